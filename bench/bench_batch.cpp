@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file    bench_batch.cpp
+  * @brief   cnn() one image at a time vs cnn_batch() throughput
+  *
+  * Builds a set of inputs from the reference signs and every 32x32 crop of
+  * trafficsign3, runs it through cnn() image by image and through
+  * cnn_batch(), checks that both give identical outputs and reports the
+  * throughput of each in images/s.
+  *
+  * Usage: bench_batch [iterations]
+  */
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+// trafficsign1, trafficsign2 and the 12 x 12 crops of trafficsign3
+#define IMAGES (2 + 12 * 12)
+
+static input_t inputs[IMAGES];
+static output_t single[IMAGES], batched[IMAGES];
+
+static void build_inputs() {
+  unsigned short crop[32 * 32];
+  size_t n = 0;
+
+  pixelProcess32(trafficsign1, inputs[n++]);
+  pixelProcess32(trafficsign2, inputs[n++]);
+  for (int oy = 0; oy + 32 <= 43; oy++) {
+    for (int ox = 0; ox + 32 <= 43; ox++) {
+      for (int i = 0; i < 32; i++) {
+        memcpy(&crop[i * 32], &trafficsign3[(oy + i) * 43 + ox], 32 * sizeof(crop[0]));
+      }
+      pixelProcess32(crop, inputs[n++]);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 20);
+  build_inputs();
+
+  bench::Stats one = bench::measure([] {
+    for (size_t i = 0; i < IMAGES; i++) {
+      cnn(inputs[i], single[i]);
+    }
+  }, iterations, 2);
+  bench::Stats batch = bench::measure([] {
+    cnn_batch(inputs, batched, IMAGES);
+  }, iterations, 2);
+
+  if (memcmp(single, batched, sizeof(single)) != 0) {
+    fprintf(stderr, "MISMATCH: cnn_batch outputs differ from cnn\n");
+    return 1;
+  }
+  printf("%d images: cnn_batch outputs identical to cnn\n", IMAGES);
+
+  bench::print_stats("cnn x N", one);
+  bench::print_stats("cnn_batch", batch);
+  printf("throughput: cnn %.1f images/s, cnn_batch (CNN_BATCH_SIZE=%d) %.1f images/s, x%.2f\n",
+         IMAGES * 1e6 / one.mean_us(), CNN_BATCH_SIZE,
+         IMAGES * 1e6 / batch.mean_us(), one.mean_us() / batch.mean_us());
+  return 0;
+}
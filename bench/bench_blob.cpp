@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * @file    bench_blob.cpp
+  * @brief   Compiled network vs the same network interpreted from a model
+  *          blob (nn_blob.h) mapped with blob_map.h
+  *
+  * Checks that modelBlobRun() reproduces the outputs of the compiled cnn()
+  * on the three reference signs, and that cnn()/cnn_batch() run it once
+  * activated, then times both, the opening of the blob (CRC-32 and
+  * descriptor checks) and the rejection of corrupted copies.
+  * A blob exported with --fold matches a build with -DWITH_BN_FOLDING.
+  *
+  * The compiled layers have their shapes as constants, the interpreted
+  * ones read them from the descriptors and gather each conv2d window into
+  * a patch first. The ratio printed is the whole cost of interpreting; a
+  * build with -fno-tree-vectorize shows it without the host's vectorizer.
+  *
+  * Usage: bench_blob [iterations] [model.bin]
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+#include "blob_map.h"
+
+#include "bench_common.h"
+
+#ifndef WITH_MODEL_BLOB
+#error "bench_blob needs -DWITH_MODEL_BLOB"
+#endif
+
+static input_t inputs[3];
+static output_t compiled[3], interpreted[3];
+static int16_t scratch[2 * 4096] NN_ALIGNED;
+
+static blob_map_t map;
+static model_blob_t model;
+static volatile int open_status;
+
+// Open a modified copy of the blob and check the status it is rejected with
+static int reject(const char *name, void (*corrupt)(uint8_t *, size_t), int expected) {
+  uint8_t *copy = (uint8_t *)aligned_alloc(MODEL_BLOB_ALIGN, (map.size + MODEL_BLOB_ALIGN - 1)
+                                           & ~(size_t)(MODEL_BLOB_ALIGN - 1));
+  model_blob_t tampered;
+  memcpy(copy, map.data, map.size);
+  corrupt(copy, map.size);
+  int status = modelBlobOpen(&tampered, copy, map.size);
+  free(copy);
+  printf("  %-28s %s\n", name, modelBlobStatusName(status));
+  if (status != expected) {
+    fprintf(stderr, "MISMATCH: %s accepted as '%s', expected '%s'\n", name, modelBlobStatusName(status),
+            modelBlobStatusName(expected));
+    return 1;
+  }
+  return 0;
+}
+
+static void flip_weight(uint8_t *data, size_t size) {
+  data[size - 2] ^= 0x01;
+}
+
+static void wrong_magic(uint8_t *data, size_t) {
+  data[0] ^= 0xFF;
+}
+
+static void newer_version(uint8_t *data, size_t) {
+  data[4] += 1;
+}
+
+// A descriptor edited consistently, checksum included: only the shape
+// checks can catch it
+static void wrong_shape(uint8_t *data, size_t size) {
+  model_blob_header_t *h = (model_blob_header_t *)data;
+  model_blob_layer_t *first = (model_blob_layer_t *)(data + h->header_size);
+  first->shape.filters += 1;
+  h->checksum = modelBlobCrc32(0, data + 16, size - 16);
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 2000);
+  const char *path = argc > 2 ? argv[2] : "model.bin";
+  const uint16_t *signs[3] = {trafficsign1, trafficsign2, trafficsign3};
+  int failures = 0;
+
+  int status = blobMapOpen(&map, path, &model);
+  if (status != MODEL_BLOB_OK) {
+    fprintf(stderr, "%s: %s (run tools/export_blob.py)\n", path, modelBlobStatusName(status));
+    return 1;
+  }
+  if (modelBlobScratchSize(&model) > sizeof(scratch) / sizeof(scratch[0])) {
+    fprintf(stderr, "%s: needs %zu scratch values\n", path, modelBlobScratchSize(&model));
+    return 1;
+  }
+  printf("%s: %s, %u layers, %u bytes, %zu bytes of activations\n", path, model.header->name,
+         (unsigned int)model.header->layer_count, (unsigned int)model.header->total_size,
+         modelBlobScratchSize(&model) * sizeof(int16_t));
+
+  for (int i = 0; i < 3; i++) {
+    pixelProcess32(signs[i], inputs[i]);
+    cnn(inputs[i], compiled[i]);
+    modelBlobRun(&model, &inputs[i][0][0][0], interpreted[i], scratch);
+    if (memcmp(compiled[i], interpreted[i], sizeof(output_t)) != 0) {
+      fprintf(stderr, "MISMATCH: trafficsign%d, blob and compiled outputs differ\n", i + 1);
+      failures++;
+    }
+  }
+  if (cnnUseBlob(&model) != 0) {
+    fprintf(stderr, "MISMATCH: cnnUseBlob() rejected the blob\n");
+    failures++;
+  }
+  output_t through_cnn, through_batch[3];
+  cnn(inputs[0], through_cnn);
+  cnn_batch(inputs, through_batch, 3);
+  cnnUseBlob(NULL);
+  if (memcmp(through_cnn, interpreted[0], sizeof(output_t)) != 0) {
+    fprintf(stderr, "MISMATCH: cnn() on the blob differs from modelBlobRun()\n");
+    failures++;
+  }
+  if (memcmp(through_batch, interpreted, sizeof(through_batch)) != 0) {
+    fprintf(stderr, "MISMATCH: cnn_batch() on the blob differs from modelBlobRun()\n");
+    failures++;
+  }
+
+  bench::Stats compiled_stats = bench::measure([] { cnn(inputs[0], compiled[0]); }, iterations);
+  bench::Stats blob_stats = bench::measure([] {
+    modelBlobRun(&model, &inputs[0][0][0][0], interpreted[0], scratch);
+  }, iterations);
+  bench::Stats open_stats = bench::measure([] {
+    model_blob_t reopened;
+    open_status = modelBlobOpen(&reopened, map.data, map.size);
+  }, iterations / 10 + 1);
+
+  bench::print_stats("cnn() compiled", compiled_stats);
+  bench::print_stats("modelBlobRun()", blob_stats);
+  bench::print_stats("modelBlobOpen() incl. CRC", open_stats);
+
+  printf("corrupted copies:\n");
+  failures += reject("flipped weight bit", flip_weight, MODEL_BLOB_ERR_CHECKSUM);
+  failures += reject("wrong magic", wrong_magic, MODEL_BLOB_ERR_MAGIC);
+  failures += reject("newer format version", newer_version, MODEL_BLOB_ERR_VERSION);
+  failures += reject("first layer filters + 1", wrong_shape, MODEL_BLOB_ERR_SHAPE);
+
+  blobMapClose(&map);
+  if (!failures) {
+    printf("outputs identical, corrupted blobs rejected\n");
+  }
+  return failures ? 1 : 0;
+}
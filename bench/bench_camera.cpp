@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * @file    bench_camera.cpp
+  * @brief   Sustained FPS of the camera pipeline on the host
+  *
+  * Runs the capture -> ROI -> resample -> cnn() -> softmaxLabelQ15() loop of
+  * camera.h, like the WITH_CAMERA firmware, with the host replay backend
+  * standing in for the GC0308: a producer thread fills one frame buffer
+  * while the other is being classified. The source is a raw RGB565
+  * little-endian video, a directory of PPM images or, by default, a
+  * synthetic 320x240 frame holding trafficsign3.
+  *
+  * Reports the classified and dropped frames, the sustained FPS, the
+  * capture-to-label latency and the time spent in each stage.
+  *
+  * Usage: bench_camera [video.rgb565 | directory] [--size WxH] [--fps n]
+  *                     [--loops n] [--frames n] [--roi x,y,size]
+  *                     [--expect label]
+  *
+  * --fps paces the replay like a real sensor (late frames are dropped),
+  * 0 (default) replays as fast as the pipeline consumes. --expect makes the
+  * exit status non-zero when fewer than 90% of the frames get that label;
+  * it defaults to 26 (Forward) for the synthetic source.
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "postprocess.h"
+#include "trafficsigns.h"
+#include "camera.h"
+
+#include "bench_common.h"
+
+static input_t inputs;
+static output_t outputs;
+
+// trafficsign3 scaled x5 on a grey background, centred in a QVGA frame
+static std::vector<uint16_t> synthetic_frame() {
+  std::vector<uint16_t> frame((size_t)CAMERA_WIDTH * CAMERA_HEIGHT, 0x8410);
+  const int scale = 5, size = 43 * scale;
+  const int x0 = (CAMERA_WIDTH - size) / 2, y0 = (CAMERA_HEIGHT - size) / 2;
+  for (int y = 0; y < size; y++) {
+    for (int x = 0; x < size; x++) {
+      frame[(size_t)(y0 + y) * CAMERA_WIDTH + x0 + x] = trafficsign3[(y / scale) * 43 + x / scale];
+    }
+  }
+  return frame;
+}
+
+static int usage(const char *argv0) {
+  fprintf(stderr, "usage: %s [video.rgb565 | directory] [--size WxH] [--fps n] [--loops n] "
+                  "[--frames n] [--roi x,y,size] [--expect label]\n", argv0);
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  const char *source = NULL;
+  int width = CAMERA_WIDTH, height = CAMERA_HEIGHT;
+  double fps = 0.0;
+  int loops = 1;
+  uint32_t max_frames = 0;
+  camera_roi_t roi = {-1, -1, 0};
+  int expect = -1;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+      if (sscanf(argv[++i], "%dx%d", &width, &height) != 2) return usage(argv[0]);
+    } else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+      fps = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--loops") == 0 && i + 1 < argc) {
+      loops = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+      max_frames = strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--roi") == 0 && i + 1 < argc) {
+      if (sscanf(argv[++i], "%d,%d,%d", &roi.x, &roi.y, &roi.size) != 3) return usage(argv[0]);
+    } else if (strcmp(argv[i], "--expect") == 0 && i + 1 < argc) {
+      expect = atoi(argv[++i]);
+    } else if (argv[i][0] != '-' && source == NULL) {
+      source = argv[i];
+    } else {
+      return usage(argv[0]);
+    }
+  }
+
+  if (source != NULL) {
+    if (!cameraReplayOpen(source, width, height, fps, loops)) {
+      fprintf(stderr, "%s\n", camera_replay.error.c_str());
+      return 1;
+    }
+  } else {
+    static std::vector<uint16_t> frame = synthetic_frame();
+    cameraReplayStill(frame.data(), CAMERA_WIDTH, CAMERA_HEIGHT, max_frames ? max_frames : 300, fps);
+    if (expect < 0) expect = 26;
+  }
+  if (!cameraBegin()) {
+    return 1;
+  }
+
+  bench::Stats wait, preprocess, inference, latency;
+  size_t histogram[NBLABELS] = {0};
+  uint32_t classified = 0;
+  camera_frame_t frame;
+  uint64_t start = cameraMicros();
+
+  while ((max_frames == 0 || classified < max_frames)) {
+    uint64_t t0 = bench::now_ns();
+    if (!cameraGrab(&frame)) {
+      break;
+    }
+    if (roi.size == 0) {
+      roi = cameraCenterRoi(frame.width, frame.height);
+    }
+    uint64_t t1 = bench::now_ns();
+    if (cameraFrameToInput(&frame, &roi, inputs) != 0) {
+      fprintf(stderr, "ROI %d,%d,%d outside the %dx%d frame or wider than %d\n",
+              roi.x, roi.y, roi.size, frame.width, frame.height, CAMERA_MAX_ROI);
+      cameraRelease(&frame);
+      cameraEnd();
+      return 1;
+    }
+    uint64_t t2 = bench::now_ns();
+    cnn(inputs, outputs);
+    uint16_t confidence;
+    int label = softmaxLabelQ15(outputs, NULL, &confidence);
+    uint64_t t3 = bench::now_ns();
+    latency.add((cameraMicros() - frame.timestamp_us) * 1000);
+    cameraRelease(&frame);
+
+    wait.add(t1 - t0);
+    preprocess.add(t2 - t1);
+    inference.add(t3 - t2);
+    histogram[label]++;
+    classified++;
+  }
+  double elapsed_s = (cameraMicros() - start) / 1e6;
+  camera_stats_t stats = cameraStats();
+  cameraEnd();
+
+  if (classified == 0) {
+    fprintf(stderr, "no frame classified\n");
+    return 1;
+  }
+  printf("%s: %u frames classified, %u captured, %u dropped, ROI %d,%d,%d\n",
+         source ? source : "synthetic trafficsign3", classified, stats.frames, stats.dropped,
+         roi.x, roi.y, roi.size);
+  printf("sustained: %.1f FPS over %.2f s%s\n", classified / elapsed_s, elapsed_s,
+         fps > 0.0 ? "" : " (unpaced replay)");
+  bench::print_stats("wait for frame", wait);
+  bench::print_stats("ROI + resample", preprocess);
+  bench::print_stats("cnn + softmax", inference);
+  bench::print_stats("capture to label", latency);
+
+  int top = 0;
+  for (int i = 1; i < NBLABELS; i++) {
+    if (histogram[i] > histogram[top]) top = i;
+  }
+  printf("most frequent label: %d (%s), %zu/%u frames\n", top, labelName(top), histogram[top], classified);
+  if (expect >= 0 && expect < NBLABELS && histogram[expect] * 10 < (size_t)classified * 9) {
+    fprintf(stderr, "FAILED: label %d on %zu/%u frames\n", expect, histogram[expect], classified);
+    return 1;
+  }
+  return 0;
+}
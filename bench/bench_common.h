@@ -0,0 +1,118 @@
+/**
+  ******************************************************************************
+  * @file    bench_common.h
+  * @brief   Shared helpers for the host-native benchmarks (timing, statistics)
+  *
+  * Benches that include preprocess.h and trafficsigns.h before this header
+  * also get the three reference signs with their expected labels.
+  */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace bench {
+
+typedef std::chrono::steady_clock clock;
+
+static inline uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      clock::now().time_since_epoch()).count();
+}
+
+// Latency samples in nanoseconds
+struct Stats {
+  std::vector<uint64_t> samples;
+
+  void add(uint64_t ns) { samples.push_back(ns); }
+
+  size_t count() const { return samples.size(); }
+
+  double mean_us() const {
+    if (samples.empty()) return 0.0;
+    double sum = 0.0;
+    for (uint64_t s : samples) sum += (double)s;
+    return sum / samples.size() / 1000.0;
+  }
+
+  // Nearest-rank percentile, p in [0, 100]
+  double percentile_us(double p) const {
+    if (samples.empty()) return 0.0;
+    std::vector<uint64_t> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+    size_t rank = (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[rank] / 1000.0;
+  }
+
+  double min_us() const {
+    if (samples.empty()) return 0.0;
+    return *std::min_element(samples.begin(), samples.end()) / 1000.0;
+  }
+};
+
+// Runs fn() iterations times after a short warm-up and records each call
+template <typename Fn>
+static inline Stats measure(Fn fn, size_t iterations, size_t warmup = 16) {
+  Stats stats;
+  for (size_t i = 0; i < warmup; i++) fn();
+  for (size_t i = 0; i < iterations; i++) {
+    uint64_t start = now_ns();
+    fn();
+    stats.add(now_ns() - start);
+  }
+  return stats;
+}
+
+static inline void print_stats(FILE *f, const char *name, const Stats &stats) {
+  fprintf(f, "%-28s n=%-6zu mean=%9.2f us  p50=%9.2f us  p99=%9.2f us  min=%9.2f us\n",
+          name, stats.count(), stats.mean_us(), stats.percentile_us(50),
+          stats.percentile_us(99), stats.min_us());
+}
+
+static inline void print_stats(const char *name, const Stats &stats) {
+  print_stats(stdout, name, stats);
+}
+
+static inline size_t iterations_from_args(int argc, char **argv, size_t fallback) {
+  if (argc > 1) {
+    long n = strtol(argv[1], NULL, 0);
+    if (n > 0) return (size_t)n;
+  }
+  return fallback;
+}
+
+#if defined(PREPROCESS_H) && defined(TRAFFICSIGNS_H)
+struct Sign {
+  const char *name;
+  const unsigned short *pixels;
+  int size;
+  int expected_label;
+};
+
+static const Sign signs[] = {
+  {"trafficsign1", trafficsign1, 32, 4},  // 70 km/h
+  {"trafficsign2", trafficsign2, 32, 15}, // Slippery road
+  {"trafficsign3", trafficsign3, 43, 26}, // Forward
+};
+
+static const size_t sign_count = sizeof(signs) / sizeof(signs[0]);
+
+// Preprocesses a reference sign like loop(): 43x43 signs go through pixelProcess43
+static inline void load_sign(const Sign &sign, input_t inputs) {
+  if (sign.size == 43) {
+    pixelProcess43(sign.pixels, inputs);
+  } else {
+    pixelProcess32(sign.pixels, inputs);
+  }
+}
+#endif
+
+} // namespace bench
+
+#endif // BENCH_COMMON_H
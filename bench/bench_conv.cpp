@@ -0,0 +1,84 @@
+/**
+  ******************************************************************************
+  * @file    bench_conv.cpp
+  * @brief   Reference nested-loop conv2d vs im2col + GEMM engine (conv_gemm.h)
+  *
+  * Feeds conv2d_1 (8->32 channels) and conv2d_2 (32->64 channels) with the
+  * real activations of trafficsign1, checks that both engines produce the
+  * same output and reports their latency.
+  *
+  * Usage: bench_conv [iterations]
+  */
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+static input_t inputs;
+static conv2d_output_type conv2d_out;
+static batch_normalization_output_type bn_out;
+static conv2d_1_output_type conv2d_1_ref, conv2d_1_gemm;
+static batch_normalization_1_output_type bn1_out;
+static conv2d_2_output_type conv2d_2_ref, conv2d_2_gemm;
+
+static int16_t patches[CONV_GEMM_TILE_PIXELS * 3 * 3 * 32];
+
+static const conv_shape_t conv2d_1_shape = {15, 15, 8, 32, 3, 3, 2, 2, 0, 0, 7, 7};
+static const conv_shape_t conv2d_2_shape = {7, 7, 32, 64, 3, 3, 2, 2, 0, 0, 3, 3};
+static const requant_t relu_q7 = {0, -7, 7, ROUND_MODE_FLOOR, NN_ACTIVATION_RELU, 6 << 14};
+
+static int compare(const char *name, const void *a, const void *b, size_t size) {
+  if (memcmp(a, b, size) != 0) {
+    fprintf(stderr, "MISMATCH: %s outputs differ\n", name);
+    return 1;
+  }
+  printf("%s: outputs identical\n", name);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 5000);
+  int failures = 0;
+
+  pixelProcess32(trafficsign1, inputs);
+  conv2d(inputs, conv2d_kernel, conv2d_bias, conv2d_out);
+  batch_normalization(conv2d_out, batch_normalization_kernel, batch_normalization_bias, bn_out);
+
+  bench::Stats ref1 = bench::measure([] {
+    conv2d_1(bn_out, conv2d_1_kernel, conv2d_1_bias, conv2d_1_ref);
+  }, iterations);
+  bench::Stats gemm1 = bench::measure([] {
+    conv2d_im2col_gemm_q15(&bn_out[0][0][0], &conv2d_1_kernel[0][0][0][0], conv2d_1_bias,
+                           &conv2d_1_gemm[0][0][0], patches, &conv2d_1_shape, &relu_q7);
+  }, iterations);
+  failures += compare("conv2d_1", conv2d_1_ref, conv2d_1_gemm, sizeof(conv2d_1_ref));
+
+  batch_normalization_1(conv2d_1_ref, batch_normalization_1_kernel, batch_normalization_1_bias, bn1_out);
+
+  bench::Stats ref2 = bench::measure([] {
+    conv2d_2(bn1_out, conv2d_2_kernel, conv2d_2_bias, conv2d_2_ref);
+  }, iterations);
+  bench::Stats gemm2 = bench::measure([] {
+    conv2d_im2col_gemm_q15(&bn1_out[0][0][0], &conv2d_2_kernel[0][0][0][0], conv2d_2_bias,
+                           &conv2d_2_gemm[0][0][0], patches, &conv2d_2_shape, &relu_q7);
+  }, iterations);
+  failures += compare("conv2d_2", conv2d_2_ref, conv2d_2_gemm, sizeof(conv2d_2_ref));
+
+  bench::print_stats("conv2d_1 nested loops", ref1);
+  bench::print_stats("conv2d_1 im2col+gemm", gemm1);
+  printf("  speedup x%.2f\n", ref1.mean_us() / gemm1.mean_us());
+  bench::print_stats("conv2d_2 nested loops", ref2);
+  bench::print_stats("conv2d_2 im2col+gemm", gemm2);
+  printf("  speedup x%.2f\n", ref2.mean_us() / gemm2.mean_us());
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,113 @@
+/**
+  ******************************************************************************
+  * @file    bench_convspec.cpp
+  * @brief   Reference conv2d templates vs the kernels of model_convspec.h
+  *
+  * Feeds each conv2d layer with the real activations of trafficsign1, checks
+  * that the specialised kernel (tools/specialize_conv.py) produces the same
+  * output as the template of model.h and reports both latencies per layer.
+  * On the board, compare the per-layer cycles of env:m5stack-cores3-profiling
+  * and env:m5stack-cores3-convspec.
+  *
+  * Usage: bench_convspec [iterations]
+  */
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "model_convspec.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+static input_t inputs;
+static conv2d_output_type conv2d_ref, conv2d_spec;
+static batch_normalization_output_type bn_out;
+static conv2d_1_output_type conv2d_1_ref, conv2d_1_spec;
+static batch_normalization_1_output_type bn1_out;
+static conv2d_2_output_type conv2d_2_ref, conv2d_2_spec;
+static batch_normalization_2_output_type bn2_out;
+static conv2d_3_output_type conv2d_3_ref, conv2d_3_spec;
+
+// Every conv2d of the network: Q7 in, Q7 weights and biases, ReLU
+static const requant_t relu_q7 = {0, -7, 7, ROUND_MODE_FLOOR, NN_ACTIVATION_RELU, 6 << 14};
+
+struct Result {
+  const char *name;
+  bench::Stats ref;
+  bench::Stats spec;
+};
+
+static int compare(const char *name, const void *a, const void *b, size_t size) {
+  if (memcmp(a, b, size) != 0) {
+    fprintf(stderr, "MISMATCH: %s outputs differ\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 5000);
+  int failures = 0;
+  Result results[4];
+
+  pixelProcess32(trafficsign1, inputs);
+
+  results[0] = {"conv2d",
+    bench::measure([] { conv2d(inputs, conv2d_kernel, conv2d_bias, conv2d_ref); }, iterations),
+    bench::measure([] {
+      conv2d_specialized(&inputs[0][0][0], &conv2d_kernel[0][0][0][0], conv2d_bias,
+                         &conv2d_spec[0][0][0], &relu_q7);
+    }, iterations)};
+  failures += compare("conv2d", conv2d_ref, conv2d_spec, sizeof(conv2d_ref));
+  batch_normalization(conv2d_ref, batch_normalization_kernel, batch_normalization_bias, bn_out);
+
+  results[1] = {"conv2d_1",
+    bench::measure([] { conv2d_1(bn_out, conv2d_1_kernel, conv2d_1_bias, conv2d_1_ref); }, iterations),
+    bench::measure([] {
+      conv2d_1_specialized(&bn_out[0][0][0], &conv2d_1_kernel[0][0][0][0], conv2d_1_bias,
+                           &conv2d_1_spec[0][0][0], &relu_q7);
+    }, iterations)};
+  failures += compare("conv2d_1", conv2d_1_ref, conv2d_1_spec, sizeof(conv2d_1_ref));
+  batch_normalization_1(conv2d_1_ref, batch_normalization_1_kernel, batch_normalization_1_bias, bn1_out);
+
+  results[2] = {"conv2d_2",
+    bench::measure([] { conv2d_2(bn1_out, conv2d_2_kernel, conv2d_2_bias, conv2d_2_ref); }, iterations),
+    bench::measure([] {
+      conv2d_2_specialized(&bn1_out[0][0][0], &conv2d_2_kernel[0][0][0][0], conv2d_2_bias,
+                           &conv2d_2_spec[0][0][0], &relu_q7);
+    }, iterations)};
+  failures += compare("conv2d_2", conv2d_2_ref, conv2d_2_spec, sizeof(conv2d_2_ref));
+  batch_normalization_2(conv2d_2_ref, batch_normalization_2_kernel, batch_normalization_2_bias, bn2_out);
+
+  results[3] = {"conv2d_3",
+    bench::measure([] { conv2d_3(bn2_out, conv2d_3_kernel, conv2d_3_bias, conv2d_3_ref); }, iterations),
+    bench::measure([] {
+      conv2d_3_specialized(&bn2_out[0][0][0], &conv2d_3_kernel[0][0][0][0], conv2d_3_bias,
+                           &conv2d_3_spec[0][0][0], &relu_q7);
+    }, iterations)};
+  failures += compare("conv2d_3", conv2d_3_ref, conv2d_3_spec, sizeof(conv2d_3_ref));
+
+  double total_ref = 0.0, total_spec = 0.0;
+  for (const Result &r : results) {
+    char label[64];
+    snprintf(label, sizeof(label), "%s template", r.name);
+    bench::print_stats(label, r.ref);
+    snprintf(label, sizeof(label), "%s specialised", r.name);
+    bench::print_stats(label, r.spec);
+    printf("  speedup x%.2f\n", r.ref.mean_us() / r.spec.mean_us());
+    total_ref += r.ref.mean_us();
+    total_spec += r.spec.mean_us();
+  }
+  printf("all conv2d: %.2f us -> %.2f us, speedup x%.2f\n", total_ref, total_spec, total_ref / total_spec);
+  if (!failures) {
+    printf("outputs identical on every layer\n");
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,76 @@
+/**
+  ******************************************************************************
+  * @file    bench_dual_core.cpp
+  * @brief   Single-core vs dual-core cnn() (dual_core.h)
+  *
+  * Built with -DWITH_DUAL_CORE. Runs the three reference signs with the
+  * layers on the calling thread only (dual_core_set_enabled(0)) and split
+  * between two threads, checks that both modes produce identical outputs
+  * and the expected labels, and reports the latency of each mode.
+  *
+  * Usage: bench_dual_core [iterations]
+  */
+
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "postprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+#ifndef WITH_DUAL_CORE
+#error "bench_dual_core needs -DWITH_DUAL_CORE"
+#endif
+
+static input_t inputs;
+static output_t outputs;
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 2000);
+  int failures = 0;
+
+  bench::Stats single, dual;
+  for (const bench::Sign &sign : bench::signs) {
+    bench::load_sign(sign, inputs);
+
+    dual_core_set_enabled(0);
+    bench::Stats s = bench::measure([] { cnn(inputs, outputs); }, iterations);
+    output_t reference;
+    memcpy(reference, outputs, sizeof(reference));
+
+    dual_core_set_enabled(1);
+    bench::Stats d = bench::measure([] { cnn(inputs, outputs); }, iterations);
+
+    if (memcmp(reference, outputs, sizeof(reference)) != 0) {
+      fprintf(stderr, "MISMATCH: %s dual-core outputs differ\n", sign.name);
+      failures++;
+    }
+    float confidence;
+    int label = softmaxLabel(outputs, &confidence);
+    if (label != sign.expected_label) {
+      fprintf(stderr, "REGRESSION: %s predicted %d, expected %d\n",
+              sign.name, label, sign.expected_label);
+      failures++;
+    }
+    printf("%s: -> %s, single %.1f us, dual %.1f us\n",
+           sign.name, labelName(label), s.mean_us(), d.mean_us());
+
+    single.samples.insert(single.samples.end(), s.samples.begin(), s.samples.end());
+    dual.samples.insert(dual.samples.end(), d.samples.begin(), d.samples.end());
+  }
+
+  bench::print_stats("cnn single core", single);
+  bench::print_stats("cnn dual core", dual);
+  printf("  speedup x%.2f (layers below %d MACs stay on one core, %u hardware threads)\n",
+         single.mean_us() / dual.mean_us(), DUAL_CORE_MIN_MACS, std::thread::hardware_concurrency());
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,113 @@
+/**
+  ******************************************************************************
+  * @file    bench_fused.cpp
+  * @brief   pixelProcess32 + cnn() vs the fused RGB565 first layer
+  *
+  * On trafficsign1, trafficsign2 and every 32x32 window of trafficsign3:
+  *  - checks that cnnRGB565() gives the same outputs as rgb565FrameToInput()
+  *    followed by cnn();
+  *  - times the first layer alone (unpack + conv2d vs conv2d_rgb565) and
+  *    the whole inference both ways.
+  * Exits with a non-zero status on any output mismatch.
+  *
+  * Usage: bench_fused [iterations]
+  */
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+struct Window {
+  const unsigned short *frame;
+  int width, x0, y0;
+};
+
+// trafficsign1, trafficsign2 and the 12 x 12 windows of trafficsign3
+#define WINDOWS (2 + 12 * 12)
+
+static Window windows[WINDOWS];
+static input_t inputs;
+static output_t separate, fused;
+static conv2d_output_type first_separate, first_fused;
+
+static void build_windows() {
+  size_t n = 0;
+  windows[n++] = {trafficsign1, 32, 0, 0};
+  windows[n++] = {trafficsign2, 32, 0, 0};
+  for (int oy = 0; oy + 32 <= 43; oy++) {
+    for (int ox = 0; ox + 32 <= 43; ox++) {
+      windows[n++] = {trafficsign3, 43, ox, oy};
+    }
+  }
+}
+
+static int check() {
+  int mismatches = 0;
+  for (const Window &w : windows) {
+    rgb565FrameToInput(w.frame, w.width, w.x0, w.y0, inputs);
+    cnn(inputs, separate);
+    cnnRGB565(w.frame, w.width, w.x0, w.y0, fused);
+
+    conv2d(inputs, conv2d_kernel, conv2d_bias, first_separate);
+    conv2d_rgb565(&w.frame[w.y0 * w.width + w.x0], w.width, PREPROCESS_LUT5, PREPROCESS_LUT6,
+                  conv2d_kernel, conv2d_bias, first_fused);
+    if (memcmp(separate, fused, sizeof(fused)) != 0
+        || memcmp(first_separate, first_fused, sizeof(first_fused)) != 0) {
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 2000);
+  build_windows();
+
+  int mismatches = check();
+  if (mismatches != 0) {
+    fprintf(stderr, "MISMATCH: %d/%d windows differ between cnnRGB565 and pixelProcess + cnn\n",
+            mismatches, WINDOWS);
+    return 1;
+  }
+  printf("%d windows: cnnRGB565 outputs identical to rgb565FrameToInput + cnn\n", WINDOWS);
+  printf("first layer input: input_t %zu bytes, fused row ring %zu bytes\n", sizeof(input_t),
+         (size_t)3 * 32 * 3 * sizeof(int16_t));
+
+  static size_t next = 0;
+  bench::Stats layer = bench::measure([] {
+    const Window &w = windows[next++ % WINDOWS];
+    rgb565FrameToInput(w.frame, w.width, w.x0, w.y0, inputs);
+    conv2d(inputs, conv2d_kernel, conv2d_bias, first_separate);
+  }, iterations * 10);
+  bench::Stats layer_fused = bench::measure([] {
+    const Window &w = windows[next++ % WINDOWS];
+    conv2d_rgb565(&w.frame[w.y0 * w.width + w.x0], w.width, PREPROCESS_LUT5, PREPROCESS_LUT6,
+                  conv2d_kernel, conv2d_bias, first_fused);
+  }, iterations * 10);
+  bench::Stats full = bench::measure([] {
+    const Window &w = windows[next++ % WINDOWS];
+    rgb565FrameToInput(w.frame, w.width, w.x0, w.y0, inputs);
+    cnn(inputs, separate);
+  }, iterations);
+  bench::Stats full_fused = bench::measure([] {
+    const Window &w = windows[next++ % WINDOWS];
+    cnnRGB565(w.frame, w.width, w.x0, w.y0, fused);
+  }, iterations);
+
+  bench::print_stats("unpack + conv2d", layer);
+  bench::print_stats("conv2d_rgb565", layer_fused);
+  printf("  first layer speedup x%.2f\n", layer.mean_us() / layer_fused.mean_us());
+  bench::print_stats("pixelProcess + cnn", full);
+  bench::print_stats("cnnRGB565", full_fused);
+  printf("  inference speedup x%.2f\n", full.mean_us() / full_fused.mean_us());
+  return 0;
+}
@@ -0,0 +1,244 @@
+/**
+  ******************************************************************************
+  * @file    bench_gtsrb.cpp
+  * @brief   Dataset-wide accuracy and throughput benchmark
+  *
+  * Streams a packed file or a directory of labelled images (see
+  * gtsrb_dataset.h) through pixelProcess32/pixelProcess43, cnn() and
+  * softmaxLabelQ15(), exactly like loop() does, and reports top-1 accuracy over
+  * the 28 labels of postprocess.h, the p50/p99 latency of one image and the
+  * throughput. File I/O is excluded from the timings.
+  *
+  * Usage: bench_gtsrb <dataset.bin | directory> [--json <file|->]
+  *                    [--limit <n>] [--min-accuracy <percent>]
+  *
+  * --json writes the results as a JSON object, to track them over commits;
+  * with `--json -` it is written to stdout and the text summary to stderr.
+  * --min-accuracy makes the exit status non-zero below the given top-1.
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "postprocess.h"
+
+#include "bench_common.h"
+#include "gtsrb_dataset.h"
+
+static input_t inputs;
+static output_t outputs;
+
+struct Results {
+  size_t images = 0;
+  size_t correct = 0;
+  size_t skipped = 0;
+  size_t per_class_total[NBLABELS] = {0};
+  size_t per_class_correct[NBLABELS] = {0};
+  bench::Stats preprocess;
+  bench::Stats inference;
+  bench::Stats total;
+  double elapsed_us = 0.0;
+
+  double accuracy() const { return images ? 100.0 * correct / images : 0.0; }
+  double images_per_s() const { return elapsed_us > 0.0 ? images * 1e6 / elapsed_us : 0.0; }
+};
+
+template <typename Reader>
+static bool run(Reader &reader, size_t limit, Results &r) {
+  gtsrb::Sample sample;
+  while ((limit == 0 || r.images < limit) && reader.next(sample)) {
+    if (sample.label < 0 || sample.label >= NBLABELS) {
+      r.skipped++;
+      continue;
+    }
+
+    uint64_t start = bench::now_ns();
+    if (sample.size == 43) {
+      pixelProcess43(sample.pixels.data(), inputs);
+    } else {
+      pixelProcess32(sample.pixels.data(), inputs);
+    }
+    uint64_t preprocessed = bench::now_ns();
+    cnn(inputs, outputs);
+    uint64_t inferred = bench::now_ns();
+    uint16_t confidence;
+    int label = softmaxLabelQ15(outputs, NULL, &confidence);
+    uint64_t end = bench::now_ns();
+
+    r.preprocess.add(preprocessed - start);
+    r.inference.add(inferred - preprocessed);
+    r.total.add(end - start);
+    r.elapsed_us += (end - start) / 1000.0;
+
+    r.images++;
+    r.per_class_total[sample.label]++;
+    if (label == sample.label) {
+      r.correct++;
+      r.per_class_correct[sample.label]++;
+    }
+  }
+  if (!reader.error().empty()) {
+    fprintf(stderr, "%s\n", reader.error().c_str());
+    return false;
+  }
+  return true;
+}
+
+static const char *config() {
+  return ""
+#ifdef WITH_IM2COL_GEMM
+    " WITH_IM2COL_GEMM"
+#endif
+#ifdef WITH_BN_FOLDING
+    " WITH_BN_FOLDING"
+#endif
+#ifdef WITH_SIMD
+    " WITH_SIMD"
+#endif
+#ifdef WITH_SIMD_EMULATION
+    " WITH_SIMD_EMULATION"
+#endif
+#ifdef WITH_DUAL_CORE
+    " WITH_DUAL_CORE"
+#endif
+#if PREPROCESS_NORMALIZATION == PREPROCESS_NORM_UNIT
+    " PREPROCESS_NORMALIZATION=UNIT"
+#endif
+#ifdef PREPROCESS_43_CROP
+    " PREPROCESS_43_CROP"
+#elif PREPROCESS_43_FILTER == RESAMPLE_BILINEAR
+    " PREPROCESS_43_FILTER=BILINEAR"
+#endif
+#ifdef WITH_MEMORY_PLAN
+    " WITH_MEMORY_PLAN"
+#endif
+#ifdef WITH_INT8
+    " WITH_INT8"
+#endif
+#ifdef WITH_SPECIALIZED_CONV
+    " WITH_SPECIALIZED_CONV"
+#endif
+#ifdef WITH_PACKED_WEIGHTS
+    " WITH_PACKED_WEIGHTS"
+#endif
+#ifdef WITH_PLACEMENT
+    " WITH_PLACEMENT"
+#endif
+#ifdef WITH_WEIGHT_STREAM
+    " WITH_WEIGHT_STREAM"
+#endif
+#ifdef WITH_MODEL_BLOB
+    " WITH_MODEL_BLOB"
+#endif
+    ;
+}
+
+static void print_latency_json(FILE *f, const char *name, const bench::Stats &s, bool last) {
+  fprintf(f, "    \"%s\": {\"mean\": %.3f, \"p50\": %.3f, \"p99\": %.3f, \"min\": %.3f}%s\n",
+          name, s.mean_us(), s.percentile_us(50), s.percentile_us(99), s.min_us(), last ? "" : ",");
+}
+
+static void write_json(FILE *f, const char *dataset, const Results &r) {
+  std::string escaped;
+  for (const char *c = dataset; *c; c++) {
+    if (*c == '"' || *c == '\\') escaped += '\\';
+    escaped += *c;
+  }
+  const char *flags = config();
+  fprintf(f, "{\n");
+  fprintf(f, "  \"dataset\": \"%s\",\n", escaped.c_str());
+  fprintf(f, "  \"config\": \"%s\",\n", flags[0] ? flags + 1 : "");
+  fprintf(f, "  \"images\": %zu,\n", r.images);
+  fprintf(f, "  \"skipped\": %zu,\n", r.skipped);
+  fprintf(f, "  \"correct\": %zu,\n", r.correct);
+  fprintf(f, "  \"top1\": %.4f,\n", r.accuracy() / 100.0);
+  fprintf(f, "  \"images_per_s\": %.1f,\n", r.images_per_s());
+  fprintf(f, "  \"latency_us\": {\n");
+  print_latency_json(f, "preprocess", r.preprocess, false);
+  print_latency_json(f, "inference", r.inference, false);
+  print_latency_json(f, "total", r.total, true);
+  fprintf(f, "  },\n");
+  fprintf(f, "  \"per_class\": [\n");
+  for (int i = 0; i < NBLABELS; i++) {
+    fprintf(f, "    {\"label\": %d, \"name\": \"%s\", \"images\": %zu, \"correct\": %zu}%s\n",
+            i, labelName(i), r.per_class_total[i], r.per_class_correct[i], i + 1 < NBLABELS ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+}
+
+static int usage(const char *argv0) {
+  fprintf(stderr, "usage: %s <dataset.bin | directory> [--json <file|->] [--limit <n>] "
+                  "[--min-accuracy <percent>]\n", argv0);
+  return 2;
+}
+
+int main(int argc, char **argv) {
+  const char *dataset = NULL;
+  const char *json = NULL;
+  size_t limit = 0;
+  double min_accuracy = -1.0;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+      json = argv[++i];
+    } else if (strcmp(argv[i], "--limit") == 0 && i + 1 < argc) {
+      limit = strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--min-accuracy") == 0 && i + 1 < argc) {
+      min_accuracy = atof(argv[++i]);
+    } else if (argv[i][0] != '-' && dataset == NULL) {
+      dataset = argv[i];
+    } else {
+      return usage(argv[0]);
+    }
+  }
+  if (dataset == NULL) {
+    return usage(argv[0]);
+  }
+
+  Results r;
+  bool ok;
+  if (gtsrb::is_directory(dataset)) {
+    gtsrb::DirectoryReader reader(dataset);
+    ok = run(reader, limit, r);
+  } else {
+    gtsrb::PackedReader reader(dataset);
+    ok = run(reader, limit, r);
+  }
+  if (!ok || r.images == 0) {
+    fprintf(stderr, "no images evaluated\n");
+    return 1;
+  }
+
+  // With --json - stdout carries the JSON only, the summary goes to stderr
+  FILE *report = json != NULL && strcmp(json, "-") == 0 ? stderr : stdout;
+  fprintf(report, "%s: %zu images (%zu with an unknown label skipped)\n", dataset, r.images, r.skipped);
+  fprintf(report, "top-1 accuracy: %.2f%% (%zu/%zu)\n", r.accuracy(), r.correct, r.images);
+  bench::print_stats(report, "preprocess", r.preprocess);
+  bench::print_stats(report, "cnn", r.inference);
+  bench::print_stats(report, "image (pre+cnn+softmax)", r.total);
+  fprintf(report, "throughput: %.1f images/s\n", r.images_per_s());
+
+  if (json != NULL) {
+    FILE *f = strcmp(json, "-") == 0 ? stdout : fopen(json, "w");
+    if (f == NULL) {
+      perror(json);
+      return 1;
+    }
+    write_json(f, dataset, r);
+    if (f != stdout) fclose(f);
+  }
+
+  if (min_accuracy >= 0.0 && r.accuracy() < min_accuracy) {
+    fprintf(stderr, "REGRESSION: top-1 %.2f%% below %.2f%%\n", r.accuracy(), min_accuracy);
+    return 1;
+  }
+  return 0;
+}
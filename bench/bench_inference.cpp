@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @file    bench_inference.cpp
+  * @brief   Host-native inference throughput benchmark and regression check
+  *
+  * Runs the three reference signs of trafficsigns.h through the same
+  * preprocessing, cnn() and fixed-point softmax code as the firmware and reports latency
+  * and throughput. Exits with a non-zero status if a predicted label changes.
+  * Built with -DWITH_LAYER_PROFILING it also prints the mean time per layer.
+  *
+  * Usage: bench_inference [iterations]
+  */
+
+#include <cstdio>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "postprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+static input_t inputs;
+static output_t outputs;
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 2000);
+  int failures = 0;
+
+  bench::Stats all;
+  for (const bench::Sign &sign : bench::signs) {
+    bench::load_sign(sign, inputs);
+    bench::Stats stats = bench::measure([] { cnn(inputs, outputs); }, iterations);
+    bench::print_stats(sign.name, stats);
+    all.samples.insert(all.samples.end(), stats.samples.begin(), stats.samples.end());
+
+    uint16_t confidence;
+    int label = softmaxLabelQ15(outputs, NULL, &confidence);
+    printf("  -> %s (%.2f%%)\n", labelName(label), confidence * 100.0 / SOFTMAX_ONE);
+    if (label != sign.expected_label) {
+      fprintf(stderr, "REGRESSION: %s predicted %d, expected %d\n",
+              sign.name, label, sign.expected_label);
+      failures++;
+    }
+  }
+
+  bench::Stats pre = bench::measure([] { bench::load_sign(bench::signs[0], inputs); }, iterations);
+  bench::print_stats("pixelProcess32", pre);
+
+  bench::print_stats("cnn (all signs)", all);
+  printf("throughput: %.1f images/s\n", 1e6 / all.mean_us());
+
+#ifdef WITH_LAYER_PROFILING
+  printf("\nmean per layer [%s]:\n", PROFILER_TICK_UNIT);
+  for (unsigned int i = 0; i < CNN_LAYERS; i++) {
+    printf("  %-24s %10u\n", cnn_profile_layer_name(i), (unsigned int)cnn_profile_mean_ticks(i));
+  }
+#endif
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,188 @@
+/**
+  ******************************************************************************
+  * @file    bench_int8.cpp
+  * @brief   int16 network of model.h vs int8 network of model_int8.h
+  *
+  * Runs both networks on the same inputs and reports, for each, the top-1
+  * accuracy, the latency of one inference and the bytes of weight tables
+  * (flash), plus the top-1 agreement and the largest logit deviation of
+  * the int8 network. Inputs are the reference signs and every 32x32 crop of
+  * trafficsign3, or a dataset (see gtsrb_dataset.h) given on the command line.
+  *
+  * On the host, -O2 auto-vectorizes the fixed-size int16 loops of model.h
+  * but not the int8 ones; build with -fno-tree-vectorize for a latency
+  * ratio closer to the scalar code of the ESP32-S3.
+  *
+  * Usage: bench_int8 [dataset.bin | directory] [--limit n] [--repeat n]
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "model_int8.h"
+#include "preprocess.h"
+#include "postprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+#include "gtsrb_dataset.h"
+
+struct Input {
+  int label;
+  input_t x;
+};
+
+static void add(std::vector<Input> &set, int label, int size, const unsigned short *pixels) {
+  set.emplace_back();
+  set.back().label = label;
+  if (size == 43) {
+    pixelProcess43(pixels, set.back().x);
+  } else {
+    pixelProcess32(pixels, set.back().x);
+  }
+}
+
+static void reference_set(std::vector<Input> &set) {
+  add(set, 4, 32, trafficsign1);
+  add(set, 15, 32, trafficsign2);
+  add(set, 26, 43, trafficsign3);
+  unsigned short crop[32 * 32];
+  for (int oy = 0; oy + 32 <= 43; oy++) {
+    for (int ox = 0; ox + 32 <= 43; ox++) {
+      for (int i = 0; i < 32; i++) {
+        memcpy(crop + i * 32, trafficsign3 + (oy + i) * 43 + ox, 32 * sizeof(unsigned short));
+      }
+      add(set, 26, 32, crop);
+    }
+  }
+}
+
+template <typename Reader>
+static void dataset_set(Reader &reader, size_t limit, std::vector<Input> &set) {
+  gtsrb::Sample sample;
+  while ((limit == 0 || set.size() < limit) && reader.next(sample)) {
+    if (sample.label >= 0 && sample.label < NBLABELS) {
+      add(set, sample.label, sample.size, sample.pixels.data());
+    }
+  }
+}
+
+struct Network {
+  const char *name;
+  void (*run)(const input_t, output_t);
+  size_t weight_bytes;
+  size_t correct = 0;
+  bench::Stats latency;
+};
+
+static void run_int16(const input_t x, output_t out) {
+  cnn(x, out);
+}
+
+static void run_int8(const input_t x, output_t out) {
+  cnn_int8(x, out);
+}
+
+int main(int argc, char **argv) {
+  const char *dataset = NULL;
+  size_t limit = 0;
+  int repeat = 20;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--limit") == 0 && i + 1 < argc) {
+      limit = strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc) {
+      repeat = atoi(argv[++i]);
+    } else if (argv[i][0] != '-' && dataset == NULL) {
+      dataset = argv[i];
+    } else {
+      fprintf(stderr, "usage: %s [dataset.bin | directory] [--limit n] [--repeat n]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::vector<Input> set;
+  if (dataset == NULL) {
+    reference_set(set);
+  } else if (gtsrb::is_directory(dataset)) {
+    gtsrb::DirectoryReader reader(dataset);
+    dataset_set(reader, limit, set);
+  } else {
+    gtsrb::PackedReader reader(dataset);
+    dataset_set(reader, limit, set);
+  }
+  if (set.empty()) {
+    fprintf(stderr, "no images\n");
+    return 1;
+  }
+
+  Network nets[2] = {
+    {"int16", run_int16,
+     sizeof(conv2d_kernel) + sizeof(conv2d_bias)
+     + sizeof(batch_normalization_kernel) + sizeof(batch_normalization_bias)
+     + sizeof(conv2d_1_kernel) + sizeof(conv2d_1_bias)
+     + sizeof(batch_normalization_1_kernel) + sizeof(batch_normalization_1_bias)
+     + sizeof(conv2d_2_kernel) + sizeof(conv2d_2_bias)
+     + sizeof(batch_normalization_2_kernel) + sizeof(batch_normalization_2_bias)
+     + sizeof(conv2d_3_kernel) + sizeof(conv2d_3_bias)
+     + sizeof(dense_kernel) + sizeof(dense_bias)
+     + sizeof(dense_1_kernel) + sizeof(dense_1_bias), 0, bench::Stats()},
+    {"int8", run_int8,
+#define INT8_TABLES(layer) \
+     sizeof(layer##_int8_kernel) + sizeof(layer##_int8_bias) \
+     + sizeof(layer##_int8_multiplier) + sizeof(layer##_int8_shift)
+     INT8_TABLES(conv2d) + INT8_TABLES(conv2d_1) + INT8_TABLES(conv2d_2)
+     + INT8_TABLES(conv2d_3) + INT8_TABLES(dense) + INT8_TABLES(dense_1), 0, bench::Stats()},
+#undef INT8_TABLES
+  };
+
+  size_t agree = 0;
+  int max_dev = 0;
+  double total_dev = 0.0;
+  for (const Input &in : set) {
+    output_t out[2];
+    int label[2];
+    for (int n = 0; n < 2; n++) {
+      nets[n].run(in.x, out[n]);
+      label[n] = argmaxLabel(out[n]);
+      nets[n].correct += label[n] == in.label;
+    }
+    agree += label[0] == label[1];
+    for (int i = 0; i < NBLABELS; i++) {
+      int dev = abs(out[0][i] - out[1][i]);
+      max_dev = dev > max_dev ? dev : max_dev;
+      total_dev += dev;
+    }
+  }
+
+  // Latency, both networks interleaved image by image
+  for (int r = 0; r < repeat; r++) {
+    for (const Input &in : set) {
+      for (Network &net : nets) {
+        output_t out;
+        uint64_t start = bench::now_ns();
+        net.run(in.x, out);
+        net.latency.add(bench::now_ns() - start);
+      }
+    }
+  }
+
+  printf("%s: %zu images\n", dataset ? dataset : "reference signs + trafficsign3 crops", set.size());
+  for (const Network &net : nets) {
+    printf("%-6s top-1 %6.2f%% (%zu/%zu)  weights %7zu bytes\n", net.name,
+           100.0 * net.correct / set.size(), net.correct, set.size(), net.weight_bytes);
+    bench::print_stats(net.name, net.latency);
+  }
+  printf("int8 vs int16: top-1 agreement %zu/%zu, logits max |deviation| %d LSB, mean %.3f LSB\n",
+         agree, set.size(), max_dev, total_dev / (set.size() * NBLABELS));
+  printf("int8/int16: weights x%.2f, latency x%.2f\n",
+         (double)nets[1].weight_bytes / nets[0].weight_bytes,
+         nets[1].latency.mean_us() / nets[0].latency.mean_us());
+  return 0;
+}
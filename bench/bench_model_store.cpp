@@ -0,0 +1,193 @@
+/**
+  ******************************************************************************
+  * @file    bench_model_store.cpp
+  * @brief   Model hot-swap through the two slots of model_store.h, with the
+  *          partitions simulated in a file
+  *
+  * Uploads model.bin chunk by chunk with an inference between chunks,
+  * commits it and checks that cnn() switched to it, then renames it to get
+  * a second model and swaps again into the other slot. Along the way it
+  * checks what must not change the running model: a chunk at the wrong
+  * offset, an early commit, a corrupted upload, a blob refused by
+  * activate(), and an upload cut by a "reset" (the store is closed and
+  * reopened halfway), after which the newest committed slot boots.
+  *
+  * The store file is flash-like (writes only clear bits): a sector written
+  * twice without an erase would show up as a checksum error.
+  *
+  * Usage: bench_model_store [iterations] [model.bin] [store file]
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+#include "model_store.h"
+
+#include "bench_common.h"
+
+#if !defined(WITH_MODEL_BLOB) || !defined(WITH_MODEL_STORE)
+#error "bench_model_store needs -DWITH_MODEL_BLOB -DWITH_MODEL_STORE"
+#endif
+
+static const uint32_t chunk = 4096;  // PROTOCOL_MODEL_CHUNK
+
+static model_store_t store;
+static input_t inputs;
+static output_t compiled, outputs;
+static int failures;
+
+static void check(bool ok, const char *what) {
+  printf("  %-44s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    failures++;
+  }
+}
+
+static int refuse(const model_blob_t *) {
+  return -1;
+}
+
+static const char *running() {
+  const model_blob_t *blob = cnnBlob();
+  return blob != NULL ? blob->header->name : "compiled";
+}
+
+// Blob with another name, its checksum updated
+static std::vector<uint8_t> renamed(const std::vector<uint8_t> &blob, const char *name) {
+  std::vector<uint8_t> copy(blob);
+  model_blob_header_t *h = (model_blob_header_t *)copy.data();
+  memset(h->name, 0, sizeof(h->name));
+  strncpy(h->name, name, sizeof(h->name) - 1);
+  h->checksum = modelBlobCrc32(0, copy.data() + 16, copy.size() - 16);
+  return copy;
+}
+
+// Chunks of [begin, end) of the blob, one inference after each; returns the
+// slowest inference in us
+static double upload(const std::vector<uint8_t> &blob, uint32_t begin, uint32_t end, int *status) {
+  double slowest = 0;
+  for (uint32_t offset = begin; offset < end; offset += chunk) {
+    uint32_t n = end - offset < chunk ? end - offset : chunk;
+    if ((*status = modelStoreWrite(&store, offset, blob.data() + offset, n)) != MODEL_STORE_OK) {
+      return slowest;
+    }
+    uint64_t start = bench::now_ns();
+    cnn(inputs, outputs);
+    double us = (bench::now_ns() - start) / 1000.0;
+    slowest = us > slowest ? us : slowest;
+  }
+  return slowest;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 20);
+  const char *path = argc > 2 ? argv[2] : "model.bin";
+  const char *store_path = argc > 3 ? argv[3] : "bench_model_store.bin";
+  int status;
+
+  FILE *f = fopen(path, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "%s: not found (run tools/export_blob.py)\n", path);
+    return 1;
+  }
+  std::vector<uint8_t> first;
+  uint8_t buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+    first.insert(first.end(), buffer, buffer + n);
+  }
+  fclose(f);
+  if (first.size() < sizeof(model_blob_header_t)) {
+    fprintf(stderr, "%s: too short\n", path);
+    return 1;
+  }
+  const char *first_name = ((const model_blob_header_t *)first.data())->name;
+  const std::vector<uint8_t> second = renamed(first, "swap-b");
+  std::vector<uint8_t> corrupted(second);
+  corrupted[corrupted.size() / 2] ^= 0x10;
+
+  pixelProcess32(trafficsign1, inputs);
+  cnn(inputs, compiled);
+  remove(store_path);
+
+  printf("empty store:\n");
+  check(modelStoreOpen(&store, store_path, cnnUseBlob) == MODEL_STORE_OK, "open");
+  check(store.active == -1 && cnnBlob() == NULL, "compiled tables at boot");
+
+  printf("upload %s (%zu bytes):\n", path, first.size());
+  check(modelStoreWrite(&store, 0, first.data(), chunk) == MODEL_STORE_ERR_STATE, "chunk before begin refused");
+  check(modelStoreBegin(&store, MODEL_STORE_SLOT_SIZE) == MODEL_STORE_ERR_SIZE, "blob larger than a slot refused");
+  check(modelStoreBegin(&store, first.size()) == MODEL_STORE_OK && store.upload == 0, "begin into slot 0");
+  check(modelStoreWrite(&store, chunk, first.data() + chunk, chunk) == MODEL_STORE_ERR_OFFSET,
+        "chunk at the wrong offset refused");
+  double slowest = upload(first, 0, first.size() / 2, &status);
+  check(status == MODEL_STORE_OK, "first half written");
+  check(modelStoreCommit(&store, cnnUseBlob) == MODEL_STORE_ERR_INCOMPLETE, "early commit refused");
+  slowest = std::max(slowest, upload(first, store.received, first.size(), &status));
+  check(status == MODEL_STORE_OK && strcmp(running(), "compiled") == 0, "still on the compiled tables");
+  uint64_t start = bench::now_ns();
+  status = modelStoreCommit(&store, cnnUseBlob);
+  double commit_us = (bench::now_ns() - start) / 1000.0;
+  check(status == MODEL_STORE_OK && store.active == 0, "commit switches to slot 0");
+  cnn(inputs, outputs);
+  check(memcmp(outputs, compiled, sizeof(output_t)) == 0, "outputs of the blob = compiled outputs");
+  printf("  slowest inference during the upload %.0f us, commit %.0f us\n", slowest, commit_us);
+
+  printf("swap to swap-b:\n");
+  check(modelStoreBegin(&store, second.size()) == MODEL_STORE_OK && store.upload == 1, "begin into slot 1");
+  upload(second, 0, second.size(), &status);
+  check(status == MODEL_STORE_OK && strcmp(running(), first_name) == 0, "slot 0 runs during the upload");
+  check(modelStoreCommit(&store, cnnUseBlob) == MODEL_STORE_OK && strcmp(running(), "swap-b") == 0,
+        "commit switches to slot 1");
+  check(store.generation[1] == store.generation[0] + 1, "newer generation");
+
+  printf("refused uploads, slot 1 keeps running:\n");
+  modelStoreBegin(&store, corrupted.size());
+  upload(corrupted, 0, corrupted.size(), &status);
+  check(modelStoreCommit(&store, cnnUseBlob) == MODEL_BLOB_ERR_CHECKSUM && store.active == 1,
+        "corrupted blob: checksum");
+  modelStoreBegin(&store, first.size());
+  upload(first, 0, first.size(), &status);
+  check(modelStoreCommit(&store, refuse) == MODEL_STORE_ERR_REJECTED && strcmp(running(), "swap-b") == 0,
+        "blob refused by activate()");
+  check(modelStoreCommit(&store, cnnUseBlob) == MODEL_STORE_ERR_STATE, "second commit refused");
+
+  printf("reset during an upload:\n");
+  modelStoreBegin(&store, first.size());
+  upload(first, 0, first.size() / 2, &status);
+  modelStoreClose(&store);
+  cnnUseBlob(NULL);
+  check(modelStoreOpen(&store, store_path, cnnUseBlob) == MODEL_STORE_OK && store.active == 1
+        && strcmp(running(), "swap-b") == 0, "boots on the last committed slot");
+  cnn(inputs, outputs);
+  check(memcmp(outputs, compiled, sizeof(output_t)) == 0, "same outputs after the reset");
+
+  printf("swap cycles:\n");
+  std::vector<uint8_t> blobs[2] = {renamed(first, "cycle-a"), renamed(first, "cycle-b")};
+  bench::Stats cycle = bench::measure([&] {
+    static int next = 0;
+    const std::vector<uint8_t> &blob = blobs[next ^= 1];
+    modelStoreBegin(&store, blob.size());
+    upload(blob, 0, blob.size(), &status);
+    modelStoreCommit(&store, cnnUseBlob);
+  }, iterations, 0);
+  bench::print_stats("begin + upload + commit", cycle);
+  check(strcmp(running(), (iterations % 2) ? "cycle-b" : "cycle-a") == 0, "last committed blob runs");
+  modelStoreClose(&store);
+  cnnUseBlob(NULL);
+  remove(store_path);
+
+  if (!failures) {
+    printf("all swaps as expected\n");
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    bench_pipeline.cpp
+  * @brief   Sequential loop vs three-stage pipeline (pipeline.h)
+  *
+  * Classifies a stream made of the three reference signs, first like the
+  * original loop() (unpack, cnn() + softmax, then the report on the serial
+  * link, one image at a time), then through pipeline.h where unpacking and
+  * reporting run on their own threads. The report formats the same lines as
+  * main.cpp and waits for them to leave a UART at --baud (10 bits per byte,
+  * 0 disables the wait), which is what Serial.printf() costs on the board
+  * once the TX FIFO is full.
+  *
+  * Reports the time of each stage, the throughput of both modes and the
+  * 1 / max(stage) bound, and checks the labels of every image.
+  *
+  * Usage: bench_pipeline [images] [--baud n]
+  *
+  * The overlap only shows when the stages get their own CPU (or sleep, like
+  * the UART wait): on a single-CPU host the compute stages still serialise.
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "postprocess.h"
+#include "trafficsigns.h"
+#include "pipeline.h"
+
+#include "bench_common.h"
+
+static void unpack(uint32_t id, input_t inputs) {
+  bench::load_sign(bench::signs[id % bench::sign_count], inputs);
+}
+
+struct Report {
+  long baud;
+  size_t failures;
+  bench::Stats unpack, inference, report;
+};
+
+// Same lines as the sequential loop of main.cpp, then the UART drain time
+static void report(Report *r, uint32_t id, int label, uint16_t confidence, uint32_t infer_us) {
+  char line[160];
+  unsigned int percent100 = ((uint32_t)confidence * 10000 + SOFTMAX_ONE / 2) >> 15;
+  int n = snprintf(line, sizeof(line),
+                   "Temps d'inference = %.6f ms\n\nConfidence sign[%u] : %u.%02u%%\n\nClass Predicted : %s\n",
+                   infer_us / 1000.0, (unsigned int)(id % bench::sign_count), percent100 / 100, percent100 % 100,
+                   labelName(label) != NULL ? labelName(label) : "Error !");
+  if (r->baud > 0) {
+    std::this_thread::sleep_for(std::chrono::microseconds((uint64_t)n * 10 * 1000000 / r->baud));
+  }
+  if (label != bench::signs[id % bench::sign_count].expected_label) {
+    fprintf(stderr, "REGRESSION: image %u (%s) predicted %d, expected %d\n",
+            (unsigned int)id, bench::signs[id % bench::sign_count].name, label, bench::signs[id % bench::sign_count].expected_label);
+    r->failures++;
+  }
+}
+
+struct Stream {
+  uint32_t images;
+};
+
+static bool stream_source(void *context, pipeline_slot_t *slot) {
+  if (slot->id >= ((Stream *)context)->images) {
+    return false;
+  }
+  unpack(slot->id, slot->inputs);
+  return true;
+}
+
+static void stream_sink(void *context, const pipeline_slot_t *slot) {
+  Report *r = (Report *)context;
+  uint64_t start = bench::now_ns();
+  report(r, slot->id, slot->label, slot->confidence, slot->infer_us);
+  r->report.add(bench::now_ns() - start);
+  r->unpack.add((uint64_t)slot->unpack_us * 1000);
+  r->inference.add((uint64_t)slot->infer_us * 1000);
+}
+
+static void print_mode(const char *name, const Report &r, uint32_t images, double elapsed_s) {
+  double slowest = r.unpack.mean_us();
+  if (r.inference.mean_us() > slowest) slowest = r.inference.mean_us();
+  if (r.report.mean_us() > slowest) slowest = r.report.mean_us();
+  printf("%s: %u images in %.3f s, %.1f images/s (1 / max(stage) = %.1f images/s)\n",
+         name, images, elapsed_s, images / elapsed_s, 1e6 / slowest);
+  bench::print_stats("  unpack", r.unpack);
+  bench::print_stats("  cnn + softmax", r.inference);
+  bench::print_stats("  report", r.report);
+}
+
+int main(int argc, char **argv) {
+  uint32_t images = 300;
+  long baud = 115200;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--baud") == 0 && i + 1 < argc) {
+      baud = strtol(argv[++i], NULL, 0);
+    } else if (argv[i][0] != '-' && atol(argv[i]) > 0) {
+      images = (uint32_t)atol(argv[i]);
+    } else {
+      fprintf(stderr, "usage: %s [images] [--baud n]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  // Sequential: one image goes through the three stages before the next
+  static input_t inputs;
+  static output_t outputs;
+  Report sequential = {baud, 0, {}, {}, {}};
+  uint64_t start = bench::now_ns();
+  for (uint32_t id = 0; id < images; id++) {
+    uint64_t t0 = bench::now_ns();
+    unpack(id, inputs);
+    uint64_t t1 = bench::now_ns();
+    cnn(inputs, outputs);
+    uint16_t confidence;
+    int label = softmaxLabelQ15(outputs, NULL, &confidence);
+    uint64_t t2 = bench::now_ns();
+    report(&sequential, id, label, confidence, (uint32_t)((t2 - t1) / 1000));
+    uint64_t t3 = bench::now_ns();
+    sequential.unpack.add(t1 - t0);
+    sequential.inference.add(t2 - t1);
+    sequential.report.add(t3 - t2);
+  }
+  double sequential_s = (bench::now_ns() - start) / 1e9;
+
+  // Pipelined: unpack and report threads around the inference loop
+  static pipeline_t pipeline;
+  Stream stream = {images};
+  Report pipelined = {baud, 0, {}, {}, {}};
+  start = bench::now_ns();
+  pipelineBegin(&pipeline, stream_source, &stream, stream_sink, &pipelined);
+  pipelineEnd(&pipeline);
+  double pipelined_s = (bench::now_ns() - start) / 1e9;
+
+  printf("UART %ld baud, %d pipeline slots, %u hardware threads\n",
+         baud, PIPELINE_DEPTH, std::thread::hardware_concurrency());
+  print_mode("sequential", sequential, images, sequential_s);
+  print_mode("pipelined", pipelined, images, pipelined_s);
+  printf("  speedup x%.2f\n", sequential_s / pipelined_s);
+
+  if (pipelined.report.count() != images) {
+    fprintf(stderr, "FAILED: %zu/%u images reported by the pipeline\n", pipelined.report.count(), images);
+    return 1;
+  }
+  return sequential.failures + pipelined.failures ? 1 : 0;
+}
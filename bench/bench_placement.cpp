@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file    bench_placement.cpp
+  * @brief   Per-layer latency of cnn() under each weight placement
+  *
+  * Runs the reference signs with the kernel tables left in flash, placed by
+  * the default CNN_PLACEMENT_MAP, all copied to internal DRAM and all copied
+  * to PSRAM (placement.h), checks that every placement produces the outputs
+  * of the flash one and prints the mean time per layer, the bytes read from
+  * each region and the time of the boot-time copy.
+  *
+  * Needs -DWITH_PLACEMENT -DWITH_LAYER_PROFILING. On the host every region
+  * is ordinary RAM, so the columns only differ by noise: the numbers that
+  * matter are the per-layer cycles printed by env:m5stack-cores3-placement.
+  *
+  * Usage: bench_placement [iterations]
+  */
+
+#include <cstdio>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+#if !defined(WITH_PLACEMENT) || !defined(WITH_LAYER_PROFILING)
+#error "bench_placement needs -DWITH_PLACEMENT -DWITH_LAYER_PROFILING"
+#endif
+
+static input_t inputs[3];
+static output_t reference[3];
+static output_t outputs;
+
+enum Preset { PRESET_FLASH, PRESET_MAP, PRESET_DRAM, PRESET_PSRAM, PRESETS };
+
+static const char * const preset_names[PRESETS] = {"flash", "map", "dram", "psram"};
+
+struct Result {
+  uint32_t layer_ticks[CNN_LAYERS];
+  double inference_us;
+  double copy_us;
+  size_t bytes[PLACEMENT_REGIONS];
+  int failed;
+};
+
+static double place(Preset preset, int *failed) {
+  uint64_t start = bench::now_ns();
+  placementClear();
+  switch (preset) {
+    case PRESET_FLASH:
+      *failed = 0;
+      break;
+    case PRESET_MAP:
+      *failed = cnnPlacementInit();
+      break;
+    case PRESET_DRAM:
+      cnnPlacementSetAll(PLACEMENT_DRAM);
+      *failed = placementApply();
+      break;
+    default:
+      cnnPlacementSetAll(PLACEMENT_PSRAM);
+      *failed = placementApply();
+      break;
+  }
+  return (bench::now_ns() - start) / 1000.0;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 2000);
+  int failures = 0;
+  Result results[PRESETS];
+
+  pixelProcess32(trafficsign1, inputs[0]);
+  pixelProcess32(trafficsign2, inputs[1]);
+  pixelProcess43(trafficsign3, inputs[2]);
+
+  cnnPlacementSetAll(PLACEMENT_FLASH);
+  const size_t kernel_bytes = placementBytes(PLACEMENT_FLASH);
+
+  for (int p = 0; p < PRESETS; p++) {
+    Result &r = results[p];
+    r.copy_us = place((Preset)p, &r.failed);
+    // Tables left out of the map are read from flash too
+    r.bytes[PLACEMENT_DRAM] = placementBytes(PLACEMENT_DRAM);
+    r.bytes[PLACEMENT_PSRAM] = placementBytes(PLACEMENT_PSRAM);
+    r.bytes[PLACEMENT_FLASH] = kernel_bytes - r.bytes[PLACEMENT_DRAM] - r.bytes[PLACEMENT_PSRAM];
+
+    for (int s = 0; s < 3; s++) {
+      cnn(inputs[s], outputs);
+      if (p == PRESET_FLASH) {
+        memcpy(reference[s], outputs, sizeof(outputs));
+      } else if (memcmp(reference[s], outputs, sizeof(outputs)) != 0) {
+        fprintf(stderr, "MISMATCH: sign %d differs with the %s placement\n", s + 1, preset_names[p]);
+        failures++;
+      }
+    }
+
+    cnn_profile_reset();
+    size_t n = 0;
+    bench::Stats stats = bench::measure([&n] { cnn(inputs[n++ % 3], outputs); }, iterations);
+    r.inference_us = stats.mean_us();
+    for (unsigned int i = 0; i < CNN_LAYERS; i++) {
+      r.layer_ticks[i] = cnn_profile_mean_ticks(i);
+    }
+  }
+  placementClear();
+
+  printf("mean per layer [%s]:\n  %-24s", PROFILER_TICK_UNIT, "");
+  for (int p = 0; p < PRESETS; p++) {
+    printf(" %10s", preset_names[p]);
+  }
+  printf("\n");
+  for (unsigned int i = 0; i < CNN_LAYERS; i++) {
+    printf("  %-24s", cnn_profile_layer_name(i));
+    for (const Result &r : results) {
+      printf(" %10u", (unsigned int)r.layer_ticks[i]);
+    }
+    printf("\n");
+  }
+  printf("  %-24s", "cnn [us]");
+  for (const Result &r : results) {
+    printf(" %10.2f", r.inference_us);
+  }
+  printf("\n\nkernel bytes per region, boot-time copy:\n");
+  for (int p = 0; p < PRESETS; p++) {
+    const Result &r = results[p];
+    printf("  %-6s flash=%-7zu dram=%-7zu psram=%-7zu copy=%8.2f us", preset_names[p],
+           r.bytes[PLACEMENT_FLASH], r.bytes[PLACEMENT_DRAM], r.bytes[PLACEMENT_PSRAM], r.copy_us);
+    if (r.failed) {
+      printf("  (%d tables left in flash)", r.failed);
+    }
+    printf("\n");
+  }
+  if (!failures) {
+    printf("outputs identical under every placement\n");
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,280 @@
+/**
+  ******************************************************************************
+  * @file    bench_preprocess.cpp
+  * @brief   Per-frame cost of the RGB565 -> input_t preprocessing
+  *
+  * Compares, for a 32x32 frame (pixelProcess32) and a 43x43 frame
+  * (pixelProcess43):
+  *  - the original shift-and-mask loop (centre crop for 43x43), kept here
+  *    as the reference;
+  *  - the same window normalised with float arithmetic, round(code *
+  *    2^MODEL_INPUT_SCALE_FACTOR / divisor), which the channel LUTs replace;
+  *  - pixelProcess32/pixelProcess43 of preprocess.h;
+  *  - the area and bilinear resamplers of resample.h on 43x43, 64x64 and
+  *    160x120 sources;
+  *  - the float RGB888 expansion formerly done by rgb565_to_rgb888, against
+  *    its table-driven replacement.
+  * Exits with a non-zero status if pixelProcess32/pixelProcess43 or the
+  * resamplers differ from their double-precision references (and, with
+  * the default PREPROCESS_NORM_CODE, pixelProcess32 from the shift-and-mask
+  * loop), or if the RGB888 tables differ from the float formula.
+  *
+  * Usage: bench_preprocess [iterations]
+  */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+// Keeps the timed calls from being optimised away
+volatile int sink;
+
+static input_t reference, lut;
+static unsigned char rgb888[43 * 43][3];
+static unsigned short frame64[64 * 64], frame160[160 * 120];
+
+// pixelProcess32/pixelProcess43 before the LUTs
+static void shift_mask(const unsigned short *frame, int width, int start, input_t inputs) {
+  for (int i = 0; i < 32; i++) {
+    for (int j = 0; j < 32; j++) {
+      uint16_t pixel = frame[(i + start) * width + (j + start)];
+      inputs[i][j][0] = (pixel >> 11) & 0x1F;
+      inputs[i][j][1] = (pixel >> 5) & 0x3F;
+      inputs[i][j][2] = pixel & 0x1F;
+    }
+  }
+}
+
+static void float_normalise(const unsigned short *frame, int width, int start, input_t inputs) {
+  const float one = (float)(1 << MODEL_INPUT_SCALE_FACTOR);
+  for (int i = 0; i < 32; i++) {
+    for (int j = 0; j < 32; j++) {
+      uint16_t pixel = frame[(i + start) * width + (j + start)];
+      inputs[i][j][0] = (int16_t)roundf((pixel >> 11) * one / PREPROCESS_DIV_5);
+      inputs[i][j][1] = (int16_t)roundf(((pixel >> 5) & 0x3F) * one / PREPROCESS_DIV_6);
+      inputs[i][j][2] = (int16_t)roundf((pixel & 0x1F) * one / PREPROCESS_DIV_5);
+    }
+  }
+}
+
+// Double-precision area or bilinear resize of a width x height source
+static void double_resample(const unsigned short *src, int width, int height, int mode,
+                            input_t inputs) {
+  const double divisor[3] = {PREPROCESS_DIV_5, PREPROCESS_DIV_6, PREPROCESS_DIV_5};
+  for (int y = 0; y < 32; y++) {
+    for (int x = 0; x < 32; x++) {
+      double sum[3] = {0.0, 0.0, 0.0};
+      double total = 0.0;
+      for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+          double w;
+          if (mode == RESAMPLE_AREA) {
+            double wy = std::max(0.0, std::min((y + 1) * height / 32.0, i + 1.0) - std::max(y * height / 32.0, (double)i));
+            double wx = std::max(0.0, std::min((x + 1) * width / 32.0, j + 1.0) - std::max(x * width / 32.0, (double)j));
+            w = wx * wy;
+          } else {
+            double sy = std::min(std::max((y + 0.5) * height / 32.0 - 0.5, 0.0), height - 1.0);
+            double sx = std::min(std::max((x + 0.5) * width / 32.0 - 0.5, 0.0), width - 1.0);
+            w = std::max(0.0, 1.0 - fabs(sy - i)) * std::max(0.0, 1.0 - fabs(sx - j));
+          }
+          if (w == 0.0) continue;
+          unsigned short p = src[i * width + j];
+          sum[0] += w * (p >> 11);
+          sum[1] += w * ((p >> 5) & 0x3F);
+          sum[2] += w * (p & 0x1F);
+          total += w;
+        }
+      }
+      for (int c = 0; c < 3; c++) {
+        inputs[y][x][c] = (int16_t)floor(sum[c] / total * (1 << MODEL_INPUT_SCALE_FACTOR) / divisor[c] + 0.5);
+      }
+    }
+  }
+}
+
+// Largest |a - b| over the input tensor
+static int max_difference(const input_t a, const input_t b) {
+  int max = 0;
+  for (int i = 0; i < 32 * 32 * 3; i++) {
+    int d = abs((&a[0][0][0])[i] - (&b[0][0][0])[i]);
+    if (d > max) max = d;
+  }
+  return max;
+}
+
+static void float_rgb888(const unsigned short *frame, int pixels) {
+  for (int i = 0; i < pixels; i++) {
+    unsigned short p = frame[i];
+    rgb888[i][0] = (unsigned char)round((float)(p >> 11) / 31 * 255);
+    rgb888[i][1] = (unsigned char)round((float)((p >> 5) & 0x3F) / 63 * 255);
+    rgb888[i][2] = (unsigned char)round((float)(p & 0x1F) / 31 * 255);
+  }
+}
+
+static void lut_rgb888(const unsigned short *frame, int pixels) {
+  for (int i = 0; i < pixels; i++) {
+    int r, g, b;
+    rgb565_to_rgb888(frame[i], &r, &g, &b);
+    rgb888[i][0] = (unsigned char)r;
+    rgb888[i][1] = (unsigned char)g;
+    rgb888[i][2] = (unsigned char)b;
+  }
+}
+
+static int check() {
+  int failures = 0;
+  for (unsigned int p = 0; p < 0x10000; p++) {
+    int r, g, b;
+    rgb565_to_rgb888((unsigned short)p, &r, &g, &b);
+    if (r != (int)round((float)(p >> 11) / 31 * 255)
+        || g != (int)round((float)((p >> 5) & 0x3F) / 63 * 255)
+        || b != (int)round((float)(p & 0x1F) / 31 * 255)) {
+      fprintf(stderr, "MISMATCH: rgb565_to_rgb888(0x%04x)\n", p);
+      failures++;
+      break;
+    }
+  }
+  float_normalise(trafficsign1, 32, 0, reference);
+  pixelProcess32(trafficsign1, lut);
+  if (memcmp(reference, lut, sizeof(lut)) != 0) {
+    fprintf(stderr, "MISMATCH: pixelProcess32 differs from the float normalisation\n");
+    failures++;
+  }
+#if PREPROCESS_NORMALIZATION == PREPROCESS_NORM_CODE
+  shift_mask(trafficsign1, 32, 0, reference);
+  pixelProcess32(trafficsign1, lut);
+  if (memcmp(reference, lut, sizeof(lut)) != 0) {
+    fprintf(stderr, "MISMATCH: pixelProcess32 differs from the shift-and-mask loop\n");
+    failures++;
+  }
+#endif
+#ifdef PREPROCESS_43_CROP
+  float_normalise(trafficsign3, 43, (43 - 32) / 2, reference);
+#else
+  double_resample(trafficsign3, 43, 43, PREPROCESS_43_FILTER, reference);
+#endif
+  pixelProcess43(trafficsign3, lut);
+  if (memcmp(reference, lut, sizeof(lut)) != 0) {
+    fprintf(stderr, "MISMATCH: pixelProcess43 differs from its reference (max %d LSB)\n",
+            max_difference(reference, lut));
+    failures++;
+  }
+
+  // Resamplers: identity on 32x32, double-precision reference otherwise.
+  // The fixed-point reciprocal may round an exact tie the other way.
+  struct Source {
+    const unsigned short *pixels;
+    int width, height;
+  } sources[] = {{trafficsign1, 32, 32}, {trafficsign3, 43, 43}, {frame64, 64, 64},
+                 {frame160, 160, 120}, {trafficsign3, 43, 20}, {trafficsign2, 20, 32}};
+  const char *names[] = {"area", "bilinear"};
+  for (const Source &src : sources) {
+    for (int mode = RESAMPLE_AREA; mode <= RESAMPLE_BILINEAR; mode++) {
+      double_resample(src.pixels, src.width, src.height, mode, reference);
+      resample565(src.pixels, src.width, src.height, src.width, mode, lut);
+      int diff = max_difference(reference, lut);
+      if (diff > (src.width == 32 && src.height == 32 ? 0 : 1)) {
+        fprintf(stderr, "MISMATCH: %s resample of %dx%d off by %d LSB\n", names[mode],
+                src.width, src.height, diff);
+        failures++;
+      }
+    }
+  }
+  if (failures == 0) {
+    printf("PREPROCESS_NORMALIZATION=%d: pixelProcess32/43 and resamplers match their references\n",
+           PREPROCESS_NORMALIZATION);
+  }
+  return failures;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 100000);
+  // Upscaled sign and a synthetic camera-like ramp frame
+  for (int y = 0; y < 64; y++) {
+    for (int x = 0; x < 64; x++) frame64[y * 64 + x] = trafficsign1[(y / 2) * 32 + x / 2];
+  }
+  for (int y = 0; y < 120; y++) {
+    for (int x = 0; x < 160; x++) {
+      frame160[y * 160 + x] = (unsigned short)(((x * 31 / 159) << 11) | (((x + y) * 63 / 278) << 5) | (y * 31 / 119));
+    }
+  }
+  int failures = check();
+
+  bench::Stats mask32 = bench::measure([] {
+    shift_mask(trafficsign1, 32, 0, reference);
+    sink = reference[31][31][2];
+  }, iterations);
+  bench::Stats float32 = bench::measure([] {
+    float_normalise(trafficsign1, 32, 0, reference);
+    sink = reference[31][31][2];
+  }, iterations / 10);
+  bench::Stats lut32 = bench::measure([] {
+    pixelProcess32(trafficsign1, lut);
+    sink = lut[31][31][2];
+  }, iterations);
+  bench::Stats mask43 = bench::measure([] {
+    shift_mask(trafficsign3, 43, (43 - 32) / 2, reference);
+    sink = reference[31][31][2];
+  }, iterations);
+  bench::Stats lut43 = bench::measure([] {
+    pixelProcess43(trafficsign3, lut);
+    sink = lut[31][31][2];
+  }, iterations);
+  bench::Stats area43 = bench::measure([] {
+    resample565(trafficsign3, 43, 43, 43, RESAMPLE_AREA, lut);
+    sink = lut[31][31][2];
+  }, iterations / 10);
+  bench::Stats bilinear43 = bench::measure([] {
+    resample565(trafficsign3, 43, 43, 43, RESAMPLE_BILINEAR, lut);
+    sink = lut[31][31][2];
+  }, iterations / 10);
+  bench::Stats area64 = bench::measure([] {
+    resample565(frame64, 64, 64, 64, RESAMPLE_AREA, lut);
+    sink = lut[31][31][2];
+  }, iterations / 10);
+  bench::Stats area160 = bench::measure([] {
+    resample565(frame160, 160, 120, 160, RESAMPLE_AREA, lut);
+    sink = lut[31][31][2];
+  }, iterations / 10);
+  bench::Stats bilinear160 = bench::measure([] {
+    resample565(frame160, 160, 120, 160, RESAMPLE_BILINEAR, lut);
+    sink = lut[31][31][2];
+  }, iterations / 10);
+  bench::Stats float888 = bench::measure([] {
+    float_rgb888(trafficsign3, 43 * 43);
+    sink = rgb888[0][0];
+  }, iterations / 10);
+  bench::Stats lut888 = bench::measure([] {
+    lut_rgb888(trafficsign3, 43 * 43);
+    sink = rgb888[0][0];
+  }, iterations / 10);
+
+  printf("per frame:\n");
+  bench::print_stats("32x32 shift-and-mask", mask32);
+  bench::print_stats("32x32 float normalisation", float32);
+  bench::print_stats("pixelProcess32", lut32);
+  bench::print_stats("43x43 crop shift-and-mask", mask43);
+  bench::print_stats("pixelProcess43", lut43);
+  bench::print_stats("43x43 area resample", area43);
+  bench::print_stats("43x43 bilinear resample", bilinear43);
+  bench::print_stats("64x64 area resample", area64);
+  bench::print_stats("160x120 area resample", area160);
+  bench::print_stats("160x120 bilinear resample", bilinear160);
+  bench::print_stats("43x43 RGB888 float", float888);
+  bench::print_stats("43x43 RGB888 LUT", lut888);
+  printf("  RGB888 speedup x%.2f\n", float888.mean_us() / lut888.mean_us());
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    bench_simd.cpp
+  * @brief   SIMD dot-product kernels (simd.h) vs the reference templates
+  *
+  * Checks dot_q15() against the scalar loop on random vectors, on operands
+  * that make the int32 accumulator wrap, on unaligned operands and on odd
+  * lengths, then runs conv2d_1, conv2d_2 and dense on the real activations
+  * of trafficsign1 with both the reference templates and the SIMD kernels
+  * and checks the outputs are identical.
+  *
+  * Build with -DWITH_SIMD_EMULATION on the host to exercise the PIE code
+  * path through its C model; on ESP32-S3 the real instructions are used.
+  *
+  * Usage: bench_simd [iterations]
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+static const char *backend_name() {
+  switch (SIMD_BACKEND) {
+    case SIMD_BACKEND_PIE: return "ESP32-S3 PIE";
+    case SIMD_BACKEND_EMULATED: return "PIE emulation";
+    default: return "scalar";
+  }
+}
+
+static input_t inputs;
+static conv2d_output_type conv2d_out;
+static batch_normalization_output_type bn_out;
+static conv2d_1_output_type conv2d_1_ref NN_ALIGNED, conv2d_1_simd NN_ALIGNED;
+static batch_normalization_1_output_type bn1_out NN_ALIGNED;
+static conv2d_2_output_type conv2d_2_ref NN_ALIGNED, conv2d_2_simd NN_ALIGNED;
+static batch_normalization_2_output_type bn2_out NN_ALIGNED;
+static conv2d_3_output_type conv2d_3_out NN_ALIGNED;
+static dense_output_type dense_ref, dense_simd;
+
+static const conv_shape_t conv2d_1_shape = {15, 15, 8, 32, 3, 3, 2, 2, 0, 0, 7, 7};
+static const conv_shape_t conv2d_2_shape = {7, 7, 32, 64, 3, 3, 2, 2, 0, 0, 3, 3};
+static const requant_t relu_q7 = {0, -7, 7, ROUND_MODE_FLOOR, NN_ACTIVATION_RELU, 6 << 14};
+
+static int compare(const char *name, const void *a, const void *b, size_t size) {
+  if (memcmp(a, b, size) != 0) {
+    fprintf(stderr, "MISMATCH: %s outputs differ\n", name);
+    return 1;
+  }
+  printf("%s: outputs identical\n", name);
+  return 0;
+}
+
+static int check_dot(const char *name, const int16_t *a, const int16_t *b, int n) {
+  int32_t expected = dot_q15_scalar(a, b, n);
+  int32_t got = dot_q15(a, b, n);
+  if (expected != got) {
+    fprintf(stderr, "MISMATCH: dot_q15 %s n=%d: %ld != %ld\n", name, n, (long)got, (long)expected);
+    return 1;
+  }
+  return 0;
+}
+
+static int check_dot_products() {
+  static int16_t a[1024 + SIMD_LANES] NN_ALIGNED;
+  static int16_t b[1024 + SIMD_LANES] NN_ALIGNED;
+  int failures = 0;
+
+  srand(1);
+  for (size_t i = 0; i < sizeof(a) / sizeof(a[0]); i++) {
+    a[i] = (int16_t)(rand() & 0xFFFF);
+    b[i] = (int16_t)(rand() & 0xFFFF);
+  }
+  for (int n = 0; n <= 1024; n += (n < 64 ? 1 : 61)) {
+    failures += check_dot("random", a, b, n);
+    failures += check_dot("unaligned", a + 1, b, n);
+    failures += check_dot("unaligned", a + 3, b + 5, n);
+  }
+
+  // -32768 * -32768 * 1024 wraps the int32 accumulator, the 40-bit ACCX
+  // does not: the low 32 bits must still match
+  for (int i = 0; i < 1024; i++) {
+    a[i] = INT16_MIN;
+    b[i] = (i & 1) ? INT16_MIN : INT16_MAX;
+  }
+  failures += check_dot("wrap", a, a, 1024);
+  failures += check_dot("wrap", a, b, 1024);
+  failures += check_dot("wrap", a, b, 1021);
+
+  printf("dot_q15 (%s): %s\n", backend_name(), failures ? "FAILED" : "matches scalar");
+  return failures;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 5000);
+  int failures = check_dot_products();
+
+  pixelProcess32(trafficsign1, inputs);
+  conv2d(inputs, conv2d_kernel, conv2d_bias, conv2d_out);
+  batch_normalization(conv2d_out, batch_normalization_kernel, batch_normalization_bias, bn_out);
+
+  bench::Stats ref1 = bench::measure([] {
+    conv2d_1(bn_out, conv2d_1_kernel, conv2d_1_bias, conv2d_1_ref);
+  }, iterations);
+  bench::Stats simd1 = bench::measure([] {
+    conv2d_simd_q15(&bn_out[0][0][0], &conv2d_1_kernel[0][0][0][0], conv2d_1_bias,
+                    &conv2d_1_simd[0][0][0], &conv2d_1_shape, &relu_q7);
+  }, iterations);
+  failures += compare("conv2d_1", conv2d_1_ref, conv2d_1_simd, sizeof(conv2d_1_ref));
+
+  batch_normalization_1(conv2d_1_ref, batch_normalization_1_kernel, batch_normalization_1_bias, bn1_out);
+
+  bench::Stats ref2 = bench::measure([] {
+    conv2d_2(bn1_out, conv2d_2_kernel, conv2d_2_bias, conv2d_2_ref);
+  }, iterations);
+  bench::Stats simd2 = bench::measure([] {
+    conv2d_simd_q15(&bn1_out[0][0][0], &conv2d_2_kernel[0][0][0][0], conv2d_2_bias,
+                    &conv2d_2_simd[0][0][0], &conv2d_2_shape, &relu_q7);
+  }, iterations);
+  failures += compare("conv2d_2", conv2d_2_ref, conv2d_2_simd, sizeof(conv2d_2_ref));
+
+  batch_normalization_2(conv2d_2_ref, batch_normalization_2_kernel, batch_normalization_2_bias, bn2_out);
+  conv2d_3(bn2_out, conv2d_3_kernel, conv2d_3_bias, conv2d_3_out);
+
+  bench::Stats ref3 = bench::measure([] {
+    dense((const int16_t *)conv2d_3_out, dense_kernel, dense_bias, dense_ref);
+  }, iterations);
+  bench::Stats simd3 = bench::measure([] {
+    dense_simd_q15((const int16_t *)conv2d_3_out, &dense_kernel[0][0], dense_bias, dense_simd,
+                   128, 64, &relu_q7);
+  }, iterations);
+  failures += compare("dense", dense_ref, dense_simd, sizeof(dense_ref));
+
+  printf("backend: %s\n", backend_name());
+  bench::print_stats("conv2d_1 reference", ref1);
+  bench::print_stats("conv2d_1 simd", simd1);
+  printf("  speedup x%.2f\n", ref1.mean_us() / simd1.mean_us());
+  bench::print_stats("conv2d_2 reference", ref2);
+  bench::print_stats("conv2d_2 simd", simd2);
+  printf("  speedup x%.2f\n", ref2.mean_us() / simd2.mean_us());
+  bench::print_stats("dense reference", ref3);
+  bench::print_stats("dense simd", simd3);
+  printf("  speedup x%.2f\n", ref3.mean_us() / simd3.mean_us());
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,167 @@
+/**
+  ******************************************************************************
+  * @file    bench_softmax.cpp
+  * @brief   Fixed-point softmax (softmaxLabelQ15) vs the float path
+  *
+  * Compares, on the network outputs of the reference signs and of every
+  * 32x32 crop of trafficsign3 plus random Q7 logit vectors:
+  *  - softmaxLabelQ15 against an exact double-precision softmax of the Q7
+  *    logits (error on the confidence and on every probability);
+  *  - the predicted label against the original float softmaxLabel;
+  *  - the cost of one call of each.
+  * Exits with a non-zero status if a label differs or if the Q15 error
+  * exceeds SOFTMAX_TOLERANCE.
+  *
+  * Usage: bench_softmax [iterations]
+  */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "postprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+// Largest accepted |Q15 probability - exact probability|
+#define SOFTMAX_TOLERANCE (8.0 / SOFTMAX_ONE)
+
+// Keeps the timed calls from being optimised away
+volatile int sink;
+
+struct Logits {
+  output_t values;
+};
+
+static std::vector<Logits> network_outputs() {
+  std::vector<Logits> all;
+  static input_t inputs;
+  unsigned short crop[32 * 32];
+  Logits l;
+
+  pixelProcess32(trafficsign1, inputs);
+  cnn(inputs, l.values);
+  all.push_back(l);
+  pixelProcess32(trafficsign2, inputs);
+  cnn(inputs, l.values);
+  all.push_back(l);
+  for (int oy = 0; oy + 32 <= 43; oy++) {
+    for (int ox = 0; ox + 32 <= 43; ox++) {
+      for (int i = 0; i < 32; i++) {
+        memcpy(&crop[i * 32], &trafficsign3[(oy + i) * 43 + ox], 32 * sizeof(crop[0]));
+      }
+      pixelProcess32(crop, inputs);
+      cnn(inputs, l.values);
+      all.push_back(l);
+    }
+  }
+  return all;
+}
+
+// Random logits in [-range, range], the spread of real outputs being a few thousands
+static std::vector<Logits> random_outputs(size_t count, int range) {
+  std::vector<Logits> all(count);
+  for (Logits &l : all) {
+    for (int i = 0; i < NBLABELS; i++) {
+      l.values[i] = (int16_t)(rand() % (2 * range + 1) - range);
+    }
+  }
+  return all;
+}
+
+struct Comparison {
+  size_t vectors = 0;
+  size_t label_mismatches = 0;
+  double max_confidence_error = 0.0;
+  double max_probability_error = 0.0;
+  double sum_confidence_error = 0.0;
+  double max_legacy_error = 0.0;
+};
+
+static void compare(const std::vector<Logits> &set, Comparison &c) {
+  for (const Logits &l : set) {
+    int16_t max = l.values[0];
+    for (int i = 1; i < NBLABELS; i++) {
+      if (l.values[i] > max) max = l.values[i];
+    }
+    double exact[NBLABELS];
+    double sum = 0.0;
+    for (int i = 0; i < NBLABELS; i++) {
+      exact[i] = exp((l.values[i] - max) / (double)(1 << MODEL_OUTPUT_SCALE_FACTOR));
+      sum += exact[i];
+    }
+
+    uint16_t probs[NBLABELS];
+    uint16_t confidence;
+    int label = softmaxLabelQ15(l.values, probs, &confidence);
+    float legacy_confidence;
+    int legacy_label = softmaxLabel(l.values, &legacy_confidence);
+
+    c.vectors++;
+    if (label != legacy_label) {
+      c.label_mismatches++;
+    }
+    double error = fabs((double)confidence / SOFTMAX_ONE - exact[label] / sum);
+    c.sum_confidence_error += error;
+    if (error > c.max_confidence_error) c.max_confidence_error = error;
+    for (int i = 0; i < NBLABELS; i++) {
+      double e = fabs((double)probs[i] / SOFTMAX_ONE - exact[i] / sum);
+      if (e > c.max_probability_error) c.max_probability_error = e;
+    }
+    double legacy = fabs(legacy_confidence - exact[legacy_label] / sum);
+    if (legacy > c.max_legacy_error) c.max_legacy_error = legacy;
+  }
+}
+
+static int report(const char *name, const Comparison &c) {
+  printf("%s: %zu vectors\n", name, c.vectors);
+  printf("  label vs float softmaxLabel: %zu mismatches\n", c.label_mismatches);
+  printf("  Q15 confidence error: max %.6f mean %.6f (%.2f LSB max)\n", c.max_confidence_error,
+         c.sum_confidence_error / c.vectors, c.max_confidence_error * SOFTMAX_ONE);
+  printf("  Q15 probability error: max %.6f\n", c.max_probability_error);
+  printf("  float softmaxLabel confidence error: max %.6f\n", c.max_legacy_error);
+  if (c.label_mismatches != 0 || c.max_probability_error > SOFTMAX_TOLERANCE) {
+    fprintf(stderr, "FAILED: %s outside tolerance\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 20000);
+  int failures = 0;
+
+  srand(1);
+  static std::vector<Logits> network = network_outputs();
+  Comparison cn, cr, cw;
+  compare(network, cn);
+  compare(random_outputs(10000, 1024), cr);
+  compare(random_outputs(10000, 4096), cw);
+  failures += report("network outputs", cn);
+  failures += report("random logits +-8", cr);
+  failures += report("random logits +-32", cw);
+
+  static size_t next = 0;
+  bench::Stats legacy = bench::measure([] {
+    float confidence;
+    sink = softmaxLabel(network[next++ % network.size()].values, &confidence);
+  }, iterations);
+  bench::Stats fixed = bench::measure([] {
+    uint16_t confidence;
+    sink = softmaxLabelQ15(network[next++ % network.size()].values, NULL, &confidence);
+  }, iterations);
+  bench::print_stats("softmaxLabel (float)", legacy);
+  bench::print_stats("softmaxLabelQ15", fixed);
+  printf("  speedup x%.2f\n", legacy.mean_us() / fixed.mean_us());
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,172 @@
+/**
+  ******************************************************************************
+  * @file    bench_stream.cpp
+  * @brief   conv2d_3 and dense read in place vs streamed through the SRAM
+  *          double buffer of weight_stream.h
+  *
+  * Feeds both layers with the real activations of trafficsign1 and checks
+  * that the streamed kernels, with a synchronous copy and with the copier
+  * thread, produce the outputs of the in-place ones. For several block
+  * sizes it then records the block schedule, checks its double-buffering
+  * invariants and replays it with a copy cost per byte and a compute cost
+  * per MAC to estimate the share of the copies hidden on the board.
+  *
+  * The default costs are a guess for the ESP32-S3 at 240 MHz: 6 cycles per
+  * byte for a flash cache refill at 80 MHz QIO, 3 cycles per scalar MAC. On
+  * the host the weights are already in RAM, so the measured latencies only
+  * show the cost of the scheduler and of the copier thread hand-offs. At
+  * -O2 the host also vectorizes the in-place layers, whose shape is known
+  * after inlining, but not the blocks called through weight_stream_run():
+  * build with -fno-tree-vectorize for a comparison closer to the scalar
+  * code of the ESP32-S3.
+  *
+  * Usage: bench_stream [iterations] [copy cycles/byte] [cycles/MAC]
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "trafficsigns.h"
+
+#include "bench_common.h"
+
+#ifndef WITH_WEIGHT_STREAM
+#error "bench_stream needs -DWITH_WEIGHT_STREAM"
+#endif
+
+static input_t inputs;
+static conv2d_output_type conv2d_out;
+static batch_normalization_output_type bn_out;
+static conv2d_1_output_type conv2d_1_out;
+static batch_normalization_1_output_type bn1_out;
+static conv2d_2_output_type conv2d_2_out;
+static batch_normalization_2_output_type bn2_out;
+static conv2d_3_output_type conv2d_3_ref, conv2d_3_sync, conv2d_3_async;
+static dense_output_type dense_ref, dense_sync, dense_async;
+
+// Both layers: Q7 in, Q7 weights and biases, ReLU
+static const requant_t relu_q7 = {0, -7, 7, ROUND_MODE_FLOOR, NN_ACTIVATION_RELU, 6 << 14};
+static const conv_shape_t conv2d_3_shape = {3, 3, 64, 128, 3, 3, 2, 2, 0, 0, 1, 1};
+static const int conv2d_3_unit_macs = 3 * 3 * 64;
+static const int dense_unit_macs = 128;
+
+static const int16_t *flat = &conv2d_3_ref[0][0][0];
+
+static weight_stream_event_t events[1024];
+static weight_stream_trace_t trace = {events, sizeof(events) / sizeof(events[0]), 0, 0};
+
+static void conv2d_3_streamed(int16_t *output) {
+  weight_stream_conv2d_q15(&bn2_out[0][0][0], &conv2d_3_kernel[0][0][0][0], conv2d_3_bias, output,
+                           &conv2d_3_shape, &relu_q7);
+}
+
+static void dense_streamed(int16_t *output) {
+  weight_stream_dense_q15(flat, &dense_kernel[0][0], dense_bias, output, 128, 64, &relu_q7);
+}
+
+static int compare(const char *name, const void *a, const void *b, size_t size) {
+  if (memcmp(a, b, size) != 0) {
+    fprintf(stderr, "MISMATCH: %s outputs differ\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+// Record the schedule of one call, check it and print its simulated cost
+static int simulate(const char *name, void (*layer)(int16_t *), int16_t *output, int unit_macs,
+                    double copy_per_byte, double per_mac) {
+  trace.count = trace.dropped = 0;
+  weight_stream_set_trace(&trace);
+  layer(output);
+  weight_stream_set_trace(NULL);
+
+  size_t bad = weight_stream_check(&trace);
+  if (trace.dropped || bad) {
+    fprintf(stderr, "SCHEDULE: %s invalid at event %zu (%zu dropped)\n", name, bad, trace.dropped);
+    return 1;
+  }
+  int blocks = 0;
+  for (size_t i = 0; i < trace.count; i++) {
+    blocks += trace.events[i].type == WEIGHT_STREAM_COMPUTE;
+  }
+  if (blocks == 0) {
+    printf("  %-8s filters larger than the block, read in place\n", name);
+    return 0;
+  }
+  double serial;
+  double streamed = weight_stream_simulate(&trace, copy_per_byte, unit_macs * per_mac, &serial);
+  printf("  %-8s %3d blocks  serial=%8.0f  streamed=%8.0f cycles  x%.2f\n",
+         name, blocks, serial, streamed, serial / streamed);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  size_t iterations = bench::iterations_from_args(argc, argv, 20000);
+  double copy_per_byte = argc > 2 ? atof(argv[2]) : 6.0;
+  double per_mac = argc > 3 ? atof(argv[3]) : 3.0;
+  int failures = 0;
+
+  pixelProcess32(trafficsign1, inputs);
+  conv2d(inputs, conv2d_kernel, conv2d_bias, conv2d_out);
+  batch_normalization(conv2d_out, batch_normalization_kernel, batch_normalization_bias, bn_out);
+  conv2d_1(bn_out, conv2d_1_kernel, conv2d_1_bias, conv2d_1_out);
+  batch_normalization_1(conv2d_1_out, batch_normalization_1_kernel, batch_normalization_1_bias, bn1_out);
+  conv2d_2(bn1_out, conv2d_2_kernel, conv2d_2_bias, conv2d_2_out);
+  batch_normalization_2(conv2d_2_out, batch_normalization_2_kernel, batch_normalization_2_bias, bn2_out);
+
+  bench::Stats conv_ref = bench::measure([] {
+    conv2d_simd_q15(&bn2_out[0][0][0], &conv2d_3_kernel[0][0][0][0], conv2d_3_bias, &conv2d_3_ref[0][0][0],
+                    &conv2d_3_shape, &relu_q7);
+  }, iterations);
+  bench::Stats dense_in_place = bench::measure([] {
+    dense_simd_q15(flat, &dense_kernel[0][0], dense_bias, dense_ref, 128, 64, &relu_q7);
+  }, iterations);
+
+  weight_stream_set_async(0);
+  bench::Stats conv_sync = bench::measure([] { conv2d_3_streamed(&conv2d_3_sync[0][0][0]); }, iterations);
+  bench::Stats dense_sync_stats = bench::measure([] { dense_streamed(dense_sync); }, iterations);
+  weight_stream_set_async(1);
+  bench::Stats conv_async = bench::measure([] { conv2d_3_streamed(&conv2d_3_async[0][0][0]); }, iterations);
+  bench::Stats dense_async_stats = bench::measure([] { dense_streamed(dense_async); }, iterations);
+
+  failures += compare("conv2d_3 sync", conv2d_3_ref, conv2d_3_sync, sizeof(conv2d_3_ref));
+  failures += compare("conv2d_3 async", conv2d_3_ref, conv2d_3_async, sizeof(conv2d_3_ref));
+  failures += compare("dense sync", dense_ref, dense_sync, sizeof(dense_ref));
+  failures += compare("dense async", dense_ref, dense_async, sizeof(dense_ref));
+
+  printf("host, %d byte buffers:\n", WEIGHT_STREAM_BLOCK_BYTES);
+  bench::print_stats("conv2d_3 in place", conv_ref);
+  bench::print_stats("conv2d_3 streamed, sync", conv_sync);
+  bench::print_stats("conv2d_3 streamed, copier", conv_async);
+  bench::print_stats("dense in place", dense_in_place);
+  bench::print_stats("dense streamed, sync", dense_sync_stats);
+  bench::print_stats("dense streamed, copier", dense_async_stats);
+
+  printf("\nsimulated schedule, %.1f cycles/byte copied, %.1f cycles/MAC:\n", copy_per_byte, per_mac);
+  static const size_t block_sizes[] = {512, 1024, 2048, 4096};
+  for (size_t bytes : block_sizes) {
+    if (bytes > WEIGHT_STREAM_BLOCK_BYTES) {
+      continue;
+    }
+    printf(" %zu byte blocks\n", bytes);
+    weight_stream_set_block_bytes(bytes);
+    failures += simulate("conv2d_3", conv2d_3_streamed, &conv2d_3_async[0][0][0], conv2d_3_unit_macs,
+                         copy_per_byte, per_mac);
+    failures += compare("conv2d_3 traced", conv2d_3_ref, conv2d_3_async, sizeof(conv2d_3_ref));
+    failures += simulate("dense", dense_streamed, dense_async, dense_unit_macs, copy_per_byte, per_mac);
+    failures += compare("dense traced", dense_ref, dense_async, sizeof(dense_ref));
+  }
+  weight_stream_set_block_bytes(WEIGHT_STREAM_BLOCK_BYTES);
+
+  if (!failures) {
+    printf("outputs identical, schedules valid\n");
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file    bench_telemetry.cpp
+  * @brief   Text result lines vs binary telemetry records (telemetry.h)
+  *
+  * Runs the three reference signs in a loop like the WITH_TELEMETRY
+  * firmware and reports each inference either:
+  *  - as text, with the three lines of main.cpp written like
+  *    Serial.printf() does: blocking whenever the TX FIFO is full;
+  *  - as a 21-byte telemetry record pushed into the ring, which is only
+  *    drained into the FIFO as far as it has room.
+  * The UART is simulated: a FIFO of --fifo bytes emptied at --baud
+  * (10 bits per byte). Reports the time each frame spends reporting, the
+  * frame rate and the telemetry records dropped because the ring was full.
+  *
+  * The host runs cnn() much faster than the ESP32-S3; --inference-us pads
+  * every inference to a board-like duration so that the link, and not the
+  * host CPU, sets the record budget.
+  *
+  * Usage: bench_telemetry [frames] [--baud n] [--fifo bytes] [--inference-us n]
+  */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+#include "model.h"
+#include "preprocess.h"
+#include "postprocess.h"
+#include "trafficsigns.h"
+#include "telemetry.h"
+
+#include "bench_common.h"
+
+static input_t inputs;
+static output_t outputs;
+
+// TX FIFO emptied at the line rate
+struct SimUart {
+  double byte_ns;
+  size_t fifo;
+  uint64_t empty_at;    // time at which the queued bytes are all sent
+  size_t sent;
+
+  size_t room() const {
+    uint64_t now = bench::now_ns();
+    if (now >= empty_at) return fifo;
+    size_t queued = (size_t)((empty_at - now) / byte_ns) + 1;
+    return queued >= fifo ? 0 : fifo - queued;
+  }
+
+  void queue(size_t n) {
+    uint64_t now = bench::now_ns();
+    empty_at = (empty_at > now ? empty_at : now) + (uint64_t)(n * byte_ns);
+    sent += n;
+  }
+
+  // Serial.write(): waits for room in the FIFO
+  void write_blocking(size_t n) {
+    while (n > 0) {
+      size_t r;
+      while ((r = room()) == 0) {
+      }
+      r = r < n ? r : n;
+      queue(r);
+      n -= r;
+    }
+  }
+};
+
+static void spin_until(uint64_t deadline_ns) {
+  while (bench::now_ns() < deadline_ns) {
+  }
+}
+
+// cnn() + softmax of frame i, padded to inference_us
+static int infer(uint32_t i, uint32_t inference_us, uint16_t *confidence) {
+  uint64_t start = bench::now_ns();
+  switch (i % 3) {
+#ifdef WITH_FUSED_RGB565
+  case 0:
+    cnnRGB565(trafficsign1, 32, 0, 0, outputs);
+    break;
+  case 1:
+    cnnRGB565(trafficsign2, 32, 0, 0, outputs);
+    break;
+#else
+  case 0:
+    pixelProcess32(trafficsign1, inputs);
+    cnn(inputs, outputs);
+    break;
+  case 1:
+    pixelProcess32(trafficsign2, inputs);
+    cnn(inputs, outputs);
+    break;
+#endif
+  default:
+    pixelProcess43(trafficsign3, inputs);
+    cnn(inputs, outputs);
+    break;
+  }
+  int label = softmaxLabelQ15(outputs, NULL, confidence);
+  spin_until(start + (uint64_t)inference_us * 1000);
+  return label;
+}
+
+int main(int argc, char **argv) {
+  uint32_t frames = 2000;
+  long baud = 115200;
+  size_t fifo = 128;
+  uint32_t inference_us = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--baud") == 0 && i + 1 < argc) {
+      baud = strtol(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--fifo") == 0 && i + 1 < argc) {
+      fifo = strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "--inference-us") == 0 && i + 1 < argc) {
+      inference_us = strtoul(argv[++i], NULL, 0);
+    } else if (argv[i][0] != '-' && atol(argv[i]) > 0) {
+      frames = (uint32_t)atol(argv[i]);
+    } else {
+      fprintf(stderr, "usage: %s [frames] [--baud n] [--fifo bytes] [--inference-us n]\n", argv[0]);
+      return 2;
+    }
+  }
+  const double byte_ns = 1e10 / baud;
+  int failures = 0;
+  static const int expected[3] = {4, 15, 26};
+
+  // Text: the three lines of the sequential loop, blocking writes
+  SimUart uart = {byte_ns, fifo, 0, 0};
+  bench::Stats text_report;
+  uint64_t start = bench::now_ns();
+  for (uint32_t i = 0; i < frames; i++) {
+    uint16_t confidence;
+    uint64_t t0 = bench::now_ns();
+    int label = infer(i, inference_us, &confidence);
+    uint64_t t1 = bench::now_ns();
+    char line[160];
+    unsigned int percent100 = ((uint32_t)confidence * 10000 + SOFTMAX_ONE / 2) >> 15;
+    int n = snprintf(line, sizeof(line),
+                     "Temps d'inference = %.6f ms\n\nConfidence sign[%u] : %u.%02u%%\n\nClass Predicted : %s\n",
+                     (t1 - t0) / 1e6, (unsigned int)(i % 3), percent100 / 100, percent100 % 100,
+                     labelName(label));
+    uart.write_blocking((size_t)n);
+    text_report.add(bench::now_ns() - t1);
+    failures += label != expected[i % 3];
+  }
+  double text_s = (bench::now_ns() - start) / 1e9;
+  size_t text_bytes = uart.sent;
+
+  // Telemetry: push into the ring, drain what the FIFO takes
+  static telemetry_t telemetry;
+  telemetryInit(&telemetry);
+  uart = {byte_ns, fifo, 0, 0};
+  bench::Stats telemetry_report;
+  uint64_t last = 0;
+  start = bench::now_ns();
+  for (uint32_t i = 0; i < frames; i++) {
+    uint16_t confidence;
+    uint64_t t0 = bench::now_ns();
+    int label = infer(i, inference_us, &confidence);
+    uint64_t t1 = bench::now_ns();
+    telemetry_record_t record = {i, (uint8_t)label, telemetryConfidenceQ7(confidence),
+                                 0, (uint32_t)((t1 - t0) / 1000), 0,
+                                 last ? (uint32_t)((t1 - last) / 1000) : 0};
+    last = t1;
+    telemetryPush(&telemetry, &record);
+    const uint8_t *data;
+    size_t n;
+    while ((n = telemetryPeek(&telemetry, &data)) > 0) {
+      size_t room = uart.room();
+      if (room == 0) break;
+      n = n < room ? n : room;
+      uart.queue(n);
+      telemetryConsume(&telemetry, n);
+    }
+    telemetry_report.add(bench::now_ns() - t1);
+    failures += label != expected[i % 3];
+  }
+  double telemetry_s = (bench::now_ns() - start) / 1e9;
+
+  printf("UART %ld baud, %zu-byte FIFO, %u frames, inference padded to %u us\n",
+         baud, fifo, frames, inference_us);
+  printf("text:      %.1f frames/s, %.1f bytes/frame\n", frames / text_s, (double)text_bytes / frames);
+  bench::print_stats("  reporting per frame", text_report);
+  printf("telemetry: %.1f frames/s, %d bytes/record, %u records dropped (link capacity %.0f records/s)\n",
+         frames / telemetry_s, TELEMETRY_RECORD_SIZE, telemetry.dropped,
+         baud / 10.0 / TELEMETRY_RECORD_SIZE);
+  bench::print_stats("  reporting per frame", telemetry_report);
+
+  if (failures) {
+    fprintf(stderr, "REGRESSION: %d frames with an unexpected label\n", failures);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,215 @@
+/**
+  ******************************************************************************
+  * @file    gtsrb_dataset.h
+  * @brief   Readers for the traffic-sign evaluation sets of bench_gtsrb
+  *
+  * Two sources are supported, both yielding square RGB565 tiles (the pixel
+  * format of trafficsigns.h and of the camera) with their model label:
+  *
+  *  - a packed file written by tools/pack_gtsrb.py:
+  *      "GTPK", uint32 version (1), uint32 count, uint32 reserved
+  *      count x { uint8 label, uint8 size, uint16 reserved,
+  *                size * size x uint16 RGB565 }
+  *    all little-endian, size being 32 or 43;
+  *  - a directory <root>/<label>/<image>.ppm of binary (P6) PPM files, the
+  *    sub-directory name being the model label (0..27). Images are resized
+  *    to 32x32 with nearest-neighbour sampling, except 43x43 ones that are
+  *    kept for pixelProcess43.
+  *
+  * Original GTSRB trees (43 classes, PNG/PPM of any size) are converted to
+  * the packed format by tools/pack_gtsrb.py, which also maps the classes.
+  */
+
+#ifndef GTSRB_DATASET_H
+#define GTSRB_DATASET_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+namespace gtsrb {
+
+struct Sample {
+  int label;
+  int size;                          // 32 or 43
+  std::vector<unsigned short> pixels;  // size * size RGB565
+  std::string name;
+};
+
+static inline unsigned short rgb565(int r, int g, int b) {
+  return (unsigned short)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+static inline uint32_t read_u32(const unsigned char *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Reader of the packed format, one sample at a time
+class PackedReader {
+ public:
+  explicit PackedReader(const char *path) : file_(fopen(path, "rb")), remaining_(0), index_(0) {
+    unsigned char header[16];
+    if (file_ == NULL || fread(header, 1, sizeof(header), file_) != sizeof(header)
+        || memcmp(header, "GTPK", 4) != 0 || read_u32(header + 4) != 1) {
+      error_ = std::string(path) + ": not a version 1 GTPK file";
+      return;
+    }
+    remaining_ = read_u32(header + 8);
+  }
+
+  ~PackedReader() {
+    if (file_ != NULL) fclose(file_);
+  }
+
+  bool next(Sample &sample) {
+    unsigned char record[4];
+    if (remaining_ == 0 || fread(record, 1, sizeof(record), file_) != sizeof(record)) {
+      return false;
+    }
+    sample.label = record[0];
+    sample.size = record[1];
+    if (sample.size != 32 && sample.size != 43) {
+      error_ = "record " + std::to_string(index_) + ": unsupported size " + std::to_string(sample.size);
+      return false;
+    }
+    std::vector<unsigned char> raw((size_t)sample.size * sample.size * 2);
+    if (fread(raw.data(), 1, raw.size(), file_) != raw.size()) {
+      error_ = "record " + std::to_string(index_) + ": truncated";
+      return false;
+    }
+    sample.pixels.resize((size_t)sample.size * sample.size);
+    for (size_t i = 0; i < sample.pixels.size(); i++) {
+      sample.pixels[i] = (unsigned short)(raw[2 * i] | (raw[2 * i + 1] << 8));
+    }
+    sample.name = "#" + std::to_string(index_++);
+    remaining_--;
+    return true;
+  }
+
+  const std::string &error() const { return error_; }
+
+ private:
+  FILE *file_;
+  uint32_t remaining_;
+  uint32_t index_;
+  std::string error_;
+};
+
+// Next integer of a PPM header, skipping white space and # comments
+static inline bool ppm_field(FILE *f, int &value) {
+  int c = fgetc(f);
+  while (c == '#' || isspace(c)) {
+    if (c == '#') {
+      while (c != '\n' && c != EOF) c = fgetc(f);
+    }
+    c = fgetc(f);
+  }
+  if (!isdigit(c)) return false;
+  value = 0;
+  while (isdigit(c)) {
+    value = value * 10 + (c - '0');
+    c = fgetc(f);
+  }
+  return isspace(c);  // a single white space precedes the raster
+}
+
+// Decodes a binary PPM (P6, maxval 255) into RGB565 at 32x32, or 43x43 if
+// the image already has that size
+static inline bool load_ppm(const std::string &path, Sample &sample) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (f == NULL) return false;
+  int width = 0, height = 0, maxval = 0;
+  bool ok = fgetc(f) == 'P' && fgetc(f) == '6' && ppm_field(f, width) && ppm_field(f, height)
+            && ppm_field(f, maxval) && maxval == 255 && width > 0 && height > 0;
+  std::vector<unsigned char> rgb(ok ? (size_t)width * height * 3 : 0);
+  ok = ok && fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+  fclose(f);
+  if (!ok) return false;
+
+  sample.size = (width == 43 && height == 43) ? 43 : 32;
+  sample.pixels.resize((size_t)sample.size * sample.size);
+  for (int y = 0; y < sample.size; y++) {
+    int sy = (2 * y + 1) * height / (2 * sample.size);
+    for (int x = 0; x < sample.size; x++) {
+      int sx = (2 * x + 1) * width / (2 * sample.size);
+      const unsigned char *p = &rgb[((size_t)sy * width + sx) * 3];
+      sample.pixels[y * sample.size + x] = rgb565(p[0], p[1], p[2]);
+    }
+  }
+  sample.name = path;
+  return true;
+}
+
+static inline bool is_directory(const std::string &path) {
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+// Sorted entries of a directory, without "." and ".."
+static inline std::vector<std::string> list_directory(const std::string &path) {
+  std::vector<std::string> names;
+  DIR *dir = opendir(path.c_str());
+  if (dir == NULL) return names;
+  while (struct dirent *entry = readdir(dir)) {
+    if (entry->d_name[0] != '.') names.push_back(entry->d_name);
+  }
+  closedir(dir);
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+// Reader of <root>/<label>/<image>.ppm, one sample at a time
+class DirectoryReader {
+ public:
+  explicit DirectoryReader(const std::string &root) : next_(0) {
+    for (const std::string &label : list_directory(root)) {
+      std::string dir = root + "/" + label;
+      char *end;
+      long value = strtol(label.c_str(), &end, 10);
+      if (!is_directory(dir) || *end != '\0') continue;
+      for (const std::string &name : list_directory(dir)) {
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".ppm") == 0) {
+          files_.push_back({dir + "/" + name, (int)value});
+        }
+      }
+    }
+    if (files_.empty()) {
+      error_ = root + ": no <label>/*.ppm images";
+    }
+  }
+
+  bool next(Sample &sample) {
+    while (next_ < files_.size()) {
+      const File &file = files_[next_++];
+      if (load_ppm(file.path, sample)) {
+        sample.label = file.label;
+        return true;
+      }
+      fprintf(stderr, "skipping %s: not a P6 PPM with maxval 255\n", file.path.c_str());
+    }
+    return false;
+  }
+
+  const std::string &error() const { return error_; }
+
+ private:
+  struct File {
+    std::string path;
+    int label;
+  };
+  std::vector<File> files_;
+  size_t next_;
+  std::string error_;
+};
+
+} // namespace gtsrb
+
+#endif // GTSRB_DATASET_H
@@ -0,0 +1,196 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Shim minimal de l'API Arduino pour compiler src/main.cpp sur Linux (env:native)
+*/
+
+#include "Arduino.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+HardwareSerial Serial;
+
+static struct timespec boot_time;
+
+static unsigned long elapsed_us(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (unsigned long)((now.tv_sec - boot_time.tv_sec) * 1000000L
+                         + (now.tv_nsec - boot_time.tv_nsec) / 1000L);
+}
+
+unsigned long micros(void) {
+  return elapsed_us();
+}
+
+unsigned long millis(void) {
+  return elapsed_us() / 1000UL;
+}
+
+void delay(unsigned long ms) {
+  usleep(ms * 1000UL);
+}
+
+void delayMicroseconds(unsigned int us) {
+  usleep(us);
+}
+
+/*
+  La liaison serie est redirigee vers stdout. Avec NATIVE_SERIAL_PTY defini,
+  elle passe par un pseudo-terminal brut qui remplace le port USB de la
+  carte : son nom est affiche sur stderr et, si NATIVE_SERIAL_PTY est un
+  chemin, un lien symbolique y est cree (client : tools/serial_infer.py).
+*/
+static int pty_fd = -1;
+static uint8_t rx_buffer[4096];
+static size_t rx_head = 0, rx_tail = 0;
+
+static void serial_open_pty(void) {
+  const char *link = getenv("NATIVE_SERIAL_PTY");
+  if (link == NULL || pty_fd >= 0) {
+    return;
+  }
+  int fd = posix_openpt(O_RDWR | O_NOCTTY);
+  if (fd < 0 || grantpt(fd) != 0 || unlockpt(fd) != 0) {
+    perror("posix_openpt");
+    exit(1);
+  }
+  struct termios tio;
+  tcgetattr(fd, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(fd, TCSANOW, &tio);
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  const char *name = ptsname(fd);
+  if (strcmp(link, "1") != 0) {
+    unlink(link);
+    if (symlink(name, link) != 0) {
+      perror(link);
+    }
+  }
+  fprintf(stderr, "Serial : %s\n", name);
+  pty_fd = fd;
+}
+
+// Remplit rx_buffer avec ce que le client a deja envoye
+static size_t serial_poll(void) {
+  if (pty_fd >= 0 && rx_head == rx_tail) {
+    rx_head = rx_tail = 0;
+    ssize_t n = ::read(pty_fd, rx_buffer, sizeof(rx_buffer));
+    if (n > 0) {
+      rx_tail = (size_t)n;
+    }
+  }
+  return rx_tail - rx_head;
+}
+
+static size_t serial_write(const void *data, size_t size) {
+  if (pty_fd < 0) {
+    return fwrite(data, 1, size, stdout);
+  }
+  const uint8_t *p = (const uint8_t *)data;
+  size_t done = 0;
+  while (done < size) {
+    ssize_t n = ::write(pty_fd, p + done, size - done);
+    if (n > 0) {
+      done += (size_t)n;
+    } else if (n < 0 && errno != EAGAIN && errno != EINTR) {
+      break; // Client deconnecte : les octets sont perdus, comme sur l'USB
+    } else {
+      usleep(100);
+    }
+  }
+  return done;
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+  (void)baud; // Sans effet sur un pseudo-terminal
+  setvbuf(stdout, NULL, _IOLBF, 0);
+  serial_open_pty();
+}
+
+int HardwareSerial::available(void) {
+  return (int)serial_poll();
+}
+
+int HardwareSerial::read(void) {
+  return serial_poll() ? rx_buffer[rx_head++] : -1;
+}
+
+size_t HardwareSerial::readBytes(uint8_t *buffer, size_t length) {
+  size_t n = 0;
+  while (n < length && serial_poll()) {
+    size_t chunk = rx_tail - rx_head;
+    if (chunk > length - n) chunk = length - n;
+    memcpy(buffer + n, rx_buffer + rx_head, chunk);
+    rx_head += chunk;
+    n += chunk;
+  }
+  return n;
+}
+
+int HardwareSerial::availableForWrite(void) {
+  return 128;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  return serial_write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  return serial_write(buffer, size);
+}
+
+void HardwareSerial::flush(void) {
+  if (pty_fd >= 0) {
+    tcdrain(pty_fd);
+  } else {
+    fflush(stdout);
+  }
+}
+
+size_t HardwareSerial::print(const char *s) { return serial_write(s, strlen(s)); }
+size_t HardwareSerial::print(int n) { return printf("%d", n); }
+size_t HardwareSerial::print(unsigned int n) { return printf("%u", n); }
+size_t HardwareSerial::print(long n) { return printf("%ld", n); }
+size_t HardwareSerial::print(unsigned long n) { return printf("%lu", n); }
+size_t HardwareSerial::print(double n, int digits) { return printf("%.*f", digits, n); }
+size_t HardwareSerial::println(void) { return print("\r\n"); }
+size_t HardwareSerial::println(const char *s) { return print(s) + println(); }
+size_t HardwareSerial::println(int n) { return print(n) + println(); }
+size_t HardwareSerial::println(unsigned int n) { return print(n) + println(); }
+size_t HardwareSerial::println(long n) { return print(n) + println(); }
+size_t HardwareSerial::println(unsigned long n) { return print(n) + println(); }
+size_t HardwareSerial::println(double n, int digits) { return print(n, digits) + println(); }
+
+size_t HardwareSerial::printf(const char *format, ...) {
+  char line[256];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(line, sizeof(line), format, args);
+  va_end(args);
+  if (n < 0) {
+    return 0;
+  }
+  return serial_write(line, (size_t)n < sizeof(line) ? (size_t)n : sizeof(line) - 1);
+}
+
+int main(int argc, char **argv) {
+  long iterations = NATIVE_LOOP_ITERATIONS;
+  if (argc > 1) {
+    iterations = strtol(argv[1], NULL, 0);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &boot_time);
+
+  setup();
+  for (long i = 0; iterations < 0 || i < iterations; i++) {
+    loop();
+  }
+  fflush(stdout);
+  return 0;
+}
@@ -0,0 +1,69 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Shim minimal de l'API Arduino pour compiler src/main.cpp sur Linux (env:native)
+*/
+
+#ifndef ARDUINO_NATIVE_H
+#define ARDUINO_NATIVE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define ARDUINO_NATIVE 1
+
+// Les tableaux PROGMEM sont de simples constantes sur l'hôte
+#define PROGMEM
+
+// Nombre d'appels a loop() effectues par main() (surcharge possible par
+// argv[1], negatif : sans fin)
+#ifndef NATIVE_LOOP_ITERATIONS
+#define NATIVE_LOOP_ITERATIONS 3
+#endif
+
+unsigned long micros(void);
+unsigned long millis(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+class HardwareSerial {
+public:
+  void begin(unsigned long baud);
+  void end(void) {}
+  int available(void);
+  int read(void);
+  size_t readBytes(uint8_t *buffer, size_t length);
+  int availableForWrite(void);
+  size_t write(uint8_t c);
+  size_t write(const uint8_t *buffer, size_t size);
+  void flush(void);
+
+  size_t print(const char *s);
+  size_t print(int n);
+  size_t print(unsigned int n);
+  size_t print(long n);
+  size_t print(unsigned long n);
+  size_t print(double n, int digits = 2);
+  size_t println(void);
+  size_t println(const char *s);
+  size_t println(int n);
+  size_t println(unsigned int n);
+  size_t println(long n);
+  size_t println(unsigned long n);
+  size_t println(double n, int digits = 2);
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// Points d'entree du sketch, appeles par le main() du shim
+void setup(void);
+void loop(void);
+
+#endif // ARDUINO_NATIVE_H
@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    blob_map.h
+  * @brief   Map a model blob (nn_blob.h) without copying it: flash data
+  *          partition on the ESP32, file on Linux
+  *
+  *  - ESP32: the blob is written to the data partition labelled
+  *    MODEL_BLOB_PARTITION (subtype 0x40, see partitions_model.csv) and
+  *    mapped through the flash MMU with esp_partition_mmap(): the weights
+  *    are read through the cache exactly like the const tables of model.h.
+  *  - Host: the file is mmap()'ed read-only, the pages are loaded on first
+  *    access and shared with the page cache.
+  *
+  * blobMapOpen() only maps the bytes the header announces and checks them
+  * with modelBlobOpen(). blobMapClose() unmaps; the model_blob_t filled by
+  * blobMapOpen() must not be used afterwards.
+  */
+
+#ifndef _BLOB_MAP_H_
+#define _BLOB_MAP_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "nn_blob.h"
+
+#ifndef MODEL_BLOB_PARTITION
+#define MODEL_BLOB_PARTITION "model"
+#endif
+#define MODEL_BLOB_PARTITION_SUBTYPE 0x40
+
+#if defined(ESP_PLATFORM)
+
+#include "esp_idf_version.h"
+#include "esp_partition.h"
+#if ESP_IDF_VERSION_MAJOR < 5
+#include "esp_spi_flash.h"
+#endif
+
+typedef struct {
+  const void *data;
+  size_t size;
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_partition_mmap_handle_t handle;
+#else
+  spi_flash_mmap_handle_t handle;
+#endif
+} blob_map_t;
+
+// Map the blob of data partition `label`
+static inline int blobMapOpen(blob_map_t *map, const char *label, model_blob_t *model) {
+  const esp_partition_t *part = esp_partition_find_first(
+      ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)MODEL_BLOB_PARTITION_SUBTYPE, label);
+  model_blob_header_t header;
+
+  map->data = NULL;
+  map->size = 0;
+  if (part == NULL || esp_partition_read(part, 0, &header, sizeof(header)) != ESP_OK) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  if (header.magic != MODEL_BLOB_MAGIC) {
+    return MODEL_BLOB_ERR_MAGIC;
+  }
+  if (header.total_size < sizeof(header) || header.total_size > part->size) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_err_t err = esp_partition_mmap(part, 0, header.total_size, ESP_PARTITION_MMAP_DATA, &map->data,
+                                     &map->handle);
+#else
+  esp_err_t err = esp_partition_mmap(part, 0, header.total_size, SPI_FLASH_MMAP_DATA, &map->data,
+                                     &map->handle);
+#endif
+  if (err != ESP_OK) {
+    map->data = NULL;
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  map->size = header.total_size;
+  int status = modelBlobOpen(model, map->data, map->size);
+  if (status != MODEL_BLOB_OK) {
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_partition_munmap(map->handle);
+#else
+    spi_flash_munmap(map->handle);
+#endif
+    map->data = NULL;
+    map->size = 0;
+  }
+  return status;
+}
+
+static inline void blobMapClose(blob_map_t *map) {
+  if (map->data != NULL) {
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_partition_munmap(map->handle);
+#else
+    spi_flash_munmap(map->handle);
+#endif
+    map->data = NULL;
+    map->size = 0;
+  }
+}
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef struct {
+  const void *data;
+  size_t size;
+} blob_map_t;
+
+// Map the blob stored in file `path`
+static inline int blobMapOpen(blob_map_t *map, const char *path, model_blob_t *model) {
+  struct stat st;
+  int fd = open(path, O_RDONLY);
+
+  map->data = NULL;
+  map->size = 0;
+  if (fd < 0) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(model_blob_header_t)) {
+    close(fd);
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  void *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  int status = modelBlobOpen(model, data, (size_t)st.st_size);
+  if (status != MODEL_BLOB_OK) {
+    munmap(data, (size_t)st.st_size);
+    return status;
+  }
+  map->data = data;
+  map->size = (size_t)st.st_size;
+  return status;
+}
+
+static inline void blobMapClose(blob_map_t *map) {
+  if (map->data != NULL) {
+    munmap((void *)map->data, map->size);
+    map->data = NULL;
+    map->size = 0;
+  }
+}
+
+#endif
+
+#endif//_BLOB_MAP_H_
@@ -0,0 +1,500 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Hugo Meleiro - LEAT
+
+  Acquisition camera et chaine capture -> ROI -> pretraitement -> cnn().
+  A inclure apres model.h, preprocess.h et postprocess.h.
+
+  Les trames sont en RGB565 big-endian (octet de poids fort en premier),
+  le format du driver esp32-camera. Deux tampons de trame tournent : le
+  capteur remplit la trame N+1 pendant que la trame N est classifiee.
+
+   - ESP32 (M5Stack CoreS3, capteur GC0308, -DWITH_CAMERA) : driver
+     esp32-camera en QVGA, fb_count = 2 en PSRAM, CAMERA_GRAB_LATEST pour
+     toujours classifier la trame la plus recente. Le capteur partage le bus
+     I2C interne du CoreS3 (SDA 12, SCL 11), libere par M5Unified avant
+     l'initialisation du driver.
+   - Hote : un thread producteur rejoue une video brute RGB565 little-endian
+     (ffmpeg -i video.mp4 -vf scale=320:240 -pix_fmt rgb565le -f rawvideo
+     out.rgb565), une sequence d'images PPM (repertoire) ou une image
+     synthetique, dans deux tampons, au rythme du capteur (fps > 0 : les
+     trames non lues a temps sont perdues, comme sur la carte) ou le plus
+     vite possible (fps = 0 : aucune trame perdue).
+*/
+
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#ifndef PREPROCESS_H
+#error "camera.h doit etre inclus apres preprocess.h"
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define CAMERA_WIDTH  320
+#define CAMERA_HEIGHT 240
+
+// Largeur maximale d'une ROI (une ligne est convertie a la fois)
+#define CAMERA_MAX_ROI CAMERA_WIDTH
+
+typedef struct {
+  const uint8_t *data;      // width * height pixels RGB565 big-endian
+  int width, height;
+  uint32_t index;           // Numero de la trame depuis cameraBegin()
+  uint64_t timestamp_us;    // Instant de capture
+  void *handle;             // Tampon du driver, rendu par cameraRelease()
+} camera_frame_t;
+
+// Carre (x, y, size) de la trame classifie
+typedef struct {
+  int x, y, size;
+} camera_roi_t;
+
+typedef struct {
+  uint32_t frames;          // Trames capturees par le capteur
+  uint32_t dropped;         // Trames ecrasees avant d'etre lues
+} camera_stats_t;
+
+#if defined(ESP_PLATFORM)
+
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include <M5Unified.h>
+
+static uint32_t camera_index;
+
+static inline bool cameraBegin(void) {
+  camera_config_t config = {};
+  config.pin_pwdn = -1;
+  config.pin_reset = -1;
+  config.pin_xclk = 2;
+  config.pin_sccb_sda = 12;
+  config.pin_sccb_scl = 11;
+  config.pin_d7 = 47;
+  config.pin_d6 = 48;
+  config.pin_d5 = 16;
+  config.pin_d4 = 15;
+  config.pin_d3 = 42;
+  config.pin_d2 = 41;
+  config.pin_d1 = 40;
+  config.pin_d0 = 39;
+  config.pin_vsync = 46;
+  config.pin_href = 38;
+  config.pin_pclk = 45;
+  config.xclk_freq_hz = 20000000;
+  config.ledc_timer = LEDC_TIMER_0;
+  config.ledc_channel = LEDC_CHANNEL_0;
+  config.pixel_format = PIXFORMAT_RGB565;
+  config.frame_size = FRAMESIZE_QVGA;
+  config.jpeg_quality = 0;
+  config.fb_count = 2;                      // Double tampon DMA
+  config.fb_location = CAMERA_FB_IN_PSRAM;
+  config.grab_mode = CAMERA_GRAB_LATEST;
+
+  // Le GC0308 est sur le bus interne deja ouvert par M5.begin()
+  M5.In_I2C.release();
+  camera_index = 0;
+  return esp_camera_init(&config) == ESP_OK;
+}
+
+static inline bool cameraGrab(camera_frame_t *frame) {
+  camera_fb_t *fb = esp_camera_fb_get();
+  if (fb == NULL) {
+    return false;
+  }
+  frame->data = fb->buf;
+  frame->width = fb->width;
+  frame->height = fb->height;
+  frame->index = camera_index++;
+  frame->timestamp_us = (uint64_t)fb->timestamp.tv_sec * 1000000u + fb->timestamp.tv_usec;
+  frame->handle = fb;
+  return true;
+}
+
+static inline void cameraRelease(camera_frame_t *frame) {
+  esp_camera_fb_return((camera_fb_t *)frame->handle);
+  frame->handle = NULL;
+}
+
+static inline void cameraEnd(void) {
+  esp_camera_deinit();
+}
+
+// Le driver ne compte pas les trames perdues par CAMERA_GRAB_LATEST
+static inline camera_stats_t cameraStats(void) {
+  camera_stats_t stats = {camera_index, 0};
+  return stats;
+}
+
+static inline uint64_t cameraMicros(void) {
+  return (uint64_t)esp_timer_get_time();
+}
+
+#elif defined(__cplusplus)
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+static inline uint64_t cameraMicros(void) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Rejeu d'un flux enregistre a la place du capteur
+struct camera_replay_t {
+  // Source
+  FILE *raw = NULL;                     // Video RGB565 little-endian
+  std::vector<std::string> images;      // Sequence PPM
+  std::vector<uint16_t> still;          // Image synthetique
+  int width = 0, height = 0;
+  uint32_t length = 0;                  // Trames par passage (0 : jusqu'a la fin du fichier)
+  int loops = 1;
+  double fps = 0.0;
+
+  // Double tampon : FREE -> (producteur) READY -> (cameraGrab) HELD -> (cameraRelease) FREE
+  enum { FREE, READY, HELD };
+  std::vector<uint8_t> buffers[2];
+  int state[2] = {FREE, FREE};
+  uint32_t index[2] = {0, 0};
+  uint64_t timestamp[2] = {0, 0};
+
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::thread producer;
+  bool running = false;
+  bool finished = false;
+  camera_stats_t stats = {0, 0};
+  std::string error;
+
+  // Arret du producteur a la sortie du programme
+  ~camera_replay_t() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      running = false;
+    }
+    changed.notify_all();
+    if (producer.joinable()) producer.join();
+    if (raw != NULL) fclose(raw);
+  }
+};
+
+static camera_replay_t camera_replay;
+
+// Valeur suivante d'un en-tete PPM (espaces et commentaires # ignores)
+static inline bool cameraPpmField(FILE *f, int *value) {
+  int c = fgetc(f);
+  while (c == '#' || (c != EOF && isspace(c))) {
+    if (c == '#') {
+      while (c != '\n' && c != EOF) c = fgetc(f);
+    }
+    c = fgetc(f);
+  }
+  if (c == EOF || !isdigit(c)) return false;
+  *value = 0;
+  while (c != EOF && isdigit(c)) {
+    *value = *value * 10 + (c - '0');
+    c = fgetc(f);
+  }
+  return c != EOF && isspace(c);
+}
+
+// PPM binaire (P6, maxval 255) -> RGB565 big-endian
+static inline bool cameraLoadPpm(const std::string &path, std::vector<uint8_t> &out, int *width,
+                                 int *height) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (f == NULL) return false;
+  int w = 0, h = 0, maxval = 0;
+  bool ok = fgetc(f) == 'P' && fgetc(f) == '6' && cameraPpmField(f, &w) && cameraPpmField(f, &h)
+            && cameraPpmField(f, &maxval) && maxval == 255 && w > 0 && h > 0
+            && (*width == 0 || (w == *width && h == *height));
+  std::vector<uint8_t> rgb(ok ? (size_t)w * h * 3 : 0);
+  ok = ok && fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+  fclose(f);
+  if (!ok) return false;
+  *width = w;
+  *height = h;
+  out.resize((size_t)w * h * 2);
+  for (size_t i = 0; i < (size_t)w * h; i++) {
+    uint16_t p = ((rgb[3 * i] >> 3) << 11) | ((rgb[3 * i + 1] >> 2) << 5) | (rgb[3 * i + 2] >> 3);
+    out[2 * i] = p >> 8;
+    out[2 * i + 1] = p & 0xFF;
+  }
+  return true;
+}
+
+// Trame i du passage courant dans out, false en fin de source
+static inline bool cameraReplayRead(camera_replay_t *r, uint32_t i, std::vector<uint8_t> &out) {
+  size_t pixels = (size_t)r->width * r->height;
+  out.resize(pixels * 2);
+  if (r->raw != NULL) {
+    if (i == 0) fseek(r->raw, 0, SEEK_SET);
+    if (fread(out.data(), 2, pixels, r->raw) != pixels) return false;
+    for (size_t p = 0; p < pixels; p++) {
+      std::swap(out[2 * p], out[2 * p + 1]);
+    }
+    return true;
+  }
+  if (!r->images.empty()) {
+    int w = r->width, h = r->height;
+    if (i >= r->images.size()) return false;
+    if (!cameraLoadPpm(r->images[i], out, &w, &h)) {
+      fprintf(stderr, "camera: %s ignoree (PPM P6 %dx%d attendu)\n", r->images[i].c_str(),
+              r->width, r->height);
+      std::fill(out.begin(), out.end(), 0);
+    }
+    return true;
+  }
+  if (i >= r->length) return false;
+  for (size_t p = 0; p < pixels; p++) {
+    out[2 * p] = r->still[p] >> 8;
+    out[2 * p + 1] = r->still[p] & 0xFF;
+  }
+  return true;
+}
+
+static inline void cameraReplayProduce(camera_replay_t *r) {
+  std::vector<uint8_t> frame;
+  uint64_t start = cameraMicros();
+  uint32_t n = 0;
+  for (int loop = 0; r->loops <= 0 || loop < r->loops; loop++) {
+    for (uint32_t i = 0; cameraReplayRead(r, i, frame); i++, n++) {
+      if (r->fps > 0.0) {
+        // Exposition au rythme du capteur
+        uint64_t due = start + (uint64_t)(n * 1e6 / r->fps);
+        uint64_t now = cameraMicros();
+        if (due > now) std::this_thread::sleep_for(std::chrono::microseconds(due - now));
+      }
+      std::unique_lock<std::mutex> lock(r->mutex);
+      int slot = r->state[0] == camera_replay_t::FREE ? 0 : r->state[1] == camera_replay_t::FREE ? 1 : -1;
+      if (slot < 0 && r->fps > 0.0) {
+        // Capteur temps reel : la trame prete la plus ancienne est ecrasee
+        int oldest = -1;
+        for (int s = 0; s < 2; s++) {
+          if (r->state[s] == camera_replay_t::READY && (oldest < 0 || r->index[s] < r->index[oldest])) oldest = s;
+        }
+        slot = oldest;
+        if (slot >= 0) r->stats.dropped++;
+      }
+      // Sans cadence (ou les deux tampons tenus) le producteur attend un tampon libre
+      r->changed.wait(lock, [&] {
+        return !r->running || slot >= 0 || r->state[0] == camera_replay_t::FREE
+               || r->state[1] == camera_replay_t::FREE;
+      });
+      if (!r->running) return;
+      if (slot < 0) slot = r->state[0] == camera_replay_t::FREE ? 0 : 1;
+      r->buffers[slot].swap(frame);
+      r->state[slot] = camera_replay_t::READY;
+      r->index[slot] = n;
+      r->timestamp[slot] = cameraMicros();
+      r->stats.frames++;
+      lock.unlock();
+      r->changed.notify_all();
+    }
+  }
+  std::lock_guard<std::mutex> lock(r->mutex);
+  r->finished = true;
+  r->changed.notify_all();
+}
+
+static inline void cameraEnd(void) {
+  camera_replay_t *r = &camera_replay;
+  {
+    std::lock_guard<std::mutex> lock(r->mutex);
+    r->running = false;
+  }
+  r->changed.notify_all();
+  if (r->producer.joinable()) r->producer.join();
+  if (r->raw != NULL) fclose(r->raw);
+  r->raw = NULL;
+  r->images.clear();
+  r->still.clear();
+  r->width = r->height = 0;
+}
+
+/*
+  Ouvre la source rejouee :
+   - source repertoire : images PPM P6 de meme taille, dans l'ordre des noms ;
+   - sinon fichier brut RGB565 little-endian de trames width x height.
+  fps = 0 : trames fournies des qu'un tampon est libre ; loops <= 0 : en boucle.
+*/
+static inline bool cameraReplayOpen(const char *source, int width, int height, double fps, int loops) {
+  camera_replay_t *r = &camera_replay;
+  cameraEnd();
+  r->fps = fps;
+  r->loops = loops;
+  r->length = 0;
+  struct stat st;
+  if (stat(source, &st) == 0 && S_ISDIR(st.st_mode)) {
+    DIR *dir = opendir(source);
+    while (struct dirent *entry = dir != NULL ? readdir(dir) : NULL) {
+      std::string name = entry->d_name;
+      if (name.size() > 4 && name.compare(name.size() - 4, 4, ".ppm") == 0) {
+        r->images.push_back(std::string(source) + "/" + name);
+      }
+    }
+    if (dir != NULL) closedir(dir);
+    std::sort(r->images.begin(), r->images.end());
+    std::vector<uint8_t> first;
+    int w = 0, h = 0;
+    if (r->images.empty() || !cameraLoadPpm(r->images[0], first, &w, &h)) {
+      r->error = std::string(source) + " : pas d'image PPM P6";
+      r->images.clear();
+      return false;
+    }
+    r->width = w;
+    r->height = h;
+  } else {
+    r->raw = fopen(source, "rb");
+    if (r->raw == NULL || width <= 0 || height <= 0) {
+      r->error = std::string(source) + " : video brute illisible ou taille inconnue";
+      return false;
+    }
+    r->width = width;
+    r->height = height;
+  }
+  return true;
+}
+
+// Image fixe (RGB565 natif) repetee `frames` fois, pour les essais sans video
+static inline bool cameraReplayStill(const uint16_t *pixels, int width, int height, uint32_t frames,
+                                     double fps) {
+  camera_replay_t *r = &camera_replay;
+  cameraEnd();
+  r->still.assign(pixels, pixels + (size_t)width * height);
+  r->width = width;
+  r->height = height;
+  r->length = frames;
+  r->loops = 1;
+  r->fps = fps;
+  return true;
+}
+
+// Demarre la capture. Sans source ouverte, CAMERA_REPLAY (repertoire ou
+// fichier brut) et CAMERA_REPLAY_SIZE (320x240 par defaut) sont utilises.
+static inline bool cameraBegin(void) {
+  camera_replay_t *r = &camera_replay;
+  if (r->width == 0) {
+    const char *source = getenv("CAMERA_REPLAY");
+    const char *size = getenv("CAMERA_REPLAY_SIZE");
+    int width = CAMERA_WIDTH, height = CAMERA_HEIGHT;
+    if (size != NULL) sscanf(size, "%dx%d", &width, &height);
+    if (source == NULL || !cameraReplayOpen(source, width, height, 0.0, 1)) {
+      fprintf(stderr, "camera: %s\n", source == NULL ? "CAMERA_REPLAY non defini" : r->error.c_str());
+      return false;
+    }
+  }
+  r->state[0] = r->state[1] = camera_replay_t::FREE;
+  r->stats.frames = r->stats.dropped = 0;
+  r->finished = false;
+  r->running = true;
+  r->producer = std::thread(cameraReplayProduce, r);
+  return true;
+}
+
+// Attend une trame prete (la plus recente si fps > 0, sinon la plus
+// ancienne) ; false en fin de flux
+static inline bool cameraGrab(camera_frame_t *frame) {
+  camera_replay_t *r = &camera_replay;
+  std::unique_lock<std::mutex> lock(r->mutex);
+  int slot = -1;
+  r->changed.wait(lock, [&] {
+    for (int s = 0; s < 2; s++) {
+      if (r->state[s] == camera_replay_t::READY && (slot < 0 || r->index[s] > r->index[slot])) slot = s;
+    }
+    return slot >= 0 || r->finished || !r->running;
+  });
+  if (slot < 0) return false;
+  int other = 1 - slot;
+  if (r->state[other] == camera_replay_t::READY) {
+    if (r->fps > 0.0) {
+      // CAMERA_GRAB_LATEST : la trame plus ancienne est abandonnee
+      r->state[other] = camera_replay_t::FREE;
+      r->stats.dropped++;
+    } else {
+      // Rejeu sans cadence : les trames sont lues dans l'ordre
+      slot = other;
+    }
+  }
+  r->state[slot] = camera_replay_t::HELD;
+  frame->data = r->buffers[slot].data();
+  frame->width = r->width;
+  frame->height = r->height;
+  frame->index = r->index[slot];
+  frame->timestamp_us = r->timestamp[slot];
+  frame->handle = (void *)(intptr_t)slot;
+  return true;
+}
+
+static inline void cameraRelease(camera_frame_t *frame) {
+  camera_replay_t *r = &camera_replay;
+  {
+    std::lock_guard<std::mutex> lock(r->mutex);
+    r->state[(intptr_t)frame->handle] = camera_replay_t::FREE;
+  }
+  r->changed.notify_all();
+}
+
+static inline camera_stats_t cameraStats(void) {
+  std::lock_guard<std::mutex> lock(camera_replay.mutex);
+  return camera_replay.stats;
+}
+
+#else
+#error "camera.h a besoin du driver esp32-camera (ESP32) ou d'une compilation C++ sur l'hote"
+#endif
+
+// Plus grand carre centre de la trame
+static inline camera_roi_t cameraCenterRoi(int width, int height) {
+  camera_roi_t roi;
+  roi.size = width < height ? width : height;
+  roi.x = (width - roi.size) / 2;
+  roi.y = (height - roi.size) / 2;
+  return roi;
+}
+
+// ROI de la trame -> tenseur d'entree, ligne par ligne (resample.h) : seule
+// une ligne de la ROI est convertie en RGB565 natif a la fois
+static inline int cameraFrameToInput(const camera_frame_t *frame, const camera_roi_t *roi,
+                                     input_t inputs) {
+  unsigned short row[CAMERA_MAX_ROI];
+  resampler_t resampler;
+  if (roi->size > CAMERA_MAX_ROI || roi->x < 0 || roi->y < 0 || roi->x + roi->size > frame->width
+      || roi->y + roi->size > frame->height
+      || resamplerInit(&resampler, roi->size, roi->size, RESAMPLE_AREA, inputs) != 0) {
+    return -1;
+  }
+  for (int y = 0; y < roi->size && !resamplerDone(&resampler); y++) {
+    const uint8_t *src = &frame->data[((size_t)(roi->y + y) * frame->width + roi->x) * 2];
+    for (int x = 0; x < roi->size; x++) {
+      row[x] = (unsigned short)((src[2 * x] << 8) | src[2 * x + 1]);
+    }
+    resamplerPushRow(&resampler, row);
+  }
+  return 0;
+}
+
+// Classification d'une trame : label predit, confiance Q15 dans *confidence
+static inline int cameraClassify(const camera_frame_t *frame, const camera_roi_t *roi,
+                                 input_t inputs, output_t outputs, uint16_t *confidence) {
+  if (cameraFrameToInput(frame, roi, inputs) != 0) {
+    return -1;
+  }
+  cnn(inputs, outputs);
+  return softmaxLabelQ15(outputs, NULL, confidence);
+}
+
+#endif // CAMERA_H
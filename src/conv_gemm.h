@@ -0,0 +1,184 @@
+/**
+  ******************************************************************************
+  * @file    conv_gemm.h
+  * @brief   im2col + blocked GEMM convolution engine for the int16 conv2d layers
+  *
+  * Selected at build time with -DWITH_IM2COL_GEMM. Each output pixel's
+  * receptive field is lowered into a row of a patch matrix (HWC order, which
+  * is also the order of one filter in conv2d_*_kernel), then the patch matrix
+  * is multiplied by the kernel matrix with a 2x4 register-blocked
+  * int16 x int16 -> int32 micro-kernel. Pixels are lowered CONV_GEMM_TILE_PIXELS
+  * at a time so the patch buffer stays small.
+  *
+  * When WITH_SIMD selects a vector backend (simd.h), each patch row is
+  * instead multiplied with dot_q15().
+  *
+  * Results are bit-exact with the reference nested-loop conv2d templates.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _CONV_GEMM_H_
+#define _CONV_GEMM_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "nn_common.h"
+#include "simd.h"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#ifndef CONV_GEMM_TILE_PIXELS
+#define CONV_GEMM_TILE_PIXELS 8
+#endif
+
+// Lower output pixels [first_pixel, first_pixel + pixels) into patch rows
+static inline void im2col_q15(
+  const int16_t *input,
+  const conv_shape_t *s,
+  int first_pixel,
+  int pixels,
+  int16_t *patches) {
+
+  const int row_len = s->kernel_size_x * s->input_channels;
+
+  for (int p = 0; p < pixels; p++) {
+    int pos_y = (first_pixel + p) / s->output_width;
+    int pos_x = (first_pixel + p) % s->output_width;
+    int input_y0 = pos_y * s->stride_y - s->zeropadding_top;
+    int input_x0 = pos_x * s->stride_x - s->zeropadding_left;
+    int inside_x = input_x0 >= 0 && input_x0 + s->kernel_size_x <= s->input_width;
+
+    for (int y = 0; y < s->kernel_size_y; y++) {
+      int input_y = input_y0 + y;
+      int16_t *dst = patches + y * row_len;
+
+      if (input_y < 0 || input_y >= s->input_height) { // ZeroPadding2D
+        memset(dst, 0, row_len * sizeof(int16_t));
+      } else if (inside_x) {
+        // A kernel row is contiguous in a HWC input
+        memcpy(dst, input + ((size_t)input_y * s->input_width + input_x0) * s->input_channels,
+               row_len * sizeof(int16_t));
+      } else {
+        for (int x = 0; x < s->kernel_size_x; x++) {
+          int input_x = input_x0 + x;
+          for (int z = 0; z < s->input_channels; z++) {
+            dst[x * s->input_channels + z] = (input_x < 0 || input_x >= s->input_width) ? 0 :
+              input[((size_t)input_y * s->input_width + input_x) * s->input_channels + z];
+          }
+        }
+      }
+    }
+    patches += s->kernel_size_y * row_len;
+  }
+}
+
+// output[p][k] = requant(patches[p] . kernel[k] + bias[k]) for k in [0, filters)
+static inline void gemm_q15_requant(
+  const int16_t *patches,
+  int pixels,
+  const int16_t *kernel,
+  const int16_t *bias,
+  int filters,
+  int depth,
+  const requant_t *rq,
+  int16_t *output) {
+
+#if defined(WITH_SIMD) && SIMD_BACKEND != SIMD_BACKEND_SCALAR
+  for (int p = 0; p < pixels; p++) {
+    for (int k = 0; k < filters; k++) {
+      output[(size_t)p * filters + k] = requantize_q15(
+        dot_q15(patches + (size_t)p * depth, kernel + (size_t)k * depth, depth), bias[k], rq);
+    }
+  }
+  return;
+#endif
+
+  int p = 0;
+  for (; p + 2 <= pixels; p += 2) {
+    const int16_t *a0 = patches + (size_t)p * depth;
+    const int16_t *a1 = a0 + depth;
+    int16_t *out0 = output + (size_t)p * filters;
+    int16_t *out1 = out0 + filters;
+
+    int k = 0;
+    for (; k + 4 <= filters; k += 4) {
+      const int16_t *b0 = kernel + (size_t)k * depth;
+      const int16_t *b1 = b0 + depth;
+      const int16_t *b2 = b1 + depth;
+      const int16_t *b3 = b2 + depth;
+      int32_t c00 = 0, c01 = 0, c02 = 0, c03 = 0;
+      int32_t c10 = 0, c11 = 0, c12 = 0, c13 = 0;
+
+      for (int i = 0; i < depth; i++) {
+        int32_t x0 = a0[i];
+        int32_t x1 = a1[i];
+        int32_t w0 = b0[i], w1 = b1[i], w2 = b2[i], w3 = b3[i];
+        c00 += x0 * w0; c01 += x0 * w1; c02 += x0 * w2; c03 += x0 * w3;
+        c10 += x1 * w0; c11 += x1 * w1; c12 += x1 * w2; c13 += x1 * w3;
+      }
+
+      out0[k + 0] = requantize_q15(c00, bias[k + 0], rq);
+      out0[k + 1] = requantize_q15(c01, bias[k + 1], rq);
+      out0[k + 2] = requantize_q15(c02, bias[k + 2], rq);
+      out0[k + 3] = requantize_q15(c03, bias[k + 3], rq);
+      out1[k + 0] = requantize_q15(c10, bias[k + 0], rq);
+      out1[k + 1] = requantize_q15(c11, bias[k + 1], rq);
+      out1[k + 2] = requantize_q15(c12, bias[k + 2], rq);
+      out1[k + 3] = requantize_q15(c13, bias[k + 3], rq);
+    }
+    for (; k < filters; k++) {
+      const int16_t *b = kernel + (size_t)k * depth;
+      int32_t c0 = 0, c1 = 0;
+      for (int i = 0; i < depth; i++) {
+        c0 += (int32_t)a0[i] * b[i];
+        c1 += (int32_t)a1[i] * b[i];
+      }
+      out0[k] = requantize_q15(c0, bias[k], rq);
+      out1[k] = requantize_q15(c1, bias[k], rq);
+    }
+  }
+
+  for (; p < pixels; p++) {
+    const int16_t *a = patches + (size_t)p * depth;
+    int16_t *out = output + (size_t)p * filters;
+    for (int k = 0; k < filters; k++) {
+      const int16_t *b = kernel + (size_t)k * depth;
+      int32_t c = 0;
+      for (int i = 0; i < depth; i++) {
+        c += (int32_t)a[i] * b[i];
+      }
+      out[k] = requantize_q15(c, bias[k], rq);
+    }
+  }
+}
+
+// patches must hold CONV_GEMM_TILE_PIXELS * kernel_size_y * kernel_size_x * input_channels values
+static inline void conv2d_im2col_gemm_q15(
+  const int16_t *input,   // [input_height][input_width][input_channels]
+  const int16_t *kernel,  // [filters][kernel_size_y][kernel_size_x][input_channels]
+  const int16_t *bias,    // [filters]
+  int16_t *output,        // [output_height][output_width][filters]
+  int16_t *patches,
+  const conv_shape_t *s,
+  const requant_t *rq) {
+
+  const int depth = s->kernel_size_y * s->kernel_size_x * s->input_channels;
+  const int total_pixels = s->output_height * s->output_width;
+
+  for (int p = 0; p < total_pixels; p += CONV_GEMM_TILE_PIXELS) {
+    int pixels = total_pixels - p < CONV_GEMM_TILE_PIXELS ? total_pixels - p : CONV_GEMM_TILE_PIXELS;
+    im2col_q15(input, s, p, pixels, patches);
+    gemm_q15_requant(patches, pixels, kernel, bias, s->filters, depth, rq, output + (size_t)p * s->filters);
+  }
+}
+
+#endif//_CONV_GEMM_H_
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
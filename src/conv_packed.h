@@ -0,0 +1,175 @@
+/**
+  ******************************************************************************
+  * @file    conv_packed.h
+  * @brief   conv2d/dense kernels on filter-blocked weights (model_packed.h)
+  *
+  * Selected at build time with -DWITH_PACKED_WEIGHTS. tools/repack_weights.py
+  * rewrites every conv2d/dense kernel table from [filters][y][x][c] into
+  * blocks of CONV_PACK_FILTERS filters, channels innermost and the filters
+  * of the block interleaved:
+  *
+  *   [filters / B][y][x][c][B]        (dense: [units / B][samples][B])
+  *
+  * The last block holds the remaining filters % B when filters is not a
+  * multiple of B, so the packed table has the size of the original one.
+  *
+  * For each output pixel a block of B filters is computed at once: each
+  * input value of the window is loaded once and multiplied by the B weights
+  * that follow it, so the weights are read strictly sequentially and the
+  * HWC window row by row, with B accumulators in registers.
+  *
+  * Results are bit-exact with the reference nested-loop templates.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _CONV_PACKED_H_
+#define _CONV_PACKED_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "nn_common.h"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef CONV_PACK_FILTERS
+#define CONV_PACK_FILTERS 4
+#endif
+#if CONV_PACK_FILTERS != 4 && CONV_PACK_FILTERS != 8
+#error "CONV_PACK_FILTERS must be 4 or 8"
+#endif
+
+// acc[b] += sum_i input[i] * weights[i * CONV_PACK_FILTERS + b]: the
+// weights of the filters of a block are interleaved. One local per
+// accumulator so that they stay in registers.
+static inline void packed_mac_q15(
+  int32_t acc[CONV_PACK_FILTERS],
+  const int16_t *input,
+  const int16_t *weights,
+  int count) {
+
+  int32_t a0 = acc[0], a1 = acc[1], a2 = acc[2], a3 = acc[3];
+#if CONV_PACK_FILTERS == 8
+  int32_t a4 = acc[4], a5 = acc[5], a6 = acc[6], a7 = acc[7];
+#endif
+  for (int i = 0; i < count; i++, weights += CONV_PACK_FILTERS) {
+    const int32_t v = input[i];
+    a0 += v * weights[0];
+    a1 += v * weights[1];
+    a2 += v * weights[2];
+    a3 += v * weights[3];
+#if CONV_PACK_FILTERS == 8
+    a4 += v * weights[4];
+    a5 += v * weights[5];
+    a6 += v * weights[6];
+    a7 += v * weights[7];
+#endif
+  }
+  acc[0] = a0; acc[1] = a1; acc[2] = a2; acc[3] = a3;
+#if CONV_PACK_FILTERS == 8
+  acc[4] = a4; acc[5] = a5; acc[6] = a6; acc[7] = a7;
+#endif
+}
+
+// Same for the last block of n < CONV_PACK_FILTERS filters
+static inline void packed_mac_q15_tail(
+  int32_t *acc,
+  const int16_t *input,
+  const int16_t *weights,
+  int count,
+  int n) {
+
+  for (int i = 0; i < count; i++) {
+    const int32_t v = input[i];
+    for (int b = 0; b < n; b++) {
+      acc[b] += v * weights[b];
+    }
+    weights += n;
+  }
+}
+
+// conv2d without zero-padding, packed kernel
+static inline void conv2d_packed_q15(
+  const int16_t *input,   // [input_height][input_width][input_channels]
+  const int16_t *packed,  // [filters / B][kernel_size_y][kernel_size_x][input_channels][B]
+  const int16_t *bias,    // [filters]
+  int16_t *output,        // [output_height][output_width][filters]
+  const conv_shape_t *s,
+  const requant_t *rq) {
+
+  const int row_len = s->kernel_size_x * s->input_channels;
+  const size_t input_row = (size_t)s->input_width * s->input_channels;
+
+  for (int pos_y = 0; pos_y < s->output_height; pos_y++) {
+    for (int pos_x = 0; pos_x < s->output_width; pos_x++) {
+      const int16_t *window = input + (size_t)pos_y * s->stride_y * input_row
+                              + (size_t)pos_x * s->stride_x * s->input_channels;
+      const int16_t *w = packed;
+      int k = 0;
+
+      for (; k + CONV_PACK_FILTERS <= s->filters; k += CONV_PACK_FILTERS) {
+        int32_t acc[CONV_PACK_FILTERS] = {0};
+        for (int y = 0; y < s->kernel_size_y; y++) {
+          packed_mac_q15(acc, window + y * input_row, w, row_len);
+          w += row_len * CONV_PACK_FILTERS;
+        }
+        for (int b = 0; b < CONV_PACK_FILTERS; b++) {
+          *output++ = requantize_q15(acc[b], bias[k + b], rq);
+        }
+      }
+
+      // Last, narrower block
+      const int rest = s->filters - k;
+      if (rest > 0) {
+        int32_t acc[CONV_PACK_FILTERS] = {0};
+        for (int y = 0; y < s->kernel_size_y; y++) {
+          packed_mac_q15_tail(acc, window + y * input_row, w, row_len, rest);
+          w += row_len * rest;
+        }
+        for (int b = 0; b < rest; b++) {
+          *output++ = requantize_q15(acc[b], bias[k + b], rq);
+        }
+      }
+    }
+  }
+}
+
+static inline void dense_packed_q15(
+  const int16_t *input,   // [samples]
+  const int16_t *packed,  // [units / B][samples][B]
+  const int16_t *bias,    // [units]
+  int16_t *output,        // [units]
+  int samples,
+  int units,
+  const requant_t *rq) {
+
+  const int16_t *w = packed;
+  int k = 0;
+  for (; k + CONV_PACK_FILTERS <= units; k += CONV_PACK_FILTERS) {
+    int32_t acc[CONV_PACK_FILTERS] = {0};
+    packed_mac_q15(acc, input, w, samples);
+    w += samples * CONV_PACK_FILTERS;
+    for (int b = 0; b < CONV_PACK_FILTERS; b++) {
+      output[k + b] = requantize_q15(acc[b], bias[k + b], rq);
+    }
+  }
+
+  const int rest = units - k;
+  if (rest > 0) {
+    int32_t acc[CONV_PACK_FILTERS] = {0};
+    packed_mac_q15_tail(acc, input, w, samples, rest);
+    for (int b = 0; b < rest; b++) {
+      output[k + b] = requantize_q15(acc[b], bias[k + b], rq);
+    }
+  }
+}
+
+#endif//_CONV_PACKED_H_
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
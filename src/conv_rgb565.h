@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file    conv_rgb565.h
+  * @brief   First conv2d layer fused with the RGB565 preprocessing
+  *
+  * conv2d_rgb565_q15() reads the network input straight from an RGB565
+  * image (flash table or camera frame buffer) instead of a 32x32x3 int16
+  * tensor. Source rows are unpacked into a ring of kernel_size_y rows as
+  * the output rows need them, each channel code being mapped to its input
+  * value through a 32-entry (red, blue) or 64-entry (green) table, so every
+  * pixel is unpacked once and the only scratch memory is the ring
+  * (3 x 32 x 3 int16 for this network instead of the 6 KB input tensor).
+  *
+  * The MACs go through dot_q15() (simd.h) and the output stage through
+  * requantize_q15(), so the outputs are bit-exact with pixelProcess32()
+  * followed by conv2d() when the tables are those of preprocess.h.
+  *
+  * It trades speed for memory: the runtime-sized 9-value dot_q15() per
+  * filter and the ring indirection cost more than the unpack they save,
+  * the layer runs at ~0.5-0.8x the speed of unpack + conv2d() on the host
+  * (bench_fused). The firmware only uses it with -DWITH_FUSED_RGB565.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _CONV_RGB565_H_
+#define _CONV_RGB565_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "nn_common.h"
+#include "simd.h"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Unpacks `width` RGB565 pixels into HWC int16 values
+static inline void rgb565_unpack_row_q15(
+  const uint16_t *pixels,
+  int width,
+  const int16_t *lut_5,   // [32] value of a red or blue code
+  const int16_t *lut_6,   // [64] value of a green code
+  int16_t *row) {         // [width][3]
+
+  for (int x = 0; x < width; x++, row += 3) {
+    uint16_t p = pixels[x];
+    row[0] = lut_5[p >> 11];
+    row[1] = lut_6[(p >> 5) & 0x3F];
+    row[2] = lut_5[p & 0x1F];
+  }
+}
+
+// conv2d without zero-padding on a 3-channel RGB565 image
+static inline void conv2d_rgb565_q15(
+  const uint16_t *pixels, // top-left pixel of the input_height x input_width window
+  size_t stride,          // distance between two source rows, in pixels
+  const int16_t *lut_5,
+  const int16_t *lut_6,
+  const int16_t *kernel,  // [filters][kernel_size_y][kernel_size_x][3]
+  const int16_t *bias,    // [filters]
+  int16_t *output,        // [output_height][output_width][filters]
+  int16_t *rows,          // scratch [kernel_size_y][input_width][3]
+  const conv_shape_t *s,
+  const requant_t *rq) {
+
+  const int row_len = s->kernel_size_x * s->input_channels;
+  const int depth = s->kernel_size_y * row_len;
+  const size_t row_size = (size_t)s->input_width * s->input_channels;
+  int next_row = 0;   // first source row not unpacked yet
+
+  for (int pos_y = 0; pos_y < s->output_height; pos_y++) {
+    int top = pos_y * s->stride_y;
+    const int16_t *window_rows[16];   // kernel_size_y <= 16
+
+    // Source row r lives in slot r % kernel_size_y of the ring
+    if (next_row < top) {
+      next_row = top;
+    }
+    for (; next_row < top + s->kernel_size_y; next_row++) {
+      rgb565_unpack_row_q15(pixels + (size_t)next_row * stride, s->input_width, lut_5, lut_6,
+                            rows + (size_t)(next_row % s->kernel_size_y) * row_size);
+    }
+    for (int y = 0; y < s->kernel_size_y; y++) {
+      window_rows[y] = rows + (size_t)((top + y) % s->kernel_size_y) * row_size;
+    }
+
+    for (int pos_x = 0; pos_x < s->output_width; pos_x++) {
+      size_t column = (size_t)pos_x * s->stride_x * s->input_channels;
+      int16_t *out = output + ((size_t)pos_y * s->output_width + pos_x) * s->filters;
+      for (int k = 0; k < s->filters; k++) {
+        const int16_t *filter = kernel + (size_t)k * depth;
+        int32_t acc = 0;
+        for (int y = 0; y < s->kernel_size_y; y++) {
+          acc += dot_q15(window_rows[y] + column, filter + y * row_len, row_len);
+        }
+        out[k] = requantize_q15(acc, bias[k], rq);
+      }
+    }
+  }
+}
+
+#endif//_CONV_RGB565_H_
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
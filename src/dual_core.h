@@ -0,0 +1,227 @@
+/**
+  ******************************************************************************
+  * @file    dual_core.h
+  * @brief   Split the conv2d/dense layers of cnn() between two cores
+  *
+  * Built with -DWITH_DUAL_CORE. Every conv2d/dense layer cuts its
+  * CONV_FILTERS / FC_UNITS range in two halves: the calling task computes
+  * the first half while a worker computes the second one, then both meet on
+  * a barrier before the next layer starts. Each half writes disjoint output
+  * channels, so the result is bit-exact with the single-core network.
+  *
+  *  - ESP32 (FreeRTOS): the worker is a task pinned to core 0, the Arduino
+  *    loop task running on core 1. Dispatch and barrier are direct-to-task
+  *    notifications, the cheapest FreeRTOS synchronization primitive.
+  *  - Host (C++): the worker is a std::thread. It polls for a new job for a
+  *    while before sleeping on a condition variable, the caller polls for
+  *    completion.
+  *
+  * Layers below DUAL_CORE_MIN_MACS multiply-accumulates run on the calling
+  * core only, since the barrier would cost more than the work it splits.
+  * dual_core_set_enabled(0) runs every layer on the calling core, to compare
+  * both modes in the same binary.
+  */
+
+#ifndef _DUAL_CORE_H_
+#define _DUAL_CORE_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "nn_common.h"
+#include "simd.h"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef DUAL_CORE_MIN_MACS
+#define DUAL_CORE_MIN_MACS 16384
+#endif
+
+// job(arg, part, parts) computes slice part of parts
+typedef void (*dual_core_job_t)(void *arg, int part, int parts);
+
+static int dual_core_enabled = 1;
+
+static inline void dual_core_set_enabled(int enabled) {
+  dual_core_enabled = enabled;
+}
+
+#if defined(ESP_PLATFORM)
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifndef DUAL_CORE_WORKER_CORE
+#define DUAL_CORE_WORKER_CORE 0
+#endif
+
+#ifndef DUAL_CORE_WORKER_STACK
+#define DUAL_CORE_WORKER_STACK 2048
+#endif
+
+static struct {
+  TaskHandle_t worker;
+  TaskHandle_t caller;
+  dual_core_job_t job;
+  void *arg;
+} dual_core_state;
+
+static void dual_core_worker(void *unused) {
+  (void)unused;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    dual_core_state.job(dual_core_state.arg, 1, 2);
+    xTaskNotifyGive(dual_core_state.caller);
+  }
+}
+
+static inline void dual_core_dispatch(dual_core_job_t job, void *arg) {
+  if (dual_core_state.worker == NULL
+      && xTaskCreatePinnedToCore(dual_core_worker, "cnn_worker", DUAL_CORE_WORKER_STACK, NULL,
+                                 uxTaskPriorityGet(NULL), &dual_core_state.worker,
+                                 DUAL_CORE_WORKER_CORE) != pdPASS) {
+    // No worker (out of memory): both halves on the caller, retried next layer
+    dual_core_state.worker = NULL;
+    job(arg, 0, 2);
+    job(arg, 1, 2);
+    return;
+  }
+  dual_core_state.job = job;
+  dual_core_state.arg = arg;
+  dual_core_state.caller = xTaskGetCurrentTaskHandle();
+  xTaskNotifyGive(dual_core_state.worker);
+  job(arg, 0, 2);
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+#elif defined(__cplusplus)
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Polls of the worker before it goes to sleep, and of the caller before it
+// yields the CPU. Polling is disabled on a single-CPU host, where it would
+// only steal time from the other thread.
+#ifndef DUAL_CORE_SPIN
+#define DUAL_CORE_SPIN 100000
+#endif
+
+struct dual_core_state_t {
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::atomic<unsigned> posted{0};
+  std::atomic<unsigned> done{0};
+  dual_core_job_t job = nullptr;
+  void *arg = nullptr;
+  int spin = std::thread::hardware_concurrency() > 1 ? DUAL_CORE_SPIN : 0;
+};
+
+// Never freed: the detached worker lives until the process exits
+static dual_core_state_t *dual_core_state;
+
+static void dual_core_worker(dual_core_state_t *st) {
+  unsigned seen = 0;
+  for (;;) {
+    for (int spin = 0; spin < st->spin && st->posted.load(std::memory_order_acquire) == seen; spin++) {
+    }
+    if (st->posted.load(std::memory_order_acquire) == seen) {
+      std::unique_lock<std::mutex> lock(st->mutex);
+      st->wake.wait(lock, [&] { return st->posted.load(std::memory_order_acquire) != seen; });
+    }
+    seen = st->posted.load(std::memory_order_acquire);
+    st->job(st->arg, 1, 2);
+    st->done.store(seen, std::memory_order_release);
+  }
+}
+
+static inline void dual_core_dispatch(dual_core_job_t job, void *arg) {
+  dual_core_state_t *st = dual_core_state;
+  if (st == nullptr) {
+    st = dual_core_state = new dual_core_state_t;
+    std::thread(dual_core_worker, st).detach();
+  }
+  st->job = job;
+  st->arg = arg;
+  unsigned ticket;
+  {
+    std::lock_guard<std::mutex> lock(st->mutex);
+    ticket = st->posted.load(std::memory_order_relaxed) + 1;
+    st->posted.store(ticket, std::memory_order_release);
+  }
+  st->wake.notify_one();
+  job(arg, 0, 2);
+  for (int spin = 0; st->done.load(std::memory_order_acquire) != ticket; spin++) {
+    if (spin >= st->spin) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+#else
+#error "WITH_DUAL_CORE needs FreeRTOS (ESP32) or a C++ host build"
+#endif
+
+static inline void dual_core_run(dual_core_job_t job, void *arg, long macs) {
+  if (dual_core_enabled && macs >= DUAL_CORE_MIN_MACS) {
+    dual_core_dispatch(job, arg);
+  } else {
+    job(arg, 0, 1);
+  }
+}
+
+typedef struct {
+  const int16_t *input;
+  const int16_t *kernel;
+  const int16_t *bias;
+  int16_t *output;
+  const conv_shape_t *shape;
+  const requant_t *rq;
+  int samples;            // dense only
+  int units;              // dense only
+} dual_core_layer_t;
+
+static void dual_core_conv2d_part(void *arg, int part, int parts) {
+  const dual_core_layer_t *l = (const dual_core_layer_t *)arg;
+  conv2d_simd_q15_filters(l->input, l->kernel, l->bias, l->output, l->shape, l->rq,
+                          l->shape->filters * part / parts, l->shape->filters * (part + 1) / parts);
+}
+
+static void dual_core_dense_part(void *arg, int part, int parts) {
+  const dual_core_layer_t *l = (const dual_core_layer_t *)arg;
+  dense_simd_q15_units(l->input, l->kernel, l->bias, l->output, l->samples, l->rq,
+                       l->units * part / parts, l->units * (part + 1) / parts);
+}
+
+// conv2d without zero-padding, filters split between the two cores
+static inline void dual_core_conv2d_q15(
+  const int16_t *input,
+  const int16_t *kernel,
+  const int16_t *bias,
+  int16_t *output,
+  const conv_shape_t *s,
+  const requant_t *rq) {
+
+  dual_core_layer_t layer = {input, kernel, bias, output, s, rq, 0, 0};
+  long macs = (long)s->output_height * s->output_width * s->filters
+              * s->kernel_size_y * s->kernel_size_x * s->input_channels;
+  dual_core_run(dual_core_conv2d_part, &layer, macs);
+}
+
+// dense, units split between the two cores
+static inline void dual_core_dense_q15(
+  const int16_t *input,
+  const int16_t *kernel,
+  const int16_t *bias,
+  int16_t *output,
+  int samples,
+  int units,
+  const requant_t *rq) {
+
+  dual_core_layer_t layer = {input, kernel, bias, output, NULL, rq, samples, units};
+  dual_core_run(dual_core_dense_part, &layer, (long)samples * units);
+}
+
+#endif//_DUAL_CORE_H_
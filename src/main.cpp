@@ -6,94 +6,610 @@
 
 #include <Arduino.h> // Include the Arduino library
 #include "model.h" // Include the model header file
+#include "preprocess.h"
+#include "postprocess.h"
 #include "trafficsigns.h"
 #include "math.h"
+#ifdef WITH_CAMERA
+#include "camera.h"
+#endif
+#ifdef WITH_PIPELINE
+#include "pipeline.h"
+#endif
+#ifdef WITH_TELEMETRY
+#include "telemetry.h"
+#endif
+#ifdef WITH_MODEL_STORE
+#ifndef WITH_MODEL_BLOB
+#error "WITH_MODEL_STORE demande WITH_MODEL_BLOB"
+#endif
+#include "model_store.h"
+#elif defined(WITH_MODEL_BLOB)
+#include "blob_map.h"
+#endif
+#ifdef WITH_SERIAL_PROTOCOL
+#include "protocol.h"
+#if defined(WITH_CAMERA) || defined(WITH_PIPELINE)
+#error "WITH_SERIAL_PROTOCOL ne se combine pas avec WITH_CAMERA ou WITH_PIPELINE"
+#endif
+#endif
 
-#define NBLABELS 28
 #define SEUILSOFTMAX 0.001
+#define SEUILSOFTMAX_Q15 ((uint16_t)(SEUILSOFTMAX * SOFTMAX_ONE))
+// Seuil d'affichage d'un panneau vu par la camera
+#define SEUILCAMERA 0.8
+#define SEUILCAMERA_Q15 ((uint16_t)(SEUILCAMERA * SOFTMAX_ONE))
+// Debit de la liaison serie au demarrage (le protocole binaire peut l'augmenter)
+#ifndef SERIAL_BAUD_RATE
+#define SERIAL_BAUD_RATE 115200
+#endif
 
+#ifndef WITH_PIPELINE
 static input_t inputs;
 static output_t outputs;
+#endif
 
 float StartTime;
 float CurrentTime;
 
 int cpt = 0;
 
-// Fonction pour convertir le rgb 565 en RGB 8 bits
-void rgb565_to_rgb888(unsigned short rgb565, int* red8, int* green8, int* blue8) {
-  // Decalage de la valeur rouge a droite de 11 bits.
-  unsigned char red5 = rgb565 >> 11;
-  // Decalage de la valeur verte a droite de 5 bits et extraction des 6 bits inferieurs.
-  unsigned char green6 = (rgb565 >> 5) & 0b111111;
-  // Extraction des 5 bits inferieurs.
-  unsigned char blue5 = rgb565 & 0b11111;
+#ifdef WITH_PIPELINE
+static bool pipelineStarted = false; // false : taches non creees ou flux termine
+static void startPipeline();
+#endif
 
-  // Conversion du rouge 5 bits en rouge 8 bits.
-  *red8 = round((float)red5 / 31 * 255);
-  // Conversion du vert 6 bits en vert 8 bits.
-  *green8 = round((float)green6 / 63 * 255);
-  // Conversion du bleu 5 bits en bleu 8 bits.
-  *blue8 = round((float)blue5 / 31 * 255);
+#ifdef WITH_MODEL_STORE
+// Deux emplacements de modele : l'actif et celui qui recoit le suivant
+static model_store_t modelStore;
+
+static void loadModelStore() {
+#ifdef ESP_PLATFORM
+  const char *source = NULL;
+#else
+  // Les deux partitions simulees dans un fichier
+  const char *source = getenv("MODEL_STORE") != NULL ? getenv("MODEL_STORE") : "model_store.bin";
+#endif
+  uint32_t start = micros();
+  if (modelStoreOpen(&modelStore, source, cnnUseBlob) != MODEL_STORE_OK) {
+    Serial.println("Modele : partitions model/model1 introuvables, poids compiles utilises");
+    return;
+  }
+  const model_blob_t *blob = modelStoreActive(&modelStore);
+  if (blob == NULL) {
+    Serial.println("Modele : aucun emplacement valide, poids compiles utilises");
+    return;
+  }
+  Serial.printf("Modele : %s, emplacement %d, generation %u (%u us)\n", blob->header->name, modelStore.active,
+                (unsigned int)modelStore.generation[modelStore.active], (unsigned int)(micros() - start));
+}
+#elif defined(WITH_MODEL_BLOB)
+// Modele charge depuis la partition "model" (ou le fichier $MODEL_BLOB sur PC)
+static blob_map_t modelMap;
+static model_blob_t modelBlob;
+
+static void loadModelBlob() {
+#ifdef ESP_PLATFORM
+  const char *source = MODEL_BLOB_PARTITION;
+#else
+  const char *source = getenv("MODEL_BLOB") != NULL ? getenv("MODEL_BLOB") : "model.bin";
+#endif
+  uint32_t start = micros();
+  int status = blobMapOpen(&modelMap, source, &modelBlob);
+  if (status != MODEL_BLOB_OK) {
+    Serial.printf("Modele : %s illisible (%s), poids compiles utilises\n", source, modelBlobStatusName(status));
+    return;
+  }
+  if (cnnUseBlob(&modelBlob) != 0) {
+    Serial.printf("Modele : %s incompatible avec input_t/output_t, poids compiles utilises\n",
+                  modelBlob.header->name);
+    blobMapClose(&modelMap);
+    return;
+  }
+  Serial.printf("Modele : %s, %u couches, %u o (%u us)\n", modelBlob.header->name,
+                (unsigned int)modelBlob.header->layer_count, (unsigned int)modelBlob.header->total_size,
+                (unsigned int)(micros() - start));
+}
+#endif
+
+#ifdef WITH_TELEMETRY
+static telemetry_t telemetry;
+static uint32_t lastReportUs = 0;
+
+// Un enregistrement binaire par image a la place des lignes de texte
+static void telemetryReport(uint32_t frame, int label, uint16_t confidence, uint32_t preprocess_us,
+                            uint32_t inference_us, uint32_t postprocess_us) {
+  uint32_t now = micros();
+  telemetry_record_t record;
+  record.frame = frame;
+  record.label = label >= 0 && confidence >= SEUILSOFTMAX_Q15 ? (uint8_t)label : 0xFF;
+  record.confidence = telemetryConfidenceQ7(confidence);
+  record.preprocess_us = preprocess_us;
+  record.inference_us = inference_us;
+  record.postprocess_us = postprocess_us;
+  record.period_us = lastReportUs != 0 ? now - lastReportUs : 0;
+  lastReportUs = now;
+  telemetryPush(&telemetry, &record);
+}
+
+// Envoie ce que la liaison accepte sans bloquer, le reste attend l'appel suivant
+static void telemetryDrain() {
+  const uint8_t *data;
+  size_t n;
+  while ((n = telemetryPeek(&telemetry, &data)) > 0) {
+    int room = Serial.availableForWrite();
+    if (room <= 0) {
+      break;
+    }
+    n = Serial.write(data, n < (size_t)room ? n : (size_t)room);
+    telemetryConsume(&telemetry, n);
+  }
 }
+#endif
 
-void pixelProcess32(const unsigned short *trafficSign){
-    // Initialisation des entrées avec des valeurs réelles de trafficsigns
-for (int i = 0; i < 32; i++) {   // Hauteur de l'image (ex: 32x32)
-  for (int j = 0; j < 32; j++) { // Largeur de l'image
-    uint16_t pixel = trafficSign[i * 32 + j]; // Récupère le pixel en 16 bits trafficsignX remplacer par image souhaitée
+void setup() {
+#if defined(WITH_SERIAL_PROTOCOL) && defined(ESP_PLATFORM)
+  // Une tuile complete peut arriver pendant l'inference de la precedente
+  Serial.setRxBufferSize(2 * PROTOCOL_MAX_ENCODED);
+#endif
+  Serial.begin(SERIAL_BAUD_RATE);
+  delay(10);
+  Serial.println("Ready !");
+#ifdef WITH_PLACEMENT
+  // Copie des poids chauds hors de la flash avant la premiere inference
+  uint32_t placementStart = micros();
+  int placementFailed = cnnPlacementInit();
+  Serial.printf("Placement : %u o copies en DRAM, %u o en PSRAM (%u us)\n",
+                (unsigned int)placementBytes(PLACEMENT_DRAM), (unsigned int)placementBytes(PLACEMENT_PSRAM),
+                (unsigned int)(micros() - placementStart));
+  if (placementFailed) {
+    Serial.printf("Placement : %d table(s) restee(s) en flash, memoire insuffisante\n", placementFailed);
+  }
+#endif
+#ifdef WITH_MODEL_STORE
+  loadModelStore();
+#elif defined(WITH_MODEL_BLOB)
+  loadModelBlob();
+#endif
+#ifdef WITH_TELEMETRY
+  telemetryInit(&telemetry);
+  Serial.write((uint8_t)0); // Separe le texte de la premiere trame
+#endif
 
-    // Extraction des composants RGB
-    inputs[i][j][0] = (pixel >> 11) & 0x1F; // Rouge (5 bits)
-    inputs[i][j][1] = (pixel >> 5) & 0x3F;  // Vert (6 bits)
-    inputs[i][j][2] = pixel & 0x1F;         // Bleu (5 bits)
+#ifdef WITH_CAMERA
+#if defined(ESP_PLATFORM)
+  M5.begin(); // Alimentation du capteur et bus I2C interne du CoreS3
+#endif
+  if (!cameraBegin()) {
+    Serial.println("Erreur : camera non initialisee");
   }
+#endif
+#ifdef WITH_PIPELINE
+  startPipeline();
+#endif
 }
+
+#ifdef WITH_CAMERA
+static camera_roi_t roi;
+#ifndef WITH_TELEMETRY
+static int lastLabel = -1;
+static uint32_t fpsFrames = 0;
+static uint64_t fpsStart = 0;
+#endif
+
+#ifndef WITH_PIPELINE
+// Capture -> ROI -> pretraitement -> cnn() -> softmax, une trame par appel.
+// Le capteur remplit deja la trame suivante pendant la classification.
+static void cameraLoop() {
+  camera_frame_t frame;
+  if (!cameraGrab(&frame)) {
+    return;
+  }
+  if (roi.size == 0) {
+    roi = cameraCenterRoi(frame.width, frame.height); // Carre central de la trame
+  }
+#ifdef WITH_TELEMETRY
+  // Un enregistrement par trame, la liaison se vide pendant la suivante
+  uint32_t t0 = micros();
+  bool valid = cameraFrameToInput(&frame, &roi, inputs) == 0;
+  uint32_t t1 = micros();
+  if (valid) {
+    cnn(inputs, outputs);
+  }
+  uint32_t t2 = micros();
+  uint16_t confidence = 0;
+  int label = valid ? softmaxLabelQ15(outputs, NULL, &confidence) : -1;
+  cameraRelease(&frame);
+  telemetryReport(frame.index, label, confidence, t1 - t0, t2 - t1, micros() - t2);
+  telemetryDrain();
+#else
+  uint16_t confidence;
+  int label = cameraClassify(&frame, &roi, inputs, outputs, &confidence);
+  cameraRelease(&frame);
+
+  // Affichage quand un nouveau panneau est reconnu
+  if (label >= 0 && confidence >= SEUILCAMERA_Q15 && label != lastLabel && labelName(label) != NULL) {
+    unsigned int percent100 = ((uint32_t)confidence * 10000 + SOFTMAX_ONE / 2) >> 15;
+    Serial.printf("Trame %u : %s (%u.%02u%%)\n", (unsigned int)frame.index, labelName(label),
+                  percent100 / 100, percent100 % 100);
+    lastLabel = label;
+  }
+
+  // Cadence soutenue, chaque seconde
+  uint64_t now = cameraMicros();
+  if (fpsFrames++ == 0) {
+    fpsStart = now;
+  } else if (now - fpsStart >= 1000000) {
+    Serial.printf("%.1f FPS\n", (fpsFrames - 1) * 1e6 / (double)(now - fpsStart));
+    fpsFrames = 0;
+  }
+#endif
 }
+#endif
+#endif
 
+#ifdef WITH_PIPELINE
+static pipeline_t pipeline;
 
-void pixelProcess43(const unsigned short *trafficSign){
-  uint8_t Xstart = (43-32)/2;
-  uint8_t Ystart = (43-32)/2; // Va rogner l'image est les pixels au delà seront perdus
+#ifdef WITH_CAMERA
+// Etage de depaquetage : trame camera -> ROI -> inputs
+static bool cameraSource(void *, pipeline_slot_t *slot) {
+  camera_frame_t frame;
+  if (!cameraGrab(&frame)) {
+    return false; // Fin du flux (ou trame manquee sur l'ESP32, voir loop())
+  }
+  if (roi.size == 0) {
+    roi = cameraCenterRoi(frame.width, frame.height);
+  }
+  int status = cameraFrameToInput(&frame, &roi, slot->inputs);
+  slot->id = frame.index;
+  cameraRelease(&frame);
+  if (status != 0) {
+    memset(slot->inputs, 0, sizeof(slot->inputs));
+  }
+  return true;
+}
+
+// Etage de rapport : nouveau panneau reconnu et cadence, comme cameraLoop()
+static void cameraSink(void *, const pipeline_slot_t *slot) {
+#ifdef WITH_TELEMETRY
+  telemetryReport(slot->id, slot->label, slot->confidence, slot->unpack_us, slot->infer_us, 0);
+  telemetryDrain();
+#else
+  if (slot->label >= 0 && slot->confidence >= SEUILCAMERA_Q15 && slot->label != lastLabel
+      && labelName(slot->label) != NULL) {
+    unsigned int percent100 = ((uint32_t)slot->confidence * 10000 + SOFTMAX_ONE / 2) >> 15;
+    Serial.printf("Trame %u : %s (%u.%02u%%)\n", (unsigned int)slot->id, labelName(slot->label),
+                  percent100 / 100, percent100 % 100);
+    lastLabel = slot->label;
+  }
+  uint64_t now = cameraMicros();
+  if (fpsFrames++ == 0) {
+    fpsStart = now;
+  } else if (now - fpsStart >= 1000000) {
+    Serial.printf("%.1f FPS\n", (fpsFrames - 1) * 1e6 / (double)(now - fpsStart));
+    fpsFrames = 0;
+  }
+#endif
+}
+#else
+// Etage de depaquetage : les trois panneaux de test, puis fin du flux
+static bool signSource(void *, pipeline_slot_t *slot) {
+  switch (slot->id) {
+  case 0:
+    pixelProcess32(trafficsign1, slot->inputs);
+    return true;
+  case 1:
+    pixelProcess32(trafficsign2, slot->inputs);
+    return true;
+  case 2:
+    pixelProcess43(trafficsign3, slot->inputs);
+    return true;
+  default:
+    return false;
+  }
+}
 
-  // Initialisation des entrées avec des valeurs réelles de trafficsigns
-for (int i = 0; i < 32; i++) {   // Hauteur de l'image (ex: 32x32)
-  for (int j = 0; j < 32; j++) { // Largeur de l'image
-    uint16_t pixel = trafficSign[(i+Ystart)*43+(j+Xstart)]; // Récupère le pixel en 16 bits trafficsignX remplacer par image souhaitée
+// Etage de rapport : memes messages que la boucle sequentielle
+static void signSink(void *, const pipeline_slot_t *slot) {
+#ifdef WITH_TELEMETRY
+  telemetryReport(slot->id, slot->label, slot->confidence, slot->unpack_us, slot->infer_us, 0);
+  telemetryDrain();
+#else
+  Serial.printf("Temps d'inference = %.6f ms\n\n", slot->infer_us / 1000.0);
+  unsigned int percent100 = ((uint32_t)slot->confidence * 10000 + SOFTMAX_ONE / 2) >> 15;
+  Serial.printf("Confidence sign[%u] : %u.%02u%%\n\n", (unsigned int)slot->id,
+                percent100 / 100, percent100 % 100);
+  if (slot->confidence >= SEUILSOFTMAX_Q15) {
+    if (labelName(slot->label) != NULL) {
+      Serial.printf("Class Predicted : %s\n", labelName(slot->label));
+    } else {
+      Serial.println("Error !");
+    }
+  } else {
+    Serial.println("No class detected");
+  }
+#endif
+}
+#endif
 
-    // Extraction des composants RGB
-    inputs[i][j][0] = (pixel >> 11) & 0x1F; // Rouge (5 bits)
-    inputs[i][j][1] = (pixel >> 5) & 0x3F;  // Vert (6 bits)
-    inputs[i][j][2] = pixel & 0x1F;         // Bleu (5 bits)
+static void startPipeline() {
+#ifdef WITH_CAMERA
+  pipelineStarted = pipelineBegin(&pipeline, cameraSource, NULL, cameraSink, NULL);
+#else
+  pipelineStarted = pipelineBegin(&pipeline, signSource, NULL, signSink, NULL);
+#endif
+  if (!pipelineStarted) {
+    Serial.println("Erreur : taches du pipeline non creees");
   }
 }
-  
+#endif
+
+#ifdef WITH_SERIAL_PROTOCOL
+static protocol_decoder_t decoder;
+static unsigned short tile[PROTOCOL_MAX_TILE * PROTOCOL_MAX_TILE];
+static uint32_t baudRate = SERIAL_BAUD_RATE;
+static uint32_t frameStart;   // Premier octet de la trame en cours
+
+// Le 0x00 initial separe la trame d'un eventuel texte (Serial.println) envoye avant
+static void protocolSend(uint8_t type, uint16_t seq, const uint8_t *body, size_t len) {
+  uint8_t frame[1 + PROTOCOL_FRAME_SIZE(PROTOCOL_MAX_REPLY)] = {0};
+  size_t n = protocolEncode(type, seq, body, len, frame + 1, sizeof(frame) - 1);
+  Serial.write(frame, 1 + n);
 }
 
-void setup() {
-  Serial.begin(115200);
-  delay(10);
-  Serial.println("Ready !");
+static void protocolError(uint16_t seq, uint8_t code) {
+  protocolSend(PROTOCOL_ERROR, seq, &code, 1);
+}
+
+// Tuile RGB565 -> cnn() -> softmax -> RESULT
+static void protocolImage(const protocol_message_t *message) {
+  int width = message->len >= 2 ? message->body[0] : 0;
+  int height = message->len >= 2 ? message->body[1] : 0;
+  if (width == 0 || height == 0 || width > PROTOCOL_MAX_TILE || height > PROTOCOL_MAX_TILE
+      || message->len != 2 + 2 * (size_t)width * height) {
+    protocolError(message->seq, PROTOCOL_ERR_SIZE);
+    return;
+  }
+  for (int i = 0; i < width * height; i++) {
+    tile[i] = protocolGet16(message->body + 2 + 2 * i);
+  }
 
-  
+  uint32_t start = micros();
+  if (width == 32 && height == 32) {
+#ifdef WITH_FUSED_RGB565
+    cnnRGB565(tile, 32, 0, 0, outputs);
+#else
+    rgb565FrameToInput(tile, 32, 0, 0, inputs);
+    cnn(inputs, outputs);
+#endif
+  } else {
+    resample565(tile, width, height, width, PREPROCESS_43_FILTER, inputs);
+    cnn(inputs, outputs);
+  }
+  uint16_t confidence;
+  int label = softmaxLabelQ15(outputs, NULL, &confidence);
+  uint32_t end = micros();
+
+  uint8_t result[PROTOCOL_RESULT_SIZE];
+  result[0] = confidence >= SEUILSOFTMAX_Q15 ? (uint8_t)label : 0xFF;
+  protocolPut16(result + 1, confidence);
+  protocolPut32(result + 3, end - start);
+  protocolPut32(result + 7, end - frameStart);
+  protocolSend(PROTOCOL_RESULT, message->seq, result, sizeof(result));
+}
+
+#ifdef WITH_MODEL_STORE
+// Reception d'un modele dans l'emplacement inactif, bascule a MODEL_COMMIT.
+// Les messages sont traites entre deux inferences : la suivante utilise deja
+// le nouveau modele, sans redemarrage.
+static void protocolModel(const protocol_message_t *message) {
+  int status = MODEL_STORE_OK;
+  switch (message->type) {
+  case PROTOCOL_MODEL_BEGIN:
+    if (message->len != 4) {
+      protocolError(message->seq, PROTOCOL_ERR_SIZE);
+      return;
+    }
+    status = modelStoreBegin(&modelStore, protocolGet32(message->body));
+    break;
+  case PROTOCOL_MODEL_DATA:
+    if (message->len < 4 || message->len > 4 + PROTOCOL_MODEL_CHUNK) {
+      protocolError(message->seq, PROTOCOL_ERR_SIZE);
+      return;
+    }
+    status = modelStoreWrite(&modelStore, protocolGet32(message->body), message->body + 4,
+                             (uint32_t)message->len - 4);
+    break;
+  case PROTOCOL_MODEL_COMMIT:
+    status = modelStoreCommit(&modelStore, cnnUseBlob);
+    break;
+  default: // PROTOCOL_MODEL_INFO
+    break;
+  }
+
+  const model_blob_t *blob = modelStoreActive(&modelStore);
+  uint8_t reply[PROTOCOL_MODEL_SIZE] = {0};
+  reply[0] = (uint8_t)status;
+  reply[1] = blob != NULL ? (uint8_t)modelStore.active : 0xFF;
+  protocolPut32(reply + 2, modelStore.received);
+  if (blob != NULL) {
+    memcpy(reply + 6, blob->header->name, MODEL_BLOB_NAME_SIZE);
+  }
+  protocolSend(PROTOCOL_MODEL, message->seq, reply, sizeof(reply));
+}
+#endif
+
+static void protocolHandle(const protocol_message_t *message) {
+  switch (message->type) {
+  case PROTOCOL_PING: {
+    uint8_t pong[6] = {PROTOCOL_VERSION, PROTOCOL_MAX_TILE};
+    protocolPut32(pong + 2, baudRate);
+    protocolSend(PROTOCOL_PONG, message->seq, pong, sizeof(pong));
+    break;
+  }
+  case PROTOCOL_IMAGE:
+    protocolImage(message);
+    break;
+#ifdef WITH_MODEL_STORE
+  case PROTOCOL_MODEL_BEGIN:
+  case PROTOCOL_MODEL_DATA:
+  case PROTOCOL_MODEL_COMMIT:
+  case PROTOCOL_MODEL_INFO:
+    protocolModel(message);
+    break;
+#endif
+  case PROTOCOL_BAUD: {
+    uint32_t baud = message->len == 4 ? protocolGet32(message->body) : 0;
+    if (baud < 9600 || baud > 5000000) {
+      protocolError(message->seq, PROTOCOL_ERR_BAUD);
+      break;
+    }
+    protocolSend(PROTOCOL_ACK, message->seq, message->body, 4);
+    Serial.flush(); // L'ACK part a l'ancien debit
+#if defined(ESP_PLATFORM) && !ARDUINO_USB_CDC_ON_BOOT
+    Serial.updateBaudRate(baud);
+#endif
+    // USB CDC (CoreS3) et pseudo-terminal de l'hote : le debit est sans effet
+    baudRate = baud;
+    break;
+  }
+  default:
+    protocolError(message->seq, PROTOCOL_ERR_TYPE);
+    break;
+  }
 }
 
+// Consomme les octets recus, une reponse par trame complete
+static void protocolLoop() {
+  uint8_t chunk[256];
+  size_t n;
+  while ((n = Serial.available()) > 0) {
+    n = Serial.readBytes(chunk, n < sizeof(chunk) ? n : sizeof(chunk));
+    for (size_t i = 0; i < n; i++) {
+      if (decoder.len == 0 && chunk[i] != 0) {
+        frameStart = micros();
+      }
+      protocol_message_t message;
+      if (protocolFeed(&decoder, chunk[i], &message)) {
+        protocolHandle(&message);
+      }
+    }
+  }
+}
+#endif
+
 void loop() {
+#if defined(WITH_SERIAL_PROTOCOL)
+  protocolLoop();
+#elif defined(WITH_PIPELINE) && defined(WITH_CAMERA)
+  // Inference de la trame N pendant que N+1 est depaquetee et N-1 rapportee
+  if (pipelineStarted && !pipelineStep(&pipeline)) {
+    pipelineEnd(&pipeline);
+#if defined(ESP_PLATFORM)
+    startPipeline(); // Delai du capteur depasse : le flux reprend
+#else
+    pipelineStarted = false; // Fin du flux rejoue, le pipeline reste arrete
+#endif
+  }
+#elif defined(WITH_PIPELINE)
+  // Inference de l'image N pendant que N+1 est depaquetee et N-1 affichee
+  if (pipelineStarted && cpt <= 2) {
+    pipelineStep(&pipeline);
+    if (++cpt > 2) {
+      pipelineEnd(&pipeline); // Attend les derniers affichages
+#ifndef WITH_TELEMETRY
+      Serial.println("Fin du programme");
+#endif
+    }
+  }
+#ifdef WITH_TELEMETRY
+  else {
+    telemetryDrain(); // L'etage de rapport est termine, loop() finit de vider l'anneau
+  }
+#endif
+#elif defined(WITH_CAMERA)
+  cameraLoop();
+#elif defined(WITH_TELEMETRY)
+  // Les trois panneaux en boucle, un enregistrement binaire par inference.
+  static uint32_t frame = 0; // Numero d'enregistrement, revient a 0 sans UB
+  telemetryDrain();
+  uint32_t t0 = micros();
+#ifdef WITH_FUSED_RGB565
+  // Les 32x32 passent par la convolution fusionnee (depaquetage dans l'inference)
+  if (frame % 3 == 2) {
+    pixelProcess43(trafficsign3, inputs);
+  }
+  uint32_t t1 = micros();
+  switch (frame % 3) {
+  case 0:
+    cnnRGB565(trafficsign1, 32, 0, 0, outputs);
+    break;
+  case 1:
+    cnnRGB565(trafficsign2, 32, 0, 0, outputs);
+    break;
+  case 2:
+    cnn(inputs, outputs);
+    break;
+  }
+#else
+  switch (frame % 3) {
+  case 0:
+    pixelProcess32(trafficsign1, inputs);
+    break;
+  case 1:
+    pixelProcess32(trafficsign2, inputs);
+    break;
+  case 2:
+    pixelProcess43(trafficsign3, inputs);
+    break;
+  }
+  uint32_t t1 = micros();
+  cnn(inputs, outputs);
+#endif
+  uint32_t t2 = micros();
+  uint16_t confidence;
+  int label = softmaxLabelQ15(outputs, NULL, &confidence);
+  telemetryReport(frame++, label, confidence, t1 - t0, t2 - t1, micros() - t2);
+  telemetryDrain();
+#else
   if (cpt <= 2) {
+#ifdef WITH_FUSED_RGB565
+    // Les images 32x32 passent par la convolution fusionnee, leur depaquetage
+    // fait donc partie du temps mesure : le redimensionnement de la 43x43 aussi.
+    StartTime = micros(); // démarre un chrono pour calculer temps inference en microseconds
+
+    switch (cpt)
+    {
+    case 0:
+      cnnRGB565(trafficsign1, 32, 0, 0, outputs);
+      break;
+    case 1: 
+      cnnRGB565(trafficsign2, 32, 0, 0, outputs);
+      break;
+    case 2:
+      pixelProcess43(trafficsign3, inputs);
+      cnn(inputs, outputs);
+      break;
+    }
+
+    CurrentTime = micros(); // Fin du chrono (temps = currentTime-StartTime)
+
+    printf("Temps d'inference (pretraitement inclus) = %.6f ms\n\n", (CurrentTime - StartTime)/1000);
+#else
     switch (cpt)
     {
     case 0:
-      pixelProcess32(trafficsign1);
+      pixelProcess32(trafficsign1, inputs);
       break;
     case 1: 
-      pixelProcess32(trafficsign2);
+      pixelProcess32(trafficsign2, inputs);
       break;
     case 2:
-      pixelProcess43(trafficsign3);
+      pixelProcess43(trafficsign3, inputs);
       break;
     }
 
-    
     StartTime = micros(); // démarre un chrono pour calculer temps inference en microseconds
 
     // Cette fonction réalise l'inférence du modèle
@@ -102,59 +618,26 @@ void loop() {
     CurrentTime = micros(); // Fin du chrono (temps = currentTime-StartTime)
 
     printf("Temps d'inference = %.6f ms\n\n", (CurrentTime - StartTime)/1000);
-    // TODO : Ajoutez ici votre code pour calculer le softmax,
-      int label = 0;
-      float sum = 0;
-      float max_val = outputs[0];
-      for (int i = 1; i < NBLABELS; i++) {
-        sum += exp(outputs[i]/100);
-        if (max_val < outputs[i]) {
-          max_val = (float)outputs[i];
-          label = i;
-        }
-      }
-
-      //calculate prediction accuracy with softmax
-      float softmax[NBLABELS];
-
-      for (int i = 0; i < NBLABELS; i++) {
-        softmax[i] = exp(outputs[i]/100) / sum;
-      }
-      Serial.printf("Confidence sign[%d] : %.2f%%\n\n", cpt, softmax[label] * 100); //print the confidence of the prediction
+#endif
+#ifdef WITH_LAYER_PROFILING
+    // Temps de chaque couche de la derniere inference
+    static char profile[256];
+    cnn_profile_dump(profile, sizeof(profile));
+    Serial.println(profile);
+#endif
+    // Calcul du softmax (virgule fixe Q15) et de la classe predite
+      uint16_t confidence;
+      int label = softmaxLabelQ15(outputs, NULL, &confidence);
+      unsigned int percent100 = ((uint32_t)confidence * 10000 + SOFTMAX_ONE / 2) >> 15;
+      Serial.printf("Confidence sign[%d] : %u.%02u%%\n\n", cpt, percent100 / 100, percent100 % 100); //print the confidence of the prediction
 
 
     // Print the label predicted
-    if(softmax[label] >= SEUILSOFTMAX) { // Seuil de confiance
-      switch(label){
-        case 0 : Serial.println("Class Predicted : 20 km/h"); break;
-        case 1 : Serial.println("Class Predicted : 30 km/h"); break;
-        case 2 : Serial.println("Class Predicted : 50 km/h"); break;
-        case 3 : Serial.println("Class Predicted : 60 km/h"); break;
-        case 4 : Serial.println("Class Predicted : 70 km/h"); break;
-        case 5 : Serial.println("Class Predicted : 80 km/h"); break;
-        case 6 : Serial.println("Class Predicted : 100 km/h"); break;
-        case 7 : Serial.println("Class Predicted : 120 km/h"); break;
-        case 8 : Serial.println("Class Predicted : Wrong way"); break;
-        case 9 : Serial.println("Class Predicted : Stop"); break;
-        case 10 : Serial.println("Class Predicted : Yield"); break;
-        case 11 : Serial.println("Class Predicted : Danger"); break;
-        case 12 : Serial.println("Class Predicted : Dangerous left turn"); break;
-        case 13 : Serial.println("Class Predicted : Dangerous right turn"); break;
-        case 14 : Serial.println("Class Predicted : Winding road"); break;
-        case 15 : Serial.println("Class Predicted : Slippery road"); break;
-        case 16 : Serial.println("Class Predicted : Crosswalk"); break;
-        case 17 : Serial.println("Class Predicted : Bicycles"); break;
-        case 18 : Serial.println("Class Predicted : Animals"); break;
-        case 19 : Serial.println("Class Predicted : Red light"); break;
-        case 20 : Serial.println("Class Predicted : Road bumps"); break;
-        case 21 : Serial.println("Class Predicted : Workers ahead"); break;
-        case 22 : Serial.println("Class Predicted : Right or Forward"); break;
-        case 23 : Serial.println("Class Predicted : Left or Forward"); break;
-        case 24 : Serial.println("Class Predicted : Right"); break;
-        case 25 : Serial.println("Class Predicted : Left"); break;
-        case 26 : Serial.println("Class Predicted : Forward"); break;
-        case 27 : Serial.println("Class Predicted : End of game"); break;
-        default : Serial.println("Error !"); break;
+    if(confidence >= SEUILSOFTMAX_Q15) { // Seuil de confiance
+      if (labelName(label) != NULL) {
+        Serial.printf("Class Predicted : %s\n", labelName(label));
+      } else {
+        Serial.println("Error !");
       }
       if(cpt > 2){
         Serial.println("Fin du programme");
@@ -166,4 +649,5 @@ void loop() {
       Serial.println("No class detected");
     }
   }
-}
\ No newline at end of file
+#endif
+}
@@ -239,6 +239,55 @@ static inline void int8_t_to_float(int8_t * tabint, float * tabfloat, long tabdi
 #ifdef __cplusplus
 } // extern "C"
 #endif
+
+#include "nn_common.h"
+#include "simd.h"
+#include "conv_gemm.h"
+#include "conv_packed.h"
+#include "nn_batch.h"
+#include "conv_rgb565.h"
+
+#ifdef WITH_DUAL_CORE
+#include "dual_core.h"
+#endif
+
+#ifdef WITH_BN_FOLDING
+#include "model_bnfold.h"
+#endif
+
+#ifdef WITH_MEMORY_PLAN
+#include "model_arena.h"
+#endif
+
+#ifdef WITH_SPECIALIZED_CONV
+#include "model_convspec.h"
+#endif
+
+#ifdef WITH_PACKED_WEIGHTS
+#if defined(WITH_DUAL_CORE) || defined(WITH_SPECIALIZED_CONV) || defined(WITH_IM2COL_GEMM) || defined(WITH_SIMD) \
+    || defined(WITH_CMSIS_NN) || defined(WITH_NMSIS_NN)
+#error "WITH_PACKED_WEIGHTS: the other engines read the kernels in the [filters][y][x][c] layout"
+#endif
+#include "model_packed.h"
+#endif
+
+#ifdef WITH_WEIGHT_STREAM
+#if defined(WITH_PACKED_WEIGHTS) || defined(WITH_DUAL_CORE) || defined(WITH_CMSIS_NN) || defined(WITH_NMSIS_NN)
+#error "WITH_WEIGHT_STREAM streams [filters][y][x][c] kernels with core 0 as the copier"
+#endif
+#include "weight_stream.h"
+#endif
+
+#ifdef WITH_PLACEMENT
+#ifdef WITH_INT8
+#error "WITH_PLACEMENT: the int8 tables of model_int8.h are not in the placement map"
+#endif
+#include "placement.h"
+#endif
+
+#ifdef WITH_MODEL_BLOB
+#include "nn_blob.h"
+#endif
 /**
   ******************************************************************************
   * @file    conv2d.hh
@@ -278,7 +327,7 @@ typedef int16_t conv2d_output_type[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS];
 #if 0
 void conv2d(
   const number_t input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],               // IN
-  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE_X][CONV_KERNEL_SIZE_Y][INPUT_CHANNELS], // IN
+  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS], // IN
 
   const number_t bias[CONV_FILTERS],						                // IN
 
@@ -356,70 +405,136 @@ void conv2d(
 
 static inline void conv2d(
   const NUMBER_T input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],               // IN
-  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_X][CONV_KERNEL_SIZE_Y][INPUT_CHANNELS / CONV_GROUPS], // IN
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
 
   const NUMBER_T bias[CONV_FILTERS],						                // IN
 
   NUMBER_T output[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]) {               // OUT
 
-#if !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
+#if defined(WITH_IM2COL_GEMM) || defined(WITH_SIMD) || defined(WITH_DUAL_CORE) || defined(WITH_SPECIALIZED_CONV) \
+    || defined(WITH_PACKED_WEIGHTS)
+#if CONV_GROUPS != 1
+#error "WITH_IM2COL_GEMM, WITH_SIMD, WITH_DUAL_CORE, WITH_SPECIALIZED_CONV and WITH_PACKED_WEIGHTS do not support grouped convolutions"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+#if defined(WITH_PACKED_WEIGHTS)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_PACKED_WEIGHTS does not support zero-padding"
+#endif
+  // kernel is the filter-blocked table of model_packed.h
+  conv2d_packed_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_DUAL_CORE)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_DUAL_CORE does not support zero-padding"
+#endif
+  dual_core_conv2d_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_SPECIALIZED_CONV)
+  // Kernel generated for this layer shape (literal in model_convspec.h)
+  (void)shape;
+  conv2d_specialized(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &requant);
+#elif defined(WITH_IM2COL_GEMM)
+#ifdef WITH_MEMORY_PLAN
+  NUMBER_T *patches = (NUMBER_T *)(cnn_arena + CNN_ARENA_conv2d_scratch);
+#else
+  static NUMBER_T patches[CONV_GEMM_TILE_PIXELS * CONV_KERNEL_SIZE_Y * CONV_KERNEL_SIZE_X * INPUT_CHANNELS] NN_ALIGNED;
+#endif
+
+  conv2d_im2col_gemm_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    patches,
+    &shape,
+    &requant);
+#else
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_SIMD does not support zero-padding"
+#endif
+  conv2d_simd_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#endif
+#elif !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
   unsigned short pos_x, pos_y, z, k; 	// loop indexes for output volume
   unsigned short x, y;
   int input_x, input_y;
-  LONG_NUMBER_T	kernel_mac;
-  LONG_NUMBER_T tmp;
-  static LONG_NUMBER_T	output_acc[CONV_OUTHEIGHT][CONV_OUTWIDTH];
-
-  for (k = 0; k < CONV_FILTERS; k++) { 
-    for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
-      for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
-        output_acc[pos_y][pos_x] = 0;
-
-        for (z = 0; z < INPUT_CHANNELS / CONV_GROUPS; z++) {
-          kernel_mac = 0; 
-            
-          for (y = 0; y < CONV_KERNEL_SIZE_Y; y++) {
-            input_y = pos_y * CONV_STRIDE_Y - ZEROPADDING_TOP + y;
-
-            for (x = 0; x < CONV_KERNEL_SIZE_X; x++) {
-              input_x = pos_x * CONV_STRIDE_X - ZEROPADDING_LEFT + x;
-
-              if (input_x < 0 || input_x >= INPUT_WIDTH || input_y < 0 || input_y >= INPUT_HEIGHT) // ZeroPadding2D
-                tmp = 0;
-              else
-                tmp = (LONG_NUMBER_T)input[input_y][input_x][z + (k / FILTERS_PER_GROUP) * CHANNELS_PER_GROUP] * (LONG_NUMBER_T)kernel[k][y][x][z];
-              kernel_mac = kernel_mac + tmp;
+  LONG_NUMBER_T	output_acc;
+
+  // One output pixel at a time: each filter accumulates in a register and
+  // the CONV_FILTERS results of the pixel are written contiguously
+  for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
+    for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
+      for (k = 0; k < CONV_FILTERS; k++) { 
+        output_acc = 0;
+
+        for (y = 0; y < CONV_KERNEL_SIZE_Y; y++) {
+          input_y = pos_y * CONV_STRIDE_Y - ZEROPADDING_TOP + y;
+          if (input_y < 0 || input_y >= INPUT_HEIGHT) // ZeroPadding2D
+            continue;
+
+          for (x = 0; x < CONV_KERNEL_SIZE_X; x++) {
+            input_x = pos_x * CONV_STRIDE_X - ZEROPADDING_LEFT + x;
+            if (input_x < 0 || input_x >= INPUT_WIDTH) // ZeroPadding2D
+              continue;
+
+            for (z = 0; z < INPUT_CHANNELS / CONV_GROUPS; z++) {
+              output_acc += (LONG_NUMBER_T)input[input_y][input_x][z + (k / FILTERS_PER_GROUP) * CHANNELS_PER_GROUP] * (LONG_NUMBER_T)kernel[k][y][x][z];
             }
           }
-
-          output_acc[pos_y][pos_x] = output_acc[pos_y][pos_x] + kernel_mac;
-
         }
-      }
-    }
 
-    for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
-      for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
         // Scale for possible additional precision of bias
-        output_acc[pos_y][pos_x] = scale(NUMBER_T, output_acc[pos_y][pos_x],  WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output_acc = scale(NUMBER_T, output_acc,  WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 
         // Scale bias to match accumulator
-        output_acc[pos_y][pos_x] += scale(NUMBER_T, (LONG_NUMBER_T)bias[k], BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output_acc += scale(NUMBER_T, (LONG_NUMBER_T)bias[k], BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 
 
 #ifdef ACTIVATION_LINEAR
-        output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc[pos_y][pos_x], INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc, INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 #elif defined(ACTIVATION_RELU) || defined(ACTIVATION_RELU6)
         // Activation function: ReLU
-        if (output_acc[pos_y][pos_x] < 0) {
+        if (output_acc < 0) {
           output[pos_y][pos_x][k] = 0;
         } else {
 #if defined(ACTIVATION_RELU6)
-        if (output_acc[pos_y][pos_x] > scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE)) {
-          output_acc[pos_y][pos_x] = scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE);
+        if (output_acc > scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE)) {
+          output_acc = scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE);
         }
 #endif
-          output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc[pos_y][pos_x], INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+          output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc, INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
         }
 #else
 #error "Unsupported activation function"
@@ -474,6 +589,70 @@ static inline void conv2d(
 #endif
 }
 
+// Same layer on n <= CNN_BATCH_SIZE images, each filter read once per batch
+static inline void conv2d_batch(
+  const NUMBER_T *const inputs[],                                               // IN [n][INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS]
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
+
+  const NUMBER_T bias[CONV_FILTERS],						                // IN
+
+  NUMBER_T *const outputs[],                                                    // OUT [n][CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]
+  unsigned int n) {
+
+#if CONV_GROUPS != 1 || ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "cnn_batch() does not support grouped convolutions or zero-padding"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+
+  conv2d_batch_q15(inputs, (const NUMBER_T*)kernel, bias, outputs, n, &shape, &requant);
+}
+
+// Same layer reading its input straight from an RGB565 image (conv_rgb565.h)
+static inline void conv2d_rgb565(
+  const uint16_t *pixels,                                                       // IN [INPUT_HEIGHT] rows of `stride` RGB565 pixels
+  size_t stride,
+  const NUMBER_T lut_5[32],                                                     // IN value of a red/blue code
+  const NUMBER_T lut_6[64],                                                     // IN value of a green code
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
+
+  const NUMBER_T bias[CONV_FILTERS],						                // IN
+
+  NUMBER_T output[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]) {               // OUT
+
+#if INPUT_CHANNELS != 3 || CONV_GROUPS != 1 || ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "conv2d_rgb565() needs a 3-channel input without groups or zero-padding"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+#ifdef WITH_MEMORY_PLAN
+  NUMBER_T *rows = (NUMBER_T *)(cnn_arena + CNN_ARENA_conv2d_scratch);
+#else
+  static NUMBER_T rows[CONV_KERNEL_SIZE_Y][INPUT_WIDTH][INPUT_CHANNELS] NN_ALIGNED;
+#endif
+
+  conv2d_rgb565_q15(pixels, stride, lut_5, lut_6, (const NUMBER_T*)kernel, bias,
+                    (NUMBER_T*)output, (NUMBER_T*)rows, &shape, &requant);
+}
+
 #undef INPUT_CHANNELS
 #undef INPUT_WIDTH
 #undef INPUT_HEIGHT
@@ -521,7 +700,7 @@ const int16_t conv2d_bias[CONV_FILTERS] = {3, 3, 4, 6, 31, -9, 4, 4}
 ;
 
 
-const int16_t conv2d_kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS] = {{{{-14, -15, 3}
+const int16_t conv2d_kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS] NN_ALIGNED = {{{{-14, -15, 3}
 , {-3, 11, 13}
 , {-4, 40, 10}
 }
@@ -803,7 +982,7 @@ typedef int16_t conv2d_1_output_type[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS
 #if 0
 void conv2d_1(
   const number_t input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],               // IN
-  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE_X][CONV_KERNEL_SIZE_Y][INPUT_CHANNELS], // IN
+  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS], // IN
 
   const number_t bias[CONV_FILTERS],						                // IN
 
@@ -869,8 +1048,14 @@ void conv2d_1(
 #define ACTIVATION_RELU
 
 // For fixed point quantization
+#if defined(WITH_BN_FOLDING)
+// Preceding batch_normalization folded into the weights, see model_bnfold.h
+#define WEIGHTS_SCALE_FACTOR CONV2D_1_FOLDED_WEIGHTS_SCALE_FACTOR
+#define BIASES_SCALE_FACTOR CONV2D_1_FOLDED_BIASES_SCALE_FACTOR
+#else
 #define WEIGHTS_SCALE_FACTOR 7
 #define BIASES_SCALE_FACTOR 7
+#endif
 #define TMP_SCALE_FACTOR 7
 #define INPUT_SCALE_FACTOR 7
 #define OUTPUT_SCALE_FACTOR 7
@@ -881,70 +1066,136 @@ void conv2d_1(
 
 static inline void conv2d_1(
   const NUMBER_T input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],               // IN
-  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_X][CONV_KERNEL_SIZE_Y][INPUT_CHANNELS / CONV_GROUPS], // IN
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
 
   const NUMBER_T bias[CONV_FILTERS],						                // IN
 
   NUMBER_T output[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]) {               // OUT
 
-#if !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
+#if defined(WITH_IM2COL_GEMM) || defined(WITH_SIMD) || defined(WITH_DUAL_CORE) || defined(WITH_SPECIALIZED_CONV) \
+    || defined(WITH_PACKED_WEIGHTS)
+#if CONV_GROUPS != 1
+#error "WITH_IM2COL_GEMM, WITH_SIMD, WITH_DUAL_CORE, WITH_SPECIALIZED_CONV and WITH_PACKED_WEIGHTS do not support grouped convolutions"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+#if defined(WITH_PACKED_WEIGHTS)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_PACKED_WEIGHTS does not support zero-padding"
+#endif
+  // kernel is the filter-blocked table of model_packed.h
+  conv2d_packed_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_DUAL_CORE)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_DUAL_CORE does not support zero-padding"
+#endif
+  dual_core_conv2d_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_SPECIALIZED_CONV)
+  // Kernel generated for this layer shape (literal in model_convspec.h)
+  (void)shape;
+  conv2d_1_specialized(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &requant);
+#elif defined(WITH_IM2COL_GEMM)
+#ifdef WITH_MEMORY_PLAN
+  NUMBER_T *patches = (NUMBER_T *)(cnn_arena + CNN_ARENA_conv2d_1_scratch);
+#else
+  static NUMBER_T patches[CONV_GEMM_TILE_PIXELS * CONV_KERNEL_SIZE_Y * CONV_KERNEL_SIZE_X * INPUT_CHANNELS] NN_ALIGNED;
+#endif
+
+  conv2d_im2col_gemm_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    patches,
+    &shape,
+    &requant);
+#else
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_SIMD does not support zero-padding"
+#endif
+  conv2d_simd_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#endif
+#elif !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
   unsigned short pos_x, pos_y, z, k; 	// loop indexes for output volume
   unsigned short x, y;
   int input_x, input_y;
-  LONG_NUMBER_T	kernel_mac;
-  LONG_NUMBER_T tmp;
-  static LONG_NUMBER_T	output_acc[CONV_OUTHEIGHT][CONV_OUTWIDTH];
-
-  for (k = 0; k < CONV_FILTERS; k++) { 
-    for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
-      for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
-        output_acc[pos_y][pos_x] = 0;
-
-        for (z = 0; z < INPUT_CHANNELS / CONV_GROUPS; z++) {
-          kernel_mac = 0; 
-            
-          for (y = 0; y < CONV_KERNEL_SIZE_Y; y++) {
-            input_y = pos_y * CONV_STRIDE_Y - ZEROPADDING_TOP + y;
-
-            for (x = 0; x < CONV_KERNEL_SIZE_X; x++) {
-              input_x = pos_x * CONV_STRIDE_X - ZEROPADDING_LEFT + x;
-
-              if (input_x < 0 || input_x >= INPUT_WIDTH || input_y < 0 || input_y >= INPUT_HEIGHT) // ZeroPadding2D
-                tmp = 0;
-              else
-                tmp = (LONG_NUMBER_T)input[input_y][input_x][z + (k / FILTERS_PER_GROUP) * CHANNELS_PER_GROUP] * (LONG_NUMBER_T)kernel[k][y][x][z];
-              kernel_mac = kernel_mac + tmp;
+  LONG_NUMBER_T	output_acc;
+
+  // One output pixel at a time: each filter accumulates in a register and
+  // the CONV_FILTERS results of the pixel are written contiguously
+  for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
+    for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
+      for (k = 0; k < CONV_FILTERS; k++) { 
+        output_acc = 0;
+
+        for (y = 0; y < CONV_KERNEL_SIZE_Y; y++) {
+          input_y = pos_y * CONV_STRIDE_Y - ZEROPADDING_TOP + y;
+          if (input_y < 0 || input_y >= INPUT_HEIGHT) // ZeroPadding2D
+            continue;
+
+          for (x = 0; x < CONV_KERNEL_SIZE_X; x++) {
+            input_x = pos_x * CONV_STRIDE_X - ZEROPADDING_LEFT + x;
+            if (input_x < 0 || input_x >= INPUT_WIDTH) // ZeroPadding2D
+              continue;
+
+            for (z = 0; z < INPUT_CHANNELS / CONV_GROUPS; z++) {
+              output_acc += (LONG_NUMBER_T)input[input_y][input_x][z + (k / FILTERS_PER_GROUP) * CHANNELS_PER_GROUP] * (LONG_NUMBER_T)kernel[k][y][x][z];
             }
           }
-
-          output_acc[pos_y][pos_x] = output_acc[pos_y][pos_x] + kernel_mac;
-
         }
-      }
-    }
 
-    for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
-      for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
         // Scale for possible additional precision of bias
-        output_acc[pos_y][pos_x] = scale(NUMBER_T, output_acc[pos_y][pos_x],  WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output_acc = scale(NUMBER_T, output_acc,  WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 
         // Scale bias to match accumulator
-        output_acc[pos_y][pos_x] += scale(NUMBER_T, (LONG_NUMBER_T)bias[k], BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output_acc += scale(NUMBER_T, (LONG_NUMBER_T)bias[k], BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 
 
 #ifdef ACTIVATION_LINEAR
-        output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc[pos_y][pos_x], INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc, INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 #elif defined(ACTIVATION_RELU) || defined(ACTIVATION_RELU6)
         // Activation function: ReLU
-        if (output_acc[pos_y][pos_x] < 0) {
+        if (output_acc < 0) {
           output[pos_y][pos_x][k] = 0;
         } else {
 #if defined(ACTIVATION_RELU6)
-        if (output_acc[pos_y][pos_x] > scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE)) {
-          output_acc[pos_y][pos_x] = scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE);
+        if (output_acc > scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE)) {
+          output_acc = scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE);
         }
 #endif
-          output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc[pos_y][pos_x], INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+          output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc, INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
         }
 #else
 #error "Unsupported activation function"
@@ -999,6 +1250,34 @@ static inline void conv2d_1(
 #endif
 }
 
+// Same layer on n <= CNN_BATCH_SIZE images, each filter read once per batch
+static inline void conv2d_1_batch(
+  const NUMBER_T *const inputs[],                                               // IN [n][INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS]
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
+
+  const NUMBER_T bias[CONV_FILTERS],						                // IN
+
+  NUMBER_T *const outputs[],                                                    // OUT [n][CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]
+  unsigned int n) {
+
+#if CONV_GROUPS != 1 || ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "cnn_batch() does not support grouped convolutions or zero-padding"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+
+  conv2d_batch_q15(inputs, (const NUMBER_T*)kernel, bias, outputs, n, &shape, &requant);
+}
+
 #undef INPUT_CHANNELS
 #undef INPUT_WIDTH
 #undef INPUT_HEIGHT
@@ -1046,7 +1325,7 @@ const int16_t conv2d_1_bias[CONV_FILTERS] = {-8, 11, 13, 6, 13, -1, -19, 23, 16,
 ;
 
 
-const int16_t conv2d_1_kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS] = {{{{6, 19, -13, -7, -19, 24, -32, 5}
+const int16_t conv2d_1_kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS] NN_ALIGNED = {{{{6, 19, -13, -7, -19, 24, -32, 5}
 , {-25, -12, 21, 6, -2, 16, -22, -3}
 , {-17, 1, 24, -7, -15, -4, 3, -6}
 }
@@ -1640,7 +1919,7 @@ typedef int16_t conv2d_2_output_type[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS
 #if 0
 void conv2d_2(
   const number_t input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],               // IN
-  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE_X][CONV_KERNEL_SIZE_Y][INPUT_CHANNELS], // IN
+  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS], // IN
 
   const number_t bias[CONV_FILTERS],						                // IN
 
@@ -1706,8 +1985,14 @@ void conv2d_2(
 #define ACTIVATION_RELU
 
 // For fixed point quantization
+#if defined(WITH_BN_FOLDING)
+// Preceding batch_normalization folded into the weights, see model_bnfold.h
+#define WEIGHTS_SCALE_FACTOR CONV2D_2_FOLDED_WEIGHTS_SCALE_FACTOR
+#define BIASES_SCALE_FACTOR CONV2D_2_FOLDED_BIASES_SCALE_FACTOR
+#else
 #define WEIGHTS_SCALE_FACTOR 7
 #define BIASES_SCALE_FACTOR 7
+#endif
 #define TMP_SCALE_FACTOR 7
 #define INPUT_SCALE_FACTOR 7
 #define OUTPUT_SCALE_FACTOR 7
@@ -1718,70 +2003,136 @@ void conv2d_2(
 
 static inline void conv2d_2(
   const NUMBER_T input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],               // IN
-  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_X][CONV_KERNEL_SIZE_Y][INPUT_CHANNELS / CONV_GROUPS], // IN
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
 
   const NUMBER_T bias[CONV_FILTERS],						                // IN
 
   NUMBER_T output[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]) {               // OUT
 
-#if !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
+#if defined(WITH_IM2COL_GEMM) || defined(WITH_SIMD) || defined(WITH_DUAL_CORE) || defined(WITH_SPECIALIZED_CONV) \
+    || defined(WITH_PACKED_WEIGHTS)
+#if CONV_GROUPS != 1
+#error "WITH_IM2COL_GEMM, WITH_SIMD, WITH_DUAL_CORE, WITH_SPECIALIZED_CONV and WITH_PACKED_WEIGHTS do not support grouped convolutions"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+#if defined(WITH_PACKED_WEIGHTS)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_PACKED_WEIGHTS does not support zero-padding"
+#endif
+  // kernel is the filter-blocked table of model_packed.h
+  conv2d_packed_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_DUAL_CORE)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_DUAL_CORE does not support zero-padding"
+#endif
+  dual_core_conv2d_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_SPECIALIZED_CONV)
+  // Kernel generated for this layer shape (literal in model_convspec.h)
+  (void)shape;
+  conv2d_2_specialized(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &requant);
+#elif defined(WITH_IM2COL_GEMM)
+#ifdef WITH_MEMORY_PLAN
+  NUMBER_T *patches = (NUMBER_T *)(cnn_arena + CNN_ARENA_conv2d_2_scratch);
+#else
+  static NUMBER_T patches[CONV_GEMM_TILE_PIXELS * CONV_KERNEL_SIZE_Y * CONV_KERNEL_SIZE_X * INPUT_CHANNELS] NN_ALIGNED;
+#endif
+
+  conv2d_im2col_gemm_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    patches,
+    &shape,
+    &requant);
+#else
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_SIMD does not support zero-padding"
+#endif
+  conv2d_simd_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#endif
+#elif !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
   unsigned short pos_x, pos_y, z, k; 	// loop indexes for output volume
   unsigned short x, y;
   int input_x, input_y;
-  LONG_NUMBER_T	kernel_mac;
-  LONG_NUMBER_T tmp;
-  static LONG_NUMBER_T	output_acc[CONV_OUTHEIGHT][CONV_OUTWIDTH];
-
-  for (k = 0; k < CONV_FILTERS; k++) { 
-    for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
-      for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
-        output_acc[pos_y][pos_x] = 0;
-
-        for (z = 0; z < INPUT_CHANNELS / CONV_GROUPS; z++) {
-          kernel_mac = 0; 
-            
-          for (y = 0; y < CONV_KERNEL_SIZE_Y; y++) {
-            input_y = pos_y * CONV_STRIDE_Y - ZEROPADDING_TOP + y;
-
-            for (x = 0; x < CONV_KERNEL_SIZE_X; x++) {
-              input_x = pos_x * CONV_STRIDE_X - ZEROPADDING_LEFT + x;
-
-              if (input_x < 0 || input_x >= INPUT_WIDTH || input_y < 0 || input_y >= INPUT_HEIGHT) // ZeroPadding2D
-                tmp = 0;
-              else
-                tmp = (LONG_NUMBER_T)input[input_y][input_x][z + (k / FILTERS_PER_GROUP) * CHANNELS_PER_GROUP] * (LONG_NUMBER_T)kernel[k][y][x][z];
-              kernel_mac = kernel_mac + tmp;
+  LONG_NUMBER_T	output_acc;
+
+  // One output pixel at a time: each filter accumulates in a register and
+  // the CONV_FILTERS results of the pixel are written contiguously
+  for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
+    for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
+      for (k = 0; k < CONV_FILTERS; k++) { 
+        output_acc = 0;
+
+        for (y = 0; y < CONV_KERNEL_SIZE_Y; y++) {
+          input_y = pos_y * CONV_STRIDE_Y - ZEROPADDING_TOP + y;
+          if (input_y < 0 || input_y >= INPUT_HEIGHT) // ZeroPadding2D
+            continue;
+
+          for (x = 0; x < CONV_KERNEL_SIZE_X; x++) {
+            input_x = pos_x * CONV_STRIDE_X - ZEROPADDING_LEFT + x;
+            if (input_x < 0 || input_x >= INPUT_WIDTH) // ZeroPadding2D
+              continue;
+
+            for (z = 0; z < INPUT_CHANNELS / CONV_GROUPS; z++) {
+              output_acc += (LONG_NUMBER_T)input[input_y][input_x][z + (k / FILTERS_PER_GROUP) * CHANNELS_PER_GROUP] * (LONG_NUMBER_T)kernel[k][y][x][z];
             }
           }
-
-          output_acc[pos_y][pos_x] = output_acc[pos_y][pos_x] + kernel_mac;
-
         }
-      }
-    }
 
-    for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
-      for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
         // Scale for possible additional precision of bias
-        output_acc[pos_y][pos_x] = scale(NUMBER_T, output_acc[pos_y][pos_x],  WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output_acc = scale(NUMBER_T, output_acc,  WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 
         // Scale bias to match accumulator
-        output_acc[pos_y][pos_x] += scale(NUMBER_T, (LONG_NUMBER_T)bias[k], BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output_acc += scale(NUMBER_T, (LONG_NUMBER_T)bias[k], BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 
 
 #ifdef ACTIVATION_LINEAR
-        output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc[pos_y][pos_x], INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc, INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 #elif defined(ACTIVATION_RELU) || defined(ACTIVATION_RELU6)
         // Activation function: ReLU
-        if (output_acc[pos_y][pos_x] < 0) {
+        if (output_acc < 0) {
           output[pos_y][pos_x][k] = 0;
         } else {
 #if defined(ACTIVATION_RELU6)
-        if (output_acc[pos_y][pos_x] > scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE)) {
-          output_acc[pos_y][pos_x] = scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE);
+        if (output_acc > scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE)) {
+          output_acc = scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE);
         }
 #endif
-          output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc[pos_y][pos_x], INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+          output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc, INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
         }
 #else
 #error "Unsupported activation function"
@@ -1836,6 +2187,34 @@ static inline void conv2d_2(
 #endif
 }
 
+// Same layer on n <= CNN_BATCH_SIZE images, each filter read once per batch
+static inline void conv2d_2_batch(
+  const NUMBER_T *const inputs[],                                               // IN [n][INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS]
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
+
+  const NUMBER_T bias[CONV_FILTERS],						                // IN
+
+  NUMBER_T *const outputs[],                                                    // OUT [n][CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]
+  unsigned int n) {
+
+#if CONV_GROUPS != 1 || ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "cnn_batch() does not support grouped convolutions or zero-padding"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+
+  conv2d_batch_q15(inputs, (const NUMBER_T*)kernel, bias, outputs, n, &shape, &requant);
+}
+
 #undef INPUT_CHANNELS
 #undef INPUT_WIDTH
 #undef INPUT_HEIGHT
@@ -1883,7 +2262,7 @@ const int16_t conv2d_2_bias[CONV_FILTERS] = {-38, -25, -27, -52, -28, 10, -3, 7,
 ;
 
 
-const int16_t conv2d_2_kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS] = {{{{-3, -3, -7, -21, -1, 0, -4, -4, -11, -6, 17, -14, -7, 3, 4, -6, 11, -6, 3, 7, -1, -2, 13, 13, 8, -8, 9, -4, -14, 8, 3, 2}
+const int16_t conv2d_2_kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS] NN_ALIGNED = {{{{-3, -3, -7, -21, -1, 0, -4, -4, -11, -6, 17, -14, -7, 3, 4, -6, 11, -6, 3, 7, -1, -2, 13, 13, 8, -8, 9, -4, -14, 8, 3, 2}
 , {4, 9, 15, -7, 9, 2, 9, 3, -31, -8, 37, -16, 0, 18, -17, -12, -10, -2, 18, -14, -17, 6, 18, -6, -19, 1, 9, 7, 21, 8, -16, -8}
 , {3, 12, 7, -4, 9, -3, -6, 0, 0, 2, -2, -15, 1, 7, -9, 7, -18, -28, -15, -12, -20, -6, -2, -9, -25, -6, 22, 1, -2, 3, 10, 4}
 }
@@ -2893,7 +3272,7 @@ typedef int16_t conv2d_3_output_type[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS
 #if 0
 void conv2d_3(
   const number_t input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],               // IN
-  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE_X][CONV_KERNEL_SIZE_Y][INPUT_CHANNELS], // IN
+  const number_t kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS], // IN
 
   const number_t bias[CONV_FILTERS],						                // IN
 
@@ -2959,8 +3338,14 @@ void conv2d_3(
 #define ACTIVATION_RELU
 
 // For fixed point quantization
+#if defined(WITH_BN_FOLDING)
+// Preceding batch_normalization folded into the weights, see model_bnfold.h
+#define WEIGHTS_SCALE_FACTOR CONV2D_3_FOLDED_WEIGHTS_SCALE_FACTOR
+#define BIASES_SCALE_FACTOR CONV2D_3_FOLDED_BIASES_SCALE_FACTOR
+#else
 #define WEIGHTS_SCALE_FACTOR 7
 #define BIASES_SCALE_FACTOR 7
+#endif
 #define TMP_SCALE_FACTOR 7
 #define INPUT_SCALE_FACTOR 7
 #define OUTPUT_SCALE_FACTOR 7
@@ -2971,70 +3356,149 @@ void conv2d_3(
 
 static inline void conv2d_3(
   const NUMBER_T input[INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS],               // IN
-  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_X][CONV_KERNEL_SIZE_Y][INPUT_CHANNELS / CONV_GROUPS], // IN
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
 
   const NUMBER_T bias[CONV_FILTERS],						                // IN
 
   NUMBER_T output[CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]) {               // OUT
 
-#if !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
+#if defined(WITH_IM2COL_GEMM) || defined(WITH_SIMD) || defined(WITH_DUAL_CORE) || defined(WITH_SPECIALIZED_CONV) \
+    || defined(WITH_PACKED_WEIGHTS) || defined(WITH_WEIGHT_STREAM)
+#if CONV_GROUPS != 1
+#error "WITH_IM2COL_GEMM, WITH_SIMD, WITH_DUAL_CORE, WITH_SPECIALIZED_CONV, WITH_PACKED_WEIGHTS and WITH_WEIGHT_STREAM do not support grouped convolutions"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+#if defined(WITH_WEIGHT_STREAM)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_WEIGHT_STREAM does not support zero-padding"
+#endif
+  // Each weight is read once: prefetch the next filter block into SRAM
+  // while the current one is multiplied (weight_stream.h)
+  weight_stream_conv2d_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_PACKED_WEIGHTS)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_PACKED_WEIGHTS does not support zero-padding"
+#endif
+  // kernel is the filter-blocked table of model_packed.h
+  conv2d_packed_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_DUAL_CORE)
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_DUAL_CORE does not support zero-padding"
+#endif
+  dual_core_conv2d_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#elif defined(WITH_SPECIALIZED_CONV)
+  // Kernel generated for this layer shape (literal in model_convspec.h)
+  (void)shape;
+  conv2d_3_specialized(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &requant);
+#elif defined(WITH_IM2COL_GEMM)
+#ifdef WITH_MEMORY_PLAN
+  NUMBER_T *patches = (NUMBER_T *)(cnn_arena + CNN_ARENA_conv2d_3_scratch);
+#else
+  static NUMBER_T patches[CONV_GEMM_TILE_PIXELS * CONV_KERNEL_SIZE_Y * CONV_KERNEL_SIZE_X * INPUT_CHANNELS] NN_ALIGNED;
+#endif
+
+  conv2d_im2col_gemm_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    patches,
+    &shape,
+    &requant);
+#else
+#if ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "WITH_SIMD does not support zero-padding"
+#endif
+  conv2d_simd_q15(
+    (const NUMBER_T*)input,
+    (const NUMBER_T*)kernel,
+    bias,
+    (NUMBER_T*)output,
+    &shape,
+    &requant);
+#endif
+#elif !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
   unsigned short pos_x, pos_y, z, k; 	// loop indexes for output volume
   unsigned short x, y;
   int input_x, input_y;
-  LONG_NUMBER_T	kernel_mac;
-  LONG_NUMBER_T tmp;
-  static LONG_NUMBER_T	output_acc[CONV_OUTHEIGHT][CONV_OUTWIDTH];
-
-  for (k = 0; k < CONV_FILTERS; k++) { 
-    for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
-      for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
-        output_acc[pos_y][pos_x] = 0;
-
-        for (z = 0; z < INPUT_CHANNELS / CONV_GROUPS; z++) {
-          kernel_mac = 0; 
-            
-          for (y = 0; y < CONV_KERNEL_SIZE_Y; y++) {
-            input_y = pos_y * CONV_STRIDE_Y - ZEROPADDING_TOP + y;
-
-            for (x = 0; x < CONV_KERNEL_SIZE_X; x++) {
-              input_x = pos_x * CONV_STRIDE_X - ZEROPADDING_LEFT + x;
-
-              if (input_x < 0 || input_x >= INPUT_WIDTH || input_y < 0 || input_y >= INPUT_HEIGHT) // ZeroPadding2D
-                tmp = 0;
-              else
-                tmp = (LONG_NUMBER_T)input[input_y][input_x][z + (k / FILTERS_PER_GROUP) * CHANNELS_PER_GROUP] * (LONG_NUMBER_T)kernel[k][y][x][z];
-              kernel_mac = kernel_mac + tmp;
+  LONG_NUMBER_T	output_acc;
+
+  // One output pixel at a time: each filter accumulates in a register and
+  // the CONV_FILTERS results of the pixel are written contiguously
+  for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
+    for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
+      for (k = 0; k < CONV_FILTERS; k++) { 
+        output_acc = 0;
+
+        for (y = 0; y < CONV_KERNEL_SIZE_Y; y++) {
+          input_y = pos_y * CONV_STRIDE_Y - ZEROPADDING_TOP + y;
+          if (input_y < 0 || input_y >= INPUT_HEIGHT) // ZeroPadding2D
+            continue;
+
+          for (x = 0; x < CONV_KERNEL_SIZE_X; x++) {
+            input_x = pos_x * CONV_STRIDE_X - ZEROPADDING_LEFT + x;
+            if (input_x < 0 || input_x >= INPUT_WIDTH) // ZeroPadding2D
+              continue;
+
+            for (z = 0; z < INPUT_CHANNELS / CONV_GROUPS; z++) {
+              output_acc += (LONG_NUMBER_T)input[input_y][input_x][z + (k / FILTERS_PER_GROUP) * CHANNELS_PER_GROUP] * (LONG_NUMBER_T)kernel[k][y][x][z];
             }
           }
-
-          output_acc[pos_y][pos_x] = output_acc[pos_y][pos_x] + kernel_mac;
-
         }
-      }
-    }
 
-    for (pos_y = 0; pos_y < CONV_OUTHEIGHT; pos_y++) { 
-      for (pos_x = 0; pos_x < CONV_OUTWIDTH; pos_x++) { 
         // Scale for possible additional precision of bias
-        output_acc[pos_y][pos_x] = scale(NUMBER_T, output_acc[pos_y][pos_x],  WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output_acc = scale(NUMBER_T, output_acc,  WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 
         // Scale bias to match accumulator
-        output_acc[pos_y][pos_x] += scale(NUMBER_T, (LONG_NUMBER_T)bias[k], BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output_acc += scale(NUMBER_T, (LONG_NUMBER_T)bias[k], BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 
 
 #ifdef ACTIVATION_LINEAR
-        output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc[pos_y][pos_x], INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+        output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc, INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
 #elif defined(ACTIVATION_RELU) || defined(ACTIVATION_RELU6)
         // Activation function: ReLU
-        if (output_acc[pos_y][pos_x] < 0) {
+        if (output_acc < 0) {
           output[pos_y][pos_x][k] = 0;
         } else {
 #if defined(ACTIVATION_RELU6)
-        if (output_acc[pos_y][pos_x] > scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE)) {
-          output_acc[pos_y][pos_x] = scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE);
+        if (output_acc > scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE)) {
+          output_acc = scale(NUMBER_T, 6, -(INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR), OUTPUT_ROUND_MODE);
         }
 #endif
-          output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc[pos_y][pos_x], INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
+          output[pos_y][pos_x][k] = scale_and_clamp_to(NUMBER_T, output_acc, INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, OUTPUT_ROUND_MODE);
         }
 #else
 #error "Unsupported activation function"
@@ -3089,6 +3553,34 @@ static inline void conv2d_3(
 #endif
 }
 
+// Same layer on n <= CNN_BATCH_SIZE images, each filter read once per batch
+static inline void conv2d_3_batch(
+  const NUMBER_T *const inputs[],                                               // IN [n][INPUT_HEIGHT][INPUT_WIDTH][INPUT_CHANNELS]
+  const NUMBER_T kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS], // IN
+
+  const NUMBER_T bias[CONV_FILTERS],						                // IN
+
+  NUMBER_T *const outputs[],                                                    // OUT [n][CONV_OUTHEIGHT][CONV_OUTWIDTH][CONV_FILTERS]
+  unsigned int n) {
+
+#if CONV_GROUPS != 1 || ZEROPADDING_TOP != 0 || ZEROPADDING_BOTTOM != 0 || ZEROPADDING_LEFT != 0 || ZEROPADDING_RIGHT != 0
+#error "cnn_batch() does not support grouped convolutions or zero-padding"
+#endif
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const conv_shape_t shape = CONV_SHAPE_FROM_LAYER();
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+
+  conv2d_batch_q15(inputs, (const NUMBER_T*)kernel, bias, outputs, n, &shape, &requant);
+}
+
 #undef INPUT_CHANNELS
 #undef INPUT_WIDTH
 #undef INPUT_HEIGHT
@@ -3136,7 +3628,7 @@ const int16_t conv2d_3_bias[CONV_FILTERS] = {-5, -12, -7, -19, -10, -10, -9, -16
 ;
 
 
-const int16_t conv2d_3_kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS] = {{{{1, -18, -13, 8, -1, -12, 7, -11, -3, 2, -3, -1, -10, -5, 7, -5, 0, -12, -8, 0, 3, -7, -9, -14, -21, -19, -12, -13, 4, -3, 3, -16, -8, 5, -2, 16, 4, 16, -1, -6, 21, -10, -29, -7, -26, -6, -7, 15, 4, -14, 12, 2, -10, -2, -15, -9, 7, -14, 11, -17, -5, 17, -5, -9}
+const int16_t conv2d_3_kernel[CONV_FILTERS][CONV_KERNEL_SIZE_Y][CONV_KERNEL_SIZE_X][INPUT_CHANNELS / CONV_GROUPS] NN_ALIGNED = {{{{1, -18, -13, 8, -1, -12, 7, -11, -3, 2, -3, -1, -10, -5, 7, -5, 0, -12, -8, 0, 3, -7, -9, -14, -21, -19, -12, -13, 4, -3, 3, -16, -8, 5, -2, 16, 4, 16, -1, -6, 21, -10, -29, -7, -26, -6, -7, 15, 4, -14, 12, 2, -10, -2, -15, -9, 7, -14, 11, -17, -5, 17, -5, -9}
 , {-7, -3, 1, 1, -17, -2, 3, -2, -1, 10, 0, -12, -6, 3, -3, -4, -11, 8, -5, 12, 7, 0, 16, 13, -8, -3, 7, -11, 9, -13, 9, 4, -1, 18, 7, 4, 9, -8, 17, 2, -8, 7, 1, -4, -3, -6, -5, 15, -9, -4, -8, -8, 2, -19, 11, -1, 9, -10, 3, 14, -4, 1, -4, -11}
 , {6, -3, 5, 8, -21, 1, -15, -10, 8, -1, -5, -3, 13, -7, 3, -12, 1, 8, 17, 7, -2, -2, -10, -21, 1, 8, -19, 0, 1, 3, 7, -4, 12, -2, 6, 2, 10, 4, 9, -10, -2, -15, 2, 8, 5, -4, 15, 11, 0, -14, 3, -7, -1, 0, 9, 12, 11, 9, 3, 0, 1, 12, -4, -4}
 }
@@ -4952,7 +5444,30 @@ static inline void dense(
 
 	NUMBER_T output[FC_UNITS]) {			                // OUT
 
-#if !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
+#if defined(WITH_SIMD) || defined(WITH_DUAL_CORE) || defined(WITH_PACKED_WEIGHTS) || defined(WITH_WEIGHT_STREAM)
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+
+#if defined(WITH_WEIGHT_STREAM)
+  // Each weight is read once: prefetch the next unit block into SRAM
+  weight_stream_dense_q15(input, (const NUMBER_T*)kernel, bias, output, INPUT_SAMPLES, FC_UNITS, &requant);
+#elif defined(WITH_PACKED_WEIGHTS)
+  // kernel is the unit-blocked table of model_packed.h
+  dense_packed_q15(input, (const NUMBER_T*)kernel, bias, output, INPUT_SAMPLES, FC_UNITS, &requant);
+#elif defined(WITH_DUAL_CORE)
+  dual_core_dense_q15(input, (const NUMBER_T*)kernel, bias, output, INPUT_SAMPLES, FC_UNITS, &requant);
+#else
+  dense_simd_q15(input, (const NUMBER_T*)kernel, bias, output, INPUT_SAMPLES, FC_UNITS, &requant);
+#endif
+#elif !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
   unsigned short k, z; 
   LONG_NUMBER_T output_acc;
 
@@ -5021,6 +5536,30 @@ static inline void dense(
 #endif
 }
 
+// Same layer on n <= CNN_BATCH_SIZE inputs, each kernel row read once per batch
+static inline void dense_batch(
+  const NUMBER_T *const inputs[],                   // IN [n][INPUT_SAMPLES]
+	const NUMBER_T kernel[FC_UNITS][INPUT_SAMPLES],  // IN
+
+	const NUMBER_T bias[FC_UNITS],			              // IN
+
+	NUMBER_T *const outputs[],                        // OUT [n][FC_UNITS]
+  unsigned int n) {
+
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+
+  dense_batch_q15(inputs, (const NUMBER_T*)kernel, bias, outputs, n, INPUT_SAMPLES, FC_UNITS, &requant);
+}
+
 #undef INPUT_SAMPLES
 #undef FC_UNITS
 #undef ACTIVATION_RELU
@@ -5048,7 +5587,7 @@ static inline void dense(
 const int16_t dense_bias[FC_UNITS] = {11, -4, 2, -1, 9, -3, 3, -5, 7, 4, 1, 3, -8, 6, 17, 1, -7, -2, -10, -4, 4, 8, 6, 2, 3, 6, 11, -9, -7, -10, -7, -1, 0, 8, 3, 5, -1, 3, -7, -5, 9, -2, 7, -1, 14, -3, -3, -2, -3, -4, 5, 6, 0, -3, -1, 10, -4, 8, -8, -4, 7, 5, -1, -4}
 ;
 
-const int16_t dense_kernel[FC_UNITS][INPUT_SAMPLES] = {{0, -42, 31, -11, -12, -56, 20, -27, 7, 3, -3, -16, 7, -10, -4, -36, -10, 33, 15, 18, 22, 22, 11, 16, 3, -3, 30, 16, -21, 4, 17, -40, 11, -17, 42, 7, -19, -5, 20, 4, 45, -19, 7, -1, -28, -8, 11, 50, 5, 12, 19, -20, 2, 14, 20, 13, -10, 8, 14, -15, 18, 23, -15, 0, 13, 5, 27, -4, -12, 13, -4, -3, 24, -25, -36, 11, -28, -2, -7, 31, 0, 28, -11, 19, -26, -5, -11, -26, -1, 7, -10, -4, 24, 1, -28, 32, -33, 20, -21, 9, -2, -14, -11, 25, 7, 20, -7, 3, -1, -12, 23, -6, 35, -18, -32, -15, -24, -4, -5, 2, -14, 10, 20, -17, -14, 1, 22, -13}
+const int16_t dense_kernel[FC_UNITS][INPUT_SAMPLES] NN_ALIGNED = {{0, -42, 31, -11, -12, -56, 20, -27, 7, 3, -3, -16, 7, -10, -4, -36, -10, 33, 15, 18, 22, 22, 11, 16, 3, -3, 30, 16, -21, 4, 17, -40, 11, -17, 42, 7, -19, -5, 20, 4, 45, -19, 7, -1, -28, -8, 11, 50, 5, 12, 19, -20, 2, 14, 20, 13, -10, 8, 14, -15, 18, 23, -15, 0, 13, 5, 27, -4, -12, 13, -4, -3, 24, -25, -36, 11, -28, -2, -7, 31, 0, 28, -11, 19, -26, -5, -11, -26, -1, 7, -10, -4, 24, 1, -28, 32, -33, 20, -21, 9, -2, -14, -11, 25, 7, 20, -7, 3, -1, -12, 23, -6, 35, -18, -32, -15, -24, -4, -5, 2, -14, 10, 20, -17, -14, 1, 22, -13}
 , {-39, 10, -20, -20, 9, -15, 27, -51, -7, -3, -14, -23, 6, 2, -6, -20, 13, 1, 18, 11, 30, -2, -18, -3, 12, 9, 0, -15, -12, 21, 8, 12, 7, 17, 31, -19, 13, -11, -5, -9, -11, 10, 11, 5, -22, 0, 10, -8, 12, -9, -22, 32, -13, -36, -45, 22, -10, 1, 24, -6, 0, -10, -14, -18, -2, -12, 0, -6, 9, -16, -12, 18, -3, 21, -30, -32, -26, 6, -17, 16, -52, 40, 10, 22, 26, -9, -15, -11, 14, 20, 18, 40, 14, -8, 19, -26, -7, -6, -16, 5, 7, -33, -10, 29, 20, 24, -4, -4, -26, 46, 31, 39, -13, -4, -29, 4, -9, -16, -12, -13, -26, -5, 1, 10, -11, 4, 23, -49}
 , {-26, -7, 17, -6, 12, 3, 1, 13, 15, 25, -16, 0, -10, 14, -14, 7, 21, -22, 17, 23, 7, -8, 5, 2, 16, -29, -36, -23, -6, 7, -32, -31, 18, -32, -9, 18, 31, 18, 22, -10, -21, 16, 9, 18, 1, 1, -14, -21, -2, -18, 7, 9, -29, 8, -22, -2, 7, 1, -32, 4, -12, -7, 15, 15, -14, -39, -55, 13, 18, 11, 39, 17, -2, -18, 24, -19, -7, -17, -2, -8, 5, -29, -26, -20, 15, -25, -35, -5, -19, 10, 12, -4, 2, 14, 17, -48, 9, -2, -20, -27, -21, -16, 31, -8, -8, 31, 17, -9, -19, 18, 29, 6, -12, 21, 4, -17, 25, 24, 15, 27, 19, -3, -22, 16, -2, 40, -13, 9}
 , {-10, -48, 22, -14, 5, -34, 7, 15, 2, -40, -20, -8, -1, -6, -23, -37, -20, 10, -25, 10, 29, -19, 16, -12, -11, -2, -3, -9, -31, -2, 24, -1, -6, -4, 8, 13, 21, -9, 15, 7, -9, 1, -7, 24, 6, 0, 2, 18, -13, -29, 1, 15, -5, 16, -7, -15, 0, 17, 2, -18, -15, 22, -36, -18, -1, 22, 9, 8, -11, 10, 14, 20, -6, -1, 19, 1, -1, 11, -11, 16, -33, 14, 14, -1, 18, -9, -12, -38, 16, 15, -20, -42, -10, 12, -15, 30, 26, 3, -22, 26, -7, -15, 13, 21, -9, 57, -29, -10, -11, 45, 26, -20, 14, 5, 6, 14, -15, -36, 5, 37, 12, 20, 17, 11, -32, -18, 23, 28}
@@ -5196,7 +5735,27 @@ static inline void dense_1(
 
 	NUMBER_T output[FC_UNITS]) {			                // OUT
 
-#if !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
+#if defined(WITH_SIMD) || defined(WITH_DUAL_CORE) || defined(WITH_PACKED_WEIGHTS)
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+
+#if defined(WITH_PACKED_WEIGHTS)
+  // kernel is the unit-blocked table of model_packed.h
+  dense_packed_q15(input, (const NUMBER_T*)kernel, bias, output, INPUT_SAMPLES, FC_UNITS, &requant);
+#elif defined(WITH_DUAL_CORE)
+  dual_core_dense_q15(input, (const NUMBER_T*)kernel, bias, output, INPUT_SAMPLES, FC_UNITS, &requant);
+#else
+  dense_simd_q15(input, (const NUMBER_T*)kernel, bias, output, INPUT_SAMPLES, FC_UNITS, &requant);
+#endif
+#elif !defined(WITH_CMSIS_NN) && !defined(WITH_NMSIS_NN)
   unsigned short k, z; 
   LONG_NUMBER_T output_acc;
 
@@ -5265,6 +5824,30 @@ static inline void dense_1(
 #endif
 }
 
+// Same layer on n <= CNN_BATCH_SIZE inputs, each kernel row read once per batch
+static inline void dense_1_batch(
+  const NUMBER_T *const inputs[],                   // IN [n][INPUT_SAMPLES]
+	const NUMBER_T kernel[FC_UNITS][INPUT_SAMPLES],  // IN
+
+	const NUMBER_T bias[FC_UNITS],			              // IN
+
+	NUMBER_T *const outputs[],                        // OUT [n][FC_UNITS]
+  unsigned int n) {
+
+#if defined(ACTIVATION_LINEAR)
+  const nn_activation_t activation = NN_ACTIVATION_LINEAR;
+#elif defined(ACTIVATION_RELU6)
+  const nn_activation_t activation = NN_ACTIVATION_RELU6;
+#elif defined(ACTIVATION_RELU)
+  const nn_activation_t activation = NN_ACTIVATION_RELU;
+#else
+#error "Unsupported activation function"
+#endif
+  const requant_t requant = REQUANT_FROM_LAYER(activation);
+
+  dense_batch_q15(inputs, (const NUMBER_T*)kernel, bias, outputs, n, INPUT_SAMPLES, FC_UNITS, &requant);
+}
+
 #undef INPUT_SAMPLES
 #undef FC_UNITS
 #undef ACTIVATION_LINEAR
@@ -5292,7 +5875,7 @@ static inline void dense_1(
 const int16_t dense_1_bias[FC_UNITS] = {7, 6, 5, 0, -16, 17, -3, -4, -22, -5, -28, -7, 12, 7, 12, 3, -4, 2, 6, 2, -2, -8, 6, -2, -11, -9, 1, -7}
 ;
 
-const int16_t dense_1_kernel[FC_UNITS][INPUT_SAMPLES] = {{19, -18, -50, -36, 31, -13, 35, -47, 2, -40, -4, 28, 38, -28, 8, 23, -15, -13, 7, -48, 22, 10, 13, -37, 10, -23, 24, -33, 14, 34, 24, -23, 28, -67, -6, 17, 2, -21, -29, 5, -42, -48, -21, -16, -3, 5, -28, -9, -57, 25, -24, 28, -10, 34, 24, -21, 7, -21, 6, -37, 11, -29, -43, -24}
+const int16_t dense_1_kernel[FC_UNITS][INPUT_SAMPLES] NN_ALIGNED = {{19, -18, -50, -36, 31, -13, 35, -47, 2, -40, -4, 28, 38, -28, 8, 23, -15, -13, 7, -48, 22, 10, 13, -37, 10, -23, 24, -33, 14, 34, 24, -23, 28, -67, -6, 17, 2, -21, -29, 5, -42, -48, -21, -16, -3, 5, -28, -9, -57, 25, -24, 28, -10, 34, 24, -21, 7, -21, 6, -37, 11, -29, -43, -24}
 , {20, -27, -60, -41, 18, 15, 24, -59, 10, 22, 11, -17, -6, -34, 0, -40, -54, -28, -35, -40, 23, 35, 30, 21, 12, -34, 30, -20, 8, 29, -9, 1, -27, -17, 21, 25, -49, -2, -29, -26, 25, -42, 3, -24, 18, 13, 17, -14, -23, 20, 7, -21, 27, 29, 12, -19, 26, 21, -17, 12, 18, -21, 14, -39}
 , {12, -31, -18, -56, -6, 19, -30, -22, 3, 23, -13, 23, 3, -37, 29, -45, -8, 39, -12, -50, 29, 31, -6, -4, -25, -41, 24, -28, 13, -3, -3, 7, -24, 28, -3, 22, 0, 26, -28, -12, 23, 11, 32, 22, 13, 18, 17, -19, -20, 10, -18, 29, 26, -27, -39, -13, 13, -12, -28, -11, 3, 25, -50, -24}
 , {23, -50, -2, 17, 12, -39, -25, -55, -3, 25, 18, 24, -37, -7, 0, 9, -19, -47, -6, -23, 33, 14, 31, 24, 10, 24, -19, -55, -8, -18, -29, -45, -8, -40, -40, 3, 21, 24, -30, -8, 18, 14, 30, -11, 15, 2, 18, 33, -10, -31, 4, 30, 22, -46, -51, -41, -30, 22, -24, -29, -34, 27, -45, 28}
@@ -5386,8 +5969,58 @@ void cnn(
   const input_t input,
   output_t output);
 
+// Same as cnn() on n images, processed CNN_BATCH_SIZE at a time so that each
+// weight is read once per batch instead of once per image
+void cnn_batch(
+  const input_t *inputs,
+  output_t *outputs,
+  size_t n);
+
+// Same as cnn() with the first layer reading a 32x32 RGB565 window directly
+// (conv2d_rgb565) instead of an input_t: rows are `stride` pixels apart and
+// each channel code is mapped to its input value by lut_5 (red, blue) or
+// lut_6 (green). See cnnRGB565() in preprocess.h.
+void cnn_rgb565(
+  const uint16_t *pixels,
+  size_t stride,
+  const int16_t lut_5[32],
+  const int16_t lut_6[64],
+  output_t output);
+
 void reset(void);
 
+#ifdef WITH_LAYER_PROFILING
+#define CNN_LAYERS 10
+
+// Per-layer durations, see profiler.h for the tick unit
+uint32_t cnn_profile_ticks(unsigned int layer);       // last inference
+uint32_t cnn_profile_mean_ticks(unsigned int layer);  // mean since last reset
+const char *cnn_profile_layer_name(unsigned int layer);
+size_t cnn_profile_dump(char *buffer, size_t size);   // compact one-line report
+void cnn_profile_reset(void);
+#endif
+
+#ifdef WITH_PLACEMENT
+// Copy the weight tables of CNN_PLACEMENT_MAP to their region (placement.h).
+// Returns the number of tables left in flash for lack of room.
+int cnnPlacementInit(void);
+// Declare every conv2d/dense kernel table of cnn() in `region`, to be applied
+// with placementApply()
+void cnnPlacementSetAll(placement_region_t region);
+#endif
+
+#ifdef WITH_MODEL_BLOB
+// Run cnn() and cnn_rgb565() on an opened model blob (nn_blob.h) instead of
+// the compiled tables, from the next inference on; NULL switches back. The
+// blob must stay mapped while in use. Returns -1, keeping the current model,
+// when it does not take an input_t, produce an output_t or fit in
+// MODEL_BLOB_MAX_ACTIVATION.
+// cnn_batch() runs it too, one image after the other since nn_blob.h has
+// no batched kernels.
+int cnnUseBlob(const model_blob_t *blob);
+const model_blob_t *cnnBlob(void);  // NULL with the compiled tables
+#endif
+
 #endif//__MODEL_H__
 
 
@@ -5434,109 +6067,555 @@ extern "C" {
 #include "weights/dense_1.c"
 #endif
 
+#include "profiler.h"
 
-void cnn(
+#ifdef WITH_INT8
+#include "model_int8.h"
+#endif
+
+
+#ifndef WITH_INT8
+#ifdef WITH_PACKED_WEIGHTS
+// Filter-blocked kernel tables (model_packed.h); conv2d_rgb565() reads
+// conv2d_kernel as is
+#define CNN_WEIGHTS(name) name##_packed_kernel
+#else
+#define CNN_WEIGHTS(name) name##_kernel
+#endif
+
+#ifdef WITH_PLACEMENT
+// Table read through its DRAM/PSRAM copy when placementApply() made one
+#define CNN_PLACED(table) (*(__typeof__(table) *)placementResolve(table))
+#else
+#define CNN_PLACED(table) table
+#endif
+#define CNN_KERNEL(name) CNN_PLACED(CNN_WEIGHTS(name))
+
+#ifdef WITH_PLACEMENT
+// Residency of the kernel tables at boot, PLACE(layer, region). The default
+// moves the two largest tables, each weight of which is read once per
+// inference, out of the flash cache. Override with -DCNN_PLACEMENT_MAP.
+#ifndef CNN_PLACEMENT_MAP
+#ifdef WITH_BN_FOLDING
+#define CNN_PLACEMENT_MAP(PLACE) \
+  PLACE(conv2d_3_folded, PLACEMENT_DRAM) \
+  PLACE(dense, PLACEMENT_DRAM)
+#else
+#define CNN_PLACEMENT_MAP(PLACE) \
+  PLACE(conv2d_3, PLACEMENT_DRAM) \
+  PLACE(dense, PLACEMENT_DRAM)
+#endif
+#endif
+
+#define CNN_PLACE(name, region) placementSet(#name, CNN_WEIGHTS(name), sizeof(CNN_WEIGHTS(name)), region);
+
+int cnnPlacementInit(void) {
+  placementClear();
+  CNN_PLACEMENT_MAP(CNN_PLACE)
+  return placementApply();
+}
+
+void cnnPlacementSetAll(placement_region_t region) {
+  CNN_PLACE(conv2d, region)
+#ifndef WITH_BN_FOLDING
+  CNN_PLACE(conv2d_1, region)
+  CNN_PLACE(conv2d_2, region)
+  CNN_PLACE(conv2d_3, region)
+#else
+  CNN_PLACE(conv2d_1_folded, region)
+  CNN_PLACE(conv2d_2_folded, region)
+  CNN_PLACE(conv2d_3_folded, region)
+#endif
+  CNN_PLACE(dense, region)
+  CNN_PLACE(dense_1, region)
+}
+#undef CNN_PLACE
+#endif
+
+// Network on either an input_t or, when pixels is not NULL, an RGB565 image
+static void cnn_run(
   const input_t input,
+  const uint16_t *pixels,
+  size_t stride,
+  const int16_t *lut_5,
+  const int16_t *lut_6,
   dense_1_output_type dense_1_output) {
   
   // Output array allocation
+#ifdef WITH_MEMORY_PLAN
+  // Every tensor at its planned offset in cnn_arena (model_arena.h)
+#define CNN_TENSOR(activations, name) (*(name##_type *)(cnn_arena + CNN_ARENA_##name))
+#else
+#define CNN_TENSOR(activations, name) activations.name
+#ifndef WITH_BN_FOLDING
   static union {
     conv2d_output_type conv2d_output;
     conv2d_1_output_type conv2d_1_output;
     conv2d_2_output_type conv2d_2_output;
     conv2d_3_output_type conv2d_3_output;
     flatten_output_type flatten_output;
-  } activations1;
+  } activations1 NN_ALIGNED;
 
   static union {
     batch_normalization_output_type batch_normalization_output;
     batch_normalization_1_output_type batch_normalization_1_output;
     batch_normalization_2_output_type batch_normalization_2_output;
     dense_output_type dense_output;
-  } activations2;
+  } activations2 NN_ALIGNED;
+#else
+  // batch_normalization layers are folded into conv2d_1..conv2d_3 (model_bnfold.h)
+  static union {
+    conv2d_output_type conv2d_output;
+    conv2d_2_output_type conv2d_2_output;
+    dense_output_type dense_output;
+  } activations1 NN_ALIGNED;
+
+  static union {
+    conv2d_1_output_type conv2d_1_output;
+    conv2d_3_output_type conv2d_3_output;
+    flatten_output_type flatten_output;
+  } activations2 NN_ALIGNED;
+#endif
+#endif
 
 
 // Model layers call chain 
   
   
+  PROFILE_LAYER_BEGIN();
+  if (pixels != NULL) {
+    conv2d_rgb565(
+      pixels,
+      stride,
+      lut_5,
+      lut_6,
+      CNN_PLACED(conv2d_kernel),
+      conv2d_bias,
+      CNN_TENSOR(activations1, conv2d_output)
+      );
+  } else {
   conv2d( // Model input is passed as model parameter
     input,
-    conv2d_kernel,
+    CNN_KERNEL(conv2d),
     conv2d_bias,
-    activations1.conv2d_output
+    CNN_TENSOR(activations1, conv2d_output)
     );
+  }
+  PROFILE_LAYER_END(0);
   
+#ifndef WITH_BN_FOLDING
   
+  PROFILE_LAYER_BEGIN();
   batch_normalization(
-    activations1.conv2d_output,
+    CNN_TENSOR(activations1, conv2d_output),
     batch_normalization_kernel,
     batch_normalization_bias,
-    activations2.batch_normalization_output
+    CNN_TENSOR(activations2, batch_normalization_output)
     );
+  PROFILE_LAYER_END(1);
   
   
+  PROFILE_LAYER_BEGIN();
   conv2d_1(
-    activations2.batch_normalization_output,
-    conv2d_1_kernel,
+    CNN_TENSOR(activations2, batch_normalization_output),
+    CNN_KERNEL(conv2d_1),
     conv2d_1_bias,
-    activations1.conv2d_1_output
+    CNN_TENSOR(activations1, conv2d_1_output)
     );
+  PROFILE_LAYER_END(2);
   
   
+  PROFILE_LAYER_BEGIN();
   batch_normalization_1(
-    activations1.conv2d_1_output,
+    CNN_TENSOR(activations1, conv2d_1_output),
     batch_normalization_1_kernel,
     batch_normalization_1_bias,
-    activations2.batch_normalization_1_output
+    CNN_TENSOR(activations2, batch_normalization_1_output)
     );
+  PROFILE_LAYER_END(3);
   
   
+  PROFILE_LAYER_BEGIN();
   conv2d_2(
-    activations2.batch_normalization_1_output,
-    conv2d_2_kernel,
+    CNN_TENSOR(activations2, batch_normalization_1_output),
+    CNN_KERNEL(conv2d_2),
     conv2d_2_bias,
-    activations1.conv2d_2_output
+    CNN_TENSOR(activations1, conv2d_2_output)
     );
+  PROFILE_LAYER_END(4);
   
   
+  PROFILE_LAYER_BEGIN();
   batch_normalization_2(
-    activations1.conv2d_2_output,
+    CNN_TENSOR(activations1, conv2d_2_output),
     batch_normalization_2_kernel,
     batch_normalization_2_bias,
-    activations2.batch_normalization_2_output
+    CNN_TENSOR(activations2, batch_normalization_2_output)
     );
+  PROFILE_LAYER_END(5);
   
   
+  PROFILE_LAYER_BEGIN();
   conv2d_3(
-    activations2.batch_normalization_2_output,
-    conv2d_3_kernel,
+    CNN_TENSOR(activations2, batch_normalization_2_output),
+    CNN_KERNEL(conv2d_3),
     conv2d_3_bias,
-    activations1.conv2d_3_output
+    CNN_TENSOR(activations1, conv2d_3_output)
     );
+  PROFILE_LAYER_END(6);
   
   
+  PROFILE_LAYER_BEGIN();
   flatten(
-    activations1.conv2d_3_output,
-    activations1.flatten_output
+    CNN_TENSOR(activations1, conv2d_3_output),
+    CNN_TENSOR(activations1, flatten_output)
     );
+  PROFILE_LAYER_END(7);
   
   
+  PROFILE_LAYER_BEGIN();
   dense(
-    activations1.flatten_output,
-    dense_kernel,
+    CNN_TENSOR(activations1, flatten_output),
+    CNN_KERNEL(dense),
     dense_bias,
-    activations2.dense_output
+    CNN_TENSOR(activations2, dense_output)
     );
+  PROFILE_LAYER_END(8);
   
   
+  PROFILE_LAYER_BEGIN();
   dense_1(
-    activations2.dense_output,
-    dense_1_kernel,
+    CNN_TENSOR(activations2, dense_output),
+    CNN_KERNEL(dense_1),
     dense_1_bias,// Last layer uses output passed as model parameter
     dense_1_output
     );
+  PROFILE_LAYER_END(9);
+#else
+  
+  PROFILE_LAYER_BEGIN();
+  conv2d_1(
+    CNN_TENSOR(activations1, conv2d_output),
+    CNN_KERNEL(conv2d_1_folded),
+    conv2d_1_folded_bias,
+    CNN_TENSOR(activations2, conv2d_1_output)
+    );
+  PROFILE_LAYER_END(2);
+  
+  
+  PROFILE_LAYER_BEGIN();
+  conv2d_2(
+    CNN_TENSOR(activations2, conv2d_1_output),
+    CNN_KERNEL(conv2d_2_folded),
+    conv2d_2_folded_bias,
+    CNN_TENSOR(activations1, conv2d_2_output)
+    );
+  PROFILE_LAYER_END(4);
+  
+  
+  PROFILE_LAYER_BEGIN();
+  conv2d_3(
+    CNN_TENSOR(activations1, conv2d_2_output),
+    CNN_KERNEL(conv2d_3_folded),
+    conv2d_3_folded_bias,
+    CNN_TENSOR(activations2, conv2d_3_output)
+    );
+  PROFILE_LAYER_END(6);
+  
+  
+  PROFILE_LAYER_BEGIN();
+  flatten(
+    CNN_TENSOR(activations2, conv2d_3_output),
+    CNN_TENSOR(activations2, flatten_output)
+    );
+  PROFILE_LAYER_END(7);
+  
+  
+  PROFILE_LAYER_BEGIN();
+  dense(
+    CNN_TENSOR(activations2, flatten_output),
+    CNN_KERNEL(dense),
+    dense_bias,
+    CNN_TENSOR(activations1, dense_output)
+    );
+  PROFILE_LAYER_END(8);
+  
+  
+  PROFILE_LAYER_BEGIN();
+  dense_1(
+    CNN_TENSOR(activations1, dense_output),
+    CNN_KERNEL(dense_1),
+    dense_1_bias,// Last layer uses output passed as model parameter
+    dense_1_output
+    );
+  PROFILE_LAYER_END(9);
+#endif
+
+  PROFILE_INFERENCE_END();
+#undef CNN_TENSOR
+}
+#undef CNN_KERNEL
+#undef CNN_PLACED
+#undef CNN_WEIGHTS
+#endif // WITH_INT8
+
+#ifdef WITH_MODEL_BLOB
+// int16 values of the largest layer input or output a blob may use
+#ifndef MODEL_BLOB_MAX_ACTIVATION
+#define MODEL_BLOB_MAX_ACTIVATION (2 * MODEL_INPUT_DIMS)
+#endif
+
+static const model_blob_t *cnn_blob = NULL;
+static int16_t cnn_blob_scratch[2 * ((MODEL_BLOB_MAX_ACTIVATION + 7) & ~7)] NN_ALIGNED;
+static input_t cnn_blob_input NN_ALIGNED;
+
+int cnnUseBlob(const model_blob_t *blob) {
+  if (blob != NULL
+      && (!modelBlobCompatible(blob, MODEL_INPUT_DIM_0, MODEL_INPUT_DIM_1, MODEL_INPUT_DIM_2, MODEL_OUTPUT_SAMPLES)
+          || modelBlobScratchSize(blob) > sizeof(cnn_blob_scratch) / sizeof(cnn_blob_scratch[0]))) {
+    return -1;
+  }
+  // Single pointer store: an inference already running keeps its blob
+  __atomic_store_n(&cnn_blob, blob, __ATOMIC_RELEASE);
+  return 0;
+}
+
+const model_blob_t *cnnBlob(void) {
+  return __atomic_load_n(&cnn_blob, __ATOMIC_ACQUIRE);
+}
+#endif
+
+void cnn(
+  const input_t input,
+  dense_1_output_type dense_1_output) {
+#ifdef WITH_MODEL_BLOB
+  const model_blob_t *blob = cnnBlob();
+  if (blob != NULL) {
+    modelBlobRun(blob, &input[0][0][0], dense_1_output, cnn_blob_scratch);
+    return;
+  }
+#endif
+#ifdef WITH_INT8
+  cnn_int8_run(input, NULL, 0, NULL, NULL, dense_1_output);
+#else
+  cnn_run(input, NULL, 0, NULL, NULL, dense_1_output);
+#endif
 }
 
+void cnn_rgb565(
+  const uint16_t *pixels,
+  size_t stride,
+  const int16_t lut_5[32],
+  const int16_t lut_6[64],
+  dense_1_output_type dense_1_output) {
+#ifdef WITH_MODEL_BLOB
+  const model_blob_t *blob = cnnBlob();
+  if (blob != NULL) {
+    for (int y = 0; y < MODEL_INPUT_DIM_0; y++) {
+      rgb565_unpack_row_q15(pixels + (size_t)y * stride, MODEL_INPUT_DIM_1, lut_5, lut_6, &cnn_blob_input[y][0][0]);
+    }
+    modelBlobRun(blob, &cnn_blob_input[0][0][0], dense_1_output, cnn_blob_scratch);
+    return;
+  }
+#endif
+#ifdef WITH_INT8
+  cnn_int8_run(NULL, pixels, stride, lut_5, lut_6, dense_1_output);
+#else
+  cnn_run(NULL, pixels, stride, lut_5, lut_6, dense_1_output);
+#endif
+}
+
+
+// Point in[]/out[] at the input and output buffers of a layer for each image b
+#define CNN_BATCH_BUFFERS(layer_input, layer_output) \
+  for (b = 0; b < count; b++) { \
+    in[b] = (const int16_t *)(layer_input); \
+    out[b] = (int16_t *)(layer_output); \
+  }
+
+void cnn_batch(
+  const input_t *inputs,
+  output_t *outputs,
+  size_t n) {
+#ifdef WITH_MODEL_BLOB
+  const model_blob_t *blob = cnnBlob();
+  if (blob != NULL) {
+    for (; n > 0; n--, inputs++, outputs++) {
+      modelBlobRun(blob, &(*inputs)[0][0][0], *outputs, cnn_blob_scratch);
+    }
+    return;
+  }
+#endif
+#ifdef WITH_INT8
+  cnn_int8_batch(inputs, outputs, n);
+#else
+
+  // Output array allocation, one set of buffers per image of the batch
+#ifndef WITH_BN_FOLDING
+  static union {
+    conv2d_output_type conv2d_output;
+    conv2d_1_output_type conv2d_1_output;
+    conv2d_2_output_type conv2d_2_output;
+    conv2d_3_output_type conv2d_3_output;
+    flatten_output_type flatten_output;
+  } activations1[CNN_BATCH_SIZE] NN_ALIGNED;
+
+  static union {
+    batch_normalization_output_type batch_normalization_output;
+    batch_normalization_1_output_type batch_normalization_1_output;
+    batch_normalization_2_output_type batch_normalization_2_output;
+    dense_output_type dense_output;
+  } activations2[CNN_BATCH_SIZE] NN_ALIGNED;
+#else
+  static union {
+    conv2d_output_type conv2d_output;
+    conv2d_2_output_type conv2d_2_output;
+    dense_output_type dense_output;
+  } activations1[CNN_BATCH_SIZE] NN_ALIGNED;
+
+  static union {
+    conv2d_1_output_type conv2d_1_output;
+    conv2d_3_output_type conv2d_3_output;
+    flatten_output_type flatten_output;
+  } activations2[CNN_BATCH_SIZE] NN_ALIGNED;
+#endif
+
+  const int16_t *in[CNN_BATCH_SIZE];
+  int16_t *out[CNN_BATCH_SIZE];
+  unsigned int b, count;
+
+  for (; n > 0; n -= count, inputs += count, outputs += count) {
+    count = n < CNN_BATCH_SIZE ? (unsigned int)n : CNN_BATCH_SIZE;
+
+    CNN_BATCH_BUFFERS(inputs[b], activations1[b].conv2d_output);
+    conv2d_batch(in, conv2d_kernel, conv2d_bias, out, count);
+
+#ifndef WITH_BN_FOLDING
+    for (b = 0; b < count; b++) {
+      batch_normalization(activations1[b].conv2d_output, batch_normalization_kernel,
+                          batch_normalization_bias, activations2[b].batch_normalization_output);
+    }
+
+    CNN_BATCH_BUFFERS(activations2[b].batch_normalization_output, activations1[b].conv2d_1_output);
+    conv2d_1_batch(in, conv2d_1_kernel, conv2d_1_bias, out, count);
+
+    for (b = 0; b < count; b++) {
+      batch_normalization_1(activations1[b].conv2d_1_output, batch_normalization_1_kernel,
+                            batch_normalization_1_bias, activations2[b].batch_normalization_1_output);
+    }
+
+    CNN_BATCH_BUFFERS(activations2[b].batch_normalization_1_output, activations1[b].conv2d_2_output);
+    conv2d_2_batch(in, conv2d_2_kernel, conv2d_2_bias, out, count);
+
+    for (b = 0; b < count; b++) {
+      batch_normalization_2(activations1[b].conv2d_2_output, batch_normalization_2_kernel,
+                            batch_normalization_2_bias, activations2[b].batch_normalization_2_output);
+    }
+
+    CNN_BATCH_BUFFERS(activations2[b].batch_normalization_2_output, activations1[b].conv2d_3_output);
+    conv2d_3_batch(in, conv2d_3_kernel, conv2d_3_bias, out, count);
+
+    for (b = 0; b < count; b++) {
+      flatten(activations1[b].conv2d_3_output, activations1[b].flatten_output);
+    }
+
+    CNN_BATCH_BUFFERS(activations1[b].flatten_output, activations2[b].dense_output);
+    dense_batch(in, dense_kernel, dense_bias, out, count);
+
+    CNN_BATCH_BUFFERS(activations2[b].dense_output, outputs[b]);
+    dense_1_batch(in, dense_1_kernel, dense_1_bias, out, count);
+#else
+    CNN_BATCH_BUFFERS(activations1[b].conv2d_output, activations2[b].conv2d_1_output);
+    conv2d_1_batch(in, conv2d_1_folded_kernel, conv2d_1_folded_bias, out, count);
+
+    CNN_BATCH_BUFFERS(activations2[b].conv2d_1_output, activations1[b].conv2d_2_output);
+    conv2d_2_batch(in, conv2d_2_folded_kernel, conv2d_2_folded_bias, out, count);
+
+    CNN_BATCH_BUFFERS(activations1[b].conv2d_2_output, activations2[b].conv2d_3_output);
+    conv2d_3_batch(in, conv2d_3_folded_kernel, conv2d_3_folded_bias, out, count);
+
+    for (b = 0; b < count; b++) {
+      flatten(activations2[b].conv2d_3_output, activations2[b].flatten_output);
+    }
+
+    CNN_BATCH_BUFFERS(activations2[b].flatten_output, activations1[b].dense_output);
+    dense_batch(in, dense_kernel, dense_bias, out, count);
+
+    CNN_BATCH_BUFFERS(activations1[b].dense_output, outputs[b]);
+    dense_1_batch(in, dense_1_kernel, dense_1_bias, out, count);
+#endif
+  }
+#endif//WITH_INT8
+}
+
+#ifdef WITH_LAYER_PROFILING
+static const char * const cnn_layer_names[CNN_LAYERS] = {
+  "conv2d",
+  "batch_normalization",
+  "conv2d_1",
+  "batch_normalization_1",
+  "conv2d_2",
+  "batch_normalization_2",
+  "conv2d_3",
+  "flatten",
+  "dense",
+  "dense_1",
+};
+
+uint32_t cnn_profile_ticks(unsigned int layer) {
+  if (layer >= CNN_LAYERS) {
+    return 0;
+  }
+  return profiler_state.last[layer];
+}
+
+uint32_t cnn_profile_mean_ticks(unsigned int layer) {
+  if (layer >= CNN_LAYERS || profiler_state.runs == 0) {
+    return 0;
+  }
+  return (uint32_t)(profiler_state.total[layer] / profiler_state.runs);
+}
+
+const char *cnn_profile_layer_name(unsigned int layer) {
+  if (layer >= CNN_LAYERS) {
+    return NULL;
+  }
+  return cnn_layer_names[layer];
+}
+
+size_t cnn_profile_dump(char *buffer, size_t size) {
+  uint32_t total = 0;
+  size_t len = 0;
+  int n;
+
+  if (size == 0) {
+    return 0;
+  }
+
+  for (unsigned int i = 0; i < CNN_LAYERS; i++) {
+    total += profiler_state.last[i];
+  }
+
+  n = snprintf(buffer, size, "prof[%s]", PROFILER_TICK_UNIT);
+  len += n > 0 ? (size_t)n : 0;
+  for (unsigned int i = 0; i < CNN_LAYERS && len < size; i++) {
+    n = snprintf(buffer + len, size - len, " %s=%u", cnn_layer_names[i], (unsigned int)profiler_state.last[i]);
+    len += n > 0 ? (size_t)n : 0;
+  }
+  if (len < size) {
+    n = snprintf(buffer + len, size - len, " total=%u", (unsigned int)total);
+    len += n > 0 ? (size_t)n : 0;
+  }
+
+  // Number of characters actually written, excluding the terminating null byte
+  return len < size ? len : size - 1;
+}
+
+void cnn_profile_reset(void) {
+  profiler_reset();
+}
+#endif
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
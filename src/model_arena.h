@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @file    model_arena.h
+  * @brief   Offsets of the activations and conv2d scratch buffers in cnn_arena
+  *
+  * GENERATED by tools/plan_memory.py from src/model.h, do not edit.
+  * Used by cnn() when building with -DWITH_MEMORY_PLAN: one plan per build
+  * variant (BN folding, convolution engine), each buffer at CNN_ARENA_<name>.
+  * Tensors of a same buffer (in-place layers) share their offset.
+  */
+
+#ifndef _MODEL_ARENA_H_
+#define _MODEL_ARENA_H_
+
+#include <stdint.h>
+
+#if defined(WITH_CMSIS_NN) || defined(WITH_NMSIS_NN)
+#error "WITH_MEMORY_PLAN does not plan the CMSIS-NN buffers"
+#endif
+#if defined(WITH_IM2COL_GEMM) && CONV_GEMM_TILE_PIXELS != 8
+#error "model_arena.h was planned for CONV_GEMM_TILE_PIXELS 8, run tools/plan_memory.py --tile-pixels"
+#endif
+
+#if !defined(WITH_BN_FOLDING) && (defined(WITH_DUAL_CORE) || defined(WITH_SPECIALIZED_CONV) || !defined(WITH_IM2COL_GEMM))
+// batch_normalization kept, direct (reference, SIMD, dual core or specialised, no scratch)
+// 6736 bytes, lower bound 6736, unions + statics 7776
+#define CNN_ARENA_SIZE 6736
+#define CNN_ARENA_conv2d_output 0
+#define CNN_ARENA_batch_normalization_output 0
+#define CNN_ARENA_conv2d_2_output 0
+#define CNN_ARENA_batch_normalization_2_output 0
+#define CNN_ARENA_dense_output 0
+#define CNN_ARENA_conv2d_3_output 1152
+#define CNN_ARENA_flatten_output 1152
+#define CNN_ARENA_conv2d_scratch 3600
+#define CNN_ARENA_conv2d_1_output 3600
+#define CNN_ARENA_batch_normalization_1_output 3600
+
+#elif !defined(WITH_BN_FOLDING) && !defined(WITH_DUAL_CORE) && !defined(WITH_SPECIALIZED_CONV) && defined(WITH_IM2COL_GEMM)
+// batch_normalization kept, im2col (im2col + GEMM, patch tiles)
+// 10624 bytes, lower bound 10624, unions + statics 23184
+#define CNN_ARENA_SIZE 10624
+#define CNN_ARENA_conv2d_output 0
+#define CNN_ARENA_batch_normalization_output 0
+#define CNN_ARENA_conv2d_2_scratch 0
+#define CNN_ARENA_conv2d_3_scratch 0
+#define CNN_ARENA_dense_output 0
+#define CNN_ARENA_conv2d_scratch 3600
+#define CNN_ARENA_conv2d_1_output 4608
+#define CNN_ARENA_batch_normalization_1_output 4608
+#define CNN_ARENA_conv2d_1_scratch 7744
+#define CNN_ARENA_conv2d_2_output 9216
+#define CNN_ARENA_batch_normalization_2_output 9216
+#define CNN_ARENA_conv2d_3_output 10368
+#define CNN_ARENA_flatten_output 10368
+
+#elif defined(WITH_BN_FOLDING) && (defined(WITH_DUAL_CORE) || defined(WITH_SPECIALIZED_CONV) || !defined(WITH_IM2COL_GEMM))
+// batch_normalization folded, direct (reference, SIMD, dual core or specialised, no scratch)
+// 6736 bytes, lower bound 6736, unions + statics 7312
+#define CNN_ARENA_SIZE 6736
+#define CNN_ARENA_conv2d_output 0
+#define CNN_ARENA_conv2d_2_output 0
+#define CNN_ARENA_dense_output 0
+#define CNN_ARENA_conv2d_3_output 1152
+#define CNN_ARENA_flatten_output 1152
+#define CNN_ARENA_conv2d_scratch 3600
+#define CNN_ARENA_conv2d_1_output 3600
+
+#elif defined(WITH_BN_FOLDING) && !defined(WITH_DUAL_CORE) && !defined(WITH_SPECIALIZED_CONV) && defined(WITH_IM2COL_GEMM)
+// batch_normalization folded, im2col (im2col + GEMM, patch tiles)
+// 10624 bytes, lower bound 10624, unions + statics 22720
+#define CNN_ARENA_SIZE 10624
+#define CNN_ARENA_conv2d_output 0
+#define CNN_ARENA_conv2d_2_scratch 0
+#define CNN_ARENA_conv2d_3_scratch 0
+#define CNN_ARENA_dense_output 0
+#define CNN_ARENA_conv2d_scratch 3600
+#define CNN_ARENA_conv2d_1_output 4608
+#define CNN_ARENA_conv2d_1_scratch 7744
+#define CNN_ARENA_conv2d_2_output 9216
+#define CNN_ARENA_conv2d_3_output 10368
+#define CNN_ARENA_flatten_output 10368
+#endif
+
+static uint8_t cnn_arena[CNN_ARENA_SIZE] NN_ALIGNED;
+
+#endif//_MODEL_ARENA_H_
@@ -0,0 +1,5962 @@
+/**
+  ******************************************************************************
+  * @file    model_bnfold.h
+  * @brief   conv2d weights with the preceding batch_normalization folded in
+  *
+  * GENERATED by tools/fold_batchnorm.py from src/model.h, do not edit.
+  * Used by cnn() when building with -DWITH_BN_FOLDING.
+  *
+  * Rounding tolerance against the unfolded network, measured on 178 images
+  * (reference signs, all 32x32 crops of trafficsign3, random inputs):
+  *   max |output deviation| = 21 LSB, mean = 2.881 LSB (Q7 logits),
+  *   top-1 agreement 175/178
+  */
+
+#ifndef _MODEL_BNFOLD_H_
+#define _MODEL_BNFOLD_H_
+
+#include <stdint.h>
+
+// batch_normalization folded into conv2d_1
+#define CONV2D_1_FOLDED_WEIGHTS_SCALE_FACTOR 11
+#define CONV2D_1_FOLDED_BIASES_SCALE_FACTOR 11
+
+const int16_t conv2d_1_folded_bias[32] = {1816, 1686, 2245, 2364, 620, 2843, -3709, 2865, 1229, 1974, 2094, 2915, 838, 3607, 1327, 1922,
+  1427, 490, 918, 1370, 1735, 565, 816, 2145, 1926, 3544, 722, 816, 1787, 1764, 1420, 1659}
+;
+
+const int16_t conv2d_1_folded_kernel[32][3][3][8] NN_ALIGNED = {1305, 6329, -1762, -1032, -1905, 11082, -8592, 470, -5438, -3998, 2846, 884, -201, 7388, -5907, -282,
+  -3698, 333, 3252, -1032, -1504, -1847, 806, -564, 5220, 333, -5014, 1621, 100, 9235, 2417, 188,
+  1740, 1333, -2575, -4421, 0, 6465, 1611, 3102, -1088, 4664, 407, -3537, 1203, 7388, 7518, 2350,
+  -218, -3998, 2575, 737, -1504, 8773, -806, -1222, -4133, 333, -542, 442, 0, -1847, -537, -1692,
+  0, 0, -1355, -590, 401, 11544, 269, -2256, 1088, -1333, 1762, 737, -2607, -1385, -1880, 2162,
+  -1958, 1333, 2033, 2211, -1203, -8773, -4296, 1128, 870, 3664, 542, -590, 301, -10620, 1343, 1034,
+  1088, 999, -949, -2358, -602, -11082, -1074, 2914, -653, -13325, 1897, -5011, 0, -462, -3491, 2726,
+  -1523, -3331, 1084, -3832, 2105, -4618, 2148, 1692, -3698, 2332, -1762, -147, 100, -924, -2685, -188,
+  -1088, 2998, -2439, -1474, -501, -15700, 2954, -1034, 1523, 2665, -2575, -3684, -902, -6003, -537, 564,
+  -6960, -10660, 2575, 1179, -100, -11082, 5907, 564, -4568, -1666, 1897, 2063, -1404, -5079, 806, -1504,
+  3698, -4331, 407, 147, -3709, -2771, 1074, -94, -2175, 5996, -407, -4127, -802, -12006, 3491, -94,
+  -5873, -8661, 4472, 147, 401, -4618, 5102, 752, 218, -6329, 2439, 2948, -1704, 2771, 2954, -658,
+  -1740, 2332, -2710, 1179, 301, 924, -2148, 1316, 4568, 1999, -1084, -5306, -201, -4618, -5639, 1316,
+  -1088, -999, 2575, -442, -1003, -2309, -2417, 188, 2610, -666, -1897, -2505, -1303, -2309, -1880, -940,
+  -435, 6329, -3117, -295, -1404, -3232, 269, -1786, 218, 5330, -1491, -442, -2105, -1847, 0, -1410,
+  -5873, -333, -949, 3684, -1303, -7850, -5907, -1316, -4133, -666, 271, 5453, 301, -13391, -1611, -1692,
+  -2828, 3998, 678, 1916, -1303, -7850, 1074, -2726, -3698, 999, 2033, 2800, 902, 2309, 0, 846,
+  -2828, -6329, 1626, 3095, -301, -7388, -1880, 188, -435, -3331, 2168, 2211, 401, -3694, -6713, -940,
+  -4350, -2998, 1626, -295, 0, -924, 537, -846, -7395, -3331, 1491, 2358, -602, -8312, -269, -1128,
+  -5873, -2665, 2033, 1032, -1704, -10159, 806, -2914, 2828, -7995, 407, -2505, 602, -6926, -5639, 1222,
+  -1305, -333, 3252, -2800, -100, -924, -2417, 1598, -3915, -1666, 3523, 1179, 1103, -7388, -1880, -1786,
+  6090, -5663, -1762, -590, 1103, -3694, -3491, 376, 5220, -7995, -1897, -2800, 602, -2771, -1343, -564,
+  4785, 3664, -678, -2948, -501, 462, -3222, 1504, -4133, -2665, -1626, -1474, 0, -2771, 2954, 658,
+  -6960, -8994, 1897, 1474, 301, -5541, -4833, 1598, -1523, -333, 2439, -2505, 1604, 5541, -1074, -1504,
+  -218, 2332, -3794, -1474, -1504, 1385, -537, 1034, -2175, 333, 1220, -5306, 1103, 3694, -3491, 1786,
+  653, 333, 949, -3095, -902, 6465, -9398, -846, 1958, -333, 1762, -442, -802, 462, 269, 94,
+  2175, -2332, -2710, -1032, -1704, 2771, -2954, 188, -2828, -6329, -1762, -442, -2607, 6926, -1074, 1128,
+  1740, -1333, -1491, -4863, -1203, 6003, -5102, 752, -4133, -333, -813, -5011, 1003, 8773, -3222, 1316,
+  -435, 4997, 949, -3390, 1003, 14776, -5370, 1692, 1740, 1666, 1626, 1179, 1704, -924, 2685, 94,
+  -4133, -3664, 2575, 4421, 702, 7850, 4028, 658, -653, 0, -813, 1032, 1404, 4618, -11009, 2068,
+  -2175, 2998, -813, 0, 1805, 7850, 4833, 376, 1305, 333, -678, 1474, 201, 6465, -2148, -188,
+  4133, -1333, 2439, -737, 2105, 6465, 3759, 188, -3263, 5663, -2575, 1032, -2206, 462, 2685, 658,
+  -5438, -2998, -1355, 0, -1103, -8773, 1880, 564, 1088, 3331, 2710, 442, 602, -3694, 2148, -1692,
+  3045, -8328, 1762, -442, -501, -9235, -5370, 1034, -8700, 666, 2439, 884, -602, -924, -537, -1504,
+  1305, -999, 2981, -1326, 902, -6003, -2954, -2162, 870, -7662, -136, -5600, 902, -8312, -3759, -94,
+  -1958, 2665, -136, -3832, -902, -9697, 2148, 1316, -3045, -5330, 1355, -737, -802, -5079, -269, -2256,
+  -6960, 5663, 0, 3390, -1303, -3694, 1611, -940, -870, -1333, -407, 2800, -1103, -7388, 4296, -658,
+  2393, -3998, 1084, -590, -1203, -3694, 2148, 282, -4568, -6663, 4743, 442, -501, 462, -1074, -752,
+  3045, 4997, 3252, 884, 2306, -462, -806, -2820, 2175, 2665, -3930, 1769, -1504, -924, -4565, 846,
+  -1958, -5330, 0, -4421, -301, -5541, 1611, 94, 870, 6996, 1897, 0, -802, -6465, 2954, -1692,
+  3045, 0, -2439, 1769, 201, -4156, -1074, 1598, 1088, -3331, -2033, 1916, 702, -924, 0, -94,
+  -3263, 0, 2168, -1179, -301, 2771, -5102, 470, 2610, 999, 1626, -737, -301, -6003, -2954, -1034,
+  -2175, -4664, -136, 2800, -702, -5079, -269, -94, -1305, -2332, 542, -2948, -702, 462, -537, 470,
+  -870, 6996, 3117, -5306, 0, -3694, -2685, -3760, -1740, 2665, 949, -2358, -100, -8773, 269, 1880,
+  -3263, -6329, 4336, -3832, 501, -3232, -2148, -2350, -1088, -3331, -136, -737, -602, 5079, -2954, -2538,
+  -1523, -3331, -271, -4421, -201, -14314, -269, 376, -1740, 2665, 678, -147, -301, -12929, 537, 1316,
+  2393, 5330, 2033, -147, 1303, -2309, 2148, 2068, 1523, -5996, 407, -5011, -100, -10620, -2417, -188,
+  -3698, -999, -407, -6337, 0, -3694, -1074, 1974, -218, 2665, 1084, -4127, 501, -9235, 2417, 376,
+  -4568, 3998, -1897, 1916, 401, -7850, 1611, -1316, -870, 0, -3794, -3684, 1103, -3232, 3759, -752,
+  2610, 666, 407, -4863, -201, -9235, -3759, 940, -1740, 666, -1355, 590, -100, -4156, -4296, -846,
+  1088, -1999, -2710, -1326, -2005, -10159, -3491, -940, 435, -1999, -407, 1769, -3509, -5541, -1880, 376,
+  -1088, 1666, -407, 884, -501, -19394, -2417, 376, -6090, 0, -3117, 884, -2406, -3232, -5370, 282,
+  -2828, -7995, -949, 2505, 401, -10620, -5639, 282, 653, -9328, -2168, -2063, 2005, -10159, -1343, -1128,
+  -5655, -3331, -1220, 3979, -1704, -9235, -2417, 282, -5438, -4997, 813, 2063, 2907, -3694, -537, 1222,
+  218, -5996, -1491, 2948, 2707, -10159, -2685, -470, -5873, -333, 542, -3684, 1604, -6926, 6176, -94,
+  1088, 999, 2168, -884, 902, -1847, -3759, 1786, 435, -3331, 2168, 1916, 1905, -3232, -5102, -564,
+  0, 2332, 949, -3979, 501, -2771, -2685, 1316, 653, 2998, -2168, -3684, -1704, -10620, 537, 658,
+  2175, -1999, -136, -737, -100, -1847, 1343, 376, 6308, -2665, -407, -1032, -3308, -15238, 2148, 1316,
+  1523, -333, 678, -2063, -2807, -11082, 1074, 282, -435, -2998, -2168, -295, 802, -1385, -1343, 940,
+  2610, -4997, -813, -3537, -1604, 6926, 537, -564, 2610, -333, 1355, 1474, -2105, 8773, -6713, 0,
+  653, -6996, 407, -3390, 1905, 4156, 4833, -752, 4133, -7329, 2439, -5158, 602, -1385, 4296, -1316,
+  3915, -4664, -813, -295, -602, -5079, 2417, 282, -1740, -1666, -3659, 147, -1203, -4618, 4565, -376,
+  -1740, 3664, -4472, 2063, -1103, -6926, 9129, -1034, -1088, 333, -2033, 1769, -3108, 9235, -806, -188,
+  1523, 333, 1491, -2063, -602, -3694, -3759, 188, 1523, 4331, 0, -4421, 1404, -8312, -269, -1598,
+  -653, -1333, 2168, -295, 1504, -8773, 2954, -470, -7178, -999, 0, 3390, -2206, 1385, -2417, -846,
+  653, 333, -3659, -1032, 501, -10620, 2685, -3384, 1740, -2998, -2710, -2800, 802, -4156, 806, -282,
+  -5220, -6329, 2439, 2358, 802, -2309, -9666, 564, 1523, -2998, 2439, -590, -702, -12467, -1880, -1692,
+  4133, -5663, 2033, 2063, -1404, 1847, -2954, -752, -5220, 1333, 1220, 3832, -802, 0, -7518, 470,
+  3698, -666, -271, 2063, -802, 4618, -2417, 0, 2175, 333, -1491, -3242, -2807, -1385, -269, -1034,
+  -7395, 999, 4201, 2063, 602, -924, -3222, 470, -435, 1666, 3388, -147, 401, -5541, -5102, -1504,
+  -5003, -1999, -1355, -2211, -3108, -2309, -2148, -2538, 218, -666, -1084, -1621, 1303, -9697, -6713, 0,
+  218, -6996, 949, -295, -1203, -9235, -6444, 376, -435, 5663, 1084, 1769, 1003, -924, 1343, 470,
+  1088, 333, 678, 147, 2306, 1847, 1074, -1692, -653, 2665, 678, -3832, -2306, 5079, -2954, 188,
+  -2393, 1333, -1220, -2063, 1203, -4156, -806, -1504, -7613, 0, 1220, -4716, -1003, -4156, 3491, -1786,
+  -1523, 999, -2981, 2653, -501, -3694, 3222, 282, -435, -333, 2710, -442, 2206, -2771, 0, -2632,
+  -435, 666, -2981, 2211, -3409, -1847, 4565, 1410, -2393, 333, 1762, -590, -301, -5541, -1074, 2162,
+  435, -3998, 136, 737, 1404, -4156, -4028, 0, -2610, 2998, 2575, -7074, 401, -10620, 1074, 658,
+  -1305, 10660, 0, 442, 1905, -9235, -1343, 940, -2393, 6663, 271, 3684, 1103, -5541, -4833, 1880,
+  -2175, 3998, -5827, 1769, 401, 2771, 269, -1034, -1088, -333, -4336, 442, -602, -2309, -1343, 1786,
+  -2610, 6996, -407, -2948, -201, -13853, 806, 2914, 1088, 1666, -678, 0, -702, 2309, 3759, -2162,
+  -435, -999, -542, 1326, 100, -7388, -3222, -846, 653, 2998, 1762, 590, -201, -3232, -2417, -1128,
+  -870, -4331, 542, -1916, 301, -4618, 269, -1128, -3915, 8328, 813, 737, -501, 924, -3222, -752,
+  -435, -1666, -3794, -147, 401, 6465, -537, 188, 0, 999, -2168, 3095, -100, -4156, -1880, -658,
+  1305, -333, -271, -2800, 802, -1847, -3759, 1598, -870, -5996, 271, -3095, 902, 1385, -5102, -1128,
+  -11963, 1333, -407, 3390, 1404, 4156, 0, -940, 6743, -5996, 407, 1621, 2707, 462, -8592, -2350,
+  3915, 2665, -1220, -3832, -2907, -2309, -1880, -564, 3045, -666, -1626, -295, 2506, -7388, 3491, -282,
+  0, 6663, -136, -442, 1704, -4156, -269, 94, 2175, 999, -1491, -1032, -201, -1385, 5102, -940,
+  218, 13991, -1762, 3832, 802, -8773, 9666, -2914, 2828, 333, -2846, 442, -802, -5079, 5639, -1222,
+  -2828, 4997, -2304, -1769, -3609, 462, -1343, 1316, -7613, 9994, 2168, 884, 1303, -3232, -1074, 282,
+  2828, 4664, 678, 442, -1604, -5541, -1880, -1222, -870, 2332, 813, 2358, -902, -12467, -1343, 0,
+  -1305, -2665, 1897, -3390, -1604, 12006, 2148, -1034, -10658, 999, 1897, -1474, 1303, 15700, 2685, -564,
+  -4350, 666, -813, -1032, 100, 7850, -806, -282, -6743, -3664, -542, -2505, 1303, 5079, 269, -1974,
+  -6090, 1666, -136, -2063, 201, 0, -537, -4042, -2610, -2332, -5149, 1032, 1203, -8312, -1343, -752,
+  -435, -4997, -136, 1916, 501, 9697, -1611, -1692, 1958, -2998, -1491, -1916, 702, -4618, 1074, 470,
+  3915, 2665, -2033, 2211, -301, -1385, -4028, 1692, 6308, 3331, 1355, 3537, 702, 924, 5907, -940,
+  0, -1333, -4065, 0, 2105, -10620, -2685, 846, -1740, -1999, -3523, -2211, -501, -8312, -2685, 1692,
+  1958, -4331, -678, -5306, -1704, -7850, 537, 1222, 1523, -3331, -1897, 147, -1404, -4618, 2417, -846,
+  -1088, 999, 1626, 2653, 2005, -7850, 5639, -94, 2610, -999, -2439, 3979, -1303, -10159, -1074, 1504,
+  2828, -333, -1762, 737, -1303, -3232, -1074, 2350, -653, 1666, -136, -3095, 602, -9697, -2685, 1128,
+  -2828, -7995, 4472, -442, 201, -8312, -1880, 658, -6743, 4664, 678, -295, -100, 924, -269, -1692,
+  -3045, -2332, -1897, 1769, -301, -3232, 2685, -94, -653, 3331, -813, -1032, -3008, 0, 1074, 2256,
+  -4133, -666, -407, -4421, -702, 7850, -2148, 658, 1305, 2998, -1220, 4127, 2105, 1385, 2954, 1034,
+  3045, -2332, -2981, 2063, -1704, -6465, 0, -1128, -653, 3664, -2981, 295, 1805, -7850, 6176, -188,
+  1740, 666, -1626, -1769, 1704, -5541, 1880, 94, 870, -1999, -678, -442, -501, -1847, -537, 940,
+  1305, -666, 0, -4863, -1003, 6926, -2148, 1222, 1305, -5330, 2575, -3979, -301, 3694, -2417, 1786,
+  2175, -2998, -2168, -2505, -902, -4618, 1343, 0, 2175, -3331, -5014, -295, -2707, 5079, -1074, -470,
+  -2393, -6329, -5420, 295, -2707, 11544, 2417, -752, 2828, -2332, 1355, 0, 602, 3694, 1074, 846,
+  -2828, -9328, 3794, 1032, 2306, -8312, 2148, -376, -2610, -14324, 1897, 442, 1704, 3694, 4028, -1504,
+  -5438, 999, 1762, -1179, -802, -2771, -3491, -846, 435, -1999, 407, 442, -1103, 3694, 4565, -376,
+  -870, -333, -949, -3537, 0, 3232, 3759, 282, -1088, -2998, -2981, -442, -1303, 7388, -2148, 2444,
+  -6960, -1666, 4472, -590, 702, 3232, 8861, -846, -1740, -8994, -4065, -884, 0, 1385, 269, 1128,
+  -1523, -3331, -2304, 1621, -602, 1385, -537, 2068, -4133, -2332, 2575, -4274, -401, 11544, -537, -658,
+  -4350, 2998, -2304, -884, 902, 6003, -806, 94, -4133, -1333, 678, -1916, 301, -2771, -3491, 752,
+  -870, -6996, 136, -4127, -2005, -10159, -806, 1410, 653, -2998, 678, -147, -2607, -6003, -3759, 94,
+  -3263, -1999, 949, -1032, 501, -5079, -7250, 282, -1088, 3664, -1220, -3684, -1604, -1385, 0, 1316,
+  -3915, -6663, 1626, -590, -2807, -5541, 0, 940, -6308, 333, -1626, 1474, 1303, 0, 2417, 470,
+  -870, -4664, -3930, -2358, -1203, -10620, -3759, 1598, -4133, 999, 2033, 1179, 501, -9697, -269, 1410,
+  218, 4997, -3252, 590, 2005, -1385, 2685, -1128, 3480, 3664, -542, -2505, 1203, 9235, 2685, 1692,
+  3045, 6996, 2168, 2800, -1203, 5079, 1611, -658, -1305, 6663, 2168, 442, 602, 462, -2148, 1316,
+  4133, 7329, -1355, -442, 2206, 1847, 4565, -1786, 2393, 1999, -271, 1916, -2506, -1385, -537, 1316,
+  -1523, 6663, -1491, -1179, -702, -5541, -7250, 564, 2828, 666, -2168, -1326, 1704, -6926, 1343, -2632,
+  1958, 0, -542, -1474, -3910, -7850, 2148, 94, 1958, -1333, 2846, 884, 100, 3232, 269, -1034,
+  4568, -3998, 2439, 5453, 201, 1385, 269, -3666, 1958, 1666, 0, 737, -2306, -9235, -537, 564,
+  -3263, 666, -3117, -1032, 100, -1847, 5102, 1974, -5003, 1999, 407, 2211, 902, -5541, 806, -94,
+  -4133, -10327, 136, 1179, -1704, -4156, 0, -2538, -4568, 2665, -813, 1032, -2005, 0, 537, 1222,
+  -1740, 4331, -813, 1032, 1905, 2771, 806, -564, -1088, 4997, 1762, -295, -201, 1385, -4296, -3290,
+  3263, 6663, 2575, 590, 0, 0, 806, -752, -1523, -2332, -2575, -737, -1103, -3232, -2148, -1316,
+  1958, 999, 813, 1179, 1303, 5541, -4296, 470, 653, 3331, -542, -442, 602, -2771, -3222, -1504,
+  6743, 0, -4201, -3537, -1704, -2309, 2685, 2444, 1305, -1666, -1220, 3684, -802, 1385, 2954, -2350,
+  -3263, 999, 949, 590, -1604, 2771, -3491, -470, 2393, -2332, -3388, -5306, 602, -5541, 1343, -282,
+  -5438, 1666, 813, 590, 1604, -2771, -4833, -282, -435, -999, -1220, 590, -1905, -3232, -5370, 658,
+  -5003, 6329, -4878, 2505, -201, -9235, 5102, -1504, -218, 2665, -1762, 2800, -501, -5079, -1074, 1316,
+  -2175, -666, -2033, 1179, -1504, -3232, -8324, 1128, 0, -1666, 1355, 2358, 1303, 1385, -10472, 94,
+  -1088, -7329, 2304, 1032, 1805, -11544, 0, -1410, -1958, -5330, 1355, -2800, 0, 0, 1880, -376,
+  -870, 666, 1355, -6485, -100, 924, 1343, 1410, 2393, -1999, 136, -1916, -2206, 4618, -3491, 376,
+  -218, 0, -1626, -147, -802, 5541, 5370, -1598, -2175, 6996, 407, -590, 902, 12929, 2685, -564,
+  -870, 4331, -2575, -590, 0, 3694, -6444, -1222, 1740, 4331, 678, -4127, 902, 9697, 1343, -564,
+  3480, 3331, -542, -5600, 0, 1385, 3222, 1692, -870, 2665, 1355, -3832, 2406, 5079, -5370, 1222,
+  435, -8328, 1355, -2653, 902, -924, -1074, 188, 435, 0, -542, 2505, -2907, -5541, -7250, 658,
+  653, 0, 1355, 2948, -2506, 9235, -3222, -1034, -1958, -7329, 1626, -295, 1203, -14776, -5907, 2162,
+  -1958, 333, 2575, -2653, 3008, -12006, -12083, -470, 2393, -1333, 0, -2063, 802, -19855, 2417, -2068,
+  -5003, -333, 1762, -4569, 100, -7850, -537, 1316, 653, 1999, 271, -8106, -501, -9697, 0, -188,
+  5003, 4664, -271, 442, -1203, -12467, 2417, -658, 1305, 666, 678, -1621, -100, -3232, -1343, 1128,
+  -870, -666, -1355, 590, -2206, -9235, -1611, 94, 653, 1333, 136, -1474, -401, -12929, 5907, 1316}
+;
+
+// batch_normalization_1 folded into conv2d_2
+#define CONV2D_2_FOLDED_WEIGHTS_SCALE_FACTOR 14
+#define CONV2D_2_FOLDED_BIASES_SCALE_FACTOR 12
+
+const int16_t conv2d_2_folded_bias[64] = {18540, 25484, 6401, 6051, 22644, 3194, 2986, 21050, 13725, 12281, 19391, 19044, 7368, 11093, 5687, 8708,
+  21523, 13412, 11296, 8564, 15052, 9436, 12912, 11800, 5977, 11105, 7019, 17594, 6361, 12268, 14489, 18926,
+  20203, 11862, 23305, 15279, 9071, 10558, 12093, 6337, 11034, 11604, 10122, 1854, 18893, 16093, 10593, 10016,
+  13231, 13734, 12302, 16568, 7972, 11838, 12987, 10223, 10556, 9644, 15891, 7952, 5314, 17613, 10531, 13108}
+;
+
+const int16_t conv2d_2_folded_kernel[64][3][3][32] NN_ALIGNED = {-858, -531, -1386, -3927, -173, 0, -644, -952, -2299, -1476, 3281, -3724, -1631, 768, 976, -1512,
+  3091, -1374, 960, 1596, -268, -446, 3458, 4069, 2696, -2208, 2520, -968, -4018, 1904, 825, 466,
+  1144, 1593, 2970, -1309, 1557, 608, 1449, 714, -6479, -1968, 7141, -4256, 0, 4608, -4148, -3024,
+  -2810, -458, 5760, -3192, -4556, 1338, 4788, -1878, -6403, 276, 2520, 1694, 6027, 1904, -4400, -1864,
+  858, 2124, 1386, -748, 1557, -912, -966, 0, 0, 492, -386, -3990, 233, 1792, -2196, 1764,
+  -5058, -6412, -4800, -2736, -5360, -1338, -532, -2817, -8425, -1656, 6160, 242, -574, 714, 2750, 932,
+  -7722, -4956, 1584, 3553, 346, -4864, 644, 4760, -627, 3198, -3860, -4522, -4893, -9472, -3172, 3024,
+  -3091, -6412, 2880, -1140, 1072, 1115, -3192, -4382, -2696, -3588, -840, -1452, -3731, 6426, -4950, -3495,
+  -10010, -4602, -7722, -1122, -5017, -14592, 3703, -1190, -418, -738, 193, -4256, -2330, -2816, 2684, -2016,
+  -1967, -2061, -5440, 2736, 2948, -1561, -2128, 5947, -6740, -2208, 5320, -1694, -2296, -4998, -7425, -3262,
+  -572, -1239, -1386, 2431, -865, 608, 2576, 1428, 627, -4920, -1544, 3724, -6058, -256, -732, -1008,
+  -2529, 4580, -6080, -1824, 268, -2230, -4788, 1252, 1685, 2484, 1400, -2178, 0, 2380, -1375, -2796,
+  -286, -1593, -594, 374, -1038, 0, 966, -952, -5643, -1968, -1930, -1596, -1398, -768, -732, -504,
+  2529, 229, 0, -3876, 1608, -223, -5586, -3130, 1685, 3864, -3360, -1694, -574, -5236, 1375, 1631,
+  -5434, -6372, -2772, 4114, -3460, -4256, 0, -1666, -3135, 1230, -6369, 2394, 1631, 512, 1952, -4032,
+  -843, -2290, -960, -912, 1608, -223, -6384, -3443, -6066, -1380, -3080, 242, -287, -952, 825, -2563,
+  2574, -885, 198, -1870, -692, -608, 1610, -1666, -1045, 1968, -4246, -3724, -233, 1024, 488, -4284,
+  281, 1374, 3200, 3192, 1608, 0, -5320, -2191, -10447, 828, -1960, -726, -2296, -714, 2750, -3029,
+  -3146, -2124, -1188, 1496, -865, -304, -1449, -1190, -209, 2214, -3088, 1862, -932, -2560, -3904, 2268,
+  0, -4809, -8000, -1596, 0, -2676, -2660, -1565, 2696, -2208, -7000, -2662, -2583, 952, -7150, 1165,
+  -1716, -5310, -3168, 2244, -7785, -3040, -1449, -3094, -1463, 492, -5018, -1862, -4893, -4096, 1708, 3528,
+  1686, 229, 1280, -2964, -1876, -3122, -8512, 4069, 4381, 0, -4760, 2662, -6601, -3808, -3025, -4893,
+  -1144, 177, -198, -3740, 173, 1824, -1771, -1666, -1463, -3444, 1737, -5586, -1864, -1024, -2196, -4284,
+  -1124, -1603, 320, -1596, 2680, 223, 1064, -6260, 8088, 1656, 2520, -3630, 574, -2380, -1375, 932,
+  3718, 1947, 2376, 374, 865, 5472, -2254, -714, -627, -4428, 0, -2394, 0, -1024, -5856, -4788,
+  1405, 2748, 1920, 1368, 536, 1784, 3724, 313, -2359, 1932, -5320, -2420, -2583, 476, -550, -1165,
+  572, 3363, 1386, -748, 0, 2128, -2415, -3094, -627, -984, -5018, -2128, -466, -1792, -4392, 2520,
+  -2810, -4122, 960, -2508, -6700, -7136, -1330, -10642, -5055, -5796, -560, 484, -5453, -476, 275, 3262,
+  1430, -1239, -396, -374, -865, -7904, 805, 952, 1672, -1230, -3667, -4788, 932, -3072, -1220, 1260,
+  -1405, -687, -3840, -912, -2412, 3568, 1330, -3443, -1348, -5244, -7000, -4356, -3731, -476, 825, -3262,
+  -5434, 885, -2376, -1122, -519, -2128, 0, -5474, -1881, -4674, -2895, 4522, 2796, -1536, -488, -2268,
+  562, -3206, 640, -1368, -2144, 6244, -2660, -2191, -11458, 552, 1680, -3872, -1722, 476, -1925, -3262,
+  -1430, -2301, 3564, 1496, 1038, -1824, 1127, 1428, 2090, -1968, -7334, -2926, 932, -4352, -244, 3780,
+  -3091, -2748, -6720, -228, -6164, -1115, -5320, 313, -2696, -11040, -7840, 1210, -16359, 2618, -2750, -5126,
+  4576, 1770, 198, -748, 1730, 1824, 966, 3094, -1881, -2460, -772, -2660, 466, -1792, -244, 0,
+  -1405, -1145, -640, 2964, -1876, 1561, -3192, 2191, -2696, -828, -2520, -3872, -287, 1190, 550, 1864,
+  0, -1770, 1188, -935, -865, 0, -2576, 1190, -1254, -1968, 2509, 1596, -3495, -512, -488, -3528,
+  2529, -2061, -640, -4332, -4020, 223, -1330, -7512, -674, 4968, -7000, -1210, 4879, -2618, -3300, 233,
+  -1430, 354, 594, 1122, 2249, 1216, -1288, 7854, 1045, 1722, 0, -3192, -4194, -7168, 1464, 4284,
+  -2248, -5267, 960, -3192, -6432, -7359, -6384, -6260, 1685, -9108, -9800, 3146, 0, 3570, -550, -2563,
+  -3146, -3186, -2376, 187, -519, -2128, -1771, -4046, 4598, -2214, -2895, 3990, -233, 4352, 2440, 3024,
+  3372, -2290, -3520, 1140, 4824, -1115, -4522, -2191, 4381, 1380, -1120, 484, -1148, -952, 6050, 233,
+  2574, 3540, 0, -5797, 519, 10336, -322, -1190, -1463, 0, 2509, -7980, 5592, -1280, -7076, -1764,
+  -5058, 2290, 4160, 1824, -2412, -2453, -1330, 2817, 4044, 3864, 4760, -7986, 1148, 1190, -1375, -932,
+  4004, 1062, 3168, -3740, 1557, 1520, -966, -238, -3344, 2706, 0, -1862, -2330, 4608, -1708, -2268,
+  1405, -1145, -5120, 684, -5092, 223, 2926, 1878, -3033, -276, 3640, 6050, -4305, -6664, 0, 4194,
+  286, 177, 2376, 4862, 2941, -5168, -322, 714, -418, -984, 0, 5852, -8155, -7424, -1708, -2520,
+  281, 916, 3840, -4332, -1608, 669, 2926, -5634, -3370, -276, -1960, 2904, 3444, 3332, -4400, -1864,
+  -4862, -1947, -396, 1683, -4325, -1824, -1932, -5236, 836, -8610, 772, -2128, 1631, 2304, -1464, 0,
+  843, 916, -1600, 456, 536, -892, 1862, -2504, -1348, 4140, 1400, -1210, -287, -2618, 550, 932,
+  2860, 1239, -3168, -374, -1903, 7296, -2254, 2142, -1045, 1722, -772, 1064, -4194, -2304, 1220, -4032,
+  -3372, 3893, -2240, -2052, -3752, -446, -532, 313, 1685, 0, 0, 3630, -3731, -476, 1100, -2330,
+  858, 0, -2178, -4301, -519, -1216, -1288, 1904, -1463, 2952, 2123, -2394, 1864, 1792, 1952, -504,
+  4777, -3206, 3200, 912, 1876, -1115, -1330, 1878, 9773, -3588, -4200, 726, 2870, -3094, 1925, 1631,
+  -4576, -531, -1188, 2618, -3633, 608, 2415, 1428, 1672, 3690, -772, 1064, -3029, -5632, 4392, 1008,
+  1124, -4122, 960, 2052, 3484, -4460, 3724, -3443, 7077, -828, 560, 2420, 574, -714, -2200, -233,
+  -3146, -3540, -1188, 1870, 1038, 1520, 966, 0, -1881, -4182, -1351, 266, -5359, -256, 1952, -1512,
+  5058, 3435, -1280, 2280, 3216, 1784, -2660, -2191, 1011, -5520, -1400, -3872, -574, 0, 6050, -1864,
+  4004, -885, -2970, 1683, 1038, 6384, -161, 2618, 1045, 1230, 772, -2128, 932, -256, -1952, -756,
+  1686, 1832, -1920, 684, -268, -2676, 1596, 3130, -1011, 276, 0, 0, 1148, -1190, 2200, 1165,
+  -6578, 0, 1782, -2805, -173, -1520, -1127, 2380, 2090, 4920, 579, -3458, -1864, -1024, 488, 2016,
+  -843, -3206, 640, -2280, 268, -1115, 5320, -3130, 11121, 0, -3080, 1210, -4879, 476, 1925, 2563,
+  -4290, 1770, 198, -6732, 1903, 3040, -805, -714, -6688, -4920, 3860, 798, 2097, 5120, -6100, -4788,
+  -5620, 0, 4480, 684, -4824, -1115, -1596, -5008, -11121, 6348, 3920, -8954, 0, 714, 550, 3728,
+  -4576, 708, 1188, -4301, 2076, 304, -1932, 3570, 0, 1230, -965, -3724, 3029, -1536, -7076, 2520,
+  0, -6641, -9600, -7296, -5092, 446, 3192, -9703, 5392, -5244, -2800, -4356, -11480, 952, -2750, 233,
+  2574, -3186, 594, -374, 1384, -304, -3542, 238, 0, 984, -1544, 798, -699, 3840, 1952, 252,
+  -562, 458, -640, 912, 3216, -3122, -3724, -313, -2022, 828, 1120, -726, 3157, -952, 1925, 233,
+  -1430, -5841, -594, 1870, -6401, -6688, -161, -4998, 1254, -2214, -772, 798, -7223, 1024, 0, 1512,
+  1124, -229, -5760, 1596, 268, -223, -3192, 3443, -674, -1380, 560, 3872, -2870, -2618, -3025, -6757,
+  4004, -1062, -1386, 2244, -1038, 912, -1288, -952, -2508, -984, -2123, 1330, -7456, 1024, 4148, 756,
+  -562, 1145, 1600, 4560, 0, -892, 1596, 6260, 1685, -1656, -280, 484, -2870, 476, 3300, -233,
+  -2002, 1239, 1386, -2057, -1557, 5168, -3703, -5236, -2926, -1722, -193, 1330, 932, 1280, -4392, 756,
+  -2248, -458, 640, -912, -3216, -2007, -798, 0, -7751, 1380, 1680, 484, 1722, -4522, 550, 2563,
+  -858, -1062, 1584, -2431, -2595, -1216, -5152, -5236, -836, -5412, -1737, -1596, 3262, 4608, 244, 0,
+  -5901, -5038, -5760, -2052, -7772, -4683, -6118, 4069, -6066, -828, -840, -4598, -7462, -238, 1375, 3029,
+  -3718, 0, -198, 2244, -692, -2432, -2898, -1666, -2508, -4428, -772, 2660, 0, 1536, -2196, -1008,
+  -7868, -4580, -5760, -6156, -7236, 1338, -798, 4382, -6066, -1932, -3360, 1694, 1722, 238, 2475, 0,
+  -2574, 885, 1386, -2618, -1384, 3344, -966, 714, -1672, 3444, 1351, 3724, -466, -2560, -1464, 1008,
+  562, -1145, -3520, 0, -4288, -4237, -3724, -1565, 1011, -276, -2520, 2178, 1722, 1904, -1100, -466,
+  -9438, 354, 1386, 2992, 0, -4256, -4025, -952, 418, -5658, -2702, 5320, -2330, 1792, -4880, 1008,
+  -3653, -5954, -10240, -3192, -5360, -1784, -3990, -939, 2022, 2208, -4760, 968, 287, -952, -2200, -699,
+  -5148, 1239, -3366, 1122, -2249, -3952, -3542, 0, -2717, 246, -1351, 1862, -1864, 1280, 1464, 1260,
+  -4777, -5038, -5760, -2508, -5628, -3122, -9044, 626, -2022, 2760, -1960, -1210, -574, 2618, -3575, -466,
+  0, 708, 0, -374, -1730, 3040, -2254, -476, -1672, -1968, -1351, 1064, -3495, -7936, -3172, 1260,
+  -2529, -2977, -320, 0, -4020, -7136, -266, -2504, -674, 1656, -3920, 484, 287, -3332, -3850, 0,
+  -4004, -1416, 2178, 1309, 1384, 1824, -2576, 4522, -3971, -738, -772, 1330, -1398, -1536, -6832, 2268,
+  -7587, -2519, 5440, -1140, -6968, -9812, -4788, -7512, -674, 9108, -2800, -1210, 1435, -4284, -4400, -1398,
+  572, 708, -792, -1496, 865, -304, -3059, -4522, 2508, -492, -2316, 3724, -1165, -256, 1708, 1764,
+  -5620, -4809, 320, -2508, -5360, -5352, -5320, -1878, -1348, 1656, -5040, -1936, -1435, -3094, -3025, 2796,
+  -4290, -531, 2376, 561, 3806, -2128, -3381, 5712, 4807, 2706, 1544, -2660, 1864, 768, 488, 756,
+  1686, 1374, 960, -3420, 2948, -3568, -1330, 939, -674, -2484, 5600, 2662, -2009, 3570, 275, -1631,
+  2860, -177, -594, -561, 1903, 3344, 322, 714, 1672, 1230, 2895, -7182, 4660, 3584, 3660, 2016,
+  -8992, -2977, 8000, 2964, 4288, -2007, -4256, -1252, 3370, -4692, 1120, 0, 2296, 3332, 2200, 4427,
+  -2574, -177, -4158, -3366, -2422, -1520, -2415, 0, -1254, 2952, 579, 1064, 1398, 1280, 976, -2268,
+  562, -229, -1920, -1368, 2412, 3345, 532, 2817, 1348, -276, -560, 2662, 0, 1666, 1100, 1165,
+  -2288, -3186, 396, -3927, 519, 2128, 161, -238, -2090, 4674, 3088, -7448, 6291, 3840, 4880, -1260,
+  562, 0, 6080, 3648, 2680, -3568, 266, -2504, 2696, 3312, 1960, -1694, -861, -714, 5225, 3262,
+  2288, -1947, -1188, -6358, -2941, 2736, -4025, -6426, 418, -3444, -2123, 532, 4427, 2560, -244, 5544,
+  7025, -2061, 2240, -456, -2680, 3568, -1862, 0, -3707, -2208, 1680, -2662, 2296, -9044, 1925, 2796,
+  572, -3186, -594, -935, -1038, -3040, 483, 952, -4180, -3444, -2123, 3990, 1631, 2048, -3172, 1764,
+  1124, 1603, -3840, -2964, -3484, 3345, -3458, -1252, -1348, 276, -2240, -1936, 2009, -2856, 3300, -3495,
+  -7722, -4956, 3366, -1496, -2249, -4256, 966, -714, 3971, 738, -3667, 5054, 3495, 4096, 1220, 3780,
+  -1405, 1374, 1280, 3192, 536, -2007, -5054, -3130, -3033, 3036, 5320, -1936, -3444, -3808, -3025, -4893,
+  -2574, 1239, -2178, -2057, -3806, 1216, -2093, -4760, -2299, -4182, -2702, 2926, -4194, 3840, -5124, 2016,
+  -5901, -2061, 640, -3192, -3752, 4014, -3192, -1878, -1685, 1380, 1400, -4598, 2870, -4760, 0, -2563,
+  1716, 1770, -5544, -1309, -3287, 1216, -3864, 2142, -3344, 4920, -965, 532, -2330, 2560, 2928, 1008,
+  0, -5038, -1920, 1824, -4556, -446, 532, 5634, 4044, 828, 560, -2662, 1722, -2856, -2200, -2563,
+  -858, -1416, 792, -561, -865, 912, -161, -2142, -627, -492, 1158, -266, 1398, 1280, -4148, -1260,
+  -562, 916, -1920, 2508, 536, 2230, 1596, -2817, 6066, 7176, 2800, -1694, 4018, -1904, 2475, -1398,
+  4290, 885, -1782, 2992, -1557, 4560, 161, 1190, -5016, 2952, 2702, 798, 2330, 512, 2196, -5040,
+  281, -458, 6720, 228, 268, -223, -2394, 3130, -4381, 3588, 1400, -5082, -2870, 238, 1925, -1398,
+  -1716, 2124, 396, 2431, 2422, 2736, 0, 714, 1881, -2706, 1351, 1862, -699, -1536, -244, 2520,
+  -1967, -916, 960, -1824, 3752, -2676, 2128, -5008, 5055, -2760, -5600, -1210, -5166, 714, 2200, 3029,
+  -1430, -177, -792, -2805, 173, 1216, -1449, 2856, -2508, -492, 2509, -266, 932, 768, -244, -7560,
+  2529, 1145, 4800, -228, 268, 2676, -5586, -1252, -674, 4692, 0, -3388, 6027, 4284, -550, -4194,
+  -10582, -2124, 2178, 935, 2249, -608, -483, 7140, 3135, -3444, -2123, 2128, -1165, 1024, -4148, 4032,
+  281, -5954, -11200, -4104, -5092, -4460, -5054, -3756, 4044, 2484, -7000, -1694, -1435, 2380, 2200, 466,
+  -3432, -5310, -3564, 2057, -5709, -11248, 1449, -3570, 627, 246, -5790, 2660, -3029, 2048, 3660, 0,
+  -562, -3435, 3840, 2736, 2144, -4906, -7448, 6260, -2022, -4140, -2800, -3872, -3731, -2380, 825, -7456,
+  -2288, 3009, -1386, -4488, 1384, 3344, 2415, -952, 1881, 246, 3088, -5852, 2097, 1024, 2440, 756,
+  1967, -2290, 3200, 1824, 804, -2453, -4522, -313, 2359, 2484, -3920, -5566, 2296, -2856, -825, 2796,
+  -1144, 1593, 2178, -9350, 1903, 3040, 1771, 714, -418, -738, 4439, -532, 0, 1536, -488, -2016,
+  -2529, 5267, 2560, -456, -4020, -3568, -1596, -1252, 6403, 4416, 840, -2904, 3444, -2856, 275, -932,
+  4004, 2124, 4752, -5423, 2422, 608, 805, 1666, 1881, -984, 1351, -3458, -1631, 1024, -2196, -504,
+  -5058, -916, -1280, -6156, -268, -892, 3458, 626, -337, -3036, 280, 2178, 2296, 0, 2750, 1165,
+  1430, -1770, -3960, -2244, -346, 4864, -1610, -476, -1881, 984, 193, 1064, -1398, -4352, -1708, -2268,
+  281, 1832, 320, 456, 2412, -669, 2926, -1252, 337, 1656, 280, -1210, -2296, -4284, -3575, 1398,
+  -572, -1770, 2178, 2618, 1211, 3952, -2093, 3570, -2508, 984, 386, 1596, -1398, -5376, -7808, 0,
+  -562, 1832, -4160, -5244, -1340, -3568, -4788, -9703, -2696, 1932, -10080, -242, -2870, 2142, -1375, -699,
+  2288, 531, -792, -1870, 0, 1520, -2898, -1428, 627, -2214, 193, -5320, -1631, -512, -488, 756,
+  -5339, 0, -2880, -1368, -3752, -3568, -1862, -6573, -5729, -552, -2520, 484, -4879, 0, 4400, -1864,
+  -1144, 531, -5940, -2057, -2249, 2432, -2254, -6188, 627, -4674, -386, 2128, 3262, 1536, 1220, -4032,
+  -1967, 2290, 4160, 912, 1876, 223, 1064, -3443, -337, 3036, -7000, -1452, 861, -9520, 3300, 3262,
+  -572, -885, 3960, -1870, 3287, 7296, -161, -1666, -6688, -5658, 2316, -532, -2563, 1024, -8052, -7056,
+  -3091, -458, 6720, -2736, 804, -446, -4256, -4695, -4718, 2760, -280, -5082, 861, -2618, 0, -1631,
+  -4004, -3009, -1386, 0, -346, -9424, -1127, 3808, -836, 3936, -4053, -3192, -1398, -5632, -976, 6300,
+  -3372, -5954, 320, -3420, -2144, -8920, -4522, -8764, -2359, 828, -7840, -968, -5166, 238, -5500, -3029,
+  2860, 177, 396, 374, 865, -2736, 161, -238, -3135, -984, -3474, 1596, -3262, -1792, -4392, -1008,
+  -1686, 687, 5440, -456, -4824, -669, -532, -7512, -6740, -828, -5320, 2420, -1435, 2618, -275, -7456,
+  1430, 0, 4356, -2244, 2595, 304, 1771, 1428, -1463, -492, 386, -266, -699, 2560, -2440, 5040,
+  -3372, -229, 3520, -2736, -2680, -669, -2394, -3443, -8425, -1656, -4200, 5566, 0, -238, -2200, -3728,
+  572, 1593, -2178, -187, -2076, 1824, -2415, -4760, -1254, -1476, -2702, -1330, -1631, 5120, 1708, -1260,
+  -4496, 916, 320, 1596, -804, -5798, -1862, 1565, -5055, 276, -1960, -7018, -3444, -4284, 2200, 4427,
+  -6864, -1770, -2574, 561, -346, 912, 1127, -238, 1254, 2214, -2895, 266, 233, -1536, -1464, 252,
+  1405, -1832, -3520, 228, 268, -669, 532, -3756, 0, 0, 1960, 968, -3731, 0, -3025, 2563,
+  -6292, -2478, 792, 2431, -2249, -912, -322, 238, 0, 4182, -1737, 5586, -2563, -4352, -1952, -2772,
+  2248, -3893, -5120, -1824, -3752, 0, -3724, -3756, -1348, 1932, -2240, 1210, 287, 238, -4950, -3029,
+  -286, -354, 1188, 4488, -2422, -4256, 805, 1904, -1045, 492, -3088, 1596, -3029, -2048, 0, 3024,
+  1124, -2748, -4160, 1140, -3216, 223, -1596, 626, -5729, -5520, 280, 4356, 287, 476, -1100, 233,
+  572, 885, -7524, -7667, -1903, 2736, -2254, -714, -1881, -2214, 2509, -5320, -2796, 3072, 976, -6552,
+  -2248, 916, -3200, -4104, -3216, -7136, -2128, -1878, -2359, 4140, -1680, -10648, 287, 1904, 2475, 0,
+  -3432, 1947, 3762, -3740, 2076, -3952, 966, 4760, -2299, -5904, 3667, -6650, 1165, 6400, -15372, -6048,
+  5901, -5038, -9600, -12084, -2680, 1115, 2128, -5321, 4718, 4968, -280, -4840, -2009, 2856, -3300, -699,
+  858, -3717, 990, -187, -1903, 304, -161, 1190, 0, 1230, -3281, 532, 466, -1280, 488, 504,
+  -281, 229, 1280, -456, -6700, -5352, -6384, 0, -5729, 1932, -2800, -2420, 2870, -714, 3300, -1165,
+  -286, -885, -1188, 374, 0, -2432, -1449, -3332, -2717, -4674, 0, -3192, -3262, 3840, 1464, -252,
+  6744, 0, 1280, 2280, 2412, 5129, 3724, -2817, 2359, -1104, 1960, 484, 2009, 238, 3025, -4893,
+  4290, -1770, -2574, -1122, -3979, 912, 1771, 2142, -2299, -6642, 1930, -1330, 233, 5888, 3416, 1764,
+  -281, -1603, -1280, 0, 4824, 446, -3458, -2191, -674, 3312, 2800, -3388, -4592, -2856, 825, -2796,
+  3718, 1593, 2376, -2992, -2076, 912, 1127, -6426, -1045, -3936, 1930, -266, -1398, 4864, -976, -7560,
+  843, 3206, 640, 912, 1072, -223, 1596, -1252, 0, 7728, 1680, -1210, 3444, -5950, 4125, -932,
+  -2574, 354, -2772, 2992, -1903, -912, 483, -476, 836, -246, -2702, 3192, -1631, -2304, -2928, 2016,
+  281, 916, -1920, -3648, -3484, -2230, -1330, -1878, -4381, -1656, -3640, -1452, -6314, 1666, 825, -3029,
+  -2574, -1947, -396, -2244, -173, -1520, 161, 3332, 209, 1968, -2702, 2926, -2330, -2560, -976, 1260,
+  -562, -4122, -8320, -912, 536, -4460, -1596, 2504, 3707, -2484, -15400, -2420, -6314, -1428, 1650, 2563,
+  1430, -1770, -3168, -1683, 692, -304, -644, -1428, -3344, -7626, 1544, 532, -2563, -3072, 0, -4788,
+  562, 2977, 1280, -2964, 3216, 2676, 3990, 939, -2359, 1932, 2520, -968, 8610, -3094, 5225, -233,
+  -3432, 1062, -1980, 187, 0, 1824, 2898, 4284, -1045, 1722, -193, -2660, -3728, -2816, -5124, 5544,
+  -2529, -4809, -5120, -6156, -2948, -5352, -6916, -5947, -1011, -1656, -13440, 726, -11480, -952, -3575, 233,
+  572, 885, 4158, -935, 5363, -608, 483, 4998, -5016, 492, 4632, 1596, 1864, -3072, -4636, -4032,
+  0, -1374, -320, -6156, 268, 0, 1064, -4069, 3033, 5244, -9240, -968, 5453, 1428, 2750, -699,
+  -4576, 1239, -5742, -374, -173, -1824, -2898, -1190, -1672, -2214, 1930, 3990, 1165, -5120, 732, 252,
+  -562, -4809, 640, 228, -1876, -5575, -6118, -5321, 3707, 828, -2240, -4114, 3731, 1190, -2200, -4427,
+  572, 354, 198, -2057, 1557, 1824, -322, 2856, -4180, 3936, 3860, -3458, 0, 768, -976, -3276,
+  -281, 1145, -6720, -2508, -1340, -1561, -2660, 2191, 1348, 1380, 840, -968, -861, -2142, 825, 4427,
+  -4004, -4779, -792, 935, 1038, -2432, 1932, 0, -4807, -1968, -965, 3990, 3961, -2560, -1708, -3024,
+  5058, -1603, -7360, -2508, -268, 2899, -1862, -1565, -337, 6900, 1960, -1936, 7749, 3094, 1375, -1864,
+  1716, -2301, -2574, 0, -1211, -1824, 644, -1666, 1045, 2706, 2702, -3192, 4194, -768, 1708, 3276,
+  -1405, -1374, 5760, 0, -2412, -892, 1064, -1565, 337, 2760, -1680, -5082, 1148, 476, 550, -2330,
+  -6292, -2301, -1188, -2805, -1903, -6688, -2576, 952, 418, -492, -7720, 532, 1864, -5888, -2440, -3024,
+  1967, -1832, 0, -684, -1340, -5352, -3192, -11894, -674, -6624, -5040, 2904, -2296, -238, -825, 699,
+  -2288, 531, -198, -2244, 519, 304, 161, -238, -1672, 2952, 965, -1330, 2330, -7424, -4392, -504,
+  -5901, 916, 1920, -1596, -3752, 1338, -2660, -13772, 2022, -276, -3640, 242, -287, -714, -1375, -5126,
+  -1716, -531, 1782, -935, 865, -304, 2254, -1666, 2299, -1968, -1544, -6650, 1864, -4352, -6832, 1764,
+  -4777, -5267, 0, -4788, -6968, -4237, -1862, -8451, -5729, -3036, 840, 0, -1148, 2856, -825, -1165,
+  2288, -531, 396, -7293, 519, 1216, 2254, 952, -209, 984, 4246, -5320, 932, 1536, -4636, -5040,
+  -1686, 229, 3840, -4332, -3216, -6021, -266, -5008, -1011, 5520, 0, -4356, 2009, -1666, 4400, 932,
+  2002, 708, 594, -9911, 173, 912, -1932, -5236, -2508, 3936, -772, -6384, -1864, -2304, -2196, 1764,
+  -3372, -4809, 6080, -2508, -4288, -892, -4788, 0, 2359, 0, -280, 0, 4018, -5950, 3025, 699,
+  -3718, -708, 198, -3927, -519, -304, 483, -2142, -209, -246, 772, -2394, -466, 1792, -3416, 1008,
+  3934, 687, -2560, -1596, -4288, -1338, -532, -2504, -1685, -276, 6440, -2178, -1722, 2142, -4675, 2796,
+  6006, -885, -1980, -2805, -3633, -912, 1288, -1190, 418, -246, 965, -798, 2563, 1536, -1708, 252,
+  -3091, 3664, -2240, 1824, 1072, -1561, 1064, 3756, 337, 1932, 4760, -1936, 1148, -5474, 1375, 1165,
+  1716, 708, 1980, -1122, -1557, -6384, -161, -952, -1463, 984, 0, 2660, -6058, -5120, -1952, -3024,
+  -3372, 3893, 1600, -2280, -1608, 5575, 5320, 4382, 1348, -3864, -6720, 7744, 5166, 1666, 550, -2097,
+  572, 354, 2574, 748, -5363, -3952, 1932, -2618, 1254, -246, -4246, 3458, -2563, 0, 0, 4788,
+  -3372, 1145, -8000, 5244, -1072, -3122, 532, 939, 2696, -2760, 840, 2904, -5166, -1428, -1650, -1398,
+  286, 1239, -792, -3179, 1730, 4560, -3703, -1190, -5434, 738, 1158, 532, -1165, -3840, -732, -2268,
+  -6463, 687, 3200, 1140, 2144, 223, -1862, 3443, -6066, 3036, -560, -2420, -1148, -1666, 2750, 2563,
+  2002, 1239, -198, 2431, -1730, -1216, -1610, -2142, 2926, -1968, -1737, 0, 1864, 768, -4148, -2268,
+  3372, -2519, -7360, -5244, -3216, 2453, 1064, 4695, 1685, 0, 1120, 3388, -2009, 2380, -2200, -233,
+  3718, -531, -2178, 2244, -2422, -2736, 1288, 238, 1045, 1968, -1158, -2660, -4427, 512, -244, -756,
+  -4215, 1603, 320, 3876, 3484, -4683, -798, 1565, 0, -2484, -560, 242, -4879, -4522, -3575, -1398,
+  -3718, -1947, -1188, 561, -2249, -12768, -5796, -6664, -418, -3198, -1737, 2128, -3961, -3840, -732, 1008,
+  3372, -3664, -640, -2052, 1876, 1338, 1862, 4695, 5729, -6072, -840, -484, -5166, -476, -7975, -1864,
+  858, -1416, 594, -2992, -346, -2736, -6440, 2856, -1463, 984, -772, -266, -7689, 2560, -3416, -252,
+  -5620, -3206, -6080, -2964, -804, -4460, -1330, 5321, 2022, -5520, 840, -242, -8897, 952, 2475, -4660,
+  4004, -531, -990, -1496, 2076, 0, -5152, -3808, -1254, 2952, 1158, -4788, 699, 1280, 1464, -1764,
+  1686, -916, 2240, 2052, 7772, 2453, 3458, -2504, 1685, -276, -2800, 2178, -4018, -3570, 3575, -466,
+  -6292, 0, 1782, 748, -865, -1824, -5152, 2380, -4807, 246, -4053, -1596, -3495, -256, -2684, 2016,
+  -3091, -3664, -5440, -2508, -1876, -4906, -3724, 626, -674, 0, -9240, 1210, -4018, -238, -550, -466,
+  1430, 354, -7326, 935, -3806, 1216, -5152, -4522, -1045, 3690, -2702, 5054, -3495, -2304, 976, -3528,
+  -1405, 1374, 3520, 456, 1072, 446, -1064, 2191, -3707, 552, -3360, -2178, -1722, -1904, -1650, 233,
+  -7436, -3540, 198, 2805, 346, -5472, -3542, -952, -2090, 1968, -5018, 1862, -7456, -256, 3416, 3024,
+  1967, -4809, -4800, 1824, -268, -1784, -2926, 2504, -674, -1656, -1400, 2420, -9471, -476, -7425, -4660,
+  -2574, 2832, 1188, 374, -2249, -4256, -2576, 476, 209, 492, 2316, 0, 2796, 1792, -976, -1764,
+  6744, -229, -7040, -1596, 804, 1338, 2128, 1878, 4381, -1380, -3080, 484, -1435, -952, -550, 1864,
+  2288, 3186, 2772, -561, 1730, -304, -3220, 1190, 209, -2706, 0, -798, -4660, 2048, -5368, 2772,
+  -1686, -2290, 640, -2280, 5896, -2899, 2660, -4382, 2022, -3036, -5040, 5324, 2870, 5236, 275, -2097,
+  -3146, -2124, 990, 2618, -519, -7296, -644, 952, 0, 5412, -2895, 1596, 2563, -4608, 3416, -2016,
+  4777, 0, 3520, 6384, 7772, -3122, 1064, -1878, -5729, -1932, 5600, -1936, 2583, 1190, 2475, -5359,
+  -572, -885, -1782, -561, -2249, -6080, 322, -4046, 2299, -2952, 1544, -1330, -2097, 3584, -4148, 2268,
+  562, 3206, -6400, 3192, 1876, -1338, 1596, 3130, 5392, 2208, 1680, 484, -1722, -6664, 550, -466,
+  2288, 177, -2574, -2244, -5363, 4864, 644, -3808, 2926, -2214, 579, -1064, -4194, 4096, -976, 2016,
+  1124, -229, -320, 456, 2412, -7359, 266, 6573, 6403, -828, 1400, 484, -4018, -1904, -825, 2097,
+  2574, -708, -4356, 1870, -1903, 6688, -2576, -7378, -2299, 3198, 1351, 1330, 466, -1280, 1952, -4032,
+  -1686, 1832, 4160, 2052, -2948, -4906, -5054, 5947, 4044, 2484, 2800, 4114, -4018, -4760, -1925, 932,
+  -2860, -531, 1386, 374, 1557, 608, 805, -952, -5016, -984, -2316, 1330, 0, -1536, -3660, -2772,
+  2529, 1374, -4160, 1368, 1340, 3345, -3990, -12833, -5055, 4692, 0, -3630, 1148, -4522, 3025, -3029,
+  2002, 1416, -2178, -5423, -173, 3344, -1610, -7140, 1045, 1230, -1544, -2394, 0, -768, 0, -2772,
+  -1405, -2977, 2560, 228, 268, -1338, 2394, -8138, 1685, -3312, -560, -5082, 861, -952, 1925, 4660,
+  -5720, -177, 990, -1870, 519, 1216, -161, 2142, 1045, 1722, -3088, 266, -1398, 2816, -5368, 5544,
+  -4496, -9618, -6080, -3192, -5628, -6244, -4522, -4382, 12132, -4968, -1680, 1210, -4305, 3094, 825, 1165,
+  858, -1239, -2574, -5423, -2422, 912, -161, -1666, -418, 4674, -193, -532, -699, 3840, 1220, -3780,
+  3372, -1374, 640, 3192, 2144, 2899, 266, 2504, 3707, -3588, 840, 242, 1148, -2380, 3025, 2097,
+  -286, -1593, 396, 0, -865, 2128, -2737, -7140, -2926, -7134, -965, -1330, 2796, 5120, -2440, -3780,
+  562, 2977, 3200, 2052, 1072, 4460, 532, 1252, -674, -552, 1120, 726, 1722, -2380, 5775, -932,
+  572, -708, -792, 561, -1038, 3344, -805, -952, 1254, -1230, 193, -4256, 932, -1536, -732, -252,
+  1686, 1374, -2240, -1368, -3484, 446, -3458, 5634, 1348, 828, 840, 3146, 2296, 3332, -550, -1864,
+  -6006, -2478, 594, 1309, 1730, -1520, -1288, -1666, 2299, -4182, -2316, -798, -2330, 1024, -4148, -3024,
+  -843, -2748, 5440, -1140, 3216, -223, -532, -3130, 2696, -5520, 1680, -484, 1148, -1666, -1100, 233,
+  -2860, 177, -5940, -2992, -2076, 3952, -2576, -7140, 2299, 0, -5597, 0, 4194, 2560, -4392, 5544,
+  5339, -7557, 4160, -912, -12596, -223, -7980, 626, 2022, -276, 3640, -726, 287, -4284, 3025, -466,
+  1144, 2478, 1584, 748, 865, 5472, -2093, -1190, -836, -1476, -3088, 266, 1398, -2560, -244, 756,
+  8149, 0, -6720, -5700, -7504, -446, -798, 5321, 2696, -2484, 0, 1936, 287, 0, 3025, 466,
+  -2002, -1947, 990, -1122, -519, 6384, -1771, 2856, 1463, 4674, 772, -3724, 3961, 1024, 244, 1512,
+  -281, 687, -1920, -684, 1608, -1338, -3192, 1878, -1011, -1380, -1400, 4840, 287, 238, -2475, -1398,
+  -1716, -1416, 1584, -1309, -1384, 0, -2737, -7616, -2090, -2460, -4632, 4788, -2330, -1280, -7564, 3024,
+  -3091, 2519, -8320, 2052, -4824, 4683, -3724, -3130, 3707, 6900, -8400, 726, 1435, -4046, 4675, -3029,
+  858, 885, 396, 1683, 519, 1824, -483, 2856, -5852, -984, -5018, -1330, -2796, -5376, -2196, -252,
+  -5620, -2748, -4480, -6612, -4288, 892, -1064, 626, 4381, -6624, -8680, 4356, -1722, 5474, -275, -3262,
+  -3146, -1062, -1782, -5049, -692, 1216, -1771, 952, -4180, 984, -772, 3724, -4427, 1792, -3904, -1512,
+  562, -2977, -320, -4332, -1072, -6021, 798, -5321, 3033, 552, -5040, -5566, -4592, -6426, -275, 4427,
+  6292, 885, -4752, -2431, -2768, 304, -2737, -2856, 1045, -984, -386, 1862, -6757, 5888, -1708, -4536,
+  -2810, 916, -4160, 912, 4824, -3791, 5054, 3130, -674, -1932, 0, -8954, -9184, -3332, 5225, 932,
+  -4862, 0, 990, 2431, -1730, -3344, 0, 476, -209, -4920, 772, 2128, -2097, 3840, -5368, 252,
+  3934, 2519, -2560, -4788, -3216, 892, -798, 313, 1011, -1104, -280, 2662, -7462, 3570, 3850, -3961,
+  -4004, -2478, 594, 1683, -1038, -5472, -3381, 238, -3971, 1968, 2702, -1064, -5592, 256, 1220, -1260,
+  5901, 2290, -3200, -1596, 6164, 446, 1330, -1565, 4718, -3588, -4200, 1210, 1722, 2856, -825, -1631,
+  -1716, -531, 792, 2992, 865, -1216, -644, -4522, 1254, -2952, 965, 1330, 466, 5376, 2928, -6048,
+  -2248, 2519, -6400, 6156, 6164, 4014, 3724, 4069, -8088, -9936, -5600, -4356, -287, 3808, 2750, -3262,
+  -572, 354, 2772, 3179, 1211, 1520, -2415, 5950, -1881, 6150, -579, 1330, 3029, 1792, -2928, 3024,
+  -562, -4351, -4160, 2280, 2680, -1561, -7448, 4382, -7414, -1104, -3080, 484, -7749, 2618, 550, -3029,
+  -286, 1416, 1188, 0, 3287, 1520, -483, 476, 1672, 1722, 4246, -798, 932, 1280, -3172, -252,
+  -3934, -3435, -4800, -912, 2412, -2007, -532, 3130, 674, 1380, 840, 726, 1148, 0, -3850, 1631,
+  572, -177, 396, 1683, 3460, 3952, -1449, -1904, -418, -3198, 2702, -1330, 932, -3328, 244, 252,
+  -1686, 3664, -4160, 456, 536, 669, 5054, 1878, -3707, -3036, 0, -1936, 1722, 3570, 2750, -2796,
+  2288, -1770, 1386, 1496, 0, 608, -644, 714, -1881, -1968, -1544, 2660, 6058, -5376, -2684, 1260,
+  2248, 687, -2240, 2280, -5360, 1561, -2128, 939, -5392, 276, -1120, 968, -4592, 714, -275, 3029,
+  1430, -3363, -6534, 2431, -4498, 0, -3542, -3332, -2508, -2460, 1930, -798, -9786, -1280, 1952, -5040,
+  2248, 5038, 8320, 1368, 1340, -1784, -798, 1252, 1011, 1104, -1960, 484, 4305, -6664, 3575, -1398,
+  1716, -2832, 396, 0, -1211, -1216, -483, -4760, -3344, -5412, 386, 532, -4660, -2816, 732, -504,
+  -1405, 5496, 1920, 3876, -268, 669, -1064, 313, 5392, 3864, 4200, -1936, 2296, -6188, -550, 1165,
+  1430, 2124, 2772, 0, 2249, -608, -805, -714, 1881, -3936, -1351, -3192, -2563, -512, -4636, -1260,
+  -7587, 916, 960, -2736, -4288, 2453, 4522, -3443, -1011, -6624, -5040, 6050, -1148, 3570, -3850, -2796,
+  -4004, -3186, 1188, -4488, -865, -1824, -3864, 1428, 1045, 3444, 772, 1596, -3029, -2048, -2196, 2268,
+  -3653, -2519, -8320, -3192, 3216, -3791, 266, -10955, 1011, 0, -3640, 1452, -2296, 3570, 2200, -2330,
+  -6864, 885, 396, -3366, -1038, -1520, -1610, 1428, 2299, 4920, 1544, -8512, 3262, -2560, 976, 4536,
+  -6182, -4351, -320, -2964, -1340, -6690, -5320, -13459, 1348, -5244, 2520, -726, -1435, -1190, -3025, 932,
+  -3718, -1062, 5148, -2244, -1038, 4864, -966, -1428, 4807, -1476, 2895, -5586, 0, 2560, 2196, 6300,
+  0, 458, -3200, 684, -3752, 2230, 2660, 7199, 6740, -2760, 2520, -1210, -2296, 1666, 4400, 3961,
+  1716, -2301, -396, 374, -2768, 1216, -322, -1190, -3344, -6150, -193, 1862, -466, 1536, 1220, 504,
+  3372, 5496, -4480, -228, 1876, 2007, 6916, -939, -1348, 3036, 1120, -1452, -4592, -4046, 4675, -932,
+  -2574, -3009, 396, 935, 865, -912, 483, -4522, -1881, -738, -965, -1064, -1165, 3584, -244, 2016,
+  0, 0, -640, -1596, 2412, -446, 1596, 2504, -674, -1932, 0, -2662, -1435, 476, 825, 1398,
+  -1716, -4248, -3168, 1496, -2768, -5168, 1610, -2618, -2717, -7626, -2702, 0, 1864, 5120, -2928, -1512,
+  4496, 458, -5760, 2736, -2412, -2007, 3458, -1565, -674, 3312, -1120, 968, -2009, -1428, 7150, 3262,
+  1430, 1593, -3564, -2244, 0, 2432, -322, 714, -627, 984, 2702, -4522, -233, 1024, -2440, -1260,
+  -3372, 916, -1280, 684, 0, -3791, -4788, -1252, 3707, 0, 280, 726, -3444, -238, -1650, -1165,
+  -4576, 531, -3960, -2992, -1211, -3648, -1288, -4046, -2926, -5412, 3281, -798, 0, 1024, 1952, -7056,
+  2248, 1145, -2560, -228, 3216, 4683, 2926, 313, -674, -276, 0, -3388, -1435, -2856, -3025, 3495,
+  -2860, -1770, -1188, -1683, -3114, 5776, 483, 238, -418, 3444, 1930, -3724, 1398, 1536, -1220, -1260,
+  2810, 2977, 960, 1368, 2144, 446, 3990, 626, -1011, -2208, 4480, -4356, -2870, -2380, 1925, 2796,
+  -2860, -1239, -2574, -5610, -1384, -1520, -5474, -2380, -2926, -492, 1737, -3192, -7922, 256, -732, -2520,
+  1124, 916, 320, -1824, -804, -1561, 4788, -1878, -1011, 4140, -840, -3872, -6314, -238, -4400, 4660,
+  -2002, -1239, -3564, -5610, -1384, 3648, -3059, 0, -1463, 246, 1158, -6916, -699, -1280, -5856, -2772,
+  -1405, -3206, -3520, -1824, 0, -4683, -4256, -3130, 3033, -2484, 560, -7260, -2583, -238, 3300, -3029,
+  -2574, -354, -1584, -6171, 346, -1520, -966, 1428, -4180, -1476, -193, 0, 2330, -2048, -2684, -1260,
+  -1967, -229, 1920, -3192, -4288, -669, -2128, -1565, -1011, -552, 280, -9196, -861, 2618, 2475, 2563,
+  -3146, -2478, -198, -1496, -1903, 2736, -2254, 1666, -2508, -1968, 1544, 0, -5126, 3584, -1952, -2520,
+  -281, -4122, -3840, -4104, 1608, -1338, 3724, -6886, 4718, 3312, -4480, -2178, 861, 238, -4400, 2563,
+  -11440, -4956, 1980, -3366, 173, -2432, -3542, -1428, -5434, -4428, 386, 798, -4427, -256, -6100, -2772,
+  -4777, -2748, -6080, -684, 0, -6021, 2394, -7825, 3033, 2484, 840, -1210, 2009, -4998, -5225, 1631,
+  -1430, -3186, -594, 2618, -6228, -6992, -483, 2380, -4180, -5904, -3281, 4788, -6291, 3840, -3660, 756,
+  1405, 687, -9920, -228, -3484, 669, 532, -939, 3370, 3588, -7560, 1210, -6888, -2142, 1375, -1398,
+  1430, -2478, -3564, 1309, -1211, -1216, -966, 476, 2090, -492, -2316, 2660, 0, 1792, 2196, 3528,
+  6463, 229, 2880, 1368, 4020, -446, -1064, 939, 3370, 0, -840, -968, -2583, 714, 1925, 699,
+  -5434, -2832, 198, 2057, 1384, -3040, -2737, 238, -418, -2706, -3474, 5586, -1864, 0, -1464, 504,
+  5620, 2061, -3200, -2052, 4824, 2676, 1862, -5321, 674, -3036, 1120, 1694, 861, 4760, 0, -3728,
+  1430, 0, 396, 2057, 3114, 2128, 322, 1428, 2299, -246, -965, -1330, 699, 512, -2196, -2268,
+  -1686, 0, 0, 456, 4824, 3568, -798, 5008, -6066, -552, 5320, -242, 287, 1904, 3850, -3262,
+  -2288, 1593, -1782, -5797, -2076, -1520, -4025, -2380, -5016, -246, 1351, -5852, 0, 1536, 2196, -6804,
+  843, 1145, 8960, -2736, -268, 669, 1862, -1565, -4044, -3864, -1400, -5566, -6601, 2618, 3300, -466,
+  -2860, 1947, -594, -8789, 1557, 7600, -2737, -238, -3553, -1968, 965, -532, 6990, 5888, -8784, -4788,
+  562, -2748, -5120, -5928, -1876, 4906, -2660, -3443, -4044, 1932, 280, -8470, -3157, -2856, 6325, 3961,
+  -1144, 2301, -594, -3927, 346, 4256, -966, 0, -3553, -2214, 772, -2394, -1398, -768, 732, -252,
+  -3653, -2748, -320, -1368, -6432, 223, 1596, 1252, 2696, 4140, -560, 2662, 1148, 952, 1375, 3961,
+  -8294, -1947, -1386, -2431, -2595, -304, -3220, -5950, 209, -5658, -3860, 266, -1631, 5376, -3660, 1764,
+  1686, -6641, -3200, 2052, -3484, 669, -2660, -3130, -6740, 0, -840, -1694, 6027, -5474, 275, 1864,
+  -3432, -1593, -3366, -1870, -2941, -4560, -2576, -4760, -2299, -738, -2702, 4256, -6058, 2304, -1220, -1260,
+  -1124, -3435, 320, -4788, -4020, 1784, -6650, 2191, -4381, 828, -3080, -3630, -5453, -952, -4125, -9786,
+  -2288, 2124, -1782, -561, 1903, 1520, -644, 952, -1881, -738, -579, -1596, -3029, 768, -3904, 1260,
+  -3372, -1832, 4480, -3648, -4020, 0, -2128, -626, -1685, -3036, -4200, -3388, -2009, 4522, 550, 1165,
+  2288, 1416, 990, 561, 692, -608, 1610, -2856, 836, -1230, -3281, 532, 1631, -512, 1220, 5292,
+  -1967, -1603, 2560, 456, 0, 669, 2394, 2504, 2022, -2760, 2800, 3388, 4305, 476, 1925, -466,
+  5434, -1062, 3564, 2431, -346, 1216, -161, 1428, -209, 3444, -2895, 1596, 0, -1792, -6100, 0,
+  -3653, 2061, -1600, 1140, -1340, 1784, 532, 626, -3033, -2760, 560, 4840, 287, 476, 4125, -2330,
+  286, -885, -396, 187, 1384, 2128, 161, -3094, 0, -2214, -1737, -266, -2563, -256, -488, 3276,
+  -3934, -1603, 1920, 3192, 1876, 0, -532, 2817, -3033, -552, 1960, 0, 574, -1428, 0, -699,
+  572, 2655, 198, -2992, -1038, -6992, 483, -2618, -2717, -5412, -1930, -1862, -2097, -5888, -2928, -2268,
+  281, -5038, -6400, -4104, -1876, 1561, 2128, 626, -3370, -1932, -6160, 968, 6888, 1428, -550, 2563,
+  3146, -708, -6534, 0, 173, -4256, 322, 4760, -2926, 1476, -579, -1330, -699, 1792, 244, -3528,
+  3372, -4122, -1280, -2052, -3216, -4237, -266, 6573, 2022, -3588, 2520, -968, 3731, 1190, -1375, -1398,
+  -4576, -2478, -2772, -5049, -865, -11552, 322, -1666, 0, 1968, 1930, -1596, -4194, -2048, -2928, -3528,
+  -1124, 1374, 6400, -1824, 4288, -2230, -2660, -939, 3033, -1932, -280, 1694, 6027, -952, 1925, -5825,
+  -286, 2832, -1188, -6171, -865, -1824, 1288, -238, -3135, -3690, 772, -1064, -2330, 5632, -3172, -2268,
+  3091, -4351, -1600, -3420, 0, -1561, 5586, -2191, 11121, 1932, -6160, -6292, 287, -3570, -5500, 3961,
+  -1430, -708, -1782, -1122, -1557, -5776, 2415, 2618, -3135, 3198, 2509, -3458, -8621, 7424, -5368, -8568,
+  9835, -2061, 320, -2736, 2948, -1784, 3724, -4695, 7751, 276, -2240, -1210, -2870, -3570, -550, -233,
+  -572, -885, -4752, -374, -2595, 912, 3059, -2856, -3553, 2952, 2895, -1596, 1165, 3584, 1220, -2520,
+  7306, -2061, 3840, 1824, 5896, -1115, -3192, -1565, 2359, -3312, -7280, 968, 1722, -6188, 5500, -2097,
+  -4576, -6195, 0, 2992, -5536, -8816, -1127, 238, 1045, -1230, -2123, 2394, -5126, 1024, 1952, -2772,
+  5058, 687, 960, 2280, 4824, -1115, 3458, -3756, 8762, -2484, -2520, 3388, 574, 1666, 3575, -6757,
+  4576, -1593, 594, -2057, -4152, -4864, -322, 2380, -2926, 492, 1351, -266, 3262, -1024, -2440, -6048,
+  3934, 3206, 640, 3648, 536, 892, -2660, -6260, 674, -2208, -1400, -3388, 4592, 0, 1925, -3728,
+  3432, 1416, 198, -5984, 2941, 2736, -322, 238, 2926, 492, -193, -4788, -233, 4608, -5124, 2772,
+  -8711, -1832, 320, -684, -2680, -1115, -3192, 5008, -2359, -3864, 7280, -1210, -5166, -476, 4125, 3029,
+  1716, -354, -594, -5610, 3287, 5472, -2415, -1666, 1672, 246, 193, -3990, 3961, 1280, -1952, 1764,
+  -843, 687, 4160, 2508, 536, -1561, 1862, 1565, 6066, 1932, 2520, -3388, 3444, -1190, 6875, 1165,
+  1430, 2301, -2970, -2992, -1730, 2432, -1610, -7140, -3135, -3198, -386, 1596, -4427, -512, 1220, -3024,
+  3091, 3435, 640, 456, 1608, 0, 1862, 10642, 2696, 3588, 560, -1452, 1722, -4046, 3575, 3728,
+  -8580, -7611, 2574, 374, -1038, -2736, 322, -1666, -2926, -7134, -2702, 0, -8621, -2560, -732, -2520,
+  4777, 0, 960, 228, 4824, -1338, -2394, 1252, 4381, -828, -5600, 1936, 4305, -476, -275, -5359,
+  -7436, -3009, -1980, 187, 692, -7600, -805, -238, -3971, 0, -386, 5320, -3495, -1792, -2684, -1764,
+  2248, 2977, 0, -684, -2412, -1115, 3192, -5321, -2696, 1932, -2800, -1452, 287, 1190, -275, 932,
+  0, -177, -792, -3179, 519, 0, -322, -476, -418, 6888, -1351, 2926, 932, -5120, -2440, -2016,
+  1967, -1145, 1600, -3420, 2680, 0, -532, -7199, 4718, 552, -6440, 242, -861, 2142, -3300, 233,
+  -3432, -2478, 1188, 561, 865, 2432, -483, 3570, -209, 984, 579, -4788, 3029, 256, -976, 1764,
+  3372, -1374, -5760, -3420, -3752, -2007, -5054, -3130, -7077, 4140, -3360, -3146, -6027, -238, -1100, -233,
+  1716, -3009, -3366, -935, -2422, -1216, -483, -1666, -3344, -492, 579, -3458, -6291, 2304, 1952, -2520,
+  2810, 1832, 640, 0, 4824, -223, 2926, -4695, 3033, -3312, -1680, -3146, -4592, -2142, 0, 1631,
+  -2002, 354, 990, -1496, 346, 1824, -483, 476, -418, -984, 4246, -9842, 466, 512, -1464, -3276,
+  -3653, -1603, 3520, -912, 3752, -1115, 1330, -4382, 4381, -1656, 840, 1210, 287, -2142, -1100, 2330,
+  -1144, -1416, -4950, -1309, -173, 2432, -2093, 238, 1463, 1230, -965, -2660, 932, 3072, -2440, -252,
+  -1686, -1145, -7040, -1368, -2412, -446, -5054, -313, -2022, -1104, -3080, -3630, 2009, -476, 3850, 1631,
+  -2860, -2478, -198, 2244, 2076, 0, -161, 2856, -3971, 2460, -3088, -2394, -5592, -3840, -2684, -252,
+  -562, -3664, 0, -228, 0, 1115, -4522, -4069, -8762, -276, -4760, -726, -4879, 4046, -1375, -3262,
+  -12012, -8496, 4158, -2431, -1903, -9728, 1288, -1666, 4598, -1968, -2895, -3192, 0, 1280, 3416, 8820,
+  -1967, -6641, -2560, 912, 804, -3345, -3990, -1565, -7414, -1380, -1120, 4356, -6601, -2618, 1375, -3961,
+  2288, -885, -2574, -187, -2422, -304, -161, -4998, -5434, -4182, 1158, 2926, -466, 3072, -2928, -3276,
+  -4496, 4122, 3520, -1824, -6164, -1784, -2926, 4382, 337, 0, -1400, -5566, -3444, 3808, -825, -5825,
+  0, 3186, -198, -5049, 865, 912, -161, -476, -5225, 492, 2509, -11172, 466, 6656, 1220, -3780,
+  -4496, -1374, 1280, 456, 1876, -892, -1064, 2817, 337, -3864, 840, -3146, -3444, -2856, 4125, 4427,
+  -286, 2124, 1386, -3927, 1211, 912, -2898, 1428, -7315, -4920, 5404, 1596, -3728, 5632, -4148, -2772,
+  562, 3893, 2880, -4104, -2680, 446, 2660, -1878, 0, 276, -4760, 1452, 3731, 1904, 275, 3961,
+  3146, -2301, -2376, -1683, -5017, -1824, -161, -6664, 0, 0, 0, -798, -1398, 4864, -488, 1512,
+  1967, -2748, 2240, 1140, -3484, -4014, 1862, 2504, 7751, -828, -1120, 0, -287, -2856, -275, 233,
+  1430, -2124, 1782, 2805, 173, 3344, 805, 1428, 2090, -1476, -772, -1064, 0, 2560, 732, -2268,
+  -281, 2290, 3520, 2736, 268, -1338, 798, -1565, -5392, -4140, 2800, 1936, -574, 1428, 2475, -932,
+  572, -1062, -792, 2992, 2249, -3648, 0, -3332, 3971, -1476, -2316, 2128, 2097, 256, 0, 5292,
+  -1967, -1603, 320, 1368, 1340, 2007, 1064, 1565, -3370, -7176, 280, 3630, -5453, 4760, -1925, -2796,
+  -3146, -1062, 4554, 748, 1557, -912, 644, -5236, 4389, -4920, -3088, -532, 4893, -1024, -1464, 6048,
+  -4496, -3664, 960, -684, -6700, 1338, 532, -5008, -7077, -1104, -1680, -1210, -3444, 0, -2750, -233,
+  -6006, -5487, 1188, 2805, 1557, -7600, 483, -3332, 3344, -1722, -5597, 7182, 1398, -256, 2196, 6048,
+  281, -916, -1920, 3648, 0, 892, -1064, 1878, -5392, -2484, 2800, -726, 1148, -476, -2750, -2563,
+  3432, 354, 1782, 561, -1038, 1824, 1127, 0, 3135, 3690, -3281, -2128, 1631, -3584, 488, 5796,
+  -10397, 1603, 960, 2964, -7504, 1115, -3724, -1252, 337, 276, 560, 968, -2583, -4522, 550, -1631,
+  -3432, -177, 5544, -1683, 519, -1520, -1932, -3094, -2508, -3690, -2895, -3990, 1398, 4352, 244, -1008,
+  -4777, -4122, -6720, -912, -5628, 446, -3458, 313, -8088, -3036, 3080, 2178, 861, 1190, 1375, 699,
+  2574, 3540, -792, -4488, 1384, 304, 1449, 2618, 4807, 4182, 2316, -5852, 233, -2560, -732, 2016,
+  1405, -916, 1920, -228, -10720, -669, -3724, 1252, 6403, 552, 1120, 484, -861, 1428, -1100, 1864,
+  -2574, 708, 2178, -7667, 1730, -5472, 322, 2142, 418, 1968, -2509, -1596, 1631, -3072, -3172, 1260,
+  -281, -5954, -4160, -6840, -8844, 669, -2394, -1565, 6740, 828, 5040, 2420, 1722, -5950, 550, 4194,
+  -1144, 531, 594, -5423, -3806, -3952, -1449, -4046, -1463, 2214, -3281, 266, 4194, 1536, -2928, 3276,
+  -2529, -2061, 3200, 228, -3216, 223, -532, 1252, -5055, 4416, 2520, -1936, 2583, -7854, -4400, -699,
+  -2574, -1770, 594, 2618, -3460, -4864, 1127, -1428, -1045, -1722, -4825, 1596, -6524, -1280, -732, -3024,
+  -843, -229, -1600, 1140, 1340, 2230, 3724, -939, 0, -552, -1960, 4114, -574, -1190, -2750, 3728,
+  -3146, 0, 396, 2057, -865, -1824, 3220, 1190, 2299, 2460, 772, 1596, -2796, -1024, -2684, 3024,
+  -3934, 2290, 1600, -684, -1072, -2899, -1064, -4069, 0, 0, 3920, 3630, -4592, 1904, -6325, -3495,
+  4576, 1593, -2178, 561, 692, 0, -1288, -238, 0, 1722, 0, 532, 1631, -1792, 1464, 1512,
+  0, -2061, -2880, 2052, -3216, -3122, -1596, -3443, 1348, 1656, -1120, -726, -1435, -1666, -1100, 4427,
+  572, 1239, 1782, 187, 1557, 1520, 1771, 1428, -8151, 3444, -3281, 798, 233, -2560, -4636, -6804,
+  -2810, 2061, 1920, -2964, -1876, -669, 0, -2817, 1011, -1380, -12040, -726, -9471, 3570, -1925, -3961,
+  -3432, -708, -1782, -2992, -1384, 1824, 322, 3094, -418, -1230, -4439, 10906, -233, -768, 244, 756,
+  -7306, -2290, -10880, -4104, 3484, -8474, -798, -1878, 5055, 1104, -9800, -2420, -8036, -714, 6875, 6058,
+  -2860, -2478, -2376, 374, -2422, -2128, 0, -3332, -1881, -1968, -579, 6118, -1631, 2304, -3904, -756,
+  -3372, 687, -320, -4560, -3216, -4014, -266, 939, 674, 1656, -3640, -2904, -1148, -1666, 4675, -233,
+  3432, -531, 198, 187, 865, 1216, 2576, 1666, 1881, 492, -772, -532, 1864, -5120, -488, 3276,
+  562, 0, -320, 912, -3216, 1784, -2128, 3756, 7077, -1380, -8400, -2662, 2583, -238, -5225, 699,
+  0, -3540, -2970, 561, 173, -9120, 1932, 0, -7524, 246, 579, -798, -8388, -9216, 244, -7560,
+  5901, 2519, 8960, -228, -268, -1338, 798, -3443, 674, 1380, -7000, 3388, 2583, -1190, -1375, -7922,
+  -286, -2124, 198, -561, 3460, 2432, -3059, -952, -2926, 246, -772, 266, 3029, 768, -732, -2268,
+  2810, 0, 0, 456, 1876, -7136, -5054, -4695, -4044, -2760, -280, 0, 2296, 714, 4950, -699,
+  -7722, -354, -2772, -187, -2768, 5776, -2898, -3332, 1045, -3690, -4632, 1064, 3262, -3584, -488, -504,
+  -5901, -916, -320, -2736, -268, 2676, -1330, 0, -1685, 1380, -840, 2178, -6027, 3808, -550, 1398,
+  -1430, -1416, 3366, -561, -865, 4864, -5313, 2142, -3971, 3444, -386, -532, 1631, -6656, -5612, 504,
+  1967, 2061, 640, -4332, -2412, 1561, -1064, -5634, -1348, 1104, -7000, -484, -1722, -952, -4675, 1864,
+  1144, 708, -1782, -374, 519, -5168, -805, 952, 836, -492, 0, 1862, -1631, 1024, 2196, -756,
+  -843, 916, -640, -228, 804, 669, 2128, 2191, -4381, -552, 560, 726, 861, -238, 2200, 1631,
+  -5720, 2124, 792, -6358, 1211, 8816, -7567, 3094, -627, 984, 386, -6118, 3262, -256, -11224, 1008,
+  843, -3893, -4800, -9120, -2680, 2007, -1064, -7199, 0, -1380, -4480, -2904, -3731, 6426, 0, 2097,
+  286, 708, 594, -2618, -519, 4560, -4025, 4760, 0, -1476, -1930, 4522, 2796, 1280, -12200, 3528,
+  3091, -6412, -10560, -9804, -4020, 3791, 532, 1565, 337, 2760, -6720, -5808, -1435, 0, 3025, 2563,
+  572, -1770, 792, -2805, 519, -3648, -1449, 952, 3553, -2214, -579, 1596, -1864, -2048, 1220, 1512,
+  2248, 687, 4480, -456, 2680, -892, 1064, 4069, 5055, -1380, 1680, 0, -2296, -1190, 3575, -2796,
+  -1144, 531, -4158, -4114, -2941, -1520, 0, -1666, -1672, -984, -2123, 2660, -466, 4864, -1952, -1260,
+  -2810, -4122, -2880, 684, 1340, 1115, -2394, 5634, -5729, 4692, 0, -7986, -3731, -8330, -1650, 699,
+  858, 1416, -3366, -374, -1903, 2432, -2093, -714, -4389, -2706, -1930, 3458, -1631, 768, -2928, -4032,
+  281, -3893, -6400, -2964, 2680, 3122, 798, 3130, -4381, -1104, -1680, -726, -1435, -3570, 3300, -3961,
+  3718, 531, -1584, -1870, -1211, -912, 1288, -2618, -209, -1476, -3088, -532, -3262, 1024, 2684, -5292,
+  -281, 916, 5120, 684, 1340, 5798, 2926, 0, -2022, -2484, -560, 2420, 6314, -2856, 2750, -932,
+  -7150, -3009, 3564, -1309, 1038, 912, -1449, -1428, 3344, 492, 772, -1064, 1864, 1792, 1952, 2520,
+  -562, -5267, -4800, -684, 536, -3345, -2660, -3756, 0, -2760, 1120, -1694, -861, 0, 275, 3029,
+  -3146, -708, 2178, 4114, 3114, 2432, -1449, 952, 627, -984, 386, 1064, 1165, 3840, -3172, 504,
+  -843, -3206, -6720, -3420, -4556, 223, -4522, 313, -7751, 2208, 1680, 4840, 3444, 1428, -3300, 1398,
+  -2288, -2301, -3168, 1309, -173, -4560, -483, -714, 1254, 5166, -1544, 2660, -1398, -2816, 4636, -1764,
+  -1967, 1145, 640, 2052, -4556, -4014, -3192, 1878, -13480, -3864, 2240, -1694, 4018, -3570, -2475, -4427,
+  -1144, -885, -396, 1122, -1557, 608, 1127, -2142, 0, 3690, -772, 3724, -1864, 1536, -1952, 2520,
+  -2810, 3206, -4800, -912, 268, 2453, -3724, 5947, -1685, 4416, 1960, -968, -1148, -4998, -4125, 466,
+  2288, -4071, -3960, 2057, -2595, -1520, -2576, 476, -627, -1230, -6755, 2128, -6757, -6656, 2440, 252,
+  -6463, 916, -9280, 1368, -6968, -4683, -1330, 8451, -5055, 0, -2800, -1694, -10906, 1666, -6325, -6291,
+  2288, 0, -1386, 3553, -865, 5472, -966, -1190, -836, -492, 386, -266, 233, -256, 1220, 1008,
+  -4777, 2748, -1280, -1140, 2412, 446, 3458, -4382, -2022, 276, -2240, 2904, 1722, 2856, -1375, 4194,
+  -3146, 3009, 2970, -5049, 2076, 3344, -1127, 1428, -836, 246, 2509, 532, 1398, 4096, -244, -2016,
+  1967, 3435, 1920, -5244, -804, 3791, -3990, 0, -3707, 2208, 3080, -3872, 2296, 1428, 825, 2796,
+  1716, 1239, 792, -6732, 3460, 2128, -2254, 1428, -1045, -1722, 1351, -2128, 4660, 5120, 488, -7056,
+  0, -1374, 3520, -6156, -804, 1115, 798, -5947, -6403, -3588, -560, -4840, -1722, 3570, 3025, 4427,
+  2288, 0, 396, -3179, 3633, 2128, -3220, -238, 1045, -2214, -772, -1064, 6291, 4608, -1952, 3276,
+  1405, -6641, -5760, -2280, -3484, 2899, -1596, 2191, -1348, 828, -1120, -4114, -1148, 476, 5225, 1864,
+  858, -177, -4950, 3927, 0, -912, -1449, -714, -836, -984, -772, -798, 233, -768, 2196, 2520,
+  -562, 2748, -2560, -228, -2680, 669, -4256, 3756, -8425, 0, -3360, -2420, -2296, -1428, 1925, 1631,
+  2574, 1770, 3960, 2805, 2422, 5168, 805, -1666, 209, -1476, 193, -3192, 1398, -4096, -1952, 504,
+  -1686, -3206, -640, -2052, 1072, -892, 2926, -3756, 3033, -2208, 1400, -242, 1148, 2142, -1925, 3728,
+  -3432, -1239, -2574, -374, -1903, -912, 1610, -476, -209, 2460, 579, 2926, 2330, 3072, 0, 2772,
+  -1967, -916, 3520, 912, -1072, -892, -3990, -2504, 3707, 5244, 3080, -4114, -287, -1428, 4400, 466,
+  -858, 708, -1584, -6919, -2249, 1520, -3381, -1428, -2717, -246, -1158, -4788, 3495, -512, -1464, 504,
+  -562, -458, -3520, -3876, -3216, -1115, -5320, -3756, -674, 276, -3360, -2420, 4018, -3094, 1100, 1864,
+  -7722, -1239, -1782, -5423, -3114, -2128, -322, -2380, -3553, -5658, 0, 1064, 699, 3328, -2440, -2268,
+  1967, -5954, -11840, -5928, -3484, 892, -4256, 7825, -1011, 8004, 4480, -3388, 2296, -5950, -825, 3961,
+  2860, 1593, -396, 2244, -346, 3648, -644, -1904, -2717, -492, -965, 3724, -1864, 256, -3660, -2772,
+  -3372, 2748, -640, -6612, 268, 892, -266, 1878, 1348, 2484, -3360, 2904, -5740, 238, -4675, 1165,
+  -4004, -1062, -5346, -1683, -3633, -2432, -3864, -3808, -6479, 5166, 0, 1330, -2097, -256, -3172, -4536,
+  281, -3206, 2240, -228, 268, -2453, 266, 3130, -3033, 2760, -2800, 1936, -574, -9044, -275, -2097,
+  -6006, -3717, -2178, 1496, -3114, -3952, 161, -3094, -1672, -5166, 1544, 7448, -6058, -2304, -5368, -3276,
+  3653, -229, -4480, -3192, 4824, 3568, 1862, 1878, -5729, 6072, -8960, -1936, 2583, 0, -1925, -4427,
+  2002, -708, 2970, 3179, 4152, 2736, -322, 2618, 418, 5166, -2509, 5586, -4660, 1024, -976, 4788,
+  -6744, 2290, -960, 912, 1340, -2007, -266, -3443, 7077, 828, -5040, -242, -4018, 4760, -1650, -3728,
+  4576, -1593, -2970, -3740, -1730, 304, -4186, -2856, -418, 984, 386, -3990, -3728, 5120, -244, -6552,
+  843, 2748, 0, 228, 3216, -1784, 6118, -1878, 3707, -2208, -1400, 726, 4879, -476, 825, -3029,
+  3146, 531, 198, -374, 519, 3040, -483, -714, -1672, -492, -3667, -532, -2796, 1536, -488, 252,
+  0, -687, -960, 2280, 1340, -223, 1330, -1252, -6403, -9384, -1680, 1694, -2870, 952, 1375, -3495,
+  0, 3540, 198, 2431, 865, -1520, -1932, 0, -2508, 1476, -1737, 1862, -2796, 2048, 488, -252,
+  -2248, -2519, 1280, 1596, -804, -1561, 1064, 3443, -5392, 276, 3080, 242, 574, 2142, 275, 2097,
+  -2574, -4956, -2178, 3179, -2422, -3952, -1127, -2856, -1254, -4182, -3474, 266, -1864, 4608, -732, -1764,
+  562, 2061, -1920, 5016, 2144, -3791, -2394, -6573, -4718, -4416, 0, 242, 5453, -2618, 8250, -7223,
+  -1430, -708, 990, -374, 3287, -1824, 0, -4284, -2090, 2952, -772, -2926, -233, 256, -488, -4032,
+  281, -3435, 8320, -1596, -2680, 1784, -266, 939, -6066, -1932, 1960, 1936, 2296, -952, 825, -3495,
+  -4004, -2832, -5148, 1683, -1903, -6688, -1449, 2618, 2508, 984, -3088, 2926, 932, -1536, -1464, 1008,
+  2529, -4351, -1920, -2508, -3484, -3345, -7714, -4069, -2022, 552, -280, -4114, -1148, 1428, 4675, -4893,
+  7150, 3009, 198, -1870, 1211, 3344, -2576, 0, -1254, 1230, 3667, -8246, 0, 6400, 3172, -2772,
+  -6182, 2061, -640, 1368, -8040, -2899, 1064, 2817, -6740, -3036, 4200, -242, -574, 3332, 3575, -1631,
+  858, -177, -990, -2057, -1557, -6080, -2093, -4522, 2717, -3444, -2123, 1596, -2563, 7424, 3904, 3024,
+  2248, -2748, -4800, 1824, 3752, 2899, 8512, 5947, -1348, -2208, 4480, 3146, 3731, -3570, 5775, 2330,
+  2860, -177, 2376, 1122, 346, 3040, -322, -714, -4389, -984, 1930, 532, -7223, 1536, -732, -5544,
+  -1967, 3893, -640, -1140, 1876, 5352, 7714, 626, -3370, 2484, -2800, 2662, 2583, 3808, -2475, -5359,
+  -2002, -2478, 792, 374, 173, -912, -3059, -238, -418, -246, -5597, 266, 1631, -768, 732, 756,
+  7306, -2519, -3840, 228, 2948, 1784, 2394, -1252, -1011, -3036, -2240, -2662, -5740, 4046, 275, 1398,
+  2574, 2124, -2376, -561, -1557, 304, -1932, -238, 836, -3444, 1737, -5852, 932, 512, -244, -4788,
+  -1967, -2519, 6400, 3648, 4020, 669, 2926, -5008, -5729, -5796, 4760, -6776, -861, -714, 6050, -466,
+  858, 885, -2376, 1496, 1384, 1520, -3059, -3808, 836, -2706, 1737, -3990, 2330, 0, -1708, -1764,
+  -1686, 687, -5120, 3192, -2144, -446, 532, 4695, 2022, -3312, 2800, 1210, -1435, 1666, 550, -3262,
+  -858, 531, -3960, -1309, -3114, -3648, -3220, -4760, 1045, -2952, -6369, 1862, -233, 2560, 976, 1260,
+  -3091, -1832, 3840, -1140, -536, -446, -3192, -313, -337, 6072, 1120, -2662, -287, -3094, 825, 466,
+  -5434, 0, 594, -1496, -346, -11248, -1932, -6188, 4180, -1968, -3860, -8778, 3029, 512, 1220, -252,
+  -5339, -7328, 2240, 1824, -1072, 669, 3724, -2817, 8425, -4140, 6440, 2904, -3444, -952, -4675, -5126,
+  -6006, 177, 990, -2805, -1730, -608, -966, -3094, 2090, -492, -965, -3724, 233, 0, -2928, -2016,
+  -3934, -2519, -2880, -2964, -1072, 4237, 1330, -1565, 13480, -6348, 5880, 242, 2870, -238, -3850, 466,
+  -2002, 2478, 396, 1496, -3460, -7600, -3703, -2380, 1881, -738, -3088, 1330, -1398, -7680, 244, 4788,
+  -5058, 458, 5760, -1140, -536, -1338, 2394, -939, 4381, 828, -5040, 968, -2870, 1904, -3300, -1398,
+  -2002, 354, -1782, 374, -4844, -5168, -2415, -476, 2090, 1722, -1737, -6384, -2796, 1792, -732, 1764,
+  0, -6412, -640, 912, 0, -1784, -2660, -3756, 9773, -3864, 280, 3146, 861, -1904, -2750, -233,
+  -2860, 531, 396, 187, -4152, -4864, 644, 1666, -2090, -1722, -1930, 1064, -1398, 512, -732, -3780,
+  -6182, -687, -6400, 2052, -2144, 2676, 532, -2504, 6066, -2208, 4760, -2420, -4879, -476, -1650, -3029,
+  858, -531, -4356, -3179, -2422, 1824, -322, -4046, -3971, -2460, 1544, 1862, 4194, 768, 0, -756,
+  -281, 687, 2560, 0, -3484, 6690, -2660, 4695, -4381, 2760, 1400, -4114, -2870, -3094, -825, -4194,
+  572, 708, 1782, -1683, 2768, -912, -322, -1190, -11077, -1968, 2702, 266, 932, 1280, -4148, -5292,
+  -6463, 1603, -2880, -5016, -1072, 1561, -2128, 2817, -5729, 9936, -3360, -1452, -1148, 476, 0, 932,
+  -858, 2478, 396, 0, -1384, 3648, 1449, 2380, 627, 4182, -386, 2926, 1165, -2048, 1952, 2772,
+  -3653, -1603, -5760, 912, 1608, 1338, 4522, 3130, 674, 2208, -5040, 1936, -574, -1428, -1100, 2796,
+  -10868, -6195, 990, 3553, -3633, -10032, -966, -2142, -1672, -2706, -3860, 798, -4427, 0, -3904, 1764,
+  3653, -2061, -3840, -1596, 268, 2007, 266, 1878, -674, -1656, -280, 6776, 287, -1428, -3025, -8388,
+  2288, 1416, -5940, -2057, -2941, -3648, 966, -9044, -3344, 4428, 965, -798, 1165, 768, 4636, 1512,
+  -4777, 229, 2560, 2736, -1072, -2676, -7448, 5947, -9436, 552, 1400, 484, -861, -9282, -2475, -5592,
+  -1144, 2301, 2376, -2805, 1384, 1824, -966, 4046, -2090, 492, 3281, 3458, 1864, 512, -5124, -504,
+  2248, 2290, 3200, -7980, 1608, 3345, 1862, -1878, 1011, 3312, -560, -1694, -574, 4998, 1925, 2330,
+  1430, 2478, 1782, -1496, 2768, 2432, -805, -1904, -3553, 1968, 579, -266, -3495, 3328, -2928, -756,
+  -4777, 1374, -1600, -684, 3752, -1561, -1596, 3130, -3033, 0, 840, 1936, -2583, 238, 825, 1864,
+  -10296, -177, -1188, 935, 692, -8208, 1932, -1904, -209, -984, -3474, 2660, -2330, -2304, 1220, -756,
+  2810, -3206, -4480, 228, 6700, 1338, 9576, 4382, -2022, -1932, -840, 968, -574, 4046, -275, 0,
+  -1716, -1416, -3168, 1683, -1038, 2128, 1771, -952, 2299, 3198, -386, 1064, -699, -2304, -2440, -1512,
+  1124, 1603, 6400, 912, 1876, -446, 1064, 4382, 337, -3588, -3080, -4114, -4879, 1190, 2475, 2097,
+  572, 177, 3960, 2244, 865, 1520, -5152, 476, -1045, -984, 3667, 2926, 233, 5376, -2684, -5040,
+  3091, 687, -6080, -1368, -536, 3122, 1064, -1878, -4044, 6072, 1120, -968, 8036, 1190, 3850, -1398,
+  -1716, -1770, 2772, 187, -2249, -7600, -4025, -3094, 2717, 246, -1544, 0, -1631, 768, -2684, 4536,
+  -5058, -5725, -4480, 4788, -1072, -1784, -3724, -939, 2359, -4692, 2520, 2904, 861, -1190, 0, 233,
+  4290, -1239, -1584, 1309, -1730, -2432, -4508, 2380, -209, 9102, 772, 532, -6524, 2304, -1708, -3528,
+  -3372, -5267, -3520, -5016, -4824, -6021, 1862, -5947, 1348, 276, -2520, 484, -3157, 1666, -825, 233,
+  -1144, -1062, -6138, -1870, 0, 0, -322, -238, -2717, 4428, 965, 1330, 2563, 3840, 0, -756,
+  0, -1374, -4160, -2280, -2412, 892, -3458, 313, -4381, 6624, 3360, -6776, 4879, -3808, 1375, -466,
+  -8580, -1416, -1980, -4675, -1211, -3344, -1449, -3332, 3971, -2214, -3474, -4256, -466, -1024, 3416, 0,
+  0, -3206, 1280, -2964, 5628, -4237, 3192, 1252, 5729, -4416, 0, 2904, -1148, -2142, -1375, -233,
+  572, -1416, 594, 5423, 1211, 4256, -2093, 1904, -5643, 984, 579, 4522, -5126, 0, -488, -4284,
+  -1967, 687, -5120, 1140, 2680, -3791, 532, -313, 1011, 1656, -8120, 726, -3157, -2380, 1925, 0,
+  -4576, -1770, -396, -187, -1557, -304, -2737, -714, -3344, 2460, -1158, 2660, -6058, 1536, -4636, -1260,
+  281, 1603, -320, -3876, -2144, 446, -1862, -313, -4381, 4140, -5320, 726, -1435, 476, -3025, -1631,
+  -2002, 1416, -3960, 1496, -519, -4864, -805, -238, 2717, 738, -1737, 1596, -4194, 256, 4148, -1764,
+  -3934, -1145, 1920, -2736, 4824, -4683, 2926, 3130, -1348, -2484, -5320, -726, -5166, 1904, -1375, -699,
+  6292, -3540, -1782, 1309, 1384, 2432, 322, -1904, -1463, -1968, -2702, 5586, -1165, 1792, -2440, -3528,
+  -2248, 2061, 6400, -456, -3752, -3345, 532, 939, -6066, -3864, -5040, 726, -7175, -952, 3300, -8621,
+  -1430, 177, 0, 0, 346, 912, -1610, 1666, 2508, 2460, -3860, -2660, -1864, -3072, -2928, 1260,
+  3934, -3435, -3520, -5472, -2948, 2007, 3192, -7199, 1685, -6348, -3360, 3146, -2583, 5474, -550, 233,
+  858, 1416, -3168, -1309, 3287, 1216, -3542, 4046, -209, 2460, -1351, 1862, 3728, -2304, -3904, 1764,
+  1124, -2748, -4800, -3648, -1340, -1561, -3458, -5321, -3033, -276, -1400, 3872, 2870, 2142, 1100, 1631,
+  286, 1239, -792, -748, -692, 3952, -805, -2618, 2090, -1476, 965, 1596, -1398, 0, -488, 1008,
+  -6182, 1374, 1920, -228, -2948, 223, 1862, -1252, 337, 1656, -2240, 3630, 1435, -2618, 825, 1631,
+  0, 177, -7524, -12342, -1730, 2736, -2576, -952, -3135, 2952, 579, -266, 2330, 5376, -1464, -1008,
+  -2529, -3893, -3520, -912, 536, -6021, -5586, 313, -337, 5244, -1120, -7744, -5166, -8330, 1100, 5359,
+  1144, 2124, -2772, -3179, 1384, 3952, -2093, -238, -3135, 984, 1544, -266, -1631, 3328, -3416, -7560,
+  -1686, 916, 4160, -9348, -536, -892, 3458, -1252, -2696, 1932, -2240, -6776, -1148, 3808, 7975, -699,
+  -3432, 0, -1188, -1870, 2249, -912, -2898, 0, 209, -4182, 2702, 6118, -1631, 2816, -7076, -252,
+  -1124, -229, 0, -1824, 2412, 3568, 4522, -1878, -2022, 2208, -1960, 968, 1722, 1190, 1375, -2097,
+  -3718, -8142, -3168, 2618, 1038, -10944, -1127, -2856, -3135, -2214, -2702, 532, -8854, -256, -244, -2016,
+  -1124, -229, 5120, -3648, 2948, -1784, -1330, 1565, 3033, -2484, -1960, -242, -1148, 4522, 1925, -10019,
+  -2860, -1416, -1584, 2244, 1903, -6992, 644, -714, -1045, -3198, -2702, 3724, -8854, -768, -2440, 1260,
+  -1124, -6412, 320, -2052, 1340, -223, 532, -313, -1685, 828, -1400, -1936, 5453, 4046, -3300, -2330,
+  -1716, -4602, -2772, 1309, 346, -3344, 483, 1904, -418, 4920, -2123, -798, -4660, -1536, -2196, -1512,
+  -2810, 687, 320, -684, 2680, -3345, -3724, -1565, -4381, -1104, 560, -1694, -3444, 3332, -3300, -6757,
+  -3146, -2301, -990, -2805, -5017, -2432, -2737, -3570, -2299, -6642, 2702, -2926, -1631, -256, -4880, -3024,
+  3091, -2290, -3840, 456, 1340, -2676, -2926, -1565, 674, 1932, 2240, -6050, 2009, -6664, -1375, 699,
+  1430, 531, 594, -1496, 1211, -3344, -805, -1666, -2717, -1722, 1930, 2660, -1398, 3328, -2928, -7560,
+  -281, -229, -4160, -7296, -3484, -669, -6650, -3443, -3033, 3312, 1960, -242, 2583, -476, 2200, 1398,
+  2860, -177, -198, -561, 2249, 304, -1449, 1428, 2299, 0, 386, -5320, -3029, -512, 1464, 4788,
+  -4777, -1145, 0, -912, -4288, -2676, 1064, -2817, -7414, -1380, 0, 1210, 5453, 0, 0, -466,
+  4576, -3009, -2376, -6732, -5882, -1824, -5957, 2380, -209, -984, 2123, 1064, -1864, 4352, -2196, -756,
+  -3372, -2519, -320, 2052, -1340, 669, -532, -9703, 3033, -1656, 5320, -5082, 5740, -714, 1650, -1631,
+  2288, 1947, -5346, -5610, -1038, 3040, -1771, -9282, -3971, -6642, 4053, -1330, -1165, 5376, -4880, -1764,
+  -4777, -3206, -2240, 3420, -2948, 223, -1596, 4382, -3370, 3588, -280, -1452, 287, -4760, 3025, 233,
+  1716, 1416, 3762, -374, 0, -3344, -483, -4998, -2090, -6150, 2702, -1862, -6757, 256, -2196, -504,
+  0, 1374, -10240, 684, -4020, -446, 266, 5947, 7077, 3312, -3080, 5082, -1148, -4522, -4125, 0,
+  -2002, 354, 1386, 935, 1384, 1520, -644, 3332, -1672, -5904, 1930, 798, -2563, 1280, -488, -2772,
+  5339, 1145, -1600, 912, -3484, 2676, 798, -5008, 2359, 552, 2800, -3388, 3444, 476, 825, -466,
+  -5720, -4956, 198, 1309, -3114, -8512, -966, -5236, -209, 0, -4439, 1596, -5126, 768, 2196, 756,
+  -1405, 687, -2880, 1368, 536, -2453, -5852, -4382, -5055, -4416, -280, 0, -2009, -3332, -2200, -11417,
+  572, -1062, 1386, 374, 2768, 0, -1449, 714, -1045, 1722, -965, -1596, 233, 2304, 1708, 2268,
+  -2810, -2748, 1920, 1368, 4020, -4460, -266, -939, -5729, -1932, -1680, -2662, 287, -476, 550, 1864,
+  2574, -177, -1386, -2618, 1903, 3040, -2576, 2856, -1045, 1722, 3667, -2128, -466, 1024, -8540, 252,
+  2529, 687, 2560, -3876, -2412, 1115, 5586, 3130, 5392, 552, -840, 484, 2009, 2142, 275, 2097,
+  -6292, -2655, 3762, -2057, 2076, -2432, -1771, -238, 1045, -984, 193, -1330, -3262, -2816, -5124, -4032,
+  3934, 3206, -640, -912, -2680, 3568, 2394, -5947, 1685, -2208, 4200, 3146, 2583, 0, 3575, -932,
+  -286, 1239, 5148, -2244, 1384, -912, -1610, -476, -1045, -492, -772, 4788, -1165, -5888, -1464, 0,
+  -3934, -2290, 2240, -912, -4020, -446, -1330, 1252, -1011, 1380, -2240, 1694, -574, 3332, -2475, -5359,
+  -4862, -1770, -6732, -748, -3114, 2432, 805, 2142, -418, -1476, -1351, 532, 466, 256, 3660, 1008,
+  1686, 229, 1280, 228, 804, 2676, -3724, -3756, -2359, -4140, 2520, 1210, -2009, -3570, 2475, 233,
+  -286, -1770, -1782, -1309, -1557, 3344, 1449, -1666, -9196, -4674, -2316, 0, -1864, -3072, -7076, -7812,
+  -3372, 4122, -5760, -4104, -1340, -446, 266, -3756, -7077, 4140, -2240, -8228, -4018, -714, -2475, -1631,
+  -4004, -177, -5742, -1683, 865, -608, 1771, -3094, 209, 4182, 0, -9044, -1398, -7680, 488, 2520,
+  -8149, -3435, 3840, -4560, -4020, -8028, 266, -5634, 1685, -7176, -840, 1210, -9471, -1428, -9075, -932,
+  -5720, -2301, -990, 748, -2422, 304, -1771, -4522, -1045, -2952, 193, 1596, 5126, -6912, -1220, -1008,
+  1967, -687, 5760, 3192, -2680, 4237, -3192, -939, -2696, 0, -2240, -2178, 1435, 714, -4675, -1398,
+  -572, -885, -4158, -4488, -2768, 1824, -1127, 714, -2717, -1968, 386, 798, 1631, -3840, -5124, -4284,
+  -7587, 687, -320, -3648, -1608, -1115, -6916, -1565, -1348, 6348, -4760, -8470, 861, -238, 0, -1631,
+  -3718, -2301, 198, -3927, 346, -304, 966, 4522, 1881, 5904, -2509, -2926, 466, -3584, -976, 5292,
+  -1124, -7786, 2560, -2736, 1072, -3122, -3458, -7199, 1011, -3864, -4760, 726, -3731, -952, 0, -699,
+  2002, -1947, -1782, -1122, 1038, -1216, 161, -1190, -4389, -1476, -4053, -4522, -1165, -256, -5124, -1764,
+  1967, 1374, -2560, -1140, -5092, -2899, -2660, 2191, -6066, -1380, 0, 1694, -287, 1428, 4400, -466,
+  3432, -2124, 792, 1870, -2076, -7600, -322, 476, -1881, -738, -772, -2128, -5825, -1280, -3172, 504,
+  -2529, -916, 1280, -456, 1608, -1115, 3458, 6573, -1348, -4140, 560, 4356, -3157, 238, -275, -2796,
+  572, -885, 0, 561, 0, -5776, 161, 1190, 2508, 738, 193, -1330, -3029, -2304, 2684, -1512,
+  -4215, -1374, -2240, 4332, 1340, -3122, 0, 1878, -6066, -4140, -280, 1452, -2870, 1904, -4400, 3029,
+  2860, 531, -4158, -3366, -519, -3952, -3059, -5236, -2299, -3198, -1158, -1064, -2563, 1280, 5124, -3276,
+  -1405, 3664, -3200, 3648, -5896, -1338, 2394, 1565, 0, -2760, 560, -242, -2870, -5236, 8800, 233,
+  4290, 2478, -594, -4114, 3460, -304, -1932, -2618, -2926, -1476, -193, -5852, -233, 4352, 244, -7812,
+  -1124, -1603, 640, 684, 2412, 2230, 2128, 2817, -3370, -4416, 840, 3146, -3444, 1428, 6600, 233,
+  -858, -1416, -1980, -2805, 1903, 4864, -2898, -2618, -836, -2460, -1544, -3990, 3728, 0, 4880, -2016,
+  5058, -458, -4160, 3192, 1340, 5575, 3458, 4069, 3033, -5520, -2800, 2178, -4305, -1666, 7425, 1631,
+  286, 2301, 1980, 187, 2422, 6992, -1288, 2856, -1463, 246, -2509, -1064, -932, -6144, -5124, 504,
+  -3091, -1374, -6400, -6156, -7236, -1561, -532, -7512, 2022, 276, -6160, 1452, 574, 3808, 1100, -1398,
+  -5434, -1416, 3960, 2244, 2076, -3040, 322, 3332, 2299, 2460, -4439, 4256, -2097, -5888, -488, 756,
+  -281, -6641, -320, -1140, -8576, -1338, -3458, -3130, -9773, 1104, -1680, 4840, -4305, 5712, -825, 3495,
+  -2288, 0, -3762, 2431, 519, -3952, 1127, -2380, 836, 1230, -6562, 3724, 3728, -2560, 4392, -1260,
+  -3934, -3664, 2240, 4332, -2144, -3122, -532, 2504, -3033, -1932, 1120, 0, -1722, -1190, 3300, 1631,
+  -572, -1770, 1980, -4862, 519, 0, -4830, 476, -418, -2460, -1351, -2926, 0, -2560, -2440, 3024,
+  -5058, -687, 4160, 1596, -1876, 892, -5320, -4069, -6403, -276, 3360, -3630, -1435, 714, 1100, 2330,
+  5434, 2301, -2574, -561, 1557, 2736, -2576, -1428, -2508, -3444, -2509, -1596, 2330, -1024, -3660, -6804,
+  -1967, -687, -640, -4560, -2948, 4906, 3724, 1878, -7077, -5796, -1680, -2662, -287, -238, -275, 466,
+  -6578, -2124, 1584, -935, 519, 3344, -2898, 1666, 1254, 738, -772, -266, -466, -1024, 0, 1260,
+  -1686, -4122, -8640, -4788, -4556, -2453, 798, -5947, 2022, -5520, 1400, 3630, -2870, 0, -275, 699,
+  -2574, -6549, -990, 748, -6920, -10336, -1932, -8330, -1463, -5658, -5211, 3724, -1864, 3840, 0, 4536,
+  -6744, -2977, 960, 1596, -7236, -4237, -6916, 6260, -1011, 3864, 280, 484, -2583, -9520, -1100, -3961,
+  -286, 531, -2970, -1870, -1730, 2128, -805, -4760, -6270, -4428, -2123, 4522, -10485, 2048, -3172, -4032,
+  -3372, -3206, 3840, -4788, -5360, 2676, -3192, 5634, -2359, 1656, -10360, 242, -3731, 952, -550, -6524,
+  -4004, -3540, -2376, 561, -2422, -2432, 483, 1190, -3553, -2706, -3474, -2128, -5592, -3840, -1464, -1260,
+  1124, -1603, -5440, -5016, -804, -1338, -3990, 939, 0, 3036, -3360, -2904, -1435, -238, -1375, -3029,
+  -2002, 2301, 3960, 1122, 2422, -3344, -1610, 6426, 1672, 2706, -772, -1862, -233, -4352, -976, 2268,
+  -3372, -1603, 0, -3192, 1876, -4906, -532, -313, 337, -1104, -5880, 2420, 1722, 2380, -4400, 0,
+  2574, 1947, -1584, -2805, 1384, -608, -966, -238, 418, 492, 772, 798, -1631, -768, -6588, 504,
+  -3653, -3435, -640, -4788, -804, -669, 532, -4695, -1348, -6624, -3080, 2662, -2009, 1666, 6600, 699,
+  2288, -177, -1782, -3179, -1557, -4560, 1771, 1428, -1463, 3198, 1737, 1064, -1864, -768, -2196, -2016,
+  1405, -916, 1280, -2280, -268, -1115, 0, -1252, 2359, 2484, -3640, -2178, -574, 1666, 1650, 932,
+  -1144, -1416, -2574, 748, -2941, -3344, 1449, -2142, 2717, 246, -965, 2660, 932, -4096, 732, 3276,
+  3653, 2061, 2880, 912, 1608, 1115, -266, -4069, 7414, -1104, -1680, 1936, -2870, -1428, -3850, 466,
+  0, 531, 1584, -374, 173, 4256, 0, -3332, -3762, -492, 0, 4522, -6524, 0, -1952, -7056,
+  2529, 2977, -2880, 2052, 2680, -1784, 3192, -2817, 1685, 4140, -1960, 726, -2296, 4284, -1100, -932,
+  -572, 708, -3762, 187, 1211, -1824, -3059, -3094, 836, 1230, -772, 1862, 5592, -1536, -976, 3528,
+  -1405, -458, -640, 1824, -5628, -3345, -7714, 2817, -4044, -552, 1400, 0, -2009, -1428, -1100, -2330,
+  -4862, 1239, 198, -2244, 1557, 3040, -1288, 4284, 1881, 1722, 965, -2394, 1165, -2048, -5856, 2520,
+  -1686, -1832, -3520, 0, -1340, -1115, 2128, -1878, 5055, 3588, -5880, 968, 1148, 2142, -5225, 3961,
+  -2860, -1770, -1584, -2057, -865, 3344, -322, -3332, -2299, 3444, 2123, -532, 1864, -3584, 976, -4788,
+  5058, 458, 2240, 456, 2948, 1338, -3192, -4069, 2022, -3312, 1680, -13068, 287, 0, -2750, -1631,
+  -2574, 1239, 2376, -3366, 2941, -912, -1288, 714, 209, -1968, -965, 266, -5126, -3584, -6100, 5292,
+  -5339, -2748, -1280, -7068, -2680, -5129, -3724, 0, -1011, -552, -2800, 242, -1722, 476, -4400, -699,
+  0, -885, -6138, -2057, -1557, 4560, -1127, -2380, -2508, 0, 1158, -7448, 4893, -1280, 732, -3024,
+  -3372, 2748, 4160, -912, -4824, -5575, -2128, 5008, -2022, -828, -3080, -4114, -4592, -8092, 3575, -699,
+  -6864, 1239, -2376, -7667, 692, -1824, -3059, -8092, -3762, -3198, 772, -5586, 4427, 3840, -3660, -5040,
+  -3091, -1603, 1280, -4560, 2412, 3791, 1596, 313, -2696, -552, 0, -5808, 574, -3570, 1650, 7689,
+  -572, 354, -4950, 374, 0, 3344, -1127, -476, -9614, -1722, 0, -4256, -1165, 4352, 2196, -7560,
+  1686, 2748, -640, -1368, -2948, -2676, -5320, 1252, -4044, -1380, -1120, -5082, -1148, -3570, 4400, -699,
+  -1430, -3363, -2772, 2244, 1557, 1520, 0, -952, -3762, 1968, -5018, 1330, -3728, 0, 1708, -1512,
+  3372, 5725, 640, -3420, 1876, 4014, 0, 1878, 674, 3036, -2800, 2178, 1722, 1666, 3025, -4893,
+  -2574, -708, 1782, 2057, 2422, 2736, -1449, 238, -2090, -1968, 2509, -1330, 2563, -4096, 2196, -1512,
+  -843, -687, 4480, 2052, 2144, 892, -3724, -6886, -3370, 828, -2240, 242, 2583, 1190, -2750, -3728,
+  -2002, -1770, -4554, 1309, -346, -1216, -1127, 952, -2299, -2952, -1158, -1862, 3495, 512, 244, -2268,
+  -1967, -2061, 2560, 228, -536, 223, -4788, -4382, -4381, -552, 840, -2420, 4592, 476, 4125, -1631,
+  -2288, -2301, 2178, 4114, 2595, 304, 644, 1428, -9823, 1722, 965, 4788, -3495, -5632, -3172, -4536,
+  -281, 1145, 2560, -7296, -268, 4014, -2926, 5008, -14154, -1104, -3640, 2662, 4305, 0, -4675, -5126,
+  -572, -3894, -3168, -1309, 692, -4560, -3542, 1666, -2717, 984, -772, 266, 2097, -2304, 8296, 5040,
+  -2810, -2290, -3520, 4788, -3216, -4237, -1596, 0, -8088, 9108, 5320, -5808, 13489, -6902, 1100, 466,
+  -5148, -354, -1980, 561, -2249, -3648, -2898, -2618, -5016, -3690, -1351, 266, 4194, -1024, -732, -252,
+  1405, -4580, 1280, -2964, 536, -3345, -2394, 1878, -1348, -276, -8960, -4356, -1435, 238, 4400, 1631,
+  572, 885, 1980, -374, 2249, 6384, 322, 4522, -3344, -1968, 0, 1862, -699, 1024, 1220, -4284,
+  -2810, -458, -2560, 2052, -2144, -2007, -10640, 939, -6066, 3036, 3360, 1694, 3444, -3332, -3025, -3728,
+  -2002, -4071, -1584, -561, 346, 304, -1932, -714, -3135, 0, -1930, 266, 2097, -1536, 3904, 252,
+  -2248, -1374, 3520, -2736, -5092, -2007, -1330, -1252, -3033, 4140, 840, -5082, 8897, -952, -1925, -233,
+  -1716, 0, -1980, -1122, 519, -608, -1288, -2618, -2299, -1476, 0, -798, 1398, 1792, -1220, 252,
+  2529, -4351, -3840, -228, 1876, -446, -2394, -2504, 1011, 4692, -6720, -968, -574, -4046, -2200, 1398,
+  -1716, -3540, 396, 1309, -5017, -4560, -322, -2142, -5643, 2460, -2895, 5320, -1631, 1280, 1464, 1260,
+  0, 5267, -1280, 2052, -1608, -3122, -4256, 1878, 3033, 276, -6720, 6050, -6027, -4998, 2475, -1398,
+  8008, 1416, -5544, -935, -1384, 2432, 0, -9520, -2299, 246, 1930, 0, -4427, 7424, 3660, -252,
+  -1967, 2290, 6080, 2736, 536, -4460, 2128, 6260, -3707, 7176, -2520, 484, -861, -5712, 7425, 3029,
+  -3146, 531, 594, -2618, -3287, -912, -1771, -8568, -2508, -3444, 3088, -266, -5126, -768, -2440, -6300,
+  2810, 1145, 0, -456, 3484, 3345, 2926, 4382, 6740, 552, -3640, 0, 1435, -5236, -1925, 2097,
+  286, 531, -1584, 748, 1557, 6992, -3059, 952, -2090, 738, -579, 2394, 1398, -512, -1220, -756,
+  -3653, 3435, -3840, -228, -1608, -2676, 0, 626, -5392, -4968, -1680, -2420, -7462, 238, 1100, 233,
+  2288, 2655, 2970, -561, 3114, -912, -2093, -476, 1672, -3444, 193, 2394, -5592, -2048, -5368, -252,
+  -3653, -1145, -1920, -5244, -2680, -223, 5852, -3443, 4044, -3864, -8120, 7018, -4018, 5950, -1375, -3728,
+  572, 1239, 990, -1309, -692, 4256, -1771, -952, 836, 3444, 772, -1596, -466, -5376, -9028, 4032,
+  -1124, -2290, 1920, -5244, -1340, -446, -1064, -3756, 3033, -552, -2800, -726, 2009, 1666, -3850, 699,
+  3146, 0, -792, 187, 173, 304, -2254, 1666, -1463, 1722, -193, -798, -2097, -2304, -4636, 1764,
+  3091, 916, -2240, -2280, -3484, 223, -2660, 313, -1685, 2208, -4200, -242, 574, 1904, -6050, -1631,
+  -5720, -1947, -3564, -748, -865, -4256, 483, 714, -2508, 492, -772, -532, -466, -256, 0, -5292,
+  -1405, -1832, -3200, -1596, 2412, -223, 2394, -1878, 0, -1380, -840, -7260, -1435, 952, -550, -233,
+  -5148, -2832, -1980, 935, -1384, -2736, 644, 1904, -627, -1476, 1544, -1330, -466, 2304, -1464, -5796,
+  3653, -1145, -4480, -228, 6432, -2230, -532, 1252, 674, -1380, 3360, -2420, 0, 1190, 2200, -3029,
+  -5720, -3186, -990, 748, -1384, -7296, 1449, -3094, 418, -984, -386, 1064, -4893, 5376, -488, -504,
+  1124, 1374, -320, 1824, 1876, 1338, 5586, -2817, 0, 276, 560, -2904, 2870, -1190, 4400, -932,
+  3146, 531, 594, 2057, 0, 912, 2254, -476, 1463, -5412, -4632, 2394, -3961, 4864, -5856, -1512,
+  -1686, 458, -7360, -1140, -3216, -1115, -266, -313, -1685, -8556, 1680, 968, -2583, 2142, 275, -4893,
+  6292, -1062, 0, -187, 2422, 1216, 805, 1190, 209, 1722, 1351, 532, 2097, 1280, -2196, 252,
+  281, 1145, 1280, 684, -1340, -446, -3192, 1565, 5729, 828, 5880, 3146, 1148, 714, 3025, -5825,
+  -2574, -1947, -1980, 561, -3114, -5472, -483, -4522, -627, 246, -2509, 1064, -2330, -7936, -2196, 1512,
+  -1686, -2519, 4800, 2736, -1876, -446, -1064, -939, 4718, -2484, -1120, -242, -4592, 2856, -4950, -3495,
+  -1430, -1239, -3168, -2244, 0, -2128, -2415, 6188, -6897, 1722, -3281, 266, 1165, -2816, -4392, -5040,
+  -5620, -6412, -11200, -4560, -4288, -6244, -8246, -1878, 1348, -3036, -1960, -3872, -10045, 4760, -825, -3961,
+  3432, 354, -3564, -2244, -865, 4864, -1932, -1428, 209, 3690, -1351, -5054, 1864, 768, 1952, 1764,
+  -6463, 1603, -640, -1596, -1608, -446, -532, 7825, -1685, -828, 840, -3388, 287, -4284, 825, 7922,
+  -1430, -1770, 1782, -561, 692, 6080, -2254, -952, 1463, -1722, 3667, -532, -233, 2048, -2928, 1764,
+  1405, -5038, 3520, -1596, 2144, -2007, 532, -4695, 674, 276, 560, 2662, 2583, -6188, -2750, 2330,
+  1716, -2301, -4158, 935, -3460, 6992, 1449, -714, 2926, 2214, -1930, 1862, -699, -768, 3172, -252,
+  -2529, 687, 3520, 1824, 3216, -7359, -6384, 4695, 337, -1104, -1400, -3388, -8897, 0, 275, -699,
+  -5434, -3186, -792, 2431, -2595, -2128, -644, -1190, 2090, 2214, -1737, 3192, -2796, 4352, -1220, -252,
+  -1405, 687, -1920, -5016, 1072, -2899, 1064, -626, 7751, -2208, -1680, 5808, -3731, 1666, -2475, 2563,
+  1716, 2301, -2772, -3179, 4152, -1520, -5313, 714, -1254, -738, 2316, -3724, -3728, 2560, -1952, -2268,
+  1967, -2977, 1920, -3192, 268, 0, 798, 2817, -1011, 2760, 840, -3872, -1435, -1666, -1650, 466,
+  -7150, -1416, 1584, 374, -3460, -3040, 0, 2380, 209, 738, -2509, -2394, -233, -1792, 2440, 2520,
+  1967, -3206, -14080, 1596, -1876, 669, 266, 5947, -674, -1380, 2240, 3630, 1435, 2618, -1925, -1398,
+  286, 1593, -1386, 1870, -346, 2432, 2415, -6902, -2508, -1230, 6176, -2926, -1864, 0, 3904, -1008,
+  -562, 4809, 3840, 6612, 2948, 223, -266, 2817, -7751, 276, 2240, 1452, 2009, -6426, 825, -3495,
+  -4576, -177, -1782, -2244, -346, -1216, -2576, -2142, 1672, 3444, 579, 798, -1398, 2560, -976, 2772,
+  -1967, -3893, 3840, 5928, 1876, -1784, -1862, -3756, 2696, 552, -1960, -1452, 2009, -2142, 2750, 1165,
+  572, 1416, 2376, 1496, 2076, -1824, -2737, 1190, -4180, 0, 4246, 532, -1864, -1536, -7564, -10584,
+  -4215, 2290, -1280, -4560, 2144, -3122, 2394, -9390, -3033, -276, 3360, -484, -1722, 4998, -275, -3262,
+  -6578, 354, 1386, 2618, 0, -6080, 966, 952, 3553, 984, -2123, -2128, -1864, -3328, -2684, 6552,
+  -2248, -7099, -5120, -684, -1340, -892, 0, -4382, 1348, -6900, 3360, 2420, -5453, 5950, -1925, -6058,
+  -8580, -2832, -2376, -1122, 865, 3952, -1771, -3808, 1254, -1722, -3474, -1862, 3262, 2048, -1952, 4536,
+  2248, 1145, -3200, -456, -268, 2899, 0, 1565, 1348, -1380, -1120, 1452, -5166, -4284, -550, 1398,
+  2002, -2478, -1584, 2805, -4152, 912, 0, -238, -3344, 3198, -772, 266, 3262, -2304, 1220, 1512,
+  6463, 3664, 640, 228, 536, -2007, -5054, 4382, -337, 0, -8120, -4114, -5453, 2142, 1375, -1864,
+  -1716, -354, -198, 0, 692, 3344, -966, -1904, -6688, 738, -965, -3192, -1165, -1792, 4148, -1512,
+  3653, 2290, 3200, 0, 5896, -1115, 1064, 2504, -1348, 828, -5040, -2662, -1435, -952, 5775, 2796,
+  3718, 1593, 1782, -5423, 519, 9424, 161, -238, -209, 738, 2895, -5586, -4660, 512, 1464, -1008,
+  -3091, 1374, 4160, 1596, 0, -669, 2660, -4069, -2022, -3588, 0, 484, -861, 476, 3025, 3029,
+  1144, 354, -792, -187, -346, -608, 483, -2142, -836, -1722, 1158, 3990, -1398, -4864, -4148, -3024,
+  -1405, -687, -3200, -4104, -4020, 2676, 3724, 1565, 2022, 0, 1120, -2178, 574, 2856, 0, -1864,
+  3718, 708, 990, 561, -1557, 304, -483, 2856, 1881, -1968, 1351, -1064, -4893, -512, -976, -756,
+  -562, -2977, 960, 228, -3484, -1784, -266, -2504, 7751, -1932, -1680, 1452, -1435, 2142, -550, -1631,
+  -5148, -4779, -4356, -561, -6574, 608, 0, 1190, 1254, 3444, -4825, 1064, 3961, -1024, 1952, 6048,
+  281, -1145, -1600, -1596, -2680, -6021, -6384, 313, 1348, -276, -840, 1694, -2583, -4522, 5225, -2796,
+  -572, 3009, -396, -5797, -2595, 3344, 644, -3332, -12958, -1476, 7334, -4522, 1631, -1280, -3416, -11340,
+  3372, -458, 4160, -2052, 1608, 4237, -798, 313, -674, 8556, -4760, -6534, 8036, -5712, -4125, 3495,
+  -3432, -4425, -2574, -1122, -692, -1520, 805, 3570, -6270, -984, 1158, 1862, -699, -1536, 1708, -10080,
+  1405, 2519, -7680, -2508, 2412, -2453, 1862, 3130, 2359, -828, -1680, -2662, 4305, -714, 825, 699,
+  858, -1770, 594, 3179, 2941, 2432, -2093, -3570, -1045, -984, -1351, 798, -9553, 2304, 1952, 1764,
+  281, 1145, -1920, 0, -1072, -5129, -266, -7825, -4044, 1380, -2520, 2420, 287, 2142, -2750, 466,
+  -858, -3540, -4752, -1309, -3806, -5776, -1610, -1190, -836, -246, -1930, 3724, -466, 0, 1464, 2772,
+  1124, -7099, 1920, 0, -268, 892, -798, -2504, -7751, 1380, -2240, -4114, 0, 0, -3025, -4660,
+  2574, 531, -5544, -935, -173, 3648, 161, 1190, -5016, 1968, 3088, -3724, -5359, 2816, 3660, -4788,
+  2248, 2748, -320, -456, 268, -4683, -266, 1565, -4381, -3036, -1400, -4598, -2870, -1428, 2200, 1864,
+  -2288, -3186, -396, 2805, -3114, -1824, 966, -2856, 1672, 4182, -4053, 1862, -3728, 1792, -2440, 4536,
+  6463, -687, -640, -684, 804, -2007, 532, -313, 0, -552, -2520, 4840, -3157, -2856, -550, -2097,
+  -286, -1593, -3564, 1309, -346, -1216, 1932, -5712, -418, -1722, -193, -1064, -699, 1792, 1708, -1764,
+  843, -229, 2240, -684, 1072, 2007, 1064, 939, 674, 1380, 5600, -484, 3731, 952, -2475, -233,
+  -858, 0, -3366, -374, -346, -3648, -1127, 2856, 2926, 2952, 386, -2128, 2330, 512, -488, 2016,
+  2810, -916, 2240, 456, -1340, -669, -532, -1252, 0, -3312, 3640, -242, 5453, 1904, 5775, 1398,
+  -572, 177, 990, 748, 1730, 4256, -161, 3094, 627, 3444, -193, 1596, -2097, -512, -3660, -4536,
+  -1967, -458, -7040, -5700, -1072, 446, 1596, -9077, 2696, -1380, -4760, -4840, -2296, 476, -550, 2330,
+  -9152, -7434, 4752, 2057, 1038, -5776, 966, 5474, 1463, -2214, -7913, 266, -5825, -5120, -3172, 7560,
+  -1967, -11221, -13120, -5244, -1608, -5352, -2926, -7512, 5392, -828, -2520, 2420, -4018, 4998, -3575, -2330,
+  -4290, -7257, -1386, 3553, -5536, -7904, 805, -714, 1672, -246, -5983, -266, -6757, -4352, 3172, 1008,
+  0, -2061, 320, 912, -2412, -7582, -9044, 5634, 2022, -828, 4200, 726, 1435, 476, -275, -9320,
+  -1430, -2478, 0, 561, -1903, 2128, 1288, -2380, -6270, -4182, 193, -1330, -1398, 3328, -1708, 756,
+  281, 3664, -5440, 2280, -1608, -2007, 266, 3130, 0, 4140, -1960, -4840, 287, -2856, 1375, -466,
+  4576, 1770, -990, -3740, 2768, -1824, 1288, -952, -5643, 1722, 772, 2394, 932, 2048, 732, -7560,
+  -4215, 2061, -640, 1596, -2680, 0, 0, 1565, -1685, 3036, 280, -484, 3157, 1190, 550, 0,
+  858, -885, 594, -1683, 1557, 2736, 161, 2618, -3971, -492, 2895, -266, 0, -1792, -976, -1260,
+  -1405, 916, -960, 684, -268, -4237, 0, 1878, -5055, 828, -840, 484, 1148, 952, -1100, 2097,
+  -1430, -2301, -1584, -1496, 173, -4864, -1771, 0, 1672, -2214, -1544, -2926, -2097, -256, 3660, 0,
+  5339, 1603, -3200, 1824, 1608, 669, 6650, -6573, 3033, -5244, 4480, 484, 1722, -1666, -825, 1631,
+  -3718, -1416, 3564, -935, 1211, 304, -3059, 1428, -2508, -1968, 1930, -3724, -3262, -7680, -5856, -756,
+  1124, 687, 2560, 1368, -804, 669, 3724, -7825, -2696, 276, -5600, 3630, 1722, 4284, 2475, 0,
+  572, -4779, 396, 1683, -346, 912, -1771, -476, 4180, 2214, -1737, 2926, -1864, 0, 2196, 4032,
+  1124, -916, 0, 4332, 268, -1784, -2926, 1878, -7414, -8280, 7840, 2904, -2870, -1904, -1650, -7456,
+  -4862, -2124, 1188, 187, -1038, -1520, -3059, 1666, 0, 0, -386, 1064, 1165, -2048, -976, -2268,
+  3091, -687, -4480, -912, -268, -1784, -1596, -4382, 1685, 1656, 3360, -2420, 1148, 476, 9350, 3262,
+  1430, -2124, -5346, -5049, -2422, -304, -2254, -4998, -4389, 2214, -386, -3458, 932, 2816, 3904, -1008,
+  1124, -229, 1280, 1596, -8844, -1561, -5852, 1565, -2696, -828, -560, -4840, 1435, -2856, 275, 233,
+  -2860, -1062, 1386, -6171, 1730, 0, -4025, -952, -5643, 246, 2123, -1330, -699, 2304, -1220, -5292,
+  -3372, -4580, -960, -3420, -2144, 2676, 5852, 1878, -337, 1380, -4760, 968, 1435, 476, -3300, 6990,
+  -3718, 177, 198, 935, 1384, 1520, 322, -3570, -2717, -5904, 386, 1064, -1165, 1792, -732, -3276,
+  281, -2748, 320, -2508, -4824, 2007, 4256, 6573, 337, 1104, -560, 1210, 1148, 2380, -1100, 466,
+  -572, -1593, 990, 1496, 692, 1824, 966, 4522, 2926, -246, -1351, -2660, -4194, 768, -3660, 4788,
+  -7025, -3435, -3520, 1596, -4288, -1784, -5320, 2504, -3370, -7728, -4200, 484, -8897, 238, 6050, -4194,
+  -4576, -5310, -396, 2057, -2768, 304, 2576, 3570, 1254, -3198, 1351, -3458, -6524, -3840, -2440, 3276,
+  2810, -2519, -960, -3648, -2412, 1338, -2394, -2817, 4718, 3312, -1680, 1452, 1722, 3094, -4400, -4427,
+  5148, -2301, -990, 561, -5017, -1216, -3703, -1428, -209, -492, -3667, 2128, -932, 768, 4392, 504,
+  2810, 916, 2880, 228, -9112, -2007, -798, 5008, 337, 1656, 280, -726, 574, -952, -6325, -6291,
+  5148, 2301, -792, -1683, 2249, 1216, -2093, -1190, -209, -6396, 579, -1064, -2563, 7168, 3172, 252,
+  -6182, -2290, -4480, 228, -6432, 1561, 1862, 1878, -6740, -6072, 840, 3388, 0, -2380, 10175, 1165,
+  8294, 2124, -792, 2244, -173, 5168, 644, 3094, -627, -5166, 2123, 1862, -2330, 5888, -1220, 1512,
+  -2529, -3435, -7360, -228, -2948, 3345, 532, 4382, -6066, -4968, 0, 2904, -1435, -2618, 4400, -2330,
+  3718, -1062, 1584, -748, 2076, 4256, -2093, -3808, 2299, -1230, -1930, -1862, 2796, 1792, 1464, -1512,
+  2529, 1145, -3200, -228, -268, 1561, 4788, 3130, -337, -276, -3080, 6050, 3444, 952, 5225, 699,
+  5720, -708, -1782, -748, 519, -3648, -644, -2618, 418, -1722, -1544, 532, -466, 3072, 2928, 3780,
+  1967, -916, 2560, 2736, -2680, 1115, 3990, 8451, 0, -8004, -1680, 1452, -1722, -1190, -825, 0,
+  4862, -354, 594, -2805, -1557, -2736, 161, -2618, -627, -5166, -1930, -532, -2563, 1792, -2440, -3528,
+  562, -1145, -7680, 6384, 536, -1338, 6384, 1252, 3370, -3036, 1120, 726, 6027, -1428, 3850, -3029,
+  -1716, 2124, 1386, 2618, 1211, 304, -2093, 2856, 3135, 1968, -3860, -2394, 699, -3584, 976, 6552,
+  562, -5496, -9600, 456, -4020, -3122, 2926, -6886, -3370, -2484, 5040, -484, -3157, 1428, -4125, -3728,
+  858, 4425, 594, -1122, 2768, 2736, -322, 1190, 2508, -6150, 772, -5320, 233, 512, -976, 252,
+  -1967, -1832, -4480, 3192, -1608, 3122, 5320, -8138, -2696, -828, -280, 2178, 5740, -238, 4675, 932,
+  -286, 4071, 0, 374, 1038, 1520, -483, 1428, -1463, -3198, 0, -2394, -1864, 0, 244, -3024,
+  -1124, -2977, -5120, 684, 3216, 2899, 7182, 939, -1348, -4416, 2800, 726, 4018, 1428, 9900, 233,
+  -6006, -2832, -792, -1122, -865, -912, -4991, -3570, 0, -2952, -1158, 266, 466, 2048, -976, 3276,
+  1686, -1145, 320, 1140, -2680, 2453, -4788, -4695, 3707, 3036, 4200, -968, -287, 476, -3850, 932,
+  -4576, 1239, -3168, -2618, -1903, 1216, -2576, -2618, -2299, 1230, 193, -1862, 1398, 256, -976, -2772,
+  2529, -4122, -3840, -1140, -3752, 5129, 1596, 5947, 1685, -3864, -840, 1210, -574, -476, -1925, 2330,
+  -858, -531, -792, -935, -1038, -304, -161, 952, 0, 738, -2509, 798, -466, -4096, -488, 504,
+  -2248, -687, -2240, -2736, -2412, 1784, 1064, -939, -1685, -4968, 280, -968, -574, 714, -1650, 466,
+  -1716, 1770, -2178, -2992, -3633, -5472, -2737, -10472, 1672, -9102, -5790, 2394, 3728, 0, -4392, -1764,
+  -9554, -4351, -3200, -3192, -7772, 2230, -7182, -626, -2696, 828, 2800, -6776, -5166, -2618, 825, -1398,
+  -572, 3717, -396, 0, 1038, 2128, -483, 6426, 1881, 0, -5790, -6916, -3029, -2560, -488, 4284,
+  -7306, -9847, -2560, -5016, -7236, 446, -1596, 2817, 8762, -2760, -1120, 484, -5166, 1666, 0, -4427,
+  2860, -3186, -594, -2431, -3460, -2736, -3864, -7616, -3135, 0, 2509, -4522, -3728, -768, 3172, -2520,
+  -5339, 1832, 3840, 1368, -1608, -2899, -1330, 626, 337, 5520, 3080, 242, 5453, -3570, -2750, -2097,
+  -4004, 2478, 198, 1309, -692, -2432, -1771, -238, -1672, 0, -3088, 4788, -2796, -256, 732, 504,
+  -3372, -229, 3200, -2052, -6432, -1561, -3990, 4382, -4044, 3864, -1960, 726, -287, -476, 825, -2330,
+  286, 1770, -2178, 374, -2941, 1824, -483, 1904, -4598, -2952, 2509, 0, -233, 3328, 732, -7308,
+  2810, 687, -2240, -1140, -6700, 3122, -2394, -626, -7751, 4968, -1400, -2662, 5453, -1428, 4125, -233,
+  -2002, -531, 990, -1122, -692, -6384, -1610, 2856, 2090, -1230, 386, 1330, -932, -768, -1708, 3780,
+  281, -5725, -6720, 228, -2948, 892, 1064, -1878, 7751, -1380, -4480, 726, 0, 714, -4675, -1631,
+  -1716, 2832, 0, 374, 346, -3040, -1771, 1190, 1463, -2460, 1930, -4256, -2330, -3328, -244, -1260,
+  -1967, -458, 5440, -1368, 1876, -3345, 2926, -4069, 2696, -1656, -840, -2420, 3157, 3808, -1375, -1631,
+  -4576, -1593, 1980, -2244, 1384, -3344, 1932, 4760, 627, -3444, 3281, -7448, -1398, 1792, -976, -1008,
+  0, -4580, -4800, 456, 1340, 0, 0, -2504, -2696, -4416, 6160, -1936, -2583, 3332, 825, 2330,
+  -1430, -2124, 1980, -561, 3979, -1216, 805, 7140, -418, 738, 1544, -4256, -2563, -1024, -3416, 1008,
+  -562, -2061, -2560, -1140, 2412, -1338, 1330, -4695, 1348, -1932, 5880, -1694, 4879, 2380, -1100, -2097,
+  -572, -2655, 792, 1122, -2076, -3952, -805, -238, -418, -2214, -1158, -266, -6058, -4096, 2928, -3024,
+  6182, -5038, -6720, 1824, 2680, -1115, -266, 4069, -2359, -4416, 560, -726, 287, -476, -7425, -233,
+  -2574, -7965, -6138, 2057, -5709, -6688, 1127, -714, -1881, -4428, -1351, -2128, -1864, 2560, 7808, -2772,
+  -6182, 2290, -3520, 6840, -536, -2230, -3192, 6260, -4381, 552, 5040, -5082, 287, 2856, 0, -2796,
+  3718, -5664, -9306, 3366, -8304, -3344, 1449, -8330, -2508, -1230, 193, 266, -4660, 1536, 5612, -5292,
+  2248, 5725, -1920, 3648, 1876, -223, -4256, 6573, 2359, -2484, 1120, -4114, -1435, -3332, 1375, -3029,
+  -4004, -1416, -2970, -748, -2249, 4256, 322, -238, -1672, 246, -193, 798, 0, -768, 1464, -2016,
+  281, 3435, 2240, 228, 2412, -892, -1064, -1252, 1011, 1104, -4760, -2904, -4879, -4522, -550, 1165,
+  -2574, 1593, -6336, 187, -1903, -6384, -1610, -4284, -2926, -3198, -1930, -2128, -3961, 0, -1952, -7308,
+  -1405, 458, 1600, -2508, 804, -2676, -2660, -939, -1011, 3864, -280, -3872, 1148, -476, 0, -2097,
+  1716, 1062, 792, -1683, 2768, -1824, -483, 2142, -5016, -738, 386, -6650, 466, -1280, -488, -3528,
+  -1967, -5267, -5760, -4104, 0, -4014, -2128, -939, -2022, 1104, -1120, 5566, -1148, 2618, -550, -466,
+  -858, 2832, -2178, -3740, -173, 912, -1932, 952, 209, 1722, 0, -532, 4427, 2048, 1220, -1008,
+  -3091, -458, 640, 912, -2680, -892, 0, 2504, -5055, -1104, 0, -3630, -1722, 1190, 7700, 699,
+  3718, 1239, 5346, -4488, 2249, 6992, -3542, 2856, -2508, -738, 4053, -11704, 1165, -1024, -1708, 504,
+  281, -458, 7680, -6840, -2144, -1784, -1596, -2817, -7077, 0, 0, 2420, 6027, 3570, 1100, 1398,
+  -2002, -885, -594, -935, -865, -912, -3059, 1190, 0, 1230, -386, 3724, 1165, -1024, -488, -504,
+  1124, 2061, -4160, -1596, -1072, -223, 2660, 2504, 3707, 1932, -2800, 2662, 2870, -2380, 4950, 3961,
+  -2002, -708, -1782, -2057, -1384, 4560, -3703, -2618, 836, 3198, -1158, -3990, -1631, 768, -1952, 3528,
+  562, -1374, 3520, 0, 268, 446, -532, -3443, 2359, 3864, -2520, -242, -1148, 2142, 275, 233,
+  -16588, -3363, -2178, 748, -6574, -13376, 2737, -5236, -627, -7626, -3088, 6118, -6990, -1792, -1464, 252,
+  10116, -6183, -7680, -10032, -804, 4906, 0, 5947, 3033, 1656, 3360, 3146, -4879, 714, -11825, -4427,
+  -1144, -3717, -2970, 0, 346, 1824, -1127, 3332, 627, 4428, -1544, -2128, -3495, 1024, -976, 0,
+  -4215, 1145, 4160, -2280, -4824, -7805, -5852, -5321, -1685, -1932, -1400, -2178, -287, 5950, -1375, -7223,
+  -2860, -1062, -792, -1870, -2595, -4864, -1288, -2380, -1045, -3444, -579, 6650, 932, 3072, -2440, -1260,
+  -562, 3435, -2560, 0, -268, 1561, 3724, -313, -5392, 2760, -2240, -1694, -1722, -952, 825, -699,
+  2288, 0, -2574, -561, 0, -2432, 0, -1190, -1881, 2214, -965, 532, -1165, -1024, 976, -1260,
+  -3372, -5725, -1280, -2280, -268, 1784, -3724, 4695, -1685, -4140, 0, -968, -3157, 952, -3025, -233,
+  858, -4248, -2574, 935, -3114, -1520, 0, 1904, -1254, -492, -965, 798, -466, 2304, 1708, -1512,
+  -562, 1832, -3840, 1368, -1072, -892, -4522, 4382, -7414, 552, -3920, -1694, 1148, -1428, 2475, 1398,
+  -9724, -5133, -5148, 1309, -865, -912, -1127, 1428, 1045, 1968, -2509, -266, -3029, -4608, 0, -2520,
+  7025, -458, -960, 2736, 4288, -1338, 532, -2817, 337, -3312, 1400, -968, -1148, -2142, 3575, 0,
+  -3146, -6903, -4356, 935, -8477, -1216, -3059, -4522, -1463, -5166, 1351, 6118, -3262, -4608, -244, -3780,
+  1405, 1832, 3520, 4104, 6164, 2230, 798, -939, -1011, 3864, 1120, -4114, -574, -6426, -550, -6291,
+  1430, 531, 0, -935, 1384, 4256, 1610, 2856, -1672, -246, 386, -532, -3262, -3584, -1952, -1260,
+  -2810, 229, 0, -1824, -6700, -1338, -6650, 3756, -2359, -828, 1400, -6292, 2009, 6188, -5500, -2097,
+  4004, 1062, -1782, -935, 1038, 5168, -1449, -4046, -4807, -4182, 386, 532, -3728, -256, -2684, -5544,
+  -1405, 5038, 3200, -3420, 1340, 223, 6118, 4069, 4718, -7728, -560, 1694, 1148, -1190, 3025, 233,
+  1144, 885, 396, 2431, 1038, 912, -2576, 1190, -1672, -492, 386, -1064, -9553, -2560, -244, -756,
+  3653, 3435, 8960, 0, 1608, 1561, 2660, 626, 4044, -1380, -7280, 2420, -861, 3332, -275, -3262,
+  -858, -177, -990, -2057, -692, 304, -1127, -5236, 627, -2460, 1544, -5320, 3495, -1024, 4392, 4032,
+  -3653, 458, 7680, 3876, 3752, -4906, 1330, 6573, -3033, 0, 1400, -5566, 0, -7378, -1650, 3961,
+  -3718, -1239, -1188, 935, 173, 1216, 161, 476, -4598, -2952, -2316, -2128, 1864, -1280, 1464, -2268,
+  -281, -4580, 1280, -456, 2412, 892, -1862, 4069, -8425, -6624, -2240, -1452, -1722, 2142, 1925, -2097,
+  572, -4248, 0, 187, -346, -3344, -1771, 4760, 836, 5904, -2895, -1330, -2330, -3072, 3416, -3528,
+  4215, -1145, 2560, -684, 1072, -2007, -1596, -626, 3707, -3036, -3640, 242, -2296, 0, -1375, -2796,
+  -6578, -2832, -1584, 561, -346, -912, -3542, -1428, -1254, 492, -772, -1596, 1864, 0, 1952, 3024,
+  -281, -687, 5440, 3876, 536, -2899, -2660, -2191, 1685, -1932, 1400, 484, 574, -476, 825, -2563,
+  -3718, 1416, -2574, -2805, 0, 4864, -1610, -1190, 1463, 246, 386, -5054, 1165, 1536, 488, -1764,
+  0, 229, 4480, -912, 4288, -3568, -532, -1252, 9099, 1104, -1960, 2178, -4018, -4046, 1650, 4660,
+  -5148, -531, -594, -187, -2249, 1520, -2576, 3094, -3762, -3198, -1544, -798, -4893, -2048, -2928, -4032,
+  562, -1832, -960, -3876, -1876, -669, -1064, -1252, 2696, 3312, 2240, 968, 4879, -238, 1375, -2330,
+  -286, -3363, 0, -3366, -692, -2432, -3864, 2142, 1045, -2460, 2509, -266, -2330, -5376, -1220, -1260,
+  2810, -2290, -2240, 912, 4824, -4906, -3458, -4382, 4718, 3036, 3080, 242, 574, -3570, -275, -2097,
+  -2288, -1770, 1980, 1496, -1384, -304, -3381, -3808, -2508, 3690, 2509, 1330, -1398, -1280, -244, -1764,
+  843, 0, 3200, 684, 3484, -1784, -1862, -6886, 3370, 276, -3640, 1452, 2296, -952, -1375, -5126,
+  -2574, 1593, -1386, -2992, -1903, -912, -2737, 2142, -1881, -246, 1930, -1862, -2330, -6912, -244, 1008,
+  -3653, -8702, -6080, -5472, 1876, -7805, -5586, 3130, 7077, 1380, -2240, -1694, 1148, 1904, -4950, -233,
+  -7150, -3186, 792, 0, -1384, -3344, 161, 4284, -2090, -1968, -3667, 266, -4427, -512, -488, -2016,
+  -843, -1603, -7680, -1596, 1608, -3345, 2394, -5634, 4718, 2484, -2240, 1694, 6888, -1666, 2750, -233,
+  -1144, 0, 792, -1309, -692, 1216, -483, -4998, 209, 1968, 772, 1862, -2796, 1536, -244, -504,
+  1124, -2061, -1600, 1824, 2948, -446, -798, -939, 4381, 6072, 3360, -726, -861, -4046, -2475, 2563,
+  -4862, -2655, -2574, -2618, -3287, 304, 322, -1904, 5852, 3690, 1158, -6916, 1631, -4608, 3904, 2268,
+  -2529, -2290, 2880, -1140, 804, -2899, 266, -626, 8425, -3864, -1680, -1936, -7462, -476, -5500, 932,
+  -8580, -4602, 2178, -1683, 865, 1824, -2415, 0, -6897, -246, 2895, 3724, -1398, -3072, -11224, -3024,
+  1967, 1374, -6720, -5472, -536, 1115, -1330, -7825, 5729, 7452, -5880, -2904, 4592, -2380, 1375, 932,
+  -1716, 885, 990, 2805, -1384, -2128, -1932, 476, -418, -738, -1158, 1330, -3728, -7936, -732, 756,
+  0, 2748, -6720, -456, -4288, -5352, -1596, 2191, -5392, 552, -1960, 1694, -4879, 2142, 825, -3029,
+  -572, 1593, -3366, -1870, -519, -3344, -1127, -2856, -418, -3936, -1158, -1596, -1398, 6400, 1952, -1764,
+  -843, 1374, 3200, 684, 2412, -2007, 5054, 1878, -3033, -2484, 1960, -726, -1148, -2856, 7150, 1631,
+  4862, 1947, 594, -1309, 692, 1824, -3703, -2618, -836, -6396, 579, 0, -2796, 2304, -488, -504,
+  -5339, -1374, 960, -1824, 268, 892, -266, 1878, -4044, 1656, -3640, 4598, 1148, -4998, -275, -233,
+  6578, 2301, -792, -4862, 1211, 1520, 966, 3808, -4180, 4674, 965, -4522, -1398, -1024, -4392, -4284,
+  -7025, -3206, -4480, -1140, -2948, -6690, 1862, -4069, 2696, 1656, -1120, -4840, -4018, 1666, -5500, 3495,
+  -6292, -3363, 2178, 0, 173, -5776, 966, -1904, 1881, -12546, -2509, 6650, 1165, 2048, -10004, -2520,
+  6182, -2748, -8320, -5700, -3216, 6467, -798, -313, -5055, -276, -1400, -242, -3444, 476, 3025, -3495,
+  572, 4425, 1782, 3179, 0, -1824, -966, 6426, 2299, 3444, -2123, -1064, 3495, -4096, -5124, 6804,
+  -5620, -2977, -3200, -4560, -9380, -6021, -2660, -626, -1348, -2760, -5880, 2904, -3731, 3094, -3300, -6291,
+  -1716, -1239, -198, -2431, -1903, -912, 805, -476, 418, -2214, 1158, -266, -3262, 1536, 3416, 3528,
+  4777, 1603, -5440, 2508, 5628, -2453, 5852, -3130, 10110, 1932, -3080, -5082, 1435, -3094, -2200, 3029,
+  -1430, -177, -396, -2244, -3460, -304, -1610, -3332, -2926, -1476, -1737, -5054, -2097, -768, -2928, -3024,
+  -843, 3206, 1280, 1596, -1608, -223, -6650, 2817, 3370, 1380, 1960, -1694, -861, -3808, -275, -5359,
+  4290, -531, 792, 1496, 0, 2128, 322, 1190, -5225, 6150, -386, -2926, -233, -1024, -1952, -1512,
+  1686, 1145, 2560, 228, -2144, -1338, -4522, 1565, -2359, 3036, -5040, 242, -1435, -2618, -1650, -932,
+  -3146, -3186, 990, 2805, 0, -912, 161, -714, 627, -3936, -2509, -1064, 699, -1792, -488, 1260,
+  6463, -229, 0, -228, -2948, 4906, -5320, 1878, -2022, -276, 3640, 2178, -3731, 1904, 275, -3728,
+  0, -2301, -2772, 0, -865, -1824, 1127, -9044, 2090, -6642, -3088, 2128, -6058, -1024, 1708, 6552,
+  -4496, 2290, -4160, 2964, -2680, 2676, -2660, 4069, 8425, 4140, -560, 2420, 3731, 2142, -1650, -6524,
+  2860, 1947, -1188, 3179, 0, 608, 1932, 1190, -1672, 2460, -1351, 2926, -7223, -1280, 1220, -1764,
+  -281, 916, 2560, 3192, -4288, -446, 2926, -939, 5392, -2760, -3640, 968, 1435, 2856, -4125, 2563,
+  -2574, 177, 2970, 935, 1384, 1824, 644, 3570, -3344, 2706, 2316, 0, -4427, 1536, -6588, 3024,
+  -843, -5725, -6400, -4332, -4288, -5575, -5320, 3443, -4381, 8004, -3360, 3872, 574, 952, 1925, -4893,
+  -4576, 177, -5346, -187, -4325, -5776, 966, -4284, 418, -9102, -1544, 8778, -5126, 1024, -244, -504,
+  843, 687, -1280, -912, 2144, -2007, 3458, -2504, 1011, -1380, -3640, -4598, -3444, -3332, 3575, -1631,
+  1430, 2301, 1386, 561, 3114, 912, 1449, 3570, 836, 3198, 193, -1596, -1165, -256, 1464, 1008,
+  -5620, 2061, 1600, -1596, -4020, -4460, 4522, 1565, 11121, -12144, -7000, -242, -5166, 5950, 1375, -1398,
+  -1716, -1593, -2178, 374, 1384, 912, 0, 1904, -2090, -1722, -772, 3192, 0, 256, -488, 1260,
+  -3091, 458, 2560, -1368, -3216, -1561, -2128, -626, 1348, 3864, -4200, -1210, 1435, 1666, -1100, -2796,
+  -4862, -3009, -792, -1309, -173, -2432, -966, -2856, -627, -3690, -386, 266, -4194, -4352, -2196, -6048,
+  -281, 687, 6080, -3192, -536, -4460, -1596, -11268, -337, 2208, -7560, 968, 574, -952, -3850, -1864,
+  -5720, -3009, -2970, -748, 2076, 2128, 322, 5474, -3762, 5904, 772, -1064, -2563, -768, -488, -504,
+  562, -4580, 960, 0, -2144, -2676, -2394, -313, -4718, -3312, -4760, 2178, -1435, -2142, -1925, 2330,
+  -4862, -708, -4554, 935, -3114, -6080, 1610, 2618, -1254, 738, -1737, 2394, -233, 768, 488, -756,
+  1686, 916, -5760, 1824, -2144, -4237, -3458, -626, -1685, -3864, 1680, -3630, -2296, -4522, 3575, -699,
+  -2002, -354, -4752, 187, -3114, -3040, 966, -7378, -2717, -3444, 1158, -2128, 1398, 3072, -976, 756,
+  -843, 1145, -1280, 2052, 1608, 4683, -2128, 626, -1685, 1104, 2800, -1694, -1722, -1428, 4400, 5592,
+  2860, 1416, -396, 1496, -1557, 1216, 322, 1666, 2090, 984, 579, -2394, -2330, 5632, -2928, -4284,
+  -1405, 1374, 1280, 1824, 2144, 1784, -798, 1565, -674, 2760, 1960, 242, 2870, 0, 2475, 0,
+  -9438, -3717, 2970, -561, 2249, -4256, -1127, 952, -5225, 246, -4439, 6384, -4427, 1536, -6100, 1260,
+  843, 916, -6400, -5928, 5628, -4460, -1862, -5321, 3033, 3312, -6160, 2662, 1722, -1666, -825, 2796,
+  -8866, -6195, -2574, 3366, -2768, -15504, 0, -1190, 418, 4182, -6948, -532, -2796, -1792, 976, 2772,
+  -1124, -4351, -960, 1368, 268, -2453, -5320, -4069, 2359, 828, -560, 3872, 2009, -6188, -3575, -6757,
+  -1716, 177, -2178, -2805, -3979, -912, 161, -476, 0, -4920, 193, 1064, -233, 3072, -2928, -2520,
+  2810, 0, -3840, -684, 0, 223, -2394, -626, 1348, 2760, 560, -1936, 5740, -2856, 2200, -2796,
+  -2288, -1947, -1584, -1309, 1384, -2736, 1288, -714, -2090, 2214, 579, 2660, 1165, -1536, -2440, -4032,
+  -5339, 687, 2240, -2508, 536, 2007, -798, 0, -4044, 2484, -3920, -2420, -1148, -476, -3300, -5359,
+  -9438, -885, 3564, -1870, 2422, -3040, -644, 3570, 627, 4428, -2123, 2394, -1864, -5120, -7076, 7308,
+  -2529, -10076, -6720, -7524, -5896, -1784, 1330, -14085, 3033, 1380, -4480, 4356, -1722, -238, -4675, 3262,
+  -1144, -1770, -1386, 935, 2249, -2736, -161, 4046, -1045, 3198, 386, 3192, -1631, -1536, -732, 1008,
+  -3091, -2519, -320, -2964, -1876, -2676, -4788, 0, -674, -1380, 840, -2420, 1722, -952, -3025, 2097,
+  -4290, -1062, -594, 1870, -2249, -2128, -805, -238, -3344, 0, 386, 3458, -3262, -768, 1708, -1008,
+  10116, 2061, -1600, -684, 3216, 1338, 6650, -5008, 5392, 0, -5320, -726, 1148, 1190, 1100, -1398,
+  4576, 177, 990, 1496, -173, -3040, -805, -238, -418, 738, 1351, 1064, -3029, -3072, 3416, 504,
+  -2529, 3893, 1920, 2280, -2144, -3345, -1330, -7825, -7414, -2760, 840, 2904, -1435, 476, 4400, -2563,
+  2288, 531, 1188, 187, 1211, 1520, -966, -238, 2717, 1722, 1158, -2128, -466, -5888, -2928, 5544,
+  -4496, -2290, 960, 912, 1876, 0, 1596, 0, 1685, 0, 2800, 3872, 5453, -2380, 1100, 0,
+  -1716, -2478, -198, -1309, 2076, 5776, 1127, -1428, -5016, -2214, 3860, 3458, 3262, -4096, 244, -5544,
+  1686, 687, -2560, 1596, 3752, 1115, 4256, -1252, 2359, 5796, 1680, -7986, 2009, 4046, 1375, -233,
+  2288, -1062, 1584, 935, 1557, 4560, -3381, 1428, 1254, 4674, -2702, -4522, 3728, -2048, 0, -756,
+  0, 0, 960, -1368, -1608, -2230, -2660, -6886, -5729, -5796, 840, 2904, -2870, 5236, 1925, 1864,
+  -2288, -354, 4158, -5423, 3287, -4560, -4991, 476, 1254, -2952, -579, -7714, 3961, -3072, -732, 504,
+  562, -1832, -3520, -3192, 268, 3791, 1330, -10016, 5729, -3036, 3080, -726, 4305, 2380, 5225, 932,
+  -7150, -4248, -3762, -2431, -5882, -9120, -2737, -2380, -4180, -6642, -1737, -3458, 3029, -3584, -244, -1008,
+  -4215, -229, -6400, -2964, -268, 2007, -798, 3443, 4718, 3036, -4200, -2904, -2583, -3808, -1925, -3262,
+  -286, -354, -1188, -1683, 0, 3040, -4508, -476, -6270, -2952, -4439, 3458, 0, 0, -3904, -7812,
+  -5058, 2290, -8000, 1596, -804, -2230, -1330, 3443, -4381, 3036, -2800, 2420, 574, -714, 275, 4660,
+  -5148, -2655, -1188, 1683, -173, -4864, -805, 3332, 2299, 1476, -5983, 1862, -2097, -2048, -732, 756,
+  4496, -229, -960, -228, -4824, -669, -1596, -2817, -1685, 3864, 1120, 2178, 287, -2380, -3575, -3728,
+  -7150, 177, 792, -4488, 692, 1824, -3542, -2142, -1045, -2460, -193, -1330, -466, -256, -7076, 1764,
+  -1405, 458, 1920, -5700, -2680, 892, 2128, -4695, 337, 0, -2520, 2904, 574, 2618, -1100, -1165,
+  4004, 531, -1386, -2992, 346, -3344, -4186, -952, 1672, 4674, -3281, -4256, 1165, 512, -1952, -756,
+  843, -4809, -320, -912, -4824, -4683, 1330, 939, -1011, -2208, -1120, -1452, -7462, -2142, 5775, 0,
+  -2002, 885, 1980, -5236, 0, 3040, -3220, 2618, 418, -492, 2895, -4522, -1398, 1536, -4880, 2520,
+  2529, -3664, -6080, -6384, -1340, -669, 1862, 626, 1685, 2208, 1120, 1694, 2870, -1190, -550, 2097,
+  0, -885, -2772, -1683, -3633, -608, 161, 238, 0, 0, 386, 0, 4427, 2560, 244, -756,
+  -7868, -4122, -7680, -1140, -2144, -8251, -4522, 4382, 674, 2760, 840, -3388, 574, -7378, -1650, 1864,
+  8294, 3540, 3960, -4488, 2422, 608, -5152, -2618, -9196, 1722, 1158, -5054, -6291, -2048, -3660, -2268,
+  -7306, 1374, 3840, -5016, -1340, -3568, 2926, -626, 4381, -6900, -8680, -484, 287, -1666, 3575, 4194,
+  0, -354, -990, -2057, 519, 608, -3059, 6188, -836, 2952, -386, 2394, 233, -2304, -3904, -504,
+  4215, -4351, -7040, -912, -1072, 2453, 0, -939, -4718, -1656, 560, -6292, 1148, 0, 275, -1631,
+  -1430, 354, -1980, -1496, -865, 3648, -3703, 1190, -3344, 0, 579, -4522, 1165, -3072, 1708, -504,
+  -843, -687, 5120, -2052, 5896, -4460, 3192, -5008, -1011, 1656, -3360, -242, 1148, -3094, 825, -2563,
+  -4004, -1947, 198, -1683, -2941, 304, -4508, 714, 418, -3690, 1544, 3990, -233, 2560, -1220, 252,
+  1124, -3206, -2240, 2280, 3484, -4237, -1064, -4695, 2359, -3864, -1400, 1210, 1148, -3094, 2750, 699,
+  1144, -2832, -2772, 748, 1384, 4256, -322, -1190, -2508, 5658, -386, 1596, -3728, 2560, 5612, -1512,
+  3653, 229, 5120, 2736, 2680, 2676, -1064, 3130, 0, -828, 1960, -2178, -574, -8806, 4675, -1631,
+  -3718, -5310, -2376, 2057, -6228, -608, -2415, -5712, -627, -246, -772, 798, 1165, -1024, 2684, 3024,
+  -1686, 2290, 5120, 4560, 804, -1561, -532, 1252, 5392, -1380, 3080, -1694, 4592, 1666, -2475, 466,
+  2288, 0, -2772, -748, -1211, 912, -805, 1666, -6897, 1476, 2895, -1330, -1631, -1280, 3904, -1764,
+  -1405, 2977, -3200, -2280, -4824, -1115, -2394, 6260, -337, -4140, -2520, -726, -12628, 1666, 275, -1631,
+  1716, 177, -792, -3740, 692, 3952, -1449, 1428, -1045, -6396, 1737, 798, 2097, 1280, -5124, -504,
+  -1967, 2519, -960, -6612, -2948, -446, -798, -3130, 2359, 3588, -1120, -242, 2296, -3332, 3300, 1165,
+  -4290, -3717, -396, 1496, -6747, -3040, 1127, -5236, -627, -6150, -965, 2660, 466, 3328, 4148, -504,
+  -1686, 1145, -7680, 3420, -804, 1115, -3192, 313, 5729, -1380, 1120, -2904, 1722, -10472, -550, -466,
+  4004, 885, -1188, 2992, 0, 7296, -1449, -476, -2717, 6150, -965, -3458, -1864, -3328, 4148, -3780,
+  -11240, -687, 5120, 2736, -2948, -3568, -266, 7199, 3370, -7176, -10080, -2904, -2583, -2142, 3575, 1165,
+  858, 1947, 1584, -1496, 1730, 1824, 161, -952, -1045, 246, 3667, -3724, -699, 1536, -488, 252,
+  1124, 2290, -6400, -2508, -6700, -669, -5852, -8138, 7414, -1380, -1400, -3146, 4879, 952, 275, -6058,
+  -5434, -2124, -198, 1870, -1903, -1520, -966, -4284, -627, -2214, 193, -1064, -1864, -1792, 1220, 1764,
+  -3934, -1832, -3200, -456, 1608, -4460, -5852, 2191, 1348, 4416, -3080, 4598, 4018, -6902, 825, -2330,
+  -1144, -1239, 0, 374, -1211, 3040, -2254, -2856, -6897, -3198, -579, -532, -932, -2048, -1952, -4284,
+  2529, -1374, -640, -2052, 1340, 0, 2128, 1878, -2696, 4416, -4200, -2420, 2870, -1428, -550, 2796,
+  0, -1947, -2574, -1496, -3287, 608, -644, 4760, -2717, 5166, 965, -2128, -1398, 1536, -244, 756,
+  -2810, -229, -2560, -1368, -1340, -5575, -5054, -313, 0, -1656, -2800, -4840, -6027, -3094, 4125, 1165,
+  -12012, -4602, 3564, 2992, 519, -5168, -1771, -2856, 1881, -7626, 1351, 5586, -466, 1024, 488, 2268,
+  -3934, -5496, -960, 4788, 1072, -2676, -4522, -1252, 2022, 2208, -2240, 968, 287, 476, -2200, -3029,
+  -7150, -885, -396, 3740, 1038, -912, 483, -2142, 2508, -1476, 0, 532, -1398, -4864, 3172, 1764,
+  3934, -1145, 3200, -912, 2948, 3345, 1064, 2191, -1011, -6348, -2520, 484, -3731, 1904, 1650, -1864,
+  -286, -3363, -2178, -187, -173, -1824, -2254, -1904, -4180, -2952, -386, 798, -932, -1536, 1952, -3276,
+  3372, 1374, 2880, -228, 3752, 1115, 3192, -7512, -7077, -6072, -1400, -1452, -1435, -3094, 3575, -1398,
+  1144, -531, 990, 1122, -346, -912, -2254, -476, -1881, 492, 1158, 3458, 2330, 512, -732, 252,
+  -2810, -2290, -1280, -5016, -4288, -2899, -1862, 1878, 1685, 552, 1960, -2420, -1435, 0, -4950, -233,
+  0, 2124, -990, -2244, 1211, 1824, 1127, 1666, 2717, -4182, 2702, -2128, 2097, 4352, -3172, 3024,
+  -7868, -1603, -6400, -3876, -4288, 2676, 2394, 1878, -4044, 1656, -560, -968, -3731, 714, -5775, 4194,
+  3718, 3363, -1980, -2805, 1211, 1216, 483, 1428, -418, 1722, 2123, -10374, 233, 4864, -6832, -3780,
+  -2810, 0, -3200, -3192, 536, 2453, 1862, 4382, -3370, -3588, 2240, -2420, -2296, 2856, -1100, 1398,
+  -858, -1062, -198, -187, -692, 2128, 644, 3094, -1463, 1230, -193, -2128, 1165, -768, -488, 3780,
+  -5058, -5725, -2880, 684, 1340, -1784, -1330, 939, -1348, 2760, -3080, 968, 2583, -238, -6600, -233,
+  -9438, 0, -1386, 561, -5017, -5168, 161, 0, 1672, -246, 1351, 532, 1631, 1792, 3904, 2520,
+  -6744, -3893, -2560, 6840, 4288, -3122, -5586, 7199, 1011, -1104, 3920, -2178, -7175, -1666, -1925, -466,
+  -4290, -3540, -6732, 2244, -7785, -4560, -161, 1428, -5852, -3936, -2316, -798, -4194, 5120, -2684, -2016,
+  -3934, -916, -5440, 2736, 5896, 2453, -266, 4695, -2022, 5796, 560, -5808, 1148, -2618, 1100, -466,
+  -8008, -2655, -1386, 187, 865, -7296, -1449, 1666, -1881, 1230, -2702, 1330, -3728, -3328, 488, -3528,
+  3653, -2061, -7360, -456, -3752, -1561, -2660, -1878, -2022, 0, 560, -1210, 1722, -238, -4125, -699,
+  -5434, -5487, -3564, 187, -519, -3344, -1449, 2142, 836, -246, -2316, 532, 466, -3328, 4392, -3276,
+  -5620, 1145, 1920, 228, 5092, -4014, -798, 1878, 337, -5520, 1960, 968, -8036, 4998, -3025, -1398,
+  -4004, -5664, 396, 561, -1384, -1216, -2415, -1428, -209, 984, -1544, 1862, -5592, -1792, 2196, -2016,
+  1967, -2061, -3840, 3648, 2948, 1115, -3458, 313, 3033, 552, 3360, 2178, 574, 714, -1375, -1165,
+  0, -354, -6732, -2992, -1384, 2736, -161, -238, -3762, 1230, 386, -1862, -2330, -1024, -1952, -2268,
+  -281, -2061, 640, -228, -7772, -4014, -2926, 626, 674, 2760, -3360, -5082, -574, 1666, -4400, 699,
+  -1430, 531, -1584, -3366, -519, 4560, -1932, 2380, -2508, 6150, 1351, -4256, -233, -768, 1952, -2520,
+  -1124, -3893, -2240, -4332, -3484, -5352, -1330, 1565, -2022, -828, -4200, 242, -4018, 1190, -1375, 2330,
+  858, 708, -4356, -7667, -865, -912, 0, 2618, 1672, 7134, 2895, -5852, -4427, 4864, -732, -2520,
+  8711, 0, 5120, -1140, 4288, 223, -798, 2191, 7414, -2484, 5600, -6050, 5740, 3808, 5775, 1864,
+  3432, 177, -6138, -374, -3979, 1520, 483, -1190, -836, 1722, 1158, -8512, -466, 2560, 1952, -3276,
+  -3934, 2519, -2240, 1596, -1340, 0, 2926, 2817, 2022, -6900, 1120, -1694, -3157, -4284, -1925, -466,
+  2002, 2301, -1584, -4301, 2076, 2432, -1449, 3332, -3344, -492, 4053, -2128, -4194, 2304, -3660, -6552,
+  -3091, -458, -1920, -2280, 2144, -5129, 1330, 5321, 3370, 5520, -5320, -2420, 0, -3808, -3025, 2097,
+  -2002, 1062, -1188, 748, -2768, -304, -3059, 714, 2299, 3690, 3281, 266, -2796, 7168, -732, -504,
+  4496, 0, -1920, -1596, 7504, -4237, 2660, -9703, 6403, 2484, -3920, 2420, 2009, -1904, 6050, 3029,
+  3432, 354, -2772, 374, 0, -1520, 0, -2380, 209, 0, -1544, 3458, -466, -3328, -2196, 756,
+  3934, 3206, 3200, -3192, 4824, -223, 4256, -4382, 0, -2484, 1400, 968, 7175, -714, 2475, -2330,
+  1430, 1239, -594, 3553, 3806, 608, 1288, -1904, 3762, -4428, -1737, 1862, -1398, 2048, -5856, -504,
+  -1405, 1832, 3520, -7296, -268, 2676, 3990, -1565, -4381, -1380, 5040, 1694, 2009, 3808, 3025, -2563,
+  -286, 0, -792, 1122, -1038, -1824, 0, -1428, 1463, 738, -2702, -1596, 3728, 2560, 1220, 2520,
+  -2810, 2061, -3200, 2508, -1876, 2899, -2128, -3130, -7077, -2760, 7000, -242, -574, -238, -3025, -1398,
+  -4576, -3009, 594, -1683, 346, -4256, -1932, -2142, 627, 1722, -579, 1596, 2097, 2304, 1220, 1764,
+  -843, -3664, -1920, 2280, 536, -4237, 4788, 626, 9099, -3864, 280, -3146, 2296, -3570, 275, 2796,
+  -5148, -1593, -2178, 3179, -2768, 608, 966, -6188, -4389, -2214, 2702, 5054, 233, -2048, -4392, -6804,
+  -1124, -458, -5440, -2736, -3484, 2899, -2394, 7512, -9773, -1380, -1960, 968, -2870, 952, -3025, -5359,
+  858, -1239, -5346, 1122, -2595, 1216, 966, 1666, -2090, -3690, -386, 5054, 3495, 6144, 2196, -1260,
+  -7306, 687, -8960, 0, -6432, -1338, -5054, 8451, -6740, 1380, -280, -3630, -4879, 952, 6325, 0,
+  -4862, -3363, 0, -3179, 1211, -608, 805, -1190, 1045, -5658, 772, -7448, -1631, 3072, -2196, -756,
+  5058, 229, -640, 1368, 2680, 223, 2660, -6260, 4718, -1656, 1680, 1694, 0, 3570, -275, -4660,
+  -3718, -4956, -2574, 1309, 3460, 5472, 2415, 1904, -209, -2460, -2509, 4522, -5592, 1536, -1708, 504,
+  3653, -6641, -3520, 2736, 4020, 1561, -1330, -2191, -674, 1656, -1680, -2662, -861, -3332, 2475, -3495,
+  -2574, -3363, -4158, 2431, -3460, -3344, 1932, -714, -1463, -2214, -1737, 0, -1398, 1280, 488, -1764,
+  8149, 3206, 1600, 1368, -3216, 669, -1862, -3130, -4381, 552, -4200, -2662, -4018, -2380, 5225, -1864,
+  3146, -1416, -396, 1122, 1038, 4560, -966, 4522, -3553, 246, 2316, 2128, -3262, -1024, 732, 504,
+  2248, -2519, -5440, -228, -1072, 2899, -2128, 2191, -1348, 3036, -560, -2178, 2870, -1190, -3850, -932,
+  -7722, -4602, -2970, 561, -3806, -3040, 322, -4998, 4598, -2952, -2509, -1064, 5359, -512, 3660, 3024,
+  562, 0, -2560, 6612, 8308, -5129, -3724, -1252, -8762, -3864, 0, 3630, -4018, -7854, 275, 233,
+  -3718, -4425, -3762, 748, 346, -1520, -1610, 2856, -836, -3444, -1544, 798, -4194, -3584, 1708, -252,
+  1967, 458, 0, 2736, 536, 1338, -6650, 3756, -337, -2484, 1120, -2420, -861, 2856, -4400, -3262,
+  2288, 1239, -2574, -4862, 2941, 2128, -805, -476, -1254, -246, -1158, 0, 3262, -3328, -3904, -756,
+  -562, -4580, -1280, -5700, -5896, 892, -4522, -1878, -8425, -3036, 0, -3872, -861, 2618, 275, 0,
+  -3432, 354, 4158, -3927, 865, 608, -5796, 2856, 1881, -492, -4632, -6384, -466, 2048, -3660, 0,
+  -4215, -10076, -3200, -2964, -4020, -2453, -1064, -5947, -4718, -8004, -2240, 2178, -2583, 3332, -2475, 233,
+  -4290, -2301, -4158, -4114, -2076, -3344, -3542, 1190, -1045, 1722, -6562, 1596, -932, 1280, -732, -1008,
+  5620, -5267, -3840, -1368, -536, 669, -3458, -313, -7751, 3864, -1680, 1694, 2870, -8092, 2475, 1864,
+  286, 1593, -1386, 1870, -3114, 2128, -483, -1190, 418, -738, 965, -3724, 4194, 256, -2196, -504,
+  -2248, 687, 0, -1596, -3216, -223, -1330, 3443, -674, 552, -1120, 0, -6314, -1428, 550, 4893,
+  -4290, -885, -990, 2244, -2422, 0, 1610, -5236, -2508, -6396, 0, 5586, 2796, -512, -2440, -1512,
+  -281, -687, 960, -1596, -1340, 4014, -4522, 1252, -5392, 1104, -3640, -2420, 287, -3570, -1100, 1864,
+  -2288, 1239, -198, 1496, 1557, 1824, -322, 4046, -1045, 1722, -193, 3192, -2563, -2048, -1952, -5292,
+  -1967, 2061, -320, -2736, -1340, -223, 1596, -4382, 1348, -2484, -1960, 726, -2296, 4046, -275, -1165,
+  3718, -885, -1188, -2431, -865, 1216, -322, 952, -1463, 1476, 1158, -532, -6291, 2560, -6344, -4284,
+  -1405, -1374, -960, -4332, -5360, -3568, -8246, 939, -2696, 2760, 0, 2662, -1435, -1904, 0, -2097,
+  -1430, -4248, -3366, 561, 346, -5776, 1288, 2618, 209, 3936, -3474, -3724, -3728, -768, 4880, -3024,
+  5901, 2977, 5120, -3192, 2948, -2007, -1596, -5634, -2696, -552, -1400, 4356, 1435, -3332, 4400, 1165,
+  4290, -354, -3762, -1309, -692, 0, -3059, -4760, 1045, 492, -579, 4256, 699, -1792, -1464, 2772,
+  -1405, -687, 6720, 5472, -3216, -1784, 532, -313, -1348, 3864, 280, 6534, 5453, -3570, 550, 2097,
+  -3146, 708, -594, -1496, 1903, 912, 3059, -238, -2090, -2952, -2123, -266, -2097, 2048, 1220, -5544,
+  843, -3893, -3520, -1368, 0, -4237, -798, 2504, -3033, -2760, -5040, -7744, 0, -1190, 5225, -2097,
+  1716, 1593, 792, -1496, 4671, 5168, -1610, 5474, -2717, 4674, 1930, -4522, 4427, 2816, 6100, -2268,
+  -9835, -2519, 6080, 1824, 1608, 892, -266, -3443, 6403, -3864, 3080, -484, -2583, 952, -3850, 4660,
+  -2574, 531, 2970, -2618, 2076, 608, -1610, 1904, 1672, 1476, 193, -2926, -1398, -1536, -4392, 5292,
+  5339, -916, 0, -3192, 268, 2453, 4256, -3756, 2359, 1656, -840, 6050, 574, 2142, 4125, -1165,
+  -2288, -4425, 1782, -374, 692, -2432, 0, -476, 2090, 1722, -4246, -532, -2330, 1536, -4880, -252,
+  843, -229, -5440, -456, -2680, 2230, -6384, 2504, 5392, -276, -1680, 5566, -1722, 3332, -3575, -233,
+  858, -1416, -1386, -374, -9342, -2432, 1288, -2142, 1463, 2952, 0, -1330, 466, -4352, 732, 2772,
+  2529, 0, -4800, 684, -5628, -446, 266, 3130, 0, 6072, -1400, -4598, 287, -5950, -7425, -1631,
+  858, -2301, -4158, -935, -692, -1520, -966, -1666, -2926, -1968, -2123, -4788, 3262, 3072, 2440, -7308,
+  2529, 0, -5120, 2508, -8576, -2230, -1862, -626, -1011, 2760, 2520, -7986, 6027, 0, 1375, 233,
+  -1144, 3717, 3366, -935, -173, 1824, -2093, -3570, -3762, 0, 1351, 1064, -1631, 768, 2196, 1512,
+  281, -1603, -1920, 1368, -5360, -892, -2128, 6260, 5729, 7176, 1960, 1694, 3444, 2618, -275, 699,
+  7150, 2655, -1584, -187, 346, 3648, 2576, -4046, 1672, -2214, -386, -7714, 3262, 3328, -2928, 2772,
+  -2810, -5038, 0, 456, -10452, 2453, 2394, 7825, -3370, -2208, 2800, -242, 287, -3570, 1375, 1398,
+  2574, 177, -1188, -5049, 346, -1824, -805, 3570, -2926, 2460, 1351, -4522, -6524, 1792, -5856, -252,
+  -1967, -2290, -9280, -5016, -6700, 223, 798, 5634, 1348, -276, -4760, -484, -287, 476, -825, -932,
+  -1716, 177, 792, -2057, -2076, 608, -161, -3332, 1254, -492, -772, -5054, 1398, -2048, 2928, 3024,
+  -3653, -3435, -4480, 2508, -804, -4460, 1064, 313, 1011, 4692, 8400, -4598, 3731, -952, 0, 2097,
+  -2574, -2832, 2574, -374, -3633, -3344, -2093, 2380, -1045, 246, 579, -1862, -7223, -1280, 732, 2268,
+  6182, -7328, -3200, 2736, -1340, 0, -5320, -626, -674, 3036, 3640, -484, 3157, 714, -2475, -1631,
+  -3432, -4602, -5940, 2244, -2941, -9424, 966, 4522, -5225, 1722, -1930, -3990, 466, 1280, 1220, -5544,
+  5339, -3893, -6400, 2280, 6432, 892, 266, 4695, 2696, -6900, 1960, -2420, 6314, -1904, 7150, -2563,
+  858, 354, -792, 1122, 1557, 3040, -322, -4046, 2299, -4182, 2509, 1596, -3029, 512, 1952, 504,
+  1967, 4351, 1280, 684, 4288, -446, 3192, -3443, 1685, -1380, 2800, 726, 287, -2142, 2750, 1864,
+  -858, -2655, 990, 935, -173, 1520, -322, 3094, 3344, -984, -4053, 1596, -3262, -2816, 1220, 6552,
+  3934, -1832, -1280, -684, -7504, 0, -3458, 626, -1011, 2484, 0, -1936, -6027, 238, 2475, -1864,
+  -3432, -1593, -3168, 374, -1384, -5168, -161, 1428, 209, 738, 772, -798, 1165, 1024, 3416, 0,
+  -2810, -4351, 0, 456, 2412, 0, -2926, 626, 3707, -7176, 280, -1936, 3444, 1428, 2475, -233,
+  4576, 1770, 1782, -3179, 1038, 8512, 0, -2142, -3971, -4920, 3667, -2394, 0, 2048, -2440, 2016,
+  -3372, -2061, 640, 1140, -2144, 1561, 0, -939, 1011, -276, -840, -4356, 1148, -4760, 4675, -1398,
+  -2288, 177, -1782, -1122, 1730, 3648, 966, -2380, -1045, -4182, 193, -2660, 3029, 1792, -2440, -6048,
+  -4496, 1603, -3840, -456, -1876, -1338, -3458, 2191, -6740, 3312, -2240, -6776, -10906, -1190, 7700, 3029,
+  -1716, 354, 792, -3366, -519, 1216, -2898, 238, -3344, -4428, 0, -1330, 2097, 256, -2684, -1260,
+  -1124, -458, -1280, 0, -804, 2453, 798, 1252, 4718, 2208, -4760, -1452, 861, -714, 2200, 2097,
+  -3718, -2124, 3168, 2992, 519, -5168, 3059, 476, 1672, -2706, -4246, -1596, 466, -6400, 244, 2016,
+  1124, -6183, -3520, -912, -4288, 2453, -6118, 3130, -2696, -3588, 4760, 0, 0, 5474, -4950, -10252,
+  -2002, -5487, -792, 3179, 1557, -5472, -644, 2618, -3762, -1476, -5983, 6650, -4427, -7680, -488, 2016,
+  -1405, -5267, -2240, -912, -8576, -4460, -4256, -2817, -8088, -1656, -5600, -484, -2009, 4998, -6050, -7223,
+  -6006, 354, 396, 935, 2422, -6992, -966, 2380, -3553, -738, -965, 1862, 466, 256, -244, -3024,
+  -1405, -4809, -3520, -2508, -3752, -2453, -7448, -1565, -3033, 1104, -5040, -1694, -2296, 238, -1100, -1864,
+  572, -354, -1980, -935, 519, 2432, -805, -4760, -836, -3198, 3088, -3458, -2796, 3328, 244, 0,
+  1405, -1603, 0, 684, -3484, 446, -266, 626, 5729, 3588, 560, -1694, 2870, -5950, 2475, 1165,
+  2288, 177, 1188, -1870, -3287, 1824, 2093, -1428, -418, -3690, 1351, -532, -6291, -2560, 1220, -3276,
+  2248, 1374, 2560, 2508, 1072, -4906, -3724, 5008, 674, 5244, -7000, -1694, -4305, -5712, -3300, -2097,
+  2574, 177, -3366, 1122, -2768, 608, -1771, -1904, -3971, 1230, -772, -798, -6058, -256, 1952, -4788,
+  2810, -1374, -960, -2508, 5360, -3122, -5054, 4382, 2022, -276, -4480, -242, -2296, 1904, 2750, -2097,
+  -2860, -6372, 594, 1309, -1038, -5776, -1127, 4284, -1254, 5412, -1737, 2394, -2563, -512, 1952, -1008,
+  5058, -458, 2880, 1824, 1876, 2230, 0, -7199, 3370, -1104, -2520, 1452, 2009, 714, -6325, 1165,
+  -286, -4602, -4554, 2618, -4671, -4560, 2576, -4522, -1463, -4674, -2702, 7182, -6990, 4608, 5856, -1260,
+  -3934, 229, 640, 4332, -2144, -446, -6650, 7199, -6066, 1380, -840, -968, 5166, -952, 4400, -7689,
+  858, -885, -3168, 1683, -519, -2128, -1610, -476, 1045, 0, -4053, 1596, -6291, 512, 3416, 504,
+  1124, 1145, 4800, 684, -2948, -1561, -266, -1565, -3707, -1656, 4480, 5566, -4305, -3808, 6050, -6990,
+  -1144, -3717, -6930, -2057, -2595, 2736, -966, -3094, 1045, -738, -1544, -1330, 932, 3584, 488, -3528,
+  -2529, -2748, 960, 2280, 3216, -2453, -4788, 313, 2022, -1656, 5040, -1936, 1435, -3332, 4400, 466,
+  3146, 531, -1782, -2992, -1557, -2736, 322, -5474, -1881, -984, -386, -3724, -3029, -3584, 732, -4536,
+  -5058, 2977, 7040, 1596, -1340, -2676, -798, 5634, -337, -3312, 3920, 3388, 4879, -4998, 1925, 3495,
+  6292, 1062, -1782, -561, 0, -3040, -1771, 1666, 1254, 3936, 1544, 798, 932, -1280, -976, -1008,
+  -3091, 2519, -320, -1824, -7504, -1561, 2660, -3443, -3370, -3036, 1400, 726, 3157, -238, 5500, 0,
+  -1144, -885, 2178, 0, -692, -3344, 644, 1904, -1045, -492, -1930, -1596, -1631, -3840, 1708, 252,
+  -281, -2290, 1920, -3192, -1876, -669, -2926, -6886, -4718, 828, -4480, -484, -3157, 238, 1650, -5592,
+  -858, 531, -1584, -187, -519, 1520, -966, -2380, 1045, -984, -1737, -1064, 5825, 4864, 1464, 4284,
+  -8430, -5496, 4800, -1368, -1340, -3345, -5852, -8138, 5392, 0, -280, 484, -2870, 0, 3025, 932,
+  1716, 1593, -198, -2431, -692, 2736, -805, 2856, -4598, 2706, -965, -3458, -1165, 4352, -244, -3024,
+  3372, -2748, -1920, -684, -3216, -3122, -532, -1878, 674, 828, 0, 0, -2870, 1190, 3850, 5592,
+  3146, 3363, 1584, -1309, 0, 2128, 2576, -1428, -1672, -246, 772, -1862, 2097, -3840, -2196, 504,
+  -1686, 0, 4800, -3192, -804, 2899, 2394, 1565, -337, -4140, -2800, 968, -3731, -238, -550, 1165,
+  286, 1416, -1584, -2057, -692, -304, -1771, 3808, 418, 1968, -772, -8246, 3495, -2048, -5368, 4032,
+  -1686, -3664, -6720, -5016, -1608, -3568, -7980, -3756, 1011, -276, 1120, -1694, -5740, 238, 550, 4893,
+  0, -1416, -594, 935, 1211, -1216, -644, 1428, 627, -2460, 386, 0, -2330, 4608, 488, 0,
+  -843, -229, -1280, 2736, 3216, 0, 3458, 5947, -674, -1656, 2800, 726, 1722, 714, 3850, 3262,
+  286, 2301, 2574, -4488, -2076, -1824, -644, 1190, 627, 4182, -2123, -7714, 932, -2560, -1220, 2268,
+  -281, -4809, -4160, -1140, -2412, -3791, -5320, 5008, 0, -1656, -3640, 3630, -2296, -2380, -1100, 2796,
+  -7436, 1947, -5148, -7667, -2076, -3648, 322, -3332, -7315, -1476, 4632, 0, 3961, 3328, -732, -6300,
+  -5620, -229, -3840, -912, 1608, -2676, 532, -2191, -1348, 7728, -2240, -7260, 2009, -12376, -2200, 6524,
+  -4290, -708, -3168, -187, -346, -3344, -805, -3332, -2090, 246, -1351, -2926, -1864, -512, -5124, -1764,
+  -1124, -1374, -6720, -3192, 2680, 0, -3458, -313, 1348, -4416, -1120, -968, 2583, -2380, -825, 466,
+  -1144, -1593, 3168, -1870, 2422, 4560, -966, -1190, -3762, -4182, 0, -1330, -7689, 2560, -2440, 504,
+  -3653, -1145, 1600, 1596, 4020, -446, 798, -7512, 3707, 1104, -560, 1452, 574, -3094, 2200, -932,
+  -8580, -5133, 2772, 2618, -7785, -7904, 644, -1428, -2926, 3198, -386, 5320, 0, 1024, -488, 504,
+  5339, -3435, 1920, 2280, 0, -2676, -1596, -1878, -3370, 552, -1120, -726, -4879, -3808, 2200, -7689,
+  2288, 1947, -3564, 935, 346, 4864, -2737, -3808, -627, 984, -2316, 1596, 2563, 7168, 2440, -3276,
+  -562, -229, 2560, -1368, 1608, -3345, -5320, -939, -3707, 0, 1680, -4598, -1148, 238, 7425, 1398}
+;
+
+// batch_normalization_2 folded into conv2d_3
+#define CONV2D_3_FOLDED_WEIGHTS_SCALE_FACTOR 14
+#define CONV2D_3_FOLDED_BIASES_SCALE_FACTOR 12
+
+const int16_t conv2d_3_folded_bias[128] = {12006, 3050, 618, 1113, 4074, -4717, 10623, 11882, 11578, 11991, 7833, 6892, 14818, 9319, 3312, 12065,
+  11553, -6031, 8430, 5063, 511, 9821, 7014, -4666, 16968, 20752, 6943, 5301, 590, 18430, 8113, 10110,
+  6826, 7092, 6167, 12084, 15800, 17316, 15720, 3263, 11944, 13957, 10440, 6138, 4349, -3846, 8714, 11997,
+  9924, 6506, 1682, 3306, 8650, -5981, 4998, 2431, 17342, 11256, 4630, 7569, 6345, 8000, 705, 12429,
+  6803, 11664, 15178, 8785, -2209, 13187, 9331, 11177, -11151, 14094, 14663, -8575, 3207, 13918, 14112, 9917,
+  10429, 20559, 6289, 3447, 13420, 10857, 13666, 10945, 11641, 7298, 14245, 5201, 8613, 10428, 14011, 12987,
+  5734, 2884, 14237, 6459, 2791, 9351, 5290, 7098, 13105, 15256, 9085, 5981, 13596, 9735, 17789, 4731,
+  18924, 9327, 8505, 4040, 15582, 4890, 12303, 8018, 20441, 9536, 2534, 17522, 11003, 7543, 12489, -1862}
+;
+
+const int16_t conv2d_3_folded_kernel[128][3][3][64] NN_ALIGNED = {107, -2214, -1365, 808, -169, -1200, 700, -1507, -357, 226, -306, -133, -990, -640, 714, -565,
+  0, -1500, -768, 0, 354, -525, -1044, -1708, -2184, -2280, -1188, -1495, 364, -405, 369, -1776,
+  -1080, 435, -294, 1712, 508, 1552, -139, -552, 2331, -1090, -4002, -581, -3302, -648, -903, 1470,
+  544, -1582, 1380, 220, -1160, -236, -2220, -864, 798, -1344, 1298, -1547, -520, 2227, -480, -954,
+  -749, -369, 105, 101, -2873, -200, 300, -274, -119, 1130, 0, -1596, -594, 384, -306, -452,
+  -1573, 1000, -480, 1512, 826, 0, 1856, 1586, -832, -360, 693, -1265, 819, -1755, 1107, 444,
+  -135, 1566, 1029, 428, 1143, -776, 2363, 184, -888, 763, 138, -332, -381, -648, -645, 1470,
+  -1224, -452, -920, -880, 232, -2242, 1628, -96, 1026, -960, 354, 1274, -416, 131, -384, -1166,
+  642, -369, 525, 808, -3549, 100, -1500, -1370, 952, -113, -510, -399, 1287, -896, 306, -1356,
+  143, 1000, 1632, 882, -236, -150, -1160, -2562, 104, 960, -1881, 0, 91, 405, 861, -444,
+  1620, -174, 882, 214, 1270, 388, 1251, -920, -222, -1635, 276, 664, 635, -432, 1935, 1078,
+  0, -1582, 345, -770, -116, 0, 1332, 1152, 1254, 864, 354, 0, 104, 1572, -384, -424,
+  2140, -2091, 0, 404, -169, 900, -100, 0, -714, -1130, 0, 399, -495, -1152, 816, 452,
+  0, -2875, 1344, 0, -236, 975, -696, -1098, -1144, -1440, 99, -1150, -273, 810, -1845, 222,
+  1890, 174, 1911, 1819, 2921, 679, 417, -276, 1554, 654, -414, 249, 889, 972, 2322, -588,
+  816, -678, 0, 330, 348, -1652, 444, -768, -1140, -960, -472, -273, -104, 917, 192, 954,
+  749, -861, -840, -404, -4732, 500, -2400, -3288, -3332, 2034, 1632, -399, 198, 640, -1836, 452,
+  1716, -2375, 576, -1638, 1652, -525, -464, -1342, -1144, 2760, 792, -230, 1456, -1215, -1722, -1443,
+  -1620, -2088, -2499, 1070, 1397, -1649, -695, 1104, 1554, -2289, 1380, -1162, 0, -1188, -387, -1960,
+  1360, -2599, -1610, -220, 3248, -826, 1924, -672, 2166, -96, -472, 546, -936, 1048, 0, 424,
+  -1070, -1476, 1680, -707, -4056, -1000, -300, -959, 357, 452, -1632, 532, 495, -1152, -102, -904,
+  -715, -2875, 672, 1134, -2360, -1500, -580, -122, -520, -840, -1881, -1495, -1456, -135, -492, 333,
+  1350, 1392, -294, -2354, 1397, 582, -1390, -1288, -555, -981, 966, -1743, 2286, 216, 903, -196,
+  408, -2147, -460, -1870, -348, -1298, -1332, -2976, 798, 1440, -1180, -1274, -208, -2489, 480, -3180,
+  1712, 861, 525, -505, 169, -1000, -300, 822, -2618, 904, 0, 266, -693, 1408, 2346, 339,
+  715, -750, 480, -126, -708, 825, -580, -122, 520, 1680, -297, -1380, 455, 540, -861, -2109,
+  -405, 435, 441, -214, 889, 970, 0, -1104, 999, 0, -1794, -664, 0, -3024, 2322, 98,
+  2040, 565, 460, 440, 232, 1062, -148, 1440, -570, 864, -1180, 364, 1872, 655, 1632, 318,
+  107, 1722, -1155, -1111, 507, -1300, 1900, 1096, 714, 1469, -2346, -399, -2178, -1792, -1734, -2712,
+  -143, 625, 384, -504, -1652, -1200, -3248, 488, -1664, -1200, 891, -5060, -455, -135, 2091, -1332,
+  405, 783, -3234, 107, -1397, 582, -4309, 1840, -999, 1853, -2070, -1328, -1905, -432, 2064, 2548,
+  2584, -113, -920, -2750, -928, 472, -2368, -2304, -1368, 2016, 1416, -1092, 416, 3013, -1056, -106,
+  1498, 123, 420, 404, -4563, 1100, 1100, -1644, -952, 1243, -306, -399, 198, -768, -816, 452,
+  -2860, -1125, -1056, -630, 0, -300, 1044, -976, 104, -3000, -297, 690, 182, 1080, -123, -1554,
+  675, -87, -2058, -963, 2286, 97, 834, -2024, 444, 109, -138, 0, 1524, 972, -516, -686,
+  1360, -565, 2300, -1100, 1044, 1298, -1776, 1152, 0, -480, 2242, 728, 936, -262, -768, -1802,
+  -107, -615, 525, 505, -1690, 300, 700, 1507, -1071, 452, -714, -2660, -396, -128, 1326, -904,
+  -143, -375, 1056, 252, -354, -225, 1160, -244, -520, 2880, 792, 460, 546, -945, 492, -1221,
+  0, -522, -588, 1070, 1016, -485, 973, 1012, 1887, 109, 1242, 747, -2159, -540, -516, 784,
+  1088, 1130, 460, 770, -928, 1652, 1480, 192, -342, 1248, -472, -273, -728, 524, 288, 1590,
+  535, -2337, -525, -606, -3211, 600, -1400, 411, 714, 113, -2652, -133, 990, -1536, -204, 452,
+  1859, -2375, 1632, 126, 1416, 450, -348, -1098, -2392, -1200, -495, -1610, 1001, -1755, -2952, -111,
+  540, -2175, -1617, 2354, 508, 1552, -1807, -1748, 1221, -2180, 138, -249, 635, -1296, 516, -882,
+  1632, -904, 1035, 550, -1392, 472, 1628, -192, 1140, 576, -1416, -819, 0, -2358, 288, 848,
+  -1926, 123, 0, 303, 1183, 400, -1700, -822, -595, 2147, 1020, 2793, -1287, -2176, -306, 1130,
+  2288, -125, 192, 0, 708, -1050, -116, -366, -1664, 600, -2178, 460, -1001, 135, -615, 333,
+  945, 957, -2058, -642, -254, 291, 417, 460, 999, -2943, 276, 0, -127, -1188, -903, -1372,
+  1224, -452, 1380, -2420, 1624, 2478, 3996, 480, 912, 672, -1416, -273, -1248, -1048, -96, 2014,
+  -1605, -369, 1470, 202, -338, -100, 1700, 2877, -714, 113, -1734, 798, -792, -1408, 1428, -791,
+  286, -1250, -1632, 756, 354, -375, -2088, -366, 1248, 2280, 1980, -1955, 1092, 1890, 1230, 333,
+  810, 609, 588, -856, 762, 1358, -1390, 552, 1665, 654, -1380, 166, -1524, 972, -129, 588,
+  -272, -791, 460, -1540, 580, 590, 444, -96, -456, -480, -354, -637, -208, 1572, -96, -318,
+  214, 1599, -2520, -2525, -169, 1200, -2300, -548, -3570, 1582, -3468, 0, 792, 2944, 612, 904,
+  1287, -4625, -480, 1260, -2832, -900, -2204, -976, -936, -1560, -1584, 2875, 182, 675, -1476, -3441,
+  1620, -3045, 0, -535, 4445, -2813, -4448, -2484, -2664, 872, 276, 249, -635, 1404, 2193, -980,
+  4352, 1017, 2070, 5170, -1508, -2596, -2516, -1440, -1824, -768, -3186, -1001, 1664, -3537, 1920, -1696,
+  1498, 369, 840, 404, -507, -400, 1300, 2329, 833, 1017, -2550, 3059, 891, -256, 1734, -1582,
+  -1573, 2125, -1344, 0, -590, -825, 116, -2318, -1768, -1080, 990, -2875, 1001, 2160, -369, 333,
+  2565, 870, 294, -214, 889, 485, -834, -92, 444, 981, -138, -83, -1524, -540, 0, 0,
+  -272, -904, 1725, 1320, -696, -2006, -1628, 960, -3306, 576, 236, 1365, -416, -655, 576, 742,
+  856, 123, -630, 404, -338, 800, 1500, 1507, -1428, -1469, -510, -399, 198, 1408, 1326, -1130,
+  1144, 1500, -672, 0, -236, -1875, -232, 1098, 208, 1320, -396, -1955, 0, 405, 3075, 1221,
+  675, 1131, 2058, -1498, 127, 970, -3475, -920, 222, 0, -1932, 332, -254, 108, 1290, 392,
+  0, -791, -805, -880, -1740, 354, -4144, 960, -1938, 384, -472, -1729, -208, 1179, 480, 212,
+  642, 123, 0, -1010, 3718, -900, -1500, -2603, 357, 452, 816, -2128, 1485, -1920, -714, -791,
+  -1859, 875, -480, 504, -1062, -975, 3132, -366, -1768, -600, -594, -230, -91, 3645, -984, -777,
+  -2025, 1305, 3969, -1284, 1778, -2134, -695, -2484, 111, -3488, -1518, 996, 635, 864, 258, -1862,
+  -1496, -1130, 2530, -330, -2436, 472, 3700, 192, -114, -1440, 944, -546, -208, 0, 1152, -318,
+  -749, 369, 2100, -1010, -2873, -300, -500, -685, 1309, -113, 1020, -266, 1980, -2048, -1938, 565,
+  0, -2750, 672, -882, -354, -450, -116, 122, -416, -600, -891, 2530, -273, 2295, -492, -666,
+  -3240, 870, -1029, -1391, 762, 1649, 695, 276, -222, 1962, -966, 498, -1270, -972, -1290, 1078,
+  -272, -791, -115, -2860, 812, 0, -1036, 1344, 1140, -1152, 1180, 1547, 0, -3668, 1920, -2968,
+  -2140, 861, 1155, 202, -1014, -300, -1900, -822, 595, 1808, -204, -1197, -792, -1280, -714, -113,
+  858, -625, 864, -2016, 0, 675, 1044, 1098, -832, -360, 0, -345, -182, 1350, 2091, -555,
+  540, 783, -294, -107, -1778, -291, 1112, -460, 2664, 218, 138, -996, -2159, -1944, -2064, -490,
+  816, -113, -575, -1760, 116, -708, -2368, -192, 0, 192, 2832, 182, 104, -2358, 96, 1166,
+  107, 738, 1155, 808, -338, -1700, -1200, 4384, 238, 1695, 714, 1596, -297, -3584, -510, 565,
+  -429, -1250, -1056, 1764, -118, 150, 1508, 610, -1560, 360, -891, 345, 819, 1620, 0, -222,
+  3645, -435, 588, -963, -1143, 291, 1112, 644, -1332, -763, 966, -2075, -254, -1296, -645, 2842,
+  544, -452, -575, 880, 232, -236, -1924, 384, 456, 480, 1062, -1365, -2184, -1965, -960, 1166,
+  1284, 2214, 420, 1717, 676, -1000, -100, 822, 595, 565, -714, 1596, 297, -512, 408, -113,
+  3289, -500, 2784, -756, -354, -450, 580, 244, -624, 1080, -792, -1610, -1092, -135, 123, 1332,
+  540, -261, 441, 1177, -254, -291, -278, 276, 555, 981, 0, -581, 762, 108, 1677, 588,
+  -680, 1469, -1955, -1430, -1044, 2006, -2516, 2112, 0, -96, 1298, -819, -416, -262, -1536, 1908,
+  -428, -369, -420, -303, -2197, 1100, -2000, -411, -2856, 904, -1224, 1064, 891, 384, 612, -904,
+  -1001, -1125, 864, 630, -1652, 1575, 0, -1830, -728, 120, -99, -1610, 637, -2025, -369, 111,
+  1755, 870, 2646, -1177, 1270, 97, -834, -184, 2553, -1417, -552, -913, -127, -216, 2064, -686,
+  136, 2486, 2185, 440, -1624, -118, 3996, 1344, -1710, -1056, 118, 1638, 312, 524, -576, 2120,
+  107, -2337, 1365, -303, -845, -1800, 1800, 548, 0, 3616, 2652, 266, -2376, -640, -2244, 0,
+  -1144, 0, 1152, 252, 236, 750, 116, 3538, -936, -840, 198, -575, -546, -135, 1599, -1776,
+  -270, -3567, -4116, 1391, 1270, -388, 417, 736, 0, 327, 276, -2490, -635, -1296, -1806, 1666,
+  1088, -1808, -1265, 1760, 2552, -1534, -2220, -960, 1596, -2976, -236, -2002, -1248, -1703, -2112, 424,
+  -428, -1722, 1050, 1010, 1183, 2200, 2600, 137, -714, -1808, -612, 2926, -396, -384, 1020, -339,
+  429, 1250, 1440, 252, 708, -75, 1740, 2318, 0, -600, 297, -345, -1274, -1215, -984, -1332,
+  135, -522, -1029, 1819, -762, -1067, 278, -828, -1665, 654, -2346, 830, 635, 1512, -1677, -1862,
+  -1224, 1243, 0, -880, -116, 2006, -592, 1536, 3078, 1152, 2950, -1092, -416, 1572, 768, -954,
+  -107, 861, -420, 303, -1183, 300, -700, 137, 357, -113, 204, -399, -396, -128, -1224, -565,
+  -1430, 625, 864, 1008, 354, 375, 1624, -610, -1768, 480, 1584, -460, 2184, 135, -984, -1554,
+  -2160, 870, -735, 321, 2667, 194, 278, 828, -777, 218, 0, -1660, -762, -324, -387, 196,
+  0, 339, -1150, 1320, -1160, 118, -2812, 96, 1824, -192, 118, 1001, -520, 262, 96, -318,
+  -642, -1476, 315, -606, -5408, 600, 2200, 1507, -1785, -2486, -306, -266, 990, -1152, 0, -1356,
+  1287, -1625, 192, -2394, 2242, 900, -232, -610, 416, 960, -198, -345, 182, -2430, -1476, -2109,
+  3510, -87, -2058, -2140, 889, 194, -2502, 1288, -1443, -872, -2208, 581, -254, -432, -129, -490,
+  544, 1130, -345, -1540, 2552, -590, 1036, -864, 798, -1056, -2832, 91, 208, 2227, -1248, 636,
+  1712, -3198, -1890, 404, -2535, 2200, -1100, 411, -2499, -2034, 0, 133, -594, 0, 0, -1130,
+  -572, -875, 2304, 1890, 1534, -825, -812, 1586, 1248, -960, 594, 2530, 819, -3240, -3690, 777,
+  0, -261, -1323, -1391, -1397, 194, -2085, -1656, 888, 545, 690, 332, 4064, 864, 1032, -686,
+  4080, 565, -1610, -1210, -5568, -472, -1776, 1152, 456, -768, -2714, -1274, 1248, 2489, 288, -106,
+  -214, -1107, -210, -202, -676, -500, -500, -548, -1428, 113, 408, 1596, -198, 256, 612, 678,
+  -429, -2750, 2016, -252, -118, -675, -812, 854, 728, -840, 99, -2415, 364, -270, 0, 444,
+  540, 609, -1617, 321, -1270, -485, 2085, 0, 0, 218, 0, 913, 254, 1404, -1032, 784,
+  -2992, 904, -1035, -880, -1856, 2832, 1480, 768, -228, 1344, -2242, 455, 416, 1179, 1632, 1060,
+  963, 369, -315, 606, -338, -800, -500, -2466, 2618, -904, -612, 133, -792, 384, 1734, -904,
+  -286, 875, -1344, -126, 2242, -1050, 1276, 1464, -1040, 840, 2574, 575, 637, 3915, -246, -555,
+  -3105, 1653, -2058, -963, 889, 97, -1668, 184, 1554, 436, 1104, 1079, -2794, 216, -1419, 882,
+  -2584, 1469, -115, 110, -1624, 472, -296, 768, 0, 480, -2360, -455, 520, 1441, 672, 1696,
+  856, 615, 420, 202, 1521, 700, -600, 0, 714, 113, -306, -1463, 297, -512, -306, 565,
+  -1144, -1250, -1536, 882, -354, -1125, -1740, 1220, -1144, -120, -198, -2070, 1092, 1350, 246, -999,
+  -270, 696, -147, 535, 127, 97, -1112, 1380, 2553, 981, 138, -664, -1905, -432, -129, -784,
+  -2856, 1243, -690, -880, 812, -1062, 296, -864, -228, 288, 236, 182, -728, -524, -384, 954,
+  856, -1107, -210, 1010, 1183, -1400, -200, 3288, -119, 904, -1530, 931, -792, -1408, 612, 0,
+  -858, -1875, 192, 1134, -708, -2550, -928, -244, -1456, -120, 1584, -2530, 546, -1080, -492, -2331,
+  1350, 957, -2205, 1819, -889, -582, 417, 1288, 1554, 218, 552, -1411, -2413, 432, -2064, 0,
+  1496, 565, -1035, 660, 348, -1770, -1480, -1728, -684, 288, -590, 0, -1248, 2227, -96, 954,
+  214, -2460, 0, -3434, 4056, -1100, 1400, -2877, -3689, -565, -1938, -1064, 1782, -1152, -714, 452,
+  -1001, -4500, 2880, -630, 1062, 1875, 3364, 244, 1456, -2880, -3069, 690, -1001, -1620, -3813, -1332,
+  -1215, 1827, 588, -1070, -762, 2134, -4031, -1748, -4329, 981, -1380, 498, -2286, 1620, 258, -686,
+  2176, 2034, 3565, 2640, -928, -826, 1924, -1440, -798, 384, -1534, 182, -728, 393, 2784, -530,
+  107, -1353, -2310, -505, 169, 100, -100, -3151, -2142, 0, -1122, -1064, -396, 1792, -306, 904,
+  1144, -375, 96, -126, -236, 675, -1276, -488, -1560, 2400, 396, 1610, 1183, -270, -492, 222,
+  -810, -783, -147, 1498, -508, 1261, 3197, 1104, -111, -654, 2070, 166, -2032, -1512, -516, 490,
+  952, 904, 460, -330, -232, 118, 2664, 1248, -570, 864, -590, -637, -936, 0, 1248, -424,
+  2033, -369, 840, 1717, -2197, -900, 1000, 1781, 2737, -113, -408, 532, -990, -1792, -102, 0,
+  572, 1625, 864, -1386, 1062, -600, -232, 366, -1352, 600, 891, 575, 1001, 1080, -861, 555,
+  1620, 522, 1764, 963, -381, -1067, 2641, -184, 1221, -1090, 2622, -1079, 1143, 324, 0, -686,
+  -1496, -3277, -805, -660, -2204, -1180, 0, -576, -342, -1344, 2950, -182, 0, 655, -576, -424,
+  214, 861, 2100, 808, -1690, -800, -2000, 548, 2261, 1017, 3060, 1330, -891, -2048, 1836, -1695,
+  -286, -1000, 1056, -1512, 1416, -600, 1392, -366, -832, 360, -1287, 1380, 1729, -1620, 615, 1665,
+  2970, -696, -1470, 1177, -1397, -3201, -695, -1564, 444, 1744, 2346, 415, -1270, 0, -3741, -490,
+  1904, -2034, -1840, 3630, -464, 590, -1332, 192, -342, 960, -3304, -364, -208, -5633, -1824, 106,
+  -1070, -1599, -525, -1616, -1014, 200, -1500, 548, 0, -904, 714, 1197, -693, 640, 2142, -1356,
+  286, 250, 192, -1260, -826, -1425, -464, -1586, -3224, 120, 1782, -690, -637, -270, 1599, 333,
+  -1215, -261, -147, -428, -1016, -97, -278, 1196, 999, 109, -828, 332, -1397, -972, 1548, -980,
+  -272, -1243, -575, 1100, -1276, -590, -2072, -384, -1596, 480, -472, 819, 936, -2096, -480, -106,
+  1712, -369, 1260, 101, -507, -400, 400, -548, 714, -565, -306, 399, 1089, 640, -1632, 1243,
+  -572, 1500, 864, 504, 1534, 225, -348, -122, 2704, -360, 990, -2070, 273, 675, -369, 222,
+  -1080, -609, 147, -428, 2667, -1164, 1946, 1104, 0, 1308, 552, -581, -127, 216, 258, -294,
+  136, -1243, 1955, -1100, -580, -944, -2072, 1536, 1140, 192, -826, 91, 208, 131, 288, 0,
+  -963, -492, 1260, 202, 169, 900, -600, -548, 476, 2260, -1836, 1463, 198, -1152, 714, 1695,
+  2145, -250, 768, -252, -826, -825, -464, -366, -208, 1320, 99, -1035, -637, -945, 1476, -777,
+  -945, -609, 147, 321, -1016, 1261, 0, 1288, 666, -1308, 2208, -2407, -1016, -1188, 903, -294,
+  1088, 565, -230, 110, 0, 826, 2220, 480, 684, 960, -1298, 819, -1040, 262, 672, -424,
+  -428, 123, 840, 808, -1183, -1600, -200, -2329, 833, 339, -204, -798, -1485, 1024, -1836, 565,
+  -858, 625, 192, -1890, 354, -450, -1856, -1952, -312, 480, -1584, -1840, -546, 0, 123, 222,
+  -405, -870, -294, 1177, -127, 388, 3197, 828, 1332, 0, -690, -1411, 1143, -756, 258, -1568,
+  -1088, -1356, 920, 440, 1044, -708, -1036, 1344, 1824, 480, -1770, 364, 208, 655, 288, 1272,
+  -107, 1107, -840, 0, -2535, -200, 800, -411, -119, -791, -1938, 266, -594, 896, -612, -226,
+  -1716, 125, 384, -1890, -1062, -450, 348, 1464, 104, 240, 3366, -1955, 819, -675, 861, 111,
+  405, -348, -441, 749, 762, -388, 1251, 460, -666, -2180, 828, -1909, -635, -864, 1419, 686,
+  -1904, -2486, -115, 0, -812, 1180, 1480, -768, 1824, -1248, 3186, 182, -1560, 1441, 768, -1060,
+  -1070, -123, -525, 606, -845, 1100, -1500, -2603, 119, 565, 102, 665, 198, -768, 714, 1921,
+  858, 750, -2016, 1512, -708, -1350, 2552, 0, -2496, 2760, 693, -920, -1638, 1080, 5166, 666,
+  -2565, 783, -2499, -3210, -1016, -1455, 973, -920, 555, -1526, 828, -2490, -1397, 1944, -2064, -1372,
+  1496, -1130, -1380, -1320, 116, -1298, -1628, 1152, -1824, 768, -118, 1547, -3432, -655, 96, 1378,
+  749, 0, 315, -505, 845, 400, -2200, 1370, -2261, -1243, -1632, 931, 0, 640, 1122, 1469,
+  1716, -875, -1344, 2142, -1416, -1050, -1856, -2562, -520, 480, -396, -1725, -182, -1620, -1845, 1554,
+  1350, 696, -147, -1284, 127, 1067, 278, 0, -111, -981, 0, -2490, -2413, -1620, 1161, 3136,
+  -816, 565, 690, 1100, -116, -1062, -444, -960, -5016, 288, -4130, -2002, 208, -3537, 1728, -1272,
+  963, -738, 1680, 202, -3718, -200, 400, -137, 2499, -1243, -102, -931, 297, -1664, -408, 1017,
+  -1859, -1000, 192, -252, 2596, -900, 812, 1830, -416, -1800, 1386, -1610, 637, 2025, -861, -444,
+  405, 1131, 1764, -1712, -762, -1358, 278, 276, 222, -763, -3588, -581, 508, -3888, 645, 588,
+  -1768, -452, -1495, -550, 348, -590, 2664, -576, 342, 192, -590, -819, 416, 393, -384, 424,
+  -1177, -2337, -2625, 1616, 2704, 1700, -1600, 685, 238, 1469, 1020, 266, -2178, -128, 2346, -1356,
+  -2717, -625, -960, 0, -1180, -900, 1276, -732, -208, 1200, 1683, 1035, -2548, 2700, 492, -3330,
+  4725, -2088, 2940, 1926, 1651, -1455, 0, -1748, -666, -1744, -3864, -2573, -1905, -3348, 1419, -1372,
+  1360, 2147, 4715, 1100, -2204, 236, -1332, 192, -1596, 1728, 0, -2002, -2184, 1572, 864, 424,
+  -321, 0, 2520, -707, -2535, -1000, 1700, 3014, -119, 2825, 1836, -2128, -1485, -1664, -204, 1808,
+  -2288, -625, -1728, 2394, 236, -1350, 3248, 2928, -3016, -960, 1089, -1725, -182, 1485, 1476, 111,
+  -3645, 0, 1764, 321, 635, -97, 2919, -644, -1443, 1962, 414, -2075, -1524, -2484, -1419, -98,
+  -2040, -1582, 2070, 2530, -348, 1534, 1184, 0, 2508, -864, 1298, 1638, -1976, -4454, 1632, -742,
+  2033, -738, 315, -404, 169, 2700, -300, 0, -595, -1469, -2346, -266, -594, 896, -306, 565,
+  2860, 750, -864, -126, 236, 1125, 464, 1220, 832, 600, 1386, -1495, 728, 405, -861, -111,
+  -405, -783, -5880, 321, 889, -2037, -1112, 2208, -1554, -1744, -138, -498, -1143, -324, 645, -980,
+  0, -1469, -690, -330, 2204, -826, 444, 0, -1254, 1344, 236, 910, 624, -2227, 2112, 742,
+  535, 738, -420, -707, -2535, 2800, -400, -137, -2499, -2486, -714, -133, -297, 1792, -1326, 0,
+  4147, 2000, 2592, 378, 354, -225, -1508, 854, 208, -360, 396, -575, 0, -270, 246, -1221,
+  1485, -1392, 294, 3210, 1397, -291, 139, -460, -1776, -654, -138, 83, 1143, 216, 774, 392,
+  408, 113, 1955, 440, 1044, 472, 444, -96, 1140, 96, 354, -364, -520, -393, -960, 0,
+  -535, -615, -1995, -202, -7098, -100, 600, -1644, -119, 678, -306, -2261, 198, 1664, 1326, -1017,
+  1287, 1000, 576, -126, 1180, -675, -812, -366, -624, -2280, -99, -345, 182, 675, 861, -111,
+  -1350, 609, -4851, 107, 0, -194, -278, -92, 1332, 872, 690, 913, -381, -756, -516, 1470,
+  -408, -1469, 115, -440, -1624, -2596, -1036, -1920, 912, -768, -590, 1183, -520, -2096, 480, -1484,
+  -1605, 1722, -735, -1616, 4732, 2600, 1000, -959, -595, -2034, -816, 1862, 99, 2304, -510, 226,
+  1144, 2125, -1440, 1890, 472, 975, -1392, -244, 1456, 1320, 198, 0, -1183, -270, -861, 2442,
+  -135, 522, -147, 0, -254, -1261, 695, -920, -777, 981, -1794, 581, 0, 324, 645, 2058,
+  -1768, 452, -3220, -660, 0, -826, -2220, 672, -2508, 1536, 2006, -182, 520, 1572, 864, 318,
+  -1926, -738, 420, -2828, 676, 1300, -300, -959, 476, -1017, -2448, -1596, 396, -256, 918, 791,
+  -2288, 1875, -480, -882, -472, 1575, 0, 976, 1248, 1200, 1386, 460, 0, 135, 1722, -555,
+  -675, 1218, 1029, 535, 1143, 388, -1251, -736, -2220, -872, -2484, 1162, 1778, 1944, -645, -784,
+  -2040, -3164, 1265, 330, -1276, -2478, -2072, 2880, -798, 384, -708, 0, 624, 262, 480, -2544,
+  214, 1107, 105, -909, -4732, 900, 2400, 1096, -1190, -339, -714, 0, -1584, 2304, 2448, -1469,
+  -1859, 4125, 864, -378, 1888, 2175, 116, 2318, 832, 2040, -594, -2300, 2093, -2835, 2214, -1221,
+  -1350, 1827, 1176, -749, -127, -1261, 973, -2024, -666, 872, 1104, 581, -508, 0, 1806, -980,
+  -1904, 339, 690, 0, 2204, 472, -1628, 384, -570, 1536, 118, -364, 104, 1703, -1440, -742,
+  0, -123, -315, 0, 6084, 1700, 500, 3425, 476, 565, 0, 1197, -1782, 768, -816, 339,
+  -2288, -375, -864, 2772, -236, 1200, 2204, 244, 0, -120, -495, 1265, 1274, 1080, 984, 1221,
+  3105, -435, 1470, -642, -1016, -2328, 1251, 828, 2664, -763, -3864, -1577, -254, -2700, -2838, 1176,
+  -680, -678, -2415, 1100, -2204, 236, -1776, -1440, -1824, 1536, 2006, 182, -104, -2358, -1248, 424,
+  -1605, -492, -630, -707, 6760, 3900, -100, -274, -3689, 2486, 1632, 133, -1485, -1536, -714, 226,
+  2288, 625, -2880, 1008, -1534, 1725, -812, 1830, -208, 3120, -792, -1380, 546, 2025, 1476, 666,
+  810, 0, 4116, 0, -127, -2328, 1668, -92, -1887, -2943, -276, -830, 3683, -3456, 774, -3724,
+  -680, 452, 1035, 2420, -812, 0, 296, 768, -570, 672, 2242, -1274, 1144, -1310, -2304, 1272,
+  214, -615, 2520, -606, 1690, 700, -200, -137, -833, -791, 408, 3857, -891, -128, -2856, -678,
+  -2145, -1250, 960, -756, 236, 825, 1044, 2440, -832, 1800, -1287, 460, 1638, 0, 1968, 1776,
+  3240, -957, 2205, -2140, -1270, 485, 1390, 920, 3441, -2071, -1242, -249, 1143, -3456, 1419, -1568,
+  2040, -2938, 1265, 1430, -928, 1416, 1776, 864, 798, 1248, -354, -182, 1248, 655, -384, 106,
+  -856, 1476, -315, 1010, 0, 1200, -1500, 1096, -714, -1356, 918, -665, 495, 128, -204, 1130,
+  286, -1250, 480, -504, 354, 1050, -1392, 122, -1456, 1440, 396, 1840, 273, -810, -1845, -555,
+  2025, 87, 735, 856, 2286, -1843, 278, -736, 111, -1090, 138, -249, 762, -1404, -1419, 98,
+  1768, 1356, 575, 330, 580, -1062, 1776, -576, -2280, 768, -1534, 910, -416, -393, -96, 954,
+  -642, 1230, -2625, 303, -338, 1300, -1200, -1644, -1309, 1356, 612, 266, 297, 2048, -714, -791,
+  1573, 1250, -288, 504, 708, -600, 0, 1220, -2184, 240, 891, -805, -546, -1620, -1845, -1443,
+  -810, 1914, -441, 1284, 889, 0, -1668, 0, 111, 0, 690, -166, 2413, 864, 903, -1666,
+  816, 1582, -920, -330, -464, -236, 2812, 768, -684, 0, -1534, 0, -104, 1048, 1920, -1484,
+  749, -1845, -735, -2424, -1521, -200, 1600, -685, -476, -339, -204, 1463, 0, -2944, -408, 2147,
+  1001, -2500, -672, -1008, 1770, 300, 348, -244, 0, -120, -792, 2760, 273, 1350, 123, -1998,
+  0, -87, -882, 963, -508, 194, -1946, -1472, 555, -545, -276, -249, -127, -972, 1161, 1274,
+  1632, 452, 920, -3080, 1624, -354, -1036, -1920, 114, 768, -1298, -728, 1768, -2096, 1440, -424,
+  0, 246, 630, -404, -845, -400, 600, 137, -357, 113, 612, -931, -1089, -512, 1530, -339,
+  -1716, -1500, 672, -504, 1534, 375, -1276, -1464, 2184, -240, 990, -690, -1274, -135, -2091, 222,
+  1890, -1740, 1470, 1070, 0, 582, 417, -644, 1554, -872, -552, 166, -2159, -756, -2967, -980,
+  136, 452, -575, -110, 116, 1062, 444, -480, 1938, -864, -590, 91, 624, -131, -288, -212,
+  -1177, 1353, -1470, -2525, 3887, -2600, 2200, -274, -833, 1130, -1224, -2926, -99, 1280, -612, -339,
+  858, -3125, 960, -504, -1652, 75, -464, 0, 1456, -4680, -2277, -575, -637, -2700, -1230, -1887,
+  2295, -348, 1176, -214, 381, 1455, -278, -2116, -3996, 3052, -3036, 581, 1016, -108, -1419, -1372,
+  2720, 2486, 2415, 4070, 812, -354, 1184, -2016, -798, -384, -236, -273, 104, 1834, 1440, -636,
+  1819, -369, 0, -303, -1352, 1200, -1400, -1918, -595, 1695, -1938, 1463, -396, 512, -510, 226,
+  286, -125, 192, -756, -708, 300, 464, -610, -3328, 960, -792, 805, 2184, 1620, 492, 222,
+  270, -1566, 147, -428, 254, -485, 417, 184, 2553, -1526, -1104, -415, -1270, -2484, 1032, -882,
+  544, 113, 2530, 330, -2552, 236, 0, 1344, 456, 0, 1888, 182, 0, 0, 1152, 1696,
+  535, 1722, 315, -404, 0, 500, 700, 1781, -1785, 565, -1224, 665, 0, -768, -1530, -1017,
+  715, -1875, 96, 1134, -354, -525, 232, 1952, -2080, -360, -99, -2185, -1456, 0, 738, -444,
+  1350, -1566, -1029, -428, 1524, 776, -3475, -368, 666, 763, -828, -664, 0, 1512, 1806, -686,
+  0, -113, -920, 110, 1044, 0, -3256, -1248, -1710, -1248, 2124, -182, -1872, -262, -576, -1272,
+  3103, 2091, 210, -1616, 676, -600, -2300, -137, 1666, -1243, 1020, 266, 0, -512, -2448, -1695,
+  2288, 250, -288, -504, -1770, -450, 928, -1952, 208, 1200, -693, -460, 1092, 1890, 369, 1332,
+  1890, -957, 2352, -1926, 1143, -3298, -2224, -1840, 1110, -4251, 2346, 249, -254, 108, -516, -2058,
+  -272, -2147, 2185, -110, -1508, -708, -1628, 192, -4674, 480, -118, -91, 104, -3799, -1728, 636,
+  -3531, 369, -1050, -909, -169, -200, -800, -137, -476, -678, -408, -1463, 0, -2048, -510, -2034,
+  1287, -250, 1632, 504, -3304, -2850, 696, 1708, -1456, 960, 693, -1035, -3367, 2565, 1476, -1776,
+  -1215, 1653, -441, -535, -381, 1164, -556, 1104, -1221, 218, -3174, -332, -889, -1836, -903, 1274,
+  -816, 565, 460, -880, -580, 590, 1628, 96, 912, -768, 590, 546, -2808, -1965, 288, 530,
+  -428, 861, -420, -606, -1690, -1300, 600, 1233, -833, 904, 510, 1729, 1584, -256, 612, 1017,
+  -1144, -250, 1440, 2520, -2006, -450, 1044, 610, -312, 1320, 0, -1840, 455, 2160, 615, 1776,
+  1485, 609, -2058, 1284, -2032, -873, 2502, -184, -1110, -1199, -1242, -747, -2921, 648, 387, -1274,
+  -816, -791, -1035, 1100, 348, 1416, -1628, -864, -798, -1920, -354, 728, -312, -2489, -96, -1060,
+  -1284, -615, -525, -808, -507, -1800, -300, 0, -1666, -2260, -204, 931, 594, -512, -102, -2373,
+  -2288, -3000, -864, -126, 944, 750, 2320, -1342, -104, -2280, -990, 1725, 273, 135, 246, -1554,
+  2025, 1044, 1911, -1498, 0, -291, -556, -736, -444, 436, 1104, 581, 508, -756, -2193, 588,
+  -680, -1130, -345, 880, -232, -2360, -1628, 192, -1140, -1152, -354, -546, -936, -917, -2112, -424,
+  214, 1230, -1785, 101, 1183, 1700, -1400, -1644, 0, 0, -510, 665, -1386, 768, 918, -1356,
+  -2574, -625, 1248, 252, -2124, 225, -580, 732, -832, 240, 396, 1725, -728, -1350, -2706, 111,
+  -810, 435, -882, -856, -508, 582, -278, 368, -444, -218, -138, -581, 2159, -864, -1290, 0,
+  -680, 113, -230, 1650, -580, -1770, -2664, -288, -1140, 960, -708, -455, -1872, 131, -768, -1378,
+  -2247, -2829, -945, -303, -2028, 300, -2500, 411, -1309, -339, 1224, -266, 693, -1152, 816, 226,
+  0, 1375, 1440, 252, 708, 525, 580, 976, 624, 1080, 297, -1495, 364, 945, -246, 666,
+  -810, 87, 1323, 1605, 1143, -582, 1390, -2300, 555, -2398, 2208, 83, 1397, -432, -1419, 0,
+  -272, -2373, -1035, -1210, -928, 0, 1332, -96, 114, -576, 0, -637, -3016, -917, 768, -318,
+  535, -861, 1260, -202, 0, 1200, 2600, 137, -1547, 339, -102, 532, 495, -256, -2652, -1695,
+  -3289, 375, 0, 2016, 0, -1500, -3132, 244, 520, -600, 1089, -345, -1001, 1080, 2214, -2664,
+  0, -957, 0, 749, -2159, 970, 417, -92, -888, 1962, 828, -1328, 1651, 972, 3999, 196,
+  2176, -1582, -575, -2750, -1740, -2242, -1184, -2784, 1026, -1152, 1298, -182, -832, -3537, 288, -2014,
+  -107, 2952, 1680, 303, 1859, -700, 500, 2055, 1309, 1017, -714, -665, 495, 256, 714, -2260,
+  429, -375, -1248, -1638, 708, 0, 580, -244, -416, -1080, -495, 575, 1456, -1080, 1845, -888,
+  -2025, 1305, 735, 321, -1016, -485, 2363, 0, 0, -1308, 690, 996, 1651, -1404, -1032, 0,
+  2040, -1243, -1610, 660, 1624, 590, -2368, 96, -1254, 288, -944, 0, -1040, -131, 864, -318,
+  642, 246, -2100, -505, 676, -700, -200, -2877, -1190, -1582, -510, 1995, 1386, -256, 3060, -1017,
+  2431, 750, 768, -2772, -2006, -1350, 116, -1586, -1144, 2520, -594, 460, 910, 1080, 615, -1110,
+  0, 783, -882, 1070, -3048, 388, -2224, -828, -666, 109, -1242, 498, -2794, -648, 1548, -980,
+  -3808, -113, 805, 550, -928, 2124, 0, 1440, -342, 2304, 944, -182, 1248, -917, -768, 742,
+  214, 492, 735, 101, 5070, 600, 100, 548, 0, 1243, 816, -1463, -1188, -1536, -510, -1356,
+  286, 500, -576, -3276, 1416, 150, -2204, 2440, -3328, -1080, 198, -805, 91, -675, 1722, -1665,
+  -675, 1044, -294, -1070, 127, 1455, -3614, 276, -111, 327, -2208, -913, -2286, -1080, -129, 980,
+  -1088, 1808, 0, -1980, 2088, 3776, 1628, 1152, -570, -864, -708, 1456, -520, 917, 960, -106,
+  -1712, -1968, 2310, -404, 2366, -100, -900, 137, 1904, 904, 0, -399, 198, -2688, -510, -2260,
+  -2145, -2625, 576, -1260, -2596, 375, -1392, 1464, 624, -1200, -693, -2530, 1092, 405, -1107, 222,
+  1620, -4176, -441, 1605, 508, 0, -834, 736, 2553, -1853, -1380, -747, 762, 1188, 387, -1568,
+  0, 339, -1150, -330, -2088, 1416, -1924, 576, 1938, -1440, 1180, 637, -208, -1703, 960, 1060,
+  107, -2091, -210, -404, -3211, 1000, 500, -548, -2023, 1017, -1020, -1330, -792, -1024, 1020, 0,
+  715, -250, 192, 252, 708, -825, -580, 976, -1664, 840, -1089, -3565, -182, -1215, -123, 666,
+  -810, -1740, -3381, -107, 1905, -1552, -1668, 552, -666, -1853, -138, -415, -3048, 1512, -258, -1568,
+  680, 1582, -1840, -110, -1160, -354, 1036, -672, 456, 288, 590, 455, -520, -1572, -384, 1272,
+  1498, -492, -1890, -404, -845, 500, -2400, -137, -2975, -2260, -408, 1995, 891, 1280, 204, -1808,
+  3003, 2500, -864, -126, -1652, -1275, -1740, -1220, -416, 1800, 1485, 1035, 364, -270, -1230, -1443,
+  270, 870, 1323, 1284, -762, -291, -834, 0, 1443, -654, 414, 913, 127, 972, 1548, -1078,
+  -1496, 339, -1610, -440, -1624, -590, 2960, 672, -3534, -192, 590, -546, -832, -1310, -96, -318,
+  214, 615, 315, 101, -676, 200, -1400, -411, -833, -791, -408, 1995, 99, -896, 612, 904,
+  -715, -625, -1728, 1134, -1770, -300, 1508, 0, -416, -240, -891, -1495, 546, -945, -1230, -222,
+  675, -957, -1911, 642, 3048, -1455, 695, -828, 1554, -1962, 276, -1245, -1651, 1080, 645, 2058,
+  408, 678, -1840, 0, 1856, -590, 2368, -768, -456, 1536, -2596, 637, -832, -1703, -576, 530,
+  -642, 1107, -1470, -1515, 1352, 200, -600, -411, 1190, 226, 918, -2261, -297, -1536, -918, 113,
+  858, -1500, 96, 504, -354, -1800, -464, 122, -1040, -360, 594, 805, -1183, -270, 861, -222,
+  -1350, 435, 1323, -428, -1778, -679, 973, -1840, -333, -2289, -1104, -747, -2794, -2700, -258, -98,
+  1632, -3051, -230, 1430, -1508, 2006, -2072, 384, -1140, -96, -472, -1547, -1352, -1965, 288, 106,
+  749, 1845, -210, -1212, 2873, 100, 800, 411, 833, -4859, -1122, -4256, -396, -896, 1530, -1695,
+  429, 375, 96, 756, 944, -375, -116, -3782, -104, -1920, -891, -1380, -455, -2835, -1353, 1332,
+  -540, 1131, 3675, -428, -2540, 1261, -3197, 920, 1443, -545, -690, 1079, -1143, -540, 1935, -1470,
+  -1496, 226, 3910, 1100, 348, 1180, 0, -1728, -3192, 2976, -1888, -1820, -312, -524, 768, 848,
+  -107, 1968, 1785, -1616, 845, 1000, 800, 137, 238, 1017, -204, -1995, 1287, -512, -1122, -1695,
+  1859, 1125, 288, -1134, 590, -675, -1856, 610, -1560, 1560, 792, 115, -637, -135, -369, 333,
+  -1620, 87, 441, 0, 508, 776, -1668, -1564, -1665, 327, -2070, -1494, -635, -1296, 387, -1078,
+  544, -1921, -345, -440, -348, -236, -296, 768, 342, 0, 236, -1092, -1248, -524, 1248, -742,
+  0, 246, -210, -202, -1183, -200, -1000, 2603, 1547, 1017, 306, -133, 0, -1408, 0, -1017,
+  -1001, -375, -672, 882, -472, 1275, -116, 1586, -728, -840, -891, 230, -2184, 1890, 1230, 222,
+  -405, -783, -1617, 963, 762, -1649, 417, 1656, 111, 1417, 828, -1079, -635, 864, -645, -98,
+  816, -678, -1380, 440, 116, 708, -888, 1248, -798, 672, 2006, 91, -208, 786, 384, -742,
+  3745, 1845, 945, -202, -338, -2400, 1000, 1918, 833, 678, 816, 399, 1089, -384, 408, -2712,
+  572, 1750, -960, -2394, 1652, 375, -1276, 610, 1768, 120, -1089, -1955, 2821, -2295, 861, 666,
+  1080, 0, -2940, 642, 1270, -1843, -139, 736, 777, 1199, 2898, -332, -762, -1296, -4257, -2352,
+  -544, -1017, -460, 880, -812, 1888, -1036, 672, -2622, -288, -1180, -364, -1664, -2882, 0, -530,
+  -963, -2460, 210, -505, 1690, 1100, -1300, 548, -2142, 1130, 204, 665, -495, 640, 0, -1695,
+  -2145, 1625, -288, -1386, -3658, 975, -1740, -122, -3120, 1920, 99, 690, -1001, 1755, -123, 1998,
+  -675, 0, 4263, 2354, -1524, 0, 1668, 736, -1332, -872, -276, 0, -762, -864, 903, -2058,
+  -1224, 678, 1150, 0, -696, -118, -2220, -576, 228, 0, 944, -273, 1248, 1441, -2208, -106,
+  2782, 738, -525, -1717, 1183, 1900, -200, -1918, -1309, -113, -2958, -798, -1584, 0, -2142, 791,
+  -1573, -375, 1440, 1764, 1062, 600, -1276, -732, 0, -2040, 1782, 2415, -819, -2295, -738, -999,
+  -945, -870, -2940, 1070, -635, 194, -1946, -552, 2553, -654, -276, 83, -1905, 2592, 1032, 1862,
+  -1224, 1356, -1035, 660, 1856, -1416, -2516, 96, -456, 1536, 708, 819, 1976, -524, -288, 1060,
+  214, -492, 1365, -101, 1352, -300, -300, 2329, -952, 2373, 816, -399, 396, -128, -1326, -1243,
+  0, 1000, -672, -126, 590, -1275, -1508, -244, 936, 1440, -396, -2185, 819, -2025, 123, 999,
+  2160, -435, 0, 749, 1397, 582, 0, 1288, 0, -327, -828, -332, -254, -648, -129, 490,
+  1904, -1017, 1725, 0, 232, 354, 1036, -864, -114, 0, 236, 728, -312, 655, 960, -2014,
+  -107, -984, -1365, -404, -2197, -400, 1600, 137, -476, 1243, -306, -931, 891, 1024, 1836, 1130,
+  1144, -375, -672, -882, 708, -750, 1160, -1464, -1560, -1680, -99, -1380, -1547, 1890, 369, -2220,
+  -405, 87, -2205, 428, -762, -970, 2224, -184, -777, 3488, -690, 498, -635, 324, 1419, -490,
+  1768, -339, 805, 0, 928, -118, 2072, 96, 2394, -576, 708, 1274, -1664, 1179, 864, -848,
+  -963, 369, -315, -2020, -338, 1100, 300, 2466, -476, -339, -2448, -1330, 1287, 768, 1836, 0,
+  -2288, -1250, -960, 2646, -826, -750, 1624, -1952, 624, 1800, 0, -1265, -1365, 270, -2337, 888,
+  -810, -1827, 441, -642, 1016, -1843, -2363, -92, -2886, 109, 1518, 747, -762, 216, -1677, -196,
+  544, 1356, -1495, -1210, 116, -1770, -2664, -1056, -2622, 0, 354, 455, 1040, -131, 192, 1378,
+  -749, -2583, -2520, -2626, -3042, -4700, 200, 3699, 833, -565, 1326, -931, -1188, 1024, -714, -3842,
+  -1144, -500, 960, -1134, 708, 600, 1276, 122, 728, -960, 1089, -575, 819, -2295, -2583, -1332,
+  945, 0, 4557, 214, 508, -2037, -4031, -1104, 2775, -981, -276, 0, 889, -432, -1935, 294,
+  1632, -3616, 115, -220, -2204, 0, 2960, -2304, 456, -384, -3304, -2184, -4264, -262, -288, -742,
+  -1712, -2952, -315, 1111, -507, 3100, -2300, 411, -595, -678, 306, -1596, 297, 1536, -1122, 678,
+  1573, 2250, 672, 1260, -118, 375, -232, 1586, -416, 2040, -1089, -345, -2821, 675, -861, 1665,
+  -2700, 87, -1029, 1712, 1016, 291, -695, -1656, -888, -1526, 1104, 664, -889, 324, 0, -882,
+  1904, 452, -690, -880, -1972, 2832, 740, 1536, -228, -576, 2242, 273, 1352, -1441, -192, 212,
+  -321, 0, -315, -606, 4056, 500, 500, 2603, -238, -113, -1938, -1064, 396, -384, -1020, 565,
+  -3003, -125, -2208, 2394, -2242, 975, 1276, -2074, -2704, -1560, 1683, 115, -728, 540, 492, 1554,
+  675, -522, -1617, -428, -1778, -97, 1251, -2116, 444, 763, -1932, -1079, -762, -648, -258, 1176,
+  680, -565, -1495, 440, 0, -944, -1628, -2496, -2622, 1440, 1770, -2093, -104, 2096, -96, -530,
+  -1498, 0, -1050, -1313, -169, -2300, -2300, 2192, 357, 3277, 204, 931, -1089, 896, -2550, -904,
+  286, -1500, 1248, -3402, -2242, 750, 1972, 1952, -728, 1080, -2079, 805, -364, 2025, 2460, 444,
+  2565, 696, 1323, -2354, 127, -194, -278, 552, 333, -1308, -1932, -830, 508, -3240, 516, -1568,
+  3128, 791, 115, -1540, 580, 1298, 592, -1152, -798, 480, 118, -364, -1248, -917, -2688, 1484,
+  -214, -1722, -630, 1414, 338, 800, -1200, -2329, -1071, 1582, 102, -2926, -2871, -128, -1224, -1243,
+  2574, -2625, -1440, 882, 590, -75, -348, 1098, -1144, -360, 693, 230, -2548, 945, -984, 555,
+  -1485, -3306, -147, 749, 635, -2037, -1390, -1472, 2442, -1308, -966, -747, 1651, -648, -516, -686,
+  952, -678, 3680, 880, -1624, 1534, 592, 0, -1254, -480, -590, -546, -208, 262, 672, 1166,
+  -107, 1476, -2100, -1313, -4056, -800, -500, 274, -1071, 565, -1938, 665, 1188, 2816, -714, -113,
+  858, 1125, 1248, 756, 590, 0, 2204, -2806, -728, 120, 891, 1610, -2184, -1620, -738, -2331,
+  -1620, 3567, -3381, -107, -2794, 1746, 2224, -736, -2442, 327, 2070, 1577, -635, 108, -903, 2646,
+  -1496, 339, 575, 440, -696, -1888, -1924, 288, -1140, 2496, -1770, 1456, 936, -917, 1056, -1378,
+  214, 1107, 1260, -505, -4225, -1600, 900, 1096, 1785, -113, -612, -133, -1683, -1920, -510, 0,
+  2002, 0, 2400, -1008, -2242, -675, 696, -2684, -1664, -1800, 99, 230, 910, -2970, -738, 222,
+  405, 87, 2058, 321, 2667, 291, 417, 460, 1554, 1526, 3174, 166, -1905, -1080, -1161, -1764,
+  952, 226, -2645, -660, 1044, 1062, 888, -96, 2964, -576, -1652, 728, 1352, 0, -480, -1696,
+  214, 1107, -1995, -808, -845, 1000, -700, -2329, -714, -904, 612, 266, -99, 2432, 1530, -678,
+  -143, 1375, 1056, -1134, 0, 1200, -116, 976, -2080, -480, 594, 460, -1274, -2160, 0, -888,
+  -1080, -174, -1617, 963, -1270, -970, 0, -1380, -1665, 2289, 1932, -1577, 1651, 324, 1419, -2156,
+  1088, 678, 2185, -220, 1624, 944, -1036, -96, -114, 2496, 708, 455, 936, -786, -1152, -848,
+  428, 1968, -735, 404, -1014, -300, 1800, 2466, 238, 452, -1428, -1596, -693, -512, -510, 1017,
+  -286, 2250, -1632, 882, 826, 375, 1972, -732, -624, -1920, 594, -115, -1547, 0, -1230, 777,
+  0, 261, 1029, 1498, 635, -2037, 834, 828, -555, 1635, 1932, 332, 508, 108, -1806, 196,
+  408, 0, -1955, -3080, 1508, -472, 444, 960, -2394, 1632, 708, 364, -312, 1310, -480, -2332,
+  -1177, -861, 525, -1313, -1521, -1400, -3300, 685, -238, 1017, 510, -665, -792, 1408, 204, 1130,
+  572, -750, 960, -2772, -826, 150, -580, -2806, 104, 0, 990, 575, 1183, -675, -3936, -888,
+  -3915, -174, 2940, 963, -635, 582, -4031, -3956, 1110, -3706, 1518, 581, 2921, -3024, -5805, 196,
+  0, -3729, 1035, 2640, -1972, 1652, 4884, -2784, -1368, 480, -944, 91, -2392, 1965, -2688, -1696,
+  -1712, -984, -420, -1111, 1014, -3800, -700, 2466, 1071, -1017, -918, 1330, 891, -2176, 1428, -1695,
+  1287, -2625, -1440, 378, -236, -300, 116, -366, 1976, -600, -990, 345, 1456, 3105, 2583, 444,
+  -1620, 1479, 2058, -321, -1270, -2522, -417, 368, 333, -1417, 138, -664, 1016, 216, 1677, -2156,
+  0, -2260, 1150, 440, 0, -472, -148, -1344, -342, -288, -826, 910, -624, 1048, 0, 1378,
+  -1070, 492, -2730, 404, 2535, -1200, 900, 3562, -119, -452, -306, 399, -198, -384, -204, -1921,
+  0, 750, -1536, 1512, -1534, 225, 1740, -122, -520, 1560, 792, 920, 455, -945, 123, -444,
+  1620, -783, -588, 749, 1524, -291, -973, -1104, -888, -2289, 276, -581, -1143, 108, 129, -588,
+  -1088, 1017, 805, -770, -116, 236, 740, -1440, -1026, -96, -1298, -1092, 416, -131, -480, 0,
+  749, 369, 0, -1515, 1352, -1100, -500, -822, -238, 1243, -306, 1197, 594, -2560, 204, 1017,
+  -143, 2125, 960, -1134, -1652, 375, 1740, 1464, -1352, 3000, -594, -575, -273, 135, 369, -444,
+  2025, -174, 2352, 0, -762, -291, 2780, -828, 1554, -2180, -690, 332, 127, -540, -903, -392,
+  272, -226, -690, -2530, -580, -708, 148, -192, 0, -288, -1416, -364, -2080, -131, -768, 424,
+  856, -492, 420, 808, 338, 200, 900, -1096, 833, 1130, 2040, 133, 693, -1152, -204, 791,
+  2145, 1125, -1344, 2520, 590, 825, 580, 1708, -624, 480, 0, 115, -273, -810, 0, -2331,
+  -1350, -2262, 1323, 2675, -508, -1455, -2085, -1104, -111, 109, 276, 332, -1524, 216, 2451, 490,
+  -1632, -226, 230, -1320, 2784, 1652, 2960, 768, -1482, 2304, 590, -1820, -1456, -1441, 864, 106,
+  -1070, -1476, -1785, -606, -3380, 2200, 1400, -548, 2023, 339, -408, -1064, -693, 256, 816, 1130,
+  1287, 500, 288, -756, 354, 825, 116, 976, 104, -480, 594, -115, 455, -540, -369, -555,
+  -945, 0, -1176, 749, 762, -1261, -1668, -828, 666, -1090, -1518, 0, 762, -216, -387, -882,
+  544, -1582, -575, -1210, -1276, -1180, 592, 480, 114, -960, -708, 819, 208, -1703, 1056, -1802,
+  -856, -1107, 1260, -1313, -676, -800, 1500, -959, -238, -1582, 204, 266, 594, 1408, 1020, -565,
+  1144, 2750, 672, -1260, 118, 525, 232, 366, 104, 1800, 198, -920, -182, -4050, 0, -111,
+  3105, -1044, -1470, 1391, 762, -291, -278, -920, 777, 763, 0, 664, -1016, 648, -1290, -1960,
+  -1496, -1130, -1380, -110, 580, 354, 1628, -384, 228, -576, 472, 0, 104, 917, 96, -424,
+  -321, -1845, -210, 0, -845, 700, -400, -548, -1190, 1017, -2244, 1596, -396, -512, 408, -226,
+  -2145, -250, 288, -1386, -826, -150, 116, 488, 312, 2280, -1881, -2300, 1092, -135, 1107, -777,
+  -2565, -522, 882, -1284, 254, -873, -278, -1012, 777, 218, 1242, 415, -1905, 648, 387, 1274,
+  -680, -791, -1380, 440, -1160, 236, 2220, -960, 570, 1728, -2242, 819, 0, -786, -1440, -318,
+  856, -861, -1575, -2121, 1014, 300, 1200, -685, 1190, 113, -816, 931, 1485, 0, 408, -452,
+  1287, -1250, -960, 882, -1062, -1800, -1392, 488, 832, -600, 0, -805, 0, 810, -3075, 666,
+  -1890, 1218, 1470, -2140, 1143, 1261, 417, -2024, 1554, 2398, -5658, 1743, -381, 648, 129, 1274,
+  -2176, -1808, -230, 220, -1276, 118, 1628, -96, 228, -288, -1180, -3549, -520, -1179, -192, -318,
+  -107, 0, 2205, -909, 507, 2100, -5100, 822, 595, -3955, 612, 266, -990, -1024, 1428, -2599,
+  -429, -1250, -576, 2268, -1652, -1050, -1972, -3904, -1768, 840, -495, -460, 910, 405, -861, 2775,
+  -540, 1827, 4263, -1498, -3556, -3298, -2780, 552, 2109, -6649, 414, 1411, -3302, -1512, 1677, 0,
+  -1088, -2938, 920, 880, -2204, 3304, 2368, 576, -114, 1632, -236, -2457, 2808, -2751, -2208, 530,
+  -1498, -615, 1050, 303, 1014, 300, -700, 1370, 3094, 904, -816, 532, -990, 896, 612, -1695,
+  572, 2250, -576, -756, 118, -2325, 0, 1220, -1872, 1080, 495, -345, -2002, 135, 3936, 0,
+  -540, 87, 882, -1070, -254, -485, 556, -184, -2553, -1962, -552, -1328, 381, -108, 129, 196,
+  0, -226, 1380, 660, -348, 944, 1036, 1632, 0, 864, 236, 273, 0, -262, 1632, -848,
+  214, -2952, -315, -1616, 2197, -100, 1600, -3836, 952, -1130, -1224, 532, -594, -1024, -2856, 0,
+  -429, 625, 1440, -882, 472, 0, 928, 1708, -416, 2280, -1386, 0, -728, -270, -615, -111,
+  -945, -957, -294, -1498, -1397, -776, 973, -552, -777, 2180, 966, -1328, 508, 540, 258, 98,
+  1632, -1130, -920, -330, 1160, 1298, -296, 1728, 2850, 0, 1298, -364, 624, 1703, -1920, -212,
+  -428, -738, 1890, -606, 2028, -700, -500, -274, 1666, -1695, -204, 1064, 3069, -1408, 1326, -2599,
+  -1859, 0, 864, -630, -236, 75, -1856, 488, 208, 2160, -99, 575, -910, 540, -738, -777,
+  -540, -1218, -1176, 535, 889, 388, -834, 276, 1776, -2398, 276, -1826, -1016, -216, 1548, -294,
+  -2176, -452, -3105, 1100, -348, -590, -296, 1536, 1254, 576, 236, -1092, -1248, -4061, 0, 1484,
+  -856, 861, -735, 2020, 1521, 500, 800, 1507, 714, -339, -1122, 798, -1188, -128, -408, 339,
+  -858, 1375, 480, -1638, -590, -900, -1160, 122, -1872, 120, 198, 805, -1274, -135, -1107, -333,
+  -270, -696, 4263, 963, -381, 2231, 1807, 828, -1998, 436, -966, 415, 635, -324, -1290, 0,
+  0, 904, 690, 1320, 348, -354, 444, 672, 912, 576, 236, -728, -624, -524, 288, -1484,
+  1284, -1599, -210, -606, -845, 300, -1000, -1644, -1547, -452, -1224, 1596, -594, 1920, 714, -791,
+  1144, 2000, 96, -756, 708, 0, -1160, -1830, -936, 2880, 1683, 920, -364, 270, -615, 111,
+  -1215, 870, -3234, -321, -127, 776, -417, 736, -333, 981, -552, -332, -3048, 324, 516, 490,
+  1088, -1356, -460, -440, 464, 118, -888, -1536, 912, -480, -1062, 1092, -1768, -1048, 576, 636,
+  -428, -1845, -840, -1212, -2366, 2500, 300, -1233, -1071, -1243, -1938, -798, -396, 2432, -306, -113,
+  3718, 1500, 288, 1638, 472, 225, -1160, -2562, 312, -960, -198, -1265, 546, -675, -1353, 555,
+  -540, -1566, -1176, 535, 2159, -1455, 417, -1104, 333, -872, 2622, 249, 381, -1080, 1419, -882,
+  1768, -1469, -1380, -880, 2204, -590, -1184, -96, -228, 384, -354, -910, 728, -3013, 0, -318,
+  -107, 246, -105, 0, 0, 300, 100, 411, 2142, 0, -204, -532, 0, 128, 714, -113,
+  1144, 375, 192, -1512, -2124, 600, -696, 1342, -728, -960, -1386, 460, -1911, 945, -1722, -333,
+  540, 348, -2646, -535, -1016, 388, -973, -1012, -888, -218, 0, -415, -762, 216, -774, 196,
+  -2040, -1017, -460, -550, 580, 118, -888, -192, -1482, 672, 590, 637, -104, 655, -576, -106,
+  1391, -738, -1365, 707, -338, 0, -1400, -2192, -1071, -1695, -1734, -931, -198, 256, 816, -226,
+  572, 250, 288, -126, -1416, -225, -348, -1830, -416, 1440, 99, 0, 455, -675, -1353, -888,
+  -2700, -435, 2058, -321, 2667, 2037, 834, -552, -1221, -327, -1656, -83, -1397, -540, 387, -196,
+  544, 1130, 115, 770, 116, 0, -296, 768, -1710, -576, 944, 910, -1352, 3013, 576, 318,
+  -428, -1599, 1155, -1515, -1859, -1500, -900, -1507, -1904, 1243, -918, -1596, 1584, 896, 102, -226,
+  -572, -2625, -1152, -630, -2242, -300, -696, 732, -208, 240, -1881, 1495, 1092, 405, 246, -1332,
+  -675, -3219, 1029, -1070, 635, -194, -1251, -2208, -666, 0, -1380, -498, 762, 324, -516, -2058,
+  2720, -1582, 805, 5280, -4408, -1770, -3996, -1824, -2622, -96, -2478, -2548, 832, -3930, -1728, -424,
+  856, 1353, 420, 505, 1859, -1900, 1200, 411, -1190, -226, -1734, 532, -198, -640, 714, -2825,
+  1144, -625, -2304, -1512, -1534, -675, -812, -3538, 1768, -600, -198, -345, -364, 675, 0, -111,
+  270, -1392, 3381, 0, 254, -388, 695, -184, -999, 1090, 690, -1079, 254, -1080, -3612, -1568,
+  -680, 1130, 1150, 2420, -348, -4484, -296, -672, -3990, 1536, 236, -182, -936, -917, -192, 954,
+  -107, -2460, -2415, 606, -507, -500, 0, -137, 1071, -1582, 0, 266, -594, -1024, -612, 565,
+  1144, 1625, -384, 2394, 1062, 75, -2204, -732, 312, -600, 198, 1725, -364, 1620, 615, 1554,
+  -2700, 1218, -588, -856, 1397, 679, -3058, 276, -444, -1090, -1242, -1328, -1524, 108, 129, 1176,
+  680, 1017, -690, -440, 348, 1416, -3848, 672, -798, 384, -708, -455, -2496, 1441, 864, 1060,
+  -1498, 246, 525, -1818, -169, 3600, 700, -1781, 357, -3729, 1632, -931, -495, -2048, -1326, 2373,
+  -3432, 625, -288, 1260, -118, 1575, 2320, -122, -624, 1320, -1683, 805, -3822, 1890, 984, -1776,
+  -540, -1305, 294, -214, -1778, -1843, 1112, -3772, 111, -1417, -966, -83, -1143, -648, 1032, -1764,
+  -680, -2825, 1725, 880, -1276, -2714, -1036, 192, -228, -576, -236, -819, -1456, -2227, 480, 1166,
+  -1070, 3321, 1470, 202, -2873, 500, 2900, -1507, -476, -226, 2754, -532, 198, 2944, 510, 1695,
+  143, 3000, 768, 2394, -354, 150, 2320, 854, 1976, 1440, 2376, -690, 273, -270, -1230, -111,
+  -4185, -957, 1176, 749, 635, 97, -139, 920, -222, 1308, -690, 664, -762, -864, -774, 294,
+  -680, 339, -345, 1430, 1392, -1534, 1036, 1536, 1482, 1824, 118, 273, -1352, 917, 1920, -1908,
+  -214, 738, 210, 101, -845, 400, -1600, 822, -357, -113, 102, 2660, -1584, -3072, -102, -339,
+  -1430, 750, -96, 1134, -1062, -1500, -812, -2196, -2288, 840, 792, 1150, 273, -1350, 861, 1332,
+  135, 696, -147, 642, -254, -873, 973, 0, 222, -763, -138, 83, -889, 0, -387, 1568,
+  -544, 226, 230, 880, -1160, -590, 592, -1248, 114, 672, 590, -182, -728, 393, 672, 212,
+  -1284, -1230, -525, 606, 1859, 400, 600, -2466, -714, -2825, -510, 399, 1188, 512, 714, 452,
+  -858, -1625, -960, -504, 1298, -2100, -2668, -1586, -312, 600, -891, 1840, -364, 2295, 1476, 1887,
+  405, -609, -2205, -1712, -254, 291, -278, 828, 1332, -327, -690, 415, 508, 324, -903, -1078,
+  544, 791, -345, 1430, -348, 590, 1924, -672, -1254, -288, -1770, -182, 1768, 1703, -288, 0,
+  1926, 246, 420, 1919, 507, -1000, -300, -1507, 595, 226, -1224, -266, 495, -512, -612, 1130,
+  143, 1625, -864, 126, -1180, -2475, -580, 366, -104, -360, 495, -2185, 273, 945, 1722, -1332,
+  405, -609, 1470, -1177, 254, 194, 1251, 1196, 555, -872, -1242, 581, -3175, 1944, -129, 196,
+  1768, -1130, 1035, 1540, 348, -2832, 1480, -864, 684, 672, 590, 91, -728, 1834, 288, -106,
+  1391, 246, -630, -1818, -845, 1400, -1800, 1233, -3094, 1469, -1938, -133, 792, -768, -1632, 226,
+  -572, 875, -864, 1260, 3894, -150, -1276, 122, -1352, 3600, -1287, -1265, 728, 1080, 2706, 111,
+  810, 870, 1470, -1177, 2540, 97, -278, -184, 1221, -1090, 828, -1494, -889, -324, 1548, 0,
+  952, -1017, 3910, 550, -1160, -1180, -1628, -1728, -1368, -384, 1770, -728, -104, -1441, -384, 1166,
+  -428, 984, -420, -1212, -3211, -3300, -400, 3699, 1309, -1695, -2244, 1729, 396, -4224, -1122, 0,
+  2288, -1250, 672, 882, -118, -600, -1508, 122, -1040, -4560, -1386, 920, 728, 2835, -1599, -1998,
+  1350, -1827, -588, 535, -1397, 1164, 973, 1380, -888, -1962, -414, -166, 3175, -2484, -1032, 1372,
+  2992, -3051, -3565, 0, 580, 118, 740, -960, 2166, -2784, 826, -1729, -208, -6419, 864, -954,
+  749, 369, -1050, -505, 338, -3100, 400, -137, -714, -678, 1530, -665, -99, 896, -2040, -452,
+  572, -1125, 384, -126, 590, -1125, -696, -1830, 728, -720, 99, -115, 0, -1215, -738, -444,
+  3375, -2175, 1470, 2568, -2032, -1261, 3058, -184, 0, 0, -1656, -996, 1905, 0, -387, 490,
+  136, -1017, 1955, 660, 348, -1180, -888, -672, -798, -192, -1416, -1365, -728, -1441, 1440, 106,
+  -963, 615, 315, 202, 338, 700, -500, 2603, -476, 0, 1326, -2261, 1584, 256, -102, 678,
+  -715, 750, -192, 882, -826, 750, 3016, 122, 416, 1920, -693, -2990, -1456, 1215, -615, -444,
+  1485, -1653, 588, 3745, 2032, -776, -973, -2116, -444, -218, -1380, -913, -127, 216, -516, 294,
+  -136, -452, 1955, -880, -1160, -2124, -1924, -1824, 570, -672, -708, 1274, -1040, 1048, -864, 530,
+  2247, 1968, -1155, -1212, 2028, 300, 300, 411, -1666, -904, 1224, -798, 396, -640, 2040, -1695,
+  143, -125, -1056, 2394, -118, 600, -1276, 1098, 2600, -2760, -1782, 1955, -1001, -2025, 861, -888,
+  -5535, 609, -147, -963, 635, -97, -3197, -2760, 444, -545, -690, 0, 1270, 3348, 0, 980,
+  1088, -1695, -1265, 220, -2436, 826, -888, -1248, -2052, 192, -1770, -364, 208, 262, 1344, 954,
+  535, -246, 525, -2424, -2535, -900, -800, -1233, 714, -1356, 816, -133, 1782, -512, 612, -1808,
+  -1287, 1500, 576, 0, 708, -1125, -1624, -1952, 104, 1320, -1980, 575, 0, -270, -1722, 2886,
+  405, 609, -1617, -2675, -508, -776, 834, 1104, 1665, -654, -276, -996, 2032, 1080, 516, 3430,
+  -272, -2599, -2990, -110, -1740, 944, -296, -96, -3192, 192, 236, 1001, -624, -393, 480, -1272,
+  642, -861, 630, -707, -1521, -200, 2300, 548, -714, -1243, 102, 665, 990, -384, 1326, 339,
+  1144, 0, 288, -378, 708, -525, 1044, 854, -1768, 840, 396, -805, 182, 1215, 1599, -555,
+  0, -870, -882, -535, 1397, -970, 1668, -276, -222, 872, 276, -1162, -1905, -1836, 516, -1960,
+  3264, -2373, 690, -660, 580, 236, -1036, -1344, 1026, -1440, -118, -2457, -1560, -1310, -1248, -424,
+  -2247, 246, -1365, 808, -338, 1500, -400, 137, -1666, -791, -408, -399, -1188, -768, 612, 1356,
+  4576, -125, -1632, 1008, -1062, 600, -928, -854, -1456, -840, 297, 3680, 1456, -2025, -738, 888,
+  405, 1131, 294, -1177, -254, 679, 1946, -276, 222, -1308, 1656, -1245, 254, -972, -516, 490,
+  -1496, -1130, 805, 1650, -580, -1416, 0, 2208, 1254, 672, 708, 819, 1040, 1048, -672, 530,
+  -107, -1230, -630, 1010, -2535, 1700, -100, -2603, -833, 565, -1530, 665, -297, -2688, -816, 1808,
+  2002, 125, 864, 882, 944, 0, 812, 732, -2184, 2520, 396, 2760, -1092, 2700, 123, 444,
+  -1080, 174, 588, -1819, 254, 873, 695, 184, 1443, -654, 276, 830, 1397, -1512, 1032, 980,
+  -1360, -226, -690, -770, -1856, -1062, 888, 1920, 570, -192, 1180, 637, 728, 786, -576, 424,
+  535, -123, 1575, -2020, -338, 600, 500, -1233, 357, -678, 0, 1330, 693, 384, 1326, -339,
+  -1430, 500, 672, 1134, -826, -675, 1276, -1342, 104, 600, -990, -575, -1365, 1485, -738, 1110,
+  -270, 2262, 2058, 214, 508, -194, 834, 184, 1110, 436, -552, 996, -2032, 1080, -903, -1568,
+  -544, -1243, -460, -1100, -696, -1180, -1332, 0, 1938, -384, 118, -1183, -312, 131, 1248, 848,
+  3103, 492, 1575, 0, -5408, -1300, -1700, -4110, -357, 791, 0, -399, -2475, -1920, -2040, 0,
+  1716, 2750, 864, -1764, 1180, -300, 1856, 1952, 104, 2760, -495, -2415, 1365, 4320, 0, 111,
+  -4185, -1566, -6615, 1819, 1778, 194, 1529, 184, 2220, 654, -2622, -2075, -5461, 648, 0, -1372,
+  2040, -678, -230, 330, 0, -1534, -4440, -576, 912, -2016, 3540, -910, -104, -4585, 96, 1166,
+  -428, 2706, -1050, -2020, 3718, 100, -1400, 2329, -1071, 0, -816, -399, 1584, 2816, 1020, -1017,
+  -1430, -2000, 288, -1008, -472, 375, 348, -1220, 624, 120, -792, -690, -637, -540, -369, -444,
+  810, -522, 441, 856, 1524, -388, -556, 1104, -2220, 1417, -1656, -747, -1143, -216, 0, -392,
+  136, 565, 2415, 1100, -1508, -1062, -888, 1152, -912, 384, -2006, -910, -936, -786, -864, -424,
+  1284, 2214, 105, 808, 845, 0, 1300, -137, 833, 113, 1428, -532, -891, -1536, -306, -565,
+  -1144, 500, -96, -756, -1534, -300, 464, 122, 0, 2640, -396, -1035, 0, 1350, -615, -777,
+  -405, 261, -1911, 749, -2286, 0, -973, 552, -222, 545, -1518, -166, -889, -1296, 645, 784,
+  -408, -452, 345, 1870, 348, -944, -2812, -768, -114, 768, -472, -364, 416, 131, -576, 848,
+  -321, 0, -2415, -1010, 1014, 2900, 700, 3836, -714, 791, -1020, 2261, -2277, 2432, 1836, -226,
+  -2002, -125, -1632, -2016, -2478, 150, -812, -1830, 1560, -2400, -1287, 1035, 2548, -1485, -2583, -555,
+  270, 1392, -1470, -428, -1524, 0, -556, 644, -1776, 872, -1104, -664, -762, -540, 1677, 196,
+  2856, 678, 1725, 1870, -1276, -354, -2368, -384, -1710, 288, -826, 1092, -416, 917, -1248, 2120,
+  535, 1230, 0, -606, -338, -300, 1400, 1096, -4879, 113, 306, -931, -3366, -1536, 0, 226,
+  -2717, -625, -576, 0, 708, 975, 1856, 3172, -728, -360, -693, -3795, 455, -1215, -246, -1332,
+  1485, -1653, -1470, -642, 381, 291, 2224, -2944, 555, 763, 1794, -830, -381, -3348, -645, -1666,
+  1088, -1130, 575, -220, -1044, -1534, -1776, -2784, -1140, -192, 1180, -1274, 208, -1179, -2112, 424,
+  535, 1107, 1155, -1717, 1352, -1000, 800, 2329, 476, -339, -714, -1197, -1287, 1280, -612, 1469,
+  715, 375, -1248, -1008, -354, 75, 1740, -366, -728, 600, -495, -1725, -1001, -675, -1722, -222,
+  405, 174, -1029, 2033, 127, -1455, 0, 0, -444, -654, 828, 415, 1270, -648, -774, 2058,
+  1768, -565, -115, 440, 812, 236, -1036, -288, -114, -480, 0, -910, -1248, -917, 768, -1696,
+  -3852, 1107, 2730, -1111, 1859, 500, 500, 548, -1309, 1582, -1020, -798, 1287, -1280, -612, -1130,
+  3146, -250, 480, 1134, -1062, -525, 116, 1952, 1248, -120, -1188, -345, -1638, 0, -1230, -1443,
+  1620, -696, -735, -963, -889, 2231, -973, -184, 888, 763, 414, -249, -254, -2484, 516, 686,
+  1768, 1695, -1035, 220, 1392, 2360, 1332, 192, 1596, -864, -944, -1001, 936, 131, -1248, 848,
+  -2675, -1476, -105, -1414, 2366, 2300, 200, -1781, -1309, 2034, -1224, 532, 0, -2432, -918, 1469,
+  3432, 1750, 0, -756, 2006, 1350, -1160, 244, -2496, 960, -891, -1035, -364, 3240, -2337, -1221,
+  0, -870, -147, -1177, -508, -97, 556, 0, 555, -872, 966, -332, 3302, -972, -3741, 294,
+  1088, 0, -690, -660, 1044, -236, 1924, -288, -228, -672, 2242, 273, 1144, 655, -1056, 424,
+  321, -246, -945, 0, 676, 1000, -1300, 822, -2499, -565, 816, 931, -1485, 2048, -2040, 1243,
+  1144, -125, -1440, -1008, 590, -825, -1276, 732, -2080, -240, -1386, 2185, 182, 270, -1968, -1332,
+  1215, -348, -294, -107, 254, -1940, 1251, -2484, -444, -1308, -138, -664, 0, -1296, -2322, -1078,
+  680, -2034, -2760, -1870, 580, 2124, 1036, 1344, 2622, -672, -354, 455, -312, -2096, -2016, 1378,
+  -2461, 861, 1785, -6464, -2197, -1300, -800, -548, -119, 1921, 1632, -266, -198, -4480, 816, -2599,
+  2288, -1625, -288, 126, -1888, -600, 2204, 3294, -1352, -960, -1188, 1840, -3731, 4860, 1107, -4107,
+  810, -2610, -2205, -214, 381, -485, -3753, -3588, -888, 218, -3726, -1494, 381, 864, 1161, 1666,
+  3944, -339, -690, 880, 0, -2124, -888, -2496, -1140, -96, -354, -1729, -1456, -4716, -672, -2120,
+  2354, 2337, -630, -2222, 2197, 100, 900, 3425, -1904, -113, -2448, 532, -2079, 1408, 1632, -3503,
+  858, -2125, -1440, -630, 1888, 1425, -1044, -1098, 1352, -1560, -1683, -690, 819, -1350, 738, -666,
+  2160, 348, 1176, -214, -254, -97, 695, -920, -1443, 981, 2070, 2158, 1397, -1944, -129, -98,
+  1360, 1808, 1840, 2200, -812, 236, 1184, 288, -3078, -1248, 0, -637, -728, 1572, -576, -1908,
+  -428, -984, -420, 808, -3042, -2700, 0, -685, 2261, -2147, 918, -798, 792, 768, 306, 1243,
+  -1287, 1375, 864, -378, 354, -1350, 696, -488, -1352, 720, -396, -805, 1911, 1485, -123, 666,
+  -2430, 870, -1323, -1070, 889, -1552, -2919, 644, -1554, 1199, -2070, -1494, 127, -1620, -387, 980,
+  1496, 565, -805, 1870, -1160, -472, -740, -672, -684, 288, -1652, -1183, -3120, -1048, -768, 848,
+  -2033, 861, 735, -101, 1352, -2200, 1700, 3562, 595, -226, 1938, -1064, -198, 1024, 816, 1582,
+  -3432, 250, 0, 0, 1652, 1500, 928, -1708, -1456, -1080, -99, -1380, -1001, -135, 492, -888,
+  945, -87, 2646, 1926, 381, -2910, 1112, -2852, 111, 0, 1932, 747, 1905, -1404, -2322, -1176,
+  1904, -1356, 2070, 1430, 2436, -2360, 1776, -1344, -1824, -1920, -3186, -910, 728, -1572, -1632, -1590,
+  -321, 492, 2520, 1616, -1183, -2300, 1700, 1644, 1428, 3277, 1836, -1330, 297, -2688, -2448, -2147,
+  -3146, 125, 864, 1764, -472, 675, 3364, 2196, 1664, -1200, -495, -2300, 0, -3240, 1230, 1443,
+  -405, 435, 1764, 856, 254, -776, 2085, 1932, 666, 763, 1656, -498, -254, 0, 516, -980,
+  1360, -1356, 2415, 990, 116, -1652, 1332, -672, 1938, -1728, -236, 1092, 208, -524, -192, -424,
+  1926, 0, -105, -1010, -2028, -600, -700, 274, -952, 565, 918, 0, 99, -1152, -2448, 1130,
+  1716, -125, 960, 2016, 0, -75, 1624, 488, 1248, -480, 792, 115, 364, 945, -615, -111,
+  945, 609, -735, 1284, 127, 582, -834, -460, 2220, 218, -690, -2407, 127, 540, 1548, 980,
+  -544, -2147, 1380, -1430, 580, -354, 2516, 960, 1482, -864, -354, 1547, -1664, 0, 192, -636,
+  -1605, -615, 0, 1111, -1859, 900, -1000, 1096, -1190, -1469, -1530, 665, 198, -1024, -918, -1243,
+  1001, 125, -1632, -1260, -118, -2100, 464, 244, -520, 960, -1683, -920, 91, 1620, -492, -1110,
+  1755, -696, -2499, 0, -635, 485, -278, -1564, 2775, -545, 414, 0, -508, 0, 387, 490,
+  -952, -1808, 690, 440, 464, 354, 740, 0, 1140, -768, -236, 91, -1040, -1834, -768, 0,
+  535, -2460, -210, -404, -3718, -100, 300, -1370, -952, -1130, -2244, 532, 0, -640, 102, -2599,
+  3003, -500, -960, 1512, -1888, -225, -812, -732, -3120, 1080, 792, 115, -1365, 1755, 1107, -999,
+  -270, 0, -2352, 107, -127, 679, -2224, 1472, 1776, -654, 1932, 581, -2540, 216, -903, -196,
+  -1496, -1356, -115, 110, -116, -472, 2812, -576, -228, -1344, 354, 1092, -832, -1179, 288, -106,
+  -214, -1230, 1365, 1818, -1352, -900, -500, 3014, 952, -2260, -918, 1330, -198, -384, 1326, -1695,
+  -4004, -1750, 2592, -126, -1888, 75, 348, -1586, -832, 120, -198, -115, 728, -675, -1107, -444,
+  4455, -261, 588, 2568, -889, -291, -3475, 2024, -1776, -2289, -1104, -332, -254, 0, 645, -882,
+  -1496, 1582, 345, -1100, -3132, -1180, -444, 1056, -1140, -672, -1770, 2548, -624, -524, 960, 2014,
+  2354, -2337, -1680, -2424, 1521, 0, 1200, -6302, -5474, 1921, 1020, -3192, 198, 640, -1734, -1017,
+  2002, -3250, 1824, -2268, 4366, 975, 4872, 3294, -520, -840, -3168, 230, 637, -810, -3690, -2220,
+  -3105, -1827, -4410, 1284, 3683, 582, -1390, -1012, -1554, 3270, -5934, -1245, -2921, 216, 2580, -196,
+  -408, 1808, 1610, 1650, 232, -5428, -4440, -1920, -1254, -864, -2832, -2548, -832, -393, -576, 1272,
+  -1391, -1476, -2625, -707, -845, -700, 1700, -2192, 1190, 1356, -510, -1596, -990, -896, 102, -1582,
+  -286, 250, 1632, 756, -1534, -1125, 928, 2562, -1664, 3240, 495, -115, -2093, -135, -246, -1776,
+  -1215, -1131, -441, 1177, 381, -776, 695, -644, 555, 654, -1794, 249, -1397, 972, -645, 196,
+  -680, -678, 2070, 220, 696, -944, 1480, -960, -228, 1248, -1770, -455, -208, 0, -288, -1696,
+  0, 615, -420, 2525, -3211, 1100, 0, -137, 238, -226, 306, 532, 297, 896, 1836, -1017,
+  -143, 1625, 1248, 2646, -1062, 375, 116, -1098, -1352, 600, 1584, 2185, -819, 540, -246, 111,
+  -135, 261, 147, -535, -762, -1746, 417, -460, 444, -436, -276, -83, -127, -756, -258, 196,
+  -544, 0, 0, 660, 1276, -2006, -1480, -2400, -570, -384, 590, 546, 208, -655, 1920, 1272,
+  -1712, 492, 315, 303, -1859, 0, -2300, 959, -1547, 1921, -918, -266, -495, 1152, -1326, -1243,
+  1716, -125, 288, -3402, -1652, -975, 1624, -1830, -416, 1080, -1188, -1265, 1820, -3645, -1107, 888,
+  2160, 0, 441, -107, 127, -1164, 3892, -736, 666, -1308, 138, -581, -889, -1620, -1548, 98,
+  4352, -3277, 460, -770, -928, -1770, -1184, -1824, -114, 864, -2478, -182, -2496, -2096, -1248, 106,
+  963, 492, -1260, 202, 169, -500, -1000, 1096, -119, 565, 612, -798, -2079, 384, 1530, -1695,
+  2574, 1375, 672, -1386, 472, -1350, -1276, -732, -1664, 1200, -1980, 460, -273, -1485, -984, 111,
+  1485, -1740, -2058, 1498, 0, -97, -139, -1012, 222, -1090, -552, 0, 1016, -2484, 774, -1274,
+  680, 226, 1380, 1430, -580, -2242, -592, -480, 0, 2016, -944, -273, 728, -1441, -1440, -318,
+  107, -984, -525, -101, -2197, -800, -300, -137, 357, 1130, -1122, 1064, -1188, -1024, 1836, -1243,
+  0, -2125, 0, -1386, 590, -1650, 0, -1708, 104, -720, 495, -1495, 455, -2160, 246, -1221,
+  405, 696, 735, -535, -2159, 970, 417, -828, -333, 872, -2898, 913, -889, -432, -387, 1176,
+  544, -1130, -575, 990, 0, -1770, 592, -192, 2508, -2400, -2478, -819, 936, 655, -864, 1060,
+  428, -492, 945, -505, -1183, 1000, 100, -137, 3213, 1017, -510, 266, -891, -2176, -204, -3051,
+  143, -2125, 192, 504, 826, 0, 116, -610, -1040, -1920, 2178, 920, -455, 405, 123, -777,
+  945, 957, -2058, 1926, -1397, -388, 0, 184, 555, 763, -414, 332, -4318, -1836, -516, -1568,
+  272, -904, -1725, 550, -1392, 1298, -1628, 1728, 2394, -96, -1770, 728, 520, -1179, 1152, 530,
+  -642, -1599, -1260, 1616, 169, -1000, 1600, -137, 1785, -904, -102, 0, 0, 1536, -306, 2147,
+  -1716, 2625, 96, -252, 1534, 900, -464, 610, 1040, -480, 99, -1035, -1092, -270, -1722, 1554,
+  -270, 870, 2205, 0, 254, -1164, 0, 0, 444, 763, -552, 83, 889, -1620, 645, 784,
+  -1904, 1130, 0, 2640, 2088, 236, -444, 1728, 798, 384, -708, -364, 1768, -2096, -384, 1484,
+  1391, 369, -1995, 101, -3549, -600, 1300, -1918, -952, -1130, -306, 2527, 891, 1152, 1122, 113,
+  -3146, 875, -768, 504, -1416, -225, -2204, -976, 832, 480, 0, 1610, -182, 135, -861, 3330,
+  -135, 3306, 0, -1498, 1270, 0, -973, 0, 222, 545, -138, 1992, -254, 2376, -774, 2646,
+  -2176, -1695, 115, 1320, -232, -472, -148, -576, 570, 960, -590, -1456, 1352, -1572, 960, -1590,
+  -1177, 1353, 1575, 101, -2197, 1300, 800, 959, 4879, -2712, -1020, -665, -297, -2048, 2550, 678,
+  -572, 2750, 192, 252, 1180, -375, -812, 366, -2288, -240, -297, -2875, -819, 1215, 738, 444,
+  -1620, 2436, 735, -1284, -1016, 2134, -695, -92, -222, -327, 276, 498, -2159, 2592, -1419, -98,
+  -816, -904, -3220, 1540, 348, -2596, -1480, 480, 1368, 864, 2006, 1456, 3224, 262, -288, -1166,
+  1177, 738, -315, 2121, 1690, 1300, 300, 959, 2737, -1356, 510, 266, 1782, -640, -510, 226,
+  2431, 0, 480, 1134, -1062, -450, -232, -3172, -312, 1560, -99, -460, 0, 1620, 2952, 1332,
+  1755, -261, 2205, -107, -1143, -1067, -278, -184, -222, -327, -828, -1577, -508, -1944, -129, 490,
+  -1496, -1130, -1265, -1320, -812, 1888, 2812, 384, -456, 288, 944, 1547, -1352, 1310, 768, 318,
+  -428, -1845, -420, 303, -3211, -800, 100, 1507, 3213, -1582, 408, -1729, 594, -2048, -816, -791,
+  -715, -1500, 2112, -1260, 2124, 75, -348, -488, 520, -720, 1881, 575, 1183, -1350, -861, 111,
+  135, 1479, -882, 428, -1270, 0, -3197, 828, -222, 436, 2346, -498, 762, 216, 1548, 686,
+  -1904, 226, -115, 0, -348, -1062, -1184, 768, 2394, -576, 826, -1092, 208, 786, -288, 0,
+  -214, -738, 315, -505, -676, 700, 0, -1233, -119, 1243, -306, 1995, 2178, -2560, 1632, 904,
+  -143, 125, 2016, 2394, 1888, -1350, 2552, -244, -1248, 1920, -198, 2645, -2184, 405, 2091, 999,
+  -540, 1131, -3087, 642, -635, -970, 556, -1104, 777, 1635, 966, -664, -1397, 756, 516, 1372,
+  136, 113, -230, -440, -1508, -1652, -1480, -288, 228, 1152, -1180, -546, -1352, -786, -1152, -742,
+  963, 2214, 0, 1212, 1183, 100, 0, -137, 1428, -339, 0, 1330, 297, 0, 510, 2147,
+  -2145, 1875, -576, -504, 236, 1050, 580, -1952, -1560, -2040, 99, -2300, 273, 1755, 1845, 444,
+  -1755, 2697, -2352, 428, -1016, -1940, 139, 1104, 0, -1526, 690, -166, -2540, -432, -129, 1274,
+  2040, -678, 460, -880, -348, -2124, -592, 384, -2280, 672, 236, 1183, -104, -262, 384, 1696,
+  1284, -123, -1785, -1010, 1014, 400, -1700, -1233, -238, 678, -918, -532, -891, 128, 1326, -904,
+  -3289, 125, 480, -2016, -590, 900, -232, -1952, 520, 240, 99, 230, 273, -1485, -492, -888,
+  0, -783, -882, -1177, 1143, 1067, 0, -184, 333, 436, -690, -1743, -1905, 1080, -516, 490,
+  -1496, -678, 1380, -440, -1856, -1652, -1480, 384, -228, 1536, -236, 1547, 0, -131, 480, 742,
+  -535, 492, 105, -404, -169, -500, 2600, -411, -595, 791, -1326, 1064, -495, 1280, -510, 226,
+  -1430, 750, -1056, 1008, 944, -1125, -116, 1220, -208, 600, 495, -1150, 819, 1215, 861, -1110,
+  1215, -1131, 1176, 963, 2159, -1067, 1251, -276, -888, 327, 552, -1079, -889, 864, 0, 588,
+  544, 113, 1495, 110, -1044, 1416, -592, -960, 342, 0, -826, 1547, 728, -1441, 480, -742,
+  -1177, -738, -630, 505, -1521, 700, 1000, -411, 238, 565, -1530, 266, 990, -2048, 1020, -1921,
+  1001, -1625, 96, 1008, 590, 300, -464, -366, -312, 840, 1683, -690, 455, 1890, 738, -1998,
+  675, -1914, 294, 1926, 635, 194, -3614, -828, 1110, 2180, 1380, -996, -1778, -1296, 3096, 588,
+  -816, 113, 690, -660, -1044, 944, 740, 0, -912, 1152, 0, 273, -1144, -1179, -192, 1272,
+  -535, 492, -315, 1010, 338, -1600, 1200, 2740, -595, 1695, 102, -2926, 1188, -256, -204, 339,
+  -3146, -250, -96, 252, -236, 300, 232, -488, 520, -2160, 99, -805, -455, -2160, -984, 0,
+  1620, -348, 3234, 214, 1270, -1552, 556, 1380, 222, 1853, -1380, 1079, -1778, -540, -3096, 1666,
+  680, -1469, -1150, -2200, -464, -708, -2960, -1152, -2508, -384, 590, -1365, -2184, 2358, 672, -1590,
+  -1177, -984, -1470, 1313, -1690, -2200, -3500, -137, 1309, -2825, -612, -665, -3168, -1536, 2142, -678,
+  -286, 1125, -288, -3024, -3422, 600, -1044, -5856, -2808, 240, 1287, -4025, 819, -1350, -738, -111,
+  -270, 1392, 3675, -535, -3556, -679, -556, 736, 2331, -5886, 1656, -166, -1143, -756, -4386, -784,
+  -1904, -3164, 0, 1870, -1856, 118, 1184, 576, -2850, 2400, 708, 1456, 520, 4323, -576, 1484,
+  -1177, -2583, -105, 707, 0, 100, -1900, -1507, -238, -339, -1224, 532, -1188, -768, -102, 678,
+  1430, -1875, 576, 1764, -472, -975, 812, -2074, 0, -480, -594, 575, -1820, 675, 2460, -2442,
+  3510, 435, 588, 1926, -1778, 485, -695, 1012, 777, -872, 2208, -1494, 1524, 324, 0, -392,
+  -1224, -113, 805, 550, -1044, 472, -2812, 96, 0, -768, 472, -364, 1352, -2882, 1728, -106,
+  1177, -1107, 420, -1515, 507, -800, -100, 2055, -595, 2938, -612, -532, -1386, 256, -918, -113,
+  -2860, -2125, -96, -630, 708, -225, 1276, -366, 832, -1440, -99, -460, 1092, -1890, -861, -111,
+  -810, -174, 588, -107, -254, 970, 1112, -460, 666, 872, 690, -747, 508, -108, -129, 686,
+  1224, -452, -115, 550, -1972, 708, 740, -1248, 1368, -1440, -708, 455, -416, 0, 576, -106,
+  642, -861, 210, 707, -1521, -1000, -500, -1918, 119, 1921, -102, -532, -792, -1024, 816, -113,
+  -858, 375, 672, -504, -826, 375, -1044, 0, -728, 2400, 693, 230, 1001, -270, -1722, -3330,
+  270, -87, -2058, -428, -127, 485, -1112, 184, 1110, -1635, -138, -498, -2540, 0, -1290, 686,
+  1088, 904, 2530, -1430, -232, 826, 444, 1248, -456, 384, -236, -455, -2184, -786, -1440, 1590,
+  749, -369, 525, 1616, 1352, -100, -1200, -1644, 595, 1356, -102, -2394, -990, 256, 204, 1469,
+  143, 250, -2688, 126, 1062, -2700, 928, 610, -1872, 120, 0, -2530, -2275, -270, -1353, -2664,
+  675, -1305, -1323, 749, -889, 1358, -278, 1012, 1110, 327, 690, 581, -1143, -1188, -1161, -98,
+  -272, 678, 1495, 770, 3016, 3068, 740, 0, 0, 288, 1534, -182, -624, -2489, 1440, 848,
+  1284, -2091, -2835, 101, -338, 1800, -1700, -2877, 357, -904, -1734, -1197, -198, -256, 2346, -452,
+  1859, 2625, -864, 2268, -826, -300, -1624, -1098, 104, 840, 891, 920, -273, -1620, -984, 888,
+  -1350, -522, 588, 963, -508, 2716, -834, 920, 444, 654, -2346, -664, 889, 1512, 1161, 588,
+  -1768, -1017, -690, -220, -580, 1180, 2368, 288, 798, 288, -1534, -1001, 416, 131, -864, -1378,
+  -535, -2583, 525, -2525, 2197, 1000, 500, -1370, -476, -1130, -1734, -266, 693, 640, 102, -565,
+  286, -2000, -192, -2394, 2124, 225, -1276, 1464, 208, 1200, 990, -1380, -91, 945, 1599, -444,
+  -1890, -957, -1470, -1819, 0, 873, -973, 920, -777, 327, -2346, -913, 1270, -324, 3096, -784,
+  -2040, -113, 230, -880, 696, -118, 296, -1344, -456, 384, -2006, 455, 208, -524, -1248, -742,
+  535, -246, -1050, -303, 1183, -400, 400, -1233, -238, -1243, -2448, 399, -99, 1152, 1020, 1356,
+  -1001, 2125, -288, -1386, 0, 450, -464, 488, 624, 0, 396, -1035, 273, 135, 123, -1221,
+  -540, 522, -1029, 856, -254, 291, 973, 736, 1221, -327, -828, 166, -1016, -432, 1806, -686,
+  -136, -1582, -920, 1100, -464, -826, 1776, 1248, -1482, -1056, -944, 637, 728, 524, 576, -636,
+  1284, -2214, -1050, 1717, -169, -900, -800, 1096, 357, -226, -2346, 2793, -990, -640, 102, 1243,
+  858, -500, 1056, 126, 236, 525, -1392, -366, -1872, -1560, 1089, 1265, -273, 2295, -738, -888,
+  540, -609, 294, 1284, 127, 873, -1807, 736, -333, -1744, -2070, 498, 635, 324, 2709, 686,
+  -136, 113, -460, -990, -2668, 2006, 148, 576, -798, -672, 354, 1456, -1144, -262, 384, 318,
+  1712, -1107, 105, 1212, -1521, 1800, -800, -274, -1904, -226, 1734, 532, -99, -2944, -408, 226,
+  -286, -1000, -1440, 378, 3422, -2700, 1508, 2806, -416, 1080, 198, -3795, 0, 0, -123, 777,
+  1215, -2088, -2058, 1177, 1143, -291, 2641, -184, 2331, 0, -138, -1411, -2794, 1404, 2451, 490,
+  3264, -2486, -2185, -3190, 116, 1652, -2664, 480, 1254, 0, -590, -637, 1040, -1048, -1248, 2332,
+  749, 1968, 0, 1010, 1690, 1800, -2400, -685, 119, -226, -510, -133, -891, 1024, -510, -904,
+  715, -1250, -1536, -630, -1888, -1350, -1856, -1220, -312, 2400, -693, -575, 455, -1350, 2829, 777,
+  2430, 609, 2793, 428, -254, -679, 1946, 644, -666, -654, -2070, -996, 254, -864, 1419, -490,
+  272, -565, -1840, -880, -232, -1062, 1184, -1248, -1596, 960, 0, 91, 520, -1048, -576, 742,
+  -428, 1230, -1050, 101, -1183, -1200, 1200, -1644, 1428, 113, 204, 665, 1485, -2688, -306, 452,
+  -1573, -500, 672, -882, -708, -1275, -1044, -732, 1144, 360, 1089, -1035, -1092, 675, 1599, -1554,
+  -945, 174, 588, 535, -889, 194, -1390, 184, -1665, 2507, 690, -1743, -381, -108, 1677, -392,
+  -408, -452, 1610, -220, -1508, 118, 296, 384, 912, -480, -590, 364, -728, 1965, -192, -636,
+  1391, 246, 735, 0, 1859, -1500, 500, -548, -238, 1243, -1428, -266, 891, -896, -102, -1243,
+  -143, -1750, -192, -4032, -944, -300, -812, -488, 520, -2520, 297, -345, -910, 270, -615, -1665,
+  -2295, 870, 0, -642, -1524, 1843, 1112, -920, 1332, 1090, -2208, 83, -2413, -108, 774, 1568,
+  -952, -904, -1495, -1100, -4060, 1888, 444, -864, 1938, 864, 2596, -1183, -1976, 1048, 288, -1908,
+  -1712, -1845, 1890, 303, 338, -500, 900, -411, 2261, 1017, 1632, -532, -2178, -1920, -408, -565,
+  -858, 375, -1248, 252, 590, 600, -1972, 0, 312, 120, 198, -1035, 546, -270, 1845, 111,
+  -3780, 1131, 1176, 856, 1651, 291, 2919, -920, -888, -981, 690, 498, 3048, -3240, -3354, 294,
+  -1632, -678, 0, -990, 232, 944, 1036, 768, 1596, 672, 236, 182, 312, -1048, 480, -742,
+  1177, 1599, 2415, 707, -169, 800, -1700, 822, -476, -1017, 510, 532, -891, 768, 408, -1017,
+  -143, 1625, 480, 756, -2006, -375, -2204, 1220, 832, 1080, 1188, 1725, -455, -2295, 1107, -777,
+  3510, 87, 147, 1177, -889, 485, -417, 828, 1443, 1417, 552, 1079, 2159, -432, -258, 490,
+  816, 1130, 0, -660, 1740, 1652, 1480, 960, 456, -384, 2950, 0, 312, 524, 576, 742,
+  321, 738, 315, -1111, 2028, 0, -1400, 548, -238, -113, 0, 1197, -198, -384, 306, 1808,
+  0, 750, 1440, 1260, 1062, 1125, 1044, -976, -2184, 360, -1287, -805, -819, -2835, 246, -1887,
+  3240, -435, -441, 1819, 1016, -194, 417, -460, -666, -109, -552, -913, 1651, 0, -774, -980,
+  1632, 791, -460, -330, 696, 118, 444, 960, 912, 288, 1180, -273, -104, 655, 1056, 212,
+  214, -123, -315, 1414, -1690, -700, 900, -411, 952, 678, -816, 0, 1485, -640, -102, -565,
+  1716, 750, 960, 1008, -590, 525, 1856, -610, 624, 360, 198, -805, -273, -2025, 369, 888,
+  -675, 1566, -1470, 214, -889, 485, 695, 828, 222, 1090, 690, 498, 1016, 1620, 903, -294,
+  1904, 904, 1265, -3190, 2204, 236, -592, 864, -1482, 480, -354, 1274, -624, 917, -960, 636,
+  2354, 246, 0, -1212, -3380, 1200, -700, -2192, -357, 0, 408, 1463, 198, 128, -408, -565,
+  0, 875, 480, -3654, 236, 1275, -928, 1586, -1352, 2040, -99, 0, 1365, -675, 246, 777,
+  -1215, -174, 735, 963, 889, 582, 278, -1472, 777, -2725, -2208, -166, 635, -864, 2451, -490,
+  -1224, 1921, 460, -110, 1624, 944, 2072, 384, -1596, 192, -1062, -364, 104, 131, 192, -636,
+  -1712, 1599, 420, 1515, 0, 2300, 1700, 2740, 3927, 1130, -204, -3325, -693, -1408, -2142, 565,
+  -1001, 2375, -1824, -882, -2596, -1125, -1740, 3538, -5616, -1080, 396, 460, -3094, 135, 369, -1110,
+  -2160, -957, -1029, -107, -889, -388, -1668, -1840, 555, 2834, -1104, -332, -1143, -1836, -3483, -196,
+  2040, -904, -2415, 880, -3132, 590, -1776, -576, -1026, 576, 118, -364, 520, -3406, -192, 1908,
+  2354, 246, -735, -606, -1352, -400, 1000, -822, 0, 339, -102, -1463, -792, -1280, 102, -678,
+  572, -500, 288, -1512, -472, 225, -812, 488, -312, -1800, 792, -920, 1456, 1350, -246, -1998,
+  675, 435, 0, -428, 1651, -1164, -1529, -828, -1110, -872, -138, -996, 1016, 540, -1161, 980,
+  -2584, -1017, -690, 770, 580, 1062, 148, 672, 798, 672, -1416, 728, -520, -524, 0, 1060,
+  -1284, 369, -210, -1717, 169, 1100, -900, -137, -357, 1695, 1224, 2527, 891, -1152, -1020, 0,
+  -1287, 0, 384, 378, -1534, -675, 1508, 610, -1144, -600, -99, 0, -728, -405, -1845, -1443,
+  1485, -87, 1029, -535, 127, 776, -3475, 184, -1110, -1635, -1656, 332, 1016, -1944, -1935, 294,
+  -1632, -1243, 2070, -220, -1624, 1534, -1184, -1152, -1254, 384, -472, -1183, 624, -1310, -1056, 0,
+  -1284, 1476, -1470, 2222, -1690, -1300, -600, 1781, -2737, 452, 918, 532, 0, -1664, 2346, 2486,
+  0, -625, -1344, -1260, -2006, -525, 4640, -2440, -1144, 2280, 99, -1265, -1638, 2700, -738, -1443,
+  -810, -348, -2058, 0, 889, -97, 3058, 1564, -1998, -1526, 138, -249, -889, -3564, -4257, -1470,
+  -136, 1243, 3450, -990, 2320, -118, 2960, 768, -456, -864, -472, 1183, -1352, -131, 1440, -2438,
+  107, -246, 0, 909, -338, -600, -200, 548, 1309, 565, -1326, -133, -1188, 256, -1020, 1356,
+  1859, 875, 480, 1386, -2006, 75, 1856, -488, -3224, -480, -1584, 230, -273, -675, -1599, 1332,
+  -270, -174, -1176, -1498, -1270, 1164, -278, 1472, 777, -218, 0, -830, -2540, 108, -1548, 294,
+  680, -1921, 115, 550, -1972, 354, 0, -288, -2394, 768, -236, 2912, -1456, 1965, 576, 1272,
+  535, 861, -210, -1515, -1014, -200, 400, -685, -714, -1017, -2244, -1064, 1188, 768, 0, -1808,
+  715, -125, 1344, 126, 1770, -750, 232, -488, -104, 480, -396, -1610, -182, 1215, 861, -444,
+  -675, 348, 2205, -963, 508, 1164, -834, 184, 1998, 1308, -1104, 249, -1651, 2592, 1419, 196,
+  -1224, 226, 3795, 1980, -2088, -354, 740, -1440, -684, 672, 1652, 728, 624, 1965, -1344, -1060,
+  963, 492, 315, -1717, -2535, -300, 200, 2740, -1666, -1808, -1326, -399, -1089, 896, -306, 0,
+  2145, 0, -1824, 2394, 1062, -150, 1392, -732, -1248, 840, 792, -920, 546, 405, -2091, 222,
+  810, 0, 3528, -428, 381, 1164, -1390, 92, 0, -218, -690, 581, -762, 108, 129, 392,
+  -544, -1469, 460, -440, 1044, -1770, -444, -480, 912, 480, -1416, -273, -624, 524, 192, -212,
+  107, 2091, -1155, 808, -507, 900, -600, -959, -1190, 678, -1530, -399, 1584, -768, 1326, -1130,
+  858, -1250, -864, 1764, 1180, -450, -696, -2318, -728, 480, 693, 575, 273, -540, 1353, -1332,
+  -1620, -783, -147, -535, 508, 1261, -417, 1012, 1443, -436, 828, 332, 2540, 2376, 2064, 686,
+  -952, 226, -920, 0, -696, 590, -444, 480, -1368, -96, 354, -273, -728, 2096, -384, 636,
+  1391, 0, 945, 1010, -2704, -500, -300, -1096, 119, -226, 306, 1596, -297, -1536, 1428, -339,
+  -1287, -1625, 1536, -2268, 236, 675, -1160, 488, -1352, -4200, 0, -690, -273, 1350, -1476, 888,
+  1215, 1479, 1911, 428, -1524, -388, -1251, -1012, 1665, 436, 1932, 1494, 3810, 756, 0, -784,
+  -816, -339, -575, -2310, 1392, -2360, 1776, 576, 912, -96, -1888, 1092, -936, 1441, 576, 1166,
+  -107, -2214, -945, -707, -4394, -1600, -1800, -2603, -833, 2825, 2244, -1596, -198, 640, -1632, 1017,
+  3861, 750, -960, -882, 1652, -150, -2088, -610, -2080, 1920, 1089, 460, 1456, -1890, -2952, 0,
+  -4725, -696, -1617, -214, 1524, -1552, -1807, -460, -777, 1417, 0, 166, 1270, -3348, -2064, 686,
+  -1224, -4068, -920, 550, 4060, -472, 592, -1440, -570, -1440, -1534, 728, -4264, 393, 192, 742,
+  -2675, 1230, 420, -2323, 1352, 900, -2200, -959, 476, -1243, -1020, 266, 297, -896, -1428, -1582,
+  -429, 1250, -192, -756, -2596, -525, -812, 854, 0, 600, -792, 115, -2821, 2835, 0, -999,
+  -675, 1392, -1764, -1177, -1778, 2910, 139, -552, -1665, -872, 276, 332, 1651, 864, 387, -1176,
+  -408, -113, 115, -1210, 348, 354, -592, -1728, -228, -768, 236, 91, 2184, -2227, 672, -1908,
+  1070, -369, -210, -1414, 2197, 100, -400, 3014, 1785, 1469, 204, -931, -1584, 1152, -612, -904,
+  -858, -250, -1152, -504, -944, 825, 348, -1464, 520, 840, 1188, 2415, 273, -1485, -1599, -999,
+  540, 0, 1029, -1070, 254, 1940, 695, -1472, 1221, 0, -1242, 1162, 254, -756, 2322, -882,
+  1360, -565, -1840, -660, -116, 0, -296, 1056, -1368, 384, 472, -637, -832, 524, 480, -424,
+  0, -369, 315, -2121, -1014, -1400, 1100, 137, -1190, -339, -2040, -1197, -198, 1664, -918, -1130,
+  3861, -500, 768, -882, -944, -75, -812, -366, 208, 1200, 1485, -575, 1820, -405, -2829, 222,
+  1890, 348, -2058, 749, 127, -97, -1807, 276, -2331, -981, 3174, 1079, 762, -108, -1290, -392,
+  2176, -1243, 2300, -110, -116, 472, -2812, -480, 0, 384, -590, -1274, 936, -1048, -1536, -318,
+  749, 492, -2520, -606, -507, 1300, -1500, 137, 1071, 113, 510, -532, -594, -128, -510, -2486,
+  572, -625, -1536, 126, -3186, 0, 2668, 488, 104, -1200, 0, 1150, 273, -1485, -1230, 999,
+  540, -1218, -1911, 214, -508, -291, -556, -552, 444, -2289, -138, -332, -762, -108, 1935, -196,
+  408, -226, 1380, -1320, -1044, 1888, 148, -1152, -114, 480, -590, -91, 104, -393, -96, -530,
+  0, -2460, -1365, -707, 338, -600, 300, -2329, 1190, -1243, -816, 4123, 990, 768, 612, 113,
+  1001, 250, -960, -1134, -472, -300, -2088, -1708, -1768, 840, 495, 345, 0, 270, -1968, 1221,
+  -675, 870, -1176, -1070, -254, 2037, -139, 0, 1110, 872, -828, 1162, -1905, -540, 1677, -2352,
+  0, 113, -690, 110, -1508, 236, 296, 96, -2052, 672, 472, 455, 1248, -655, -288, 1908,
+  963, -738, 1050, 1414, 1183, -600, -1100, -2192, 0, -904, -204, -133, -99, -256, -1938, -791,
+  858, 1250, 1920, 3024, -2006, -1875, 1044, -1952, 104, -1560, -198, 0, 91, 1350, 1230, 1554,
+  -1620, 435, 2205, 1070, -254, 97, -556, -552, 888, -327, -690, -996, 635, -108, -4386, -686,
+  2448, -565, 2185, 1100, 580, 590, 1628, 480, -1710, -576, 2124, -273, -520, -393, 768, 1166,
+  -214, -3075, -1470, 1010, -1521, -2000, -1000, -2055, -476, -678, -1632, -1197, 594, 0, 612, 1243,
+  1287, -125, 2976, -1134, -2242, -600, 1508, -1708, -2392, -240, -594, -1610, -910, 810, 861, 666,
+  -3105, -348, -1911, -642, 889, 679, -1112, -92, -1665, 218, -1242, -415, -1651, 1188, -387, -490,
+  3128, -2938, 115, 2970, -232, 1770, 444, -864, 1140, -192, -2006, 182, 0, 131, 1056, -1696,
+  1070, 1107, 945, 707, 2704, -900, -1800, -1644, 357, -226, 0, 133, -1287, -1920, -816, -2373,
+  1144, 2000, -480, -2016, 118, 75, -580, -976, -1144, 3120, -1683, -3565, -91, -405, 1230, 2664,
+  -3240, 174, -441, -1284, -1905, 485, -2224, 1288, -666, -763, -1104, -913, 127, 1836, -903, 2352,
+  -3536, 0, 1495, 660, -464, -1416, 1776, 1728, -1482, 1056, 1770, -1729, -2912, 131, 1248, -1908,
+  -2568, 3444, 2205, 1818, -338, -700, 2400, 2329, 2975, -3051, -816, 665, -1287, -512, -1734, -113,
+  286, 1000, -96, -4158, 1534, -2250, -5684, -1464, -624, -2160, 990, -805, -1638, 3915, 369, -777,
+  270, -87, 294, -535, -2921, 970, 1112, 828, -5328, 763, -138, -913, -508, 648, -903, -490,
+  -1360, 452, -1035, 1430, 232, -826, -1036, 2016, 3078, -2784, 826, 182, 624, 2751, -2688, -4876,
+  -321, -1230, -630, 2525, -3042, -1000, 500, -1370, -238, -226, -612, 931, 1683, 768, 1326, 565,
+  -429, 375, -1632, -252, 944, -2100, 232, 122, -1976, -240, -396, -1725, -819, 405, 2091, -1776,
+  1215, 87, -3087, 214, -889, -388, 3197, 184, 444, 545, -966, -2324, -762, 1296, -1935, -196,
+  -408, 2147, -345, -1980, -464, -118, -2220, 1728, -798, 1152, -708, 91, -2392, 655, -288, 1060,
+  -428, 0, -1050, -505, 845, -500, -400, 2877, -357, -1469, -1428, 798, 594, 256, -510, -678,
+  286, 1625, -1632, -2142, 0, 75, 464, 366, 208, 2280, 495, -690, -546, -1890, -246, 777,
+  2295, -522, 294, 963, -127, -1649, -834, 828, -222, -218, 966, -1328, -1016, -756, 1290, -1078,
+  -136, -1695, 115, 550, -2088, -708, -1924, -1824, -3876, 672, 944, -91, -1768, 1441, 960, -530,
+  -963, -1722, -420, 1717, -2535, 300, -1100, -1918, -476, -904, -2142, -1197, 891, -1792, 1020, 452,
+  143, 1375, -1152, -252, -472, -150, -348, 244, 2496, 1080, 594, -920, 273, 405, -615, 999,
+  -1890, -870, 588, -1605, 127, 970, 1390, -276, 0, 327, 552, -913, -762, -2160, 516, 0,
+  544, 904, 2875, 1540, 2088, 236, 2812, 1152, -1368, -1728, 236, 1547, 1560, 1310, 672, 0,
+  1070, 246, -1470, -707, 3042, -300, 2500, 1781, -476, -452, -3774, -133, -792, 1920, 102, -904,
+  286, 2000, 96, 1008, -1652, -75, 3364, -244, 832, -600, 891, -920, 273, 810, -369, -222,
+  1755, -1566, -1617, -1712, -381, 291, 278, -184, 555, 1635, -2070, -581, -127, 1728, -129, 784,
+  2176, -2034, -920, -110, -1508, -236, 3108, -768, -1026, -1056, 1652, 819, -936, 2620, 2304, -848,
+  2247, -492, 210, -606, -2028, 600, -300, 2740, 1190, -452, -1530, 399, 198, 2944, 204, 452,
+  858, 3500, -1056, 504, -2714, -750, 348, -854, -936, 720, 1881, -230, -182, 945, -123, 1554,
+  2430, 1044, -1764, 1498, 635, 1358, 973, -828, 1332, 218, 2484, 0, -127, -216, 258, 1470,
+  -1088, -339, -805, -770, 1624, -944, 1628, 1056, -798, 1728, -354, 728, 104, -393, 288, -742,
+  963, 1230, -210, -1919, -1014, 100, -1100, -822, 0, -113, -1530, -1596, -198, -384, -2346, -791,
+  1716, 1250, 1056, 756, 118, 150, -580, 366, -624, -360, -198, -345, -455, 675, -984, -444,
+  0, 0, 2499, -1498, 2286, -388, -417, 0, 1665, 0, -414, 747, -1143, -864, 1290, -490,
+  1088, -113, -230, -1650, 1740, 354, 2516, 0, -114, 768, 0, -637, 728, -1048, 960, 318,
+  1177, 123, -3465, 2121, 845, 200, -1300, -548, -238, -226, -1020, -1596, 792, 2560, 1020, 1017,
+  429, 750, -576, 504, -590, 900, -348, -1586, 208, 480, -891, 575, -1274, -810, -861, -888,
+  2025, -783, -441, 1070, 127, -776, 973, 1380, -666, -872, 1794, 166, 254, 1296, -1161, -784,
+  0, -565, 1610, -3630, 2436, -1062, 2220, 1344, -2052, 1728, -2360, 546, -1664, -524, 1248, -530,
+  -642, 492, -1260, 2626, 2028, -1100, -700, 2466, 1547, -452, -1938, 1729, -1584, 384, -102, 1356,
+  0, 0, -2016, -504, 0, -150, -3364, -2074, 1560, -840, -1485, 460, 819, -3105, -738, -1665,
+  -1620, 1218, 2793, 428, 1143, 485, 2363, -736, -111, 218, 1380, -581, 635, -540, -258, 1274,
+  -816, 1582, -690, 550, 0, -826, 0, 2016, 798, 1440, 472, -455, -104, 2358, 1056, -1166,
+  749, -1599, 3045, -1010, -2873, -1200, 200, -2877, 1428, -1469, 408, -2793, -99, -1408, 408, 226,
+  572, -625, 384, -2646, 236, 225, 2668, 2318, 1144, 1920, -693, -3450, -1456, 2430, 3690, -1665,
+  -3645, 0, -1323, 321, -762, 194, -1529, -1840, -2553, 1635, -2208, -581, 2921, 108, 516, 882,
+  -272, 2260, -805, -2420, -1624, -708, 444, 288, -3078, 864, -472, 546, 208, 262, -960, -2650,
+  -214, 0, -1155, 202, 1859, -1900, 2000, 1644, 714, -113, -204, -1596, -990, -768, 2652, -565,
+  -1001, -250, -1152, 3402, 118, 600, -232, -244, 3016, 1800, 792, -230, 728, 1080, 1845, 777,
+  -3375, 0, 2058, -1712, 635, -388, -1251, 0, -999, 2616, -2346, -166, 127, -972, 774, -294,
+  -1904, -452, -115, 2530, 0, -1416, -888, -1728, -2394, -576, 944, 1001, 1040, 3930, 768, 1378,
+  -1284, -1353, 210, -505, 507, 800, 1400, -685, -1309, 904, 510, -532, 990, -1152, -3366, -2034,
+  -3575, -250, -1248, 882, -1180, -150, 1972, -244, -728, 2520, 693, 460, 182, -540, -2337, 111,
+  -1080, -870, -1029, 1284, 635, 970, -2224, -1012, -444, 218, -414, 0, -635, -1188, -774, -784,
+  952, -113, 2415, 220, -1160, -1652, -444, -1056, -342, -96, -1062, -1001, -1456, 262, 1248, 848,
+  -3103, -738, -315, -505, 3042, 0, 1900, -137, -595, 1130, -2040, -665, 1089, -1408, -510, 565,
+  858, 250, 288, 3024, 1180, 825, 928, -1098, 1976, 1800, 0, -345, -1274, -675, -369, -1887,
+  1755, -1566, -735, 2247, 635, -1261, 2502, 736, 1443, 3379, -414, -498, 1778, -216, 258, -588,
+  408, -904, -345, 1980, 348, -1888, -592, -288, 798, 1248, 1298, -91, -1456, 1179, 864, 636,
+  2140, -1845, 1155, 1414, 1014, 200, 1700, -1370, 714, 1130, 1020, 0, -1287, -128, -306, 2373,
+  -858, 3500, -1344, 504, 826, 3300, -1276, -1708, -1248, 240, -495, -345, 1001, 270, 1230, 1443,
+  -2700, 609, 2793, 214, 0, -970, -1668, 828, 2775, -2180, 828, 415, -254, -3024, -1935, -784,
+  -1360, 565, -1265, 770, 116, 1180, 2220, 1728, -456, 672, 354, -910, 1768, 1179, 672, 2332,
+  428, -492, -630, 1111, 1521, -100, -1200, 137, 2380, -1356, 612, -1729, -693, -896, -816, -904,
+  1001, 3500, -864, -1512, -354, -600, -1160, 0, 520, -840, -1287, 1150, -1365, -1485, -369, -333,
+  -1350, 261, -1323, 856, 508, -582, -2641, -368, 1887, 1526, 690, -830, 381, -324, 516, 294,
+  0, -113, -230, 2310, -696, -826, 3256, 960, -1026, 1248, 472, 1001, -2808, -1441, 1248, 954,
+  214, -1353, -210, -808, 1014, 1600, 800, -2055, -1309, 0, -714, 266, -495, -640, -1836, 1017,
+  286, -750, 480, 630, 2360, -225, -1740, 488, -1352, -2760, -2376, 575, -182, -810, -3567, 1221,
+  -1890, -1479, -3087, 1498, 3429, -1067, -973, -2024, 111, -2943, -552, -664, -762, 216, -1161, -1372,
+  2856, -452, -575, -880, 116, -118, 3108, 576, 1482, 288, 354, 364, 520, -4323, -576, 742,
+  214, -123, -105, 404, 169, 1600, -500, -2055, -714, 678, -306, -1862, 693, -1024, -1836, 339,
+  -1716, -875, 0, 378, -1416, -525, 0, -244, 1040, 960, -2970, -1265, -1456, 675, -1353, 1110,
+  1890, -1566, -735, 1819, 635, -291, -1529, -828, 1110, -872, -2760, -1577, -889, 1728, -516, -1372,
+  952, -1921, 345, 330, -928, 1416, 1036, -1440, -798, 1536, -1062, -1638, 1248, -917, -672, 1060,
+  214, -123, -1785, 202, 3380, -800, -800, 2329, 476, -1243, -1632, 1197, -891, 512, -1938, -113,
+  -1430, -2250, -960, -1260, -472, -900, 0, 854, 1664, 2160, -198, 345, 2002, 2565, 123, 999,
+  -270, 174, 588, -2889, -1905, -1358, -556, -828, -666, -436, -1794, -830, -635, -864, 1677, -588,
+  1496, 226, 575, 1320, -1276, -236, 2220, 576, -1026, -768, 2006, -1183, -1144, -1703, -288, -212,
+  -2354, 1599, -3360, -808, -3549, 1300, -900, 548, -3213, 904, -816, 2793, -495, 1408, 714, 113,
+  -572, 625, -1344, 0, 826, -900, 464, 1586, -832, -1920, 990, -1150, 728, -2025, 2583, 555,
+  -1350, 261, 3087, -856, -508, -1649, -2224, -644, -1776, 109, 1380, -747, 0, -3024, -1419, 1078,
+  -1360, -791, -1035, 2530, 1740, -826, 0, 192, -2964, 768, 708, -1274, -1248, -2358, -1344, -530,
+  963, 1230, 735, 909, 1352, 300, -1600, 1233, 833, -2599, 1428, 266, 1188, 0, -612, -1695,
+  -2431, 1375, -3264, 378, -2596, -2175, -2088, -244, -1768, 840, 198, -2875, 91, 405, -861, 3774,
+  270, -261, 294, -3745, 508, -2716, -2085, 92, 1110, -3379, 414, -249, 762, -972, -2451, 1078,
+  680, -1808, -2070, 550, 348, -1298, -592, 288, -3420, -96, -944, 637, -728, -1965, 2016, 1272,
+  -2354, 123, 1575, -303, 507, -1600, -1300, -959, 119, 452, 2040, -1729, 396, -512, 816, -1469,
+  -1144, -375, 768, 126, -1770, 600, 232, 3538, -936, -1320, 396, -1955, -2093, 270, 984, -111,
+  -3105, 870, 294, 1391, -1651, 873, 2085, 368, -1887, -327, -1242, 498, -254, -2592, 258, -294,
+  272, 1243, -460, -2750, -1624, 2360, -148, -1344, 228, -192, -236, 728, -936, -3275, 864, 636,
+  -535, -2952, -2415, 3232, 676, 100, -700, -2192, -357, 226, -1122, -133, 891, 1152, 510, -1808,
+  -429, 1750, 576, 2268, -1888, -600, 1856, -610, 1144, 3000, 1782, 690, -2366, -675, 2214, 222,
+  2565, -1392, 2499, 2889, 3429, 1358, -278, 460, 222, -3488, 1242, -166, 508, 1944, 1677, -2156,
+  -4488, -565, 2415, -1100, -232, -2478, -148, -1344, -1710, 2976, -3186, -182, -3432, 1310, 1440, 1166,
+  642, 123, 315, 707, 338, -1400, -900, 2740, -119, -113, -612, 1330, -1485, -512, -3366, 3842,
+  -1716, 375, -480, 756, 236, -225, 348, -488, 416, -2280, 1980, 0, -1274, 675, 1107, 666,
+  -2565, 1305, 1176, -856, -889, -582, 556, -644, -999, 763, 414, 83, -1397, -2592, -2709, 2352,
+  -4080, 565, -920, -2310, -580, -590, -1480, 1536, 456, 96, -118, 455, -1352, 262, 864, -1696,
+  -856, -2952, 420, 606, -2704, 1100, -700, 822, -595, 1921, -918, -1729, -396, 1024, -1224, -452,
+  1001, -125, 288, 1386, 2006, 75, -696, -1098, -520, 2160, 990, 2300, -455, -675, 1230, -1332,
+  810, 1218, 147, -856, -762, 291, 556, 920, 222, -1635, 966, 1162, 381, 216, 0, -1078,
+  -1768, -339, -115, -220, 348, 472, 2368, -1536, -798, -192, 236, 182, 0, -1048, 1056, -1166,
+  2140, -738, -1470, -1616, -845, 700, 1200, -548, 0, -904, -1836, 1862, -693, 896, -306, -1356,
+  429, -875, 96, -630, 236, -1275, -928, -3294, 0, -1800, -297, -115, 1092, -2970, -2460, -888,
+  -810, -783, -735, 856, 254, -1649, 0, 92, 888, 1308, -2622, -166, -1651, 1728, -387, -1960,
+  0, -565, -1380, -110, -2552, 0, 1628, -1056, 342, 192, -2950, -728, -832, -655, 1536, -424,
+  -1391, -492, -735, -1414, -169, -300, -800, -959, -476, 1130, -816, 931, -1089, 2176, 1530, -1582,
+  1001, -125, -576, -630, 1062, -75, -1972, -1708, -2808, -1200, 1188, 920, 819, -135, -738, 0,
+  1215, 261, -147, 642, -1778, 0, -973, -460, 0, -1744, 276, -249, -2032, -1728, 1290, 196,
+  2584, -904, -230, 330, -1044, -354, -148, -1728, -342, -480, -944, -1001, -728, 393, 96, 106,
+  -1819, 0, -210, 303, -507, 800, -100, -137, 119, 1130, 816, -931, -1980, -256, -612, -1582,
+  0, -875, -960, -252, -1416, -1275, -1624, -1098, 728, -1080, -1683, -805, -637, -270, -2460, 999,
+  540, 870, -147, 856, 2159, -388, -1529, 2024, 2220, -109, 0, 332, -1905, -2484, -2064, -490,
+  680, -1130, -1495, -2090, -1276, 1062, 888, 1152, -570, -576, -1888, 1820, -416, 1441, 1344, -2014,
+  -1070, 0, -1890, -1717, -507, -1300, -400, -6165, -3332, -1130, -1326, -931, -891, 2560, 2142, 1469,
+  0, -1125, 2688, -1386, 708, 375, 1276, -1342, -2288, -360, -495, 460, 2184, -810, -4674, -444,
+  -1755, 0, -1617, -107, -508, -1067, -2363, -5060, -3219, -1635, 1104, 747, -381, -1512, -4386, -2450,
+  1360, -113, 920, 1980, 812, -354, 6660, -288, -1482, -3072, 1180, 2093, 728, 2096, -1728, -2862,
+  -107, 246, -1260, -202, 1352, -1600, -300, 1781, 833, -113, 510, 1862, 396, -1280, 2040, -2034,
+  1144, 2250, -192, -2142, -3304, -2025, 464, -2318, -1872, 600, 0, -2300, -546, 135, 369, 222,
+  540, -174, -3675, -749, 635, -2037, -278, 920, 1665, -1417, -1380, -2573, -2667, 972, 387, -98,
+  544, -1808, 1495, 330, -1972, -826, -3404, -960, -912, 480, -708, -728, -1352, -3537, -864, -530,
+  856, -1107, -315, 1515, -1521, -200, 800, 274, -2142, -113, -612, -1596, -1881, -256, 714, -1356,
+  1573, -500, 1152, -252, 708, -1200, -580, -976, -3120, -240, -396, -1610, 910, 945, -1968, 333,
+  -1755, -1392, -3675, 749, -127, 485, -556, 644, -999, -1308, 276, -249, 0, 1620, 258, -980,
+  -1088, 678, 1150, -1430, -928, 1062, -148, 864, -1140, -1344, 590, 182, -1352, -917, -960, -530,
+  -642, 615, -525, 202, 2704, -1400, -1300, 0, 0, 1582, -408, 266, -1485, -768, 1836, 1808,
+  715, 750, 1632, 882, -1534, -675, 1508, 976, -104, 720, -297, -115, -1274, 1755, -1722, 111,
+  -135, -783, 2352, -1284, 1270, 1261, 834, -828, -2220, -1090, -1794, 747, 635, 324, -1161, 1274,
+  1904, -452, -920, 1320, 1160, -1652, -3256, -1056, -1482, -768, -472, -637, 312, -2751, -96, -106,
+  -321, 1353, -1365, -808, 169, 200, 300, -1233, 0, -1017, -2040, -931, -396, -256, 1122, 904,
+  572, 625, 768, 630, -1416, 600, -928, 2196, -520, 360, 1287, -690, -364, 945, 1476, -1332,
+  675, -87, 2058, -428, -508, -97, -278, -828, 333, 654, 828, 415, -1778, 648, 774, 294,
+  -1768, -1243, -345, 660, 1972, 354, 592, -768, -1026, 576, 1298, -1547, -936, -655, -864, 106,
+  321, 123, -945, 1212, 507, -1600, -1300, 548, 2737, 452, 408, 1064, 198, -1024, 1122, -791,
+  -2574, -125, 1632, 1386, -1062, 75, -1856, -1586, -936, -960, 396, 115, 273, -135, -492, -111,
+  -1620, 0, -441, -963, 1397, 194, -278, 920, -666, 872, -1794, -83, -2413, 108, -2064, 98,
+  -952, -1356, 1265, -660, -1508, 1180, -592, 192, 1140, 192, 1298, -1547, -1456, 393, -576, -1378,
+  -642, -369, -1785, 1616, 338, -500, 1200, -411, -357, -565, 612, 0, 0, -256, -918, 2373,
+  1144, -250, -672, 2016, 1298, -150, 1276, 1098, -312, -1800, 99, -460, 728, -810, -615, 222,
+  -135, -1131, 1029, 1070, -2032, 485, 1529, 1012, -3441, 981, -276, 0, -508, -216, -774, 392,
+  -1088, 2034, 920, 0, 580, -1062, -148, -1056, 114, -672, -1180, 0, 0, 1703, 1152, -1166,
+  1070, 123, 840, 1212, -2873, -300, 1500, 548, -119, -1695, -1224, 266, 297, -256, 1224, 1469,
+  2145, 750, 1728, -252, 3540, 0, -696, 122, 728, -720, -99, 460, -91, 405, 1968, -2442,
+  -135, -522, 735, -107, -3556, 1358, -278, -920, 0, 3161, -1242, 415, -2159, 756, -1161, -1274,
+  -1360, 113, 1380, 660, 464, 2242, -888, 96, -1482, -192, 118, -91, 832, 655, -1344, -424,
+  2354, 984, 840, 404, 169, -800, 400, 1644, 476, 2712, 306, -1463, 495, -1536, 408, -791,
+  143, -250, 576, -882, 0, -600, -812, -1098, -1248, -1440, 1287, -345, -273, 810, -738, 555,
+  2835, 87, -1029, 1284, 127, 970, 278, -184, -888, 1744, 414, -2075, 762, 1620, -1419, 1176,
+  -136, 226, -115, -220, 2320, 944, -1924, 0, -1368, 0, -590, -91, -624, 917, 768, -424,
+  2140, -369, -1680, -303, 845, -1000, -4200, -4384, -2975, 0, 408, 1995, 99, -1152, 918, 1582,
+  -715, -500, -1632, -3780, -826, -225, 928, -3538, -312, 2880, -693, -3565, -182, 1485, -1107, -333,
+  -810, -1653, -882, -2033, -508, 0, 3336, -1472, 3441, -4578, -552, -996, -2159, 216, -387, -1862,
+  2040, -3842, -1610, 2310, -1972, 0, -2220, 384, -570, 2112, -2242, -2912, 208, 3013, -1056, 2756,
+  -1284, -1722, -420, -1313, -3042, -300, -2800, -1096, 357, -565, -1224, -133, 297, -1280, 816, -1017,
+  1859, -2875, 768, -756, -826, -2700, 116, -2928, 520, 3480, 99, 0, -1183, -1350, 3198, -999,
+  1350, -435, 1911, 1819, -1778, -388, -139, 0, 2109, -1853, -138, -1660, 1143, 864, 645, -1470,
+  -1768, -791, 1150, -440, -928, -1298, -296, -288, 570, 960, -236, 1001, 1664, 131, -192, -1166,
+  2782, 1230, -525, -1616, -2028, -700, -1100, -137, 357, 791, 1632, -532, -1386, 640, 816, 565,
+  -1430, 125, 384, -252, 590, 300, -116, -2196, 728, -240, -792, -230, 546, 810, -2583, 777,
+  -135, -174, 1176, 1712, 127, -485, 278, 0, 555, 109, -828, -664, -762, -648, 1161, -196,
+  -816, 1017, 0, 330, 116, -472, -592, -960, -912, 0, 236, 182, -312, 655, 480, 636,
+  -321, 2583, -525, -909, -845, -700, 1200, 959, -476, -2373, -102, 133, 1386, 384, 1428, 678,
+  0, -500, -1920, -1512, 708, -75, -1508, 122, 832, 360, -1782, -575, -182, -540, -1476, -888,
+  1080, 870, -2058, 1391, -381, 485, 695, -1196, 111, 2180, 828, -581, -2794, 0, -645, -686,
+  816, 113, 1725, -1430, -2552, -1652, -3700, 1824, 1140, 768, 1534, 273, -1456, 917, 192, 530,
+  -214, 1845, -1260, -606, -3042, -800, 500, -137, -1071, 1921, -2244, -665, -891, -128, 1224, 226,
+  572, 250, -288, -378, 0, -1425, 2552, -1830, -520, -2160, -495, -230, -1183, -2565, -2337, -1110,
+  3915, 435, -147, -1284, -1524, 1455, -417, 276, -888, 1199, 414, 1577, -508, 216, -1677, 294,
+  -1360, 1356, 920, 1100, -464, -118, -888, 1152, -228, -96, 236, 1638, 1352, -786, -768, 636,
+  -1177, 369, -1155, 3131, 676, -1000, 800, 1918, 119, -678, -102, -1064, 1287, 256, 816, -1582,
+  -715, 875, 480, 2646, 118, -1275, -928, -610, -520, 960, 99, -230, -637, -1620, 123, -444,
+  -540, -696, 2940, 963, -1651, -679, -4170, 736, 999, -872, 2622, -664, 1270, 432, 1290, 392,
+  -544, 0, -2530, -1320, 1276, -472, 444, -1152, -912, 1440, -472, -1001, -1144, -1965, -1632, 1272,
+  -1819, 123, -2310, 202, 676, 600, -2300, -1644, 1071, -113, 102, 532, -1782, 128, -1428, -452,
+  2145, 0, 480, -2016, 2006, 525, -232, 1098, 416, -1080, 198, 2415, -819, -810, -1845, -666,
+  675, 174, 3528, 214, -254, 1261, -139, 92, 0, -872, 1656, -1245, 2794, -2376, -1290, 196,
+  -816, 1243, -2415, -2640, 1160, -236, -740, 1248, -1026, -1440, 708, 1456, -936, 1310, -864, -848,
+  856, 738, -1155, -202, 1690, -700, -1400, -3288, 119, 2034, -102, -266, -297, -640, 1530, 2373,
+  3861, -1250, 480, -2016, 0, -825, 1160, 1464, 2392, 2400, -2376, 920, -91, -1080, -246, -555,
+  -675, 0, -735, -1284, -1651, -582, -417, -1472, -777, -436, -690, -332, 1397, -432, -1935, -392,
+  3128, 1695, 115, -2310, -464, -118, 148, 768, 2166, 672, 826, -910, -1872, -1834, -1056, 1378,
+  749, -1353, -1365, 909, -507, -2700, -300, -3288, 1190, -1017, 1428, 266, 1782, 512, 816, 678,
+  715, -1125, 2688, 882, -472, -900, 464, 488, -624, -3360, 792, 460, -910, 0, 246, 1443,
+  -1620, 609, -1029, -749, 2413, 1164, -1390, 552, 2109, -981, 2346, 249, 635, 1296, 2838, 0,
+  -2448, 565, -2070, -110, 2088, 2124, -592, -1152, -456, 2016, -1416, -364, 1768, -786, 0, -1272,
+  -535, 1722, 1680, 1212, -1183, 200, 200, -1918, -1547, -1017, -2142, 2660, 396, 1408, 612, 565,
+  -1144, -2000, -672, -1260, 236, -375, -348, -1586, -936, -840, 2079, 1955, -91, -540, 1968, -222,
+  -3780, 348, -1764, -2354, -635, 388, 278, 1012, -2553, -763, 1380, 830, 635, 648, -1419, 196,
+  -2584, 1469, -230, -880, 116, 1180, 444, 480, 342, -576, 1416, 2457, 1560, 1572, 1632, -1802,
+  856, -984, 1260, 2222, 3549, -1200, -1900, 411, 2380, -1469, -306, 665, 792, -3712, 1326, -1582,
+  1430, -125, -1440, -378, 944, -825, 580, 244, 1456, 240, 594, -1380, 273, 1080, -738, 3441,
+  -945, 348, 147, -642, -1270, 582, -1807, 460, 1776, -436, 276, 996, -2286, 1296, -129, 1666,
+  -1904, -565, -1725, -2530, 116, -1180, 0, 960, -114, 1440, 354, -273, 936, -393, 1344, 530,
+  1177, -1230, 630, 101, -2704, -800, -500, -685, 595, -226, -1428, 1197, -792, 512, -612, -226,
+  0, -250, -192, -378, -2006, -2175, -3364, 0, -1040, -600, 495, 460, 273, -405, -1476, -333,
+  -2970, 0, -2352, -428, 3175, 582, 973, 1564, 1887, -545, 1518, 913, 1651, 2376, -903, -1764,
+  -2584, 3051, -1035, -1320, 1276, 0, 888, 576, -1938, 480, -1534, 1365, 2600, -524, 192, -2120,
+  2675, 0, 630, -1111, -4563, 600, -400, -3014, -119, 565, -1836, 133, 0, -640, -612, -452,
+  -429, -250, 1056, 378, -1416, -825, -232, -122, -3016, -3120, 297, 1035, -364, 540, 0, -555,
+  -2295, -87, -2352, -2568, 635, -194, 278, -368, -1887, 0, 1656, 415, -1778, 1512, -2193, 1078,
+  -1224, -4068, -1380, -1650, 1624, 236, -148, -1248, -912, -1248, 1416, 91, -520, 917, 1632, 212,
+  -1819, -246, -1575, 606, -507, 2100, 1600, 4658, -357, -791, -1326, -1463, 1287, 896, 102, 678,
+  1001, -250, 2112, 2268, -590, 0, -928, -1342, -416, 480, 2079, 690, 2821, 3240, -246, 666,
+  1080, 696, -294, 642, 4318, 194, -834, -92, -666, -1526, 1932, -913, -889, 108, 645, 588,
+  408, 904, 575, 1650, 2204, 0, -740, -1248, 114, 1536, 708, 182, -1768, 131, 0, -424,
+  -535, -492, -1995, 202, 2535, 800, -600, -959, -1309, -226, -1020, 1064, -495, -640, 1224, -1130,
+  -1573, -500, -864, -630, 590, 450, -1856, -244, 1976, -240, -396, 0, -182, -270, 492, -2886,
+  1080, -609, 294, -321, 2413, -873, -695, -552, 333, -2071, -1242, -1411, -381, -1296, 903, -392,
+  2584, 113, -575, 550, -1508, 590, 1332, -864, -342, 960, -354, -1092, -1040, -1310, -192, 1378,
+  -107, 0, -105, -1010, -507, 400, 400, 2192, -2142, 339, 102, 0, -1485, -128, -1326, 1130,
+  1430, 2375, 192, -504, 118, 525, -928, -366, 520, -600, 396, 1955, -182, -270, -984, 222,
+  1620, 609, -2940, 2033, 254, -679, 1946, -368, 222, -545, -138, -830, 2794, -2808, -1677, -98,
+  0, -1130, -920, 0, 580, 118, 296, 480, 456, 960, 944, 910, -1352, 262, 576, 1484,
+  963, 123, -525, -1717, 1183, 1100, -400, 0, -1309, 565, -306, -1596, 1188, 640, -1122, 904,
+  -143, 2875, -672, -252, 2006, 1500, -116, 1464, 208, 480, -990, 2300, -910, -1485, 123, 999,
+  2700, -1740, 882, -535, 381, 97, -278, -920, 777, -1962, 1518, -83, 3302, 1188, 129, 882,
+  -680, 678, 1495, -550, -696, -236, 1036, -864, -2052, 0, 1062, -1274, -1768, -131, -1248, -1166,
+  -1712, -123, -630, -1212, 1352, 600, 800, -411, 714, -678, -816, -532, -891, 256, -510, -2373,
+  -2288, 2625, -1056, -1260, 1180, -150, 0, -1464, 2392, -1080, -2475, -1725, -2457, 0, -1107, 1221,
+  1485, 1131, -2793, -321, 2794, -2716, -1251, -1564, 333, -545, 1518, -332, -381, 756, -774, 980,
+  -2040, 113, -920, 110, 1044, -708, -1332, -384, -2052, 768, -118, -1183, 1872, -2882, 2016, 742,
+  -856, 1476, 2100, -2323, 1521, 800, -1000, -411, 952, -113, -204, 931, -297, -512, 816, -1808,
+  715, 1625, -1152, -1890, 1534, 225, -116, 366, 1248, 1320, -891, -575, 1365, 0, -123, 777,
+  -270, 87, 2793, 1177, -762, 388, -1112, -736, -2553, -1853, -2070, 2075, 508, -216, -903, -1274,
+  -1768, 1695, -230, -2530, -116, -472, 0, 1920, -114, -1536, 3776, 455, -1456, 1048, 0, -2650,
+  -535, 1599, 630, -505, 1352, 0, 600, -411, 833, 113, 1632, -266, -198, 1792, -1122, -1695,
+  -715, 1000, -288, 378, 118, 900, -1160, 2684, 520, 3120, -1584, -2070, 2184, -3375, 1599, 1221,
+  1080, -348, 1911, 428, -508, -1552, -1946, -1840, 2109, -1635, 2760, 1162, 127, -1188, -2193, -882,
+  -4488, -565, 575, 990, 464, 590, 296, 96, 1140, 288, -1062, -1456, -832, -2096, -960, 848,
+  1391, -2706, -210, -1010, 3380, 1400, 100, -137, -357, -565, -612, -1995, -990, 512, -1632, -1469,
+  -858, -1500, 1248, -1134, 1062, 825, -1044, -1464, 1352, -240, 990, -1495, 637, 135, -2214, 444,
+  945, -1044, 1911, 1391, 635, -582, 139, 736, -222, -327, -138, -830, 1778, 108, -1548, 1470,
+  -408, 0, -2760, 990, -2320, -1298, 148, -1248, 912, 288, -472, 455, -1144, -1572, -960, -742,
+  1070, -1722, 525, -808, 3887, 3200, -500, -548, -1547, 0, -408, -3059, -2178, 1792, 0, 678,
+  -715, 1375, 864, 1134, 944, -525, -2900, 488, 624, 720, 0, 115, -819, 1755, 738, 777,
+  -540, -261, 2205, 1177, 1397, -1940, 0, -1012, 1887, -1635, 1518, 166, 0, 2268, 774, -980,
+  544, -1243, 690, 1760, -580, -708, -740, 192, 798, 672, -1416, -819, 728, 1179, 192, -636,
+  -428, -123, 1050, -1313, 1690, 700, -1700, 1507, 0, 2034, -510, 1729, -594, 640, -102, -452,
+  2574, 1625, 2976, 2394, 590, -1050, 232, 2562, 832, 840, -1089, -230, 2366, 1890, 1353, -1221,
+  1890, 87, 2352, 3317, -889, 2522, 2363, -92, -555, -1526, -552, -1245, 0, 0, 1935, 588,
+  136, 1243, 1150, 880, 1972, 236, -888, -1824, 1482, 2496, -590, -728, -1976, 3144, -1152, -530,
+  -1605, 369, 0, -707, -338, -600, -400, 822, -119, 2260, -612, -798, -1089, -3328, -408, -1921,
+  2002, -625, 576, -756, 826, -600, -1740, -2806, -520, -360, -792, 1840, -1456, -270, -246, -111,
+  540, -87, -1029, 428, -381, 291, -417, -736, -444, 0, -2346, -1660, -1905, -2268, -2580, 1568,
+  0, 1017, 230, 1100, -1856, -1062, 740, 864, -114, -672, -1652, -819, -1352, -524, 192, 1802,
+  1391, -3444, -315, 0, -169, -100, -700, -548, 833, 1695, 1326, 798, -792, 1664, -1224, 904,
+  2288, 0, -576, -2520, -236, -600, -2668, 244, -1040, 600, 2673, -1035, 2184, 1080, -1476, -333,
+  945, -1305, -2058, -107, 762, -1843, 3197, 1288, 2553, -872, -966, -2905, -635, -108, 774, -784,
+  272, 226, -805, -1650, -464, 472, 1776, -1056, 2166, 96, 118, -273, -728, 917, -1344, -954,
+  -1391, 369, 0, -303, 2535, 800, -100, -959, -1904, 791, 510, -2128, -792, -1280, 1020, -1243,
+  -2002, -1375, -672, 252, -472, -1575, 1392, 0, 1248, -120, -1782, -1725, -546, -270, 2214, -555,
+  -945, 348, -2352, -535, 0, 388, -2363, 0, 333, -1308, 276, 332, 127, -216, -1161, -784,
+  0, 678, 1955, 330, -2784, 2596, 1036, -864, -1254, -192, 590, -455, -624, -2227, -480, 106,
+  0, -984, 525, 202, 1014, 200, -600, 1233, -2380, 452, -1530, -399, 594, -2176, -1326, -113,
+  -572, -2375, 576, -252, -826, -2550, 1044, -732, -1560, 360, -891, -345, 273, 135, 492, -444,
+  135, -174, -441, 749, 254, -485, -834, -1564, 666, -1962, 276, -2407, -127, -2700, 1032, -196,
+  -272, -113, 345, -1320, -580, -354, 3256, -1632, -1482, 576, 826, 1638, -728, 917, 288, 1060,
+  -2889, -3444, -4095, 1717, -3042, -100, -2000, -1370, -1428, 226, -714, 5320, -1188, 3072, 3366, 113,
+  3146, 1750, -576, -2268, 236, -1125, 1160, -488, -208, 0, 495, -1035, -1001, -3510, 1599, 666,
+  -1215, -1479, -735, 321, -2286, -291, -973, 2116, 0, -872, -2346, -1411, -889, -4320, 1032, -1078,
+  -2176, -113, 345, -1210, 2552, 236, 888, 192, 114, -384, 2242, 364, -2288, -3275, -384, -2014,
+  1391, 1230, 210, 1010, 0, 1200, -2200, -685, -714, -2147, 1224, -1596, 297, 512, -918, 1469,
+  -1716, 3375, -672, 1008, 118, 75, -580, 854, -3016, 1680, -1782, -1150, -546, -1215, 984, 2997,
+  -1350, -1044, -1470, -2568, 3683, 582, -278, -920, 333, 109, 4692, 332, -1524, 1512, 1935, 1470,
+  -2584, -1243, -920, -1320, 928, -2714, -1628, 768, -912, 96, -354, 91, 1872, -3013, 960, 212,
+  -107, 1353, -315, -707, 0, -1300, -1500, -548, -1547, 678, 918, -1330, -1584, -768, -612, -226,
+  -2145, -3500, -864, 1134, -1534, 1050, -1508, 1342, -104, -960, 594, 0, 273, 405, -123, 444,
+  -540, -783, -1029, -749, -127, -97, 973, -276, 333, 218, -1794, -1494, -1016, -324, 516, 980,
+  4488, -2147, 1265, 1540, 1044, 0, 296, -96, 1254, -864, 236, -910, 832, -3275, 1056, -1166,
+  -1819, -1353, -2835, -505, 507, 200, 100, -548, -119, -1017, -2142, -1330, -1683, 2560, -612, -1582,
+  429, -1750, 0, -126, -2006, 1200, -2204, -610, 520, -240, 1782, 805, 1274, -2700, -1968, -1221,
+  1620, -1131, 1029, 214, -381, -97, -2780, 276, 555, -1417, 552, -1162, 1016, -756, 2064, 2156,
+  -2040, 565, 2415, 990, -3248, -236, -3996, -1152, -3420, 2112, -2832, -1911, -1456, -262, -1152, 848,
+  -321, 1845, 1155, 505, 507, -1100, 100, -274, -476, -113, 204, -931, -2277, -1536, 408, 1695,
+  -4433, -750, 864, 378, 2124, 525, 812, 366, -624, -1320, 2970, -575, 182, 2025, 1107, 111,
+  -2565, -957, 0, -856, 508, -485, 2085, -1196, -1998, 2289, -690, 332, -381, -864, -2322, -490,
+  -2584, 113, -345, -330, 2552, 2124, -1924, 2112, 2052, -1248, 1534, -637, -936, 1703, 1344, -2120,
+  -1070, 369, -735, 808, -2028, -1800, -500, -274, -2023, 1243, -102, 0, 891, 512, -102, 0,
+  572, -1000, -96, -378, -1534, -600, -928, 1098, -3224, 480, -297, -2760, -819, 540, 615, 0,
+  -2430, 435, -1029, -321, 889, 679, -1668, 0, -1554, -327, -828, -996, -1651, -324, 1548, -686,
+  -1768, 904, -690, -770, -1624, -1180, 444, 864, 1824, 288, -2478, 819, -1144, 1310, 384, 742,
+  1284, -861, -1785, 505, -2535, -2400, 700, -822, 2618, 904, -1122, -1064, -2673, -1024, 510, -113,
+  -1001, -3125, -480, 1260, 1062, -75, 116, 1830, 104, -240, 2178, -575, 91, 810, 246, -333,
+  -1080, 87, 882, -428, -635, -97, 2224, 1288, 1665, 872, -2760, -664, -508, -1080, 129, -588,
+  544, -1921, -2070, -1100, -1856, 944, 592, 576, 798, 1248, -2596, 546, -1560, 655, 768, 954,
+  428, -2460, -2100, 606, 1183, -400, -900, -137, 1071, 226, -204, 1064, -891, -1152, -714, -452,
+  1144, -375, 0, -2520, 1888, -1125, 1392, -244, -520, 960, -1386, -1955, 728, 270, 246, -2109,
+  -1620, -87, 147, 321, -889, -1261, -1390, -644, 333, -218, -1656, -332, -635, -972, -1161, 294,
+  544, -678, -575, -330, -3016, 944, -1332, 1632, 798, 480, 944, -273, -1144, 524, -960, 530,
+  1070, -1845, -105, -808, -1521, -100, -1000, -822, 1428, 1695, 0, 532, 99, -2432, 204, -1130,
+  1144, 500, 192, -2016, 236, 375, 1624, -366, 416, -2040, -1188, -575, 546, 810, -2460, -1998,
+  -1755, 1653, -882, -321, 2159, -388, 2780, -1104, 888, -545, -966, 166, -127, -324, 645, -1274,
+  -952, 565, 1380, -220, -232, -1416, 592, 864, 456, 768, -118, -1638, 312, -917, -480, 1166,
+  -1819, -615, 945, -1414, 2197, 300, -1300, -1370, -1904, 452, -2040, 2261, -396, 256, -918, 339,
+  1716, -250, 96, -252, -1888, 1350, -232, 1220, 0, -1440, -1683, 2760, -1911, 540, 984, -1887,
+  -810, 1218, 0, -1605, 1016, 3298, 2224, -92, -2442, 872, -828, 332, 254, 972, 516, 392,
+  -2040, 1582, 115, -660, 1160, 1180, 2220, 1152, 2736, 576, 354, -546, 312, -1179, 1440, -1378,
+  1391, -246, -420, 606, 1183, 1000, -400, -2603, -2142, -1921, -2448, -1862, 198, 128, 0, 565,
+  2431, -375, 864, 2772, 1180, -1200, -812, -122, -1768, 1560, -1287, 115, -455, 1620, -123, 111,
+  -270, -2523, -1764, 321, 635, 2037, -973, -92, -1665, 0, -2070, -830, -127, -864, 3096, 784,
+  -2040, -339, -230, 550, -2900, -708, 296, -1632, -114, 1152, -118, -1729, -208, -1179, 1248, 1908,
+  0, -615, -630, 1010, -1859, -200, 800, 959, 238, 452, -918, 798, -1287, -1536, -204, -791,
+  -1001, -250, -2112, 1260, -1180, -300, -2204, -1342, 1768, 720, 2178, 0, -728, -540, -492, 1221,
+  -1620, -348, -147, 107, 381, 1067, 278, -184, 555, -436, 0, 83, -1524, 1512, 645, -588,
+  1768, -1356, 575, -770, 1856, 826, -888, -96, 798, -1920, 354, 2639, -936, 2620, 480, -954,
+  -321, 738, -840, -3333, -2197, -1500, 900, -548, -476, 1695, -306, 266, 198, -1024, -714, -226,
+  -143, -2250, -576, -1890, 1180, 450, 928, 488, 624, 120, -396, 0, -273, -270, -984, -777,
+  -1890, -957, 882, -642, 1270, -1358, 1529, -2116, -111, 981, -1242, -498, 0, -2052, -1548, -2254,
+  2312, -2938, -2300, 1210, 1044, 236, -296, -1344, 0, -2208, -118, 91, -3016, -393, -1728, 106,
+  -2354, 2460, 420, 1717, 1859, -1100, -600, 1507, -1547, 226, -1224, -665, 198, 3456, 2550, -2486,
+  2288, 1125, 1920, 252, 590, 1575, 1160, -1952, 1352, 120, 495, -460, -182, 675, 123, 0,
+  -945, 174, 2205, 3103, 635, -1067, -139, 460, 111, -2398, 1518, 581, -1651, 324, -1806, -1372,
+  2312, 1017, -1035, 440, 1856, -708, 1036, -480, 342, 480, 0, 364, -1872, -262, -1728, 636,
+  749, 1353, -420, 101, 3042, -1300, 1000, -685, 0, -1356, 1122, -798, 990, 1280, 102, -452,
+  -3146, -3000, -864, -1386, 354, 225, -2436, 366, -208, -3120, 2376, 2185, -728, 540, -1230, 555,
+  -2700, -957, 1911, 214, -889, 388, -1112, 184, 333, 1090, 1794, 913, 4191, -432, 1290, -1372,
+  -1088, 2034, -1150, 0, -1508, 118, -740, 576, -2394, -960, 1062, 1365, 936, 2620, 1920, -742,
+  321, 861, -2310, -101, 1690, -500, -1200, -822, -119, 226, 1020, -1064, -2673, -1024, -1428, 1469,
+  572, -2500, 672, -2016, 708, -150, -928, 488, 104, -1920, 0, 1380, -910, 405, 0, 777,
+  -135, 87, -294, 1284, 889, 194, -1529, -920, -777, 1090, 0, -1577, -127, 972, -645, -1470,
+  2040, 791, 920, -440, -2204, 118, -740, 960, -114, 192, 2360, -1092, 1456, 2620, -96, 106,
+  428, 369, -2100, -1010, 338, -2500, -1200, -822, -357, 1469, 0, 2394, -2079, 1920, 1224, -226,
+  286, -1500, 1632, -1890, -1888, -1275, 812, 854, -832, 720, 198, 920, -1456, 2565, 2583, 1443,
+  -3780, 2436, -441, -1605, -4699, 291, 3753, 276, -1776, -218, -3864, 1411, -127, 1404, -1290, -882,
+  136, -565, 1150, 330, -232, -472, -1036, -1728, 912, -288, 1180, -1820, 1768, 2227, -192, -2544,
+  2889, 1353, 1155, 1616, 2197, -200, -2100, 411, 595, -113, 102, 1729, -1584, -1024, -1632, 1130,
+  -572, 1125, -1248, 0, -354, -225, -1624, 0, -104, 1560, 693, 1725, 1001, 1080, -1107, 1665,
+  0, 1305, 2205, 321, -2413, 291, 834, 828, 2553, 1417, 414, 1411, 127, 1728, -2322, -588,
+  -3264, 0, 345, -1870, 580, 236, 444, -480, 1596, -1632, 354, 364, 2184, -393, 1344, 530,
+  749, -369, 2310, -1212, 1352, -2400, -200, 822, 3094, -113, 1224, -266, -1782, -2944, 816, -2034,
+  -2860, -3750, 192, -3024, -1062, 525, 1972, -1098, 624, -3720, -2574, -690, -1092, -405, 0, -888,
+  3780, 87, -3528, -1284, -2540, 1940, 417, -1104, -1221, -2071, -6210, 249, -1778, -1620, -1935, -588,
+  -816, 2938, 920, -770, -1392, -826, 2220, -672, 2850, -3552, 826, -637, -104, 393, -192, -636,
+  -2033, -2583, -525, 1212, 0, -1300, 400, 1096, 714, 2599, 102, -3458, 1089, -128, 3264, 452,
+  -3289, 250, -2016, 1764, -2596, 0, 1508, -976, 624, 1560, -990, -3795, -3367, -675, 1230, -1776,
+  675, -609, -3675, 1284, 381, 1552, 695, 184, 555, -1853, -1104, -1162, -635, 1188, -258, -294,
+  1360, 2712, 1265, -2200, -2088, -1652, -888, 384, -1368, -480, -1770, 455, -2288, -1310, 672, 2862,
+  749, 615, 210, -3030, -676, -500, -1300, 2877, -2261, -1243, 1326, 665, 693, 2560, -612, 1921,
+  -286, -1875, 864, -630, 1416, 975, 812, 2196, 624, 2760, -1287, -805, 910, -270, -1476, -444,
+  540, -522, -1617, -535, 0, -194, 834, -1748, -1998, -654, -1104, 415, 762, -324, -1032, -980,
+  -544, 2147, 2300, 880, -116, 236, -444, -4320, -1026, -2016, 1180, -273, -2808, -1572, 1632, -106,
+  -2354, 123, 315, 1212, -2028, 600, -400, 3014, 595, 2260, 2244, -1330, -1089, -256, 102, 113,
+  0, 250, 2496, 1260, 0, 600, -928, -1220, 208, -1080, 594, -920, 1001, -1215, -1353, -777,
+  675, -2523, -1323, 1712, -635, -3104, 1251, -3588, 999, -327, -690, -1162, 0, -3780, -774, -98,
+  2176, -2260, 575, 1430, 348, -708, 1036, -2016, 1596, -480, 590, -1183, -624, -3406, -864, 3074,
+  -1391, 246, 1260, 606, -845, 1200, 3300, 411, -595, -1130, -408, -1197, -495, 640, 510, 678,
+  -1859, 1625, -1344, -882, 2360, 150, 812, -2196, 1560, -600, 990, -1725, 1092, -1080, -1107, -333,
+  405, -1131, -882, -642, 1270, -873, 1946, -276, 333, 2834, 138, -1328, -381, 1188, 1290, -1862,
+  1088, 113, -230, 1320, 0, -1652, 1776, -1248, 342, 768, 944, -546, 1144, -917, -1632, 1166,
+  321, -369, 420, -909, -2366, 400, 700, -685, 476, -2034, -918, 2128, -495, -768, -1326, 565,
+  1287, -2750, -96, 252, 118, -1575, -812, 366, -312, 1080, -1881, 230, 728, 675, 1476, -555,
+  -270, -435, -882, 428, -381, -194, -1807, 92, -333, -327, -2484, 415, -1905, -2484, -129, 1078,
+  1496, 1243, 345, 1760, 116, -1416, 148, -480, 1596, -2208, 590, 1001, -104, -655, 864, -1802,
+  107, -1722, -840, 808, -3211, 0, -200, -685, -2618, -791, -816, 1064, 1881, 384, 1224, 0,
+  -1144, -375, 192, -504, 1888, -225, 0, -1830, -2184, 480, 2475, -230, 637, 0, -1107, -555,
+  -2160, -522, -2058, 428, -381, 582, -1390, 736, -111, -545, 138, -1245, -254, -324, -129, 294,
+  -408, 1695, 2070, 220, 1972, 0, 2664, -1344, -1824, 672, 0, 910, -208, 1179, 576, -1272,
+  1284, 246, -105, 404, -6422, -300, 300, -2466, -1190, 565, -1020, -532, 99, -896, -1122, 904,
+  -1859, -1750, 2016, 1134, -1180, -225, -1044, -1708, -2912, -720, 495, 115, 273, -2565, 246, -2553,
+  1215, 87, -1176, 214, -1397, -485, 1946, 644, 1554, 1744, -1518, -249, -127, 432, -1290, 392,
+  -1496, -3051, -690, 0, -1856, -2006, 296, 864, 570, 480, -354, 273, 832, 1965, 960, 424,
+  107, -1599, 315, -707, -1859, -1200, -1400, -1781, 1428, 1469, -408, 0, -2079, -1152, -510, 113,
+  -2431, 1125, 1536, -1764, 2124, 825, 580, 1342, -1040, 480, -594, 575, -455, 405, 1353, -444,
+  405, 1218, -735, 1391, 508, -582, 1946, 0, 1887, -1308, 828, 581, -762, 972, 129, -686,
+  -408, -3390, -230, 990, -1044, 0, 1480, 384, 1026, 1632, -2596, -1274, 936, 393, -2496, 1590,
+  -5136, 4428, -210, -1717, -3887, 900, 800, 2877, 3689, 452, 2244, -1463, -396, -1280, 1122, 1582,
+  -3146, 500, -480, -1008, 354, -450, -696, 1586, 2184, -960, 1485, -920, -4004, 540, 492, -2775,
+  2565, -348, -3381, 3103, -6477, -970, -1668, 2300, -1443, 2180, -966, -83, 1651, -1512, -3225, 0,
+  1224, 791, -2070, 770, 1392, 1770, 2960, 1152, 684, -1344, 0, -2184, -936, -4978, 192, -1272,
+  -428, -615, 525, -101, 1521, -500, -1700, -2329, 1785, 3164, 1122, 1197, 0, 384, 816, -113,
+  -286, -375, -960, -1134, 944, -1125, -2320, 2806, -936, 2040, -1782, -2185, 546, -405, -246, 999,
+  -1485, -957, -2352, -963, -127, -582, -1112, -1104, 1776, 1308, -2622, 996, 1778, -1512, 0, -882,
+  -408, -1356, 690, -880, 348, -236, -296, -192, 3192, -864, 1888, -546, 1352, 1048, -576, 2438,
+  -214, 1230, -3255, -2424, -338, 300, 400, 274, -2380, 1469, 816, 1463, 1188, 640, 2448, 452,
+  1001, -1625, -2784, -630, 0, 1200, 812, 244, 2080, 600, -495, 1840, -1911, 2430, 2091, -1332,
+  -405, 1305, 1176, -1712, 0, 194, 3336, -92, -1887, 0, -828, -415, 1778, -1944, 258, 490,
+  680, -2034, 230, 1100, 116, 354, 296, 0, 228, -1056, -944, 0, 0, -262, 1152, -1590,
+  2461, -3444, -1470, -202, 3549, 600, -1700, -1918, -2618, 226, -408, 2128, -792, 3328, 1122, -5424,
+  2574, -625, -288, 2772, -2832, -900, -3480, -2074, -728, 0, 297, 1380, 1820, -2025, 738, 2775,
+  3645, 174, -1911, 535, -2413, -97, -695, -552, 777, -3815, 1380, 1909, -889, 2268, 1548, -1960,
+  -816, -339, 460, 2420, -1044, 1888, 1332, -1440, -4104, 2976, -3304, -1820, 520, 1441, 1056, 2544,
+  321, 123, 315, -4040, -1859, -800, 1000, -137, 119, 452, 306, 2261, 891, -512, -3060, -2599,
+  2431, -2375, -192, -1512, -118, -1050, -116, -2074, -104, -240, 594, 690, 364, 2565, 1107, -444,
+  1080, 174, -1029, -2996, 1270, -1164, 3058, -368, 1998, -1526, -2622, -1660, -127, 324, -774, 98,
+  -272, -452, -690, -2310, -1392, 3422, 3256, -1152, -342, -768, 472, 910, 0, -2227, -1632, -742,
+  2140, -1476, -315, 909, -507, -400, 700, -959, 1071, -791, -2550, 399, -198, -768, -2142, 1243,
+  -3575, -1875, -96, -882, 0, 1575, 580, -732, 1144, -1800, -2772, 575, 546, -405, -1722, -2664,
+  -1890, -174, 1470, -642, 1905, -485, -2780, -828, 1776, 218, -1380, 0, -635, 2700, 1161, 588,
+  -1088, -3729, 230, -440, -232, -1652, 2368, 1152, -1482, -2208, -236, 819, -1976, 1703, -576, -1272,
+  -2461, 1230, -420, -606, -845, -200, -500, -137, -952, -1808, -1530, -399, -693, -512, 204, 1582,
+  0, 125, 96, -882, 1298, 375, -696, -976, -1040, -3000, -1782, 1380, -1365, -2835, 1845, 111,
+  -2700, 87, 1617, 1177, 1143, -1455, -1390, -1288, -1776, -1090, 0, -1245, -1778, -2268, 1161, 196,
+  3536, 113, -1150, 220, 812, -354, -592, 1632, -2166, 480, 1062, -819, 416, -524, -672, -106,
+  -1498, 1230, -1785, 3232, 0, 2100, -1100, 3014, -119, 565, -3060, 1330, -990, -2432, 816, -1469,
+  -1716, 1375, -1248, 1008, -590, -450, -3712, 244, 520, 3000, -1386, 230, -910, -135, 2706, 222,
+  2295, 435, 2793, -321, -1143, -2037, 0, 276, -666, -1744, -1380, 249, -381, -432, 1935, -1764,
+  -136, -1921, -575, 3080, -2436, -1062, 1924, 384, -2052, 1632, -1062, -910, -624, 2096, -1344, -106,
+  -856, 0, 735, 1515, -1352, -1100, -1100, 3562, 3332, 2373, 2040, 931, -594, -384, -102, -3390,
+  -429, -2375, 1536, -3024, 0, -225, 1740, 854, 520, 720, -2079, -3220, -273, 675, 984, -888,
+  945, -261, -1176, 1819, -2667, 0, -973, 1012, 1332, 2398, -2760, -415, -1651, -1620, -2322, -2156,
+  -2176, -904, -460, 1760, -928, -472, 2368, 1248, 1938, 384, -1062, -910, -1560, -3537, 192, 1166,
+  107, 1722, -210, 101, -1183, 1800, 600, -137, 714, 2825, 408, -399, -1683, 640, -1938, -2260,
+  -2431, 875, 480, -2520, 2832, -525, -464, 4758, -1144, 120, 396, -115, 91, 945, -861, -1221,
+  -2970, -2262, -1323, 1284, -762, -873, -4170, 460, -666, 2180, -1104, 913, -1651, -2592, -516, -1274,
+  -2448, 1582, -1380, -220, -1276, 2242, -1184, 192, -1140, -960, 2006, -273, -1456, 262, -2112, 1484,
+  -321, -246, 525, -1010, -845, -1100, 500, -411, 2499, 0, 2550, -399, 1287, 256, -1530, -791,
+  -4862, 0, -768, 0, 826, 300, -1160, 1342, 1456, 1440, 1386, 1265, 637, 1215, 123, 1221,
+  270, 0, -882, -1605, 2794, -970, -834, 1104, -444, -654, 1104, 664, 1397, -1296, 903, 2352,
+  -136, -452, -2185, 0, 1508, -1416, -3404, 864, -2508, 288, -2124, 273, 1352, -786, -576, 1272,
+  214, -1230, -420, -404, 338, -1600, -1400, 1644, 952, -452, -1224, -133, -1782, 0, 1632, 678,
+  429, -125, 1440, -756, 236, -600, -232, 1586, 520, -360, -594, -690, 273, 1080, 246, -444,
+  270, 696, -1323, 2782, -381, 1261, 556, 368, -2331, 218, 1104, 664, -2286, 432, -1548, 0,
+  -680, 1356, -460, -110, 1508, -944, -444, -2208, -228, 1440, 1416, -364, 1456, 524, 2496, -1060,
+  -1284, -1353, -1155, 303, -507, 400, 1800, 3151, 1309, -339, -408, -1330, -1683, 3200, 408, 113,
+  0, 2125, 2016, -252, 2124, -225, -2088, 3416, 2392, -2040, -396, 1035, 364, -3240, 1599, -888,
+  -3645, 870, -2205, 2033, -508, -1261, 278, 184, -1332, 218, 690, 1660, -635, -756, -1677, 294,
+  0, -1130, -1035, 3190, -928, -1062, -296, -1728, 1254, -480, -2478, 910, -104, 786, 576, 0,
+  856, -984, 1575, 1212, 2197, -2900, 800, 2329, 1547, 678, -510, -931, -594, 1152, 918, -3955,
+  -1144, 1500, 1632, -4158, 944, 1500, -464, -2074, -1144, -720, 2277, -230, 1456, 0, 738, 1110,
+  2160, 261, -1323, -1819, 254, -1358, 0, 2208, 2886, -1526, 2622, 581, -1143, -2268, -1935, -980,
+  -3672, -1921, 115, -1760, -1856, 944, -296, -192, -2052, 1632, 2478, 1274, -208, 0, 192, -318,
+  642, -1230, 945, -303, -676, 1400, -600, -1370, -595, -1808, -1530, 798, 99, -512, 2448, 1130,
+  -1573, 1875, 864, 2268, 236, -150, -1972, -610, -936, 1440, 891, 1495, 637, -135, -2829, 666,
+  810, -348, -2205, -1070, 0, 582, -556, 1288, 666, 1744, 1794, 166, -1143, -324, 258, 98,
+  816, 904, 230, 440, 812, -2124, 444, 1056, -798, -864, -826, -273, -1664, 1310, 480, 1166,
+  428, -246, -420, -606, -2535, 300, 1700, -274, -2618, -904, -408, 532, 891, -1152, 612, 904,
+  715, 1750, -1824, 1134, 2006, -675, -928, 976, 1040, 1080, -297, -1840, 1092, -540, -492, 1332,
+  -270, 609, 735, 749, -508, -1552, 1251, -828, 999, -1635, 276, 415, 889, 756, -645, -1470,
+  1496, -113, 115, -990, -232, -1652, 2960, 0, -1140, -2400, -1298, -910, -728, 393, 480, 530,
+  -214, -1230, 1470, 0, -676, 700, 1300, -137, -119, -678, -1326, 931, 792, -768, 102, -1469,
+  2288, 625, 672, 252, 1180, 675, 1972, 0, 0, -360, -693, 1035, 364, 2025, 1968, -1221,
+  540, 174, -1029, 1177, 381, 582, -1112, -920, 666, 1417, -2484, 498, -635, 0, 1419, -588,
+  -1904, 339, 0, -1760, -464, 472, 1332, 864, 912, 576, 0, -273, 624, -1572, 0, 1378,
+  1605, -1353, 2415, -707, 2197, -1200, 1300, -2055, -119, 1921, -102, 399, 1485, 2176, 1632, -1808,
+  -2288, -1750, 480, 2394, -708, -675, 464, -976, -728, 3480, 495, -4025, -91, 675, -246, 1110,
+  1755, -2349, -1764, -1284, 762, 291, -1112, 2300, -1776, 981, -276, -332, 0, 972, -645, -1372,
+  2040, 904, 1495, -550, 812, 826, -1332, -480, -1824, -1152, -708, -273, 832, 1179, -576, -742,
+  321, -2214, -2415, -2020, 2873, -1600, 1300, -4658, -6664, -339, -3570, 2926, 792, 384, -306, -1356,
+  -715, -4125, 480, -5166, -590, 750, 2320, 0, 2288, -1560, -1287, -690, 182, 675, -2337, 111,
+  135, -522, 2352, -3959, 2794, 0, 2363, -3588, -111, 218, -966, -581, -2032, 2808, 129, -392,
+  -408, -678, 0, 1980, -4524, -1298, -6660, -480, -1140, 864, -708, -273, -520, 4192, 288, 636,
+  -963, -3075, -525, -606, -1859, 1900, -600, -2329, 595, 678, -612, -798, -990, 1152, 102, -1695,
+  2002, -1625, 1248, 630, -826, -975, 464, -1586, -1560, 1920, -198, 460, -91, -1485, 3321, 333,
+  1215, -522, 882, 2354, -2667, 1067, -1390, 1748, 2442, -654, -1104, 747, -127, 756, 516, 98,
+  -1360, 2599, -920, -3080, -2436, 354, 1184, -96, 228, 2208, -826, -91, 832, -1310, -480, 2968,
+  1177, 1353, 420, 1010, -845, 300, 1500, -1644, 952, -339, 918, -1064, -693, -512, 612, -226,
+  -1001, 375, -1248, -756, -1416, -1425, -696, 0, -832, 360, 1881, -2070, -1183, 135, 246, -333,
+  810, 609, 0, 535, 762, -582, 417, 1196, 1110, -872, 1518, -581, -1397, 1512, -903, -686,
+  1496, -904, 0, -220, 116, -118, 0, -1152, -114, -192, 1416, -637, 520, 2358, -2112, -1272,
+  -2675, 984, 105, -808, -5239, 2500, -1000, 274, -119, -904, 1326, 266, -2079, -1536, -204, 1130,
+  -2860, -1250, -2304, -3024, -1062, 75, 116, -732, -1768, -480, 0, 1150, -1638, 405, 492, -888,
+  1890, -870, 441, -749, 635, 679, -278, -460, -111, 1308, -2622, -1909, 508, -1620, -645, -784,
+  3128, -226, -575, -2090, -1856, 826, -296, 960, -1254, -1152, 1298, 1456, -1352, -2096, -288, 424,
+  -963, 1722, -2205, 303, 1183, -1000, 300, 959, -2023, 339, -204, -3591, -891, -2432, -1938, -565,
+  2574, -3000, 960, 1386, 354, -975, -2204, 122, 104, -360, 792, -460, -1547, -405, -1722, -1221,
+  405, -348, 147, 1284, 889, -679, -1668, -552, 555, -109, -276, -1577, -508, -432, -1548, 0,
+  1088, 904, -460, 1980, -1856, -590, 740, 864, -1254, 384, 354, 364, -1040, 0, -288, -318,
+  107, -492, 105, -1111, -1352, 400, 200, -959, -833, 226, -714, 798, -1089, -384, 1326, -1582,
+  1287, -375, -480, -3150, 0, -450, 0, 122, -312, -600, 0, -1610, 455, 2295, -123, 222,
+  0, 696, -2499, -1070, 381, 776, 1112, -92, -444, -1635, 0, -1162, -508, -2484, -1032, -882,
+  0, 452, -115, 330, -2552, 118, 1036, 1344, -798, 0, -590, 0, -936, -1703, 288, 1908,
+  -749, 246, -630, -909, 1690, 900, 600, -822, -595, 1243, 918, 266, 99, 128, -510, -1582,
+  572, 875, -576, -252, -2242, -1275, 2320, -122, -1352, 1080, -198, -1610, 819, 0, 123, -555,
+  -2295, -957, -735, 1391, 889, 873, 834, 736, 555, 981, -552, -581, -254, 1404, 903, -1372,
+  544, -1582, 345, -770, -1276, -826, 592, -384, -114, 864, 1888, -455, -728, 393, 960, -530,
+  1177, 1968, -735, -909, -1352, -1400, 100, 411, -1428, -791, -408, 2128, -990, -1280, 204, 1130,
+  -286, -1250, 960, 378, -708, -750, 1624, -2440, -416, 960, -1188, -115, 1274, 0, -123, 111,
+  -405, 696, -294, -428, -381, 970, 1946, -276, -222, -545, -138, -166, -1905, 324, -903, 1666,
+  -680, 1695, 0, 880, -1160, -708, 1036, 96, -456, 672, -590, -182, -728, 917, 960, -530,
+  -642, -861, -840, -1919, -2197, 900, -300, -3014, -952, -1017, 204, 133, -792, -2432, -2244, -3051,
+  429, -375, 0, -2646, -708, -600, 348, 854, -1144, 1080, -297, -920, 819, -1080, 3321, 111,
+  -6615, -1044, -1029, -2782, -381, -97, 417, -3128, -555, -981, -2070, -249, -2032, -2808, 258, 98,
+  -408, -3390, -1380, -550, -580, 236, 2368, -576, 2280, -576, 472, -546, -1352, 393, 672, -742,
+  -642, -615, 105, 2222, 338, 2400, -200, 4521, 3451, -1695, 0, -266, -1782, 1792, -918, -3164,
+  1430, 2625, -864, 882, -2832, -2775, -3480, -976, -4680, 1320, 990, 920, -1729, -675, 1722, 2442,
+  -135, -609, 1764, -1070, -2032, -582, 695, 828, 1554, -1090, -1380, 166, 2667, -1404, 2193, -1078,
+  -2312, -1356, -690, -4840, -1508, 0, -592, -1056, -2394, 2592, 118, -819, 728, -3668, -2592, -106,
+  -428, -123, 1995, -505, -676, -1900, -200, 274, -833, 791, -816, -399, 693, -512, -408, -904,
+  1144, 875, -960, -1764, 826, -75, 116, 1830, -312, -1080, -1188, 460, -364, -405, -1476, -1110,
+  135, 522, 1029, 321, 762, -873, 3336, -92, 111, 109, 828, -747, 635, 756, 387, -686,
+  408, -1243, -1035, 110, -348, 826, 1480, 672, 342, -384, -236, -546, -936, -2227, -384, 1060,
+  107, -123, -735, -808, -676, -800, 500, -1233, -2856, 565, -102, -1596, 891, -1024, -510, 565,
+  1144, 1750, 0, -1764, 826, 1425, -116, 1098, 936, -600, -1485, -1380, -910, -2430, -246, 888,
+  -810, -1827, 1911, -1177, 508, 0, 834, -644, 888, 1962, -1518, -83, 0, 216, -903, -686,
+  1768, -1130, 690, 440, -1044, 1416, 0, -864, -228, 1248, -1416, -2093, -416, 1179, -960, 1696,
+  -535, -738, -2100, 2121, -1859, -400, -400, 274, -238, 226, -2142, -798, 792, 384, -816, -226,
+  0, -875, 1056, -756, -2714, 525, 1160, -976, 936, 720, 1485, 345, 273, 1350, 1107, 1998,
+  1350, 1392, 1176, -1284, -635, 679, -139, 1104, 111, -1526, 276, -830, -2413, -2376, -258, -490,
+  -3672, 2260, 1725, -550, 348, -236, 592, 672, -2850, 0, -1770, -455, -832, 786, 1824, -212,
+  749, -369, -210, -303, 1014, -500, -1800, 2603, -2142, 1582, -1530, 1995, 0, -2048, -1122, 1243,
+  -1716, -2750, 96, 0, -826, -1500, 2784, 2074, 1872, 720, 792, -920, 637, 3645, 861, 555,
+  -2835, -696, -588, -1177, 1143, 582, 834, -1196, -888, -1090, -2070, -1494, 127, -648, 516, 98,
+  -1088, -2599, -1035, 330, 464, -590, 0, -768, -2166, -1248, -354, -637, -1144, 3799, 288, 2120,
+  -2033, 1107, 420, -303, 2535, 1300, -900, -959, 119, 2486, 612, -798, -1287, -1152, -2652, -452,
+  1144, 625, 192, 1386, -1180, -1575, -1972, -488, -1976, 720, -1188, 2530, -182, -2295, -369, 777,
+  810, -783, 1323, 642, -1016, -2522, 417, -184, 444, -872, -2346, -1162, 1905, -1404, -774, 490,
+  1904, 791, -115, 220, -1856, -1416, 1184, -768, -114, -2016, -590, -364, -520, -1441, -864, 1696,
+  -749, -3813, -525, 202, 3718, -400, 800, 959, 2618, 113, -918, 1064, 198, 768, 816, 791,
+  1287, -1000, 864, -3024, 0, 900, -2088, -244, 312, -2160, 1782, 2300, 91, 270, -1599, -333,
+  2025, -174, -294, 535, 1397, 388, -1112, 0, 2109, -1199, 552, -830, 889, -1512, -2580, 882,
+  2720, 226, -1265, 440, -232, 590, -592, -576, 1140, -2400, 236, 2275, 1144, -1703, -576, 1484,
+  0, -738, -315, 0, 3549, 1300, -600, -2466, -952, 904, -204, -532, 1287, 1024, -918, 339,
+  -286, -500, 2208, -882, -826, -900, 812, 610, 1352, -1680, -1287, -1610, -455, 1890, -1968, 1332,
+  675, -1218, 2646, 2033, -762, -1067, 1668, 1380, 1443, -1199, -552, -249, -3302, 324, -516, -686,
+  408, -452, 575, 440, -232, 0, 740, -960, 912, 192, -1298, -1547, -832, 2489, 0, 2438,
+  -749, -615, -1995, 303, 2873, -1600, -1100, 0, -3570, 1243, -714, 266, -2079, 1152, -1224, -1243,
+  -1573, 0, 768, -126, 2242, -75, 928, 1220, -1352, 2280, -495, 460, 2639, 675, 0, 111,
+  945, -1044, 735, -2247, 1270, -970, -973, -1656, -555, -1308, -1518, 664, 889, -2268, -645, 1666,
+  -1224, -1695, 1610, 1210, -2900, 708, -444, -1344, -1596, -768, 1652, 455, -1560, -917, -2112, 424,
+  -2889, -2829, -210, 808, 169, 100, 1600, -137, 952, 1017, 1632, 0, -2772, -896, 102, 3051,
+  2002, 875, -384, -1638, -236, -225, 2320, 122, -1144, -240, -99, 345, -1092, -1890, 2337, 111,
+  540, -1044, 1764, 2247, -2032, -1261, -139, 1104, 2331, -545, 1242, -2490, -508, -108, -5418, -2450,
+  1360, 565, -1265, -880, 2552, -2242, 2368, -576, 1596, 96, -354, 1365, -832, -3144, -1536, 0,
+  1391, 3813, 105, 202, 4732, 0, 800, 822, -1190, -452, 1122, -2128, -1188, -1536, -204, -678,
+  572, 1375, -1536, 2016, -1416, 225, -3132, 488, 208, -1560, -792, -1955, -1092, -1620, -1230, 111,
+  2430, 261, 147, -856, -889, -776, -2085, -2392, 111, -1526, 690, -747, 127, 216, -1677, 686,
+  -2856, -339, -1495, 1320, -812, -2006, -3848, -384, -4560, -1536, -1888, -2184, -520, -1834, 96, -636,
+  -214, -123, -525, 909, -1859, 500, -200, -2329, -1785, 339, 1326, -665, 3267, 896, 1938, 113,
+  1430, 625, 3168, 378, -472, -750, -348, 1464, -520, -240, 990, 345, 364, 1890, 1230, -1221,
+  -135, 87, 0, 1070, 2159, 679, -1668, -920, -777, 327, 138, -830, 127, 324, 645, -2058,
+  -136, -226, 920, -2640, -3596, -236, -888, -480, -1368, -1728, -944, -1183, -832, 131, -1728, 530,
+  535, 2091, -2100, 1212, -507, -900, -400, -3973, -833, 2373, -1836, 665, 198, -1280, -102, -678,
+  -2574, -2250, -1440, 1890, 708, -1425, -2436, 1708, 104, -1080, -198, -345, -3094, -1485, 1107, 222,
+  -1755, 1392, 1323, 856, -1778, 1455, -2641, 184, -555, -1635, -552, -996, 508, 1296, 2322, 3430,
+  -2856, 565, -690, -3410, -1392, -2124, -1036, -576, -3762, -96, -2006, -2275, -1768, 2751, 1056, -3604,
+  1391, 738, 2940, -202, 1183, -1300, 0, -822, 714, -339, 1530, -399, 891, -4224, -102, 1808,
+  -1001, -1250, -3456, -126, -354, 1275, -1740, -2318, 312, -1200, -1089, -920, 182, -675, -615, 3108,
+  -1890, 957, -735, -2354, -2413, 194, -139, 1380, 333, 1526, 1104, 913, 127, 1944, -2967, -1470,
+  -136, 904, -1150, -2530, -1044, -1298, -4144, 0, 1254, 2496, 1534, 2002, 104, 1572, 2016, -318,
+  1605, -738, -2310, 808, 0, 600, -1600, -685, -714, 678, -408, -1064, -99, -768, 510, 1356,
+  -2574, 250, 960, -252, -1062, -1575, 232, 1342, -312, -1320, 2079, -1150, 364, 1215, 861, 1221,
+  -1080, 1479, -1617, -1498, 1524, 873, 1807, 1656, -666, -981, 2622, 1660, -1270, 972, -1548, -882,
+  -2448, 1243, 920, -1100, -1276, -118, 148, 1248, 1026, 1536, 1416, 1729, 1664, 1834, 480, -106,
+  963, -2460, 105, -101, 1521, 100, -1600, -1096, 0, -2599, -1530, 133, 1386, -1664, -714, 565,
+  -1716, -750, -960, -252, -236, -525, 0, -1708, -728, 120, 1287, -115, -728, 3240, -861, -444,
+  -1350, 0, 294, -2568, -381, -1940, 1807, 1196, -222, 1744, -2484, -913, -1397, -1296, -645, 294,
+  1360, 1130, 690, -1320, -1856, -2478, -3552, -480, -1596, 1920, -1416, -364, -1872, -1179, -672, -212,
+  2033, 246, 105, 1010, 507, -1300, -1400, 548, -1547, -1695, -306, 266, 1188, 384, -816, 565,
+  -286, 1500, 672, -2772, -590, 225, -812, 976, -208, -720, -2079, -1035, 364, 1215, 1230, 333,
+  135, -1827, -441, 749, 635, -679, 2919, 920, -444, -763, -414, 664, -762, 2376, -1161, -1666,
+  544, -2599, 115, 1210, -1392, -118, 740, 480, 228, 1536, -2714, 910, 0, 1703, 384, -1908,
+  -535, 369, 315, 1313, 1183, -400, -900, -1918, -1428, 565, -2754, -665, -693, -1920, -2346, 0,
+  -2145, 1250, -96, -1008, -590, -675, -2436, -976, 0, -600, 1386, -2760, -182, -1080, 615, -555,
+  -1215, 2262, 294, -107, -1016, 1940, 1807, 368, -444, 1308, -414, -2739, 0, 1080, 1290, 2450,
+  408, -1130, 805, 110, 464, 236, 1184, 960, 456, 0, -354, 819, -1976, 3275, -192, -3392,
+  4066, -1722, -1995, -5959, -1352, -4000, -1300, -2603, -1071, -2486, -2244, 1064, 2970, -5632, -2142, -904,
+  -4719, -4125, -192, 3528, -2714, -2400, -116, -3172, 832, -600, -1683, -575, -4459, 1890, -1845, -4662,
+  2295, -1566, -1764, 1070, -3429, 3201, -556, -1288, 111, 1090, -6210, -1328, -1651, 3132, 3096, 784,
+  5576, -5085, 2875, -990, -3016, 1062, 2368, -864, 570, 1248, -2832, -3094, -2392, -786, 1440, -2544,
+  -963, 984, 630, -909, 2366, 700, 500, -822, -2261, 1356, -918, -1729, 99, 0, 1530, -904,
+  -3289, -375, -1440, -630, -118, -675, 580, 244, -104, 120, -396, -2070, 273, -2025, -1476, 1887,
+  -1890, -1392, 1176, 1819, 508, 1843, 695, -828, 555, -654, 276, -747, 508, 540, -516, -196,
+  544, 791, 1150, 330, -2088, -708, -888, 192, -1482, -192, -472, -182, -416, -1834, 1920, 1272,
+  535, 984, -735, -1212, 1014, 1100, -1700, -1370, 2142, -904, 306, -1330, 0, 256, -612, 565,
+  -2717, 1500, -384, -1890, 1298, 1875, -580, -1586, 2496, 0, 0, -1380, -1274, -135, 1599, 222,
+  -135, -783, 1323, -107, -2159, -97, -139, -920, 333, 2398, -966, -1328, 762, -1836, -1548, -980,
+  816, -1582, 115, 990, -812, 236, 0, 864, 570, -576, 1416, 546, -832, 1048, 1152, 318,
+  1605, -6027, 840, -404, -5070, 1400, 400, -2603, -1785, -1808, 1122, -2660, -1881, -256, -1734, -113,
+  1430, -625, -1728, -378, 4484, 525, -696, -244, -3536, 120, -1386, -460, 455, 540, -1107, -2220,
+  -1350, -1566, -7791, 963, 2667, -2619, -1529, -5244, 1332, 545, -1104, 332, -1524, -1080, -258, -1764,
+  1224, -791, 115, 2420, -3132, 1888, 3256, 1824, 1596, 0, -1652, -637, -1768, -3144, -1248, 4558,
+  -749, -615, 1365, -3232, 845, 400, 800, -1096, 1904, -339, 408, -1596, 1584, 1024, -918, -2373,
+  2431, 2125, -192, -1386, 0, -525, 464, -3172, 624, -720, -1584, -1840, -1001, 1755, 1230, 555,
+  1350, -1218, 441, -107, -508, 873, -278, -1012, 1332, 1635, -276, 1079, 381, 324, -3354, -1274,
+  -272, -791, 2875, 550, 232, 3540, 148, -480, 3192, -960, 944, 546, 1456, -3144, -1728, -1272,
+  -107, -1599, -630, 1313, -3042, -100, -200, -1233, 833, -226, -1428, -665, 396, 384, 3162, 678,
+  -286, 375, -192, -504, 826, 150, 116, -244, -624, 360, 2772, -805, -364, 1350, -1476, -666,
+  -2295, -1479, 1911, -963, 1778, 1067, 278, 1380, -1443, 2071, -828, -249, -1016, -108, 1677, -1568,
+  408, 678, -345, 1430, 116, -1652, -592, 384, -1596, 768, -708, -182, -1352, 917, 480, 742,
+  0, -246, 630, -202, -507, -1100, 300, -1507, -833, 1243, -1122, 1064, -792, 512, 714, 1695,
+  -1859, 1250, 384, -756, 1534, 675, 812, 1342, 520, 840, 2178, -920, -910, 540, -246, -888,
+  -540, -1740, 2793, -1284, 1143, 194, -417, 92, -1110, -1199, -414, -747, -254, -324, 387, -1372,
+  -1088, 678, 1150, -220, 696, -236, 0, -384, 1368, -576, 1062, 546, -1664, 1703, 2496, -1590,
+  214, -615, -105, 1616, -3380, -1000, -1000, -274, -952, -452, -1326, -399, -1188, 896, -1122, 791,
+  -572, 750, 864, 1386, -590, -150, 1044, -244, -1144, 480, 99, 805, -728, 135, -369, 777,
+  -810, -609, -2793, 642, -635, 1940, 1529, 368, -111, -1635, -414, 1079, -2159, -864, -129, 98,
+  -680, 339, 1610, 990, -928, -1416, -2664, 480, -2850, 0, 354, -637, -832, -1310, 192, -106,
+  -749, -3321, -525, 101, 338, -200, -1600, -4110, 0, 678, 918, -1330, 297, 256, -2754, 226,
+  1716, 250, -864, -1764, 1298, 150, 580, 244, -416, 0, 0, -1150, -637, 0, 0, -777,
+  -405, -1479, -3234, -535, 889, 194, 139, -3128, 444, -1635, -276, -2822, -1397, -3024, 1032, 490,
+  -816, -1469, 2185, -220, -812, -1534, 2664, 960, 1140, -96, -708, -819, -1040, -2227, -672, -1060,
+  -2033, 861, 840, 1212, 1014, 1900, -300, 822, 952, 904, -306, 2128, -1287, -896, -612, -2712,
+  -1144, 875, -1728, 2268, -3304, -3075, -1044, 2684, -2912, 960, -792, -1495, -2366, 1755, 4920, 1332,
+  -2430, -522, -3528, 1391, 127, -2037, 1251, -1748, 0, 763, -1242, -249, 1270, -1512, 129, 490,
+  -1088, -678, -3680, -3630, 348, 2124, 592, -480, -342, 1344, 1770, -637, -312, -3275, -2208, 636,
+  -535, -1968, -1050, -1919, -3718, -600, -1000, -1918, -119, -113, -1530, 2527, -792, 640, 918, -452,
+  429, -1125, -192, -1008, -236, -2325, 580, 2440, -1352, 960, 1386, 805, 1001, 1215, 1353, 333,
+  -1485, -174, -3969, 1284, -635, -485, 1946, 184, 888, -436, -1794, -747, 1397, 1188, -1161, -1568,
+  -680, -1017, 920, 990, -580, 118, 2664, -1248, 1482, 192, -1180, -273, -728, -1179, -768, -318,
+  -1070, -369, 525, -1717, -2197, -700, -600, -411, 0, -1695, -1326, 532, 792, -896, -204, -339,
+  -143, -1125, 384, 1512, 708, -375, 928, -244, -208, 360, 198, -920, -91, 270, -861, 111,
+  945, 1479, -441, -107, -762, 97, -834, 1656, -1443, 654, 276, 1743, -2286, 540, -387, 0,
+  -1360, -1017, 920, -1100, 464, 1062, 444, -384, 0, -192, -236, 2002, -1768, -524, 1440, -636,
+  -214, -369, -1365, 707, -3718, -500, 100, -548, -476, -791, -1224, 266, -1584, -384, 1734, 226,
+  143, -625, -1152, -1638, -826, -375, -2668, -2684, -520, -600, 2079, -1150, -273, -2835, -1968, -444,
+  -675, -174, -2205, 1605, 4318, 1358, -834, -276, 777, -1308, -138, -249, -2286, -2484, 1935, -294,
+  -2992, -904, 920, 0, -928, -1416, 1184, 768, -2052, -192, -1416, 273, -624, 2751, 1920, -212,
+  -107, -1968, -315, 505, -1014, -200, 200, -1096, -595, -904, -816, -1197, -2376, -768, 1224, 1695,
+  429, -125, 480, 252, 354, -1350, -348, 1220, 104, -240, 693, 115, -637, -1890, -4059, -111,
+  -1485, -696, -294, -1284, -1778, 970, -2502, -644, -1554, 327, -2760, 1826, -127, 108, -903, 294,
+  952, -226, -920, 0, -2204, 236, -1332, 864, 0, 1248, -944, -1547, -1456, -524, 1728, -530,
+  -856, 369, -2415, -202, -338, -600, 300, 548, -833, -113, -714, -133, -1287, 768, 306, 113,
+  1001, -750, -576, 252, 1534, -1050, 116, -244, -520, -360, -2277, 345, -364, -405, 1599, 222,
+  1350, -435, -3234, 535, 2032, 582, -1112, 184, -666, -872, -2208, -498, -1016, -2808, -516, 490,
+  -544, -1695, 1955, 110, -2204, -826, 2664, -1536, 1596, -480, 1534, 91, -1248, 524, -480, 636,
+  856, -123, 210, 2121, -1859, 1200, 0, -1370, -833, 565, 612, -266, 1584, 1152, 1020, -565,
+  2717, 1375, -1728, 1890, -1888, -1125, 1160, 122, 624, -720, -1386, -2415, 1092, -945, -1230, -1110,
+  -2700, -87, -882, 1284, 0, 1261, -417, 552, 1665, 545, 552, 498, -1651, 1296, -1161, 980,
+  408, 0, -690, 0, 696, -236, 1628, -96, 1026, -672, -354, 91, 1560, 0, -672, -1696,
+  749, -1845, 735, -1717, -2873, 100, -500, -1233, 595, -1017, -1224, 1330, 198, -2304, 714, -1243,
+  1001, -625, 480, -1134, 472, -1875, -464, -2074, -936, -240, -495, -1495, 910, 540, 1599, 777,
+  -135, -261, -1029, 428, -254, -582, 1112, -184, -222, 1744, 690, -664, -2413, 1080, 1806, 1274,
+  -408, 1469, -1725, -110, 348, -1180, 1924, 96, 570, 384, -472, 1274, 1248, 786, -1440, 1166,
+  1070, -492, 525, -202, -169, -600, 1100, -1370, 0, -339, 612, 532, 396, 1152, -714, 226,
+  2002, -375, -96, -756, -590, -525, -116, -1220, -1040, 1200, -1287, 1955, -728, 2160, -861, -1221,
+  1080, 957, -294, 1177, 1905, 388, -417, -1288, 1221, 1090, 690, 1328, 254, -216, -2064, -392,
+  0, -3051, -690, -990, -464, 472, 1036, 1632, 2052, -288, -1062, -728, -936, -1179, 288, 954,
+  -321, -1107, -210, 707, 2704, 1100, -3200, -2055, 952, -1243, 714, -2527, -990, 1920, -714, -1582,
+  2574, 625, 192, -756, -1062, -225, -1160, -3172, -2288, 2640, 495, 230, 1365, 945, -738, 888,
+  945, -435, 4998, -749, -762, -582, -834, 552, 3108, -2834, -138, -1992, -1524, -216, 1548, -686,
+  -952, -3051, 2300, 4070, -464, 1416, -148, -1152, -570, 768, -826, -1547, -520, -3013, -960, 1060,
+  -963, -123, -525, -909, -507, -1100, 0, 137, -357, 678, -2040, -665, -1980, -2176, -1326, -904,
+  2002, 0, 96, 630, -2596, -75, 812, -976, -1144, 120, -2079, 115, -2002, 1620, 861, -2886,
+  0, -348, -147, -2247, -508, -485, -3336, -368, -1443, 436, -2760, -1411, -381, -972, 1677, -980,
+  1088, -2260, -115, 330, -812, 1534, -1036, 2208, 684, -768, 1770, 1001, 2392, -655, -192, -1802,
+  2033, 1107, -315, -505, -676, 1500, -100, 1918, -1071, 339, 1632, 1463, -693, -768, -816, 0,
+  -1001, -500, 1632, -1890, 590, 1575, 2204, 1464, 1144, 720, -990, -690, 1456, -945, 738, 0,
+  -1080, 696, 147, 214, 254, 291, 1529, -552, 333, -654, -1932, 83, -762, -1728, 0, 1176,
+  2448, -1356, -690, 660, -232, 1180, -2812, 192, 798, 480, 1652, -91, 416, 393, -1056, 636,
+  1605, -369, -1470, -101, -1859, -700, 900, 411, -357, -1017, -1938, 1330, -396, -1920, -816, -1469,
+  -1001, 1125, -1152, 504, -3186, 300, -1160, -732, 2392, 1680, -495, -1610, -273, 810, 0, 333,
+  -2295, 1044, 882, 749, 508, 194, 139, 828, 1554, -1308, 0, -664, -381, 648, -2193, -294,
+  -408, 1582, -920, -1320, -2436, -354, -1628, -96, -1140, 96, -118, -637, 208, 1703, 288, 742,
+  214, 1845, 1260, 1010, -676, -1500, 300, -1096, 476, 678, 204, 266, -198, -3840, 816, 904,
+  -3003, -2000, 768, -630, -590, -1050, 348, 2318, 520, -1560, 594, -805, -1001, 1620, 492, -222,
+  -540, 957, -147, -1712, -1016, 2134, 278, 368, -1665, 1090, 1932, 415, -1524, -972, -903, 1176,
+  952, -226, 345, -770, 1740, 354, -1776, 1536, 570, 192, 236, -2275, -104, 1048, -288, 530,
+  -107, -738, 945, 808, -676, 700, -1100, 137, -476, -1808, -816, -133, -495, 1792, 102, -1695,
+  858, 1125, 768, 252, 826, -300, 0, -122, -728, -1200, -792, -230, -637, 1620, 246, 222,
+  -540, 87, 1911, 1819, -508, -485, 0, -552, 1998, -1853, -966, -1162, -1524, 756, -129, -882,
+  -952, -1695, 1610, -660, 696, -236, -888, -768, 1140, 864, 2006, -728, 1144, 0, -1728, 1908,
+  -214, 984, 1260, 1818, -1183, 100, 0, 137, 595, 226, -408, 1064, -99, -512, 204, -113,
+  -286, 250, -2016, 1134, -472, -975, -348, 244, 208, 600, 1188, -1380, 1820, 270, 738, 333,
+  -1755, 1131, 147, -749, -1270, 776, -695, 644, 444, 436, -966, 249, -1651, 540, -903, 686,
+  -1632, 904, -345, -220, 464, 236, 888, 288, 912, 1536, 2006, 728, -312, 917, 1152, -1590,
+  1177, -984, -315, 909, -1352, -1400, -300, 274, -238, 0, -1428, -1596, -693, -768, -102, -1356,
+  -1287, 1375, 0, 252, 1770, 0, 696, -2684, 312, -1440, 99, 805, 273, -810, 0, 111,
+  -675, 1218, -1911, -107, -889, 485, -2085, 828, 1443, -109, -276, 1494, 889, 1944, 645, 686,
+  -1904, -226, -345, -220, -1044, 944, 444, 864, -1368, -672, -118, 455, 416, 2096, 672, -530,
+  642, -369, -105, -404, -338, 500, 500, -1507, 1309, 113, 408, 665, 891, -1536, 1020, -113,
+  -858, -1750, 1344, -378, -708, -225, 812, -976, -2600, -2520, -1386, 230, -3549, -810, 984, -1554,
+  270, -1566, -1470, 1391, 381, -194, 278, 552, -111, 0, -690, 249, 1016, -756, 129, -2450,
+  136, 904, -805, 1430, 1624, 118, -592, -480, -1254, 480, -354, 91, 1560, -1572, 288, 2014,
+  1926, -738, -1365, -505, -169, -800, 100, -1781, -595, 1017, 510, -3724, 297, 1920, -2346, -1582,
+  2574, 0, -192, 504, 236, -375, -1044, 244, -104, 1680, 693, 1035, 819, -1755, -615, 222,
+  -3375, -348, 1470, -1605, 2667, 1358, 1251, 1196, 1443, -1090, -1656, -996, 2032, -1080, 387, -392,
+  -136, -1582, -115, -110, 2320, -944, 296, -2016, 0, -768, 118, -182, -312, 524, 1440, 848,
+  214, -1845, -105, -3939, 338, -1900, -2800, -1233, -595, 904, -2550, -266, 1386, -256, -1734, 452,
+  1430, -2125, 1248, 2142, -1652, 0, -348, -244, -728, 2280, -594, 1610, -546, 1350, -738, -2220,
+  135, -1827, -882, -1391, 2159, 1164, -139, -1196, -777, -1635, 1104, 249, 127, -1836, 2709, -686,
+  1496, -2373, -920, -660, 348, 0, 1036, -864, 1482, 96, -118, 182, 520, -655, 1056, -2650,
+  856, 1599, -630, 0, -338, -900, 400, 0, -833, 904, 918, 133, -990, -256, -510, 1017,
+  429, 1000, -1344, -756, -2242, 450, -1740, 488, -416, 1440, 297, 1035, 0, 1215, 1353, -333,
+  -2025, 174, -2499, -963, 889, 485, 556, -2484, 2553, 654, 552, 1411, 1143, 0, -1161, -784,
+  272, -1243, 1840, 1650, -116, 1298, -1332, -864, -798, -768, -1180, -546, -1144, -1179, 96, 1060,
+  -1498, 1599, -1365, -909, -1183, -1800, 500, 1370, 1309, 452, -2346, -133, -1188, -1408, -306, -452,
+  -715, -1625, 672, -378, -1062, 225, -1392, -1708, -416, 0, 693, -2415, 819, -270, -984, 1110,
+  270, 1914, -441, -1177, -762, 194, -3058, 1104, -1110, 436, 1794, 1245, -1270, -108, 258, -588,
+  1904, 452, -1265, -2750, -928, 0, -1924, -384, 1254, -96, -1416, 728, 104, 1703, -1536, 848,
+  1605, -123, -1785, 1313, -2873, 1400, -1000, -959, -714, -452, -1122, -532, 396, -512, 2346, -565,
+  2002, -1125, 192, 252, 236, -2175, 928, -1342, 312, -1680, 297, -3450, -1183, -1890, 615, -666,
+  1350, -1131, -2940, -1177, -508, -1552, 0, -1932, -2664, -1199, -1794, -498, -1143, -324, -387, -1372,
+  1496, 2486, 0, -1760, -1624, 0, -1184, -1728, -2850, 1344, -3186, -455, -1352, -262, -1920, 1484,
+  428, -1722, 630, 303, -507, -700, -500, 548, 476, -113, -1020, -665, 792, -1408, 816, -1356,
+  -1859, 0, -1056, 126, -1298, -300, -1392, 0, -104, 1080, 1188, -805, 1911, 675, 1476, 999,
+  405, -870, 2352, -1177, 254, -1940, 834, 184, -111, 218, -276, 581, 1397, 1620, 387, -686,
+  136, -3051, -1955, 550, -1508, -590, -592, -576, -1140, -288, -1652, -1456, 1248, 1179, -1056, 0,
+  -2033, 123, -1155, 303, 1014, -1300, -400, 411, -2142, 226, -816, 399, 1089, -1408, 306, 452,
+  2002, -1375, -1632, -630, -708, 150, -1160, -244, 2080, -1080, -1089, -575, 546, -1890, 984, -1554,
+  1215, -348, 1323, -856, -254, -1843, -139, -1196, -222, 218, -138, 0, -1016, -540, 1161, -1372,
+  136, -678, -1035, 1210, -580, 354, -1924, -2496, -1254, -1440, -708, -182, -1040, -393, 0, -636,
+  -856, 123, -210, -404, 676, -700, 1200, -274, -476, 1130, -3060, 1197, -2475, 1920, 1734, -1695,
+  429, -625, -576, -882, 118, -675, 1740, -732, -1560, -1320, 693, 575, 364, -405, -492, 1998,
+  -3375, 609, -147, -1070, -508, 1940, -1946, 736, -666, 436, -3036, -166, -1143, -2160, 1419, 490,
+  -2176, -791, -1610, 1210, -812, -118, -148, -672, -1938, 960, -118, -910, 312, -1441, -864, 318,
+  -749, 492, -1050, -707, -676, -1100, -2200, -1370, -952, 1582, 612, -1463, 495, 768, 0, 1582,
+  1287, 2750, -480, -2268, 354, -375, 232, 732, -2184, -1680, -1485, 1955, 910, 675, -1353, -111,
+  -1620, -87, -441, -856, -508, 873, 1529, -1656, -1332, -1744, -552, -332, -1778, -1728, -516, 588,
+  -544, -904, -115, 1980, -116, 2006, 2516, 1440, 912, -96, -1062, 0, 312, -1834, 864, -954,
+  -749, -1968, 1785, 707, 1690, 2900, -3700, 274, 1190, -4181, -102, 2527, -2376, -2560, 816, -1695,
+  286, 375, 0, 1890, -4248, -1875, -1508, -2684, -2808, 2400, -1386, -2185, -455, 1890, 3567, 2442,
+  -1620, 522, -294, -1177, -1016, -2231, 1946, -1932, 3219, -7194, 1656, -249, -3302, -864, 0, -392,
+  -2040, -1582, -1955, -550, -3132, 3304, 148, 1440, 1710, 2112, -2124, -2639, 2808, -131, -2400, 1696,
+  -1712, -2337, -2205, 303, -1521, -500, -700, 1233, 3570, 113, 816, 798, 594, -1664, -612, -678,
+  2288, -2375, 192, -882, -1180, -975, -464, -122, 104, -480, 495, 2185, -455, 540, 4182, -1998,
+  135, -957, -1617, 1819, 1270, -2425, -1112, 552, 222, 545, -2484, -1162, 1270, 1404, -387, 0,
+  544, 1243, 345, -1430, -232, 590, -888, 0, 912, 576, 0, 728, -1352, -1441, -672, -1484,
+  428, 738, 525, 404, -2535, -700, -1700, 1233, 1785, -1017, -816, 1064, -1188, -1536, -1734, -1017,
+  -286, -2375, 1824, -126, -590, -975, 928, -610, 1248, -240, -1089, -920, 819, -540, 123, 2442,
+  -405, 348, 1029, -963, -127, -1552, -1112, 1288, 0, -1308, 2622, -2822, -1143, 1296, -2451, 1078,
+  -408, -1695, 575, 1540, 696, 472, 2960, -1152, 684, -96, 0, 910, 208, -2620, -480, 530,
+  -642, -1968, 420, 0, -1183, -1300, 0, 137, -595, -2373, -408, 798, 1584, 0, 3570, 339,
+  -3146, 250, 0, 1638, 590, 375, -1740, -3050, -624, -960, 1980, 1610, -1638, 810, -2337, -1554,
+  -1215, -435, -1617, 1391, 1016, -291, 1807, 184, 777, 436, 414, -1992, -1651, 1944, 774, 294,
+  -1496, 0, -690, 440, -2900, -708, 1036, 384, 570, 96, -1180, 546, -2808, 917, 3072, -1908,
+  1070, -861, -1155, 505, -1014, 0, 200, -1644, -2737, 1017, -408, 532, -1386, -1536, 1326, 1469,
+  -572, -750, 384, 504, 2124, 300, -1044, 122, -1768, 960, 990, -1150, -273, -3645, -492, -111,
+  -810, 696, -294, 1712, 1651, 2037, 139, 1564, -666, 872, 828, 913, -1651, 108, -1935, -882,
+  136, -113, 575, 2860, 232, -2596, 296, -960, -1710, 1632, -708, -1638, 0, -786, -960, 530,
+  214, 1353, -2100, -909, 2028, 500, 500, 822, -833, -1695, 714, -266, 495, -2304, 612, 0,
+  -143, -625, -1536, -3024, -354, -450, -580, 1220, 624, -720, -1188, -575, -273, 945, 615, 555,
+  -405, -783, 147, -107, 1778, -291, -278, -828, -333, -1526, -1380, -913, 889, 1080, -1419, -2058,
+  1224, 0, -805, -220, -116, -590, -444, 960, -570, -1152, 472, -728, -728, -2227, 672, -318,
+  -1070, 615, -1260, -1212, 2197, -1200, 400, 959, -2856, 452, 204, 2394, -1584, -512, 816, -113,
+  -143, 1625, -960, -882, -1652, -150, -348, 1342, 1560, 1080, 198, -1955, 273, -135, 246, -1110,
+  -2430, 174, 147, 1070, -1143, -291, 1390, -1288, -666, 0, -1104, -1494, -762, 1512, 0, 294,
+  1632, 565, 690, -220, -696, -826, 444, -960, -1368, 384, 118, -1729, -1352, -1179, -1440, 848,
+  535, 2952, -315, -202, 2535, -2400, -400, 2055, -714, 1017, 714, -798, -2376, -1280, 612, -2373,
+  -2860, -500, -96, -1386, -2478, 75, 1276, 488, 1456, 960, -297, -1495, 819, 0, -1599, 333,
+  540, -957, 294, 535, 381, -291, 278, -736, -111, -2725, -2760, -332, -254, -2160, -3225, -588,
+  544, -904, -115, 550, -928, 944, 3108, -672, -2052, -672, 0, 455, -2600, -393, 864, -530,
+  1070, 369, -2625, -1313, 1183, -300, -800, -1644, 833, -226, -204, 1330, -891, -1664, -408, 113,
+  1573, 1125, 0, -2898, 944, -2025, 696, 1708, 728, -840, 0, 0, -637, 270, 861, -777,
+  -2700, -957, 2058, -963, 254, 1843, 834, -2116, 333, -1199, -2622, -830, 1270, -2592, 1548, 588,
+  -1768, -565, 805, -1540, -696, -236, 1036, -576, 1710, 480, 590, -2457, -1040, 1703, 192, -1378,
+  -749, 369, 1680, 707, 2704, 500, -400, 685, -714, -791, -816, -133, 198, 768, 714, -3729,
+  -143, 1500, -480, 2016, -236, -1200, -1044, -610, -104, 1080, 792, -2760, -1365, -2160, 1968, 2997,
+  945, 1218, 294, -856, -3429, 679, -139, 1932, 0, -1635, -276, -913, -762, -1296, 903, 882,
+  -5032, -1130, 920, -3080, 696, 472, 740, 96, -3078, 672, 2714, 819, 0, -2620, -1056, 848,
+  428, 492, -420, -606, -1690, -400, -800, -959, -238, -791, 408, 399, -297, -2048, 1326, -452,
+  -1716, 1625, -672, -1512, -590, 525, 2088, -244, -936, 480, 0, -1495, 819, 1080, 0, 1665,
+  -945, -348, -1764, 1284, 508, 970, -556, 276, -111, 0, -2484, 913, -1651, 2376, -516, 686,
+  -136, -2486, -230, 990, 232, 1534, 1924, 1056, -342, -288, -590, -1911, -1040, 262, 768, -742,
+  0, 0, 210, 0, -338, -1200, -1400, -2466, -1071, 0, 714, -1064, -1782, -384, 102, 226,
+  -572, -1875, 0, -1890, -944, 1350, -1508, 1220, 312, -360, 297, -690, -182, -1215, 492, 444,
+  -945, -783, -1470, -1177, -3048, 97, 1251, 1380, -555, -981, -138, -664, -2159, -1404, -1290, -1176,
+  952, -339, 345, -1430, 580, 1298, 148, 192, -798, 768, 1298, 455, 104, -1048, 1536, 0,
+  -856, -738, -1050, 606, -3042, 700, 1000, 1781, 119, -1017, -816, 1862, -1089, -1408, -510, 1130,
+  -1573, -2625, 96, 2520, -1888, -150, 580, -122, 728, 1320, 1287, -690, 1274, -405, -123, -555,
+  -1215, -870, -882, -428, 1016, -485, 2224, 1472, 111, 2180, 2070, -830, 1778, -864, 1161, 1274,
+  -1904, 226, -575, 1760, 1044, -472, -1924, 96, 114, -1440, 708, 819, -208, 2489, -1632, -1378,
+  -321, -984, -1575, 707, 1690, 1800, -1400, 548, -714, 1808, -2040, 1197, -1881, -512, 1122, -565,
+  -429, 500, -672, -2394, 1180, -150, -232, 1220, -624, 2040, 1089, -230, -91, -405, 2829, 333,
+  -270, 435, 2793, 1284, 381, -776, 1668, -828, 2331, -1853, -1104, 996, -1016, 648, -387, -1960,
+  136, -226, -1840, 220, -928, -826, -2516, 0, -570, 1440, 236, -2002, -1144, 786, 672, 2014,
+  -1177, -1107, -420, -1616, -2535, -2000, 600, 1644, -476, -339, -408, -532, 1683, -640, 816, 1469,
+  3289, -500, -1344, 1764, 1298, -225, -2088, -976, 832, -720, 1980, -1035, -1911, 0, -738, 1887,
+  -135, 1044, -1176, -107, 254, -97, 1112, 1932, 1110, 218, 138, 1992, 1016, -1404, 1548, -882,
+  816, -1356, -575, -550, -1276, -3540, -1332, -1344, -912, -1632, -1416, 273, -1248, -2096, 1248, -2332,
+  -1284, -492, -1260, 1212, -1183, -800, 2300, 1233, 1904, -1921, -1326, -2128, 891, 0, -510, 1921,
+  -286, 125, -1632, -252, 472, 1650, 2668, 1586, -728, -2160, 1188, -1380, 364, 2835, -1722, -222,
+  270, 1305, -441, 1605, 2032, 1455, 278, -460, 1110, 1090, 276, 166, -254, -648, 387, 1176,
+  1632, 113, 0, -1760, 348, -2714, -2664, -672, -2166, 192, 472, 364, -1976, 655, 864, 424,
+  -2354, 369, -525, -1414, -3211, 1000, -900, 137, -119, 226, -1530, -399, -297, -1536, 1020, 791,
+  -3575, 1625, 480, -630, 1062, 525, -580, -732, 520, -1080, -297, -1610, -637, -675, 2460, 999,
+  -270, 783, -1029, 0, -381, -970, 0, 368, 1332, 1090, 1932, 1411, 1016, 756, -645, -1470,
+  -2312, -791, -805, 1540, 1160, -1180, -444, -1536, 1026, -864, 1298, 728, -2912, -3406, -576, 1060,
+  -214, 369, 420, -1616, -1352, 300, -200, -2192, -1904, -452, 0, 665, 1089, 640, -2652, -226,
+  715, 2875, 0, 1134, -236, 600, 0, 0, 1040, 2280, 1881, -2300, 2366, 540, 615, 1221,
+  -1485, -522, -1470, 1391, -762, -1261, -1390, 0, -555, 436, -138, 664, 381, 108, -516, -1862,
+  -1496, -1582, 460, -990, -348, -1062, -444, 768, 0, -288, -354, 1820, 208, -1703, -192, -424,
+  -107, -738, 945, -3030, -2028, -1300, 2000, -2603, 833, 1356, 1326, 3325, -2178, -2944, 1020, -1808,
+  -429, 1750, 672, -2520, 708, 1575, 1624, 1098, 312, 480, 1584, 1495, 0, -270, 246, 666,
+  -675, -1653, -2058, 1498, 889, 1261, -1112, 828, 999, 1962, 0, 166, 1778, -972, 387, 2156,
+  -1088, 1017, 575, 440, 2204, -2596, -1776, -288, 1026, -1824, 1652, 1183, -832, -1310, -1248, 530,
+  1284, 738, 315, 404, 5577, 1800, -600, 1781, -1071, -1582, -1326, -3325, -198, 1024, -2142, 339,
+  143, -375, 768, 1008, 118, 1275, -696, -854, 312, 360, -1683, -115, -1001, -945, -3813, -777,
+  1755, 1740, 147, 1070, -635, -970, 2641, -184, -1221, -1090, 2484, 1577, -635, 972, -774, -1176,
+  -1360, 1921, -1610, -550, -2088, 2478, 888, -288, -2622, -1824, -2124, -2184, 1352, 262, 192, 318,
+  -321, -3690, -420, -1616, 2873, 1500, -300, 1507, 833, -3390, -102, 0, -198, -1280, 816, -1469,
+  -572, 750, -96, 0, 118, 450, -580, -1952, 208, 360, 198, 345, 1274, 540, -984, -555,
+  405, -435, 3087, 1284, 1524, 0, 556, 276, -333, -1962, -138, 1743, -889, 1404, 1806, -1274,
+  -408, -565, -1150, 440, -1508, 1652, 3552, -96, 0, -288, -1534, -2002, -104, 1179, -1728, 0,
+  -2140, 615, -420, -1313, -507, 600, 1500, 822, -476, 904, -1836, 931, 396, 768, 816, -1130,
+  858, -125, -576, -756, -118, 600, 348, 488, -520, -120, -1485, 1955, 1729, -945, -1476, 333,
+  2160, -609, 1617, -1177, -381, 194, -973, -1564, -1776, 981, -1242, -996, 2032, 540, 903, -2058,
+  1904, 904, -115, 330, -2320, 3304, 888, 1440, -3990, -2208, 590, -2002, 104, -131, -480, 106,
+  0, 1107, 1470, 808, 3718, -1100, 500, -1233, -1071, -226, -1428, -798, 792, -1024, -306, -2034,
+  -2574, -875, -384, 3906, 354, 1050, -1044, 732, 936, -240, -1881, -805, -1092, 2835, -1599, 2997,
+  -2835, 1218, 735, -3210, -2032, -97, -556, -736, 777, 981, -690, 664, 1143, 1620, -387, -2058,
+  2856, 1243, -230, 220, -232, 826, -1184, 384, -798, -1536, 944, 0, 1144, -917, -1344, -530,
+  1498, 123, -210, 808, -507, 2100, -200, -411, -1785, -113, -816, 133, 594, 768, -1428, -1243,
+  -572, 1500, -1536, 1512, 708, 750, -580, -2074, 624, -1560, -1287, 115, -1456, 1215, -984, -666,
+  945, 87, 1176, -214, 1651, -388, 417, 184, 111, -109, 2070, -664, -2032, 2484, 903, 1470,
+  -680, 1695, 1150, 990, -348, -472, -148, -576, -570, 1440, -354, -1365, 728, -524, 864, -742,
+  -428, 492, 630, -505, 169, 0, -1800, 822, -119, -339, -918, 798, -2475, 0, -816, -1243,
+  -1287, -3000, -2016, -630, 472, -750, 232, -1830, 1456, -1680, -396, 690, -1638, -2430, -861, -2442,
+  2025, -348, 2352, 1712, 635, -2134, -695, 736, 888, -1744, 138, -498, -127, -2268, 1806, -196,
+  1224, 791, -2645, 990, 348, 2360, 296, -1728, 1140, -1248, -1062, -273, -832, -2096, -864, 848,
+  -535, 1353, -1365, 303, 2197, 100, -700, -137, 119, 1243, 1836, 2128, 1089, 4480, 204, 1243,
+  2288, -1125, 480, -756, -590, -525, 116, 0, -728, 480, -990, 920, -1638, 0, -615, 2442,
+  270, 1479, 1764, 749, 381, -2328, -139, -644, -2997, -2507, -2898, -996, 508, -216, -1290, -294,
+  2856, -1695, -1380, 1540, -696, 1888, -3256, -1440, 1824, -384, 1062, -1092, -520, -655, -768, -742,
+  -2675, 1353, 105, -1111, 507, 1700, -2700, 1507, -714, -678, 2754, -665, -1485, -1536, -2856, 339,
+  -715, -1000, 384, 756, -1652, 225, 116, 732, -1144, -720, 594, 805, -455, 540, 1107, -999,
+  -1215, 435, 882, 535, -1524, -1261, -1668, -276, 2220, -1744, 138, -913, 381, -1620, -1548, 1176,
+  2176, -678, 575, -1650, -2088, 2006, 888, -864, 2850, -1248, -472, 91, -832, -1834, 1728, -848,
+  107, 492, -210, 101, -1352, 300, -500, -685, -833, -1130, 1428, -1995, -1188, 896, -408, -339,
+  -429, -1000, 192, -1134, -236, -300, -3712, -3416, -1040, -1800, 297, -1265, 91, 270, -2091, 555,
+  -1485, 696, 882, 321, -3556, -679, -834, -2484, -555, -2507, 552, 332, -381, -1404, -2064, -1078,
+  680, -1469, 575, 550, -1044, 1888, 1036, 192, -228, 0, -1652, -1092, -1560, 2358, -480, 0,
+  1177, 123, 3255, 909, -2366, -1400, 2700, 274, 476, -1356, -612, 3325, 693, -2304, 1122, -1017,
+  -1287, 125, -1632, -1512, 1888, -75, -464, 610, 520, -720, 891, -575, 910, 2160, 2583, -2664,
+  1080, 174, -147, 749, -254, 873, 1112, -828, -333, 872, -2484, -83, 1651, 1296, 2064, -784,
+  -680, -1921, 230, 220, 3712, -2124, -2368, -1152, 1026, 384, 2006, 0, -416, 786, -1824, -742,
+  642, 369, -3360, 606, -845, -200, -2500, 1096, -476, -565, -510, -133, 99, 1408, 204, 0,
+  -143, -2000, 672, 1890, -590, -1950, -464, -2440, -208, -240, -396, -1035, -819, 1890, 1599, -666,
+  1350, -870, -1176, -856, -1397, -873, -139, -92, 111, -545, -2484, -664, -1016, -1620, 129, 2744,
+  408, -565, -345, 220, 696, 354, -1628, -672, -684, 1056, -354, -364, -104, -2751, -480, 1060,
+  1819, 0, 315, 101, 5915, 2200, -1000, 1370, -833, 791, 1632, 2926, 693, 1024, 2652, -113,
+  0, 500, 1824, 756, 2006, -900, -1972, 976, -104, 2040, -891, -575, -1183, 1080, 2091, 444,
+  1620, 348, 441, 321, 2794, -776, 0, -1196, 555, -1526, 1794, -498, 889, -108, -129, 98,
+  -1496, 678, -115, 1540, 1856, -708, -148, 1152, 114, 576, -236, -728, 936, -786, 192, 1272,
+  1070, -2583, -1890, -2020, 2366, -700, -600, 411, -595, -113, -408, 3059, -594, 896, 1836, -2373,
+  -143, 2000, 960, 756, -354, -825, -812, 976, 936, 2640, -594, 575, 1729, -1350, 615, 111,
+  -270, 609, -588, 214, 508, 388, 834, 644, 1110, -218, 414, 996, 889, 2052, 2451, 490,
+  272, -565, 0, 1430, -1624, -2242, 1480, -1440, -342, 0, 590, -91, 312, 2882, -864, 1060,
+  0, 123, -420, 1414, 1014, 300, 100, 1233, -2142, 2147, -1530, 1463, 495, -640, 1020, -452,
+  1573, 125, -576, -378, 2006, -600, -696, -122, -520, 0, 2376, 920, 364, 135, 123, 777,
+  -1755, -957, -3969, -1284, -508, -1455, -695, -92, -1110, -545, 0, 83, -381, 648, -387, 0,
+  544, -678, -1495, 1650, -232, -1180, 296, 1152, 114, -288, 826, 273, 104, -655, 1248, 212,
+  214, -123, -1050, 0, -1183, 500, 800, 685, -476, -452, -1326, 1463, -99, 0, -102, -1695,
+  1144, 875, 768, 0, 1416, 75, -580, -1220, -104, 480, 693, 805, -1183, 1080, -1722, 1554,
+  -945, 435, -1176, -321, -381, -1746, 556, -276, 111, 763, 0, 83, 2921, -324, 774, 1862,
+  952, -791, -2185, 2750, -580, -472, 1480, -96, -342, 864, 1062, -455, 1144, 524, -192, 1378,
+  -321, -861, -840, 0, 1014, 200, 300, 2466, -1071, 791, -1020, 1064, -891, -2944, -102, -226,
+  -286, -1500, -672, 1134, -2124, -525, 464, -610, -1144, -480, 198, 1035, 273, -540, 369, 555,
+  2160, -435, 2499, -749, 3683, -873, 278, -1288, -555, -1526, 1380, -913, -1651, 324, 387, 196,
+  1768, 339, -115, 1870, -1392, 354, 148, 288, 1026, 0, -1770, -455, -936, 524, -384, -848,
+  1391, -492, -1680, -606, 2366, -700, 0, 1781, -1071, -2147, -2244, 1862, -693, 256, 1428, 1130,
+  1430, -875, 1248, -126, 590, -975, -232, -1098, 1248, 360, 1287, 230, 546, 675, -1476, 1443,
+  -1620, -1305, 1470, -749, -889, 1067, -695, -460, -1332, 218, -966, 498, 254, 1836, 129, -2744,
+  -136, -678, 575, -220, -696, -1416, -1184, -288, -2622, 1152, -118, -1274, -728, 1179, -288, -424,
+  642, 492, -1155, 808, 1352, -1500, 1700, 2603, -357, 452, -816, 399, -495, -256, -1326, -3729,
+  -429, 750, 960, -1386, 354, -75, -696, -610, 520, -1440, 297, -115, 1274, -810, 738, 2442,
+  540, 348, 294, -214, 1143, -1067, -2780, 0, -1221, 981, -828, 996, 0, -1836, 0, 1470,
+  -5168, -2147, 1150, -2200, -464, -826, -4440, -960, -2394, -1152, -118, -1274, -936, -917, -1152, 636,
+  963, 1599, -315, 1010, -507, 1000, 0, -959, -833, -791, -1020, -532, -1980, -1664, -1224, -678,
+  -3003, 2375, -1632, 252, -472, 75, -1160, 2196, -2600, 2040, 297, 2415, 273, -2430, 1476, 2775,
+  -810, 609, 1029, -749, -1397, -1649, 973, 552, 888, -981, -276, 1577, -1778, 1728, -1290, 98,
+  -680, -1582, -805, 2420, -1160, 1298, -296, 2976, -1824, 1632, 1180, -91, 624, 524, 576, 2650,
+  -1284, -1353, 210, -1111, 1352, -2100, -300, 1781, -714, -791, -1326, -133, 495, 512, 1428, -904,
+  -143, 1125, 384, -504, -472, -450, 1276, 122, -312, 960, 1485, -920, 182, 405, 0, -555,
+  270, 0, 1764, 2140, -2159, 582, -1390, 1656, -999, 981, 0, 1079, 127, -324, -516, -980,
+  -816, -565, 0, -330, -1740, 1062, -1184, -576, 114, 384, -354, 1365, -1664, 524, 576, -530,
+  963, 0, -315, 1010, 676, 600, 900, 3014, -714, 678, -2856, -798, 1485, -896, -612, 1582,
+  3003, 500, 384, -756, 354, 150, -2320, -366, 2184, 1320, 396, -2070, 455, 135, 0, 999,
+  -1890, 609, 4410, 535, -1143, 194, 278, 1564, 1998, -981, -552, -83, -508, 972, 1677, -1176,
+  680, 1356, 2185, 550, 1392, -1888, 444, 480, -342, 768, -118, 455, 208, 1179, 1248, -1484,
+  2140, -615, 0, -1414, -1014, -200, -2700, 1918, -119, 226, -510, 133, -1287, -2432, -612, 791,
+  -429, -1375, 3552, -1134, -1180, -300, 464, 0, 1560, 1560, 1485, 230, 273, 0, 1722, -2220,
+  -540, 783, -294, 963, 1016, -291, 973, -1288, 1665, -1308, -828, 415, -2159, -324, 516, 0,
+  -680, -1469, -230, 1540, -2784, -826, -740, 96, 1140, 192, -1416, -910, -1352, 2489, 960, 212,
+  -1391, 1353, 315, 505, 507, 500, 700, -959, 0, 113, -612, -133, 990, -1152, 816, 678,
+  572, 0, 480, -504, -472, -375, -1508, -1830, 208, 1080, -594, 805, -637, -810, -984, -1776,
+  -1215, -87, -2205, 963, -1651, -485, 2224, 644, 888, -436, 552, -498, -2286, -756, -774, -98,
+  1088, 0, 690, -880, -348, -354, 1924, 576, -342, 2784, 472, -364, 520, -524, 1248, -212,
+  1498, 0, -2310, 0, -169, 200, 400, -685, -833, -904, -1734, -532, -1188, -3456, -1530, 904,
+  286, -1125, -1440, 2142, 708, 675, -1740, -1830, -936, -720, -198, -460, 819, -675, -246, 1443,
+  -1080, 174, 294, 749, -1524, -1746, 695, -1840, -444, -981, 552, -415, 0, 0, -1419, -1176,
+  1632, -1695, -230, 1980, 1276, -1062, 740, 384, -456, -1344, -472, -1274, 624, 393, -96, -212,
+  -1498, -738, 630, 303, 169, 200, 900, 0, 238, -339, -102, -931, 297, -1536, 1020, -1469,
+  1573, 875, 192, 126, 354, -450, -1160, 1708, 624, 360, 297, -460, 364, 405, 0, 222,
+  0, 609, -2793, -642, -889, 194, -139, 920, 1887, -654, 1104, -996, -127, -1080, 774, -196,
+  1224, -904, 575, 1210, -348, -1062, -296, 480, -342, -960, 1180, 1001, -312, -1048, 192, 848,
+  963, -1599, 210, 707, -1521, 400, -100, -1096, -238, -113, 612, -665, -990, -768, 816, -1017,
+  -1430, 250, -1056, -252, 944, 1500, -2204, -1708, 520, 2520, 891, -2300, 910, 1215, -615, 666,
+  270, -348, 0, 2033, 1524, 97, 1668, -184, 999, 872, -1104, -1328, -1016, 540, -903, -1666,
+  0, 1130, 690, 990, 928, 826, 444, -1152, -1938, 864, 0, -455, 104, 917, 0, 530,
+  749, 738, -1680, -505, 845, -100, 0, 822, -2023, 4746, -1122, -3192, 891, 1152, -2244, 678,
+  1716, -4250, 192, -630, -1180, 750, -2552, 366, -1352, -840, 2970, 2530, 1183, 2025, -3567, -888,
+  270, -2436, -2940, -1070, 2794, 582, -3197, 0, -1554, 1853, -2208, -1328, -381, 648, -645, -1274,
+  -1088, 452, -460, 2530, -1740, -2714, -5476, -1728, -1596, -2208, -1652, -1456, 1040, 786, 1728, 212,
+  1498, -1722, 420, -1515, 1014, -1100, 1300, 0, 1309, 791, -1632, 0, -594, -1152, 1326, -2034,
+  -2288, -375, 960, -2646, -236, 975, 580, -1830, -104, 1800, 1485, -1380, 546, 1755, -1107, -111,
+  -1215, 870, 588, -1605, -1524, 194, 556, 1288, 888, 109, 552, -996, 508, 1296, -129, -1176,
+  -2040, -1356, -1150, 770, -696, -708, -1332, 288, 1482, 384, 354, 455, 208, 1310, -960, 742,
+  214, -2214, 840, 1515, -1183, 400, 300, 1918, -833, -226, 408, -133, -297, 1280, 1224, -1582,
+  1287, 1125, -576, -2520, -354, -1275, -1856, -854, -1144, 840, 1089, -2070, 1911, -675, 738, 1110,
+  1215, -696, 1029, 3210, -254, -679, -2224, 1104, 1332, -2071, -1794, -1660, -2286, -1620, 258, -588,
+  -2176, 1017, -345, -1760, -812, 1416, -1924, 480, -1368, 1824, 0, -728, -1248, 1572, -384, 1696,
+  -214, 2337, 1155, 1111, -2028, -2000, -800, 1644, -476, -1130, -102, 1197, 99, -3968, -1836, 2599,
+  1716, 2000, -2112, -1512, -944, -1275, 1508, 1586, -312, -840, -1089, -3795, 637, 3915, -492, 555,
+  270, -348, -147, -963, -2159, 388, -3058, 1380, -1221, -327, -1104, -2324, 127, -1512, -2709, -1568,
+  1088, 1921, 2875, -220, 1044, 236, 592, 288, -4218, -3648, 708, 1456, -1768, -1310, -96, -530,
+  1177, 123, -1260, 101, -2197, -600, -2800, -137, -1309, 904, -1224, -931, -1287, -256, -1632, -565,
+  -286, 1375, 1056, -756, -1416, -1200, 2436, 366, -1768, 840, -1485, 1840, 637, -1485, -369, 777,
+  -1215, -261, -2793, -2247, 889, 1164, -417, 1196, 888, -218, -138, -1909, -4064, -216, 129, 1666,
+  816, 1356, -2530, 220, -812, -826, 592, -768, -1938, -2400, 0, 1092, -1976, 1572, -192, 1696,
+  107, 0, -315, 1515, -2535, 300, -1700, 959, -595, 678, 102, 1064, 297, 768, -714, 339,
+  -429, 125, -576, 1260, -1534, 75, 1856, -1098, -728, 240, 2376, -460, -1183, 1080, 1476, 2109,
+  -1080, 1044, 1176, -428, 635, -485, 1807, 184, -111, 327, 2346, -1328, 508, -1080, 1806, 294,
+  -816, 1130, -690, 1650, 696, -1062, 296, 96, -684, 96, -944, 910, -832, -1179, 576, 106,
+  1819, 861, -840, -404, -1352, 300, -100, -137, 952, 1808, -816, 665, -1386, -512, -918, -565,
+  -1001, -375, -1728, 0, -1062, 0, 464, 122, -624, 1200, 297, 115, 364, 1890, -738, 1332,
+  1890, -174, -882, 856, -1905, -1746, 139, -460, -999, -109, -828, 0, -762, 972, -387, -196,
+  -1088, 0, 0, -880, 696, 0, 148, 864, 912, -672, -472, -728, -104, 655, 576, -636,
+  963, -1845, 105, -707, -507, 100, -500, 822, 714, -226, -1224, -266, -1386, -2176, -306, -678,
+  -572, -3000, -864, -2268, 354, -1275, 580, 1098, -1352, -1680, 1188, -690, 1001, -405, 615, 444,
+  -675, -957, -588, 1391, 0, 970, -1529, 828, 333, -872, -828, -830, -1778, -648, -774, 392,
+  -1632, 1130, -805, -550, -1392, 354, -4292, -1440, -1368, -1824, 0, -910, -1768, -1179, -768, 424,
+  -428, 1230, 1050, -1616, 1014, 0, -2100, 685, -595, -565, -408, 2394, 396, -128, -510, 0,
+  2145, 875, -1248, -2016, 354, 300, 1160, -732, 1560, -600, -792, -1035, -1001, 945, 369, -1221,
+  -1215, -174, 1176, -428, -254, 194, 2502, -2208, 1110, -763, -2070, -996, 1016, -1620, 258, -980,
+  -816, -1243, 2070, 110, 232, -472, -148, -768, 1368, 1536, 472, 0, -936, 131, -672, 106,
+  -1926, -984, -1785, -404, 6084, -1200, 1800, 1918, 1904, 2599, -510, -1862, -594, -2816, -1224, -1017,
+  4147, -875, 960, 2016, -236, -375, 1160, 1952, -1768, -1920, -2970, -115, -2275, -2160, 2091, 1665,
+  -4455, -261, -2205, -642, 2413, -1164, -278, -920, -2886, 218, -1242, 0, -508, -1404, -1935, 1372,
+  -816, -1017, 460, 440, -580, 1652, 740, -192, 0, 0, 236, -910, -1248, 393, -960, 1272,
+  2354, 1107, -2205, -1717, 3887, -1400, -700, -822, -952, 1582, -1122, 532, 0, -2048, -1734, -791,
+  2574, -3750, 1824, -756, -1652, -675, 812, 976, -1664, 3600, -1089, 1150, -2002, 1890, 984, -222,
+  -2565, -2349, -2352, -535, 508, -873, 556, 276, -666, -1308, -1794, -1245, -1016, 1296, -129, -980,
+  544, -3277, 460, 330, 1160, 472, 1480, -2592, -912, -1632, -236, -728, 208, 393, 384, -1484,
+  -1177, -2460, -840, 101, -845, 700, -1700, 1644, 119, -452, 306, 1729, -990, -1408, 714, -339,
+  1287, 125, -1344, 1260, -590, -75, 232, -2684, -624, 240, 2079, -230, 0, -135, -1230, 999,
+  -135, -87, 1911, -1284, -1143, -97, -1529, -644, 999, -1308, -966, 581, -1397, 1836, -774, -686,
+  -1360, -2147, 345, -330, -1972, 1652, 2220, -288, -114, -960, -1652, 364, 0, 0, -1536, 318,
+  -1284, 369, 1785, -1515, -845, -1000, -200, -137, 1666, 2373, -102, -133, 990, -2048, -2142, -1469,
+  143, 750, 1440, -1638, 3658, -75, 2320, 1098, -208, 1800, 396, -1035, 910, -945, 0, 1110,
+  0, -2088, -441, 856, 1016, -1649, 1529, -828, -444, 2834, -966, -1328, -1143, 108, 516, -2744,
+  2040, -2486, -1150, 0, 1160, -708, -444, 384, 1938, 384, 472, 728, -1872, -2227, -1152, -742,
+  -1177, -492, -630, -2323, 3887, 100, 900, -822, -238, -1582, -714, -931, 1287, -384, 612, -565,
+  2431, 750, 1056, -2898, -590, 900, -116, -610, -832, 2640, 1089, -2300, -910, -945, 492, 1776,
+  -540, -1218, -3234, -963, -1524, -1843, -278, -920, -1887, -218, -1932, 0, -508, 2268, -516, -2842,
+  3128, -1808, -805, -880, -1044, -826, 2072, 864, 684, 1152, 118, -819, -1144, -524, -3168, 212,
+  -1605, 615, -735, -1515, 338, 400, 2000, 137, 2142, -2260, -714, -532, -198, 512, -408, -2147,
+  -1859, -125, 2496, -1890, 0, -1650, -1160, 1342, 104, 1920, 1881, 2185, 182, 2835, 615, 111,
+  -2565, -1392, -1470, -642, 889, 194, -2502, -1564, 1887, 327, -552, 664, 2794, -756, 387, -2744,
+  816, -791, 920, -1320, -812, 1416, -2516, 0, 684, 384, -236, 637, 624, 1310, -192, -1272,
+  -856, 1599, 1365, -1515, -169, -1700, -900, 411, 0, 0, -1836, -931, -990, -1152, -1224, 678,
+  -1716, 1250, -480, -504, 0, 1350, -464, -732, 104, 1440, 2772, 1035, 1365, 1350, -2214, 888,
+  -2160, 783, -588, 1177, 381, 97, 834, 1380, 444, 1308, -276, 83, -1270, -648, -1548, -98,
+  -1632, -339, 0, -1320, -464, -1416, 3700, -576, -1368, 576, 472, -364, 312, 393, 1344, -318,
+  107, 123, -630, 909, 0, -600, -500, 0, 357, 565, -204, 1197, 99, -640, -1122, -1356,
+  -2002, -125, 1728, 126, -826, -75, -1508, 366, 1144, 1560, -1089, 230, -1365, -540, 1845, -333,
+  -540, -1131, 1764, -1498, 127, 1358, 2363, 368, 444, 1417, 2346, 83, 1905, 972, 903, -882,
+  -2176, 452, 1150, -2420, 1160, -354, -592, -1248, -1596, 0, -944, 910, -104, 1310, 672, 742,
+  1712, -1230, -1155, -808, -169, -1700, -200, -3836, -1666, -1921, 0, 2660, 0, -1920, 816, 2825,
+  -1144, -500, -1728, 378, 1888, 225, -2900, -1098, -1976, 240, 396, 1150, 364, 1215, -246, 777,
+  -945, 1566, 441, 749, -889, 1358, 1112, -1104, 555, 981, -966, 3403, 1270, 0, 774, 1274,
+  -952, -1469, 690, 2310, 464, -826, -1036, 768, -1254, 1344, -2596, -1456, 0, -655, 864, -1802,
+  642, -246, 3675, -101, -2028, -1300, 2200, -137, 357, -678, -102, 1064, 2079, -1920, 1020, -2147,
+  143, 1750, -1632, 504, -4130, -1500, 928, 488, 416, -360, -1584, -1610, -1547, 0, -2706, 777,
+  2700, -1131, -3234, -1926, -254, 1843, 0, 1288, 555, 654, -3864, 498, -508, 108, 1419, -294,
+  544, -113, 0, -1870, -580, 0, -296, 288, 1368, -1056, 1298, 273, 2184, 131, 1344, -1166,
+  -214, -3321, -2100, -1212, 338, -800, 0, -4521, -714, 2712, -306, -1064, 2079, 384, 918, 1130,
+  -4433, 750, 0, -2520, -590, 300, -696, -1586, -416, -1200, 594, -1150, 455, -1350, -1599, -111,
+  -270, 1566, 1323, -963, 1270, 1843, 973, -828, 222, -436, -2898, 249, 0, 2808, -3741, 588,
+  1632, 678, 115, -2420, 1160, 472, -1184, -672, 0, 384, -354, 1092, 0, 4585, 1536, 424,
+  -428, 123, 945, -303, -676, 0, -2100, 1781, -1071, -226, -612, -266, -2178, -896, -1632, 452,
+  -3003, 2000, -672, -2268, -4248, 1125, 1276, 122, -1664, 1200, -297, 2530, -364, -405, 246, -1554,
+  405, -696, -3528, 428, -1143, 291, -695, -736, 2331, -1090, 690, -1079, 381, -3564, 1161, -686,
+  -680, -1243, 920, -330, -464, 354, 592, 1632, 0, -192, -826, -91, 520, -2882, 1056, 2120,
+  321, 984, 1890, -2525, -1690, 2100, 700, 0, -833, -1808, 2142, -4921, 0, 896, -612, 2938,
+  429, -1625, 0, 3402, -1416, 750, 1276, 0, 1456, -600, 99, -1035, 273, -2970, -1476, 777,
+  405, -1479, -3528, -749, -2159, -2231, 695, -1932, -222, 545, 276, -581, 889, 540, -1419, 0,
+  544, -2599, -3910, -220, 580, 1416, 2220, -3360, 1938, 576, 1298, -2730, 2912, -2227, -1248, 848,
+  -1284, -2091, -1575, 505, -3042, 2000, -1700, -959, 1785, 0, -306, 931, 1287, 2688, 1122, -3277,
+  1716, -500, 0, -1134, -2006, 975, 232, -976, 728, 0, -1683, 1495, -182, -270, 984, -666,
+  2565, -522, 294, -1070, -508, -194, 834, 2576, 3330, -2398, 828, -2573, -1905, -1728, 1290, 882,
+  -816, 1243, -1035, 0, 580, 4248, -148, -1728, -342, 192, -1770, 0, -1456, -2096, -1536, 1060,
+  -214, 123, -945, -606, -676, -300, -800, 1370, 714, -1582, -1428, -266, 297, -640, -714, 113,
+  715, -2125, -288, -630, -472, 75, -1160, -2196, 1560, -720, -792, -920, 1911, 945, 615, 0,
+  2295, 0, 1617, -856, 508, -1261, -139, 1104, -1443, -1308, 414, -747, 889, -1728, -387, 294,
+  -544, 339, -230, -550, -1044, -472, -1776, 0, 1140, -480, 708, 91, -416, 262, -480, -1060,
+  -214, -861, 315, -1111, -507, -1000, -1600, 274, -238, 339, -816, -266, -2871, 1152, -3162, -226,
+  3861, 2625, 288, 504, -472, -450, -1740, -488, -728, 1080, 693, -690, -910, 405, 246, 0,
+  -1215, -348, -1470, 2996, -254, -1358, 556, 92, -666, 872, -1242, -1660, 0, -108, -1290, -1372,
+  -2856, -1582, -2415, -110, -464, 1062, 1924, 1536, 2508, -96, 1534, 273, 832, -917, -2400, 848,
+  428, 861, -525, 808, -1859, -700, -2400, 274, -1785, 2147, -1428, -931, -396, 640, 816, -452,
+  715, -875, -384, 378, 708, -1950, -232, 854, -728, -960, 1188, -2070, 182, 1485, -492, 1554,
+  1215, 957, 1029, -1070, 127, -679, 139, 368, 1887, -2398, 414, -332, -1016, 540, -774, -686,
+  -544, -1582, -1840, -1540, -2320, 944, 2220, -1344, 798, -1440, -1416, 1820, -1768, -917, -576, 424,
+  -214, 492, -1260, -1212, 1183, 1900, 1200, 411, 714, -1921, -102, 3724, -891, -1664, 1530, 226,
+  -715, 750, -1824, -504, -590, -225, 0, -1464, -1248, -360, -594, 690, -1001, 1485, 123, 333,
+  945, 174, -441, 0, 1270, 97, 417, -1472, -1998, -872, -4416, 249, -1397, 540, -2580, 196,
+  -1088, -565, -115, -1210, -1856, -1652, -1036, -288, 798, -192, 708, -2002, 1248, -1048, 1152, 1378,
+  1819, 615, -1785, 303, 1183, 1900, 200, -3425, -2499, -2486, -2346, -5187, -297, 384, 1020, -904,
+  1287, -250, 96, 1512, 1770, 225, 3596, -1098, 832, 960, -1782, -1265, -182, -675, 492, 3108,
+  -2565, 2088, -441, -1605, 1651, 97, -1668, -2116, -1221, -327, -1656, 1411, -4064, 1944, 2322, -1372,
+  -2176, 2599, 690, 550, -2552, 708, -1776, 1344, -912, -192, -2242, -2275, 624, 0, 1824, 1908,
+  -214, 2706, 1680, -404, 338, 900, 100, 685, 1666, 1130, -3366, 798, 0, 3072, 714, -791,
+  -429, 3250, 288, 378, -236, -975, -1856, 2806, 0, 1800, 0, -1035, 819, 0, 738, -222,
+  -675, 435, 1617, -749, 1397, 1067, 1390, 184, 222, -436, -2898, 83, -635, -1296, 0, -294,
+  -680, -452, -2300, 1430, 2668, 1062, 2220, -96, 228, 96, 2124, 910, -624, -1834, -672, -530,
+  -321, -369, 105, -303, 845, -600, 1000, -2329, -595, -1130, 204, -2128, -99, 640, -1020, 904,
+  -1430, -1625, 1344, 1134, 2242, -900, 0, -2074, -2184, -840, 1089, 920, -1911, 2295, -2460, -1887,
+  1080, -870, -1323, -642, -3429, -1552, -2085, -2116, -1332, 545, -1656, -664, 381, -1404, 0, 1078,
+  0, -904, -575, 2310, 928, -1062, 2516, -2784, 1596, -1440, 2596, -2002, -416, 1834, 672, 212,
+  -2033, 123, 1785, 0, 507, 300, 800, 4932, 2261, 678, 816, 399, 1485, 0, 612, 452,
+  -286, 500, -96, -4914, -708, -900, 232, 610, 624, -240, 99, 575, -1365, -1350, -369, 333,
+  1080, -1218, 882, 3959, 254, -3686, 2502, 552, 666, 1526, -966, -1245, -762, -3024, -2838, -2744,
+  -272, -339, -1840, 330, -116, -118, -1628, 96, 1710, 192, -1652, 1365, -2496, -524, -576, -212,
+  -428, -861, -525, -202, 845, 1500, 0, -548, -476, 2147, -408, 1330, -3762, 2304, -204, 113,
+  0, -375, 2880, -378, 472, 525, 1276, 3050, -2912, 960, 1485, -1955, 455, -945, 2214, 2109,
+  675, -696, -588, -856, -1651, 0, 695, 1564, 666, -872, -2208, -1992, 127, -1188, -1290, -882,
+  -544, 678, 0, 990, -2204, 0, 444, -1536, 912, 1920, 1298, -182, -520, 1441, 192, 3180,
+  321, -861, 525, -909, -2704, -400, 0, -2055, -1071, -1695, 102, -1064, 1188, 896, 2754, -1469,
+  0, 0, -192, 252, 1416, -1050, -696, -1708, -2080, 720, 198, -1725, 91, 1350, 615, 444,
+  -2970, -261, -588, -1498, 2032, 291, 973, 0, -888, 0, 552, -166, -1778, 1404, -645, 1960,
+  -408, -791, 805, 770, 696, -1888, -888, -1056, -1026, -864, -354, 273, -1248, 0, -384, -742,
+  -642, -1353, -1260, 606, -3380, 100, 1200, -1781, 119, -113, -714, 266, -693, 1408, 1224, 791,
+  2002, 875, -96, 1008, -354, 600, 1508, -1342, -2496, -960, -396, 2645, -91, 0, -1230, -1665,
+  0, 0, -2499, 1605, 2794, 388, 1946, -552, 888, -436, 1104, 83, 889, 108, -258, 1470,
+  -272, 452, -230, 550, 2088, -1888, -444, 1440, 1026, 96, -1062, 637, 208, -262, -192, 1272,
+  -107, 1107, 945, -404, -1352, 1900, 1100, -959, 1071, 791, -510, 0, 297, -2432, 1122, 339,
+  2145, 1625, 0, 504, 472, 300, -580, 3172, -832, 960, 297, 115, 910, 2430, 1476, -1221,
+  -270, -522, -1029, -535, 1524, 97, -973, 552, -333, -763, -138, 1245, 1016, 2160, -1032, 686,
+  -1632, 2260, -345, -1980, 464, 1062, 2516, 576, -2736, -288, 2950, -91, 2288, -655, 480, 1166,
+  -1498, -984, 0, 404, -2366, -1000, -400, 548, 1190, -1469, 612, 1729, -1386, 128, -816, 1130,
+  1573, 1250, 576, 1890, -1180, 1950, 1624, -1464, -624, 600, 99, 230, -364, 810, 2337, 0,
+  0, 1479, -1470, 1070, 1397, 194, 695, -460, 2220, -4251, 0, -1328, -2794, -324, 1161, -1372,
+  0, -3164, 690, 2310, 1624, 1416, 2664, 960, -1596, 96, -708, 1183, -728, -2882, -1344, -1802,
+  -428, -738, 630, 909, 1859, 0, -1100, 2329, 4165, 2373, 0, -1064, -4554, -5504, -2448, 0,
+  -1859, 0, 192, -1890, -2006, -1950, -2668, 2684, -2184, -720, -99, -115, -1911, -945, 369, -1221,
+  -1215, -783, -3381, 856, 889, -97, -3336, 1288, 1443, -545, -966, 747, -635, -1728, -2838, 2254,
+  -1224, -904, 230, -2310, 0, 826, 1332, -192, -1710, -1632, 1416, 1365, -728, -2620, -1344, 1802,
+  2354, 1353, -1365, 1313, 1014, -1200, 500, -2192, 595, 678, -1326, -1463, -891, 512, -816, -113,
+  0, -1750, -1824, -1134, 1062, -375, -2088, -122, -416, 2520, -990, -1380, -364, 0, 492, 1221,
+  -540, -348, -1617, 321, -381, -1649, -139, 184, -1110, 763, -1242, 913, 1270, 864, -903, -2058,
+  -3400, -678, -920, 1980, 928, 0, 1628, -384, -1824, 1632, -1062, 364, 312, 393, -384, 1378,
+  0, 123, -840, -1010, -507, -1200, 1300, -822, 714, 678, -510, 665, 891, -2688, -510, 226,
+  3575, 1625, 384, 378, 1062, -675, 580, -2074, 104, -720, -99, -115, 273, 135, -1599, -2442,
+  -945, 348, -1617, -963, -762, 1358, -139, 184, -999, 872, -1932, 1411, -1524, -2592, 0, 490,
+  952, 678, -805, 0, 348, -236, 888, 960, 1482, 1632, 354, 1456, -1144, 131, 192, -1908,
+  -2568, 369, 210, -1919, 1521, -600, 2500, -1644, -1071, 3164, -1020, 0, -891, -256, -1326, -791,
+  2288, 1500, 1440, -4284, -708, -150, 1740, -122, -2808, 1680, 1089, -575, 910, 1215, -1353, 333,
+  -2970, 174, -1617, -642, -2540, 2037, -278, 1104, 222, 2834, 690, -166, -381, -4644, -2709, -2352,
+  -272, -113, -1380, 990, 348, 1534, 592, 672, 2052, 768, 2006, 728, -312, 2620, 1248, -742,
+  642, -492, -945, -909, 676, -1900, 2700, 1370, 2142, -2147, 102, -798, -891, 384, -918, 1582,
+  572, -250, 768, -2016, -236, -225, 0, 244, 208, 1200, 1287, -2185, 1001, 270, -2091, 1998,
+  0, -348, -1323, -1498, 2667, -388, -139, -920, -555, 109, 276, -498, 1524, -4212, -645, -392,
+  3944, -678, -575, -220, 1624, -3776, 2516, 384, 684, 2016, 1062, 1092, 936, -1310, 480, -3074,
+  107, -1230, -1890, 909, -1352, -600, 1200, -3151, -714, -113, -408, -399, 198, 256, 918, -113,
+  -286, 375, 768, -2268, -2124, -900, -1160, -366, -1872, -720, -1584, -805, -364, -945, -1722, -1110,
+  -2700, 87, -1029, 321, 2667, -1940, -695, -184, 111, -436, 1518, -166, -127, -324, -1290, 2450,
+  2176, -339, -1955, 220, -928, -1770, 4588, -672, -2052, -864, -1062, -1638, 416, -262, 384, -848,
+  -428, -369, -105, 2020, -338, 1500, -500, 685, 1785, 339, -2040, 665, -1485, -640, 1224, 226,
+  -1573, 1000, -1152, 1260, -1062, -525, -812, 366, -1144, 1440, 693, 1265, -364, 2295, 369, 444,
+  810, -87, 0, 1712, 635, -97, -1668, 828, 2109, -1853, 690, -581, -635, -864, -1935, 784,
+  1224, 452, 1725, -770, -116, -1888, 1480, 192, -1026, -768, -472, 273, -832, -1703, 672, 742,
+  -214, -861, -945, 404, 0, -1300, -900, -1918, -476, 1808, -204, 1330, -297, -2560, 306, 1243,
+  858, 2250, 480, 126, -354, -600, -348, 1830, 1144, 1560, 792, -920, -1001, 3375, 615, -1776,
+  -2295, -174, -588, 642, -889, -388, 4170, 552, 444, -654, 552, -1909, -889, -1944, -516, -490,
+  1360, -339, 460, 550, -1160, -472, 2812, -384, 1710, 96, 0, -455, 2184, 262, 960, 318,
+  -214, -4182, -1470, 1717, -2197, 700, -1700, 1781, -238, 339, -1224, -266, 693, -1408, -1734, -452,
+  1144, 2625, -1152, -2016, -2360, 0, -928, -1342, -832, -1320, 297, -920, 1001, 2430, -123, -666,
+  1620, -261, -441, 963, 1524, 0, -556, 0, 888, -1635, 828, -913, 1270, 756, 1290, 2058,
+  -952, -1243, 115, -2310, 1624, -590, 1776, 864, 0, 672, 590, 455, 104, -917, -1152, -1908,
+  -1177, -1476, 1365, 404, -507, -700, 600, 959, 0, 2486, 102, 4123, -495, -1152, -1734, -1130,
+  -858, 1875, 0, -1890, -1062, -1350, 2900, -122, -1664, 480, -594, -1955, -2730, -945, 2583, 0,
+  2295, 174, -3234, 749, -3937, 1067, -2502, 1472, 1332, 1635, -3864, -1743, -381, -1836, -1548, 3038,
+  -816, 2486, -575, -3630, 3364, 472, 2664, 672, 2052, 192, 4602, 1729, -312, -1179, -768, -1272,
+  -749, 369, 525, 202, 2704, -1100, 1100, -685, 476, 565, -3162, 1729, -891, -896, 0, 226,
+  715, 750, -2688, -1008, -2124, -675, -928, -2806, 104, 2160, -297, -1265, -455, -405, 1353, -333,
+  -540, 87, -2352, -963, -2413, 1455, 278, 1656, 1443, -2180, -2070, -664, -889, -1728, -387, 1470,
+  -952, 678, -460, -2530, 232, 826, 1332, 480, -342, 96, 1062, -1456, -624, -917, 768, 1378,
+  107, -3075, 210, 505, 676, 1200, -200, -411, 238, -1356, 306, -1197, -594, 2816, 1530, 2825,
+  -2002, -625, 96, -2016, 590, -1425, 464, 854, -208, 2280, -594, 0, 364, 270, 492, -666,
+  -1620, -522, -441, -428, -127, 1164, 695, 1656, -111, 1635, -966, -747, -1143, -864, 3225, -1568,
+  272, 791, 2185, -1650, -116, -2242, 1036, 672, -1254, -1824, 1416, 91, 1352, -131, 864, 636,
+  -749, 123, -420, -606, 845, 700, 600, -411, 0, -678, 102, -1064, -4059, 128, 510, 2825,
+  2717, -1125, -288, 1260, -472, -1725, -696, 1464, -3120, -1920, -693, 690, 637, -2160, 123, 666,
+  0, 609, 1323, 2354, -2159, -1746, 2224, -460, -2331, 872, 0, 0, 1397, -1404, 0, 3332,
+  2040, -3390, -230, 550, -2552, -2242, -5032, -960, -342, -192, 1298, -2639, 104, 1834, -1056, -636,
+  -1070, -1476, 1260, -808, -1014, -1700, 200, -685, 3332, 1921, -204, 665, -990, -1280, 1020, 226,
+  286, -3500, 480, -1890, 1652, -1350, 1044, 1464, 1976, -2040, 198, 1035, -546, 405, 984, 222,
+  -1620, -87, 441, -642, 1778, 776, -417, 1564, 1443, 109, 690, -1494, -635, -1620, 645, 0,
+  1088, 678, 2070, 550, -232, 472, 1924, -384, 1710, 1056, -708, -273, -1664, -1441, 1536, -1272,
+  -107, 1968, 1050, 909, -338, -500, -100, 2329, 595, -113, -510, 798, -198, -640, 204, 226,
+  -286, 625, 1152, 1386, -236, -750, 348, -1342, -1560, -480, -495, 690, 546, -1080, -615, 999,
+  810, 0, 1323, 428, -1143, -679, 556, 1472, 1776, -1853, -552, -996, 1651, -756, -645, 3136,
+  -544, 339, 1265, 110, -1508, -1062, 2812, -864, -342, 672, -2242, 637, -624, -1572, 192, -742,
+  642, -3567, -315, 1212, -2873, -300, 300, -1096, -714, 339, 102, 0, -792, -2176, -1224, -113,
+  715, -1250, 2304, -1386, 236, 450, -116, -1220, -624, 480, 990, -1610, -455, 810, -1353, -666,
+  -945, -261, 588, 428, -381, -97, -417, -1380, 1776, 218, -1794, -83, -381, -216, 1935, -1470,
+  -1224, -1469, -690, 330, -348, 1770, 0, 192, 570, 576, 826, 273, 1144, 131, 96, 636,
+  -1819, -1353, 0, 0, -2704, 1200, 1300, -1370, 595, 1469, 102, 931, 99, -3328, 0, -1808,
+  2288, -1500, 192, -882, 944, -300, 928, -1342, -2808, -1440, -99, 1725, -1274, 2160, -246, -999,
+  -2025, -783, -735, 963, -1016, 1940, -695, 0, 888, -981, -828, -2490, -2921, 1404, -129, 882,
+  -2448, -565, 0, 0, -928, 354, 1332, 672, 3420, -192, 354, -1274, 104, -524, -672, 742,
+  -749, 984, -315, 808, -2028, -400, 2100, 2055, 833, 339, -204, -133, -1584, -384, -714, 565,
+  286, -1250, 1056, 126, -2714, -1050, 1044, 610, -1040, -2040, 198, -690, -1820, 1215, -246, -1887,
+  1350, -870, -2793, 963, -1143, 97, 1807, 460, -1332, -109, -1518, -830, -1270, -540, -258, -1176,
+  3672, -339, 230, -1650, 464, 236, 1924, 192, -1596, -960, -472, 819, 0, 0, 1440, 424,
+  1498, 738, -4305, 505, 507, -2800, 0, 1233, -1785, 1130, -1224, -4256, -1782, -1792, 1122, -113,
+  -429, -4125, 864, -2394, 1298, 375, 116, 122, 3120, -480, 198, -1495, 455, -3375, -2583, -1665,
+  945, 1653, -441, 321, 2540, -194, -2224, 1104, -888, 3161, 552, -498, -1778, 1836, 258, 392,
+  -1496, 1582, 575, 2860, 2436, -2714, -1184, -672, -1596, -672, -3422, -364, -832, 2227, -96, 0,
+  749, -1968, 420, 1212, -2366, -700, 500, -1781, 2142, 452, -1020, -665, 792, -1920, 1122, 452,
+  1144, -1000, 1344, -2142, -1534, -300, -1160, -1830, -1560, 1680, 198, 805, 364, -540, -2952, -1443,
+  -1215, -1914, -3087, -2140, -508, 194, 834, -1656, 2109, -218, -2208, -249, -508, -540, -1419, 392,
+  272, -2034, -920, 330, -116, 236, 444, 192, -570, 384, -826, -182, -104, 655, 768, 848,
+  -1284, -1107, -420, -808, -1014, 2000, -100, 0, -357, 3164, -408, 532, 0, 128, 1122, -2260,
+  3432, 750, 864, -1638, -1180, -750, -580, 0, -1144, 240, 0, -1610, -1001, 1215, -615, -3885,
+  -540, -957, -1029, 428, 2921, 1358, 695, 552, 0, -1962, -1380, -1079, -254, -1188, -1161, -2058,
+  -1496, 113, -230, -1430, -348, -944, 1924, 1344, 684, -96, 354, 1638, -1248, 262, -864, 742,
+  2354, 3813, 1680, -2222, -1183, -800, -1200, 1096, 238, 1695, -1122, -133, 0, -1408, -3060, -1921,
+  286, 1250, 1344, -252, -944, -75, 116, 2562, -728, 1200, -1287, -1840, 91, 0, 2214, 1776,
+  945, 0, -2058, 1926, -381, -582, 0, 1656, 1998, -1090, -552, -747, -1270, -324, 0, -1078,
+  3400, -3164, -4140, -770, 0, -236, 888, -672, -570, 1632, -472, 2093, -832, -2227, -768, 1378,
+  321, -1476, -735, -1414, -845, -1100, 700, 274, 595, 0, -1326, -665, -792, -1280, -306, 339,
+  -2288, -625, -1056, -756, -826, -525, -2552, -854, 0, 720, -495, 0, 728, 270, -2706, -333,
+  0, -1392, -1470, 0, -1397, -1746, -278, 1472, -1554, -763, -1242, -415, -635, 324, 3354, 392,
+  -544, -1243, -115, 330, -1160, 118, -296, -1344, 1254, 672, 472, 2093, 0, 917, 384, -1378,
+  -642, -2091, -945, 1212, 0, -500, -1300, -1233, 2261, 1243, 816, 1330, -495, -5504, -102, 791,
+  1716, -500, -96, 0, 944, -675, 1160, -1098, 208, -240, -594, -230, -637, 3780, 369, 888,
+  -1620, 1653, -2940, 1498, 254, 0, -3058, -920, -555, 545, -552, -83, -762, -756, 903, 1666,
+  -2040, -1017, 1495, 330, -928, 2124, 1332, 288, 114, 192, 1180, -182, 104, -1703, -480, 1060,
+  535, -2583, -315, 909, 845, -800, 1500, 548, 119, 339, 0, 399, 99, -1920, -204, -2147,
+  -572, -1625, 480, -1638, 1770, -1875, 580, 244, -624, -600, -594, -690, -728, -810, -246, 444,
+  2025, -1131, 882, -321, 1778, 194, 139, 92, 1332, 1090, -1932, 581, 254, -864, 774, -686,
+  -136, 678, -345, -220, 2668, 1062, 1480, -672, 912, -864, -1416, 728, 104, 1965, -1248, -636,
+  1070, -1230, 0, 303, 1014, 200, -1200, -548, 1190, -452, -510, -931, -198, -2048, 1734, 1582,
+  1001, 125, 1056, -1008, -472, 450, -232, -1830, 728, 840, 297, 230, -182, 675, 615, 333,
+  0, -87, 441, 321, 381, 291, -1251, -184, 1110, 1853, 1104, 83, -1778, 1512, 1677, -1764,
+  272, 1808, -1495, -1100, -2204, 236, 0, 192, 1254, 960, -708, 1183, 832, -524, -288, 848,
+  1391, -861, 105, 3434, -845, -2200, -2400, 1233, 1071, -113, -306, 2793, -990, -512, 1326, 1808,
+  -572, -1375, 1440, -2016, 826, 675, -2088, -976, -312, -1440, 0, 1955, 819, -270, -738, 555,
+  -270, 1653, -294, 1605, -1905, -97, 973, 1656, -444, -1635, 1932, 498, 381, -1404, 1032, 1274,
+  1088, 2599, -1610, 440, -348, -1298, -592, 2496, -684, 1152, 354, 819, 416, -1834, 1728, 2120,
+  749, 1476, -525, 808, 3042, -500, 1300, 274, 1309, -113, 2448, -665, -990, -2048, -1632, 1582,
+  286, 125, -960, -2520, 1062, -2025, -3248, 3172, 1040, 3120, 99, -1840, -91, -2835, 1107, -1887,
+  1890, -957, -1764, 535, -1016, 1067, -3336, 1564, -999, 2398, -2070, -1411, 1143, 216, 2064, 2646,
+  -2312, 2938, -805, -1650, 696, -2596, -1480, -96, 114, 480, -1770, -1274, 832, 1572, -864, -1060,
+  -749, -492, -840, 3333, 0, -200, 700, -548, 3213, -565, 918, 266, -1287, -256, -1020, -339,
+  -858, 1250, -1632, -630, 118, -1200, -928, 0, -1248, 720, 99, 575, -2093, -135, 1476, 1887,
+  -1350, 2436, -1323, -214, 127, -1164, 1668, 828, 333, -218, -690, 747, -254, -756, -1161, -588,
+  -1224, 1695, 230, -2530, -232, 944, -1332, 1056, 0, -192, 2950, 546, 2600, -1179, -384, 318,
+  -535, -492, 315, 202, 845, -1400, -100, 1644, 1309, -339, -1734, -399, 1287, -1024, 714, 113,
+  1001, 250, 576, -1260, 2360, 225, -812, 610, 1560, 600, 1386, -2070, 91, 1485, 1476, -1554,
+  -3105, 1740, 3381, 2033, 3175, 970, -1251, 1656, -1332, -218, 4002, 166, -2159, -756, -1419, -686,
+  952, -113, -115, 1540, -464, -1652, -444, -864, -1368, -1248, 590, 728, -2184, 2227, 960, 742,
+  1926, -738, 525, -606, -2873, 0, -200, -1370, -714, 904, -2958, 665, -396, -2304, -1122, 1582,
+  2574, 1375, -384, 504, 590, 375, -1044, 732, -936, -1080, 0, -690, -455, -2700, 123, 666,
+  -405, -435, -1029, 1712, -254, 1067, -973, 92, 1665, -218, 0, -581, -635, -324, 2967, 1078,
+  1496, -1695, -460, -1210, 464, -2950, -444, -768, -912, -1536, 1062, -1001, -208, 0, 576, -106,
+  0, 615, -420, 1717, 507, 500, 900, 548, -1547, 791, 102, 2394, 495, 128, -1428, 226,
+  2002, 1875, 288, 126, -1180, 1125, -464, -1342, 312, 1080, 1881, 1725, 364, 2160, -1845, -555,
+  -4590, 783, -588, -642, 1143, -1164, 1112, 184, 111, -1308, -138, -581, 762, -216, 1419, -196,
+  -680, -904, -460, 330, 928, -708, 2812, 96, -342, 768, -826, -1183, 728, -131, 960, -1378,
+  1926, -123, -420, -404, 1014, 300, 0, 411, -1190, 113, -408, -266, 396, -128, 1734, -1469,
+  -1430, 500, 0, 0, -826, -75, 812, -610, -1664, 2400, -1485, -460, 2093, -1890, -1230, 888,
+  -2565, 783, -441, -1712, 1524, 194, -278, -2668, -888, 0, -1104, 1577, 1524, 756, -903, 294,
+  -1768, -2712, 805, 1320, 1160, -2478, 2368, -672, -1254, 576, 472, 182, -1768, -655, 1440, -530,
+  -535, -861, 630, -1515, 2704, -1700, -1200, -548, 1309, -791, -1122, 798, -990, 1536, -1020, -1130,
+  2288, 1250, 1440, -630, 1062, 750, 928, -2196, -1976, 120, 1089, 1725, 728, -945, 492, 1332,
+  -135, 435, 2352, 3210, 381, 388, -973, -920, 1332, -1526, 828, 747, -254, -2052, -1290, -196,
+  -1224, 0, 345, -440, -1740, 236, -2368, 1152, 684, 576, 708, -2275, -832, 262, -1056, -106,
+  -963, -861, -735, 909, -2197, -600, 200, -685, 1309, 1695, -714, -665, -693, -1664, 1428, 113,
+  -286, -500, 1728, 1512, 236, -450, -580, 1586, 1040, 600, 594, -230, 0, 3240, 984, -777,
+  -2025, -1044, 1323, 535, -381, -582, 1946, 276, -1443, -545, -966, 498, -3302, 108, 2838, -490,
+  -3672, 339, 1380, -1540, 0, -1888, -2072, 1632, -1368, 960, 0, -728, 520, 786, 96, 318,
+  2461, 2706, 735, 2828, 0, -2400, -700, -137, 2856, 339, 2040, 798, -891, 256, -1020, -904,
+  -1573, 750, -960, -882, -2006, -225, -348, -610, -312, -480, 396, -460, 1274, -1350, -1107, -222,
+  -4050, 261, 1617, -642, 762, 388, -973, 1840, -1332, 872, 690, 166, -2540, -540, 387, -1764,
+  -2720, -1808, -115, 1210, -928, -472, -1776, 2688, -1026, 384, 0, 546, -2808, -1703, 768, -424,
+  428, 369, 420, -404, 1014, -500, 600, -1370, 3808, -1469, -408, -532, -1881, -2816, 2448, -678,
+  -3146, 1125, 480, -2268, 2242, -150, -1160, 1220, -312, -960, 1188, 1610, -1001, -810, 0, -2442,
+  -2835, -1914, -2940, 1819, 127, 776, -2780, 552, 444, 3706, -1242, 1577, -2540, 1404, -2064, -1764,
+  544, 2034, -805, 770, -696, -1652, -2368, 1440, 2622, -2400, 3422, -273, -728, 2096, -1536, -636,
+  -1284, 492, -2520, 303, 676, -400, 1100, 0, 952, -565, -1122, -399, -99, 1152, 1836, 0,
+  2145, 125, 1728, 1008, 708, -225, -116, 122, 312, 2400, 198, -1955, 364, 270, 1353, 222,
+  810, -348, 294, 1177, -1143, -194, 2363, 0, -1554, 1744, -2208, -830, -1143, 1188, 1032, -2352,
+  -952, -678, -920, -1210, -1160, 354, -148, -1344, -342, 960, 826, -273, 832, 1965, 96, 1166,
+  -2354, 1107, -1470, -1010, 1690, 300, 600, 1233, -119, -1695, 204, 399, -1881, -1024, -408, 565,
+  0, 1500, 864, 504, -1180, -525, -696, 1220, -1144, 1200, 1089, -805, -273, 135, 2214, -2331,
+  -2160, 522, -2058, -1712, -127, -97, -1251, 1656, -333, 327, 1104, 83, -1397, -972, -3096, -882,
+  -1224, 1921, 920, 1210, 464, -1652, -2072, -1344, -2052, -192, 2006, 1456, -1456, 524, 864, -212,
+  1284, -246, -2415, 202, 338, 500, 600, 1370, -2737, -2373, -1632, 1330, -1188, 896, 1020, 2034,
+  1144, -1125, -96, -2520, 2832, -600, -1044, -488, -1768, 1200, 1386, -1495, 2457, -2295, -1476, 888,
+  -3240, 435, 1323, -642, 0, -1164, -2502, 184, 1554, 981, 0, 249, -508, 648, 516, -196,
+  -3400, -2034, -230, 1210, -464, -1062, -1776, -1728, -3648, 0, 2124, -91, 4160, 3275, -2880, 2332,
+  -428, -1476, 735, -606, 507, 100, 1900, 685, -357, 452, -2856, 1463, 1089, 896, 1530, 226,
+  1144, 1250, -96, -6174, 0, 450, 1044, -610, -1456, -1080, 2376, -2760, 910, -135, -984, 888,
+  540, -1653, -441, -1712, 1397, -776, -139, -828, 3441, -1526, -1656, -830, 127, -1728, -2451, -3136,
+  -1768, 678, 805, -2090, 580, 1416, 0, -864, -798, -672, 236, -273, 520, 131, -1152, 530,
+  -1712, -1107, 1785, -1313, 338, -400, 700, 2329, 476, -1017, -408, -2261, 1188, 0, -1326, -2373,
+  -2574, -875, -192, 0, -1180, 525, 232, 976, -104, 600, 99, -1150, -1638, 2025, -1599, -1110,
+  135, 261, 1176, 535, -2159, -1552, 2502, -2116, 1221, -436, 1104, 166, 2286, -972, 387, 392,
+  680, -1469, -115, 1210, -1276, -826, -2812, 672, -798, -480, -354, 819, 416, -3406, 480, -1590,
+  -107, 2952, -840, -707, 845, 1100, -400, 274, -714, 1356, -306, -1064, -1386, -1024, -3162, -1130,
+  1859, -500, -768, 756, 236, -975, -696, -488, 2184, -360, -990, -1840, 546, -2160, -738, 999,
+  2025, -1218, 4116, 2782, 3556, -388, -278, -644, 888, 981, -828, 1992, 508, 972, -516, -1274,
+  1360, 2825, -1265, 110, -348, 1180, 888, -2400, 342, -288, 708, -1729, 1144, -1834, -1536, -212,
+  -856, -861, -315, 303, 0, 300, -3000, 411, -119, 1356, 0, -1197, -99, 384, -510, -1469,
+  1716, -750, 1440, -1008, -1298, 900, -116, 244, -416, 1800, -396, 805, 1183, 1080, -123, 1554,
+  1755, 174, 1323, 1926, -762, 1067, 139, 1104, 555, -981, 276, -415, -762, -756, 903, -1176,
+  -680, 678, 920, -3190, 464, -472, -1184, 96, 1482, -384, 1416, -546, 1456, 1179, -1344, 2226,
+  2247, 1107, 420, 303, 0, -1500, 0, 685, -2261, 565, 612, 1064, 891, 768, -612, -2260,
+  -1001, -2750, -96, -2142, 826, -450, -1160, 122, -936, -720, -792, 115, 0, 135, -492, -777,
+  945, -87, -2058, 214, -889, -1067, -417, 368, -1110, 109, 690, 664, -1397, 1188, 774, -2156,
+  -272, 904, 690, -990, -1972, -472, -740, -576, -1026, 1056, -3422, 546, 1040, 786, -1440, 318,
+  -535, -984, -2415, -1313, -3887, -400, 900, -822, 952, 1243, 1530, 931, -2574, -1024, 408, -678,
+  -2288, -3250, -384, -4158, -708, -525, -464, 0, -3744, -2040, 891, 115, -910, -1620, 0, 333,
+  -1080, -522, -735, -428, 2286, -1552, -4031, -3036, -222, -545, -690, -747, -635, 216, -3870, -490,
+  -136, 791, -230, -660, -2204, 1770, 740, -480, -1368, -864, -2950, 273, 312, 262, -480, 424,
+  428, 369, -315, 606, 1014, 200, 2000, 2192, 1547, 3164, -1122, -798, -594, -896, 1326, -2034,
+  4004, 2125, 0, -3024, -1534, -975, -1276, 976, -1768, -720, -1089, -805, -728, 540, 2706, 444,
+  1080, 1566, 588, 214, 381, -485, 417, 736, 555, -2616, 1518, -581, -889, -216, -645, -196,
+  3128, 452, 115, 440, -928, 2006, 1036, 288, 570, 1344, 354, 546, 416, 1179, -192, 2544,
+  -749, -492, -1155, 505, -2028, -1400, -600, 1507, 238, -678, 102, 0, 0, -1536, -1020, -1808,
+  -715, 375, 1152, -252, 2478, 1050, 696, 1220, 1560, 2400, 297, -1495, -91, 2160, -1476, -666,
+  540, 1131, 3087, 1391, 1905, -1164, -3336, 1564, -999, 872, -276, -83, 1016, -3132, -1032, 1078,
+  1360, 1695, -460, -440, -2668, -118, 148, -480, -912, -384, -944, -182, -2912, 1048, 2208, -530,
+  535, 246, -945, 2121, -2366, -2300, 1700, 1370, 1071, 2599, -306, 931, 297, 640, -1938, 1582,
+  -286, -1250, 1056, -1260, 2242, 525, 696, -1220, 104, 360, 891, 230, -455, 1890, -3321, -2220,
+  675, -1740, 294, 1926, 2159, -776, -139, -736, 1332, 2943, -3726, -415, -381, 324, 258, 0,
+  2584, -904, 230, 3960, 1044, 354, 2072, -1056, 456, -1344, -1062, -910, -728, -1572, -768, 1802,
+  -856, 2460, 1260, 2121, 2704, -1100, 3400, 3562, 1190, 1469, 1122, 1197, -198, -2688, -714, 113,
+  -143, -1750, 192, -2772, 118, 2400, -116, 976, 1352, -2280, 2079, -1495, 910, -945, -1230, -1776,
+  270, 348, 1176, -107, 381, -2619, 1251, 1196, 1110, 1635, 0, -1743, 254, -5292, -2322, -2842,
+  3672, -339, 345, 660, 812, -2242, 2516, -288, 342, -1536, -2950, -1001, 624, 1572, -288, -318,
+  2140, -369, -525, 404, -1690, 200, -200, -274, 833, -339, 816, -1995, -693, 1152, 0, 1243,
+  1573, 1125, 2016, 2520, 944, 525, 812, -122, -312, -2400, 2673, 1380, -1183, 1755, -615, 1776,
+  810, -87, -2205, 2247, -1524, 2037, 278, 0, 1776, 218, 2898, 83, 635, 1944, -645, 2156,
+  -3128, -1243, -690, -220, 2088, -826, 296, 2208, -1368, 480, 1416, -637, -312, 2227, 672, -212,
+  1177, 123, 1155, 303, -2197, -2000, -700, -1096, 476, 226, -102, -665, 99, -2944, -408, 2599,
+  -2145, -1500, 192, -2646, -1652, 75, 696, 1586, -624, 0, -2079, -690, 1820, 3915, 1968, -999,
+  -945, 870, -1911, -428, 1143, -388, 2919, -1288, 888, -1090, -828, 249, -889, 972, 516, -1764,
+  -544, -678, 575, 330, 0, 1416, -1628, 1152, 228, 576, 118, 1456, -104, 262, 288, 530,
+  642, -246, -1680, -303, -5577, 1000, -2000, -822, -1547, -339, -1428, -798, -198, 2560, 204, 0,
+  -1430, 750, -1056, 504, 354, -825, 232, 1342, -832, -120, -396, -115, -637, 2835, 2829, -1665,
+  -810, 348, -1470, -1605, -508, 679, 417, -276, 0, 872, 552, 0, -1651, 324, 1161, -2058,
+  -1360, -1582, 230, 1760, 1044, -1770, 1184, -1632, -1482, 1920, -590, 0, -1352, -1441, -96, -2544,
+  -1070, 246, -105, 1010, -3042, 100, -1200, 2192, 1071, -1243, -1836, -399, 990, -1792, 714, 2147,
+  -429, -2250, 288, 882, 118, -1275, -116, -2440, -1560, -480, 594, 115, 364, -810, 1230, -111,
+  -2160, -1131, -2205, 642, -2032, 873, -3475, 2024, 333, 545, 2898, -498, -3175, -216, -516, -392,
+  -136, 791, 575, 440, -580, 1888, 2812, 1248, 1596, -480, -944, -91, -624, -2620, -1056, 848,
+  535, -246, 1470, -3131, 2028, 1500, -400, -5069, -357, -4407, -102, 798, -99, 896, -918, -1017,
+  -1144, -1000, 1152, -1890, 1652, -975, -1508, 2318, 2704, -3600, -2772, -1840, -910, -270, -4182, -5661,
+  -3105, -783, -1323, 749, 1016, 388, 834, -552, -4329, 109, -1656, 249, -635, 648, 2967, 1470,
+  -1496, 1808, -1610, -4950, -2088, -590, -1184, -1440, -570, -288, 1062, -1911, 520, 1179, 480, -5088,
+  -1070, -2583, -3780, 1616, -2366, -800, 400, -2466, 833, 1017, -1122, -665, -1683, -256, 510, 226,
+  -572, -250, -384, 1008, -2006, -525, 812, -1708, 1040, -240, -198, -230, 1547, -270, 1845, 222,
+  135, 1566, 441, -321, 127, 0, -2085, 552, 444, -1853, 3174, 747, -2159, 540, -1548, 686,
+  -136, 226, 805, -550, -3016, -1180, 444, -1536, -1254, -192, -472, -455, -1560, -786, -576, 848,
+  214, 2583, -105, 404, -1014, 1400, 1500, 411, -119, -904, 510, -798, -495, -1024, 408, -452,
+  2431, 1625, 288, 126, 944, 450, 2320, 122, -1976, 240, -495, 460, -1365, 270, -246, -444,
+  1890, -957, -294, 856, 762, -291, 1112, -2024, -1332, 327, 1932, -664, 127, 432, -516, 1078,
+  1224, -226, 690, -990, -232, -1770, -444, -1728, 1824, 384, -236, -2002, -832, -393, -384, -1378,
+  -1284, -1599, -1995, -2323, 0, 1500, -2400, -137, -2737, 113, -1020, -4123, -2574, -384, 0, -904,
+  -1430, -2500, -384, 630, -3186, -450, 464, -2074, -2600, -1200, 495, 4600, -637, -3645, -2091, -1332,
+  -270, -1218, 0, 107, -635, 2425, 1529, -736, -111, -545, -966, 913, 508, -2376, 5031, 294,
+  -272, -113, 230, -220, -1972, 472, 2368, -1920, 912, -1824, -1180, -728, 1352, 393, 2688, -424,
+  -1070, 369, 945, -1313, -338, -1800, 1100, 548, 0, -678, 204, -266, 792, 0, 408, -452,
+  -1430, -2750, -96, -378, 708, 75, -812, 1952, 1872, -120, 297, 1265, -819, 675, -3321, -3441,
+  1620, -957, -441, 2354, 2286, 0, -1251, -1012, 0, -218, 0, -581, 1016, -540, -129, 588,
+  -1904, -2825, 115, -550, -1392, -1180, 148, 1152, -1824, 768, -826, -1365, -1560, -262, 1152, -318,
+  321, -492, -1155, 1818, 338, 700, 500, 2329, 238, 1695, -510, -798, 99, 1920, 102, -1130,
+  -1144, 1000, -1056, 504, -1416, 300, -696, -976, -520, 1920, 495, -1610, 364, 0, -615, 333,
+  -1890, -261, 1764, 0, 1143, 97, -2085, 184, 333, 2725, -1656, 664, -1651, -1080, 258, 392,
+  -1088, -904, -1035, 1760, -1276, 0, -444, 192, -1254, -192, -1062, -728, 1040, -655, 480, -2438,
+  -107, -1722, -315, 101, 0, -1100, 1600, 411, -1428, 791, 918, 133, -1188, -640, 1020, 0,
+  -3003, 1125, -576, -1008, -826, 1050, -1160, 0, -1040, 2040, 1485, 920, 0, 675, 246, -777,
+  -1215, -174, -1029, -1391, 762, 291, 834, -1196, 222, -1308, -2346, -415, 0, -324, -1161, -1764,
+  1224, -452, 345, 770, -232, -1180, -1924, 960, -1938, 1056, -354, -273, -104, 1703, 576, 1272,
+  -856, -1476, 0, -101, -1183, 700, -700, -685, 476, -565, -2754, 2261, -495, -1152, 1020, -565,
+  1001, 1000, -480, -1890, 1652, -1125, -1508, 244, -520, 240, 891, -805, 91, -1350, 1476, 777,
+  -2970, 522, 588, -856, 635, 485, -834, 0, -1110, -872, -690, -166, -1778, 108, -774, -294,
+  -680, -565, -1380, 550, -1276, 1298, -444, 576, -798, 1248, 944, 910, -1872, -393, -576, 848,
+  1177, -2091, -630, 1818, -2873, 1100, -1200, 0, -357, -1130, 612, 2128, -693, -640, 204, -113,
+  2860, 2375, -192, -2142, -826, 750, 116, -366, -728, -240, -3267, 575, 91, 405, 1968, -111,
+  -540, 261, 1176, 214, 508, 2231, 556, -1564, 3108, -1962, -828, -1826, -1397, -1836, 1032, -1372,
+  -408, -226, 2875, -1980, 696, 0, 444, 576, -798, 2112, 590, 546, 312, -393, -1632, 530,
+  -4922, -2460, -525, 1313, 676, 800, 1500, 685, 1428, 3503, 2142, 2128, -297, -1536, -1326, -3955,
+  143, 875, -1728, 2142, -5428, -1650, -928, 3050, -3224, 1440, -2277, -1265, -3094, -2160, 3567, 1998,
+  0, 174, -4704, 1605, -2921, -970, -1946, -1472, 1776, 1744, -3588, -1411, 1651, -108, -5289, 784,
+  -1088, -565, -2530, -3300, 928, 2832, 3256, -2688, -570, -1152, 1652, 1183, -1976, -5240, -1728, 1378,
+  0, 0, -1470, -1313, 0, 2000, -1200, 274, 238, 113, -2142, 3192, -891, 512, -102, -2373,
+  286, -2000, -1440, -1764, 472, -225, -812, 1708, -2392, -360, 693, 1150, 182, 1080, -2091, -1332,
+  -945, -1044, -1176, 856, -254, 1358, 556, 2116, 111, -654, -1242, 1826, -1016, 1080, -774, -490,
+  816, 904, -920, 1430, -696, 118, 444, 1536, -456, 768, 944, 91, -312, -131, 768, 1166,
+  -642, 615, -630, 909, 3211, -700, -700, -411, 833, -452, -816, -399, -792, -2176, -408, -113,
+  858, -1625, -288, 378, 236, -675, 348, -2196, -104, 240, 693, 0, 364, -675, 861, 999,
+  -1485, 174, 2940, -2461, 127, -679, -1390, 460, -111, -218, -1794, -1162, -2921, -108, -1548, -1274,
+  -1360, -1356, -805, 220, -696, 590, 1776, 1152, -1254, 864, -472, 91, 208, -2358, 864, 1590,
+  -1605, 1722, -420, -2121, 676, 200, 1100, 2192, -595, -3164, 1530, 0, -3069, 1152, -306, 1469,
+  1573, -125, -1056, -126, 236, -1125, 1624, -1342, -1248, 120, 990, 1035, 1638, 540, 0, 777,
+  -1890, 783, -1617, 214, -1524, -1067, 3336, 276, -2331, 1090, 138, -913, 1397, -864, -516, 0,
+  -1768, -1695, 1035, 2090, -2088, -1180, -592, -672, -1368, 384, 0, -1001, 1144, 0, 96, -530,
+  1177, -2460, -2625, -1919, -1183, -1800, -2000, -1370, 1190, -113, -1530, 1064, -2079, -2432, 714, -2599,
+  -286, -2000, -192, -756, -354, -1950, -3248, 1220, -1040, -240, -198, 0, -455, 810, 861, 777,
+  -135, -783, -882, -1391, -1016, 679, -1946, -920, 2220, -109, -1380, 581, -1016, 756, 645, -1568,
+  0, 1243, -1380, -110, -3596, 1534, 1480, -1056, -1254, -864, -826, -728, -520, -2751, 864, -1484,
+  428, -369, 630, -101, -1014, -1900, 300, -959, 119, -2712, -1326, -133, -594, 0, 0, -452,
+  -858, -1125, 96, 2520, 236, -750, -696, 976, -1872, 480, 495, -460, 455, -270, -2460, 111,
+  -810, -435, -1764, 321, 635, -1649, -1390, 184, -777, 654, 1242, 996, -889, -972, 1677, 1274,
+  680, 791, -1150, 110, 464, -2006, 1332, 672, -1368, 1440, -2714, 0, -104, -1834, 480, -424,
+  749, 1353, -1890, -1717, -1183, -400, -1000, -1507, -1785, -1017, 306, -1197, -198, -2432, 204, -1469,
+  1430, -375, 672, -1638, 0, -375, -1856, -732, -624, 600, -495, -1035, 455, 540, -2091, -111,
+  -2970, -174, -441, 2675, 0, 1358, -1946, -1196, 1443, 0, -2760, 166, -635, 972, -258, -1470,
+  2176, -1695, -2645, 220, -1044, 1770, 444, 1440, 228, 192, -1770, -1911, 312, -131, 96, -212,
+  -1070, 492, 315, -1111, 2704, 700, 400, 137, 1785, -678, 1632, 798, -198, -256, -204, -1243,
+  2145, 2375, 1152, 1134, 1298, 375, 1160, -732, -1560, 360, -396, 805, -546, 810, 2337, 333,
+  -675, 870, -882, 214, -1905, -1164, -3058, 92, -111, -1417, -690, -1826, -762, 1188, -387, 882,
+  -136, 1130, 920, 220, 232, 236, -2220, 1344, -570, 1440, 1416, 364, -1248, -3930, -768, 1802,
+  214, -246, 735, -505, 1521, 0, 800, 548, -833, 565, -306, -1197, -594, 640, -102, -339,
+  -1859, 500, 384, 1260, 0, 225, -696, 122, -1144, 1080, 693, -2300, -728, -405, -1230, -1887,
+  -810, -870, -2352, -749, 2286, -485, -1529, 184, -444, 1090, -414, 1411, -2286, 648, -258, 0,
+  1904, 678, -2530, 990, 348, -708, -1184, 672, -1368, 1056, -1298, -546, 728, 1965, -768, 0,
+  -321, -3075, -315, -2525, 2197, -200, 3900, -4384, -5355, 0, -5304, -266, 1089, 768, -408, 339,
+  -1144, -3750, 2496, -1638, 1652, 1350, 2320, 1830, 2184, -960, 99, 0, -728, 1080, -4305, -222,
+  -540, 1653, 2940, -2568, 381, 291, 2085, -2208, -3996, 2507, -1380, 249, 1905, 3348, 387, 784,
+  -1224, 678, 230, 1650, -4872, -2124, -3404, -96, -2394, -480, -2360, -1365, -416, 2620, 480, -1590,
+  -428, 246, -525, -707, -169, -2700, 3200, 274, 1309, -1130, -612, -266, 495, -2304, 2856, -1130,
+  1716, -625, 288, -252, 1062, 750, 232, -2074, -520, 480, 1089, 460, 1547, -1620, 615, -2442,
+  -1350, -435, -1176, 856, -1651, 388, 695, 1380, 2775, 981, -552, 996, -1397, 432, -258, 392,
+  1360, -226, 0, -660, 1044, 826, 1628, 480, 114, 288, 472, 819, -1248, 1965, 1152, -636,
+  107, -1353, 1050, 505, -3211, 1600, -500, 685, -2618, -339, -102, -931, -1188, -256, -1122, 0,
+  0, -625, -768, -378, -1062, -1425, 116, 488, -2184, 240, -594, 345, 364, 810, 369, 1554,
+  1755, -435, -2058, -749, 762, -1067, -556, 1288, 2220, -1526, 414, -996, -127, 108, -1935, 294,
+  -272, -904, 575, 440, -580, 236, 592, 576, -1938, -1056, -118, -182, -1040, 786, -1248, 1378,
+  -1605, 1722, 2100, -202, -676, 1200, -2800, 274, -119, -565, 0, -399, 990, -1536, -816, 452,
+  2288, 2250, 384, -3528, -708, 0, 2320, 976, -1456, 2640, -99, -805, 1183, 1080, 1968, 444,
+  1620, -2697, -588, 1284, -254, -1067, 1251, -552, 1554, -1635, 690, -1411, 635, -2808, -2451, -2450,
+  3536, -1582, -230, 220, 0, 2006, 888, 288, -1368, -576, -236, 728, -728, -4716, 288, 1484,
+  -1605, 369, -1680, -1212, 2028, -800, 1700, -959, -2618, -1469, -102, 1596, 0, 512, -510, 0,
+  1430, -625, 1728, 126, -236, 1125, -1044, -1098, -104, 1680, 1188, -115, 1456, 945, 1107, 1332,
+  -270, -1218, 2646, 963, -1524, -97, -1390, 736, -222, -981, -414, -581, -1143, 864, 1935, 1078,
+  408, -1243, -2530, 550, 116, -354, -1184, -1632, 114, 1344, -1888, -364, 104, 0, -576, 530,
+  1712, 738, -105, 707, 2366, 1000, 500, -274, -1904, -678, -1224, 133, -1980, -256, -1428, -1017,
+  -3575, -625, -1728, 504, 1652, 75, -348, -122, -416, -1080, -1584, -920, 273, -1485, -1968, -555,
+  -405, -348, 735, -214, 1651, -388, -1668, 276, 1887, 1199, -966, 996, -762, 1728, -258, 1568,
+  -2992, 0, -690, 880, -1276, -236, 0, -384, -1482, 1248, -826, 910, 832, 262, 192, 1166,
+  -1070, 1230, 840, -2525, -507, -1200, -2500, -1096, -1666, -1243, 102, 798, -1188, -1664, 918, 904,
+  0, -1875, -576, -1008, -1534, -1350, -116, -1342, -832, 480, 297, -690, 1547, -2025, 1107, 1110,
+  1755, -87, 294, -642, 381, 97, -1529, 276, 666, -1744, 828, -249, 127, -1296, -645, 588,
+  1496, -1695, 460, 220, -464, 1180, -592, -480, 228, -96, -2950, 910, -104, -1572, -768, 530,
+  428, 246, -420, 1010, 338, 900, 1000, 0, 714, 339, 1326, -798, -198, 1280, 306, 1808,
+  4290, -1625, -1152, -1134, 472, -600, -348, -976, -728, -1080, -891, -230, -637, 2295, 1845, 2886,
+  540, -783, -1911, -535, 1651, -1455, -2085, -1380, 1776, 109, 1518, -498, -508, -1404, -2709, -392,
+  -544, -1017, 2415, 330, 1160, 1888, 0, 1056, 0, -960, 2124, 1001, 728, 262, -192, 848,
+  428, 492, -735, -404, 1690, -800, 1700, 2329, 476, -113, -408, -1729, 198, -1408, -1428, 791,
+  -4004, -875, -960, 1008, -354, 1950, -116, -732, 1144, 960, 2475, -2070, 819, 540, -246, -777,
+  540, -261, 1764, 2247, -1016, -97, 0, -92, 333, 2289, -1380, 581, -1905, 1296, 387, -98,
+  1224, 339, -690, -550, -1276, 944, -1776, -1920, -912, -1536, 708, -1365, -624, 786, 864, 1484,
+  -535, -738, -3885, 101, -4056, -2000, -3000, 1507, 1190, 565, 714, -798, 1782, -2560, -510, 1130,
+  -2574, -4000, 384, -1260, -2832, 1125, 116, -4636, -1144, -5160, 3960, -1495, 2366, 135, -2091, -555,
+  -3240, 261, 3822, 749, -1397, -1261, -278, -552, 2886, -1090, 2622, 415, 254, -1620, -4644, -1470,
+  -1904, -3842, 0, 1760, -1508, 2360, 3848, -1056, -2280, 864, -1888, 728, -3848, -262, 1056, 636,
+  963, -3813, -420, 606, -2197, 900, -1900, -274, 1071, 113, 102, -1596, -495, -1920, 102, 678,
+  -143, -1875, -960, 0, 708, 600, -928, -1464, 1352, -480, -1089, 690, 819, -945, -1353, -222,
+  135, 1479, -1470, 1177, -1143, -1261, -695, 368, 999, 218, 2622, 1245, 508, -324, 387, -882,
+  -680, -339, 460, 990, -580, 1888, 296, -1728, 114, 96, -1416, 455, 832, 0, 2496, -212,
+  2140, -738, -315, -606, -676, -2200, -100, 685, -1071, -904, 816, 532, -792, 512, -510, 1017,
+  0, -375, -288, -1260, -1062, 750, -232, -488, -832, -1560, 1386, 0, -273, -1755, 1230, -777,
+  1485, 0, -147, -1605, 0, 1455, 1668, -92, 888, -1962, -1380, 830, -762, 0, -1935, 784,
+  1224, -1356, -345, 220, 812, 354, 888, -1440, 114, 480, 236, -546, -936, 1834, 960, -106,
+  -749, -2091, 1155, -1717, 169, -1500, 1300, 1781, -238, 1243, 0, 665, 99, 640, 0, -1582,
+  2145, 125, 1056, -252, -1888, 975, 580, 976, 1040, 720, 792, -1150, -910, 3240, 1230, -1776,
+  2295, 1044, 0, -321, -1778, -776, -1529, 92, -444, 981, 1794, 1079, -381, -1296, -1032, -2254,
+  1904, 791, 115, 990, 580, -826, -1924, -2784, 912, -576, -708, 0, 728, -1441, 384, 1378,
+  963, -3444, -1155, 505, -676, 600, -700, 274, -2737, -1582, -2142, -133, 1683, 1024, 1428, -1921,
+  1573, 1250, 192, -1512, 2360, 1050, -116, -1708, 1768, -1560, 495, 805, 364, -2025, -1230, -444,
+  2565, 1653, -2352, 321, 1016, 291, 1112, 552, 1665, -218, -1380, 913, -2159, 1944, 1548, 588,
+  136, 339, -575, 1870, -348, -2950, -148, -2304, -1824, -1824, -1888, 1547, -1248, 1834, 0, -1060,
+  -642, 492, 105, 909, 1690, 700, 1100, -137, 595, -565, -1530, 133, 396, 1792, 306, 113,
+  -1287, 1750, -576, -2016, -472, 600, -696, 0, 624, 0, -1089, 1610, 910, 270, -861, 444,
+  -405, -1131, 441, 1177, 1143, 194, 1390, -276, 1665, 1744, 552, -332, 1651, -2376, -645, 784,
+  -1088, -339, 1380, -110, 1508, 236, 2516, 672, 114, -960, 236, -1274, 208, 1310, 0, 106,
+  -535, 984, 735, 101, -845, 2400, -900, -1507, -2023, -113, -306, -665, -396, 128, -204, -904,
+  2002, 875, -576, 1008, 118, -900, 464, 122, -624, -600, -990, 690, -1183, 0, 738, 555,
+  -1080, -957, -1617, -535, -1143, 873, 0, -552, 0, -981, -690, -913, 0, -108, -903, 588,
+  1088, 113, 690, -990, -464, -236, 3256, -864, 1368, 96, 1652, -1183, 104, -1310, 768, 848,
+  -1391, -615, 420, 707, 169, 0, 100, -1096, 119, -1017, -204, 1064, 99, 0, 306, -1243,
+  2145, -500, -96, 1512, 944, 900, -348, -854, -624, 1920, -99, -2185, 91, -1215, -1599, -666,
+  270, -1653, -2352, -1070, -762, 97, -556, -368, 0, -436, -414, -664, -254, -756, 1935, 490,
+  -2040, 226, 1150, 110, -812, -708, -296, -864, -228, 288, -2006, -273, -208, 1441, -1056, -1166,
+  642, -1230, -105, -101, 0, 200, 700, 1370, -119, 1017, 510, -133, 297, -640, 408, -904,
+  -1430, -1625, 1440, -1386, -354, 1125, 580, 1220, 312, -1080, 0, -1840, 364, 1080, -738, -444,
+  -675, 87, 3087, 642, 2159, 776, -695, -552, -1110, 545, -2070, 1245, 1905, -2052, -645, 0,
+  -272, 226, 230, -1430, -812, 944, 1480, -288, -684, -960, 1180, -455, -1040, 917, -576, 2332,
+  963, -861, -630, 303, 0, 0, -3300, 685, -1428, 2938, 2346, -6783, 0, 1536, -2346, 791,
+  2145, -125, -1632, 2394, -708, -900, -928, 976, -2496, 4080, 1287, 3565, 1092, 3105, -2952, 999,
+  -270, -1566, 735, 2140, 2159, 194, -4448, -828, 4107, -218, -1242, -2905, -2667, 324, 3225, -980,
+  544, -226, 575, 3080, -2436, -472, -2960, -2976, -1482, -1344, -1298, -2184, -1664, -4323, 960, 3710,
+  749, -861, -105, -1414, -1690, -2200, 0, -137, 238, 1356, -408, 1197, 1188, 1152, 1836, -2034,
+  2145, -750, 576, -252, 118, 75, 812, 366, 104, 720, 99, 230, 273, 0, -1968, -333,
+  270, -261, 1764, 856, -1143, 582, -695, -920, -111, 1199, -690, -1577, 254, -324, 1548, -392,
+  1768, -1130, 575, 990, -812, -354, -1036, -960, 1368, 192, -118, -273, -1248, -2358, -1536, -2544,
+  1177, -123, 840, -202, -2028, -100, 1300, -1370, -238, 1356, 204, 1596, 99, 768, 408, -2147,
+  858, -750, 672, -2142, 1180, -75, -464, 976, -312, 840, -1683, -1495, 1183, 1485, 2583, -555,
+  405, -261, 588, -2461, -635, 1067, -139, 184, -222, -109, -2484, -1328, -381, -864, 774, -1568,
+  -136, 1243, 1610, 770, -1044, 708, -1184, -192, -684, 2112, -236, 182, -832, 1703, 0, 742,
+  -1070, 1476, -1995, 101, 1352, -2100, -600, 1918, 1190, 226, 1632, 665, -792, -4480, -1020, 1695,
+  286, 1250, -1344, 1386, -3776, 525, 1392, -1342, 832, -960, -1485, -3335, -1092, 2835, 0, 1554,
+  -810, 1218, -1470, 0, -1651, -1358, -1807, 920, -2109, -2616, -828, -1245, 1016, -3132, -3483, -588,
+  2312, -791, 115, -440, -348, -708, -1036, -864, -2964, -576, -1062, 0, -3224, -786, -2592, 0,
+  1070, 615, -105, -707, -169, -1300, 300, -1918, -2380, 1130, -612, 0, 792, -384, 1836, -678,
+  -1144, -1250, -192, -1134, 826, -450, 2436, 2074, 416, -1560, -891, -1035, 546, -2160, -738, -111,
+  2025, 696, 1029, -1284, -635, -679, 139, -828, 666, 436, 552, 249, -1270, -216, -129, -294,
+  1224, 904, 230, 110, -580, -1062, 592, -96, -342, -2016, -2714, 364, -208, -3537, 192, 106,
+  963, -123, 1050, 202, -2197, 400, -900, 959, 833, 565, 204, 532, 0, 768, 0, 113,
+  -1001, 500, -1440, -378, 1888, 0, -696, -732, -312, -120, 990, -115, 91, 135, 246, 1443,
+  -405, 1479, 4116, 428, 508, -776, -139, -920, 0, 327, -828, 166, 381, 1080, 1419, 98,
+  136, -2373, 230, 1980, -1044, 1652, -888, -1248, -456, 0, -1770, 91, -728, 917, -672, 1166,
+  -2247, -861, 1155, 505, 845, 1100, -400, 137, -119, 0, -1530, -931, 693, -1280, -408, -1695,
+  -429, -500, -384, -1890, -354, 375, 1392, 244, -728, -960, -891, -1150, -819, -1755, -738, -555,
+  -1485, -870, 882, -428, 1016, 679, 0, 1012, 666, 872, 690, -1079, -254, -1296, -1419, -686,
+  1360, 1130, 1380, 330, -1508, 0, -592, 480, 1026, -672, -826, 1911, -416, -2227, 96, -106,
+  -1070, -2214, 1050, -606, 507, 1400, 1400, -1370, -714, 226, -918, 266, -2178, -1152, -510, -339,
+  5577, 500, 2208, -504, 1534, 825, -2552, 732, -624, 1440, 792, 1380, 0, 810, -738, 333,
+  0, 174, 588, 428, 1270, 1843, -1668, 920, -444, 763, 138, -415, 1905, 216, 774, 1078,
+  816, -2260, -2645, 550, 464, 2242, -1184, -96, 228, 864, 1180, -637, 1560, -131, 1056, 1272,
+  -214, 2460, -210, -606, 169, -500, -500, -2055, -714, 1695, 1224, -1330, -297, -256, 306, 113,
+  572, 750, -1536, -1260, -826, 150, 1276, 2196, 104, 960, 594, -2070, -91, -135, 246, -999,
+  -1350, 174, 588, 428, -635, -97, -695, 736, 444, 2289, 1242, -1079, 1270, 756, -387, 392,
+  816, -339, 345, 990, 232, 354, 1036, -1152, 570, -1248, -708, 0, 208, 131, 288, -1272,
+  -2247, 1722, -1365, 1313, -2704, -200, -100, 0, -1666, 1017, -204, -798, -396, 1664, -1734, -113,
+  1573, 250, -1824, -1638, -2714, -2250, -1276, -610, -1456, 840, -1683, -920, 91, 2025, 369, 1110,
+  -1350, 870, -3822, -2247, -1143, -1067, 2919, -276, 555, -3052, 5796, -332, 508, -2592, -5289, -490,
+  408, -2373, -1035, 550, 348, -590, -2220, -288, -1482, -480, -236, 910, 520, 131, -1152, 848,
+  -535, -615, -1260, 0, 676, 1200, 700, 0, 119, -1243, -1326, 2394, 792, 640, 1938, -1356,
+  4147, -1625, -1632, -3150, -2478, -1050, -1740, -1830, 624, 2280, -297, -230, -910, -270, 2706, 1554,
+  1080, 1392, -1911, -1712, -1270, -1164, 139, 1564, 777, -872, -414, 1162, -254, 1080, -1161, 294,
+  -408, -3842, -1840, 0, -2436, -354, -592, 960, -684, 1632, -1062, 1547, 312, -262, -1632, 318,
+  321, 123, -2100, 404, 676, -500, 700, 0, 595, 1469, -204, -1463, 198, -3712, 1530, -1808,
+  -143, -1375, -1152, 1386, -2478, -450, 696, -1830, -312, -840, -693, -2185, 91, 405, -369, -444,
+  1620, 522, 441, -428, 1905, -679, -973, -92, 444, -1308, -1380, 581, 127, -432, 387, 196,
+  -272, -339, 1380, -660, -2552, -2714, 740, 1824, -228, -576, -1770, 182, -208, 393, -1920, -954,
+  -2033, -1230, 2625, -1717, -338, -1900, -1200, 274, -714, 3051, -510, -266, 2079, -3072, 306, -2825,
+  -2431, 1250, 1056, -1512, -1416, -900, 1624, -2562, -2288, 240, -990, 230, -2002, 540, 1230, -1776,
+  3375, 783, -147, -2033, 1397, -970, 139, -920, 1887, 2616, -1518, -1577, -3175, 864, -2064, -686,
+  816, -1582, -920, -1650, 1740, -1062, -148, -576, 798, 288, 1298, -546, -416, -1703, -1536, 106,
+  -535, -3321, -2100, 202, 845, 1000, 300, -959, 714, -2034, -714, 266, -2871, -896, -102, 1582,
+  715, 1875, 1728, 504, -2360, 75, -928, -1220, -1560, 720, -396, 2300, 182, -270, 1476, -777,
+  675, -1566, 0, 428, 889, 970, 0, -644, -222, -2289, 1518, -166, 1143, -648, 258, -1078,
+  408, 226, 460, -550, -928, -236, 592, 1152, 1482, 1056, 2006, 364, 0, -1441, -1152, -2226,
+  642, 984, -315, 1717, -3380, 500, -900, 959, 357, -2147, -204, 1862, -396, 1152, 0, 1017,
+  -1287, 1125, -1728, 882, -590, -375, -1392, -2928, -104, -1080, 990, -1495, -455, 810, 1107, -555,
+  405, 609, 735, -214, 889, 485, -1668, 644, -777, -327, -828, 83, 762, 648, 258, -392,
+  -2312, 0, 0, 2090, 2320, -1062, -444, -864, -228, 1344, 0, 364, 312, 262, 1824, -1696,
+  -214, 861, 630, -505, -1014, 500, 1900, 274, -1428, 565, -1224, -1330, -1089, -640, -1530, 791,
+  286, -1375, 480, 1890, 0, -825, -812, -1220, -2704, -840, 396, 1955, 0, -540, 246, 555,
+  1620, 696, 147, 107, 1270, 2037, -695, -92, -444, 109, -3588, 332, -889, -540, -258, 784,
+  2040, 565, 1150, 440, -232, 2714, 444, 384, -2508, -576, -590, 819, 832, 1703, 576, -848,
+  -2033, 615, 210, -202, -1521, 200, -100, 137, 595, 2486, -204, 532, 1683, -2944, 2550, 0,
+  -1573, -750, -288, -756, -118, 975, -1972, -1220, 0, 120, 693, -460, 546, 1215, 246, -3219,
+  270, -174, 1911, 856, -1270, -582, -278, 1472, 666, -545, -2070, 249, -889, 324, -2451, -2254,
+  -1768, 678, 2300, 220, -580, -236, -148, -768, -342, 2208, -826, 637, 0, -131, 96, -424,
+  963, -738, 1575, 2727, 1014, 800, -1600, 685, 595, -791, -1632, 266, -396, -384, -1020, 1808,
+  -2145, 1500, -1344, 1134, 118, -450, -3016, 488, 2184, 2880, 99, 345, 1001, 2430, 246, 111,
+  -945, -87, 2205, 0, 254, -1358, 278, -92, 1554, 109, 690, 581, 508, 324, -2322, -294,
+  -3808, -2373, -920, 330, -1044, 1534, -296, 2208, -1710, 864, -826, -364, -520, -1441, 0, 1802,
+  -214, 1722, -525, -2626, -2535, -2100, 1300, 548, 1309, -2825, -3672, -1596, 396, -1664, 2652, -1808,
+  -4290, -3750, 192, -1512, -1534, -750, 232, 854, 4160, -720, -693, -3105, 1365, 405, -1107, -5217,
+  945, -870, 1764, 1926, -2032, 97, 973, 1840, -2553, 1962, -1104, -166, 254, 324, -129, 686,
+  -2312, 1017, 2415, 1100, -928, -1180, -592, -1440, 1482, -864, 1416, -3276, -832, 655, 768, -2332,
+  -321, -2460, -840, 909, -676, 1200, 100, 1233, -714, -1356, -1632, 2394, -594, 0, 1020, -3277,
+  0, -625, 288, 630, 3186, 1200, -1856, -1586, 1352, 840, 1683, -1265, 455, -945, 1353, -555,
+  405, 957, 0, -2140, -508, -194, 1807, -1840, 1443, -327, -1242, 996, 1397, 1404, -258, -2548,
+  952, -2034, -690, -220, -1044, 1298, -2812, -480, 228, -288, -2360, -728, 936, 2620, 96, 1802,
+  -2354, -1353, 420, -202, -1352, -1700, 1900, -1918, 595, -2938, 2040, -532, -693, -1152, -510, 3051,
+  429, 250, 672, 126, -1062, 600, 2668, 2684, -520, 1320, -99, -690, 546, 1080, -246, 555,
+  -2160, 348, -1470, 214, 889, 97, 556, 0, -1443, 218, -1104, 0, -1905, -1296, -1806, 1078,
+  -1632, 678, 1265, -550, -1276, 1062, 444, 0, -2166, 768, -590, 819, -624, -1572, 0, 742,
+  1284, -2706, -1785, 303, -845, 2300, 700, 2466, -2975, -339, 816, -1729, -2574, 1664, -204, -226,
+  -429, -375, 2208, 2646, -826, 1275, -1740, 2196, 520, 1320, 1188, 1150, 2275, -5940, 2091, 1332,
+  -3105, -609, 2205, -428, -1524, -194, 278, -1012, 999, -763, -1518, 1826, -254, 1728, 2709, -1176,
+  -1088, -2373, 230, 1100, 0, 826, 1924, -2304, 912, 1920, -2478, -1274, 936, 917, 192, 2756,
+  -963, -1476, -1680, -505, 2197, -1100, -500, -2329, 2023, 678, 2754, 1330, 1089, 640, -918, -3729,
+  -1716, -1500, 768, -126, -1770, -525, -116, 732, 936, 1080, 1188, 115, 910, -1350, 738, 2553,
+  1755, -522, 1617, -1498, 127, -873, -2780, 184, 2331, -2943, -1242, -1079, -127, -108, -258, 1372,
+  -544, 339, -230, -550, 1160, 4366, 2368, -768, -1938, 384, 944, 546, -1248, -1048, 384, 530,
+  -107, -246, -420, 0, -1014, 100, 800, -1507, 476, -565, -1428, -1463, -594, -2944, 102, 791,
+  -286, -500, -672, 3906, 354, 450, -1160, -976, 312, -1080, -594, -920, 455, 810, -369, 1332,
+  -1215, -522, -1617, 1498, -2413, -2134, -973, 1472, 1554, -436, -276, -996, -2032, 432, -1032, 588,
+  -952, -904, -115, 110, 812, -1888, -2368, 480, -1824, -960, -590, -1092, -624, 262, 384, 318,
+  1177, -246, 1995, -101, 1690, -1400, 2200, -959, 476, -678, -204, 266, 495, 1024, -408, 2712,
+  858, -1750, -1248, -1638, -590, 525, -1276, 488, 1248, -2400, -297, -2300, 364, 1755, -1968, -333,
+  2295, -87, 1911, 963, -1524, 1746, 834, 828, 1443, -109, 1242, -166, 1905, -1728, -129, 0,
+  1088, -113, -345, 0, -696, -354, 1628, -2976, 912, -2496, 2006, 728, 104, 3144, -1248, -2438,
+  214, -615, 315, 808, -3042, -700, -400, -548, -2618, 1808, -2652, -931, 495, 1024, 408, -565,
+  1573, -4375, 1344, 630, -118, -900, 1044, 488, 832, -360, -1980, -1610, -1183, 3240, 1599, -1887,
+  1620, 435, 1764, -214, -635, 582, 139, -184, -1332, 2398, 828, 166, -3175, -216, 903, -686,
+  1088, -904, 690, 2420, -116, -236, -740, -960, 1710, -1440, -472, 0, -1248, 524, -96, 530,
+  107, -615, -1155, -2323, -507, 300, 1300, -548, -1547, -904, -1020, -1197, -99, 1152, 1632, 339,
+  -4004, -125, 288, 1260, -1534, -225, 2668, -1342, 208, 360, 1584, -1035, -819, -2430, -246, 777,
+  2835, -696, -1470, 0, -2413, -3007, -278, -460, -2664, 1744, -828, -498, 635, 216, 774, 392,
+  -952, 226, -1265, 550, 464, -1298, -1036, 192, -1596, -192, -118, 364, 1144, 131, -864, 424,
+  -963, -2583, 315, -2222, 1014, -600, -600, -685, -1309, -904, -1836, 931, -990, -1792, 1428, -678,
+  -3289, -2125, 768, 126, -1298, 900, -116, -854, -1144, -1440, -990, 1265, 1638, -810, 492, -888,
+  945, -174, 1323, -2782, 1778, 0, -1529, 552, 888, -1417, -3174, 1577, -889, 1404, -129, -686,
+  -1768, -1017, -1380, -1870, -2436, -118, -2516, 864, 2508, -1344, -826, -1911, 0, 1179, -288, 1166,
+  -428, 2706, 1365, 1616, 338, 3100, -600, 1096, -1190, 339, 2346, -4256, 693, 1536, 306, -1921,
+  -2145, 2875, 96, 882, -472, 150, 928, 122, -416, 960, -198, 115, -2639, 270, 1353, 888,
+  1485, 3741, -1764, -321, 1270, -1552, -139, -1012, -222, -3052, 4968, -415, -1016, 0, -516, -392,
+  -1632, 339, 0, -4180, -348, 1298, -1184, 1440, -2052, 480, 472, -1274, 728, -3930, -480, 1908,
+  535, 615, 420, -606, 676, 3200, -2200, -1096, -595, -452, 204, -532, -396, 3072, -306, -339,
+  -286, 1125, 2400, 1134, -2832, 1425, 1740, 732, -3120, 1560, 792, 2415, -364, -810, 1107, -1998,
+  540, -2610, -147, 428, -889, -1261, 0, -2208, 888, -2725, -828, -1162, -1143, -1296, -1806, -3038,
+  2040, -2599, -1380, -880, 812, 1180, 888, -2400, -228, 2112, 2478, -637, 520, -1441, 768, 1484,
+  -1712, 3321, -1365, 202, 338, -800, 0, 411, -1071, -452, -816, -266, 396, -256, -2040, 226,
+  143, -1000, 96, 126, 354, 450, 464, 1220, 416, -1320, -297, -1035, 1092, 1215, -123, 333,
+  2295, -783, 735, -2568, 1524, -1261, 2085, 828, 0, -2289, 690, -1743, 1651, -2160, 258, -980,
+  -1632, -3729, 1725, 1760, 928, -236, 740, -480, 228, -1152, 1062, 1001, 728, -655, -1824, 212,
+  1070, 1599, -630, -303, -1859, 500, -2100, 3014, -1904, -1243, -816, 2527, -99, 1152, -816, -2147,
+  -1573, 1875, -864, -252, -1298, 225, 348, -2928, -1352, 1440, 495, 1495, 2184, 1620, -369, 1776,
+  2295, 522, 1617, -2568, 254, -1843, 1529, -552, 1998, -3815, 3036, -249, 1397, 2700, -387, -784,
+  1088, -1921, 1610, -990, -1508, 118, -444, 384, -2850, 192, -2714, 0, 416, -1441, 864, 318,
+  -856, 123, -210, 606, -338, -1600, -700, 1096, -714, 565, -1224, -266, 99, -640, -204, 565,
+  -143, -250, 1152, 126, -1770, 150, 580, -1952, -2184, -1320, 594, 345, -364, -675, 1353, 0,
+  945, 87, 294, 107, -635, 2134, 1807, 368, 666, 1962, -414, 581, 127, -1512, -774, 294,
+  2448, -2712, -575, 550, -812, -236, 1332, 1344, -570, -960, 1298, -728, -1664, 1310, 768, -2120,
+  -963, 615, -735, 0, -169, -2100, 300, -137, -2142, 1582, -1428, 266, 891, -896, 102, -452,
+  858, -1625, -480, -378, -354, 975, 696, 1586, 0, -1680, -891, -690, 2184, 1890, 1599, -1776,
+  -1755, -87, -735, -1391, 2032, -679, 1807, 276, 444, -872, 138, 166, -1397, -864, 387, -1078,
+  -816, 339, 1380, 990, -812, -1534, -740, -576, 114, -480, -236, 728, 728, -786, -960, 530,
+  428, 615, 0, 1010, -338, -1000, 200, 1370, 119, -1469, -2754, -931, -198, 1664, 1938, 791,
+  1716, 750, -96, 882, 944, 900, 348, 1708, 832, 480, 792, -460, 182, 135, -738, -2220,
+  810, -522, 735, -321, -2159, 2134, 417, -184, -1776, 981, -1242, 415, -127, -216, 1677, -882,
+  408, 452, 115, 660, 348, -1534, -888, 96, -912, 1728, -236, 1001, -104, 393, 192, 0,
+  321, 615, 945, 101, 169, -1000, 1100, 1507, -833, 339, 510, -1729, 396, -1280, 306, -452,
+  0, -1125, 0, 630, 2124, 1200, 232, -1220, -2080, -2880, -990, 1495, -819, 270, -1845, -1221,
+  1485, -696, -3381, -428, -381, -1164, -695, -1380, -1332, 545, -2484, 664, 127, 1728, -129, 882,
+  -408, 565, 1725, 990, 580, -826, 1036, 1632, 342, 1056, 118, 819, 312, -3144, -96, 0,
+  1819, -861, 1365, -202, 169, 2200, -3400, -5480, -3451, -1243, -102, 266, -3267, -768, 1632, 226,
+  2288, 3000, 96, -2142, -708, -150, 348, -122, -936, 2280, -2079, -3565, 91, 0, 246, 666,
+  -810, -261, -2793, -321, 3683, -97, 1807, -460, 2775, -4687, 1104, 166, -4445, 432, 1032, 784,
+  -1632, -2599, -2185, -660, -696, 354, -5032, 768, 2394, 576, 590, -1183, 2080, -131, -1344, 2756,
+  -856, -1476, -735, 808, -1521, -1800, -1500, -822, 714, -904, 1224, 399, -99, -128, -204, -1243,
+  2288, -3500, 864, 1638, 354, -975, 348, 366, 312, 2400, 1089, -460, -1001, -405, 3567, 2331,
+  2565, 435, 0, 535, -508, -2037, -973, 828, 555, -1090, 2760, -1245, 381, 756, 903, -1176,
+  -1632, 452, 1265, -1540, -348, 1534, 592, -192, 342, -288, -354, 364, 624, -1572, -1920, 424,
+  -321, 2460, 315, -808, -338, -200, -200, 959, -238, -226, 102, -1330, -1485, 512, -1224, -2034,
+  -1716, 1500, -768, 2646, 1298, 375, -116, -732, -208, 480, 0, -1035, -364, -945, -615, -111,
+  270, 1653, 2058, 856, -2286, -2134, -1251, 184, 111, -1853, 2208, 747, -1143, 216, 516, -784,
+  408, -113, 920, -770, -348, 590, -148, -1920, 1026, -1056, -590, 819, 1872, -1048, -2112, 318,
+  -856, -246, -1155, -1111, -338, -500, -1200, 1370, 0, -1808, -2244, -266, -297, 640, 2244, -791,
+  -1573, -1625, 96, -882, -1062, -375, -1624, -4026, 1560, -2520, 594, 1035, 0, -2430, -2829, -555,
+  -1755, 783, -5145, 1070, -254, 776, 0, 828, 222, -1526, -276, -166, -508, 2268, 903, 980,
+  816, -565, 575, 770, -2900, -236, 444, 288, -114, -1152, 472, 910, -832, 2096, 1824, -212,
+  2140, 615, -945, 3131, -2028, -300, -900, -959, -357, 791, 816, 1197, -693, 512, 306, 1695,
+  -1001, 2375, -864, 756, -118, -1800, -232, -122, -1872, 1800, 495, -1725, -91, -1890, -2091, -888,
+  810, 2697, -3381, -856, -2032, 1164, -1390, -1288, 777, 109, 690, 664, 254, -3240, -1161, 1470,
+  -1224, 1356, 575, -1870, -348, 944, 148, 1728, -2622, 1728, 118, -1365, 208, -393, -96, 848,
+  1498, -861, 0, 808, 507, -800, 1400, -1096, -2261, 113, -1326, 399, 396, 1280, -204, -1921,
+  429, 0, -768, -126, 472, 375, 232, 610, -104, 240, -2079, -2070, -637, 270, 861, -111,
+  810, -783, 1911, -107, 635, -679, -417, -644, -111, -109, -2070, 166, 0, 864, 2064, -1470,
+  -952, -565, -345, 1980, -348, -1180, 2220, 672, 798, -672, 472, -1001, -1976, 1834, -960, 1060,
+  0, 123, -1260, 1111, 1352, -200, -500, -685, -1547, 1243, 1122, -2261, 198, -2048, -1020, -1130,
+  1287, -1000, -864, -630, 354, 1575, -1044, -1586, 208, 360, 693, 920, 455, 1215, 861, -888,
+  -540, -261, 1323, 107, 889, -291, -1946, 552, 777, -109, -3864, -996, -889, 1836, 387, -1862,
+  -544, -1921, -575, 0, 1160, 826, 592, 672, -1254, -480, 118, 1365, -832, 1048, 576, 212,
+  -321, -1107, 105, -2121, 507, 1600, -1700, -137, 714, -791, -816, 0, 0, -2176, -408, -1695,
+  -1716, 875, 1920, 504, -826, 150, -580, -732, 104, 2040, -1683, 345, 910, -2565, 738, 777,
+  -540, 174, 1029, 0, -381, -1164, -278, -1012, -444, 109, -828, 0, 1016, 108, 1032, -98,
+  -408, -791, -460, 1430, -696, 0, 2664, 1344, 0, 1536, -472, -1365, -312, -262, 1248, 212,
+  -1284, -246, 735, -1818, 1521, -500, 300, -411, 0, -113, -510, -798, -990, 384, -714, -1356,
+  143, -250, 480, -378, -1180, -675, 116, 244, 1872, 1320, -1881, -345, -1092, 1215, -246, -222,
+  0, 261, 2940, 749, -381, -1940, 417, -1196, 111, 1308, -276, -913, -127, -540, 0, -1274,
+  680, -904, -230, -110, -2204, -708, 1332, -1248, -1938, -1344, -354, -1274, -1144, 655, -672, 530,
+  -1498, 4305, 945, -1212, -1014, -600, -1200, -274, 119, -2034, -816, -399, -1287, 2816, 1224, -1469,
+  2145, 1750, -192, -3276, 2832, -1725, -3248, 1342, 1560, -120, -2277, -1610, -1820, 675, -861, 1998,
+  810, -348, 441, 749, -1143, 0, 556, 0, -2109, 327, 276, -415, -2667, -540, 1548, -784,
+  -544, 2486, -345, -1540, 348, 590, -296, -864, 912, -1248, 1770, -910, -520, 0, -1728, -318,
+  535, -984, 0, -505, 2028, 100, 100, -3151, -1190, 0, -1938, 931, 1683, 640, 2040, 791,
+  286, -1625, -96, -882, 236, -525, -348, -1708, 832, -1320, -891, 115, -1183, 270, -492, -111,
+  -2160, -87, -1029, -2675, 2540, 582, -1251, -1104, 333, 436, -414, 166, 254, 0, 1290, -882,
+  952, -1808, -115, 990, -3712, -708, 1776, -672, -1482, -1344, -1770, -1274, 1248, 262, -480, 212,
+  -1177, -1230, 420, -404, 1859, 1100, -1000, -1370, -2380, 226, 714, -399, -3465, -2048, 0, -1695,
+  2145, 1125, -1152, -378, 0, -1125, -1972, 2440, -1976, 720, -2376, -2300, -1365, -2430, 492, -333,
+  -2565, -1392, -588, 856, 127, -1649, 417, -1656, -999, -2180, -1932, -1494, 127, -216, -1290, -1372,
+  3400, 1243, -2990, -990, 1856, 1298, -296, 192, 1710, 192, -708, 1092, -2184, 1048, -864, -212,
+  214, -2583, -630, 1818, 1183, -1100, -200, 2466, -357, 791, 816, 2394, -1683, -512, 408, -1469,
+  0, -1250, 1824, -504, -1062, -525, -464, 2318, 1040, 1320, 1287, -345, 2093, 540, 1353, 1332,
+  -1755, -870, 441, 107, 1778, -873, -834, 736, 888, -2943, 414, -498, -1270, 540, 2064, -588,
+  -1904, 791, -2070, 0, 1160, 472, 592, -384, -1938, 192, -1416, -1092, 728, 2227, -1632, 848,
+  -963, 2214, 1470, 1212, -1521, -2900, 900, 2055, 1071, 2260, -102, 399, -792, -1792, -306, 904,
+  -3432, -625, 2208, -2520, -236, -1425, 348, 3050, -312, 360, 1089, -2645, -728, 2025, 369, -999,
+  -1890, 696, -1176, -1712, 0, 679, 2502, 276, -1554, 1635, -966, -1909, -508, -1296, -258, 1176,
+  -1224, 452, -575, -990, 464, 2242, 740, 2112, 684, -2592, 1652, -182, 0, -262, -1440, -848,
+  -1177, -246, -945, 101, 169, 200, 0, -2192, -119, -226, -1428, 133, 693, -1792, 102, 113,
+  -1001, -2250, -672, 882, -3186, -1125, -1044, -732, 312, 840, 495, -1150, 455, 945, 369, -666,
+  -540, 435, -1911, -749, -508, 194, 1251, 2116, 444, -654, 1656, 249, -1651, -1080, -645, 294,
+  -1768, -339, 690, 220, -116, -1416, -148, 384, 1140, -1056, 0, -910, 208, -131, -192, -318,
+  -1070, 861, -105, -404, -1352, -200, 0, -1096, -1071, -2486, 612, -532, 693, -1408, 612, -1130,
+  -2002, -2375, -480, -1260, -1416, -975, -116, 122, -624, 480, -99, -2300, 1001, 135, 1599, 666,
+  -2025, 435, -1617, -1819, -3302, 97, 973, -276, -555, 1744, -138, -913, -3683, 864, -903, -1078,
+  -3264, -678, -230, 1430, -1972, -1062, 444, 480, 114, 96, -2006, 0, 936, 1310, -192, -1166,
+  -642, -2952, -525, -303, 0, -400, -1400, 1096, -833, -1017, 1428, 133, -1386, -640, 0, -226,
+  -1859, -125, -960, -2268, -354, 300, -580, 244, -416, -840, 297, -2645, 1183, -675, 492, -111,
+  -135, -696, -1176, 856, 2032, 388, -417, 368, 666, -545, -966, 249, -2286, -2268, -2709, -490,
+  0, -791, 230, 1430, -1508, 1652, -888, 768, -1140, 288, 1062, -1092, 936, -1441, 0, 106,
+  -642, -369, -315, 202, 676, -600, 700, -1233, -357, 678, -918, -1463, 792, 256, -408, -226,
+  -1430, -375, 1248, -378, -354, 150, -812, 610, -1768, -360, 891, -575, -455, -1350, -1107, -111,
+  -1890, -609, -1176, -107, 1270, 1552, -2085, 368, -444, -327, -1518, 83, 381, 432, -1935, 0,
+  -272, -565, 690, 1210, 116, 1652, -592, 672, 684, 768, -590, 364, -416, 1310, 480, 106,
+  2354, -1353, -210, -1515, 507, -300, 2000, -4521, -6426, -1017, -1836, 4655, 2376, -2816, -1530, 0,
+  1430, -375, 96, -882, 708, 675, 1972, 2074, 2288, 2520, -1386, -1035, -819, 3240, 615, -555,
+  2430, -957, -1176, 107, 1397, -291, 3892, -1656, -2109, 1744, -1104, -2241, -889, 2808, 3741, -882,
+  2720, -113, -1495, -3520, -3596, -1180, -1480, -864, 342, 1440, -2124, -3549, 208, 131, 192, 106,
+  -428, -492, -630, -606, 169, 800, -1900, -137, -1309, 226, -2652, 2128, 297, 512, -306, -1243,
+  1287, -2250, 192, 126, -1888, -450, 812, -2806, -208, 240, -495, 920, 546, 810, 2091, -2442,
+  1080, -1044, 588, -1712, -1651, -873, -1807, 2392, 777, 218, -4278, -166, -1016, -1620, 1806, 1568,
+  -1224, -791, -1495, 1210, -2088, 354, 1036, -1632, -456, 480, -236, 273, -1664, 1048, -96, -742,
+  -321, -492, 1155, -606, 507, 100, -300, -411, -714, -452, -102, 1330, -594, -1536, -102, -2712,
+  -715, 1000, -768, -504, -708, 0, -116, 732, 832, 1560, -297, -2530, 364, 1350, 2337, 1443,
+  -2025, 1566, -2205, 1070, -127, 679, 695, 1012, 888, 327, 690, -581, -381, -324, 387, -784,
+  544, -1469, -1035, -220, -812, -118, -296, 1824, 684, 576, 590, 455, -2080, 131, -960, 424,
+  -1177, -1107, -420, -1010, -2197, -300, -2500, 1370, -119, -2373, -1326, 665, -1287, -2176, 204, -1017,
+  286, -500, -1728, -1764, -1298, -375, 348, 610, -208, -1080, 495, -920, -182, 2025, -246, -666,
+  -1350, 696, 441, 856, -1270, 1746, -556, -1012, 999, 1308, -4002, -249, -1397, -2376, 1806, 490,
+  3264, 1243, -575, 0, -1276, 826, 592, 192, -912, 480, 944, 364, -2392, -393, 192, 106,
+  -2782, -492, 210, -707, -676, -500, 2000, 3562, -238, 226, 204, -3458, -495, -384, -204, 791,
+  -715, -750, -864, -1008, 472, 525, 1160, -610, 936, -240, -198, -2185, -1547, 810, 1968, -2553,
+  -2565, -957, 735, 535, 381, 291, 2919, -1656, -888, -981, -966, -913, 0, -1944, -387, 98,
+  -952, -2825, -920, 1100, -1856, 236, -592, 192, 798, -1440, 0, 273, -1040, -1703, -864, 2014,
+  -749, 984, -420, -202, -845, -1700, -800, -411, -833, -226, 408, -2527, 396, -768, 816, -678,
+  -286, -750, -576, 1008, -1062, -900, 348, -732, -1248, 360, 0, -230, -1092, 135, -1353, 888,
+  1620, 870, 441, 535, -381, -1261, -834, 1288, -444, -872, -1794, 332, -635, -648, -3483, 882,
+  -544, 2034, 230, 110, -348, -1652, -1332, 480, -456, -576, -236, -728, 208, 1310, 1152, 1272,
+  -535, -1599, 525, 808, -676, 600, -300, -1233, 2023, -565, 102, 1330, 99, -1664, 1428, -226,
+  -1430, -1000, 288, -1134, 236, 1125, -1392, -1098, -312, 120, 396, 920, 182, -1080, 123, -888,
+  -810, 0, -3087, 856, 127, -388, -278, -460, -111, -2507, 138, 415, 762, -432, -2967, -588,
+  1224, 678, -1265, -660, 696, 1534, -1924, -1056, 2394, -1920, -354, -1547, -728, -1703, -192, 1484,
+  0, -369, 105, 101, 3042, 800, 800, -1781, 714, 2034, 612, 931, -99, 2560, -408, 904,
+  429, -500, 1824, -252, -1180, -450, 232, 1708, -104, -240, 198, -345, -273, -1215, -1230, -111,
+  1350, -1566, -2646, 214, -762, 582, 2502, 2852, 666, -2071, -414, -830, -508, -1404, 645, -1176,
+  -544, 1356, 1610, -880, 580, 2478, 1480, -192, 456, 288, -2124, 273, 728, 786, -1056, 636,
+  749, -1599, -315, 2323, -676, 800, -1400, -274, -2737, -113, 714, -2261, -297, 256, -1020, 1243,
+  1287, 1375, 384, -882, 1416, 225, -812, 488, -728, 840, 891, -1495, 1547, 945, 1107, -666,
+  -945, -1044, 441, 214, 1143, 873, 2085, -2116, 0, -1853, 966, -830, 254, -1188, 2580, -294,
+  -272, -1695, 345, -550, 1508, 236, 3108, 576, 114, 0, -236, 910, -520, -786, -2304, -742,
+  -3103, -2583, 420, -1111, 676, 0, -1200, 822, 2737, 2373, 408, 133, -990, -1664, 918, 1130,
+  -572, 1250, 1344, 630, -5546, -1200, -1044, 1952, -832, -1560, -2376, 1495, -3822, -1080, 1722, -1110,
+  -1350, -2958, -1617, 2996, 2032, -1067, -2085, -1288, -444, 2834, -2070, -830, -1778, 864, -2451, 392,
+  2176, 1017, 920, -660, 1392, -118, 1332, -1056, 114, 2304, -1416, -2457, -936, -3537, -864, -424,
+  1391, 861, -840, -1313, 1014, -1600, 800, 137, 952, -452, -510, -266, -396, -1664, 204, 226,
+  -3432, -625, -96, 882, 1298, 825, -348, -1708, -2184, 960, 99, -460, 1547, 1620, -123, 444,
+  405, -2262, -1911, 428, -254, -291, -139, -276, 1110, 981, -1104, -581, 1270, -216, -645, -686,
+  -2992, -1695, 2300, 1430, 812, -1770, 2516, -1728, 684, -1248, -590, 91, -104, -917, -192, -1166,
+  -1177, -2337, 1260, -505, -1859, 200, -800, -1096, -119, 1695, -408, -1197, 891, 0, 408, -2373,
+  2860, -1250, 1344, 2268, -3304, -2400, 928, -732, -832, 2640, 594, -345, -91, 135, 984, -1665,
+  -1755, -1044, 588, -1070, -127, 1649, -1251, 368, 1443, -1853, -1794, -1245, -889, -1080, -645, -2352,
+  -272, 1356, -115, -2090, -580, 1534, 888, 1056, -228, 192, -1062, -364, -104, -1310, 768, 954,
+  0, 861, -1155, -1717, 0, -1200, -1600, -411, -1547, -1921, -1428, 1197, -891, -640, -1122, -1469,
+  1144, 625, -1152, 0, 708, -975, -1624, -366, 312, -120, -99, -1265, -1274, -270, 1107, 888,
+  -1080, -609, -2352, 2140, 762, 1164, -556, -1472, 1332, -545, 1242, -1660, 1143, -4860, 2322, -294,
+  544, 452, 920, -1210, -2436, 0, 2664, 384, -2280, -960, -826, -1274, -1456, -524, 2304, -1378,
+  535, 2337, 1995, 1111, 169, -1400, 300, -959, 2737, 565, 306, -1729, 891, 128, 1224, 904,
+  286, 500, -1536, 504, 1180, -1125, -464, -122, -728, 1200, -990, -1150, -91, -1890, -1968, 2886,
+  -2565, 261, -1764, -428, -1016, 0, 1112, 2760, -555, 3379, 276, 83, -1143, -1296, -1419, 196,
+  136, 3616, -345, 1760, 1392, -708, -1924, 864, 798, 1920, 590, 2639, -624, 393, 288, -424,
+  1498, -2214, -420, 808, -3887, -300, 600, -1233, 2737, -1582, -612, -1463, 1881, -256, 1938, -113,
+  -3432, 2500, -480, 126, 472, 600, 696, -1586, -208, 360, 1287, 1150, -364, 1755, 369, 2109,
+  -2025, -696, 588, 749, -889, -291, 834, 92, -333, 109, 1380, 1743, -762, 216, -1548, -882,
+  -3400, 339, -460, 660, -116, -1062, 1480, 1632, -570, 96, 472, -455, -312, 131, 1344, 0,
+  -856, -1968, 420, 404, 1690, 300, -300, -1096, -1190, -2486, -714, 133, -297, -640, 0, 226,
+  -1859, 1875, -96, -2142, 236, 300, -2552, -122, 1664, -1320, -198, 2415, -455, 0, 1107, -111,
+  810, 0, 1323, 1177, 1016, -97, 973, -828, 777, 1199, 552, 830, -762, 2052, 129, -1470,
+  136, 452, 2185, 660, 116, -118, 1924, 0, 1254, -864, 472, 364, 312, 0, 1056, -318,
+  1605, -615, -315, 1616, -3211, -1600, 0, -2329, -952, 339, -2958, 1596, 297, 1024, 714, 0,
+  1144, 0, 1440, 252, 236, -225, -1392, 1342, 728, 1920, 495, -1265, 1274, 4050, 1845, -666,
+  -1620, 87, -1617, -1070, -2032, 1455, 1668, -1472, 1554, 2180, -828, -747, -1905, -216, 1677, 490,
+  -2448, -1017, 1150, -220, 464, -236, -1776, 192, 456, 288, -1652, -819, 1352, -655, -192, 212,
+  2140, -1230, 1470, 808, -1014, -1000, -800, 411, -119, 1130, -1326, -1064, 495, 1792, 0, 339,
+  -143, 1625, 672, 0, 944, -675, -1044, -2318, 1664, 240, 693, -230, -637, 2835, -738, -333,
+  2025, 261, 0, -321, -1270, -97, 3614, 368, 333, 872, 1518, -747, -889, -972, -1032, 3430,
+  -1088, 339, -230, -220, 1276, 944, 2072, -1056, -1368, -576, 1652, -910, -416, 2620, 1152, -2438,
+  0, 123, -735, -1616, 5239, -700, 600, -1644, 0, -2147, 102, 399, -2574, -3072, -408, -1130,
+  143, -3000, 1728, -1638, -1534, 225, 3480, -122, -1456, 1320, -3267, -1380, -910, 0, 861, 1554,
+  1080, -1218, 2793, -3317, -1905, 0, 1946, -1564, -777, -1962, -3726, -1411, -3810, 1512, -1161, -1764,
+  -272, 678, 920, 550, -4292, 590, -2516, 0, 2166, 288, 0, -1729, 416, 3013, -1440, 2332,
+  -428, -738, -525, 2020, -169, -100, -900, 137, -1547, 1017, -408, -2128, 693, 0, 2142, -1356,
+  1573, 625, 576, 252, 1534, 1050, 0, -366, 416, 1920, 594, 460, -910, -405, 738, -222,
+  2160, -696, 147, 428, -2159, 194, 1807, -92, 333, -981, 2484, -2158, 127, 1404, 1935, 686,
+  136, 2260, 0, 660, -812, -590, -888, -576, 912, 2688, -1888, -637, -2184, 0, 1152, 1378,
+  -963, 246, 1365, -606, -845, 1200, -700, 959, -714, -2260, -408, -798, 297, -2432, -204, 1017,
+  -858, 1625, -576, 2268, -2478, -375, 1044, 122, -208, 1200, -891, -2645, 0, 675, 615, 1110,
+  945, -1044, -2205, 1284, 508, -1067, -973, -92, -777, -763, 414, -1411, -889, -324, 129, -98,
+  -544, 0, 805, -330, -1160, -2478, -148, -2016, -2622, 0, 2242, -1092, -832, -524, 1344, 848,
+  -1605, 2337, 2100, 2626, -2028, 400, -100, 2740, -1071, 1243, 2346, -1197, 1188, -2048, 2142, 791,
+  429, 2125, 288, -630, -1062, 975, -1044, -366, 208, -3240, -1386, -1150, 91, -675, 1107, 444,
+  1620, -609, -735, 1498, 127, -873, -973, -920, -1221, -327, -138, -1079, -3683, -1512, -2709, -980,
+  544, 678, 0, 1430, 232, 590, -740, -384, -114, 1056, -708, 182, -2912, -3668, -672, 3180,
+  -2033, -369, 1155, -303, 2873, 700, 1900, 411, 238, -339, -612, 2128, -792, -1024, 1326, 565,
+  858, 125, -960, -2268, 3068, 1425, 116, 488, 2704, -720, -297, -1035, -1092, 135, -1353, -444,
+  1350, -348, 1911, -107, -889, 291, 2224, 1840, -1443, 218, -966, 498, 381, -1944, -774, -1764,
+  -1632, -1243, -230, 1870, -1972, -354, 888, -480, 0, 192, -1298, 819, -1768, 917, -960, 530,
+  749, -2952, -630, -505, -2028, -500, 1400, -274, -1071, -452, -408, 1862, -594, 512, -918, 904,
+  1001, -750, -1152, 630, 2596, 300, -696, -1586, 312, -2280, 1287, -1955, 0, -270, -984, 333,
+  -1890, 87, -441, -1605, 635, -679, -417, 276, -1887, -327, -276, 83, -1524, 0, 258, -784,
+  -408, -565, -1150, 2310, -580, -2242, 592, -1440, 114, -384, -1062, -637, -936, 393, -384, 212,
+  749, 1599, -1260, 1717, -2197, -200, -800, 0, -119, 1017, -816, -532, -396, -256, 510, 0,
+  1001, 625, 768, -756, -472, -600, -2900, -976, -832, -360, -1683, -1380, -728, -2970, -861, 111,
+  405, -522, -2793, -749, -1016, 485, -2502, 1380, 666, -545, -1242, 332, -381, 540, -2451, 980,
+  -1768, -452, 460, 550, 464, -1416, -1036, -1440, -114, -2016, -2124, 364, -936, 1179, 672, -636,
+  -321, -861, 1260, -707, -1014, 400, -600, -2466, 595, -339, -1020, 665, -1188, -1792, 204, -791,
+  -858, 750, 672, -252, -1180, 75, 580, -1220, 312, -1080, -495, -1150, 273, 135, -738, 444,
+  -675, -174, -2205, 1498, 1651, 1067, -278, 184, 333, -109, -690, 664, -1651, -432, 1290, 1470,
+  1496, -1243, -2070, -550, 348, 236, 592, -864, 798, 1344, -236, 182, -312, 524, -480, 1060,
+  -214, -123, 105, -101, -507, 700, -1800, 274, 0, -1243, 1632, -1596, -792, -2048, -2142, -1017,
+  1573, -1625, 1632, -1386, -472, 300, 116, 122, -1352, 1080, -990, 1725, -182, -945, 492, -888,
+  -2025, -1044, -3087, 321, 381, 873, -1529, -92, 333, -2071, -3174, -1328, -1651, -1512, -258, -294,
+  136, -4068, 0, 1320, -812, -1298, 296, 0, -912, 288, -1534, -182, -1872, -2751, 672, 1802,
+  -1498, 3198, 3570, 101, 1352, 800, -1000, 1370, 952, -1921, 714, -133, 198, 1280, -2550, -339,
+  1430, 3125, 1632, 504, -4602, -2475, 812, 610, -1560, 2040, -1287, 0, -1274, 675, 2460, 2664,
+  -270, 1218, 1470, 1391, -3302, -2716, 2641, 736, 333, -1744, 1518, -1743, 2032, -2808, 1419, 1078,
+  3128, -2373, -2645, -2530, 1044, 236, 2516, -1152, -798, 288, -118, -1092, -624, -4061, -2880, 0,
+  214, -861, -315, 202, 338, -1400, 200, -411, -2023, -1356, -1224, 2926, 396, 1408, 918, -2486,
+  2288, -1000, -384, -1260, -1652, 450, -696, -1952, 104, -1080, -594, 345, 2366, 1890, 246, -999,
+  -2835, 87, 1911, -1177, -1270, -1067, 278, 92, -1221, -218, 828, 1162, 1143, -540, 258, 98,
+  1496, -3164, -690, 1650, -1276, 1770, 444, -384, -228, -192, -354, 910, -1040, 131, -96, -848,
+  -642, -1722, -840, -606, 1183, -300, -400, 411, -238, 1017, -2142, 1197, 990, 1664, 306, 904,
+  858, 375, 1248, -1638, -1534, 675, 232, -976, -104, 1920, -891, -1150, -1001, -135, 0, 111,
+  135, 870, -1764, -1498, -1651, 97, -1668, -276, 333, -872, -2622, -1577, -2540, -216, -387, 490,
+  136, 339, 575, -990, -1044, 590, -148, -576, 570, -96, -708, -1183, -1456, -1965, -864, 2650,
+  -2675, -123, -105, 1313, 1352, -1400, 1500, 1644, 1071, 1695, -612, 665, 2574, -1024, 408, -2599,
+  -429, 625, -1056, 1386, -2832, -300, -812, 1220, 832, -360, 0, -1150, -2548, 405, 1230, 222,
+  -810, -957, 2646, 3210, 1397, -194, -695, -828, 1554, 0, -1242, -1909, -1016, -108, 1935, -196,
+  -1360, -226, -575, -1100, -1508, -118, 2368, 288, 684, -864, -826, -91, -1872, 393, -576, 212,
+  535, -246, -840, -202, -2535, -300, -1100, -2192, -1071, 113, -102, 1463, 990, -640, 612, 1130,
+  -143, -875, 2016, -504, -826, -150, 232, 488, 2600, 480, -1386, -1380, 819, 810, 0, 333,
+  -2970, 783, 882, 1177, -2286, 0, -1112, -1380, -1665, 0, -276, 0, 1905, 1296, 1806, 980,
+  952, 0, 115, -880, -232, -944, -148, 672, 1140, 672, 354, 273, -520, 1048, -96, -106,
+  107, -2337, -1365, -101, 0, 1100, -1300, -1781, -714, -452, -510, 0, 594, 1792, -1530, 791,
+  -1430, -125, -1152, -378, 944, 825, -1276, -1342, 936, -600, 891, -1265, 1911, 1485, -1722, -1776,
+  -1890, 1914, -2058, -428, 1270, -582, -417, -736, 3996, 981, 1794, -415, 635, 0, 258, 196,
+  -816, -791, -2300, 1430, 696, 1652, 592, 1440, -342, 1056, 826, 1001, 104, -917, 1536, -424,
+  -642, -615, 1260, -909, -338, 0, 400, -1370, -833, 565, -1020, -1197, 693, -768, -306, 452,
+  -429, -1250, 768, -126, -826, -975, -928, 732, 0, 1080, 396, -115, 0, 810, -123, 444,
+  270, -87, -294, 321, 1397, 582, -973, 0, -444, -327, -690, 249, -2286, 2160, -387, -1862,
+  408, 565, 1610, -660, 464, 1770, -296, -480, 798, 384, -1416, 1365, 624, -1048, 2400, -1060,
+  -963, -123, -1470, 404, -3887, 100, 1200, -411, 833, 1017, -2346, 266, 1287, 0, 102, -791,
+  572, -625, 2112, -882, -2006, -525, -348, 1220, -832, 480, 792, -1265, 91, 405, -369, 1554,
+  1890, 1305, -147, 107, -762, 970, -834, 1288, 555, 545, 0, -498, 127, 324, 516, 980,
+  -1768, -678, 345, 220, 348, -1298, -1184, -576, -456, 480, -2242, 1456, -520, -1834, -480, 954,
+  -107, 0, 210, -2020, -338, -400, 700, -685, -1309, 452, 102, 399, -1782, -1024, -1224, -226,
+  -715, -375, -2112, -1008, 590, -825, -464, 1830, -312, 3600, 1980, -575, 3094, -135, 1353, 111,
+  -1485, 348, 0, -642, 0, -1164, -1946, -644, 999, 981, -3864, 83, -2159, -648, 387, 98,
+  -1360, -791, 345, 330, -1856, -236, 0, -288, -228, -288, 944, -455, 1144, 1048, 480, -2438,
+  -3959, -984, -210, 1818, -2028, -800, -1400, 2466, 2499, 0, 612, -3458, -1485, -4608, 1836, 226,
+  286, 1000, -1632, 1008, -4012, -375, -3016, -2806, -3120, -1680, 2178, 0, 2093, 1350, 3198, 666,
+  -1755, 2175, 1176, -107, -2794, -776, -2780, 460, 2664, -4142, 2208, -498, -3810, -4752, -9933, -2548,
+  136, -3955, 2645, -3080, 580, 4484, 4144, 1344, -3762, 960, -3894, 1274, -3640, 524, -1248, 1060,
+  -535, -2460, -1155, -1616, 1183, -2200, 800, -2466, -2142, 904, -1020, -1064, -297, -1280, 408, 1356,
+  -715, -2125, 192, 1638, 0, 150, -928, 3416, -832, 720, -891, 115, -91, 405, -246, -1332,
+  -810, -348, -1323, -1070, -1397, 970, -1668, 460, -999, 1199, 1656, -1660, 254, -1080, 258, 588,
+  952, 0, -1840, 1430, 812, 826, -592, -1632, 228, 384, -2832, -91, -728, -2096, 480, 424,
+  321, -984, -1050, 808, -2197, -800, 800, 274, 952, -565, -1020, 665, 198, -2176, 102, 2825,
+  572, -375, 480, -1386, 1298, 1050, 116, 488, -312, 120, 990, 345, 1365, 0, -738, 222,
+  -945, -522, 2058, -428, -508, 1164, 695, -1656, 777, 1635, 690, 0, -635, -1296, 645, -294,
+  -1496, -339, 345, -1100, 696, 472, 2220, -192, -2394, -1056, 236, -1092, -1040, 262, 768, -742,
+  107, -246, -525, 1919, -845, -400, -1000, -1644, 595, 1695, -714, 1064, 297, -896, -1938, -3164,
+  -2002, 0, -1248, -1890, -1652, -1575, 1972, -1342, -1664, 3000, -594, -1495, -455, -135, 369, -555,
+  2295, -870, -1323, -535, 1270, -97, -1112, 92, 777, -4687, 828, -1079, -3429, -1404, -903, -1176,
+  -136, 1130, 2070, 220, -1856, -2360, -2960, 1152, -342, 2688, -826, -546, -1040, -1965, 672, 636,
+  -963, -2091, -105, 0, -507, -200, -500, 1233, 1071, 339, -1428, 399, 297, 384, 1224, 904,
+  1144, 1000, -1632, 378, -1770, -900, 928, -122, -416, 840, -693, 1725, -455, 2160, 861, -333,
+  -135, -174, -147, 0, -2794, 485, 278, -460, 111, 654, -138, 83, -2286, -1080, -387, -882,
+  -952, -1130, -1265, 1760, -1624, 1180, 296, -960, -684, 672, -944, 910, -624, -393, -768, 530,
+  -1605, -246, -315, -404, -1859, 100, -600, -2466, -1904, -1695, 1632, 1596, 1188, -1664, 918, 0,
+  -1573, -1375, -384, 882, -1062, 600, 0, -488, -1456, 240, 891, 460, 455, -675, 2583, 111,
+  -1080, 261, 147, -1391, -889, -1552, -1112, -92, -888, -2398, -966, 498, -762, 324, -2193, -882,
+  -816, -1130, -575, -2310, 1160, 236, 148, -288, -1254, 0, 1180, 91, 208, -1834, 96, 636,
+  428, 1476, -1155, 303, -845, 500, 200, 0, -238, 226, -306, 931, 693, 0, -306, 1017,
+  143, 375, -1248, 1008, -2124, -1425, -1624, 854, 728, 720, -1584, 575, -455, 2025, 2091, 555,
+  1350, 609, -735, 1070, 254, 0, -695, -1012, -1110, -545, 690, -581, -508, 1620, -258, -784,
+  1496, 1017, -2185, -1650, -1624, 1534, 1184, 480, -3078, 864, -472, -637, -1560, 2096, 1344, 424,
+  -642, 984, 1365, -808, 2197, -1700, 1600, 2329, 1071, 1469, 714, 931, -792, -3328, -714, -226,
+  2145, -2875, -1056, 756, 2006, -525, 1392, 1464, -416, 240, -594, -230, 546, 1350, 2829, -333,
+  2700, 348, 147, 428, -3429, -873, -2363, -920, -1221, -545, -1656, 664, -2540, -648, 258, -980,
+  680, -339, -1380, -770, -1276, 236, -740, -96, 228, -672, 0, -637, 520, -655, -384, 212,
+  -1284, 615, -525, 1414, 1183, 700, 0, -685, -357, -113, -408, -798, 396, -256, -306, 226,
+  1430, 0, 768, 1512, -590, 450, 0, -1220, 312, 1920, -1089, 345, -1911, -2970, 3813, -777,
+  -945, -435, 2058, -535, 127, -194, -139, 1380, 2220, -981, 0, -249, -2032, -108, -645, 588,
+  136, -113, 230, -1760, -232, -590, 740, -672, -1140, 480, -472, -1001, -208, 786, 384, 742,
+  -2354, -123, -1785, -2525, 169, 1100, 1100, 411, -1547, -1017, -3468, 3591, 891, -128, -1734, 678,
+  -143, -750, 576, -2142, -1770, 450, -2552, -1708, 312, -3240, -2079, 1610, -91, 1620, -1353, -1998,
+  -1215, 1827, -1323, -1819, 889, 1455, 695, -2300, -3219, 2180, -414, 581, 2159, -864, -1032, -1176,
+  -2312, -904, 920, -110, 0, 1298, 1924, 384, 114, 192, 236, 1456, -520, -262, 1248, -424,
+  856, 738, -315, 0, -2704, 2800, 1000, -2603, -952, 1808, -816, 2527, -1782, -640, -816, -1243,
+  715, 2125, 576, 1890, -2596, -525, 1044, 854, -3432, 1800, -2277, 230, 0, 675, 0, 222,
+  2025, -783, 588, 1605, -508, 388, -417, 1012, 1332, -218, -1794, 83, -2286, -540, -387, 1176,
+  -272, 1582, 1610, -1760, -1972, 0, 1036, -192, -1710, 96, -472, -2366, -936, -262, 672, 2014,
+  -749, -1599, 735, 808, -338, -900, -1900, 137, 238, -2034, 306, 665, -2178, -256, -306, -904,
+  2574, -1750, 192, 252, 1062, -225, -116, -732, 1560, -1320, 99, 230, 182, -1755, -2091, -111,
+  -1755, -1131, -1323, 214, 127, 97, 278, -184, 1887, 109, 414, -996, -635, 108, 129, -784,
+  272, -1356, -575, 1540, 0, -236, -2072, -960, -2052, -672, 1062, -91, 520, -1441, 0, -1696,
+  -321, -984, -1260, -1414, -676, -700, 300, -548, 119, -2486, -102, -1064, 495, -1024, -510, -1356,
+  2574, -125, 192, -2016, -118, 375, -1508, 976, -1040, 600, -198, 690, 0, 1350, 492, 222,
+  810, -348, 588, -2140, 889, 873, -139, -2208, -2442, -436, -1380, -581, 1778, -1728, 3096, -1470,
+  1360, 113, 345, 990, -116, -472, -2368, -768, -1938, -1056, 1180, -1365, -1976, -655, -1536, -1060,
+  -1926, 984, -1155, 606, 0, -400, -800, 3288, -357, 565, 0, -399, -1584, 256, -1326, -2825,
+  2145, 375, 2496, 882, -1652, -1050, 1624, 1708, -1248, 1080, -495, 1840, 0, 135, -738, 1110,
+  -405, -435, 3234, 642, -1524, 873, -1946, 276, 1332, -872, -1656, 0, 381, -756, 258, -588,
+  1360, 226, -920, 1430, -464, -2124, 1036, 96, -1140, 1440, -944, -455, -1768, -524, -1920, 318,
+  -856, 123, 945, 404, -1521, 500, 600, 0, 595, 0, -2244, -3857, -1584, 1024, 102, 904,
+  -2002, 2000, -2016, -126, 2950, -150, 580, 732, -520, -840, -99, -1840, -819, -945, -738, -222,
+  945, -348, -1470, 0, 889, 485, -973, -736, 777, 1635, 2484, 166, 381, 1296, -387, 490,
+  -4624, 113, 0, 990, 1856, -354, -592, 576, -342, -1152, 3186, 1183, 312, -131, -96, -212,
+  214, -2460, 315, 101, -338, 0, 300, 0, 2142, 113, -1122, -665, 792, 768, 1632, 452,
+  572, -1125, 1248, 882, 354, -1050, -812, 1342, -1976, -2280, 693, -575, -364, 2025, -369, 1221,
+  1620, 609, 2058, 856, -254, 1552, 278, 828, 1998, 109, 138, -415, -508, 1296, 645, 1078,
+  272, -678, 920, -550, -696, -708, -592, 192, 228, -192, 1534, 1638, -104, 262, -192, -318,
+  107, -1599, 210, -404, -5070, -700, -600, -1918, -1547, 226, -102, 399, 1584, -512, 612, -113,
+  -858, -750, 1440, 504, 0, 75, 1392, 732, 1248, -360, -792, -230, 364, 4725, 1845, -1332,
+  -540, 1218, 0, -214, 889, 485, -1251, 1196, 1554, 3924, 1242, 664, -1016, 1080, 1806, -98,
+  408, -339, -690, 110, -696, -944, 1776, -672, 342, 1248, 1298, 364, 0, -655, -576, -424,
+  -428, 2829, -105, 909, 1352, -1400, 300, -548, 714, -1130, -1836, 3059, 396, -384, -408, 1808,
+  572, -1000, -864, 1386, -2006, -150, -1508, 2928, 1352, 1320, 2970, -1035, 637, -540, 1722, 1443,
+  -810, 1914, -588, -1926, -1651, 1164, -695, 1748, -111, 872, -138, 1328, 1524, 0, 2064, 2058,
+  0, -1130, 115, -550, 0, 2242, -3700, 864, 342, 1536, 590, 0, 1456, 393, -2208, -848,
+  -963, 1599, -840, 1313, 169, 300, -1100, -822, 1904, -1582, -2040, 931, -1584, -3712, 2958, 1130,
+  -2145, -2000, 768, 504, 826, -900, 0, -854, -104, 600, -198, 115, 364, 0, 2952, 111,
+  -3240, 1653, 2940, -1391, -1905, 485, -2780, 1472, 222, -1635, 3174, 747, -1270, 756, 258, 1764,
+  -2176, 904, -345, -1430, 116, 0, -888, 2400, -2736, 1824, -1770, 1911, -936, -393, 768, 106,
+  -428, 1968, 735, 1818, -1690, 1600, -1200, 3288, 1309, 339, 0, -1729, -594, -384, -102, 1808,
+  -858, 3125, -192, -1512, -590, 375, 0, 1220, 1664, -720, 495, -690, -4186, -135, 492, 1221,
+  -1080, 2697, -1470, -321, 1524, -582, 1668, 1288, -1776, 545, 1656, 1411, 1270, -1512, 129, -490,
+  -2856, 113, -1035, -2090, -348, 3304, 1924, 2112, -1482, -192, 590, 1274, -1144, -786, 768, 0,
+  -321, -1107, 945, 303, 2366, -1700, -400, 548, 2023, 1243, 1020, -532, 891, -640, 918, -452,
+  -2002, 625, 192, 882, 0, 1050, 1508, 1342, 728, -120, 2277, -805, 1001, -405, -492, 111,
+  -2025, 2262, 4263, -321, 2794, 679, 0, 184, 0, -1635, -828, 1909, 1524, -3456, 129, -196,
+  -1088, 452, -115, -880, 348, -2596, -1480, 1440, -228, 1248, 354, 364, 208, 393, -288, -1272,
+  -1070, -2460, 630, -101, -1352, 1300, 1100, -274, 476, 1469, -1734, -2261, 792, 768, -510, -565,
+  -572, 2125, 480, 252, 0, 1125, 3248, -732, -936, 1080, 198, 805, -1365, 810, -1230, -1887,
+  2295, -1827, -882, 214, 3175, -679, 1529, -1288, -333, 2180, 552, 996, -2159, 1404, -1290, -2744,
+  -816, -1582, -1495, 1210, 1276, 1180, 888, 1440, 1710, 864, 3186, -728, -832, 786, -96, 1378,
+  428, -1353, 315, 909, -676, 1200, 2200, -822, 238, -1017, 510, -1197, 1089, -1792, -1122, 0,
+  -143, -1875, 96, -2268, 2006, 2100, -1392, -366, 1040, 1080, 2673, 2070, 1001, 540, -1845, -444,
+  -4455, 696, 2205, -1712, 1143, -1164, -973, 0, -111, 218, 138, 996, -381, -1512, 387, -980,
+  408, 2147, 345, 0, -696, -118, 444, 1728, -570, -576, -236, 728, 416, 1572, 1728, -2650,
+  535, 246, 210, -707, -1183, -500, 1100, -137, -833, 226, -714, 532, 198, 768, -102, 113,
+  572, -125, -480, -1134, 590, -750, 812, 1098, -520, -120, 99, 345, 1001, -945, -246, -2442,
+  945, -2088, -3381, 749, 2032, 1358, -139, 460, 777, -436, -828, -747, 2413, -1188, 129, 784,
+  1360, -1017, -230, 110, 580, -1652, 1332, -1824, -456, -576, -1062, -546, -416, 524, 480, -1908,
+  -2033, -1107, -735, -404, -338, 700, 1500, -137, 1309, -226, -612, -399, 99, -2816, 204, -904,
+  3003, -625, -576, 378, -472, -300, -2088, -1952, -936, -1560, -99, 0, 91, -1890, -123, 1221,
+  1215, -2175, -2058, 2033, 762, -194, -1390, 1104, 1332, -327, -966, -1411, -1778, -216, -2322, -1666,
+  3944, 339, -1495, -660, 580, 944, 3552, 0, -456, -1344, -1652, -364, -728, -1441, 1344, -318,
+  -642, 0, 315, -202, -338, 400, -300, 548, 238, 226, 612, 2394, 693, 1152, 102, 0,
+  3146, 2250, -1344, 126, 236, -900, 696, 976, 936, 1320, -2178, -690, -455, 270, 984, 1332,
+  1890, 435, 1323, -1926, -127, -2037, 695, -1656, -444, -436, 276, -1992, 254, 0, 645, -392,
+  408, 1130, 1955, -2750, 1276, -590, 888, -384, -912, -1056, 826, -1547, -1560, -1048, -1344, 1908,
+  321, -1230, 420, -1818, -3718, 600, 300, 137, 119, -226, -918, 1596, -198, 128, -612, -1243,
+  1144, -2625, 1152, -378, 708, -2025, -696, -488, -2704, 120, -1188, 1955, -273, 270, 246, 111,
+  945, 609, -1176, -428, 1143, 485, 139, -552, 2109, -218, -1794, 415, -1905, -1080, -387, -588,
+  680, -452, -345, -990, -116, 1770, 1036, -2304, 2280, -96, -1770, -2275, 312, -655, -480, -318,
+  -1498, 1353, 315, 202, -845, 2100, -400, -4658, -2737, -2373, -102, -3724, -693, 4352, -1122, 113,
+  5577, -375, -960, 630, 236, -750, -348, -1098, -6656, 1920, -1287, 2990, -1001, -135, -3690, 2997,
+  -1080, -2784, 0, -2461, 2159, 97, -6116, -3680, -444, -1526, -414, -415, -762, 108, -774, -1176,
+  680, 2260, -2415, 2090, -2436, -118, 296, -1536, 114, -1248, 1062, 91, 624, -2751, -576, 1272,
+  0, 738, -1155, -1111, 1014, -800, 600, 1644, 1547, -1695, -1020, 1064, 594, -384, 1632, -791,
+  3146, -250, -576, 1764, -944, -1950, -1044, -2318, -520, -960, -99, -920, 728, 2025, -2460, 555,
+  2565, -174, 1911, -642, 635, 970, -278, 368, 222, -218, 2484, -415, 254, -3348, 2322, 0,
+  816, -113, 1035, 1980, -464, 2360, 2812, 768, -1596, -480, -472, 0, -2600, 0, 288, 530,
+  -1391, -1599, -105, 1919, -3887, -800, 300, 1507, -119, -1243, -204, -798, -1188, -512, 306, -791,
+  0, -1625, 384, 378, -1180, -1575, 580, 122, 208, -1680, 198, -920, -273, -675, 1968, -1443,
+  -945, -1305, 1029, -535, 1143, 388, -556, 736, -1443, -654, 1380, 996, -1143, -1404, -645, -784,
+  3536, 452, 345, 880, 464, 1534, -3848, 480, 798, -192, -708, 182, 0, 262, 384, -212,
+  -214, 2460, -1260, 1111, 1352, -2100, -700, 822, 952, -2373, 1530, 2394, -198, -512, 1122, 4068,
+  -1716, 0, 768, 2016, -1652, -1800, 2552, -1098, -1872, -1800, 594, -230, -3094, 3645, -123, 1221,
+  -3645, -87, 3381, -1926, -254, -2716, 2641, -644, -2109, -1090, 690, -2158, 2286, -972, -3741, 1666,
+  680, -1695, 690, 1320, 812, -1652, -1628, -1344, -3306, -2208, 1298, -910, -104, -393, -1440, -1060,
+  1070, 1968, 1890, 505, -507, -2200, -2100, 822, -476, -226, 1020, 1995, -693, -1920, -102, -565,
+  -3432, -3125, 1824, 1008, -1770, -525, -464, 244, -312, -1200, -297, -115, 1183, 945, 492, -1332,
+  -405, 348, 2058, -2247, -635, 1843, 834, 1748, 333, 109, -2484, -2822, -1905, 216, -387, 2156,
+  -680, 1130, 230, 1540, 696, 236, 2664, -1344, -2964, -1056, -118, -819, -312, -1048, 0, -1166,
+  107, -1845, -630, 0, -2535, -1400, 1800, 548, 952, 339, -510, -399, 1881, -1664, -612, -1695,
+  -3146, -1000, 0, 1512, 236, 150, 928, -3050, 208, -3480, -198, 115, -910, -945, 1107, -111,
+  -540, 1305, 441, 2140, -762, -1067, -695, 460, 1998, 0, 1656, 1494, -4191, 2268, 1677, 490,
+  -272, -113, 230, -880, -1624, -2124, -740, 480, -1026, 1056, 0, -1001, -416, -2489, 1056, 1060,
+  214, -2091, -1680, 2020, 845, 800, 2300, -685, -1666, 1243, 816, 399, 1683, 1792, -612, -452,
+  -1716, 625, -3552, 3780, 354, -750, -1624, -1098, 1456, 600, -1188, -1610, -1092, 675, 861, -444,
+  -540, 957, -1176, 1926, -2159, 679, -2085, -1564, 888, 1962, -1242, 83, -1143, 1512, -1806, 1764,
+  -816, -565, 920, -1210, -696, -1416, -592, -1344, 114, -2112, -826, 455, -1768, -786, 384, -2120,
+  -2354, -2091, 1470, -1515, -5070, 900, 800, -1096, -1785, 1356, -1428, -532, -99, 512, 1020, 339,
+  -3289, -1750, 2112, -2016, 0, -825, 928, -854, -1352, -480, -594, 230, 1092, 675, 1476, -444,
+  -540, 2523, -1029, 856, -3175, 1067, 139, 0, 2331, 654, -414, 913, -4064, -108, -129, -1470,
+  3536, 565, 1150, 440, 1044, -1534, 148, 96, 4104, -1056, -354, 2002, -104, -1572, 384, 1060,
+  1391, 1599, -945, -707, 0, 100, -1600, 2329, -476, 678, 1530, -1596, -495, -1408, -102, 452,
+  -1287, -500, 288, -756, -2478, 300, -1624, 366, -624, -1440, -297, -115, 1729, -270, -615, -1443,
+  270, 609, -1470, -2354, -1143, -194, -973, -920, -1665, -545, 138, -249, 0, -432, -2322, 2744,
+  -816, -1017, -1840, -2530, -232, -118, 1332, 672, -684, -768, -236, 3003, -416, -524, -2688, 954,
+  -2568, -615, 840, -3737, 2197, -2500, 1500, 1644, 1428, -339, 2856, 399, -1188, -512, -2040, -3842,
+  1001, 1000, -480, -2142, -4602, -375, 116, 244, -208, 1680, -2871, -1150, -4186, -135, -1107, -1554,
+  4725, -1566, -1470, -428, -508, -1261, 1529, 276, 222, -2289, -2622, -2407, 1905, -1620, -2193, -392,
+  -1632, 1243, 2415, -2530, -232, 354, -296, -480, 4560, 0, -1888, -3913, 208, -1441, -1344, -2014,
+  -1177, -1230, 735, 2222, -4394, 3700, 100, -2055, -714, 1356, 1224, -2926, -1584, -384, 2856, -2034,
+  1859, 2500, -2016, -1512, -1062, 600, 3132, 610, -1664, 1200, -693, -805, -4277, -540, 1722, -4662,
+  -2025, 957, -3822, 856, 762, 582, 1251, -552, -444, -1744, 966, 913, -762, -1296, 1548, -2058,
+  -2040, 2712, 230, -3960, -1160, 1062, -1184, 2016, -1368, 384, 590, 819, -208, -3668, -576, 2120,
+  -749, -246, 420, -505, 3380, 0, -500, 3425, -595, -452, -306, 931, 990, 0, -612, 339,
+  0, 1000, 192, 1134, 472, 450, 1972, -122, -416, 600, -2277, -1150, 1001, -2565, -1230, -2331,
+  405, 87, 735, -856, 2032, 388, 1946, -920, -2775, -654, -690, -1411, -1016, -2160, -1419, 0,
+  952, -339, -1380, 0, 580, -708, -1628, -864, -1824, -1152, 2360, 1092, -1456, 1179, 384, 530,
+  -1605, -2214, -420, 606, -1690, 1200, -1000, 2877, -238, -113, -306, -1330, -495, -256, -1122, -1243,
+  2002, -625, 0, 2268, -2596, 375, -2320, 1952, -3640, 1320, -396, 0, 1456, -945, 0, 777,
+  1485, -609, 3675, 214, 1524, 97, -1390, 184, 0, -3379, 138, -1162, 381, -2268, 0, 1960,
+  4216, -2034, 575, -1650, -348, -590, 1776, -1344, -1368, -1152, -2124, 546, -1768, -1179, 192, 0,
+  963, 246, -2940, 1212, 1014, -200, 600, -1370, -1785, 2599, -408, 931, -693, -512, 1326, -3842,
+  715, -3000, 1536, -882, 1062, 900, 2320, 0, 1456, 720, 1089, -345, 910, 135, -1968, 222,
+  -4320, 957, 0, -1712, 1143, -1067, 1251, 460, 1554, 327, 2070, 830, 762, 972, -774, -294,
+  2312, 678, -690, 1210, 696, -826, 1036, 1920, -2394, -1344, -2006, -1183, 416, 2096, -672, 2014,
+  428, -1845, 0, 1212, -1183, 1700, 0, -685, 119, 452, -102, 1463, -1980, -2048, 714, -1017,
+  -2717, -500, 1152, 0, -944, 600, 1276, 0, 0, -1680, 693, 345, 1001, -2565, 1107, -1332,
+  270, 522, 294, -107, -635, -1164, 278, 276, 1443, 327, -4140, 249, 508, -756, -645, 392,
+  -816, 452, 805, 1320, 1160, 1062, -1036, -288, -570, -96, -590, 1001, 624, -786, -384, 1272,
+  749, -3813, -315, 1414, 1859, 800, 200, -1370, 1071, 226, -408, 1729, -1287, 2176, 102, -2712,
+  0, 375, 3264, 504, 1180, -1875, -696, 854, 1456, 480, 1386, 805, 546, -945, 246, 333,
+  -675, -1827, -147, 1070, -1397, 388, 0, 828, 2331, -109, 2208, 913, 762, 540, -1419, -588,
+  680, 339, 1150, 1540, -1740, 826, 1184, -672, 1824, 768, 0, -546, 416, -1048, -576, 1802,
+  107, -2829, -210, 1212, -1690, -1000, 2200, -822, 0, 565, -2550, -532, 1287, 896, 918, 1243,
+  -715, -1500, 864, 1890, 236, -1275, -1160, 732, 1664, -2280, 1584, -1725, 819, 2160, 123, 333,
+  -1215, 174, 441, -107, -762, 873, 556, 1656, -333, 2071, 828, -581, -3683, 0, 1419, 1078,
+  -544, 113, 460, 1980, -1624, -944, -1184, -1632, 342, 1536, -1888, 91, 1456, -131, 2112, 530,
+  -107, 738, 1470, -404, 676, -100, 700, 1781, -714, 1130, -1530, 3059, 0, 768, 714, -2938,
+  -1859, 375, -1056, 756, -1416, -75, -696, -366, -624, 1080, -1386, 1840, -91, -1755, 738, 666,
+  405, -87, -2646, 2033, 1143, -679, -2502, 2300, -1554, 109, 276, 1743, -2540, 1728, -774, 294,
+  -1496, -1243, 2300, 660, -1508, -2950, -2664, 480, -1254, -192, 1652, -1911, 1352, -1179, 480, -2120,
+  -1391, -1599, -2730, -909, 507, -2500, 900, -2466, 595, -678, -2550, 1995, 594, -2048, 2346, 1243,
+  286, -1375, 1824, -126, 2006, 600, -464, -1342, -2288, -3240, 495, 2415, -273, 1080, -246, 111,
+  -1215, 1566, -4116, 2247, 127, 1552, -2780, -460, -333, 218, -276, 415, 1143, 1512, -3483, -1666,
+  952, -1582, -2300, 220, -1740, 236, 1628, 3072, 2622, -576, 2596, -2366, 1248, -786, 576, -2544,
+  -1926, 123, 1050, -909, 0, 1000, 1500, -1781, 2023, 1921, 1224, 1729, 0, 1280, 3060, 113,
+  858, 2375, 1824, 630, 1298, 75, -1508, 2562, -208, 3120, 1188, -345, -455, 1215, 1968, 111,
+  1350, -609, 1029, 1391, -1778, -1164, 2919, -1196, -1998, -1090, -1104, -1743, -1905, -540, -516, -1078,
+  -2176, -113, -460, 220, 1856, 1416, 2072, 1824, 1596, 1056, 2478, -819, -1768, 1048, 192, 1166,
+  -1819, 492, -945, -202, -676, -200, 1700, 1233, 476, -226, 714, 798, -495, -1152, -1836, 2373,
+  -2574, 750, 3360, 882, -236, -450, 2320, 732, -1768, 2040, 297, -920, 1183, 1620, -1230, -2331,
+  2565, -783, -1029, -1177, 762, 388, -1390, -736, 2109, 1635, -276, -581, -1270, -1296, -1161, -686,
+  272, -678, 1610, 330, -1044, -708, -5920, 864, 2622, -2016, 1416, 0, 832, 524, -288, 742,
+  2675, 984, 420, -505, 3211, 300, -600, -2192, 1428, 113, 306, -798, -198, -896, 3774, 904,
+  4004, -875, 2208, -630, 1180, -900, -1044, -732, 104, 360, -1485, 920, -1729, -2295, -615, 111,
+  -675, -783, -147, 1498, -254, -1552, -5421, -92, 333, -2289, 0, -913, -1397, 1404, -1548, 1470,
+  -1496, -1808, -1265, 1870, -2320, -590, -1776, 0, 1482, 1632, 1770, -1001, 2080, -917, -1056, 212,
+  214, -2337, 630, -2525, 676, 1600, 1000, -1644, -833, 0, -1122, 266, 2574, 1280, 2244, -1356,
+  -572, 625, -1440, -756, -472, -225, -1276, -366, -1248, 1080, -495, -1035, 1911, -2565, -615, 1443,
+  2025, -1044, 1176, -2247, 127, -582, 2502, 368, 1332, -1090, -966, -664, 0, 324, -1935, -294,
+  -136, -226, 1265, 2530, -1276, -3186, 1480, -768, -684, 1344, -2478, 182, 520, -262, 1248, -1696,
+  1284, 0, -840, -202, 169, 500, 1100, -274, -595, 226, -612, -532, -792, -1024, -816, 226,
+  1573, 875, -480, 1134, -590, -600, 464, -244, -520, -1200, 198, 230, 1729, 675, -369, 1443,
+  540, -87, 1029, 642, 1016, 873, 139, 828, 444, 218, -1518, -664, 254, -216, 774, 490,
+  952, -2034, 1035, -770, 0, 1416, 296, 288, 912, 384, -1416, 1274, 0, 1965, 192, -2120,
+  -642, -738, -735, 303, 1352, -200, 700, -1096, -2142, 226, -102, 399, 99, 128, 408, -1017,
+  -286, 1000, -672, -252, 590, -975, -116, -1342, -1248, 960, -891, 230, 819, -2700, 738, 1110,
+  945, -174, -3822, 0, -127, 679, 1807, -1104, 888, 1308, 552, -1411, 0, 756, 1419, 784,
+  -272, -2034, 1725, 1210, -580, -118, 444, -288, 1140, 576, -472, 0, 104, -917, -1728, 212,
+  -428, -2214, 525, 404, 1521, 700, 1500, 822, 952, 678, -408, -133, -1089, -1152, 408, -1582,
+  1716, 250, -288, -504, -2714, -1200, -580, 610, -1976, -480, 198, 0, -1274, 4185, -738, -444,
+  1350, 87, 588, 1070, 1524, 291, 834, 1380, 1665, -327, -690, -581, -1397, -216, -258, 882,
+  -272, 2938, 2300, -330, -464, 472, -296, 384, 570, 576, 1062, -91, -312, -1572, 960, -1060,
+  0, 123, -735, -1515, 1352, 1500, 1000, 274, -119, -226, -1632, 532, -99, -768, 306, -2147,
+  1716, -750, -384, -378, -826, -600, 696, -244, -2496, -120, 1683, -1380, 0, 135, 1353, 222,
+  -405, -348, 1470, 535, 1270, -873, 695, 0, 111, -327, -1380, 664, 127, -864, -903, -980,
+  952, -452, 0, -1980, -1856, -236, 0, -1344, 114, -384, 2006, -91, -2600, -524, 1632, -212,
+  2033, -738, -1995, 2222, -3042, -700, -3800, 4110, 952, 3277, 2550, -931, -3465, -2176, -2448, -339,
+  -858, -1250, -672, -504, -472, -75, -2436, -1220, -4576, 840, 4356, 1265, 2093, 135, -1722, -444,
+  -405, 783, 1323, 856, -1016, 485, -2919, 1012, 3885, -2834, 2484, -2324, -889, -3456, 516, -392,
+  -1360, -4407, -575, 1100, -1392, 0, 148, -192, -2622, -576, -826, 1001, -728, -3537, 672, 2226,
+  1070, -2214, 1050, 1414, -1859, -1400, 100, -1918, -833, 1356, -1122, -798, -1386, 1664, -1122, 226,
+  286, -3375, -384, -1386, 1770, 75, -812, 244, 728, 600, -891, -345, 91, -270, -2214, -888,
+  405, -2784, -1176, -321, -1778, -194, -1946, -1380, 555, 109, -966, -1826, 127, 216, 645, -1078,
+  816, -339, 115, 2310, 1392, -708, 888, 192, -798, -768, -590, -1365, -416, -786, 96, -742,
+  1819, 492, 630, 909, 169, -400, 600, 411, -714, 1243, 918, 0, 693, -1408, 102, 678,
+  2288, 1875, -1248, -1764, -1062, -825, 0, 244, -208, 480, -891, -2645, 455, 1620, 2337, 1332,
+  -1080, 348, -3675, -642, -635, -97, 834, -1012, 555, 545, -1380, -332, -635, -1620, -903, 1568,
+  0, -565, 460, 880, -232, 472, 296, 864, -912, 1440, 1062, 0, -1248, -262, 960, 318,
+  -1712, 1968, 945, -303, 676, -800, 400, 1644, -119, 339, -1122, 266, 1683, -4224, -816, -452,
+  0, 1250, -1824, -1386, -1534, 300, -2088, -732, 1352, -1440, 891, -3565, -364, 270, 1230, 0,
+  -1350, 1740, -294, -1391, -1905, 1649, -4726, 2392, 0, 1417, -828, -913, -889, -324, -1290, -686,
+  -816, 2260, -1265, -880, -232, 708, -740, 480, 456, -1536, 1652, 1365, -1040, 1834, -1440, -636,
+  3103, -738, -1785, -606, -3211, 1100, -1100, 685, -2499, -1808, -3774, -532, -990, -128, 1122, 565,
+  -286, 1625, -576, 504, 1652, -1350, 116, -244, 1768, -120, 693, 460, 455, -1755, -1845, -666,
+  2025, -435, 147, 856, 1905, 0, 278, 184, 1776, -327, 2346, 1577, 254, -756, 1806, -784,
+  -952, -1356, -690, -110, -812, -2006, -2220, -768, -2394, -672, 118, 273, 208, 1572, -288, 1696,
+  749, -1476, 210, 0, -1352, -1000, -700, -2603, 0, -1356, 0, -1596, 1287, 896, -1020, -226,
+  -2002, -875, 1152, 2016, -354, -150, -232, -488, -1456, 1920, 1089, 1495, 364, 405, 369, 999,
+  135, -348, -2058, -214, -254, -485, -1112, 1288, 1443, -1417, 2898, 1577, 635, -1188, 0, -490,
+  1360, -565, -115, 1210, -464, -944, -1332, 0, -1254, -1632, -590, 182, -624, 262, 1536, 106,
+  -1070, 2337, 0, -909, -1690, -1600, -1300, 1370, 595, -226, -1530, -133, 594, -1792, -714, 226,
+  -2717, -625, 1632, -378, -1652, -1050, -232, -976, 624, 120, 0, -1035, 364, 1485, 1845, 1110,
+  -540, 348, 735, -214, -889, 2522, 1529, 368, -555, -545, -2484, -581, -635, -972, 0, -980,
+  0, -1695, 690, 2090, -812, 944, -1184, 960, 114, -192, -1652, -819, -312, 131, -384, -106,
+  -214, -2460, -525, -202, -169, 0, -100, 822, 1190, 0, -306, 133, -297, 384, 714, 452,
+  0, 1500, 1536, -882, -236, -150, 1160, -1342, -2600, 1200, -198, -1150, 91, 0, 2214, 111,
+  -1620, 0, 441, -749, -1524, -485, 556, -1380, -777, -218, 276, -1245, -1270, -1512, -1419, -882,
+  -816, -1808, 1610, 2750, 696, 354, -2516, -96, 114, 1344, -826, -2184, -1664, -1310, -1344, -318,
+  -428, 246, 315, 404, 1183, 700, 1900, 685, -238, 2373, -1632, -1330, -396, -1024, 510, -1469,
+  -1144, -1375, 384, -126, -1652, -375, -1276, -1098, -1144, -840, 396, -1495, -1547, -2700, -2337, -222,
+  1350, -957, 0, 107, 1016, -97, -2919, 2208, 1110, 3052, -966, -249, -381, 2916, -903, -294,
+  -1496, 904, -805, -1210, -1044, -472, -444, 0, -2052, -480, -1298, 910, -1872, 524, -672, 954,
+  -214, -1968, 420, -1111, -2028, 300, 700, -7124, -6069, -904, -1428, 3990, 297, -640, -204, 1469,
+  -429, -1500, -192, -6048, 1534, 300, 0, 122, 1456, 2280, 1980, -1035, -1729, 3240, -2214, -1887,
+  -135, -435, -441, 1391, -1524, -388, 4865, -1748, -1665, 872, 828, -1494, 127, 2160, 1419, -980,
+  408, -339, -2530, -3190, -1856, -118, -148, 2016, -1482, -768, -590, -2093, -104, 3799, -864, -2120,
+  -2140, -1845, -840, 0, -2704, 100, 1600, -1096, -1666, -678, -1428, 798, 0, 1024, 1836, -565,
+  858, -875, -1248, 504, 1770, -1200, 1392, -3538, 624, -120, -396, -460, 1001, 1620, 4797, -2553,
+  -405, -261, 1470, 1819, 127, 97, 2363, 736, 1776, 1853, -4140, 747, 508, 1944, 387, 1470,
+  -680, 1130, 1265, 660, -464, 354, -740, -2016, -228, -576, -1770, 819, -3120, 262, -1728, -1378,
+  214, 369, 1365, -1111, 1859, 500, 0, 685, 476, 113, -102, 665, -1386, -1792, -1020, -1243,
+  1144, -1625, 0, -126, -118, -1350, 464, 1586, -208, -840, -2079, 575, 273, -405, -369, 222,
+  -270, -957, 1323, 321, 1143, 582, -1112, -644, -999, -327, 1932, 0, 508, -1296, 1032, 0,
+  272, -678, 460, 330, 348, 0, 0, -288, 1482, -192, 1298, 455, -520, 1310, -192, 848,
+  -963, -3690, -1890, -909, 169, -400, -3200, -1370, -1071, -1921, -1428, 1596, -1881, -1536, 306, 565,
+  -286, -750, -576, -1512, -3068, -975, 1856, 1342, -1664, -480, -693, 920, 91, 3240, -2337, -1110,
+  0, -870, -294, -1498, -1143, 1940, 0, -828, 1554, -1744, -5934, 1079, -1270, -3348, 2193, 2254,
+  2584, 565, -1265, 660, -928, 826, 1480, -1152, -684, -1056, 1416, -1365, 1248, 262, 1632, 318,
+  -1712, -1353, -1890, 0, -3549, -400, -100, 274, -2261, 0, -204, -3325, -2178, 0, 0, -226,
+  1144, -375, -1344, -2142, -118, 0, -464, 732, 416, 120, 0, -1380, 1729, -1080, 1722, -2220,
+  270, -1218, -1764, 535, 4318, -1358, -139, -644, 1221, -981, -138, -83, 0, 0, 903, -490,
+  -408, -1582, -920, 110, -1160, 354, 1628, -1440, -1368, -192, -1770, -455, -1560, -2096, -480, 1378,
+  1819, 0, -525, -1919, -1690, 1400, 900, 1781, -1547, -452, 1224, -266, -198, 384, -1938, -1130,
+  -858, -1375, 1536, 1386, -2124, 0, 0, -610, -416, -2880, 396, -1955, 546, -810, -1230, -333,
+  2295, 609, -2793, 214, -1524, -291, -973, 460, 3219, -218, 1518, -996, -1143, 1188, -2064, 882,
+  -1904, -1469, -1265, -1540, 1160, 1062, 592, -288, 912, -960, -472, -1365, 1144, -917, 480, 1802,
+  -642, -369, -105, 707, 169, -1300, -1600, -411, -595, 226, -714, -931, -99, -2176, 306, 1808,
+  -429, -750, 0, -2142, -1652, -1125, -928, 366, -104, 120, -198, -1035, 1183, 135, 738, -1665,
+  0, -87, -3969, -214, -635, 1455, 834, -828, 1221, -763, -138, 0, -1143, -1404, -774, 1078,
+  -408, -1695, 0, 110, -2204, -590, -592, 480, -114, -864, -826, 637, -624, -1441, -384, -318,
+  642, 2583, 420, -404, -3549, -300, -700, 685, -3094, -678, 1224, -266, 396, 1152, -1326, -113,
+  1573, -1625, 0, -1260, -354, -150, 232, 732, -312, -480, 693, -805, 182, -405, 738, -999,
+  -270, -609, -1764, 1498, -254, -582, 1251, 736, -222, 109, 1518, -1577, -2921, -648, -774, -1078,
+  -816, -1017, 805, -330, 1624, -118, 1776, -288, -342, 768, 354, 182, -1560, 524, -768, 848,
+  -1391, 615, 210, -303, -1859, -1000, 1300, 3425, 952, -1017, 1020, 266, -297, -2432, -1020, 339,
+  -2574, 125, 576, 1386, -1888, -2475, 812, 244, 416, 960, 297, -3680, 273, -270, -369, -444,
+  405, 1218, 294, 321, 127, -485, 417, 644, -1221, 218, 690, -1162, -508, -756, -645, 2254,
+  -272, -1017, 115, -770, 1276, -354, -592, 384, 1368, -192, -826, -182, -1768, -131, -768, 106,
+  1284, -123, 1995, -808, -845, 2200, -200, -685, -2380, -3616, -102, -1596, -198, -1280, 1326, -1469,
+  -2145, 750, 576, -2142, 2596, -225, 3016, 0, -104, 240, -1980, -3105, -273, -270, 984, -4218,
+  810, -174, -882, -214, -254, 1164, 417, 1104, 555, -545, -3726, -498, -4318, 1296, 3612, 196,
+  -680, 678, 690, -3520, -464, 0, -1184, 864, 342, 864, -3068, -1638, 728, 524, -480, -530,
+  -1712, -1845, -1050, -101, -2535, 1500, 1800, -685, 476, 1356, 510, -1330, -1386, 1280, 2754, -2147,
+  -1430, -250, -672, 1890, 708, -1200, 1508, 2318, -936, 120, 693, -805, -364, -270, -492, -111,
+  -945, 1044, -1911, 1712, 762, -194, -3475, 644, 1554, -1090, 1104, -1577, -3429, 432, -516, 0,
+  1632, -565, 230, -2530, 348, -472, 296, -2496, -2166, -960, -590, 910, -728, -1179, -480, 1696,
+  0, 1599, -630, 202, -2535, 100, 200, -1233, -595, 0, 1836, 532, -396, -768, 306, -1130,
+  -715, -875, 672, 378, -354, -1125, 928, -122, -3328, 2280, -2079, -115, -910, -675, 1845, -1998,
+  270, 0, 1029, -749, -1143, 291, 973, -2024, -1221, -218, 1656, -1245, -2286, 648, 1032, -1372,
+  0, -1695, -230, -660, 464, -1298, -2516, -288, -342, 0, 472, 637, -1040, -2227, -864, 530,
+  214, 369, -2940, -404, -3211, -700, -2600, 1370, -2261, -791, -510, -1197, -990, 896, -1020, -339,
+  -286, -2875, 192, 2016, -1298, -825, 2320, -1342, -1144, -1320, -1089, 1265, 0, -2160, 615, 666,
+  1350, 1044, -1323, 856, 1143, 1746, 1251, 184, 555, -1526, 1380, 415, -1905, -216, 1032, 1764,
+  2176, -3277, 1495, -330, -4408, -2714, -2516, -576, -912, -384, -1888, -182, 624, 1048, 1152, -212,
+  642, 1107, -1995, 1111, -169, -1700, 600, 274, 0, 2147, 1020, -798, -1683, 2560, 102, -904,
+  -1573, 1625, 480, 252, -354, -300, 1856, -854, -208, 360, 693, -115, 637, -3240, 123, -3885,
+  1485, 174, 441, 2461, 1651, -970, -1946, -2208, 1665, 1635, -1104, 166, 762, -216, -2322, 882,
+  -544, -1808, 1265, 1540, 232, -1416, 1628, 576, -1368, 576, 118, 637, -1664, -393, 864, -848,
+  0, 615, 1890, 606, -2197, 600, -1500, -685, 833, 565, 612, -532, -198, -1152, -1428, -565,
+  1573, 1000, 672, -1134, 1770, -150, -1508, -1586, 2080, -1080, -1188, 805, -546, 2700, -246, 222,
+  -945, 174, -3234, 107, -1651, 1552, 278, -184, -444, 872, 1380, -83, -381, 0, -1290, 490,
+  -2856, 678, 1955, 1760, 696, 1180, -592, 192, -456, 1344, -708, -910, -520, 1179, 384, -1166,
+  963, -2337, 1155, 909, -1690, -100, 0, 548, 476, 113, -306, 1995, 693, 128, 408, -1356,
+  -715, 125, 1152, -378, 1180, -1575, -1392, -2074, -1976, 720, 396, 460, -91, 1890, -1230, 777,
+  1080, -1218, 441, -214, -889, 388, -139, -736, -111, -1635, -2622, 0, 635, 432, 0, 784,
+  -1360, 1017, 460, 660, 580, 118, -296, -864, -1254, -96, -1062, 364, 208, 262, -672, -212,
+  428, 0, 0, -404, 169, 300, -600, -1096, 238, 452, -306, 2527, -990, 1792, 0, -2712,
+  0, -3125, -288, 126, 236, -1125, -580, -2806, -104, 720, -990, -690, 0, -2835, 492, -777,
+  675, 87, 147, -428, 254, 1552, -139, 460, -1332, 218, 1380, -1992, -2159, -972, 1935, -588,
+  816, 791, -1610, 2090, -812, 826, 0, -768, -570, 864, -1180, 91, -1456, 1048, 864, 1378,
+  214, -1107, 315, -101, -1521, -2600, -700, 685, 476, -791, -408, 931, 1089, -512, 408, 0,
+  2145, -2125, 96, -2016, 826, 1350, -348, 0, 1040, -480, -1683, 0, 1092, -945, 123, -888,
+  945, -522, -1617, 107, -508, -291, 2085, 1104, 0, -1744, 276, -581, -762, 3456, 258, 588,
+  -952, 226, -920, 660, 1276, 354, -1628, -1248, 570, 1728, -1652, 273, 1456, 3275, 0, -530,
+  -4280, 984, -1050, 2424, 845, 1200, 1400, 3562, 2856, -791, 2448, -2128, 990, -768, 1836, 452,
+  1716, 3500, -1728, 1890, -5074, -1575, -928, 2196, -1768, 2280, -1287, -690, -3094, -2970, 3321, 1554,
+  -1080, 1914, -1617, 214, -2413, -1552, -2641, 736, 444, -109, 828, 581, 1524, -3672, -5418, 588,
+  -1904, 1243, -805, -2310, 464, 1416, 2220, -192, -2736, -384, -2006, 1365, -2496, -3668, 96, 1484,
+  -856, -369, -1995, 1111, -1690, 1400, -100, -1233, -2023, -1695, 1734, 2394, 594, -768, 102, 791,
+  -858, 1000, -864, -252, -2596, -1050, -3364, 976, -1040, -2280, 1485, -1265, 182, -1620, -861, 0,
+  -1755, 2001, 1323, -1605, -508, -97, -139, -552, -111, -981, 690, 581, 635, 216, -645, -588,
+  680, -2147, -2300, 330, -116, 236, -1776, 768, 114, 288, 0, -728, -1040, -1441, -672, 106,
+  642, -984, 735, 101, 1521, -500, -200, 274, 1904, -339, -714, -266, 495, -1152, 918, 452,
+  -2717, -1625, -1824, -756, -1180, 375, -1044, -2318, 1144, -1440, 1584, 2990, -1001, 0, -2583, -1443,
+  -1350, -957, 2058, 1177, -635, 0, -973, -276, -1554, -436, -2346, 1577, 254, 0, 258, -882,
+  -408, -2147, 230, 0, -1740, -1180, -740, 1632, -456, 864, -1416, -910, 624, 262, 1536, -848,
+  -1391, -2583, 525, -505, 676, -200, 200, 1507, -119, 1469, 612, -1064, -396, 1792, 204, -1469,
+  2431, 125, 576, 2394, -2478, -900, 2668, -1342, -104, 1680, 891, -115, -910, -945, 861, 2109,
+  1350, -1305, -588, 1070, 2159, -2425, 4448, -276, -2331, -872, 828, 498, -1016, 1728, -2451, -882,
+  680, -2373, 230, -440, 1276, -2714, -2516, -768, 1482, 1632, 1180, -546, -416, 393, 288, 106,
+  107, -2091, -1785, -2020, -1183, -1600, -300, -411, 1071, 904, 204, 1596, 594, -640, -408, 1243,
+  1859, -1375, 1632, -126, -944, 675, -2088, 1220, -520, -1800, 1485, 3795, -364, 1890, -1107, 555,
+  -135, 87, 882, -1498, -3048, 97, 139, -460, 1998, -1744, 1518, 249, 2540, -1404, 645, -1176,
+  -680, 339, -1265, -990, -348, 1888, 2960, 1632, -1026, 192, -1062, -364, 416, -3013, 1344, -1908,
+  1284, -738, -105, -505, -3549, -500, -700, 548, 714, 113, 306, 2394, -594, -1664, -1836, -1017,
+  -1430, -1750, 576, 882, 826, 150, 2088, -1464, 0, -1560, -297, -1265, 728, 1350, 2091, -1998,
+  -1485, -435, -1029, -1391, -1016, -1455, 834, -460, 444, 2289, -276, -2573, -2540, 648, 645, 686,
+  408, -1356, 460, 1210, 464, 826, -1036, -1344, -228, 384, -590, 455, -1352, 524, 768, 424,
+  -214, -369, 525, -505, -2028, 200, 0, 411, -1666, 678, -408, 931, 594, -1408, 306, -3955,
+  1144, 375, 288, 504, 1534, -1950, 1160, 122, -832, 1080, -1782, -1265, -91, 945, -369, -444,
+  810, 87, 441, -428, -254, 679, 834, -1656, 0, -981, -414, 1162, 254, 108, -645, -1078,
+  544, -452, 920, 660, 348, -118, 2072, -672, 1938, 96, -2714, -1547, -1456, -1048, -288, -1060,
+  -1391, -861, 210, 101, -5070, 800, 1500, -137, 1190, 791, -2448, -133, 0, -384, 204, -2034,
+  715, -875, 480, 0, 944, -975, -928, 366, -1976, -720, -396, -1380, -364, 0, 1353, -2664,
+  405, -957, -1029, 0, 508, -97, 417, 1472, 222, 763, -1932, -332, 381, 432, 258, 1372,
+  -2176, -904, 1610, 330, 928, -118, -2072, -576, 1254, 576, -118, 910, 520, -1834, -768, 1166,
+  0, 123, -1050, 202, -1352, 1800, -200, 1370, -833, 2034, -102, 0, -792, 1792, -306, -226,
+  -572, 1375, 576, -3276, 826, 225, 1856, -2196, -208, -1320, 99, -805, 546, -675, -369, -1554,
+  1620, 174, 1176, 535, -889, 582, 1529, -552, 555, 436, 828, -664, -2032, 0, -1677, -98,
+  -544, -226, 1150, 660, 1624, -2360, -296, -864, -1140, 192, -472, 1456, -728, 1703, -384, -742,
+  -5778, -3075, -1155, -1010, 3042, -2200, 700, 4932, 3689, 1695, 2550, -931, -3168, -2560, -408, -2147,
+  3003, 500, -1056, 756, -5900, 750, 812, 854, -1144, 480, 1683, -2070, -1547, -2700, 3813, 555,
+  -1890, 261, 2646, 2140, 254, -3686, -1529, -2116, 1998, -218, 0, -996, 2540, -3240, -8772, 784,
+  952, -4068, -1265, -330, -348, 2832, 2072, -576, 684, 768, -1652, -1911, -3016, -3144, -2208, -1378,
+  1070, -861, -525, -1717, -2535, 2200, -500, 959, -2261, -791, -1734, -133, 0, 1536, -918, -226,
+  1716, 1125, 864, 1638, 1180, -300, -696, 1342, 832, 3240, -1584, 805, -455, 3105, 1476, -1665,
+  -270, -1218, 1764, -963, -1143, 194, -1251, -460, -1110, -218, -1380, 415, -1524, 756, 1677, -1960,
+  680, 1130, 460, 1430, 1856, 472, -148, -288, 228, -768, 1770, -637, 1040, 0, 192, -1696,
+  1177, -123, 1050, -404, 1352, -1000, 1300, 2329, 119, -452, -102, -133, -693, -1280, -1020, 565,
+  -1144, 0, -1152, 1890, 354, -300, 1044, -1464, -1456, -480, -990, 1035, 273, -135, 1845, 444,
+  1350, -87, -294, -1819, 2667, -679, -1529, 276, 888, 218, -414, -581, -635, 432, 516, 1960,
+  272, 565, -1035, 880, -232, -1770, -592, -2592, -1026, -2208, 590, -1001, 832, -131, -768, -212,
+  -1926, 984, -210, -2525, 1690, -2800, 0, 959, -1428, 0, 612, 1995, -1089, 256, 306, -2373,
+  2288, -3375, 480, -2142, -590, 375, 1624, -1464, -624, 360, -693, -345, -1365, -3105, 246, -1332,
+  6480, -174, 2205, -1284, 2794, -582, 695, 92, -1665, -1635, 138, -1577, 381, -2592, -1677, -1862,
+  3400, 226, 1955, 330, 116, -1770, -1184, -480, 342, -384, -1534, -91, -1144, -1179, -864, -2862,
+  -321, -2706, -1260, -202, 507, -200, 1000, -1233, 476, 2147, 408, -399, -693, 512, -612, -678,
+  1859, -125, -960, 0, 590, -1500, 812, 2196, -1456, 1920, -297, -230, 728, -540, -2214, -1554,
+  405, -870, 735, -1605, -1651, 291, 278, -644, -333, -763, -1242, -249, 508, -1296, 2064, -980,
+  2448, 904, 1610, 2970, -1160, 1180, 3108, 480, 0, 576, -2360, -910, 416, -1179, -480, -2120,
+  -1284, 492, -945, 404, 1014, -1000, 600, -411, 1071, -791, -816, -665, -198, -2432, -306, -226,
+  -715, -875, 480, -3528, 472, 0, -348, 2440, 208, 840, 396, -2415, 0, -405, -492, 555,
+  -270, -522, 0, 428, -1778, -388, -1529, 460, -1221, 327, -966, -249, 254, -1188, -2193, 0,
+  816, 1017, -460, 0, -1856, -236, -2960, -1344, -342, -576, 826, -1820, -1976, 1703, -768, -530,
+  -642, 1476, 945, 0, 507, 400, -200, -1781, -2023, -113, 714, 1596, -297, 384, 1020, -791,
+  143, -375, 1344, -756, -1770, -1200, -348, 2196, -416, -960, 891, 115, 0, -675, -2460, 555,
+  -3240, -2262, -1029, 2033, -1397, 0, -556, -644, -1554, 1090, -1518, -1162, -508, 1080, -129, -196,
+  -136, 565, -1150, 1210, 116, 2832, 296, 288, -1026, 0, -2242, 546, -1352, 1310, 192, 742,
+  -107, -1476, -1050, -1212, -1352, -800, -600, 548, -952, -1808, 1224, 665, -3366, -384, 1020, 452,
+  572, -500, 672, -2394, -1416, 375, 348, 1464, -936, -120, 1188, 1150, 819, -1620, -738, -666,
+  -1620, 0, 0, 1284, 1270, 194, -2502, -1656, -1221, -1635, -1380, 166, 127, -2160, -1548, -490,
+  952, -2147, -1150, 1540, -116, 354, 592, -480, 0, 576, 118, -1183, -1352, -1310, 384, -1696,
+  642, 984, -1575, -404, -1014, 1100, 700, -411, -238, 339, -1326, -266, 1188, -1024, 0, -3842,
+  -143, 1750, -2304, -252, 354, -375, -1160, 488, -936, -360, 792, -1265, 182, -2430, -2337, 222,
+  -675, -1392, 1029, 1391, 1397, 970, -2641, 736, 666, -327, 0, -1162, -508, 2808, 645, -2058,
+  816, 113, -805, -110, -1044, 944, -2220, -288, -2964, -1248, -2242, 455, -1872, 2227, 192, 0,
+  -107, -1968, -2415, -1414, 1690, -1000, 400, -7535, -4998, -1582, -3264, 6783, 990, -512, 816, -791,
+  2145, 750, -96, -3654, -1298, -1050, -2088, -1586, 1040, 1080, 198, -2300, -1274, 2160, -4305, -555,
+  540, 1914, -294, -1926, -1270, 388, 3892, -3588, -1998, -1526, -276, -664, -508, 2160, -129, -1078,
+  1768, -1356, -3335, -2200, -1740, -354, 2812, 2112, 798, 576, 944, -637, 1664, 3144, 576, -1696,
+  -107, -1353, -525, -505, -1014, 1500, 300, -411, -119, -791, -1326, 1064, 495, -1024, -714, -1921,
+  2145, -1625, -2016, 126, -1770, -3300, -1044, -2684, -1976, 720, 99, 690, 182, 3240, 3321, -222,
+  2700, -1653, -588, 2354, -381, 679, -1112, 276, 2553, -981, -5106, -332, -381, -1188, 1032, 392,
+  -816, 2034, 345, -2200, 464, 590, 0, -576, 0, 480, 1298, 182, -832, -786, -1056, 212,
+  -1284, 492, -105, -1818, -845, -600, -500, -1096, -1428, 1582, 510, 0, -1881, -896, -1530, -1469,
+  2431, 500, -384, -2016, 236, -1500, -1044, 610, 1456, -840, 891, -1495, -273, -1215, -369, 666,
+  -540, -522, 588, -428, -127, -291, 556, -276, -777, -327, -414, -913, 2794, -1512, -2322, 0,
+  -544, 1243, -115, 110, -928, -236, 888, -960, 1026, -1440, 0, -1092, -832, 917, -480, -1272,
+  214, -2952, 420, -2626, 507, -500, -3200, -411, -357, -1808, -918, -133, -3366, 384, 3774, -1356,
+  286, -750, -96, -2394, -1652, -750, -116, 610, -2392, 960, 1782, 1035, -2093, 3240, -123, -222,
+  -2700, -1566, 0, -1498, -1270, 1940, 0, -1380, 555, 436, -5520, -664, -1778, 432, 1935, 196,
+  2176, 1808, -1840, -880, 232, 1298, 1776, -480, 570, 1344, 1298, -637, 624, -262, 1152, 530,
+  -2033, -2214, -1785, -1111, -1014, 800, -600, 548, 119, 226, -1428, -3325, -1782, 0, 102, -452,
+  143, 2125, -1056, 1008, -708, 150, 232, 1586, -1872, 2640, -1485, -1035, 455, -810, -123, -1332,
+  -540, -2001, -882, 2568, 1016, 1455, 695, -1196, 333, -327, -1380, -1411, -635, -864, 1935, -392,
+  -136, 226, 1380, 1100, -3944, 118, 2516, -2016, -798, -864, -118, -2093, -4264, -1572, 1632, 742,
+  1177, -1845, 210, 808, -676, 1300, -700, -548, -1428, -791, 306, 931, -396, -768, 1020, 565,
+  -143, -1375, -1824, -126, -590, -225, 580, -488, -1560, 2640, 99, -1955, 1547, 2835, 1476, 1110,
+  -2970, -261, -2058, -1284, 1651, -1746, 1112, 92, -1443, -872, -138, -249, -381, 432, -387, -980,
+  -408, -2599, -690, 440, -116, -590, 148, 480, -912, 0, 590, 546, 208, 0, 480, -530,
+  -642, 984, -735, -101, 845, 100, -900, -1096, 0, -2260, 714, 2261, 198, -1024, 2142, -2260,
+  572, -625, 480, -3906, -826, -825, -1856, -2562, -416, 480, -792, -1840, 364, 675, 369, -333,
+  -810, -348, -1617, -1498, -2032, -873, -834, 1196, 222, 545, -966, 83, -1905, 324, 774, -1078,
+  -2040, 452, 460, 110, -1276, -1180, -1184, 576, -1824, 960, -2006, -91, -208, 3275, -1344, 212,
+  0, -1845, -210, -1414, 1859, 300, -1200, -137, 1547, -791, 204, 0, -2574, -2048, -1326, 678,
+  -1716, 875, 576, -882, -118, -300, 1160, 0, -1456, 360, -594, -1035, 1001, -2970, -1107, 333,
+  -675, -348, -2646, -321, 254, -291, -973, -828, -111, -981, -1242, -996, -2286, -1620, -645, 196,
+  -1768, 2938, -1150, 440, 0, -1298, 1924, -576, -228, 1728, -826, 182, -2080, 917, -960, -1590,
+  535, -492, -1470, 1111, -338, 500, 0, -137, 1428, 1130, 1020, -2660, 297, -384, -1734, -113,
+  1144, 1500, 1536, -1008, 590, -750, 348, 1708, 416, -2160, 495, 575, 1092, -1485, 492, -333,
+  -3240, 87, -1617, 535, 2286, 1455, -1807, -1288, 2553, -1744, 1656, -166, -508, -1188, 0, 980,
+  -1496, -2825, -460, 1100, -2668, 590, 296, 1056, 3078, 2304, -590, -91, -1456, 1310, 480, 636,
+  -1070, 369, 2835, 606, 2028, 1800, 900, -822, -1190, -2147, 0, 266, 2277, 1408, -1428, -3051,
+  -1287, 2875, 768, 2016, -1534, -2025, 116, -244, 728, 2040, -792, -690, -1274, -540, 1968, 2442,
+  -135, -783, 1176, -749, -1143, -485, 3475, -3496, -999, -109, 276, -581, 1778, 324, 4386, 0,
+  544, -339, 1840, -4070, -3944, 708, 2812, -2304, 228, 1536, -354, -3003, 1768, -1048, -480, -530,
+  -642, -1968, -3150, -101, -1352, -1300, 600, -411, 357, 1356, -2244, -931, -1881, -1152, 714, -1469,
+  715, -2375, 1056, 0, 1298, -975, 116, -2196, -104, -600, 198, 1150, 728, -270, -123, -888,
+  -1485, -870, 1911, 749, 635, 679, 1112, 920, 555, 654, 276, 0, -508, -1188, 0, 1274,
+  272, -1469, 1265, 2420, -580, -118, 3108, -480, 912, 1344, -2006, 364, -1352, -1179, 1056, -954,
+  107, -369, 1680, -101, -845, 800, -700, -2329, 238, -113, -816, 532, -297, -1536, -714, -226,
+  1287, 2000, -96, -882, 354, 0, 232, 488, 1248, 1200, 1089, -805, 546, 1080, 615, 2664,
+  405, 609, -441, -1712, -381, -582, 1390, 276, 777, 654, 414, -166, 889, -648, -1419, -294,
+  2040, -565, -1035, 1870, -232, -826, 1480, 1152, -570, 1248, -1298, -455, -312, -1048, 192, 424,
+  -3959, -1968, -945, -909, -2535, -1300, 600, 2055, -238, -1356, -816, 133, 495, -2688, 918, -678,
+  -572, -625, 864, 378, -118, 600, -928, 0, 624, 0, 990, 230, -1456, 2295, -861, 0,
+  -945, 348, 3087, 214, -254, 873, 3753, 0, 1332, -545, 276, -913, 1397, 324, 1419, 294,
+  -1768, 0, -2185, -330, -1160, 944, -888, -1056, -342, -1536, -2242, 0, -1144, 262, 1344, -1272,
+  -214, -492, 420, 1717, -1521, 600, 600, 1233, -2261, -904, 204, -798, 990, -1152, 816, -678,
+  -1573, 1000, 1248, -504, 1180, -300, -2088, -610, 1248, 2280, 792, -1150, -91, 405, 3321, -1776,
+  -2430, -174, 2058, 749, 635, -97, -973, -920, -111, -1308, 276, -996, -889, 432, 645, -490,
+  -1632, -678, -1380, 330, 348, -1534, 888, 864, 798, 0, -708, -819, -1456, -393, -768, 3074,
+  -428, 1230, 420, -101, -1352, 1000, -500, -411, 357, -1243, -510, -532, -198, -512, 816, 0,
+  143, 375, 480, 126, -118, -600, -1856, 1708, 312, 1200, -1089, -345, 91, -945, -123, 333,
+  1215, -87, 0, 321, 762, -582, 139, -368, 222, -2071, -828, 913, -635, -1836, 645, -1176,
+  816, 1017, -460, -2420, -1740, 708, 1036, 288, 0, 672, -826, -728, 312, 131, -288, 636,
+  -856, 1107, -735, 808, 1183, 200, 400, 685, 357, 339, 714, 266, 792, -640, -306, -1695,
+  572, 2250, -2016, 252, -1534, -1950, 1160, 2440, -208, 960, 693, -2070, 1274, 810, -369, 333,
+  405, -783, -294, 428, -889, 873, -2224, -92, 111, 981, 552, -747, -508, 648, 258, -294,
+  1088, 1356, -1035, -550, 232, 1062, 3848, -864, -342, -576, -2124, 546, -104, 917, 672, 1272,
+  -535, 615, 840, 707, -1521, -200, 1200, 548, 1071, 113, 816, 532, 1188, -3584, 2040, -565,
+  2431, -875, -192, -1134, 1416, 450, 348, -366, -312, 840, 1089, -1150, 637, -1080, 492, 444,
+  0, -609, -147, -321, -2032, 1067, -695, -920, 0, -327, 1380, -830, -1016, -756, -129, 1274,
+  136, 339, 1380, 440, 464, 1062, 1776, -288, 456, -1440, -2242, 273, -624, -262, -1344, 954,
+  321, -2460, -105, 202, 845, 600, -400, 685, 2023, -113, -204, -798, 198, -1536, 1224, -1582,
+  572, 2000, -288, 0, -354, -1650, 928, 244, 208, 1920, 1089, -575, -1001, 945, -2829, 777,
+  2295, -1131, 1029, 535, 1143, -776, 1390, -828, -444, -1744, -966, 332, -1270, 648, -5676, -2744,
+  544, 1130, 575, -3740, -348, -472, -444, 1056, -1254, -1344, -354, -1456, -728, -262, -288, 742,
+  1070, -3567, -3990, -1616, 507, 200, -1900, -3973, -2618, -678, -510, -1197, -1584, -1408, 1530, -226,
+  2717, -875, 960, 0, -944, 600, 3828, -2318, -2600, 1560, 297, -1610, 1365, -405, -2337, 1887,
+  -270, -261, 882, -2033, 635, -1358, 417, -2208, 3996, -3161, -1242, -332, -5715, 108, 774, 1176,
+  1632, -1243, 690, 3520, -2552, 944, -888, -1536, -2052, 1920, -3658, -2275, 520, 2096, -672, 3816,
+  -2889, -615, 1260, -3030, -1014, 200, 900, 1781, 1190, -1469, -510, -798, 1683, -2432, -408, -452,
+  2431, -2000, 672, -378, -354, -1200, -464, 0, 520, 1440, 594, -345, -1456, 540, 0, -444,
+  2835, -174, 294, 107, 0, -97, -278, 92, -111, 654, -414, -1494, 1270, -1404, 645, -686,
+  952, -1130, 1610, 0, 696, 118, 1480, 96, 1254, -384, -1888, 546, 1040, -1965, -288, -2862,
+  1605, -738, -945, -1010, -676, 600, -800, -548, 238, -1469, 918, 532, -1188, 512, 1122, 1921,
+  715, -1000, 864, 1134, 354, 450, -2204, -732, -1872, -600, -1188, 2530, -819, -1215, 2091, 1332,
+  540, 2175, 0, -749, -2032, -1940, -834, -1380, 555, -327, -414, 249, 0, 972, -1419, 2254,
+  -408, 0, -1035, 3410, 0, 1534, 592, -1152, -1596, -288, -590, 364, 832, -917, 96, 1060,
+  -1391, 1353, 840, 606, -2366, -1100, 700, 2055, 1785, -339, 306, 266, 2079, -1024, -1122, -1017,
+  0, 2875, -3072, -2520, 0, -1650, -1740, 0, 416, 120, 891, 230, -182, -810, 615, 999,
+  -405, 957, -3822, 1605, 254, -2231, -695, 736, 333, 981, 1518, -1245, -381, -1728, -3999, -1078,
+  544, -113, -1495, -660, -2668, 472, 1184, 1248, -2052, 384, -826, 1001, -2184, -2751, -960, 1802,
+  963, 369, -840, 707, -169, -500, -1700, -2877, -833, -452, 204, 399, -693, -128, 1020, 1695,
+  -143, 0, 960, 378, -1180, -1275, -1624, 244, -2392, -120, 1980, -1380, 1274, 540, 492, 1443,
+  945, 783, -147, 428, -2794, 2328, 973, 1012, -666, 436, 1656, -581, -1651, -1728, 258, -588,
+  -680, 904, 230, 550, 2320, -590, -740, 768, -1254, 288, -708, -1365, 2184, -786, -1440, -848,
+  -321, 0, 105, -707, 3380, 200, 1600, 137, 1666, -791, -2652, 0, -297, 0, -408, -1808,
+  1144, -125, 480, -2268, -1298, -1275, -4060, 1708, -936, 1080, 2079, -1610, 2093, 0, 1722, 333,
+  -270, 174, -294, 0, -381, 679, -1251, 2116, 1887, -981, 1656, 581, 508, -1296, 774, -588,
+  952, -1017, 345, -1540, 580, 944, 1628, -1632, 0, 960, -236, 273, 1352, -655, -192, 106,
+  -428, 615, -2205, -1313, -2366, -600, -1000, -2192, -1071, -452, -3264, 798, -1386, -2176, 0, 1808,
+  2288, -1625, 1632, 0, 1770, -600, -1624, -2074, -312, -1200, 396, -115, 910, -405, -1353, -444,
+  -810, -174, -1911, 107, 2413, -582, -417, -2576, 666, -872, -414, 83, 3048, -756, 1677, 1274,
+  4760, -1356, 575, 880, -580, -1652, -740, -1248, 228, 576, -1770, -1274, 520, -1048, 768, -318,
+  -2568, 2583, -1575, 0, -3211, -400, 700, 411, 119, -1356, -2550, 665, -495, -2688, 1122, 1469,
+  3146, -375, 192, 1764, -708, -1275, -928, 1098, 104, 240, -396, -115, -1820, 4725, -1476, -222,
+  -270, -609, -3528, 214, 0, -1067, 139, -368, -1221, -2398, -1380, -830, -762, -1728, -2322, 196,
+  -272, 1017, 230, 220, -812, 1770, 740, 672, -456, -672, 826, -910, 104, -2489, 1824, -1484,
+  -535, -1722, -1575, -101, -2197, 1000, 600, 822, -2499, 226, -1428, 1064, 693, 896, -306, -1469,
+  -1287, 625, -1152, 504, -944, 375, -812, -976, 1456, 2040, 792, -1610, 819, 1485, 246, 2220,
+  945, 435, 2058, -1070, -2286, 97, 139, -736, 888, -1526, -2484, -498, 381, 1188, -1161, 1078,
+  -952, 565, 805, -1650, 696, 472, 2220, -3264, -2166, -480, -590, -182, -624, 131, 2784, -1378,
+  -1284, -1599, -2205, 101, -1183, 0, 300, 1781, 119, 3729, -1326, -133, -891, 1024, -1938, -452,
+  -286, 250, -2208, 630, -2124, 600, -1740, 488, -3848, -600, 2475, 1035, -182, 1350, -1599, -1221,
+  675, -1653, -147, -2354, -127, -194, -278, -828, 3108, 872, -2208, 1079, -762, 1188, 1161, -1176,
+  136, -565, -230, 1320, -3248, -1652, -2368, -384, -1938, 288, -590, 1092, -936, -3537, 1920, 1060,
+  1070, -3075, 0, -1111, -676, -1700, 600, 0, 357, -904, -1326, -1064, -693, -1152, 1428, -339,
+  -1001, -625, -576, 252, 118, 1350, -1044, -4026, -2704, -1800, 2178, 575, 1911, 1485, -1968, 333,
+  -405, 348, 588, 0, -127, 970, -417, 1288, 1776, -2289, 1380, -166, -3937, 540, -1548, 1078,
+  -544, -1243, 460, 2310, -116, -944, -1184, 1440, -2394, -192, -3068, 182, -1144, -1572, 1152, 1378,
+  1070, -4059, -1260, 1111, -338, 100, 1900, 0, -1904, -452, -408, -931, 990, 2048, 714, -1243,
+  -429, 1375, 960, 756, -826, -1575, -232, -854, 520, 0, 1386, -345, 910, 1620, 1230, 555,
+  405, -957, 3675, 321, -1651, -1843, -1529, -92, 0, -218, -966, 747, -635, -324, 645, -1274,
+  -2040, -1356, 1610, -1100, -1160, 826, -1332, -1920, -1710, -192, 1298, -2093, -624, 0, -192, 742,
+  -2140, 0, -1890, -1010, 338, -900, 700, -548, -2737, -678, 306, 266, 1485, 1536, 306, 3390,
+  858, 1000, -1056, -1512, -708, -300, 232, -854, 728, -840, -693, -1035, -2093, 3645, -984, -1554,
+  -4590, 1740, 1617, -1177, -1143, 873, 1390, 184, -4662, -218, 690, -415, -254, 0, -3483, 98,
+  1360, 904, 1265, 330, -696, 944, -444, -192, 114, -960, 472, -1001, -832, 2227, -1344, -1590,
+  1926, -738, -210, 202, -169, -1500, -2100, -959, -1071, -1695, -1326, 3458, -396, -768, 714, -791,
+  429, 375, -1248, 1008, -1062, -2250, -580, -610, -832, -1080, -396, 1610, 182, -1215, 615, -1443,
+  1890, 522, -882, -2568, -3048, 388, 278, 1840, 2331, 545, -414, -249, -1905, 540, -1032, 588,
+  1768, -1243, 0, 0, -348, 472, 1184, 480, -2052, -192, -1652, 364, -1040, -131, -384, -954,
+  535, -2337, -945, -303, -3887, 300, -2000, -959, -238, 791, -816, 532, -198, 1408, -306, 339,
+  -2574, 1500, 672, 504, 1180, 300, -696, 0, -416, -480, 2178, 460, 182, 675, -492, -1554,
+  810, 1392, -2940, -1070, 1016, 291, -1251, 0, 666, 436, 414, 83, 1524, -432, -903, 980,
+  -680, 565, -1265, 880, -812, 944, -444, 1440, -570, 1440, 354, 728, 832, -393, 480, -106,
+  3638, -369, -1575, -1515, -3549, -400, -1200, -1918, -357, -1921, -1224, -1330, -99, 1792, 204, -339,
+  143, -625, -960, -1260, 354, -825, 116, 244, -208, 2280, 495, 230, -182, 2025, 615, -999,
+  -945, -261, -1323, 321, 1270, -1552, -417, 276, -222, 0, -414, -249, -889, 1620, -645, -980,
+  -1904, 113, -690, -1540, -1392, 118, -888, -1536, 456, 1440, -354, -1001, 1560, 0, 1344, -1378,
+  -1605, -1107, -105, -2020, 676, -400, -700, 1096, 833, -452, -306, -1064, -297, 128, 918, -1695,
+  -1430, -1750, -864, -756, -944, 675, -1508, -488, -936, -1320, 1683, 345, -1365, -3105, -246, 777,
+  -2700, 609, 588, 963, 254, 485, 278, 1104, 111, 109, -690, -1162, 2413, 216, 1935, 1470,
+  -2584, -339, -3105, 550, -1044, 472, -3552, -1824, -2280, 480, -2832, 637, 104, -1441, -480, -954,
+  428, -1107, -315, -2525, 845, 0, 200, -1781, -119, -565, -816, 1596, 495, 1920, -102, -1469,
+  286, -375, -2112, -756, 354, -1350, -116, 610, 2080, -1200, 0, -1035, 546, -135, -615, -1776,
+  -1485, 1044, -2352, -428, 635, -2813, 556, 0, 1887, -545, -1656, 166, -2286, 216, -645, -1078,
+  952, -226, 345, -1320, -580, -1652, 148, 192, -1482, 768, -590, -364, -936, 1834, 1920, -2014,
+  -2889, -738, -3045, 1010, -3380, -1200, 1700, 1918, 4641, 1017, 816, 0, -1584, 1408, 1122, 1017,
+  -1716, 2000, 672, -630, -1416, 975, -232, -2196, -1872, -1920, 2178, -2415, 364, -540, 1107, -222,
+  -4725, 3393, 2499, 1391, -2413, 194, -278, -2208, 555, -327, -690, 664, 3556, -2700, -8772, 1764,
+  -680, 339, 1150, 1980, -1624, 3540, 5920, 864, -3762, 1632, 0, 2548, -2392, 917, 0, -2438,
+  -1070, -369, -1155, 707, -676, -2300, -100, 548, -119, 339, 612, 931, 1188, -1024, 0, 565,
+  -715, 875, 768, 252, -1416, 75, -1044, 2562, 0, 600, -495, -805, -1729, 1755, -123, -555,
+  -2970, 696, -3969, -321, 508, 1358, -695, 644, -888, 436, -2484, -1245, -1270, 540, -903, 196,
+  -272, 904, -345, 440, 928, 2360, -592, -960, 798, -576, 118, 910, -624, -2096, 96, 1484,
+  1284, -1845, -210, -505, 1352, -100, 1900, 959, 833, -1469, -1428, -266, -1188, -1920, -612, 1017,
+  -1287, -2000, -1632, 1638, 1534, -675, -580, -976, -416, 360, 1386, 230, 819, -405, -1230, 2109,
+  1620, -1479, 294, 214, 889, 194, 1529, -2668, -444, 218, 1518, 996, -1143, 108, -1032, 1176,
+  272, -678, -460, -990, -348, 354, 1036, -1728, -1824, 1056, -1062, -1001, -1352, -1834, 480, -848,
+  -1177, 1230, 1995, 101, 2704, 0, 500, -548, -1785, 0, -204, -133, 198, 1792, 612, -1356,
+  -1144, 2000, 1248, 1512, 2242, 450, 2320, 2806, 1768, 1920, -1089, -1150, -1365, -1215, 1599, -1332,
+  1485, -783, -588, -321, 2159, -485, 0, 920, 111, 2507, 966, -166, -1143, -2268, 129, -588,
+  -1224, 339, -2990, 990, -232, -236, -2368, 864, -798, -864, -590, 1092, -1144, -2620, -576, -1060,
+  214, 246, 735, 101, 2028, -2200, 100, -1096, 1309, -904, 510, -1197, -1287, 1920, 2142, -452,
+  -1287, 3000, -288, -1512, -472, 975, -928, -1220, 312, -1200, 1188, -1725, -637, 0, -738, -666,
+  -810, -1305, 882, 2033, -1397, -388, -973, -368, 1665, -1417, 414, 747, -1905, -1296, 1032, 98,
+  -1632, 565, 920, 110, 232, -354, 592, 480, -228, -576, 354, -182, 104, 1441, -384, 212,
+  214, -1230, 525, 1515, -1352, -1700, 1500, 2877, 2142, 0, -2346, -532, -891, -3328, -204, -226,
+  -572, -375, -1056, 504, 354, 150, 1624, -854, -1040, -2280, -495, 575, 819, -945, 1599, 444,
+  1080, 348, -2499, -107, 0, 291, 1251, -460, -777, 2834, 276, 83, -1016, -108, -1677, 1568,
+  -1904, 452, 230, 330, -696, 590, -888, 384, -1254, 192, 590, 1092, 0, -524, 864, -212,
+  749, -1353, 420, -707, -2704, 900, -2300, 411, -3213, -1695, -102, 133, -990, 2176, -204, -1808,
+  1573, 3875, 1440, -378, -236, -600, 696, -366, -2080, 0, 297, 1380, -1638, -945, 123, -777,
+  1215, -522, 147, 1498, -254, -291, 2919, -276, -666, 218, 828, -913, 1397, 972, -774, 1176,
+  -2584, -678, -575, -770, 2552, -2596, -888, -576, -2964, -576, 2124, -273, -520, 524, -1152, -424,
+  -535, 984, 1050, -101, -3211, 1400, -100, -411, -1428, -1469, -306, 2128, -792, -2432, -2652, 678,
+  1859, -1000, -192, 1134, -1298, -1050, 928, -1830, -1768, -840, -1683, -230, -1456, 4995, -246, -666,
+  0, -522, 1176, -1819, 1651, -1067, 973, -368, 111, 1090, -690, 83, -1778, 1620, 129, 784,
+  816, -2825, -230, 1100, -1972, -708, 2368, 1344, 798, -384, 826, 1001, 2912, 1703, 2784, -2332,
+  1284, 984, -630, 202, -338, -500, -400, -548, 1190, -226, -2346, 1729, -1980, -512, -612, 2147,
+  1716, -1000, 96, 2898, -1062, 1200, -1160, -854, -416, -480, 1188, -345, 273, -405, 369, 222,
+  -540, -783, -1470, 642, 1016, -582, -139, 1840, -1221, 1635, 138, -2158, -2032, -108, 387, -1470,
+  1224, 904, 575, 330, -348, -1062, 444, 0, -570, 864, 0, -273, 0, -393, 192, 0,
+  428, 4305, -1890, 505, 1014, -2600, -2600, 959, -714, -1808, 204, -1330, -1485, 640, -408, 1582,
+  -4004, -2500, -672, 1512, -2242, -675, -1740, -1464, -104, -1560, -1089, 805, 1092, -1080, -1968, -1554,
+  -1350, 1305, -1323, -1391, -1270, -485, -2641, 828, -999, -5341, 3312, -747, -1524, -2160, -4386, 1176,
+  1768, -1808, 920, 2200, -1392, 1534, 592, 768, 0, -2208, -2242, 364, -2184, -393, 0, 318,
+  1712, 123, 1575, 404, -1521, 1400, -500, 137, 238, 1921, -510, -532, -198, 0, -918, 791,
+  -286, 1875, -768, -1008, -472, -1725, -348, 3050, -1352, 960, 99, -2415, -1183, -1755, 738, 2886,
+  -135, 0, -4410, -1819, 2032, 679, 0, -644, 111, -327, -3036, -1328, -1905, 1404, -774, 98,
+  -1224, -565, -1035, 110, 1508, -1062, 2072, 1824, -912, 288, 1534, 182, -1352, 1441, -480, 2226,
+  -1819, -984, -630, -1313, -3380, 1700, 300, -1781, 0, -452, -1938, -399, -1881, -2432, 204, -2486,
+  1287, 750, -672, 126, -2360, -150, -1160, -1830, -520, -1680, -693, -2760, -91, -945, 615, -1776,
+  0, -2262, -588, -1070, -1016, -291, 834, -1104, -444, -1308, -1518, -913, 254, -1188, 1548, 490,
+  1224, 1582, -1150, 220, -1624, -1888, -444, -672, 114, 2400, -944, -1365, 104, 262, 576, -530,
+  -2140, -861, 3990, -1818, 2197, 800, 2600, -1918, 714, 4294, 1836, -4522, 792, -2560, -102, -3164,
+  -1144, -625, 1920, -2268, -472, 0, 2784, 122, -2496, 1200, 1089, -3220, -819, 405, 369, -888,
+  -135, -783, -6027, -1177, 1143, -679, 1668, -184, 777, 3052, -2622, -1494, -1524, -216, -3354, -294,
+  0, -1808, -5635, 1760, 2204, 1652, 148, -1440, 3876, -2112, 4012, 637, 936, 131, -2208, 4134,
+  -2461, -4182, -1470, -505, 0, 200, 2600, -3425, -1190, -1921, 612, 1463, 1287, -896, 102, -339,
+  -858, 750, 288, -2142, 472, 75, -2204, -610, 0, 120, 990, 115, 364, 2160, -984, 999,
+  -270, -1479, 1911, -428, 1778, -2134, 1112, 92, 1776, -981, 414, -913, 2413, -756, -1290, -2352,
+  2312, -678, 920, -1320, -1276, 1888, 2220, 384, 684, -1344, 2124, -1183, -416, 1179, 0, -1590,
+  -1498, -1230, -1260, -101, -1014, 2800, 100, 411, -357, -1582, -1326, -2660, 0, 3584, 204, -339,
+  429, -250, 288, -252, 2478, 900, -2436, -1220, 936, 1320, 1980, 575, -364, -405, -738, 1110,
+  -810, 609, -1764, -428, 1651, 194, 834, -92, 1332, -2071, -1242, 415, 635, -756, -1290, -588,
+  -2176, -904, -920, -880, 0, 2242, 592, -1344, -570, 1344, -472, -455, 0, -2358, 1536, -1166,
+  -642, 123, 945, 606, -2028, -300, 1700, 274, -119, 565, -204, -3059, -594, 1024, -1224, 0,
+  858, -500, 1248, 0, -2360, -900, 580, 1586, -832, 360, -99, -230, 1365, -675, -984, -1110,
+  2295, -957, 294, -428, 3175, -388, -2085, -460, -222, 1417, -1242, -83, -1778, -1188, 1548, -784,
+  408, 678, -1265, -1870, -232, -354, -592, -960, 1368, -192, -1298, 455, 208, -2096, -192, 0,
+  963, -615, 0, -1111, -1859, 800, -900, -959, -1547, 678, -612, 266, 297, -640, -510, -113,
+  -1430, -250, -1056, -1638, -1888, -675, 1392, 976, 1976, -360, -891, 805, 0, -675, 1353, -777,
+  540, 435, -735, 2140, 1651, -582, 3197, -644, 777, -872, 1518, -166, -1270, -972, 2193, -588,
+  3536, -339, -1150, -2200, 348, -944, 740, -288, 342, -1248, -2006, 182, -1040, -1834, -1152, -1060,
+  856, 0, 210, -505, -1859, 900, -400, 548, 0, -2486, -1734, -1463, -1287, -1280, -510, 1243,
+  -286, -1125, -768, 0, -1888, -450, -928, -1586, -1040, -1680, 1881, -1610, 2184, 945, -1107, -888,
+  -1890, -522, 147, 107, -889, 194, -417, 1104, 1332, 1090, -138, 249, -2667, -2376, 258, -588,
+  1088, -1582, -1495, -1320, -812, 944, -296, 1536, -2166, 672, -1416, 1001, 832, -262, 1056, -848,
+  1712, 0, -945, 909, -2366, 400, -3800, -137, 119, 1695, 612, -931, -2475, -1024, 1632, -2034,
+  -2288, -875, 1824, 1134, -354, -525, -1392, -2196, -1664, 1320, 792, -1495, 2639, -1485, 615, -555,
+  -1890, -348, 2352, 1605, -635, -1843, -3336, 1288, 1554, -2180, 1518, 1162, -1524, -4536, -774, -1666,
+  -4760, -1469, 2645, -110, 3712, 1888, 4440, 288, -3078, -96, 590, 1001, -2184, 1441, -96, -1272,
+  -321, -246, 1155, 0, 676, 2100, -800, 137, -2023, -565, -3366, 1995, -891, -384, -1122, -226,
+  -572, -500, -1536, -1386, -944, -600, 1508, 366, -1040, 480, -396, -920, -1365, -135, -738, 222,
+  1350, -870, 294, -963, 1651, 1649, -4170, -1288, 444, -1199, -2484, -249, -2921, 324, 1161, 294,
+  -816, 1017, 345, 770, -1276, -1416, 296, 2400, -1824, -864, 354, -1729, 624, 1703, 672, 106,
+  1070, -2214, -1680, 303, 3042, 1300, -800, 685, -833, -339, -816, 133, -396, 2432, -918, -2260,
+  1716, 750, -1440, -1260, -236, 600, -1392, -610, -104, 3000, -1683, 575, 1547, 945, 369, -1332,
+  -2160, -870, -5439, 535, 635, -873, 973, -184, -1221, -1417, -966, -1245, -1270, -1188, -1935, -882,
+  1496, -113, -805, -770, -812, 2596, -444, 576, 228, -384, 2006, -273, -2080, -1703, 1248, 1272,
+  428, -1845, -315, 606, 1521, 400, -500, 959, 2499, -1017, -102, 1596, 396, 2304, 102, -791,
+  1144, 2500, 0, 252, 472, 1350, -3364, 0, 1040, 720, 990, 0, 1638, 270, 615, 888,
+  -1080, 783, 3381, 749, -762, -1261, -1946, -460, 222, -763, 1794, 1328, 2286, 432, 903, 1862,
+  -1088, 226, -575, 1650, -1624, -2006, 740, 480, -114, 1632, -708, -1001, 0, -1441, 1824, 954,
+  -428, -369, -840, -1111, -1014, 2700, -1200, -1781, -2380, -791, -408, -1330, -792, -1024, 714, 678,
+  -429, 0, -1248, 1134, 0, 75, -2204, -244, -2288, 480, 198, -1725, -728, -540, -123, -1443,
+  -1485, -783, 1617, -107, 3048, -970, -417, -1472, 777, 1744, 0, 0, 508, 324, -645, 980,
+  -952, 0, 460, 880, 580, -2242, -148, -2496, 0, 192, 2006, -2548, 104, -655, 2112, 106,
+  -428, 123, -1680, 404, 0, 600, 1300, 2466, 833, 904, -2448, -266, -1683, -1280, 102, 678,
+  1144, -125, 1056, -630, -236, -675, 348, -1586, -520, 240, 693, -1380, -1001, 270, -1107, -333,
+  675, -174, 0, 428, 2159, 194, 0, 920, -111, 1962, -690, 1411, -508, -216, 129, 980,
+  -136, -678, 1150, 440, -696, -3540, -592, -192, -570, 1536, -1180, 0, -832, 1441, -384, -1590,
+  0, -1230, 525, 404, 1690, -800, 800, 411, -238, -678, 408, -931, -693, 1024, -204, 1356,
+  -1001, 3625, -1440, 1890, -1180, 750, 1160, -1098, -1560, 960, -99, -345, -182, 540, -984, 333,
+  135, 435, -1176, -1712, 508, -1164, -1529, -644, 111, -654, 2346, -581, 381, -324, 1161, 98,
+  0, -1130, 0, -550, 348, -1416, 444, 0, 798, -384, -1652, -1092, 624, 1179, 1536, 636,
+  -1391, 246, 1155, 0, -1352, 1300, -100, -959, -476, -904, -510, 2793, 2277, -2560, 2244, 226,
+  -1430, 125, 1248, -1134, -1062, -375, -1740, 1098, 1560, -720, 693, 1035, -1274, 1215, 615, -1443,
+  0, -174, 588, 214, -381, 0, 973, 184, -1443, 1090, 1104, -747, -889, 756, 516, -392,
+  -1768, -565, 1725, -660, 1972, -236, -592, 0, 2166, -960, 708, -182, -208, -524, 864, 0,
+  3210, -1968, -210, 1212, -1352, 1100, -900, 2055, -238, -339, 714, 266, 1188, -1024, -408, -452,
+  1859, 4000, -192, -504, 118, -450, -696, -976, -416, 840, -2970, 460, 637, -2295, -2460, 111,
+  405, -957, 294, 1498, -508, 291, -556, -92, -1998, -1199, -1932, 83, -1016, -648, 1032, 196,
+  -136, -452, 460, -2310, 928, -3304, 1036, -576, -342, 192, -1652, 182, -416, 524, 864, -1060,
+  -1177, -1968, -105, -303, 2704, 600, 2500, 1644, 1190, 226, 102, -1330, -1089, -1024, -3876, -1017,
+  1001, 2500, -384, 1260, -236, 750, 2204, 488, -936, -240, -2970, -2415, -1729, -1215, -246, -555,
+  -135, -261, -1617, 749, -889, -1455, 0, 1012, 1998, 218, -1794, -1245, 1143, -2808, -1032, 1960,
+  -544, -2486, 1150, 330, 580, -1416, -3108, -2208, 1710, -288, 2360, 1183, 624, 917, -1152, -106,
+  642, -984, -1155, 1313, 676, 1500, -300, -411, -476, 1582, 1938, -2128, -99, 2432, 714, -2147,
+  -572, 625, 0, -2142, 0, -225, 1392, 244, -1352, 840, 1089, -575, -273, -675, 492, -1998,
+  -270, 87, 1029, 963, -2921, -582, -139, -1656, 555, -2289, -414, -415, -889, 432, 387, -3234,
+  408, 1469, 690, -1760, -812, 236, 1184, 96, -114, -576, -826, -273, -312, -1179, 288, -318,
+  107, 1230, -1470, 1111, 2704, -700, 100, 274, 1071, -1695, -1020, -931, 1584, -1280, 714, 904,
+  1287, 250, -384, -1890, -118, -1050, 1624, -1952, -1248, -1080, -891, -460, -1638, 1620, -1353, 666,
+  2700, -870, 147, 535, -508, -1164, -139, -276, -1221, -436, -3036, 415, -1651, 1404, -645, -686,
+  -1224, 904, -115, 330, -2088, -2006, -1036, 1056, 0, -192, -236, -1274, -312, 131, -1248, -318,
+  -749, 2214, 2835, -1313, 845, -1100, 300, 2740, 0, -1017, 918, -1596, -396, -2560, -2142, -226,
+  3575, -1500, -672, 2898, -944, -1875, 1276, 1586, 416, 0, -990, -115, 91, -1080, 369, 3108,
+  -810, -348, -294, -107, -1905, -3395, -1807, -1656, -2886, 1308, 414, -1162, 1270, -1188, 258, -784,
+  1904, -1017, -345, -990, -3944, 0, -2960, 0, -2850, -1056, -1180, -1001, -728, -2620, -576, 424,
+  1926, -369, -1680, 404, 676, -1200, 100, -1096, 476, -1243, -1020, 2527, -396, 2944, 1632, -1921,
+  1573, -1500, -384, -1260, 354, -825, -580, -1708, -728, -1440, -1485, -230, -546, -810, -615, 3219,
+  1215, 348, 3969, -2140, -1778, -1067, -973, 736, 1221, 763, -828, 664, -254, 1836, -1290, -882,
+  -952, -1243, 0, 2530, -1160, -1416, -1480, -192, -456, 960, -2596, 182, 104, 2620, -768, -212,
+  -214, 1353, 945, -707, 3211, -300, -1500, -548, 952, 1356, -1326, 0, 495, 1024, -306, 565,
+  858, -875, 768, -1386, -354, -1275, -1972, 488, 0, -120, 396, -230, -728, -405, -3321, 222,
+  2700, 696, -294, 428, -254, -873, -417, 0, 555, -109, 1518, 166, 1016, -864, 1032, 0,
+  -1768, 0, 1035, -110, -1392, 354, 1480, 768, 114, 864, -354, -91, 1248, 393, -1056, -212,
+  -214, -1353, -2520, -808, 338, 800, -600, -1507, -1547, 904, -204, 0, -1188, -896, -1836, 1130,
+  1859, -250, -288, -1890, 354, -1800, -696, -976, -2184, 1680, 297, -345, 1820, 270, -1476, 777,
+  -1215, -174, -735, 428, -508, -2037, 1251, 184, 999, 0, -690, 83, 889, 1944, -2838, -2156,
+  2992, -1695, -805, 440, 1392, 1180, 2072, 384, 1254, -96, 236, 91, 104, 262, -1536, -1590,
+  1177, -2091, 0, -1212, 2704, -100, -800, 411, -357, 339, 1734, -133, -297, 128, 816, -565,
+  2145, 1000, 288, 126, -354, -975, 812, 976, -2184, 1200, 1188, 460, -1365, -135, 984, 1554,
+  -810, 1044, 294, 963, -2540, 291, -973, -460, -555, -1526, -1932, -830, -127, 648, -774, -1666,
+  952, -1130, -690, -110, 1624, -118, -2664, -480, -1140, 0, 1298, -91, -1248, -1048, -192, -318,
+  -1284, 2952, -735, 0, 2366, 0, 500, 411, -1785, -113, -306, 1330, -198, -896, 612, -1243,
+  1573, 250, 288, -1008, -1534, -825, -928, 488, -1248, 2640, 1584, -2530, -364, 1215, 615, 1998,
+  1755, -174, 1470, 428, -1270, -776, 695, -92, -2553, -2180, 1932, -2158, -1143, -1728, 0, -980,
+  1632, 1130, -1725, 770, -2204, -826, 592, -384, -2508, 0, 1298, 182, 104, 655, 384, -636,
+  535, -246, -2100, -3737, 2704, 1000, 1400, -1644, -2261, -904, -2856, 2128, 495, 768, -2142, -1469,
+  -143, -125, 1440, -3780, 2950, -375, 2204, 2196, 832, -600, -1287, -1265, -1365, -2430, -2952, -666,
+  -405, -696, 1323, -535, 381, 1746, 1807, -2392, -5328, 1199, -4002, -581, 2159, 1836, 1419, 196,
+  -1632, 2147, -1035, -770, -1972, -2360, -1628, -576, -3990, -384, -1062, -910, -208, 1572, -96, -2650,
+  1819, -123, 735, -202, -3549, -2000, -700, -411, 952, 1695, 510, -1330, -1980, 0, -918, 339,
+  1573, 1125, 192, -630, -590, -450, -928, -122, -1456, 1800, -495, -920, -728, -270, 738, 666,
+  -2160, -1653, -1617, -321, 1016, -388, -139, 1656, 1110, -2180, -1518, 83, -381, -1728, 1290, -98,
+  -408, 904, 0, -660, 928, 1534, -1332, 2112, -342, 2400, -472, -273, -520, -1179, -1344, -318,
+  -428, 1968, -210, -404, 4563, -600, 300, 685, -952, 565, 1122, -532, 198, -1280, -102, -113,
+  1144, 1375, -384, -2646, 118, 0, -1508, 1342, 208, 600, 1188, -1380, -1729, 405, -1230, 666,
+  1350, -783, 441, -107, 1270, -1261, 1112, 644, 666, -872, -690, -498, -381, -972, -1935, -1764,
+  -1360, -1243, 575, -440, 1392, -472, -1776, -1344, -228, -384, 2950, -2275, -1144, -1441, -864, -848,
+  -2033, 1107, -630, 1919, 2028, 900, -2000, 1233, 595, 2712, -102, -1463, -2475, -512, 0, -1243,
+  2574, 625, -384, -1512, -1888, -1650, -232, 2806, -936, 840, 99, -115, -182, 1080, 3321, 444,
+  0, -435, 1029, -214, -1270, 582, -695, -1012, 1221, 872, -4140, 249, -381, -864, -903, -1568,
+  -136, -1017, -2760, -1100, -1392, 1062, -1184, 384, 0, 1440, 708, 910, -832, -2489, 0, 3604,
+  2247, -2583, -525, -505, 0, 600, -900, 2329, 833, 565, -1428, 1330, -2277, -256, 612, -565,
+  1001, 2125, 1824, 1386, 354, -750, -116, 610, -728, 1200, 1485, 690, -182, -675, 1107, 999,
+  -4050, -174, -2793, 1605, 381, -1358, 1807, 368, 1998, -109, 1242, -664, -1651, 432, 645, 294,
+  -4352, -1356, 115, 220, -3480, 590, 444, -192, -456, 2304, -1180, -182, -1144, -131, -576, 1908,
+  535, 246, 105, -1010, -1014, 100, 600, -137, 1190, 1130, 0, -931, -1188, 384, 306, -1469,
+  -2574, -250, 768, -2520, 236, 525, 812, 976, -936, -120, 1089, -115, -1092, -810, 369, -1110,
+  -675, -783, -3822, 1391, -381, 582, 695, 368, -444, 218, -1380, 664, -1016, 432, 645, -1078,
+  2176, -113, 1150, -110, -1392, -118, -888, 384, -1026, 960, -590, 364, -1768, 655, -576, 318,
+  -1284, -369, -630, 2323, -338, -600, -500, 274, 595, -339, -102, -1197, -990, -2816, -1224, -339,
+  -143, 125, 192, -1638, 354, -600, 116, -854, -1144, -1680, -693, -115, 273, -945, 492, 666,
+  -945, 522, -1176, -535, 889, 970, -973, -2024, 1998, -1417, 1518, -830, 0, -864, -1290, -392,
+  2448, 113, 575, -550, 580, 118, -2072, 1536, -684, -1056, -2242, -819, -520, -1441, -2400, 1696,
+  -2354, -123, 1260, -101, 676, -800, 0, 0, 833, 1017, 918, -931, 1287, 768, 714, -226,
+  3003, 1500, 672, -1008, 118, -1500, 1972, 1708, -520, 1320, -1287, -1725, -819, 1620, 861, -777,
+  -810, -1479, -2058, -214, -1270, -2231, -1668, 1104, -999, -218, 966, -664, -254, -864, -774, -2450,
+  -680, -2260, 920, -1320, 580, -590, 1036, 0, 228, 0, 236, 91, -208, -2096, -864, -318,
+  749, -861, -1365, -1515, -169, 200, 2200, -1918, -1428, 1243, -1224, 133, 99, -768, 510, -3051,
+  -1430, -1375, -1920, -1008, 1416, -600, 1740, -1098, -2496, 480, -297, -1495, 273, 1350, -861, 111,
+  405, 87, 1176, -2461, -762, -291, -1946, 92, -999, 981, -2484, -581, -1905, 3348, 258, 1666,
+  -136, -226, -115, -770, -928, -118, -148, -3072, 114, 96, 1298, -1820, 0, 786, -192, 106,
+  -1926, -123, -1575, -101, 507, 1500, -900, 1370, -238, -2034, -3876, 4921, -99, -896, -612, -3616,
+  2574, 125, -4704, -2016, -3304, 225, -3596, -5246, -2912, -600, 1089, -575, -182, 4725, -738, 999,
+  270, 1566, 4116, -1284, -3429, -873, 0, -552, 2331, -4687, 276, -166, 762, -1836, -1290, -1470,
+  -136, -3164, -1840, 330, -3016, 3304, -1036, 768, -1140, 1440, -354, 182, -728, 917, 864, 1272,
+  -642, -4059, 1470, 808, -845, 500, 200, 548, 1071, -113, -1122, 1064, -891, -1536, 204, -1695,
+  -429, -750, -1440, -252, 826, -1200, 464, -244, -520, 1560, -297, -575, 364, 0, 2091, 444,
+  2295, 435, 294, 1819, -889, -388, -1112, -184, 1110, -1526, -2484, -498, -1778, -324, -387, -588,
+  -1904, 678, -230, 880, -1160, 826, -1036, -1152, -456, 480, -590, -364, -624, 786, -1152, 1060,
+  856, -246, -210, 909, 338, 1200, 0, 1507, 2856, -1582, 1020, -133, -891, -1536, 1938, -1017,
+  -2860, 2250, -1536, -1890, -1416, -975, 696, -610, 0, -1680, -495, -1725, -1729, 2430, 615, 444,
+  3105, -174, -294, 1498, 635, -1067, -1112, -2024, 555, -2071, 138, -498, 508, -216, 129, 490,
+  -2448, 1130, -345, -2640, -1508, -1416, -1036, 672, -912, -192, 1652, -546, -936, 786, -384, -848,
+  -642, 1599, 1050, -1111, -169, -700, -400, -1644, -1309, 2599, 1530, -798, 891, -1664, 1530, -1017,
+  -715, -1875, -960, -2142, 708, -150, 1740, -1586, -208, -600, -1881, 0, -1092, 2970, 369, -1110,
+  540, 1305, -294, -2247, -381, 3492, 834, -460, -1443, 3161, -2208, -664, -762, 756, 1032, -588,
+  1904, 4520, 1265, 110, 1392, 1770, -740, 1440, -1368, -1536, 1180, -182, -1248, -262, 1152, 1484,
+  428, -984, -2940, -505, 0, -1900, -300, -2466, -2380, 1017, -2346, 1064, -2871, 0, -1734, 565,
+  286, -1000, 1056, 252, 1298, -675, 812, -854, -3016, 120, 297, 2875, 1274, 810, -3198, -1776,
+  945, -609, -2940, 1498, 1651, -388, -1668, 276, 333, 545, 690, -664, -2286, -1296, -2064, -882,
+  1224, -113, 115, 1870, -928, -354, 888, 384, -1824, -480, 826, -182, -1976, 0, -288, -318,
+  -107, -246, -945, 101, -507, 1900, 500, 137, 119, -452, -408, -532, -1287, 512, -306, -791,
+  -858, 1000, -384, 630, -354, -75, 0, 610, -1560, 360, -495, 1610, 910, -1350, -492, 444,
+  -2025, -1305, -294, 642, 1524, 0, -1529, -644, 333, -981, 414, -1577, -762, 1188, 0, -1078,
+  2176, -1469, -690, 1430, 1392, 1298, -296, -864, -1710, 384, 118, -819, -1768, 1572, 96, 106,
+  -1498, -369, 525, -808, -845, 300, 1100, 959, 476, -565, 204, 1995, 396, 384, 0, 1808,
+  858, 875, 96, -2646, -472, -1425, -1508, 2440, -1352, 720, -2079, 1035, 1092, 1620, -738, -1110,
+  540, -2523, -294, 642, 1397, 388, 1390, -1380, -111, -218, -414, -1079, 508, 0, 258, 196,
+  -680, 452, 575, 0, 696, -708, 1036, -672, 456, -1440, -236, -273, -1040, -393, -1440, -318,
+  -856, 123, 735, -1010, -845, 100, -1700, -959, 357, 1243, -1326, 1197, -396, -384, 714, 0,
+  1716, -1500, -768, -1008, -590, -150, 1160, 2074, -728, 0, 792, 115, -273, 1755, 615, -999,
+  -405, -609, 735, 107, 0, 291, -1529, 1104, 666, 654, -552, 498, -1524, -1296, 645, -1568,
+  1224, -565, 2875, -330, -1740, -118, -592, -1920, -570, 384, -1298, -1092, 104, -2751, -192, 1378,
+  -856, 1353, -840, -606, 2704, -1400, -400, 822, 714, 1582, -102, 532, 1287, 256, -1836, -904,
+  572, -875, -768, 1386, 0, -675, 812, 976, -1456, 120, -1188, 690, 182, -270, 369, -111,
+  0, -435, 1176, -428, 381, 291, -2085, 184, -111, 1090, -690, -1494, 1016, 648, -1032, 490,
+  272, -1017, 230, -770, 232, 118, -1480, -480, -912, -1536, 472, -364, -936, -524, -288, -742,
+  -535, -2583, -1155, 1010, 1352, -900, -3400, -1370, -1904, -2147, -1122, 3325, -3762, -2944, 3468, -678,
+  2431, -1125, -1440, -1386, -3776, -150, 348, -3904, -1872, 600, 1386, -2530, 910, -1755, -2952, -222,
+  -540, 348, 1470, -642, 1778, -291, 2224, -1012, 2220, -6976, 1656, 830, -3810, -756, -1419, -1274,
+  -680, -2825, -1610, 550, -3132, 1770, 1332, 3648, 0, 2400, 0, 1183, -104, 3537, 0, 2014,
+  -856, -1845, -1995, 1111, -3887, 1600, -900, 1370, 357, -339, -918, 931, -1188, -2176, 612, -113,
+  2717, 1375, -1824, 1008, 1298, -2775, -464, 2440, -312, 2760, 99, -1495, -2275, 2025, 6150, 666,
+  -270, -609, 294, 2247, -2286, 194, -2780, -1104, 2886, -1090, 414, -1909, -508, 1620, -387, -1078,
+  -136, 1017, -460, -2860, 1392, 354, -888, 384, 1026, 672, 1888, -364, -1768, 131, -96, 742,
+  1070, 1476, -1050, -505, 1352, 300, -700, 1918, -2261, 339, -1122, 266, -198, 896, -1428, -1130,
+  -715, -1250, -384, 3402, -1180, 525, -116, -1830, -104, -840, -396, 920, 273, 0, 615, -333,
+  -270, 261, 588, -2140, 127, -485, 2224, -828, -333, 0, 2622, 0, -1524, 756, 0, -196,
+  2176, 1130, -575, 1760, 464, -472, 1924, 576, -1026, -576, 0, 637, -208, -1048, -768, -1272,
+  -642, -615, 840, -2929, 2366, -400, 1000, -274, -238, 2373, -1530, 665, -891, -1152, 2958, -3051,
+  715, -2375, -768, -3402, -2832, 600, 348, -1098, -2080, 0, -990, 575, -910, 1620, -1599, -4107,
+  405, -957, -2793, -2033, 254, 2328, 1668, -644, -222, 1199, -2070, -83, -889, -216, -516, -196,
+  2312, 1017, -2875, 1870, -1392, 1298, 1332, 192, 2508, -1152, 2714, -1183, -208, -1572, 1248, -318,
+  -535, -1476, -735, -505, 3211, -200, 1000, -2740, -1785, 113, -1122, 1197, -2376, -1408, -408, 0,
+  4862, 1000, -1632, 0, 1534, 0, -1044, -2440, -3432, 2760, -297, 920, -1274, 135, -1230, -444,
+  -270, 522, 147, 0, 381, 1552, 973, -460, 666, 1308, 2898, 83, 381, -972, -1161, -980,
+  816, 2147, 2760, 2750, 232, -1062, 1184, -1440, 342, 192, 236, -2275, 1144, 1310, 288, -1272,
+  3959, -2583, -630, 1111, 1521, 400, -2300, -822, 714, -678, -1224, 532, -1089, -640, 0, -1808,
+  2002, 1125, 288, -504, -590, -1575, -928, 488, -1872, 600, -990, -1380, 182, 1485, 1353, 1221,
+  1215, 1131, -2646, 535, -2159, 0, -1112, -460, 2442, -2834, -690, 166, 1143, 1836, -387, 882,
+  -1768, 452, 345, -2200, -348, -944, 592, 384, 684, -96, 0, 819, 1144, 1441, -1728, 2014,
+  107, -615, 1995, -606, 1352, 900, -1100, 1644, -476, 113, 0, 1862, -693, 256, 612, -1017,
+  -286, -375, 384, -1764, 0, -600, 1044, 976, 104, 480, 495, -1380, -1365, 1890, 1230, 666,
+  1890, 174, 3528, 642, 1016, -1358, -417, -184, 1443, -218, -2070, -747, -889, -432, -1419, 392,
+  -1360, -1130, 1150, -1540, -3364, -472, -2220, -480, 1140, 768, 1298, -637, -2288, -2096, -1248, 1060,
+  2568, -2583, -1365, 808, 1521, -1400, -800, -685, -2618, -565, -1020, -532, 198, 3968, -714, -226,
+  -286, 0, 768, 2520, 1180, -1650, 0, -610, -520, 1800, 0, -1840, -273, 1080, 0, 111,
+  -540, 87, -588, -1712, 254, 970, 834, -552, 444, 763, -690, 913, 508, 1188, 129, 196,
+  -408, 113, -230, 660, -1392, -2596, 2072, -288, -228, 1152, 1416, -182, -1352, -524, 576, -1166,
+  428, -1230, -735, -2525, 169, -1400, -600, -2329, -2856, 1695, 102, -1330, 1287, 0, -408, -565,
+  -2002, -1125, 672, 126, -826, 900, 812, 244, -520, 0, 1287, -345, 0, -1755, 492, 0,
+  -1755, -1044, -147, 856, 381, -776, 2780, 1196, 0, 327, -1104, -1328, 0, -216, 1419, -1470,
+  3264, -2034, 460, 660, -1740, -2242, -2072, -960, 1026, -2688, 236, -1456, 208, 655, 0, -530,
+  -321, -2091, -1995, -4545, -2028, -400, -900, -2603, -2380, -1808, -4284, 2793, 1584, -384, -612, -2486,
+  1859, -3000, 2112, 2016, 354, 75, -696, -1098, 936, -2280, 198, 2875, -1092, 405, 861, -1998,
+  -270, -1305, 2646, -107, 2413, 1261, 1807, -1012, -1887, -1744, -1104, 332, 0, 540, 903, 196,
+  2720, 565, -2530, -2640, -2784, 1062, -1480, -1440, 2280, -384, -472, -1092, -208, -1310, 2976, -2120,
+  2140, -123, -3675, -1717, -1352, -2000, -1000, -1370, 1309, -2486, -306, -931, 198, 1920, -1428, -904,
+  1430, -125, 1152, 756, 826, 0, -2784, -610, -104, 240, 2079, -690, -182, 810, -2091, -333,
+  -2565, 435, 441, 2461, 2921, -97, 0, -1840, 1443, -2398, 1794, -1162, -2032, -2160, 645, 980,
+  1224, -1356, -460, 1760, -696, -1180, -1332, -960, -114, 1248, -590, -2366, -1456, -3930, 1536, 0,
+  -1177, 1599, -2520, -2323, 1183, 700, -1700, -548, -1547, 565, 102, -266, -396, -1280, -1224, 678,
+  143, 3125, -480, 0, -236, 1350, -1740, 1220, -520, 1200, 693, -575, 455, 1620, 369, -1443,
+  135, 1914, 441, -1605, 1524, -485, 973, -1472, 444, -109, 1794, -1743, 1651, -972, 258, 784,
+  2448, -2599, -1380, -1210, 580, -1180, -1628, -864, 1368, -1344, -354, 455, 936, 655, -1440, -1378,
+  -1284, -2091, -2205, -606, 3042, 800, 400, 137, 595, -1017, -102, -1729, -1782, -1024, 1428, -113,
+  2288, -1750, -192, 1764, 0, 75, -928, -1098, -1560, -480, 693, 920, -2548, 2430, 0, 111,
+  2970, 87, -441, -2461, 762, 0, -2641, -184, 999, -218, -1932, 332, 127, 972, -774, -294,
+  0, -791, -690, 990, -696, 2124, 148, 96, -1254, -672, -1534, -364, 1144, 131, -1536, 1484,
+  -428, -984, 2205, -707, -3549, 1000, -500, 959, -714, 678, -1224, 1862, 693, 0, 1938, -2373,
+  3289, -375, -384, 378, 1062, -525, -116, 1342, -624, -600, 990, -1840, 364, 2295, 1476, 666,
+  2295, -1305, 588, -1498, 2413, -485, -1529, -644, 1665, -981, -2898, -166, -381, 864, -1290, -1470,
+  2448, -339, 1150, -550, -928, 0, 592, 576, 1938, 384, -118, -91, -2184, -131, 288, 1696,
+  749, -1599, -1155, 303, -1014, -1300, -500, -411, -1071, 791, 204, 532, -891, -1920, 1530, 0,
+  -858, -500, 960, -504, -1534, 900, -1856, 1464, -832, 840, 1386, 575, 1547, -1080, -615, -111,
+  -540, -1914, -2499, 642, 762, -1649, 1807, 368, -1110, -1526, 138, -83, 381, -756, 129, -1764,
+  -544, -339, -2185, -550, -1392, 590, 1480, 2304, -456, 288, 0, -364, -624, -262, -288, 318,
+  -1284, 123, 1155, 1111, -845, -100, 1200, -1644, -1547, 1808, -204, 1064, 1782, -512, 204, -791,
+  -715, 125, -1920, 0, -1770, -825, 580, 3782, 416, -240, 1188, -1265, 0, 945, -1107, -2109,
+  -675, -1218, -3969, 321, 1778, 194, 417, -552, 0, -327, 1242, 166, 1397, -864, -1290, -784,
+  -1496, 1808, 1150, -220, -348, 708, 3256, 288, -342, -1440, -236, 546, 312, -262, 192, -106,
+  1391, -369, 105, -1212, 507, -1300, 500, 822, 833, -1130, -408, -798, -990, -128, 102, 226,
+  1001, -1125, -672, -1008, 1888, -600, -348, 1708, -1248, 600, -396, -575, 1092, 1485, 1599, 333,
+  -810, -1044, 1323, 535, 1270, 776, -973, -2300, 2220, 545, 0, 249, -2286, 1404, 1290, -882,
+  -680, 904, -345, -1430, 0, -1062, -296, -1344, -798, 576, -1062, -182, 728, -1048, -3168, -636,
+  -963, 984, 1995, 101, 3718, -1300, -100, 411, 476, 1130, 204, 399, 198, -2176, 1938, -4407,
+  -143, 2000, -1824, -1008, -1888, -2550, -1044, -122, 520, 2040, 396, -2530, -1001, 810, 1230, 1332,
+  1485, -87, -2646, -856, -889, -291, -1807, 552, -2109, 0, -966, -913, 0, 756, -2967, 392,
+  -1088, 565, 460, -1430, 0, 236, -1628, -2112, -2622, -864, -236, 91, -520, -2751, -480, -2226,
+  1819, 246, -630, 1212, 3887, -200, 0, -685, -2856, -2260, -3060, -665, -1287, 256, 1530, -1017,
+  -858, 625, 0, -3654, 944, 300, 2784, -2440, 0, -240, -4059, -1380, 0, 675, 1230, 1332,
+  1485, 2088, 1029, -2247, 762, 291, 2224, -368, 333, -1308, 828, 1245, -4064, 1512, 645, -1078,
+  -952, 1017, 3910, 1320, -2900, 118, -2072, 2496, -684, 1056, -354, -910, 1144, 3144, -480, 848,
+  -1177, -1476, 315, 808, -1183, 1700, -200, -1644, 1666, 113, -2448, -3192, 891, 384, 1122, -1695,
+  1430, -1250, -672, -882, 236, -675, 1392, -2928, -624, 1920, 1584, -345, 182, -1080, 1476, -999,
+  135, 261, 1029, 749, -2540, 194, -2919, 92, 1887, 436, -1518, 249, 0, 108, -1290, -980,
+  -1496, 1695, 920, -770, -1624, -472, -444, 672, -1026, 768, -236, 910, 520, -655, -576, -106,
+  0, -1230, -105, -808, -507, -2200, 700, 548, -2142, -1582, -510, -2660, 1188, 768, 408, 678,
+  -3432, 1250, -1440, 756, 1062, -300, -1508, -488, -416, -1320, 495, -345, -728, -675, -1476, 1998,
+  -540, 696, 0, 0, -1143, -2328, 1390, -552, -666, 0, 1656, 415, -1778, 1296, 774, 980,
+  816, -2938, -1035, -660, -232, -118, 2960, -288, -342, -672, 354, -182, 312, -2227, -1536, -1484,
+  -642, 2706, 1995, 404, -4901, 900, -500, 1096, 1309, -2599, 204, -532, 2178, -640, -918, -2147,
+  286, -500, -1152, 0, -708, -225, -1044, -1464, 1768, -120, -693, 1380, 364, 1080, 123, -333,
+  -945, -435, -1029, 856, 254, -194, 0, -1012, 2109, 545, 138, -1992, 1905, -108, -2064, -1372,
+  1224, -2034, 690, 220, -1160, 354, 1480, 960, -456, -1248, 118, 728, -2600, -5371, 2304, 0,
+  -1605, -492, -630, 404, 507, 100, -300, 1233, 1190, 226, -204, -931, -1584, -128, 1224, -226,
+  429, -125, -384, -126, 472, -525, -812, 732, -624, 2040, 99, -920, -1638, -1890, -2091, 333,
+  0, 957, -588, 749, -2032, 1261, 278, 368, 111, 1199, 690, 581, -2159, 756, 1935, -196,
+  -1224, 1695, 230, 1210, -232, -2714, -1628, 480, -1368, 1344, -944, -1911, -104, 262, 480, 530,
+  856, -861, 315, 1212, -2366, 1400, 300, -1370, 476, -226, -1224, -399, 891, -512, -1836, -339,
+  -1859, 1000, -576, 1134, -944, 825, -1508, 488, 208, 0, -1089, 460, 728, -1620, 1599, -999,
+  270, -174, 2499, -321, 1016, -1164, -278, 0, 1221, -872, 1518, 996, 1270, 216, 645, 1078,
+  -2448, -226, 1725, 220, -464, -354, 1332, -1920, 0, 384, -2950, 637, 1560, 1310, -1056, -530,
+  -428, -861, 1470, -1111, -1014, 800, 300, 1370, 1071, 339, -1632, -1463, 0, 640, 204, 791,
+  1859, -875, 768, 1260, 0, 75, 232, -1220, -520, 1680, 198, -345, 0, -810, 1599, -222,
+  -1890, -870, -441, 107, -1270, 1940, -2224, 736, 1110, 654, -414, -1162, -889, -2916, 774, 1176,
+  272, -452, -230, -2200, 232, -1298, -2664, -2400, -1368, 192, -3776, 182, -2080, -2751, 0, -848,
+  -963, 492, -630, 909, 169, 1000, 900, -548, -2380, 0, -510, 2527, 594, -128, 612, -565,
+  1573, 625, -192, 504, -2242, -750, -1856, -1220, 1144, 120, -891, 1035, -728, 2025, -1230, -999,
+  270, -174, 1176, -1605, -762, 0, 2780, 276, 222, 0, -414, -166, -1905, -432, 1677, -1960,
+  -544, -904, 1150, 220, 348, -2006, 2072, -288, 570, 1056, -118, 182, 1768, 1703, 768, 424,
+  -535, -615, -1155, 909, -3211, -900, -200, -2877, -1785, -452, -408, -1064, -297, 768, -918, -113,
+  -1287, -875, -2016, -756, 0, -750, -464, 244, 208, 2280, 396, -1035, 364, 675, 861, -1443,
+  405, -174, 2940, -2996, -381, 485, -1112, 368, -1110, 545, 1794, -913, 0, -216, 645, 1666,
+  544, 678, 690, 110, -348, -1888, 740, 288, 456, -2112, -1062, 364, -2704, 1310, 384, -2014,
+  -107, -738, -525, -909, -3549, 600, 700, 411, -1547, -226, -102, 532, 1683, 0, -1836, 565,
+  -286, -2125, -1920, 3654, -472, 0, -2668, -1586, -208, 840, -2673, -115, -364, 135, -3444, -555,
+  2835, -1479, -2205, -1070, 1524, -1358, -1807, 920, 1554, -654, -138, -1660, -254, -648, 1419, 1176,
+  2448, -226, -230, 990, -812, -1534, 740, 96, -1824, -864, -2242, 1183, 416, -1310, 1824, 954,
+  -107, 1968, 840, -303, 507, 1300, 900, -137, 238, -2373, 2754, 665, -891, 0, -714, -1130,
+  -3432, 1500, -288, -1260, -118, 1050, -116, -1342, -1872, -1920, 297, -1035, 637, 405, -615, -444,
+  -270, 2088, 735, -1819, -1016, 970, 834, 736, -111, 327, 276, -747, 762, 216, 387, -98,
+  1088, -2034, -2760, 0, 0, 590, -888, 960, -2964, 576, -236, 728, -416, 786, 576, 742,
+  -535, 1230, -1050, 2222, -2028, -300, -700, -3151, 714, -226, 204, -532, 99, -2688, 816, 1921,
+  -1144, -2250, 864, -1764, -2714, -900, 2088, 488, -1872, 1680, -198, -1725, -819, 2295, 2091, -888,
+  135, -1305, 882, -963, -762, 776, -695, -2024, -1110, 1199, -2208, -830, -1905, 972, -387, 490,
+  -1768, 339, 1495, -1760, -464, 1652, 592, 672, 114, 2592, -118, 91, 1352, -1310, 480, -530,
+  1177, 984, 1890, -2020, -169, -1500, -400, -685, 2261, -339, 2958, -3325, -891, -2432, -1530, 1695,
+  -858, -625, -192, 2142, -944, -825, 696, 1586, -1664, 720, -297, -920, -1274, 540, 1353, 333,
+  -4050, -1131, -1764, 856, -508, -3492, 2919, -3312, -2886, 218, -1518, -581, -1651, 432, -2322, 1176,
+  -136, -3729, -2875, 440, -348, 826, -1332, -1440, 1710, 1056, 2124, -1274, 1248, -2620, -864, 2332,
+  749, -861, 1680, -707, -2366, -3200, -1100, -2603, 3213, -339, 1020, 3458, -396, -1920, -306, -3390,
+  0, -1750, 192, -882, 1298, -150, -2320, -2196, 520, -2400, -1188, 1955, -273, 675, 1599, 555,
+  -1350, 1479, 588, -535, 508, 776, 695, 2208, 2553, 436, -690, 0, 635, 1296, -1548, 1274,
+  -2040, -1356, 115, 0, 348, 1180, 1628, 480, 228, -768, 236, 910, 3328, -3275, 384, -1802,
+  -1177, -1353, 1365, -2121, -3042, -500, -800, -411, -2856, 791, 306, -1596, 1485, -768, 1734, -791,
+  -2574, -125, -2112, -882, 944, 900, -348, 244, -1456, 720, -396, -805, -273, -4590, 1230, -111,
+  -1755, 957, -1176, -856, 635, -291, -278, 1564, -333, -1962, 1518, 83, 0, -216, -1548, 196,
+  -2584, -1356, 1150, 110, 2204, -708, -1776, 768, 456, -2304, -1062, 182, -208, -1310, -1248, 1378,
+  -749, -246, -840, -101, -2535, -200, 300, -1507, 2261, -1243, 918, 0, -2277, 384, 0, 339,
+  1716, 750, 1248, -630, 708, 900, -464, 488, -2288, -1560, -693, 1035, -1911, -1620, 369, -777,
+  0, -609, -147, 1177, -508, -388, 695, 1840, 999, -2071, -138, 83, 127, 540, 903, -882,
+  -816, 452, -690, 220, -1740, 472, -1480, 2784, 1710, 864, 354, 0, 936, 2358, -1632, 742,
+  -214, -369, -210, 303, -507, -100, -300, -1096, 1309, 1356, 816, 1729, -495, -128, 102, -1130,
+  1001, -500, 192, 252, 1888, -300, -3248, 1220, 1976, -120, -198, -115, 546, -135, 1107, -1665,
+  135, -261, -735, -1391, -2159, 1746, 139, 1564, 111, -981, -276, -1245, -762, 2268, -516, 1960,
+  -5304, 3390, 575, -1430, 348, 2124, 148, 384, -2166, 384, -590, -1092, -728, 1834, 864, -636,
+  0, -861, 1470, 1111, 507, 2100, -1000, 822, -1309, -1017, 1428, -399, -396, -1280, -1632, -904,
+  -1144, 1000, -480, -378, -708, 1425, 116, 122, -624, -840, -297, 1380, -546, -2970, -492, -1110,
+  -270, 435, -1617, 1391, 0, 194, -2641, -1012, 2109, -2507, -966, -581, -889, -540, 2451, -1960,
+  0, -2034, 1150, 1760, 1276, -1180, 1924, -960, -1140, -1536, -118, 728, -416, -2227, -2112, 318,
+  -1391, -2091, 0, -404, -1521, 800, -300, -1644, 0, 678, -408, -1463, -99, -512, 2040, -1017,
+  4147, -125, -384, -504, 354, 150, 116, -610, -2704, -2040, -891, 2070, -2548, -1890, -492, -777,
+  -3780, -1479, -3381, 1498, 254, 97, -2780, -828, -111, -2834, -2760, 498, -1397, -972, -2709, -2058,
+  1768, -2825, -1265, -1430, -1160, 2124, 888, 864, 684, -2880, 1298, -1547, 416, -3930, -864, -1272,
+  535, 1599, 735, -909, -507, -400, -600, 274, 2856, 565, -1734, 1729, 1485, 1664, 306, -452,
+  143, 1250, 2400, -252, -236, -300, -116, 1220, -2184, 1920, 594, -345, 637, -405, -2583, 2331,
+  1485, -435, 882, 2675, -635, -388, 1807, 0, -1332, -109, -690, -830, -635, -1080, -774, -882,
+  -2856, -339, -1150, 1320, 2088, -118, 3552, -1440, 456, 96, 354, 637, -1456, -1048, 0, 2014,
+  -107, 369, 0, 202, 2704, 1000, 1100, 959, -1190, 1017, -1020, -399, -1485, -1536, -1020, -226,
+  286, -375, -960, -2016, -472, 975, -232, -1708, 1248, 120, -990, 2070, -1001, 945, -246, 333,
+  -1350, 1305, 588, -1819, -254, -1067, -1529, 276, -777, 981, -552, 1079, 2540, -324, -1419, 196,
+  -408, -904, -460, 1430, -464, -1180, -2072, 2112, 912, -576, 1180, 364, 416, -2882, -1248, 848,
+  1284, -1353, -945, -606, -676, 600, -800, -2055, 833, -1808, -2244, 1729, 198, 896, 1734, -1356,
+  2717, 1500, 192, -378, -1888, -975, -3016, 488, -520, 2040, -396, -805, 910, -1350, -1476, 1776,
+  -2295, -957, -441, -1498, -2540, -582, -1946, 0, 888, -1526, 828, 1245, -889, 972, -258, -2548,
+  0, -1243, -115, 2310, -2204, 118, -1776, -672, -3876, 1152, -1062, 91, 1456, -131, -96, 1802,
+  -1284, -369, -2940, -505, 169, -1100, 0, 274, 2261, -2147, -2244, -931, -693, 2688, 2346, -113,
+  2002, 875, 1152, 1638, -236, -75, -464, -854, -104, -1920, 99, -460, 728, -1350, -984, 1332,
+  2430, 87, 0, 214, -1143, 1455, 139, 644, -2664, 1417, 414, 664, -762, -756, -2967, -784,
+  272, 1017, -460, 2310, -928, -472, -740, 1536, 1254, 384, 590, -364, 416, 0, 768, -3180,
+  0, -123, -1365, -606, -507, -1400, 1400, 1918, 238, 565, 306, 665, 594, -1664, 0, 113,
+  -143, -500, 1344, -2772, 708, -750, -928, -976, -1040, -1200, 1980, 1265, -455, 540, -2091, 333,
+  1620, -609, 441, 428, 381, 1164, -417, 276, 0, 763, 414, 996, 635, 108, -3225, -196,
+  2176, 226, 690, 440, -696, 354, 2960, 384, 1026, -1344, 1888, 273, 728, -131, 288, -1908,
+  963, -1107, -420, 202, -3718, -200, -400, 548, -119, 904, 1938, 133, -297, -3840, -408, -1243,
+  -1287, -625, 1152, 1386, 708, -825, 0, -1830, -624, -960, 0, 345, 455, 540, 492, 111,
+  270, -2001, -2058, 321, 1270, -2328, -2085, -828, 1332, -654, -966, -664, -1397, -648, -645, 882,
+  408, -339, 690, 330, -1160, -708, -1480, -96, -342, -384, 1416, 273, 0, -1048, 288, 742,
+  -1177, 0, -105, -505, -1014, -200, 200, 959, 714, 1017, 1836, -2394, -1287, -768, -1020, 1582,
+  858, -1500, 1728, -1008, -944, 225, 928, 854, -312, 240, -1980, 1265, -2730, -2565, 492, -2109,
+  -2295, -1044, -441, 428, 889, 0, 973, -1196, -1998, 0, 1104, -1577, -2667, -2160, -516, 588,
+  1088, -1130, 460, 2530, -1624, 354, 0, 1440, 2508, 384, -826, -546, -312, 262, 576, -742,
+  -535, -1476, 420, -2020, 1690, 1600, -400, -1370, 476, -904, -2346, -931, -1089, -1536, -1122, -678,
+  572, 1250, 0, -1008, 1416, -975, -580, -1708, -2184, -360, -297, -2990, -455, 1485, 984, -222,
+  -135, -87, 1764, -535, -127, 0, 417, -920, 2775, 218, 414, -415, -127, 1836, -516, 1078,
+  272, -339, 805, 1760, 928, -236, -296, -1920, -456, 1920, -472, -364, 208, 1441, -384, -954,
+  -535, 615, -630, -505, -1352, -2000, 2000, 2740, 476, -678, 0, 2527, -891, -1408, -1326, -2034,
+  -1859, 125, -384, -252, -590, -2400, -464, -1220, 208, -1200, -594, -4600, -455, 2565, -2337, -1443,
+  2835, -783, -4410, 2247, -1270, -388, -834, 828, 1221, 1417, -2898, -1079, 1651, 108, -2838, 1176,
+  544, -2486, -690, -3190, 0, 826, -444, -1728, 2166, -3072, 590, 0, 104, -524, 0, -742,
+  963, -1107, 1470, 303, -507, 100, 600, 274, 119, 0, 306, -1064, 0, -1792, 2040, -2034,
+  -2288, -1500, -672, 756, 1062, -450, 1392, -854, -104, -1320, 1584, -230, 637, -1080, -738, 111,
+  -2700, -87, -294, 1284, -2286, -485, -556, 184, 1665, -1962, -1242, 498, -3302, 2376, -2322, -784,
+  0, -2373, -805, 220, -1392, 472, -740, -1056, -1254, 480, 708, -182, 0, 393, -864, 3180,
+  428, 246, -2415, -606, 1859, 700, -1400, 1370, -714, -226, -204, -532, 297, -768, 1020, -113,
+  1144, -3250, 576, 126, -236, -300, 812, -2684, 104, -840, 297, -1955, -364, 0, 1722, 0,
+  -1080, -348, 1764, 3424, -254, 97, 973, 276, -999, 109, -966, -415, -1778, 0, 1677, 294,
+  -544, 339, 2185, -440, 0, 1770, 2220, 1728, -228, 480, -118, 364, -1872, 1834, 1536, -106,
+  3317, 738, 210, -1212, 169, 0, -900, -822, -1785, -565, 306, 1064, -792, -2176, -918, 1469,
+  3289, -625, 0, 3024, 1888, -450, -2668, 2806, 1768, -1320, -594, -2070, 819, -2160, 2583, 666,
+  -2970, 1218, -1029, -321, -381, 776, -2641, 644, -888, 0, 690, 498, 2540, 1944, 3096, 2352,
+  -1768, -791, -1035, 770, -928, 472, -740, 672, -1596, -192, 1062, 1547, -624, 524, 576, 1060,
+  1605, -861, -1575, 707, -1183, -200, -2400, 2740, 595, -565, -2550, 1729, -2475, -256, -1224, -1695,
+  -2002, -1000, 672, -1134, -2006, -2100, -1624, -1952, 1144, 840, -396, -345, -182, -405, 246, -888,
+  2565, -2001, 441, 428, 1143, -970, -139, 2024, 5106, -1199, 552, -1660, 254, -540, 1161, 0,
+  -136, -339, -1380, -110, -1276, 1062, -444, -960, -912, 1248, -826, 1547, -1144, -393, -288, 954,
+  107, 738, 840, -303, -2873, 2000, 700, -685, 1904, 0, -714, -1197, 297, 2048, -510, -791,
+  -1287, 1500, 1728, 630, -236, 825, -812, -366, 104, -1800, 990, -230, -910, -135, 738, -1887,
+  1485, 87, -1911, 2996, 2159, 1940, -3058, 92, 1443, 1962, 552, -83, 254, -1512, 0, -1372,
+  -680, 904, -1840, -1430, 1044, -354, 1184, 192, -1824, 0, 944, 819, 104, -1572, 480, -212,
+  -1284, -492, -210, 202, -1352, -1500, 800, 411, 357, -678, 510, 798, -495, -3456, -2244, 1130,
+  1573, 375, 576, -1638, -472, 525, -696, 976, -1144, -480, -594, 345, 1547, -405, -492, 666,
+  -270, -696, -441, 1177, 762, 0, 2085, -92, 2553, -1090, 276, 83, 1016, -756, -1290, 392,
+  1496, -565, -1840, 1100, -464, 118, 592, 192, 1710, 96, -354, 637, -624, -1965, -576, 530,
+  -107, -2583, -1155, 2525, -1521, 1500, -300, 2466, 476, 1582, -510, -133, 1089, -128, 102, -1695,
+  -429, 2625, -864, 756, -3540, 450, -2204, -122, -728, 1200, -990, -1725, -455, 405, 2460, 1776,
+  -945, 87, -882, 321, -508, 679, -556, 2024, 999, -872, 552, -1162, 2032, 432, 0, -294,
+  0, 565, 230, -1760, -348, 1888, 1332, 384, -912, 1728, -708, 91, -1144, -1441, 864, 1166,
+  -1284, 2091, 735, -101, 3549, 200, -600, 1370, 0, -4633, -714, 798, -1089, 640, -1224, -1017,
+  286, 625, 384, -1512, -1888, -75, -1276, -488, -832, 480, 99, 1840, 910, -1890, -1599, 2331,
+  135, 435, 735, -107, -1397, 0, -2224, 276, -1221, 0, -1104, 581, 1397, -2160, 129, 686,
+  -1768, -113, 0, -660, -348, -236, -888, 2112, -2052, -96, 708, -455, 0, -1441, -960, 212,
+  214, 2091, 2310, 1414, -2535, -2200, 1100, -1370, 1190, -3390, 612, -2527, -3465, -1408, 0, 1017,
+  -2145, -1875, 864, -3654, 2124, -1050, 1508, 244, -104, -1080, 99, -2760, 1365, 1620, -369, -1998,
+  -810, -522, -1176, -535, 254, 1067, 1251, 1840, -2775, 2616, -1932, -498, -3175, 432, 1161, 196,
+  680, 2147, -230, -3300, 0, -1770, -444, 2208, -1482, -1824, 1180, 182, -2912, 1965, -2016, -1802,
+  856, -2214, -315, 3232, -338, -2900, 2600, -1507, 2261, -1243, 1122, -532, 1386, 2304, 1836, 678,
+  -1144, 1375, -1152, -882, 2360, 750, 232, 366, 0, 720, -396, -2070, 910, -1890, 369, 1776,
+  -2565, 1305, -147, 1819, 254, 97, 834, -736, 1887, 109, 1104, 166, -1524, 0, -774, -2156,
+  1088, -339, -575, 990, 1972, -1534, 148, 1920, -228, 96, 1770, 1638, -416, 917, -288, 1908,
+  -107, 369, -1890, -707, 1014, 600, 600, -3973, 2023, -678, 816, -2527, -990, 2688, -1122, 678,
+  -2574, -375, 1056, -378, 944, 825, 1972, 976, -416, -360, 396, 1495, -546, 1080, -2583, -2553,
+  -540, -783, -588, -963, 1270, -485, 2085, -1104, -2553, 654, -2070, 249, -1270, -216, 0, -686,
+  3400, -339, 690, 880, -928, 944, -1332, -768, -1938, 96, 1298, -910, -416, 1441, -1344, -106,
+  -321, -492, -3990, 1818, 845, -900, 500, -685, -3451, 565, -1326, 1197, 594, 1280, -204, 1808,
+  1001, -750, -672, -504, -354, -675, 116, -1342, 208, 1920, 1683, 460, 728, 1350, -738, -1998,
+  -270, -1653, -2352, 1177, -381, 485, 1390, 552, -111, 436, 1656, -1660, -1651, -1944, 0, -2744,
+  -136, 904, 1380, 990, 580, -2124, 1776, 1248, -114, -480, 1180, 273, -624, 917, 0, -1590,
+  1819, 1230, -1365, -202, -338, -2400, 800, -1644, -952, 1582, 612, 2394, -396, 640, -1836, 1921,
+  -2574, -2000, -576, -378, -944, 600, 2668, -854, -520, -120, -297, 1150, 1092, 270, -738, -1443,
+  1080, -783, 1323, -1177, -1524, 776, -139, 1012, -888, 1853, -2484, -2075, 1397, 1296, 1161, 490,
+  952, 226, 1265, -880, -232, -472, 740, 0, -684, -576, 2360, 819, 728, 786, 960, -2014,
+  1498, -3075, -1575, 505, -2873, 300, 1000, -3425, -1785, -1582, -102, -532, -495, 768, -306, 226,
+  858, -625, 480, 1512, 944, -900, 696, -3294, 312, -2280, 792, -575, 1183, -810, -738, -1332,
+  -2025, -1044, -1911, 749, 1905, -873, -695, -2944, 1110, -109, -1104, -664, 635, -2052, -2064, 392,
+  1768, -452, 345, 440, -580, 708, 1776, -480, -912, 576, -2714, -1547, -1768, -655, 2400, -212,
+  -107, 246, 315, 707, -338, 100, 800, -685, -3927, 1582, -816, -665, 297, -1536, -102, -452,
+  -2002, 375, 576, 126, 1652, -600, -696, -122, 104, 1200, 0, -690, -819, -405, -369, -444,
+  1350, -522, -2352, -1498, 2921, -1552, -1390, -1104, -111, 1199, -2898, -1909, -1397, -1404, 1032, 392,
+  408, 113, 1610, -330, 1972, -3068, 2220, 0, 912, -768, -826, -637, -104, -524, -480, 530,
+  321, -1476, 735, 303, 507, 200, -200, -685, -476, 678, 102, -1995, -495, 384, -408, -1017,
+  -3575, 1375, -1920, 756, 708, -600, -348, 1708, -936, 2400, -693, 575, -1274, 1890, 1476, 888,
+  675, 435, 0, 642, -1905, 97, -834, 552, 333, -109, -1656, -415, -1778, -540, 1806, 196,
+  272, -565, 115, -550, -1508, 1180, 1480, -960, -1368, 96, -590, 182, 624, 1179, 384, 0,
+  -1391, -1230, 1785, -707, -1183, 2400, 500, 685, -1547, 226, -1122, -1330, -990, 256, -1734, 226,
+  -143, -500, -1536, -2772, -118, -75, -2900, -610, -1040, -2880, -2079, 0, -728, -270, -1599, -1443,
+  1080, -609, -2499, -1177, -127, 970, 139, 368, 666, -654, -1656, -415, -1524, -1080, 2193, -490,
+  272, -3277, 115, -330, 696, -118, -296, 96, 570, -480, 472, -273, 1560, -393, -960, -424,
+  -2033, -615, 2100, -808, -1352, 600, 1300, 1507, -1190, 1921, 3366, 6384, 198, 1024, -1632, -2034,
+  715, 1750, -288, 756, -1770, -1050, 2436, 244, 936, 840, 1980, -2875, -4095, 135, 4797, 666,
+  -135, 0, 735, 2140, -3556, 291, 695, 368, -3219, 218, -4416, -498, 2667, -432, 0, 980,
+  -3264, 1695, -2990, -6050, 2436, 1062, 1924, -2592, -1938, -960, 4720, -1183, -1768, -917, -3456, -3604,
+  -2247, 1599, -1260, 1717, -2873, -1300, -300, 2329, 119, -3616, -2448, 2527, -1287, -640, 1530, -1808,
+  -3432, -500, -2304, -1134, -236, -450, -1044, -1708, 832, -1200, 1089, 805, 1820, -540, 1722, -999,
+  -270, -348, 1911, -321, -1270, -97, 417, 1656, 3441, 436, 1242, 1494, -1905, -216, 774, 588,
+  1904, -226, 115, 770, -1392, -826, 1628, 192, 342, -480, -1770, -1365, -520, 1572, 1824, -848,
+  -1819, -4551, 420, -1515, 3042, -1000, -600, 685, -1190, 1130, -612, 1729, -1782, 768, -1428, -1243,
+  -286, -4250, 864, -756, -708, -75, -1392, -610, -2080, 1560, -792, -230, 728, 1485, -984, -1332,
+  -1890, -696, -588, -107, -508, 1067, 1390, 1932, 222, -872, -2760, -1577, -381, -972, 774, -1862,
+  2992, -1017, -690, 1210, -116, 2950, 2664, -384, -798, -864, -1888, 728, -208, -786, 960, -636,
+  -2782, -3567, -3045, 1313, 3380, 800, 300, 2055, 833, -678, -1632, 1197, -3267, 2304, 1020, 1130,
+  1430, 1875, -192, 2898, -2832, -300, -1276, 732, -1560, -600, 297, -575, 1183, -2430, 246, 1776,
+  2835, -1044, 4263, 3210, 2032, -1455, -1112, -460, 3108, -4687, 2622, -2158, 1778, -1944, -258, 1176,
+  -1224, -2034, 2875, 2420, -696, -1652, 296, -768, -570, -576, -1062, -2548, -2080, 1834, 1248, 1166,
+  -2461, -615, 525, -303, 169, 700, -200, -1781, -1428, 1130, 612, -1330, -1287, -896, -306, -339,
+  1430, 375, 480, -378, 1180, -1125, 928, 2928, 1976, 2280, -693, -4945, 0, -1080, 246, -2220,
+  -1755, -1479, 882, 0, 381, 873, 139, -2484, -111, -109, -552, -913, 1143, -972, -258, 882,
+  544, 339, 345, 1100, 1392, -118, -1184, 0, 2850, -576, 1180, -2366, -1872, -524, -192, -318,
+  428, 2337, -1050, -1313, 2366, 100, -100, 2055, -1071, 791, 1224, 133, 495, 896, 1530, 226,
+  1430, 1625, 384, -2520, 354, 1050, -928, 610, 1352, -480, -1386, -920, 1547, -2835, -738, -555,
+  2565, 87, 1764, 1070, -762, -485, 278, -828, -999, -1526, 690, -83, 1651, 108, 2451, -1960,
+  -2720, -452, -805, 220, -116, 354, 1036, 288, 0, 1344, 472, -182, -208, 1572, -576, 424,
+  -1391, 1968, -1260, -1515, 676, 0, 0, -822, 238, 452, 2040, -399, -1089, -1792, -1020, -1921,
+  0, -1250, 768, -126, -1770, -675, 464, 854, -1352, 480, -693, -1725, 0, 135, -1107, -1332,
+  -1215, 435, -1764, 214, -3810, 1455, -834, -920, 444, -872, -3588, 913, 508, -1620, -2193, -98,
+  -1632, -1017, 1380, 0, -1160, 236, 888, -768, -570, -384, -236, -1092, 624, 393, -192, 1378,
+  -1070, -369, 105, 808, 507, -800, -2500, 959, 1071, 452, 1326, -798, -1089, -3456, 102, -1243,
+  1859, 0, 480, -2268, -1416, 675, 232, -732, -936, 360, -99, -230, 819, -1080, -492, 1332,
+  0, -609, -1176, 535, -762, -1455, -417, -368, 666, -654, -2622, -1079, 127, -1620, -1419, 686,
+  -2448, 3164, -2530, -2200, -580, 1062, 2072, 2208, 1026, 1440, -354, 273, -728, -1703, 864, 2014,
+  -214, 861, 945, -2222, 338, -400, 600, -3288, 1785, -678, 1734, 665, -396, -1408, 408, -2712,
+  1430, -375, 2016, -2898, -2124, -1350, -1044, 1708, 1352, 240, 0, 690, 455, -2295, -123, 2553,
+  -2970, 522, -147, -856, 508, 970, 556, 276, -999, -1635, 552, 1162, 0, 1512, 1806, 392,
+  -2584, -452, -1725, -110, -116, 826, -2072, 1920, 798, -768, 0, -1911, 1144, 2096, -960, 636,
+  2568, 984, 840, 1010, -338, -300, -1200, 274, 2023, -4294, -2142, -1463, -1287, -1536, 2040, -452,
+  1573, 2250, -960, -1134, 2006, -2925, -1392, -1952, -1352, 720, -2673, -2530, 546, 1890, -861, 2553,
+  135, 696, -294, -1177, -1651, 970, 1668, 1012, 999, 436, 1518, -664, -3556, 3564, 1806, -980,
+  408, 226, -805, -2310, -1624, -1534, -2664, 1536, 342, 1056, 2242, 1092, 520, 131, -672, 954,
+  -1926, 0, 840, -1313, 1014, -900, 100, -1644, 1309, 226, 714, -1862, 1881, 384, 3366, 452,
+  1001, -2625, -288, -504, 2950, -225, 812, -2318, -208, -1920, -198, -1610, 273, -135, -1107, -2775,
+  -270, -87, -1911, 107, -127, 873, -3336, -184, -2775, 1853, -2208, -996, -1905, 108, -129, 196,
+  -1088, 113, -1150, 110, -580, 236, 444, 96, -1026, -864, -590, 182, -1352, 2882, -384, -2226,
+  1605, 246, 945, 202, 169, 1000, 200, -2877, -1785, -1130, -714, 1197, 1485, 256, 102, 1017,
+  -1144, 875, 960, -4410, -118, -225, -812, -732, 1456, -120, 1089, 1035, 182, -540, -246, 666,
+  405, -435, -1029, -749, -1778, -291, 2363, 368, 0, 218, -690, -913, 127, -1296, 129, -1862,
+  136, -565, -805, -440, 1276, -354, -1628, 96, 570, 864, -118, -819, 2392, 1834, -1056, 848,
+  535, 492, -2310, 1111, -1183, -600, 200, 411, -357, 791, -102, 133, 1089, 1408, -918, -1130,
+  572, -125, -2208, 1890, -2714, 150, -696, -1830, -312, 1680, 495, 345, 637, -270, -369, -111,
+  -1350, 435, 441, -214, -1397, -582, -556, 368, 222, -1853, -2760, 332, -3175, 972, -1419, -294,
+  -4216, 1921, 460, 1430, -1392, 944, 1480, 96, -342, 192, 118, -91, 104, -262, 672, 212,
+  535, -369, -2205, 808, 2535, 600, 1600, 822, -1547, 3277, -1122, 2128, 891, 2304, 714, -1469,
+  1287, 375, -1152, -882, 118, -150, 1160, 1464, -1872, 1680, 1386, -460, 1001, 1485, -123, 555,
+  1620, -261, -588, 1498, -254, 582, 139, -644, 555, -1526, -414, -1245, -127, 1296, 774, -1274,
+  -1360, -1243, -920, 220, -348, -1888, 3256, -1248, -1824, -384, -944, -546, -416, 1834, -864, 1378,
+  428, -1476, -1050, -707, -2028, 100, 700, -1370, 1666, -791, -1530, -133, -1683, 1152, -816, 339,
+  858, 2250, -672, 1764, -2124, 225, 464, -1220, -520, -3000, 198, 1150, 364, 810, -1722, -999,
+  -1350, 957, -735, 1391, 1778, 194, -695, -920, 2664, 981, 1794, 249, -381, 324, -774, 1372,
+  -272, 565, 920, -880, -116, -118, 2072, -96, -456, 96, -1652, 91, 312, -1441, 1440, -1696,
+  321, 738, 105, 404, -1859, 500, 1000, 1507, -952, -226, 1020, -2261, -1485, 768, 102, 1130,
+  -143, 1125, 960, -882, 708, 225, -348, 1098, -312, -720, 891, 575, -2912, -2025, -369, -444,
+  -1485, -87, -1764, 963, 1905, -873, -139, 828, 999, 981, -1794, -664, 0, -1836, 258, 1568,
+  816, -1017, -1035, -440, -1160, -708, -148, -192, 1824, 288, 2360, -1547, -1144, 131, -672, -742,
+  642, -3198, -2940, -1414, 1183, 2500, -900, -1781, -1666, -678, -1632, -399, -2277, -512, -306, 226,
+  1430, 2500, -576, 1890, -1770, 600, -1392, -1464, -1456, 2880, -1386, 2300, -364, -1890, -369, 111,
+  -2025, -435, 1764, -1498, -1016, -1358, -139, -920, -111, -1853, -2898, 747, 2413, 1836, -1290, -1274,
+  -1768, -1017, -345, 0, -3248, 354, -148, 384, -456, 192, -1180, -1183, 1872, 1441, -2400, 1484,
+  -1819, 615, 630, -505, 1859, 600, 400, 2329, -238, -1243, 612, -266, -792, -512, -612, 339,
+  -429, -1875, -480, -1260, 354, 450, -1508, -610, 416, -2040, 1881, 575, -1274, -1080, -1845, -3330,
+  540, -87, -1323, 428, -3556, 0, 417, 92, -222, 2834, 1380, 581, 0, -1296, 3483, 392,
+  -1224, 3842, -575, 770, 1624, 118, 1480, 1536, -228, -576, 1180, 546, 312, -917, 1632, -1802,
+  963, -615, 420, 1313, -2028, -200, 2500, -2055, 0, 2599, 918, 0, -1188, 640, -1326, 791,
+  572, -375, -1728, -1890, 472, -1125, 1160, 1220, -1352, 1800, 297, -230, 455, 1890, 1968, -999,
+  1080, 348, -147, -1605, -2540, 388, -2641, 1748, 888, -654, -2484, -498, -254, -1188, 1290, 1568,
+  -816, 1808, 920, -2530, 696, 2006, 0, 2496, -1026, -672, 2832, 2184, -520, -262, -1536, 1272,
+  -428, 2829, -630, 808, 676, -2900, 600, 1507, 1904, -1808, 204, 1596, -1188, 768, -510, 1017,
+  -572, 1125, -3168, 1134, -1416, -150, 580, 2074, -1040, 1320, -891, 345, -910, 135, 861, -1998,
+  1215, 1305, -294, -1070, -3810, 3880, -973, -828, 333, -436, -2208, -249, 2286, -1080, -387, 1078,
+  -136, 904, 805, -1320, 1392, -236, 1184, -192, 570, -288, 826, -455, 312, 917, -768, -742,
+  2247, -2952, 945, -404, 507, 1200, -500, -2055, -714, 1808, 1020, 399, -99, 2048, -1224, -1469,
+  -858, -1375, 1920, -2142, 236, 375, -1276, 732, -1144, 1560, -297, -345, 182, -675, 984, -222,
+  1485, -174, 147, 749, 635, -582, 0, 92, -777, -2289, -1656, 1245, 1524, 1188, 1935, -1176,
+  -816, 452, 460, 990, -1740, 944, 2072, -384, -798, 1632, -1770, 637, 1352, 2489, -864, 1908,
+  -428, -861, -525, -1616, 3718, -600, 200, -411, 1547, -1582, -816, -532, -396, 640, 510, 1582,
+  0, 0, 1536, 1008, -1298, 1200, 696, 488, 1560, -2160, 792, -230, -546, -135, -1476, -1110,
+  1485, -783, -3234, -321, 762, -2813, 695, -644, -333, 436, -2760, -1328, -127, 216, -2838, 294,
+  3264, -2599, -345, 2200, -696, -2832, -4144, -480, 1596, -384, 1888, -364, 1248, 1179, -96, -318,
+  -1712, 369, -1260, 505, -2028, -700, -900, -959, 1071, 0, 1122, 0, -891, 1792, 918, 565,
+  858, 1875, -96, 2772, -3422, 1725, 116, 1464, -3016, -1680, -594, 1610, 728, -270, 1353, -444,
+  270, 696, 882, -749, -1270, 873, 2502, -1012, 1554, 109, 2346, -996, -889, 432, -903, 980,
+  0, 113, -805, 1430, -1276, -472, -296, -96, 228, 2208, 2242, 91, -416, -2751, 480, -424,
+  749, 861, 0, -707, -507, -900, 200, 2192, -833, -452, 816, 133, -1287, 128, 306, -452,
+  143, -2000, -576, 630, -118, -1950, 1160, -976, -2704, 1920, 297, -1265, 273, -675, 1968, 1887,
+  -1890, 0, -1470, -1605, 1524, -1164, 139, 184, -1110, 218, -966, -996, -1651, -972, 774, 1176,
+  1496, -904, 1495, 1540, -812, -354, -1776, -288, 684, -480, -590, -273, -520, -786, 96, 424,
+  428, 2214, -210, -404, -338, -600, 700, 0, -1428, -678, -204, -133, -495, 1920, 1836, -565,
+  2288, 2000, -480, 0, -2596, 975, 1276, 610, -2288, 480, -1089, 1495, 728, -405, -738, -666,
+  -135, -522, 1323, -749, 381, -1552, 1112, -552, -1443, -109, -414, -249, -1270, 1836, 1290, -980,
+  -1768, 452, -1610, 770, -348, -944, -296, 1536, 228, 1152, -944, -1729, 728, 131, 480, -212,
+  -535, 615, 2310, -202, -4901, 1300, -1400, -137, 952, 0, 510, 798, 891, -2560, 1224, -226,
+  -1001, 2500, -96, -882, 1298, -300, -116, 2562, -208, 0, -99, -1725, -910, -3105, -738, 222,
+  135, 261, -735, -107, -381, 97, -556, 368, -333, -1308, 828, -664, -127, -1404, -645, 392,
+  -3400, 113, 230, -1650, 928, 1416, 1184, 1152, -114, -1344, 354, 1911, -3432, -1310, -1152, -848,
+  -107, 861, 210, -1414, -2366, 900, -200, 2055, 1785, -1017, 1530, 133, -297, 896, -1428, 904,
+  1287, 2875, 0, 378, 236, 0, -116, -2196, 624, -960, 990, -1840, 546, 135, 861, -2109,
+  270, 783, 1470, 2675, 635, 582, 2363, -1104, 666, -1526, 276, -1826, -2794, -1404, -129, -2058,
+  -816, -2825, 575, -1100, 1160, -1534, 1036, 576, -1254, 768, 826, 182, -1872, -655, 1632, 742,
+  -2033, -1107, 1260, 202, 1521, 200, -1500, 137, 3451, 1017, 1020, 0, -3465, -2560, 408, -2260,
+  2002, 1500, -1824, 1386, -1652, -825, 1508, 2196, -1664, 2520, -792, 1150, -1001, -810, 2952, 1443,
+  -5400, -1218, -2058, 3103, -381, -2522, 139, -1380, 111, -2180, -966, -1245, -1905, -3240, -2064, -686,
+  408, -2034, 230, -110, 0, 3068, 1924, 1056, -114, -2688, 3422, 364, -3848, -2489, -2688, 0,
+  1284, 1722, -1050, -3333, 845, -1000, -800, 0, -3570, 226, -2142, 1330, -1584, 2304, -816, 565,
+  3003, -3375, 192, -1008, 1062, 300, -812, 976, 936, 1080, 495, 1610, 1365, -1620, 861, 0,
+  -135, -348, 0, -214, 635, 2231, 1251, 184, -1554, 1635, -1380, -996, -1143, -864, 516, -1372,
+  408, -565, 1495, 3300, -232, -1180, 592, 672, 1026, -864, -1770, -728, 1456, 262, -768, -1908,
+  -1605, -246, -210, -101, 2535, 900, 800, 822, -1547, 678, 1224, 266, -1584, -1536, 204, -1921,
+  2002, -2250, -1344, 1386, -236, -1050, 464, 488, 520, 1080, -891, -1150, 1729, -540, 861, -666,
+  -540, -609, -1764, -1284, -1143, -2231, -2224, -552, -1221, -1308, -828, 332, -1524, -2808, -1290, 588,
+  2856, -226, -575, 1100, 232, 118, -148, -2496, 798, 768, -2124, -455, -2184, -2751, -2112, 1696,
+  -535, 615, 0, -303, 3549, 1600, 1500, 1096, -1309, -791, 306, 1197, -1089, 1536, 1836, -2260,
+  -143, 1000, -384, -2016, -472, -825, -2900, -1586, 1144, 960, 99, 115, 1547, -3105, -2829, 222,
+  -135, -522, 1617, -214, 508, -970, 139, 828, -1665, 109, -828, 332, 1143, 540, 1677, -3038,
+  680, 904, -805, 3630, -1392, -354, -444, -1248, -342, -864, -826, 91, 104, 1179, 384, 848,
+  -1712, 1476, -210, -1010, -1183, -2100, 1300, 685, -2142, 791, -612, -798, 297, -2048, 1326, 113,
+  715, 2250, -384, -252, -1062, -1125, 1740, 1830, -2080, 720, 396, -4370, -1001, -675, -492, -555,
+  1215, 783, -1764, -1498, -889, 970, 2224, -276, -555, 0, 0, -1411, -508, -1512, -387, -490,
+  -816, 1469, 230, -550, 812, -590, -148, -1728, 570, 0, 2242, -455, -728, 524, -2112, -636,
+  -107, -1599, -105, 1313, -2366, 100, -700, 548, -1666, 791, 918, 266, -495, -768, 1122, 226,
+  572, -375, -1536, 504, 590, 225, -1044, -732, 104, 720, -396, 690, -910, 1350, 1107, -555,
+  -1890, -435, 1617, -214, -1397, 388, 834, -736, 333, 2289, -2898, -747, -889, -864, -1548, 784,
+  1088, -565, -115, 0, 2088, -1062, -1480, 1152, -1254, -672, -708, -1274, -936, -393, -192, -424,
+  535, -738, -525, 1212, 169, 100, -600, -411, -833, -565, 408, 665, -693, 640, -714, -565,
+  0, 1875, -288, 1386, 236, 675, -116, -122, -2288, 2040, -99, 1035, -1092, 2565, 615, -777,
+  1350, -870, 0, -2247, -1270, 291, 556, -368, 555, -1417, -2208, 0, -889, 648, 1290, 98,
+  1224, 1356, -345, 110, 464, -236, -444, -96, -456, -384, -354, -637, 416, 917, -96, -742,
+  107, 1107, 420, 1111, -3380, -100, 100, -274, -833, 565, -1428, 1995, 198, -1152, 1020, -1243,
+  1001, -250, 768, 1008, -236, -975, -116, 0, -1560, 1200, 297, -345, 1365, -1080, 0, 1776,
+  405, 1044, -294, 642, 0, -679, 417, 1472, 333, -436, 552, -83, -2794, -648, 903, 784,
+  -1768, -1469, -115, -660, -348, -590, -1332, -960, -912, -480, 0, 455, -416, 655, -672, -106,
+  -856, -2091, 840, 2222, -3380, -700, -3200, -1918, 357, 226, -306, 2793, -1188, 2432, 306, 0,
+  2288, 500, 1152, -3906, 2596, 2475, 696, -1220, -208, 120, -2376, 1610, 1820, -2025, 3075, -222,
+  -270, 261, 2058, 1926, 0, 1552, 278, -1472, 1998, -3270, -3036, -1826, 762, -3024, 1806, 0,
+  -2312, -904, 2990, 440, 116, 236, 2664, 1344, 1482, 1248, 236, 1365, -1560, 2096, -960, -530,
+  -5564, -2337, 1890, 1212, 1183, 100, 2000, 1918, 4403, 3842, 2754, -1862, -2772, -3328, -3060, -791,
+  3432, 3250, -1344, 2520, -6136, -2175, 232, 5856, -1144, 480, -2376, 2300, -3731, 2295, 4797, -555,
+  -1755, -2262, -7938, 3103, 2032, -2231, -1112, 736, -888, 763, -3036, -332, 1651, -5076, -6966, 1274,
+  2312, -1130, 1495, -1430, 232, 3540, 3404, 576, 2508, -1632, 1652, -1365, -3328, -6550, -3264, 1378,
+  856, 1107, 630, -606, -1183, 1800, -700, -1370, -2142, -339, -510, -266, -990, 1024, -408, -678,
+  -572, 1375, -480, -1512, -590, -750, -116, 1952, -104, 1680, 0, 345, -273, -945, -615, -1332,
+  -1215, -1044, -5292, 1819, -127, 582, 1390, 736, -1110, 327, 414, 1577, -1397, 1728, -774, -2744,
+  -1632, 3277, 575, -440, 232, -1180, 148, 1536, 456, 0, 3776, -728, -1560, -1965, 1056, 0,
+  -1284, 984, -945, -404, 1183, 100, 400, 685, -238, 452, -204, 1330, 1188, -1920, 1326, 0,
+  858, 500, 96, 1638, 472, -375, 812, -1342, -624, 1680, -990, 230, 1001, -1485, 738, -333,
+  405, 435, 1323, -642, 254, -194, -3197, 184, -777, 327, -690, 0, -1016, -648, 645, -980,
+  272, 226, -1610, 0, -812, -1416, 148, -1056, 0, -1440, 0, 0, -312, -1703, -288, 318,
+  -2461, -246, -840, 0, -2535, 1800, 800, 1507, -1547, -1356, -408, 1596, -1089, 128, 2040, 226,
+  2431, 250, -1152, -504, -3540, -1275, -696, -1464, -1976, 480, 693, 345, 728, -1485, -1353, 444,
+  270, -435, -294, 749, 1651, -1261, 1668, 736, -999, -2071, 552, 332, -127, -3348, -1935, -490,
+  2584, -1695, 1495, -110, -1276, -3068, -1184, -864, -2052, 384, 236, -910, -2184, -262, 192, -530,
+  0, -861, -1470, -606, -1014, -600, 400, -1370, -2856, -339, -408, 532, -2475, 512, 1326, 452,
+  3575, -1500, 192, -504, 2124, -3450, -1508, 1464, 0, 720, 2178, -230, 364, -675, -1599, 2775,
+  -2970, -1479, -2646, -963, 127, -388, 0, -1564, -333, 1853, 1518, -83, 1524, 1512, -129, -2156,
+  1088, 1469, 805, 1100, -1508, -1062, -1036, -768, 456, 768, -826, -637, 312, 786, 768, -636,
+  107, -1599, 735, 0, 1352, -100, 1400, -2877, -1071, -791, -918, -2261, -1287, 0, -1428, 452,
+  -2288, -375, -1536, 2394, 590, 825, 348, 732, 520, -360, -990, 0, 1456, 0, -984, -333,
+  -135, -522, 1764, -1070, -127, 194, -139, -828, 0, 327, 1104, 913, 1143, -756, 0, 686,
+  -1224, -1243, 690, 660, 696, -2950, 592, -1152, -1368, -1344, -2124, 273, 104, 131, 960, -1908,
+  -428, -123, -105, 808, -1859, -1700, 100, -2055, 1904, -1695, -918, 133, 99, 256, 204, -2486,
+  -1144, -2375, 1632, -630, 0, -2025, -812, -976, 104, -1440, 693, -345, 546, -945, 1599, 666,
+  -405, -261, 3528, -749, -3937, 2328, -695, 1012, 333, 763, -966, -581, -2032, 2052, -1032, -882,
+  2720, -1130, -1955, 1320, -2320, 590, -1924, 2208, -912, -192, -2124, -1001, -104, 131, 1632, -1166,
+  -428, -2952, -840, -707, -1352, -1300, -200, 959, 595, -339, -1020, 1729, 495, 1152, 2040, -1130,
+  -1144, 250, 1728, 252, 944, -1125, 464, -1952, -312, 600, 594, -2645, 728, -540, -738, 2109,
+  -1350, 2175, -2499, -2140, -635, 1455, -695, 736, -1332, 1962, 828, -1162, -4064, 756, -1161, -980,
+  -2448, -113, -805, 1760, -580, -826, -2220, 0, -1482, 576, -1888, -273, -832, 917, -96, 530,
+  -2782, 1230, 210, 202, -169, -1600, 600, -685, -1071, 1469, 102, 1064, 297, -3584, -1224, -4633,
+  -2431, 500, 0, 0, -2006, -525, 116, 2684, -312, 2760, -1881, -3105, -637, 2160, 2214, 333,
+  -1485, 522, -147, -856, 1905, -388, -3753, 2852, 2220, 872, -552, 664, 762, 972, 129, -98,
+  -2176, -1130, -690, -770, 232, 1770, -148, 672, -114, -1152, 826, -910, 0, 0, -960, -1378,
+  -2461, -1476, -1155, 404, 1352, -2100, 3600, -2740, 952, 452, -1530, 3857, -990, 128, 3570, 678,
+  1287, -1750, 1344, -1764, 1298, -1650, -812, 610, -1560, -1320, 1980, 115, -2639, -1485, -2952, 0,
+  0, 87, -2058, 214, -1524, 1067, 2363, -1196, -2886, 2180, -3312, 747, -254, 2916, -903, -294,
+  -2176, 1695, -4485, -990, -1392, 3422, -1628, 1152, 2622, -1152, 708, -819, 1352, 1441, -2880, -2438,
+  -749, -984, 630, 606, -2366, 300, 0, -1096, 476, 452, -612, 2793, 1881, 128, 4080, 1130,
+  -1859, 1250, -384, 630, 236, -225, -1856, -1586, 520, -1560, 495, -115, 728, 1620, 1476, -2997,
+  540, 2349, 1764, -321, -4445, 582, -139, 184, -1443, 654, 1656, 913, -1905, 2484, 903, 392,
+  -272, 1582, -805, -2310, 0, 472, -1776, -96, 228, 1440, 1770, -91, -1560, -524, 960, 530,
+  0, 1599, 630, -606, -2366, 1000, -1100, 548, 1071, 339, 612, 532, 990, -1408, -1122, 226,
+  286, -125, -672, -1008, -2478, -825, -116, 854, 2080, 2640, -2871, -1495, 637, -675, 1968, 222,
+  -810, 609, -588, 321, 2921, 97, -1112, -460, 444, -1417, -552, 664, -508, 1080, 0, 0,
+  -1088, -791, 1380, -880, 1276, -944, -148, -288, 114, -192, 1062, -637, 1456, -131, 96, -106,
+  749, -4059, -2310, -808, -845, 1100, -1800, -2603, -714, -1130, -714, 1596, -396, -2688, 2958, 339,
+  1287, -125, 384, 1260, -826, -900, -580, 1586, -4680, -960, -396, 805, -637, -2700, 246, 222,
+  -2430, 696, -1176, 107, -127, 582, -2502, 460, 2775, 436, -276, 166, -1524, -1296, 1677, 882,
+  -408, -1469, -1610, 770, 348, 944, 592, -384, 456, 864, -354, -1547, 520, -1048, 96, 1696,
+  -1712, 615, 1575, -1616, 507, 300, 1900, 1233, 2142, -565, 102, -2660, 2178, 1280, 204, -2034,
+  1716, 2125, -288, -630, -590, 600, -232, 1220, 1040, 600, 297, 460, 546, -405, 861, 0,
+  1620, -1740, -882, 428, 1270, -2134, 695, 1472, -1221, -218, 276, -581, -1524, 1080, -387, -98,
+  136, -1582, -920, 330, 348, -472, 2812, -576, -1140, -960, -590, -637, -1352, -786, 768, 1802,
+  -321, -1476, -420, 808, -845, 300, 900, 0, 476, -3277, -1020, -2926, -99, -896, 1122, 113,
+  -1144, 2375, -384, 2898, 1180, 225, -580, -1464, -520, 1080, 1089, -1495, 0, -540, 369, 555,
+  -135, -870, -294, 1605, 1016, -582, -1529, 276, -333, 327, 276, -1162, -1524, 972, -1548, 1078,
+  1360, -1808, 575, -2090, 1160, -2242, -148, -768, -798, -384, 2006, -1092, -2808, 0, -1440, -1166,
+  -749, 123, -420, 404, -1690, -800, -400, -411, -1309, 1469, 306, 532, 693, -768, 612, -1921,
+  286, 625, 864, -630, -472, -1125, 0, -976, -208, -1200, -198, -230, 364, -1620, 861, -2664,
+  -2025, 348, 294, 1712, 0, 194, 3614, -184, -1998, 545, -1518, -581, 381, 972, -645, 882,
+  -136, 678, 690, 550, -348, -708, 1184, -672, -570, -192, 826, -546, -208, -524, -288, -1166,
+  -1070, -2829, 105, -1515, 169, 1000, -700, -685, 714, -904, -918, 1463, -1188, -512, -306, -2486,
+  1287, -250, -1152, 1386, -1416, -750, 1392, 0, -1456, 120, -594, 230, -910, 1755, 615, -1776,
+  135, 261, 735, 1712, -635, 582, 139, 276, -222, -1853, -4692, -415, -2794, -216, 1677, -1372,
+  1224, 113, 230, -1210, -1740, 944, 296, -288, -684, 480, -118, 182, 1248, -131, 96, 212,
+  -428, 1107, -630, -1414, 0, 0, -100, -1096, -2261, -113, 408, -1330, -1683, 256, 0, -339,
+  -286, 250, 1632, -1008, 236, 975, -232, -244, -1144, -960, 990, 460, -1274, -405, -615, -555,
+  945, -174, 2352, -2461, 1143, 388, -1251, 368, 1554, 2180, -3312, 747, 254, 1728, -258, 1764,
+  408, -339, -920, -440, 116, -1652, 296, 384, -570, 192, -1652, 0, -104, 524, -1152, -1378,
+  0, 1107, 105, -606, -1014, 1100, -2200, -1370, -1785, -2147, -1428, 3458, -2079, 1152, -102, 1582,
+  1859, 1500, 0, -2646, 590, 825, -3248, -2562, 1040, 1560, -495, 460, -91, 540, -3813, 888,
+  -1755, -870, -882, -214, -1778, 97, 1946, -1104, -1110, -3379, 2898, -664, 254, -216, -258, -1372,
+  -2312, -1695, -1265, 550, -580, -826, 1184, 4800, -1026, -672, 236, 273, 1352, 3013, 192, 0,
+  -107, 1599, -1155, -808, -1690, 1000, -800, -1918, -476, 1356, -102, 2527, -2673, 1408, -612, -904,
+  2574, -875, 864, 378, -1062, -1875, 928, 3538, -2704, 1440, -2079, -920, -1911, 270, 1722, -1554,
+  -1080, -261, -3087, 1605, 889, -776, -2919, -1932, 444, 327, -1104, -1245, -1016, 1188, -903, 882,
+  -816, 452, 230, 0, 1856, -1416, -2072, -576, 1824, -288, 2242, -1365, -416, -393, -1536, -2862,
+  -214, 1107, 210, -1313, 169, 1500, -100, 1507, -833, 339, 1326, 399, -1980, 512, -1530, -113,
+  1716, 250, -1248, 504, 0, 0, 232, 1708, 1352, 840, -1287, 460, 728, 675, 369, 111,
+  -3510, -1392, 588, 1391, -254, 1358, 973, -368, -666, -327, 276, 747, -127, -432, 774, -98,
+  1360, -339, -1725, -110, 232, -1180, -296, 96, -1254, -192, 1180, 637, 208, 1179, -672, -530,
+  -1391, -1845, -420, -1212, 3380, -1200, -700, -1370, -1428, -1243, -1020, 266, 396, 1024, 1326, -2260,
+  -1287, 125, -864, -1386, -2006, 0, -1856, 732, -936, 720, -594, -690, 182, 1350, -861, -444,
+  -2970, -348, 441, -428, -508, 1455, -973, -1104, -555, -436, -552, -249, -127, -324, 0, -686,
+  136, 226, -920, 1320, -812, 472, 592, -1344, 456, 96, 118, -1274, 1040, 1048, -192, -1060,
+  214, 123, -420, 1111, 507, 400, 200, 1781, -1547, 2034, -3570, -399, -1881, 1408, -1224, -1695,
+  -286, 875, -960, 126, 472, -825, 580, 854, -1144, 1680, -2277, 230, 819, -2025, 1845, 333,
+  2160, 435, 1470, -321, 254, 776, 2085, 920, -555, -109, 2070, -664, 381, -324, -1677, 490,
+  0, 113, 2070, 1210, -580, -2596, -740, -3072, -1026, 1248, 826, 455, -1768, 655, 96, -954,
+  1819, -369, -1260, -101, -2197, -1700, 300, -2877, 2023, -1017, 816, 1596, 396, 0, 1428, -1356,
+  1144, -1125, 192, -630, 1652, -150, 0, -1098, 104, -960, -891, 1495, -273, -1215, -984, 666,
+  -2430, 87, -1323, -214, 762, -873, 139, 644, -222, 1308, -690, -747, -1397, 1836, 516, -294,
+  1360, -678, -345, -440, -580, -236, -740, 768, 1140, -480, 118, -546, -208, 0, -672, 1696,
+  1284, -984, -945, 1010, 1859, -300, -500, -1918, 2023, 113, 102, -931, -297, 384, 102, -1130,
+  -143, -500, 864, 1638, 1416, 750, -464, 1098, 832, -600, -1386, -575, -1365, 1080, 1599, 666,
+  -135, 261, -1764, -963, 1397, -194, -1668, -1472, -1332, -872, -552, 332, -1778, 1728, -2709, -882,
+  -952, -452, 3335, 550, -1508, -708, -1332, 960, -1482, -96, 1416, -1183, 832, 917, 480, -1272,
+  642, 492, -210, -808, -5408, -2400, 200, 137, -119, -678, 102, 1596, 594, -1664, -612, 0,
+  -429, -375, 4608, -126, 1888, 150, 232, -2074, 312, 960, -1287, 575, 2093, -1080, 1476, -1110,
+  -270, 87, -2646, -321, -2032, 3395, 1807, -276, 666, 654, -414, 0, -1016, 1404, 0, 588,
+  2856, -904, 920, 220, -116, 236, 1776, 768, -570, -1056, -472, 819, 1040, 1441, 1536, -1378,
+  1498, -738, -1365, 505, 845, -1700, -200, -2192, -1547, -452, -204, 1862, 1782, 0, -612, 678,
+  2574, 2125, -1824, -1134, 708, 0, -1508, -854, -624, 1320, 99, -1265, 1456, -270, 1353, 1887,
+  -810, 435, -2058, -856, 127, -1455, 2363, 920, 1443, -2289, 2346, -498, 127, 3888, -3483, 490,
+  -816, -1469, -2415, -110, -1972, 472, 296, -672, 1026, -576, 472, -1365, -1560, -3537, -576, -1908,
+  -2461, -984, 3150, 909, -845, 700, 200, 2329, 952, -1808, 1530, -665, -495, -2560, 510, -2034,
+  -429, 2750, -2400, 504, -5192, -1950, -1972, -1220, -104, 1200, -2673, -1495, 910, 675, 4551, 1665,
+  1755, 2349, -294, -2889, -4191, 1067, -1251, 828, 2331, -5123, 2208, 581, -1524, -2592, -7740, -196,
+  -2448, -1017, 1035, -1100, -928, 1180, -1332, 1824, 2736, -1728, 354, 273, -104, -524, -480, 530,
+  -2675, -2214, -840, 707, -1352, -500, -1000, -822, -2023, 1469, -714, -1064, -396, -1792, 2448, -226,
+  143, -2500, -2880, 1638, -826, -2175, 696, -1342, -832, 0, -2475, -1495, -2639, -2160, -246, -1110,
+  -1080, -696, -2499, -2568, -1270, -97, -3475, -736, -1887, -1090, -1104, 498, -1905, -216, -2967, 392,
+  -1768, 1582, 1150, -1100, -3596, 0, -2368, 0, -114, -576, -1062, -91, 728, -5240, -1056, 1378,
+  321, -123, 1050, -505, 0, 400, -1300, 822, 238, 791, 204, -532, 1683, -1280, 408, -113,
+  -1287, 500, -864, 504, 354, 1800, -464, -1586, 1456, -1920, -297, -345, -637, -2565, 615, 1554,
+  1890, 957, 2499, -321, -127, -1261, 834, -2024, 555, 436, -276, 332, 0, 432, 1290, 1470,
+  272, -904, -575, -1650, 232, 2242, -1776, -384, -1482, -1152, -1888, -1092, 208, 1048, 192, 1166,
+  -1391, -1107, -525, -202, -1859, 2300, -500, -2466, -357, 1017, -408, -1729, 1584, -1792, -1224, -4181,
+  286, -250, -768, 0, -2006, -1275, 464, -1342, 104, 2400, -1782, -805, 910, 1215, 1230, 999,
+  1620, -2001, -2793, -107, -508, -2231, 278, -2392, 1665, -2943, -690, -830, -1905, -216, 0, -686,
+  3672, -4407, 1955, 2640, -1508, -1298, -2220, -480, -912, 1920, -944, -3276, -1248, -1834, -1152, 2544,
+  -428, -861, 1155, 2525, -1690, 1200, -200, 1233, 1190, -1356, 204, -532, 693, 896, -612, -226,
+  1287, 1125, -192, -756, -1416, -825, 1276, -2074, 208, -1920, 198, 575, 91, 1215, 984, 222,
+  675, -609, 294, -1819, -381, 291, -834, -2208, 1554, -1308, 1518, -1411, -1143, -2052, 516, 0,
+  -1496, -1356, -345, -1430, 2668, 1652, 1332, 3072, 570, 1344, -590, -91, -1352, -1834, 480, -636,
+  -1391, -492, 315, 1010, -2704, 1000, 300, -2055, -1309, -226, -510, 0, -693, -128, 102, -1695,
+  -858, -2000, 864, 378, 708, -525, -1508, -2684, -832, -840, -792, 1955, -91, 405, -861, 111,
+  -540, -522, -2793, 1177, 635, 194, -973, 552, 1221, 1635, -1104, -664, 762, 540, -1419, 882,
+  680, -226, 2185, 880, -580, -1534, 444, -1344, 228, -960, 118, 1001, 104, 131, 1152, -212,
+  856, -2337, 2205, 1414, -1183, 1100, 200, -1096, 0, -452, 306, -798, 693, -128, -306, -1130,
+  1287, -500, -480, 630, 2596, 225, 696, -1952, -2288, -480, 1386, 1035, 637, 675, -738, 1443,
+  -3645, -609, -2499, 214, 381, -873, -139, 92, 2109, -2943, -2070, -996, -1778, -108, -1935, -392,
+  1496, -791, 690, 330, -696, 1062, 1628, 864, 1140, 288, -2242, -819, -832, -2358, -864, 424,
+  321, -615, -105, 1111, -3380, -300, 700, -274, 119, 2373, -204, 532, -495, 2176, 408, 113,
+  1859, -625, -768, 1890, 118, -375, -348, -244, -1144, 1800, -297, -345, 0, 1755, -861, -2886,
+  -540, -522, -2646, -1391, -254, -1746, 695, -1748, 2442, -436, -138, 996, 1143, 324, -1935, -1274,
+  408, -1469, 575, 1650, -2088, -590, 592, 480, 342, -1152, 0, 364, -936, -131, 576, -106,
+  -428, -1230, 1260, 0, -676, -100, 1500, 1644, -1904, 113, -1020, -1596, 594, -640, -2346, 1130,
+  429, -250, 0, -378, 472, -1050, -928, 0, -208, -1800, -396, -1610, 1001, 1620, 0, -1221,
+  1080, -1479, -1176, 749, -254, 776, 1112, -276, 777, 0, -138, 249, 508, -1188, 2451, -98,
+  -272, 565, 920, 1100, 348, 708, 1480, -1728, 2166, -192, 118, -546, 520, -524, 192, -742,
+  -214, -123, -3465, -303, -3042, -2400, 100, 3151, -238, 2938, -1224, 1596, 1089, 1664, -1122, -339,
+  3718, -3125, 1248, -378, 0, -825, -2900, 854, 1560, -3240, 2079, 2185, 91, 1350, 738, -666,
+  270, -1479, -1029, 1498, 0, -1649, -1251, 368, -1332, 981, 276, -1162, -127, -2376, 0, -392,
+  -272, -2260, -2645, 1430, 0, -2360, -2368, -864, 1596, -288, -118, -1729, -728, -4847, 2016, 0,
+  1177, -369, -105, 505, -4056, -1400, -1000, -1918, 952, 1243, -306, 931, -396, -2176, -204, 226,
+  1144, -750, 960, -1512, -1770, -525, -116, -1098, -728, -1320, 396, 920, 0, -1350, 369, -222,
+  270, -1827, 882, 856, -2032, -1649, 1390, 0, 1443, -2180, 2208, 166, -2159, 1512, 129, -490,
+  544, -1469, 1035, 2530, 348, -1062, -1480, -96, 912, 384, -1770, -364, 1248, 524, 864, -1272,
+  -1284, -2214, 210, -1010, -2197, 400, -200, 685, -3689, -678, -1122, -133, 495, 128, 510, -678,
+  -2002, -625, -192, -630, -1534, 150, 232, -122, 0, 240, -1188, -1035, -91, 0, -2583, -1554,
+  540, 435, -294, -214, 2286, 1261, 139, -552, 111, -1526, -3036, 747, 381, 0, 1290, -1372,
+  1632, -339, 2415, -220, -1392, 354, 592, 2208, -684, -1824, -2714, 1001, 312, 2096, 384, 954,
+  2461, -615, -1785, -1010, 2704, -1000, -300, -1233, -2499, 226, -2040, 3591, -1584, 2560, 2244, 678,
+  1573, -3125, -480, 630, -1180, 1650, -580, -1342, 936, -1080, -594, 805, -546, 270, -1722, -999,
+  -135, 870, 588, 642, 0, 1358, -4587, 552, 555, -3924, 1104, 747, -1397, 2916, 2580, -588,
+  -408, 1582, 1610, -880, -696, -1062, -2072, -192, -2508, 960, -1770, -455, 936, 917, 1152, 1272,
+  -1284, 0, 210, -2121, -676, 100, 100, 0, 357, -113, 102, 2394, 99, -1152, 612, 565,
+  2002, -3375, 192, -252, 472, 300, 348, 1708, 2184, 360, 792, 115, -819, -675, -3198, -999,
+  675, -957, -4116, -1605, 1016, 97, 3058, 736, -111, 2071, -966, -498, 1143, 540, -1290, 98,
+  544, 678, -3105, -1870, -812, -1062, 444, 768, -912, 0, 236, -455, -1664, 2227, 0, -848,
+  -856, 1968, 1050, -404, -1859, -800, 400, 274, 1666, 1243, -510, -1330, 495, -512, -1122, 113,
+  -1287, -750, -864, 630, -708, -825, 0, -122, -1248, 1440, -297, 115, -182, -1215, 1353, 666,
+  -1080, -522, 1617, -1284, 127, 1261, 695, -1012, -1110, -218, 966, -166, 1397, 540, -645, 98,
+  -2584, -452, 690, -440, 580, -708, -1480, -1344, -114, 672, -708, -91, -1560, 1703, -288, -212,
+  963, -861, -735, -909, -3887, 200, -2200, -1096, -119, -565, 102, -1596, -891, -2304, -1224, 1130,
+  858, -2250, 1728, -2394, 944, -75, -1856, 1098, -1040, 480, 1782, 2645, -91, 1485, 615, -1443,
+  -3105, -87, -588, -1712, -1651, 1164, -695, 644, 1554, 872, -1656, 332, -1270, 0, 516, 1078,
+  -3536, -678, 345, -2310, -1160, 2596, 1332, -864, 684, -768, -2242, 1456, -624, -524, 288, 636,
+  963, 123, 1575, 0, -2028, -200, 700, -2192, 1428, -1130, -1428, 1330, -99, -256, -1326, 1243,
+  -1287, -1000, 1344, 252, 1062, -300, 116, 1464, -1144, 1920, 1089, -690, 273, 2160, 123, -2220,
+  -540, -2001, -1029, 535, 1778, -776, 1668, 1380, 1443, 763, 1656, -2158, -2540, -2052, 2451, -490,
+  136, -565, -345, -220, 928, 826, 148, 576, 1596, 1536, -1652, 1365, 2392, -2227, 0, 1378,
+  535, 1353, 105, 404, -2873, -1000, 1600, -3014, -1190, 678, -204, -1729, 297, 896, -1122, 1243,
+  -3432, 1750, -768, 252, -236, 525, 2204, 488, -208, -120, 0, 230, -1365, -675, -615, -888,
+  1215, 522, -1911, -321, -762, 0, -139, -276, -333, -436, 1242, 332, -1651, 648, 1290, 882,
+  544, -1243, 0, -770, -928, 590, 1332, 672, -456, -288, -118, -728, 416, -655, 288, 212,
+  -3317, -984, -3150, 1212, 169, 600, -1500, 0, 833, 1243, -1734, -133, -693, -1280, 2244, 1017,
+  -715, -625, 384, -630, -236, -600, -812, -1830, -1352, -1440, 1386, -230, -1092, -2700, -1968, -2220,
+  -675, 1653, 3675, 1819, -2794, 873, -973, 1288, 1554, -1308, 1518, -249, -635, -540, -5160, 686,
+  -136, 565, 115, -2310, -1276, 3068, 1628, 2208, 342, 864, 354, 2548, -1144, 786, 1920, 0,
+  642, -2460, -2100, 1717, -1690, 500, -1100, 0, -3927, -339, -1530, 931, -1089, -384, 1020, 678,
+  0, 0, 1152, 882, 1416, -225, 580, 2440, -1768, 840, 2871, -1150, 91, 405, 0, 999,
+  -3645, 435, -294, -1712, -762, 1067, -139, 1288, 111, 436, 1242, 664, -2159, 1296, 0, -392,
+  -1904, 1469, 230, -440, -1276, -1416, -1184, -1632, 342, 2592, -118, -364, 1872, 1441, 672, -318,
+  -856, 246, 1260, -1111, -676, 2300, 400, -1781, 476, -1017, 510, 665, 0, 0, 816, -339,
+  -715, 125, 1248, 1008, -944, -525, 1160, 1708, -416, -480, -495, 115, 1001, 0, -615, -1110,
+  -945, 522, -294, -642, -381, 873, 417, -1932, -1110, 218, -138, 1577, 2921, 1080, 645, 0,
+  -1088, -678, -1495, -1100, -232, 590, -444, 576, 456, -768, 1062, -1547, 728, 655, -576, -2226,
+  428, 123, 735, -2727, -2197, -1600, -800, -2329, -357, 1469, 306, 399, -990, 256, 204, -3390,
+  1430, -4000, 1728, -1260, -708, -525, -1624, 122, -1872, -2160, 0, 1265, -455, 1350, 615, -2442,
+  1755, 435, -2646, -2140, 0, 1067, -2085, 1012, -1332, 1526, -1932, -913, 635, -864, 2193, 686,
+  2040, -452, -3335, -2310, -1508, 2124, 148, -288, -114, -1632, 944, -1183, -520, 393, 96, -1166,
+  2140, -1599, 0, 1313, 338, 1700, 100, -2192, 1190, 1017, -510, -798, -198, 640, 102, 2825,
+  -858, -1000, -672, -504, 1416, -300, -1508, -244, 624, 2280, 1188, -230, 819, 2700, -615, 1887,
+  -675, 783, -2058, -1070, 1778, -1649, -1112, 920, 1110, 872, 690, 1660, 889, -1512, 3354, -1078,
+  -1360, 904, 575, 880, 1508, -590, 296, -672, 684, 1152, 472, -1183, 936, -1441, 1440, -424,
+  -535, -1599, -420, 1111, 1690, -200, -1700, -1644, 0, 791, 816, -665, -2673, -2048, 816, -1469,
+  1287, -1875, 384, -1008, 236, -1125, 1740, -732, -2704, 1200, -990, -690, 1092, 135, -1353, 999,
+  -1755, -1914, -882, 642, -635, -388, -278, 92, -1110, 436, -1104, -1909, 1778, -648, 0, 588,
+  -680, 452, -1495, -330, 0, 1298, -296, 288, 1254, -288, 472, 91, -1248, -393, -384, 636,
+  -1391, 369, -1260, -1616, 3211, -700, -1300, -959, 595, 678, 510, -1862, -1584, 640, -1224, -339,
+  1144, -2500, 96, -1386, -1416, -1125, 1624, 1098, -1768, 600, -891, 345, -2002, -1215, -1230, -1332,
+  270, -1392, -1029, 1070, -635, 970, -1946, -276, 444, 981, 414, -2075, 762, -2592, -387, 784,
+  -136, 678, 0, 110, -696, -826, 1628, -576, 228, -672, -118, 1547, -728, -1179, -1152, -106,
+  -2033, 861, 105, -2121, 1521, -1000, -1600, -1233, -238, 565, -408, 665, -495, -768, 306, -904,
+  3575, -625, 288, -1134, 118, -600, -580, 488, -1248, -840, 792, 0, 273, 1890, -492, -999,
+  135, -1566, -735, 535, 1143, -873, 695, 644, 1554, -1526, 1656, -913, 254, -216, 1806, -98,
+  1224, -904, 575, 0, -1508, 590, -148, 1056, 1482, -192, 472, -1820, -2184, 1441, 288, -1272,
+  1070, -492, -840, -1111, 1859, -500, -300, 0, 238, -678, -1938, 1197, -1287, 0, 1734, -226,
+  1287, 2500, 864, 2394, -1534, -750, -232, -1220, -1664, -360, 2475, 920, -1092, -1350, 738, 0,
+  -540, 783, -2205, -1498, -1397, 679, -417, 0, -1998, -2507, 1104, -1411, 127, -540, 129, 784,
+  -680, -678, -460, 0, -1044, -826, -740, -288, -798, -480, 1888, 546, 1040, 131, 1152, -530,
+  -214, -123, -1575, 808, -845, -500, -1900, -1370, -2737, 339, 1224, -266, -1188, -768, 408, 1695,
+  1573, -500, 384, 1386, -708, 375, 1276, -244, -1248, 360, -792, 1955, -728, -2700, -1230, 444,
+  270, -1044, -3381, -214, 2032, -679, -1390, 460, -444, -5341, 4692, 581, -889, -432, -2709, -196,
+  3672, -2486, 1380, 440, 232, -1888, -740, 480, 570, -480, -1770, 910, -3016, 393, 2112, 424,
+  856, -1107, 2520, 404, 1183, 2300, -1200, 1781, -476, -113, -306, 1463, -99, -2176, -204, -226,
+  3003, 2000, -1632, -1008, -2242, -1875, -580, 3416, 416, 1320, -297, -3105, -2275, -1890, 1968, 2553,
+  1215, 522, -1470, -428, -762, -873, -1112, 460, 1554, -763, -1380, -913, -635, 756, 1419, 784,
+  -2176, 339, -1725, -2530, -464, 472, 1036, 1344, -2622, 1632, 1652, 1456, -728, 655, -960, 636,
+  856, -1968, -1680, -202, -2197, -1100, -800, 2329, 952, -339, -1632, 798, 99, 640, -306, 339,
+  1001, -750, -1152, -378, 0, 525, -1044, -1342, 624, -2280, 990, 460, 1820, 1080, -246, -999,
+  -2025, 348, 2058, -2461, 2159, 485, 1390, 0, 999, 1635, 2070, -581, -1016, -108, -903, -98,
+  1088, 1017, -2530, 110, -580, -1416, -888, 1248, -2052, 1728, -826, 637, 312, 393, -96, 0,
+  856, 984, 1890, -1111, -1859, -700, 0, -548, 476, 4068, -204, -2261, 594, -3456, -2856, -4633,
+  -2717, -625, 96, -3906, 590, 600, 2204, -1586, -4056, 960, -990, 115, 91, 540, -123, -1110,
+  540, -870, 2205, -2568, -2159, 679, 0, -368, 1887, 1744, 552, -913, -2413, -1620, -258, 392,
+  2312, -1808, -2760, -2420, 1392, 1534, 1480, 672, 684, -1536, 3658, -1729, 104, 1572, 384, 318,
+  -1712, 861, -1365, -707, 676, 600, 1100, 2055, 238, -2599, 204, -2926, -1683, -1024, -918, 452,
+  -1430, -3875, 672, -1512, 826, -900, -2552, -1220, -936, -960, 99, 2415, 1183, 3510, 0, 666,
+  -810, 87, 1323, 963, 0, -388, 1668, -1656, -2553, -654, -828, -332, 3429, -2592, -774, 294,
+  408, 2260, 2185, -330, 232, -590, 444, -576, 1482, -192, 2124, -1274, 1352, 1179, 1248, -2862,
+  749, -492, 105, 1212, -2873, 2000, -400, -274, 119, -113, -1632, 2394, -792, 384, -1734, -1130,
+  715, 2125, 1248, -1638, -118, -675, -2204, 976, 624, 1320, -2079, 230, 182, -2430, 246, -1332,
+  1350, -1392, -1029, 535, 2667, 679, -2085, 276, 1221, 0, 552, 830, -127, -324, -1419, -1470,
+  1224, -791, 805, -660, 232, -944, 3700, 0, -684, -480, 236, -455, 1144, 262, 384, 106,
+  -963, -1476, -840, -1313, -2197, -400, 200, 959, -119, -1356, -1122, 931, -297, -1280, -204, 1356,
+  1001, 1000, 384, 1386, 2006, 0, 232, -976, -3120, 840, -1089, 1840, -728, -675, -123, -555,
+  945, -609, -2058, -642, 508, 388, -278, 828, 1887, -436, -1794, -2407, 1397, -3240, -1032, 0,
+  1496, 0, 1150, -220, -1160, -826, -1036, 960, -684, -384, -826, 91, -1144, -1572, 96, 848,
+  -1498, 1845, 105, 2020, -1690, 800, 1400, -1644, -833, -565, -306, 1330, -495, -512, 1224, 339,
+  3146, 1000, 384, 504, 1062, -525, 1044, -1342, -104, 240, -990, 0, 455, 810, 0, -333,
+  -675, 0, 294, -749, 889, 194, 139, 460, -555, 109, 690, 830, -1270, -324, -1419, -1960,
+  -680, 1243, 2760, 220, -116, -1298, 888, 768, 798, -384, 1062, -91, 1976, -655, 576, 106,
+  321, -1722, -2835, -404, -2873, 100, -1800, 137, -2499, -1130, 1326, -665, 792, -1664, -1428, -904,
+  -143, -500, 96, -1764, 1534, 1275, 1044, -1098, -208, 1560, -1782, -920, 1911, 405, 615, 111,
+  405, 174, 2940, -107, 508, 97, 417, -92, 0, -1526, -2484, -1162, 1524, -432, 0, 1568,
+  0, -678, 690, -660, -232, -2478, 1924, -1440, 228, -96, -1652, -1547, -936, 1441, -1344, -1484,
+  -1926, -984, -105, 2323, -5408, 2100, 3100, 2055, 714, -226, -2958, 0, 1188, -2432, -1326, -1695,
+  2717, 2000, -2304, -252, 1062, -525, 2204, -1342, -3120, 960, -3564, -1840, 2457, 945, -1353, 777,
+  1215, -261, -6027, -1391, -1524, -485, -3197, 1472, 3441, -981, 276, -1328, -889, -756, -3354, 980,
+  -1224, -1130, -2875, -2200, -3364, 826, -296, 960, -114, -1344, -708, 2912, -1872, -2882, 192, 3286,
+  321, 492, 735, 909, -845, -1600, 1300, 0, 595, -3051, 1122, 798, -495, -128, 1530, -791,
+  429, 875, -192, -2142, -472, 1275, -1624, -122, -2288, -2640, 1881, -2300, 2366, -810, -1353, -222,
+  270, 1044, 588, 1926, -1778, 485, -1390, 368, 333, -2071, 966, 913, -1905, -108, -1677, -196,
+  -136, -3503, -2990, 660, 1972, 1534, -740, 768, -2280, 672, -590, 455, -312, 2227, -1152, 318,
+  -1391, 0, 0, 404, -845, -200, -200, 274, 476, 1356, 612, -1330, 594, -1664, 510, -2373,
+  -2145, -500, 768, -1386, -1652, 525, 1972, 366, -1560, -1080, -1287, -1610, -1274, -135, 2706, -1221,
+  2835, 870, 2940, 107, 762, 388, -2780, 552, 555, -436, -690, 83, -1143, -756, 1161, -980,
+  -1224, -339, 2185, -770, 348, -1888, 444, 0, -114, 1440, 1416, 91, 208, 524, 288, 636,
+  428, 1845, 1260, -1515, 1183, -900, 500, 1096, -2975, -565, 3162, -1596, -1485, -128, 816, 2034,
+  4147, 0, -768, 3654, 1416, -1725, 1972, 854, 0, 480, -2277, 1380, -1365, 1080, 246, -222,
+  -3780, 0, -882, 1177, 508, -3395, 4587, -1840, -4218, 1308, -3312, -830, -1016, 1620, -4128, 1176,
+  1224, -5763, -2415, 1100, 464, -1652, -2664, -1824, 1254, -864, 944, -1274, 312, 655, -1344, -848,
+  107, -4182, -2730, -707, -2028, -2100, -2300, -4247, 2380, 339, -2754, 4921, -1881, 1280, 1734, -4181,
+  2431, -375, 2784, -882, -3304, 150, -1624, -1830, -104, -1080, -2475, 1610, 728, -135, 2337, -1110,
+  1350, 609, 1029, -1712, -889, -776, -139, 2024, 4884, -4033, -552, -2324, -3048, 1404, -1935, -686,
+  1768, -3729, -920, 1540, -1624, 2596, 2220, -768, -2508, -96, -2596, -182, 208, -2096, -768, -530,
+  107, -984, 1155, 101, 1014, 1300, 300, -548, 357, -791, 918, 266, -1980, -640, 612, -1017,
+  -1716, 750, 960, -252, 826, -75, -1972, 488, -520, 360, 1089, -230, 546, -2025, 984, 111,
+  -135, -1392, -4116, -107, 1397, -679, 1946, 368, -1554, 1308, 690, 332, -762, 216, -2193, -588,
+  -2040, 2147, -690, -1210, 0, 472, 888, 1344, -1026, 1248, -2124, 819, 104, -262, 288, -424,
+  -428, -123, -1995, -1414, 2197, 1000, 500, -3151, -2142, 339, 1224, 1463, 0, 1792, 1122, -2260,
+  -3003, 500, -1440, -1638, -1298, -150, 580, 1220, -624, 1920, 0, 1150, -910, 2160, -2337, -777,
+  -1755, -261, -735, -214, -889, 388, -2363, -368, 555, 654, -2484, 664, 254, 1296, -1290, -1666,
+  -816, 565, 345, 550, -1972, -1652, 888, 480, -2052, 0, -826, -546, 728, -524, 672, -212,
+  -107, -1353, 1365, -303, 1183, -1800, -2000, 685, -238, 0, 918, 1064, 198, -128, 204, 1356,
+  -1859, 750, -1248, -2016, 1180, 0, -696, 1342, -312, -2160, 693, 115, 1911, -405, -1230, -444,
+  -675, 1218, -1764, 963, 1143, -485, -278, -460, 666, -1526, -552, 498, -1524, -1728, -2193, 392,
+  0, 1130, -1035, -1100, -348, 0, 444, 960, -1368, -576, -1652, -273, -2080, -3406, 288, 1802,
+  -2354, -1476, -2415, -303, 338, 0, -700, -2055, 238, -1017, -714, 0, -693, -512, 204, 226,
+  -1144, 1500, 480, 378, -1298, -1950, -812, 488, -104, 2040, 1386, -575, 1365, -945, 738, -444,
+  -540, -348, 294, -214, -1270, 388, -1112, 920, 1887, -1417, -276, 249, 381, -2808, -1032, 1274,
+  952, 452, -920, -110, 1276, -472, -1480, -960, -1026, 576, 472, 364, 832, 2227, 96, -1696,
+  856, -2583, -630, -3333, 5577, -4000, 3400, -959, -1190, -2260, -2448, 1463, 1980, -640, 2142, -113,
+  0, -3250, 1344, -504, 1298, 525, 3364, -488, 1664, -960, -990, -1265, 273, -270, -3444, -888,
+  675, 609, 588, -963, 381, 1940, 556, -2024, -2997, 2834, -3174, -664, -254, 4320, 258, 1176,
+  0, 113, 2300, 990, -3828, 0, -888, -1344, -570, 2112, -2596, -2275, 1040, 1703, 480, -1166,
+  321, 2583, 0, -1616, 2366, 900, -1300, -411, -2975, 1017, 0, 133, 297, 512, -1428, -1695,
+  858, -1625, -192, 882, -1416, 375, 1044, 1098, -208, 1080, -1188, 460, -455, -135, 246, -666,
+  0, -174, 882, -321, 0, 1552, 0, -92, -1665, -545, -1794, 0, -2286, 108, -1290, 2254,
+  -2040, 904, 115, -1760, 232, 1062, 740, -192, -456, -384, 1534, -637, -832, 1310, 1344, 2120,
+  -535, -615, -1260, 303, 845, 900, -600, -1370, -1547, 113, -1632, -1197, -693, -4480, 0, -1130,
+  -715, -2500, -864, 378, -1416, -1125, -1276, 244, -832, -600, 99, 1150, -273, -1485, -492, -111,
+  405, -609, -1176, -856, -762, 291, -417, 1196, -222, -654, -1242, -830, 1270, 432, 1290, -1078,
+  -1632, -1356, 575, 220, -1044, -472, -296, 1344, 114, -1728, 0, -91, 624, -786, 960, -1060,
+  -107, -1230, 1365, 909, -1690, 0, 300, -1370, -833, -1243, 1326, -266, 990, 896, 204, -791,
+  1144, -1125, 288, -1134, 1770, 525, -1044, -732, -1352, -720, -1386, -920, 1456, -2160, 984, 555,
+  1485, -1914, -2793, 749, -889, -873, -417, -1104, -111, 872, -1242, -2490, -254, 108, -2967, -1078,
+  2312, 791, -1035, -550, -1160, 2478, -888, 0, -1482, -768, -3658, -1365, -3536, -524, -1824, 212,
+  -749, -2460, -630, -1616, 4901, -1400, 0, 1370, -1785, -1582, 714, -1197, -1584, -3968, -918, -1808,
+  1716, -1875, -96, -252, -472, 2025, -2436, 610, 104, -1080, -792, 115, -1365, -540, 615, -2109,
+  1080, -1131, 1176, 1284, -127, -97, -695, -460, 555, -763, -828, -1660, 0, 972, -387, 686,
+  544, -113, -1035, 550, 1508, -2124, -1924, 0, 2052, 192, 944, -1638, -2080, 786, -1632, -318,
+  -107, -1230, -840, -808, -169, -600, -100, -137, -1785, -565, -1122, 1064, -990, 0, -510, 1582,
+  1573, 2250, -96, -1008, -472, -450, 0, 610, 1976, 1320, 99, -230, 273, -675, -738, 2109,
+  -540, -522, -441, 1070, 2286, -291, 556, -184, 1443, -218, -1518, 249, 1524, -1728, -1677, -784,
+  -2448, 1243, 1955, -220, 464, -2006, 2220, 864, 114, 288, -118, -364, 416, -2096, 0, 424,
+  -642, 246, -840, 0, 2535, -1100, 300, 1918, 2023, 565, -1836, 2261, 594, 640, -612, -678,
+  1716, 1375, 576, 1008, 236, -300, -812, -1464, -104, -600, 594, -460, 728, 1485, 492, 1332,
+  -270, 696, 3381, -107, 1016, 388, 2085, 368, 2442, 545, 2208, -996, 1524, -3564, 3096, 0,
+  1768, 339, 575, 880, -1740, -1180, 148, -480, 0, -864, 2242, 455, 208, -2096, 1344, -742,
+  -535, 492, -105, 202, -169, -700, -1000, -3973, -595, 339, 612, 1463, -99, -256, -1632, -565,
+  -2145, 625, 384, 378, 590, -1425, 2668, 244, 624, -1440, -3168, -115, -1820, -1080, 123, 111,
+  -675, 609, -1617, -963, -635, 291, -834, -1104, 0, 872, 690, -913, 1270, -1080, -129, -980,
+  136, -339, 1610, 770, 2088, -2242, -2812, -960, 1254, -192, -944, 1001, -936, -3144, 0, -636,
+  2675, -615, -630, 303, 169, 500, -700, -1918, -833, -113, 0, -133, -891, -896, 204, -791,
+  143, 750, -1824, -2268, 236, -1500, 580, 1830, -1560, 2280, 0, 115, -1547, -1350, 861, 1221,
+  1350, -1653, -1323, -535, -1397, 970, -1668, 1104, -1221, 545, -1932, -1079, 1143, 108, 2709, -882,
+  -816, 113, -2415, -2090, -580, 354, -1036, -384, -1368, 96, 1770, 2093, -520, 3275, -768, -1802,
+  -749, -492, -630, 909, 0, -200, 100, 1370, 1309, 0, 102, 3458, 1881, -1152, -714, -452,
+  -143, 250, -1344, 882, -1062, 0, -1160, -3782, -208, -840, 396, 690, -819, 2565, -492, -666,
+  405, -696, 588, -642, 254, 582, -834, -1472, 2664, 981, -2070, -1079, -1397, 648, 2838, -1470,
+  272, -2034, 345, -1210, -1392, 2006, 592, 384, -798, 672, -826, 1092, -416, -3275, -96, 1802,
+  428, 2460, 840, 1010, 1183, -1600, -1700, 274, -2737, 113, 2754, -2128, 1089, -896, 102, 226,
+  858, 0, -480, -1512, -1416, -675, 348, 244, 1040, -960, -792, -1840, -1001, 2025, 738, 1998,
+  270, 1392, -147, -107, 254, -776, 1390, -460, 111, -981, 414, -2490, 1016, 0, 516, -98,
+  952, -904, 690, -2860, -580, 590, 1036, -1632, -1368, 288, -1298, 91, -2184, -1965, 576, 1166,
+  -749, -984, -840, -2424, 338, -200, -1800, 548, -833, 1808, -204, -266, 990, 2304, -408, 0,
+  -3575, -3375, -1344, 126, -708, 750, -232, 1464, 312, -480, 99, 3105, 637, -2295, -861, 333,
+  1350, 87, 4263, -535, -2032, 1746, 834, 184, -1332, 981, -3588, -1245, 3429, 216, -1161, -98,
+  2176, -565, 1150, 1980, 696, 0, 888, 192, -912, 576, 708, -455, 2392, 2096, 1152, -1060,
+  -642, -615, -2835, -505, 4225, 800, -300, 0, -1785, 678, -2142, 1596, -99, 384, 714, 904,
+  1716, -625, -1920, -252, 1180, 750, 2552, 488, -104, 1680, -1782, -2300, 819, 1080, -1353, 1110,
+  1620, -1131, -294, 1284, 381, -2425, 1251, -2484, -555, -1526, -1518, -1245, 1778, -324, -1677, -1764,
+  -136, -1695, 3105, 3410, -1856, -2596, 3848, 1152, -2280, 576, 708, -1001, -832, -262, -2496, 1272,
+  -3638, 1722, 2100, -202, 2197, -1400, 1700, -548, 833, 1356, 306, 532, -198, -1152, 1734, -1017,
+  143, -125, -288, 1260, -2006, 225, 1044, -1586, 312, -1560, -198, 115, -1365, 405, 0, 1110,
+  -675, 957, 2205, 428, 381, -1843, -278, -460, -222, 1308, 414, 581, -3175, -432, -2451, -392,
+  -272, -1921, 1035, 1870, 696, -236, -2368, 1440, 2850, -1728, -708, -546, 208, -5502, -288, -1272,
+  642, -123, -1155, 3232, -338, -300, 400, -274, 238, -452, -714, 266, 297, 128, -204, 565,
+  143, 875, 864, 1134, 1062, -1350, 348, -1098, -208, -2160, 594, -920, -2184, -675, -123, -555,
+  -2025, 1914, -1029, -963, -2286, -1164, 1251, 1196, -2331, -218, 2622, 332, 762, -1620, -129, 1176,
+  -1088, 1017, -2070, 550, 2436, -1770, 0, 768, 570, 1728, 2124, 1729, -728, -524, -672, -530,
+  642, 984, -1155, -202, 1352, -1200, 300, -2329, 0, -904, 204, -931, 396, 1152, -1530, 113,
+  -2574, 125, -96, 2268, -944, 1725, 0, 122, 312, -120, -1089, 4025, -546, -2025, 738, -666,
+  -1755, 1044, 0, -1712, 2032, -97, -1390, -184, -777, 218, 2070, 498, 1016, 1620, -2064, -686,
+  -816, -339, -2185, -220, 1276, -590, -148, 2208, 1140, -576, 118, 91, 624, 131, 1440, -106,
+  0, -369, -1365, 505, 338, -400, -400, -1507, 833, -904, -102, 532, 891, 1280, -204, 904,
+  -572, -375, 288, 378, 1062, -525, 348, 2684, -936, -3120, 0, 1725, -1001, -2565, -1230, 777,
+  -3780, 1131, 1764, -1712, -254, 291, -1390, 552, -2220, -1308, -2346, 1079, 889, 648, 0, 882,
+  -136, 1017, -1265, 0, 1276, 118, -1332, 672, -1710, 1056, 1298, -819, 1664, -1965, 864, -954,
+  1605, -246, -1890, 606, -1859, -800, -1100, 548, -833, -1130, -102, 1064, 1485, -1408, -408, 1017,
+  0, 500, 192, -1764, 1298, 975, -348, -1342, 1248, -1440, -891, 2185, 819, -675, -2706, 1221,
+  -2565, -174, -735, 321, 762, 388, 973, 184, 1110, -1308, -1242, -166, -1905, -648, -387, -2450,
+  -952, -2599, 345, -110, -812, -2714, 1332, 288, -114, -2688, -1180, 364, 936, -1048, 1248, -318,
+  -428, -984, 735, 202, 338, -1000, 500, -1096, -1071, 452, -1122, 133, 1386, 1280, -408, -1356,
+  572, -875, -864, 630, -1298, 825, -1856, -2318, -936, -2880, 495, 2875, 0, 945, -1353, 222,
+  -6750, -1218, -1617, 1070, 127, -1164, 2085, -2116, -2442, 327, 966, -581, 1016, -1188, -1161, -294,
+  -1904, -904, -1495, -1650, 464, 354, 1924, -1920, -684, -384, -118, 91, 1352, -655, 0, -3710,
+  749, 492, 1365, 1212, 676, -300, -1200, -1507, 238, -904, 102, 2394, -297, 1792, -1224, 678,
+  2574, -375, 384, 882, -2124, -1875, -1044, -1708, -1144, -1560, 99, 2070, -455, 4320, 1230, 0,
+  -1350, -3132, -2205, -1284, -1651, -194, 2224, 276, -444, -1962, -1794, -1079, -1397, -1728, 1806, 686,
+  272, 339, 920, -1100, -116, 944, -296, 864, 0, 1344, 826, 910, -832, -655, 1824, 1060,
+  -214, 615, -630, -606, -3042, -400, -300, 411, -357, -226, -1122, 1862, 0, -1024, -1020, 113,
+  1859, -1750, 480, -2772, 2124, -600, -348, 610, 1560, 1800, 2178, 575, 637, 1485, -1722, 666,
+  0, 1044, 735, -1712, 1270, 485, -556, 1840, -1776, 1526, 1104, 166, 1143, 1080, -1806, -294,
+  -1768, 2034, -230, 0, -464, 472, -1332, -960, -570, -1440, 354, 91, -1456, -262, 192, -1166,
+  1819, -1968, -2205, -1212, -1521, -1500, 1000, -2603, -1071, -2712, -1326, 133, -1089, 1024, 1122, 1808,
+  0, -2875, 1920, -1134, 944, -675, -696, 488, -1872, 600, 1980, 1955, 91, -1080, -1968, 666,
+  -3780, -696, -1176, -963, -1778, 1067, -2641, -1932, -666, -218, 138, 0, -508, 972, 516, -1666,
+  -952, 1695, -2415, 440, -1160, 944, -1480, -1056, 684, 768, -944, -546, 832, -917, -384, -424,
+  -4494, -861, -840, 808, -1183, 0, -1000, 0, 2380, -1582, -1224, -266, -396, 1024, 1938, 1582,
+  286, 1500, 1728, -1008, -2478, -375, -928, -366, -1872, -1080, -693, -1840, -1183, -405, 2214, -777,
+  -270, -522, -735, -2033, -2032, 1261, -139, 1656, -1332, -1199, -276, -83, -762, -756, -1290, 392,
+  272, -1243, -1610, 770, 1392, 590, -296, 672, 798, 960, 1180, 364, 1040, -262, -768, 1272,
+  -107, 861, 1680, -101, -338, 1000, 800, -2055, 952, 2486, 1224, -1330, -2079, 256, -1734, 1243,
+  -1001, -1000, 2688, 1260, 1416, 0, 464, 1342, -1976, -1440, 396, 115, -819, -405, -492, -777,
+  -810, 261, -2940, -1177, 0, 485, -278, -644, 222, 545, 138, -1577, -1397, -1188, -2709, 588,
+  -136, 0, -1265, -660, 1740, 1180, 148, 1248, 456, -864, -1770, 546, -104, -1310, 1344, 1696,
+  -856, -492, 1680, 404, 338, -500, 2200, 685, 1071, -791, -102, 399, 297, -2048, -204, 1469,
+  -3575, -1875, 2688, -756, 1888, -1125, -232, 122, 832, -600, 396, -460, -1547, -1485, -3198, -2331,
+  1350, -1653, 588, 1177, -127, 194, -1529, 552, -1554, 2180, -5382, 415, -2159, -324, 774, -490,
+  2040, -113, 1035, 110, 696, 826, -1332, 384, 2280, -288, -354, -1456, -416, -786, -864, -106,
+  535, -3321, -525, -202, 507, -1400, -1400, 1096, 833, 791, 408, -266, -1980, -1280, 1020, -113,
+  -1716, 250, 1632, -2520, 1888, -75, 1044, -1830, -520, -480, 594, -1840, 1001, -1215, -984, 444,
+  2025, 522, -735, 1070, -127, 1358, 1946, 1104, -777, 545, 414, -249, -762, -1836, -387, -1568,
+  2448, 1356, -115, -330, -232, 1298, -592, 768, 1140, 480, -472, -1001, -2496, 524, 96, 1696,
+  -1926, 1353, -210, -707, 845, -900, -700, 2740, -833, 678, -102, -399, -297, -384, 918, -2599,
+  143, -1625, 1632, 630, 472, 0, 1276, 0, 416, -480, -1584, -345, 364, 405, 861, 2331,
+  135, 2610, 0, -214, 1270, 970, -139, 1104, 999, 1635, 1380, 498, -254, 1080, 1290, -882,
+  136, 678, -920, 1100, -1624, 472, -1776, 96, 1368, -864, 590, 0, 104, 1179, 1344, 212,
+  -1284, -2337, -1050, -1919, -2535, -400, 2400, -3151, -4641, 565, -3672, 2128, 1683, -256, 204, 0,
+  -3289, -750, 576, 756, 3894, -2325, -1276, 1342, -1144, -1800, 2772, -115, 91, 1620, 738, -888,
+  -810, 1566, 882, -963, -1778, -194, -278, -3864, -5217, 2398, 414, 1909, 1905, 4212, 1677, 490,
+  816, -2712, -460, -1980, -1160, -472, 1332, -1440, -912, -960, -3422, -1911, 624, 2227, -192, -6254,
+  963, 1845, 630, -101, -2873, -1400, 1700, 959, -2499, -1356, -1734, 1330, 1683, -1280, 2652, -1356,
+  0, -1000, -1248, -1512, 1652, -600, -464, -2440, 1560, -3360, 0, -1150, 910, 675, -123, -1887,
+  135, 435, 1764, -642, -508, -97, -278, 552, 0, 0, -1518, 1826, -1651, 648, -1161, 98,
+  2176, -1921, -1380, 1540, -1160, -1652, -3108, -2208, 114, 288, -472, -273, 208, 131, 1248, -1696,
+  1070, 246, -735, -404, -338, 300, -300, -1233, 0, 904, -102, -1064, 99, -2304, -714, 791,
+  -429, -2125, 2880, 0, 354, -1500, 1740, 2562, -416, -1560, -1188, -2070, 273, 675, 615, -1776,
+  -1485, -1392, -2646, -642, -508, 0, 1946, -644, 888, 1199, -2208, -581, -1397, 1404, -1419, -686,
+  408, 0, -345, 880, -348, 1534, 444, -864, 912, 0, 1062, -1183, 1560, -786, 384, 212,
+  0, -2952, -1260, -1212, -1352, 2500, -200, -685, -3332, -678, -1122, -266, 396, 1152, 1326, -1921,
+  2145, 500, -288, 126, -472, -450, -464, 488, -2392, -1920, 792, 0, -1911, -3645, 1845, -2109,
+  540, -522, -3087, -642, 1270, 1455, -3058, -2484, 333, -545, -828, 830, -2286, 756, 645, 1862,
+  -408, 339, -2530, 0, 1160, 354, 1924, -1824, 570, -2400, 118, -182, 0, -131, 192, -212,
+  1391, -1968, 315, -1414, -3549, 800, 3300, 2740, -3332, -1695, -2142, 399, 891, -1152, -102, -3842,
+  0, -875, -192, 504, 236, -375, -464, -732, -312, -240, 792, 805, 1729, -675, 1722, 555,
+  -135, -522, 1176, -642, -1143, -291, -1251, -460, 2775, 654, 690, 332, 889, 3996, 2451, -1078,
+  952, -3390, 0, -550, -1624, -3068, -1184, -864, 1140, 1920, -1888, -546, -1144, 1703, 576, -318,
+  0, 369, 315, 1313, -845, 400, 700, 137, 1309, 339, 1530, -1729, 0, -2176, -306, 113,
+  0, 1000, 0, -1008, 2242, 150, -928, -366, -1248, -1080, -693, -345, -91, -3240, -2583, 555,
+  -3105, 261, -3528, -1070, 381, 194, -1807, 184, -1443, -218, -276, -1079, -1143, -1080, -1290, -98,
+  -2448, 1017, 345, -550, 1392, 708, -1184, 1824, -798, 672, 1416, 1001, -728, 0, 480, 3604,
+  0, -861, -1995, 303, -169, 800, -3500, -411, -1666, -791, -510, 1064, -2673, 1792, -1020, -1469,
+  3003, 1625, 384, 378, 590, -975, 1508, 366, -1768, 1680, -297, 1610, -2821, -2970, -1107, -555,
+  -270, -1218, -588, 856, -762, -1843, -1668, -184, 888, -1635, -552, 332, 1397, 1080, -1806, 1372,
+  -1496, -565, -575, 330, -1044, 1062, -1036, -192, 798, 768, 472, -2002, 208, -1572, -1344, 742,
+  -856, -246, -210, -303, -1014, -1100, 800, 2192, 1309, 0, 306, 399, -792, -2048, -1224, 1356,
+  3003, -1750, 1152, 378, 2360, -375, 696, -366, -1872, -2280, 297, -115, 0, -810, -2706, -1221,
+  1080, 435, -1470, -1070, 1397, -388, 1946, 1196, 222, -981, 552, -2656, -889, -864, -516, 1666,
+  408, -1130, -230, -660, -464, -118, 296, -576, 1368, -576, -2360, 1092, -1768, 2096, 768, 742,
+  642, 123, 840, 1010, 0, 1600, -1100, -959, 238, -791, -3978, 532, -2871, 128, -1428, -1808,
+  143, -500, -672, -1134, 354, 1800, -2784, -244, 520, 720, 1287, 230, -273, 945, 369, -1332,
+  -1485, -1305, -1470, -428, 2032, -97, -973, 920, 555, -763, 414, -83, -1524, 972, -129, 1568,
+  272, -1356, -1725, 2310, 348, 590, 1332, 192, -3420, 3168, -118, -728, -624, 393, 480, -636,
+  -1605, 2337, -4515, -2222, 1521, -800, -500, 0, -833, -2825, -1122, -2660, 792, -512, -612, 3277,
+  429, -2250, 576, -126, -2478, 300, -1392, 1708, 2080, -2520, -2376, 1150, -637, 2970, -984, -2442,
+  1080, -609, -1911, 4066, 508, -1164, 973, 0, -2220, 327, -2070, 1079, 381, 108, -129, -2352,
+  2448, -452, 1725, 770, 1276, 236, 3996, 672, 2622, -96, -1180, -1456, 728, -786, 960, -1166,
+  1284, 1722, 1680, -303, -1014, 1500, 1000, 1096, 714, 226, 408, 1729, -396, -2048, 918, -452,
+  1144, 625, 480, 126, 236, -225, 0, 2562, -4160, 2040, 1089, -2300, 1001, 1485, -1845, 555,
+  -945, -1740, -2205, 428, 254, -582, -2224, -736, 111, -1199, -4554, -498, -1397, 432, -1161, -882,
+  -2176, -1356, 575, 220, 1044, -1770, 1924, 288, 684, -576, 2360, 1365, -1976, -786, -1056, 212,
+  -1926, -861, -1575, 2020, -3380, 2100, -700, 1918, -1190, 1130, 204, -266, -1386, 1152, 1938, 904,
+  572, -875, -960, -1134, -2124, -525, 696, -1342, -1144, -120, 1188, -690, 1820, -135, 123, -777,
+  405, -783, -294, 1926, 0, 1067, 973, 2944, -777, -1308, -138, -1245, -3175, -4320, -645, -980,
+  -3672, 1356, 230, -660, -928, -708, 0, 480, 0, -192, 1298, 1456, -2912, 262, 768, 742,
+  535, 246, 1050, -303, 5070, 1300, -100, -1370, -238, 1695, -204, -1862, -2772, -640, 204, -1017,
+  1001, 375, -1728, -2142, 1652, -1425, -1856, 2196, -2184, 1080, 0, -1955, -1274, -1080, 1230, -1221,
+  -1080, -609, -882, 642, 1524, 1455, -3753, 552, -3108, -1417, -1932, 996, -254, -540, -774, -1274,
+  -3808, 1921, -1265, -880, 1276, -1416, -592, -96, -1026, -1536, 2950, 455, 936, -262, -960, 212,
+  642, -861, -1155, -2929, -338, -1000, 600, 685, -1666, 339, -612, 2527, -495, -384, 1122, 452,
+  858, -750, 960, -882, 236, -225, -580, -366, -1040, 1680, -2079, -575, 1092, 945, -492, 0,
+  1080, -348, 882, 0, -1778, 679, 139, 1288, 1110, 1199, -1104, -581, 1016, -540, 645, -882,
+  1632, 1130, 2530, 1980, -2784, 590, -740, 288, 114, 288, 1180, 637, 832, 1834, -96, -424,
+  749, -615, -210, 404, 2873, 800, 100, -411, -238, -791, -1632, 665, 1584, 1664, 204, -1130,
+  -572, -125, 864, -1386, 236, 225, 1624, 854, 1248, -960, -495, -575, 273, -2025, -738, -222,
+  945, 174, -3381, 428, 2032, -776, -1807, -1472, -555, -545, 690, -249, 381, -1188, 387, -1372,
+  1768, -904, 920, -330, -3132, -2832, -444, 96, -342, -96, -590, 364, 104, 655, 864, -212,
+  214, -738, 630, 707, 1014, -500, 1000, 822, 1547, -565, -1020, 399, -297, -1920, 306, -565,
+  -1001, -750, 1152, 1260, -590, -450, 1276, 1098, 208, 0, 792, -920, -1365, -2430, 123, -111,
+  1215, -783, -2499, 1391, -1397, -485, 417, 1932, 1332, 654, -552, -166, -1270, 108, 258, 196,
+  1768, 2034, 230, -2200, -1276, -590, 1184, -192, -1368, 1248, -472, -1274, 312, 1572, 672, 1484,
+  642, 861, 945, 1717, 169, 600, -300, 0, -1309, 904, -102, 266, 0, 1664, -1428, 1356,
+  -858, 2875, 96, 1638, -2596, -825, -348, 2196, 1768, 2280, -297, -805, 1820, -945, 0, 111,
+  -675, -609, -1323, -214, 508, -1649, 2780, -368, 999, -436, 1104, -1494, -2159, -2160, -129, 1176,
+  544, -791, 460, -2200, 116, -708, 1332, 0, 114, 480, -118, -819, 104, 1310, 2112, -848,
+  321, 1476, -1365, -1111, -2028, -100, -200, -1507, -357, 791, 510, -532, -594, -1920, -1428, 452,
+  715, -375, 1248, -882, 1652, -2700, 0, -122, -1976, -1680, 495, -230, -546, 2430, 1107, -999,
+  -3375, -261, -1764, -1498, -1143, 1746, -834, -2392, 444, -1526, -1518, -415, -889, 0, 516, 1274,
+  1496, -2938, -1725, -330, -928, 590, -148, -768, 1140, 768, 590, -2821, -1352, -1965, -1728, -2226,
+  1819, -1722, 1575, -1818, 507, 800, -200, -274, 238, -2486, 102, 266, 1089, 2432, 0, -678,
+  429, 125, 480, 3276, 1180, -2325, 1972, -3294, -3120, 1320, 0, -805, 546, -405, 2091, 3330,
+  1755, -1131, -147, -856, -2286, -1261, -3475, -2852, 1665, -1090, -2346, -1245, -381, 216, 3096, 196,
+  -2040, -1469, -920, 110, -1624, 1298, 444, -3648, 0, 960, 472, 637, 520, -3668, 864, 530,
+  -1819, 615, 735, -2222, 1183, -1000, 1400, -137, -476, 1356, -204, 1463, -198, -1536, 816, -791,
+  -1287, 2250, 1344, -1512, 1062, 0, 1624, -122, 104, -2040, 594, -2185, 455, 675, -1722, 0,
+  -135, 522, 1617, -1070, 2540, -873, 1112, 368, -555, 545, -138, -1162, -2540, -216, -1548, 490,
+  544, -565, 460, 440, -116, -826, 888, 576, 1938, 288, 1652, 1456, -1352, -262, -288, 954,
+  -856, -1476, -1365, -1010, 0, -1200, -300, -1644, -357, -1582, 306, 1330, 99, -256, 204, 226,
+  572, -1125, -1344, -1008, 1062, -675, 1508, 1098, 832, -360, 495, -345, -2457, 1080, 0, 111,
+  -1350, 261, -588, -2354, -508, 388, -556, -1012, 888, -1199, -966, -664, -635, 0, -2322, -1274,
+  1632, 1130, 1150, -440, -696, -118, 1184, 672, 570, -672, -354, 0, -520, 655, -192, -318,
+  -856, 492, 210, 505, -169, 100, 800, 1918, 238, -3616, 816, 133, 792, -768, 102, 3842,
+  572, -1750, 0, 1638, -826, 600, 0, 244, -728, -1800, 1188, -1840, 910, 1350, -2091, 0,
+  -2025, 0, 588, 1819, -127, -2619, 4031, -184, -222, 1526, -1380, -2241, 1270, -648, -1677, 1568,
+  -1088, -2599, 1035, 2310, -1276, -236, -592, -96, -1140, 672, -944, -546, -1352, -1048, -768, -636,
+  642, 861, 525, 1212, 169, 900, -800, -1370, 1071, -678, -1734, 2527, -198, 384, -1224, -339,
+  -572, -625, 288, -1512, 236, -825, -580, 1098, -832, 0, 1287, 690, -728, -1215, 0, -2886,
+  -675, 348, 2940, -428, 2540, 2134, -1251, 2668, 1443, 1744, -3036, -1992, -1016, 2268, 1161, 1274,
+  -816, 2486, 805, 1540, 1276, 1062, -444, -96, -1026, -480, -472, 364, -104, -1441, 576, 636,
+  1498, 0, 210, -808, 3042, -300, 800, 0, -1547, -113, -816, -1064, 1386, 1408, 306, 678,
+  572, -1750, 0, -252, 1416, -1425, -1508, -122, 0, 1440, -297, -2185, 455, -1350, -2091, -333,
+  1485, -87, -588, 2782, 2159, -194, 973, 368, 444, 1199, -1794, -2075, 1016, 1080, -387, -588,
+  -1632, 0, 575, -550, -696, -826, 888, 192, 114, -768, -590, 455, -104, -1965, -1632, -848,
+  -856, -1968, -945, -909, 338, 700, -600, -2192, -595, -678, -1428, -399, -990, 256, 1938, 904,
+  858, -1500, 0, -2268, -1770, -150, 812, -976, 520, 720, 198, -230, -91, -1890, -1599, -1110,
+  -135, -1479, -441, -1391, 127, 1358, -1112, 460, -777, -218, -138, 0, 254, -2700, -2064, 686,
+  -408, 339, 1495, -1430, -928, -1062, 2516, -960, 342, 768, -236, 546, -1352, -4847, -672, 318,
+  856, -492, -525, 101, -676, 1200, -800, -4110, 476, 226, -408, -2128, -1584, 512, 0, 0,
+  2145, 250, 1344, 1638, -590, 0, -1972, -610, -1456, -1920, -198, -1150, 546, 2025, -2952, -111,
+  0, -2175, -3528, 642, 2921, -97, -278, -644, 1332, -1199, 1932, 581, 254, -2484, -1161, -784,
+  -272, -1808, -690, -660, 1160, -236, -148, 672, -684, -288, 1416, -91, 104, -1834, 288, 530,
+  -963, 984, 1155, -303, 2366, 300, -300, 3562, -952, -1808, 612, -399, -1881, 1920, -1428, 452,
+  1716, 875, 1152, -882, -118, 300, -464, 2562, 1664, 1920, 2475, -2300, 1547, 270, 1476, -333,
+  1620, -522, 1029, 749, -1397, -1164, 973, -1196, -1221, -763, 0, -1079, -889, -1296, 3096, 1176,
+  544, -678, -690, -990, 464, 826, -1628, -1056, 1824, 1056, 1416, -273, 208, 1834, 480, -2014,
+  2782, -2091, -3150, 1515, -4056, -1600, -700, -137, -2142, -226, -612, -1064, 495, -2560, 102, 1921,
+  -286, 1000, 864, 504, -708, -2775, 2204, 610, -2080, 360, 297, -1380, -182, 135, 615, -1776,
+  135, -609, -2058, -1177, -3429, -485, 695, 920, -333, 436, 2070, -664, -2413, 1944, 2193, -392,
+  4080, -2373, 1150, -1210, -696, -708, -148, 768, -1710, 1824, -3776, 819, -1248, 131, -864, 530,
+  -107, -246, 420, 0, 2028, 2700, -500, -137, -833, -904, -1428, 1197, 495, -384, -1632, 226,
+  -858, -3125, -3072, 378, 354, 525, -2784, -1952, 312, -840, -396, -1495, 728, 810, 246, -777,
+  1755, 1131, 0, -749, -2667, -388, -1112, -92, 1110, -436, -414, -332, -635, -648, 387, 2058,
+  -3128, -226, -575, -110, 1740, -708, -888, 1248, -2964, -1056, -1180, -364, 1560, -1441, 480, 424,
+  -321, -615, -1470, 1313, -1183, 700, -200, -1233, 238, -339, 918, -1862, 1089, -2048, 2448, -452,
+  -2288, -250, 864, -1386, -944, -675, 1276, -122, 520, -840, -693, -920, 637, 945, -1353, -1221,
+  270, 783, 294, 856, 0, 291, -695, 368, 222, -1526, -4278, -1162, 381, -3888, 1290, -2254,
+  680, -2034, -1495, -3520, -2900, -1180, 592, 1344, -2166, -1056, -708, -364, -832, -917, -1248, 1484,
+  -1070, -615, 735, 1717, 1352, -100, -700, -1644, -1309, 2712, 204, -1729, 2673, -1280, 102, -3277,
+  -143, -250, -1824, -2646, 236, -2325, -1740, 0, 832, -120, -2178, -2185, -1456, -810, 738, -999,
+  270, -174, 441, -642, -1016, 1552, -2919, 736, -222, -1417, 1242, -2075, -2413, -3132, 1161, -98,
+  -2448, 2938, 2645, -2200, -696, 590, 1332, 1248, -114, 1056, 472, -1729, -4888, 1179, 1920, -424,
+  -642, -738, 2310, -1414, -3380, 500, -300, -274, 0, 1356, 408, -665, -1782, -1792, -1224, 2147,
+  -572, -1375, -192, 2142, 236, -1125, 580, -1098, -416, 1680, -1287, 1150, 546, 1755, 1353, 222,
+  -540, -87, -1617, 428, -762, 970, 1807, -184, -2109, 2507, 1932, 913, 508, -1944, -129, 1470,
+  -1768, 113, 920, 990, 116, 118, -888, -192, 2736, -96, 2006, 1001, -1352, 655, 1056, -1484,
+  -321, 369, -420, 505, 1859, -300, -200, -1644, -1547, -1130, -2142, 2660, 99, -256, -2142, 113,
+  715, 0, -192, -1386, 118, -150, -116, -1708, -1144, -1680, -792, -230, 364, 675, -738, -222,
+  -2160, -609, 882, 856, 635, 1843, -2085, 644, 444, 327, -1794, -996, -2794, -216, 387, -882,
+  -816, -2034, 3450, 110, -116, -236, 2516, -576, -1026, -1056, -354, 1001, -936, 393, 576, -636,
+  -1391, -1230, -105, 606, 676, 1300, 900, -1370, -1190, -226, -2550, -266, -891, 0, -1020, 678,
+  1144, 250, -960, -1008, 1652, -375, -812, 366, -416, 360, -792, -460, 819, -135, 123, 666,
+  270, 87, -1029, 107, 508, 1940, 0, -368, 1221, 218, -2070, -1162, -1397, 540, -903, 3724,
+  2040, -1582, 920, -220, 696, -1416, 592, -768, 114, -1056, -118, -182, -312, 131, -1056, -636,
+  321, -2214, 840, 1414, -169, 600, 1000, -1918, 238, 339, -2652, 1463, 1485, 896, 102, -2147,
+  2288, 1250, 480, 2394, 472, -375, -464, -366, -104, 1200, 693, 0, -91, 3780, 1968, 0,
+  135, -1305, -147, -428, 635, 1067, 1807, 920, 3219, -1417, 0, 747, 1016, -864, 2064, -392,
+  -408, 339, 1725, 0, -696, 118, 0, 672, 912, -96, 354, -455, 936, -393, 672, 1484,
+  -107, -984, 1575, 707, -845, 600, 200, 1644, -1666, -226, -816, 1197, 0, -640, 816, -1808,
+  -2431, 750, 768, 126, -1062, 675, 696, 610, -832, 960, -693, -1035, -455, 2430, 861, -111,
+  3645, 1131, 294, 1926, 381, -1261, 0, 368, -555, -109, 1242, -581, 508, 756, -1161, 196,
+  -544, 1356, -920, -660, -1044, -2360, -296, -384, -1710, -960, -118, 819, -2288, -1965, 1152, 1696,
+  3103, -861, -3990, -101, -1859, -1100, -1700, -1781, -5712, 3164, 1632, -3591, -1584, -384, -1938, 3390,
+  1001, -6500, -672, -630, 2596, 900, 464, -488, -416, 2280, 1980, 2415, 2548, 0, -2214, -555,
+  -2025, -870, -2205, 1498, 3556, 388, -3614, 1564, 888, 1308, -138, -1245, -3683, -756, 1548, 686,
+  -136, -904, -575, 1870, 2088, -3422, -4144, -192, -2508, -1248, -4484, -91, -1248, -655, 2304, 2438,
+  -1070, -984, -525, -202, 1014, -2400, 100, -3836, -119, -565, -1632, -931, -693, -2176, 1938, -339,
+  572, -1375, 384, 504, -354, -1050, 580, 1586, -1144, 960, -198, -230, -1092, 0, -861, -1443,
+  540, -957, 4263, 535, -1778, -388, -834, -1012, 444, 872, 828, -1328, 635, -108, -1419, -588,
+  1360, -678, 1035, 770, -696, 118, 592, -96, 342, -1152, -2006, -728, -416, 1310, 192, -2756,
+  1819, -2091, 105, 303, 845, 1600, 100, 2329, -952, 1017, 1428, -399, -396, 3456, 714, -226,
+  -1287, -1000, -96, 1890, -354, -900, -348, -976, 104, 120, 1188, -1380, 0, 540, 1599, -1221,
+  270, -87, -294, -535, 889, -1746, 1390, 92, 333, 981, -2622, -581, -381, -1080, 1419, 490,
+  816, -113, -115, 880, -1044, -1180, -2368, -2016, -1938, 1440, -708, -728, 208, 2096, 384, -318,
+  -749, -369, -2415, -1010, -676, -800, 400, 0, -238, 1921, -1632, 2394, -1089, -1152, -1428, -452,
+  3289, -1000, -1056, -4536, -1416, 450, 232, 366, -416, 240, 297, -2530, 2093, 1080, -615, -777,
+  405, 696, -1176, 535, -381, -776, -2363, 1564, 777, 763, 828, -415, -127, -2808, -2967, -882,
+  4488, -1243, 690, -1430, -696, 1534, 1036, -960, 114, 768, 0, 455, -3224, 2227, -1824, 1590,
+  1177, -1353, -1575, -303, -1352, -1000, -100, -548, -238, -226, -2346, 0, -891, 512, -306, 1017,
+  1287, -625, -96, -4284, -118, -1425, 464, 122, 208, 480, -1881, -920, 1001, -270, -738, -1443,
+  405, -1305, -2058, -1070, -1778, 388, 139, 276, 777, 1199, -966, -913, 254, -1728, 387, -392,
+  -816, 1130, -115, -990, -3016, -2124, 148, 480, -114, 864, -708, -455, 1560, -524, -2208, -742,
+  963, -1107, 315, -202, -3211, -2000, -300, -1370, -595, 565, -816, -3591, 1584, -256, -102, 452,
+  -3432, 125, 96, 882, -1534, 300, 348, 488, -104, -360, -693, -345, 1638, -2160, 1107, 0,
+  -675, 1044, 3969, -749, -254, 485, 139, 1196, -111, -1308, 1932, 1494, -1524, 2376, 1161, 1176,
+  -544, 1356, -1265, -1100, 232, -472, 1036, -864, -1596, 1152, -472, -455, 312, 1572, -1344, -848,
+  749, -738, -1785, -1616, -2704, -100, -400, 0, 952, 1130, -1020, 665, -594, 0, -1122, 904,
+  -1001, 750, -384, -1008, 1770, -225, 1160, -488, -832, 240, 2178, 345, -1365, 945, 1353, -1776,
+  -4050, 87, 1911, -1177, 1143, 1940, -1807, 1840, -555, 436, -690, -1245, 254, -2484, 903, 1470,
+  272, -1017, -1840, -660, -232, 590, -296, -1632, -1824, -2592, -118, 1001, -416, -524, -288, -3074,
+  -963, -123, -315, 101, 3887, 2200, 1300, 1507, -595, -1469, -1428, 931, 1980, 768, -714, 565,
+  -429, 1000, 96, 1890, -1888, -600, -812, -1952, 0, -720, 198, 1265, -2821, -1485, -246, -555,
+  -675, 609, 2499, -107, 762, -1455, 2363, -368, -1665, 218, -1380, -830, -762, 756, 129, -882,
+  272, -565, -115, 880, 812, -1416, 740, -384, 1596, 1152, -1652, -182, -1040, 1834, -96, 742,
+  1391, -738, 630, 2626, -3549, 2300, -3000, -3288, -2380, -113, 204, -1862, -1485, 1920, -1326, -226,
+  -1144, 750, -192, 252, -708, -750, 1740, 122, -832, 120, 198, 1035, 637, 135, -123, 555,
+  540, 348, 1911, -1605, 889, 97, -973, -1012, -111, -2180, 4002, 0, -762, -864, 516, 3332,
+  -2448, 1356, 230, 110, -1276, 1062, 1036, 1248, -342, 0, 118, 1820, -936, 2751, 0, 1696,
+  -1070, 738, -105, -1919, -169, -900, -300, -548, -1547, 1017, -1428, 2128, 1485, 2048, -3060, 1469,
+  858, 0, -96, -756, -472, -750, 348, -122, 104, 1920, -3366, -690, -5005, 1485, -1722, -111,
+  1755, -1305, -2058, 963, 127, -291, 1668, 184, -1443, 1199, -276, -2075, 2921, 1188, -516, 980,
+  4760, -1243, -2070, -550, 928, -2596, 1036, -1248, 2850, -576, -236, 1547, -1144, -1048, -1056, -2862,
+  214, -492, 1050, -606, 338, 2200, 600, 959, -1428, -1356, 918, 2926, -792, -1536, 306, 678,
+  -3718, 1125, 384, 1260, 118, 675, -1740, -3294, -624, -720, 198, 115, -182, 3240, -1722, 1443,
+  -1215, 522, -1323, 963, 1143, 291, -834, 276, -1221, -1526, -414, 332, -1143, 540, 1419, 0,
+  -408, -565, -690, -2200, 696, 0, 296, -480, -3420, -288, 708, -1001, 1248, 2358, 480, -848,
+  -642, 0, -840, 1313, 338, -100, -600, 137, 119, -1695, -1326, -1197, 693, 384, 2040, -678,
+  -2002, 375, 1056, 3780, -1770, -525, -696, -1830, -832, 2280, -297, 805, -91, 1755, -1230, -1554,
+  -135, -783, -147, -856, -762, 873, -2641, 460, -888, -109, -1656, 581, -1143, 1296, -129, -588,
+  -1360, -113, 460, -1320, 1276, 826, 296, -288, -1368, 0, 354, -546, 1248, -1310, 1728, 318,
+  749, 246, -630, -1212, 169, -900, -1600, -1096, 1190, 904, 1224, 1197, -2277, -1792, -612, -1695,
+  1001, -4500, 1728, -756, 1534, 600, -1624, 2684, -1768, -2160, 99, -1955, -1001, -1485, -615, 0,
+  -2295, 1566, 882, -321, 1905, -2910, -1251, -2484, -3108, 218, -828, -498, 508, -972, 645, 980,
+  -1088, -1921, -2070, -1320, -3132, 354, -592, -192, -228, -288, -354, -728, -520, -262, -1344, 212,
+  535, -492, -630, 101, -2704, -1800, -1100, -1096, 476, 2147, 612, 1330, 396, -1536, 102, -339,
+  -2431, -1500, 2112, 630, 708, -675, -1624, -1586, -520, 360, 693, -805, -91, 270, 861, 2109,
+  -2700, 1479, 1176, 428, -1270, -194, -417, 1288, 1221, 545, 2346, 1494, 2921, 1944, -2451, 686,
+  272, 1017, 1495, -1540, -1856, 2714, 2072, 1920, 1710, -480, 1770, 1638, 1768, -1310, -288, 212,
+  -1498, -492, 945, 1818, 0, -1100, -1100, 1370, 1309, 2373, 1224, 931, -198, -1792, 306, 791,
+  1430, 625, -192, -1386, -1298, 225, 2320, 488, -2184, -1200, 1287, -2300, -2275, -2160, -123, -666,
+  540, 609, -1323, 1498, -2286, 679, 556, 460, -1665, 0, -276, -83, -1778, -972, -2322, 686,
+  1768, 1130, -920, -770, 3248, -708, 148, 1536, 342, 864, 1652, 1911, -1872, -4454, 192, 1590,
+  856, 369, -105, 1111, -507, -200, -1600, 0, -119, -339, 816, -266, -1188, -1152, -816, 1469,
+  858, -750, -768, 2268, -590, -75, 348, 244, 312, -1680, 1287, 575, -1729, 0, 246, 0,
+  1755, -522, -147, 856, 889, -1455, -139, -92, 2553, 545, 966, -830, 254, -972, -1161, -588,
+  3400, -452, -115, 990, 1508, 944, 740, 960, 2736, 1056, 944, -364, -520, -1703, -384, 1908,
+  1498, -738, -735, 303, 507, 100, 700, 0, -833, -339, 1632, -1995, -99, -640, -1632, 1921,
+  2002, -2500, -192, 630, -590, -150, 232, 854, -1664, 480, 99, 460, -1092, -675, -369, 1221,
+  -135, -261, 2793, -214, 1270, 582, -3058, -736, -2886, 763, -1656, 0, -1524, 1728, 1548, 1078,
+  1904, 0, -1495, 0, 1044, 1888, 0, 384, -570, 288, 0, -1183, 2392, -1441, -480, -530,
+  -1284, 738, -315, 808, 1690, -1200, -3000, 2329, 357, 113, 0, 798, -891, 384, 612, -1469,
+  2145, -250, 1632, -882, 1652, 150, 1508, 366, 1872, 1200, -297, -1035, 182, 0, 0, 555,
+  -1485, 1044, 2058, -1819, -762, -485, -695, -828, -2553, -1526, 138, -1162, 1270, 432, -387, 490,
+  -272, 1017, 1610, 1100, -928, 1062, 1332, -672, -1368, 768, -236, -455, -1040, 1965, -960, -848,
+  -2247, 4059, 210, -303, 1859, -800, 1200, 2466, -595, 0, -1224, 1596, -1980, -2560, -306, -1130,
+  -1144, -1625, -1248, -3528, 2124, -525, -232, -976, -1248, -3120, -594, -2760, 364, 2970, -123, -3663,
+  -1755, 870, -2940, -1177, -1397, -776, 139, -184, -1665, 1635, -1104, -415, 508, -324, -2838, 1960,
+  -680, -452, 1840, -1320, -1276, -1534, -592, -1152, -570, -1440, -236, 91, -2496, 393, -2016, -954,
+  2033, 2214, -105, 707, 0, 1800, -100, 2877, -357, -1017, -102, 2793, -1485, -2432, -1122, -1130,
+  1144, -125, -2400, -378, 2242, 0, 348, -366, -2392, -840, 297, 2185, -637, 405, -246, -888,
+  2160, 1479, 2940, 1284, -2794, -2037, 1807, 1196, -222, -1308, 1242, 581, 1397, 756, 516, 0,
+  -952, -113, -2185, 1100, 1160, 472, -1776, -480, -798, 1056, 2006, 1729, -936, -2358, -864, 2226,
+  -1284, 1230, -1155, -404, -507, -900, 100, -411, 0, -1695, -1836, 0, 594, 128, 2040, -1808,
+  -3146, -375, -288, -1386, 1180, -600, -232, -2074, 1144, -3600, 2079, -1380, -1274, 405, 2460, 333,
+  2700, 2088, 2793, 2140, -1143, -97, 139, 1104, -1776, 327, 3174, 1826, -1778, 864, 516, -1274,
+  -1768, 1356, 2415, -1100, -1856, -708, -4588, -1920, -798, 1248, -826, -1456, -936, 393, 768, 424,
+  1498, 984, -630, 707, 169, -1500, 1400, 137, -2142, -339, -816, -2660, 1782, -1280, 1326, 2147,
+  -429, -375, -96, -1386, 2124, 150, 696, -122, 104, 1800, 594, -2645, -1365, -810, 615, -2553,
+  -2025, 522, -2205, 1284, -254, 1746, -1390, 92, -3441, 2071, -276, 2158, -2413, 1620, 1161, -490,
+  -2448, 1695, 690, -1540, 3364, -1298, 148, 1152, -456, -1632, 944, 1456, -104, 1834, 576, -4558,
+  214, 738, -3045, -1010, -1014, -1700, -1000, -274, -1428, -565, 816, 665, -396, -2304, -1020, 1017,
+  -1287, -1750, 2112, -882, 708, 1350, 1044, -1220, 3224, -360, 990, 920, -1001, -3240, -1722, -1332,
+  -3645, 0, -2499, 1177, -127, 1940, -1807, -828, -222, 1199, -966, 2407, -635, 540, -903, 490,
+  1632, -1695, -1265, -2750, -3596, -3540, -148, 576, -1140, 0, -354, 91, -520, 2751, 0, -318,
+  -1177, 1230, -1260, 606, 845, -1100, 600, -1781, -1547, -791, 102, 4256, -1287, -2944, -204, 452,
+  -2288, -2250, -864, 0, -944, -150, 1624, 366, -1664, -2640, -297, -575, 1092, 405, -246, -666,
+  -675, -696, -1029, -2675, -635, -776, -417, -276, 1221, -1853, 2346, -1079, 2540, -864, -1032, -98,
+  1632, -1582, -460, 330, 1276, 826, 2960, -192, 114, -1152, 236, -455, 2288, -393, 480, 318,
+  214, -738, -1575, 606, -1859, 900, 600, -685, 238, 0, -816, 665, 594, -3200, -102, -791,
+  1859, -2125, -1248, -756, 472, -750, -580, 976, -1144, -840, -1188, 0, 728, -135, 1968, 1554,
+  -1215, -1914, -1323, 1284, -508, -291, -2363, -736, 1110, -2071, 1932, -1245, 0, 324, -2580, -98,
+  272, -113, -2530, -880, 0, 1062, 888, -960, 0, 480, 708, -637, -208, -262, -1248, 424,
+  -321, 984, -735, -303, -2366, -200, -200, 1096, 1428, 339, 918, 1995, -198, -640, -612, -452,
+  2002, -2625, -1440, -1512, 826, -1125, 464, 854, 1144, 360, -495, -460, -364, 135, 861, 0,
+  1350, -696, 441, -2033, -1651, -2328, -1946, -828, -111, -436, -1104, -1577, 1397, 1188, -1935, 882,
+  -2312, -113, -345, 770, -1508, -590, -3848, -1344, -1482, 672, 236, -1729, -1456, 393, -2112, 212,
+  -1819, -1968, 315, -1111, 4056, -400, -800, 1370, 1547, -678, -408, 133, 396, -1152, -2244, -452,
+  -1287, -125, -672, -1134, -354, -1725, 116, 1708, -1144, -1920, 297, -345, -1911, -945, -738, -3441,
+  -675, -1392, -735, 2033, -1651, 1067, -139, 1472, -1554, -654, -3588, -83, 254, 648, -1419, -294,
+  -952, -1921, 1265, 1870, 1972, -236, -444, -1440, -114, -576, 1180, -1638, 624, -1441, -384, 0,
+  -2247, -984, -1575, -1818, 2028, -1500, 2300, 2055, -2142, -678, -1836, 2527, -297, -1920, 1224, -1808,
+  3718, -2375, 288, 1134, 2832, -525, -928, -3538, -312, -3600, 891, 115, -819, -945, -3444, -2331,
+  3240, -1305, -882, -214, -508, 970, -139, 2024, -999, 2071, -3588, 166, 4826, 1296, -1290, 1176,
+  -1496, -565, -575, -1210, 116, -2714, -592, 96, 2622, -2400, 1062, -2548, 728, 1179, -384, -2438,
+  2889, -2337, -1470, -707, 1690, 1300, -400, 685, 952, -1017, -1530, -798, -495, 1280, 612, 113,
+  2431, 750, -384, 3150, 590, 75, -1160, -2684, -1664, 1200, 495, 1380, 273, 2835, -861, 222,
+  1485, -1305, 2352, 1498, -2159, -485, 1529, -552, 666, -1744, 414, 1245, -1270, -2268, 0, 686,
+  0, -226, 1725, -2420, -1856, 708, 1184, -1440, -1368, 768, 354, -2184, -1664, -655, 2304, 742,
+  -856, -738, -1680, 909, 1352, -1100, 0, 1918, -714, -678, -1530, 931, -495, -768, -612, 1921,
+  -1430, -3375, 0, -2142, -2006, 900, -116, -854, -520, -1200, 99, 690, 728, -1485, 369, 555,
+  -405, 1479, 1764, -1070, 889, 194, 1251, 1380, 1776, -872, 3726, 1079, -508, -1080, -1677, -294,
+  1224, -2260, 1265, 2200, -812, -118, 1332, 288, -684, -384, -2006, 728, -208, 917, 1344, 636,
+  3317, -1230, -1575, -1010, 1352, 500, 1300, -4795, -4046, 791, -816, -1596, -891, -640, 1836, 226,
+  3289, -3875, 1056, 3024, 708, -750, 1972, 1708, 208, -720, -297, -1840, 364, -3375, 0, 222,
+  -1755, -261, -588, -1284, 1016, 776, -3336, -2944, -1665, -109, 414, 913, 762, 2700, 903, -2254,
+  2312, -2825, -3220, -330, 232, -1534, -1628, -480, -456, 1344, -118, -637, 416, 1310, -480, 530,
+  -2140, 369, -1260, -2525, 169, 1400, -2400, 2466, 1666, -226, -1632, 399, 792, 1024, 1428, -1921,
+  715, -1750, -960, 0, -236, 0, 348, -4148, 728, -480, -1683, -1035, -1456, -2430, 246, 1110,
+  2295, -174, 1764, -428, -2032, 291, 1668, 644, -1998, -3270, 1380, -1079, 381, -324, -774, 392,
+  -136, 1469, -2875, 1760, -1044, 472, -444, -2016, -1596, 1152, -708, 182, -3120, -3013, -672, -1802,
+  535, 246, -840, 1313, 3380, 1500, -700, 274, -238, 904, -1632, 798, -1188, 640, -1020, -565,
+  -1573, 875, 384, 630, 1652, 0, 232, -732, -208, 480, 1287, 345, -364, -270, 0, -999,
+  675, -957, 2058, -214, 2794, 1455, 278, -460, 1554, 1526, 276, 415, -1905, 972, -258, 1470,
+  -680, -565, 1380, 440, -464, -1298, -1776, -960, -1140, 2112, 0, -1001, 1976, 131, 0, -1166,
+  -1284, -1599, -105, -1313, -845, 1400, 600, -685, 357, -226, -204, -2660, -1782, -384, 306, -1808,
+  -715, -1250, 96, 1134, 1416, -75, -116, 610, 208, -840, -99, -690, -364, 405, -615, -444,
+  -135, -1305, -1176, -428, 889, -1358, -1946, 644, 333, 109, -1380, -498, 381, -216, 903, 294,
+  2856, -1017, 575, 1100, 580, 472, -148, 864, 1482, 0, -1534, -546, -2080, 262, -576, -636,
+  428, 246, -105, 1313, 507, -1100, -500, 137, 238, 1921, 816, 1197, 198, -2432, 0, -1356,
+  4147, -1375, 1440, -504, -708, -150, -232, -732, 416, -600, -396, -1035, -455, -1080, -369, 777,
+  810, 0, -1617, 214, 2032, -679, -278, 644, -2109, -327, -1380, -1079, -1524, -1188, 258, -686,
+  408, -1695, 460, 220, -812, 2596, -444, -96, -114, -384, -708, -728, -624, 1048, 1536, 212,
+  -749, 246, -1470, 1010, 1014, 900, 300, 959, 357, -339, -306, -665, -891, -640, 204, 0,
+  858, -1375, -192, -1134, 590, 1200, 116, 0, -832, 1200, 594, -920, -546, 945, 1230, -333,
+  945, -1131, 0, 1284, -635, 1067, 1668, 0, -444, 654, -828, 166, -508, -1728, 1419, -490,
+  -1768, 2712, 1495, -110, 116, 1416, 740, -192, -2508, 672, 118, -91, -1664, 1834, 1440, -212,
+  214, -492, -2835, 707, -2873, 1100, -3300, 411, -952, 1921, 204, -532, -1287, -1152, -1326, -1921,
+  -429, -1000, -2208, 630, -1062, -1650, -1044, 1220, -3120, 1920, 297, -690, 1092, -135, 861, 444,
+  -1350, 261, -882, -1712, 2032, -970, -556, 460, 555, -2616, 276, 332, 0, -2808, 516, 196,
+  -544, -2938, -690, -220, -1392, -590, -1036, -96, 798, -1536, 826, 273, -1248, -1703, -2880, 2120,
+  -428, -369, 1155, 303, 1183, -1200, 0, 411, -595, -904, 306, -133, 99, -1920, -1326, -113,
+  -429, -2750, -864, 252, 1298, -1200, -232, -1342, 312, 240, 693, 575, 910, 3240, -1845, -111,
+  1485, -435, 1617, 642, -381, -388, 556, 736, 1554, -1417, 690, 83, -889, 1620, 516, -196,
+  952, -2034, 690, 330, 116, -944, -2072, 96, 342, 288, -1180, 546, -520, 0, 1536, -1060,
+  -107, -2460, -630, -1919, -1183, -700, -200, -822, -1428, -226, 204, 0, 693, 640, 1020, 678,
+  143, -250, -768, 126, -118, -225, 0, -1830, 936, -1200, 1089, -575, -364, 540, -1476, -666,
+  -1890, -783, 1176, 428, -1143, 1358, -1807, -184, 333, 436, -1380, -83, -2286, 1080, -129, -588,
+  -408, 565, 1725, -1980, -696, -1062, -888, -960, -114, 1536, -1416, -1911, -520, -917, 1056, 106,
+  -963, 1722, 1260, -2222, -1859, 100, 1600, -137, -714, -1243, 612, -1463, 1089, -2304, 1326, 452,
+  1430, 1875, -576, 1512, -1888, -75, -464, 488, 1040, 480, -990, -690, -2639, 1080, 984, 111,
+  -2295, 870, -588, -1284, 635, -1455, -2919, -552, -777, -436, -1380, 83, -1143, 1620, -1290, -1078,
+  952, -2034, 1265, -440, -1276, -3422, -592, -480, 2052, -2016, 1180, -2730, -104, 131, 480, -1484,
+  1498, -1230, -1470, -505, -3211, 1000, -2000, 274, -2023, 678, 816, 2261, 297, 512, 714, -1243,
+  1287, 2000, 1248, 1512, -2124, -1800, 464, -1342, -728, 600, -396, -115, 819, -3780, 246, 222,
+  405, -261, -2793, -2461, 0, 388, 0, -736, 2664, -1853, 552, -830, -2413, -108, 1548, 588,
+  2448, -2260, -230, 770, -2204, -708, -296, -1152, 456, 96, -3304, -364, -1664, -1441, 1632, 424,
+  -1391, 492, -945, 909, 1352, 200, 1200, -274, 1547, 565, -1020, 665, 1980, 384, -918, 678,
+  -1144, -250, -192, 252, -1888, -1275, -928, -1342, -2392, 600, -1287, 345, -1274, -1080, 984, 444,
+  -540, -87, -1470, -321, -1270, 2328, -1251, 460, 2220, 545, 138, 830, 381, -648, 645, -196,
+  -680, 226, 920, 0, -1392, -944, -2812, 288, -1254, 96, 236, 455, 832, -393, 2112, -848,
+  1498, -2460, -1680, 808, -1352, -100, -2500, 137, -357, 339, 102, -798, -990, -768, -1326, 339,
+  572, -125, 1056, 252, -354, -675, 1044, -1464, -1664, -840, 792, 805, 1729, 1080, -123, 1110,
+  -405, 87, 1176, 1177, 508, 1649, 0, -368, 1887, -2834, -2070, 249, -1905, -216, -129, 98,
+  -1904, -1017, -690, -550, 696, 590, -1036, 1440, -342, 1056, 1888, -455, -1248, 2489, 2112, 318,
+  -749, -2337, -105, -101, -507, -900, 600, 959, 1666, 904, 1734, 532, -99, -896, -306, -1243,
+  1573, -2125, 2400, -630, -1416, -1200, 1392, -854, -416, 3000, 0, 230, -1274, 810, 2214, -999,
+  1620, 1392, 1029, 1177, -2667, 291, 1112, 460, -888, 1090, -2484, -498, -1016, -1188, 2193, -686,
+  -816, 1130, 575, 220, -1160, 2124, -888, 1152, 1938, 480, 236, 0, 1248, -262, -288, -212,
+  -642, -123, -1155, 303, -2704, -1300, 1500, -1233, 0, 339, -714, -1862, 1188, -640, -204, -3277,
+  -2860, -2000, -1248, 378, -1770, 300, -928, -2196, 1872, -1320, 495, -2990, -273, -540, -738, 555,
+  -2835, 1131, 735, 0, 762, 582, -2780, -276, 1776, 1308, 1794, 913, 381, 2484, -2451, 2352,
+  -408, -2938, -1495, 440, -1044, -590, 1036, -576, -798, 0, -1888, -910, -1144, 0, 480, -1484,
+  -2782, 492, -735, -3030, -338, -400, 1000, -1096, 238, -1130, -204, 3591, -396, -384, 1836, -1130,
+  -143, -1000, -480, -126, 0, -150, -1856, 244, 1456, -2760, 2376, 690, -1547, 540, 0, -2775,
+  1620, 2175, -1029, -321, -2286, -97, 1946, -368, -3108, 2180, -1104, 581, -127, 1836, -2580, 686,
+  -2992, 1469, -230, -660, -116, 2006, 296, -192, 1368, -96, 1770, -2184, 728, 3013, 288, -2438,
+  -2033, -2706, -1890, 505, 0, 900, 600, -2055, -2261, 1582, -816, 1596, -1089, 1408, 2142, -339,
+  715, -375, -1152, 504, 944, -1650, 464, 1098, -624, 360, -594, 345, 0, 810, 2214, -1665,
+  -4725, 1827, -147, -642, -2794, 2425, -278, -92, -444, 1744, -1518, 2407, -2540, 2916, -516, 0,
+  -1768, -452, -230, -1320, 116, 1062, 740, -288, 456, 192, 118, 637, 1664, 1441, -672, 1272,
+  642, -1353, -315, -2525, -338, 2500, -400, 1781, -595, 0, -2142, 0, 1287, -1152, 0, -452,
+  1430, -1875, -1632, -378, -590, 675, -1276, 122, -312, -240, 99, -920, 910, -1080, -861, 666,
+  -1080, -261, -882, -214, 1651, 388, -139, 276, 999, 218, -2070, 1162, -889, 2160, 2322, -294,
+  -272, -1582, -2645, 220, 812, 118, 888, -960, -1026, 576, -1062, 637, -1144, 131, 672, 106,
+  107, -2337, 2310, -1616, -3549, -1900, -1600, 1096, -1785, -678, 1020, 1729, -693, -1920, 102, -1356,
+  715, -2000, 96, -2142, -2242, -75, -1160, 2318, -2496, 1080, 198, -1840, 1911, 3915, 2337, 555,
+  2565, -1914, -147, -856, -2794, -1940, -695, -368, 1776, -3815, -4002, -1245, 127, -108, 1548, 392,
+  2448, -2034, 805, 440, -348, 1770, 1480, -3072, -342, -192, 236, -3367, 1664, -1441, -1632, 954,
+  2033, 1107, -945, -303, 845, 2300, -400, 2603, -476, -339, -1632, -399, -891, 1280, 306, -1243,
+  1859, -875, -1152, 126, -2124, 1275, 2088, 732, -312, 600, 792, 230, 1911, -1755, 123, -1110,
+  540, -696, -1617, -1712, 1270, 194, -417, 920, 222, -872, -552, -498, -2921, 1080, 4257, 0,
+  2448, -2373, -345, 220, 464, 590, 740, 96, 114, 1344, -2124, 364, -520, -786, -384, 2544,
+  642, 369, -630, -505, -1690, 600, 300, -2740, -1071, -565, -816, -1596, -792, 1024, -2244, 904,
+  -1001, 2250, -672, 2520, 1534, 0, -1740, -2684, -1144, -1320, -396, 920, 91, -675, -1476, -111,
+  135, 1044, 1176, -1926, 508, -1164, 0, 552, 555, -872, 1242, 166, -1397, -648, -516, 1274,
+  408, -1356, -920, -1210, 0, -1180, -888, -1248, -228, -768, -472, 273, -312, 1703, -768, -530,
+  -1605, 2337, -210, 505, -507, -200, 900, -959, -119, 1469, 204, -1330, 1089, 896, -1122, -339,
+  -1716, -1250, -1536, -630, -118, -825, -1276, -1464, 624, -1200, -297, 460, -364, -135, 984, -1665,
+  1080, 696, -2058, 963, 1651, 582, -1807, 460, 888, 1417, -1242, 498, -1016, 1080, 258, -1568,
+  680, -339, 230, -440, -928, 1062, 1332, 0, 456, -384, -1770, 819, -936, -917, 672, -1166,
+  -1070, -246, 840, -1212, -2535, 300, 800, -411, -1309, 1243, 510, 1330, 297, 512, -714, -1356,
+  858, -1375, -288, 882, -3304, -975, 464, 1708, -1560, -240, 891, -1955, -91, 1080, 2214, -1221,
+  -1485, 1044, -147, 321, 508, 388, -695, -184, 111, 1417, -828, -498, -3175, -972, 774, 1470,
+  0, -1356, 805, 0, 580, 1534, 0, -672, 570, -864, -708, 819, -624, -2227, 288, -1166,
+  -1391, 492, -1785, 101, -1521, -400, 300, -1233, -595, 339, 306, -1729, 396, -1408, -1428, -1921,
+  -2002, 375, -1152, 630, -1062, -750, -232, 976, -416, 1440, 693, -115, -637, 270, 0, 1332,
+  405, 261, 0, 321, 1143, -1067, -2641, 1380, 1887, 654, -690, 1328, 889, 1188, -1806, 1372,
+  -136, -2260, -690, -1760, -2204, -2360, 1628, -1152, -1710, -672, 708, -182, -2080, -1572, 1440, -1484,
+  -2889, -3813, -1260, -1515, -169, -2000, -2300, 1644, 3570, -1921, 2040, 1729, -792, 384, 816, -1469,
+  -1287, 375, -384, -2016, -3894, 75, -3596, -6588, -1456, -840, 2772, -2760, 1729, -1215, -3321, -111,
+  2160, 957, 4410, 1819, -5715, -1261, 2502, 184, 2442, -4033, 1242, 581, 254, -1188, -6450, -2352,
+  -1632, -2373, -1495, -990, 232, 1534, 5476, -672, -2052, 1824, 236, 910, -728, 3406, -192, -1590,
+  -1498, -2706, -420, -202, 1183, -1300, -500, -1233, -2499, 904, 1122, 1596, 0, -128, 102, 113,
+  1287, -2125, 480, 0, -1652, 450, -232, -610, -312, 960, -1287, 0, -1092, 540, 369, -3552,
+  -1485, 696, -1323, -1498, -1778, 1649, 139, -644, -1887, 218, -1932, -1743, -1651, 864, 0, -686,
+  272, -678, 115, 550, -580, 118, -2664, -480, -798, -960, 0, 0, -1248, -655, 480, 212,
+  535, 861, -1680, -202, 338, 700, -1100, 2466, 595, 904, -510, -1197, -1683, -1280, 0, 1582,
+  1573, -125, 960, -2394, -1180, -900, 1276, -244, -1144, 600, 891, 230, 455, 1755, 1599, -555,
+  1620, -609, 588, -214, 635, 970, 139, -368, 0, -327, -2898, 0, 889, -648, -645, -490,
+  -272, 0, 690, 330, 1160, 1888, -444, -672, -912, 0, 1888, 91, -416, 655, -1248, 530,
+  -428, 123, -840, -2626, -169, -1500, 100, -548, -2499, -113, 408, 133, -891, -1536, -204, -565,
+  -429, -4250, 1152, -1008, 472, -900, 812, 1830, -520, 1920, 1188, -1265, 1365, 2295, 1476, -555,
+  675, -174, 1323, -2033, 0, -291, -278, -552, 666, 1090, -276, -1162, -127, -1620, -645, 98,
+  544, 904, -1265, 110, -3828, 1888, 444, -2688, -1482, -480, -236, -1092, 832, -1179, -1056, -1802,
+  -749, 1107, -735, 0, 1352, -1800, -400, 685, 2142, 904, -306, -266, -1287, -256, -408, -1921,
+  2288, 250, -288, -504, -1062, -525, 1044, 244, -2392, -480, -1188, -230, -1183, 945, 1476, 999,
+  270, -348, -1470, 0, -127, 194, -1112, 1104, 1443, -1417, 414, -1245, -1397, -540, -387, 196,
+  544, -226, 1725, 1210, -928, 1416, 1332, -1536, 0, -1152, -236, 1274, -520, -1834, -480, 1590,
+  321, -492, 1155, 1717, -3211, -700, -400, 548, -357, -113, -1428, 133, -891, -128, -102, -113,
+  429, -250, -1536, -126, -354, 1500, 1276, -732, -832, 1440, 990, 690, -728, -1485, -246, 111,
+  -405, 1479, 1617, 321, -762, 194, 417, 736, 1443, 109, -414, 83, -508, 0, 0, 294,
+  408, 339, -805, -550, 348, -354, -148, 384, -1710, 96, 944, 1092, -2080, -1572, 384, -212,
+  -428, 1599, 1050, -1515, -3887, 400, -1000, 1233, 1666, 339, -1326, -3059, 198, 1792, -1734, 452,
+  -143, 875, 96, -1008, -354, 525, 348, 1342, -416, -3600, -1287, -230, -1365, 405, 1476, 999,
+  -405, -522, 3381, 1070, 1778, -97, -417, -1012, 2331, 218, -1104, -747, -381, -864, -4386, -1470,
+  4896, 0, -2760, -2860, 580, 2478, -740, 768, -1254, -2400, 472, 1183, 728, -1310, -192, 0,
+  -1284, -615, -1365, -1414, 338, 400, -1100, 411, -1190, -339, -1632, -931, -990, 512, 306, -1695,
+  -1001, -1625, -96, 1134, -1180, 375, -1972, 244, 104, 1800, 99, 1610, -546, 0, 861, 777,
+  1215, -1131, 2646, -749, -1397, -1940, -834, -1656, 555, -545, -138, -747, -1143, 108, 645, -490,
+  1904, -1356, -575, -990, -1044, 472, -148, -768, -912, 384, -2242, -819, -1560, -655, -1920, 1696,
+  -856, 1107, 420, 1919, 507, -300, -300, 685, 1428, -113, 2652, 1064, 198, 1408, 1224, 565,
+  143, -2000, -1728, 756, -1062, -300, -580, -976, 1456, 1200, 1287, -1380, 364, 405, -984, -1998,
+  -2160, 522, -2940, 107, -2159, -1358, 973, 1012, -1332, 2071, -414, 415, -1270, -864, 1935, -196,
+  -1088, 339, -345, 1100, 580, 2006, -592, 672, -570, 480, 708, -1274, 520, -655, -480, -212,
+  -3638, 492, -315, -1111, 1352, 1500, 400, -4795, -3451, -339, -2142, -1330, 297, 4480, 1632, 904,
+  858, -2000, -1632, -378, -236, 525, -348, 1830, -728, -720, -693, 2300, -364, 1485, -123, -333,
+  -2025, -261, 2205, -1498, 2667, 97, -3058, -2116, -555, 1199, 2622, 1660, 1651, -216, -2193, -1568,
+  -1632, 3503, 1840, 1760, -1160, 118, -444, 1056, 684, 768, 354, 1092, 0, -1572, -96, 0,
+  -214, -1722, -3360, 505, -5408, 1000, 800, 685, 238, -791, -510, 133, -198, 2048, 816, -1921,
+  -858, 250, -1440, 252, -826, 75, -696, -1342, 1456, 1680, 1485, 690, 455, 810, 1845, 222,
+  -405, 2610, 1176, -1498, 1778, -3104, -2363, 184, -222, -1635, 2346, 913, -381, -108, 1419, -294,
+  -1496, -1017, -920, -880, -812, 2478, -148, 576, -2622, 288, -944, 1183, -1144, -655, -288, 1696,
+  -642, -2337, -105, 0, 2028, -1900, -1300, -822, -595, -1469, -2856, 1064, 792, -2176, 1734, -2260,
+  -2717, -375, 576, 2268, -2832, -300, -812, 366, -416, -720, -1881, -575, -91, -405, -492, -444,
+  -945, 1305, -882, 535, 508, -388, -556, 552, -1332, -2616, 276, 913, -1651, 0, -1806, 686,
+  408, -678, 1725, -770, 464, 1062, -1184, 384, -912, 288, -1888, -455, 208, -2882, -576, -2438,
+  -2033, -738, -210, -101, 169, 1300, -200, -1644, 952, 1017, -510, 1596, 198, -384, 2448, 339,
+  -2574, 500, -288, 378, -118, 750, -116, -732, -520, 480, -693, -1840, -273, 1215, 369, -2553,
+  -3375, 0, 1617, -2782, 0, -1164, -1529, -2668, -555, 1199, 690, 830, 635, 540, 1161, -490,
+  -680, -678, 1610, 1760, -348, -826, -2516, -96, -2622, -1440, 3068, -273, 2600, 0, -1536, -954,
+  856, 2091, 945, 707, -1690, 1400, 2400, 548, -238, -1695, 2040, -1995, -1386, 256, -306, -226,
+  -2288, -500, 192, 0, 2006, 2400, 464, 1220, -728, -840, 2178, 1150, -546, 945, -615, 0,
+  -3915, -261, 1617, 963, 2794, -485, -1529, -920, -666, 1526, -690, 1826, 1016, -324, -2322, -1274,
+  -408, 3390, 1265, -550, -232, 236, -1036, 2208, -1254, 864, 1888, -1547, 1560, -1965, 1920, -2756,
+  214, -246, -525, 505, 2028, 2200, -2500, -822, -1309, 1356, -510, 1330, -1584, 0, 408, 113,
+  -1573, 375, 672, -1890, -236, -600, -348, -854, -1352, 1440, 198, 345, -273, 675, -2337, 111,
+  810, -87, -2205, -428, -1778, -679, 1112, 92, 999, -436, -2622, -1079, -762, 864, -1161, 294,
+  272, 226, 575, 770, -3480, 1416, 1332, -192, 684, -96, -1298, -910, 416, -262, -672, 106,
+  1284, -1722, 630, 202, 1521, 2100, -700, 274, -952, -113, -408, 1463, 0, 2048, -1326, -1582,
+  1144, -125, 0, 1386, 1062, 150, 928, -610, 208, 1800, 0, 1265, -182, 540, -2583, 1221,
+  1620, -1305, 441, 0, 1524, -1940, -695, 0, 0, -981, -1794, -332, 1016, -1620, 129, -882,
+  136, -226, 1150, 2640, 116, -1298, 592, -192, 114, 288, 944, -91, 1144, -2358, -96, 530,
+  1070, 0, -1155, 404, 2197, -1200, -1200, -137, 238, 226, 1326, -1064, 891, 0, -1224, 1017,
+  1430, -1125, 576, 630, -1888, -675, 1392, 488, 520, 480, 99, -460, -1729, -1215, 738, 1221,
+  3240, 522, 3675, 1819, 3556, -1067, -1112, -1196, -2220, -1090, 0, 1411, 127, 1620, 129, -882,
+  -544, -226, 230, 330, -1972, -118, -1332, -672, -684, 288, -944, -1456, -4056, -1179, -288, -1802,
+  -535, 492, -1155, -1010, -2197, 600, -600, 1781, -595, -226, -612, 532, -990, 256, -612, 1582,
+  -1144, 500, 288, 882, 2714, -525, 1740, 488, 1560, 3000, 1287, -4370, 364, -135, 1107, 777,
+  -3915, -1566, 294, 428, -1651, -388, -1529, -644, 1332, 0, -2070, -1909, -889, -864, -645, -196,
+  1224, -1356, -460, 110, -2204, -236, -444, -1056, -114, 1344, 118, -2548, -2600, -1310, -2016, -106,
+  749, 1107, -3885, -404, -1690, -1000, 300, 3425, -595, -1695, -510, 2394, 1386, -3072, -2040, -1130,
+  -1859, -2625, -96, -504, 472, -675, -2204, -1220, 1768, -4800, 2475, -345, 1547, 3105, 246, -1221,
+  1890, -174, -147, 749, -889, -291, -1946, 0, 555, 3270, -276, -332, 2286, 540, -258, 1372,
+  3128, -2373, -805, 1100, -3248, -472, -1184, -768, -1026, -1152, -2124, -2548, -416, -2096, 864, -1908,
+  321, 2337, -630, -808, 5577, -100, 600, 1644, 119, 1469, 714, -798, -1386, -1920, -2040, -1469,
+  429, -3125, -1248, 126, -590, -675, -1276, 610, 1040, 360, 495, 2185, 91, 270, -1107, 111,
+  135, -870, 3381, 1284, 1016, 485, -695, -1472, 1110, -109, -1242, 332, 1651, -864, -3096, -98,
+  -272, 904, -920, -440, -1508, 1652, -1628, 576, -684, 192, 2360, -2093, -208, 1048, -864, 1590,
+  -856, -1230, -2835, -404, 169, -1400, -1500, -548, 0, -791, 0, 133, 1782, 2560, 1530, -113,
+  1859, 2000, -288, 0, -354, 75, 696, 1342, 0, 360, 1485, -1380, -2821, 1215, 2829, -111,
+  135, -870, 441, 1391, -254, -291, -1529, 0, -1110, -1308, 1518, -249, 381, -108, -258, 196,
+  -408, -113, -2415, -880, -116, -944, 0, 1056, 228, 2208, -1062, -1001, -2184, -262, -288, -954,
+  749, 861, -210, 303, 1183, -400, 1700, 685, -1785, 113, -1326, -931, 1287, 640, 102, 1356,
+  1573, -375, -1344, -882, 2714, 1125, -1972, 0, 3120, 1200, 396, -345, 364, 1485, 1476, -222,
+  540, -522, -1911, -1926, -762, 1940, -2780, 552, 333, -327, 552, 1826, 1016, 1836, 1419, -98,
+  -3808, 2599, 1495, 660, 1624, -118, -592, 1248, -1026, 192, -1416, 0, -2184, -1572, 1440, -2438,
+  107, -1845, -630, -1010, 1352, -200, -1300, 1096, 1785, -791, 1020, -798, -792, -1152, -1836, -113,
+  858, 1375, -288, 0, -2478, 375, 232, -1464, -1040, 480, -891, -115, -819, -1080, 246, 333,
+  -135, -435, -2058, 428, 0, 194, -3058, -276, 2109, 109, -2070, -166, -3175, 0, -1677, 1666,
+  -272, -1469, -1955, -1760, -4408, -590, -2368, 480, -1026, -768, -1298, 728, -1456, 2620, 0, 636,
+  428, -369, -105, -1212, -2366, -500, 1700, -685, 1309, -226, -1020, -1729, -891, -1280, 510, 113,
+  -143, -1875, 192, -1386, 590, 450, 348, 366, 1144, 360, 990, -1380, 364, 2430, 861, -222,
+  -540, 957, 0, -214, 762, -2619, -1112, -552, 777, 1853, -3450, 1245, 1524, 216, -1161, -980,
+  0, -2373, -1150, 330, -1508, -236, 740, 576, 912, -1536, 1298, -455, -1456, -1965, -1344, -742,
+  -2033, -369, 315, -303, -1521, 200, 1000, 137, 238, -339, 1836, -798, -198, 896, 1530, -565,
+  -1287, 1000, -864, -1890, -1534, 150, -1276, -976, -624, -120, 594, -1380, 728, 0, 369, -999,
+  -2970, -783, -2205, 1712, -127, -1164, 834, -1288, 1665, 1090, -1794, 498, 635, 216, -1032, -196,
+  -2720, -2938, 460, 1650, -1740, 590, 592, 384, -570, -288, 236, -637, -1144, 0, -1152, 530,
+  -321, -246, -420, -101, -169, -400, 500, -411, 0, -1921, 306, 133, -1287, -1280, -204, -791,
+  -2002, 375, -384, -2646, 826, 525, 580, -976, 0, -360, 396, -575, 182, -1215, -1353, 888,
+  -675, -1392, -2646, -963, -1397, -1649, 695, -1472, 666, 654, -828, -581, -2921, 0, -1548, 980,
+  -952, 2147, -115, -660, -2900, 590, 740, 1152, -114, 1824, -2832, -1274, -936, -1965, 864, 0,
+  1177, -861, 840, -909, 1014, 900, -700, 1781, 1547, -226, -1530, 798, 1188, -1792, 714, -1243,
+  0, 1375, 1920, -1386, -118, -975, -1044, 0, -416, 840, -1584, 1840, -1456, 1080, -123, 2442,
+  -1350, -783, -441, 0, -889, -97, 0, -1564, -1887, -218, -1932, 249, -508, -108, 0, 1274,
+  -1360, -791, -230, 330, 348, -472, 148, 288, 228, 1632, 118, -819, 1976, 262, -1824, -1166,
+  2033, 2829, 525, 606, 1690, 1000, -3000, 1096, -1190, -4294, -1734, 1596, -693, -1152, -612, -2034,
+  2288, 750, 1728, 630, -2124, -1650, -1740, -488, -1456, 2040, -3861, 920, 91, 1080, -369, 2775,
+  2700, 261, -1911, -1177, -889, 3007, -139, 1380, 333, -2834, -690, -1162, -2667, 2916, 5418, -1568,
+  -136, -339, 1725, -1760, -1392, -236, -1480, -192, 114, 384, -236, -910, 1248, -2358, -192, 954,
+  963, -1353, -1680, -606, -338, -300, 1800, -3836, -1428, 113, 1020, -3990, 891, 640, -1122, -226,
+  1859, -1125, 1152, -126, 1888, -225, 812, -1098, -1352, 0, 1980, 575, 273, -675, -123, -1998,
+  -1080, -2349, -3234, 963, 0, -1746, -417, 276, -333, 1635, -1518, 1162, -889, 324, -516, -686,
+  -272, -904, -115, 1320, -1160, -118, -296, -384, -114, 0, -1652, -91, -832, 393, -192, -848,
+  -1070, 861, -315, -404, -1859, -1200, 100, -822, -3213, -678, -204, -2394, 1287, -896, -306, -1921,
+  1144, 875, 288, -2394, -118, 600, -580, -488, 728, 2520, -594, -920, -546, -2025, 984, 888,
+  -675, 609, 0, 2033, -1016, -970, -417, 1012, -444, -1635, 138, -1660, -635, -324, -1290, -784,
+  -544, -1356, 690, 770, -812, -1416, -888, 288, 114, -192, -590, -728, -1352, -4323, -288, 0,
+  -749, 123, 1260, 606, -1183, 1700, 200, 2466, 1071, -678, -204, -1463, 2574, -2176, 510, 565,
+  -858, 125, -384, -756, -826, 225, 232, 1220, 1664, 840, 594, -1495, -1365, 540, 123, 2220,
+  -4725, 261, -882, 1498, 127, 97, -2085, 460, 666, 1199, -552, -249, 127, 216, -774, -1666,
+  -2176, 678, -230, -1320, -348, 0, 1924, 1248, 798, 480, -1534, 546, -1144, -1441, 1632, 1272,
+  0, 123, -1260, -1919, 676, 0, -800, 2055, 595, 339, -102, 1463, -1287, -2176, 918, -1017,
+  286, -125, 1152, -1260, 944, 525, -696, -244, -520, 1680, 1980, -2990, -1638, -1350, -1107, -1221,
+  -135, 87, -147, 1070, 254, 97, 1390, 92, -666, -545, -2622, -581, 889, -1836, 1548, -588,
+  2312, -2599, -1265, 550, -1624, -1298, 1184, 96, -2166, -768, -1416, -546, -1872, 1703, -1344, 106,
+  749, 369, -630, -303, -1014, 100, 0, -1507, -714, 1130, 1326, 1463, 891, 384, 306, 0,
+  -1144, 750, -960, 756, -236, 225, -116, -2318, -2600, -2040, 891, 230, -364, -945, -2091, 2442,
+  1215, 1740, 735, 321, 127, 291, 1390, 828, 1776, 436, -690, 498, -508, 1728, 0, -196,
+  408, 452, -805, 220, -1972, 1062, -1776, 1440, -456, -1248, 1298, 910, 2704, 3013, 960, 954,
+  2675, -123, 210, -1414, 1859, -200, -900, 1096, 238, 226, 714, 266, -495, -1408, -816, 452,
+  -1573, -1250, -384, 126, 708, 525, 580, -854, -104, 600, -396, -1380, -546, 1620, 738, 999,
+  1620, 1218, 294, 214, 1270, -970, 139, -1932, 777, 109, -828, 0, -1524, 648, 516, -588,
+  544, -565, 805, -330, -348, 1062, 1036, 672, -570, -960, 944, -637, 1040, 2882, 288, 530,
+  1070, -984, 1050, -808, -676, -100, -1000, -1370, 238, 452, -204, 1197, 495, -128, 816, -226,
+  2717, -1125, 2688, -756, -354, -1425, 1508, -122, 624, 1080, -396, 230, 1183, 405, 2583, 1776,
+  -1620, 1914, 294, -749, -1397, 485, 1668, 368, -999, -327, 690, 1162, -2413, 3024, 1806, 98,
+  -1088, -1356, 1495, 1650, 1972, 2360, 1184, 1056, -342, 672, -826, 819, -312, 2358, -864, -1272,
+  2033, 738, 525, 1313, 169, 300, -2700, -1233, -833, 678, 816, 133, -2376, -1152, -1530, -226,
+  429, -375, -768, 126, 1062, -375, -696, 610, -1144, 1440, 0, -1610, 2639, 2025, 1230, 333,
+  -1350, 1044, -147, 1498, 1016, -679, -556, -552, 2886, 0, 552, 415, 3302, 1512, 0, 784,
+  -408, -1469, -460, 220, 116, 1298, 2072, 672, -570, -960, 2006, -637, 624, -1965, -768, -1378,
+  -1391, 615, 945, 505, 3718, -1900, -900, 3562, 3808, -1017, 612, -1330, -3069, -2688, -1836, -2147,
+  -2002, -500, -2112, -2898, -3540, -1050, -3480, -488, -416, -1200, -891, -1610, -1001, 3240, -1230, -555,
+  1755, -1218, -441, 1605, -1905, -194, -1390, -92, 2220, -872, -2070, -332, -508, -4104, -3870, -196,
+  -2448, 791, 2415, -1430, -116, 1888, 2220, -960, 2622, -1440, 1416, -182, -1456, 393, -864, -742,
+  -535, -1845, 210, 2222, 1014, -1600, 400, -1096, -1666, 3051, -2244, -665, 792, -1024, 2958, -113,
+  2431, -2250, -672, 1134, -826, -1050, 1276, 122, -208, 2520, -1881, -2185, -364, 810, 1968, -2553,
+  405, -609, -588, 1819, 508, 2037, 556, -460, -1887, -2180, -1242, -2158, -381, 540, 1290, -2352,
+  952, 2486, 2300, 220, 232, -1180, 740, -1344, 1368, -192, -354, 91, -1352, -393, 0, 1802,
+  0, 1230, -1470, -1010, 3549, -800, -300, 3014, -595, 791, 102, -133, 1287, 256, -204, 565,
+  -429, -250, 0, -1008, -2006, 0, 812, -488, 416, 2040, -594, 230, -1092, 1215, -1722, -777,
+  2295, -174, 1470, -107, 254, 970, 1529, -552, -1332, -436, -1104, -747, -1270, -432, 2322, 196,
+  136, 565, 1265, -770, -348, -1180, 444, -192, -2280, -1824, 1888, -273, -2912, 262, 1056, 1802,
+  1391, 1476, 210, 1010, -2704, 900, -800, 1233, -2737, -791, -204, 0, 1584, -768, 204, -226,
+  1430, 250, 96, 1386, -472, -900, -1740, -1098, 832, 480, -2376, -2760, 1911, -1755, 246, -666,
+  1755, -261, -441, 321, 381, 485, -1668, -828, 999, -1199, -828, -1494, 2159, -2484, 516, 490,
+  1088, 339, 1725, 2200, -116, -1534, 1924, -96, 0, -2112, -118, -546, 104, -1703, 960, -954,
+  -1284, -1845, -525, -101, -676, 400, -1000, 685, -1666, 1243, -1632, 133, -1683, 2432, 918, -113,
+  1573, 750, -960, 378, -1180, -525, 1044, -732, -1040, 600, -594, -460, -637, -1215, -2829, 666,
+  1215, -435, -1029, -749, -762, 1552, -139, -552, 222, -1090, 276, -664, -762, -2160, 1161, 0,
+  544, -565, 230, 330, -1276, -3422, 740, -864, -798, 768, -118, 91, -1664, -3144, -288, 1060}
+;
+
+#endif//_MODEL_BNFOLD_H_
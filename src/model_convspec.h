@@ -0,0 +1,168 @@
+/**
+  ******************************************************************************
+  * @file    model_convspec.h
+  * @brief   conv2d kernels specialised for the shape of each layer
+  *
+  * GENERATED by tools/specialize_conv.py from src/model.h, do not edit.
+  * Used by the conv2d templates when building with -DWITH_SPECIALIZED_CONV:
+  * literal shapes and strides, kernel rows unrolled, no padding or bounds
+  * checks. Outputs are identical to the reference templates.
+  */
+
+#ifndef _MODEL_CONVSPEC_H_
+#define _MODEL_CONVSPEC_H_
+
+#include <stdint.h>
+
+#ifndef SINGLE_FILE
+#include "nn_common.h"
+#include "simd.h"
+#endif
+
+// conv2d: 32x32x3 -> 15x15x8, 3x3 kernel, stride 2x2
+static inline void conv2d_specialized(
+  const int16_t *input,   // [32][32][3]
+  const int16_t *kernel,  // [8][3][3][3]
+  const int16_t *bias,    // [8]
+  int16_t *output,        // [15][15][8]
+  const requant_t *rq) {
+
+  for (int pos_y = 0; pos_y < 15; pos_y++) {
+    const int16_t *line = input + pos_y * 192;
+    for (int pos_x = 0; pos_x < 15; pos_x++, output += 8) {
+      const int16_t *window = line + pos_x * 6;
+      const int16_t *filter = kernel;
+      for (int k = 0; k < 8; k++, filter += 27) {
+        int32_t acc = (int32_t)window[0] * filter[0]
+                    + (int32_t)window[1] * filter[1]
+                    + (int32_t)window[2] * filter[2]
+                    + (int32_t)window[3] * filter[3]
+                    + (int32_t)window[4] * filter[4]
+                    + (int32_t)window[5] * filter[5]
+                    + (int32_t)window[6] * filter[6]
+                    + (int32_t)window[7] * filter[7]
+                    + (int32_t)window[8] * filter[8]
+                    + (int32_t)window[96] * filter[9]
+                    + (int32_t)window[97] * filter[10]
+                    + (int32_t)window[98] * filter[11]
+                    + (int32_t)window[99] * filter[12]
+                    + (int32_t)window[100] * filter[13]
+                    + (int32_t)window[101] * filter[14]
+                    + (int32_t)window[102] * filter[15]
+                    + (int32_t)window[103] * filter[16]
+                    + (int32_t)window[104] * filter[17]
+                    + (int32_t)window[192] * filter[18]
+                    + (int32_t)window[193] * filter[19]
+                    + (int32_t)window[194] * filter[20]
+                    + (int32_t)window[195] * filter[21]
+                    + (int32_t)window[196] * filter[22]
+                    + (int32_t)window[197] * filter[23]
+                    + (int32_t)window[198] * filter[24]
+                    + (int32_t)window[199] * filter[25]
+                    + (int32_t)window[200] * filter[26];
+        output[k] = requantize_q15(acc, bias[k], rq);
+      }
+    }
+  }
+}
+
+// conv2d_1: 15x15x8 -> 7x7x32, 3x3 kernel, stride 2x2
+static inline void conv2d_1_specialized(
+  const int16_t *input,   // [15][15][8]
+  const int16_t *kernel,  // [32][3][3][8]
+  const int16_t *bias,    // [32]
+  int16_t *output,        // [7][7][32]
+  const requant_t *rq) {
+
+  for (int pos_y = 0; pos_y < 7; pos_y++) {
+    const int16_t *line = input + pos_y * 240;
+    for (int pos_x = 0; pos_x < 7; pos_x++, output += 32) {
+      const int16_t *window = line + pos_x * 16;
+      const int16_t *filter = kernel;
+      for (int k = 0; k < 32; k++, filter += 72) {
+#if defined(WITH_SIMD) && SIMD_BACKEND != SIMD_BACKEND_SCALAR
+        int32_t acc = dot_q15(window, filter, 24)
+                    + dot_q15(window + 120, filter + 24, 24)
+                    + dot_q15(window + 240, filter + 48, 24);
+#else
+        int32_t acc_0 = 0, acc_1 = 0, acc_2 = 0;
+        for (int i = 0; i < 24; i++) {
+          acc_0 += (int32_t)window[i] * filter[i];
+          acc_1 += (int32_t)window[120 + i] * filter[24 + i];
+          acc_2 += (int32_t)window[240 + i] * filter[48 + i];
+        }
+        int32_t acc = acc_0 + acc_1 + acc_2;
+#endif
+        output[k] = requantize_q15(acc, bias[k], rq);
+      }
+    }
+  }
+}
+
+// conv2d_2: 7x7x32 -> 3x3x64, 3x3 kernel, stride 2x2
+static inline void conv2d_2_specialized(
+  const int16_t *input,   // [7][7][32]
+  const int16_t *kernel,  // [64][3][3][32]
+  const int16_t *bias,    // [64]
+  int16_t *output,        // [3][3][64]
+  const requant_t *rq) {
+
+  for (int pos_y = 0; pos_y < 3; pos_y++) {
+    const int16_t *line = input + pos_y * 448;
+    for (int pos_x = 0; pos_x < 3; pos_x++, output += 64) {
+      const int16_t *window = line + pos_x * 64;
+      const int16_t *filter = kernel;
+      for (int k = 0; k < 64; k++, filter += 288) {
+#if defined(WITH_SIMD) && SIMD_BACKEND != SIMD_BACKEND_SCALAR
+        int32_t acc = dot_q15(window, filter, 96)
+                    + dot_q15(window + 224, filter + 96, 96)
+                    + dot_q15(window + 448, filter + 192, 96);
+#else
+        int32_t acc_0 = 0, acc_1 = 0, acc_2 = 0;
+        for (int i = 0; i < 96; i++) {
+          acc_0 += (int32_t)window[i] * filter[i];
+          acc_1 += (int32_t)window[224 + i] * filter[96 + i];
+          acc_2 += (int32_t)window[448 + i] * filter[192 + i];
+        }
+        int32_t acc = acc_0 + acc_1 + acc_2;
+#endif
+        output[k] = requantize_q15(acc, bias[k], rq);
+      }
+    }
+  }
+}
+
+// conv2d_3: 3x3x64 -> 1x1x128, 3x3 kernel, stride 2x2
+static inline void conv2d_3_specialized(
+  const int16_t *input,   // [3][3][64]
+  const int16_t *kernel,  // [128][3][3][64]
+  const int16_t *bias,    // [128]
+  int16_t *output,        // [1][1][128]
+  const requant_t *rq) {
+
+  for (int pos_y = 0; pos_y < 1; pos_y++) {
+    const int16_t *line = input + pos_y * 384;
+    for (int pos_x = 0; pos_x < 1; pos_x++, output += 128) {
+      const int16_t *window = line + pos_x * 128;
+      const int16_t *filter = kernel;
+      for (int k = 0; k < 128; k++, filter += 576) {
+#if defined(WITH_SIMD) && SIMD_BACKEND != SIMD_BACKEND_SCALAR
+        int32_t acc = dot_q15(window, filter, 192)
+                    + dot_q15(window + 192, filter + 192, 192)
+                    + dot_q15(window + 384, filter + 384, 192);
+#else
+        int32_t acc_0 = 0, acc_1 = 0, acc_2 = 0;
+        for (int i = 0; i < 192; i++) {
+          acc_0 += (int32_t)window[i] * filter[i];
+          acc_1 += (int32_t)window[192 + i] * filter[192 + i];
+          acc_2 += (int32_t)window[384 + i] * filter[384 + i];
+        }
+        int32_t acc = acc_0 + acc_1 + acc_2;
+#endif
+        output[k] = requantize_q15(acc, bias[k], rq);
+      }
+    }
+  }
+}
+
+#endif//_MODEL_CONVSPEC_H_
@@ -0,0 +1,6838 @@
+/**
+  ******************************************************************************
+  * @file    model_int8.h
+  * @brief   int8 network with per-channel requantization (nn_int8.h)
+  *
+  * GENERATED by tools/quantize_int8.py from src/model.h, do not edit.
+  * Used by cnn() when building with -DWITH_INT8, and by bench_int8.
+  * batch_normalization is folded into the next conv2d.
+  *
+  * Against the int16 network, on 178 images (reference signs, all 32x32
+  * crops of trafficsign3, random inputs):
+  *   max |output deviation| = 227 LSB, mean = 24.460 LSB (Q7 logits),
+  *   top-1 agreement 169/178
+  * Labelled reference samples: int16 88/147, int8 89/147
+  * Weights, biases and requantization tables: 107580 bytes (int16: 210392)
+  */
+
+#ifndef _MODEL_INT8_H_
+#define _MODEL_INT8_H_
+
+#include <stdint.h>
+
+#include "nn_int8.h"
+
+// input_t (Q7) -> int8, scale 0.00387549
+#define CNN_INT8_INPUT_MULTIPLIER 1082263585
+#define CNN_INT8_INPUT_SHIFT 29
+
+// conv2d: input scale 0.00387549, output scale 0.00362943
+const int8_t conv2d_int8_kernel[8][3][3][3] NN_ALIGNED = {-36, -38, 8, -8, 28, 33, -10, 102, 25, -18, -3, 18, -10, 15, -69, 30,
+  43, 102, -30, -38, 86, -127, -51, -66, -109, -10, -5, -71, -71, -127, 3, 40,
+  22, -56, 115, 31, 77, 28, -59, 50, -124, -6, 9, -65, 3, -25, 96, 46,
+  -3, -105, -37, -46, 31, -53, -71, 91, 20, -23, -43, 46, -33, -86, -63, 33,
+  127, 43, 56, 89, 13, -33, -33, 23, -48, 36, 20, -10, 15, -36, -56, -13,
+  -41, -127, -61, -43, -9, -43, -104, -89, 14, -32, 14, 66, -20, 40, 9, -29,
+  -89, -49, 6, 49, 35, 78, 92, 69, 72, 12, 35, 115, 36, 7, -65, -29,
+  7, -31, 38, 14, -46, 127, -24, 43, 46, 19, -46, 26, 46, 53, 108, 22,
+  -65, -36, -12, -46, -58, -62, -26, -114, -6, -73, -3, -89, 54, -22, -79, -60,
+  -70, -86, 16, -6, -57, 25, -127, -73, -92, 92, 86, -13, -63, 98, -70, 83,
+  10, -105, -72, 26, 3, 88, -107, 81, -10, -55, -94, 42, -124, 7, 26, -20,
+  29, 94, 10, -46, -75, -49, -104, 88, -104, 46, 127, -75, -85, -27, -89, 47,
+  -35, 86, 127, 65, -12, 83, -47, -27, -97, -47, 100, 0, 18, 62, 89, -124,
+  -30, -44, 56, -12, 27, -74, -77, 50}
+;
+const int32_t conv2d_int8_bias[8] = {1966, 2398, 2622, 4469, 19167, -7373, 3361, 3048}
+;
+const int32_t conv2d_int8_multiplier[8] = {1805571464, 1480568601, 1805571464, 1588902889, 1913905752, 1444457171, 1408345742, 1552791459}
+;
+const int8_t conv2d_int8_shift[8] = {39, 39, 39, 39, 39, 39, 39, 39}
+;
+
+// conv2d_1: input scale 0.00362943, output scale 0.0254675
+const int8_t conv2d_1_int8_kernel[32][3][3][8] NN_ALIGNED = {14, 70, -19, -11, -21, 122, -95, 5, -60, -44, 31, 10, -2, 81, -65, -3,
+  -41, 4, 36, -11, -17, -20, 9, -6, 57, 4, -55, 18, 1, 102, 27, 2,
+  19, 15, -28, -49, 0, 71, 18, 34, -12, 51, 4, -39, 13, 81, 83, 26,
+  -2, -44, 28, 8, -17, 97, -9, -13, -45, 4, -6, 5, 0, -20, -6, -19,
+  0, 0, -15, -6, 4, 127, 3, -25, 9, -11, 14, 6, -21, -11, -15, 17,
+  -16, 11, 16, 18, -10, -71, -35, 9, 7, 30, 4, -5, 2, -86, 11, 8,
+  9, 8, -8, -19, -5, -90, -9, 24, -5, -108, 15, -41, 0, -4, -28, 22,
+  -12, -27, 9, -31, 17, -37, 17, 14, -30, 19, -14, -1, 1, -7, -22, -2,
+  -9, 24, -20, -12, -4, -127, 24, -8, 12, 22, -21, -30, -7, -49, -4, 5,
+  -74, -113, 27, 12, -1, -117, 62, 6, -48, -18, 20, 22, -15, -54, 9, -16,
+  39, -46, 4, 2, -39, -29, 11, -1, -23, 63, -4, -44, -8, -127, 37, -1,
+  -62, -92, 47, 2, 4, -49, 54, 8, 2, -67, 26, 31, -18, 29, 31, -7,
+  -18, 25, -29, 12, 3, 10, -23, 14, 48, 21, -11, -56, -2, -49, -60, 14,
+  -12, -11, 27, -5, -11, -24, -26, 2, 25, -6, -18, -24, -12, -22, -18, -9,
+  -4, 60, -30, -3, -13, -31, 3, -17, 2, 51, -14, -4, -20, -18, 0, -13,
+  -56, -3, -9, 35, -12, -74, -56, -12, -39, -6, 3, 52, 3, -127, -15, -16,
+  -27, 38, 6, 18, -12, -74, 10, -26, -35, 9, 19, 27, 9, 22, 0, 8,
+  -27, -60, 15, 29, -3, -70, -18, 2, -4, -32, 21, 21, 4, -35, -64, -9,
+  -54, -37, 20, -4, 0, -12, 7, -11, -92, -42, 19, 29, -8, -104, -3, -14,
+  -73, -33, 25, 13, -21, -127, 10, -36, 35, -100, 5, -31, 8, -87, -70, 15,
+  -16, -4, 41, -35, -1, -12, -30, 20, -49, -21, 44, 15, 14, -92, -23, -22,
+  76, -71, -22, -7, 14, -46, -44, 5, 65, -100, -24, -35, 8, -35, -17, -7,
+  60, 46, -8, -37, -6, 6, -40, 19, -56, -36, -22, -20, 0, -37, 40, 9,
+  -94, -122, 26, 20, 4, -75, -65, 22, -21, -5, 33, -34, 22, 75, -15, -20,
+  -3, 32, -51, -20, -20, 19, -7, 14, -29, 5, 16, -72, 15, 50, -47, 24,
+  9, 5, 13, -42, -12, 87, -127, -11, 26, -5, 24, -6, -11, 6, 4, 1,
+  29, -32, -37, -14, -23, 37, -40, 3, -38, -86, -24, -6, -35, 94, -15, 15,
+  15, -11, -13, -42, -10, 52, -44, 6, -36, -3, -7, -43, 9, 75, -28, 11,
+  -4, 43, 8, -29, 9, 127, -46, 15, 15, 14, 14, 10, 15, -8, 23, 1,
+  -36, -31, 22, 38, 6, 67, 35, 6, -6, 0, -7, 9, 12, 40, -95, 18,
+  -19, 26, -7, 0, 16, 67, 42, 3, 11, 3, -6, 13, 2, 56, -18, -2,
+  36, -11, 21, -6, 18, 56, 32, 2, -43, 74, -34, 14, -29, 6, 35, 9,
+  -71, -39, -18, 0, -14, -115, 25, 7, 14, 44, 35, 6, 8, -48, 28, -22,
+  40, -109, 23, -6, -7, -121, -70, 14, -114, 9, 32, 12, -8, -12, -7, -20,
+  17, -13, 39, -17, 12, -79, -39, -28, 11, -100, -2, -73, 12, -109, -49, -1,
+  -26, 35, -2, -50, -12, -127, 28, 17, -40, -70, 18, -10, -11, -67, -4, -30,
+  -120, 97, 0, 58, -22, -63, 28, -16, -15, -23, -7, 48, -19, -127, 74, -11,
+  41, -69, 19, -10, -21, -63, 37, 5, -79, -115, 82, 8, -9, 8, -18, -13,
+  52, 86, 56, 15, 40, -8, -14, -48, 37, 46, -68, 30, -26, -16, -78, 15,
+  -34, -92, 0, -76, -5, -95, 28, 2, 15, 120, 33, 0, -14, -111, 51, -29,
+  52, 0, -42, 30, 3, -71, -18, 27, 16, -48, -29, 28, 10, -13, 0, -1,
+  -47, 0, 31, -17, -4, 40, -74, 7, 38, 14, 24, -11, -4, -87, -43, -15,
+  -31, -68, -2, 41, -10, -74, -4, -1, -19, -34, 8, -43, -10, 7, -8, 7,
+  -13, 101, 45, -77, 0, -53, -39, -54, -25, 39, 14, -34, -1, -127, 4, 27,
+  -47, -92, 63, -55, 7, -47, -31, -34, -16, -48, -2, -11, -9, 74, -43, -37,
+  -14, -30, -2, -39, -2, -127, -2, 3, -15, 24, 6, -1, -3, -115, 5, 12,
+  21, 47, 18, -1, 12, -20, 19, 18, 14, -53, 4, -44, -1, -94, -21, -2,
+  -33, -9, -4, -56, 0, -33, -10, 18, -2, 24, 10, -37, 4, -82, 21, 3,
+  -41, 35, -17, 17, 4, -70, 14, -12, -8, 0, -34, -33, 10, -29, 33, -7,
+  23, 6, 4, -43, -2, -82, -33, 8, -11, 4, -9, 4, -1, -27, -28, -6,
+  7, -13, -18, -9, -13, -67, -23, -6, 3, -13, -3, 12, -23, -36, -12, 2,
+  -7, 11, -3, 6, -3, -127, -16, 2, -40, 0, -20, 6, -16, -21, -35, 2,
+  -19, -52, -6, 16, 3, -70, -37, 2, 4, -61, -14, -14, 13, -67, -9, -7,
+  -37, -22, -8, 26, -11, -60, -16, 2, -36, -33, 5, 14, 19, -24, -4, 8,
+  2, -50, -12, 25, 23, -85, -22, -4, -49, -3, 5, -31, 13, -58, 51, -1,
+  9, 8, 18, -7, 8, -15, -31, 15, 4, -28, 18, 16, 16, -27, -43, -5,
+  0, 19, 8, -33, 4, -23, -22, 11, 5, 25, -18, -31, -14, -89, 4, 5,
+  18, -17, -1, -6, -1, -15, 11, 3, 53, -22, -3, -9, -28, -127, 18, 11,
+  13, -3, 6, -17, -23, -92, 9, 2, -6, -41, -30, -4, 11, -19, -18, 13,
+  36, -69, -11, -49, -22, 95, 7, -8, 36, -5, 19, 20, -29, 121, -92, 0,
+  9, -96, 6, -47, 26, 57, 66, -10, 57, -101, 34, -71, 8, -19, 59, -18,
+  54, -64, -11, -4, -8, -70, 33, 4, -24, -23, -50, 2, -17, -64, 63, -5,
+  -24, 50, -61, 28, -15, -95, 126, -14, -15, 5, -28, 24, -43, 127, -11, -3,
+  16, 3, 15, -21, -6, -38, -38, 2, 16, 44, 0, -45, 14, -85, -3, -16,
+  -7, -14, 22, -3, 15, -89, 30, -5, -73, -10, 0, 35, -22, 14, -25, -9,
+  7, 3, -37, -11, 5, -108, 27, -34, 18, -31, -28, -29, 8, -42, 8, -3,
+  -53, -64, 25, 24, 8, -24, -98, 6, 16, -31, 25, -6, -7, -127, -19, -17,
+  42, -58, 21, 21, -14, 19, -30, -8, -68, 17, 16, 50, -11, 0, -98, 6,
+  48, -9, -4, 27, -11, 60, -32, 0, 28, 4, -20, -42, -37, -18, -4, -14,
+  -97, 13, 55, 27, 8, -12, -42, 6, -6, 22, 44, -2, 5, -73, -67, -20,
+  -66, -26, -18, -29, -41, -30, -28, -33, 3, -9, -14, -21, 17, -127, -88, 0,
+  3, -92, 12, -4, -16, -121, -84, 5, -6, 74, 14, 23, 13, -12, 18, 6,
+  18, 6, 11, 2, 38, 31, 18, -28, -11, 44, 11, -64, -38, 85, -49, 3,
+  -40, 22, -20, -34, 20, -69, -13, -25, -127, 0, 20, -79, -17, -69, 58, -30,
+  -25, 17, -50, 44, -8, -62, 54, 5, -7, -6, 45, -7, 37, -46, 0, -44,
+  -7, 11, -50, 37, -57, -31, 76, 24, -40, 6, 29, -10, -5, -92, -18, 36,
+  7, -67, 2, 12, 23, -69, -67, 0, -24, 27, 24, -65, 4, -97, 10, 6,
+  -12, 98, 0, 4, 17, -85, -12, 9, -22, 61, 2, 34, 10, -51, -44, 17,
+  -20, 37, -53, 16, 4, 25, 2, -9, -10, -3, -40, 4, -6, -21, -12, 16,
+  -24, 64, -4, -27, -2, -127, 7, 27, 10, 15, -6, 0, -6, 21, 34, -20,
+  -4, -9, -5, 12, 1, -68, -30, -8, 6, 27, 16, 5, -2, -30, -22, -10,
+  -9, -46, 6, -20, 3, -49, 3, -12, -42, 88, 9, 8, -5, 10, -34, -8,
+  -5, -18, -40, -2, 4, 69, -6, 2, 0, 11, -23, 33, -1, -44, -20, -7,
+  14, -4, -3, -30, 9, -20, -40, 17, -9, -64, 3, -33, 10, 15, -54, -12,
+  -127, 14, -4, 36, 15, 44, 0, -10, 72, -64, 4, 17, 29, 5, -91, -25,
+  42, 28, -13, -41, -31, -25, -20, -6, 28, -6, -15, -3, 23, -67, 32, -3,
+  0, 60, -1, -4, 15, -38, -2, 1, 20, 9, -14, -9, -2, -13, 46, -9,
+  2, 127, -16, 35, 7, -80, 88, -26, 26, 3, -26, 4, -7, -46, 51, -11,
+  -26, 45, -21, -16, -33, 4, -12, 12, -69, 91, 20, 8, 12, -29, -10, 3,
+  26, 42, 6, 4, -15, -50, -17, -11, -8, 21, 7, 21, -8, -113, -12, 0,
+  -11, -22, 15, -27, -13, 97, 17, -8, -86, 8, 15, -12, 11, 127, 22, -5,
+  -35, 5, -7, -8, 1, 64, -7, -2, -55, -30, -4, -20, 11, 41, 2, -16,
+  -49, 13, -1, -17, 2, 0, -4, -33, -21, -19, -42, 8, 10, -67, -11, -6,
+  -4, -40, -1, 15, 4, 78, -13, -14, 16, -24, -12, -15, 6, -37, 9, 4,
+  32, 22, -16, 18, -2, -11, -33, 14, 75, 40, 16, 42, 8, 11, 71, -11,
+  0, -16, -49, 0, 25, -127, -32, 10, -21, -24, -42, -26, -6, -99, -32, 20,
+  23, -52, -8, -63, -20, -94, 6, 15, 18, -40, -23, 2, -17, -55, 29, -10,
+  -13, 12, 19, 32, 24, -94, 67, -1, 31, -12, -29, 48, -16, -121, -13, 18,
+  34, -4, -21, 9, -16, -39, -13, 28, -8, 20, -2, -37, 7, -116, -32, 13,
+  -43, -122, 68, -7, 3, -127, -29, 10, -103, 71, 10, -5, -2, 14, -4, -26,
+  -47, -36, -29, 27, -5, -49, 41, -1, -10, 51, -12, -16, -46, 0, 16, 34,
+  -63, -10, -6, -68, -11, 120, -33, 10, 20, 46, -19, 63, 32, 21, 45, 16,
+  47, -36, -46, 32, -26, -99, 0, -17, -10, 56, -46, 5, 28, -120, 94, -3,
+  27, 10, -25, -27, 26, -85, 29, 1, 8, -18, -6, -4, -4, -16, -5, 8,
+  12, -6, 0, -43, -9, 61, -19, 11, 12, -47, 23, -35, -3, 33, -21, 16,
+  19, -27, -19, -22, -8, -41, 12, 0, 19, -30, -44, -3, -24, 45, -10, -4,
+  -21, -56, -48, 3, -24, 102, 21, -7, 25, -21, 12, 0, 5, 33, 10, 8,
+  -25, -83, 34, 9, 20, -74, 19, -3, -23, -127, 17, 4, 15, 33, 36, -13,
+  -60, 11, 19, -13, -9, -30, -38, -9, 5, -22, 4, 5, -12, 41, 50, -4,
+  -10, -4, -10, -39, 0, 36, 41, 3, -12, -33, -33, -5, -14, 81, -24, 27,
+  -77, -18, 49, -6, 8, 36, 97, -9, -19, -99, -45, -10, 0, 15, 3, 12,
+  -17, -37, -25, 18, -7, 15, -6, 23, -45, -26, 28, -47, -4, 127, -6, -7,
+  -48, 33, -25, -10, 10, 66, -9, 1, -49, -16, 8, -23, 4, -33, -42, 9,
+  -10, -84, 2, -49, -24, -121, -10, 17, 8, -36, 8, -2, -31, -72, -45, 1,
+  -39, -24, 11, -12, 6, -61, -87, 3, -13, 44, -15, -44, -19, -17, 0, 16,
+  -47, -80, 19, -7, -34, -66, 0, 11, -75, 4, -19, 18, 16, 0, 29, 6,
+  -10, -56, -47, -28, -14, -127, -45, 19, -49, 12, 24, 14, 6, -116, -3, 17,
+  3, 69, -45, 8, 28, -19, 37, -16, 48, 50, -7, -34, 17, 127, 37, 23,
+  42, 96, 30, 39, -17, 70, 22, -9, -18, 92, 30, 6, 8, 6, -30, 18,
+  57, 101, -19, -6, 30, 25, 63, -25, 33, 27, -4, 26, -34, -19, -7, 18,
+  -21, 92, -20, -16, -10, -76, -100, 8, 39, 9, -30, -18, 23, -95, 18, -36,
+  27, 0, -7, -20, -54, -108, 30, 1, 24, -16, 35, 11, 1, 40, 3, -13,
+  56, -49, 30, 67, 2, 17, 3, -45, 24, 20, 0, 9, -28, -114, -7, 7,
+  -40, 8, -38, -13, 1, -23, 63, 24, -62, 25, 5, 27, 11, -68, 10, -1,
+  -51, -127, 2, 14, -21, -51, 0, -31, -56, 33, -10, 13, -25, 0, 7, 15,
+  -21, 53, -10, 13, 23, 34, 10, -7, -13, 61, 22, -4, -2, 17, -53, -40,
+  61, 125, 48, 11, 0, 0, 15, -14, -29, -44, -48, -14, -21, -61, -40, -25,
+  37, 19, 15, 22, 25, 104, -81, 9, 12, 63, -10, -8, 11, -52, -61, -28,
+  127, 0, -79, -67, -32, -43, 51, 46, 25, -31, -23, 69, -15, 26, 56, -44,
+  -61, 19, 18, 11, -30, 52, -66, -9, 45, -44, -64, -100, 11, -104, 25, -5,
+  -102, 31, 15, 11, 30, -52, -91, -5, -5, -11, -13, 6, -21, -36, -59, 7,
+  -55, 70, -54, 28, -2, -102, 56, -17, -2, 29, -19, 31, -6, -56, -12, 14,
+  -24, -7, -22, 13, -17, -36, -92, 12, 0, -18, 15, 26, 14, 15, -115, 1,
+  -12, -81, 25, 11, 20, -127, 0, -16, -22, -59, 15, -31, 0, 0, 21, -4,
+  -10, 7, 15, -71, -1, 10, 15, 16, 26, -22, 1, -21, -24, 51, -38, 4,
+  -2, 0, -16, -1, -8, 54, 53, -16, -21, 69, 4, -6, 9, 127, 26, -6,
+  -9, 43, -25, -6, 0, 36, -63, -12, 17, 43, 7, -41, 9, 95, 13, -6,
+  34, 33, -5, -55, 0, 14, 32, 17, -9, 26, 13, -38, 24, 50, -53, 12,
+  4, -82, 13, -26, 9, -9, -11, 2, 4, 0, -5, 25, -29, -54, -71, 6,
+  6, 0, 13, 29, -25, 91, -32, -10, -13, -47, 10, -2, 8, -95, -38, 14,
+  -13, 2, 16, -17, 19, -77, -77, -3, 15, -9, 0, -13, 5, -127, 15, -13,
+  -32, -2, 11, -29, 1, -50, -3, 8, 4, 13, 2, -52, -3, -62, 0, -1,
+  32, 30, -2, 3, -8, -80, 15, -4, 8, 4, 4, -10, -1, -21, -9, 7,
+  -6, -4, -9, 4, -14, -59, -10, 1, 4, 9, 1, -9, -3, -83, 38, 8}
+;
+const int32_t conv2d_1_int8_bias[32] = {5506, 3758, 6544, 6178, 2137, 10587, -8783, 10338,
+  5819, 7871, 5119, 5260, 1924, 13668, 3725, 6936,
+  6558, 1237, 2686, 3426, 3867, 1862, 3436, 5240,
+  5838, 11678, 2734, 2766, 9275, 5346, 3842, 2923}
+;
+const int32_t conv2d_1_int8_multiplier[32] = {1738620297, 1182261802, 1808165109, 2016799544, 1529985861, 1415370589, 1112716990, 1460441049,
+  1112716990, 1321351425, 1077944584, 1460441049, 1147489396, 1390896237, 1877709920, 1460441049,
+  1146529248, 2086344356, 1801688819, 2107241687, 1182261802, 1599530673, 1251806614, 1078707054,
+  1738620297, 1599530673, 1390896237, 1555345055, 2030994668, 1738620297, 1947254732, 1495213455}
+;
+const int8_t conv2d_1_int8_shift[32] = {38, 37, 38, 38, 38, 38, 37, 38, 38, 38, 37, 37, 37, 38, 38, 38,
+  38, 38, 38, 38, 37, 38, 38, 37, 38, 38, 38, 38, 39, 38, 38, 37}
+;
+
+// conv2d_2: input scale 0.0254675, output scale 0.0660064
+const int8_t conv2d_2_int8_kernel[64][3][3][32] NN_ALIGNED = {-7, -5, -12, -34, -2, 0, -6, -8, -20, -13, 29, -32, -14, 7, 8, -13,
+  27, -12, 8, 14, -2, -4, 30, 35, 23, -19, 22, -8, -35, 17, 7, 4,
+  10, 14, 26, -11, 14, 5, 13, 6, -56, -17, 62, -37, 0, 40, -36, -26,
+  -24, -4, 50, -28, -40, 12, 42, -16, -56, 2, 22, 15, 52, 17, -38, -16,
+  7, 18, 12, -7, 14, -8, -8, 0, 0, 4, -3, -35, 2, 16, -19, 15,
+  -44, -56, -42, -24, -47, -12, -5, -25, -73, -14, 54, 2, -5, 6, 24, 8,
+  -67, -43, 14, 31, 3, -42, 6, 41, -5, 28, -34, -39, -43, -82, -28, 26,
+  -27, -56, 25, -10, 9, 10, -28, -38, -23, -31, -7, -13, -32, 56, -43, -30,
+  -87, -40, -67, -10, -44, -127, 32, -10, -4, -6, 2, -37, -20, -25, 23, -18,
+  -17, -18, -47, 24, 26, -14, -19, 52, -59, -19, 46, -15, -20, -43, -65, -28,
+  -5, -11, -12, 21, -8, 5, 22, 12, 5, -43, -13, 32, -53, -2, -6, -9,
+  -22, 40, -53, -16, 2, -19, -42, 11, 15, 22, 12, -19, 0, 21, -12, -24,
+  -2, -14, -5, 3, -9, 0, 8, -8, -49, -17, -17, -14, -12, -7, -6, -4,
+  22, 2, 0, -34, 14, -2, -49, -27, 15, 34, -29, -15, -5, -46, 12, 14,
+  -47, -55, -24, 36, -30, -37, 0, -14, -27, 11, -55, 21, 14, 4, 17, -35,
+  -7, -20, -8, -8, 14, -2, -56, -30, -53, -12, -27, 2, -2, -8, 7, -22,
+  22, -8, 2, -16, -6, -5, 14, -14, -9, 17, -37, -32, -2, 9, 4, -37,
+  2, 12, 28, 28, 14, 0, -46, -19, -91, 7, -17, -6, -20, -6, 24, -26,
+  -24, -16, -9, 12, -7, -2, -11, -9, -2, 17, -24, 14, -7, -20, -30, 18,
+  0, -37, -62, -12, 0, -21, -21, -12, 21, -17, -54, -21, -20, 7, -56, 9,
+  -13, -41, -25, 17, -60, -24, -11, -24, -11, 4, -39, -14, -38, -32, 13, 27,
+  13, 2, 10, -23, -15, -24, -66, 32, 34, 0, -37, 21, -51, -30, -23, -38,
+  -9, 1, -2, -29, 1, 14, -14, -13, -11, -27, 13, -43, -14, -8, -17, -33,
+  -9, -12, 2, -12, 21, 2, 8, -49, 63, 13, 20, -28, 4, -18, -11, 7,
+  29, 15, 18, 3, 7, 42, -17, -6, -5, -34, 0, -19, 0, -8, -45, -37,
+  11, 21, 15, 11, 4, 14, 29, 2, -18, 15, -41, -19, -20, 4, -4, -9,
+  4, 26, 11, -6, 0, 17, -19, -24, -5, -8, -39, -17, -4, -14, -34, 20,
+  -22, -32, 7, -19, -52, -55, -10, -83, -39, -45, -4, 4, -42, -4, 2, 25,
+  11, -10, -3, -3, -7, -61, 6, 7, 13, -10, -28, -37, 7, -24, -9, 10,
+  -11, -5, -30, -7, -19, 28, 10, -27, -10, -41, -54, -34, -29, -4, 6, -25,
+  -42, 7, -18, -9, -4, -17, 0, -42, -15, -36, -22, 35, 22, -12, -4, -18,
+  4, -25, 5, -11, -17, 48, -21, -17, -89, 4, 13, -30, -13, 4, -15, -25,
+  -11, -18, 28, 12, 8, -14, 9, 11, 16, -15, -57, -23, 7, -34, -2, 29,
+  -24, -21, -52, -2, -48, -9, -41, 2, -21, -86, -61, 9, -127, 20, -21, -40,
+  36, 14, 2, -6, 13, 14, 7, 24, -15, -19, -6, -21, 4, -14, -2, 0,
+  -11, -9, -5, 23, -15, 12, -25, 17, -21, -6, -20, -30, -2, 9, 4, 14,
+  0, -22, 15, -11, -11, 0, -32, 15, -15, -24, 31, 20, -43, -6, -6, -43,
+  31, -25, -8, -53, -49, 3, -16, -92, -8, 61, -86, -15, 60, -32, -41, 3,
+  -18, 4, 7, 14, 28, 15, -16, 97, 13, 21, 0, -39, -52, -88, 18, 53,
+  -28, -65, 12, -39, -79, -90, -78, -77, 21, -112, -120, 39, 0, 44, -7, -31,
+  -39, -39, -29, 2, -6, -26, -22, -50, 56, -27, -36, 49, -3, 53, 30, 37,
+  41, -28, -43, 14, 59, -14, -56, -27, 54, 17, -14, 6, -14, -12, 74, 3,
+  32, 43, 0, -71, 6, 127, -4, -15, -18, 0, 31, -98, 69, -16, -87, -22,
+  -62, 28, 51, 22, -30, -30, -16, 35, 50, 47, 58, -98, 14, 15, -17, -11,
+  49, 13, 39, -46, 19, 19, -12, -3, -41, 33, 0, -23, -29, 57, -21, -28,
+  17, -14, -63, 8, -63, 3, 36, 23, -37, -3, 45, 74, -53, -82, 0, 52,
+  4, 2, 29, 60, 36, -63, -4, 9, -5, -12, 0, 72, -100, -91, -21, -31,
+  3, 11, 47, -53, -20, 8, 36, -69, -41, -3, -24, 36, 42, 41, -54, -23,
+  -60, -24, -5, 21, -53, -22, -24, -64, 10, -106, 9, -26, 20, 28, -18, 0,
+  10, 11, -20, 6, 7, -11, 23, -31, -17, 51, 17, -15, -4, -32, 7, 11,
+  35, 15, -39, -5, -23, 90, -28, 26, -13, 21, -9, 13, -52, -28, 15, -50,
+  -41, 48, -28, -25, -46, -5, -7, 4, 21, 0, 0, 45, -46, -6, 14, -29,
+  11, 0, -27, -53, -6, -15, -16, 23, -18, 36, 26, -29, 23, 22, 24, -6,
+  59, -39, 39, 11, 23, -14, -16, 23, 120, -44, -52, 9, 35, -38, 24, 20,
+  -51, -6, -13, 29, -40, 7, 27, 16, 18, 41, -9, 12, -34, -62, 49, 11,
+  12, -46, 11, 23, 39, -49, 41, -38, 78, -9, 6, 27, 6, -8, -24, -3,
+  -35, -39, -13, 21, 11, 17, 11, 0, -21, -46, -15, 3, -59, -3, 22, -17,
+  56, 38, -14, 25, 36, 20, -29, -24, 11, -61, -15, -43, -6, 0, 67, -21,
+  44, -10, -33, 19, 11, 71, -2, 29, 12, 14, 9, -24, 10, -3, -22, -8,
+  19, 20, -21, 8, -3, -30, 18, 35, -11, 3, 0, 0, 13, -13, 24, 13,
+  -73, 0, 20, -31, -2, -17, -12, 26, 23, 54, 6, -38, -21, -11, 5, 22,
+  -9, -35, 7, -25, 3, -12, 59, -35, 123, 0, -34, 13, -54, 5, 21, 28,
+  -47, 20, 2, -74, 21, 34, -9, -8, -74, -54, 43, 9, 23, 57, -67, -53,
+  -62, 0, 50, 8, -53, -12, -18, -55, -123, 70, 43, -99, 0, 8, 6, 41,
+  -51, 8, 13, -48, 23, 3, -21, 39, 0, 14, -11, -41, 34, -17, -78, 28,
+  0, -73, -106, -81, -56, 5, 35, -107, 60, -58, -31, -48, -127, 11, -30, 3,
+  28, -35, 7, -4, 15, -3, -39, 3, 0, 11, -17, 9, -8, 42, 22, 3,
+  -6, 5, -7, 10, 36, -35, -41, -3, -22, 9, 12, -8, 35, -11, 21, 3,
+  -16, -65, -7, 21, -71, -74, -2, -55, 14, -24, -9, 9, -80, 11, 0, 17,
+  12, -3, -64, 18, 3, -2, -35, 38, -7, -15, 6, 43, -32, -29, -33, -75,
+  44, -12, -15, 25, -11, 10, -14, -11, -28, -11, -23, 15, -82, 11, 46, 8,
+  -6, 13, 18, 50, 0, -10, 18, 69, 19, -18, -3, 5, -32, 5, 37, -3,
+  -25, 15, 17, -26, -19, 64, -46, -65, -36, -21, -2, 16, 12, 16, -54, 9,
+  -28, -6, 8, -11, -40, -25, -10, 0, -96, 17, 21, 6, 21, -56, 7, 32,
+  -11, -13, 20, -30, -32, -15, -64, -65, -10, -67, -22, -20, 40, 57, 3, 0,
+  -73, -62, -71, -25, -96, -58, -76, 50, -75, -10, -10, -57, -93, -3, 17, 38,
+  -46, 0, -2, 28, -9, -30, -36, -21, -31, -55, -10, 33, 0, 19, -27, -13,
+  -98, -57, -71, -76, -90, 17, -10, 54, -75, -24, -42, 21, 21, 3, 31, 0,
+  -32, 11, 17, -32, -17, 41, -12, 9, -21, 43, 17, 46, -6, -32, -18, 13,
+  7, -14, -44, 0, -53, -53, -46, -19, 13, -3, -31, 27, 21, 24, -14, -6,
+  -117, 4, 17, 37, 0, -53, -50, -12, 5, -70, -34, 66, -29, 22, -61, 13,
+  -45, -74, -127, -40, -66, -22, -49, -12, 25, 27, -59, 12, 4, -12, -27, -9,
+  -64, 15, -42, 14, -28, -49, -44, 0, -34, 3, -17, 23, -23, 16, 18, 16,
+  -59, -62, -71, -31, -70, -39, -112, 8, -25, 34, -24, -15, -7, 32, -44, -6,
+  0, 9, 0, -5, -21, 38, -28, -6, -21, -24, -17, 13, -43, -98, -39, 16,
+  -31, -37, -4, 0, -50, -89, -3, -31, -8, 21, -49, 6, 4, -41, -48, 0,
+  -50, -18, 27, 16, 17, 23, -32, 56, -49, -9, -10, 16, -17, -19, -85, 28,
+  -94, -31, 67, -14, -86, -122, -59, -93, -8, 113, -35, -15, 18, -53, -55, -17,
+  7, 9, -10, -19, 11, -4, -38, -56, 31, -6, -29, 46, -14, -3, 21, 22,
+  -70, -60, 4, -31, -66, -66, -66, -23, -17, 21, -63, -24, -18, -38, -38, 35,
+  -60, -7, 33, 8, 53, -30, -47, 80, 68, 38, 22, -37, 26, 11, 7, 11,
+  24, 19, 13, -48, 41, -50, -19, 13, -9, -35, 79, 37, -28, 50, 4, -23,
+  40, -2, -8, -8, 27, 47, 5, 10, 23, 17, 41, -101, 65, 50, 51, 28,
+  -126, -42, 112, 42, 60, -28, -60, -18, 47, -66, 16, 0, 32, 47, 31, 62,
+  -36, -2, -58, -47, -34, -21, -34, 0, -18, 41, 8, 15, 20, 18, 14, -32,
+  8, -3, -27, -19, 34, 47, 7, 40, 19, -4, -8, 37, 0, 23, 15, 16,
+  -32, -45, 6, -55, 7, 30, 2, -3, -29, 66, 43, -105, 88, 54, 69, -18,
+  8, 0, 85, 51, 38, -50, 4, -35, 38, 47, 28, -24, -12, -10, 73, 46,
+  32, -27, -17, -89, -41, 38, -57, -90, 6, -48, -30, 7, 62, 36, -3, 78,
+  99, -29, 31, -6, -38, 50, -26, 0, -52, -31, 24, -37, 32, -127, 27, 39,
+  8, -45, -8, -13, -15, -43, 7, 13, -59, -48, -30, 56, 23, 29, -45, 25,
+  16, 23, -54, -42, -49, 47, -49, -18, -19, 4, -31, -27, 28, -40, 46, -49,
+  -108, -70, 47, -21, -32, -60, 14, -10, 56, 10, -51, 71, 49, 58, 17, 53,
+  -20, 19, 18, 45, 8, -28, -71, -44, -43, 43, 75, -27, -48, -53, -42, -69,
+  -36, 17, -31, -29, -53, 17, -29, -67, -32, -59, -38, 41, -59, 54, -72, 28,
+  -83, -29, 9, -45, -53, 56, -45, -26, -24, 19, 20, -65, 40, -67, 0, -36,
+  24, 25, -78, -18, -46, 17, -54, 30, -47, 69, -14, 7, -33, 36, 41, 14,
+  0, -71, -27, 26, -64, -6, 7, 79, 57, 12, 8, -37, 24, -40, -31, -36,
+  -10, -16, 9, -6, -10, 10, -2, -24, -7, -6, 13, -3, 16, 14, -47, -14,
+  -6, 10, -22, 28, 6, 25, 18, -32, 68, 81, 32, -19, 45, -21, 28, -16,
+  48, 10, -20, 34, -18, 51, 2, 13, -57, 33, 31, 9, 26, 6, 25, -57,
+  3, -5, 76, 3, 3, -3, -27, 35, -49, 41, 16, -57, -32, 3, 22, -16,
+  -19, 24, 4, 27, 27, 31, 0, 8, 21, -31, 15, 21, -8, -17, -3, 28,
+  -22, -10, 11, -21, 42, -30, 24, -57, 57, -31, -63, -14, -58, 8, 25, 34,
+  -16, -2, -9, -32, 2, 14, -16, 32, -28, -6, 28, -3, 11, 9, -3, -85,
+  29, 13, 54, -3, 3, 30, -63, -14, -8, 53, 0, -38, 68, 48, -6, -47,
+  -119, -24, 25, 11, 25, -7, -5, 81, 35, -39, -24, 24, -13, 12, -47, 46,
+  3, -67, -126, -46, -57, -50, -57, -42, 46, 28, -79, -19, -16, 27, 25, 5,
+  -39, -60, -40, 23, -64, -127, 16, -40, 7, 3, -65, 30, -34, 23, 41, 0,
+  -6, -39, 43, 31, 24, -55, -84, 71, -23, -47, -32, -44, -42, -27, 9, -84,
+  -26, 34, -16, -51, 16, 38, 27, -11, 21, 3, 35, -66, 24, 12, 28, 9,
+  22, -26, 36, 21, 9, -28, -51, -4, 27, 28, -44, -63, 26, -32, -9, 32,
+  -13, 18, 25, -106, 21, 34, 20, 8, -5, -8, 50, -6, 0, 17, -6, -23,
+  -29, 59, 29, -5, -45, -40, -18, -14, 72, 50, 9, -33, 39, -32, 3, -11,
+  45, 24, 54, -61, 27, 7, 9, 19, 21, -11, 15, -39, -18, 12, -25, -6,
+  -57, -10, -14, -70, -3, -10, 39, 7, -4, -34, 3, 25, 26, 0, 31, 13,
+  18, -22, -50, -28, -4, 61, -20, -6, -24, 12, 2, 13, -18, -55, -22, -29,
+  4, 23, 4, 6, 30, -8, 37, -16, 4, 21, 4, -15, -29, -54, -45, 18,
+  -7, -22, 27, 33, 15, 50, -26, 45, -32, 12, 5, 20, -18, -68, -98, 0,
+  -7, 23, -52, -66, -17, -45, -60, -122, -34, 24, -127, -3, -36, 27, -17, -9,
+  29, 7, -10, -24, 0, 19, -37, -18, 8, -28, 2, -67, -21, -6, -6, 10,
+  -67, 0, -36, -17, -47, -45, -23, -83, -72, -7, -32, 6, -61, 0, 55, -23,
+  -14, 7, -75, -26, -28, 31, -28, -78, 8, -59, -5, 27, 41, 19, 15, -51,
+  -25, 29, 52, 11, 24, 3, 13, -43, -4, 38, -88, -18, 11, -120, 42, 41,
+  -7, -11, 50, -24, 41, 92, -2, -21, -84, -71, 29, -7, -32, 13, -101, -89,
+  -39, -6, 85, -34, 10, -6, -54, -59, -59, 35, -4, -64, 11, -33, 0, -21,
+  -50, -38, -17, 0, -4, -119, -14, 48, -11, 50, -51, -40, -18, -71, -12, 79,
+  -42, -75, 4, -43, -27, -112, -57, -110, -30, 10, -99, -12, -65, 3, -69, -38,
+  36, 2, 5, 5, 11, -34, 2, -3, -39, -12, -44, 20, -41, -23, -55, -13,
+  -21, 9, 69, -6, -61, -8, -7, -95, -85, -10, -67, 30, -18, 33, -3, -94,
+  18, 0, 55, -28, 33, 4, 22, 18, -18, -6, 5, -3, -9, 32, -31, 64,
+  -42, -3, 44, -34, -34, -8, -30, -43, -106, -21, -53, 70, 0, -3, -28, -47,
+  7, 20, -27, -2, -26, 23, -30, -60, -16, -19, -34, -17, -21, 65, 22, -16,
+  -57, 12, 4, 20, -10, -73, -23, 20, -64, 3, -25, -88, -43, -54, 28, 56,
+  -57, -15, -21, 5, -3, 8, 9, -2, 10, 18, -24, 2, 2, -13, -12, 2,
+  12, -15, -29, 2, 2, -6, 4, -31, 0, 0, 16, 8, -31, 0, -25, 21,
+  -52, -20, 7, 20, -19, -8, -3, 2, 0, 35, -14, 46, -21, -36, -16, -23,
+  19, -32, -42, -15, -31, 0, -31, -31, -11, 16, -19, 10, 2, 2, -41, -25,
+  -2, -3, 10, 37, -20, -35, 7, 16, -9, 4, -26, 13, -25, -17, 0, 25,
+  9, -23, -34, 9, -27, 2, -13, 5, -47, -46, 2, 36, 2, 4, -9, 2,
+  5, 7, -62, -63, -16, 23, -19, -6, -16, -18, 21, -44, -23, 25, 8, -54,
+  -19, 8, -26, -34, -27, -59, -18, -16, -19, 34, -14, -88, 2, 16, 20, 0,
+  -28, 16, 31, -31, 17, -33, 8, 39, -19, -49, 30, -55, 10, 53, -127, -50,
+  49, -42, -79, -100, -22, 9, 18, -44, 39, 41, -2, -40, -17, 24, -27, -6,
+  7, -31, 8, -2, -16, 3, -1, 10, 0, 10, -27, 4, 4, -11, 4, 4,
+  -2, 2, 11, -4, -55, -44, -53, 0, -47, 16, -23, -20, 24, -6, 27, -10,
+  -2, -7, -10, 3, 0, -20, -12, -28, -22, -39, 0, -26, -27, 32, 12, -2,
+  56, 0, 11, 19, 20, 42, 31, -23, 19, -9, 16, 4, 17, 2, 25, -40,
+  35, -15, -21, -9, -33, 8, 15, 18, -19, -55, 16, -11, 2, 49, 28, 15,
+  -2, -13, -11, 0, 40, 4, -29, -18, -6, 27, 23, -28, -38, -24, 7, -23,
+  31, 13, 20, -25, -17, 8, 9, -53, -9, -33, 16, -2, -12, 40, -8, -62,
+  7, 26, 5, 8, 9, -2, 13, -10, 0, 64, 14, -10, 28, -49, 34, -8,
+  -21, 3, -23, 25, -16, -8, 4, -4, 7, -2, -22, 26, -13, -19, -24, 17,
+  2, 8, -16, -30, -29, -18, -11, -15, -36, -14, -30, -12, -52, 14, 7, -25,
+  -21, -16, -3, -19, -1, -13, 1, 27, 2, 16, -22, 24, -19, -21, -8, 10,
+  -5, -34, -69, -8, 4, -37, -13, 21, 31, -20, -127, -20, -52, -12, 14, 21,
+  12, -15, -26, -14, 6, -3, -5, -12, -28, -63, 13, 4, -21, -25, 0, -39,
+  5, 25, 11, -24, 27, 22, 33, 8, -19, 16, 21, -8, 71, -26, 43, -2,
+  -28, 9, -16, 2, 0, 15, 24, 35, -9, 14, -2, -22, -31, -23, -42, 46,
+  -21, -40, -42, -51, -24, -44, -57, -49, -8, -14, -111, 6, -95, -8, -29, 2,
+  5, 7, 34, -8, 44, -5, 4, 41, -41, 4, 38, 13, 15, -25, -38, -33,
+  0, -11, -3, -51, 2, 0, 9, -34, 25, 43, -76, -8, 45, 12, 23, -6,
+  -38, 10, -47, -3, -1, -15, -24, -10, -14, -18, 16, 33, 10, -42, 6, 2,
+  -5, -40, 5, 2, -15, -46, -50, -44, 31, 7, -18, -34, 31, 10, -18, -37,
+  5, 3, 2, -17, 13, 15, -3, 24, -34, 32, 32, -29, 0, 6, -8, -27,
+  -2, 9, -55, -21, -11, -13, -22, 18, 11, 11, 7, -8, -7, -18, 7, 37,
+  -33, -39, -7, 8, 9, -20, 16, 0, -40, -16, -8, 33, 33, -21, -14, -25,
+  42, -13, -61, -21, -2, 24, -15, -13, -3, 57, 16, -16, 64, 26, 11, -15,
+  14, -19, -21, 0, -10, -15, 5, -14, 9, 22, 22, -26, 35, -6, 14, 27,
+  -12, -11, 48, 0, -20, -7, 9, -13, 3, 23, -14, -42, 9, 4, 5, -19,
+  -58, -21, -11, -26, -18, -62, -24, 9, 4, -5, -71, 5, 17, -54, -23, -28,
+  18, -17, 0, -6, -12, -49, -29, -110, -6, -61, -46, 27, -21, -2, -8, 6,
+  -21, 5, -2, -21, 5, 3, 1, -2, -15, 27, 9, -12, 21, -68, -41, -5,
+  -54, 8, 18, -15, -35, 12, -25, -127, 19, -3, -34, 2, -3, -7, -13, -47,
+  -16, -5, 16, -9, 8, -3, 21, -15, 21, -18, -14, -61, 17, -40, -63, 16,
+  -44, -49, 0, -44, -64, -39, -17, -78, -53, -28, 8, 0, -11, 26, -8, -11,
+  21, -5, 4, -67, 5, 11, 21, 9, -2, 9, 39, -49, 9, 14, -43, -46,
+  -16, 2, 35, -40, -30, -56, -2, -46, -9, 51, 0, -40, 19, -15, 41, 9,
+  18, 7, 5, -91, 2, 8, -18, -48, -23, 36, -7, -59, -17, -21, -20, 16,
+  -31, -44, 56, -23, -40, -8, -44, 0, 22, 0, -3, 0, 37, -55, 28, 6,
+  -34, -7, 2, -36, -5, -3, 4, -20, -2, -2, 7, -22, -4, 17, -32, 9,
+  36, 6, -24, -15, -40, -12, -5, -23, -16, -3, 59, -20, -16, 20, -43, 26,
+  55, -8, -18, -26, -34, -8, 12, -11, 4, -2, 9, -7, 24, 14, -16, 2,
+  -29, 34, -21, 17, 10, -14, 10, 35, 3, 18, 44, -18, 11, -50, 13, 11,
+  16, 7, 18, -10, -14, -59, -1, -9, -13, 9, 0, 25, -56, -47, -18, -28,
+  -31, 36, 15, -21, -15, 51, 49, 40, 12, -36, -62, 71, 48, 15, 5, -19,
+  5, 3, 24, 7, -49, -36, 18, -24, 12, -2, -39, 32, -24, 0, 0, 44,
+  -31, 11, -74, 48, -10, -29, 5, 9, 25, -25, 8, 27, -48, -13, -15, -13,
+  3, 12, -8, -32, 17, 45, -37, -12, -54, 7, 12, 5, -12, -38, -7, -23,
+  -64, 7, 32, 11, 21, 2, -19, 34, -60, 30, -6, -24, -11, -17, 27, 25,
+  20, 12, -2, 24, -17, -12, -16, -21, 29, -20, -17, 0, 19, 8, -41, -23,
+  34, -25, -73, -52, -32, 24, 11, 47, 17, 0, 11, 34, -20, 24, -22, -2,
+  37, -5, -22, 22, -24, -27, 13, 2, 10, 20, -12, -26, -44, 5, -2, -8,
+  -42, 16, 3, 39, 35, -47, -8, 16, 0, -25, -6, 2, -49, -45, -36, -14,
+  -37, -19, -12, 6, -22, -127, -58, -66, -4, -32, -17, 21, -39, -38, -7, 10,
+  34, -36, -6, -20, 19, 13, 19, 47, 57, -60, -8, -5, -51, -5, -79, -19,
+  9, -14, 6, -30, -3, -27, -64, 28, -15, 10, -8, -3, -76, 25, -34, -3,
+  -56, -32, -60, -29, -8, -44, -13, 53, 20, -55, 8, -2, -88, 9, 25, -46,
+  40, -5, -10, -15, 21, 0, -51, -38, -12, 29, 12, -48, 7, 13, 15, -18,
+  17, -9, 22, 20, 77, 24, 34, -25, 17, -3, -28, 22, -40, -36, 36, -5,
+  -63, 0, 18, 7, -9, -18, -51, 24, -48, 2, -40, -16, -35, -3, -27, 20,
+  -31, -36, -54, -25, -19, -49, -37, 6, -7, 0, -92, 12, -40, -2, -5, -5,
+  14, 4, -73, 9, -38, 12, -51, -45, -10, 37, -27, 50, -35, -23, 10, -35,
+  -14, 14, 35, 5, 11, 4, -11, 22, -37, 5, -33, -22, -17, -19, -16, 2,
+  -74, -35, 2, 28, 3, -54, -35, -9, -21, 20, -50, 19, -74, -3, 34, 30,
+  20, -48, -48, 18, -3, -18, -29, 25, -7, -16, -14, 24, -94, -5, -74, -46,
+  -25, 28, 12, 4, -22, -42, -25, 5, 2, 5, 23, 0, 28, 18, -10, -17,
+  67, -2, -70, -16, 8, 13, 21, 19, 43, -14, -30, 5, -14, -9, -5, 18,
+  23, 32, 27, -6, 17, -3, -32, 12, 2, -27, 0, -8, -46, 20, -53, 27,
+  -17, -23, 6, -23, 58, -29, 26, -43, 20, -30, -50, 53, 28, 52, 3, -21,
+  -31, -21, 10, 26, -5, -72, -6, 9, 0, 54, -29, 16, 25, -46, 34, -20,
+  47, 0, 35, 63, 77, -31, 11, -19, -57, -19, 55, -19, 26, 12, 24, -53,
+  -6, -9, -18, -6, -22, -60, 3, -40, 23, -29, 15, -13, -21, 35, -41, 22,
+  6, 32, -63, 32, 19, -13, 16, 31, 53, 22, 17, 5, -17, -66, 5, -5,
+  23, 2, -25, -22, -53, 48, 6, -38, 29, -22, 6, -11, -42, 41, -10, 20,
+  11, -2, -3, 5, 24, -73, 3, 65, 63, -8, 14, 5, -40, -19, -8, 21,
+  25, -7, -43, 19, -19, 66, -25, -73, -23, 32, 13, 13, 5, -13, 19, -40,
+  -17, 18, 41, 20, -29, -49, -50, 59, 40, 25, 28, 41, -40, -47, -19, 9,
+  -28, -5, 14, 4, 15, 6, 8, -9, -50, -10, -23, 13, 0, -15, -36, -27,
+  25, 14, -41, 14, 13, 33, -39, -127, -50, 46, 0, -36, 11, -45, 30, -30,
+  20, 14, -22, -54, -2, 33, -16, -71, 10, 12, -15, -24, 0, -8, 0, -27,
+  -14, -29, 25, 2, 3, -13, 24, -81, 17, -33, -6, -50, 9, -9, 19, 46,
+  -57, -2, 10, -19, 5, 12, -2, 21, 10, 17, -31, 3, -14, 28, -53, 55,
+  -44, -95, -60, -32, -56, -62, -45, -43, 120, -49, -17, 12, -43, 31, 8, 12,
+  9, -12, -26, -55, -24, 9, -2, -17, -4, 47, -2, -5, -7, 39, 12, -38,
+  34, -14, 6, 32, 22, 29, 3, 25, 37, -36, 8, 2, 12, -24, 30, 21,
+  -3, -16, 4, 0, -9, 21, -28, -72, -30, -72, -10, -13, 28, 52, -25, -38,
+  6, 30, 32, 21, 11, 45, 5, 13, -7, -6, 11, 7, 17, -24, 58, -9,
+  6, -7, -8, 6, -10, 34, -8, -10, 13, -12, 2, -43, 9, -15, -7, -3,
+  17, 14, -23, -14, -35, 4, -35, 57, 14, 8, 8, 32, 23, 34, -6, -19,
+  -61, -25, 6, 13, 17, -15, -13, -17, 23, -42, -23, -8, -23, 10, -42, -30,
+  -8, -28, 55, -11, 32, -2, -5, -32, 27, -56, 17, -5, 12, -17, -11, 2,
+  -29, 2, -60, -30, -21, 40, -26, -72, 23, 0, -56, 0, 42, 26, -44, 56,
+  54, -76, 42, -9, -127, -2, -80, 6, 20, -3, 37, -7, 3, -43, 30, -5,
+  12, 25, 16, 8, 9, 55, -21, -12, -8, -15, -31, 3, 14, -26, -2, 8,
+  82, 0, -68, -57, -76, -4, -8, 54, 27, -25, 0, 20, 3, 0, 30, 5,
+  -20, -20, 10, -11, -5, 64, -18, 29, 15, 47, 8, -38, 40, 10, 2, 15,
+  -3, 7, -19, -7, 16, -13, -32, 19, -10, -14, -14, 49, 3, 2, -25, -14,
+  -17, -14, 16, -13, -14, 0, -28, -77, -21, -25, -47, 48, -23, -13, -76, 30,
+  -31, 25, -84, 21, -49, 47, -38, -32, 37, 70, -85, 7, 14, -41, 47, -31,
+  9, 9, 4, 17, 5, 18, -5, 29, -59, -10, -51, -13, -28, -54, -22, -3,
+  -57, -28, -45, -67, -43, 9, -11, 6, 44, -67, -88, 44, -17, 55, -3, -33,
+  -40, -14, -23, -65, -9, 16, -23, 12, -53, 13, -10, 48, -57, 23, -50, -19,
+  7, -38, -4, -55, -14, -77, 10, -68, 39, 7, -64, -71, -59, -82, -4, 57,
+  80, 11, -61, -31, -35, 4, -35, -37, 13, -13, -5, 24, -86, 75, -22, -58,
+  -36, 12, -53, 12, 62, -48, 65, 40, -9, -25, 0, -114, -117, -43, 67, 12,
+  -62, 0, 13, 31, -22, -43, 0, 6, -3, -63, 10, 27, -27, 49, -69, 3,
+  50, 32, -33, -61, -41, 11, -10, 4, 13, -14, -4, 34, -95, 46, 49, -51,
+  -51, -32, 8, 22, -13, -70, -43, 3, -51, 25, 35, -14, -71, 3, 16, -16,
+  75, 29, -41, -20, 79, 6, 17, -20, 60, -46, -54, 15, 22, 37, -11, -21,
+  -22, -7, 10, 38, 11, -16, -8, -58, 16, -38, 12, 17, 6, 69, 37, -77,
+  -29, 32, -82, 79, 79, 51, 48, 52, -103, -127, -72, -56, -4, 49, 35, -42,
+  -7, 5, 35, 41, 15, 19, -31, 76, -24, 79, -7, 17, 39, 23, -37, 39,
+  -7, -56, -53, 29, 34, -20, -95, 56, -95, -14, -39, 6, -99, 33, 7, -39,
+  -4, 18, 15, 0, 42, 19, -6, 6, 21, 22, 54, -10, 12, 16, -41, -3,
+  -50, -44, -61, -12, 31, -26, -7, 40, 9, 18, 11, 9, 15, 0, -49, 21,
+  7, -2, 5, 22, 44, 51, -19, -24, -5, -41, 35, -17, 12, -43, 3, 3,
+  -22, 47, -53, 6, 7, 9, 65, 24, -47, -39, 0, -25, 22, 46, 35, -36,
+  29, -23, 18, 19, 0, 8, -8, 9, -24, -25, -20, 34, 77, -69, -34, 16,
+  29, 9, -29, 29, -69, 20, -27, 12, -69, 4, -14, 12, -59, 9, -4, 39,
+  13, -32, -62, 23, -42, 0, -33, -31, -24, -23, 18, -8, -92, -12, 18, -48,
+  21, 48, 79, 13, 13, -17, -8, 12, 10, 10, -18, 5, 41, -63, 34, -13,
+  16, -27, 4, 0, -11, -11, -5, -45, -32, -51, 4, 5, -44, -27, 7, -5,
+  -13, 52, 18, 37, -3, 6, -10, 3, 51, 36, 40, -18, 22, -58, -5, 11,
+  13, 20, 26, 0, 21, -6, -8, -7, 18, -37, -13, -30, -24, -5, -44, -12,
+  -72, 9, 9, -26, -40, 23, 43, -32, -10, -63, -48, 57, -11, 34, -36, -26,
+  -38, -30, 11, -42, -8, -17, -36, 13, 10, 32, 7, 15, -29, -19, -21, 21,
+  -34, -24, -79, -30, 30, -36, 3, -103, 10, 0, -34, 14, -22, 34, 21, -22,
+  -65, 8, 4, -32, -10, -14, -15, 13, 22, 46, 15, -80, 31, -24, 9, 43,
+  -58, -41, -3, -28, -13, -63, -50, -127, 13, -49, 24, -7, -14, -11, -29, 9,
+  -35, -10, 49, -21, -10, 46, -9, -13, 45, -14, 27, -53, 0, 24, 21, 59,
+  0, 4, -30, 6, -35, 21, 25, 68, 64, -26, 24, -11, -22, 16, 42, 37,
+  16, -22, -4, 4, -26, 11, -3, -11, -32, -58, -2, 18, -4, 14, 12, 5,
+  32, 52, -42, -2, 18, 19, 65, -9, -13, 29, 11, -14, -43, -38, 44, -9,
+  -24, -28, 4, 9, 8, -9, 5, -43, -18, -7, -9, -10, -11, 34, -2, 19,
+  0, 0, -6, -15, 23, -4, 15, 24, -6, -18, 0, -25, -14, 4, 8, 13,
+  -16, -40, -30, 14, -26, -49, 15, -25, -26, -72, -25, 0, 18, 48, -28, -14,
+  42, 4, -54, 26, -23, -19, 33, -15, -6, 31, -11, 9, -19, -13, 67, 31,
+  16, 18, -40, -25, 0, 27, -4, 8, -7, 11, 30, -50, -3, 11, -27, -14,
+  -37, 10, -14, 8, 0, -42, -53, -14, 41, 0, 3, 8, -38, -3, -18, -13,
+  -51, 6, -44, -33, -13, -40, -14, -45, -32, -60, 36, -9, 0, 11, 22, -78,
+  25, 13, -28, -3, 36, 52, 32, 3, -7, -3, 0, -38, -16, -32, -34, 39,
+  -32, -20, -13, -19, -35, 64, 5, 3, -5, 38, 21, -41, 16, 17, -14, -14,
+  31, 33, 11, 15, 24, 5, 44, 7, -11, -25, 50, -48, -32, -26, 21, 31,
+  -32, -14, -29, -62, -15, -17, -61, -26, -32, -5, 19, -35, -88, 3, -8, -28,
+  12, 10, 4, -20, -9, -17, 53, -21, -11, 46, -9, -43, -70, -3, -49, 52,
+  -22, -14, -40, -62, -15, 40, -34, 0, -16, 3, 13, -77, -8, -14, -65, -31,
+  -16, -36, -39, -20, 0, -52, -47, -35, 34, -28, 6, -81, -29, -3, 37, -34,
+  -29, -4, -18, -69, 4, -17, -11, 16, -46, -16, -2, 0, 26, -23, -30, -14,
+  -22, -3, 21, -35, -48, -7, -24, -17, -11, -6, 3, -102, -10, 29, 27, 28,
+  -35, -28, -2, -17, -21, 30, -25, 18, -28, -22, 17, 0, -57, 40, -22, -28,
+  -3, -46, -43, -46, 18, -15, 41, -76, 52, 37, -50, -24, 10, 3, -49, 28,
+  -127, -55, 22, -37, 2, -27, -39, -16, -60, -49, 4, 9, -49, -3, -68, -31,
+  -53, -31, -67, -8, 0, -67, 27, -87, 34, 28, 9, -13, 22, -55, -58, 18,
+  -16, -35, -7, 29, -69, -78, -5, 26, -46, -66, -36, 53, -70, 43, -41, 8,
+  16, 8, -110, -3, -39, 7, 6, -10, 37, 40, -84, 13, -76, -24, 15, -16,
+  19, -32, -46, 17, -16, -16, -13, 6, 27, -6, -30, 35, 0, 23, 28, 46,
+  84, 3, 37, 18, 52, -6, -14, 12, 44, 0, -11, -13, -34, 9, 25, 9,
+  -71, -37, 3, 27, 18, -39, -36, 3, -5, -35, -45, 72, -24, 0, -19, 7,
+  73, 27, -42, -27, 63, 35, 24, -69, 9, -39, 15, 22, 11, 62, 0, -48,
+  19, 0, 5, 27, 40, 28, 4, 19, 30, -3, -13, -17, 9, 7, -28, -29,
+  -22, 0, 0, 6, 63, 46, -10, 65, -79, -7, 69, -3, 4, 25, 50, -42,
+  -30, 21, -23, -75, -27, -20, -52, -31, -65, -3, 18, -76, 0, 20, 28, -88,
+  11, 15, 116, -36, -3, 9, 24, -20, -52, -50, -18, -72, -86, 34, 43, -6,
+  -37, 25, -8, -114, 20, 99, -36, -3, -46, -26, 13, -7, 91, 76, -114, -62,
+  7, -36, -66, -77, -24, 64, -35, -45, -52, 25, 4, -110, -41, -37, 82, 51,
+  -15, 30, -8, -51, 4, 55, -13, 0, -46, -29, 10, -31, -18, -10, 9, -3,
+  -47, -36, -4, -18, -83, 3, 21, 16, 35, 54, -7, 35, 15, 12, 18, 51,
+  -108, -25, -18, -32, -34, -4, -42, -77, 3, -73, -50, 3, -21, 70, -47, 23,
+  22, -86, -42, 27, -45, 9, -35, -41, -87, 0, -11, -22, 78, -71, 4, 24,
+  -45, -21, -44, -24, -38, -59, -33, -62, -30, -10, -35, 55, -79, 30, -16, -16,
+  -15, -45, 4, -62, -52, 23, -86, 28, -57, 11, -40, -47, -71, -12, -54, -127,
+  -30, 28, -23, -7, 25, 20, -8, 12, -24, -10, -8, -21, -39, 10, -51, 16,
+  -44, -24, 58, -47, -52, 0, -28, -8, -22, -39, -55, -44, -26, 59, 7, 15,
+  25, 16, 11, 6, 8, -7, 18, -31, 9, -14, -36, 6, 18, -6, 13, 58,
+  -22, -18, 28, 5, 0, 7, 26, 28, 22, -30, 31, 37, 47, 5, 21, -5,
+  60, -12, 39, 27, -4, 13, -2, 16, -2, 38, -32, 18, 0, -20, -67, 0,
+  -40, 23, -18, 13, -15, 20, 6, 7, -33, -30, 6, 53, 3, 5, 45, -26,
+  3, -10, -4, 2, 15, 23, 2, -34, 0, -24, -19, -3, -28, -3, -5, 36,
+  -43, -18, 21, 35, 21, 0, -6, 31, -33, -6, 22, 0, 6, -16, 0, -8,
+  6, 29, 2, -33, -11, -77, 5, -29, -30, -59, -21, -20, -23, -65, -32, -25,
+  3, -55, -70, -45, -21, 17, 23, 7, -37, -21, -68, 11, 76, 16, -6, 28,
+  35, -8, -72, 0, 2, -47, 4, 52, -32, 16, -6, -15, -8, 20, 3, -39,
+  37, -45, -14, -23, -35, -47, -3, 72, 22, -39, 28, -11, 41, 13, -15, -15,
+  -50, -27, -30, -56, -10, -127, 4, -18, 0, 22, 21, -18, -46, -23, -32, -39,
+  -12, 15, 70, -20, 47, -25, -29, -10, 33, -21, -3, 19, 66, -10, 21, -64,
+  -3, 31, -13, -68, -10, -20, 14, -3, -34, -41, 8, -12, -26, 62, -35, -25,
+  34, -48, -18, -38, 0, -17, 61, -24, 122, 21, -68, -69, 3, -39, -60, 44,
+  -16, -8, -20, -12, -17, -64, 27, 29, -34, 35, 28, -38, -95, 82, -59, -94,
+  108, -23, 4, -30, 32, -20, 41, -52, 85, 3, -25, -13, -32, -39, -6, -3,
+  -6, -10, -52, -4, -29, 10, 34, -31, -39, 32, 32, -18, 13, 39, 13, -28,
+  80, -23, 42, 20, 65, -12, -35, -17, 26, -36, -80, 11, 19, -68, 60, -23,
+  -55, -74, 0, 36, -66, -105, -13, 3, 12, -15, -25, 29, -61, 12, 23, -33,
+  60, 8, 11, 27, 58, -13, 41, -45, 105, -30, -30, 40, 7, 20, 43, -81,
+  55, -19, 7, -25, -50, -58, -4, 28, -35, 6, 16, -3, 39, -12, -29, -72,
+  47, 38, 8, 44, 6, 11, -32, -75, 8, -26, -17, -40, 55, 0, 23, -44,
+  41, 17, 2, -71, 35, 33, -4, 3, 35, 6, -2, -57, -3, 55, -61, 33,
+  -104, -22, 4, -8, -32, -13, -38, 60, -28, -46, 87, -14, -62, -6, 49, 36,
+  20, -4, -7, -67, 39, 65, -29, -20, 20, 3, 2, -48, 47, 15, -23, 21,
+  -10, 8, 50, 30, 6, -19, 22, 19, 72, 23, 30, -40, 41, -14, 82, 14,
+  17, 27, -35, -36, -21, 29, -19, -85, -37, -38, -5, 19, -53, -6, 15, -36,
+  37, 41, 8, 5, 19, 0, 22, 127, 32, 43, 7, -17, 21, -48, 43, 44,
+  -102, -91, 31, 4, -12, -33, 4, -20, -35, -85, -32, 0, -103, -31, -9, -30,
+  57, 0, 11, 3, 58, -16, -29, 15, 52, -10, -67, 23, 51, -6, -3, -64,
+  -89, -36, -24, 2, 8, -91, -10, -3, -47, 0, -5, 63, -42, -21, -32, -21,
+  27, 36, 0, -8, -29, -13, 38, -63, -32, 23, -33, -17, 3, 14, -3, 11,
+  0, -2, -9, -38, 6, 0, -4, -6, -5, 82, -16, 35, 11, -61, -29, -24,
+  23, -14, 19, -41, 32, 0, -6, -86, 56, 7, -77, 3, -10, 26, -39, 3,
+  -41, -30, 14, 7, 10, 29, -6, 43, -2, 12, 7, -57, 36, 3, -12, 21,
+  40, -16, -69, -41, -45, -24, -60, -37, -84, 49, -40, -38, -72, -3, -13, -3,
+  18, -32, -36, -10, -26, -13, -5, -18, -35, -5, 6, -37, -67, 24, 21, -27,
+  30, 19, 7, 0, 51, -2, 31, -50, 32, -35, -18, -33, -49, -23, 0, 17,
+  -21, 4, 10, -16, 4, 19, -5, 5, -4, -10, 45, -104, 5, 5, -15, -35,
+  -39, -17, 37, -10, 40, -12, 14, -46, 46, -18, 9, 13, 3, -23, -12, 25,
+  -12, -15, -52, -14, -2, 26, -22, 3, 15, 13, -10, -28, 10, 32, -26, -3,
+  -18, -12, -74, -14, -26, -5, -53, -3, -21, -12, -33, -38, 21, -5, 41, 17,
+  -30, -26, -2, 24, 22, 0, -2, 30, -42, 26, -33, -25, -59, -41, -28, -3,
+  -6, -39, 0, -2, 0, 12, -48, -43, -93, -3, -50, -8, -52, 43, -15, -34,
+  -127, -90, 44, -26, -20, -103, 14, -18, 49, -21, -31, -34, 0, 14, 36, 93,
+  -21, -70, -27, 10, 9, -35, -42, -17, -78, -15, -12, 46, -70, -28, 15, -42,
+  24, -9, -27, -2, -26, -3, -2, -53, -57, -44, 12, 31, -5, 32, -31, -35,
+  -48, 44, 37, -19, -65, -19, -31, 46, 4, 0, -15, -59, -36, 40, -9, -62,
+  0, 34, -2, -53, 9, 10, -2, -5, -55, 5, 27, -118, 5, 70, 13, -40,
+  -48, -15, 14, 5, 20, -9, -11, 30, 4, -41, 9, -33, -36, -30, 44, 47,
+  -3, 22, 15, -42, 13, 10, -31, 15, -77, -52, 57, 17, -39, 60, -44, -29,
+  6, 41, 30, -43, -28, 5, 28, -20, 0, 3, -50, 15, 39, 20, 3, 42,
+  33, -24, -25, -18, -53, -19, -2, -70, 0, 0, 0, -8, -15, 51, -5, 16,
+  21, -29, 24, 12, -37, -42, 20, 26, 82, -9, -12, 0, -3, -30, -3, 2,
+  17, -25, 21, 33, 2, 40, 10, 17, 25, -17, -9, -13, 0, 30, 9, -27,
+  -3, 27, 42, 32, 3, -16, 9, -19, -64, -49, 33, 23, -7, 17, 29, -11,
+  7, -13, -9, 35, 27, -43, 0, -39, 47, -17, -27, 25, 25, 3, 0, 63,
+  -23, -19, 4, 16, 16, 24, 13, 19, -40, -85, 3, 43, -65, 56, -23, -33,
+  -37, -13, 54, 9, 18, -11, 8, -62, 52, -58, -37, -6, 58, -12, -17, 72,
+  -53, -43, 11, -8, -79, 16, 6, -59, -84, -13, -20, -14, -41, 0, -33, -3,
+  -71, -65, 14, 33, 18, -90, 6, -39, 40, -20, -66, 85, 17, -3, 26, 72,
+  3, -11, -23, 43, 0, 11, -13, 22, -64, -29, 33, -9, 14, -6, -33, -30,
+  41, 4, 21, 7, -12, 22, 13, 0, 37, 44, -39, -25, 19, -42, 6, 69,
+  -123, 19, 11, 35, -89, 13, -44, -15, 4, 3, 7, 11, -31, -54, 7, -19,
+  -41, -2, 66, -20, 6, -18, -23, -37, -30, -44, -34, -47, 17, 52, 3, -12,
+  -57, -49, -80, -11, -67, 5, -41, 4, -96, -36, 36, 26, 10, 14, 16, 8,
+  30, 42, -9, -53, 16, 4, 17, 31, 57, 50, 27, -69, 3, -30, -9, 24,
+  17, -11, 23, -3, -127, -8, -44, 15, 76, 7, 13, 6, -10, 17, -13, 22,
+  -30, 8, 26, -91, 20, -65, 4, 25, 5, 23, -30, -19, 19, -36, -38, 15,
+  -3, -71, -49, -81, -105, 8, -28, -19, 80, 10, 60, 29, 20, -70, 7, 50,
+  -14, 6, 7, -64, -45, -47, -17, -48, -17, 26, -39, 3, 50, 18, -35, 39,
+  -30, -24, 38, 3, -38, 3, -6, 15, -60, 52, 30, -23, 31, -93, -52, -8,
+  -27, -19, 6, 28, -36, -51, 12, -15, -11, -18, -51, 17, -69, -14, -8, -32,
+  -9, -2, -17, 12, 14, 24, 39, -10, 0, -6, -21, 43, -6, -13, -29, 39,
+  -33, 0, 4, 22, -9, -19, 34, 13, 24, 26, 8, 17, -29, -11, -28, 32,
+  -41, 24, 17, -7, -11, -31, -11, -43, 0, 0, 41, 38, -48, 20, -67, -37,
+  48, 17, -23, 6, 7, 0, -14, -3, 0, 18, 0, 6, 17, -19, 15, 16,
+  0, -22, -30, 22, -34, -33, -17, -36, 14, 17, -12, -8, -15, -18, -12, 47,
+  6, 13, 19, 2, 16, 16, 19, 15, -86, 36, -35, 8, 2, -27, -49, -72,
+  -30, 22, 20, -31, -20, -7, 0, -30, 11, -15, -127, -8, -100, 38, -20, -42,
+  -36, -7, -19, -32, -15, 19, 3, 33, -4, -13, -47, 115, -2, -8, 3, 8,
+  -77, -24, -115, -43, 37, -89, -8, -20, 53, 12, -103, -26, -85, -8, 73, 64,
+  -30, -26, -25, 4, -26, -22, 0, -35, -20, -21, -6, 65, -17, 24, -41, -8,
+  -36, 7, -3, -48, -34, -42, -3, 10, 7, 17, -38, -31, -12, -18, 49, -2,
+  36, -6, 2, 2, 9, 13, 27, 18, 20, 5, -8, -6, 20, -54, -5, 35,
+  6, 0, -3, 10, -34, 19, -22, 40, 75, -15, -89, -28, 27, -3, -55, 7,
+  0, -37, -31, 6, 2, -96, 20, 0, -79, 3, 6, -8, -88, -97, 3, -80,
+  62, 27, 95, -2, -3, -14, 8, -36, 7, 15, -74, 36, 27, -13, -15, -84,
+  -3, -22, 2, -6, 36, 26, -32, -10, -31, 3, -8, 3, 32, 8, -8, -24,
+  30, 0, 0, 5, 20, -75, -53, -50, -43, -29, -3, 0, 24, 8, 52, -7,
+  -80, -4, -29, -2, -29, 60, -30, -35, 11, -38, -48, 11, 34, -37, -5, -5,
+  -61, -10, -3, -28, -3, 28, -14, 0, -18, 14, -9, 23, -63, 40, -6, 15,
+  -15, -15, 35, -6, -9, 51, -55, 22, -41, 36, -4, -6, 17, -69, -58, 5,
+  20, 21, 7, -45, -25, 16, -11, -59, -14, 11, -73, -5, -18, -10, -49, 19,
+  12, 7, -19, -4, 5, -54, -8, 10, 9, -5, 0, 19, -17, 11, 23, -8,
+  -9, 10, -7, -2, 8, 7, 22, 23, -46, -6, 6, 8, 9, -2, 23, 17,
+  -60, 22, 8, -66, 13, 92, -79, 32, -7, 10, 4, -64, 34, -3, -117, 10,
+  9, -41, -50, -95, -28, 21, -11, -75, 0, -14, -47, -30, -39, 67, 0, 22,
+  3, 7, 6, -27, -5, 47, -42, 50, 0, -15, -20, 47, 29, 13, -127, 37,
+  32, -67, -110, -102, -42, 39, 6, 16, 4, 29, -70, -60, -15, 0, 31, 27,
+  6, -18, 8, -29, 5, -38, -15, 10, 37, -23, -6, 17, -19, -21, 13, 16,
+  23, 7, 47, -5, 28, -9, 11, 42, 53, -14, 17, 0, -24, -12, 37, -29,
+  -12, 6, -43, -43, -31, -16, 0, -17, -17, -10, -22, 28, -5, 51, -20, -13,
+  -29, -43, -30, 7, 14, 12, -25, 59, -60, 49, 0, -83, -39, -87, -17, 7,
+  9, 15, -35, -4, -20, 25, -22, -7, -46, -28, -20, 36, -17, 8, -30, -42,
+  3, -41, -67, -31, 28, 32, 8, 33, -46, -11, -17, -8, -15, -37, 34, -41,
+  39, 6, -16, -19, -13, -9, 13, -27, -2, -15, -32, -6, -34, 11, 28, -55,
+  -3, 10, 53, 7, 14, 60, 30, 0, -21, -26, -6, 25, 66, -30, 29, -10,
+  -67, -28, 34, -12, 10, 9, -14, -13, 32, 5, 7, -10, 18, 17, 18, 24,
+  -5, -50, -45, -6, 5, -32, -25, -35, 0, -26, 11, -16, -8, 0, 3, 29,
+  -30, -7, 21, 39, 29, 23, -14, 9, 6, -9, 4, 10, 11, 36, -30, 5,
+  -8, -30, -63, -32, -43, 2, -43, 3, -73, 21, 16, 46, 32, 13, -31, 13,
+  -22, -22, -30, 12, -2, -43, -5, -7, 12, 49, -15, 25, -13, -27, 44, -17,
+  -19, 11, 6, 19, -43, -38, -30, 18, -127, -36, 21, -16, 38, -34, -23, -42,
+  -11, -8, -4, 11, -15, 6, 11, -20, 0, 35, -7, 35, -18, 14, -18, 24,
+  -26, 30, -45, -9, 3, 23, -35, 56, -16, 42, 18, -9, -11, -47, -39, 4,
+  22, -38, -37, 19, -24, -14, -24, 4, -6, -12, -64, 20, -64, -63, 23, 2,
+  -61, 9, -87, 13, -66, -44, -13, 80, -48, 0, -26, -16, -103, 16, -60, -59,
+  22, 0, -13, 33, -8, 52, -9, -11, -8, -5, 4, -3, 2, -2, 11, 9,
+  -45, 26, -12, -11, 23, 4, 33, -41, -19, 3, -21, 27, 16, 27, -13, 40,
+  -30, 28, 28, -48, 20, 32, -11, 13, -8, 2, 24, 5, 13, 39, -2, -19,
+  19, 32, 18, -49, -8, 36, -38, 0, -35, 21, 29, -36, 22, 13, 8, 26,
+  16, 12, 7, -63, 33, 20, -21, 13, -10, -16, 13, -20, 44, 48, 5, -66,
+  0, -13, 33, -58, -8, 11, 8, -56, -60, -34, -5, -46, -16, 34, 28, 42,
+  22, 0, 4, -30, 34, 20, -30, -2, 10, -21, -7, -10, 59, 43, -18, 31,
+  13, -63, -54, -21, -33, 27, -15, 21, -13, 8, -11, -39, -11, 4, 49, 18,
+  9, -2, -53, 42, 0, -10, -16, -8, -9, -11, -8, -9, 2, -8, 24, 27,
+  -6, 29, -27, -2, -29, 7, -46, 40, -90, 0, -36, -26, -25, -15, 21, 17,
+  28, 19, 42, 30, 26, 55, 9, -18, 2, -16, 2, -34, 15, -44, -21, 5,
+  -18, -34, -7, -22, 11, -10, 31, -40, 33, -24, 15, -3, 12, 23, -21, 40,
+  -37, -13, -28, -4, -20, -10, 17, -5, -2, 26, 6, 31, 25, 33, 0, 30,
+  -21, -10, 38, 10, -11, -10, -43, -27, 40, 56, 33, -44, -3, -15, 47, 5,
+  -9, 8, -17, -74, -24, 16, -36, -15, -29, -3, -12, -51, 37, -5, -16, 5,
+  -6, -5, -38, -42, -34, -12, -57, -40, -7, 3, -36, -26, 43, -33, 12, 20,
+  -83, -13, -19, -58, -33, -23, -3, -26, -38, -61, 0, 11, 7, 36, -26, -24,
+  21, -64, -127, -64, -37, 10, -46, 84, -11, 86, 48, -36, 25, -64, -9, 42,
+  31, 17, -4, 24, -4, 39, -7, -20, -29, -5, -10, 40, -20, 3, -39, -30,
+  -36, 29, -7, -71, 3, 10, -3, 20, 14, 27, -36, 31, -62, 3, -50, 12,
+  -43, -11, -57, -18, -39, -26, -41, -41, -69, 55, 0, 14, -22, -3, -34, -49,
+  3, -34, 24, -2, 3, -26, 3, 34, -33, 30, -30, 21, -6, -97, -3, -22,
+  -64, -40, -23, 16, -33, -42, 2, -33, -18, -55, 17, 80, -65, -25, -58, -35,
+  39, -2, -48, -34, 52, 38, 20, 20, -61, 65, -96, -21, 28, 0, -21, -47,
+  21, -8, 32, 34, 45, 29, -3, 28, 4, 55, -27, 60, -50, 11, -10, 51,
+  -72, 25, -10, 10, 14, -22, -3, -37, 76, 9, -54, -3, -43, 51, -18, -40,
+  62, -22, -40, -51, -23, 4, -57, -39, -6, 13, 5, -54, -50, 69, -3, -89,
+  11, 37, 0, 3, 44, -24, 83, -25, 50, -30, -19, 10, 66, -6, 11, -41,
+  43, 7, 3, -5, 7, 41, -7, -10, -23, -7, -50, -7, -38, 21, -7, 3,
+  0, -9, -13, 31, 18, -3, 18, -17, -87, -127, -23, 23, -39, 13, 19, -47,
+  0, 48, 3, 33, 12, -21, -26, 0, -34, 20, -24, 25, -38, 28, 7, -3,
+  -30, -34, 17, 22, -11, -21, 14, 47, -73, 4, 42, 3, 8, 29, 4, 28,
+  -35, -67, -29, 43, -33, -53, -15, -39, -17, -57, -47, 4, -25, 62, -10, -24,
+  8, 28, -26, 68, 29, -51, -32, -89, -64, -60, 0, 3, 74, -35, 112, -98,
+  -19, -10, 13, -5, 44, -25, 0, -58, -28, 40, -10, -40, -3, 3, -7, -55,
+  4, -46, 113, -22, -36, 24, -4, 13, -82, -26, 27, 26, 31, -13, 11, -47,
+  -54, -38, -70, 23, -26, -91, -20, 35, 34, 13, -42, 40, 13, -21, -20, 14,
+  34, -59, -26, -34, -47, -45, -104, -55, -27, 7, -4, -56, -16, 19, 63, -66,
+  97, 41, 3, -25, 16, 45, -35, 0, -17, 17, 50, -112, 0, 87, 43, -38,
+  -84, 28, -9, 19, -109, -39, 14, 38, -91, -41, 57, -3, -8, 45, 48, -22,
+  12, -2, -13, -28, -21, -82, -28, -61, 37, -47, -29, 22, -35, 100, 53, 41,
+  30, -37, -65, 25, 51, 39, 115, 80, -18, -30, 61, 43, 50, -48, 78, 32,
+  39, -2, 32, 15, 5, 41, -4, -10, -59, -13, 26, 7, -98, 21, -10, -75,
+  -27, 53, -9, -15, 25, 72, 104, 8, -46, 34, -38, 36, 35, 52, -33, -73,
+  -19, -23, 7, 4, 2, -9, -29, -2, -4, -2, -53, 3, 15, -7, 7, 7,
+  69, -24, -36, 2, 28, 17, 23, -12, -10, -29, -21, -25, -54, 38, 3, 13,
+  24, 20, -22, -5, -15, 3, -18, -2, 8, -32, 16, -55, 9, 5, -2, -45,
+  -19, -24, 60, 34, 38, 6, 28, -47, -54, -55, 45, -64, -8, -7, 57, -4,
+  8, 8, -22, 14, 13, 14, -29, -36, 8, -25, 16, -38, 22, 0, -16, -17,
+  -16, 6, -48, 30, -20, -4, 5, 44, 19, -31, 26, 11, -14, 16, 5, -31,
+  -8, 5, -37, -12, -29, -34, -30, -45, 10, -28, -60, 18, -2, 24, 9, 12,
+  -29, -17, 36, -11, -5, -4, -30, -3, -3, 57, 11, -25, -3, -29, 8, 4,
+  -51, 0, 6, -14, -3, -106, -18, -58, 39, -19, -36, -83, 29, 5, 11, -2,
+  -50, -69, 21, 17, -10, 6, 35, -27, 79, -39, 61, 27, -32, -9, -44, -48,
+  -57, 2, 9, -26, -16, -6, -9, -29, 20, -5, -9, -35, 2, 0, -28, -19,
+  -37, -24, -27, -28, -10, 40, 13, -15, 127, -60, 55, 2, 27, -2, -36, 4,
+  -19, 23, 4, 14, -33, -72, -35, -22, 18, -7, -29, 13, -13, -72, 2, 45,
+  -48, 4, 54, -11, -5, -13, 23, -9, 41, 8, -47, 9, -27, 18, -31, -13,
+  -19, 3, -17, 4, -46, -49, -23, -4, 20, 16, -16, -60, -26, 17, -7, 17,
+  0, -60, -6, 9, 0, -17, -25, -35, 92, -36, 3, 30, 8, -18, -26, -2,
+  -27, 5, 4, 2, -39, -46, 6, 16, -20, -16, -18, 10, -13, 5, -7, -36,
+  -58, -6, -60, 19, -20, 25, 5, -24, 57, -21, 45, -23, -46, -4, -16, -29,
+  10, -6, -50, -36, -28, 21, -4, -46, -46, -28, 18, 21, 48, 9, 0, -9,
+  -3, 8, 29, 0, -40, 77, -30, 54, -50, 32, 16, -47, -33, -35, -9, -48,
+  7, 8, 20, -19, 32, -10, -4, -14, -127, -23, 31, 3, 11, 15, -48, -61,
+  -74, 18, -33, -58, -12, 18, -24, 32, -66, 114, -39, -17, -13, 5, 0, 11,
+  -10, 28, 5, 0, -16, 42, 17, 27, 7, 48, -4, 34, 13, -23, 22, 32,
+  -42, -18, -66, 10, 18, 15, 52, 36, 8, 25, -58, 22, -7, -16, -13, 32,
+  -125, -71, 11, 41, -42, -115, -11, -25, -19, -31, -44, 9, -51, 0, -45, 20,
+  42, -24, -44, -18, 3, 23, 3, 22, -8, -19, -3, 78, 3, -16, -35, -96,
+  26, 16, -68, -24, -34, -42, 11, -104, -38, 51, 11, -9, 13, 9, 53, 17,
+  -55, 3, 29, 31, -12, -31, -85, 68, -108, 6, 16, 6, -10, -106, -28, -64,
+  -13, 26, 27, -32, 16, 21, -11, 46, -24, 6, 38, 40, 21, 6, -59, -6,
+  26, 26, 37, -91, 18, 38, 21, -22, 12, 38, -6, -19, -7, 57, 22, 27,
+  16, 28, 20, -17, 32, 28, -9, -22, -41, 23, 7, -3, -40, 38, -34, -9,
+  -55, 16, -18, -8, 43, -18, -18, 36, -35, 0, 10, 22, -30, 3, 9, 21,
+  -118, -2, -14, 11, 8, -94, 22, -22, -2, -11, -40, 30, -27, -26, 14, -9,
+  32, -37, -51, 3, 77, 15, 110, 50, -23, -22, -10, 11, -7, 46, -3, 0,
+  -20, -16, -36, 19, -12, 24, 20, -11, 26, 37, -4, 12, -8, -26, -28, -17,
+  13, 18, 73, 10, 22, -5, 12, 50, 4, -41, -35, -47, -56, 14, 28, 24,
+  8, 2, 55, 31, 12, 21, -72, 7, -15, -14, 51, 41, 3, 75, -37, -70,
+  43, 10, -85, -19, -7, 44, 15, -26, -56, 85, 16, -14, 112, 17, 54, -20,
+  -24, -25, 39, 3, -31, -106, -56, -43, 38, 3, -22, 0, -23, 11, -37, 63,
+  -71, -80, -63, 67, -15, -25, -52, -13, 33, -65, 35, 41, 12, -17, 0, 3,
+  60, -17, -22, 18, -24, -34, -63, 33, -3, 127, 11, 7, -91, 32, -24, -49,
+  -47, -73, -49, -70, -67, -84, 26, -83, 19, 4, -35, 7, -44, 23, -12, 3,
+  -16, -15, -86, -26, 0, 0, -4, -3, -38, 62, 13, 19, 36, 54, 0, -11,
+  0, -19, -58, -32, -34, 12, -48, 4, -61, 92, 47, -95, 68, -53, 19, -7,
+  -120, -20, -28, -65, -17, -47, -20, -46, 55, -31, -48, -59, -7, -14, 48, 0,
+  0, -45, 18, -41, 79, -59, 45, 17, 80, -62, 0, 41, -16, -30, -19, -3,
+  8, -20, 8, 76, 17, 59, -29, 27, -79, 14, 8, 63, -72, 0, -7, -60,
+  -27, 10, -71, 16, 37, -53, 7, -4, 14, 23, -113, 10, -44, -33, 27, 0,
+  -64, -25, -6, -3, -22, -4, -38, -10, -47, 34, -16, 37, -85, 21, -65, -18,
+  4, 22, -4, -54, -30, 6, -26, -4, -61, 58, -74, 10, -20, 7, -42, -23,
+  -28, 20, -55, 21, -7, -68, -11, -3, 38, 10, -24, 22, -59, 4, 58, -25,
+  -55, -16, 27, -38, 67, -65, 41, 44, -19, -35, -74, -10, -72, 27, -19, -10,
+  88, -49, -25, 18, 19, 34, 4, -27, -20, -27, -38, 78, -16, 25, -34, -49,
+  -31, 29, 89, -6, -52, -47, 7, 13, -85, -54, -70, 10, -100, -13, 46, -120,
+  -15, 2, 0, 0, 4, 9, -17, 17, 26, 25, -40, -27, -19, -32, -30, 13,
+  40, -35, -36, -56, -30, 21, 33, -74, 17, -65, -35, 32, -27, 56, -6, 2,
+  9, 15, -33, -13, 34, 13, -36, 42, -2, 25, -14, 19, 38, -24, -40, 18,
+  12, -28, -49, -38, -14, -16, -36, -55, -31, -3, -14, 40, 30, 22, 11, 17,
+  3, 13, -8, -8, -7, 41, -8, -27, 22, -15, 10, 16, -14, 0, -5, 10,
+  -64, 14, 20, -2, -30, 2, 19, -13, 3, 17, -23, 37, 15, -27, 8, 17,
+  0, 2, -77, -127, -18, 28, -27, -10, -32, 30, 6, -3, 24, 55, -15, -10,
+  -26, -40, -36, -9, 6, -62, -57, 3, -3, 54, -12, -80, -53, -86, 11, 55,
+  12, 22, -29, -33, 14, 41, -22, -2, -32, 10, 16, -3, -17, 34, -35, -78,
+  -17, 9, 43, -96, -6, -9, 36, -13, -28, 20, -23, -70, -12, 39, 82, -7,
+  -35, 0, -12, -19, 23, -9, -30, 0, 2, -43, 28, 63, -17, 29, -73, -3,
+  -12, -2, 0, -19, 25, 37, 47, -19, -21, 23, -20, 10, 18, 12, 14, -22,
+  -38, -84, -33, 27, 11, -113, -12, -29, -32, -23, -28, 5, -91, -3, -3, -21,
+  -12, -2, 53, -38, 30, -18, -14, 16, 31, -26, -20, -2, -12, 47, 20, -103,
+  -29, -15, -16, 23, 20, -72, 7, -7, -11, -33, -28, 38, -91, -8, -25, 13,
+  -12, -66, 3, -21, 14, -2, 5, -3, -17, 9, -14, -20, 56, 42, -34, -24,
+  -18, -47, -29, 13, 4, -34, 5, 20, -4, 51, -22, -8, -48, -16, -23, -16,
+  -29, 7, 3, -7, 28, -34, -38, -16, -45, -11, 6, -17, -35, 34, -34, -70,
+  -35, -26, -11, -31, -56, -27, -30, -40, -26, -74, 30, -33, -18, -3, -54, -34,
+  34, -25, -43, 5, 15, -30, -33, -17, 7, 21, 25, -67, 22, -74, -15, 8,
+  16, 6, 7, -17, 13, -37, -9, -19, -30, -19, 21, 30, -16, 37, -33, -84,
+  -3, -3, -46, -81, -39, -7, -74, -38, -34, 37, 22, -3, 29, -5, 24, 16,
+  32, -2, -2, -6, 25, 3, -16, 16, 26, 0, 4, -59, -34, -6, 16, 53,
+  -53, -13, 0, -10, -48, -30, 12, -31, -82, -15, 0, 13, 61, 0, 0, -5,
+  51, -33, -26, -75, -65, -20, -66, 26, -2, -11, 24, 12, -21, 48, -24, -8,
+  -38, -28, -4, 23, -15, 7, -6, -108, 34, -18, 59, -57, 64, -8, 18, -18,
+  25, 22, -59, -62, -12, 34, -20, -103, -44, -74, 45, -15, -13, 60, -54, -20,
+  -53, -36, -25, 38, -33, 2, -18, 49, -37, 40, -3, -16, 3, -53, 34, 3,
+  19, 16, 42, -4, 0, -37, -5, -56, -23, -68, 30, -21, -75, 3, -24, -6,
+  0, 15, -114, 8, -45, -5, 3, 66, 79, 37, -34, 57, -13, -50, -46, 0,
+  -22, 4, 15, 10, 15, 17, -7, 37, -19, -66, 21, 9, -29, 14, -5, -31,
+  59, 13, -18, 10, -39, 30, 9, -56, 26, 6, 31, -38, 38, 5, 9, -5,
+  -64, -55, 2, 15, -35, -95, -11, -58, -2, 0, -49, 18, -57, 9, 24, 8,
+  -16, 8, -32, 15, 6, -27, -65, -49, -56, -49, -3, 0, -22, -37, -24, -127,
+  6, -12, 15, 4, 31, 0, -16, 8, -12, 19, -11, -18, 3, 26, 19, 25,
+  -31, -31, 21, 15, 45, -50, -3, -10, -64, -21, -19, -30, 3, -5, 6, 21,
+  35, -2, -19, -35, 26, 41, -35, 38, -14, 23, 49, -29, -6, 14, -115, 3,
+  34, 9, 34, -52, -32, 15, 75, 42, 72, 7, -11, 6, 27, 29, 4, 28,
+  -84, -36, 50, -28, 28, -33, -24, -3, 14, -13, 3, -18, -44, -38, -69, -54,
+  53, 43, -9, -12, -36, 48, 32, -80, 23, -30, 56, 42, 35, 0, 48, -12,
+  -4, 17, 69, -30, 19, -12, -22, -6, -14, -7, -10, 64, -16, -79, -20, 0,
+  -53, -31, 30, -12, -54, -6, -18, 17, -14, 19, -30, 23, -8, 45, -33, -72,
+  -65, -24, -90, -10, -42, 33, 11, 29, -6, -20, -18, 7, 6, 3, 49, 14,
+  23, 3, 17, 3, 11, 36, -50, -50, -32, -56, 34, 16, -27, -48, 33, 3,
+  -4, -24, -24, -18, -21, 45, 19, -22, -123, -63, -31, 0, -25, -41, -95, -105,
+  -45, 55, -77, -55, -18, -6, 4, -50, -95, 56, -30, -110, -54, -10, -33, -22,
+  -54, -2, -77, -23, 12, -8, 24, -41, 3, 56, 0, -121, -19, -103, 7, 34,
+  -109, -46, 51, -61, -54, -108, 4, -76, 23, -96, -11, 16, -127, -19, -122, -12,
+  -77, -31, -13, 10, -32, 4, -24, -61, -14, -40, 3, 21, 69, -93, -16, -14,
+  26, -9, 77, 43, -36, 57, -43, -13, -36, 0, -30, -29, 19, 10, -63, -19,
+  -8, -12, -56, -60, -37, 24, -15, 10, -36, -26, 5, 11, 22, -51, -69, -57,
+  -102, 9, -4, -49, -22, -15, -93, -21, -18, 85, -64, -114, 12, -3, 0, -22,
+  -50, -31, 3, -53, 5, -4, 13, 61, 25, 79, -34, -39, 6, -48, -13, 71,
+  -15, -104, 34, -37, 14, -42, -46, -97, 14, -52, -64, 10, -50, -13, 0, -9,
+  26, -25, -23, -15, 13, -16, 2, -15, -57, -19, -53, -59, -15, -3, -67, -23,
+  26, 18, -33, -15, -66, -38, -35, 28, -79, -18, 0, 22, -4, 19, 57, -6,
+  45, -28, 10, 24, -27, -99, -4, 6, -24, -10, -10, -28, -76, -17, -41, 7,
+  -33, -12, 17, -6, 21, -14, 45, 85, -18, -54, 7, 57, -41, 3, -4, -36,
+  7, -12, 0, 7, 0, -75, 2, 15, 33, 10, 3, -17, -39, -30, 35, -20,
+  -55, -18, -29, 56, 17, -41, 0, 24, -79, -54, -4, 19, -37, 25, -57, 39,
+  37, 7, -54, -44, -7, -51, -40, -68, -30, -42, -15, -14, -33, 17, 67, -43,
+  -18, 48, -42, 47, -77, -17, 31, 20, 0, -36, 7, -3, -37, -68, 114, 3,
+  56, 32, -8, -53, 45, -4, -25, -34, -38, -19, -3, -76, -3, 57, 3, -102,
+  -15, -21, 8, 9, 31, 29, 28, 37, -44, -57, 11, 41, -45, 19, 86, 3,
+  -11, -18, -26, -36, 25, 63, -38, -34, -11, -32, -20, -52, 48, 0, 63, -26,
+  66, -6, -54, 41, 17, 72, 45, 53, 39, -72, -36, 28, -56, -22, 96, 21,
+  4, 30, 26, 2, 31, 91, -17, 37, -19, 3, -33, -14, -12, -80, -67, 7,
+  -40, -18, -83, -80, -94, -20, -7, -98, 26, 4, -80, 19, 7, 49, 14, -18,
+  -71, -18, 51, 29, 27, -40, 4, 43, 30, 32, -58, 55, -27, -77, -6, 10,
+  -4, -86, -4, -15, -111, -17, -45, -41, -127, 14, -22, 63, -56, 74, -11, 45,
+  -30, 0, -49, 32, 7, -51, 15, -31, 11, 16, -85, 48, 48, -33, 57, -16,
+  -51, -48, 29, 56, -28, -41, -7, 33, -39, -25, 15, 0, -22, -15, 43, 21,
+  -7, -21, 24, -59, 6, 0, -59, 6, -5, -30, -16, -35, 0, -31, -30, 37,
+  -61, -8, 50, 19, -23, 11, -64, -49, -78, -3, 41, -44, -17, 9, 13, 28,
+  66, 28, -31, -7, 19, 33, -31, -17, -30, -42, -30, -19, 28, -12, -44, -82,
+  -24, -8, -8, -55, -36, 59, 45, 23, -86, -70, -20, -32, -3, -3, -3, 6,
+  -80, -26, 19, -11, 6, 41, -35, 20, 15, 9, -9, -3, -6, -12, 0, 15,
+  -20, -50, -105, -58, -55, -30, 10, -72, 24, -67, 17, 44, -35, 0, -3, 8,
+  -31, -79, -12, 9, -84, -125, -23, -101, -18, -69, -63, 45, -23, 47, 0, 55,
+  -82, -36, 12, 19, -88, -51, -84, 76, -12, 47, 3, 6, -31, -115, -13, -48,
+  -3, 6, -36, -23, -21, 26, -10, -58, -76, -54, -26, 55, -127, 25, -38, -49,
+  -41, -39, 47, -58, -65, 32, -39, 68, -29, 20, -125, 3, -45, 12, -7, -79,
+  -48, -43, -29, 7, -29, -29, 6, 14, -43, -33, -42, -26, -68, -47, -18, -15,
+  14, -19, -66, -61, -10, -16, -48, 11, 0, 37, -41, -35, -17, -3, -17, -37,
+  -24, 28, 48, 14, 29, -41, -20, 78, 20, 33, -9, -23, -3, -53, -12, 27,
+  -41, -19, 0, -39, 23, -59, -6, -4, 4, -13, -71, 29, 21, 29, -53, 0,
+  31, 24, -19, -34, 17, -7, -12, -3, 5, 6, 9, 10, -20, -9, -80, 6,
+  -44, -42, -8, -58, -10, -8, 6, -57, -16, -80, -37, 32, -24, 20, 80, 8,
+  28, -2, -22, -39, -19, -55, 21, 17, -18, 39, 21, 13, -23, -9, -27, -24,
+  17, -11, 16, -28, -3, -14, 0, -15, 29, 30, -44, -26, -7, 20, 20, 11,
+  -11, -14, -25, 7, -29, -32, 14, -21, 26, 2, -9, 26, 9, -40, 7, 32,
+  36, 20, 28, 9, 16, 11, -3, -40, 72, -11, -16, 19, -28, -14, -37, 5,
+  0, 5, 15, -4, 2, 41, 0, -32, -37, -5, 0, 44, -63, 0, -19, -69,
+  25, 29, -28, 20, 26, -17, 31, -27, 16, 40, -19, 7, -22, 42, -11, -9,
+  -6, 7, -37, 2, 12, -18, -30, -30, 8, 12, -8, 18, 54, -15, -9, 34,
+  -14, -4, -6, 18, -55, -33, -75, 27, -39, -5, 14, 0, -20, -14, -11, -23,
+  -47, 12, 2, -22, 15, 30, -13, 42, 18, 17, 9, -23, 11, -20, -57, 24,
+  -16, -18, -34, 0, -13, -11, 21, -18, 49, 35, -57, 9, 11, 21, -51, 38,
+  -28, -17, -15, -20, -8, 32, -3, -32, -22, 33, 21, -5, 18, -35, 9, -47,
+  49, 4, 22, 4, 29, 13, -31, -40, 20, -32, 16, -127, 3, 0, -27, -16,
+  -25, 12, 23, -33, 29, -9, -13, 7, 2, -19, -9, 3, -50, -35, -59, 51,
+  -52, -27, -12, -69, -26, -50, -36, 0, -10, -5, -27, 2, -17, 5, -43, -7,
+  0, -9, -60, -20, -15, 44, -11, -23, -24, 0, 11, -72, 48, -12, 7, -29,
+  -33, 27, 40, -9, -47, -54, -21, 49, -20, -8, -30, -40, -45, -79, 35, -7,
+  -67, 12, -23, -75, 7, -18, -30, -79, -37, -31, 8, -54, 43, 37, -36, -49,
+  -30, -16, 12, -44, 23, 37, 16, 3, -26, -5, 0, -56, 6, -35, 16, 75,
+  -6, 3, -48, 4, 0, 32, -11, -5, -93, -17, 0, -41, -11, 42, 21, -73,
+  16, 27, -6, -13, -29, -26, -52, 12, -39, -13, -11, -49, -11, -35, 43, -7,
+  -13, -30, -25, 20, 14, 14, 0, -9, -34, 18, -45, 12, -33, 0, 15, -14,
+  30, 51, 6, -31, 17, 36, 0, 17, 6, 27, -25, 20, 15, 15, 27, -44,
+  -23, -6, 16, 18, 22, 25, -13, 2, -19, -18, 23, -12, 23, -37, 20, -14,
+  -8, -6, 40, 18, 19, 8, -33, -62, -30, 7, -20, 2, 23, 11, -25, -33,
+  -18, -16, -41, 12, -3, -11, -10, 9, -21, -26, -10, -17, 31, 5, 2, -20,
+  -18, -18, 23, 2, -5, 2, -43, -39, -39, -5, 8, -22, 41, 4, 37, -15,
+  -21, -21, 20, 37, 23, 3, 6, 13, -88, 15, 9, 43, -31, -51, -28, -41,
+  -3, 10, 23, -65, -2, 36, -26, 45, -127, -10, -33, 24, 39, 0, -42, -46,
+  -5, -35, -28, -12, 6, -41, -32, 15, -24, 9, -7, 2, 19, -21, 74, 45,
+  -25, -21, -32, 43, -29, -38, -14, 0, -73, 82, 48, -52, 121, -62, 10, 4,
+  -46, -3, -18, 5, -20, -33, -26, -23, -45, -33, -12, 2, 38, -9, -7, -2,
+  13, -41, 11, -27, 5, -30, -21, 17, -12, -2, -80, -39, -13, 2, 39, 15,
+  5, 8, 18, -3, 20, 57, 3, 41, -30, -18, 0, 17, -6, 9, 11, -38,
+  -25, -4, -23, 18, -19, -18, -95, 8, -54, 27, 30, 15, 31, -30, -27, -33,
+  -18, -37, -14, -5, 3, 3, -17, -6, -28, 0, -17, 2, 19, -14, 35, 2,
+  -20, -12, 32, -25, -46, -18, -12, -11, -27, 37, 8, -46, 80, -9, -17, -2,
+  -15, 0, -18, -10, 5, -5, -12, -23, -21, -13, 0, -7, 13, 16, -11, 2,
+  23, -39, -34, -2, 17, -4, -21, -22, 9, 42, -60, -9, -5, -36, -20, 13,
+  -23, -47, 5, 17, -67, -61, -4, -29, -75, 33, -39, 71, -22, 17, 20, 17,
+  0, 70, -17, 27, -21, -42, -57, 25, 40, 4, -90, 81, -80, -67, 33, -19,
+  107, 19, -74, -12, -18, 32, 0, -127, -31, 3, 26, 0, -59, 99, 49, -3,
+  -26, 31, 81, 36, 7, -59, 28, 84, -49, 96, -34, 6, -11, -76, 99, 40,
+  -42, 7, 8, -35, -44, -12, -24, -114, -33, -46, 41, -4, -68, -10, -33, -84,
+  37, 15, 0, -6, 46, 45, 39, 58, 90, 7, -49, 0, 19, -70, -26, 28,
+  4, 7, -21, 10, 21, 93, -41, 13, -28, 10, -8, 32, 19, -7, -16, -10,
+  -49, 46, -51, -3, -21, -36, 0, 8, -72, -66, -22, -32, -100, 3, 15, 3,
+  31, 35, 40, -7, 42, -12, -28, -6, 22, -46, 3, 32, -75, -27, -72, -3,
+  -49, -15, -26, -70, -36, -3, 78, -46, 54, -52, -108, 94, -54, 79, -18, -50,
+  8, 17, 13, -17, -9, 57, -24, -13, 11, 46, 10, -21, -6, -72, -120, 54,
+  -15, -31, 26, -70, -18, -6, -14, -50, 40, -7, -37, -10, 27, 22, -51, 9,
+  42, 0, -11, 2, 2, 4, -30, 22, -20, 23, -3, -11, -28, -31, -62, 24,
+  41, 12, -30, -30, -46, 3, -35, 4, -22, 29, -56, -3, 8, 25, -81, -22,
+  -76, -26, -48, -10, -12, -57, 6, 10, -33, 7, -10, -7, -6, -3, 0, -71,
+  -19, -24, -43, -21, 32, -3, 32, -25, 0, -18, -11, -97, -19, 13, -7, -3,
+  -69, -38, -26, 12, -18, -36, 9, 25, -8, -20, 21, -18, -6, 31, -20, -77,
+  49, -15, -60, -3, 86, -30, -7, 17, 9, -18, 45, -32, 0, 16, 29, -40,
+  -65, -36, -11, 8, -16, -83, 16, -35, 5, -11, -4, 12, -55, 61, -6, -6,
+  13, 16, -4, 21, 21, 15, 63, -32, 0, 3, 6, -33, 33, -13, 50, -11,
+  36, 6, 7, 23, 0, 10, 26, -5, 17, -61, -53, 27, -45, 55, -66, -17,
+  -19, 5, -83, -13, -36, -13, -3, -4, -19, -97, 19, 11, -29, 24, 3, -55,
+  71, -12, 0, -2, 27, 14, 9, 13, 2, 20, 15, 6, 24, 15, -25, 3,
+  3, 13, 15, 8, -15, -5, -36, 18, 65, 9, 67, 36, 13, 8, 34, -66,
+  -29, -22, -22, 6, -35, -62, -5, -51, -7, 3, -28, 12, -26, -90, -25, 17,
+  -19, -29, 54, 31, -21, -5, -12, -11, 53, -28, -13, -3, -52, 32, -56, -40,
+  -16, -14, -36, -25, 0, -24, -27, 70, -78, 20, -37, 3, 13, -32, -50, -57,
+  -64, -73, -127, -52, -49, -71, -94, -21, 15, -34, -22, -44, -114, 54, -9, -45,
+  39, 4, -40, -25, -10, 55, -22, -16, 2, 42, -15, -57, 21, 9, 22, 20,
+  -73, 18, -7, -18, -18, -5, -6, 89, -19, -9, 10, -38, 3, -49, 9, 90,
+  -16, -20, 20, -6, 8, 69, -26, -11, 17, -20, 42, -6, -3, 23, -33, 20,
+  16, -57, 40, -18, 24, -23, 6, -53, 8, 3, 6, 30, 29, -70, -31, 26,
+  19, -26, -47, 11, -39, 79, 16, -8, 33, 25, -22, 21, -8, -9, 36, -3,
+  -29, 8, 40, 21, 36, -83, -72, 53, 4, -13, -16, -38, -101, 0, 3, -8,
+  -62, -36, -9, 28, -29, -24, -7, -13, 24, 25, -20, 36, -32, 49, -14, -3,
+  -16, 8, -22, -57, 12, -33, 12, -7, 88, -25, -19, 66, -42, 19, -28, 29,
+  15, 21, -25, -29, 37, -14, -48, 6, -11, -7, 21, -34, -34, 23, -18, -20,
+  18, -27, 17, -29, 2, 0, 7, 25, -9, 25, 8, -35, -13, -15, -15, 4,
+  -64, -13, 14, 3, -31, -27, 0, 21, 2, 7, -23, -22, -2, -16, 22, 23,
+  18, -29, -127, 14, -17, 6, 2, 54, -6, -12, 20, 33, 13, 24, -17, -13,
+  3, 14, -13, 17, -3, 22, 22, -62, -23, -11, 56, -26, -17, 0, 35, -9,
+  -5, 43, 35, 60, 27, 2, -2, 25, -70, 2, 20, 13, 18, -58, 7, -32,
+  -41, -2, -16, -20, -3, -11, -23, -19, 15, 31, 5, 7, -13, 23, -9, 25,
+  -18, -35, 35, 53, 17, -16, -17, -34, 24, 5, -18, -13, 18, -19, 25, 11,
+  5, 13, 21, 13, 19, -16, -25, 11, -38, 0, 38, 5, -17, -14, -68, -95,
+  -38, 21, -12, -41, 19, -28, 22, -85, -27, -2, 30, -4, -16, 45, -2, -29,
+  -59, 3, 13, 24, 0, -55, 9, 9, 32, 9, -19, -19, -17, -30, -24, 59,
+  -20, -64, -46, -6, -12, -8, 0, -40, 12, -62, 30, 22, -49, 54, -17, -55,
+  -77, -26, -21, -10, 8, 36, -16, -34, 11, -16, -31, -17, 29, 18, -18, 41,
+  20, 10, -29, -4, -2, 26, 0, 14, 12, -12, -10, 13, -47, -39, -5, 13,
+  18, -22, -14, 25, -37, 8, 0, -2, -30, 29, -7, 2, 29, -21, 11, 14,
+  58, 33, 6, 2, 5, -18, -46, 40, -3, 0, -73, -37, -49, 19, 12, -17,
+  -15, -3, -2, 0, 6, 30, -9, -17, -60, 7, -9, -29, -11, -16, 37, -14,
+  33, 21, 29, 0, 53, -10, 10, 23, -12, 7, -45, -24, -13, -9, 52, 25,
+  36, 16, 17, -53, 5, 92, 2, -2, -2, 7, 28, -55, -46, 5, 14, -10,
+  -30, 13, 41, 16, 0, -7, 26, -40, -20, -35, 0, 5, -8, 5, 30, 30,
+  11, 3, -8, -2, -3, -6, 5, -21, -8, -17, 11, 39, -14, -48, -41, -30,
+  -14, -7, -31, -40, -39, 26, 36, 15, 20, 0, 11, -21, 6, 28, 0, -18,
+  36, 7, 10, 5, -15, 3, -5, 28, 18, -19, 13, -10, -48, -5, -10, -7,
+  -6, -29, 9, 2, -34, -17, -3, -25, 76, -19, -16, 14, -14, 21, -5, -16,
+  -50, -47, -43, -5, -64, 6, 0, 12, 12, 34, -47, 10, 39, -10, 19, 59,
+  3, -11, -16, -16, -26, -59, -63, 3, 13, -3, -8, 17, -25, -44, 51, -27,
+  -6, 29, -4, -57, -25, 33, 6, -33, -127, -14, 72, -44, 16, -13, -33, -111,
+  33, -4, 41, -20, 16, 42, -8, 3, -7, 84, -47, -64, 79, -56, -40, 34,
+  -34, -43, -25, -11, -7, -15, 8, 35, -61, -10, 11, 18, -7, -15, 17, -99,
+  14, 25, -75, -25, 24, -24, 18, 31, 23, -8, -16, -26, 42, -7, 8, 7,
+  8, -17, 6, 31, 29, 24, -21, -35, -10, -10, -13, 8, -94, 23, 19, 17,
+  3, 11, -19, 0, -11, -50, -3, -77, -40, 14, -25, 24, 3, 21, -27, 5,
+  -8, -35, -47, -13, -37, -57, -16, -12, -8, -2, -19, 36, -5, 0, 14, 27,
+  11, -70, 19, 0, -3, 9, -8, -25, -76, 14, -22, -40, 0, 0, -30, -46,
+  25, 5, -54, -9, -2, 36, 2, 12, -49, 19, 30, -36, -53, 28, 36, -47,
+  22, 27, -3, -4, 3, -46, -3, 15, -43, -30, -14, -45, -28, -14, 22, 18,
+  -22, -31, -4, 27, -30, -18, 9, -28, 16, 40, -39, 18, -36, 17, -24, 44,
+  63, -7, -6, -7, 8, -19, 5, -3, 0, -5, -24, 47, -31, -28, -5, -20,
+  -3, -15, -34, 13, -3, -12, 19, -55, -4, -17, -2, -10, -7, 17, 17, -17,
+  8, -2, 22, -7, 10, 19, 10, 9, 7, 13, 54, -5, 36, 9, -24, -2,
+  -8, 0, -33, -4, -3, -35, -11, 28, 28, 29, 4, -21, 23, 5, -5, 20,
+  27, -9, 22, 4, -13, -6, -5, -12, 0, -32, 35, -2, 53, 18, 56, 14,
+  -6, 2, 10, 7, 17, 41, -2, 30, 6, 33, -2, 15, -20, -5, -35, -44,
+  -19, -4, -68, -55, -10, 4, 15, -88, 26, -13, -46, -47, -22, 5, -5, 23,
+  -89, -72, 46, 20, 10, -56, 9, 53, 14, -21, -77, 3, -56, -50, -31, 73,
+  -19, -109, -127, -51, -16, -52, -28, -73, 52, -8, -24, 23, -39, 48, -35, -23,
+  -42, -70, -13, 34, -54, -77, 8, -7, 16, -2, -58, -3, -65, -42, 31, 10,
+  0, -20, 3, 9, -23, -73, -88, 55, 20, -8, 41, 7, 14, 5, -3, -90,
+  -14, -24, 0, 5, -18, 21, 12, -23, -61, -40, 2, -13, -14, 32, -17, 7,
+  3, 35, -53, 22, -16, -19, 3, 30, 0, 40, -19, -47, 3, -28, 13, -5,
+  44, 17, -10, -36, 27, -18, 12, -9, -55, 17, 7, 23, 9, 20, 7, -73,
+  -41, 20, -6, 15, -26, 0, 0, 15, -16, 29, 3, -5, 31, 12, 5, 0,
+  8, -9, 6, -16, 15, 26, 2, 25, -38, -5, 28, -3, 0, -17, -9, -12,
+  -14, 9, -9, 7, -3, -41, 0, 18, -49, 8, -8, 5, 11, 9, -11, 20,
+  -19, -31, -22, -20, 2, -66, -24, 0, 23, -30, -21, -40, -28, -3, 50, 0,
+  73, 22, -43, 25, 22, 9, 90, -89, 41, -71, 61, 7, 23, -23, -11, 22,
+  -51, -19, 48, -13, 16, 4, -42, 19, -34, -27, 26, -51, -44, -104, -80, -10,
+  15, 9, 35, 19, -11, 9, 51, -106, -37, 4, -76, 49, 23, 58, 34, 0,
+  8, -65, 5, 23, -5, 12, -24, -6, 57, 30, -24, 40, -25, 0, 30, 55,
+  15, -12, 0, 59, 4, -24, -40, 26, -101, -112, 106, 39, -39, -26, -22, -101,
+  -66, -29, 16, 3, -14, -21, -42, 23, 0, 0, -5, 14, 16, -28, -13, -31,
+  42, -9, -61, -12, -4, -24, -22, -60, 23, 22, 46, -33, 16, 6, 127, 44,
+  19, -29, -73, -69, -33, -4, -31, -68, -60, 30, -5, -47, 13, 38, 53, -14,
+  15, -3, 17, 22, -120, -21, -79, 21, -37, -11, -8, -66, 19, -39, 4, 3,
+  -39, -14, 19, -84, 23, 0, -55, -13, -77, 3, 29, -18, -9, 31, -17, -72,
+  -46, -62, -13, -46, -29, 36, 79, 26, -5, 19, -65, 13, 19, 6, -45, 95,
+  -51, 2, 3, 13, 19, 21, 4, -48, -37, -80, 5, 14, -16, 24, -10, -44,
+  4, -37, 4, -34, -66, 27, 58, 89, 5, 15, -8, 16, 16, 32, -15, 6,
+  -8, -22, 13, 20, 9, 25, 13, 61, 40, -3, -18, -36, -57, 10, -50, 65,
+  -95, -47, -48, 22, -58, -24, -72, 34, -46, -105, -57, 7, -121, 3, 82, -57,
+  -62, -72, -5, 28, -38, 4, 35, 48, 17, -43, 18, -47, -89, -52, -33, 44,
+  38, -34, -13, -50, -33, 18, -33, -38, 64, 45, -23, 20, 23, 42, -60, -60,
+  64, -29, -12, 7, -63, -15, -46, -18, -3, -6, -46, 27, -12, 10, 55, 6,
+  35, 11, 36, 3, -114, -25, -10, 63, 4, 21, 3, -9, 7, -12, -79, -79,
+  64, 29, -10, -21, 28, 15, -26, -15, -3, -80, 7, -13, -32, 89, 40, 3,
+  -77, -29, -56, 3, -80, 19, 23, 23, -84, -76, 10, 42, 0, -30, 127, 15,
+  104, 27, -10, 28, -2, 65, 8, 39, -8, -64, 26, 23, -29, 73, -15, 19,
+  -32, -43, -92, -3, -37, 42, 7, 55, -76, -62, 0, 36, -18, -33, 55, -29,
+  46, -13, 20, -9, 26, 53, -26, -48, 29, -15, -24, -23, 35, 22, 18, -19,
+  32, 14, -40, -3, -3, 19, 60, 39, -4, -3, -38, 76, 43, 12, 65, 9,
+  71, -9, -22, -9, 6, -46, -8, -33, 5, -21, -19, 7, -6, 38, 37, 47,
+  25, -11, 32, 34, -33, 14, 50, 105, 0, -100, -21, 18, -21, -15, -10, 0,
+  61, -4, 7, -35, -19, -34, 2, -33, -8, -64, -24, -7, -32, 22, -30, -44,
+  7, -14, -96, 80, 7, -17, 80, 16, 42, -38, 14, 9, 75, -18, 48, -38,
+  -21, 27, 17, 33, 15, 4, -26, 36, 39, 25, -48, -30, 9, -45, 12, 82,
+  7, -69, -120, 6, -50, -39, 37, -86, -42, -31, 63, -6, -39, 18, -51, -47,
+  11, 55, 7, -14, 35, 34, -4, 15, 31, -77, 10, -66, 3, 6, -12, 3,
+  -25, -23, -56, 40, -20, 39, 66, -102, -34, -10, -3, 27, 72, -3, 58, 12,
+  -4, 51, 0, 5, 13, 19, -6, 18, -18, -40, 0, -30, -23, 0, 3, -38,
+  -14, -37, -64, 9, 40, 36, 90, 12, -17, -55, 35, 9, 50, 18, 124, 3,
+  -73, -34, -10, -14, -10, -11, -61, -43, 0, -36, -14, 3, 6, 25, -12, 40,
+  20, -14, 4, 14, -33, 30, -58, -57, 45, 37, 51, -12, -3, 6, -47, 11,
+  -55, 15, -38, -32, -23, 15, -31, -32, -28, 15, 2, -23, 17, 3, -12, -34,
+  31, -50, -47, -14, -46, 62, 19, 72, 20, -47, -10, 15, -7, -6, -23, 28,
+  -10, -6, -10, -11, -13, -4, -2, 12, 0, 9, -30, 10, -6, -50, -6, 6,
+  -27, -8, -27, -33, -29, 22, 13, -11, -20, -60, 3, -12, -7, 9, -20, 6,
+  -21, 21, -26, -36, -44, -66, -33, -127, 20, -110, -70, 29, 45, 0, -53, -21,
+  -116, -53, -39, -39, -94, 27, -87, -8, -33, 10, 34, -82, -63, -32, 10, -17,
+  -7, 45, -5, 0, 13, 26, -6, 78, 23, 0, -70, -84, -37, -31, -6, 52,
+  -89, -119, -31, -61, -88, 5, -19, 34, 106, -33, -14, 6, -63, 20, 0, -54,
+  35, -39, -7, -29, -42, -33, -47, -92, -38, 0, 30, -55, -45, -9, 38, -31,
+  -65, 22, 47, 17, -20, -35, -16, 8, 4, 67, 37, 3, 66, -43, -33, -25,
+  -49, 30, 2, 16, -8, -29, -21, -3, -20, 0, -37, 58, -34, -3, 9, 6,
+  -41, -3, 39, -25, -78, -19, -48, 53, -49, 47, -24, 9, -3, -6, 10, -28,
+  3, 21, -26, 5, -36, 22, -6, 23, -56, -36, 30, 0, -3, 40, 9, -89,
+  34, 8, -27, -14, -81, 38, -29, -8, -94, 60, -17, -32, 66, -17, 50, -3,
+  -24, -6, 12, -14, -8, -77, -20, 35, 25, -15, 5, 16, -11, -9, -21, 46,
+  3, -69, -81, 3, -36, 11, 13, -23, 94, -17, -54, 9, 0, 9, -57, -20,
+  -23, 39, 0, 5, 5, -41, -24, 16, 20, -34, 26, -58, -32, -45, -3, -17,
+  -27, -6, 74, -19, 26, -46, 40, -56, 37, -23, -11, -33, 43, 52, -19, -22,
+  -62, -22, 27, -31, 19, -46, 26, 65, 9, -47, 45, -102, -19, 24, -13, -14,
+  0, -63, -66, 6, 18, 0, 0, -34, -37, -60, 84, -26, -35, 45, 11, 32,
+  -20, -29, 27, -8, 54, -17, 11, 97, -6, 10, 21, -58, -35, -14, -47, 14,
+  -8, -28, -35, -16, 33, -18, 18, -64, 18, -26, 80, -23, 67, 32, -15, -29,
+  -8, -36, 11, 15, -28, -54, -11, -3, -6, -30, -16, -4, -83, -56, 40, -41,
+  84, -69, -92, 25, 37, -15, -4, 56, -32, -60, 8, -10, 4, -6, -101, -3,
+  -35, -109, -84, 28, -78, -91, 15, -10, -26, -60, -18, -29, -25, 35, 107, -38,
+  -84, 31, -48, 93, -7, -30, -44, 85, -60, 8, 69, -69, 4, 39, 0, -38,
+  51, -77, -127, 46, -113, -46, 20, -114, -34, -17, 3, 4, -64, 21, 77, -72,
+  31, 78, -26, 50, 26, -3, -58, 90, 32, -34, 15, -56, -20, -45, 19, -41,
+  -55, -19, -41, -10, -31, 58, 4, -3, -23, 3, -3, 11, 0, -10, 20, -28,
+  4, 47, 31, 3, 33, -12, -15, -17, 14, 15, -65, -40, -67, -62, -8, 16,
+  -35, 22, -86, 3, -26, -87, -22, -58, -40, -44, -26, -29, -54, 0, -27, -100,
+  -19, 6, 22, -34, 11, -37, -36, -13, -14, 53, -4, -53, 16, -6, 0, -29,
+  23, 14, 11, -23, 38, -25, -7, 29, -68, -10, 5, -91, 6, -17, -7, -48,
+  -27, -72, -79, -56, 0, -55, -29, -13, -28, 15, -15, 76, -16, 36, -8, -6,
+  -7, 22, -17, -29, -1, 7, -15, 7, 2, 13, 0, -4, 34, 16, 9, -8,
+  -24, -4, 5, 7, -21, -7, 0, 19, -39, -8, 0, -28, -13, 9, 59, 5,
+  28, 9, 41, -34, 17, 54, -27, 22, -19, -6, 31, -90, 9, -8, -13, 4,
+  2, -4, 59, -52, -16, -14, -12, -22, -54, 0, 0, 19, 46, 27, 8, 11,
+  -15, -7, -5, -7, -7, -7, -23, 9, 0, 9, -3, 29, 9, -8, -4, -4,
+  9, 16, -32, -12, -8, -2, 20, 19, 28, 15, -21, 20, 22, -18, 38, 30,
+  -15, -5, -14, -16, -11, 35, -28, -20, 6, 24, -9, -31, -12, 6, -15, 27,
+  4, -11, 27, 0, 2, 3, -4, -26, 18, 30, -19, -2, -9, 16, 2, 2,
+  -127, -26, -17, 6, -50, -102, 21, -40, -5, -58, -24, 47, -54, -14, -11, 2,
+  77, -47, -59, -77, -6, 38, 0, 46, 23, 13, 26, 24, -37, 5, -91, -34,
+  -9, -28, -23, 0, 3, 14, -9, 26, 5, 34, -12, -16, -27, 8, -7, 0,
+  -32, 9, 32, -17, -37, -60, -45, -41, -13, -15, -11, -17, -2, 46, -11, -55,
+  -22, -8, -6, -14, -20, -37, -10, -18, -8, -26, -4, 51, 7, 24, -19, -10,
+  -4, 26, -20, 0, -2, 12, 29, -2, -41, 21, -17, -13, -13, -7, 6, -5,
+  18, 0, -20, -4, 0, -19, 0, -9, -14, 17, -7, 4, -9, -8, 7, -10,
+  -26, -44, -10, -17, -2, 14, -29, 36, -13, -32, 0, -7, -24, 7, -23, -2,
+  7, -33, -20, 7, -24, -12, 0, 15, -10, -4, -7, 6, -4, 18, 13, -12,
+  -4, 14, -29, 10, -8, -7, -35, 34, -57, 4, -30, -13, 9, -11, 19, 11,
+  -127, -67, -67, 17, -11, -12, -15, 19, 14, 26, -33, -3, -40, -60, 0, -33,
+  92, -6, -13, 36, 56, -17, 7, -37, 4, -43, 18, -13, -15, -28, 47, 0,
+  -41, -90, -57, 12, -111, -16, -40, -59, -19, -67, 18, 80, -43, -60, -3, -49,
+  18, 24, 46, 54, 81, 29, 10, -12, -13, 50, 15, -54, -7, -84, -7, -82,
+  19, 7, 0, -12, 18, 56, 21, 37, -22, -3, 5, -7, -43, -47, -25, -16,
+  -37, 3, 0, -24, -88, -17, -87, 49, -31, -11, 18, -82, 26, 81, -72, -27,
+  52, 14, -23, -12, 14, 67, -19, -53, -63, -55, 5, 7, -49, -3, -35, -72,
+  -18, 66, 42, -45, 18, 3, 80, 53, 62, -101, -7, 22, 15, -16, 40, 3,
+  15, 12, 5, 32, 14, 12, -34, 16, -22, -6, 5, -14, -125, -33, -3, -10,
+  48, 45, 117, 0, 21, 20, 35, 8, 53, -18, -95, 32, -11, 44, -4, -43,
+  -11, -2, -13, -27, -9, 4, -15, -68, 8, -32, 20, -69, 46, -13, 57, 53,
+  -48, 6, 100, 51, 49, -64, 17, 86, -40, 0, 18, -73, 0, -96, -22, 52,
+  -49, -16, -16, 12, 2, 16, 2, 6, -60, -39, -30, -28, 24, -17, 19, -30,
+  -4, -60, 17, -6, 32, 12, -24, 53, -110, -87, -29, -19, -22, 28, 25, -27,
+  7, -55, 0, 2, -5, -44, -23, 62, 11, 77, -38, -17, -30, -40, 45, -46,
+  55, -15, 33, -9, 14, -26, -21, -8, 48, -40, -48, 3, -30, 0, -18, -37,
+  -86, -37, -21, 7, -5, -12, -46, -19, -16, 6, -10, -21, 24, 0, 25, 39,
+  -4, -9, 71, 51, 7, -38, -35, -29, 22, -25, 18, 6, 7, -6, 11, -33,
+  -42, 16, -29, -32, 0, 55, -18, -13, 17, 3, 4, -57, 13, 17, 6, -20,
+  0, 3, 51, -10, 49, -40, -6, -14, 103, 12, -22, 25, -45, -46, 19, 53,
+  -58, -6, -7, -2, -25, 17, -29, 35, -43, -36, -17, -9, -55, -23, -33, -46,
+  6, -21, -11, -44, -21, -8, -12, -14, 31, 37, 25, 11, 55, -3, 16, -26,
+  -3, -38, 0, -38, -8, -28, -44, 24, 12, -28, 28, -3, -26, -61, -14, -14,
+  32, -26, -25, 10, 55, -56, -39, -50, 53, 34, 35, 3, 6, -40, -3, -24,
+  -26, -20, 22, 17, -16, -3, -38, -43, -28, 42, 28, 15, -16, -14, -3, -20,
+  10, 0, 36, 8, 39, -20, -21, -78, 38, 3, -41, 16, 26, -11, -16, -58,
+  -29, 18, -16, -34, -22, -10, -31, 24, -21, -3, 22, -21, -26, -78, -3, 11,
+  -41, -98, -69, -62, 21, -88, -63, 35, 80, 16, -25, -19, 13, 22, -56, -3,
+  -81, -36, 9, 0, -16, -38, 2, 48, -24, -22, -41, 3, -50, -6, -6, -23,
+  -10, -18, -87, -18, 18, -38, 27, -64, 53, 28, -25, 19, 78, -19, 31, -3,
+  -13, 0, 9, -15, -8, 14, -5, -57, 2, 22, 9, 21, -32, 17, -3, -6,
+  13, -23, -18, 21, 33, -5, -9, -11, 50, 69, 38, -8, -10, -46, -28, 29,
+  -55, -30, -29, -30, -37, 3, 4, -22, 66, 42, 13, -78, 18, -52, 44, 26,
+  -29, -26, 33, -13, 9, -33, 3, -7, 95, -44, -19, -22, -84, -5, -62, 11,
+  -97, -52, 25, -19, 10, 21, -27, 0, -78, -3, 33, 42, -16, -35, -127, -34,
+  22, 16, -76, -62, -6, 13, -15, -89, 65, 84, -67, -33, 52, -27, 16, 11,
+  -17, 9, 10, 28, -14, -22, -20, 5, -4, -7, -12, 13, -38, -80, -7, 8,
+  0, 28, -68, -5, -43, -54, -16, 22, -55, 6, -20, 17, -49, 22, 8, -31,
+  -6, 16, -34, -19, -5, -34, -11, -29, -4, -40, -12, -16, -14, 65, 20, -18,
+  -9, 14, 32, 7, 24, -20, 51, 19, -31, -25, 20, -7, -12, -29, 72, 17,
+  49, 20, 6, -13, 7, 18, -37, -27, -8, -65, 6, 0, -28, 23, -5, -5,
+  -54, -14, 10, -18, 3, 9, -3, 19, -41, 17, -37, 47, 12, -51, -3, -2,
+  67, 23, -8, -49, 12, 15, 10, 39, -42, 47, 10, -46, -14, -10, -44, -43,
+  -71, -32, -45, -12, -30, -68, 19, -41, 27, 17, -11, -49, -41, 17, -56, 35,
+  -64, -34, 22, 0, 2, -58, 10, -19, 19, -127, -25, 67, 12, 21, -101, -26,
+  63, -28, -84, -58, -33, 65, -8, -3, -51, -3, -14, -2, -35, 5, 31, -35,
+  6, 45, 18, 32, 0, -18, -10, 65, 23, 35, -21, -11, 35, -41, -52, 69,
+  -57, -30, -32, -46, -95, -61, -27, -6, -14, -28, -60, 29, -38, 31, -33, -64,
+  -17, -13, -2, -25, -19, -9, 8, -5, 4, -22, 12, -3, -33, 16, 35, 36,
+  48, 16, -55, 25, 57, -25, 59, -32, 102, 20, -31, -51, 15, -31, -22, 31,
+  -14, -2, -4, -23, -35, -3, -16, -34, -30, -15, -18, -51, -21, -8, -30, -31,
+  -9, 32, 13, 16, -16, -2, -67, 29, 34, 14, 20, -17, -9, -39, -3, -54,
+  43, -5, 8, 15, 0, 22, 3, 12, -53, 62, -4, -30, -2, -10, -20, -15,
+  17, 12, 26, 2, -22, -14, -46, 16, -24, 31, -51, 2, -15, -27, -17, -9,
+  -33, -33, 10, 29, 0, -10, 2, -7, 7, -41, -26, -11, 7, -19, -5, 13,
+  68, -2, 0, -2, -31, 51, -56, 20, -21, -3, 38, 23, -39, 20, 3, -39,
+  0, -24, -29, 0, -9, -19, 12, -95, 22, -69, -32, 22, -63, -11, 18, 69,
+  -47, 24, -44, 31, -28, 28, -28, 43, 88, 43, -6, 25, 39, 22, -17, -68,
+  30, 20, -12, 33, 0, 6, 20, 12, -17, 26, -14, 31, -76, -13, 13, -18,
+  -3, 10, 27, 33, -45, -5, 31, -10, 56, -29, -38, 10, 15, 30, -43, 27,
+  -27, 2, 31, 10, 14, 19, 7, 37, -35, 28, 24, 0, -46, 16, -69, 32,
+  -9, -60, -67, -45, -45, -58, -56, 36, -46, 84, -35, 40, 6, 10, 20, -51,
+  -48, 2, -56, -2, -45, -60, 10, -45, 4, -95, -16, 92, -54, 11, -3, -5,
+  9, 7, -13, -10, 22, -21, 36, -26, 11, -14, -38, -48, -36, -35, 37, -17,
+  15, 24, 14, 6, 33, 10, 15, 37, 9, 33, 2, -17, -12, -3, 15, 11,
+  -59, 22, 17, -17, -42, -47, 47, 16, 116, -127, -73, -3, -54, 62, 14, -15,
+  -18, -17, -23, 4, 14, 10, 0, 20, -22, -18, -8, 33, 0, 3, -5, 13,
+  -32, 5, 27, -14, -34, -16, -22, -7, 14, 40, -44, -13, 15, 17, -12, -29,
+  -51, -31, -8, -14, -2, -25, -10, -30, -7, -39, -4, 3, -44, -46, -23, -63,
+  -3, 7, 64, -33, -6, -47, -17, -118, -4, 23, -79, 10, 6, -10, -40, -19,
+  -60, -31, -31, -8, 22, 22, 3, 57, -39, 62, 8, -11, -27, -8, -5, -5,
+  6, -48, 10, 0, -22, -28, -25, -3, -49, -35, -50, 23, -15, -22, -20, 24,
+  -40, -6, -37, 8, -26, -50, 13, 21, -10, 6, -14, 20, -2, 6, 4, -6,
+  14, 8, -47, 15, -18, -35, -28, -5, -14, -32, 14, -30, -19, -37, 29, -6,
+  -16, -3, -39, 2, -26, -25, 8, -60, -22, -28, 9, -17, 11, 25, -8, 6,
+  -7, 9, -10, 17, 13, 38, -17, 5, -14, 9, 23, -14, -14, -12, 36, 46,
+  23, 12, -3, 12, -13, 10, 3, 14, 17, 8, 5, -20, -19, 46, -24, -35,
+  -12, 11, 10, 15, 18, 15, -7, 13, -6, 23, 16, 2, 24, 0, 20, 0,
+  -77, -30, 24, -5, 18, -35, -9, 8, -43, 2, -36, 52, -36, 13, -50, 10,
+  7, 8, -52, -49, 46, -37, -15, -44, 25, 27, -50, 22, 14, -14, -7, 23,
+  -73, -51, -21, 28, -23, -127, 0, -10, 3, 34, -57, -4, -23, -15, 8, 23,
+  -9, -36, -8, 11, 2, -20, -44, -33, 19, 7, -5, 32, 16, -51, -29, -55,
+  -14, 1, -18, -23, -33, -7, 1, -4, 0, -40, 2, 9, -2, 25, -24, -21,
+  23, 0, -31, -6, 0, 2, -20, -5, 11, 23, 5, -16, 47, -23, 18, -23,
+  -19, -16, -13, -11, 11, -22, 11, -6, -17, 18, 5, 22, 10, -13, -20, -33,
+  -44, 6, 18, -21, 4, 16, -7, 0, -33, 20, -32, -20, -9, -4, -27, -44,
+  -77, -7, 29, -15, 20, -25, -5, 29, 5, 36, -17, 20, -15, -42, -58, 60,
+  -21, -83, -55, -62, -48, -15, 11, -115, 25, 11, -37, 36, -14, -2, -38, 27,
+  -9, -14, -11, 8, 18, -22, -1, 33, -9, 26, 3, 26, -13, -13, -6, 8,
+  -25, -21, -3, -24, -15, -22, -39, 0, -6, -11, 7, -20, 14, -8, -25, 17,
+  -54, -13, -7, 23, -28, -27, -10, -3, -42, 0, 5, 43, -41, -10, 21, -13,
+  127, 26, -20, -9, 40, 17, 83, -63, 68, 0, -67, -9, 14, 15, 14, -18,
+  57, 2, 12, 19, -2, -38, -10, -3, -5, 9, 17, 13, -38, -39, 43, 6,
+  -32, 49, 24, 29, -27, -42, -17, -98, -93, -35, 11, 36, -18, 6, 55, -32,
+  29, 7, 15, 2, 15, 19, -12, -3, 34, 22, 15, -27, -6, -74, -37, 70,
+  -56, -29, 12, 11, 24, 0, 20, 0, 21, 0, 35, 49, 68, -30, 14, 0,
+  -22, -31, -2, -16, 26, 73, 14, -18, -63, -28, 48, 43, 41, -51, 3, -70,
+  21, 9, -32, 20, 47, 14, 53, -16, 30, 73, 21, -100, 25, 51, 17, -3,
+  29, -13, 20, 12, 20, 57, -42, 18, 16, 59, -34, -57, 47, -26, 0, -9,
+  0, 0, 12, -17, -20, -28, -33, -86, -72, -73, 11, 36, -36, 66, 24, 23,
+  -29, -4, 52, -68, 41, -57, -63, 6, 16, -37, -7, -97, 50, -39, -9, 6,
+  7, -23, -44, -40, 3, 48, 17, -126, 72, -38, 39, -9, 54, 30, 66, 12,
+  -90, -53, -47, -31, -74, -114, -34, -30, -52, -83, -22, -43, 38, -45, -3, -13,
+  -53, -3, -80, -37, -3, 25, -10, 43, 59, 38, -53, -36, -32, -48, -24, -41,
+  -4, -4, -15, -21, 0, 38, -57, -6, -79, -37, -56, 43, 0, 0, -49, -98,
+  -64, 29, -100, 20, -10, -28, -17, 43, -55, 38, -35, 30, 7, -9, 3, 59,
+  -65, -33, -15, 21, -2, -61, -10, 42, 29, 19, -75, 23, -26, -26, -9, 9,
+  56, -3, -12, -3, -61, -8, -20, -35, -21, 49, 14, 27, 4, -30, -45, -47,
+  -99, 2, 11, -62, 10, 25, -49, -30, -14, -34, -3, -18, -6, -4, -98, 24,
+  -19, 6, 27, -79, -37, 12, 29, -65, 5, 0, -35, 40, 8, 36, -15, -16,
+  55, 7, -19, -41, 5, -46, -58, -13, 23, 65, -45, -59, 16, 7, -27, -10,
+  12, -66, -4, -13, -67, -65, 18, 13, -14, -30, -15, -20, -103, -30, 80, 0,
+  -28, 12, 27, -72, 0, 42, -44, 36, 6, -7, 40, -62, -19, 21, -67, 35,
+  35, -51, -84, -88, -19, -9, 26, 9, 23, 30, 15, 23, 40, -16, -8, 29,
+  0, -12, -38, -23, -50, -8, 2, 3, 0, 0, 5, 0, 61, 35, 3, -10,
+  -109, -57, -106, -16, -30, -114, -62, 61, 9, 38, 12, -47, 8, -102, -23, 26,
+  115, 49, 55, -62, 33, 8, -71, -36, -127, 24, 16, -70, -87, -28, -51, -31,
+  -101, 19, 53, -69, -19, -49, 40, -9, 61, -95, -120, -7, 4, -23, 49, 58,
+  0, -5, -14, -28, 7, 8, -42, 85, -12, 41, -5, 33, 3, -32, -54, -7,
+  58, -60, -97, -13, -15, 34, 0, -13, -65, -23, 8, -87, 16, 0, 4, -23,
+  -20, 5, -27, -21, -12, 50, -51, 16, -46, 0, 8, -62, 16, -42, 24, -7,
+  -12, -9, 71, -28, 81, -62, 44, -69, -14, 23, -46, -3, 16, -43, 11, -35,
+  -55, -27, 3, -23, -41, 4, -62, 10, 6, -51, 21, 55, -3, 35, -17, 3,
+  16, -44, -31, 31, 48, -59, -15, -65, 33, -53, -19, 17, 16, -43, 38, 10,
+  16, -39, -38, 10, 19, 59, -4, -16, -35, 78, -5, 22, -51, 35, 78, -21,
+  50, 3, 71, 38, 37, 37, -15, 43, 0, -11, 27, -30, -8, -122, 65, -23,
+  -37, -53, -24, 21, -63, -6, -24, -57, -6, -2, -8, 8, 12, -10, 27, 30,
+  -17, 23, 51, 46, 8, -16, -5, 13, 54, -14, 31, -17, 46, 17, -25, 5,
+  23, 0, -28, -8, -12, 9, -8, 17, -69, 15, 29, -13, -16, -13, 39, -18,
+  -14, 30, -32, -23, -49, -11, -24, 63, -3, -42, -25, -7, -127, 17, 3, -16,
+  17, 2, -8, -38, 7, 40, -15, 14, -11, -64, 17, 8, 21, 13, -52, -5,
+  -20, 25, -10, -66, -30, -4, -8, -31, 24, 36, -11, -2, 23, -34, 33, 12,
+  -43, -37, -4, 15, -68, -31, 11, -53, -6, -62, -10, 27, 5, 33, 42, -5,
+  -17, 12, -77, 34, -8, 11, -32, 3, 58, -14, 11, -29, 17, -105, -6, -5,
+  40, 9, -12, 30, 0, 73, -15, -5, -27, 62, -10, -35, -19, -33, 42, -38,
+  -113, -7, 51, 28, -30, -36, -3, 72, 34, -72, -101, -29, -26, -22, 36, 12,
+  9, 20, 16, -15, 17, 18, 2, -10, -11, 2, 37, -37, -7, 15, -5, 3,
+  11, 23, -64, -25, -67, -7, -59, -82, 75, -14, -14, -32, 49, 10, 3, -61,
+  -55, -21, -2, 19, -19, -15, -10, -43, -6, -22, 2, -11, -19, -18, 12, 18,
+  -40, -18, -32, -5, 16, -45, -59, 22, 14, 44, -31, 46, 40, -69, 8, -23,
+  -12, -12, 0, 4, -12, 31, -23, -29, -69, -32, -6, -5, -9, -21, -20, -43,
+  25, -14, -6, -21, 13, 0, 21, 19, -27, 44, -42, -24, 29, -14, -6, 28,
+  0, -20, -26, -15, -33, 6, -6, 48, -27, 52, 10, -21, -14, 15, -2, 8,
+  -28, -2, -26, -14, -13, -56, -51, -3, 0, -17, -28, -49, -61, -31, 41, 12,
+  -127, -49, 38, 32, 5, -55, -19, -30, 20, -81, 14, 59, -5, 11, 5, 24,
+  -42, -58, -10, 51, 11, -28, -48, -13, 21, 23, -24, 10, 3, 5, -23, -32,
+  -76, -9, -4, 40, 11, -10, 5, -23, 27, -16, 0, 6, -15, -51, 34, 19,
+  42, -12, 34, -10, 31, 35, 11, 23, -11, -67, -27, 5, -39, 20, 17, -20,
+  -3, -36, -23, -2, -2, -19, -24, -20, -44, -31, -4, 8, -10, -16, 21, -35,
+  36, 15, 30, -2, 40, 12, 34, -79, -75, -64, -15, -15, -15, -33, 38, -15,
+  12, -6, 10, 12, -4, -10, -24, -5, -20, 5, 12, 37, 25, 5, -8, 3,
+  -30, -24, -14, -53, -45, -31, -20, 20, 18, 6, 21, -26, -15, 0, -52, -2,
+  0, 22, -10, -24, 13, 19, 12, 18, 29, -44, 29, -22, 22, 46, -34, 32,
+  -83, -17, -68, -41, -45, 28, 25, 20, -43, 18, -6, -10, -39, 8, -61, 44,
+  39, 36, -21, -30, 13, 13, 5, 15, -4, 18, 22, -110, 2, 51, -72, -40,
+  -30, 0, -34, -34, 6, 26, 20, 46, -36, -38, 24, -26, -24, 30, -12, 15,
+  -9, -11, -2, -2, -7, 22, 7, 33, -15, 13, -2, -22, 12, -8, -5, 40,
+  -53, -61, -30, 7, 14, -19, -14, 10, -14, 29, -33, 10, 27, -3, -70, -2,
+  -100, 0, -15, 6, -53, -55, 2, 0, 18, -3, 14, 6, 17, 19, 41, 27,
+  -71, -41, -27, 72, 45, -33, -59, 76, 11, -12, 41, -23, -76, -18, -20, -5,
+  -45, -37, -71, 24, -82, -48, -2, 15, -62, -42, -24, -8, -44, 54, -28, -21,
+  -42, -10, -58, 29, 62, 26, -3, 50, -21, 61, 6, -61, 12, -28, 12, -5,
+  -105, -35, -18, 2, 11, -95, -19, 22, -25, 16, -35, 17, -49, -44, 6, -46,
+  48, -27, -96, -6, -49, -20, -35, -25, -26, 0, 7, -16, 23, -3, -54, -9,
+  -71, -72, -47, 2, -7, -44, -19, 28, 11, -3, -30, 7, 6, -44, 57, -43,
+  -74, 15, 25, 3, 67, -53, -10, 25, 4, -72, 26, 13, -105, 65, -40, -18,
+  -52, -74, 5, 7, -18, -16, -32, -19, -3, 13, -20, 24, -73, -23, 29, -26,
+  26, -27, -50, 48, 39, 15, -45, 4, 40, 7, 44, 29, 8, 9, -18, -15,
+  0, -5, -88, -39, -18, 36, -2, -3, -49, 16, 5, -24, -30, -13, -26, -30,
+  -4, -27, 8, -3, -102, -53, -38, 8, 9, 36, -44, -67, -8, 22, -58, 9,
+  -19, 7, -21, -44, -7, 60, -25, 31, -33, 80, 18, -56, -3, -10, 26, -33,
+  -15, -51, -29, -57, -46, -70, -17, 20, -26, -11, -55, 3, -53, 16, -18, 30,
+  11, 9, -57, -100, -11, -12, 0, 34, 22, 93, 38, -77, -58, 64, -10, -33,
+  114, 0, 67, -15, 56, 3, -10, 29, 97, -33, 73, -79, 75, 50, 76, 24,
+  45, 2, -80, -5, -52, 20, 6, -16, -11, 23, 15, -111, -6, 34, 26, -43,
+  -51, 33, -29, 21, -18, 0, 38, 37, 26, -90, 15, -22, -41, -56, -25, -6,
+  26, 30, -21, -56, 27, 32, -19, 44, -44, -6, 53, -28, -55, 30, -48, -86,
+  -40, -6, -25, -30, 28, -67, 17, 70, 44, 72, -70, -32, 0, -50, -40, 27,
+  -26, 14, -16, 10, -36, -4, -40, 9, 30, 48, 43, 3, -37, 94, -10, -7,
+  59, 0, -25, -21, 98, -55, 35, -127, 84, 33, -51, 32, 26, -25, 79, 40,
+  45, 5, -36, 5, 0, -20, 0, -31, 3, 0, -20, 45, -6, -43, -29, 10,
+  51, 42, 42, -41, 63, -3, 55, -57, 0, -32, 18, 13, 93, -9, 32, -30,
+  19, 16, -8, 46, 49, 8, 17, -25, 49, -58, -23, 24, -18, 27, -76, -7,
+  -18, 24, 46, -95, -3, 35, 52, -20, -57, -18, 65, 22, 26, 49, 39, -33,
+  -4, 0, -10, 15, -13, -24, 0, -19, 19, 10, -35, -21, 48, 33, 16, 33,
+  -37, 27, -42, 33, -24, 38, -28, -41, -92, -36, 91, -3, -7, -3, -39, -18,
+  -59, -39, 8, -22, 4, -55, -25, -28, 8, 22, -8, 21, 27, 30, 16, 23,
+  -11, -48, -25, 30, 7, -55, 62, 8, 118, -50, 4, -41, 30, -46, 4, 36,
+  -67, -21, -28, 41, -36, 8, 13, -80, -57, -29, 35, 66, 3, -27, -57, -88,
+  -15, -6, -71, -36, -45, 38, -31, 98, -127, -18, -25, 13, -37, 12, -39, -70,
+  11, -16, -69, 15, -34, 16, 13, 22, -27, -48, -5, 66, 45, 80, 29, -16,
+  -95, 9, -116, 0, -84, -17, -66, 110, -88, 18, -4, -47, -63, 12, 82, 0,
+  -63, -44, 0, -41, 16, -8, 10, -15, 14, -74, 10, -97, -21, 40, -29, -10,
+  66, 3, -8, 18, 35, 3, 35, -81, 61, -22, 22, 22, 0, 46, -4, -61,
+  -48, -64, -33, 17, 45, 71, 31, 25, -3, -32, -33, 59, -73, 20, -22, 7,
+  47, -86, -46, 36, 52, 20, -17, -28, -9, 22, -22, -35, -11, -43, 32, -45,
+  -33, -44, -54, 32, -45, -43, 25, -9, -19, -29, -23, 0, -18, 17, 6, -23,
+  106, 42, 21, 18, -42, 9, -24, -41, -57, 7, -55, -35, -52, -31, 68, -24,
+  40, -18, -5, 14, 13, 57, -12, 57, -45, 3, 29, 27, -41, -13, 9, 6,
+  28, -32, -69, -3, -14, 37, -27, 28, -17, 38, -7, -27, 36, -15, -49, -12,
+  -97, -58, -37, 7, -48, -38, 4, -63, 58, -37, -32, -13, 68, -6, 46, 38,
+  7, 0, -32, 83, 105, -65, -47, -16, -110, -49, 0, 46, -51, -99, 3, 3,
+  -47, -56, -47, 9, 4, -19, -20, 36, -11, -43, -19, 10, -53, -45, 22, -3,
+  25, 6, 0, 34, 7, 17, -84, 47, -4, -31, 14, -31, -11, 36, -55, -41,
+  29, 16, -32, -61, 37, 27, -10, -6, -16, -3, -15, 0, 41, -42, -49, -10,
+  -7, -58, -16, -72, -74, 11, -57, -24, -106, -38, 0, -49, -11, 33, 3, 0,
+  -43, 4, 52, -49, 11, 8, -73, 36, 24, -6, -58, -80, -6, 26, -46, 0,
+  -53, -127, -40, -37, -51, -31, -13, -75, -59, -101, -28, 27, -33, 42, -31, 3,
+  -54, -29, -52, -52, -26, -42, -45, 15, -13, 22, -83, 20, -12, 16, -9, -13,
+  71, -66, -48, -17, -7, 8, -44, -4, -98, 49, -21, 21, 36, -102, 31, 23,
+  4, 20, -17, 24, -39, 27, -6, -15, 5, -9, 12, -47, 53, 3, -28, -6,
+  -28, 9, 0, -20, -41, -3, -17, 43, -8, 7, -14, 0, -80, -18, 7, 62,
+  -54, -11, -12, 28, -31, 0, 20, -66, -32, -81, 0, 70, 35, -6, -31, -19,
+  -4, -9, 12, -20, -17, 51, -57, 16, -68, 14, -46, -31, 4, -45, -14, 23,
+  -29, 16, -2, 19, 20, 23, -4, 51, -13, 22, -2, 40, -32, -26, -25, -67,
+  -25, 26, -4, -34, -17, -3, 20, -55, 17, -31, -25, 9, -29, 51, -3, -15,
+  48, -11, -15, -31, -11, 16, -4, 12, -19, 19, 15, -7, -81, 33, -82, -55,
+  -18, -18, -12, -56, -69, -46, -106, 12, -35, 36, 0, 34, -19, -25, 0, -27,
+  -18, -55, -43, 7, 4, -75, 17, 34, 3, 51, -45, -48, -48, -10, 63, -39,
+  76, 38, 66, -41, 38, -26, -21, -73, -35, -7, -18, 56, 19, -43, 57, 15,
+  55, -5, -49, -17, -9, 0, -40, -61, 13, 6, -7, 55, 9, -23, -19, 36,
+  -18, -9, 87, 71, -42, -23, 7, -4, -17, 50, 4, 84, 70, -46, 7, 27,
+  -41, 9, -8, -19, 25, 12, 40, -3, -27, -38, -27, -3, -27, 26, 16, -72,
+  11, -50, -45, -18, 0, -55, -10, 32, -39, -36, -65, -100, 0, -15, 67, -27,
+  22, 21, 10, -19, 60, 67, -21, 71, -35, 60, 25, -58, 57, 36, 79, -29,
+  -127, -33, 79, 24, 21, 12, -3, -44, 83, -50, 40, -6, -33, 12, -50, 60,
+  -33, 7, 38, -34, 27, 8, -21, 25, 22, 19, 2, -38, -18, -20, -57, 68,
+  69, -12, 0, -41, 3, 32, 55, -49, 30, 21, -11, 78, 7, 28, 53, -15,
+  -30, -57, 23, -5, 9, -31, 0, -6, 27, 22, -55, -7, -30, 20, -63, -3,
+  11, -3, -70, -6, -35, 29, -82, 32, 70, -4, -22, 72, -22, 43, -46, -3,
+  11, -18, -18, -5, -121, -31, 17, -28, 19, 38, 0, -17, 6, -56, 9, 36,
+  33, 0, -62, 9, -73, -6, 3, 40, 0, 78, -18, -59, 4, -77, -96, -21,
+  11, -30, -54, -12, -9, -20, -12, -22, -38, -25, -27, -62, 42, 40, 32, -94,
+  33, 0, -66, 32, -111, -29, -24, -8, -13, 36, 33, -103, 78, 0, 18, 3,
+  -14, 45, 41, -11, -2, 22, -25, -43, -46, 0, 16, 13, -20, 9, 27, 18,
+  3, -19, -23, 17, -65, -11, -26, 76, 70, 87, 24, 21, 42, 32, -3, 8,
+  87, 32, -19, -2, 4, 44, 31, -49, 20, -27, -5, -94, 40, 40, -36, 34,
+  -34, -61, 0, 6, -127, 30, 29, 95, -41, -27, 34, -3, 3, -43, 17, 17,
+  31, 2, -14, -61, 4, -22, -10, 43, -36, 30, 16, -55, -79, 22, -71, -3,
+  -24, -28, -113, -61, -81, 3, 10, 68, 16, -3, -58, -6, -3, 6, -10, -11,
+  -21, 2, 10, -25, -25, 7, -2, -40, 15, -6, -9, -61, 17, -25, 36, 37,
+  -44, -42, -54, 30, -10, -54, 13, 4, 12, 57, 102, -56, 45, -12, 0, 25,
+  -31, -34, 31, -5, -44, -41, -25, 29, -13, 3, 7, -23, -88, -16, 9, 28,
+  75, -89, -39, 33, -16, 0, -65, -8, -8, 37, 44, -6, 38, 9, -30, -20,
+  -42, -56, -72, 27, -36, -115, 12, 55, -63, 21, -23, -48, 6, 16, 15, -67,
+  65, -47, -78, 28, 78, 11, 3, 57, 33, -84, 24, -29, 77, -23, 87, -31,
+  10, 4, -10, 14, 19, 37, -4, -49, 28, -51, 30, 19, -37, 6, 24, 6,
+  24, 53, 16, 8, 52, -5, 39, -42, 20, -17, 34, 9, 3, -26, 33, 23,
+  -10, -32, 12, 11, -2, 18, -4, 38, 41, -12, -49, 19, -40, -34, 15, 80,
+  48, -22, -16, -8, -91, 0, -42, 8, -12, 30, 0, -24, -73, 3, 30, -23,
+  -42, -19, -38, 5, -17, -63, -2, 17, 3, 9, 9, -10, 14, 12, 42, 0,
+  -34, -53, 0, 6, 29, 0, -36, 8, 45, -87, 3, -24, 42, 17, 30, -3,
+  53, 21, 21, -37, 12, 99, 0, -25, -46, -57, 43, -28, 0, 24, -28, 23,
+  -39, -24, 7, 13, -25, 18, 0, -11, 12, -3, -10, -51, 13, -55, 54, -16,
+  -27, 2, -21, -13, 20, 42, 11, -28, -12, -49, 2, -31, 35, 21, -28, -70,
+  -52, 19, -45, -5, -22, -16, -40, 26, -78, 39, -26, -79, -127, -14, 90, 35,
+  -20, 4, 9, -39, -6, 14, -34, 3, -39, -52, 0, -15, 24, 3, -31, -15,
+  -13, -5, -15, 0, -9, 29, 9, 15, 55, 26, -55, -17, 10, -8, 26, 24,
+  -43, -25, 37, 35, 6, -60, 36, 6, 19, -32, -49, -19, 5, -75, 3, 23,
+  13, -72, -41, -11, -50, 29, -71, 36, -31, -42, 55, 0, 0, 64, -58, -119,
+  -23, -64, -9, 37, 18, -64, -7, 30, -44, -17, -70, 77, -52, -89, -6, 23,
+  -16, -61, -26, -11, -100, -52, -50, -33, -94, -19, -65, -6, -23, 58, -70, -84,
+  -70, 4, 5, 11, 28, -81, -11, 28, -41, -9, -11, 22, 5, 3, -3, -35,
+  -16, -56, -41, -29, -44, -29, -87, -18, -35, 13, -59, -20, -27, 3, -13, -22,
+  7, -4, -23, -11, 6, 28, -9, -55, -10, -37, 36, -40, -33, 39, 3, 0,
+  16, -19, 0, 8, -41, 5, -3, 7, 67, 42, 7, -20, 33, -69, 29, 14,
+  27, 2, 14, -22, -38, 21, 24, -17, -5, -43, 16, -6, -73, -30, 14, -38,
+  26, 16, 30, 29, 12, -57, -43, 58, 8, 61, -82, -20, -50, -67, -38, -24,
+  30, 2, -39, 13, -32, 7, -21, -22, -46, 14, -9, -9, -71, -3, 23, -56,
+  33, -16, -11, -29, 62, -36, -59, 51, 24, -3, -52, -3, -27, 22, 32, -24,
+  -43, -96, 9, 20, -16, -87, -17, 65, -19, 82, -26, 36, -39, -8, 29, -15,
+  76, -7, 43, 27, 28, 34, 0, -108, 51, -17, -38, 22, 30, 11, -95, 18,
+  -4, -69, -69, 39, -70, -69, 39, -68, -22, -70, -41, 108, -105, 69, 88, -19,
+  -59, 3, 10, 65, -32, -7, -100, 108, -91, 21, -13, -15, 78, -14, 66, -116,
+  13, -13, -48, 25, -8, -32, -24, -7, 16, 0, -61, 24, -95, 8, 51, 8,
+  17, 17, 72, 10, -44, -24, -4, -24, -56, -25, 67, 84, -65, -57, 91, -105,
+  -17, -56, -104, -31, -39, 41, -15, -47, 16, -11, -23, -20, 14, 54, 7, -53,
+  -38, -41, 14, 34, 48, -37, -72, 5, 30, -25, 76, -29, 22, -50, 66, 7,
+  47, 8, -27, -45, -23, -41, 5, -82, -28, -15, -6, -56, -46, -54, 11, -68,
+  -76, 45, 106, 24, -20, -40, -12, 85, -5, -50, 59, 51, 74, -75, 29, 53,
+  95, 16, -27, -8, 0, -46, -27, 25, 19, 59, 23, 12, 14, -19, -15, -15,
+  -47, 38, -5, -27, -113, -24, 40, -52, -51, -46, 21, 11, 48, -4, 83, 0,
+  -17, -13, 33, 0, -10, -50, 10, 29, -16, -7, -29, -24, -25, -58, 26, 4,
+  -4, -34, 29, -48, -28, -10, -44, -104, -71, 12, -67, -7, -48, 4, 25, -84,
+  -13, 8, -24, -3, -8, 23, -15, -36, 16, -15, -26, -16, 88, 73, 22, 65,
+  -127, -83, 72, -21, -20, -50, -88, -123, 81, 0, -4, 7, -43, 0, 46, 14,
+  26, 24, -3, -37, -10, 41, -12, 43, -69, 41, -15, -52, -18, 66, -4, -46,
+  51, -41, -29, -10, -48, -47, -8, -28, 10, 12, 0, 0, -43, 18, 58, 84,
+  32, 35, 16, -13, 0, 22, 26, -15, -17, -3, 8, -19, 22, -39, -23, 5,
+  -17, 0, 49, -33, -8, 30, 25, 16, -3, -42, -29, 10, -38, -2, -6, 12,
+  3, 15, -16, -21, -7, -3, -18, 39, 4, 20, -8, -85, 36, -21, -55, 41,
+  -17, -38, -69, -51, -17, -37, -82, -39, 10, -3, 11, -17, -59, 2, 6, 50,
+  0, -15, -6, 10, 12, -12, -7, 15, 6, -25, 4, 0, -24, 47, 5, 0,
+  -9, -2, -13, 28, 33, 0, 35, 61, -7, -17, 29, 7, 18, 7, 40, 33,
+  3, 24, 26, -46, -21, -19, -7, 12, 6, 43, -22, -79, 10, -26, -13, 23,
+  -3, -49, -43, -12, -25, -39, -55, 51, 0, -17, -37, 37, -24, -24, -11, 29,
+  -76, 20, -53, -79, -21, -37, 3, -34, -75, -15, 48, 0, 41, 34, -8, -65,
+  -58, -2, -39, -9, 17, -27, 5, -22, -14, 79, -23, -75, 21, -127, -23, 67,
+  -44, -7, -33, -2, -4, -34, -8, -34, -21, 3, -14, -30, -19, -5, -53, -18,
+  -12, -14, -69, -33, 28, 0, -35, -3, 14, -45, -11, -10, 27, -24, -8, 5,
+  -12, -16, 33, -19, 25, 47, -10, -12, -39, -43, 0, -14, -79, 26, -25, 5,
+  -37, -12, 16, 16, 41, -5, 8, -77, 38, 11, -6, 15, 6, -32, 23, -10,
+  -88, -53, 28, 27, -80, -81, 7, -15, -30, 33, -4, 55, 0, 11, -5, 5,
+  55, -35, 20, 23, 0, -27, -16, -19, -35, 6, -11, -7, -50, -39, 23, -79,
+  23, 20, -37, 10, 4, 50, -28, -39, -6, 10, -24, 16, 26, 74, 25, -34,
+  -6, -2, 26, -14, 17, -34, -55, -10, -38, 0, 17, -47, -12, 2, 76, 14}
+;
+const int32_t conv2d_2_int8_bias[64] = {25344, 31074, 12353, 10514, 44109, 7045, 5295, 41655,
+  17809, 15906, 28085, 29752, 11452, 17567, 11416, 12905,
+  37527, 27337, 19505, 16052, 24995, 17558, 21392, 19293,
+  8844, 18709, 14919, 26035, 11454, 26885, 23416, 33066,
+  42550, 24211, 44337, 23321, 12783, 22121, 21537, 8978,
+  16984, 17643, 21594, 3635, 35987, 34495, 12738, 20546,
+  23514, 21836, 20206, 21316, 15719, 25677, 20513, 16977,
+  21700, 19684, 31459, 16127, 10141, 32214, 24917, 21126}
+;
+const int32_t conv2d_2_int8_multiplier[64] = {1487515880, 1667644756, 2107314164, 1170277022, 2087741586, 1843899893, 1146626824, 2055120624,
+  1567029476, 1569883810, 1403924664, 1301576395, 1308202528, 1284042628, 2025761758, 1372017286,
+  1166199402, 1995179606, 1177616738, 1084850877, 1224509372, 1092802237, 1227363706, 1243674187,
+  1374158036, 1206975604, 1913219438, 1374158036, 1129194998, 1855724992, 1258149739, 1163854770,
+  1930957086, 1992529152, 2137692435, 1332158547, 1442865938, 1940947256, 1141733680, 1435322340,
+  1320945091, 1337459454, 1906287483, 2074489320, 2135041981, 1897316719, 1690989132, 1982538983,
+  1144180252, 1278945603, 1237965519, 1580485623, 2062460340, 1874889807, 1287304724, 1224509372,
+  1978257481, 1992529152, 2054305100, 2005169775, 2130964361, 1111763171, 1718716950, 1261615716}
+;
+const int8_t conv2d_2_int8_shift[64] = {39, 39, 40, 39, 40, 40, 39, 40, 39, 39, 39, 39, 39, 39, 40, 39,
+  39, 40, 39, 39, 39, 39, 39, 39, 39, 39, 40, 39, 39, 40, 39, 39,
+  40, 40, 40, 39, 39, 40, 39, 39, 39, 39, 40, 40, 40, 40, 39, 40,
+  39, 39, 39, 39, 40, 40, 39, 39, 40, 40, 40, 40, 40, 39, 40, 39}
+;
+
+// conv2d_3: input scale 0.0660064, output scale 0.097564
+const int8_t conv2d_3_int8_kernel[128][3][3][64] NN_ALIGNED = {3, -56, -34, 20, -4, -30, 18, -38, -9, 6, -8, -3, -25, -16, 18, -14,
+  0, -38, -19, 0, 9, -13, -26, -43, -55, -57, -30, -38, 9, -10, 9, -45,
+  -27, 11, -7, 43, 13, 39, -3, -14, 59, -27, -100, -15, -83, -16, -23, 37,
+  14, -40, 35, 6, -29, -6, -56, -22, 20, -34, 33, -39, -13, 56, -12, -24,
+  -19, -9, 3, 3, -72, -5, 8, -7, -3, 28, 0, -40, -15, 10, -8, -11,
+  -39, 25, -12, 38, 21, 0, 47, 40, -21, -9, 17, -32, 21, -44, 28, 11,
+  -3, 39, 26, 11, 29, -19, 59, 5, -22, 19, 3, -8, -10, -16, -16, 37,
+  -31, -11, -23, -22, 6, -56, 41, -2, 26, -24, 9, 32, -10, 3, -10, -29,
+  16, -9, 13, 20, -89, 3, -38, -34, 24, -3, -13, -10, 32, -22, 8, -34,
+  4, 25, 41, 22, -6, -4, -29, -64, 3, 24, -47, 0, 2, 10, 22, -11,
+  41, -4, 22, 5, 32, 10, 31, -23, -6, -41, 7, 17, 16, -11, 49, 27,
+  0, -40, 9, -19, -3, 0, 33, 29, 31, 22, 9, 0, 3, 39, -10, -11,
+  54, -52, 0, 10, -4, 23, -3, 0, -18, -28, 0, 10, -12, -29, 20, 11,
+  0, -72, 34, 0, -6, 24, -17, -28, -29, -36, 2, -29, -7, 20, -46, 6,
+  47, 4, 48, 46, 73, 17, 10, -7, 39, 16, -10, 6, 22, 24, 58, -15,
+  20, -17, 0, 8, 9, -41, 11, -19, -29, -24, -12, -7, -3, 23, 5, 24,
+  19, -22, -21, -10, -119, 13, -60, -83, -84, 51, 41, -10, 5, 16, -46, 11,
+  43, -60, 14, -41, 41, -13, -12, -34, -29, 69, 20, -6, 37, -30, -43, -36,
+  -41, -52, -63, 27, 35, -41, -17, 28, 39, -57, 35, -29, 0, -30, -10, -49,
+  34, -65, -40, -6, 82, -21, 48, -17, 54, -2, -12, 14, -23, 26, 0, 11,
+  -27, -37, 42, -18, -102, -25, -8, -24, 9, 11, -41, 13, 12, -29, -3, -23,
+  -18, -72, 17, 28, -59, -38, -15, -3, -13, -21, -47, -38, -37, -3, -12, 8,
+  34, 35, -7, -59, 35, 15, -35, -32, -14, -25, 24, -44, 57, 5, 23, -5,
+  10, -54, -12, -47, -9, -33, -33, -75, 20, 36, -30, -32, -5, -62, 12, -80,
+  43, 22, 13, -13, 4, -25, -8, 21, -66, 23, 0, 7, -17, 35, 59, 9,
+  18, -19, 12, -3, -18, 21, -15, -3, 13, 42, -7, -35, 11, 14, -22, -53,
+  -10, 11, 11, -5, 22, 24, 0, -28, 25, 0, -45, -17, 0, -76, 58, 2,
+  51, 14, 12, 11, 6, 27, -4, 36, -14, 22, -30, 9, 47, 16, 41, 8,
+  3, 43, -29, -28, 13, -33, 48, 28, 18, 37, -59, -10, -55, -45, -44, -68,
+  -4, 16, 10, -13, -41, -30, -82, 12, -42, -30, 22, -127, -11, -3, 52, -33,
+  10, 20, -81, 3, -35, 15, -108, 46, -25, 47, -52, -33, -48, -11, 52, 64,
+  65, -3, -23, -69, -23, 12, -59, -58, -34, 51, 36, -27, 10, 76, -27, -3,
+  38, 3, 11, 10, -115, 28, 28, -41, -24, 31, -8, -10, 5, -19, -20, 11,
+  -72, -28, -27, -16, 0, -8, 26, -24, 3, -75, -7, 17, 5, 27, -3, -39,
+  17, -2, -52, -24, 57, 2, 21, -51, 11, 3, -3, 0, 38, 24, -13, -17,
+  34, -14, 58, -28, 26, 33, -45, 29, 0, -12, 56, 18, 23, -7, -19, -45,
+  -3, -15, 13, 12, -42, 7, 17, 37, -26, 11, -18, -65, -10, -3, 33, -22,
+  -4, -9, 26, 6, -9, -6, 28, -6, -13, 71, 19, 11, 13, -23, 12, -30,
+  0, -13, -14, 26, 25, -12, 24, 25, 46, 3, 31, 18, -53, -13, -13, 19,
+  27, 28, 11, 19, -23, 41, 36, 5, -8, 31, -12, -7, -18, 13, 7, 39,
+  13, -57, -13, -15, -79, 15, -34, 10, 18, 3, -65, -3, 24, -38, -5, 11,
+  46, -58, 40, 3, 35, 11, -9, -27, -59, -29, -12, -40, 25, -43, -73, -3,
+  13, -53, -40, 58, 12, 38, -44, -43, 30, -54, 3, -6, 16, -32, 13, -22,
+  40, -22, 25, 14, -34, 12, 40, -5, 28, 14, -35, -20, 0, -58, 7, 21,
+  -47, 3, 0, 7, 29, 10, -42, -20, -15, 53, 25, 69, -32, -53, -8, 28,
+  56, -3, 5, 0, 17, -26, -3, -9, -41, 15, -54, 11, -25, 3, -15, 8,
+  23, 24, -51, -16, -6, 7, 10, 11, 25, -72, 7, 0, -3, -29, -22, -34,
+  30, -11, 34, -59, 40, 61, 98, 12, 22, 17, -35, -7, -31, -26, -2, 49,
+  -39, -9, 36, 5, -8, -2, 42, 71, -18, 3, -43, 20, -19, -35, 35, -19,
+  7, -31, -40, 19, 9, -9, -51, -9, 31, 56, 49, -48, 27, 46, 30, 8,
+  20, 15, 14, -21, 19, 33, -34, 14, 41, 16, -34, 4, -37, 24, -3, 14,
+  -7, -19, 11, -38, 14, 14, 11, -2, -11, -12, -9, -16, -5, 39, -2, -8,
+  5, 39, -62, -62, -4, 29, -56, -13, -88, 39, -85, 0, 19, 72, 15, 22,
+  32, -114, -12, 31, -70, -22, -54, -24, -23, -38, -39, 71, 4, 17, -36, -85,
+  40, -75, 0, -13, 109, -69, -109, -61, -65, 21, 7, 6, -16, 34, 54, -24,
+  107, 25, 51, 127, -37, -64, -62, -35, -45, -19, -78, -25, 41, -87, 47, -42,
+  37, 9, 21, 10, -12, -10, 32, 57, 20, 25, -63, 75, 22, -6, 43, -39,
+  -39, 52, -33, 0, -14, -20, 3, -57, -43, -27, 24, -71, 25, 53, -9, 8,
+  63, 21, 7, -5, 22, 12, -20, -2, 11, 24, -3, -2, -37, -13, 0, 0,
+  -7, -22, 42, 32, -17, -49, -40, 24, -81, 14, 6, 34, -10, -16, 14, 18,
+  21, 3, -15, 10, -8, 20, 37, 37, -35, -36, -13, -10, 5, 35, 33, -28,
+  28, 37, -17, 0, -6, -46, -6, 27, 5, 32, -10, -48, 0, 10, 76, 30,
+  17, 28, 51, -37, 3, 24, -85, -23, 5, 0, -47, 8, -6, 3, 32, 10,
+  0, -19, -20, -22, -43, 9, -102, 24, -48, 9, -12, -42, -5, 29, 12, 5,
+  16, 3, 0, -25, 91, -22, -37, -64, 9, 11, 20, -52, 36, -47, -18, -19,
+  -46, 21, -12, 12, -26, -24, 77, -9, -43, -15, -15, -6, -2, 90, -24, -19,
+  -50, 32, 97, -32, 44, -52, -17, -61, 3, -86, -37, 24, 16, 21, 6, -46,
+  -37, -28, 62, -8, -60, 12, 91, 5, -3, -35, 23, -13, -5, 0, 28, -8,
+  -18, 9, 52, -25, -71, -7, -12, -17, 32, -3, 25, -7, 49, -50, -48, 14,
+  0, -68, 17, -22, -9, -11, -3, 3, -10, -15, -22, 62, -7, 56, -12, -16,
+  -80, 21, -25, -34, 19, 41, 17, 7, -5, 48, -24, 12, -31, -24, -32, 26,
+  -7, -19, -3, -70, 20, 0, -25, 33, 28, -28, 29, 38, 0, -90, 47, -73,
+  -49, 20, 26, 5, -23, -7, -43, -19, 14, 41, -5, -27, -18, -29, -16, -3,
+  20, -14, 20, -46, 0, 15, 24, 25, -19, -8, 0, -8, -4, 31, 48, -13,
+  12, 18, -7, -2, -41, -7, 25, -10, 61, 5, 3, -23, -49, -44, -47, -11,
+  19, -3, -13, -40, 3, -16, -54, -4, 0, 4, 65, 4, 2, -54, 2, 27,
+  2, 17, 26, 18, -8, -39, -27, 100, 5, 39, 16, 36, -7, -82, -12, 13,
+  -10, -29, -24, 40, -3, 3, 34, 14, -36, 8, -20, 8, 19, 37, 0, -5,
+  83, -10, 13, -22, -26, 7, 25, 15, -30, -17, 22, -47, -6, -30, -15, 65,
+  12, -10, -13, 20, 5, -5, -44, 9, 10, 11, 24, -31, -50, -45, -22, 27,
+  29, 50, 10, 39, 15, -23, -2, 19, 14, 13, -16, 36, 7, -12, 9, -3,
+  75, -11, 64, -17, -8, -10, 13, 6, -14, 25, -18, -37, -25, -3, 3, 30,
+  12, -6, 10, 27, -6, -7, -6, 6, 13, 22, 0, -13, 17, 2, 38, 13,
+  -16, 34, -45, -33, -24, 46, -57, 48, 0, -2, 30, -19, -9, -6, -35, 44,
+  -10, -8, -10, -7, -50, 25, -46, -9, -65, 21, -28, 24, 20, 9, 14, -21,
+  -23, -26, 20, 14, -38, 36, 0, -42, -17, 3, -2, -37, 15, -46, -8, 3,
+  40, 20, 60, -27, 29, 2, -19, -4, 58, -32, -13, -21, -3, -5, 47, -16,
+  3, 57, 50, 10, -37, -3, 91, 31, -39, -24, 3, 37, 7, 12, -13, 48,
+  2, -53, 31, -7, -19, -41, 41, 12, 0, 82, 60, 6, -54, -15, -51, 0,
+  -26, 0, 26, 6, 5, 17, 3, 81, -21, -19, 5, -13, -12, -3, 36, -41,
+  -6, -81, -94, 32, 29, -9, 10, 17, 0, 7, 6, -57, -14, -30, -41, 38,
+  25, -41, -29, 40, 58, -35, -51, -22, 36, -68, -5, -46, -28, -39, -48, 10,
+  -10, -39, 24, 23, 27, 50, 59, 3, -16, -41, -14, 67, -9, -9, 23, -8,
+  10, 29, 33, 6, 16, -2, 40, 53, 0, -14, 7, -8, -29, -28, -22, -30,
+  3, -12, -23, 41, -17, -24, 6, -19, -38, 15, -54, 19, 14, 34, -38, -42,
+  -28, 28, 0, -20, -3, 46, -14, 35, 70, 26, 67, -25, -9, 36, 18, -22,
+  -2, 20, -10, 7, -27, 7, -16, 3, 8, -3, 5, -9, -9, -3, -28, -13,
+  -33, 14, 20, 23, 8, 9, 37, -14, -40, 11, 36, -10, 50, 3, -22, -35,
+  -49, 20, -17, 7, 61, 4, 6, 19, -18, 5, 0, -38, -17, -7, -9, 4,
+  0, 8, -26, 30, -26, 3, -64, 2, 42, -4, 3, 23, -12, 6, 2, -7,
+  -15, -34, 7, -14, -123, 14, 50, 34, -41, -57, -7, -6, 23, -26, 0, -31,
+  29, -37, 4, -55, 51, 21, -5, -14, 9, 22, -5, -8, 4, -55, -34, -48,
+  80, -2, -47, -49, 20, 4, -57, 29, -33, -20, -50, 13, -6, -10, -3, -11,
+  12, 26, -8, -35, 58, -13, 24, -20, 18, -24, -65, 2, 5, 51, -28, 15,
+  39, -73, -43, 9, -58, 50, -25, 9, -57, -46, 0, 3, -14, 0, 0, -26,
+  -13, -20, 53, 43, 35, -19, -19, 36, 28, -22, 14, 58, 19, -74, -84, 18,
+  0, -6, -30, -32, -32, 4, -48, -38, 20, 12, 16, 8, 93, 20, 24, -16,
+  93, 13, -37, -28, -127, -11, -41, 26, 10, -18, -62, -29, 28, 57, 7, -2,
+  -5, -25, -5, -5, -15, -11, -11, -12, -32, 3, 9, 36, -4, 6, 14, 15,
+  -10, -62, 45, -6, -3, -15, -18, 19, 16, -19, 2, -54, 8, -6, 0, 10,
+  12, 14, -36, 7, -29, -11, 47, 0, 0, 5, 0, 21, 6, 32, -23, 18,
+  -67, 20, -23, -20, -42, 64, 33, 17, -5, 30, -51, 10, 9, 27, 37, 24,
+  22, 8, -7, 14, -8, -18, -11, -56, 59, -20, -14, 3, -18, 9, 39, -20,
+  -6, 20, -30, -3, 51, -24, 29, 33, -23, 19, 58, 13, 14, 88, -6, -13,
+  -70, 37, -46, -22, 20, 2, -38, 4, 35, 10, 25, 24, -63, 5, -32, 20,
+  -58, 33, -3, 2, -37, 11, -7, 17, 0, 11, -53, -10, 12, 32, 15, 38,
+  19, 14, 9, 5, 34, 16, -14, 0, 16, 3, -7, -33, 7, -12, -7, 13,
+  -26, -28, -35, 20, -8, -25, -39, 28, -26, -3, -4, -47, 25, 30, 6, -23,
+  -6, 16, -3, 12, 3, 2, -25, 31, 58, 22, 3, -15, -43, -10, -3, -18,
+  -64, 28, -16, -20, 18, -24, 7, -19, -5, 6, 5, 4, -16, -12, -9, 22,
+  19, -25, -5, 23, 27, -32, -5, 74, -3, 20, -34, 21, -18, -32, 14, 0,
+  -19, -42, 4, 26, -16, -57, -21, -6, -33, -3, 36, -57, 12, -24, -11, -53,
+  30, 22, -50, 41, -20, -13, 9, 29, 35, 5, 12, -32, -54, 10, -47, 0,
+  34, 13, -23, 15, 8, -40, -33, -39, -15, 6, -13, 0, -28, 50, -2, 22,
+  5, -55, 0, -77, 91, -25, 32, -65, -83, -13, -44, -24, 40, -26, -16, 10,
+  -23, -101, 65, -14, 24, 42, 76, 6, 33, -65, -69, 16, -23, -37, -86, -30,
+  -27, 41, 13, -24, -17, 48, -91, -39, -98, 22, -31, 11, -52, 37, 6, -15,
+  49, 46, 80, 60, -21, -19, 43, -32, -18, 9, -35, 4, -16, 9, 63, -12,
+  2, -31, -52, -11, 4, 2, -2, -71, -48, 0, -25, -24, -9, 40, -7, 20,
+  26, -8, 2, -3, -5, 15, -29, -11, -35, 54, 9, 36, 27, -6, -11, 5,
+  -18, -18, -3, 34, -11, 28, 72, 25, -3, -15, 47, 4, -46, -34, -12, 11,
+  21, 20, 10, -7, -5, 3, 60, 28, -13, 19, -13, -14, -21, 0, 28, -10,
+  46, -8, 19, 39, -50, -20, 23, 40, 62, -3, -9, 12, -22, -40, -2, 0,
+  13, 37, 19, -31, 24, -14, -5, 8, -30, 14, 20, 13, 23, 24, -19, 13,
+  37, 12, 40, 22, -9, -24, 60, -4, 28, -25, 59, -24, 26, 7, 0, -15,
+  -34, -74, -18, -15, -50, -27, 0, -13, -8, -30, 67, -4, 0, 15, -13, -10,
+  5, 19, 47, 18, -38, -18, -45, 12, 51, 23, 69, 30, -20, -46, 41, -38,
+  -6, -23, 24, -34, 32, -14, 31, -8, -19, 8, -29, 31, 39, -37, 14, 38,
+  67, -16, -33, 27, -31, -72, -16, -35, 10, 39, 53, 9, -29, 0, -84, -11,
+  43, -46, -41, 82, -10, 13, -30, 4, -8, 22, -74, -8, -5, -127, -41, 2,
+  -24, -36, -12, -36, -23, 5, -34, 12, 0, -20, 16, 27, -16, 14, 48, -31,
+  6, 6, 4, -28, -19, -32, -10, -36, -73, 3, 40, -16, -14, -6, 36, 8,
+  -27, -6, -3, -10, -23, -2, -6, 27, 23, 2, -19, 7, -31, -22, 35, -22,
+  -6, -28, -13, 25, -29, -13, -47, -9, -36, 11, -11, 18, 21, -47, -11, -2,
+  42, -9, 31, 2, -12, -10, 10, -13, 18, -14, -8, 10, 27, 16, -40, 31,
+  -14, 37, 21, 12, 38, 6, -9, -3, 66, -9, 24, -51, 7, 17, -9, 5,
+  -27, -15, 4, -11, 66, -29, 48, 27, 0, 32, 14, -14, -3, 5, 6, -7,
+  3, -31, 48, -27, -14, -23, -51, 38, 28, 5, -20, 2, 5, 3, 7, 0,
+  -24, -12, 31, 5, 4, 22, -15, -13, 12, 56, -45, 36, 5, -28, 18, 42,
+  53, -6, 19, -6, -20, -20, -11, -9, -5, 32, 2, -25, -16, -23, 36, -19,
+  -23, -15, 4, 8, -25, 31, 0, 32, 16, -32, 54, -59, -25, -29, 22, -7,
+  27, 14, -6, 3, 0, 20, 55, 12, 17, 24, -32, 20, -26, 6, 17, -10,
+  -11, 3, 21, 20, -29, -39, -5, -57, 20, 8, -5, -20, -37, 25, -45, 14,
+  -21, 15, 5, -46, 9, -11, -46, -48, -8, 12, -39, -45, -13, 0, 3, 5,
+  -10, -21, -7, 29, -3, 10, 79, 20, 33, 0, -17, -35, 28, -19, 6, -39,
+  -27, -33, 23, 11, 26, -17, -25, 33, 45, 12, -44, 9, 5, 16, 7, 31,
+  -3, 27, -21, 0, -62, -5, 20, -10, -3, -19, -48, 7, -15, 22, -15, -6,
+  -42, 3, 9, -46, -26, -11, 9, 36, 3, 6, 83, -48, 20, -17, 21, 3,
+  10, -9, -11, 18, 19, -10, 31, 11, -16, -54, 20, -47, -16, -21, 35, 17,
+  -47, -61, -3, 0, -20, 29, 36, -19, 45, -31, 78, 4, -38, 35, 19, -26,
+  -26, -3, -13, 15, -21, 27, -37, -64, 3, 14, 3, 16, 5, -19, 18, 47,
+  21, 18, -50, 37, -17, -33, 63, 0, -61, 68, 17, -23, -40, 27, 127, 16,
+  -63, 19, -61, -79, -25, -36, 24, -23, 14, -38, 20, -61, -34, 48, -51, -34,
+  37, -28, -34, -32, 3, -32, -40, 28, -45, 19, -3, 38, -84, -16, 2, 34,
+  18, 0, 8, -12, 21, 10, -54, 34, -56, -31, -40, 23, 0, 16, 28, 36,
+  42, -22, -33, 53, -35, -26, -46, -63, -13, 12, -10, -42, -4, -40, -45, 38,
+  33, 17, -4, -32, 3, 26, 7, 0, -3, -24, 0, -61, -59, -40, 29, 77,
+  -20, 14, 17, 27, -3, -26, -11, -24, -123, 7, -102, -49, 5, -87, 42, -31,
+  24, -18, 41, 5, -91, -5, 10, -3, 61, -31, -3, -23, 7, -41, -10, 25,
+  -46, -25, 5, -6, 64, -22, 20, 45, -10, -44, 34, -40, 16, 50, -21, -11,
+  10, 28, 43, -42, -19, -33, 7, 7, 5, -19, -88, -14, 12, -96, 16, 14,
+  -43, -11, -37, -14, 9, -15, 65, -14, 8, 5, -15, -20, 10, 10, -9, 10,
+  -29, -57, -65, 40, 66, 42, -39, 17, 6, 36, 25, 7, -54, -3, 58, -33,
+  -67, -15, -24, 0, -29, -22, 31, -18, -5, 30, 41, 25, -63, 66, 12, -82,
+  116, -51, 72, 47, 41, -36, 0, -43, -16, -43, -95, -63, -47, -82, 35, -34,
+  33, 53, 116, 27, -54, 6, -33, 5, -39, 42, 0, -49, -54, 39, 21, 10,
+  -8, 0, 62, -17, -62, -25, 42, 74, -3, 69, 45, -52, -37, -41, -5, 44,
+  -56, -15, -42, 59, 6, -33, 80, 72, -74, -24, 27, -42, -4, 37, 36, 3,
+  -90, 0, 43, 8, 16, -2, 72, -16, -35, 48, 10, -51, -37, -61, -35, -2,
+  -50, -39, 51, 62, -9, 38, 29, 0, 62, -21, 32, 40, -49, -109, 40, -18,
+  36, -13, 6, -7, 3, 48, -5, 0, -11, -26, -42, -5, -11, 16, -5, 10,
+  51, 13, -15, -2, 4, 20, 8, 22, 15, 11, 25, -27, 13, 7, -15, -2,
+  -7, -14, -105, 6, 16, -36, -20, 40, -28, -31, -2, -9, -20, -6, 12, -18,
+  0, -26, -12, -6, 39, -15, 8, 0, -22, 24, 4, 16, 11, -40, 38, 13,
+  10, 13, -8, -13, -45, 50, -7, -2, -45, -44, -13, -2, -5, 32, -24, 0,
+  74, 36, 46, 7, 6, -4, -27, 15, 4, -6, 7, -10, 0, -5, 4, -22,
+  27, -25, 5, 57, 25, -5, 2, -8, -32, -12, -2, 1, 20, 4, 14, 7,
+  7, 2, 35, 8, 19, 8, 8, -2, 20, 2, 6, -7, -9, -7, -17, 0,
+  -10, -11, -36, -4, -127, -2, 11, -29, -2, 12, -5, -40, 4, 30, 24, -18,
+  23, 18, 10, -2, 21, -12, -15, -7, -11, -41, -2, -6, 3, 12, 15, -2,
+  -24, 11, -87, 2, 0, -3, -5, -2, 24, 16, 12, 16, -7, -14, -9, 26,
+  -7, -26, 2, -8, -29, -46, -19, -34, 16, -14, -11, 21, -9, -38, 9, -27,
+  -29, 31, -13, -29, 85, 47, 18, -17, -11, -36, -15, 33, 2, 41, -9, 4,
+  20, 38, -26, 34, 8, 17, -25, -4, 26, 24, 4, 0, -21, -5, -15, 44,
+  -2, 9, -3, 0, -5, -23, 12, -16, -14, 18, -32, 10, 0, 6, 12, 37,
+  -32, 8, -58, -12, 0, -15, -40, 12, -45, 27, 36, -3, 9, 28, 15, 6,
+  -34, -13, 8, -51, 12, 23, -5, -17, 9, -18, -44, -29, 7, -5, 16, 14,
+  -41, 34, -9, -16, -8, 28, 0, 17, 22, 21, 25, 8, 0, 2, 31, -10,
+  -12, 22, 18, 10, 20, 7, -22, -13, -40, -16, -44, 21, 32, 35, -12, -14,
+  -37, -57, 23, 6, -23, -44, -37, 52, -14, 7, -13, 0, 11, 5, 9, -46,
+  4, 20, 2, -16, -85, 16, 43, 20, -21, -6, -13, 0, -28, 41, 44, -26,
+  -33, 74, 15, -7, 34, 39, 2, 41, 15, 37, -11, -41, 37, -51, 40, -22,
+  -24, 33, 21, -13, -2, -23, 17, -36, -12, 16, 20, 10, -9, 0, 32, -18,
+  -34, 6, 12, 0, 39, 8, -29, 7, -10, 27, 2, -7, 2, 30, -26, -13,
+  0, -2, -6, 0, 109, 30, 9, 61, 9, 10, 0, 21, -32, 14, -15, 6,
+  -41, -7, -15, 50, -4, 21, 39, 4, 0, -2, -9, 23, 23, 19, 18, 22,
+  56, -8, 26, -11, -18, -42, 22, 15, 48, -14, -69, -28, -5, -48, -51, 21,
+  -12, -12, -43, 20, -39, 4, -32, -26, -33, 27, 36, 3, -2, -42, -22, 8,
+  -29, -9, -11, -13, 121, 70, -2, -5, -66, 44, 29, 2, -27, -27, -13, 4,
+  41, 11, -52, 18, -27, 31, -15, 33, -4, 56, -14, -25, 10, 36, 26, 12,
+  14, 0, 74, 0, -2, -42, 30, -2, -34, -53, -5, -15, 66, -62, 14, -67,
+  -12, 8, 19, 43, -15, 0, 5, 14, -10, 12, 40, -23, 20, -23, -41, 23,
+  4, -11, 45, -11, 30, 13, -4, -2, -15, -14, 7, 69, -16, -2, -51, -12,
+  -38, -22, 17, -14, 4, 15, 19, 44, -15, 32, -23, 8, 29, 0, 35, 32,
+  58, -17, 39, -38, -23, 9, 25, 16, 62, -37, -22, -4, 20, -62, 25, -28,
+  37, -53, 23, 26, -17, 25, 32, 15, 14, 22, -6, -3, 22, 12, -7, 2,
+  -23, 40, -9, 27, 0, 33, -41, 30, -19, -37, 25, -18, 13, 3, -6, 31,
+  8, -34, 13, -14, 10, 28, -38, 3, -40, 39, 11, 50, 7, -22, -50, -15,
+  55, 2, 20, 23, 62, -50, 8, -20, 3, -30, 4, -7, 21, -38, -39, 3,
+  48, 37, 16, 9, 16, -29, 48, -16, -62, 21, -42, 25, -11, -11, -3, 26,
+  -17, 33, -71, 8, -9, 35, -33, -45, -36, 37, 17, 7, 8, 56, -19, -21,
+  43, 34, -8, 14, 19, -16, 0, 33, -59, 7, 24, -22, -15, -44, -50, -39,
+  -22, 52, -12, 35, 24, 0, -45, 0, 3, 0, 19, -5, 65, 23, 25, -45,
+  22, 43, -25, -9, -13, -6, 76, 21, -19, 0, -42, 0, -3, 28, 52, -40,
+  20, -50, -20, -66, -41, -5, 43, -19, -13, -9, -6, 40, 0, -80, -11, 58,
+  27, -68, -18, -27, 48, 8, 9, -7, 0, -3, -21, 75, 7, 37, 3, -54,
+  0, -2, -24, 26, -14, 5, -53, -40, 15, -15, -7, -7, -3, -26, 32, 35,
+  44, 12, 25, -84, 44, -10, -28, -52, 3, 21, -35, -20, 48, -57, 39, -12,
+  0, 7, 17, -11, -23, -11, 16, 4, -10, 3, 17, -25, -30, -14, 42, -9,
+  -47, -41, 18, -14, 42, 10, -35, -40, 59, -7, 27, -19, -35, -4, -57, 6,
+  51, -47, 40, 29, 0, 16, 11, -17, 42, -24, -15, 5, -59, -21, -81, -27,
+  4, 12, -16, -3, 3, 29, 12, -13, 53, -23, -16, 2, 17, -4, -8, -6,
+  -32, 37, -40, -69, 105, -71, 60, -7, -23, 31, -33, -79, -3, 35, -17, -9,
+  23, -85, 26, -14, -45, 2, -13, 0, 40, -127, -62, -16, -17, -73, -33, -51,
+  62, -9, 32, -6, 10, 39, -8, -57, -108, 83, -82, 16, 28, -3, -39, -37,
+  74, 67, 66, 110, 22, -10, 32, -55, -22, -10, -6, -7, 3, 50, 39, -17,
+  49, -10, 0, -8, -37, 33, -38, -52, -16, 46, -53, 40, -11, 14, -14, 6,
+  8, -3, 5, -21, -19, 8, 13, -17, -90, 26, -21, 22, 59, 44, 13, 6,
+  7, -42, 4, -12, 7, -13, 11, 5, 69, -41, -30, -11, -34, -67, 28, -24,
+  15, 3, 69, 9, -69, 6, 0, 36, 12, 0, 51, 5, 0, 0, 31, 46,
+  15, 47, 9, -11, 0, 14, 19, 48, -48, 15, -33, 18, 0, -21, -42, -28,
+  19, -51, 3, 31, -10, -14, 6, 53, -56, -10, -3, -59, -40, 0, 20, -12,
+  37, -42, -28, -12, 41, 21, -94, -10, 18, 21, -22, -18, 0, 41, 49, -19,
+  0, -3, -25, 3, 28, 0, -88, -34, -46, -34, 58, -5, -51, -7, -16, -35,
+  84, 57, 6, -44, 18, -16, -62, -4, 45, -34, 28, 7, 0, -14, -66, -46,
+  62, 7, -8, -14, -48, -12, 25, -53, 6, 33, -19, -12, 30, 51, 10, 36,
+  51, -26, 64, -52, 31, -89, -60, -50, 30, -115, 64, 7, -7, 3, -14, -56,
+  -7, -58, 59, -3, -41, -19, -44, 5, -127, 13, -3, -2, 3, -103, -47, 17,
+  -96, 10, -28, -25, -5, -5, -22, -4, -13, -18, -11, -40, 0, -56, -14, -55,
+  35, -7, 44, 14, -90, -77, 19, 46, -40, 26, 19, -28, -91, 70, 40, -48,
+  -33, 45, -12, -15, -10, 32, -15, 30, -33, 6, -86, -9, -24, -50, -25, 35,
+  -22, 15, 12, -24, -16, 16, 44, 3, 25, -21, 16, 15, -76, -53, 8, 14,
+  -11, 22, -11, -15, -42, -33, 15, 31, -21, 23, 13, 43, 40, -6, 15, 25,
+  -29, -6, 36, 63, -50, -11, 26, 15, -8, 33, 0, -46, 11, 54, 15, 44,
+  37, 15, -52, 32, -51, -22, 63, -5, -28, -30, -31, -19, -73, 16, 10, -32,
+  -20, -20, -26, 28, 9, 35, -41, -22, -20, -48, -9, 18, -8, -62, -2, -27,
+  -32, -15, -13, -20, -13, -45, -8, 0, -42, -57, -5, 23, 15, -13, -3, -59,
+  -57, -75, -22, -3, 24, 19, 58, -34, -3, -57, -25, 43, 7, 3, 6, -39,
+  51, 26, 48, -38, 0, -7, -14, -18, -11, 11, 28, 15, 13, -19, -55, 15,
+  -17, -28, -9, 22, -6, -59, -41, 5, -29, -29, -9, -14, -23, -23, -53, -11,
+  5, 31, -45, 3, 30, 43, -35, -41, 0, 0, -13, 17, -35, 19, 23, -34,
+  -64, -16, 31, 6, -53, 6, -15, 18, -21, 6, 10, 43, -18, -34, -68, 3,
+  -20, 11, -22, -21, -13, 15, -7, 9, -11, -5, -3, -15, 54, -22, -32, 0,
+  -17, 3, -6, 41, -15, -44, -67, -7, -29, 24, -18, -11, -47, 3, -19, -35,
+  -56, -71, -24, -8, -51, 8, -63, 10, -33, -8, 31, -7, 17, -29, 20, 6,
+  0, 34, 36, 6, 18, 13, 15, 24, 16, 27, 7, -37, 9, 24, -6, 17,
+  -20, 2, 33, 40, 29, -15, 35, -58, 14, -60, 55, 2, 35, -11, -36, 0,
+  -7, -59, -26, -30, -23, 0, 33, -2, 3, -14, 0, -16, -76, -23, 19, -8,
+  13, -22, 32, -5, 0, 30, 65, 3, -39, 8, -3, 13, 12, -6, -66, -42,
+  -82, 9, 0, 50, 0, -38, -78, 6, 13, -15, 27, -9, -25, 27, 55, -67,
+  0, -24, 0, 19, -54, 24, 10, -2, -22, 49, 21, -33, 41, 24, 100, 5,
+  55, -40, -14, -69, -44, -56, -30, -70, 26, -29, 33, -5, -21, -89, 7, -50,
+  -3, 74, 42, 8, 47, -18, 13, 51, 33, 25, -18, -17, 12, 6, 18, -57,
+  11, -9, -31, -41, 18, 0, 15, -6, -10, -27, -12, 14, 36, -27, 46, -22,
+  -51, 33, 18, 8, -25, -12, 59, 0, 0, -33, 17, 25, 41, -35, -26, 0,
+  51, -31, -40, 17, 41, 15, -59, 2, -31, 7, -24, 0, -26, -3, 22, -8,
+  16, 6, -53, -13, 17, -18, -5, -72, -30, -40, -13, 50, 35, -6, 77, -25,
+  61, 19, 19, -69, -50, -34, 3, -40, -29, 63, -15, 12, 23, 27, 15, -28,
+  0, 20, -22, 27, -76, 10, -56, -21, -17, 3, -31, 12, -70, -16, 39, -25,
+  -95, -3, 20, 14, -23, 53, 0, 36, -9, 58, 24, -5, 31, -23, -19, 19,
+  5, 12, 18, 3, 127, 15, 3, 14, 0, 31, 20, -37, -30, -38, -13, -34,
+  7, 13, -14, -82, 35, 4, -55, 61, -83, -27, 5, -20, 2, -17, 43, -42,
+  -17, 26, -7, -27, 3, 36, -91, 7, -3, 8, -55, -23, -57, -27, -3, 25,
+  -27, 45, 0, -50, 52, 95, 41, 29, -14, -22, -18, 36, -13, 23, 24, -3,
+  -43, -49, 58, -10, 59, -3, -23, 3, 48, 23, 0, -10, 5, -67, -13, -57,
+  -54, -66, 14, -32, -65, 9, -35, 37, 16, -30, -17, -63, 27, 10, -28, 6,
+  41, -105, -11, 40, 13, 0, -21, 18, 64, -46, -35, -19, 19, 30, 10, -39,
+  0, 8, -29, -8, -52, 35, -48, 14, 49, -36, 30, 16, -5, -43, 24, 27,
+  3, -55, -5, -11, -84, 26, 13, -14, -53, 27, -27, -35, -21, -27, 27, 0,
+  19, -7, 5, 7, 19, -22, -15, 26, -43, 22, -28, -93, -5, -32, -3, 17,
+  -21, -45, -88, -3, 50, -41, -44, 14, -17, -48, -4, -11, -80, 40, -7, -41,
+  18, 41, -48, -3, -30, -9, 27, -18, 12, 8, 15, 12, -14, -41, -10, 33,
+  39, -13, -49, -11, -22, 13, -63, -4, -78, -59, -11, 52, 23, 33, 5, -47,
+  78, 65, -23, -3, -43, -33, -45, -32, -11, 47, 39, 27, 10, -7, -32, -38,
+  7, 23, 35, 34, -20, -8, -22, 0, 38, -17, 11, 24, 3, 25, 40, -28,
+  -39, 9, -42, -12, -42, -15, 77, 18, -92, -5, 15, -14, -22, -34, -3, -8,
+  6, 16, 8, 3, -18, 5, -37, -11, -22, -21, -11, 52, 3, -23, 16, 24,
+  -19, -16, -45, 30, -46, -8, 39, 0, -11, -6, -23, -39, 14, -25, -32, -6,
+  18, -25, -50, 17, 80, -38, 18, -22, 41, -51, 7, -33, -43, 28, 17, 54,
+  11, 18, -48, 0, 49, -15, 62, -20, -12, 40, -68, 17, -22, -45, -15, 14,
+  -17, 29, -38, -40, 35, 5, -16, -11, 31, 6, 24, -59, -8, -40, -24, 3,
+  22, -39, 3, 13, -9, -47, -12, 3, -27, -9, 16, 21, -31, -7, 23, -6,
+  -35, 11, 35, -11, -46, -18, 25, -48, -9, -60, -29, -20, -73, -71, -7, -3,
+  43, -80, -6, 37, -39, 52, -54, 10, -30, -3, -12, -40, -35, -51, 8, 3,
+  20, 48, -5, -32, 75, 3, 21, 11, 22, -127, -29, -111, -10, -23, 40, -44,
+  11, 10, 3, 20, 25, -10, -3, -99, -3, -50, -23, -36, -12, -74, -35, 35,
+  -14, 30, 96, -11, -66, 33, -84, 24, 38, -14, -18, 28, -30, -14, 51, -38,
+  -39, 6, 102, 29, 9, 31, 0, -45, -83, 78, -49, -48, -8, -14, 20, 22,
+  -3, 51, 47, -42, 22, 26, 21, 4, 6, 27, -5, -52, 34, -13, -29, -44,
+  49, 29, 8, -30, 15, -18, -49, 16, -41, 41, 21, 3, -17, -4, -10, 9,
+  -42, 2, 12, 0, 13, 20, -44, -41, -44, 9, -54, -39, -17, -34, 10, -28,
+  14, -50, -9, -12, -9, -6, -8, 20, 9, 0, 6, -29, -33, -14, 33, -19,
+  0, 6, -5, -5, -31, -5, -26, 68, 40, 27, 8, -3, 0, -37, 0, -27,
+  -26, -10, -18, 23, -12, 33, -3, 41, -19, -22, -23, 6, -57, 49, 32, 6,
+  -11, -20, -42, 25, 20, -43, 11, 43, 3, 37, 22, -28, -17, 23, -17, -3,
+  21, -18, -36, 12, 3, 19, -23, 33, -21, 18, 52, 2, -5, 21, 10, -19,
+  98, 48, 25, -5, -9, -63, 26, 50, 22, 18, 21, 10, 28, -10, 11, -71,
+  15, 46, -25, -63, 43, 10, -33, 16, 46, 3, -28, -51, 74, -60, 23, 17,
+  28, 0, -77, 17, 33, -48, -4, 19, 20, 31, 76, -9, -20, -34, -111, -61,
+  -14, -27, -12, 23, -21, 49, -27, 18, -69, -8, -31, -10, -43, -75, 0, -14,
+  -25, -64, 5, -13, 44, 29, -34, 14, -56, 30, 5, 17, -13, 17, 0, -44,
+  -56, 42, -8, -36, -96, 25, -45, -3, -82, 50, 3, 18, -26, 46, -3, 52,
+  -18, 0, 111, 62, -40, 0, 44, 19, -35, -23, -7, 0, -20, -23, 24, -54,
+  -32, 18, 30, 0, -18, -3, -58, -15, 6, 0, 25, -7, 33, 38, -58, -3,
+  75, 20, -14, -46, 32, 51, -5, -52, -35, -3, -80, -22, -43, 0, -58, 21,
+  -43, -10, 39, 48, 29, 16, -34, -20, 0, -55, 48, 65, -22, -62, -20, -27,
+  -26, -24, -79, 29, -17, 5, -53, -15, 69, -18, -7, 2, -51, 70, 28, 50,
+  -33, 37, -28, 18, 50, -38, -68, 3, -12, 42, 19, 22, 53, -14, -8, 29,
+  6, -13, 37, -3, 37, -8, -8, 63, -26, 64, 22, -11, 11, -3, -36, -34,
+  0, 27, -18, -3, 16, -34, -41, -7, 25, 39, -11, -59, 22, -55, 3, 27,
+  58, -12, 0, 20, 38, 16, 0, 35, 0, -9, -22, -9, -7, -18, -3, 13,
+  51, -27, 47, 0, 6, 10, 28, -23, -3, 0, 6, 20, -8, 18, 26, -54,
+  -3, -27, -37, -11, -59, -11, 43, 4, -13, 34, -8, -25, 24, 28, 50, 31,
+  31, -10, -18, -24, 19, -20, 31, -40, -42, -45, -3, -37, -42, 51, 10, -60,
+  -11, 2, -60, 12, -21, -26, 60, -5, -21, 94, -19, 13, -17, 9, 38, -13,
+  48, -9, 22, 0, 25, -3, 56, 3, 65, -16, 19, 34, -45, 32, 23, -23,
+  -26, 10, -9, -55, -9, 30, 8, 67, -13, -9, -66, -36, 35, 21, 50, 0,
+  -62, -34, -26, 71, -22, -20, 44, -53, 17, 49, 0, -34, -37, 7, -63, 24,
+  -22, -49, 12, -17, 27, -50, -64, -2, -78, 3, 41, 20, -21, 6, -45, -5,
+  15, 37, -40, -33, 3, -48, -72, -29, -71, 0, 10, 12, 28, -4, 5, 37,
+  -20, -70, -68, -71, -82, -127, 5, 100, 23, -15, 36, -25, -32, 28, -19, -104,
+  -31, -14, 26, -31, 19, 16, 34, 3, 20, -26, 29, -16, 22, -62, -70, -36,
+  26, 0, 123, 6, 14, -55, -109, -30, 75, -27, -7, 0, 24, -12, -52, 8,
+  44, -98, 3, -6, -60, 0, 80, -62, 12, -10, -89, -59, -115, -7, -8, -20,
+  -46, -80, -9, 30, -14, 84, -62, 11, -16, -18, 8, -43, 8, 42, -30, 18,
+  43, 61, 18, 34, -3, 10, -6, 43, -11, 55, -29, -9, -76, 18, -23, 45,
+  -73, 2, -28, 46, 27, 8, -19, -45, -24, -41, 30, 18, -24, 9, 0, -24,
+  51, 12, -19, -24, -53, 77, 20, 42, -6, -16, 61, 7, 37, -39, -5, 6,
+  -9, 0, -9, -16, 110, 14, 14, 70, -6, -3, -52, -29, 11, -10, -28, 15,
+  -81, -3, -60, 65, -61, 26, 34, -56, -73, -42, 45, 3, -20, 15, 13, 42,
+  18, -14, -44, -12, -48, -3, 34, -57, 12, 21, -52, -29, -21, -18, -7, 32,
+  18, -15, -40, 12, 0, -26, -44, -67, -71, 39, 48, -57, -3, 57, -3, -14,
+  -40, 0, -28, -35, -5, -62, -62, 59, 10, 89, 6, 25, -29, 24, -69, -24,
+  8, -41, 34, -92, -61, 20, 53, 53, -20, 29, -56, 22, -10, 55, 66, 12,
+  69, 19, 36, -64, 3, -5, -8, 15, 9, -35, -52, -22, 14, -88, 14, -42,
+  85, 21, 3, -42, 16, 35, 16, -31, -22, 13, 3, -10, -34, -25, -73, 40,
+  -6, -47, -17, 38, 9, 22, -32, -63, -29, 43, 3, -79, -78, -3, -33, -34,
+  70, -71, -39, 24, 16, -2, -9, 30, -31, -10, 19, 6, -69, 26, -27, 15,
+  -40, -89, -4, 20, 17, -55, -38, -40, 66, -35, -26, -20, 45, -18, -14, -19,
+  26, -18, 99, 24, -44, 41, 16, 0, -34, -13, -16, -15, -6, 7, 18, 32,
+  -2, 32, -46, -29, -89, -18, -11, 6, -23, 12, -42, 15, 26, 62, -16, -2,
+  19, 25, 27, 17, 13, 0, 48, -61, -16, 3, 19, 35, -48, -35, -16, -51,
+  -35, 78, -74, -2, -61, 38, 49, -16, -53, 7, 45, 35, -14, 2, -20, 58,
+  -33, 7, 13, 10, -15, -41, -42, 6, -25, 55, -39, 32, 20, -20, 23, -30,
+  5, 24, 28, -11, -92, -35, 20, 24, 39, -2, -13, -3, -37, -42, -11, 0,
+  44, 0, 53, -22, -49, -15, 15, -59, -36, -39, 2, 5, 20, -65, -16, 5,
+  9, 2, 45, 7, 58, 6, 9, 10, 34, 33, 69, 4, -42, -24, -25, -39,
+  21, 5, -58, -14, 23, 23, 19, -2, 65, -13, -36, 16, 30, 0, -11, -37,
+  5, 24, -44, -18, -18, 22, -15, -51, -16, -20, 13, 6, -2, 53, 33, -15,
+  -3, 30, 23, -25, 0, 26, -3, 21, -46, -11, 13, 10, -28, -47, 0, -19,
+  -24, -4, -35, 21, -28, -21, 0, -30, -36, 50, 42, -35, 36, 7, 31, -47,
+  24, 15, 48, -5, 36, 21, -23, -2, -2, 55, 15, 10, 20, -17, -25, -19,
+  9, 43, -16, 9, -22, -7, 39, 54, 5, 10, -31, -35, -15, -11, -11, 22,
+  -6, 49, -36, 19, 18, 8, 43, -16, -14, -42, 13, -3, -34, 0, -27, 17,
+  0, 6, 23, 33, 14, -45, 18, 18, -12, 36, 42, 7, 11, 2, -40, 4,
+  9, 0, -43, -67, 33, -10, 10, 21, -52, 36, 15, 8, -7, 29, -11, -51,
+  -26, -19, 11, -29, -33, -31, -72, 15, -5, 22, 11, -15, -17, 31, 4, 25,
+  13, -16, 21, -61, -18, 3, -13, -61, 2, 0, 22, 13, 26, -15, -86, -19,
+  -86, -4, 64, 21, -14, 13, -88, -87, 24, -81, 33, 13, 64, -66, -127, 4,
+  0, -82, 23, 58, -43, 36, 107, -61, -30, 11, -21, 2, -52, 43, -59, -37,
+  -37, -22, -9, -24, 22, -83, -15, 54, 23, -22, -20, 29, 19, -48, 31, -37,
+  28, -57, -32, 8, -5, -7, 3, -8, 43, -13, -22, 8, 32, 68, 57, 10,
+  -35, 32, 45, -7, -28, -55, -9, 8, 7, -31, 3, -15, 22, 5, 37, -47,
+  0, -49, 25, 10, 0, -10, -3, -29, -7, -6, -18, 20, -14, 23, 0, 30,
+  -23, 11, -60, 9, 55, -26, 20, 78, -3, -10, -7, 9, -4, -8, -4, -42,
+  0, 16, -34, 33, -34, 5, 38, -3, -11, 34, 17, 20, 10, -21, 3, -10,
+  35, -17, -13, 16, 33, -6, -21, -24, -19, -50, 6, -13, -25, 2, 3, -13,
+  -24, 22, 18, -17, -3, 5, 16, -32, -22, -2, -28, -24, 9, -3, -11, 0,
+  16, 8, 0, -33, 30, -24, -11, -18, -5, 27, -7, 26, 13, -56, 4, 22,
+  -3, 46, 21, -25, -36, 8, 38, 32, -30, 66, -13, -13, -6, 3, 8, -10,
+  44, -4, 51, 0, -17, -6, 61, -18, 34, -48, -15, 7, 3, -12, -20, -9,
+  6, -5, -15, -55, -13, -15, 3, -4, 0, -6, -31, -8, -46, -3, -17, 9,
+  19, -11, 9, 18, 7, 4, 20, -24, 18, 25, 45, 3, 15, -25, -4, 17,
+  47, 25, -29, 55, 13, 18, 13, 37, -14, 11, 0, 3, -6, -18, 0, -51,
+  -30, -49, 29, 59, -11, -32, -46, -24, -2, 2, 6, 7, -33, 5, 54, 11,
+  -36, -5, 5, -29, 61, 36, 65, 17, -32, 50, 13, -40, -32, -32, 19, 2,
+  -20, -28, -34, -12, -65, 42, 27, -10, 39, 6, -8, -20, -13, 5, 16, 22,
+  25, 10, 6, -14, 7, 16, 2, 19, 2, -9, 11, -2, 9, -10, -7, -11,
+  -18, 0, -22, 14, 15, -24, -32, -16, 13, -21, -29, 0, 15, -4, -7, -17,
+  10, -30, -11, -23, -24, -23, 11, 9, 2, -18, -14, 16, 4, -33, 20, -34,
+  -16, -21, 24, -25, -13, -15, 29, -18, -5, -30, 4, 5, 11, 27, 19, -11,
+  22, 53, 13, -24, 2, 10, 4, 7, 2, 34, 4, -18, -3, -77, 0, -2,
+  59, -20, -28, 27, 15, -6, -5, -18, 15, 15, 0, 13, -19, 12, -25, -37,
+  -29, -22, -26, -2, 11, 7, 31, -7, 4, -11, 9, 0, 2, 18, 2, -8,
+  -6, -35, -4, 0, -16, 13, -8, -10, -23, 19, -43, 30, -8, -10, 8, -4,
+  -41, -5, 6, -26, -16, -3, 2, 9, 6, 44, -36, -44, 21, -3, 21, -15,
+  -49, -10, 17, -25, 5, -17, -5, -19, 15, 4, 24, 8, -36, 12, 7, 24,
+  -13, -15, -26, 8, -22, 5, 42, -18, 11, 33, -43, 16, 0, -15, -28, -6,
+  16, -16, -30, -41, 19, 6, 23, -13, 23, 2, -16, 18, 28, 0, 8, -9,
+  25, -24, -18, 17, -20, -34, -27, 9, 16, -11, 0, -15, 0, 15, -59, 13,
+  -36, 23, 28, -41, 22, 24, 8, -39, 30, 46, -108, 33, -7, 12, 2, 24,
+  -42, -35, -4, 4, -24, 2, 31, -2, 4, -6, -23, -68, -10, -23, -4, -6,
+  -2, 0, 42, -17, 10, 40, -97, 16, 11, -76, 12, 5, -19, -20, 27, -50,
+  -8, -24, -11, 43, -32, -20, -38, -75, -34, 16, -9, -9, 17, 8, -16, 53,
+  -10, 35, 81, -29, -68, -63, -53, 11, 40, -127, 8, 27, -63, -29, 32, 0,
+  -21, -56, 18, 17, -42, 63, 45, 11, -2, 31, -5, -47, 54, -53, -42, 10,
+  -29, -12, 20, 6, 19, 6, -13, 26, 59, 17, -16, 10, -19, 17, 12, -32,
+  11, 43, -11, -14, 2, -44, 0, 23, -36, 21, 9, -7, -38, 3, 75, 0,
+  -10, 2, 17, -20, -5, -9, 11, -4, -49, -37, -11, -25, 7, -2, 2, 4,
+  0, -4, 26, 13, -7, 18, 20, 31, 0, 17, 5, 5, 0, -5, 31, -16,
+  4, -56, -6, -31, 42, -2, 31, -73, 18, -22, -23, 10, -11, -20, -55, 0,
+  -8, 12, 28, -17, 9, 0, 18, 33, -8, 44, -26, 0, -14, -5, -12, -2,
+  -18, -18, -6, -29, -27, -15, 19, -11, -15, 42, 18, -25, 10, 10, 5, 2,
+  31, -22, -18, -6, 22, 25, -6, 33, 54, 0, 25, -7, 12, 33, -37, -4,
+  -8, -14, 36, -12, 39, -13, -10, -5, 32, -32, -4, 20, 59, -27, 25, -50,
+  -36, 0, 17, -12, -5, 1, -35, 9, 4, 41, -2, 11, -17, 10, -14, -15,
+  -10, -23, -22, 10, 17, 7, -16, 5, 34, -46, 5, -35, -19, -4, 30, -6,
+  -42, -9, -59, 21, -7, -11, -6, 29, 24, 11, 5, -21, -24, -78, 0, 28,
+  -16, 16, -14, 39, 29, 10, 15, 29, 14, -6, -21, 15, -23, -2, -8, 6,
+  -16, 26, 9, -31, -11, -17, -22, 2, -36, 2, 4, 15, -24, -3, -21, -6,
+  -5, -13, 81, 18, -7, 43, 35, 16, -38, 8, -18, 8, 12, -6, -25, 0,
+  0, 17, 13, 25, 7, -7, 8, 13, 17, 11, 5, -14, -12, -10, 6, -28,
+  31, -38, -5, -15, -20, 7, -24, -40, -37, -11, -29, 38, -14, 46, 17, -19,
+  28, 48, 2, -18, 17, 0, -28, -44, -23, 69, 40, 22, -9, 6, -15, 3,
+  -29, 21, -78, -8, -3, 19, -10, 18, -8, 24, -13, -8, -73, 8, 12, 12,
+  26, -33, -11, -11, 11, 3, -21, -37, 22, -12, -26, 26, -43, -25, 14, 15,
+  -10, -44, -20, -29, -57, 60, 7, -30, -26, -30, -47, -19, -10, 58, -7, -3,
+  89, 36, 7, 39, 11, 5, -28, -62, 8, -23, -5, -30, 13, -16, -33, 13,
+  -13, -38, -28, 13, 52, -35, 10, -27, 8, -21, 63, 6, 9, -26, 34, -21,
+  43, -35, -33, -21, 53, -14, -28, -2, -5, 9, -9, -22, 18, -72, 0, -8,
+  -3, 6, -3, 0, 0, 7, 2, 10, 52, 0, -5, -13, 0, 3, 17, -3,
+  28, 9, 5, -36, -51, 14, -17, 32, -18, -23, -33, 11, -46, 23, -41, -8,
+  13, 8, -64, -13, -24, 9, -23, -24, -21, -5, 0, -10, -18, 5, -19, 5,
+  -49, -24, -11, -13, 14, 3, -21, -5, -36, 16, 14, 15, -3, 16, -14, -3,
+  33, -18, -33, 17, -8, 0, -34, -53, -26, -41, -42, -22, -5, 6, 20, -5,
+  14, 6, 7, -3, -34, -5, -8, -44, -10, 35, 2, 0, 11, -16, -33, -21,
+  -65, -10, 50, -8, 64, 49, 20, -13, -29, -8, -40, -2, -34, -13, 9, -5,
+  13, 27, 3, 19, 3, 0, -7, 18, -41, -14, 23, 22, -33, 72, 14, 8,
+  -10, -38, 28, -36, -45, -36, -22, -36, -46, 30, -22, -38, 38, 22, 2, -5,
+  -14, -63, -28, -15, -54, -7, -17, 18, -5, 6, -45, 36, 26, 10, 6, -32,
+  -16, -77, 25, -26, 15, -5, -30, -53, -16, 0, -33, -12, 18, 8, -12, -50,
+  65, -38, 19, 127, -106, -43, -96, -44, -63, -2, -60, -61, 20, -95, -42, -10,
+  21, 33, 10, 12, 45, -46, 29, 10, -29, -5, -42, 13, -5, -15, 17, -68,
+  28, -15, -55, -36, -37, -16, -20, -85, 43, -14, -5, -8, -9, 16, 0, -3,
+  6, -33, 81, 0, 6, -9, 17, -4, -24, 26, 17, -26, 6, -26, -87, -38,
+  -16, 27, 28, 58, -8, -108, -7, -16, -96, 37, 6, -4, -23, -22, -5, 23,
+  -3, -59, -58, 15, -12, -12, 0, -3, 26, -38, 0, 6, -14, -25, -15, 14,
+  28, 39, -9, 58, 26, 2, -53, -18, 8, -14, 5, 41, -9, 39, 15, 37,
+  -65, 29, -14, -21, 34, 16, -74, 7, -11, -26, -30, -32, -37, 3, 3, 28,
+  16, 24, -17, -11, 8, 34, -93, 16, -19, 9, -17, -11, -60, 35, 21, 25,
+  -36, 6, 13, -44, -4, 87, 17, -43, 9, -90, 39, -22, -12, -49, -32, 57,
+  -83, 15, -7, 30, -3, 38, 56, -3, -15, 32, -40, 19, -92, 45, 24, -43,
+  -13, -31, 7, -5, -43, -44, 27, -91, 3, -34, -23, -2, -27, -16, 25, -42,
+  -16, -68, 41, 21, -31, -65, -25, 5, -5, -14, -6, -20, -35, -54, 12, 28,
+  -26, 80, 35, 5, -69, 12, 70, -36, -11, -5, 66, -13, 5, 71, 12, 41,
+  3, 72, 18, 58, -9, 4, 56, 21, 48, 35, 57, -17, 7, -6, -30, -3,
+  -101, -23, 28, 18, 15, 2, -3, 22, -5, 31, -17, 16, -18, -21, -19, 7,
+  -16, 8, -8, 34, 33, -37, 25, 37, 36, 44, 3, 7, -33, 22, 46, -46,
+  -4, 15, 4, 2, -17, 8, -32, 16, -7, -2, 2, 53, -31, -61, -2, -7,
+  -28, 15, -2, 22, -21, -30, -16, -43, -45, 17, 16, 23, 5, -27, 17, 26,
+  3, 14, -3, 13, -5, -17, 19, 0, 4, -15, -3, 2, -18, 0, -8, 31,
+  -11, 4, 5, 17, -23, -12, 12, -25, 2, 13, 12, -4, -14, 8, 13, 4,
+  -25, -24, -10, 12, 37, 8, 12, -49, -14, -56, -10, 8, 24, 10, 14, 9,
+  -17, -32, -19, -10, 26, -42, -53, -31, -6, 12, -18, 36, -7, 45, 29, 37,
+  8, -12, -44, -34, -5, 6, -6, 16, 26, -6, -14, 8, 10, 6, -18, -21,
+  11, 16, -7, 28, -7, 12, 38, -13, -25, -6, -35, -4, 35, 34, -6, 0,
+  38, 5, 8, 38, 10, -20, -6, -30, 12, 4, -24, -5, 10, -10, -12, 22,
+  3, 32, -17, 2, -23, -49, -11, 7, -2, -7, 10, -43, 5, 19, 34, -26,
+  8, -12, 29, -23, 5, 4, 25, 24, 11, -17, -25, 11, -63, 38, -3, 4,
+  35, -22, 20, 30, 7, -56, 29, -17, 14, 13, 12, 2, -14, 36, 6, -2,
+  28, 5, -12, -36, -17, 28, -36, 24, -61, 29, -38, -3, 16, -15, -32, 4,
+  -11, 17, -17, 25, 77, -3, -25, 2, -27, 71, -25, -25, 14, 21, 54, 2,
+  16, 17, 29, -23, 50, 2, -6, -4, 24, -22, 16, -30, -18, -6, 31, 0,
+  19, -20, 77, 11, -23, -23, -32, -34, -27, -8, 35, -14, -2, -29, -8, 23,
+  -8, 19, -8, -24, -64, -65, -8, 73, 26, -34, -44, 34, 8, -84, -22, 0,
+  45, -25, 13, 17, -2, -12, -30, 2, -21, -90, -27, 18, 14, 56, -32, -40,
+  27, -36, -12, 11, -28, 23, 19, 27, -18, -39, -8, -3, 63, -49, -20, 27,
+  59, -60, -71, 0, 11, 2, 15, -19, 43, -55, 16, -34, -4, -127, 17, -19,
+  15, 7, -21, -10, 7, -61, 8, -3, -14, -13, 30, -13, -2, 18, -40, -9,
+  11, -22, 8, -2, 12, -22, -14, -36, 14, -14, 2, -2, 0, -24, -15, -9,
+  67, -43, 29, 51, -40, -25, 61, -4, 0, 0, -33, -20, 38, 0, -8, 10,
+  3, -20, 39, 13, 7, -23, -18, -13, -16, -4, -28, -27, -14, -29, 28, 2,
+  -19, 12, 6, 4, 7, 14, -10, 52, -9, 0, 26, -45, 31, 5, -2, 13,
+  -14, 15, -4, 17, -16, 15, 60, 2, 8, 38, -14, -59, -29, 24, -12, -9,
+  29, -33, 12, 74, 40, -15, -19, -42, -9, -4, -27, -18, -3, 4, -10, 6,
+  -3, -9, 39, -17, -23, -42, -38, -36, 11, -13, -14, 25, -21, 21, -17, 10,
+  44, 39, -23, -24, 40, 6, 6, 8, -33, -18, 24, -16, 8, -13, 40, -34,
+  3, -2, -21, 47, -2, 12, -25, 22, 51, -55, -35, 39, -20, -40, 17, -18,
+  -110, 12, -3, -19, 13, -2, -63, -55, 9, -11, -14, 0, 25, 66, 0, 19,
+  22, -34, -25, 4, -48, 16, -18, -25, -41, 4, -35, -7, 4, 5, 27, 19,
+  11, -5, 10, -48, -50, -18, -16, -24, 14, -27, 16, -3, 35, -10, 12, -36,
+  -25, 30, 11, 0, 14, -22, -32, -39, 2, 26, -39, 11, 0, -5, -34, 57,
+  8, 12, -32, -53, -10, -15, 17, 22, 33, -13, -5, -20, 40, 21, 10, 68,
+  -5, -51, -59, -2, -34, 19, -6, -2, -63, 4, 5, 20, -12, -8, 9, -25,
+  12, -17, 12, -14, -29, -4, 44, 11, -14, -24, 2, 13, 19, -7, 25, 7,
+  22, 0, 6, -7, 14, -10, 20, 16, -34, 16, 8, -15, 3, 23, 31, -11,
+  0, -17, -17, -10, 27, -19, 32, -5, -4, 17, 5, -22, -37, -35, 10, -38,
+  63, -46, 13, -13, 11, 5, -20, -26, 20, -28, -2, -47, -30, -25, -24, -8,
+  -43, 5, -26, 16, -6, 29, -8, 3, -32, -15, -8, -8, -23, -15, 12, 26,
+  88, -2, -31, 19, -20, 12, -18, -16, -28, -16, 6, 71, 28, -39, -14, 17,
+  8, 22, 6, -23, -5, 13, 37, -5, 4, -25, 32, -24, 5, -19, -10, 9,
+  -29, -22, 15, 32, -11, -27, 0, 42, 24, 13, 14, 16, 20, 20, -13, 10,
+  -2, -24, -12, 19, -49, 33, -2, -50, -16, 11, -29, 13, -6, -52, -16, 35,
+  38, 2, 17, 17, 18, 0, 16, 14, -42, 48, 8, 53, -21, 52, 2, 9,
+  -21, 3, 11, -35, 5, 17, 13, 4, 28, -13, 5, 16, 27, -29, 20, 19,
+  -26, -4, -13, -15, -36, -20, 17, 37, 11, -4, 23, 12, 14, 15, -11, 8,
+  10, -2, 30, -39, -6, 12, 10, -24, 7, -13, 0, 26, 13, 7, 25, -7,
+  -27, 10, 13, 22, -16, -13, 24, -26, 2, 12, -19, -11, -26, 29, -14, 21,
+  -5, 43, 40, 4, 10, -4, 16, 4, 21, 8, -11, 19, -39, 21, -17, -30,
+  -10, -24, -9, -21, -13, -23, -26, 0, 37, -7, 2, -23, -6, 3, 24, 16,
+  60, 9, 30, 0, -104, -25, -33, -79, -7, 15, 0, -8, -48, -37, -39, 0,
+  33, 53, 17, -34, 23, -6, 36, 37, 2, 53, -10, -46, 26, 83, 0, 2,
+  -80, -30, -127, 35, 34, 4, 29, 4, 43, 13, -50, -40, -105, 12, 0, -26,
+  39, -13, -4, 6, 0, -29, -85, -11, 18, -39, 68, -17, -2, -88, 2, 22,
+  -8, 52, -20, -39, 71, 2, -27, 45, -21, 0, -16, -8, 30, 54, 20, -20,
+  -27, -38, 6, -19, -9, 7, 7, -23, 12, 2, -15, -13, -12, -10, -7, -9,
+  16, -10, 8, 16, 29, -7, -11, 21, -43, 27, -32, -14, -22, -4, 0, -8,
+  3, 11, 46, 21, -29, -20, -17, 22, -18, 7, -39, -17, -18, -15, -17, -8,
+  25, 43, 2, 16, 16, 0, 25, -3, 16, 2, 27, -10, -17, -29, -6, -11,
+  -22, 10, -2, -15, -29, -6, 9, 2, 0, 51, -8, -20, 0, 26, -12, -15,
+  -8, 5, -37, 14, -44, 0, -19, 11, -4, 10, -29, -3, -17, -25, 12, 15,
+  -8, -9, 7, 36, 7, -18, -54, -15, -2, 15, -9, -7, 8, 3, -11, 16,
+  -6, 0, -46, -19, 19, 56, 13, 74, -14, 15, -20, 43, -44, 47, 35, -4,
+  -38, -2, -31, -39, -48, 3, -16, -35, 30, -46, -25, 20, 49, -29, -50, -11,
+  5, 27, -28, -8, -29, 0, -11, 12, -34, 17, -21, -13, -15, -10, 32, 4,
+  55, 13, 33, 36, -24, -7, -45, -7, -33, 6, -16, 21, -8, 18, -24, 41,
+  10, 24, 0, -12, -6, -6, 27, 21, -94, 2, 6, -18, -65, -29, 0, 4,
+  -52, -12, -11, 0, 14, 19, 36, 61, -14, -7, -13, -73, 9, -23, -5, -26,
+  29, -32, -28, -12, 7, 6, 43, -57, 11, 15, 34, -16, -7, -64, -12, -32,
+  21, -22, 11, -4, -20, -29, -34, -53, -22, -4, 23, -24, 4, -23, -41, 8,
+  11, 22, 23, -34, 27, -20, 16, 46, 9, -7, -14, -24, -25, 25, -12, 29,
+  14, 7, -25, -20, -7, 1, 34, -7, -14, 12, -10, -34, -20, -13, -34, -4,
+  8, 3, -20, 40, 2, -29, 0, 0, -9, -13, 16, 8, 25, -13, -15, 40,
+  35, -11, -2, 9, 16, 5, -20, -6, -2, -9, 0, -18, -25, -18, 15, -33,
+  -76, 22, 54, -22, 37, 10, 10, 11, -26, 31, -20, -16, 25, -25, -12, -22,
+  62, -5, 9, 22, -21, -10, 2, 38, 25, -2, -23, -7, -32, 0, -24, -28,
+  32, -14, -14, -19, -17, 44, -19, -4, 17, 15, 8, -5, -5, -49, 10, 13,
+  35, 33, -20, 4, 27, 46, 26, 4, 31, -17, -19, -20, 18, 3, -25, 17,
+  -53, -29, -2, -28, 46, 45, 4, -35, -26, 40, -24, 10, 0, -48, -18, 29,
+  67, 34, 0, -15, 39, 27, -23, 5, -49, 19, -18, -20, -7, 64, -46, -24,
+  0, -17, -3, -23, -10, -2, 11, 0, 11, -17, 19, -7, 65, -19, -74, 6,
+  21, 0, -14, -13, 21, -5, 38, -6, -4, -13, 44, 5, 22, 13, -21, 8,
+  6, -5, -19, 0, 13, 20, -26, 16, -49, -11, 16, 18, -29, 40, -40, 24,
+  22, -2, -28, -20, 12, -16, -25, 14, -41, -5, -27, 43, 4, 5, -39, -26,
+  24, -7, -6, -2, 5, -38, 25, -49, -9, -26, -3, -13, 0, -25, -46, -21,
+  13, -40, -54, -37, 11, 42, 20, 26, 52, -13, -7, 9, -6, -41, -40, 27,
+  -48, 17, 35, -127, -43, -26, -16, -11, -2, 38, 32, -5, -4, -88, 16, -51,
+  45, -32, -6, 2, -37, -12, 43, 65, -27, -19, -23, 36, -73, 95, 22, -81,
+  16, -51, -43, -4, 7, -10, -74, -70, -17, 4, -73, -29, 7, 17, 23, 33,
+  77, -7, -14, 17, 0, -42, -17, -49, -22, -2, -7, -34, -29, -93, -13, -42,
+  46, 46, -12, -44, 43, 2, 18, 67, -37, -2, -48, 10, -41, 28, 32, -69,
+  17, -42, -28, -12, 37, 28, -21, -22, 27, -31, -33, -14, 16, -27, 14, -13,
+  42, 7, 23, -4, -5, -2, 14, -18, -28, 19, 41, 42, 27, -38, -3, -2,
+  27, 36, 36, 43, -16, 5, 23, 6, -60, -25, 0, -13, -14, 31, -11, -37,
+  -8, -19, -8, 16, -60, -53, 0, -13, 44, -42, 18, -16, 16, 15, 6, 24,
+  -25, 27, 17, -7, 7, -27, 14, -10, -27, 14, -8, -16, 38, 29, -2, 13,
+  -48, 17, -26, -21, 17, -30, -57, 13, -31, 24, -41, -29, 2, -32, -8, 19,
+  29, 11, -16, 37, -23, -9, -15, -13, -13, 6, -32, -23, -61, -21, -15, 17,
+  -40, 17, 14, -2, 27, -43, 33, 70, 12, -4, 38, -21, -4, 20, 16, 31,
+  -67, 5, 0, 0, 32, 29, 18, -34, -29, -21, -2, -27, -20, -3, 10, -17,
+  19, -2, 52, 38, 7, -57, 22, -56, 2, 0, 38, 15, 37, -28, -46, -23,
+  37, -27, 41, 28, 48, -46, 35, -26, -36, -38, -63, -18, 14, -31, -32, -31,
+  -6, 10, 50, 32, -23, -45, 33, 32, 28, 64, 36, -26, 6, -53, -48, -42,
+  -62, 2, 17, 35, -9, 13, 66, 43, 33, -24, -10, -45, 0, -64, 24, 28,
+  -8, 9, 35, 17, 5, -15, 41, 38, 13, 15, 33, -10, -5, 0, 10, -19,
+  27, -27, 47, 19, 2, -32, 26, -13, 38, -34, -5, 21, 4, -10, -4, -8,
+  39, 0, -2, -20, -41, -12, -14, 6, -19, 11, 18, 0, 2, -23, -49, 23,
+  35, -3, 19, 41, 0, -2, 33, 10, 25, -10, 16, 2, 7, 19, -12, -2,
+  19, 12, -15, 26, 3, 12, -17, -9, 45, 4, -14, -49, 3, 11, 31, 20,
+  -11, -43, 28, -29, 12, -7, 51, 19, 30, -17, -7, 31, -34, 0, 4, -13,
+  -32, -12, 0, 22, -37, 18, -20, 22, -24, -30, -31, 13, 4, -21, -18, -25,
+  20, 3, -33, -25, -2, -42, 9, 5, -10, 19, -34, -19, 2, 33, -10, -22,
+  35, -14, -50, 0, -13, 10, -6, -32, 56, -11, 8, 0, -10, 0, 8, 10,
+  -19, -36, 14, 9, 9, 7, 15, 0, 23, -15, -5, 2, -21, -37, -15, 0,
+  11, -50, -4, -8, -75, -2, 6, -28, -19, -23, -45, 11, 0, -13, 2, -52,
+  61, -10, -19, 30, -38, -5, -16, -15, -63, 22, 16, 2, -28, 35, 22, -20,
+  -5, 0, -47, 2, -3, 14, -45, 30, 36, -13, 39, 12, -51, 4, -18, -4,
+  -30, -27, -2, 2, -2, -10, 57, -12, -5, -27, 7, 22, -17, -24, 6, -2,
+  -4, -25, 28, 37, -27, -18, -10, 61, 19, -46, -18, 27, -4, -8, 27, -34,
+  -81, -35, 52, -3, -38, 2, 7, -32, -17, 2, -4, -2, 15, -14, -22, -9,
+  90, -5, 12, 52, -18, -6, -70, 41, -36, -46, -22, -7, -5, 0, 13, -18,
+  -30, 32, 7, -22, -63, -24, -9, 21, -23, -14, -36, 51, -13, -11, 19, 41,
+  47, -47, -34, -49, 31, 0, 24, -127, -110, 39, 21, -64, 4, 13, -35, -20,
+  40, -65, 37, -46, 88, 20, 98, 66, -10, -17, -64, 5, 13, -16, -74, -45,
+  -63, -37, -89, 26, 74, 12, -28, -20, -31, 66, -120, -25, -59, 4, 52, -4,
+  -8, 36, 32, 33, 5, -109, -89, -39, -25, -17, -57, -51, -17, -8, -12, 26,
+  -28, -30, -53, -14, -17, -14, 34, -44, 24, 27, -10, -32, -20, -18, 2, -32,
+  -6, 5, 33, 15, -31, -23, 19, 52, -34, 65, 10, -2, -42, -3, -5, -36,
+  -24, -23, -9, 24, 8, -16, 14, -13, 11, 13, -36, 5, -28, 20, -13, 4,
+  -14, -14, 42, 4, 14, -19, 30, -19, -5, 25, -36, -9, -4, 0, -6, -34,
+  0, 12, -8, 51, -65, 22, 0, -3, 5, -5, 6, 11, 6, 18, 37, -20,
+  -3, 33, 25, 53, -21, 8, 2, -22, -27, 12, 32, 44, -17, 11, -5, 2,
+  -3, 5, 3, -11, -15, -35, 8, -9, 9, -9, -6, -2, -3, -15, -5, 4,
+  -11, 0, 0, 13, 26, -40, -30, -48, -11, -8, 12, 11, 4, -13, 39, 26,
+  -35, 10, 6, 6, -37, 0, -46, 19, -31, 39, -18, -5, -10, 23, -27, -25,
+  35, -3, 6, -69, -33, -20, 33, -37, -8, 22, -24, -25, 37, -73, -22, 18,
+  44, 0, 9, -2, 3, -23, 78, -15, 13, -26, 3, -12, -18, -33, -31, 2,
+  88, -66, 9, -16, -19, -36, -24, -37, -2, 17, -50, -4, -50, -42, -25, 2,
+  19, 10, -25, 4, 3, -10, -20, 22, -2, 11, 12, -16, -42, 8, 31, -34,
+  52, 28, 14, -28, 10, -27, -26, -15, -34, 24, -40, 9, -6, -30, -20, 2,
+  30, -35, -41, 30, 0, -2, -3, -20, 4, -22, -11, 0, 20, -50, 16, -26,
+  14, 5, 28, 29, -12, -45, -12, -10, 0, 41, -19, -6, 15, -29, -29, -6,
+  3, -26, -14, -3, -57, -21, -8, -4, 9, 29, -29, 28, -31, -27, 48, -32,
+  0, -55, 0, -36, 15, -43, 0, -44, 3, -19, 13, -39, 12, -56, 6, -32,
+  11, 18, 19, -14, -56, 25, 11, -22, -9, 23, -75, 24, -23, -11, -10, 31,
+  14, -29, -15, 26, 0, -46, 15, -5, 65, -62, -65, -21, 24, 17, -22, 28,
+  11, -13, 25, -13, -31, 26, 3, -4, 84, 26, -13, 7, -23, -57, -5, -79,
+  4, -55, 5, 13, 22, 0, 3, -16, -27, -50, 57, 24, -12, 11, 3, -20,
+  25, 25, -54, 50, -36, -10, 0, 5, 14, 20, -11, 9, -112, -48, -13, -41,
+  7, -24, -45, 14, -36, 34, -42, 45, 62, -2, -46, 19, 14, -31, 30, 14,
+  -17, -42, -33, 42, 4, -26, 42, -4, 46, -24, -3, 0, 0, 40, -8, 56,
+  -45, 68, 2, -7, 40, 23, -12, 16, 27, -12, 3, -27, -28, -7, -45, 40,
+  -7, 23, 57, 0, 7, -30, 0, 0, 12, 20, -14, 2, 23, -42, 17, 20,
+  -50, 29, 0, 69, 54, 6, -12, 45, 21, 10, -18, -9, 46, -55, -10, 39,
+  36, 10, -52, 3, -92, -16, 34, -50, -25, -29, -8, 66, 23, 30, 29, 3,
+  -82, 23, -20, 13, -37, -6, -57, -25, 22, 12, 0, 42, -5, 4, -22, 87,
+  -4, 86, 0, -39, 33, 0, -25, 0, 6, 14, -4, 52, -7, 62, -20, 69,
+  -57, -44, 3, 34, -6, -12, -4, -15, 15, 25, -15, -38, 35, -41, 25, -41,
+  -31, 35, 41, 3, -57, 34, 21, 25, 127, -71, -27, -17, -8, -53, 66, 18,
+  -15, 72, 5, 7, 31, -10, -21, 10, -60, -6, -8, -75, -21, 32, 19, 12,
+  -42, 63, 19, -33, -26, 56, -18, -2, -6, -9, 7, 13, -56, 67, -37, -3,
+  -21, -24, -84, 40, 9, -68, -39, 12, 36, 22, 52, 38, 84, 7, -7, -30,
+  31, 19, -8, 55, 44, 34, 8, 25, 71, -35, 13, 7, 46, -17, -13, 6,
+  63, 0, 12, 30, -28, -12, -6, -83, -8, 41, -3, -12, 0, 42, 77, 35,
+  46, -7, 57, -3, -30, -28, -7, -5, -6, -9, -22, -41, -13, -51, -3, 13,
+  -39, -29, -33, -34, -21, 49, 73, 10, -12, 7, 25, 40, -35, 34, 20, 8,
+  -11, -48, -11, 8, -84, -21, 3, 39, 84, -41, 11, -45, 15, -53, -21, -21,
+  -19, -39, 55, -33, 55, 2, -9, -13, 14, -19, 49, 15, 31, -35, -22, 3,
+  4, 38, -23, 11, -33, 0, -83, 22, -6, 11, 61, -13, 20, 6, 40, 18,
+  -50, 6, -3, 0, -9, -28, -31, 20, 62, -15, 22, -28, 5, 20, -7, 0,
+  -6, -19, 8, -13, -18, 18, 0, -32, -3, 32, -8, 52, 57, -67, 42, 24,
+  -4, 3, 52, 62, 49, -35, 66, -6, -32, 50, -5, 69, -57, 11, 54, 26,
+  -14, 29, -80, 17, -17, -25, 14, -29, 20, 43, 25, -17, -36, 20, 13, 36,
+  4, 3, -6, -11, -39, -43, -39, -7, 6, 30, -31, -14, -35, -20, -30, -19,
+  25, 58, 0, 32, 31, 3, 0, -4, 37, -9, 0, 35, 8, 0, 13, 56,
+  -56, 49, -15, -13, 6, 27, 15, -51, -41, -53, 3, -60, 7, 46, 48, 12,
+  -46, 70, -61, 11, -26, -50, 4, 29, 0, -40, 18, -4, -66, -11, -3, 33,
+  53, -18, 12, -23, -9, -55, -15, 10, -59, 17, 6, 31, -3, -7, 10, 44,
+  28, -3, -39, -22, 22, 9, -37, -27, -5, 15, -20, -11, -19, 3, 29, -20,
+  -71, 3, 10, -43, -13, 19, -5, -42, 11, 5, 2, 5, 6, -32, -11, -19,
+  0, -17, -19, -25, 25, 23, 0, -4, 7, 9, -15, -38, -41, 23, -11, 11,
+  -32, -15, 30, -9, -40, -36, -32, 8, -5, 33, -5, 33, 0, -3, 10, 16,
+  -12, 11, 2, -9, -4, -11, 56, -9, -13, 17, -29, 23, -11, 28, -11, 5,
+  -31, 16, -23, 22, 20, -24, -3, 26, -4, 13, 11, -25, 18, 26, 19, -24,
+  26, -24, 25, 21, 47, -23, 27, -6, -19, 7, 12, -23, -19, 19, 0, 13,
+  12, 2, 32, 2, -23, 31, -13, -21, 7, 0, -18, 33, 16, -31, 10, -16,
+  -25, -16, -14, 11, -33, 15, 22, -9, 5, 12, -33, 6, 21, -44, 22, -41,
+  22, -35, 2, 22, 13, 6, -10, -8, -7, 18, 36, -15, 10, 41, 16, -43,
+  15, -41, 6, 42, 14, 4, -78, -18, 24, 47, 30, -21, -38, -28, 67, 13,
+  -18, 2, 15, -14, -23, 20, 16, 0, -20, 25, 0, 6, -25, -25, -4, 27,
+  -12, 11, -7, 22, 7, -35, 26, 59, -13, 37, 2, -63, 26, -6, -4, 7,
+  -68, -5, -2, 5, -5, 6, 5, -11, 11, -47, 2, -17, -10, -47, -21, 0,
+  35, -8, 70, 5, 27, -33, 12, 30, 5, 40, -30, 23, -38, -12, -67, 36,
+  15, -32, -25, -47, -10, -15, -64, -25, -54, -8, 13, -29, -47, 51, 14, -34,
+  -25, -21, -32, 28, -36, -47, -76, -3, 28, -61, -13, -14, -68, -33, 46, -15,
+  -6, 24, -6, -65, -74, 13, -23, -126, -61, 5, 28, -87, 18, -29, -16, -2,
+  -6, 30, 79, -12, -77, -15, -12, 16, 50, -127, 36, -4, -25, -16, -95, -17,
+  -41, -68, 0, 40, -40, 3, 26, 12, -61, 52, 15, 31, 11, 93, -12, 32,
+  -25, -56, -2, 15, 0, 2, -41, -33, -5, -7, -26, 11, -26, -17, -2, 15,
+  31, -40, 12, 38, -10, -21, 18, -45, 0, -10, -13, 12, -39, 15, 53, -53,
+  76, 9, 13, 42, -38, 10, -15, 22, 17, -19, 48, -32, 33, 7, 0, -8,
+  -26, -2, 17, 12, -23, 10, -61, 2, 0, -17, 10, -8, 29, -62, 37, -2,
+  25, -24, 9, -33, 11, -17, -2, 44, -13, 63, -13, -11, -30, 6, -20, -2,
+  -62, -46, -2, -14, 15, -5, 28, -8, 18, -31, -2, -10, 24, -41, -19, -2,
+  -17, -4, 13, -2, -5, 21, 24, -10, 14, 19, 15, -16, 11, -2, -3, 15,
+  26, -10, -2, 12, -43, 15, 16, -27, 30, -31, -15, 10, -9, 0, 12, -2,
+  14, -19, 5, 15, -33, -22, -11, -41, 3, 41, -2, -11, -17, -22, 18, -2,
+  -19, 8, 14, -11, -18, 8, -23, 0, -16, 52, 15, 5, 22, -6, -37, -72,
+  6, -2, -44, -9, -3, 10, -24, 4, 24, -35, -3, -11, -55, 0, -28, 15,
+  23, 20, 55, -31, -5, 18, 10, 27, -10, 8, -5, -10, -47, -17, -31, 34,
+  16, -8, 11, 35, 29, -2, -26, -35, 13, 29, -2, -52, -21, 6, 4, 32,
+  3, 5, -58, 3, 23, -58, 20, 13, -40, 3, 0, -55, -49, -6, -29, -57,
+  15, -28, -29, 16, -19, 29, -6, 22, 24, 7, 15, 13, -25, -26, -25, -2,
+  -6, 15, 32, 17, 65, 66, 16, 0, 0, 6, 33, -4, -13, -54, 31, 18,
+  40, -65, -89, 3, -11, 56, -53, -90, 11, -28, -54, -37, -6, -8, 73, -14,
+  58, 82, -27, 71, -26, -9, -51, -34, 3, 26, 28, 29, -9, -51, -31, 28,
+  -42, -16, 18, 30, -16, 85, -26, 29, 14, 20, -73, -21, 28, 47, 36, 18,
+  -55, -32, -22, -7, -18, 37, 74, 9, 25, 9, -48, -31, 13, 4, -27, -43,
+  -17, -81, 16, -79, 69, 31, 16, -43, -15, -35, -54, -8, 22, 20, 3, -18,
+  9, -63, -6, -75, 66, 7, -40, 46, 7, 38, 31, -43, -3, 30, 50, -14,
+  -59, -30, -46, -57, 0, 27, -30, 29, -24, 10, -73, -29, 40, -10, 97, -25,
+  -64, -4, 7, -28, 22, -4, 9, -42, -14, 12, -63, 14, 7, -16, -39, -23,
+  17, -8, -33, -9, 37, -13, 13, -39, -7, -39, -77, 12, -3, 36, 32, 42,
+  -31, 66, -9, -43, 0, 14, -15, 15, 20, 0, 12, -32, 9, 4, 4, -38,
+  -17, 16, -32, 27, -8, 9, 30, 23, 38, -10, -26, 5, -32, -14, 56, -21,
+  -4, -49, -29, 34, -15, -26, 56, 39, -46, -33, -30, 20, 23, 16, 18, -20,
+  40, -69, -33, 54, -5, -28, -25, 34, 11, -7, -73, 87, -31, -20, 3, 39,
+  27, -16, 33, 4, 7, 16, -44, -11, -59, -49, 34, 40, -9, 72, -23, -28,
+  17, -19, 9, 40, 4, 27, -57, 23, -10, -55, -65, 16, 20, 10, 85, 21,
+  -4, 4, -14, -31, -83, 63, 5, 18, -25, -21, 11, 46, -36, -8, 12, 10,
+  54, -35, 3, 38, -48, 56, -25, -9, -60, -7, 54, 17, -3, -92, -13, 7,
+  -9, -31, -45, 12, 107, -84, 47, 88, -13, 34, 6, -119, 0, 0, -4, 24,
+  38, -65, -64, 37, 36, -9, 83, -6, 73, 0, -4, -44, -87, 44, 77, 15,
+  102, -78, -68, -100, 4, 52, -83, 15, 39, 0, -18, -20, 33, -33, -39, 73,
+  23, 62, 0, 32, 53, 56, -75, -21, 4, -7, -16, -4, -28, 32, -16, -28,
+  22, -39, -48, -20, -59, -42, -58, -38, -10, 75, -22, -18, 14, -42, 88, 24,
+  76, 19, 87, 13, -8, -21, 61, 20, -21, -20, -65, -31, 8, -27, 44, -15,
+  9, -18, -58, -28, -7, -33, 37, -39, -50, 30, 0, 3, 16, -33, -18, 23,
+  -13, 38, -33, 3, -37, -38, 38, -51, 45, 4, 6, 21, 46, -84, -10, 14,
+  -49, -16, 21, -28, -22, -40, -33, -23, 36, 11, 34, -32, -34, 21, 50, -49,
+  -30, 5, 18, 17, -28, 6, -43, 6, -52, 78, 22, -55, -12, -3, 52, -12,
+  -13, -14, 50, -7, -47, 4, 9, 12, 29, -15, -18, 11, -23, 61, -6, -20,
+  44, 8, 23, 0, 58, -47, 16, -17, -7, 39, -45, -8, 28, -28, -3, -39,
+  -4, -55, -6, -126, -30, -9, -25, -15, 16, -79, 9, -11, -28, 8, -19, -52,
+  -72, 27, 0, -20, -48, 58, 35, -29, 42, 34, -69, 3, -75, -3, 24, 49,
+  -30, -28, -47, -34, -127, 59, 14, -27, 61, 27, 81, -37, -62, 33, 9, -60,
+  -54, -58, 59, 9, 11, -16, 28, -13, 71, 32, 51, -17, -68, -60, -13, -18,
+  -27, 12, -39, 8, 18, 19, -62, 0, 10, 4, 6, -32, 17, -8, 58, 3,
+  -118, 35, 37, 27, 52, 9, 91, -29, -28, -31, 22, 16, 95, -101, -105, 9,
+  -51, -21, 0, -31, 7, 30, 32, 24, 50, 21, 7, 6, 10, -33, 15, -23,
+  27, 36, 55, 16, -4, 18, -38, 19, -11, -23, 12, 12, -20, 17, 9, -23,
+  -3, 37, 11, 17, -45, -8, -50, 28, 19, 24, 27, 39, -10, -52, 25, -18,
+  79, 2, 3, 27, -20, 11, -9, 19, 33, 32, 12, 24, 49, -10, -6, 11,
+  18, 26, 0, -15, 39, 37, 33, 22, 10, -9, 67, 0, 7, 12, 13, 17,
+  7, 17, 7, -25, 46, 0, -32, 12, -5, -3, 0, 27, -4, -9, 7, 41,
+  0, 17, 33, 28, 24, 25, 24, -22, -49, 8, -29, -18, -19, -64, 6, -43,
+  73, -10, -10, 41, 23, -4, 9, -10, -15, -2, -12, -21, 37, 0, -18, -22,
+  37, 18, -10, -7, 16, 3, 10, 22, 21, 7, 27, -6, -2, 15, 24, 5,
+  5, -3, -7, 32, -38, -16, 20, -9, 22, 15, -18, 0, 34, -14, -2, -13,
+  39, 17, 22, 23, -13, 12, 42, -14, 14, 8, 4, -18, -6, -46, 8, 20,
+  -15, 35, -33, 5, -20, 11, 16, 19, 5, 25, 16, 11, 23, 37, 20, -7,
+  43, 20, 29, -72, 50, 5, -13, 20, -34, 11, -8, 29, -14, 21, -22, 14,
+  53, 6, 0, -27, -76, 27, -16, -50, -8, 0, 9, 33, 4, 3, -9, -13,
+  0, 20, 11, -83, 5, 29, -21, 36, -31, 46, -2, 0, 31, -15, 6, 18,
+  -27, -4, 17, 22, 20, 13, 6, -33, 18, -62, -50, -4, 14, -20, 55, -11,
+  -28, 43, 10, -2, 37, 21, 47, 9, -36, 4, -24, -8, 2, 3, 4, -14,
+  -39, 36, 9, 34, 0, 52, 38, 62, 89, 26, -5, -75, -16, -32, -48, 13,
+  -23, 54, -41, -20, -59, -25, -39, 80, -127, -24, 9, 10, -70, 3, 8, -25,
+  -49, -22, -23, -2, -20, -9, -38, -42, 13, 64, -25, -8, -26, -42, -79, -4,
+  46, -20, -55, 20, -71, 13, -40, -13, -23, 13, 3, -8, 12, -77, -4, 43,
+  53, 6, -17, -14, -31, -9, 23, -19, 0, 8, -2, -33, -18, -29, 2, -15,
+  13, -11, 7, -34, -11, 5, -18, 11, -7, -41, 18, -21, 33, 31, -6, -45,
+  15, 10, 0, -10, 37, -26, -35, -19, -25, -20, -3, -23, 23, 12, -26, 22,
+  -58, -23, -16, 17, 13, 24, 3, 15, 18, 15, -32, 16, -12, -12, 0, 24,
+  -29, 8, -5, -39, 4, 25, -20, -3, -8, 38, 28, 57, 20, -26, -23, 0,
+  -29, 0, 9, 9, -35, -15, 34, 14, -26, -14, -2, 0, -16, -9, -42, -33,
+  34, -2, 23, -12, 3, 18, -79, 4, -25, -37, -37, 8, 23, -44, -44, 7,
+  -37, -28, 47, -5, -37, 35, -27, -26, -28, 9, -11, -27, 14, -30, -24, 0,
+  -29, 33, -33, 50, -38, -29, -14, 40, -62, 10, 21, 12, 0, -38, 53, 56,
+  0, -14, -30, -28, -45, -12, 105, -55, -26, 52, 2, -29, -37, 61, -17, -33,
+  -18, -8, -47, 0, 20, -2, 69, 35, -45, -35, 3, -6, -20, -81, -96, -33,
+  -3, 28, 78, -22, 52, -3, 67, 17, -10, -20, -11, 27, -31, -3, 33, -55,
+  2, -6, 0, 21, -8, -14, -5, 12, 30, 13, -30, -3, -27, 6, -23, 31,
+  42, 20, 11, 31, -45, 2, 42, -11, -73, -11, -36, 5, -6, -15, -36, 30,
+  -6, -4, -27, -34, -29, 26, -6, 33, 18, -5, 0, -19, -57, 2, -35, 7,
+  15, -43, 3, 12, -45, 8, 0, -7, -54, 17, -5, 66, -33, 44, 13, 29,
+  14, 23, -6, -41, -27, -5, 11, -18, -19, -27, -60, -29, 32, 21, 0, -49,
+  19, -3, 36, 3, 48, -20, 6, -13, -3, 13, -11, -43, -5, 33, 23, -12,
+  -18, 9, 59, -26, 14, 31, -22, 5, 54, 35, -30, 7, -44, 70, 38, 5,
+  -33, 6, 102, 53, -56, -10, 20, -39, -18, 18, 44, 20, 17, 53, -36, -28,
+  26, 13, 8, -46, -68, -8, 5, 74, -45, -49, -36, -11, -29, 24, -8, 0,
+  58, 0, -49, 64, 29, -4, 37, -20, -34, 23, 21, -25, 15, 11, -56, 6,
+  22, 0, 95, -12, 10, 31, -37, 2, 0, -6, -19, 16, -20, 3, 3, 11,
+  -15, -39, 12, -12, 28, -48, -12, -13, 25, 13, -38, -7, -17, 14, 5, -6,
+  3, 56, -31, 22, -14, 24, -16, -26, -32, 18, -41, -11, 43, -21, 36, -30,
+  23, -34, -23, 47, 32, -12, -19, -62, -20, 13, 19, 15, 7, -15, 36, -36,
+  -44, -21, -4, -14, 14, 34, -11, 27, 39, -12, 22, 9, 68, 64, 55, 18,
+  -26, 6, -25, 0, -19, 16, -12, 13, -37, -3, 10, -7, -20, 56, -10, 17,
+  37, 0, 25, 27, -73, -13, -8, -29, 3, -6, 8, 43, -8, -41, 38, -9,
+  -35, -44, 41, -61, 6, 18, -31, 13, -36, -113, 0, -19, -7, 36, -40, 24,
+  33, 40, 51, 12, -41, -10, -34, -27, 45, 12, 52, 40, 102, 20, 0, -21,
+  -22, -9, -15, -62, 37, -63, 48, 15, 25, -3, -51, 29, -25, 39, 15, 31,
+  -3, -60, -25, -19, -118, -43, -48, -70, -22, 76, 60, -43, -5, 17, -44, 27,
+  104, 20, -26, -24, 44, -4, -56, -16, -56, 52, 29, 12, 39, -51, -79, 0,
+  -127, -19, -43, -6, 41, -42, -49, -12, -21, 38, 0, 4, 34, -90, -55, 18,
+  -33, -109, -25, 15, 109, -13, 16, -39, -15, -39, -41, 20, -115, 11, 5, 20,
+  -72, 33, 11, -62, 36, 24, -59, -26, 13, -33, -27, 7, 8, -24, -38, -43,
+  -12, 34, -5, -20, -70, -14, -22, 23, 0, 16, -21, 3, -76, 76, 0, -27,
+  -18, 37, -47, -32, -48, 78, 4, -15, -45, -23, 7, 9, 44, 23, 10, -32,
+  -11, -3, 3, -33, 9, 10, -16, -46, -6, -21, 6, 2, 59, -60, 18, -51,
+  29, -10, -6, -38, 59, 3, -11, 81, 48, 39, 5, -25, -43, 31, -16, -24,
+  -23, -7, -31, -14, -25, 22, 9, -39, 14, 23, 32, 65, 7, -40, -43, -27,
+  15, 0, 28, -29, 7, 52, 19, -40, 33, 0, -33, 31, 7, -20, 62, -24,
+  37, -15, -49, -18, -3, 0, -8, 28, -37, 10, 13, -17, -22, 14, 13, -11,
+  0, -10, 8, -57, -27, -38, 30, 4, -32, -9, -55, -32, -5, 45, -25, -30,
+  104, -13, 21, -24, -25, -2, -22, -10, 6, 32, 40, -15, 49, -11, -76, 6,
+  51, 9, -55, 20, 3, -3, -49, 7, -63, -26, 85, 29, 20, -3, -35, -11,
+  58, -33, 62, -3, -3, 13, -76, -13, 0, 10, -16, -34, 25, -28, -41, -9,
+  20, 13, -68, -16, -14, 35, -40, 4, 29, 3, 14, -14, -16, -3, -14, -67,
+  15, -17, -41, 3, -86, 0, 72, 13, 3, -32, 0, 31, 7, -40, -33, 27,
+  15, -33, -51, 6, -14, -8, -15, -15, 12, -62, -4, -9, -20, -3, 52, -5,
+  11, -6, 37, -35, -28, 51, 4, -31, -3, 13, -16, -2, 3, -11, -3, -14,
+  0, -55, -30, -16, 8, -13, 7, -52, 27, -28, -18, 92, 22, 17, 14, 3,
+  22, 6, -21, -25, -11, -7, -47, -38, -40, 19, 11, 8, 0, 6, -44, 27,
+  -15, 19, -26, -24, -6, 46, -3, 0, 25, 19, -19, 26, -43, -12, 37, -53,
+  0, 3, -15, 2, -34, 5, 7, 2, -46, 15, 11, 10, 28, -15, -6, 43,
+  22, -16, 23, 32, 26, -13, -25, -49, 0, -20, -5, -3, -2, -6, -43, -18,
+  19, 28, 43, 68, -45, -42, 23, -44, 2, -35, -4, 0, 2, 30, 27, 35,
+  -36, 10, 49, 24, -6, 2, -12, -12, 20, -7, -15, -22, 14, -2, -98, -15,
+  55, -13, 49, 25, 13, 13, 36, 11, -38, -13, 47, -6, -12, -9, 17, 26,
+  -5, -69, -33, 23, -34, -45, -22, -46, -11, -15, -36, -27, 13, 0, 14, 28,
+  29, -3, 66, -25, -50, -13, 34, -38, -53, -5, -13, -36, -20, 18, 19, 15,
+  -69, -8, -43, -14, 20, 15, -25, -2, -37, 5, -28, -9, -37, 27, -9, -11,
+  70, -66, 3, 66, -5, 40, 10, -19, 25, -4, -45, 4, 0, 3, 24, -38,
+  24, 25, 21, 16, 60, -20, -40, -37, 8, -5, 0, 3, -29, -43, -18, -53,
+  26, 45, -11, -45, 3, 2, -13, -22, -26, 70, -38, -80, -2, -9, 27, 60,
+  -72, 4, -10, -29, -43, 11, -50, 29, -15, -17, -25, -20, 3, 41, -20, 53,
+  -79, 0, 33, 15, -10, -32, 40, 39, -33, 24, 40, -39, -65, 3, 28, -43,
+  -57, 77, 49, 41, -8, -16, 54, 52, 66, -68, -18, 15, -29, -11, -39, -3,
+  6, 22, -2, -93, 34, -50, -127, -33, -14, -48, 22, -18, -37, 87, 8, -17,
+  6, -2, 7, -12, -65, 22, 25, 19, -119, 17, -3, -20, -11, 14, -20, -11,
+  -30, 10, -23, 32, 5, -18, -23, 45, 69, -62, 18, 4, 14, 61, -60, -109,
+  -7, -27, -14, 56, -68, -22, 11, -31, -5, -5, -14, 21, 38, 17, 30, 13,
+  -10, 8, -36, -6, 21, -47, 5, 3, -44, -5, -9, -39, -18, 9, 47, -40,
+  27, 2, -69, 5, -20, -9, 71, 4, 10, 12, -22, -52, -17, 29, -43, -4,
+  -9, 48, -8, -44, -10, -3, -50, 39, -18, 26, -16, 2, -53, 15, -6, 24,
+  -10, 0, -23, -11, 19, -11, -9, 64, -8, -33, -32, 18, 13, 6, -11, -15,
+  6, 36, -36, -48, 0, 2, 10, 8, 5, 51, 11, -15, -12, -42, -5, 17,
+  51, -12, 7, 22, -3, -37, -19, 19, -5, -5, 22, -30, -23, -17, 29, -24,
+  -3, -38, 3, 12, -47, -16, -43, -41, -87, 15, 21, -2, -40, 32, 21, -12,
+  -22, -38, -9, 38, -57, 7, -25, -43, -11, -20, -48, -27, 20, -40, 23, 10,
+  3, 31, -26, -6, -11, -3, -8, 5, 56, 24, 13, -21, 6, 9, -14, 22,
+  -42, -19, 13, -36, 3, 22, 31, -6, 0, 7, 12, -20, -17, -48, 12, 0,
+  12, 20, 64, 34, 47, 5, 63, 26, -31, -39, 5, 35, 35, 29, 15, 0,
+  24, 5, -33, -16, 68, -7, 56, 40, -11, -10, -84, -3, -18, 43, 2, -20,
+  6, 45, 2, 23, -37, -2, 75, -5, 19, -13, 20, -21, 6, 18, -8, -5,
+  39, -35, -36, -38, -9, 7, 6, -4, 12, 37, -46, -13, -3, 39, -3, 18,
+  49, -45, -21, -2, -34, -5, 69, -17, -23, -24, 37, 18, -21, 59, 51, -19,
+  73, -16, 7, -20, -66, 19, -10, 89, 38, -15, -49, 13, 6, 95, 7, 15,
+  28, 113, -34, 16, -88, -24, 11, -28, -30, 23, 61, -7, -6, 31, -4, 50,
+  79, 34, -57, 48, 21, 44, 31, -27, 43, 7, 80, 0, -4, -7, 8, 48,
+  -35, -11, -26, -25, 52, -31, 53, 34, -26, 56, -11, 24, 3, -13, 9, -24,
+  31, 40, -7, -62, -33, 3, -36, -27, 0, -4, -49, -52, -6, -12, -76, -26,
+  55, 40, 34, 24, 4, 5, -19, 12, -20, -12, -6, -11, -15, 22, -32, -14,
+  0, 0, 81, -48, 74, -13, -13, 0, 54, 0, -13, 24, -37, -28, 42, -16,
+  35, -4, -7, -53, 56, 11, 81, 0, -4, 25, 0, -21, 24, -34, 31, 10,
+  38, 4, -112, 69, 27, 6, -42, -18, -8, -7, -33, -52, 26, 83, 33, 33,
+  14, 24, -19, 16, -19, 29, -11, -51, 7, 16, -29, 19, -41, -26, -28, -29,
+  65, -25, -14, 35, 4, -25, 31, 45, -22, -28, 58, 5, 8, 42, -38, -25,
+  0, -18, 52, -117, 79, -34, 72, 43, -66, 56, -76, 18, -54, -17, 40, -17,
+  -21, 16, -41, 85, 66, -36, -23, 80, 50, -15, -63, 56, -51, 12, -3, 44,
+  0, 0, -65, -16, 0, -5, -109, -67, 50, -27, -48, 15, 26, -100, -24, -54,
+  -52, 39, 90, 14, 37, 16, 76, -24, -4, 7, 45, -19, 21, -17, -8, 41,
+  -26, 51, -22, 18, 0, -27, 0, 65, 26, 47, 15, -15, -3, 76, 34, -38,
+  24, -52, 98, -33, -93, -39, 6, -93, 46, -47, 13, -90, -3, -46, 13, 7,
+  18, -20, 12, -86, 8, 7, 86, 75, 37, 62, -22, -111, -47, 79, 119, -54,
+  -118, 0, -43, 10, -25, 6, -49, -59, -83, 53, -71, -19, 94, 3, 17, 29,
+  -9, 73, -26, -78, -52, -23, 14, 9, -99, 28, -15, 18, 7, 8, -31, -86,
+  -7, 0, -37, 7, 60, -61, 65, 53, 23, -4, -7, -52, -32, -25, 86, -18,
+  -32, -8, -37, 110, 4, 19, -7, -8, 97, 58, 26, -7, 24, 35, 60, 25,
+  -109, 0, 67, -55, 21, -13, -40, 0, -32, 85, -76, -5, 4, -31, 25, -10,
+  -62, -15, -4, 82, 0, -46, -29, -56, -77, -19, 31, 32, 34, 127, 25, 45,
+  -41, -44, 7, -16, 16, 26, 45, -22, -42, 29, 16, -17, 32, -37, -109, -66,
+  -116, -8, -40, 29, -38, -5, 64, -8, -24, 81, 22, 15, 6, -17, -76, 4,
+  -35, -28, -33, 41, 21, 31, -72, -33, -14, 7, -13, 0, -21, -38, -25, -25,
+  31, -4, 78, 7, -37, -53, -14, -34, -11, -3, -34, -32, -47, 8, 40, 27,
+  -100, -24, -10, -16, 98, 0, 61, -4, -19, 37, -66, -21, 35, -46, -16, 18,
+  28, 8, 9, 98, 38, 27, 30, -35, 64, 58, 0, -11, -41, -22, -12, -61,
+  57, -51, -24, 73, 21, -41, 81, 24, 47, 109, -13, -16, 57, -7, 8, -19,
+  13, -29, -11, 64, 11, -61, -19, -9, 26, 40, 42, -3, -47, 38, 28, 21,
+  69, -60, 37, 46, 33, 6, 55, -44, 23, 37, 33, 0, -42, -4, -10, 77,
+  -28, 113, -43, 16, 27, 107, -41, -55, -40, 8, -16, -11, 32, 9, 40, 47,
+  -87, 20, 90, 7, 0, -31, -54, 27, 90, -70, 27, 13, -8, -98, -63, -25,
+  -44, 18, -41, 25, 4, 38, 72, 56, -15, 22, 11, -29, 57, 38, 22, 75,
+  12, -14, -18, 31, 43, -3, -34, 4, 67, -38, 17, -49, -20, -25, -23, -26,
+  28, 99, -24, -43, -10, -17, -33, 0, 15, -24, -36, 33, -39, -42, -10, -9,
+  -38, 7, -37, 24, 14, -16, -75, -10, 53, 43, 20, -23, 11, -9, 15, 8,
+  0, -3, -7, 65, -20, -23, 92, 27, -29, 35, 13, 28, -79, -41, 35, 27,
+  6, -38, -6, -23, 29, 45, 23, -58, -37, 0, -20, 8, -14, -18, -52, 29,
+  8, -21, 14, 18, 67, -6, -49, 14, -38, -78, -67, 16, -5, -23, -101, 35,
+  -53, -42, -87, 42, 97, -30, -28, -57, 3, -83, -16, -19, -22, 6, -33, -39,
+  81, -13, -16, -25, 3, -3, 88, 16, 42, 8, 10, 10, 15, -122, -16, 21,
+  6, -3, -3, 11, 5, 45, -14, -58, -20, 19, -9, -53, 20, -29, -52, 10,
+  -49, -25, 0, 11, -40, -15, 0, -7, 29, 27, -84, -36, -41, 19, -38, 31,
+  53, -44, -21, 51, 18, -8, -43, -23, 31, -25, -78, -45, -25, 49, -15, -39,
+  27, -54, 10, 9, -26, 40, 29, -41, -23, 43, -30, -46, 35, -26, -19, 30,
+  6, -3, -51, 6, 96, -23, -23, 66, 13, -35, -46, 34, -25, 14, -55, -3,
+  -40, -64, -27, -36, -13, -25, 0, 24, 47, 61, -6, 10, 57, 73, 3, 28,
+  -8, 5, 17, -82, -54, -38, -16, -23, -19, -12, -51, -23, -18, -24, 47, -17,
+  42, 6, 16, 37, -36, -7, 63, 16, -29, -22, 57, -33, -32, -48, -8, -6,
+  -67, 45, -95, -23, -100, 37, -25, 16, -91, 26, -23, 79, -14, 40, 20, 3,
+  -16, 18, -38, 0, 23, -25, 13, 45, -24, -54, 28, -33, 21, -57, 73, 16,
+  -38, 7, 87, -24, -14, -47, -63, -18, -50, 3, 39, -21, 0, -86, -40, 31,
+  -38, -22, -29, 72, 49, -23, 0, 5, -84, 22, 20, -36, -35, -67, -38, -15,
+  27, 35, 21, 26, 38, 8, -45, 35, 24, -74, 40, 8, 34, 0, -17, -48,
+  -69, 39, -92, 11, -73, -62, -59, -7, -50, 24, 6, -81, 3, 11, -24, 107,
+  8, -7, 8, -106, 14, -77, -59, 3, 31, -96, 12, -7, 22, -28, -69, 31,
+  19, -51, -59, 16, 10, -37, -17, 8, -97, -3, -27, 18, -21, -56, 57, 36,
+  -67, 3, 45, -9, 14, -45, -37, -27, 3, 13, 58, -49, 11, -14, 23, -42,
+  -32, -11, 22, 4, -50, 17, 7, 100, -26, -37, 11, -55, -59, 8, 28, -3,
+  -88, 25, 8, 39, -47, 25, 59, 10, -53, -9, -35, 14, -7, -73, 7, -8,
+  8, 35, -13, -78, -46, 67, -4, -38, 6, -5, -7, 21, -26, -93, 24, 18,
+  -15, -84, -68, 91, 19, 3, -20, -62, -10, 6, -32, -4, 25, 33, 14, -51,
+  -12, 50, 16, 64, -53, -17, 53, -17, 32, 85, 50, 20, -67, -19, 63, 6,
+  73, -39, 71, 82, 97, 38, -8, 13, 6, -99, 35, -5, 14, 55, 47, -61,
+  -127, -16, 68, -31, -7, -70, -4, -38, -48, 84, -90, -5, -97, 37, 41, 33,
+  18, 3, 9, 20, 10, -40, -25, 78, -3, -3, -17, 38, -42, -14, -95, 109,
+  -49, 11, -14, 21, 7, -6, 10, -14, 12, -65, 56, 0, -36, 19, 31, 19,
+  -73, 37, 33, -24, -25, -16, 16, -18, -28, 22, 12, 2, -40, -73, -77, 67,
+  -115, 16, -26, -65, -16, -17, -42, 43, 13, 3, -3, 13, -38, 7, 24, -48,
+  -16, -56, 8, 12, -52, 21, -13, 16, -11, 37, -18, -33, -8, 20, -23, -9,
+  19, -2, 5, 26, 38, 1, -13, -21, -10, 41, 19, 44, -9, -13, 23, -25,
+  15, 23, 3, -16, -15, 6, 11, 18, 4, -31, 18, 22, 7, 4, 0, -21,
+  -34, -6, -2, -4, 7, 9, 45, -29, -15, -4, 5, 3, 0, -20, 20, -22,
+  41, -14, -28, -31, -16, 13, 23, -10, 0, -17, -35, 36, -13, 17, -6, -26,
+  8, -17, 2, -12, 5, -24, -18, -63, 0, -34, -6, -2, 21, -57, -47, -17,
+  -15, -15, -14, 16, 5, -31, 0, 2, 17, 25, -50, -3, -31, 33, -7, -37,
+  0, -11, -26, -2, -49, 0, 31, -20, 7, 4, -56, -14, -16, -12, 29, -8,
+  -27, -9, -14, -27, -3, -6, -15, -18, -9, 22, -16, 18, -21, 41, 29, -30,
+  19, -2, -11, -12, 20, -1, -38, -33, -54, -23, 23, 18, 16, -3, -14, 0,
+  23, 5, -3, 12, -34, 0, -19, -9, 0, -33, 5, -5, -39, -33, 25, 4,
+  49, -17, -4, 6, -20, -7, -3, -33, -7, -9, -18, -19, -14, 7, 2, 2,
+  -35, 0, -4, 6, -10, 15, -2, -3, 2, 22, 16, -18, -38, -5, -12, -30,
+  0, -17, -18, -5, -27, -24, -31, -21, 14, -21, -32, -15, -12, -5, -47, 19,
+  10, 17, -3, 16, 41, -7, -29, 39, 42, -2, 0, 6, -36, -47, -39, -9,
+  13, -22, -29, -40, -24, 20, 17, 22, -11, -11, -36, 35, -8, 27, 26, -38,
+  -20, 0, -36, -33, -10, -25, -8, -118, -64, -22, -25, -18, -17, 49, 41, 28,
+  0, -21, 51, -26, 14, 7, 24, -26, -44, -7, -9, 9, 42, -15, -89, -8,
+  -33, 0, -31, -2, -10, -20, -45, -96, -61, -31, 21, 14, -7, -29, -84, -47,
+  26, -2, 18, 38, 15, -7, 127, -5, -28, -59, 23, 40, 14, 40, -33, -55,
+  -2, 5, -24, -4, 26, -31, -6, 34, 16, -2, 10, 36, 8, -24, 39, -39,
+  22, 43, -4, -41, -63, -39, 9, -44, -36, 11, 0, -44, -10, 3, 7, 4,
+  10, -3, -70, -14, 12, -39, -5, 18, 32, -27, -26, -49, -51, 19, 7, -2,
+  10, -34, 29, 6, -38, -16, -65, -18, -17, 9, -14, -14, -26, -67, -16, -10,
+  16, -21, -6, 29, -29, -4, 15, 5, -41, -2, -12, -30, -36, -5, 14, -26,
+  30, -10, 22, -5, 14, -23, -11, -19, -59, -5, -8, -31, 17, 18, -38, 6,
+  -33, -27, -70, 14, -2, 9, -11, 12, -19, -25, 5, -5, 0, 31, 5, -19,
+  -21, 13, 22, -27, -18, 20, -3, 16, -22, -26, 11, 3, -26, -17, -18, -10,
+  -12, 12, -10, 4, 52, -27, -25, 0, 0, 30, -8, 5, -28, -15, 35, 34,
+  14, 14, 31, 17, -29, -13, 29, 19, -2, 14, -6, -2, -24, 33, -33, 2,
+  -3, -15, 45, -24, 24, 24, 16, -16, -42, -21, -34, 14, 12, 6, -22, 24,
+  36, -9, -18, 25, 22, -32, -62, -20, -28, -15, -9, -12, 6, -52, -2, -2,
+  -6, 26, -26, -15, 3, 4, 6, -24, 0, -19, -39, -18, -8, -5, 21, 17,
+  11, 12, 15, 12, -27, 11, -18, 42, -10, 7, 25, -13, -7, 18, 28, -25,
+  13, -2, 39, -8, -10, -2, -5, -16, 6, 12, 16, 8, -34, 12, 15, 6,
+  -34, -24, -7, 13, 38, 7, 11, -15, -20, 11, 25, -29, -18, -12, -16, 2,
+  9, 3, -26, 34, 14, -44, -36, 15, 76, 13, 11, 30, 5, -28, 31, -22,
+  -71, -3, 45, 38, -29, 2, -51, -44, -26, -27, 11, 3, 8, -4, -14, -3,
+  -45, 0, -12, -27, 39, 5, -8, 26, -18, 24, -50, -2, -67, 3, -57, 3,
+  -26, -38, 35, -18, -42, 33, -16, 5, 32, 5, 36, -43, -40, 11, -16, -38,
+  -18, -10, -50, 45, 9, -14, 33, -11, -10, -16, 17, 0, 0, -7, -25, 66,
+  32, -7, -19, 56, 36, -4, 35, 30, -9, -50, 3, -13, 20, -22, -17, 6,
+  -4, -31, 29, 30, -56, 13, 42, 28, -95, 27, -8, 0, -14, -6, -21, 11,
+  -30, 56, 26, 0, 16, -29, -4, -29, 3, -19, -33, 0, 0, 47, 32, -32,
+  30, 3, 23, 34, -80, -8, 42, 15, -3, -47, -34, 7, 8, -7, 34, 41,
+  60, 21, 48, -7, 98, 0, -19, 3, 20, -20, -3, 13, -3, 11, 55, -68,
+  -4, -14, 20, -3, -99, 38, -8, -26, 0, 88, -34, 12, -60, 21, -32, -35,
+  -38, 3, 38, 18, 13, 62, -25, 3, -41, -5, 3, -3, 23, 18, -37, -12,
+  65, 27, 23, 11, 5, -22, 11, 46, 13, 75, 8, -41, 14, -43, 11, -22,
+  4, -7, 16, -24, 0, -17, -23, -30, -35, -40, 36, -10, -8, 22, -20, 15,
+  79, 2, -29, 36, 4, 27, 8, -5, -25, 48, 11, -58, 21, 45, -39, 33,
+  -4, 6, -3, -6, 64, 26, -53, 0, -38, 0, -16, -3, -17, 25, 21, -12,
+  59, -10, -47, -8, 23, -28, -117, -122, -83, 0, 11, 55, 3, -32, 25, 44,
+  -20, -14, -45, -105, -23, -6, 26, -98, -9, 80, -19, -99, -5, 41, -31, -9,
+  -22, -46, -24, -56, -14, 0, 93, -41, 95, -127, -15, -28, -60, 6, -11, -52,
+  57, -107, -45, 64, -55, 0, -62, 11, -16, 59, -62, -81, 6, 84, -29, 76,
+  -36, -48, -12, -36, -84, -8, -78, -30, 10, -16, -34, -4, 8, -36, 23, -28,
+  52, -80, 21, -21, -23, -75, 3, -81, 14, 97, 3, 0, -33, -37, 89, -28,
+  37, -12, 53, 50, -49, -11, -4, 0, 59, -51, -4, -46, 32, 24, 18, -41,
+  -49, -22, 32, -12, -26, -36, -8, -8, 16, 27, -7, 28, 46, 4, -5, -32,
+  77, 34, -15, -45, -56, -19, -31, -4, 10, 22, 45, -15, -38, 18, 23, 16,
+  -40, 3, 11, -7, 16, 8, -3, -61, 20, -7, -22, -6, 15, 22, -72, 22,
+  -4, -5, 33, 47, 4, -13, 8, 0, 15, 3, -23, -18, -21, -18, 32, -5,
+  -23, 28, 0, 9, 3, -13, -16, -27, -25, 0, 7, 5, -9, 18, 13, 18,
+  -9, 72, -15, -25, -23, -19, 33, 27, -13, -66, -3, 4, 38, 11, 40, 19,
+  0, -14, -53, -42, 20, -2, -42, 3, 23, 10, -49, -16, -5, -15, -41, -25,
+  30, 24, -57, 39, -11, 13, 19, -33, 3, 60, 23, -16, -78, 0, -18, -19,
+  23, 3, 48, -40, -71, -46, -103, 51, 32, 21, 43, 8, -40, 25, 5, 15,
+  -6, 51, -35, -17, -84, -22, 14, -4, -30, 53, -62, -18, -25, -4, 34, 6,
+  16, 7, -8, -10, 0, -40, 71, -51, -14, -60, -14, -6, -33, -71, -65, -31,
+  109, 12, -4, -36, -42, 40, -12, 8, -25, 33, 11, 44, -14, 6, -47, 8,
+  -38, 38, 26, 31, -13, -3, -25, 32, -6, -3, 7, 45, 38, -22, -21, 18,
+  -32, 10, -31, 85, 18, -27, 22, 52, 3, -18, -3, -29, 35, 7, 22, -43,
+  -19, 24, 13, 72, 3, -35, -25, -17, -14, 26, 3, -6, -17, -44, 3, -12,
+  -15, -19, 80, 26, -45, -19, -114, 20, 27, -24, 71, -18, 35, 12, 35, 11,
+  -15, 0, -69, -36, 35, -13, 12, -31, -25, 39, -13, -27, -31, -54, -44, 35,
+  -50, 3, -63, 6, 18, 16, -63, -45, 29, -3, 3, 15, -49, 3, -39, -12,
+  58, 0, 13, -55, 55, 14, -6, 30, 11, -29, 5, 66, -22, -22, -50, -18,
+  18, 5, 96, 6, -7, 34, -4, 3, 0, -24, 45, -34, 76, -65, -35, 5,
+  -22, 34, -66, -72, 32, -6, -20, 34, -28, -39, 19, 40, -26, 36, -24, -23,
+  23, 20, -31, -6, 46, -19, -38, -90, 3, 55, -3, -7, -8, -17, 42, 65,
+  105, -34, 13, -55, 0, -22, 32, 40, 65, 65, -65, 25, -2, -29, -7, -15,
+  -18, 0, -20, -35, -45, -16, -11, -40, -21, -12, -19, -9, 38, -12, -53, -11,
+  85, 46, 3, -63, -13, -3, 4, 21, 59, 18, 23, -25, -51, -50, -29, 38,
+  20, -37, -37, 25, -14, -74, -8, -90, 32, -28, 39, 7, 49, 14, 22, 18,
+  19, -31, 73, 24, -13, -25, 13, 13, -17, -92, 22, 13, -25, 0, 7, 39,
+  -44, 17, -28, -20, 66, 32, -38, 15, 58, -27, 64, 7, 17, 35, 77, 0,
+  -67, 15, -56, -3, 57, 58, -16, -31, -12, 55, -39, -10, 48, -21, 0, -35,
+  -15, 47, 46, 33, -32, 5, 5, -52, -42, -28, -58, 73, 11, 38, 17, 15,
+  -31, -55, -18, -34, 6, -10, -9, -43, -26, -23, 57, 53, -2, -15, 54, -6,
+  -103, 9, -48, -64, -17, 11, 8, 28, -70, -21, 38, 23, 17, 18, -39, 5,
+  -70, 40, -6, -24, 3, 32, 12, 13, 9, -16, 39, 67, 43, 43, 44, -49,
+  23, -27, 34, 61, 97, -33, -52, 11, 65, -40, -8, 18, 22, -101, 36, -43,
+  39, -3, -39, -10, 26, -22, 16, 7, 40, 7, 16, -38, 7, 29, -20, 94,
+  -26, 9, 4, -18, -35, 16, -49, 13, 48, -12, 8, 27, -62, 35, -4, 45,
+  -52, -15, -47, -69, 3, -32, 0, 26, -3, 39, 10, -7, 26, -11, 37, 14,
+  32, -34, 17, 3, -74, -22, -14, -19, 16, -6, -39, 33, -22, 14, -17, -6,
+  0, -7, -5, -10, -55, -59, -92, 0, -28, -16, 13, 13, 7, -11, -40, -9,
+  -81, 0, -64, -12, 87, 16, 27, 43, 51, -15, 41, 25, 45, 65, -25, -48,
+  -70, 83, -28, -36, 35, 0, 24, 16, -53, 13, -42, 37, 71, -14, 5, -58,
+  73, 0, 17, -30, -124, 16, -11, -82, -3, 15, -50, 4, 0, -17, -17, -12,
+  -12, -7, 29, 10, -39, -22, -6, -3, -82, -85, 8, 28, -10, 15, 0, -15,
+  -63, -2, -64, -70, 17, -5, 8, -10, -51, 0, 45, 11, -48, 41, -60, 29,
+  -33, -111, -38, -45, 44, 6, -4, -34, -25, -34, 39, 2, -14, 25, 44, 6,
+  -50, -7, -43, 17, -14, 57, 44, 127, -10, -22, -36, -40, 35, 24, 3, 18,
+  27, -7, 58, 62, -16, 0, -25, -37, -11, 13, 57, 19, 77, 88, -7, 18,
+  29, 19, -8, 18, 118, 5, -23, -3, -18, -42, 53, -25, -24, 3, 18, 16,
+  11, 25, 16, 45, 60, 0, -20, -34, 3, 42, 19, 5, -48, 4, 0, -12,
+  -15, -14, -56, 6, 72, 23, -17, -27, -37, -6, -29, 30, -14, -18, 35, -32,
+  -45, -14, -24, -18, 17, 13, -53, -7, 56, -7, -11, 0, -5, -8, 14, -82,
+  31, -17, 8, -9, 68, -25, -20, -16, 9, -59, -35, -40, -11, -37, 26, -11,
+  73, 3, -16, 16, -43, 17, 38, -24, -10, 27, -10, -31, -29, -37, -5, 39,
+  -3, 0, -3, -29, -14, 11, 11, 62, -61, 10, 3, 0, -42, -4, -38, 32,
+  40, 67, 5, -14, 3, 15, -26, -10, 15, -17, 11, 55, -5, -8, -28, 6,
+  46, 17, -83, 58, 7, -19, 55, -10, 6, -15, -4, -23, 79, -79, -47, -3,
+  0, -32, -26, 0, 16, 3, 8, 14, 13, 27, 27, 26, -38, 7, 16, 42,
+  27, 3, -15, -49, 33, 31, -11, 0, -37, 16, -9, -45, 34, 18, -32, 26,
+  -4, 81, -19, -7, 57, 42, -3, 41, 6, 14, -28, 65, -26, -42, 3, 28,
+  76, -49, 25, -15, 11, 3, -8, -26, 22, -56, 43, -2, 93, 34, 4, 25,
+  -19, 19, 42, -16, -20, -7, 29, -24, -58, 0, 30, -36, -50, -4, -35, -33,
+  -48, -3, -18, -34, 38, 17, 23, -12, 20, -19, -23, -15, -25, 7, -14, -67,
+  -65, 74, -30, -36, 33, -4, 0, -41, 68, -31, -70, -49, -70, 0, -31, 35,
+  42, 32, -79, -9, 79, -77, -35, -44, 9, -15, 43, -9, -11, 21, -22, 28,
+  -58, 3, -26, 3, 30, -20, -38, -11, -58, 22, -3, -33, 53, -82, 57, 21,
+  -24, 42, 59, -66, 43, 23, -28, -12, 27, -3, -6, 26, -8, -14, 23, -51,
+  20, 46, -33, -53, 43, 6, -3, 10, 35, 37, -25, -16, 39, 0, -3, 22,
+  -8, 2, 79, 33, -22, 11, -31, -21, -72, -52, -59, 59, 14, -6, -26, -36,
+  -50, 48, -7, -72, -3, -13, 0, 54, -3, -43, 107, 13, -41, 30, 0, -75,
+  -15, 45, 18, -14, 38, 0, 17, -12, 24, 3, 46, -8, -6, 51, -32, -48,
+  -20, 28, -8, 11, 3, 25, -33, 76, 15, 88, -45, -59, 62, -96, 45, 35,
+  31, -10, 54, 12, -14, -44, -55, -52, 60, -46, 78, 33, 4, -34, -62, -25,
+  -127, -16, 16, 28, 13, 17, 8, 3, 32, 8, -30, -41, -24, -59, -27, 24,
+  39, -77, -6, -29, 96, 40, 3, -4, -10, -16, -17, -56, -28, 14, -46, -42,
+  -24, -42, 35, -32, 30, 23, -30, -41, 38, -7, 28, -42, 18, 4, -63, 13,
+  27, -30, 54, 39, 18, -16, 4, 21, -6, -9, -4, -23, 50, 3, -44, 42,
+  -12, 0, -78, 28, -66, -37, 4, -35, 26, 8, -13, 13, -32, -44, -27, -21,
+  30, -49, 15, -23, 110, 91, -14, -16, -44, 0, -12, -87, -62, 51, 0, 19,
+  -20, 39, 24, 32, 27, -15, -82, 14, 18, 20, 0, 3, -23, 50, 21, 22,
+  -15, -7, 62, 33, 40, -55, 0, -29, 53, -46, 43, 5, 0, 64, 22, -28,
+  15, -35, 20, 50, -16, -20, -21, 5, 23, 19, -40, -23, 21, 33, 5, -18,
+  -12, -3, 30, -37, 48, 20, -48, 43, 0, 58, -14, 49, -17, 18, -3, -13,
+  73, 46, 84, 68, 17, -30, 7, 72, 24, 24, -31, -7, 67, 53, 38, -35,
+  53, 2, 67, 94, -25, 71, 67, -3, -16, -43, -16, -35, 0, 0, 55, 17,
+  4, 35, 33, 25, 56, 7, -25, -52, 42, 71, -17, -21, -56, 89, -33, -15,
+  -38, 9, 0, -17, -8, -14, -10, 20, -3, 54, -15, -19, -26, -79, -10, -46,
+  48, -15, 14, -18, 20, -14, -42, -67, -12, -9, -19, 44, -35, -6, -6, -3,
+  13, -2, -25, 10, -9, 7, -10, -18, -11, 0, -56, -40, -45, -54, -62, 37,
+  0, 24, 5, 26, -44, -25, 18, 21, -3, -16, -39, -20, -32, -13, 5, 43,
+  33, -82, -8, 0, -4, -2, -17, -13, 20, 40, 32, 19, -19, 40, -29, 22,
+  55, 0, -14, -60, -6, -14, -64, 6, -25, 14, 64, -25, 52, 26, -35, -8,
+  23, -31, -49, -3, 18, -44, 76, 31, 61, -21, -23, -69, -15, -3, 18, -19,
+  6, 5, -19, -39, -11, 11, 42, -25, 52, 2, 3, -7, -17, 22, -32, -23,
+  -33, 9, 0, -7, 61, 19, -2, -23, -45, 19, 12, -51, -19, -31, 24, -30,
+  -48, -33, -16, 6, -11, -38, 33, 0, 30, -3, -43, -41, -13, -6, 53, -13,
+  -23, 8, -56, -13, 0, 9, -56, 0, 8, -31, 7, 8, 3, -5, -28, -19,
+  0, 16, 47, 8, -66, 62, 25, -21, -30, -5, 14, -11, -15, -53, -11, 3,
+  0, -23, 13, 5, 24, 5, -14, 29, -57, 11, -37, -10, 14, -52, -32, -3,
+  -14, -57, 14, -6, -20, -61, 25, -17, -37, 9, -21, -8, 7, 3, 12, -11,
+  3, -4, -11, 18, 6, -12, -20, -37, 16, -47, 7, -57, -3, -64, 25, -5,
+  -6, -3, 8, -32, -14, -8, 78, -39, -35, 14, 20, 39, -17, 22, 7, 25,
+  -69, -82, -98, 41, -73, -2, -48, -33, -34, 5, -17, 127, -28, 73, 80, 3,
+  75, 42, -14, -54, 6, -27, 28, -12, -5, 0, 12, -25, -24, -84, 38, 16,
+  -29, -35, -18, 8, -55, -7, -23, 51, 0, -21, -56, -34, -21, -103, 25, -26,
+  -52, -3, 8, -29, 61, 6, 21, 5, 3, -9, 54, 9, -55, -78, -9, -48,
+  33, 29, 5, 24, 0, 29, -53, -16, -17, -51, 29, -38, 7, 12, -22, 35,
+  -41, 81, -16, 24, 3, 2, -14, 20, -72, 40, -43, -27, -13, -29, 23, 72,
+  -32, -25, -35, -61, 88, 14, -7, -22, 8, 3, 112, 8, -36, 36, 46, 35,
+  -62, -30, -22, -32, 22, -65, -39, 18, -22, 2, -8, 2, 45, -72, 23, 5,
+  -3, 32, -8, -17, 0, -31, -36, -13, -37, 16, 22, -32, -38, -18, -15, -5,
+  -51, -84, -21, 27, -37, 25, -36, 32, -2, -23, 14, 0, 7, 10, -3, 11,
+  -13, -19, -25, -18, -3, -2, 23, -7, 8, 5, -43, -36, -24, -8, 12, 23,
+  107, -51, 30, 37, 25, 0, 7, -2, 30, -21, 6, -22, 20, -78, 25, -28,
+  -43, -32, -68, -12, 12, 5, 2, -13, -3, -24, -51, -32, -40, 61, -15, -38,
+  10, -42, 0, -3, -48, 29, -53, -15, 12, -6, 43, 19, 30, -64, -47, -29,
+  39, -27, 25, 5, -9, -2, -66, 7, 13, -34, 13, -28, 24, -18, 49, 51,
+  -49, 13, 58, 24, -78, -6, -95, -28, -82, 50, -68, -46, -35, -6, -28, 20,
+  -8, 44, 28, 12, 12, -26, 2, -7, -11, -3, 5, -22, -54, -37, 10, 40,
+  -106, -18, 21, 9, 51, 13, 19, 9, -15, -32, 71, -14, 4, 48, 26, 3,
+  -61, -23, 0, -20, 12, -12, 50, -29, -48, 55, -16, 8, -9, -21, -55, -12,
+  -62, 3, -8, -8, 61, 51, -46, 50, 49, -30, 37, -15, -22, 41, 32, -51,
+  -39, 14, -27, 30, -75, -66, -18, -10, -74, 46, -4, 0, 33, 19, -4, 0,
+  21, -37, -4, -14, -56, -22, -34, 40, -118, 18, -11, -101, -30, 20, 23, 0,
+  -89, 16, -38, -12, 33, 25, -61, 0, -57, -12, -30, -37, -61, -12, 57, -25,
+  -65, 33, -25, -28, -60, -43, 16, 32, 67, 11, -91, 30, -42, 48, 14, 27,
+  47, -32, -66, 19, -93, -88, 26, -30, 96, 33, -41, -39, -98, -38, 19, -4,
+  -37, -115, -18, 46, 39, -3, 4, 67, 4, -9, 80, -21, 3, 30, 9, -12,
+  -40, 3, 32, -16, -23, -4, 82, 47, 61, 32, -101, -24, -19, -40, 5, -22,
+  20, -71, -76, -40, -68, 35, 22, 21, 29, 46, -95, 20, -57, 24, 28, 35,
+  16, -90, -77, 22, 43, -15, -33, -5, 39, 8, -7, 39, -33, -42, -26, -17,
+  42, -14, 0, -93, 69, -41, 51, -9, -19, 35, -51, -72, 27, 10, 9, -78,
+  -60, -3, 5, 12, -33, -46, -51, -24, 12, -8, -61, -12, -23, -36, -43, 11,
+  20, -25, -21, -12, -111, 35, -49, 60, 29, 18, 35, -10, -42, 19, -35, 19,
+  39, -68, -4, -30, -56, -4, -37, -30, 52, 62, 0, 20, 4, -89, 7, -42,
+  42, 18, 7, -74, 9, 14, 60, -13, 15, -75, -44, -21, 20, 30, -90, -73,
+  -64, 61, -32, -12, 79, -14, 102, -41, 33, -20, -35, 6, -5, -12, 24, -47,
+  -35, 21, 51, -8, -9, -52, 22, 32, 17, 28, -4, -60, 11, -34, -18, 43,
+  -67, -23, 35, -52, 81, 11, -48, -50, -70, 17, -75, 83, -15, 9, -34, 12,
+  63, -9, 4, -9, -69, 50, -9, 45, 0, -53, -62, 101, -70, 20, 36, -69,
+  -30, 45, 0, -59, 37, 121, 82, -3, -90, 32, -30, 12, 9, 36, 19, 14,
+  -75, 58, 4, -24, 43, 43, 82, 42, 101, 21, 13, -20, 11, -43, 53, -51,
+  51, -9, -15, 22, 43, 37, -15, -96, -79, -71, -90, -68, 7, 5, 0, 21,
+  89, -14, 32, 102, 43, -44, -30, -4, -65, 57, -47, 4, -17, 60, -5, 4,
+  -10, -93, -65, 12, 23, 75, -36, -3, -61, 0, -76, -31, -5, -32, 114, 29,
+  -75, -12, -8, 20, -107, -26, 11, -60, -4, 42, -4, -64, -8, -43, 46, 70,
+  0, -23, -23, 37, -68, -7, 29, 35, 9, 17, -34, 29, -47, -56, -7, -29,
+  -37, -9, -78, 46, -43, -11, -81, -49, 65, 26, 80, 0, -27, -20, -18, 45,
+  -60, -13, -5, 4, 14, 39, 10, -7, 20, -16, 0, 3, -56, 56, 24, -22,
+  65, -50, 21, -28, 68, 30, -33, -4, 29, -71, 13, 97, -34, 96, 18, -35,
+  -12, 27, -31, -122, -81, -55, 33, -20, -17, 62, -11, 10, 7, -38, -26, -8,
+  -5, -83, -21, -69, 43, 17, 34, 18, 23, 4, -15, 0, -10, -10, -36, -29,
+  -69, -35, 32, -24, 47, -50, 56, -78, -4, 36, -46, -18, 0, -75, -57, -83,
+  85, -108, -85, 44, 38, 9, -11, -49, 0, -81, -4, 3, -111, -14, -63, 4,
+  -87, 90, 15, 63, 68, -40, -22, 55, -57, 8, -45, -24, 7, 127, 94, -91,
+  84, 41, 71, 9, 22, 58, 43, -72, 50, 4, 18, -17, -7, 25, 5, 0,
+  -35, 6, 81, 114, 23, -39, -5, 17, 4, -88, 56, 21, -61, 12, -66, -50,
+  85, 37, -38, 16, 68, -26, 38, -18, 13, 18, 0, 13, -69, -10, -63, 23,
+  15, 28, -9, 2, 62, -27, 20, -14, 0, -28, 23, -16, 20, 26, 2, -9,
+  -64, -61, -18, -28, 7, 5, -50, 7, -4, -64, 49, 45, -15, 11, -25, 11,
+  -55, -20, 39, 4, -18, 8, -23, 4, 7, 22, 37, 19, 86, -9, 26, -28,
+  -22, 42, -24, 0, -31, 2, -15, 12, -49, -20, 22, 28, 19, 54, 39, -15,
+  7, 18, -47, -2, 35, -10, -25, -17, -2, 5, 21, -22, -55, -21, -29, 30,
+  12, -51, 14, -41, 14, -3, -19, 10, 2, -39, 0, 28, -19, 8, 0, 16,
+  -3, 2, -6, 26, 18, 4, -31, -19, -16, 22, 0, -32, -3, 20, -13, -30,
+  42, 16, 19, -9, -45, 2, -15, 20, -2, 4, 48, -22, 30, 54, -2, 2,
+  9, 8, -43, -21, 7, -51, -25, -17, -7, 30, 0, 49, -43, 39, 25, -5,
+  6, -31, 33, -39, -39, -26, 17, 17, -17, 15, 4, 19, -30, 52, 53, 30,
+  -77, 50, -9, -33, -96, 6, 77, 6, -36, -4, -79, 29, -3, 29, -26, -18,
+  3, -12, 24, 7, -5, -10, -21, -35, 19, -6, 24, -37, 36, 46, -4, -52,
+  59, 28, 24, 33, 45, -4, -43, 8, 12, -2, 2, 35, -32, -21, -33, 23,
+  -12, 23, -26, 0, -7, -5, -33, 0, -2, 32, 14, 35, 20, 22, -23, 34,
+  0, 27, 45, 7, -49, 6, 17, 17, 52, 29, 8, 29, 3, 35, -47, -12,
+  -67, 0, 7, -38, 12, 5, 9, -10, 33, -33, 7, 7, 45, -8, 27, 11,
+  15, -8, 47, -25, 28, -49, -4, 17, 63, -2, 25, -5, -36, -60, 17, -42,
+  -58, -77, 4, -62, -22, 11, 40, -22, 13, -76, -53, -14, -22, -8, 0, -18,
+  77, 2, -72, -26, -52, 40, 9, -23, -25, -42, -127, 5, -36, -33, -40, -12,
+  -17, 60, 19, -16, -28, -17, 45, -14, 58, -73, 17, -13, -2, 8, -4, -13,
+  -42, -53, -11, 25, 0, -27, 8, 22, 15, 53, 2, -71, 22, -3, 67, 9,
+  -67, 5, -41, 36, -53, 0, 31, -20, 13, 32, -20, -78, -69, -14, 25, -36,
+  14, -12, -75, 26, 8, 32, 14, 4, 11, -38, -23, -24, -13, 24, -5, -6,
+  28, 55, 26, -45, -43, -34, -18, 8, -28, -10, -36, 9, -47, -27, 14, 59,
+  15, 13, 4, -62, -14, -10, -27, 59, -46, -25, 27, 14, 14, 52, -13, 39,
+  -6, -38, 18, -13, 29, 20, 17, 45, 13, 56, -26, -16, 19, -6, -30, -9,
+  11, -11, -33, -11, 0, -4, 17, -36, -41, -13, -23, 8, 16, -7, -21, -20,
+  -11, 44, 47, 18, -2, 5, -9, -88, -21, -41, 24, -6, -57, -32, 33, -2,
+  -48, 3, 6, 25, -41, 12, -8, 62, 12, 46, 46, -27, -22, -5, 2, 2,
+  0, 5, 51, 26, 0, 12, -19, -25, 4, -22, 12, -19, 20, -25, -28, -16,
+  14, -52, -27, 35, -13, -63, 26, -73, 20, -7, -14, -24, 0, -77, -16, -2,
+  45, -46, 12, 29, 7, -14, 21, -41, 33, -10, 12, -24, -13, -70, -18, 63,
+  -28, 5, 26, 12, -17, 25, 67, 8, -12, -23, -8, -24, -10, 13, 10, 14,
+  -38, 33, -27, -18, 48, 3, 17, -45, 32, -12, 20, -35, 22, -22, -23, -7,
+  8, -23, -18, -13, 26, -18, 40, -6, 7, 58, 3, -27, -8, 24, 26, -38,
+  22, 2, -5, 27, 0, -34, 36, -26, 7, 16, 19, -11, 23, -19, -33, 24,
+  6, -7, 8, -18, -46, 8, 14, -13, 9, -40, -18, 42, -10, -15, -26, 11,
+  25, -54, -2, 5, 2, -31, -16, 7, -6, 21, -37, 5, 14, 13, 29, -11,
+  -5, -9, -17, 8, -7, -4, -35, 2, -7, -6, -49, 8, -37, -49, -3, 21,
+  29, 24, 7, 35, 2, -28, 3, -9, 31, -43, 12, 20, -2, -13, 17, -35,
+  2, -34, -16, 16, -63, 0, -4, -13, -51, -16, -16, 21, 37, 8, 24, 0,
+  -22, -7, 4, -10, 37, -4, 0, -36, -43, 9, 49, -5, 12, 0, -22, -11,
+  -42, -10, -40, 8, -7, 11, -27, 14, -2, -11, 3, -24, -5, -6, -3, 6,
+  -8, 33, 41, 4, 39, 0, 52, -26, -36, 13, 0, 18, -4, 23, 11, -25,
+  25, 5, -2, 8, -126, -6, 6, -48, -23, 11, -20, -10, 2, -18, -22, 18,
+  -36, -34, 40, 22, -23, -4, -20, -33, -57, -14, 10, 2, 5, -50, 5, -50,
+  24, 2, -23, 4, -27, -10, 38, 13, 30, 34, -30, -5, -2, 8, -25, 8,
+  -29, -60, -14, 0, -36, -39, 6, 17, 11, 9, -7, 5, 16, 39, 19, 8,
+  2, -31, 6, -14, -36, -24, -27, -35, 28, 29, -8, 0, -41, -23, -10, 2,
+  -48, 22, 30, -35, 42, 16, 11, 26, -20, 9, -12, 11, -9, 8, 27, -9,
+  8, 24, -14, 27, 10, -11, 38, 0, 37, -26, 16, 11, -15, 19, 3, -13,
+  -8, -66, -5, 19, -20, 0, 29, 8, 20, 32, -51, -25, 18, 8, -49, 31,
+  -101, 87, -4, -34, -76, 18, 16, 56, 72, 9, 44, -29, -8, -25, 22, 31,
+  -62, 10, -9, -20, 7, -9, -14, 31, 43, -19, 29, -18, -79, 11, 10, -54,
+  50, -7, -66, 61, -127, -19, -33, 45, -28, 43, -19, -2, 32, -30, -63, 0,
+  24, 16, -41, 15, 27, 35, 58, 23, 13, -26, 0, -43, -18, -98, 4, -25,
+  -8, -12, 10, -2, 30, -10, -33, -46, 35, 62, 22, 23, 0, 8, 16, -2,
+  -6, -7, -19, -22, 19, -22, -45, 55, -18, 40, -35, -43, 11, -8, -5, 20,
+  -29, -19, -46, -19, -2, -11, -22, -22, 35, 26, -51, 20, 35, -30, 0, -17,
+  -8, -27, 14, -17, 7, -5, -6, -4, 63, -17, 37, -11, 27, 21, -11, 48,
+  -4, 24, -64, -48, -7, 6, 8, 5, -47, 29, 16, 29, 23, 13, 48, 9,
+  20, -32, -55, -12, 0, 24, 16, 5, 41, 12, -10, 36, -37, 48, 41, -26,
+  -8, 26, 23, -34, 0, 4, 65, -2, -37, 0, -16, -8, 35, -38, 5, 10,
+  13, -40, 5, 22, 2, 7, 6, 0, 4, -21, -19, 0, 0, -5, 23, -31,
+  48, -68, -29, -4, 70, 12, -33, -38, -51, 4, -8, 42, -16, 65, 22, -106,
+  50, -12, -6, 54, -56, -18, -68, -41, -14, 0, 6, 27, 36, -40, 14, 54,
+  71, 3, -37, 10, -47, -2, -14, -11, 15, -75, 27, 37, -17, 44, 30, -38,
+  -16, -7, 9, 47, -20, 37, 26, -28, -80, 58, -65, -36, 10, 28, 21, 50,
+  6, 2, 6, -79, -36, -16, 20, -3, 2, 9, 6, 44, 17, -10, -60, -51,
+  48, -47, -4, -30, -2, -21, -2, -41, -2, -5, 12, 14, 7, 50, 22, -9,
+  21, 3, -20, -59, 25, -23, 60, -7, 39, -30, -51, -33, -2, 6, -15, 2,
+  -5, -9, -14, -45, -27, 67, 64, -23, -7, -15, 9, 18, 0, -44, -32, -15,
+  56, -39, -8, 24, -13, -10, 18, -25, 28, -21, -67, 10, -5, -20, -56, 32,
+  -93, -49, -3, -23, 0, 41, 15, -19, 30, -47, -72, 15, 14, -11, -45, -70,
+  -49, -5, 38, -17, 50, -13, -73, -22, 46, 6, -36, 0, -17, 71, 30, 15,
+  -28, -97, 6, -11, -6, -43, 62, 30, -39, -58, -6, 21, -52, 44, -15, -33,
+  -64, 32, -11, -16, -22, -5, -13, -4, -25, -47, -40, -10, -18, -13, 5, 41,
+  0, 3, 3, -23, 34, 10, -18, -25, -27, -78, -47, 36, -36, -74, 48, 3,
+  -71, 2, 42, 31, 30, -38, -36, -34, -46, -28, 0, -33, -46, -59, 30, 5,
+  92, 3, -30, 6, 21, -9, -15, 43, -57, 13, 28, -21, 11, -14, -18, -3,
+  -39, 32, -47, 84, 0, 55, -29, 79, -3, 15, -80, 35, -26, -64, 21, -38,
+  -45, 36, -33, 26, -15, -12, -97, 6, 14, 78, -36, 6, -24, -4, 71, 6,
+  60, 11, 73, -8, -30, -53, 0, 7, -17, -46, -36, 7, -10, -11, 51, -46,
+  -4, -50, -15, 80, -64, -28, 50, 10, -54, 43, -28, -24, -16, 55, -35, -3,
+  -22, 0, 19, 40, -35, -29, -29, 93, 87, 62, 53, 24, -16, -10, -3, -89,
+  -11, -62, 40, -79, 0, -6, 45, 22, 14, 19, -54, -84, -7, 18, 26, -23,
+  25, -7, -31, 48, -70, 0, -25, 26, 35, 63, -72, -11, -43, -42, -61, -56,
+  -57, -24, -12, 46, -24, -12, 62, 33, 51, 10, -28, -24, -41, -92, 5, 30,
+  3, 45, -5, 3, -31, 47, 16, -4, 19, 74, 11, -10, -44, 17, -51, -59,
+  -63, 23, 13, -66, 74, -14, -12, 124, -30, 3, 10, -3, 2, 25, -22, -32,
+  -78, -59, -35, 34, -20, -23, -109, 12, -17, 57, -29, 24, -43, -68, -13, -33,
+  -64, 41, -36, -6, -33, 59, -31, 5, -30, -25, 52, -7, -38, 7, -55, 39,
+  -8, -6, 14, -26, -22, -29, 13, -11, 65, 0, 67, -10, 34, 7, -40, -21,
+  -127, 0, -20, 0, 22, 8, -30, 35, 38, 38, 36, 33, 17, 32, 3, 32,
+  7, 0, -23, -42, 73, -25, -22, 29, -12, -17, 29, 17, 36, -34, 24, 61,
+  -4, -12, -57, 0, 39, -37, -89, 23, -66, 8, -55, 7, 35, -21, -15, 33,
+  6, -32, -11, -11, 9, -42, -37, 43, 25, -12, -32, -3, -47, 0, 43, 18,
+  11, -3, 38, -20, 6, -16, -6, 41, 14, -9, -16, -18, 7, 28, 6, -12,
+  7, 18, -35, 73, -10, 33, 15, 10, -61, 6, 29, 17, -60, 11, -40, 0,
+  -18, 35, -12, -3, 39, -25, -12, -58, -6, 38, 37, -10, 38, 14, 65, -28,
+  -34, -35, -30, 8, -13, 10, 47, 82, 34, -9, -11, -35, -44, 84, 11, 3,
+  0, 56, 53, -7, 55, -6, -55, 89, 62, -53, -10, 27, 10, -85, 42, -23,
+  -95, 23, -58, 53, -13, -33, 7, 5, -35, 6, 18, 43, -17, -20, -44, 8,
+  0, -30, -27, 83, -24, -28, -8, -45, 33, -13, -65, 24, -3, 21, 15, 0,
+  22, -26, 41, 32, 57, -76, 21, 61, 40, 18, -13, -24, -16, 30, 24, -103,
+  -30, 39, 43, -109, 25, 39, -12, -54, -30, -19, 59, -6, 38, 0, 19, 29,
+  56, 7, -35, -48, 7, -35, 0, 58, 75, -40, 68, 15, -30, -59, -51, -26,
+  -96, -50, 3, -46, -48, 25, -8, -5, -54, 43, 65, 33, -5, 0, 5, -8,
+  12, -23, 18, -6, -13, 27, -11, -26, -11, -34, -29, 15, 2, -10, 47, 22,
+  -30, 36, 16, 43, 4, -3, -38, -12, -18, 27, 17, 28, 12, -3, -54, 13,
+  15, -7, -42, -20, 0, 11, -11, 25, 13, 33, 34, 3, -22, -6, 5, 2,
+  16, 17, 4, 8, 15, -40, 8, 20, -15, -16, -16, -5, -32, 25, 9, 22,
+  8, -5, -8, -12, -48, 6, 32, -5, -50, -17, -8, 10, 17, -22, 12, 17,
+  14, 33, -35, 22, 38, -13, -18, 19, 20, 21, -6, -35, 21, -10, -9, 25,
+  -5, 12, 14, 14, -10, -30, 24, -16, 19, -31, 5, 8, 17, 14, -12, -28,
+  29, -2, 2, -19, -4, -31, 56, 0, -22, -46, -25, -17, -14, 7, 9, 10,
+  -4, -23, 28, 0, -13, 13, 25, -3, -2, -13, -25, 18, 15, -15, 2, -28,
+  44, 12, 13, 5, 22, 13, 38, 0, 0, -7, -13, 20, 7, 39, 38, -23,
+  10, 3, -20, 22, 7, 11, -21, -18, 13, 27, -47, 9, -12, 0, 27, -11,
+  -36, 6, 0, -34, -9, 9, 25, 16, 17, 11, 0, -5, 12, -30, 0, 26,
+  31, -26, 46, -13, 42, -23, 25, -39, -2, 37, -2, 8, 28, 41, 31, -34,
+  -44, -33, 9, 46, -13, -13, 9, -19, -14, 66, 9, -77, -2, 13, -5, 21,
+  33, -45, -34, -24, 15, 6, -21, 44, -34, 19, -5, -6, 0, 19, -12, -26,
+  39, 17, 28, -10, 15, 16, -25, -9, -35, -22, -13, -5, 16, 22, -11, -14,
+  6, -42, -46, -38, 55, -30, 25, -89, -127, -6, -68, 56, 15, 7, -6, -26,
+  -14, -79, 9, -98, -11, 14, 44, 0, 44, -30, -25, -13, 3, 13, -45, 2,
+  3, -10, 45, -75, 53, 0, 45, -68, -2, 4, -18, -11, -39, 54, 2, -7,
+  -8, -13, 0, 38, -86, -25, -127, -9, -22, 16, -13, -5, -10, 80, 5, 12,
+  -18, -59, -10, -12, -35, 36, -11, -44, 11, 13, -12, -15, -19, 22, 2, -32,
+  38, -31, 24, 12, -16, -19, 9, -30, -30, 37, -4, 9, -2, -28, 63, 6,
+  23, -10, 17, 45, -51, 20, -26, 33, 47, -12, -21, 14, -2, 14, 10, 2,
+  -26, 50, -18, -59, -46, 7, 23, -2, 4, 42, -16, -2, 16, -25, -9, 57,
+  22, 26, 8, 19, -16, 6, 29, -31, 18, -6, 17, -20, -13, -10, 12, -4,
+  -19, 7, -24, -14, -27, -27, -13, 0, -16, 7, 36, -39, -23, 3, 5, -6,
+  15, 12, 0, 10, 15, -11, 8, 23, 21, -17, 29, -11, -27, 29, -17, -13,
+  29, -17, 0, -4, 2, -2, 0, -22, -2, -4, 27, -12, 10, 45, -40, -24,
+  -51, 19, 2, -15, -100, 48, -19, 5, -2, -17, 25, 5, -40, -29, -4, 22,
+  -55, -24, -44, -58, -20, 1, 2, -14, -34, -9, 0, 22, -31, 8, 9, -17,
+  36, -17, 8, -14, 12, 13, -5, -9, -2, 25, -50, -36, 10, -31, -12, -15,
+  60, -4, -11, -40, -35, 16, -6, 18, -24, -22, 25, 28, -26, -40, -5, 8,
+  -18, 33, -42, 6, 23, -19, 6, 18, -39, 6, -4, -68, -17, -46, -37, -11,
+  49, -57, 18, 26, 7, -19, -42, 2, 2, -7, 15, -9, -29, -8, -33, -23,
+  8, -7, 3, 24, 17, -13, -32, -11, 11, -2, -5, -30, -10, -8, -30, 0,
+  21, 17, -9, 38, -35, -11, 14, 16, -24, 7, 7, 7, -20, 0, -5, -6,
+  2, -9, 2, -21, -26, 8, 4, -18, -16, 4, -14, 15, -21, -7, 25, -30,
+  25, -7, -9, -60, 0, -9, 0, 2, -6, -12, 0, -31, 9, 44, -2, 4,
+  0, 13, -48, -21, 7, 15, 21, -2, -9, -31, 0, -22, -10, -48, -20, -17,
+  0, 9, -2, 6, -49, 2, 20, 26, -15, 0, -11, 0, -18, -33, 6, 37,
+  -14, 5, -12, -17, 32, 17, 12, -16, -11, 24, 18, 5, 2, 2, -10, -30,
+  11, 17, -11, -5, -43, -24, 45, -2, -26, 21, -4, -31, 16, 0, 2, -11,
+  -44, -18, -14, 27, 17, 17, 16, 14, 11, 19, -11, -11, -5, 27, 17, -26,
+  10, -30, 7, -15, -24, -16, 11, -7, -2, 17, 36, -9, -14, 8, 18, -10,
+  23, 38, -14, -17, -26, -27, 2, 8, -27, -15, -8, 41, -19, -25, 4, 22,
+  -5, -24, 18, 7, -14, -14, 31, -47, -8, 18, -23, -2, 24, 0, -2, 2,
+  -8, 13, -6, -8, -7, 19, 37, -5, -4, -10, -3, -3, -37, 6, -17, 32,
+  -13, 33, 0, 17, -22, -14, 20, 2, -9, 13, -11, -3, -14, 18, 18, -10,
+  -12, -17, -16, -37, -42, 17, -6, -58, -18, -20, 4, 3, -15, -47, -43, -59,
+  8, -7, 0, -51, -14, -12, 7, 16, -22, 21, -6, -18, 16, -21, 64, 2,
+  -127, -20, -20, -53, -7, -2, 8, -60, -11, -19, -40, -5, -39, -54, 5, 2,
+  -8, -65, -26, -11, -11, 5, 45, -11, 44, -11, 9, -10, -26, 8, 13, -14,
+  -12, -12, 2, 43, 6, 46, -4, 87, 66, -33, 0, -5, -34, 34, -18, -61,
+  27, 50, -17, 17, -54, -53, -67, -19, -90, 25, 19, 18, -33, -13, 33, 47,
+  -3, -12, 34, -21, -39, -11, 13, 16, 30, -21, -26, 3, 51, -27, 42, -21,
+  -44, -26, -13, -93, -29, 0, -11, -20, -46, 50, 2, -16, 14, -70, -50, -2,
+  -8, -2, 38, -10, -13, -36, -4, 5, -16, 15, -16, -8, 13, -10, -8, -17,
+  22, 17, -18, -34, 16, -1, 2, 35, -6, -21, -23, 9, -7, -8, -28, -21,
+  3, 10, 20, 6, 15, -17, 64, -2, 2, 2, 16, -14, 12, 15, 7, -13,
+  8, -24, -20, 2, -7, 16, 28, 13, 7, -7, -5, -10, -18, -43, -7, 20,
+  2, -2, -14, -16, -13, -15, 10, -24, -55, 11, -2, -31, 17, -20, -10, 11,
+  22, 34, 0, -34, 16, 27, -2, 21, 18, -12, -29, -26, -17, -47, -5, 17,
+  -16, -35, 37, -23, 10, 0, 16, -12, 17, 38, -29, -2, 0, 4, -17, -13,
+  34, -22, 13, 8, -20, 27, 0, -17, -4, 24, -27, -40, -8, 23, -18, 33,
+  -10, -14, -40, 41, -36, -8, -8, 5, -5, 4, -41, -15, 15, 7, -16, -4,
+  0, -17, 20, -15, -52, 10, 22, -19, 18, 14, 29, 7, 5, 26, 21, 38,
+  26, 27, 23, -25, -12, 13, -3, 21, 2, -29, 5, -16, -46, -46, -5, -9,
+  -70, 43, 33, -11, 7, -5, 11, 13, -55, 0, -34, -9, -16, 15, 35, -4,
+  14, -7, -4, -6, 19, -10, -35, 50, -41, 30, -29, 38, 0, -39, -22, 24,
+  -33, -53, 2, 0, -16, -29, 53, 40, 36, 14, 15, -18, 12, 70, 17, 11,
+  -54, -13, -11, -23, 22, 11, 16, -23, -17, -21, -40, -29, 2, -12, 10, 2,
+  -21, -50, -20, 6, 9, -11, 0, -15, -42, -24, -7, -12, -22, 73, 6, 41,
+  -48, 26, 10, -7, 59, 30, -21, -22, 3, 58, 14, -19, -30, -27, -62, -11,
+  27, 15, 5, 32, -28, -37, -46, -11, -46, 17, -28, 59, -4, -54, -9, 18,
+  19, -18, 31, 15, -24, -59, 10, -4, 10, -20, -55, -27, 45, -33, -18, 11,
+  45, 19, -3, 5, -44, -33, 28, -18, -3, -47, -14, -9, -12, -34, -20, 40,
+  -18, -89, -12, 5, 87, -9, 19, 22, 61, 3, -22, 25, 5, 18, 19, 19,
+  30, -23, 20, -71, 0, 21, -49, -6, 7, -51, 42, 54, 2, 6, -37, -8,
+  47, -4, -7, 13, 33, 9, -26, 0, 49, -28, 13, -19, 21, -35, -60, 21,
+  64, 5, -30, 10, -5, 14, -14, -14, 27, -56, 6, 53, 27, -40, -14, 35,
+  0, -17, -7, 0, 83, 30, -14, -58, -22, 21, -5, -12, 30, 24, -22, 8,
+  -7, -12, 52, -21, -19, -21, 19, 14, 32, -39, -30, -38, -11, 44, -46, 31,
+  16, -29, 62, 48, -18, -25, 39, 32, 34, -28, -13, -6, -77, 8, -12, -16,
+  10, -11, 13, 10, -5, 0, 17, -23, 21, 5, -30, -36, -20, 58, 0, 57,
+  -18, -14, -47, 7, 67, -38, -26, 0, -84, 29, -17, 6, -49, 27, -29, -29,
+  -37, 0, 18, -3, 53, -2, 22, 29, -32, 53, -12, 11, 62, 16, 0, 3,
+  22, -24, 17, -53, 30, -23, -23, -39, -13, -31, -36, 16, 21, -53, -15, 39,
+  -29, -40, 38, 28, -68, 17, -10, -32, -37, -18, 39, 11, -37, -21, -50, 10,
+  -68, -66, -5, 19, 4, 2, 38, -3, 22, 24, 38, 0, -65, -21, 2, 72,
+  47, 21, -9, -38, -6, -5, 54, 3, -27, -6, -2, 8, -26, -44, 55, 3,
+  13, -24, 41, 53, -48, -30, -3, 26, 55, -13, 29, -58, -12, -3, -127, -57,
+  32, 13, -30, -21, 60, -53, 56, -14, 37, 2, -8, 32, -20, -74, -36, 0,
+  33, 89, 2, 5, 111, 0, 19, 19, -28, -11, 26, -50, -28, -36, -5, -16,
+  13, 32, -36, 47, -33, 5, -73, 11, 5, -37, -19, -46, -26, -38, -29, 3,
+  57, 6, 3, -20, -21, -18, -49, -56, 3, -36, 16, -18, 3, 5, -39, 16,
+  -67, -8, -35, 31, -19, -47, -90, -9, -107, -36, -44, -51, -12, -43, 2, -15,
+  -5, -3, -12, 21, -44, 12, -5, -55, -42, 8, 31, -16, 77, 21, 45, 3,
+  34, 15, 74, 9, -11, -18, -8, 34, -12, -6, 23, 8, 9, 44, 29, -29,
+  -3, 2, 0, 25, 51, 16, -39, -22, -18, 8, 3, -19, 3, 8, 15, -48,
+  -3, -5, 22, -62, -84, -6, -21, -11, -32, -41, -22, -28, -20, 3, -41, 12,
+  13, 49, -49, 28, -12, -21, -9, -93, -20, 56, -43, 16, 5, -30, -2, -16,
+  -60, -53, -34, 44, 17, -33, -57, 40, 2, -25, -5, -8, -73, -35, 26, 5,
+  -41, 33, 31, 20, -42, 34, -62, 4, -13, -38, -13, -23, 12, 30, 54, 80,
+  -67, 13, -16, -80, -33, -50, -24, -14, -88, -2, -47, -53, -41, 64, 25, -84,
+  33, 17, 69, -5, 28, -30, 0, -19, 17, -8, 36, -9, 21, -99, -2, 42,
+  -23, -29, -81, -3, -8, 30, -41, -54, 7, -28, -26, -22, 4, -16, -14, 73,
+  -44, 22, -17, -55, -57, 5, -3, 32, 8, 36, 26, 21, 3, 46, -70, -34,
+  -3, 21, -27, -59, -24, -30, -97, 0, 29, 59, 36, 47, 2, 37, 47, -7,
+  26, -12, -38, 13, 0, 10, -26, -11, -12, 11, -7, -17, -2, -13, 8, 22,
+  -42, 4, 16, -4, -17, -26, 4, 22, -5, -22, 34, -19, 6, 20, 14, 20,
+  -18, 24, -26, -24, 25, 14, 29, 27, -11, -16, 43, 27, -21, 16, -25, -14,
+  -40, 20, 15, -18, -21, -2, 2, 20, 17, 25, 23, 28, 27, 30, 8, -2,
+  16, -40, 2, -2, 25, 2, -26, -18, 0, -42, -25, 2, 23, -27, -12, 9,
+  -28, -12, -16, -4, -4, -9, 0, -28, -12, 2, 21, -2, -12, 53, -14, -7,
+  -22, 0, 5, -42, -6, -32, 29, 19, -4, 28, -40, -15, -23, -21, -11, 5,
+  22, 18, 11, -22, -30, -40, -58, -8, -26, 31, -23, -6, -31, -19, -11, -3,
+  33, 4, 2, 16, 8, -21, -23, 9, -25, -28, -5, 4, 19, 6, -13, 9,
+  -5, 24, 11, -45, -10, 4, -13, 16, -3, -12, -34, -17, 6, 20, 20, 5,
+  2, -30, -7, 12, 10, -11, 48, 15, -7, -12, -7, 11, -12, 39, -19, -27,
+  9, -42, 2, 20, -23, -2, 12, 8, 4, 25, -44, 15, 0, 28, 6, -31,
+  -9, 6, 5, 21, 19, -7, -15, -31, -23, 9, -45, -11, -11, -31, -38, 0,
+  -35, 20, -2, -16, -10, -11, -40, -16, 0, -10, 23, -45, -3, -18, 10, -9,
+  -20, 37, 5, -2, -17, 32, 29, 6, -7, 21, -7, -45, 0, 18, 21, 40,
+  7, -18, 13, 2, 8, 4, 19, 16, 7, 0, -6, 13, -32, 53, -3, -55,
+  66, -28, -33, -97, -22, -65, -21, -42, -17, -41, -37, 17, 48, -92, -35, -15,
+  -77, -67, -3, 58, -44, -39, -2, -52, 14, -10, -27, -9, -73, 31, -30, -76,
+  37, -26, -29, 17, -56, 52, -9, -21, 2, 18, -101, -22, -27, 51, 50, 13,
+  91, -83, 47, -16, -49, 17, 39, -14, 9, 20, -46, -50, -39, -13, 23, -41,
+  -16, 16, 10, -15, 39, 11, 8, -13, -37, 22, -15, -28, 2, 0, 25, -15,
+  -54, -6, -23, -10, -2, -11, 9, 4, -2, 2, -6, -34, 4, -33, -24, 31,
+  -31, -23, 19, 30, 8, 30, 11, -13, 9, -11, 4, -12, 8, 9, -8, -3,
+  9, 13, 19, 5, -34, -12, -14, 3, -24, -3, -8, -3, -7, -30, 31, 21,
+  9, 16, -12, -20, 17, 18, -28, -22, 35, -15, 5, -22, 0, 4, -10, 9,
+  -44, 24, -6, -31, 21, 31, -9, -26, 41, 0, 0, -22, -21, -2, 26, 4,
+  -2, -13, 22, -2, -35, -2, -2, -15, 5, 39, -16, -22, 12, -30, -25, -16,
+  13, -26, 2, 16, -13, 4, 0, 14, 9, -9, 23, 9, -14, 17, 19, 5,
+  26, -98, 14, -7, -83, 23, 7, -42, -29, -29, 18, -43, -31, -4, -28, -2,
+  23, -10, -28, -6, 73, 9, -11, -4, -58, 2, -23, -7, 7, 9, -18, -36,
+  -22, -26, -127, 16, 43, -43, -25, -85, 22, 9, -18, 5, -25, -18, -4, -29,
+  20, -13, 2, 39, -51, 31, 53, 30, 26, 0, -27, -10, -29, -51, -20, 74,
+  -12, -10, 22, -53, 14, 7, 13, -18, 31, -6, 7, -26, 26, 17, -15, -39,
+  40, 35, -3, -23, 0, -9, 8, -52, 10, -12, -26, -30, -16, 29, 20, 9,
+  22, -20, 7, -2, -8, 14, -5, -16, 22, 27, -4, 18, 6, 5, -55, -21,
+  -4, -13, 47, 9, 4, 58, 2, -8, 52, -16, 15, 9, 24, -51, -28, -21,
+  -3, -41, -16, 34, -79, -3, -5, -32, 22, -6, -37, -17, 10, 10, 82, 18,
+  -7, 10, -5, -13, 21, 4, 3, -6, -16, 9, 72, -21, -9, 35, -38, -17,
+  -59, -38, 49, -25, 46, 28, 7, 36, -37, 53, -21, -6, -26, -3, 43, -40,
+  11, 18, -9, 37, 3, -43, -15, 10, -41, 20, -18, -5, -35, 24, 12, 19,
+  0, -6, 16, -5, -13, -28, 8, -39, -22, 32, -29, 27, -20, 13, 18, 44,
+  -48, 32, 10, -20, 40, 17, 21, 35, 13, 22, 56, -24, -23, 14, -6, -23,
+  -14, -45, 72, -33, 30, 5, -11, 2, -29, -31, -11, -19, -7, -8, 10, -35,
+  -28, 18, 30, -6, 18, -6, 0, -10, 35, -15, 27, 14, -43, 44, 64, -41,
+  6, -16, -3, 42, -87, -26, -26, -7, -25, -12, -34, -10, -31, 23, -29, 20,
+  -15, 19, 22, 36, -15, -4, 27, -6, -30, 12, 3, 21, -19, 3, -10, 20,
+  -21, -16, -72, 17, -16, 50, 39, 9, -3, -42, -11, 28, -56, -22, -3, 3,
+  -18, 9, 42, 26, -24, -37, -69, 12, -74, 0, 9, -16, -21, -34, 5, -3,
+  -19, -86, -14, 3, 9, -5, -41, -106, 0, 18, 24, -34, 8, 7, -71, 6,
+  44, 6, -22, -46, 34, 4, 15, 6, -11, 0, 0, -30, -16, 0, 0, -20,
+  -10, -38, -83, -14, 23, 5, 4, -81, 11, -42, -7, -73, -36, -78, 27, 13,
+  -21, -38, 56, -6, -21, -40, 69, 25, 29, -2, -18, -21, -27, -57, -17, -27,
+  -52, 22, 22, 31, 26, 49, -8, 21, 25, 23, -8, 55, -33, -23, -16, -70,
+  -30, 23, -45, 59, -85, -79, -27, 69, -75, 25, -20, -39, -61, 45, 127, 34,
+  -63, -13, -91, 36, 3, -53, 32, -45, 0, 20, -32, -6, 33, -39, 3, 13,
+  -28, -18, -95, -94, 9, 55, 15, -12, -9, 35, 46, -16, -8, -85, -57, 16,
+  -14, -51, -27, -50, -96, -15, -26, -50, -3, -3, -39, 65, -20, 17, 24, -12,
+  11, -29, -5, -26, -6, -60, 15, 63, -35, 25, 36, 21, 26, 31, 35, 9,
+  -38, -4, -102, 33, -16, -13, 50, 5, 23, -11, -46, -19, 36, 31, -30, -40,
+  -18, -26, 24, 26, -15, 3, 69, -32, 38, 5, -30, -7, -19, -30, -20, -8,
+  -28, -10, 14, -44, -57, -18, -15, -11, 0, -44, -34, 14, 20, -23, -5, -9,
+  -4, -29, 10, 39, 18, -10, 24, -6, -5, 9, 5, -24, -2, 7, -22, 3,
+  24, 38, -11, -3, -20, 3, -22, 43, -37, 17, 7, 45, -59, 14, -10, 0,
+  -35, -26, 24, -28, 12, 27, 11, -10, 0, -5, -6, 52, -46, -14, 37, -16,
+  -6, -10, -35, 18, -96, -13, 3, -14, -12, -20, -32, 7, -41, -10, 45, 6,
+  4, -16, -30, -42, -21, -10, -69, -69, -13, -15, 54, -30, -7, -73, -51, -11,
+  -17, -4, -57, 41, 111, 35, -22, -7, 20, -34, -4, -6, -59, -64, 50, -8,
+  -77, -23, 24, 0, -24, -37, 31, 20, -53, -5, -37, 7, -16, 71, 50, -5,
+  -3, -51, -8, 13, -26, -5, 5, -28, -15, -23, -21, -31, -61, -20, 32, 44,
+  11, -3, 12, 7, 9, -35, -9, 31, 3, -6, 18, 3, -16, -49, -105, -3,
+  -38, -18, -8, -33, -46, 25, -65, -17, -40, 8, -71, 47, -3, 3, -23, 8,
+  25, -6, -24, 0, -57, 6, -34, 22, 0, 32, -24, -40, -38, -14, 45, -14,
+  -22, 9, -61, -5, -9, -15, 8, 14, -21, -3, -18, -3, -33, 20, 8, 3,
+  25, -19, -15, 6, 39, -27, 3, -6, -13, -9, -58, 9, -9, -10, 41, 6,
+  34, -11, -82, 14, 52, 15, -28, 5, -17, -22, -56, -13, -26, -71, -13, 12,
+  -14, -43, 50, 3, -56, -21, 68, -39, 41, -12, 39, 2, -32, 13, -12, 16,
+  22, -3, 5, 54, -47, 30, 0, -35, -21, 14, 16, -7, 40, 29, 26, -14,
+  69, 35, -44, 48, -48, -29, 29, 3, 16, -18, -35, -61, 28, -24, -31, -28,
+  -69, -2, -22, 33, 0, 32, -11, 14, 42, 14, 14, 13, -42, 33, -30, 25,
+  10, 0, -18, 0, 18, -6, 41, -2, 26, -17, -9, 2, 40, 0, -17, -43,
+  19, -47, 19, -44, -73, 3, -13, -31, 15, -26, -31, 34, 5, -59, 18, -32,
+  25, -16, 12, -29, 12, -48, -12, -53, -24, -6, -13, -38, 23, 14, 41, 20,
+  -3, -7, -26, 11, -6, -15, 28, -5, -6, 44, 18, -17, -61, 27, 46, 32,
+  -10, 37, -44, -3, 9, -30, 49, 2, 14, 10, -12, 32, 32, 20, -37, 30,
+  27, -13, 13, -5, -4, -15, 28, -35, 0, -9, 16, 14, 10, 29, -18, 6,
+  51, -10, -2, -19, -15, -13, -3, -31, -26, 30, -33, 50, -18, 55, -22, -31,
+  27, 24, -7, 30, 48, 10, -11, -33, 31, 28, 18, 34, 6, -5, -52, -10,
+  0, -78, -18, -25, -12, 12, 26, 41, 52, -7, -27, -18, -24, -30, 7, 24,
+  -8, -28, -5, 18, 69, 28, -81, -52, 24, -32, 18, -64, -25, 49, -18, -40,
+  65, 16, 5, -19, -27, -6, -29, -81, -58, 67, 13, 6, 35, 24, -19, 23,
+  24, -11, 127, -19, -19, -15, -21, 14, 79, -72, -4, -51, -39, -5, 39, -17,
+  -24, -78, 58, 103, -12, 36, -4, -29, -14, 20, -21, -39, -13, -77, -24, 27,
+  -24, -3, -13, -23, -13, -28, 0, 3, -9, 17, -52, -17, -50, -55, -34, -23,
+  51, 0, 2, 16, -66, -2, 21, -25, -29, 3, -53, 3, -51, 41, 22, -73,
+  0, -9, -4, -57, -13, -12, -85, -9, -37, 11, -70, -36, -10, -25, 43, -25,
+  28, -57, -3, 8, -21, 39, -26, 56, 17, -20, 45, 25, 61, -17, -5, -46,
+  52, 28, -8, -13, -17, 38, -3, 49, -27, 9, 41, 37, -18, -20, -21, 0,
+  -25, -13, 41, -48, 15, 40, 56, 37, 29, 18, -25, -18, 37, -24, 19, 0,
+  -27, 18, 4, 5, 6, 7, 39, -14, 8, -17, -49, 2, -19, -44, 0, 30,
+  62, -34, -18, 17, -6, 30, -71, 5, 20, 12, 42, -2, 11, 10, -27, 16,
+  41, -9, -37, -3, -47, -18, 23, 10, -9, -26, -49, 34, -10, -49, -21, -37,
+  -25, 29, -29, 13, -81, 8, -29, -19, 61, 43, -13, -41, -7, 21, 0, 8,
+  -58, 27, 22, 19, 13, 5, 4, 21, 39, -33, 0, -17, -10, 16, -56, -7,
+  -10, 40, -23, -34, -62, -9, -41, -2, -29, 2, -3, -16, 5, 43, 7, 19,
+  5, 47, 32, 26, -17, -38, 8, -28, 12, 17, 5, 7, -5, -98, 21, 23,
+  -76, -51, 20, -16, -15, -27, 9, 59, 13, -40, 15, -20, -25, 41, 13, -6,
+  -14, 24, -4, -44, -26, 54, 7, 9, -42, 28, 49, 11, -39, -25, -23, 30,
+  24, -6, 9, -20, 44, 9, -45, 39, 14, 5, 6, -58, -3, 27, -7, 13,
+  -3, -24, 30, 26, -22, 23, -35, 4, -15, -58, -26, -4, -16, 58, 3, -55,
+  28, 36, 25, 8, 27, -10, 0, -4, -23, -39, -26, -7, -21, 52, 8, 7,
+  -17, 3, 62, 59, -16, -16, 0, -18, 64, -60, -31, -37, -49, 24, -4, -28,
+  -31, -55, 52, -21, 22, -8, -29, -25, 37, 28, 65, -23, 37, 0, -56, 62,
+  -7, 32, 41, 59, -38, 3, 0, 4, 19, 7, -13, 34, -3, -17, 7, -4,
+  -9, 8, -65, 37, -15, -31, -11, 8, 7, 19, 38, -44, 59, 9, 24, 11,
+  -57, 36, 5, -24, -41, 25, -22, 21, 14, 14, -31, 8, -53, 17, -29, 22,
+  -53, 29, -11, -7, 15, 8, 29, 9, 29, 50, 65, 23, -10, 30, 37, -51,
+  38, -32, -10, 29, -44, -45, -10, 9, -8, 0, -46, -51, -22, -25, -3, -44,
+  -41, 44, 0, 8, 57, 0, 22, -87, 10, -46, 3, 26, 9, -26, 0, 4,
+  -22, 39, -62, -3, -29, 16, -67, 27, 47, -4, -9, 48, 29, 63, 21, 22,
+  -61, -7, -11, -7, -34, 30, 14, 28, -44, -22, -4, 15, 13, 68, 22, -17,
+  21, -12, -3, -13, -11, 16, 16, -49, 42, 4, 13, 21, 29, -50, 33, -4,
+  -28, -56, 43, -12, -23, -7, 26, -31, -84, -81, -45, 7, -114, -26, 32, -50,
+  9, -50, -47, 45, 12, -6, 9, 18, -4, 0, -22, 8, 33, -24, 4, -79,
+  4, 29, -26, 46, 52, 4, -19, -15, -40, 15, -11, 3, 50, -51, 9, 65,
+  62, -24, -44, -16, -5, -26, 3, -57, -19, 33, 16, -120, 10, 62, -76, -51,
+  83, 0, -6, 16, 8, -12, -34, 8, -3, 54, 22, 33, 26, -57, -20, 7,
+  -109, -11, 47, -52, 86, 44, 40, 39, 47, -35, -53, -32, 66, -35, 12, -13,
+  -4, -51, -4, -4, 75, -30, 10, -65, 0, -25, 4, -6, -10, 17, 46, 27,
+  7, -59, -3, -127, 11, -61, -90, -40, -19, 29, -82, -9, 45, -8, -56, 15,
+  46, -69, 40, 69, -53, 0, -11, -8, -23, 74, -19, 52, -18, 44, -24, -72,
+  4, -59, -28, -45, 70, 38, -4, -39, -25, -53, 36, 8, 4, -59, 87, -22,
+  48, -77, -30, -21, 11, 0, 33, -28, 48, 3, -4, 6, 17, -21, 34, -85,
+  28, 52, -20, 0, -11, -29, 13, 0, -27, 29, 30, 4, -32, -8, -16, 33,
+  14, 32, -43, -24, -72, 15, -56, 16, -13, 46, 10, 33, 0, 39, 44, -11,
+  -65, 6, -81, -31, 29, 16, 18, -80, 82, 21, 18, 45, 37, 0, -37, -25,
+  9, -40, 59, 53, -4, 42, -43, -28, -26, -25, -38, -18, -37, -38, 3, 34,
+  -48, 52, -44, -29, -38, -58, 16, 44, 42, 15, -76, -4, -38, -45, -10, -15,
+  -23, -52, 22, -12, -34, 7, -45, -55, -13, 0, 22, -78, 26, -9, -32, 36,
+  9, 62, -14, -38, -25, 6, -99, 36, -36, 14, 58, 40, -41, -3, 8, -19,
+  61, 15, -41, -89, -30, 0, -62, -12, 40, -3, -46, 23, 3, 55, -50, 27,
+  52, -4, -58, 42, -93, 45, -32, -31, -23, -15, -36, -17, 13, -17, 76, -18,
+  65, -36, 6, 8, 8, -70, 30, -43, 10, -54, 10, -111, -38, -61, 20, -21,
+  44, -36, -95, -38, -16, -50, 0, -62, -86, -39, -58, -16, -37, -10, -12, -44,
+  48, 80, 0, -57, -52, 0, -38, -56, -92, 43, -103, -15, -44, -8, -62, 48,
+  8, -30, 11, 5, -9, -12, -9, 10, 8, -2, -18, -12, 14, -25, 14, -24,
+  -33, 0, -19, 2, -23, -5, -25, 0, -2, 19, 21, -14, 34, 12, 26, 18,
+  7, -15, 42, -21, 4, -34, 15, 3, -2, 4, -5, 10, 25, 29, 7, -12,
+  2, -54, -35, 10, -27, -10, -10, -10, -20, -5, -29, -26, 22, 21, -19, 0,
+  -36, 2, -20, 5, 18, -23, -7, 7, -38, 4, -14, 7, 19, -25, 5, 8,
+  35, -24, -29, -11, -12, 3, -20, -4, 37, -19, -19, -10, 10, -33, 17, -27,
+  21, -6, 23, -15, -4, -33, -2, -21, -4, 4, -2, 0, -18, -10, 20, -24,
+  2, -12, -18, 21, -10, 6, -34, -44, -22, -25, -12, -3, -18, -7, 0, -11,
+  -15, 2, -4, -7, 12, -12, 21, -5, -8, 20, -54, 21, -44, 34, 31, -30,
+  8, -11, -10, -16, 2, -12, 31, -13, -28, -23, 12, 10, 6, -7, -9, 35,
+  -60, 11, -3, -19, -9, 34, -34, 13, -12, 8, -54, -3, -20, -38, 25, 9,
+  -38, -14, -28, 21, -14, -2, -3, -12, -34, 17, -2, -16, 6, -25, -15, 6,
+  -13, 9, -19, -12, -12, -19, -39, -24, -17, 28, 11, -26, 9, 14, 0, 28,
+  23, 49, -8, -40, 6, -7, 4, 13, -39, -30, -26, 35, 16, 12, -24, -2,
+  -29, -2, -8, -15, -9, 15, 27, -29, -24, -31, -10, -6, -31, -31, -9, 10,
+  -10, -16, -2, 35, -2, 35, 44, 25, 16, -2, -19, 0, 6, -32, 15, -17,
+  -13, -35, 32, 12, 30, 51, -65, 5, 21, -74, -2, 45, -42, -45, 14, -30,
+  5, 7, 0, 33, -75, -33, -27, -47, -50, 42, -24, -39, -8, 33, 63, 43,
+  -29, 9, -5, -21, -18, -39, 34, -34, 57, -127, 29, -4, -58, -15, 0, -7,
+  -36, -28, -35, -10, -55, 58, 3, 25, 30, 37, -37, -47, 50, -2, -42, 30,
+  -30, -41, -39, 5, -27, -9, -12, 22, 63, 2, 14, 14, 10, -29, -11, -12,
+  40, -42, 3, -16, -21, -17, -8, -2, 2, -8, 9, 39, -8, 10, 74, -35,
+  2, -17, -29, 32, 22, -43, -20, 10, 4, 10, -44, -21, 22, 25, -7, 0,
+  10, 22, 6, -25, -4, 10, -16, 0, 16, 10, 0, 13, -24, -25, -12, -26,
+  8, 13, 9, 7, -45, -12, -30, 22, 32, -18, -14, 19, -21, -27, -31, -18,
+  -5, -42, 32, -2, -10, -17, 16, -11, 22, -4, -19, -16, 14, -10, 2, 43,
+  -7, 6, 18, -17, -2, -27, -20, 23, 0, -23, 46, -50, -20, 23, -43, 19,
+  -7, -30, 10, 27, 12, 8, 52, -20, 12, -2, 0, 16, 4, -46, -8, 9,
+  -11, -35, 7, 0, -21, -23, 0, 2, -11, -42, -7, 14, 28, 0, 63, 6,
+  -56, 4, 0, 29, 10, 7, -31, -54, -11, -17, 35, 28, -29, 14, -41, -27,
+  -21, -8, -29, 25, 18, -5, 32, 3, 14, 8, 7, -35, -29, 34, 14, 5,
+  -26, 0, -12, 8, -51, -12, 18, 7, 10, 2, -21, 10, -50, 16, 54, -34,
+  19, -15, -20, 9, -18, 0, 4, -29, -48, 18, -7, 9, -24, -27, 23, 26,
+  -10, -13, 7, 9, 37, 5, -18, 2, -31, 17, 17, -20, -5, -64, -9, -2,
+  -14, 12, -5, 30, 29, 36, 2, 28, -12, 15, 15, 16, -29, 2, -34, -16,
+  2, -2, 10, 50, 4, -46, 5, -17, -30, 29, -12, -29, 0, -14, -17, 9,
+  5, 34, -53, -23, 51, 13, 13, 21, -21, -43, 18, -7, 12, -58, 15, 0,
+  -4, -16, -39, -76, -9, -11, -15, 31, 16, -18, -30, -15, -7, 24, 16, 14,
+  -10, -20, 4, -3, 45, -7, -7, -21, -8, -39, -35, -23, 22, 27, -36, -52,
+  31, 0, -20, -6, -3, -15, -11, 24, -14, -29, 12, -18, -18, -56, 17, -8,
+  -27, 16, -32, -31, 55, -30, 10, 24, -72, 11, 5, 60, -40, -13, 21, -3,
+  -4, 41, -24, -22, -42, -4, -9, 34, 39, 27, 5, -49, 7, -3, 6, -28,
+  -61, 4, 4, 27, -29, -7, 35, -33, -17, 0, -28, -38, -19, 38, 0, 7,
+  41, 14, 17, -6, -18, -21, 11, -24, -35, 10, 3, -44, -34, -30, -36, 21,
+  14, 75, -8, -5, 64, -61, -10, 52, -18, 26, 18, -20, -60, -32, 15, -60,
+  -72, -13, -2, -35, -63, 2, 32, 12, 37, 24, -7, -38, 21, 0, -40, 8,
+  14, -24, 7, 14, 10, -7, 7, -19, -3, -69, -70, -8, -6, -55, -81, -15,
+  14, -23, -3, 14, -23, 24, 78, -17, -52, -17, 0, 11, -66, -10, 22, -13,
+  27, 9, -66, -33, 30, -8, -20, -41, 21, -6, -5, 34, -22, -42, -10, 3,
+  40, 28, 0, -73, 24, -51, 18, 43, 18, -21, 0, 0, -16, 7, 22, -20,
+  -68, -24, 52, -24, 6, 47, 21, -53, 8, -30, -66, -21, 32, -65, 39, 15,
+  -45, -14, 20, -39, -18, -6, 26, -15, 43, 12, 15, -62, -26, 43, 5, -35,
+  -19, 9, 42, 18, 68, 13, -10, 17, -18, -20, -21, -3, 5, 19, 18, -94,
+  -4, 38, -12, 51, -6, -30, -26, -15, -3, 27, 20, -70, -34, -55, 50, 76,
+  24, 31, 7, -22, -87, 17, -4, 49, 0, -41, -7, -23, -19, -33, 23, 22,
+  -127, -29, 23, -78, 18, 12, 19, 2, -78, 17, 68, 21, 0, -66, -27, 21,
+  11, 12, -11, -15, -43, -10, -20, -24, -6, -20, 10, 10, -7, -52, 33, -11,
+  -43, 41, -17, -38, -15, 13, 53, -6, -24, 12, 0, -38, 21, 27, 0, 42,
+  -24, -9, -45, 32, 13, 24, -14, 7, -3, 0, -63, 23, -42, 60, -13, 17,
+  -3, -63, -6, 25, 6, 39, 49, 27, -9, -7, -15, -48, -26, 7, 19, -19,
+  0, 0, 5, 0, -9, -30, -35, -62, -27, 0, 18, -27, -45, -10, 3, 6,
+  -14, -47, 0, -48, -24, 34, -38, 31, 8, -9, 7, -17, -5, -31, 12, 11,
+  -24, -20, -37, -30, -77, 2, 32, 35, -14, -25, -3, -17, -54, -35, -33, -30,
+  24, -9, 9, -36, 15, 33, 4, 5, -20, 19, 33, 11, 3, -26, 39, 0,
+  -22, -19, -27, 15, -77, 18, 25, 45, 3, -26, -21, 47, -27, -36, -13, 29,
+  -40, -66, 2, 64, -48, -4, 15, -3, 18, 33, 32, -17, 32, -10, -3, -14,
+  -31, -22, -22, -11, 26, -12, 56, 37, 3, 55, 52, -21, 45, -22, 29, 32,
+  -48, 6, -15, 44, 26, -12, -49, 2, 3, -36, 18, 21, -5, 63, -41, -35,
+  -8, -25, -40, 18, 43, 45, -35, 14, -18, 46, -51, 30, -47, -13, 28, -14,
+  -11, 13, -17, -60, 30, -4, -6, 31, -16, 51, 27, -6, -2, -10, 71, 8,
+  -7, 11, 70, 32, 10, -20, 42, -21, 59, -47, -28, 25, -26, 16, -10, -49,
+  3, -6, -46, 6, -23, -21, -63, 0, -14, 36, 6, -51, -29, 20, 17, 51,
+  -27, -25, -10, -37, -58, -46, 14, 37, -11, -8, -9, -12, 38, -15, 19, 33,
+  75, -11, -31, 40, 30, -5, -48, -22, 19, -16, 45, -24, -44, 0, -17, 43,
+  -3, 24, -27, -2, 6, -2, 25, 44, 25, 5, 3, 45, 23, -32, 35, -20,
+  19, -31, -13, -13, -29, -81, -30, -31, -21, -37, -32, 6, -28, -48, 28, -53,
+  -29, -11, -29, 28, -27, -18, 52, 28, 43, -44, -30, -48, 20, 0, -12, 44,
+  -7, 3, -37, -6, 11, 38, 61, 36, -17, -49, 27, -31, 8, 65, -39, -5,
+  6, 30, -10, 37, 46, 33, 6, -10, 25, 25, 6, 4, -6, -15, 9, 27,
+  37, 3, 0, -40, 8, -62, -61, -15, -49, 4, 11, 8, -45, 15, 20, 10,
+  -54, 8, -12, -32, -73, 23, -20, 3, -3, 5, -35, -9, -7, -35, 23, 18,
+  -81, 37, 11, -14, 24, 12, -13, -17, 12, -25, -7, -37, -15, -15, 56, 23,
+  -6, 18, -23, 0, -9, -22, 0, 8, 30, 25, 44, 32, 23, 17, -15, -33,
+  -53, -18, -18, 35, 26, -27, -10, -35, 23, -20, 30, 17, -66, -78, -13, 24,
+  -5, 8, 10, -37, -31, 7, -5, -50, -43, -10, 0, 15, 25, 15, -60, -5,
+  16, 65, 0, 26, -5, 14, 0, 0, 24, 52, 43, -52, 54, 12, 14, 28,
+  -34, -12, -33, 32, -17, -29, -32, 0, -13, 10, -3, 15, 9, 2, -12, -42,
+  -34, -36, 10, -23, -8, -24, -10, 17, 0, -7, -8, 41, 5, -39, -4, -10,
+  -2, -17, 22, -69, -46, -30, 46, -59, 19, 31, 30, 76, -50, -67, 23, -41,
+  -10, 40, 15, -57, 16, 36, 37, 25, 7, 11, 36, 34, 0, -6, 6, 15,
+  -15, -38, -47, 34, 20, 29, -25, 19, 23, 45, 0, 4, 40, -22, 9, 49,
+  -25, 23, 13, 10, 50, -59, -40, -7, 23, -42, 38, 27, -19, -30, -28, 12,
+  29, 17, 7, 9, 127, 41, -14, 41, -24, -36, -30, -76, -5, 23, -49, 8,
+  3, -9, 17, 23, 3, 29, -16, -19, 7, 8, -38, -3, -23, -22, -87, -18,
+  40, 40, 3, 24, -14, -22, 60, -4, -28, -25, 57, 36, -14, 22, -18, -27,
+  -31, 44, -37, -13, -48, 56, 20, -7, -60, -42, -48, -50, 31, 6, 4, 7,
+  -7, -84, -10, -37, 65, 34, -7, 34, 19, -77, -2, 0, -5, -29, 19, -33,
+  -13, 17, -2, 0, 3, 10, -13, -44, 5, 8, 5, 8, 29, 12, -22, -13,
+  9, -10, 70, 29, 35, 0, 13, 6, -8, -45, -3, 40, -20, 32, 41, -29,
+  -9, -13, -26, 10, -34, 38, 81, -2, 0, -7, -35, -46, -2, 27, -39, 0,
+  -49, 14, -10, -30, -12, 14, 34, 19, -11, 21, -42, 21, 9, 17, 19, -26,
+  20, -3, -13, -17, -3, 14, 8, 11, -12, -3, -34, 45, 39, -22, -34, 8,
+  49, -14, 37, -27, -9, 4, -22, -36, -40, 22, -28, -23, 46, 12, 21, -47,
+  43, 21, -3, 8, -53, 75, 20, 33, -91, -50, 13, -46, 2, -3, -11, 2,
+  0, 25, 33, 18, 85, -25, 11, -28, -24, -5, -33, -18, 18, -23, -7, -46,
+  -59, -20, -9, 89, 8, 24, -24, 17, 21, -5, -43, -18, -25, 65, -36, 68,
+  -65, 28, 17, -73, -46, -2, -13, -17, 18, 22, -16, 15, 26, 37, -9, -47,
+  65, 28, -5, 5, -5, 19, -27, 9, -18, -35, 21, 0, 26, -21, -31, -12,
+  32, 3, -5, 17, -11, 45, -4, -9, -38, -2, -18, 3, 13, 16, -31, -27,
+  -12, 32, -33, 32, 15, 16, -12, -45, 13, -33, -28, 2, -31, 26, -21, -14,
+  20, 2, 25, -5, 35, -8, 9, 4, 2, -2, 44, -14, -44, 53, 19, 32,
+  -15, 36, 25, 21, -7, -10, -3, -12, -12, 31, -8, -29, 16, -11, 19, -16,
+  -9, 11, 14, -11, 4, 0, -39, 18, -3, -7, -20, 17, -53, 0, -18, -27,
+  -28, -64, -43, -14, 10, -16, 5, -39, 31, -36, -9, 15, -35, -52, -18, -52,
+  43, -7, 50, 37, 14, -46, -15, 16, 19, -37, 3, -11, -3, -49, 39, -4,
+  26, 17, -57, 21, 7, 51, 6, -37, 24, -27, -23, -6, -18, -45, -19, 18,
+  -11, 29, -29, 7, 47, 2, -15, -3, 3, 27, 39, 46, 23, 96, 4, 27,
+  49, -24, 10, -16, -13, -11, 2, 0, -16, 10, -21, 20, -35, 0, -13, 52,
+  6, 32, 38, 16, 8, -50, -3, -14, -64, -54, -62, -21, 11, -5, -28, -6,
+  61, -36, -30, 33, -15, 41, -70, -31, 39, -8, 23, -23, -11, -14, -16, -16,
+  -57, 29, 2, -24, 11, 37, -58, 32, -15, -15, 59, -14, -32, -33, -61, 7,
+  -15, -21, 8, 16, -35, 5, 2, 16, -25, -15, 13, 17, -10, 12, 24, -21,
+  -26, 9, 19, 11, -33, -27, -36, -6, 48, -37, 3, -20, 8, -35, -33, 25,
+  47, -15, 12, -35, -45, 43, 19, -19, 61, -27, -10, 2, -18, -39, 37, -18,
+  2, 11, -5, 2, -29, 6, -11, -15, -18, -24, 31, -43, -26, 19, -9, -7,
+  -9, -21, 4, -24, -5, -6, -80, -73, -22, -39, 6, -27, 2, 6, -45, 12,
+  -32, 15, 19, 7, -76, -15, -18, -53, -12, -54, 12, 7, -8, -30, -44, -23,
+  15, -32, 12, 12, -22, 41, 22, 4, -5, 0, -35, -23, -33, 51, -10, 0,
+  25, 3, 70, 20, -51, -30, 58, 6, 10, -29, -13, 71, 15, -49, 24, -22,
+  -28, 3, -35, -32, 41, -2, -10, 13, 11, -15, 19, -12, 20, 46, 55, -57,
+  23, 4, -3, 16, -5, 19, 24, -18, -7, 19, -53, -2, 35, 28, 44, -17,
+  -15, -41, 5, 5, 80, -46, -51, -25, 22, 8, 43, 0, -9, 17, -39, -16,
+  14, 8, -72, 13, -18, -4, -54, 24, -10, -12, -11, -3, 2, 30, 4, 0,
+  -3, -43, 14, 41, -13, -42, -10, -52, -4, -5, -9, -22, -18, 41, 34, -14,
+  29, -19, -25, -18, -30, -19, -3, -2, 2, -12, -53, -14, -22, -35, 3, 59,
+  9, -12, -7, 5, 15, 8, -35, -14, -15, 23, -8, -8, -2, -59, -10, 23,
+  39, 0, 7, 2, 127, 47, -21, 29, -18, 17, 35, 63, 15, 22, 57, -2,
+  0, 11, 39, 16, 43, -19, -42, 21, -2, 44, -19, -12, -25, 23, 45, 10,
+  35, 7, 9, 7, 60, -17, 0, -26, 12, -33, 39, -11, 19, -2, -3, 2,
+  -32, 15, -2, 33, 40, -15, -3, 25, 2, 12, -5, -16, 20, -17, 4, 27,
+  23, -55, -41, -43, 51, -15, -13, 9, -13, -2, -9, 66, -13, 19, 39, -51,
+  -3, 43, 21, 16, -8, -18, -17, 21, 20, 57, -13, 12, 37, -29, 13, 2,
+  -6, 13, -13, 5, 11, 8, 18, 14, 24, -5, 9, 21, 19, 44, 53, 11,
+  6, -12, 0, 31, -35, -48, 32, -31, -7, 0, 13, -2, 7, 62, -19, 23,
+  0, 3, -10, 35, 25, 7, 2, 30, -53, 53, -38, 36, 12, -16, 25, -11,
+  39, 3, -14, -9, 49, -15, -17, -3, -13, 0, 58, 23, 9, 3, 3, 19,
+  -43, -24, -98, -32, -12, -36, -17, -2, -27, -13, 0, 2, -9, 16, -10, 0,
+  13, -17, -37, 41, -6, -29, 7, 28, 3, -7, 20, 7, 3, -16, 31, 5,
+  5, -3, -26, 0, -29, 12, 20, 17, -12, -11, -33, 36, -2, 0, -3, -42,
+  28, 22, 19, 0, 35, 2, -14, -30, -3, 12, 17, 20, -29, 27, -42, 38,
+  -23, 11, -29, -8, -9, -43, 14, -7, 3, 19, 0, 2, 72, -8, 19, 46,
+  23, -19, -54, 68, -14, -12, 36, -2, -8, 21, 26, -11, 28, 13, -5, 34,
+  -8, -21, -21, 0, 25, 5, 7, 61, -26, 19, -25, 26, -22, -72, -3, -6,
+  -7, -37, -17, 28, -52, -13, 11, -15, -28, -12, 5, 25, 7, -13, 9, 14,
+  53, -11, 61, -18, 91, -21, 7, -32, -14, -38, 34, -22, -41, 8, 10, 5,
+  43, 8, -3, 46, -34, 9, 4, 7, 25, 0, -43, -11, -23, 13, -9, -21,
+  34, -12, -41, -15, 58, -17, 0, 44, -26, -53, -55, 46, -17, 6, 35, 28,
+  35, -22, 31, -3, 14, -24, -6, -27, 31, 9, 32, 6, 13, 17, -36, 35,
+  -40, -32, 36, -18, -22, 26, -17, -11, -33, 5, -24, 12, 6, 45, 3, -67,
+  -3, -17, 14, -5, -17, -35, -29, -7, -64, 28, -3, -31, -18, 29, -7, -10,
+  16, 12, -28, 20, 33, -37, 42, 64, -9, 11, -20, 10, -12, -6, -33, -92,
+  -11, 18, 24, -34, 9, -2, -17, -15, 13, -35, 7, -3, 31, -20, 18, 60,
+  13, 9, 7, -5, 28, -26, -68, 0, -30, 24, -20, 24, 0, -45, 0, 36,
+  -127, -53, 28, -54, -11, -20, -109, -24, -59, -28, -3, -31, -23, -23, -28, 16,
+  24, 39, -8, 25, -12, 25, 0, -24, -20, -19, -25, -13, -49, -41, -30, -17,
+  -74, 58, -40, 6, -12, 2, -29, 54, -64, 50, 7, 59, 7, -60, 36, 68,
+  -20, 15, 25, -18, -34, -41, 24, 14, 22, -24, -7, 39, -44, 42, -32, 2,
+  -17, -39, -20, 59, -29, 32, -7, 73, -45, 40, 29, -2, 15, 13, 14, 65,
+  -32, -33, 5, -27, 33, -52, -7, 44, -18, -19, -33, -3, 12, 13, 35, -22,
+  -4, 28, 9, -12, -12, -11, 31, 3, -8, 24, 36, -23, 4, 10, 0, -14,
+  7, 0, 43, 53, -53, 14, -34, 41, -25, 24, 0, 27, 3, -8, -13, -24,
+  -20, -14, 0, -8, -43, 26, -29, -14, 3, 9, -9, 34, -41, 13, 14, -13,
+  24, 0, -8, 25, 17, 15, 22, 74, -18, 17, -70, -20, 36, -22, -15, 39,
+  74, 12, 9, -19, 9, 4, -57, -9, 54, 32, 10, -51, 11, 3, 0, 25,
+  -46, 15, 108, 13, -28, 5, 7, 38, 49, -24, -14, -2, -12, 24, 41, -29,
+  17, 33, 54, 14, 34, -46, 11, 12, -8, 19, -3, 11, 5, 29, 31, -36,
+  53, -15, 0, -35, -25, -5, -66, 47, -3, 6, -13, 3, -32, -60, -15, 19,
+  -11, -34, 87, -28, -29, -7, 11, 0, 38, 38, 36, 6, 7, 0, 42, -55,
+  -13, 19, -7, 24, 25, -7, 24, -32, 41, -32, -20, 10, -53, -8, 13, 0,
+  -17, -36, -6, 38, -68, -20, -18, 2, 28, 5, -35, -22, -33, 61, 24, 5,
+  -32, 31, 7, 12, 12, 12, 16, -22, 0, 3, -14, -3, 23, -27, 19, 16,
+  13, 0, 11, -12, -11, -9, -35, -42, 5, 25, -14, 19, -15, -19, -23, -41,
+  -28, -2, -51, 22, -38, -11, 52, 15, 21, -10, 13, -12, -53, -18, -18, -2,
+  25, 0, 16, -20, -8, -8, 45, 13, -8, 65, 11, -8, 12, -12, 29, -5,
+  35, 0, -54, 0, -4, 5, 9, -16, -19, -21, -40, -12, -28, -80, -35, 21,
+  7, -26, -33, 50, 16, 16, -40, -42, -22, -17, -5, -11, 19, -16, -6, 33,
+  -25, 4, 7, 17, -35, -40, 16, -43, -10, -23, 13, -10, 0, 0, -33, -27,
+  38, -39, -5, 46, 30, -25, 17, 9, -11, -31, -11, -30, 14, 9, -2, -5,
+  -35, -17, 15, 7, 4, 5, 21, 0, 6, -8, -2, -22, 7, -36, 24, -34,
+  36, 20, 4, 3, 8, -10, -27, 40, 14, 8, 7, -11, 8, 9, 0, 5,
+  0, 14, -65, -15, -21, 4, -3, 21, 44, -15, 26, -23, -3, -25, 18, -5,
+  28, -21, 13, 28, -8, -25, -7, 11, -8, -22, 27, 23, -7, -24, 4, 20,
+  22, -37, 5, 16, -35, 9, -2, -25, -6, -3, 14, -15, -23, -18, 19, -24,
+  -33, 6, -24, -6, 22, 35, -51, -40, 12, 58, 21, -53, 21, 28, -14, 15,
+  6, -8, 0, 47, 35, 2, 39, -4, 23, 20, -26, -31, -24, 13, -21, -39,
+  0, 26, 16, 23, 22, 19, 10, -27, -45, 20, 0, -11, 2, 21, 0, 12,
+  17, 17, -39, -12, 20, -2, 0, 19, -47, 110, -26, -74, 21, 27, -52, 16,
+  40, -99, 4, -15, -27, 17, -59, 8, -31, -19, 69, 59, 27, 47, -83, -21,
+  6, -56, -68, -25, 65, 13, -74, 0, -36, 43, -51, -31, -9, 15, -15, -30,
+  -25, 10, -11, 59, -40, -63, -127, -40, -37, -51, -38, -34, 24, 18, 40, 5,
+  35, -40, 10, -35, 24, -26, 30, 0, 30, 18, -38, 0, -14, -27, 31, -47,
+  -53, -9, 22, -61, -5, 23, 13, -42, -2, 42, 34, -32, 13, 41, -26, -3,
+  -28, 20, 14, -37, -35, 4, 13, 30, 21, 3, 13, -23, 12, 30, -3, -27,
+  -47, -31, -27, 18, -16, -16, -31, 7, 34, 9, 8, 11, 5, 30, -22, 17,
+  5, -51, 19, 35, -27, 9, 7, 44, -19, -5, 9, -3, -7, 30, 28, -37,
+  30, 26, -13, -58, -8, -30, -43, -20, -27, 19, 25, -48, 44, -16, 17, 26,
+  28, -16, 24, 74, -6, -16, -52, 26, 31, -48, -42, -38, -53, -38, 6, -14,
+  -50, 24, -8, -41, -19, 33, -45, 11, -32, 42, 0, -17, -29, 36, -9, 39,
+  -5, 54, 27, 26, -47, -46, -19, 38, -11, -26, -2, 28, 2, -92, -43, 60,
+  40, 46, -49, -35, -22, -30, 35, 37, -7, -19, -25, -88, 15, 91, -11, 13,
+  6, -8, -3, -22, -50, 9, -71, 32, -28, -8, -26, -54, 3, -35, -63, -36,
+  25, 45, 67, -5, 24, 5, 14, 7, -98, -85, 16, 34, -41, -30, -2, -12,
+  27, 3, -29, 2, -51, -14, -65, -3, -30, 21, -28, -22, -30, -6, -38, -13,
+  -7, 32, 24, -18, -33, -28, 56, 8, -41, 19, -34, 43, 15, -34, -9, 18,
+  -28, -6, -65, -52, 21, 27, -10, 28, 21, -5, -3, -44, -94, -5, 3, 39,
+  19, 31, -59, 5, -19, -19, 14, -18, -45, -56, 0, 25, -46, 36, -4, 39,
+  2, 0, -7, 32, -53, 6, -35, 20, -12, 14, 2, 22, 6, 16, -15, 7,
+  -9, 3, -12, 26, -32, 2, 39, -23, -15, 5, 50, -10, -25, 23, 31, 44,
+  -23, 22, 25, -9, 13, -10, 38, 4, -2, 7, 49, -28, 11, -23, 38, 6,
+  -17, 24, -14, 34, 15, -22, 6, 2, -14, 2, -20, 19, -17, -25, 12, 2,
+  38, 18, -18, -8, -28, 6, -2, -3, 20, 38, -17, 14, -29, -11, -19, -12,
+  -21, -8, -36, 0, -22, 0, 10, 3, -13, 25, 6, 2, 8, 39, -15, 28,
+  39, -4, -18, 18, -40, -36, 3, -10, -21, -2, -17, 0, -16, 20, -8, -4,
+  -23, 0, 0, -18, 15, 0, 3, 18, 19, -14, -10, -15, -2, 14, 12, -13,
+  20, -39, 2, -15, -11, 2, -10, 17, 15, -5, -26, -6, -29, -45, -6, -14,
+  -12, -63, -18, -47, 7, -27, 12, 23, -28, -35, 25, -14, 21, -8, 13, 9,
+  -14, -20, -12, 29, 0, 20, -32, 17, 7, -18, -17, -17, -37, -14, -16, 8,
+  -34, 24, -17, -11, -29, 7, -90, -30, -29, -38, 0, -19, -37, -25, -16, 9,
+  -9, 26, 22, -34, 21, 0, -44, 14, -12, -12, -9, 50, 8, -3, -11, 0,
+  45, 18, -26, -42, 7, 6, 24, -15, 33, -13, -17, -22, -21, 20, 8, -25,
+  -25, -4, 25, -9, -5, 4, 52, -46, 23, -16, -43, -21, 21, -34, 5, -20,
+  -17, -26, 43, 2, 5, -10, -3, -16, 29, 32, 10, 0, -20, 3, -14, 2,
+  -40, -21, -37, -8, 127, -25, 38, 40, 40, 54, -11, -39, -12, -59, -26, -21,
+  87, -18, 20, 42, -5, -8, 24, 41, -37, -40, -62, -2, -47, -45, 44, 35,
+  -93, -5, -46, -13, 50, -24, -6, -19, -60, 5, -26, 0, -11, -29, -40, 29,
+  -17, -21, 10, 9, -12, 34, 15, -4, 0, 0, 5, -19, -26, 8, -20, 27,
+  49, 23, -46, -36, 81, -29, -15, -17, -20, 33, -23, 11, 0, -43, -36, -17,
+  54, -78, 38, -16, -34, -14, 17, 20, -35, 75, -23, 24, -42, 39, 21, -5,
+  -54, -49, -49, -11, 11, -18, 12, 6, -14, -27, -37, -26, -21, 27, -3, -20,
+  11, -68, 10, 7, 24, 10, 31, -54, -19, -34, -5, -15, 4, 8, 8, -31,
+  -25, -51, -18, 2, -18, 15, -35, 34, 2, -9, 6, 36, -21, -29, 15, -7,
+  27, 3, -28, 26, -12, -2, 5, -56, -13, 5, 43, -5, 0, -3, -26, 21,
+  -3, -2, 40, -27, -24, -2, -32, -13, 21, -27, -20, 12, -29, 38, -16, -14,
+  -28, -45, 7, -7, -41, 34, 46, -6, -2, -20, -34, 8, 0, 0, -32, 7,
+  -27, 8, 37, -32, -18, -21, -4, -3, 35, 50, -2, -3, 21, -43, -45, -31,
+  3, 16, 30, -34, 76, -2, 48, 23, -4, 38, 8, -22, 19, -20, 0, 23,
+  0, -44, -9, 18, 21, -34, 32, -17, -9, 59, -20, -28, -24, 2, 11, -57,
+  43, -52, -24, 0, 24, -15, -9, 8, 40, 8, 10, 15, -39, -46, -24, -15,
+  -25, -10, -13, -48, 81, 2, 19, -17, -5, -33, -15, -19, 27, -8, 13, -12,
+  51, 16, 22, -60, -12, 19, -2, -13, -17, 55, 23, -48, -19, -20, 10, 37,
+  -11, -25, -68, -20, -32, -38, -6, -19, -39, -5, -40, 0, -11, 47, -11, -59,
+  65, -38, -17, -18, -22, -17, 43, 18, 14, 24, 2, -17, -24, -11, -66, 4,
+  -41, 16, -19, -39, 9, 10, 52, 4, 55, -58, -18, -14, -5, 13, -11, -55,
+  -48, -3, 64, -49, 0, -43, -30, 35, 3, 50, 49, 56, 5, 73, 16, 3,
+  -66, -36, -38, -17, 23, 5, -65, -40, 49, 8, -14, 17, 72, -20, 10, -71,
+  21, -20, 24, -34, -21, 37, -65, 0, 18, 10, -6, 16, 16, 34, -5, -33,
+  -22, 41, 35, -39, -4, -44, -23, 11, 0, 0, -47, -24, -26, -30, -32, 17,
+  -44, 32, -12, -13, 0, 35, -12, -19, 3, 37, 72, 27, 35, 35, -57, 23,
+  -56, 20, -15, 30, 10, 3, 22, 36, 11, 34, -7, 2, -33, -17, -40, -3,
+  -42, -9, 0, -34, -12, -37, 95, -15, -35, 15, 12, -9, 8, 10, 35, -8,
+  3, 3, -16, 23, 0, -15, -13, 0, 9, 15, -5, 31, 3, -17, -29, -35,
+  -52, -3, 45, 3, -21, -2, -39, 9, 30, 40, -28, 6, -35, -14, 48, -9,
+  -14, -29, 46, -39, 3, 35, 61, 9, 11, 37, 61, 2, 49, 25, 23, -23,
+  -56, 12, 30, -62, 30, -9, -15, -32, -41, 0, -24, 23, -3, 34, 17, 19,
+  44, -32, -30, -21, -4, -44, -5, -99, -43, -50, 0, 69, 0, -50, 21, 73,
+  -30, -13, -45, 10, 49, 6, -75, -28, -51, 6, 10, 30, 9, 31, -6, 20,
+  -24, 40, 11, 19, -23, 35, 29, -28, 14, 25, -25, 88, 33, 0, 20, 33,
+  -25, -38, 18, 60, 12, -21, -27, 20, -32, 35, -67, -38, 0, -17, 22, -47,
+  17, -6, 95, -3, -52, -34, 57, -4, 9, -17, -3, 27, 54, -50, 26, -55,
+  4, 45, -42, 13, -107, -39, 24, 13, 11, -9, -41, -42, -40, 0, -70, 20,
+  70, -29, -83, -50, -7, 48, 0, 33, 14, 17, -100, 13, -13, 3, 37, -8,
+  14, -3, 0, -48, -15, 0, -8, 7, 35, -27, 33, 7, 56, 3, 35, -30,
+  -6, -86, -54, -31, 9, -21, 0, -117, -18, 70, -8, -27, 54, 10, 24, 29,
+  -114, 19, 0, -65, -15, 8, -18, -41, -11, -31, 15, -30, 12, -35, -41, -3,
+  -7, 40, 34, -25, 33, 48, 25, -21, 6, -11, -75, 6, 0, 72, -97, 15,
+  42, 17, 3, -62, 30, 12, -31, -17, 0, 10, -9, 28, 0, 118, 40, 11,
+  -11, 3, 24, -8, -17, 0, -54, 46, -28, -6, -16, -7, -56, -23, -42, 12,
+  -78, 52, -17, -59, -110, 29, 33, 3, -43, 31, -8, 65, -9, -10, 6, -40,
+  10, -18, -91, 11, -29, 8, -18, -19, 60, -28, 18, -28, 10, -92, 30, -18,
+  -18, -32, 24, -9, -12, 9, 15, 42, 0, -5, -21, -2, 13, -74, 27, 55,
+  8, 25, 49, -65, -44, 54, 18, 0, -21, -47, 55, -127, 0, 23, -16, 76,
+  11, -42, 0, 88, -37, 19, 33, 0, 38, -15, 3, -27, 7, -77, -38, 20,
+  10, -38, -91, -19, -56, -58, 18, -50, -6, 14, 7, -15, 23, 14, -37, 0,
+  14, -67, -101, -6, 15, 37, 57, -87, 50, 15, 33, -70, 75, -57, -32, 22,
+  -33, -54, -41, 13, -79, 52, -44, -25, 46, 0, -8, 24, 33, 69, 29, -85,
+  44, -13, 0, -29, -52, 25, 6, -25, 19, 0, -43, 39, -5, -7, 25, -17,
+  66, -13, 8, -28, -13, -5, 22, 66, 86, -62, 21, -66, -49, -45, 33, 23,
+  -21, 32, -27, 0, 15, 110, -4, -45, -9, 5, -46, 0, -38, -54, -40, 27,
+  -5, 3, -23, -15, -17, -7, -20, 34, 17, -39, -35, -7, 7, -16, -17, 3,
+  18, -52, -7, -15, -12, 2, -28, -54, 38, -18, -19, -23, 47, 23, 15, 0,
+  56, 0, 40, -21, 12, -31, -3, 27, -35, -32, 10, -18, 22, -42, -9, 7,
+  -13, 8, -6, -13, -26, -12, -43, 0, 28, -12, 17, 2, -10, 6, -12, -26,
+  -5, -21, 8, -27, -12, -24, -39, 7, -6, 8, -20, -7, -70, 28, -77, -6,
+  95, 64, 7, 12, -12, -11, -43, -12, -18, 26, 17, -17, -22, 10, 6, 0,
+  -30, -9, -36, 73, -6, -33, 14, 2, -16, 21, -30, -41, 0, -3, -32, -34,
+  -70, -39, -59, -3, -11, 26, 47, 38, 61, -2, 38, 7, 20, -22, -59, 21,
+  10, 21, -13, 20, -46, -17, -59, 7, -44, 53, -35, -23, -10, 16, 20, -11,
+  18, -21, -9, 9, 17, -48, -6, 21, -18, -24, 29, -51, 4, 36, -12, 38,
+  30, 23, 25, -26, 3, -17, 3, 9, 46, -59, 10, -8, -25, 13, -19, -17,
+  -13, -39, -45, -38, -57, 23, 54, -33, 20, -35, -35, 45, -43, -22, -14, 10,
+  -5, 12, -31, -30, 29, 47, 29, 10, 17, -47, -2, 91, -22, -41, 37, 6,
+  -18, 18, -45, -12, -14, -6, 0, -36, -31, -9, -15, 17, -25, 36, 3, 8,
+  23, 4, -11, 0, 31, 2, 10, -36, -49, -21, -108, 6, -34, 13, -63, 5,
+  -27, -14, -3, -30, -45, -40, -25, -7, 20, -5, 17, -49, 31, -26, 28, 34,
+  45, 15, -44, 7, 29, 47, 5, -84, -61, -61, -57, -127, -7, 9, 25, -22,
+  32, -6, 2, 37, 43, 6, 88, -27, 20, 24, -44, -31, -4, -17, 12, 76,
+  -63, 51, -11, -39, 40, 2, -41, -52, -30, -8, -41, 35, -100, 48, 57, -34,
+  -53, 64, 17, 13, -62, 17, -43, 33, -22, -5, -55, -56, 15, 0, 45, 47,
+  -5, 66, 41, -10, 8, 22, 2, 17, 41, 28, -82, 20, 0, 75, 17, -19,
+  -11, 80, 7, 9, -6, -24, -45, 69, 0, 44, 0, -25, 20, 0, 18, -5,
+  -17, 11, 40, -18, 34, 26, 34, 5, 5, -11, -71, 2, -16, -32, 0, -7,
+  -17, -11, -56, 35, 65, 26, 54, -2, 6, 2, 52, 22, -15, -45, -16, -13,
+  -8, -9, 3, -7, 21, -15, 24, -57, -15, -28, 5, -52, -2, 16, -25, 22,
+  -35, -40, 33, 28, 55, -22, 0, -51, -53, -21, 27, 23, -47, 56, -60, -46,
+  26, -21, -32, -16, -84, -38, -51, -52, -33, 13, -41, -16, 9, -34, 0, 26,
+  0, -22, -14, 57, 23, -26, 62, -68, 39, -35, 64, -49, -10, 45, 16, 5,
+  -50, 3, 44, 0, 12, 7, 20, 121, 55, 17, 20, 10, 36, 0, 15, 11,
+  -7, 12, -2, -120, -17, -22, 6, 15, 15, -6, 2, 14, -33, -33, -9, 8,
+  26, -30, 22, 97, 6, -90, 61, 14, 16, 37, -24, -30, -19, -74, -69, -67,
+  -7, -8, -45, 8, -3, -3, -40, 2, 42, 5, -40, 33, -61, -13, -14, -5,
+  -10, -21, -13, -5, 21, 37, 0, -13, -12, 53, -10, 33, -92, 56, -5, 3,
+  0, -9, 71, -9, 12, 13, 31, 75, -71, 24, 36, -48, 11, -23, 54, 52,
+  17, -17, -14, -21, -40, 0, 17, 38, 16, -21, -54, -49, 3, -29, -32, -22,
+  -13, 17, 0, 24, -54, 0, 11, -38, 22, 47, 32, -4, -13, 35, 5, 78,
+  7, -20, 12, -21, -62, -9, 0, -47, -25, -39, 2, -25, 27, 21, 64, -34,
+  0, 0, -4, 6, 33, -24, -16, -39, -48, 17, 5, -40, 2, 31, 14, 10,
+  -69, -6, -14, -35, 47, 7, 22, 0, -20, 0, 13, -4, -41, 32, -15, 45,
+  -9, -18, 19, 18, 16, -44, -20, -24, -24, -20, -8, 6, -29, 0, -9, -17,
+  -15, -31, -29, 14, -78, 2, 28, -41, 3, -3, -16, 6, -16, 32, 28, 18,
+  46, 20, -2, 23, -8, 14, 35, -31, -58, -22, -9, 61, -2, 0, -28, -38,
+  0, 0, -58, 37, 64, 9, 45, -13, 20, -10, 25, 2, 21, 2, -6, 34,
+  -6, 10, -5, 13, 48, -44, -10, 33, 24, 2, -25, 15, 5, -6, -4, 29,
+  -2, 26, 22, -9, -31, 44, 25, -22, 25, 18, -12, 0, 7, -56, 26, 8,
+  49, 37, 0, 12, 11, 7, -13, 73, -19, 22, 7, 3, 21, 56, 34, -28,
+  -6, -12, -24, -12, 35, 2, -22, 13, -8, -18, -3, 29, 23, 50, -24, 16,
+  -38, 52, -8, -46, 11, 25, 58, 13, -63, -7, 68, -2, 53, -15, 11, 27,
+  -35, -23, 0, 9, -55, -23, -9, 13, 27, -34, 14, 40, -32, 3, -19, 26,
+  36, 29, 13, 44, -27, 45, 37, -34, -14, 14, 2, 5, -8, 19, 54, 0,
+  0, 34, -34, 25, 32, 4, 16, -11, 51, -98, 0, -31, -64, -7, 27, -32,
+  0, -73, 16, 53, 37, 33, 61, 22, -37, 2, -16, 27, -17, -66, -31, -42,
+  -10, -17, 15, 21, 43, 0, -25, 54, 96, 55, 0, -25, -105, -127, -56, 0,
+  -43, 0, 4, -44, -46, -45, -62, 62, -50, -17, -2, -3, -44, -22, 9, -28,
+  -28, -18, -78, 20, 21, -2, -77, 30, 33, -13, -22, 17, -15, -40, -65, 52,
+  -28, -21, 5, -53, 0, 19, 31, -4, -39, -38, 33, 31, -17, -60, -31, 42,
+  54, 31, -31, 30, 23, -28, 12, -51, 14, 16, -31, -34, -21, 12, -19, -3,
+  0, -40, -42, -26, 25, -9, -48, -3, -10, 58, -23, -32, -8, 0, 11, 28,
+  -12, -8, -37, 7, -9, -38, -3, 4, -26, 18, -29, 21, 29, 20, -21, -47,
+  -78, -16, -21, 46, 21, 0, 38, -9, -42, 38, -25, 8, 7, 9, -9, 32,
+  0, 3, -19, -23, -12, -28, 30, -19, 16, 16, -12, 15, 21, -62, -12, 5,
+  82, 37, 9, 9, 25, -16, 13, -48, 2, -17, -2, -3, 6, 3, -37, -56,
+  -22, 8, -37, -22, -18, 31, -3, 4, -23, 20, -45, 33, -35, -60, 0, 11,
+  22, 16, -19, 0, 8, -5, 20, 22, 34, 38, 8, 34, -26, 3, 4, -44,
+  -59, 9, 5, -44, 35, -14, 58, -38, -25, 73, -24, 0, -21, -6, -31, -18,
+  53, 35, 33, -99, -16, -3, 40, -3, -65, 39, 25, -13, 21, 28, -31, 8,
+  -69, 4, -37, -15, -59, 47, -6, 25, 5, 65, 16, -4, -9, -107, -63, -54,
+  -6, -3, -32, 23, 8, 35, 14, 16, 47, 18, 46, 17, -7, 60, 29, -17,
+  15, -11, -22, -21, 16, -44, 62, 32, 49, -50, 2, -18, -21, 9, -21, 37,
+  13, -6, 18, -47, -5, -5, 0, 6, 5, 28, 30, -50, 23, 6, -48, 46,
+  0, -8, -31, -35, 62, -9, -3, -21, -13, 3, 6, -11, 35, -97, -15, -9,
+  91, -16, -13, -5, 37, -87, 58, 9, 16, 47, 25, 25, 22, -30, 11, -71,
+  3, -31, -48, 23, -34, -15, 30, -80, -18, -3, -10, -10, 5, 6, 23, -3,
+  -7, 9, 19, -57, -54, -23, -29, -9, -47, -18, -40, -20, -9, -24, -43, -28,
+  -68, 2, -26, 8, 67, -49, -18, -5, 3, -11, 38, -4, -3, -8, -33, 62,
+  55, -9, -49, 6, -23, -45, 116, -17, -52, -22, -27, -41, 10, -7, 10, -21,
+  -11, -9, -3, 51, -9, 38, -13, 17, 45, 9, -51, 17, -37, -16, 31, 6,
+  -40, 25, -29, 32, -27, -13, -20, 9, -29, 36, 17, 32, -9, 58, 9, 11,
+  20, -2, 0, 43, 16, -2, -42, 21, 53, -47, 17, -15, -16, -22, -49, 20,
+  31, 11, 44, -19, -3, -48, 37, 5, -26, -19, -12, 7, -21, -43, 17, 19,
+  -5, -22, -24, 10, 0, -33, -23, -48, -12, 46, -5, 34, -7, -65, 8, 31,
+  22, 57, 12, 3, -9, -15, -9, 46, 29, 39, 20, -23, -25, 85, 16, -45,
+  -58, -4, -15, 16, -22, -10, 105, 14, 11, -17, 14, -48, -22, -49, -13, -12,
+  34, -9, 12, 14, -29, -12, 71, -10, 43, 2, 0, -11, 55, 7, 24, 8,
+  -5, -106, -37, 43, -55, 18, -43, 45, -6, 9, -31, -7, 17, -36, -44, -11,
+  29, 66, -29, -51, -60, 0, -23, -34, -21, -33, 7, -23, 25, 61, -3, -17,
+  41, -7, -11, 24, 38, 0, -14, 0, 22, -41, 21, -23, 32, 19, 33, 52,
+  -24, -31, 3, -58, 41, -15, 45, 22, 0, 17, 15, 11, 3, -23, -29, -48,
+  -30, -37, 34, 10, -13, -18, 15, 24, 0, 63, 3, 104, -12, -29, -44, -29,
+  -22, 47, 0, -48, -27, -34, 73, -3, -42, 12, -15, -49, -69, -24, 65, 0,
+  58, 4, -82, 19, -99, 27, -63, 37, 34, 41, -98, -44, -10, -46, -39, 77,
+  -21, 63, -15, -92, 85, 12, 67, 17, 52, 5, 116, 44, -8, -30, -19, -32,
+  -19, 9, 13, 5, 68, -28, 28, -17, 12, 14, -80, 44, -22, -23, 0, 6,
+  18, 19, -68, -25, -54, -17, -23, -71, 3, 55, -7, -32, -11, -10, 34, -8,
+  -14, 2, -59, -24, -61, 37, 7, 42, 36, -55, -52, -17, -22, -44, -10, 37,
+  -24, 17, -12, -64, 6, 21, 34, 12, -9, 2, 27, -37, -16, -23, 19, 35,
+  3, -78, 5, 13, 17, 30, -5, -10, 6, -34, 8, -30, -15, 71, 39, 71,
+  -51, -16, 2, -51, 15, -36, 12, 22, -5, 58, -15, 0, 9, 7, 12, -17,
+  -41, -13, -11, -11, -3, 29, 18, 42, -3, 41, -24, -19, -29, -22, 81, -40,
+  7, 20, 55, -42, -3, -57, 26, 17, -32, -46, 36, 2, 34, -3, 22, 16,
+  -19, 3, -11, -15, 21, 18, 15, -10, 0, -17, 3, -27, -102, 3, 13, 71,
+  69, -28, -7, 32, -12, -44, -18, 37, -79, -48, -17, 17, 16, -55, 3, 17,
+  0, 15, 33, 59, -54, -44, 56, -12, -59, 22, 0, 0, 35, -35, 0, 84,
+  51, -86, -6, 14, -64, -57, -127, -24, -9, -5, 33, -67, 3, 46, -27, -16,
+  -27, -37, 32, -20, -26, -43, 5, -17, 84, 48, -5, 17, -25, -32, 26, 6,
+  7, -88, 12, -48, 42, -34, 26, 37, 50, -51, 5, 26, -14, 10, 25, 6,
+  -41, -2, 11, -16, 45, 20, -11, 39, 36, 3, 17, -38, -16, -41, 16, 0,
+  27, 17, 52, 14, -6, 12, 49, -10, 43, 27, -18, -7, -42, -36, 39, -32,
+  -3, 58, 31, 27, -10, -15, -3, 69, 18, -3, -15, 24, -6, -19, 6, 7,
+  -8, 18, 34, 41, -7, -22, 10, -40, -46, -14, -15, 20, 16, -32, -18, 29,
+  24, 0, 39, 13, -34, -20, 16, 43, 52, -55, -16, -29, 49, -22, -19, 93,
+  -16, 10, 37, 3, -44, -31, 83, -25, -10, 20, -66, 19, -18, -46, 6, -22,
+  19, -105, -9, 36, -85, -9, 9, -32, -21, 10, 3, 0, -23, -64, -36, -3,
+  21, -37, 68, -41, 7, 13, -3, -36, -18, 14, 29, -47, -13, 24, -40, -20,
+  -28, -8, 17, 13, -11, -3, -12, -41, 52, 6, -53, -2, -11, -6, 57, -43,
+  -36, -43, -20, 10, -10, 52, 0, 6, 17, 17, 24, 8, 34, 4, 3, 19,
+  -54, -40, 0, 0, -80, 35, 38, -40, 18, 43, 3, 27, 3, -98, 0, -53,
+  67, -44, 6, -26, 28, -9, 27, -40, -83, -42, -3, 51, -38, 64, -7, -29,
+  -60, -23, -22, 28, -30, 57, -21, 0, 26, -29, -24, -73, -86, 41, -4, 26,
+  -72, -17, 0, 0, -27, 10, 39, 20, 101, -6, 10, -38, 3, -15, -20, 22,
+  -22, 29, -9, 24, -60, -12, 62, 61, 25, 10, -6, -4, -47, -11, -21, 17,
+  8, -37, 31, 4, -80, -31, 31, 18, -31, -60, 6, -20, -54, 36, -7, -56,
+  40, -26, -82, 28, -34, 3, 53, 14, -39, -3, -45, -24, -37, -16, -8, -35,
+  108, -10, 7, -49, 14, 7, 57, 6, -47, -28, -14, 24, 0, 0, 42, 13,
+  44, 22, -127, 15, 15, -83, 0, 36, -53, 33, -36, -126, -53, -53, 33, -3,
+  -13, -122, 25, -71, 38, 11, 3, 4, 92, -14, 6, -44, 13, -100, -76, -49,
+  28, 49, -13, 9, 75, -6, -66, 33, -26, 93, 16, -15, -52, 54, 8, 12,
+  -44, 47, 17, 84, 72, -80, -35, -20, -47, -20, -101, -11, -25, 66, -3, 0,
+  22, -58, 12, 36, -70, -21, 15, -53, 63, 13, -30, -20, 23, -57, 33, 13,
+  34, -30, 40, -63, -45, -9, -34, -54, -46, 50, 6, 24, 11, -16, -87, -43,
+  -36, -56, -91, -63, -15, 6, 25, -49, 62, -6, -65, -7, -15, -16, -42, 12,
+  8, -60, -27, 10, -3, 7, 13, 6, -17, 11, -24, -5, -3, 19, 23, 25,
+  -38, -33, -12, -24, -30, 59, -3, 0, -11, 93, -12, 16, 0, 4, 33, -67,
+  101, 22, 25, -48, -35, -22, -17, 0, -34, 7, 0, -47, -30, 36, -18, -115,
+  -16, -28, -30, 13, 86, 40, 21, 16, 0, -58, -41, -32, -7, -35, -34, -61,
+  -44, 3, -7, -42, -10, -28, 57, 40, 20, -3, 10, 48, -37, 8, -25, 22,
+  69, 112, 50, -66, -35, -24, -35, 32, 7, 50, -33, -4, 0, -42, -90, -57,
+  8, 37, 40, -7, -28, -2, 3, 76, -21, 35, -38, -54, 3, 0, 65, 52,
+  28, 0, -61, 57, -11, -17, 0, 49, 59, -32, -16, -22, -37, -10, 0, -32,
+  100, -93, -122, -23, 0, -7, 26, -20, -17, 48, -14, 62, -25, -66, -23, 41,
+  9, -44, -22, -42, -25, -32, 21, 8, 18, 0, -39, -20, -23, -38, -9, 10,
+  -67, -18, -31, -22, -24, -15, -75, -25, 0, 21, -15, 0, 21, 8, -80, -10,
+  0, -41, -43, 0, -41, -52, -8, 43, -46, -23, -37, -12, -19, 10, 99, 12,
+  -16, -37, -3, 10, -34, 3, -9, -40, 37, 20, 14, 62, 0, 27, 11, -41,
+  -15, -48, -22, 28, 0, -12, -30, -28, 52, 29, 19, 31, -11, -127, -2, 18,
+  40, -12, -2, 0, 22, -16, 27, -25, 5, -6, -14, -5, -15, 87, 9, 20,
+  -37, 38, -68, 35, 6, 0, -71, -21, -13, 13, -13, -2, -18, -17, 21, 38,
+  -47, -23, 34, 8, -21, 49, 31, 7, 3, 4, 27, -4, 2, -39, -11, 24,
+  12, -60, -7, 21, 19, -18, 35, 13, 3, 8, 0, 9, 2, -44, -5, -50,
+  -13, -37, 11, -38, 41, -43, 13, 6, -14, -14, -14, -16, -17, -19, -6, 10,
+  47, -26, 20, -7, 41, 4, 3, 2, 31, 25, -45, 13, 6, -20, 18, -16,
+  -3, 16, -8, -5, 62, 25, 34, -16, 21, -20, -33, 17, 2, 45, -29, -15,
+  25, -28, 0, 7, 23, 5, -28, -13, 27, -10, -12, -21, -5, -47, 40, 37,
+  23, 3, 24, -23, -11, 10, -5, -42, 17, 19, 7, 5, -4, 16, 14, 8,
+  0, -2, 10, 7, 9, 7, -29, -4, 26, 43, 25, 2, -41, 35, 39, -41,
+  6, 42, -34, -25, -51, 5, 0, 4, 29, 22, -16, 27, 19, -12, -7, 20,
+  32, -20, 2, 79, -19, -51, -55, 28, 25, -3, -7, 64, -23, -12, 31, 42,
+  -13, -32, 33, -47, 19, 16, -48, -23, -7, -33, 0, 45, 19, -6, -17, 13,
+  -6, 38, -7, 37, -44, -2, 22, 38, -10, -38, 45, 11, 9, -32, 24, 29,
+  25, 60, -37, 10, -8, -30, -14, 58, -16, 27, 8, 19, 10, -42, 40, 49,
+  17, 34, -12, 19, 70, -12, 30, 6, 30, -3, 56, -15, -23, -47, -38, 37,
+  7, 3, -22, -58, 25, -47, -75, 73, 24, 72, 2, -42, -2, -65, 26, -44,
+  44, -22, -41, 12, -23, 25, -77, 36, -23, 55, -48, -33, 26, 5, 48, 61,
+  -53, 68, -19, -38, 16, -60, -34, -2, 3, 11, -41, -29, 19, 36, -20, -24,
+  -17, -11, -19, 77, 0, -5, 16, -13, 74, -13, 21, 6, -30, -6, -24, -8,
+  -20, 29, -38, -15, 3, -28, -21, 0, -29, 17, 2, 13, -48, -3, 34, 44,
+  -31, 56, -31, -5, 3, -27, 38, 19, 8, -5, -16, 17, -6, -17, -27, -14,
+  -28, 39, 5, -58, -5, 22, -31, 24, 0, -4, 68, 13, 60, -27, -9, 7,
+  -12, -11, 7, 5, 19, -32, -2, 38, 30, -8, -40, -9, 30, -24, 16, 3,
+  23, 6, 13, -29, 54, 5, -19, 14, 36, 14, 32, -48, 2, 34, 34, -36,
+  -72, 40, 78, 47, 73, 22, -29, 38, -31, -5, 92, 4, -50, -17, -33, -16,
+  22, -3, -3, 36, -11, -38, -10, -20, -32, -29, 14, 17, -50, 51, 22, 17,
+  44, -17, 12, -14, -66, 0, -5, -32, -16, 21, -68, 15, -9, -53, -26, 37,
+  59, 32, -9, 12, 14, 9, -24, 17, -22, -25, 0, -16, -10, -62, 3, 15,
+  -9, -10, -24, 40, -6, 25, -22, 2, 38, -5, 0, -13, -15, -7, 68, 25,
+  35, -39, -11, -28, 11, -68, -10, -18, -21, -35, 25, -23, -5, 0, 13, -2,
+  0, 14, -10, 40, 12, 12, 21, 13, -36, 18, 2, 55, 11, 3, -33, 5,
+  46, 43, 7, 3, -27, 26, -11, -31, 7, 25, 43, 40, 8, 50, -43, -13,
+  -106, 18, -14, -15, 26, -27, 26, 4, 3, -30, -3, -13, 18, -5, 33, -5,
+  -16, -21, -11, 8, 21, -16, 65, 2, -8, 18, -19, -27, 17, -3, 22, -32,
+  40, -3, -9, -8, 21, 6, 0, 8, -24, 2, -8, -5, 8, -3, 36, -30,
+  -29, 10, 0, 0, -17, -2, 17, -13, -34, 49, -31, -9, 43, -39, -25, 18,
+  -53, 16, -9, -35, 31, 4, -6, -55, -18, 0, -23, 32, 31, 16, -19, 6,
+  -36, -56, 17, 27, 24, -51, 49, -14, -26, 12, 10, 4, -36, -13, 30, -11,
+  -11, -18, 13, -31, 56, -35, -25, -11, 27, -16, -23, 16, -20, 32, -21, -23,
+  47, 26, 30, -13, 22, 15, 19, -45, -41, 2, 22, 35, 15, -19, 10, 27,
+  -3, 9, 48, 66, 8, 8, -20, -19, 27, -31, 17, 15, -5, -42, -27, -4,
+  -25, 0, 7, -9, -36, 5, -49, 24, 14, 12, 15, -47, -17, 5, -22, -2,
+  -20, -18, -15, 19, -45, -12, 4, -14, 27, 35, -15, -14, -14, -34, 29, 2,
+  -6, -10, 36, 31, 5, -9, -12, 33, 21, 12, 12, -5, 0, 67, 20, -16,
+  -42, -21, 27, 11, -8, -12, 40, 6, -30, -11, -20, 10, -68, 2, 58, -10,
+  -76, 7, 28, -32, 0, -39, -43, 34, -28, 20, 0, -15, 11, 16, 2, 7,
+  51, 56, 15, 58, 0, -49, -14, -3, 59, 7, 42, 16, -18, 5, -21, -19,
+  -32, 15, -20, -18, -41, -5, -7, -13, -6, -10, 8, -9, 26, -28, -23, -5,
+  -83, 5, 33, -13, 16, 8, -20, 38, -27, 18, 14, 3, -52, -11, 8, -36,
+  -56, -37, -2, 25, -19, -10, -37, 55, -21, 8, 0, 11, -58, -35, 16, -9,
+  9, 8, 9, -8, 21, -10, 12, -28, 78, -30, -8, -11, -39, -58, 50, -14,
+  -65, 23, 10, -47, 46, -3, -24, 25, -6, -20, 24, 33, -21, -17, 0, -50,
+  -58, -39, -60, 37, 3, 16, -57, 11, 9, 76, -26, 32, -52, 29, -42, -36,
+  11, 42, -17, 16, -14, -34, -49, 30, 54, -49, 70, -6, -15, 43, -32, -13,
+  -26, 10, -52, 6, 14, -8, 23, 0, 20, -12, -23, -8, -2, 24, 38, 0,
+  44, 3, 36, 21, 15, -5, -2, 3, 6, 49, 4, -40, 7, 6, 28, 5,
+  17, -7, 6, 24, -24, -4, 49, 0, -32, 36, -45, -17, -24, 24, 21, -48,
+  -20, -14, -19, -25, -24, 7, -3, -28, -7, 20, 17, -6, 17, 40, 2, 24,
+  -48, 23, -30, -21, 35, 6, 12, 25, -2, -35, 4, 8, -39, -21, -8, 12,
+  0, 31, 18, 10, -24, -11, -14, 25, -24, 25, 22, -17, -6, 3, 46, -48,
+  -44, 11, -42, -35, -3, -2, -26, 34, -7, 7, 23, 2, -29, -20, -64, -18,
+  -25, 40, 19, 25, 10, -34, -43, -28, -42, -4, 41, 30, -30, 11, 18, -4,
+  26, -5, -50, 4, 7, 10, 12, 28, -56, -49, -34, 27, -24, 18, 21, 42,
+  24, -23, -2, -52, 58, -12, -21, -10, -36, 25, 29, -31, 51, -47, -30, 18,
+  -67, 9, 27, -13, 0, -24, -51, 4, 32, 20, 0, 5, -10, 13, 11, -4,
+  -70, -42, -5, 25, -10, -22, -37, -36, -75, 0, 44, -2, 86, 67, -59, 48,
+  -9, -30, 15, -12, 10, 2, 39, 14, -7, 9, -59, 30, 22, 18, 31, 5,
+  24, 26, -2, -127, 0, 9, 21, -13, -30, -22, 49, -57, 19, -3, -20, 18,
+  11, -34, -9, -35, 29, -16, -3, -17, 71, -31, -34, -17, 3, -36, -50, -65,
+  -36, 14, 17, -43, 12, 29, 0, -18, -16, -14, 5, -6, 11, 3, -24, 11,
+  -41, -27, 43, -32, 8, -10, 17, 56, 11, -24, -10, -54, 29, 0, -32, -57,
+  -62, -21, -5, 0, -28, 13, 6, 23, -2, 14, 2, -28, -39, 49, -38, -27,
+  3, 6, 28, 13, -52, -37, 60, -51, 29, -10, 26, 4, 55, -23, 9, 9,
+  16, -35, -3, 29, -31, -20, -67, 16, -19, -12, -8, 20, 10, -82, 12, -38,
+  -3, 71, -20, -17, 20, 26, -10, 7, -17, 33, -7, -26, -33, -25, -76, -27,
+  45, -12, -18, 18, 6, -23, -17, -12, 52, -9, -24, -44, 13, -52, -18, 24,
+  49, -29, 99, 67, 85, -9, -7, -15, 21, 24, -20, 48, 12, 23, -12, -31,
+  33, 68, -30, 3, -8, 28, 21, -58, 8, -7, 17, -41, 27, -44, -37, -5,
+  -21, -21, -8, 7, 0, 7, -72, 10, -3, 33, 0, -29, -2, 9, -12, -35,
+  41, -18, 35, -24, -31, 22, -3, 6, -10, 43, -10, 19, 28, 26, -3, 37,
+  42, 4, 32, 46, -18, 26, 3, 26, 13, -24, 7, -10, -18, -18, 22, -28,
+  -16, 16, 22, -77, 11, -11, -28, 2, 36, -9, 34, -13, 35, 28, -32, 53,
+  54, 27, 10, 7, 0, -36, 0, 16, -54, 14, 15, 26, 21, 18, -15, -54,
+  -24, -66, -2, -51, 20, -11, -28, 3, -22, -17, -19, 3, 0, 3, -12, -19,
+  23, -2, -49, 5, -21, -26, -10, 9, -27, 3, 17, 16, -34, 29, 19, -52,
+  -7, 22, 17, -24, -47, -11, -18, -14, -25, 25, -82, 13, 25, 19, -35, 8,
+  -13, -24, -58, -32, -93, -10, 22, -20, 23, 30, 37, 22, -62, -25, 10, -16,
+  -55, -78, -9, -100, -17, -13, -11, 0, -90, -49, 21, 3, -22, -39, 0, 8,
+  -26, -13, -18, -10, 55, -37, -97, -73, -5, -13, -17, -18, -15, 5, -93, -12,
+  -3, 19, -6, -16, -53, 42, 18, -12, -33, -21, -71, 7, 7, 6, -12, 10,
+  10, 9, -8, 15, 24, 5, 48, 53, 37, 76, -27, -19, -14, -22, 32, -49,
+  96, 51, 0, -73, -37, -23, -31, 23, -42, -17, -26, -19, -17, 13, 65, 11,
+  26, 38, 14, 5, 9, -12, 10, 18, 13, -63, 36, -14, -21, -5, -15, -5,
+  75, 11, 3, 11, -22, 48, 25, 7, 14, 32, 8, 13, 10, 28, -5, 61,
+  -18, -12, -28, 12, -49, -34, -14, 36, 6, -16, 2, 0, 0, -37, -24, -43,
+  -17, 9, 28, -6, 59, 25, 17, 29, 37, 58, 7, -36, -2, 52, -35, -16,
+  13, 27, 74, 33, 46, -28, -80, 38, -24, 21, -7, -2, 24, -75, -25, 26,
+  33, 41, -11, -11, -64, -3, 4, -12, -22, -9, -23, -4, -70, 25, 53, -13,
+  13, 6, -23, 51, -57, -55, 41, 33, 26, 62, -7, 22, 7, 15, -47, 38,
+  -7, -30, 25, -30, 54, 13, 17, -29, 2, 9, 21, 6, -11, 45, -80, -53,
+  16, -42, 7, 46, 52, -19, -3, -18, 32, 71, -89, -10, -9, 8, 6, 0,
+  62, -22, 6, 95, 25, 8, 50, -25, 11, -32, -25, -22, -17, -38, -18, 43,
+  -21, 59, 30, 51, 65, -26, 82, 85, 29, 35, 27, 29, -5, -65, -17, 3,
+  -3, -42, 5, -67, 3, 58, -3, 23, 32, -55, 50, -36, 22, -23, -30, -43,
+  6, 8, 28, -3, 9, -63, 30, 29, 27, 39, 0, -42, 6, -127, -56, -68,
+  88, -8, 8, 16, 19, -54, 60, -7, 8, -37, -71, -24, 15, 38, -7, -8,
+  48, -8, -12, 9, -38, 4, -4, -6, 19, -8, 18, -45, -16, 26, 0, 28,
+  35, 25, 45, 57, 21, 12, 18, -3, -7, -54, 60, 31, -27, 39, -14, 40,
+  18, -2, -49, 50, -34, 46, 6, 0, 40, 5, 65, 2, 14, 44, -14, 48,
+  -70, -28, -15, -5, 47, -19, 7, 50, -31, 11, 32, -14, -7, 50, 15, -5,
+  26, 3, 26, 7, -49, -45, -16, -25, 11, 5, -2, -15, 2, -66, -9, 58,
+  -48, -34, 4, -59, -37, 2, 16, 36, -14, 0, -47, -15, 41, 88, 44, -22,
+  -21, 20, -43, -10, 26, -9, 65, -29, 20, -24, -19, 6, -20, 22, 12, -40,
+  -12, -15, 13, 7, 0, 32, -37, 26, 5, 13, 3, 33, -2, 6, 6, 12,
+  14, -6, -38, -7, -125, 22, -45, -18, -35, -8, -32, -18, -4, 57, 5, 0,
+  -32, 17, -24, 11, 8, -19, 5, 30, -19, -3, -9, -3, -14, 64, 63, -37,
+  -18, 8, -33, -36, -11, 15, 9, -6, 0, 20, 12, 0, -37, 7, 26, -46,
+  -31, -35, 5, 39, 23, -40, 27, -37, -33, 43, -13, 0, -30, -32, -2, -57,
+  -24, 6, -2, 23, -68, 2, -27, 49, 24, -28, -41, -9, 22, -40, 16, 48,
+  -10, -50, 6, 20, 3, -29, -3, -55, -35, -11, 13, 3, 8, -18, 28, -2,
+  -48, -25, -49, 14, -46, 20, -78, 45, 7, 12, 65, -11, -71, -5, -12, -9,
+  -3, 18, 13, 10, -13, 42, 63, 28, 36, -11, -21, -2, -14, -59, -24, 19,
+  12, -6, 33, -70, 45, 34, -9, -114, -8, -99, -2, 18, -2, 20, -21, -23,
+  -26, -22, 26, -42, 37, -22, -34, 52, 61, -81, -62, -41, -20, -6, -94, -127,
+  -70, -18, -30, 17, 23, 9, 19, -12, -97, 2, -37, 6, -14, 15, 67, 33,
+  -34, 41, -36, -111, -47, -13, -27, -32, -13, -6, 24, -43, 12, 26, 11, -114,
+  -24, -58, -85, 36, -53, -18, 9, -55, 19, 23, -25, -15, -38, -6, 11, 5,
+  -13, -6, -9, 23, -45, -12, 18, -38, 23, -5, -4, -5, 35, -6, 41, 5,
+  3, 35, 10, -7, 3, 0, -47, 12, 10, -42, 71, 17, -48, 12, -35, 15,
+  -3, 5, 18, -12, -68, -26, 10, -34, -28, -4, -11, -10, -35, -18, -13, 19,
+  5, 58, -2, 9, -23, 31, 34, 9, -3, -20, 11, -18, -11, -23, 9, -10,
+  55, 36, 6, 3, 21, 10, 52, 3, -44, 5, -11, 10, -31, 6, -6, -10,
+  42, -21, -7, 19, 17, -7, 25, -45, -30, 7, 43, -15, 3, 10, -12, 24,
+  27, -5, 15, -22, -5, -40, -10, -39, 41, 9, -5, -45, -19, -9, -9, -31,
+  -29, -36, -45, -52, 0, 34, -54, -3, -61, 3, -23, -92, -58, -9, 0, -20,
+  -32, -56, -9, 14, -71, -10, 10, -47, -58, -27, 11, 103, -14, -82, -47, -30,
+  -6, -27, 0, 2, -14, 54, 34, -17, -2, -12, -22, 20, 11, -53, 113, 7,
+  -6, -3, 5, -5, -44, 11, 53, -43, 20, -41, -26, -16, 30, 9, 60, -10,
+  -24, 8, 21, -29, -8, -40, 25, 12, 0, -15, 5, -6, 18, 0, 9, -10,
+  -32, -62, -2, -8, 16, 2, -18, 44, 42, -3, 7, 28, -18, 15, -75, -77,
+  36, -21, -10, 53, 51, 0, -28, -23, 0, -5, 0, -13, 23, -12, -3, 13,
+  -43, -63, 3, -12, -31, -26, 3, 26, -41, 17, -19, -31, -35, -6, 26, -7,
+  8, -12, -27, 43, 8, 16, 12, 54, 6, 40, -12, -19, 2, 45, 2, -26,
+  -27, 23, -25, 12, -33, 7, -16, -23, -12, 45, 12, -38, 9, 0, -14, 8,
+  -44, -6, 41, 0, 27, 2, -49, 4, 8, 64, -39, 16, -39, -25, 6, 9,
+  -25, -21, -24, 41, -30, 0, -10, 4, -29, -4, -25, -17, 24, -15, 11, -57,
+  -3, -40, -7, 2, 0, -26, 37, 10, -33, 19, 21, 3, -28, -15, 24, 0,
+  -70, 26, -13, -24, -19, 25, -27, 0, -24, 48, 35, 22, 0, 16, 6, -18,
+  -28, -4, -24, -33, 18, 7, 20, -28, 5, -31, -55, -10, 0, -8, -27, -41,
+  29, -11, 8, 18, -5, -28, -45, 22, -45, 25, -8, -6, -2, 40, 13, 30,
+  -20, -35, 0, -2, -28, 16, -16, -16, 11, -13, -64, 53, -12, -27, 24, -13,
+  23, 23, -11, -44, 39, -26, -35, 6, -12, 6, 21, -19, 2, -32, 35, 18,
+  -69, 12, 14, -20, 15, 11, -20, 0, -26, -20, -16, -4, -42, 3, -18, -7,
+  -16, -13, -32, 13, -30, 30, -10, 13, -19, 29, 22, 21, -44, -9, -13, 20,
+  28, -49, -15, 43, -67, 26, -28, 0, -8, -26, 14, 50, -16, -15, 5, -3,
+  67, 56, -4, -50, -19, 18, 3, -9, -17, -6, -76, 13, 2, 9, 46, -3,
+  -13, 6, 28, 5, 12, 52, 13, -37, 73, -46, -19, -43, -33, -43, 24, -32,
+  -10, -5, 67, -46, 16, 0, 10, 13, -19, 49, 14, 13, 7, -9, -38, 12,
+  -115, -58, -12, 31, 16, 19, 35, 16, 33, 82, 50, 50, -7, -36, -31, -93,
+  3, 20, -40, 50, -127, -39, -22, 71, -75, 34, -53, -30, -72, -51, 83, 47,
+  0, 4, -110, 38, -68, -23, -46, -34, 42, 41, -84, -33, 39, -3, -124, 18,
+  -25, -13, -59, -77, 22, 66, 76, -63, -13, -27, 39, 28, -46, -123, -40, 32,
+  0, 0, -34, -31, 0, 47, -28, 6, 6, 3, -50, 75, -21, 12, -2, -56,
+  7, -47, -34, -41, 11, -5, -19, 40, -56, -8, 16, 27, 4, 25, -49, -31,
+  -22, -24, -28, 20, -6, 32, 13, 50, 3, -15, -29, 43, -24, 25, -18, -11,
+  19, 21, -22, 33, -16, 3, 10, 36, -11, 18, 22, 2, -7, -3, 18, 27,
+  -15, 14, -15, 21, 75, -16, -16, -10, 19, -11, -19, -9, -19, -51, -10, -3,
+  20, -38, -7, 9, 6, -16, 8, -51, -2, 6, 16, 0, 9, -16, 20, 23,
+  -35, 4, 69, -58, 3, -16, -33, 11, -3, -5, -42, -27, -68, -3, -36, -30,
+  -32, -32, -19, 5, -16, 14, 42, 27, -29, 20, -11, 2, 5, -55, 20, 37,
+  -38, 40, -10, -50, 16, 5, 26, 51, -14, -74, 36, 0, -72, 27, -7, 34,
+  37, -3, -25, -3, 6, -26, 38, -31, -29, 3, 23, 24, 38, 13, 0, 18,
+  -44, 18, -38, 5, -36, -25, 78, 6, -55, 26, 3, -21, 33, -20, -12, 0,
+  -41, -40, 24, 49, -49, -28, -14, -16, -32, 9, 0, -23, 27, 0, 2, -12,
+  28, -58, -61, -45, -28, -42, -47, -32, 28, -3, -36, 25, -49, -57, 17, -61,
+  -7, -47, -4, -18, -8, -46, -76, 29, -24, -6, -5, 0, -11, 19, 20, 18,
+  -3, -18, -21, -33, -24, 16, -46, -22, 52, -3, -32, 14, -24, 18, 15, -37,
+  0, 29, -32, -3, -84, 36, 35, -25, -29, -20, -19, -17, -12, -64, 20, -35,
+  10, -9, 15, -2, -24, -45, 7, -23, 3, -64, -31, -3, -14, 0, 0, -11,
+  -20, -27, 2, 60, 6, -18, -17, 23, -44, 11, 12, -11, 11, -6, -58, 3,
+  -19, -10, -42, 8, 15, -39, -33, 4, -18, 16, 29, 24, -21, -23, 40, 30,
+  16, 19, -27, 3, 11, -48, 32, 16, -32, 34, -64, 0, -2, -43, 11, -10,
+  18, 32, -45, -41, -28, -9, -24, -36, -42, -24, 7, -28, -5, -58, 5, -35,
+  34, -9, 16, -39, 0, -9, -44, -17, -15, 14, -12, -25, 11, 13, -50, -3,
+  -70, -4, -10, 63, 0, 32, -46, -28, 34, 0, -65, 4, -15, 23, -6, -35,
+  52, -40, -63, 5, -25, 42, 11, 34, 5, 5, -42, -45, 7, -3, 2, -5,
+  -25, 12, 7, -26, 64, 17, 9, 3, 42, -16, 39, 19, -5, -6, -5, -29,
+  51, 56, 27, 27, 31, 9, 28, -17, -37, 9, -9, 19, -13, 19, 55, 8,
+  -16, 21, -21, 5, -45, -28, -73, 2, -3, -34, -16, -43, -18, 28, -9, 21,
+  -3, 27, 22, 5, 6, 6, -53, 32, -14, 34, 34, 9, -30, -93, -18, 43,
+  5, -6, 17, -12, 36, 0, 19, 13, -20, 13, -7, -28, -14, 15, -2, -8,
+  -44, 12, 9, 30, 0, 5, -17, 3, -27, 26, 16, -55, -17, -10, -29, -45,
+  -19, -21, -56, -18, 54, -12, -36, 4, -11, 26, -10, 33, -54, 15, -6, 0,
+  45, 16, -60, 23, 8, -17, -28, 16, -32, 25, -31, -13, 17, 47, -18, 0,
+  -8, -73, -7, -60, 52, -5, 92, -104, -127, 0, -126, -6, 26, 18, -10, 8,
+  -27, -89, 59, -39, 39, 32, 55, 43, 52, -23, 2, 0, -17, 26, -102, -5,
+  -13, 39, 70, -61, 9, 7, 49, -52, -95, 59, -33, 6, 45, 79, 9, 19,
+  -29, 16, 5, 39, -116, -50, -81, -2, -57, -11, -56, -32, -10, 62, 11, -38,
+  -10, 6, -12, -17, -4, -64, 76, 6, 31, -27, -15, -6, 12, -55, 68, -27,
+  41, -15, 7, -6, 25, 18, 6, -49, -12, 11, 26, 11, 37, -38, 15, -58,
+  -32, -10, -28, 20, -39, 9, 16, 33, 66, 23, -13, 24, -33, 10, -6, 9,
+  32, -5, 0, -16, 25, 20, 39, 11, 3, 7, 11, 19, -30, 47, 27, -15,
+  3, -32, 25, 12, -76, 38, -12, 16, -62, -8, -2, -22, -28, -6, -27, 0,
+  0, -15, -18, -9, -25, -34, 3, 12, -52, 6, -14, 8, 9, 19, 9, 37,
+  42, -10, -49, -18, 18, -25, -13, 31, 53, -36, 10, -24, -3, 3, -46, 7,
+  -6, -21, 14, 10, -14, 6, 14, 14, -46, -25, -3, -4, -25, 19, -30, 33,
+  -38, 41, 50, -5, -16, 28, -66, 6, -3, -13, 0, -9, 23, -36, -19, 11,
+  54, 53, 9, -84, -17, 0, 55, 23, -35, 63, -2, -19, 28, 26, 47, 11,
+  38, -64, -14, 30, -6, -25, 30, -13, 37, -39, 16, -33, 15, -67, -58, -58,
+  84, -38, -5, 5, 0, 48, 21, 7, -32, -14, -6, 17, -17, -112, 7, 35,
+  -38, 9, -40, -29, 48, -19, 40, -23, -62, -35, -2, 38, 0, 12, -12, 0,
+  34, -15, 41, 3, -6, 27, -25, -26, -2, 40, 28, -3, 35, 22, 26, 32,
+  -6, -29, 63, 23, -36, -2, -33, 17, -5, -23, -10, -14, -27, 20, 46, 26,
+  10, -29, -60, 13, 3, -8, -28, -39, 3, 32, -45, -9, 2, 0, -14, 13,
+  42, 18, -3, 17, 58, 25, 12, -7, -47, -17, -30, 3, -49, -6, -35, -25,
+  -88, -15, -43, 12, 41, 2, -9, -3, -10, -27, -39, -23, 7, -37, -48, -14,
+  -10, -9, 18, -5, 41, -10, -41, 7, 46, 30, -24, 25, -19, 43, -6, 39,
+  -74, 0, -17, 22, -31, -6, 0, -9, -36, 31, -20, 22, 20, 6, 5, 29,
+  -26, 30, 21, -62, -12, -30, -62, -27, -41, -31, 3, 20, -29, -41, 23, 22,
+  0, -46, -14, -25, -38, -33, -3, -33, -20, 12, 7, -17, 38, -50, 27, 27,
+  43, -2, 7, -16, 9, 2, -38, 7, 16, -43, 20, -6, 3, -32, -16, 14,
+  37, -42, 11, 5, -11, 29, -15, -12, 6, -2, -73, 22, -3, -39, -19, 13,
+  11, 6, -10, 25, 8, 22, 25, 0, 18, 8, 33, -20, -5, 32, 8, 44,
+  106, -40, -28, -28, 12, -15, -9, -24, -18, -27, -22, -6, -16, 56, 45, 71,
+  13, -19, -47, -13, 41, -36, -51, -34, 44, 3, 37, -12, -13, -35, -67, -10,
+  -13, -25, 59, 8, 29, 46, 0, 26, 0, -24, 52, 25, 18, 6, -5, 21,
+  11, 12, -18, -10, 42, -20, 42, 57, 12, -3, -10, -43, 5, -35, -35, 19,
+  -99, -22, -24, 25, -9, 48, -3, -18, 28, 24, 61, -51, 20, 13, -6, -19,
+  13, -6, 43, 55, -25, -2, 0, -2, 8, 56, -34, 14, -47, 32, 10, -2,
+  30, 8, -17, -14, -31, 23, -44, -47, -22, -38, 17, -34, -15, 19, 21, 37,
+  -13, -18, -96, 2, -100, -49, -74, 37, 29, 14, 18, -20, 44, -63, -13, 28,
+  -63, -98, 9, -31, -70, 28, 3, -114, -28, -127, 97, -37, 58, 3, -51, -14,
+  -80, 6, 94, 18, -34, -31, -7, -14, 71, -27, 65, 10, 6, -40, -114, -36,
+  -47, -95, 0, 43, -37, 58, 95, -26, -56, 21, -46, 18, -95, -6, 26, 16,
+  24, -94, -10, 15, -54, 22, -47, -7, 26, 3, 3, -39, -12, -47, 3, 17,
+  -4, -46, -24, 0, 17, 15, -23, -36, 33, -12, -27, 17, 20, -23, -33, -5,
+  3, 36, -36, 29, -28, -31, -17, 9, 25, 5, 65, 31, 13, -8, 10, -22,
+  -17, -8, 11, 24, -14, 46, 7, -43, 3, 2, -35, 11, 20, 0, 61, -5,
+  53, -18, -8, -15, -17, -54, -2, 17, -26, -22, 20, 13, -19, 13, -13, 25,
+  0, -9, -7, -31, -26, 18, -6, -12, -20, -38, 34, 0, -7, -43, 30, -19,
+  37, 0, -4, -40, 0, 36, 41, -2, 22, -48, -34, 20, -19, 0, -48, 19,
+  30, -33, -8, 5, 20, 9, 22, -35, 3, 12, 6, -13, -23, 45, 24, -3,
+  -18, -51, 28, -42, 4, -37, 32, 44, -6, 31, 0, 16, 2, 16, 0, -39,
+  53, 3, 26, -6, -46, 24, 14, 24, 26, 18, 19, -28, -22, 80, 30, -44,
+  56, 26, 0, -8, -44, -19, -38, 2, -11, 24, 44, 27, -9, -32, -25, -55,
+  47, 19, 3, 24, 14, -20, -47, -69, 22, -14, -17, 0, 18, -35, 9, 34,
+  24, -85, -28, 12, -17, 15, -17, 7, -67, -39, -53, -3, 41, 25, 35, -47,
+  39, 31, 5, -37, 58, 26, -3, -42, 44, -38, 12, 20, 9, -50, -30, -11,
+  63, 41, -58, 8, 25, 7, 27, 14, 41, -5, -34, 22, -53, 48, 38, 14,
+  3, 8, -14, 46, -9, -73, -4, -57, -45, -45, -46, 38, -31, 45, 0, -26,
+  -12, 9, 2, 17, 32, 13, 21, -3, 11, -11, -29, 2, 7, 34, 6, 2,
+  -24, 33, -11, -38, -9, 11, -13, 0, 12, 0, -20, 30, 17, 5, -16, 8,
+  -8, -21, 8, 22, 21, 4, 26, -5, 31, 33, 10, -6, 31, -44, -12, 15,
+  -20, -6, 26, -2, 28, 4, 47, 13, 2, -18, 4, -24, 4, 25, 0, 2,
+  -10, 18, 14, 2, -16, 45, -17, -28, -38, -2, -6, -12, -7, 2, -4, -17,
+  37, 16, -11, 19, 2, -17, 9, 2, -12, -11, -19, 13, -22, 0, 14, 10,
+  -20, -18, -30, -10, -21, 16, 0, -10, 0, -18, -13, -17, 0, -2, -17, 11,
+  20, 2, 13, -19, -9, -4, 61, -16, 26, 2, 31, -22, 2, -25, 14, 16,
+  -26, -12, 8, 13, 3, 0, 2, -21, 2, -19, -4, 20, 2, 0, 6, -23,
+  40, -9, -2, 28, 18, 17, -7, -16, -12, 36, -2, -41, 2, -23, -30, -12,
+  5, -31, -44, -20, -14, 2, -10, -7, 0, -8, -8, -12, -5, -14, 36, 9,
+  -38, 4, 22, 2, -15, -13, -6, -16, -4, 5, -38, -5, -4, 27, -20, -22,
+  12, -23, -2, -2, 0, 4, 13, 26, -2, 19, 10, -2, 6, -12, 8, -17,
+  -27, -30, 27, -26, -7, 21, 11, 23, 6, -20, 0, -34, 7, 20, -14, -8,
+  -13, 2, 58, 12, 40, 15, -13, -10, -21, 10, -39, 23, 36, -38, -12, 0,
+  -5, 4, 4, -27, -15, 18, 28, -5, -13, -18, 22, -9, -19, 17, -11, 44,
+  18, -16, -12, 6, 0, 0, -62, 13, -27, 55, 44, -127, 0, 29, -44, 15,
+  40, -2, -31, 45, -13, -17, -17, 18, -47, 76, 24, 67, 20, 58, -55, 19,
+  -5, -29, 14, 40, 40, 4, -83, -16, 77, -4, -23, -54, -50, 6, 60, -18,
+  10, -4, 11, 58, -46, -9, -55, -56, -28, -25, -24, -41, -31, -81, 18, 69,
+  14, -16, -2, -26, -32, -41, 0, -3, 4, 25, -8, 22, 22, 22, 34, -38,
+  40, -14, 11, -5, 2, 1, 15, 7, 2, 13, 2, 4, 5, 0, -37, -6,
+  5, -5, 33, 16, -21, 11, -13, -17, -2, 22, -13, -30, 5, -6, 29, -7,
+  33, -21, 11, 19, -15, -7, -19, -18, 26, 4, -2, -5, -23, -44, -29, -48,
+  22, -2, 16, -4, -38, -2, 24, -26, -4, 25, 4, 30, 2, 14, 8, -40,
+  16, -14, 13, -40, 22, -1, -9, 18, -6, 16, -32, -28, 22, 28, 48, -10,
+  8, -5, 11, -46, -12, 20, -3, 3, -4, -2, -47, -25, -7, -16, 14, -29,
+  -3, 23, 30, 14, -20, 13, -22, -4, -13, 40, -4, 3, -16, 32, 0, 14,
+  -20, 28, -37, 2, 25, -39, -11, 36, 22, 4, 31, 12, -15, -84, -19, 32,
+  5, 23, -25, 26, -71, 10, 26, -25, 16, -18, -28, -62, -20, 53, 0, 29,
+  -15, 23, -28, 0, -31, -25, -34, 17, -39, -49, -16, -23, 19, -59, -65, -11,
+  43, -15, 2, -8, -7, -13, -19, -16, -55, -11, -20, 0, -60, -15, -49, 0,
+  20, 12, -2, -13, -3, -24, 6, -36, -45, 21, -11, 0, 15, -7, 34, -13,
+  -21, -23, -4, -21, 15, -8, 46, 39, 8, -29, -17, -19, 10, -40, -14, -2,
+  38, 13, 19, -24, -12, -13, 3, -16, 12, 8, 10, 5, -24, -4, -2, -6,
+  23, 17, 4, 2, -11, -20, 11, -2, -6, -38, -51, 7, -4, -66, 4, 2,
+  21, -3, 23, 4, -48, 9, -20, 21, 18, 12, 4, 12, 0, 17, 0, 2,
+  -22, 11, -32, -8, 41, 0, -15, -16, -7, -3, 22, -3, 2, 3, 5, 32,
+  -9, 32, 90, 9, 11, -17, -3, -20, 0, 7, -18, 4, 8, 24, 31, 2,
+  3, -52, 5, 43, -23, 36, -19, -27, -10, 0, -39, 2, -16, 20, -15, 26,
+  -49, -19, 25, 11, 19, 24, -9, 3, -3, 0, -34, -20, 15, -28, -9, -37,
+  -9, -11, -8, -41, -8, 8, 31, 5, -16, -21, -20, -25, -18, -38, -16, -12,
+  -33, -19, 19, -9, 22, 15, 0, 22, 15, 19, 15, -24, -6, -28, -31, -15,
+  30, 25, 30, 7, -33, 0, -13, 11, 22, -15, -18, 42, -9, -49, 2, -2,
+  -23, -49, 23, -13, 11, 31, 31, -30, -16, 5, -20, 6, -48, -25, -11, -7,
+  122, 11, 48, -11, 34, 18, -56, 16, -14, 32, 17, 30, 0, 18, -16, 7,
+  0, 4, 13, 9, 28, 40, -37, 20, -10, 17, 3, -9, 42, 5, 17, 24,
+  18, -50, -58, 12, 10, 49, -26, -2, 5, 19, 26, -14, 34, -3, 23, 28,
+  -5, 54, -5, -13, 4, -11, -11, -45, -16, 37, 27, -29, -7, -6, 7, 2,
+  13, 16, -34, -28, -18, 3, 28, 48, 2, 21, 13, -45, -2, -3, 5, -22,
+  -30, 4, 13, 9, -14, -2, -15, 16, 10, 50, 27, -24, 28, 17, -8, 9,
+  18, -7, 8, 22, 5, 8, 23, -25, 12, -27, -16, 0, 5, 3, 6, -28,
+  -49, 38, -30, 29, -59, -4, -2, 0, -37, 22, -4, -17, -9, 36, -38, -2,
+  34, 5, -40, -36, -59, -49, -28, -13, -32, 18, -37, -20, 2, 44, 8, 24,
+  -30, 19, -84, -49, -25, -23, 64, -6, 12, -67, 127, -7, 11, -57, -116, -11,
+  9, -52, -23, 12, 8, -13, -49, -6, -32, -11, -5, 20, 11, 3, -25, 19,
+  -12, -13, -28, 0, 15, 26, 15, 0, 3, -27, -29, 52, 17, 14, 42, -30,
+  91, -36, -36, -69, -54, -23, -38, -40, 14, 50, -7, -5, -20, -6, 59, 34,
+  24, 31, -42, -38, -28, -26, 3, 34, 17, -19, -9, 25, -6, 24, -25, 6,
+  -9, -84, -40, 0, -53, -8, -13, 21, -15, 36, -23, 34, 7, -6, -36, 7,
+  7, 3, -46, 9, 15, -11, 15, 0, 13, 32, -4, -32, 4, -81, 34, -40,
+  -3, -30, -25, 30, -54, -10, 15, -40, -7, -18, -15, -48, 2, 9, -8, -10,
+  35, 11, 10, -9, 42, -15, -21, -2, 10, -29, -30, 13, 3, -9, 8, 4,
+  -6, -7, 30, -14, -56, -59, 16, 40, -5, -13, -39, 4, -5, 9, -42, -21,
+  -45, -27, 58, -38, -7, -42, -26, 6, -16, 67, -11, -6, 46, -67, 7, -62,
+  -53, 27, 23, -33, -31, -20, 36, -56, -50, 5, -22, 5, -44, 12, 27, -39,
+  74, 17, -3, -45, 31, -21, 3, -20, 41, 57, -33, -35, -70, 19, -45, -15,
+  18, -35, -20, -36, 38, -23, -3, -13, 17, 6, 28, -12, -9, -37, -34, 2,
+  -12, -73, -46, 4, 19, 22, 7, -21, 16, -45, -16, 6, -63, -20, -2, 35,
+  16, 41, 38, 11, -52, 2, -20, -27, -34, 16, -9, 50, 4, -6, 32, -17,
+  15, -34, 0, 9, 19, 21, 0, -14, -5, -50, 33, -4, 25, -14, 6, -24,
+  9, 5, 10, -12, -20, -5, 13, 25, 32, 23, 44, 8, 0, -32, -25, -49,
+  14, 21, -7, 37, -72, 11, -19, 21, 8, -46, -4, 40, -8, 25, 0, 22,
+  -28, 24, -37, 19, -13, -8, -30, -63, -2, -23, 21, -32, -10, 17, 24, -12,
+  9, 13, 16, -5, 19, 10, -36, 14, -17, -7, -18, 2, 16, 14, 6, -8,
+  -49, 0, 0, 45, 50, -23, -9, -18, -5, 29, 0, 8, 7, 6, 39, -36,
+  -5, 18, 13, -11, -22, 11, 41, 6, -31, 12, -26, -28, -23, -14, -33, 17,
+  6, -29, 10, 40, 0, -18, -17, -26, -58, -18, 8, 42, 0, -12, 5, 12,
+  35, 15, 3, 2, 27, 44, -15, -2, -9, 2, -77, 7, -19, -12, -6, 17,
+  44, 12, 25, 9, -5, 58, 9, 8, -54, -12, -13, 18, 18, 36, 12, -18,
+  -43, 13, 4, -4, -33, 4, -2, 3, 13, 53, -4, 11, 36, -63, 55, 0,
+  -34, -16, -6, -16, -3, 21, -42, -26, 0, 3, 15, -10, 12, 26, 5, -69,
+  6, -4, 41, 18, -27, -12, -6, 31, 14, -12, -44, 5, -19, 7, -52, -48,
+  -38, 14, 49, 5, -12, -5, -3, -16, -7, 47, -18, 14, 0, -3, 2, -9,
+  21, -16, 34, 58, 22, 17, -34, 15, 13, -17, -35, 6, -8, -8, -22, 39,
+  -46, 32, -29, 24, 3, -10, -64, 10, 47, 62, 2, 7, 21, 52, 5, 2,
+  -20, -2, 47, 0, 5, -29, 6, -2, 33, 2, 15, 12, 11, 7, -50, -6,
+  -81, -51, -20, 7, -22, 33, -6, 47, -37, 18, -18, -8, -11, -31, 0, 39,
+  -5, 37, -11, -56, -54, -45, 28, 12, 28, -60, -79, -34, 8, -36, 57, -39,
+  -92, -80, 4, -32, -33, -16, 5, 18, 89, -15, -15, -66, 29, 9, -24, -112,
+  20, -19, 38, 41, -43, 2, 21, 39, -55, 42, -24, -4, 5, 7, -3, 15,
+  -49, 22, 52, 24, -20, -25, -13, -31, 32, -18, 30, -70, -18, 14, 16, -50,
+  -7, -53, -18, 19, -14, 26, 2, 26, -15, -29, -35, 51, -13, 0, 22, -70,
+  0, -13, 6, 13, 68, 26, -40, -34, 29, 18, 36, -27, 10, -20, 29, -12,
+  9, 20, 0, -46, -11, -4, 39, -39, 31, -7, -27, 21, 30, 30, -6, -54,
+  20, -43, -15, -5, -22, 28, -60, -10, 5, -6, -50, -16, 20, 56, 2, 39,
+  -50, -29, 9, -4, -29, -36, 41, -41, 13, -63, 44, -11, -15, -25, -11, 65,
+  9, 5, 14, 3, -23, 13, 57, 57, -11, 28, -2, -15, 12, 23, -5, 12,
+  -46, 7, -31, 5, 19, 2, 12, 0, -31, 5, -24, 0, -41, -28, -39, 23,
+  -35, 14, 27, -12, -27, 23, 9, 0, -46, 16, -13, 18, -13, -34, 0, 16,
+  27, -58, -38, 6, -18, 49, 15, 53, -64, -7, 17, -37, -55, 36, -4, -5,
+  -9, -8, 47, 57, -18, 27, -37, 47, 11, 28, 25, 25, 49, -127, 45, 28,
+  -66, -13, 47, -9, -33, -4, 6, -22, 21, -16, -32, 39, -5, 37, 58, -25,
+  -23, -51, 5, 24, 0, 18, 41, -49, 19, 41, -53, -27, 20, 20, 4, 59,
+  -21, -32, -36, -11, 47, -24, -11, -50, 43, 14, 59, 28, 23, 14, -20, -80,
+  -37, -32, 16, -3, -38, -11, -2, 16, 20, 23, 25, 2, 19, -29, 16, 55,
+  38, -11, 35, -32, 3, -19, -59, 4, 50, -63, -27, -23, -3, -2, -6, 29,
+  -12, 7, -5, -12, 25, 93, 51, -16, -41, 8, 20, 12, -27, -22, 8, 11,
+  -3, -6, -11, 0, -26, 3, 20, -39, 12, -14, -37, -37, -15, -75, 3, 20,
+  -7, -13, -17, 100, 9, 12, -30, -25, 8, -28, -15, -24, 12, 21, -9, 34,
+  -31, -13, -41, 38, -62, -55, -25, 38, 40, -11, -7, -25, -52, 11, -26, 15,
+  -24, -23, -3, 3, 21, -48, -61, 12, -47, -25, -15, -28, -16, 7, 10, 8,
+  30, -6, 51, -3, 43, -36, 56, -25, 12, -17, -5, 7, 13, 26, -10, 69,
+  22, -45, -32, -42, -15, 13, -33, 12, 32, -61, -8, -59, 9, 45, -50, -9,
+  59, -2, 49, 25, -39, 45, 21, 21, 37, -3, 32, -4, 49, -44, -3, 0,
+  28, -3, -9, 0, -18, -9, 42, -76, 23, -64, 51, 19, 3, 80, -32, -62,
+  5, -16, 8, 21, -78, -18, -10, -14, -67, 46, -68, -24, 13, 26, 10, -14,
+  40, -112, 34, 16, -3, -23, 27, 12, 21, -9, -51, -41, -30, 83, 41, -48,
+  41, 11, 45, -5, -16, 15, 4, -5, -34, 61, 21, 4, -81, -6, 23, -18,
+  28, -23, 18, 62, -3, -6, -19, -25, 44, -37, -12, 0, -32, 13, -2, 14,
+  3, -16, -30, -59, -13, 8, 33, -14, -40, -23, -26, -31, -3, 29, 42, 9,
+  -102, -3, 7, 32, -39, -6, 68, -34, 5, 9, 40, -26, -21, -62, -6, 20,
+  72, -18, -38, 0, -62, -77, -7, -12, -68, 45, -21, -13, 16, 6, 20, 10,
+  -24, 6, -32, 14, 12, -33, -26, 5, -41, -5, -3, 9, 29, 3, -22, 11,
+  -25, -66, 8, -57, 26, -15, -15, -18, -33, -23, -47, 24, -25, -46, 37, -17,
+  -84, -54, 20, 3, -33, 23, -3, -22, -29, -37, -25, 32, 42, -21, 13, -23,
+  24, -4, 34, -71, 45, 0, -39, 14, 23, -36, -81, 40, -23, 36, -3, -18,
+  -45, -26, -35, -48, -62, -3, -64, 22, 64, -34, -21, -49, 0, 30, -7, 30,
+  -11, 69, 35, 41, 9, 79, -15, 28, -30, 9, 60, -109, 18, 39, 8, -49,
+  -55, 73, 2, 23, -12, 4, 24, 3, -11, 25, -5, 3, -67, 7, 35, 23,
+  38, 96, -45, -8, 32, -40, -4, -26, -6, -78, 127, -11, -26, 0, -13, -10,
+  -42, 9, 0, -107, -9, 33, -30, 37, -52, 12, 12, -33, 19, -100, -12, 49,
+  14, 16, 11, -15, 17, 82, -56, -28, -15, -12, 5, -14, -10, 79, -8, -9,
+  -7, 29, 61, 29, -72, 36, 44, 19, -80, 40, 20, 62, -9, -21, 28, -51,
+  14, -67, -4, 11, -23, -32, 0, -56, 23, -70, -21, -30, -29, -33, -46, -78,
+  52, -66, -35, -22, 21, 30, 23, -61, -6, 54, 63, -16, 13, -37, 20, 38,
+  -44, 85, -35, 5, 9, -20, 0, 11, -27, -12, -21, -7, 10, -7, -52, 6,
+  4, -26, 2, 3, 9, 12, 12, 31, 11, -34, -8, -26, 28, 31, -3, 9,
+  59, -20, 19, -66, 39, -32, 53, 21, 0, -59, 18, -45, 42, -55, 7, -25,
+  -42, -95, 44, 45, 24, -6, 19, -12, 6, -29, 27, 26, 19, -17, -47, 5,
+  27, 41, -16, -8, -48, 13, -54, 77, -49, -32, -21, 65, -3, 29, -21, -55,
+  -40, 48, -22, -6, -33, 6, 9, -75, -35, 37, 13, 38, 56, 41, -9, 45,
+  59, 13, 41, -66, 6, -47, 39, -14, 51, -98, 78, -6, 36, 69, -10, -20,
+  28, -49, 41, -25, -39, 3, -11, 10, -73, 5, -69, 0, 11, -37, 22, 8,
+  -20, 3, -5, 14, -8, -37, -16, 25, -17, 13, -28, -6, 2, -15, -5, 13,
+  -3, -6, 27, 3, -41, 3, 13, -45, -51, -31, 14, 8, -8, -16, 31, 0,
+  22, 2, 7, 2, -15, 49, 42, 9, 15, 45, -10, 13, 3, -35, -18, 7,
+  57, -63, -13, 13, -19, -5, 31, 31, -13, -22, 30, -17, -39, 30, 18, -49,
+  -22, 14, -17, 0, -4, -49, 7, -3, -50, 37, -33, 6, 21, -21, 2, -10,
+  20, -38, -11, -9, -8, 23, 16, 37, 0, -39, -21, -16, 51, 44, 37, -41,
+  -41, -2, -17, -32, 47, -16, 42, 6, 10, -20, 3, 4, -32, -20, 9, -25,
+  -19, 8, 32, 23, -19, -36, -17, -13, 3, -11, -5, 17, 17, -18, -22, 12,
+  10, 14, 0, 23, -8, -23, 5, 32, 3, -34, -64, -22, -5, 39, 45, 18,
+  40, 17, -2, 20, 22, 21, 8, 40, 19, 11, 18, -11, 4, 3, -17, -51,
+  19, -12, 17, -7, -50, 49, 10, -4, -41, 23, -29, 10, -3, -5, 39, -20,
+  9, 10, 3, 15, 8, -36, -21, 2, -21, 40, -5, 23, -2, 9, 4, 0,
+  7, 14, 22, 2, 4, -23, 25, 35, -19, 8, 12, -40, 9, -30, 7, -10,
+  0, -26, 0, 15, 49, 28, 5, -28, -48, -67, -23, 35, -19, 6, -43, -28,
+  34, -16, -78, -10, -9, -27, -16, -32, -31, 13, -58, 15, 3, 40, -3, 20,
+  -9, 13, 40, 23, 13, -19, 24, 38, 8, 24, 3, 19, 7, -73, -2, 0,
+  42, -20, 32, -5, 4, 51, -79, -127, -80, -29, -2, 6, -76, -18, 38, 5,
+  53, 70, 2, -50, -16, -3, 8, -3, -22, 53, -48, -83, 2, 0, 6, 15,
+  -19, -6, -65, -7, 85, -2, 42, -11, 64, -109, 26, 4, -103, 10, 24, 18,
+  -38, -60, -51, -15, -16, 8, -117, 18, 55, 13, 14, -27, 48, -3, -31, 64,
+  -20, -34, -17, 19, -35, -42, -35, -19, 17, -21, 28, 9, -2, -3, -5, -29,
+  53, -81, 20, 38, 8, -23, 8, 8, 7, 56, 25, -11, -23, -9, 83, 54,
+  59, 10, 0, 12, -12, -47, -23, 19, 13, -25, 64, -29, 9, 18, 21, -27,
+  -38, 10, 29, -36, -8, 36, 14, -4, 8, -7, -8, 8, 14, -36, -44, 10,
+  -7, 57, 7, -19, -8, -5, -5, 22, -6, -5, 2, -31, -34, 12, -28, -47,
+  -40, 35, -18, 61, 30, 9, -3, -17, -5, 11, 0, -24, -8, -22, -14, -3,
+  6, 38, 48, 20, -53, -49, -29, 4, 3, -43, 51, 17, -26, 5, 12, -18,
+  9, -3, 21, -18, -8, 14, -3, -44, 24, -24, -14, 19, 43, -24, -49, 7,
+  -20, -6, -27, -26, -8, -12, -28, 32, 0, -42, -52, -6, -7, 15, 52, -18,
+  -36, -38, 2, -20, -25, -9, -38, -93, 36, -58, 14, 24, 0, -56, -66, -13,
+  -41, 18, -119, 25, -6, 18, 0, 19, 5, -35, -6, -4, -12, 53, 21, 23,
+  19, -13, 13, 18, -67, -5, 10, 7, -3, -27, 11, 21, -19, 49, 42, -5,
+  50, 14, -22, 73, -47, -7, -21, -22, -8, 18, 19, 28, -16, 12, 7, 39,
+  -23, 55, -20, 18, -3, -42, -5, -3, -43, 42, 11, -40, -2, -44, -48, -21,
+  19, 63, -78, -20, -47, 27, -32, -30, 18, 3, 16, 15, 6, -75, -27, 34,
+  -28, 31, 13, -43, -8, 22, 3, 40, -61, 40, 3, -32, 5, -9, -2, 20,
+  44, -25, 0, 24, 15, -24, 41, -32, -67, 3, -39, 12, 12, 38, -6, -57,
+  13, 0, -23, -4, 14, 11, 7, 18, -3, 7, -61, -61, -19, 8, 25, -3,
+  24, -23, 56, -3, 19, -20, -12, -19, -3, -3, -61, 5, 0, 25, 61, -43,
+  -28, -17, -10, 58, -10, -35, 65, 20, 24, -20, 14, -30, -58, 54, -28, 31,
+  0, 4, -37, 33, 40, -6, -15, -20, -46, 37, 33, -67, 6, -60, -30, -33,
+  38, -30, -25, -19, 10, 46, -31, -47, 6, 11, 20, 27, 13, 36, 25, -26,
+  -16, -8, 39, 3, 26, -9, -57, 16, 23, -3, -114, -29, -26, 54, 11, -55,
+  -16, -57, -17, 0, 34, 24, 17, 20, -37, -14, 3, 40, -25, 31, 17, 6,
+  -9, -33, 3, -63, 15, 47, -50, -4, 21, -23, -24, 0, 0, -64, -12, -50,
+  -51, 26, 57, 15, -24, 4, -17, -22, 3, 60, -50, 10, 27, -76, 22, 23,
+  -16, 5, 30, 0, -11, -34, -8, -30, -13, 3, -24, 0, 30, 3, 30, -3,
+  -12, -23, -14, 42, -21, 0, 79, 40, 0, 45, -14, -40, -9, -8, 37, 6,
+  -38, -7, 22, -54, 45, -15, 9, -12, 0, -3, -15, -24, -29, 11, -21, -40,
+  4, -7, 14, -11, -35, -20, 3, 7, 55, 39, -55, -10, -32, 36, -7, -7,
+  0, 8, 87, 22, -11, -57, 12, -35, 3, 39, -8, -27, -4, -16, 0, -38,
+  20, -27, -7, -3, -65, -21, 39, -37, -57, -40, -10, -38, -34, 19, -20, 16,
+  -44, 127, 28, -36, -30, -18, -35, -8, 4, -60, -24, -12, -38, 83, 36, -43,
+  63, 52, -6, -97, 84, -51, -96, 40, 46, -4, -67, -47, -54, 20, -25, 59,
+  24, -10, 13, 22, -34, 0, 16, 0, -62, 10, 8, -12, -79, -16, 46, -23,
+  -16, 73, -10, -45, 10, 17, -9, -25, 27, -37, 52, -27, -15, 0, -51, -9,
+  16, -29, 0, -15, 60, 3, 3, -93, -35, 0, -57, 27, 50, 19, 60, 23,
+  8, -48, -3, -26, 7, -15, -10, -50, 25, -39, -26, 3, -35, 8, -15, -3,
+  -64, -3, -30, -79, 75, 17, -37, -33, 10, 13, -12, 5, 7, 0, 38, -26,
+  28, -53, -3, 29, -110, -21, 52, -20, -44, -40, -52, -38, 37, 8, -14, 6,
+  -35, -36, 12, -12, 55, 32, -30, -40, -70, 7, 21, -12, -102, -60, 0, -50,
+  63, 33, -34, -11, 0, -33, -58, 72, -58, 21, -70, -68, -40, -72, 15, -10,
+  -76, -41, -17, 25, 4, -49, 12, -49, -29, -64, -57, -44, 4, -6, -38, -40,
+  100, 37, -88, -29, 55, 38, -9, 6, 50, 6, -21, 32, -64, 31, -25, -6,
+  6, -76, -19, 54, 35, -32, -6, 73, -11, 23, 24, 71, -50, -15, 12, -43,
+  0, -37, 54, -15, -31, -15, -14, 68, 31, 39, 38, -10, 62, 16, 40, 39,
+  -52, -26, 13, 3, 52, -26, -25, 22, 26, -87, 12, -15, -37, 16, 61, -17,
+  -56, 23, -61, 0, 34, 14, 17, -11, -57, 6, -42, -32, 21, 66, -48, 25,
+  -28, 65, 43, 36, -45, -86, 27, 61, 32, 67, -3, 12, -23, -53, -9, 27,
+  -101, -18, 65, -74, -7, -42, 10, 90, -9, 11, 32, -78, -21, 60, 11, -29,
+  -56, 21, -35, -51, 0, 20, 74, 8, -46, 48, -28, -56, -15, -38, -8, 35,
+  -36, 13, -17, -29, 14, 66, 22, 62, 20, -76, 49, -5, 0, -8, -42, -25,
+  -23, -5, -19, 2, 3, 4, 0, -43, -2, -4, -28, 3, 14, -35, 2, 2,
+  -20, -44, -13, 17, -63, -22, -21, -14, 6, 17, 10, -23, 9, 19, 7, -13,
+  -11, 9, -38, -15, -10, 4, 25, 42, 9, -13, 33, 5, -33, -21, -13, 6,
+  -35, -7, 14, 4, -2, -28, -3, 8, 23, -21, 0, -18, 4, -3, -4, -6,
+  -21, 17, -2, -8, -27, -4, 0, -22, -21, -49, 12, -11, 14, -28, 12, -22,
+  -40, -47, -9, -25, -28, -19, -2, 2, -12, 9, -2, -45, 20, 3, 32, 13,
+  -40, 9, -32, -36, -65, 2, 19, -5, -11, 34, -3, -18, -73, 17, -18, -21,
+  -65, -13, -5, 28, -39, -21, 9, 9, 2, 2, -40, 0, 18, 26, -4, -23,
+  -13, -58, -10, -6, 0, -8, -28, 22, -16, -20, 28, 3, -27, -13, 0, -4,
+  -37, -2, -19, -45, -7, 6, -11, 5, -8, -17, 6, -52, 23, -13, 10, -2,
+  -3, -14, -23, 17, 40, 8, -8, 7, 13, -11, -19, 5, -45, -45, -54, -10,
+  0, -16, 5, 28, -30, 33, -18, 15, -23, 6, 21, -22, 18, -28, 0, 2,
+  -13, -7, -6, 4, 13, -12, 14, -24, -7, 13, -18, -29, 16, 5, -8, -4,
+  -28, -7, 25, -7, -7, 3, -16, 12, -35, -7, 18, -11, -9, -27, -22, -2,
+  -37, -12, -23, -2, 25, 31, -41, 7, -9, -6, -30, 2, 8, 9, -38, 0,
+  -5, -11, 14, 24, 2, 33, -12, 13, 14, 15, -12, 7, -8, 26, 9, 2,
+  47, -27, -4, -30, 10, -6, 40, -89, -127, -20, -36, 92, 47, -56, -30, 0,
+  28, -7, 2, -17, 14, 13, 39, 41, 45, 50, -27, -20, -16, 64, 12, -11,
+  48, -19, -23, 2, 28, -6, 77, -33, -42, 34, -22, -44, -18, 55, 74, -17,
+  54, -2, -30, -70, -71, -23, -29, -17, 7, 28, -42, -70, 4, 3, 4, 2,
+  -8, -10, -12, -12, 3, 16, -38, -3, -26, 4, -52, 42, 6, 10, -6, -25,
+  25, -44, 4, 2, -37, -9, 16, -55, -4, 5, -10, 18, 11, 16, 41, -48,
+  21, -21, 12, -34, -33, -17, -36, 47, 15, 4, -85, -3, -20, -32, 36, 31,
+  -24, -16, -30, 24, -41, 7, 20, -32, -9, 9, -5, 5, -33, 21, -2, -15,
+  -6, -10, 23, -12, 10, 2, -6, -8, -14, -9, -2, 26, -12, -30, -2, -54,
+  -14, 20, -15, -10, -14, 0, -2, 14, 16, 31, -6, -50, 7, 27, 46, 29,
+  -40, 31, -44, 21, -3, 13, 14, 20, 18, 6, 14, -11, -8, -6, 8, -15,
+  11, -29, -20, -4, -16, -2, -6, 36, 14, 11, 12, 9, -41, 3, -19, 8,
+  -23, -22, -8, -20, -43, -6, -49, 27, -2, -47, -26, 13, -25, -43, 4, -20,
+  6, -10, -34, -35, -26, -7, 7, 12, -4, -21, 10, -18, -4, 40, -5, -13,
+  -27, 14, 9, 17, -25, 35, -11, -20, 20, 26, -79, -5, -28, -47, 36, 10,
+  65, 25, -11, 0, -25, 16, 12, 4, -18, 9, 19, 7, -47, -8, 4, 2,
+  -55, -10, 4, -14, -13, -10, 40, 70, -5, 4, 4, -68, -10, -8, -4, 16,
+  -14, -15, -17, -20, 9, 10, 23, -12, 18, -5, -4, -43, -31, 16, 39, -50,
+  -51, -19, 15, 11, 8, 6, 58, -33, -18, -19, -19, -18, 0, -38, -8, 2,
+  -19, -56, -18, 22, -37, 5, -12, 4, 16, -28, 0, 5, -21, -34, -17, 40,
+  -17, 23, -10, -5, -19, -39, -18, -9, -19, -5, 9, -58, 9, -18, 19, -16,
+  -7, -17, -13, 23, -24, -21, 8, -17, -29, 8, 0, -5, -25, 3, -31, 20,
+  37, 20, 10, 12, -9, -29, -19, 29, -10, -20, -41, 8, -15, -15, -80, 20,
+  -12, 47, 5, 3, -8, -38, -31, 11, -10, -13, -5, -17, 5, 30, 26, 29,
+  -12, -37, 12, 19, -15, 14, -7, -28, 46, -13, 2, 30, 2, -38, 33, -5,
+  -33, -23, 7, -26, 5, 26, -32, -25, -7, 3, 9, 21, 4, -25, 3, -20,
+  -19, 0, -71, 20, 3, -9, -6, -11, -3, -57, 3, 10, 17, -10, -68, -13,
+  28, 16, -29, -15, 16, 35, -44, -24, 55, -44, -8, -35, -17, -39, -4, 34,
+  0, -8, 2, 2, 70, 18, 18, -41, 16, 47, 14, 21, -2, 59, -9, 21,
+  10, -11, 42, -6, -27, -10, 5, 39, -2, -5, 5, -8, -6, -28, -28, -3,
+  31, -36, -61, 5, -17, 13, 57, 65, 15, -47, -9, -19, -12, -32, 15, -27,
+  -12, 31, 37, -20, 13, 57, 34, -4, 10, 7, -49, 6, 17, 18, -24, 15,
+  17, -37, -7, 53, -15, 18, -32, -6, -63, -3, 16, -52, -7, 6, -23, 28,
+  29, 31, 9, -20, 32, 5, -19, 11, -17, 19, 20, -34, 35, 22, 25, -15,
+  -22, -24, 10, 5, 26, 20, 48, -48, 0, -42, 22, -19, 6, -27, 59, -7,
+  -6, -39, 8, -13, 35, 5, 71, 13, 3, 0, -5, 21, -12, -18, -53, -17,
+  -71, -59, 10, -25, 15, 0, -27, 19, 63, 54, 9, 3, -23, -38, 21, 26,
+  -13, 29, 31, 14, -127, -27, -24, 45, -19, -36, -54, 34, -88, -25, 39, -25,
+  -31, -68, -37, 69, 47, -24, -48, -29, -10, 65, -47, -19, -41, 20, -56, 9,
+  50, 23, 21, -15, 32, -3, 31, -24, 3, 53, -32, -56, -21, -81, -20, -10,
+  32, 20, -19, -30, 23, -37, 18, 3, 22, -10, -12, -6, -9, -38, 5, 5,
+  -79, -14, -2, 20, 30, 19, -8, -39, -50, 22, 2, -11, 35, 37, -3, 10,
+  9, -52, -44, 10, -6, -7, -3, -6, 25, 22, -25, -13, 29, -5, -15, -16,
+  -69, -39, 53, 33, 19, -41, 58, -40, 16, -29, -14, 2, -2, -21, -4, -27,
+  -27, -54, 29, -12, -43, 5, -18, -25, -3, 39, -9, -27, 20, 0, 9, -54,
+  65, -29, 31, 52, -76, -55, 21, -17, -19, 60, 14, -8, -2, 3, 23, -38,
+  -40, -24, 13, -25, -3, 38, -29, 8, 33, -42, -41, -29, -20, -25, -15, -54,
+  -6, 31, -3, -48, -13, 35, 20, 24, -5, 4, -24, -8, -2, -30, 18, 22,
+  0, 20, -26, -39, 0, -27, -37, -9, -35, -44, -33, 27, -20, -15, -26, -34,
+  26, 14, -26, 0, 16, -22, -37, -8, 7, -3, -2, -29, -29, -6, 25, 20,
+  -25, -14, -54, 49, 17, 27, -13, -34, 31, -12, 28, -38, 26, -111, 53, -7,
+  12, 10, 21, -28, -56, 0, 61, 9, -52, -22, -19, -29, -33, -12, 53, -32,
+  12, 54, 46, 25, 4, -32, 7, -22, 63, 13, 7, -40, 20, 3, 28, 21,
+  7, 11, -35, 12, 27, -26, -11, -3, -17, 27, -23, -26, -2, -43, -45, 66,
+  -59, 6, -40, -10, -23, 0, 25, 63, -13, 77, 6, 2, -26, -30, -32, 4,
+  3, 83, -8, 40, 32, -16, -44, 20, 18, 44, 14, 60, -14, 9, 7, -10,
+  36, -54, -10, 20, -94, -7, 15, -30, 66, -38, -15, -35, 46, -6, 47, -3,
+  -83, 61, -12, 3, 11, 15, 17, -38, -5, 9, 31, 28, -9, 43, 9, 51,
+  -49, -17, 14, 18, -22, -7, 20, 2, -8, 3, 33, 42, -18, 5, -38, -21,
+  -82, 8, -11, 16, -3, -26, 36, 40, -14, 2, 11, -11, -8, 3, 33, 0,
+  -21, -48, 10, 10, 41, 7, -7, -27, -29, -60, -17, 3, -7, -16, 0, 5,
+  -45, 45, -2, -52, 6, 7, -62, -3, 40, -32, -5, 59, -11, 0, 27, -3,
+  20, 0, 32, 29, 25, -2, 24, -20, 19, 29, 13, 20, -18, 50, 3, -36,
+  3, 11, 53, 16, 3, -3, 47, 0, 30, -21, 11, 9, 8, 0, 26, -8,
+  39, -15, -8, 39, -78, -39, 0, -56, -23, 8, -72, 39, 7, 25, 17, 0,
+  28, 0, 35, 6, 6, -5, -34, 33, 18, 47, 12, -31, 31, 98, 45, -16,
+  -39, 2, -39, -26, -49, 35, 40, -36, 38, 53, -20, -18, -46, -5, 41, 12,
+  -59, -25, 28, -5, 11, -6, -43, 5, 11, 7, -40, -20, 33, -16, -5, 5,
+  52, -30, 36, 20, -25, -24, -19, 10, -3, 27, -32, -26, 12, 43, 0, 8,
+  -3, 39, 16, 0, 23, -16, -25, -56, 40, 6, 17, -6, -15, 69, -18, -8,
+  49, 6, 0, -8, -31, -2, 88, 9, 8, 21, 37, -18, -22, -24, -25, 83,
+  -26, 8, -6, -5, 31, 23, 50, -26, -33, -14, 40, -22, -10, 64, 28, -59,
+  0, 3, -18, -39, 127, -17, 15, -40, 0, -52, 2, 10, -62, -74, -10, -27,
+  3, -73, 42, -40, -37, 5, 84, -3, -35, 32, -79, -33, -22, 0, 21, 38,
+  26, -30, 68, -80, -46, 0, 47, -38, -19, -48, -90, -34, -92, 37, -28, -43,
+  -7, 16, 22, 13, -104, 14, -61, 0, 53, 7, 0, -42, 10, 73, -35, 57,
+  -10, -18, -13, 49, -4, -2, -22, 3, -38, 25, -10, -52, 17, 0, 52, -33,
+  38, 15, 14, 6, 37, 25, 0, -9, 10, 47, 14, 11, -22, -10, 18, -5,
+  52, -17, 4, 10, -52, 5, 44, -2, 8, -24, 60, -52, 3, 34, 47, 17,
+  3, 55, 0, 16, -20, -14, -22, -14, 22, 65, -46, -15, -53, 0, 28, 33,
+  -23, 6, 33, -15, -20, 29, -17, 23, -17, -55, -10, -19, 7, -59, -5, 25,
+  -21, 39, -14, 55, -60, -9, 25, 3, -5, 29, -22, -64, 0, 16, 15, 27,
+  23, -25, -53, 31, 12, -26, -24, -2, -19, -18, 10, -34, -22, -8, 3, -2,
+  -13, 0, 20, -8, -28, -60, -4, -49, -64, 0, 54, -26, -20, -13, 33, 21,
+  -39, 57, 51, 64, -49, 10, -2, 66, -26, 30, 57, -29, 29, -50, 52, 19,
+  10, 52, 7, -15, -26, 24, -25, -9, 5, -79, -34, -28, 2, -16, 27, 11,
+  39, -15, -18, 36, 3, -21, -24, -22, -30, -8, -3, -26, -89, -37, -66, -24,
+  13, 16, 0, 35, 6, 14, -18, -9, -3, 26, -17, 4, -71, -89, -16, 77,
+  -49, -9, 28, -7, 70, 17, 46, 10, 6, -8, -15, 52, -19, -25, 32, 14,
+  21, 3, -23, -55, 74, 35, 3, 12, 66, -17, -7, -25, -26, 3, -33, -11,
+  33, -8, 46, -3, -22, 7, 54, 45, -35, 5, -23, 12, 9, -47, -19, -43,
+  -40, -30, -6, 45, -48, -9, 22, -12, 0, 5, -31, 20, -43, 22, -23, 13,
+  21, -81, -17, -14, -56, -14, 39, -8, -30, -12, -11, 51, -16, 14, -25, 25,
+  28, -21, -32, 17, 72, 8, -19, -44, 9, -63, 36, -54, 0, -7, -27, 9,
+  -52, 2, -12, -44, 18, -19, -12, 8, -52, -9, -8, 2, -42, 0, 7, -22,
+  -11, -16, -32, 64, -16, -62, 16, -40, 3, -11, -29, -18, -26, 11, -11, 6,
+  21, 44, -35, 47, -61, -6, -22, 0, -3, 28, -23, -15, -11, -7, 14, 0,
+  28, 17, 21, -21, -13, -17, -80, -27, -23, -10, -46, -38, -20, -82, -24, 3,
+  11, -14, -77, -21, -28, 13, -69, 38, 18, -15, -34, 9, -11, 15, -68, 27,
+  -49, -12, 13, 15, 13, -39, -29, -40, -3, -56, -59, 10, -26, 33, 19, -18,
+  -9, -24, 35, -20, -28, 11, -17, -68, 16, -9, -28, 18, -33, -49, 6, -22,
+  -24, 21, 19, -7, -33, 2, 16, -34, 9, -30, -14, -32, 8, 4, -20, 12,
+  -19, -5, -61, 41, 46, 29, -8, 5, 9, -3, -19, 18, -46, -12, 36, 41,
+  41, -34, -57, -15, 10, 7, 16, -24, 22, 37, -7, 5, -9, 14, -13, 29,
+  -6, -3, 3, -3, -14, 19, -50, 8, 0, -34, 45, -44, -22, -57, -59, -28,
+  43, -45, 45, -38, -13, 8, 3, 3, -37, 30, -27, 48, -5, -26, 14, -25,
+  -56, -29, -85, 9, 11, 24, -42, -3, 9, -57, -88, -37, -46, -42, -7, -8,
+  4, -112, 0, 36, -22, -36, 8, 0, -25, 8, -42, -5, -52, -76, 19, 50,
+  -41, 88, 99, 3, 37, 22, -28, 38, 26, -53, 20, -4, 5, 35, -70, -9,
+  39, 86, 45, 14, -127, -68, 22, 17, -43, 56, -36, 0, -35, 19, 68, 74,
+  -7, 34, 41, 38, -91, -75, 73, 20, 9, -48, 42, -48, 56, -77, 39, 30,
+  86, -65, -73, -70, 29, 7, 69, -32, -22, 8, -3, -30, -17, -112, -79, 0,
+  6, -24, -9, 6, 9, -39, 6, -11, -56, -37, -34, 81, 11, 39, 25, -69,
+  63, -28, -11, -35, -46, 12, -19, -54, 3, -30, -16, 10, 65, 52, 7, -28,
+  -78, 2, 53, -32, -35, -29, 8, 3, -34, -6, 23, 32, 32, -15, 7, 3,
+  41, -87, -19, 46, -35, 49, 12, -11, -6, -5, -10, 25, -29, 4, -3, -23,
+  -18, -48, -23, -17, 33, -8, -11, 11, -7, 28, -59, 33, 27, 46, 8, 25,
+  24, 10, 34, -45, -42, 19, 6, -27, -3, 53, -25, -32, -28, -4, 0, 3,
+  4, 24, -49, -41, -46, 3, -46, -8, 9, -24, -72, -44, -70, -6, -11, 14,
+  4, 9, 16, -27, -29, 16, -4, -16, 16, -3, -20, -33, -40, -54, -24, 73,
+  -74, -3, -3, 36, 37, -39, 41, 45, 30, 47, -17, 18, 71, -28, 11, -72,
+  -12, 17, -29, 38, -78, -8, -22, 34, 23, -10, 0, -32, -70, 11, 34, 6,
+  -22, -26, 73, 89, 39, -5, -19, -23, 43, 0, -34, -53, -28, -3, 53, -5,
+  -38, -6, -16, -30, -42, -3, 65, 8, 19, -24, -23, -3, -52, 11, -16, 6,
+  15, -7, -23, -6, -70, -8, -30, -60, -30, 3, -3, 40, 27, -18, 17, 31,
+  -4, -24, 56, -14, -23, -4, 6, 13, 72, 13, -38, -38, 23, 22, 0, 9,
+  -82, 22, 24, 32, -63, 0, -31, -38, -46, 0, -8, 0, 53, 36, 50, 27,
+  26, 0, 3, -24, -6, -26, -4, 19, 31, 19, 10, 8, -14, 29, -3, -3,
+  1, -30, -17, -1, 0, 14, -17, -23, -9, -6, -7, 0, 8, 23, -20, 10,
+  -18, -2, -15, -5, 12, 11, -16, -17, 12, -8, 11, -16, 24, 19, -22, -23,
+  -24, 24, -26, -5, 16, -7, -5, -9, 51, 13, 23, -5, 8, 0, 3, 3,
+  -10, -10, -29, 18, 9, 21, 8, 18, -4, 14, 11, 13, 1, -12, 20, -5,
+  -8, -8, 16, -12, -4, 0, 5, -18, -11, 7, -13, -15, 9, -10, -4, 6,
+  -5, -16, 10, -2, -11, -12, -12, 9, 0, 14, 5, -1, 0, 10, -2, 6,
+  3, -1, -4, 4, 18, 7, -12, 0, -6, -4, -9, 3, -29, 28, -5, -24,
+  5, 7, 21, -8, 6, 23, -4, -6, 10, 5, -18, 17, 8, -13, 31, -14,
+  -12, -2, -19, 5, -50, 1, 15, -5, 11, 13, -30, 3, 16, 0, 1, -10,
+  7, -8, 27, -11, -26, -7, -4, 16, -11, 6, 10, -16, 1, 5, -5, 20,
+  24, 17, -2, 1, -10, 12, -11, 16, 7, 7, 0, -6, 2, 4, 7, 13,
+  -23, -9, 4, 3, 4, -17, -15, -7, -6, 6, -29, 19, -7, -23, -6, 12,
+  -1, 0, 3, -26, -4, -5, 9, -9, -17, 6, 1, 5, -23, -13, -16, -3,
+  -9, -5, -27, -13, 8, -11, -6, 23, -4, 46, 25, -7, 40, -2, 17, 1,
+  -19, 4, 0, -8, 0, -15, -25, -8, 13, 13, -49, 1, -28, -8, 5, 1,
+  -17, -10, 4, 4, -24, -3, 0, -4, -3, -4, 12, -6, 15, 13, 6, -31,
+  -51, -13, -3, 23, -26, -10, -18, 32, 32, 0, 8, -44, -19, -59, 23, 3,
+  4, 13, -21, 13, -51, -5, -39, -36, -40, -21, 28, 0, 27, 17, 41, 9,
+  -22, 28, 15, -1, -36, -10, -36, 6, 34, -53, 28, -6, -49, -61, -127, -33,
+  2, -51, 34, -39, 7, 57, 53, 17, -48, 12, -50, 16, -47, 7, -16, 14,
+  -7, -31, -15, -21, 15, -28, 10, -32, -27, 12, -13, -14, -4, -16, 5, 17,
+  -9, -27, 2, 21, 0, 2, -12, 44, -11, 9, -11, 1, -1, 5, -3, -17,
+  -10, -4, -17, -14, -18, 12, -21, 6, -13, 15, 21, -21, 3, -14, 3, 8,
+  12, 0, -24, 18, 10, 11, -8, -21, 3, 5, -36, -1, -9, -27, 6, 5,
+  4, -13, -13, 10, -28, -10, 10, 4, 12, -7, -13, 9, 3, -28, 1, 36,
+  7, -5, 6, -18, 17, 13, 1, 6, -4, 2, 13, 4, 17, 0, -9, 3,
+  -12, -7, 26, -5, -6, 15, 9, -21, 10, 21, 9, 0, -8, -17, 8, -4,
+  -19, -4, 4, -14, 9, 6, 28, -2, -31, -14, 3, -14, -13, 3, 10, -9,
+  1, -3, -7, 25, -11, -5, -13, -21, 8, 22, -9, 14, 4, -11, -25, -40,
+  -26, 0, -16, -24, -21, -20, 25, -17, -21, 38, -8, -19, -6, -2, 5, -7,
+  29, -11, -17, -7, 16, -1, -14, 1, 10, -60, 11, -14, -44, -18, -12, -15,
+  -2, 14, 26, 3, -24, -30, -38, 15, -4, 34, -11, -7, -13, -25, 9, 8,
+  -12, -27, -1, 0, -6, -3, -6, 16, 14, 4, -18, 5, 4, 5, 16, 12,
+  15, 13, -21, 5, -23, -12, 12, -2, -5, 11, -9, 22, -6, 28, 11, -4,
+  -2, -2, -2, 0, -36, 6, 4, -6, 1, 8, -2, 1, -29, -14, -5, -11,
+  -12, -14, -16, 23, -21, 15, 4, -12, -9, 9, -12, 12, -8, -5, -10, 7,
+  -53, -8, -10, -13, -62, 3, -20, -82, -63, -56, 54, 53, 40, -55, 31, 0,
+  -52, -46, -13, 29, -35, 20, 0, -16, -48, 8, 30, 15, 15, -22, 86, 4,
+  -36, 9, 5, -46, -30, -52, -37, -3, -30, -80, -32, 17, -25, 11, -73, -29,
+  -27, -38, -19, -77, 39, 8, 5, -10, -42, 0, 39, 3, 7, -61, 3, 21,
+  14, 49, -38, 10, -28, 17, 7, 0, -8, 8, -10, 31, 23, 0, -10, 34,
+  5, 12, -42, 34, -71, -47, -54, 28, 24, 24, -53, 19, -15, 67, 70, 18,
+  45, 20, -24, 36, 8, 0, -23, -34, -37, -18, 23, -19, -17, 54, -9, -26,
+  50, 34, -73, -55, -54, 51, 39, 16, -103, 29, -16, -21, -52, 70, 45, 14,
+  -21, 33, 45, -27, 73, -57, 53, 78, 36, 49, 24, 31, -26, -111, -24, -8,
+  71, -96, -35, 25, 67, -17, 46, 49, -14, 8, -20, -8, 18, 45, 94, -11,
+  90, 12, 5, 14, -114, -29, -79, -31, -41, -18, -55, 22, -85, -22, 9, -33,
+  23, -11, -46, -26, -42, 8, -25, -3, 8, -22, 0, -21, 17, -22, -13, 7,
+  -43, 20, -17, 47, 39, 23, 0, -23, -12, -4, -14, -27, 13, -9, -10, 8,
+  48, 0, 26, 50, -20, 15, 0, -41, 10, 64, -36, 11, -64, -99, 127, -26,
+  -31, -14, 69, -18, 4, -6, -5, 46, 74, -33, 0, -8, -68, -4, -21, 20,
+  5, -4, 8, -59, -8, -20, 25, -22, -38, 16, -16, -33, -7, 26, 13, 25,
+  -78, -4, -59, -84, 6, 37, 37, 14, -52, -34, -116, 120, 30, -4, -58, 23,
+  -5, -25, 19, -71, -59, 15, -85, -57, 10, -108, -69, 54, -3, 54, -45, -67,
+  -40, 61, -44, -61, 30, 48, 23, -77, -107, 73, -14, 19, 72, -29, -34, -39,
+  -77, -30, 31, -4, 0, 43, 64, 13, 4, 6, 8, 48, -17, -9, 42, -14,
+  29, 25, -10, 0, -90, 93, 33, -87, -32, 60, -27, 84, -59, -21, -27, -41,
+  24, 71, 19, 63, -86, -17, 35, 28, -114, 60, -76, 8, 0, 22, 0, 7,
+  67, -26, 20, 53, -17, 13, -14, 34, 44, -7, -60, 3, -76, -18, -13, 39,
+  -9, 53, 54, -59, -66, 0, 35, -6, -57, 3, -16, -79, -31, -9, 22, 67,
+  -25, -53, 24, 27, -11, -30, -63, 5, 8, -68, 10, 22, -73, -9, -10, -30,
+  86, -58, 6, 8, 35, -7, -4, -24, 52, -44, 3, 8, 6, -58, -70, -4,
+  -58, -38, -44, 7, 4, 3, 9, -6, 63, 4, 14, -33, -21, 4, 4, -26,
+  9, -45, -19, 51, 0, -8, -69, -32, -68, -22, 35, -3, 17, -48, 0, -56,
+  -11, -33, -42, -47, -23, -23, 10, -18, 4, -83, -3, -35, 16, -34, -17, -45,
+  86, -4, 6, -67, -4, 12, -50, 33, -35, 20, -7, 23, 0, 45, 16, 7,
+  27, -12, 20, -71, 30, 29, -5, -74, -81, -15, -46, -19, 59, -58, 103, -49,
+  45, 4, 11, 33, -4, -16, -79, -26, -65, -35, 39, -45, -66, -22, -51, -35,
+  -64, 33, -38, 20, 0, -13, -27, 110, -12, 19, 0, -13, -53, 9, -44, -94,
+  71, 12, 83, 29, -55, -35, 54, 57, -42, 36, -16, 61, 0, 4, -25, 37,
+  -13, -14, 108, 21, -51, 29, -65, 9, 44, -29, -55, 0, 13, -25, 9, -20,
+  45, 8, -31, 48, -15, -71, 35, 3, -38, 48, -31, -15, -59, -17, -64, 11,
+  -21, 3, 24, 10, -38, 13, 15, 0, 15, 0, -56, -97, -40, 26, 3, 23,
+  -50, 50, -50, -3, 74, -4, 15, 18, -13, -21, -2, -46, -21, -24, -18, -6,
+  24, -9, -37, 0, 22, 12, -24, -18, 19, 41, 62, 4, 10, 32, -10, 12,
+  -116, 3, 0, 25, 46, -9, -15, 14, -9, -29, 80, 30, 8, -3, -2, -5,
+  5, -62, 8, 3, -8, 0, 8, 0, 54, 3, -28, -17, 20, 19, 41, 11,
+  14, -28, 31, 22, 9, -26, -20, 34, -49, -57, 17, -14, -9, 51, -9, 31,
+  41, 15, 52, 21, -6, 39, 7, 21, 50, 3, 3, -10, -13, 32, 16, 27,
+  7, -17, 23, -14, -17, -18, -15, 5, 6, -5, 38, 41, -3, 7, -5, -8,
+  3, -40, 5, -10, -127, -18, -15, -48, -39, 6, -3, 10, 40, -13, 15, -3,
+  -21, -19, 36, 13, 0, 2, 35, 18, 31, -9, -20, -6, 9, 118, 46, -33,
+  -14, 31, 0, -5, 22, 12, -31, 30, 39, 98, 31, 17, -25, 27, 45, -2,
+  10, -8, -17, 3, -17, -24, 44, -17, 9, 31, 33, 9, 0, -16, -14, -11,
+  -11, 71, -3, 23, 34, -35, 8, -14, 18, -28, -46, 77, 10, -10, -10, 45,
+  14, -25, -22, 35, -50, -4, -38, 73, 34, 33, 74, -26, 16, -14, 43, 36,
+  -20, 48, -15, -48, -41, 29, -17, 44, -3, 22, -3, 33, 38, 0, 52, 52,
+  0, -28, 3, -14, 0, 56, -93, 22, 9, 38, 15, 0, 36, 10, -55, -21,
+  -24, 40, -21, 33, 4, 8, -28, -21, 48, -40, -51, 23, -40, -93, 74, 28,
+  -54, -50, 19, 13, 21, -23, 0, -21, -3, 15, -5, 3, 9, 0, 74, 3,
+  -81, 41, 74, -35, -48, 12, -70, 37, 6, -41, 80, 19, -32, 19, 6, 44,
+  -55, 23, -9, -36, 3, 0, -22, 60, -69, 46, -44, 48, -23, -10, 19, 3,
+  -11, 49, 18, 46, -42, 40, -30, 82, 33, 8, 0, -43, -15, -10, -3, 45,
+  -21, 78, -5, -38, -15, 9, 0, 31, 42, -18, 12, -17, -105, -3, 12, 31,
+  -27, 68, -37, -8, 38, -15, 42, 32, -44, 14, 41, 35, 32, -38, 3, -12,
+  -72, 3, -26, -52, -9, 83, 48, 53, -37, -5, 15, 32, -29, -20, 19, 0,
+  -8, -28, 24, 8, 59, -43, -10, 14, 51, 31, 26, -13, 22, -16, 23, -11,
+  -50, 16, 5, 22, 0, 26, 38, 34, 18, -3, 57, -20, 25, -10, -12, 3,
+  -51, 57, 107, -8, 70, 17, 0, 5, 0, -41, -21, 48, 38, -87, 3, -5,
+  -27, 11, -3, -22, 9, -65, -37, 36, -6, 31, 9, 9, 5, 10, -7, -32,
+  -27, -62, 16, -3, -34, 33, 28, -7, 12, 37, -43, -57, 20, 19, -13, -14,
+  -14, 53, 12, 6, 0, 28, 81, -18, -23, 27, 5, 20, -34, 20, -31, -47,
+  57, -46, -22, 5, 80, -17, 38, -32, -8, 55, 14, 25, -54, 35, -32, -69,
+  -20, -40, -37, 30, 32, 30, 22, 36, 43, 22, 80, -18, -21, 20, -2, 35,
+  11, -34, 8, 23, -17, 30, 55, -21, 6, -25, 13, -30, 27, -45, -28, 0,
+  -4, -47, 2, -57, 50, 53, -35, -9, 26, 27, 67, 52, 25, 14, -46, -11,
+  -112, 17, 55, -43, 29, -29, -24, 0, -3, 5, 3, 25, -10, -38, 10, -25,
+  10, 54, 9, 0, -17, -3, 11, 43, -14, -14, -6, 18, 10, 39, 43, -66,
+  10, 5, 4, -13, -23, -10, 21, -3, -16, 4, -14, 10, 4, 15, -2, 2,
+  11, -2, -9, -22, 11, -14, 15, 21, -10, -2, 2, 7, 19, -18, -5, -47,
+  18, -40, -65, 14, 39, 26, -3, 9, 15, -8, -16, -14, 46, -23, 2, 15,
+  26, -19, -4, 2, 11, -32, 25, -35, -9, -11, -20, -10, -8, 10, 9, -36,
+  -39, -21, -14, -8, -6, 13, 29, -3, 25, -4, -12, -8, 2, -54, 4, -17,
+  57, -12, -11, 7, -9, -6, -40, -37, -18, -30, -2, 0, 2, -36, -2, 23,
+  23, -42, -39, 39, 15, -4, -27, 21, 25, -6, -18, -27, -34, -4, -44, -32,
+  75, 6, -29, -13, 11, 18, 68, 0, -9, -26, -32, -7, -14, -27, 26, -6,
+  -12, 0, 6, -4, -6, 8, -6, 10, 5, 4, 12, 46, 13, 22, 2, 0,
+  60, 43, -26, 2, 5, -17, 13, 19, 18, 25, -42, -13, -9, 5, 19, 25,
+  36, 8, 25, -37, -2, -39, 13, -32, -8, -8, 5, -38, 5, 0, 12, -7,
+  8, 22, 37, -52, 24, -11, 17, -7, -17, -20, 16, -30, -30, -20, -26, 36,
+  6, -23, 8, -35, -71, 11, 6, 3, 2, -4, -18, 30, -4, 2, -12, -24,
+  22, -50, 22, -7, 14, -39, -13, -9, -52, 2, -23, 37, -5, 5, 5, 2,
+  18, 12, -22, -8, 22, 9, 3, -11, 40, -4, -34, 8, -36, -21, -7, -11,
+  13, -9, -7, -19, -2, 34, 20, -44, 44, -2, -34, -43, 6, -12, -9, -6,
+  -29, 26, 6, 4, -16, 40, -8, -89, -52, -45, -2, -71, -13, 83, -21, 2,
+  106, -7, -18, 12, 5, -14, -7, -21, -127, 37, -25, 57, -19, -3, -70, 57,
+  -21, -53, 0, -47, 41, 2, -117, -70, -8, -29, -8, -8, -15, 2, -15, -22,
+  13, 43, -46, 40, -46, -2, 6, -29, 2, -24, 20, 2, 12, -52, -11, 24,
+  0, 14, -22, -21, 19, -15, 11, 31, 30, -32, -19, 20, 11, -7, 31, -15,
+  60, -5, -11, 34, -18, -37, -20, -44, -10, -18, -2, -18, 14, 39, -47, 11,
+  49, -3, 36, -12, 12, 19, -5, 7, 4, -4, 47, -8, 5, -64, 44, 0,
+  16, -2, 20, 38, -9, 45, 54, 15, -30, -9, -9, 0, -50, 0, 5, 10,
+  -27, -31, -2, 37, -74, -15, 6, 29, -2, -24, -4, -15, -23, -10, 6, -15,
+  0, -31, 7, 7, -23, -30, 11, 2, 4, -32, 4, -18, -5, -13, 38, -28,
+  -18, -25, 20, -10, 22, 7, -11, 14, -28, -12, 26, 19, -22, -27, -12, -15,
+  67, 9, 7, 17, 9, 29, -73, 9, 15, -4, -14, 3, 0, 5, 7, -4,
+  -4, 47, -24, 21, 26, -40, -13, 16, 18, -45, 29, 46, -4, -10, 21, 78,
+  -33, 0, 15, 38, -32, -34, 49, -21, -36, -34, 11, -4, -59, 70, -2, 23,
+  -70, -2, 65, -37, -5, -52, 50, -12, -40, -21, 13, -41, 44, -19, -71, 32,
+  13, -32, 13, 25, 15, -32, -31, -26, -63, -42, 25, -17, -2, -7, -27, -20,
+  20, 38, 36, 10, -10, -42, -40, 16, -9, -4, 19, 38, -13, -37, -2, -11,
+  -65, -60, 35, 19, -34, -10, -9, 5, -6, -23, -6, -2, 23, 18, 9, -25,
+  -8, 7, 39, -43, -12, 35, 16, 33, 6, 2, -47, -54, -36, 4, -7, 41,
+  -13, 22, 4, 29, 13, 5, 51, -26, -57, -20, -2, -16, -6, -20, 0, -22,
+  3, -46, -16, 0, -64, -35, 45, 14, 24, 8, -13, -10, 47, -42, -15, -42,
+  -79, -25, 0, 38, 6, 4, 23, -76, 5, -87, -5, 3, -23, -24, 28, -3,
+  -14, 33, 11, 54, -19, -27, -17, 12, 50, 0, 41, 37, -105, 57, 42, 12,
+  -7, -3, 6, -22, -41, -53, -19, 12, -26, 26, 0, -25, -10, -62, 26, 27,
+  5, -52, -42, 51, 21, 20, 58, -17, -42, 31, 20, 10, 42, 45, -15, -11,
+  -43, 16, -89, 95, 9, -19, -41, -28, 36, 15, -30, -40, -27, 17, 22, -11,
+  -14, 24, -29, 48, -54, 17, -52, -39, 22, 49, -31, 2, -29, 38, -45, 44,
+  -20, -14, 23, -30, -17, -35, -15, -34, 3, -53, -21, 11, -44, -20, 10, -53,
+  -59, -52, 37, -38, -127, 23, 20, -27, -45, 34, -36, -13, -2, 13, 26, 8,
+  -82, -44, 53, -50, 0, -21, 23, -21, -34, -12, -15, 6, 27, 17, 37, -11,
+  -14, 63, -26, 21, -80, 27, 3, 0, 58, 16, -10, 23, -102, -3, -3, -37,
+  89, 14, 29, 11, 26, -38, 4, 2, 103, -26, -9, 50, -3, -39, 10, 27,
+  35, 40, -24, -18, 0, 3, -40, 58, -12, 17, 38, -40, -12, -35, -3, 11,
+  -32, -13, 7, -19, -62, 8, -41, 9, -16, -36, -7, -3, 43, -7, -15, -36,
+  7, 15, -37, -59, -29, -5, -24, -23, -42, -14, 3, -6, 0, -11, -58, 69,
+  -20, -25, -46, -63, -6, -3, 33, 17, -17, -19, -6, 75, -10, -13, -67, 24,
+  -64, -15, 21, -94, 55, -63, 38, 41, 36, -8, 72, 10, -30, -13, -51, -96,
+  25, 25, -12, -54, -115, -9, 3, 6, -5, 42, -72, -29, -105, -3, -28, -39,
+  118, -39, -37, -11, -13, -32, 38, 7, 6, -57, -66, -60, 48, -41, -55, -10,
+  -41, 31, 60, -63, -6, 9, -7, -12, 114, 0, -47, -98, 5, -36, -34, -50,
+  -29, -31, 18, 56, -110, 93, 3, -51, -18, 34, 31, -73, -40, -10, 72, -51,
+  47, 63, -50, -38, -27, 15, 78, 15, -42, 30, -17, -20, -107, -14, 43, -117,
+  -51, 24, -96, 21, 19, 15, 31, -14, -11, -44, 24, 23, -19, -32, 39, -52,
+  -51, 68, 6, -99, -29, 27, -30, 50, -34, 10, 15, 21, -5, -92, -14, 53,
+  -19, -6, 11, -13, 85, 0, -13, 86, -15, -11, -8, 23, 25, 0, -15, 8,
+  0, 25, 5, 28, 12, 11, 49, -3, -10, 15, -57, -29, 25, -64, -31, -58,
+  10, 2, 18, -21, 51, 10, 49, -23, -70, -16, -17, -35, -25, -54, -36, 0,
+  24, -8, -35, 0, 15, -18, -41, -22, -46, -29, 59, 27, -36, 30, 10, 13,
+  -40, -55, -11, 15, -42, 30, -25, 72, -6, -3, -8, -33, -12, -6, -28, -31,
+  50, -16, 0, 57, -65, 9, -58, 49, -91, 33, -10, 0, 36, -24, 0, 19,
+  37, -15, 92, 5, 38, 2, -35, 5, 0, -85, 3, -29, 10, -57, 0, 49,
+  106, -51, 14, -41, -9, -15, 44, -34, -34, -29, -53, 14, -44, -30, 5, 0,
+  24, 6, -74, 30, 25, -5, 15, -34, -45, 65, -10, 23, -17, -13, 33, -96,
+  18, -75, 38, -22, 27, 23, 58, 0, 36, 18, 27, -9, 23, 3, -49, 6,
+  -108, 24, 0, -43, 29, -27, 31, 12, 39, 8, 52, 21, 19, 24, -19, -7,
+  58, 17, -17, 30, 17, -21, 26, 48, -60, -34, -50, -30, 10, 53, -17, 50,
+  9, -40, 0, 26, -25, 36, 0, -15, 3, 10, -2, 31, -42, -44, 15, -22,
+  -58, -11, 25, 0, -20, 13, 27, 0, 0, -36, 15, 7, 21, -55, 24, -29,
+  6, 11, 6, -2, -14, -25, 6, 6, 31, 7, -89, 5, 11, -16, -14, 8,
+  -18, 10, 17, 28, 25, 23, -22, -6, -12, -2, -13, 21, 13, -17, -8, 27,
+  16, -82, -7, 30, 40, 17, 4, -29, 23, 5, -9, 37, -28, 47, 2, -58,
+  0, 8, 70, 11, 25, -40, -15, 18, 31, 10, 30, 17, 12, -20, 5, 7,
+  -14, -39, -3, 23, -30, 8, 0, 18, 50, -2, 47, 20, 16, 12, -30, -13,
+  15, 7, 25, 33, -37, 18, 25, -14, 39, 16, 0, -12, 9, -22, -12, 39,
+  2, -61, -5, 26, -36, -21, 47, -18, 0, 12, -55, -11, 28, 19, 20, 27,
+  -15, -32, 19, 41, 5, -27, -25, 16, 36, -49, 34, -37, 18, 46, 3, 7,
+  -26, 4, 9, -2, -16, 19, 12, 36, -7, 44, 18, -12, -79, 0, 30, 23,
+  -12, 2, 10, 42, -35, -20, -25, -35, 7, 33, -41, 2, 31, -3, 45, 11,
+  -2, 16, 32, -9, 15, -2, 15, 38, -15, 24, -33, 66, 0, 16, 15, -63,
+  -40, 8, -23, 16, -30, -2, -15, -8, -13, 23, -30, 39, -2, -38, 16, 14,
+  9, -2, -57, 44, 25, -15, -54, 49, -33, 2, 6, 37, -54, 37, -17, 6,
+  -32, -27, 49, 14, -32, -63, -57, 10, -27, -4, 35, -41, 29, -25, 10, -45,
+  -30, -34, -59, -20, 11, -54, 19, -53, 13, -15, -55, 43, 13, -44, 50, 27,
+  6, -29, 39, -3, 43, 13, -10, -29, -49, -70, 11, 52, -6, 23, -5, 2,
+  -26, 34, -88, 48, 3, 33, -60, -10, -7, 5, -6, 9, 25, 32, -75, -36,
+  20, -34, -49, 5, -37, 5, 35, 66, 56, -12, 56, -51, 27, -17, 12, -55,
+  -41, 3, 23, -20, 0, 21, 32, -38, 43, 41, 26, 37, 0, 27, 66, 2,
+  18, 51, 39, 14, 28, 2, -32, 55, -4, 67, 25, -7, -10, 26, 42, 2,
+  29, -13, 22, 30, -38, -25, 63, -26, -43, -23, -24, -37, -41, -12, -11, -23,
+  -47, -2, -10, 5, 40, 30, 44, 39, 34, 23, 53, -18, -38, 22, 4, 25,
+  -39, 11, -20, -4, -15, -4, 36, 26, 10, -5, 15, 17, -11, -25, -39, 51,
+  -55, 16, 72, 19, -5, -10, 50, 16, -38, 44, 6, -20, 25, 35, -26, -50,
+  55, -17, -22, -25, 16, 8, -30, -16, 45, 35, -6, -12, -27, -28, -25, -15,
+  6, -15, 35, 7, -22, -15, -127, 19, 56, -43, 30, 0, 18, 11, -6, 16,
+  57, 21, 9, -11, 69, 6, -13, -47, 31, 2, 7, -17, -4, -19, 81, 19,
+  86, -19, 47, -14, 25, -19, -22, -16, 2, 8, -32, 20, -37, -49, -13, 2,
+  -14, -17, -3, 32, -5, -33, -116, -2, 7, -49, 0, -20, -30, 30, -33, 32,
+  -32, -39, -27, 40, -50, -13, -38, 0, 32, 35, 38, -21, 45, -20, -23, 5,
+  5, -50, 14, -54, 15, 34, 21, -35, -18, 0, -24, 6, 55, 27, 48, -29,
+  -12, 13, -31, -16, -10, -5, -27, -8, -27, 23, -11, -22, 41, -55, -13, 31,
+  43, -22, 25, -48, 3, -12, 54, 8, 29, -23, -21, -14, 0, 7, -42, -6,
+  -3, -5, 27, 54, -27, -68, 32, -16, -15, 29, -53, 4, 11, -6, 27, -36,
+  35, 0, -23, -5, 5, 13, 30, -7, -16, 6, -16, -14, -21, -28, -22, 6,
+  42, 24, -13, 30, -16, -16, 12, -7, -14, -32, 5, 6, 46, 18, -10, 39,
+  15, -2, 28, 17, 27, 23, 4, 22, 12, 6, -41, -18, 7, -6, 21, 13,
+  26, -55, 28, -21, 0, 38, 8, 8, 25, 10, -38, 34, 0, 53, 5, -57,
+  -17, -20, -20, 8, 36, -5, 19, -29, -58, 6, -3, 11, 3, 3, 11, -27,
+  -8, 27, -18, -7, 16, -26, -3, -36, -34, 26, -24, 6, 22, -73, 20, 30,
+  25, -5, -103, 0, -3, 18, 49, -30, 24, 35, 15, -38, 0, 20, 38, 21,
+  -7, -55, 46, 33, -16, -3, 12, -8, 31, 15, -13, 0, 3, -25, -46, 6,
+  -12, -59, 14, 11, 41, 19, 40, 22, 26, 18, -11, -4, -29, -31, 11, -43,
+  46, 7, -8, -14, -73, -32, -16, 16, -53, -13, 5, 0, -34, 112, -20, -12,
+  36, 2, 16, 29, 41, 8, 22, 37, 45, -9, -19, -16, -38, -6, -7, 24,
+  -7, 79, 62, -9, -12, 13, -8, 10, 15, 15, 29, -2, -8, -42, 26, -28,
+  0, 3, -20, -41, 36, 40, 27, 7, -3, -6, -44, 14, -3, -21, 8, -58,
+  46, -20, -10, -10, -22, -16, 19, -7, -67, -3, 45, -37, 0, 4, 36, 6,
+  -11, -9, 40, 14, 34, -23, 19, 0, 3, -9, -37, 18, 3, -23, -24, -26,
+  26, -12, 0, -53, -50, -6, 0, -36, 3, -10, 54, -2, -70, -14, 44, -6,
+  55, -20, -54, 60, -82, -19, -102, 110, 26, 88, 69, -25, -93, -58, -66, -9,
+  -23, -34, -18, -14, -13, -2, -65, -33, -123, 23, 117, 34, 56, 4, -46, -12,
+  -11, 21, 36, 23, -27, 13, -78, 27, 104, -76, 67, -62, -24, -93, 14, -11,
+  -37, -118, -15, 30, -37, 0, 4, -5, -70, -15, -22, 27, -20, -95, 18, 60,
+  29, -59, 28, 38, -50, -38, 3, -52, -22, 36, -30, -21, -37, 45, -30, 6,
+  8, -91, -10, -37, 48, 2, -22, 7, 20, 16, -24, -9, 2, -7, -59, -24,
+  11, -75, -32, -9, -48, -5, -52, -37, 15, 3, -26, -49, 3, 6, 17, -29,
+  22, -9, 3, 62, 37, -19, 24, 5, -21, -21, -16, -37, -11, -21, 3, -20,
+  49, 13, 17, 24, 5, -11, 16, 11, -19, 33, 25, 0, 19, -38, 3, 18,
+  61, 50, -34, -47, -29, -22, 0, 7, -6, 13, -24, -71, 12, 44, 63, 36,
+  -29, 9, -99, -17, -17, -3, 22, -27, 15, 15, -37, -9, -17, -44, -24, 42,
+  0, -15, 12, 24, -6, 13, 8, 23, -25, 39, 29, 0, -34, -7, 26, 9,
+  -46, 53, 25, -8, 18, -21, 11, 44, -3, 9, -30, 7, 45, -114, -22, -12,
+  0, 34, -49, -37, -41, 8, -56, -20, 36, -39, 24, -96, -10, 7, 33, 0,
+  -36, 47, -8, -37, -51, 44, -127, 64, 0, 38, -22, -25, -24, -9, -35, -18,
+  -22, 61, -34, -24, -6, 19, -20, 13, 12, -41, 44, 37, -28, 49, -39, -17,
+  83, -20, -48, -16, -86, 30, -30, 18, -67, -49, -101, -14, -27, -3, 30, 15,
+  -8, 44, -15, 14, 44, -36, 3, -7, 48, -3, 19, 12, 12, -47, -50, -18,
+  54, -12, 4, 23, 51, 0, 7, 5, 48, -9, 63, 42, 7, -20, 49, -21,
+  -26, -36, -19, -3, -22, -54, -60, -21, -64, -18, 3, 7, 6, 42, -8, 46,
+  13, -26, 4, 0, -24, -18, -12, -46, 0, -24, 0, -28, 23, 16, -18, -4,
+  -36, -16, 21, 36, -6, -3, -4, -9, -26, 34, 19, 27, 6, 7, 7, 18,
+  2, -6, -37, -4, -5, -9, -20, 23, 26, -25, 52, 28, 11, -21, 0, -9,
+  24, -10, -2, 22, -8, -17, -24, 0, -22, -29, -11, 3, -11, 5, 27, 2,
+  -19, 42, 0, -16, -30, -29, -23, 24, 11, -4, -27, -2, 11, -32, -13, 4,
+  -48, -11, 29, -7, -29, -19, -4, -17, 11, 2, 0, -18, 6, 26, 33, 20,
+  -10, 6, 13, -4, -16, 45, 27, 7, -10, -10, -44, -10, -11, -17, 0, -17,
+  0, -30, 12, 37, -14, 17, -21, 17, 2, -3, -29, -15, -6, 2, -7, -2,
+  -4, -44, -9, -4, -3, 0, -2, 15, 21, 0, -5, 2, -5, 7, 13, 8,
+  0, 27, 27, -16, -4, -3, 21, -24, -46, 21, -4, -21, 2, 0, 39, 2,
+  -29, 0, 8, -13, -27, -9, 10, -25, -14, -4, 5, -22, -23, -27, -25, -16,
+  -15, -32, 29, 49, 12, 6, -45, -2, 2, 24, -15, -39, -30, -23, -24, -6,
+  -8, 4, 6, 7, 21, 12, 34, 12, -4, 42, -29, -24, -7, -18, 9, -26,
+  -20, -25, 7, -2, -29, -7, -23, -20, -20, -15, 7, -27, -28, -48, -42, -4,
+  24, -17, 0, 2, 18, -2, -52, 39, 20, 54, -17, -4, -7, 52, -16, -5,
+  -27, 16, -14, -22, -19, -8, -8, 0, -37, -9, -23, 16, -33, 9, -12, 17,
+  -4, -35, 7, -20, -36, 5, 12, -127, -108, -16, -25, 71, 5, -11, -4, 26,
+  -8, -27, -3, -108, 27, 5, 0, 2, 26, 41, 35, -18, -31, 58, -39, -34,
+  -2, -8, -8, 25, -27, -7, 87, -31, -30, 16, 15, -27, 2, 39, 25, -17,
+  7, -6, -45, -57, -33, -2, -3, 36, -26, -14, -11, -37, -2, 68, -15, -38,
+  -38, -33, -15, 0, -48, 2, 29, -20, -30, -12, -25, 14, 0, 18, 33, -10,
+  15, -16, -22, 9, 32, -21, 25, -63, 11, -2, -7, -8, 18, 29, 86, -46,
+  -7, -5, 26, 32, 2, 2, 42, 13, 32, 33, -74, 13, 9, 35, 7, 26,
+  -12, 20, 23, 12, -8, 6, -13, -36, -4, -10, -32, 15, -56, 5, -31, -25,
+  4, 7, 24, -20, 33, 9, 0, 12, 8, 2, -2, 12, -25, -32, -18, -22,
+  20, -29, 0, -2, -2, -24, 8, 28, -4, -15, -37, 10, 5, -7, -7, 4,
+  -5, -17, 24, 6, 20, 10, -20, -11, -18, -6, 34, 0, 9, -23, 18, 0,
+  5, -12, 8, 6, 6, 0, 0, -5, 26, -3, 23, 8, -9, 23, -3, 15,
+  -17, -66, -34, -16, 3, -7, -57, -24, -19, -34, -25, 28, -34, -27, 5, 10,
+  -5, -13, -10, -27, -55, -17, 33, 24, -30, -9, -12, 16, 2, 58, -42, -20,
+  0, -16, -5, -27, -20, 35, 0, -15, 28, -31, -106, 19, -23, -60, 39, 40,
+  46, 10, -23, 12, -17, 15, 26, -21, -12, -19, 25, -24, 22, 5, 29, 6,
+  -31, -24, -34, 0, -63, -7, -2, 5, -40, 0, -4, -59, -39, 0, 0, -4,
+  20, -7, -24, -38, -2, 0, -8, 13, 7, 2, 0, -25, 31, -19, 31, -40,
+  5, -22, -31, 10, 77, -24, -2, -11, 22, -17, -2, -1, 0, 0, 16, -9,
+  -7, -28, -16, 2, -21, 6, 29, -26, -24, -3, -32, -8, -28, -37, -9, 25,
+  52, 0, -15, -55, -49, 40, 26, 51, -45, -13, 35, -8, -6, 11, -56, -33,
+  -25, -40, 44, 40, -61, 0, 0, -18, -12, -83, 11, -56, 16, -23, -35, -10,
+  66, 18, -80, 6, -44, -8, -28, 13, 93, -6, 44, -29, -33, 34, -59, 25,
+  -55, -42, -36, -44, 33, 31, 17, -8, 26, -28, -14, -39, 33, -26, 14, 52,
+  -18, -11, -3, 20, 5, -37, -46, -12, -17, 7, -21, -27, -3, -63, 9, 52,
+  -12, -22, 0, -62, -48, -32, -27, 11, -3, 3, -6, -30, 34, 4, 21, -48,
+  0, -3, -114, -6, -18, 42, 24, -24, 35, -22, -4, 0, -33, -40, -22, 31,
+  -12, -49, 0, 3, -63, -17, -17, 14, -3, -25, -24, 18, -18, -42, -11, -9,
+  18, 74, 12, -12, -102, -9, -20, 20, -89, -20, 35, -8, 11, 33, -38, -3,
+  45, -47, 0, -36, -10, -4, 7, 21, -9, -14, 20, -23, 5, -12, 21, -29,
+  -8, -18, -51, 43, -7, -17, 36, 21, -6, 3, 44, -45, -84, -19, -22, -31,
+  -24, -29, 23, -10, 47, -3, 51, -8, -10, 22, 10, 5, -45, 15, -22, 24,
+  -40, 18, 6, -9, -54, -29, 37, 99, 27, -29, 29, 8, -9, -70, -29, 10,
+  -74, 4, 17, 40, -54, -71, 23, 7, 12, 28, 9, -106, 8, -8, -11, -13,
+  12, 35, 8, 9, 4, -14, 12, 19, -35, 6, 20, -33, -15, -22, -19, 65,
+  -8, -29, 3, -22, 37, -10, -17, 11, 39, -6, -24, -5, -51, -4, -22, 3,
+  37, -4, 57, -23, -24, 63, -6, -20, -69, -104, -3, -46, -6, -37, 38, -42,
+  -62, 22, 17, -62, 75, -6, 87, 0, -3, 7, -57, -89, -8, -8, 28, -122,
+  23, -5, -25, -6, -7, 34, 12, 32, 16, -16, -107, -14, -124, 37, 104, 6,
+  -20, 20, 20, -101, -13, 0, -34, 25, 10, 25, -88, -47, 21, 15, -14, -15,
+  -49, -53, -30, -3, -73, 43, 52, -20, 14, 39, 15, -38, -40, 37, 79, -62,
+  -41, -7, -19, 54, 20, -35, 43, 67, -27, 3, 20, -23, -10, -8, -14, -3,
+  -27, 30, -55, 49, 22, -6, -100, 19, 45, -31, 32, -45, -99, 12, -15, 0,
+  47, -16, 7, -73, 10, -14, 9, -72, -62, -28, -17, 26, -21, -34, -14, 49,
+  0, 46, -18, 6, -73, 3, 6, -36, -17, 0, 53, 15, -11, -22, 9, -33,
+  -21, -25, 19, 11, -10, -32, 27, -4, -96, 66, -60, -3, -26, -19, 53, -58,
+  8, 0, 30, -22, -33, 8, 28, -58, -35, -6, 48, -36, -66, 19, 30, -40,
+  0, -49, -7, -19, 13, -37, -72, -8, -10, 0, 14, 18, -30, -64, -25, 15,
+  6, 11, -85, -12, -93, -20, -75, 39, -65, -23, -15, -34, -29, 26, -29, -10,
+  -8, -83, 6, 58, -37, -24, 67, -39, -33, -38, -31, 36, 0, -62, 18, 19,
+  39, 30, -38, 25, 33, 50, 36, 5, 16, -44, 40, 12, -55, -6, 30, 51,
+  63, -94, 43, -10, -127, -78, -72, -17, -26, -11, -54, -5, 18, 30, 33, -6,
+  18, 32, -57, 32, -5, -49, 17, 8, 0, 62, 29, -23, -48, 74, 3, -26,
+  -45, 47, 14, 7, -10, -9, 53, -25, -6, 10, 20, -3, 18, -93, 4, -112,
+  43, 5, 13, 71, 48, -28, -56, -64, 48, 47, -32, 5, 22, -6, -67, 25,
+  -16, -52, 36, 44, 7, -41, 47, 17, -39, 17, 3, 18, -48, -11, 25, -24,
+  0, 14, 44, 14, -51, 14, -35, -16, 20, 13, 14, -12, -5, -27, -33, -13,
+  37, 23, 16, -27, 41, -4, -35, -37, 49, -25, -28, 19, -13, 63, -6, 5,
+  -22, 4, -76, 3, -39, 36, 7, -4, -10, 20, 32, -2, -9, 0, -30, 11,
+  -67, 16, 46, 41, 16, 28, -14, 5, -11, 32, -17, -21, -12, 28, 9, -27,
+  23, -55, 27, 21, -40, -2, 0, 13, 11, 3, -7, 47, 16, 3, 10, -32,
+  -17, 3, 27, -9, 28, -37, -33, -49, -46, 17, 9, 11, -2, 44, -29, 18,
+  25, -29, 10, -5, -21, 9, -3, -17, -3, -38, -61, 0, 15, 10, 0, 18,
+  -32, 24, 11, 15, 14, 3, -7, -20, -29, -2, -25, 9, 5, 6, -16, -5,
+  10, 0, 0, -9, 4, 7, -14, -26, 6, 11, -7, 59, -23, 42, 0, -64,
+  0, -73, -7, 3, 6, -26, -14, -66, -2, 17, -23, -16, 0, -66, 12, -18,
+  16, 2, 3, -10, 6, 36, -3, 11, -31, 5, 32, -47, -51, -23, 45, -14,
+  19, 19, -38, 49, -19, 19, 0, -18, -13, 20, -28, 2, -34, 25, 20, 32,
+  5, -26, 7, -2, -36, -61, -16, 16, 11, -19, -10, 22, 26, -12, 10, 0,
+  50, -50, 2, -47, 19, 32, -8, 0, 24, -11, -39, 0, 26, -22, 3, -21,
+  22, -12, -38, 3, -12, -7, 49, 26, 0, -41, 6, -14, -18, 81, 6, 14,
+  -22, 5, -22, 15, 30, 8, -38, -29, 13, 41, -39, 6, 34, 77, 0, -12,
+  -100, 23, -25, 57, 20, 28, 33, 83, 67, -19, 57, -50, 23, -18, 43, 11,
+  40, 82, -41, 44, -119, -37, -22, 51, -41, 53, -30, -16, -73, -70, 78, 36,
+  -25, 45, -38, 5, -57, -36, -62, 17, 10, -3, 19, 14, 36, -86, -127, 14,
+  -45, 29, -19, -54, 11, 33, 52, -5, -64, -9, -47, 32, -59, -86, 2, 35,
+  -20, -9, -47, 26, -40, 33, -2, -29, -47, -40, 41, 56, 14, -18, 2, 19,
+  -20, 23, -20, -6, -61, -25, -79, 23, -24, -53, 35, -30, 4, -38, -20, 0,
+  -41, 47, 31, -38, -12, -2, -3, -13, -3, -23, 16, 14, 15, 5, -15, -14,
+  16, -50, -54, 8, -3, 6, -42, 18, 3, 7, 0, -17, -24, -34, -16, 2,
+  15, -23, 17, 2, 36, -12, -5, 6, 45, -8, -17, -6, 12, -27, 22, 11,
+  -64, -38, -43, -18, -28, 9, -24, -54, 27, -34, 37, 70, -23, 0, -61, -34,
+  -32, -22, 48, 28, -15, 0, -23, -6, -36, -10, -55, 37, 6, 0, 6, -21,
+  -10, -50, 5, 0, -41, -28, -17, 38, -11, 20, -33, -21, 15, 6, 36, -20,
+  -33, -61, 12, -12, 16, -5, 5, 35, -3, 34, 14, -25, -9, 42, 5, -34,
+  57, 3, 14, 56, -58, -21, 63, -31, -2, 39, 21, -3, -21, -22, 20, 49,
+  32, -31, -14, 25, 51, -57, 104, -6, -55, -20, 19, 12, -24, 41, -57, -21,
+  16, -56, 5, -10, 30, -64, -59, -18, 35, 38, 28, -13, -10, 9, 7, 2,
+  3, -49, -42, -47, -28, -38, -7, -10, 25, 21, 5, 37, 14, -15, -10, 29,
+  44, -32, 38, -3, -22, 16, -49, 29, -12, -42, 35, 89, -9, 44, -26, 13,
+  -3, 2, 21, -35, -71, 2, 3, -11, 47, -41, 36, 6, 60, -33, 15, -28,
+  -16, 8, -30, -23, -8, 44, 69, 38, -24, 5, -25, -9, 10, -71, 32, -45,
+  19, -11, -2, -7, -51, -7, -10, 8, 10, 2, 4, 35, -9, -24, -27, -15,
+  -21, -25, 8, 13, 12, 2, 30, -21, 0, -23, -4, -18, 11, 20, 30, -29,
+  -21, -6, -15, -20, -15, -21, 12, -7, 6, 33, -4, -37, -37, 9, 9, 10,
+  6, -20, 7, 18, 7, 12, -15, -19, -3, 6, -9, 7, -20, 8, 11, 6,
+  -3, -5, 8, -7, -29, 3, 0, 6, -24, 10, -6, 13, 9, -20, 4, -57,
+  17, 5, 4, 7, 22, -28, 17, 2, -12, 16, -26, -18, -1, 14, -5, -6,
+  12, 1, 6, -6, -4, 10, 12, -24, 0, -14, -6, 17, 4, 2, -9, -16,
+  8, -7, 13, 10, 5, -2, 30, -10, 28, 1, -39, -22, -21, -15, -4, -15,
+  -20, -12, 3, 1, -73, 12, 22, -2, 17, 11, -35, -2, 0, -6, 3, -29,
+  10, -13, 7, 0, 14, -14, -13, 5, -29, -10, -6, -20, -5, 0, 20, -39,
+  6, -14, -15, 0, 7, -1, 6, 21, 3, 11, -28, -5, 6, 6, 4, 20,
+  -32, -13, 23, 5, 13, -2, -30, -8, 18, 8, -2, 13, 8, -27, -11, 17,
+  0, 2, -15, 3, -20, 26, -3, 20, -12, 29, -1, 0, -11, 26, -4, -3,
+  -8, 20, 8, -47, 12, 3, 27, -32, -3, -19, 1, -12, 8, -10, -5, -22,
+  23, 3, 17, 8, -13, 8, 22, -8, 8, 6, 12, -10, -29, 0, -24, -1,
+  -8, -3, 17, 10, 24, -34, -4, -13, -17, 3, -7, 21, -11, 25, -6, -11,
+  -84, -45, -17, -15, 44, -32, 10, 71, 53, 25, 37, -13, -46, -37, -6, -31,
+  43, 7, -15, 11, -85, 11, 12, 12, -17, 7, 24, -30, -22, -39, 55, 8,
+  -27, 4, 38, 31, 4, -53, -22, -31, 29, -3, 0, -14, 37, -47, -127, 11,
+  14, -59, -18, -5, -5, 41, 30, -8, 10, 11, -24, -28, -44, -46, -32, -20,
+  15, -12, -8, -25, -37, 32, -7, 14, -33, -11, -25, -2, 0, 22, -13, -3,
+  25, 16, 13, 24, 17, -4, -10, 19, 12, 47, -23, 12, -7, 45, 21, -24,
+  -4, -18, 26, -14, -17, 3, -18, -7, -16, -3, -20, 6, -22, 11, 24, -28,
+  10, 16, 7, 21, 27, 7, -2, -4, 3, -11, 26, -9, 15, 0, 3, -25,
+  17, -2, 15, -6, 20, -14, 19, 34, 2, -7, -1, -2, -10, -19, -15, 8,
+  -17, 0, -17, 27, 5, -4, 15, -21, -21, -7, -14, 15, 4, -2, 27, 6,
+  20, -1, -4, -26, 39, -10, -22, 4, 13, 3, -6, -8, -9, 6, 7, 28,
+  4, 8, -15, 13, -3, -26, -9, -38, -15, -32, 9, -14, 12, -2, -11, -3,
+  -28, 14, -3, -37, 24, -41, 0, 14, -21, 0, 9, 29, -16, 4, 4, -34,
+  33, -49, 7, -31, -9, 5, 24, -21, -9, 5, -10, -5, -20, -45, 4, -19,
+  94, -3, 32, -19, 40, -8, 10, 1, -24, -24, 2, -23, 6, -38, -24, -27,
+  49, 3, 28, 5, 2, -26, -17, -7, 5, -6, -22, -1, -17, -17, -13, -41,
+  -5, -39, -18, -3, 7, -3, 14, -18, 7, 31, 6, -6, -10, 7, -9, -10,
+  27, -2, -14, 0, 9, -22, 12, 32, -21, 28, -4, -3, 11, -8, -32, -22,
+  6, -13, 11, -23, -24, 4, 4, -9, -5, -11, -18, -4, 7, -19, 30, -14,
+  35, 13, 23, 43, -17, 17, 45, 7, 0, 8, -34, -13, 6, -17, -7, -31,
+  -22, 8, -16, 7, 17, -17, 10, -7, 18, -13, -14, -11, -3, -41, -5, -4,
+  -12, -15, 8, -59, 8, 0, -6, 41, 4, 14, 7, -41, 0, -7, -8, 9,
+  -5, -9, 0, 7, -30, -7, -26, 8, -21, 6, -16, -4, 4, -20, -37, 0,
+  14, 17, -8, 0, -31, -4, -50, -23, -6, -10, 14, -31, -33, 29, -13, -9,
+  -11, 25, 16, 0, 9, 7, -3, -30, -34, -2, 12, 27, -5, 6, 17, -13,
+  2, -6, 23, -13, -30, -20, -6, 37, -7, -16, 15, 2, 0, -11, -41, 9,
+  -55, -38, -17, 34, -24, 0, -9, -11, -26, 18, -26, -20, -9, 18, -2, -3,
+  -2, 10, -19, 20, 2, 48, 5, 5, -17, 0, -38, 9, -23, 22, 3, 13,
+  -2, -25, -18, -20, -23, -13, -10, 9, -16, -30, 21, 11, -57, -6, 17, 8,
+  10, -8, 11, -40, -24, 6, 6, 25, -16, -2, 20, 19, 14, -27, -12, -11,
+  -27, 0, 0, 22, 21, 3, -42, -28, -21, -28, -23, 3, 2, -36, -26, -8,
+  16, -36, -19, 26, -2, 6, 10, -8, 0, 10, 2, -20, -23, -22, 6, -29,
+  11, 17, -27, -7, -17, 19, 12, -7, -4, 6, -22, -4, 20, -17, 0, -65,
+  -2, 29, -39, -4, 6, -6, -20, 8, -16, -6, 13, -21, 3, -41, -39, 4,
+  -11, -23, 17, 23, 24, 16, -45, 12, 11, -6, 0, -20, -9, 47, 11, -35,
+  14, 2, -14, -2, -18, 16, -37, -5, -50, -21, -38, 8, -32, 38, 3, 0,
+  -2, -33, -41, -24, 28, -17, 7, -127, -84, -27, -55, 114, 17, -9, 14, -13,
+  36, 13, -2, -62, -22, -18, -35, -27, 18, 18, 3, -39, -21, 36, -73, -9,
+  9, 32, -5, -32, -21, 7, 66, -60, -34, -26, -5, -11, -9, 36, -2, -18,
+  30, -23, -56, -37, -29, -6, 47, 36, 13, 10, 16, -11, 28, 53, 10, -29,
+  -2, -23, -9, -9, -17, 25, 5, -7, -2, -13, -22, 18, 8, -17, -12, -32,
+  36, -27, -34, 2, -30, -56, -18, -45, -33, 12, 2, 12, 3, 55, 56, -4,
+  46, -28, -10, 40, -6, 11, -19, 5, 43, -17, -86, -6, -6, -20, 17, 7,
+  -14, 34, 6, -37, 8, 10, 0, -10, 0, 8, 22, 3, -14, -13, -18, 4,
+  -22, 8, -2, -31, -14, -10, -8, -18, -24, 27, 9, 0, -32, -15, -26, -25,
+  41, 8, -6, -34, 4, -25, -18, 10, 25, -14, 15, -25, -5, -20, -6, 11,
+  -9, -9, 10, -7, -2, -5, 9, -5, -13, -6, -7, -15, 47, -25, -39, 0,
+  -9, 21, -2, 2, -16, -4, 15, -16, 17, -24, 0, -18, -14, 15, -8, -21,
+  4, -50, 7, -44, 9, -8, -54, -7, -6, -30, -15, -2, -57, 6, 64, -23,
+  5, -13, -2, -40, -28, -13, -2, 10, -40, 16, 30, 17, -35, 55, -2, -4,
+  -46, -26, 0, -25, -21, 33, 0, -23, 9, 7, -93, -11, -30, 7, 33, 3,
+  37, 30, -31, -15, 4, 22, 30, -8, 10, 23, 22, -11, 11, -4, 19, 9,
+  -34, -37, -30, -19, -17, 13, -10, 9, 2, 4, -24, -56, -30, 0, 2, -8,
+  2, 36, -18, 17, -12, 3, 4, 27, -32, 44, -25, -17, 8, -14, -2, -22,
+  -9, -34, -15, 43, 17, 25, 12, -20, 6, -6, -23, -24, -11, -15, 33, -7,
+  -2, 4, 23, 19, -66, 2, 42, -34, -13, -15, -2, -35, -72, -26, 28, 13,
+  34, -53, 6, 23, -20, 38, -20, -16, -41, -23, 9, 27, -11, -22, 30, 16,
+  -4, -40, -53, -4, -17, -7, 17, -14, -45, 76, 3, -57, 45, 82, 43, 32,
+  -86, -8, -60, -37, 48, -51, 32, 3, -42, -25, -4, -7, -11, 13, -11, -28,
+  -12, -75, -20, 13, -3, -17, 4, 14, -26, 0, 17, 16, 6, 0, 14, -15,
+  -19, 28, -21, -3, 24, 3, -26, -32, 0, -65, 21, 65, 6, -30, 62, -65,
+  17, -18, 14, -113, -24, -24, -54, -74, -12, 14, -23, -53, 11, 20, 11, -10,
+  -23, -10, -47, -43, -59, -25, -24, 35, 6, 16, -28, 2, -55, 9, 22, -31,
+  -59, 13, 13, 3, -37, -34, -34, 17, -53, 28, -58, -3, -6, 95, -39, 6,
+  0, -53, -6, -41, 54, 9, -35, -4, 45, -23, 6, 0, -75, -59, -38, 20,
+  -50, 25, 17, -26, -3, -9, 34, 0, -42, 10, -17, -30, 29, -86, -32, 10,
+  -20, -10, -77, -9, 7, -8, -28, -24, -3, -28, -36, -29, -66, -47, -19, 6,
+  -51, 85, -33, 13, 0, -38, 56, -17, -7, 50, -24, 5, -60, 27, -28, -46,
+  15, -14, -43, 32, -10, 14, 0, -4, 41, 33, 30, -77, 9, -11, -50, -3,
+  33, 43, 44, -29, 17, -22, 10, 49, 12, -63, 14, 17, 32, -43, 14, -10,
+  -94, 3, -47, 15, 66, 42, -52, -37, 74, -50, 48, -5, -15, -34, 0, 28,
+  -43, -82, -13, 32, -77, 17, 9, 31, 89, 67, -17, -3, -42, 38, 14, 18,
+  -31, 11, 82, 18, 59, 52, 26, -24, -34, -62, 0, 8, 66, 41, -41, -88,
+  -37, 83, 22, 58, -44, -59, 3, -7, 21, 59, -23, -20, -37, -16, 57, 71,
+  -4, -23, 34, -22, -33, -14, 101, -101, -29, -3, 8, -17, 51, 9, 127, 0,
+  16, -10, 53, -118, -114, 21, 81, -67, 7, 44, -10, -87, 51, -30, -14, -15,
+  -19, -57, -91, -3, -39, -38, 17, -12, 10, 39, -65, -27, -54, -33, 21, -43,
+  21, -69, 31, 0, 38, -28, 3, -64, -3, -17, 6, 33, 21, -8, -4, -26,
+  -43, -25, 55, 22, 18, 20, 32, 27, 16, 19, 8, 0, -15, -34, 0, 37,
+  8, -43, 37, 70, -17, -3, 90, -14, 26, 39, -58, 11, -39, -34, 31, -28,
+  3, -11, 49, -3, -24, 23, -20, -67, 7, -3, -24, 15, -9, -44, -21, -7,
+  37, 58, -3, -26, 10, 0, 7, 14, 36, 35, 32, -23, 16, 31, 18, 77,
+  12, 18, -13, -50, -11, -17, 40, 8, 22, 19, 12, -5, 26, -19, -41, -9,
+  59, -16, -30, 54, -7, -24, 43, 33, -17, 36, -38, -13, -9, -30, 6, 12,
+  -115, -57, -27, -26, -73, -38, 17, 60, -7, -39, -24, 4, 14, -78, 27, -20,
+  -17, -18, 25, 11, -3, 17, -27, 0, 18, 0, 29, 7, -42, 66, -25, 0,
+  -27, 10, 89, 6, -7, 25, 109, 0, 39, -16, 8, -26, 40, 9, 41, 9,
+  -51, 0, -63, -10, -34, 27, -26, -31, -10, -44, -65, 0, -33, 8, 39, -37,
+  -6, -14, 12, 50, -44, 17, 17, 36, -65, -26, 6, -23, 29, -33, 24, -20,
+  -46, 29, 36, -15, 34, -9, -60, -18, 36, 66, 23, -33, -3, 12, 96, -51,
+  -70, -5, 60, 22, 18, -3, -28, -27, -3, -38, 8, -29, -26, 13, 19, -14,
+  -47, -20, -40, 10, 10, -44, 26, 25, 23, 0, -21, -24, -42, -11, -22, 89,
+  -10, 27, 9, -2, -30, 22, -11, -9, 8, -28, -11, -12, -4, -11, 18, 0,
+  3, 8, 11, 3, -3, -13, -41, 38, 7, 27, -24, -8, 2, -21, -3, 7,
+  27, -2, 0, 7, 17, -13, 3, -8, 5, -46, -18, 20, -14, -41, 14, -26,
+  18, 23, -10, -54, -39, 16, 23, 6, 0, 15, -18, -16, 7, 3, -6, 14,
+  -19, 25, -16, 18, 26, 4, 9, 15, 8, 8, 16, 6, 18, -14, -7, -38,
+  13, 50, -45, 6, -34, -43, 26, 54, -5, 21, 15, -46, 28, 18, -8, 7,
+  9, -17, -7, 10, -20, 19, -49, -2, 2, 22, 12, -17, -11, 14, 6, -7,
+  24, 30, -23, -12, 5, 24, 86, -19, -8, -13, -47, 12, -2, 20, 15, 28,
+  -12, 14, 19, 16, -34, -4, 27, 12, 24, 3, 18, 12, 26, -80, 45, -13,
+  54, -19, -4, -25, 31, 10, 8, -8, -7, 19, 24, -26, 14, -24, 11, 10,
+  0, -14, -3, -7, -45, 24, -15, -20, 0, -7, 31, -18, -23, -17, -3, 28,
+  3, 8, 31, 10, 10, 24, 39, -6, 10, -32, -50, 6, -14, -6, -30, 21,
+  7, -55, -2, 4, 19, 13, -9, 15, 45, -3, -5, -18, 4, -34, 27, -35,
+  13, 44, -6, 0, -8, -37, 21, 5, 5, 43, 24, -13, -22, 21, -63, 17,
+  51, -25, 23, 12, 25, -17, 31, -18, -10, -39, -21, 7, -28, 14, -126, -61,
+  12, 25, 13, -83, -8, -10, -10, 23, -28, -30, -8, -32, -16, -6, -6, 16,
+  24, -79, -89, -36, 11, 4, -42, -88, -58, -15, -11, -27, -35, -31, 34, -5,
+  60, -19, 21, 0, -21, 13, 85, -52, -58, 35, 7, -36, 30, -9, -52, 42,
+  -6, -6, 20, -45, 14, -30, 9, -49, 89, -70, -28, -7, -127, 2, 17, 26,
+  36, -28, 15, 78, -57, 21, -20, -34, -46, 43, -81, -51, 12, 47, -15, 85,
+  -64, -14, 28, -67, -23, 4, 20, 40, 26, -33, -11, -18, 37, -54, -9, -10,
+  54, -44, 15, -8, -8, -27, -10, 0, 12, 32, 13, -8, -32, 12, 0, -10,
+  63, -4, 7, 2, 0, -2, -6, 2, -2, 15, -9, -33, 28, -31, 14, -15,
+  21, -25, 36, 0, 15, 3, 33, 2, 28, -9, -42, 12, 23, -44, -6, -64,
+  36, -16, -21, -22, -15, 13, -18, -12, 5, -33, 20, 12, -26, 11, 25, 43,
+  16, -22, 19, 25, 8, 10, -49, -16, -42, -13, -26, 56, -18, -27, 46, 30,
+  12, 48, 0, -17, -45, -43, -19, -31, 12, -7, -9, 6, 0, 22, -32, 50,
+  -9, 0, -23, 76, 0, 34, 13, -26, -35, -6, -13, 8, 18, -20, 2, 24,
+  -31, 30, 19, 13, -53, -24, 16, 46, 40, -8, 7, 6, 46, -23, -25, -23,
+  0, 64, -68, -56, 0, -37, -39, 0, 9, 3, 20, 5, -4, -18, 14, 22,
+  -9, 21, -85, 36, 6, -50, -15, 16, 7, 22, 34, -28, -8, -38, -89, -24,
+  12, -3, -33, -15, -59, 10, 26, 28, -46, 9, -18, 22, -49, -61, -21, 40,
+  21, 8, -19, 16, -4, -11, -38, -64, -19, -10, 5, 9, -15, -3, 23, 38,
+  -3, 0, 21, 8, -26, -28, -36, 5, -53, -3, 44, -31, 28, 12, 11, 32,
+  21, 17, -3, 10, -62, 52, 22, 22, -15, 10, 37, -13, -37, -38, 6, -13,
+  -15, 20, 5, 12, 52, -13, -16, 17, -28, 6, -16, -30, 49, -17, -32, -19,
+  -9, 0, 3, -19, 90, 5, 43, 4, 44, -21, -71, 0, -8, 0, -11, -48,
+  31, -3, 13, -61, -35, -34, -108, 46, -25, 29, 55, -43, 56, 0, 46, 9,
+  -7, 5, -8, 0, -10, 18, -33, 56, 50, -26, 44, 16, 14, -35, 21, -16,
+  25, -27, 9, -41, 15, 25, 43, -44, 0, 26, -6, 7, 36, -17, -5, 3,
+  -11, 16, -59, -35, -63, -16, -27, -58, -29, -12, -87, 21, -37, -58, 0, 48,
+  61, -43, 44, 0, 47, -16, -43, -55, -8, -32, 11, -3, 24, -11, -36, -12,
+  -22, -5, -51, 3, 64, -16, -11, -69, 18, -23, -11, 2, 81, -20, 45, 34,
+  127, -36, 15, 23, -15, -44, -20, -33, 6, 15, -47, -34, 14, -28, 20, -8,
+  -69, 69, -42, 0, -86, -11, 19, 11, 3, -36, -68, 18, -13, -72, 30, 39,
+  84, -10, 5, 47, -19, -34, -25, 29, 3, 6, -11, -3, -49, 126, -39, -6,
+  -7, -16, -94, 6, 0, -28, 4, -10, -33, -64, -37, -22, -20, -46, -62, 5,
+  -7, 27, 6, 6, -22, 47, 20, 18, -12, -18, 22, -24, 3, -66, 49, -40,
+  -14, -46, -42, -3, -59, 27, 16, 22, -67, 6, -38, 28, 18, 24, -8, -39,
+  -34, 17, -31, 13, -25, 10, -22, -26, 39, 54, 21, -43, 22, 40, 7, 59,
+  25, 12, 55, -29, -61, 3, 4, -20, 24, -41, -66, -13, 10, 32, -31, 29,
+  -25, 15, 21, -44, 19, 13, 59, -87, -58, -13, -16, -5, -17, 3, 74, -37,
+  -34, -43, -59, 3, -32, 0, 8, 48, 3, 99, -35, -4, -24, 27, -52, -12,
+  -8, 7, -59, 17, -57, 16, -46, 13, -103, -16, 66, 28, -5, 36, -43, -33,
+  18, -44, -4, -63, -3, -5, -7, -22, 83, 23, -59, 29, -20, 32, 31, -31,
+  4, -15, -6, 35, -87, -44, -63, -10, -52, 8, -16, 29, -25, -94, 51, 28,
+  29, -82, 0, -30, -18, -45, 16, 0, 10, -24, -35, -28, -18, -31, 38, -9,
+  -27, -17, -15, 7, 3, 36, -28, -107, -72, -48, 58, 15, 51, 40, -53, 9,
+  -11, 9, 16, 0, -3, 26, -11, 34, 47, -61, 37, -4, -105, 14, -41, 29,
+  -15, -33, 12, 62, -3, -25, -32, 38, -64, -5, -82, 5, -31, -42, 31, 37,
+  29, -108, -34, 30, -9, 3, 51, 0, -51, -12, -11, -25, 26, 55, 19, -33,
+  -11, 37, 26, 20, -22, -42, -6, -23, 14, 0, 37, -9, 24, 43, 33, 15,
+  11, -26, 98, 9, -44, -49, -41, -2, 0, -6, -26, 20, -17, -9, 17, -34,
+  -54, -36, 43, -29, -31, 22, -36, -51, -46, -5, 35, -56, -17, 0, -5, 20,
+  -57, 0, -50, -27, 9, -24, 19, -15, -73, -18, 8, 7, 40, 41, 8, 90,
+  23, 27, -28, -40, -19, -8, 6, -23, 19, -22, -18, -28, -56, 97, -26, -41,
+  -122, 46, 43, -31, -30, 23, 37, 5, -124, -6, 18, -11, -7, 0, -93, 3,
+  36, 24, 34, 9, -19, 25, -12, -5, 3, -26, 13, -27, -22, 59, -36, -42,
+  51, -20, -6, 5, -5, -40, -56, -26, -29, -45, -35, 92, -11, -20, 19, -21,
+  11, 10, -33, 27, -28, -60, -15, -16, -22, -29, -11, 43, 5, -32, 16, -39,
+  50, 14, -24, -69, -81, 10, 7, 49, 62, 15, -11, -7, -51, 14, -28, 16,
+  47, -33, 0, 0, -9, 13, 32, 13, -55, -5, -44, 10, -28, -3, -10, -25,
+  8, -34, -14, -4, -56, 4, -29, -14, -3, 11, -12, 8, -3, 20, -4, 5,
+  -37, 22, 10, 7, 17, 4, -10, 0, -6, -7, 32, 7, 3, 10, -7, -22,
+  12, 20, -43, -15, 15, 4, -18, 0, 10, 6, 6, 1, 22, -6, -13, 14,
+  -10, 8, -18, 13, -12, 14, -6, 21, -8, 21, 5, 11, 12, -6, 7, -2,
+  53, -5, -23, -22, -51, -6, -17, -28, -5, -28, -18, -19, -1, 26, 3, -5,
+  2, -9, -14, -18, 5, -12, 2, 4, -3, 33, 7, 3, -3, 29, 9, -14,
+  -14, -4, -19, 5, 18, -22, -6, 4, -3, 0, -6, -4, -13, 23, -9, -14,
+  -28, 2, -10, -22, -20, 2, -13, -22, 7, 21, -5, -14, 23, 0, 19, -20,
+  -23, -16, -2, -29, 10, -6, -10, 16, 12, -7, -4, -15, -4, 2, 13, -25,
+  -21, -25, -13, -11, -14, 10, -22, -7, -14, -19, 24, 5, -20, -45, -4, 11,
+  -39, 9, 9, 14, 4, 7, 4, 16, 2, 2, -10, -17, 35, 3, 28, 21,
+  -37, -5, -45, 8, -15, 7, -51, -26, -33, 7, -41, 9, 2, -21, -7, -14,
+  6, -16, -5, -37, 12, 0, 3, -26, -2, -8, -12, 23, 7, 28, -1, -21,
+  4, -5, -31, -11, 5, -20, -2, 9, 30, -17, 0, -15, 8, -2, -9, -26,
+  -21, 15, -34, -6, 9, -41, 8, 0, 27, -8, -24, 2, -33, 3, -9, -16,
+  14, -3, 5, -19, -8, -24, 2, 3, -21, 11, -9, -5, -14, 27, 28, -29,
+  -42, -11, -44, 15, -49, -17, 25, 28, 67, 15, 12, 0, -23, 20, 16, 15,
+  -25, 29, 10, -9, -21, 14, -3, -32, -27, -28, 32, -35, 5, -8, 16, -3,
+  -68, 49, 36, 20, -35, 3, -4, -32, 8, -5, -10, 10, 51, -39, -127, 26,
+  -10, 5, 17, 29, -24, 51, 86, 13, -54, 24, 0, 37, -35, 13, 0, -35,
+  -15, -5, -17, 10, -10, -33, -1, 8, -2, 5, 9, 13, 17, -15, 0, 8,
+  -10, 13, 11, 4, -21, 1, -15, 37, 0, 9, -7, -12, -25, 25, -2, -8,
+  -43, 10, -57, -5, 7, 20, -10, 9, -13, 6, -36, -18, -18, 8, -13, 3,
+  -4, 13, -5, 6, 13, 34, -9, -14, 12, -8, 2, 13, -9, -30, 1, 21,
+  19, -27, -3, -7, 20, -1, 28, 14, 12, -21, -21, -4, -17, -28, -9, 15,
+  -19, -29, -24, 24, 22, -10, -8, -14, -6, 5, 20, 3, 12, -6, -18, 31,
+  23, -21, 4, 3, 13, 3, 22, -39, -6, 3, 22, 14, -17, 2, -15, 17,
+  4, -10, -7, -14, -5, 5, 15, -25, -26, 15, -15, -14, -20, -27, 7, -12,
+  -17, 18, 29, 1, 39, 0, 7, -8, -26, 0, -3, -2, 3, 26, 9, -20,
+  -17, 29, 18, 22, 32, 7, 34, 41, 26, 28, -16, -17, -20, -18, 23, -19,
+  21, -11, -9, -5, 31, -7, 0, 13, 2, 36, 14, -2, -17, -33, 2, -9,
+  -18, 5, -43, 14, -3, -3, -34, 13, -12, -13, -9, 16, -17, -38, -8, -15,
+  3, 4, 11, 1, 29, -32, 1, -16, 19, -13, 7, -17, -19, 28, 31, -7,
+  -19, 43, -4, -22, -7, 14, -13, -18, 5, -17, 17, -25, -9, 0, -11, -10,
+  -12, -19, 13, 29, -20, -6, -14, -5, 24, -21, 6, 11, -28, -19, 15, 1,
+  -24, 8, 13, 2, 3, -5, 9, 7, -3, -8, 5, -3, 2, 21, -6, 3,
+  5, -26, 11, 32, -28, -36, 32, 61, 45, 0, -49, -11, -19, -70, -4, -5,
+  -12, -8, -22, 11, 7, 3, 34, -18, -22, -48, -10, 12, 17, -20, 34, 9,
+  23, 7, -53, -2, 0, 6, 26, -10, -16, 60, 6, 2, -21, -2, -35, 33,
+  -40, 10, 5, 7, -15, 12, -19, 8, -26, 4, 12, 23, 0, -11, 18, -4,
+  16, -29, 9, -15, -57, 19, -48, 9, -68, -36, -2, 3, -21, 46, -4, -38,
+  33, 82, 30, -8, -5, -13, 15, -8, -44, 0, 6, 29, -35, -20, 3, -16,
+  26, -11, 3, 32, -5, -6, 62, -6, -14, 5, 17, -19, 29, 20, -16, 25,
+  -54, -14, -12, -16, 54, -55, -19, -12, -62, -12, 45, -6, -11, 11, -24, -9,
+  -11, 21, 22, -2, -68, 30, -2, -9, -30, -31, -6, 45, -17, -51, -56, 14,
+  39, -21, -4, 24, -27, -22, 20, -39, -37, -18, -35, -5, -31, 105, -5, -14,
+  0, -11, 25, -38, 35, -22, 21, -8, 2, 23, -15, 2, -37, 34, 3, 17,
+  17, -60, -5, 23, -42, -15, 50, 28, 17, -8, 17, 21, 61, 36, 59, -49,
+  27, 21, -13, 4, -7, -11, -8, -12, 25, -5, -49, 36, -42, -11, -13, 45,
+  36, -21, 2, 61, -22, 25, -24, -18, -9, -10, 25, -7, 6, -9, 8, 5,
+  -11, -16, -31, 14, 21, -12, -3, 39, -26, 34, 3, -45, -43, -2, 8, -31,
+  26, 19, 12, 7, -7, -22, 9, 0, -12, 18, 0, -6, 0, -8, 4, 0,
+  9, 91, -40, 11, 21, -55, -55, 20, -15, -38, 4, -28, -31, 13, -9, 33,
+  -84, -53, -14, 32, -47, -14, -37, -31, -2, -33, -23, 17, 23, -23, -41, -33,
+  -28, 27, -28, -29, -27, -10, -56, 17, -21, -113, 70, -16, -32, -46, -92, 25,
+  37, -38, 19, 46, -29, 32, 12, 16, 0, -47, -47, 8, -46, -8, 0, 7,
+  36, 3, 33, 9, -32, 30, -11, 3, 5, 40, -11, -11, -4, 0, -19, 17,
+  -6, 40, -16, -21, -10, -36, -7, 64, -28, 20, 2, -51, -25, -37, 16, 61,
+  -3, 0, -93, -38, 43, 14, 0, -14, 2, -7, -64, -28, -40, 30, -16, 2,
+  -26, -12, -22, 2, 32, -22, 44, 38, -19, 6, 32, 4, -28, 30, -10, 47,
+  -38, -21, -13, -28, -71, 36, 6, -38, 0, -10, -41, -8, -40, -51, 4, -52,
+  27, 16, -14, 3, -50, -3, -24, -39, -11, -35, -15, -58, -2, -20, 13, -37,
+  0, -48, -12, -23, -21, -6, 18, -23, -9, -28, -32, -19, 5, -25, 33, 10,
+  26, 33, -24, 5, -34, -40, -9, -14, 2, 51, -20, -29, 2, 6, 12, -11,
+  -45, -18, 84, -38, 46, 17, 55, -40, 15, 90, 39, -95, 17, -54, -2, -67,
+  -24, -13, 40, -48, -10, 0, 59, 3, -53, 25, 23, -68, -17, 9, 8, -19,
+  -3, -16, -127, -25, 24, -14, 35, -4, 16, 64, -55, -31, -32, -5, -71, -6,
+  0, -38, -119, 37, 46, 35, 3, -30, 82, -45, 85, 13, 20, 3, -47, 87,
+  -52, -88, -31, -11, 0, 4, 55, -72, -25, -40, 13, 31, 27, -19, 2, -7,
+  -18, 16, 6, -45, 10, 2, -46, -13, 0, 3, 21, 2, 8, 46, -21, 21,
+  -6, -31, 40, -9, 37, -45, 23, 2, 37, -21, 9, -19, 51, -16, -27, -50,
+  49, -14, 19, -28, -27, 40, 47, 8, 14, -28, 45, -25, -9, 25, 0, -34,
+  -35, -29, -29, -2, -24, 65, 2, 10, -8, -37, -31, -62, 0, 84, 5, -8,
+  10, -6, 7, -6, 58, 21, -57, -28, 22, 31, 46, 13, -8, -9, -17, 26,
+  -19, 14, -41, -10, 39, 5, 19, -2, 31, -48, -29, 10, 15, -18, -30, -14,
+  -51, -21, -21, -21, 0, 52, 14, -31, -13, 31, -11, -11, 0, -55, 36, -27,
+  -15, 3, 22, 14, -47, -7, 40, 6, -3, 13, -5, -71, -14, 24, -29, 0,
+  20, -12, 29, 0, -55, -21, 14, 37, -19, 8, -2, -5, 32, -16, -23, -26,
+  54, -22, 7, -10, 74, -9, -49, -11, -5, 33, -29, -2, -42, -28, 36, -18,
+  10, 16, -30, -44, -5, -8, -14, -22, 32, -4, -30, 11, 5, -49, -4, 0,
+  22, -14, 0, -26, -43, 19, -21, -22, -36, 16, -14, 6, 7, -15, -12, -3,
+  -33, -6, -25, -38, -44, -16, 33, 23, 46, -8, -21, 19, 0, -16, 32, -18,
+  13, 10, -17, 50, 39, -14, 75, -15, 18, -20, 35, -4, -30, -23, 51, -14,
+  83, -8, -27, -51, 8, -22, 17, -7, 8, -29, -47, 4, -24, -43, -27, -25,
+  20, 0, 5, -12, -43, 21, -9, 13, 0, -58, -40, -34, -30, -30, -12, 29,
+  -7, -26, -18, 0, -44, -11, -22, -37, -24, -39, 44, -38, 51, 22, -26, -21,
+  -44, -12, 3, 2, -21, 5, -10, 26, 31, 25, -3, 6, -62, -55, 6, -14,
+  25, -37, -35, -31, -19, 22, -7, 36, -51, 16, -33, 23, 19, -6, 25, -20,
+  40, 0, -22, 21, -55, 9, -89, -3, 3, 40, 14, -22, -58, -24, 38, -47,
+  -53, -20, 43, 26, -8, -12, -33, -51, -39, 31, 18, -35, 62, -35, 14, -13,
+  -44, -8, 55, 37, -15, -43, -78, 30, 36, -51, 35, 27, -36, -106, -18, -39,
+  -111, -34, 62, -3, 87, 44, 104, 7, -72, -2, 14, 23, -51, 34, -2, -30,
+  -7, -6, 27, 0, 16, 49, -19, 3, -47, -13, -79, 47, -21, -9, -26, -5,
+  -13, -12, -36, -32, -22, -14, 35, 9, -24, 11, -9, -21, -32, -3, -17, 5,
+  32, -20, 7, -22, 39, 39, -97, -30, 10, -28, -58, -6, -68, 8, 27, 7,
+  -19, 24, 8, 18, -30, -33, 7, 56, -43, -20, 8, -40, 15, 40, 16, 2,
+  25, -52, -39, 7, 71, 30, -19, 16, -19, -8, -19, 3, -9, 57, -21, -53,
+  40, 18, -34, -29, -6, 14, -33, -14, -2, 70, -39, 13, 36, 22, 9, -31,
+  -50, -20, -127, 12, 15, -20, 23, -4, -29, -33, -23, -29, -30, -28, -45, -21,
+  35, -3, -19, -18, -19, 61, -10, 13, 5, -9, 47, -6, -49, -40, 29, 30,
+  10, -43, -7, 14, 36, 9, -12, 22, 58, -24, -2, 37, 9, 54, 2, -18,
+  27, 58, 0, 6, 11, 32, -79, 0, 24, 17, 23, 0, 38, 6, 14, 21,
+  -25, 18, 79, 17, -18, -29, -45, -11, 5, -18, 42, 31, 53, 10, 21, 43,
+  -25, 5, -13, 39, -38, -47, 17, 11, -3, 38, -17, -23, 0, -34, 43, 22,
+  -10, -9, -20, -26, -24, 63, -28, -42, -56, -18, -10, -31, -18, -24, 17, 16,
+  -10, 0, -29, 26, 0, 2, -51, -6, -53, 11, 5, -40, -17, -13, -3, -34,
+  -35, -18, 38, -2, 71, -23, -10, -34, 18, 41, 0, 0, 12, 8, -15, 23,
+  -22, 0, 11, 21, 14, -52, -3, -58, 0, 4, 47, -59, 2, -15, 49, 2,
+  -14, 4, -53, 13, 0, 19, 41, 78, 26, 29, -78, -8, -53, -41, 3, 22,
+  36, -4, 34, -20, -7, -21, 11, -50, -17, 8, 22, -44, -32, 9, -35, -11,
+  21, -6, 0, 14, 69, 6, 0, 29, -4, 62, -22, 45, -16, -7, 4, 31,
+  -4, -22, 37, 14, -22, -112, -19, -6, -18, 49, -37, 0, -26, 46, -12, -50,
+  0, -39, 17, 13, 54, -25, 25, 13, -8, -22, 13, -30, -22, 33, -6, 43,
+  -32, 115, -46, 60, -37, 24, 37, -35, -50, 30, -3, -11, -6, 17, -31, 11,
+  4, 14, -37, -54, 16, -37, -49, -20, 4, -21, 74, -18, 12, -10, 37, 3,
+  0, -36, 0, -17, 11, -45, 14, 0, 25, -12, -52, -35, 20, 37, 49, 20,
+  -44, 8, 37, 0, -43, 41, -3, -30, -15, -29, -16, 89, 72, -81, 71, 7,
+  -45, 4, 40, -36, -34, -12, -55, 35, 50, -23, 22, 33, -40, 39, 20, -46,
+  0, -6, 19, 7, -12, 0, 31, 6, -46, 35, 35, -24, -28, 24, 16, -12,
+  -56, -18, 55, -21, 63, -7, -19, 0, 69, -30, 22, -6, -7, -17, 27, 0,
+  102, -62, -7, 38, -43, 35, -29, 65, -8, -11, 23, 8, 38, -33, -13, -14,
+  59, 127, -6, -16, 4, -14, -22, -31, -13, 27, -94, 15, 20, -73, -78, 4,
+  13, -30, 9, 48, -16, 9, -18, -3, -63, -38, -61, 3, -32, -21, 33, 6,
+  -4, -14, 15, -73, 29, -105, 33, -18, -11, 6, -52, 6, -13, 17, 27, -34,
+  -37, -62, -3, -10, 86, 19, 79, 52, 38, 7, 3, -42, -35, -33, -123, -32,
+  32, 79, -12, 40, -7, 24, 70, 15, -30, -8, -94, -77, -55, -39, -8, -18,
+  -4, -8, -51, 24, -28, -46, 0, 32, 63, 7, -57, -40, 36, -89, -33, 62,
+  -17, -79, 37, 10, 18, -45, -99, -70, 54, -9, 75, 38, 20, 29, -37, -3,
+  20, -31, -37, 42, 21, 48, -10, -13, -15, 50, 62, -68, -3, 77, 23, -68,
+  -18, 20, 0, -68, 0, -7, 44, 8, -43, 27, 35, -18, -9, -21, 16, -63,
+  -9, 3, 33, 31, -93, -18, -4, -53, 18, -73, -13, -13, -28, 14, 12, -103,
+  13, 47, 22, -56, -26, 7, 38, 3, -4, -18, -26, -9, -10, -37, 9, -10,
+  3, 39, -47, 35, 86, -22, 3, 9, 34, -54, -32, -30, 50, -41, 23, 29,
+  41, 8, -12, -60, -4, -33, 52, -62, -40, -34, -28, -15, -52, 51, -43, 21,
+  86, -28, 5, 17, -16, -37, -4, -9, -39, -14, -96, 13, -52, 45, -20, -22,
+  -39, 29, -4, 10, -66, -64, -33, 34, 0, -6, -7, -40, -10, 4, -40, -10,
+  -24, 70, 90, -42, 27, -35, 10, 87, 0, -32, 29, -51, -13, -81, -68, -7,
+  114, -48, -21, 92, -30, -60, 41, 50, 13, 0, -31, -4, 3, -34, 12, 99,
+  -26, -11, -9, -3, -60, -108, -57, -53, -92, 42, 13, -37, 40, -38, 8, -25,
+  60, -32, -11, -31, -125, 0, -94, 0, -90, -34, -37, -32, -23, -83, -18, 13,
+  61, -12, -53, 13, 21, -38, 3, -35, 15, -39, -32, 80, -13, 93, 52, -61,
+  50, -48, -12, -40, 11, -26, -18, -54, -23, -46, -47, -7, -17, -26, -20, 102,
+  39, 11, 126, -68, -56, -34, -31, 23, 39, 24, -26, 21, -8, 58, -41, -28,
+  -30, -39, 0, 80, -37, -45, -47, -6, -14, 30, -82, 6, 3, 83, -24, -7,
+  -5, 32, 23, -17, 77, -7, -36, -13, 23, 32, -32, 0, 12, 24, -7, 13,
+  20, -21, 18, -33, -8, -30, -47, 12, 0, -3, 9, -5, -17, -10, -79, 5,
+  64, 17, -7, 10, -6, -21, -10, 0, 13, -3, 36, 4, 24, -21, 25, 0,
+  -42, 0, 25, -3, -33, 8, 35, 18, 3, 21, -8, -2, 30, 9, -25, -5,
+  -5, -32, -60, -19, 8, 19, -14, -36, -37, 22, -5, 0, -28, -21, -44, 27,
+  44, -6, -7, -45, 8, -43, -17, -23, -52, 40, 7, -8, 43, 6, -35, 19,
+  -29, -4, -18, 10, -12, -49, 30, 4, 24, 0, -16, 2, 21, 46, -68, -51,
+  71, -40, -19, 10, 33, 28, 49, 9, 30, -2, 6, 2, 2, 6, -37, -38,
+  28, -50, 0, -29, 64, -2, -19, 10, -9, 8, 41, -3, -7, 3, 19, -13,
+  51, 24, 7, 3, -8, -23, 19, 23, -52, 29, 28, 11, -33, -3, 23, 37,
+  -19, 25, 7, 23, -61, 7, -23, -11, -13, -36, -46, -20, -3, 15, -18, -40,
+  23, -27, -16, -3, 39, -3, -64, -11, -27, 0, 31, -2, -30, -25, -5, -8,
+  -31, 70, -18, 0, 56, 0, 12, 10, -43, -3, -7, 32, -5, -21, 15, -30,
+  37, 6, 7, -24, -37, -20, -22, 12, -30, 63, 38, -60, -9, 29, 15, 48,
+  42, -4, 35, 10, -30, -18, 17, -2, -61, -52, 46, -51, -27, -41, 0, -23,
+  39, 27, -41, 18, -53, -20, 14, -9, -60, 0, 31, 4, 2, 16, 9, -15,
+  13, -6, -50, -89, 64, 24, 33, -39, -54, -22, -68, 51, 12, 18, -51, -35,
+  -3, -3, 34, -90, 70, -9, 53, 52, 20, -14, -31, -30, -33, -58, -70, -16,
+  -10, -17, 32, -13, 9, 42, 43, -57, -127, 29, -95, -14, 51, 44, 34, 5,
+  -39, 51, -25, -18, -47, -56, -39, -14, -95, -9, -25, -22, -5, 37, -2, -63,
+  43, -3, 18, -5, -85, -48, -17, -10, 23, 40, 12, -32, -47, 0, -22, 8,
+  37, 27, 5, -15, -14, -11, -22, -3, -35, 43, -12, -22, -17, -6, 18, 16,
+  -51, -39, -39, -8, 24, -9, -3, 39, 26, -52, -36, 2, -9, -41, 31, -2,
+  -10, 22, 0, -16, 22, 37, -32, 50, -8, 57, -11, -7, -12, -28, -32, -8,
+  -10, 47, -5, -10, 109, -14, 7, 16, -23, 13, 27, -13, 5, -31, -2, -3,
+  27, 33, -9, -63, 3, 0, -36, 32, 5, 14, 28, -33, -41, 10, -29, 16,
+  32, -19, 11, -3, 30, -30, 27, 15, 16, -21, -16, -12, -9, -23, -46, -42,
+  -32, -30, 14, -10, 33, -11, -42, -32, -5, -9, 70, -54, -27, -34, -21, -20,
+  -48, 26, -15, 46, 48, 21, -48, 29, 14, 65, -2, -35, -59, -12, 0, -30,
+  61, 15, -9, -36, -45, -39, -6, 67, -22, 20, 2, -3, -4, 26, 79, 11,
+  0, -10, 25, -5, -30, 14, -17, -24, 29, 21, -99, 6, -9, -21, -22, -37,
+  -3, -24, -66, -26, -33, 25, -28, 9, 0, 34, 17, 22, -20, -59, 0, 86,
+  54, -62, -13, -12, 0, 14, -21, 56, 20, 13, -34, 32, -54, -6, 15, -13,
+  24, 51, 43, 33, 8, -18, -3, 15, -17, 29, 35, 16, -4, -16, 26, 24,
+  -97, -4, -67, 38, 9, -32, 43, 9, 48, -3, 30, -16, -39, 10, 15, 7,
+  -104, -32, 3, 5, -83, 14, 11, -5, -11, 55, -28, -4, -27, -3, -14, 45,
+  13, 6, 3, -24, -25, 2, 15, -3, 29, 27, 0, -23, -29, 9, 7, -36,
+  -62, -6, 19, -61, 6, 13, 20, 24, -23, -3, 26, -3, -26, -20, 9, -27,
+  -16, -19, -93, 34, -9, 14, 17, 9, -11, 5, -33, 16, -25, 10, 16, -26,
+  53, -3, 28, -3, -34, -3, -21, 9, -25, 23, -14, 9, -43, 16, -14, 8,
+  -31, -9, -15, 56, -8, -15, -12, 7, 14, -8, -2, -29, -24, -68, -30, -8,
+  -3, 3, 5, -40, 9, -15, 3, -21, -28, -41, -17, -3, 7, -23, 12, 16,
+  -23, 13, -28, -13, 22, 23, -24, -49, 48, -34, 37, -20, 0, -21, -31, -9,
+  59, 3, 14, -13, 14, 3, -50, 37, -17, -26, -54, -20, -13, -35, -58, 41,
+  -57, -3, 31, -2, 16, -19, 0, 0, 20, 25, 22, -23, 31, 19, 17, -5,
+  73, 36, 16, -24, 3, -36, 48, 41, -13, 32, -31, -42, -20, 39, 21, -19,
+  -20, -36, -50, -5, -31, -54, -40, 27, -24, -5, 23, -16, -6, -21, -19, -59,
+  -16, -55, 22, -32, 14, -14, 25, 0, 6, 0, 6, 2, -5, -51, -21, -8,
+  18, -21, -33, -37, -4, 5, 53, -46, -35, 30, -30, 3, 2, -19, 12, -74,
+  -35, -33, -46, -24, 34, -15, 42, -27, -60, 12, -7, -36, 7, 33, -21, 3,
+  10, 2, 28, -60, -18, -7, -47, 2, -24, 24, -60, -14, -46, 81, 6, 40,
+  -3, -5, -3, -19, -22, -3, -4, -74, 3, 2, 31, -44, 0, 19, -5, 3,
+  -47, -3, -38, -2, 12, 36, -22, 33, -6, -49, -94, 119, -2, -22, -15, -88,
+  62, 3, -114, -49, -80, 5, -87, -127, -70, -15, 26, -14, -4, 114, -18, 24,
+  7, 38, 100, -31, -83, -21, 0, -13, 56, -113, 7, -4, 18, -44, -31, -36,
+  -3, -77, -45, 8, -73, 80, -25, 19, -28, 35, -9, 4, -18, 22, 21, 31,
+  -16, -98, 36, 20, -20, 12, 5, 13, 26, -3, -27, 26, -22, -37, 5, -41,
+  -10, -18, -35, -6, 20, -29, 11, -6, -13, 38, -7, -14, 9, 0, 51, 11,
+  56, 11, 7, 44, -22, -9, -27, -4, 27, -37, -60, -12, -43, -8, -9, -14,
+  -46, 16, -6, 21, -28, 20, -25, -28, -11, 12, -14, -9, -15, 19, -28, 26,
+  21, -6, -5, 22, 8, 29, 0, 36, 69, -38, 25, -3, -22, -37, 47, -25,
+  -69, 54, -37, -46, -34, -24, 17, -15, 0, -41, -12, -42, -42, 59, 15, 11,
+  75, -4, -7, 36, 15, -26, -27, -49, 13, -50, 3, -12, 12, -5, 3, 12,
+  -59, 27, -8, -64, -37, -34, -25, 16, -22, -5, 40, -13, -23, 19, -9, -21,
+  -16, 39, 25, -27, -4, -17, -10, -40, -32, 63, 37, -19, 22, -40, 37, -25,
+  -17, -45, -23, -52, 17, -4, 42, -38, -5, -15, -46, 0, -26, 72, 9, -27,
+  13, 32, -7, -54, -9, 85, 20, -11, -35, 77, -53, -16, -18, 18, 25, -14,
+  46, 109, 31, 3, 34, 43, -18, 35, -33, -37, 29, -4, -30, -6, 28, 36,
+  10, -24, -71, -12, 0, -46, -7, -60, -58, 25, -57, 26, -70, 0, -42, 14,
+  7, -24, 26, 6, 31, -16, 20, -21, -73, 3, 7, 70, 31, 20, -77, -43,
+  23, -15, -71, 36, 40, -9, -40, 7, 8, 13, 17, -16, -55, -31, -50, -21,
+  30, -3, 3, 45, -22, -9, 21, 9, -44, -12, 20, -4, -48, 0, -7, -8,
+  -2, -4, -17, 2, -9, 35, 9, 2, 2, -8, -7, -10, -23, 9, -6, -14,
+  -16, 18, -7, 11, -6, -1, 0, 11, -28, 7, -9, 29, 17, -25, -9, 8,
+  -37, -24, -5, 12, 28, 0, -28, -12, 6, -18, 8, -29, -14, 22, 0, -20,
+  40, -27, -13, 26, 25, 24, -5, -16, -31, 7, 2, -15, -32, 29, 2, 2,
+  -27, -7, 10, -15, -15, 5, 20, 17, 9, -10, 4, 36, 7, 7, 0, 33,
+  16, 16, 2, -48, -9, -26, -27, 44, -25, 13, -38, 19, 20, 29, -13, -20,
+  10, -46, -5, 12, 25, 7, 25, -25, -2, -4, -8, -20, 9, 0, 5, 4,
+  -12, 8, 10, 0, 13, -13, 19, -12, 8, -26, -4, -5, -19, -7, -26, -6,
+  -16, 2, 13, -18, -15, 2, -31, -17, 6, 23, -24, 22, -7, -7, 13, 0,
+  31, -27, -14, -18, -11, -3, 21, 38, -13, 0, 14, 2, -5, 32, 11, -18,
+  -7, -11, 13, 2, 0, 5, -28, 20, 12, 12, -10, 9, -28, -24, 12, -29,
+  22, -10, 52, -6, -32, -2, -11, -35, -10, 7, -24, -20, 2, -50, -3, 25,
+  -16, 25, -15, -11, 49, -25, -7, 15, 13, 29, -2, 10, 23, 5, -33, -16,
+  10, -16, -14, 25, 0, -12, 15, 18, -27, 2, -22, 13, 3, -5, 7, -2,
+  0, -8, 21, -8, 7, 5, -38, 3, -2, 20, -13, -27, 18, 12, -19, 9,
+  5, -19, 4, -14, 4, 2, -27, -9, -17, -28, 9, -7, -17, -10, -5, -14,
+  -10, -47, -21, 18, 25, -16, -62, -25, -35, -39, -20, 61, -68, -54, 63, -12,
+  44, -20, -26, -25, -69, -3, 6, -71, -34, 11, 25, -46, 17, -32, -54, -4,
+  -10, 6, 27, -12, 32, -5, 40, -18, 40, -127, 30, 15, -69, -14, -26, -23,
+  -12, -51, -29, 10, -57, 32, 24, 66, 0, 44, 0, 22, -2, 64, 0, 37,
+  -16, -34, -36, 20, -71, 29, -16, 25, 6, -6, -17, 17, -22, -40, 11, -2,
+  49, 25, -33, 18, 24, -51, -8, 44, -6, 50, 2, -27, -41, 37, 112, 12,
+  -5, -11, 5, 41, -42, 4, -51, -20, 53, -20, 8, -35, -9, 29, -7, -20,
+  -2, 19, -8, -52, 25, 6, -16, 7, 19, 12, 34, -7, -32, 2, -2, 14,
+  19, 27, -19, -9, 25, 5, -13, 35, -41, 6, -20, 5, -4, 16, -26, -21,
+  -13, -23, -7, 62, -21, 10, -2, -33, -2, -15, -7, 17, 5, 0, 11, -6,
+  -5, 5, 11, -39, 2, -9, 40, -15, -6, 0, 48, 0, -28, 14, 0, -4,
+  40, 21, -10, 32, 8, -9, 35, 10, -19, -10, 0, 12, -4, -19, -14, -23,
+  -12, -11, 15, -53, 43, -7, 18, -5, -4, 43, -28, 12, -16, -21, 54, -56,
+  13, -43, -14, -62, -52, 11, 6, -20, -38, 0, -18, 10, -17, 29, -29, -75,
+  7, -17, -51, -37, 5, 42, 30, -12, -4, 22, -38, -2, -16, -4, -9, -4,
+  42, 19, -52, 34, -25, 24, 24, 3, 46, -21, 49, -22, -4, -29, 23, -6,
+  -10, -27, -13, -9, 58, -4, 18, -50, -32, 2, -20, 22, -43, -26, -7, 0,
+  89, 18, -30, 0, 28, 0, -19, -44, -62, 50, -5, 17, -23, 2, -22, -8,
+  -5, 10, 3, 0, 7, 28, 18, -8, 12, 24, 53, 2, 7, -18, -21, -18,
+  15, 39, 50, 50, 4, -19, 22, -26, 6, 3, 4, -41, 21, 24, 5, -23,
+  111, -72, -18, 31, 43, 11, -64, -23, 20, -19, -34, 15, -30, -18, 0, -51,
+  56, 31, 8, -14, -16, -44, -26, 14, -52, 17, -28, -39, 5, 41, 38, 34,
+  34, 32, -74, 15, -60, 0, -31, -13, 68, -79, -19, 5, 32, 51, -11, 25,
+  -49, 13, 10, -61, -10, -26, 17, 11, 19, -3, 0, 23, 32, 40, -48, 56,
+  3, -17, 56, -17, 38, 25, -31, 46, -13, 3, 0, 52, -19, 7, 17, -28,
+  -8, -10, 11, -49, 0, -17, 29, 27, 3, 13, 14, -39, -38, 53, 34, 19,
+  53, 5, 99, 18, 28, -38, -12, -5, 40, -6, -58, -21, -25, -12, -40, 11,
+  -38, -32, 32, -43, -94, -13, -62, -13, 32, 21, 36, -18, -64, -59, -35, 30,
+  72, -72, -38, 23, 43, -39, -22, -19, -73, -16, -29, -15, 6, 111, -20, -6,
+  -8, 0, 21, 70, 33, -46, 0, -17, -15, 50, 0, -51, -8, 30, 0, 3,
+  -15, 2, -16, -48, 7, 27, 23, -15, 12, 21, -19, 26, 14, 33, 4, 5,
+  -11, 3, -6, 18, -39, -73, 58, -8, -6, 32, 40, -5, -38, -15, 16, -33,
+  12, -34, -21, -71, 5, -39, -17, -65, -80, 47, 3, -37, 36, 0, -11, -16,
+  -56, -31, 19, 4, -23, 25, 23, 7, -15, 0, 36, -10, 0, -49, 14, 0,
+  -49, -29, -4, 24, 11, -22, 78, 33, 0, 9, -31, -37, 0, -6, 40, -41,
+  91, -57, 13, 18, -49, -63, -58, -27, 29, -75, 7, -41, 6, 18, 0, -15,
+  -9, -58, -56, -127, -57, -11, -25, -73, -67, -51, -120, 78, 44, -11, -17, -69,
+  52, -84, 59, 56, 10, 2, -19, -31, 26, -64, 6, 80, -31, 11, 24, -56,
+  -8, -36, 74, -3, 67, 35, 50, -28, -53, -49, -31, 9, 0, 15, 25, 5,
+  76, 16, -71, -74, -78, 30, -41, -40, 64, -11, -13, -31, -6, -37, 83, -59,
+  60, -3, -103, -48, -38, -56, -28, -38, 37, -69, -9, -26, 6, 54, -40, -25,
+  40, -3, 32, 21, 23, 0, -78, -17, -3, 7, 58, -19, -5, 23, -58, -9,
+  -72, 12, 12, 69, 82, -3, 0, -51, 40, -67, 50, -32, -57, -60, 18, 27,
+  34, -38, -13, 49, -19, -33, -37, -27, -3, 35, -16, -66, -41, -110, 43, 0,
+  -33, 45, -70, -65, 33, 20, -48, -15, -43, 16, 3, -7, -11, -36, -34, 19,
+  4, 87, -13, 0, -7, 38, -49, 34, -15, 34, 19, -16, 13, 45, 10, -40,
+  4, 53, 12, -45, 43, -14, 27, -41, 12, -3, 50, -49, 46, -27, 7, 22,
+  68, -73, -39, -34, 16, -33, -45, -24, 38, -38, -10, 13, 26, 18, -40, -39,
+  -36, -58, -62, -17, 85, 22, 11, 4, 17, -28, -3, -48, -50, -29, 40, -3,
+  64, -49, -5, 49, 0, 2, -26, -31, -44, -13, 19, 26, -71, 68, 0, 3,
+  83, 2, -12, -69, 21, 0, -74, -5, 28, -6, -54, 9, 4, 27, -22, -8,
+  0, -22, -19, 28, -19, 59, 4, 3, -35, -19, -43, -10, 32, 4, -43, 41,
+  -12, -27, 62, -20, -99, 28, -14, 27, -20, 19, -34, 52, 19, 0, 54, -66,
+  92, -10, -11, 11, 30, -15, -3, 37, -17, -17, 28, -51, 10, 64, 41, 19,
+  64, -36, 16, -42, 67, -14, -43, -18, 47, -27, -81, -5, -11, 24, -36, -41,
+  68, -9, 32, -15, -26, 0, 17, 16, 54, 11, -3, -3, -61, -4, 8, 47,
+  18, -38, -27, 7, -24, -31, -12, -10, -25, 19, 5, 13, -21, -45, 36, 0,
+  -20, -12, 23, -12, -36, 21, -44, 35, -20, 20, 33, 14, 37, -26, -15, -3,
+  -13, -45, -59, 15, 18, -39, 43, 9, -26, -36, 3, -2, 9, -18, 3, -42,
+  -13, -8, -52, -13, -33, 14, 35, 54, -11, 7, 0, -9, -15, -6, -7, 8,
+  -30, 3, 27, 26, -20, -2, 28, -39, -37, 43, -5, 25, 42, -12, 5, -19,
+  -17, 3, -45, 0, -42, -20, 14, 89, 10, -6, 28, -30, 0, 22, -26, -50,
+  -16, -29, -94, 8, 42, 5, 10, -13, 0, -8, 29, 4, 33, -20, -31, -19,
+  -35, 43, 27, -5, -8, 17, 77, 7, -8, -34, -6, 13, 7, -6, 5, -3,
+  33, -9, 2, -29, 12, -31, 12, 19, 20, -27, -10, -19, -23, -3, 2, 5,
+  24, -27, -16, -24, 45, -14, -8, 40, -30, 14, -9, -14, 26, 35, 38, 8,
+  -19, -25, 31, 13, 30, 18, -23, -54, 52, 13, 0, 6, -54, 33, 31, -21,
+  -16, 21, -8, -34, 0, -25, -7, -32, -19, 14, -25, -4, 17, -25, -75, -15,
+  -23, 23, 47, 2, 88, -31, -2, 10, 11, 27, 5, 9, 5, -51, 46, -104,
+  -3, 47, -43, -24, -45, -60, -25, -3, 12, 48, 9, -60, -24, 19, 29, 31,
+  35, -2, -63, -20, -21, -7, -43, 13, -50, 0, -23, -22, 0, 18, -70, 9,
+  -26, 13, 11, -34, 0, 6, -38, -50, -62, -20, -6, 2, -12, -65, -11, -53,
+  43, 6, -15, 29, 92, -5, 0, -16, -68, -53, -72, -16, -30, 6, 36, -24,
+  -20, 15, 0, -86, 22, 7, 66, -58, 0, -6, -96, -33, 0, 16, 29, 31,
+  35, 49, 24, -53, 18, 7, 53, -9, 8, -31, 20, 29, -96, 36, 15, -25,
+  -23, 24, 92, 31, -69, 3, -49, 59, -16, 25, -8, -22, 27, 74, -11, 20,
+  -28, -35, 7, 19, -28, 40, -5, -39, 39, 3, -58, -75, 21, 9, 27, -40,
+  34, -30, -16, -21, 6, -16, 33, -69, -15, 45, 37, -8, 4, -26, 35, -24,
+  3, 6, 24, 18, -60, 5, -69, 2, 45, 10, -36, 6, 0, 3, -31, -23,
+  -35, 40, 22, -18, -38, -11, -10, 16, -24, 18, -6, 22, 12, -15, -14, -3,
+  0, -29, -2, -19, -12, -52, 17, 13, -51, -37, -12, -63, 28, 18, 10, 16,
+  -81, 30, -34, 18, 25, -7, -36, -12, -10, -31, 12, -8, -17, -16, -35, 47,
+  -13, 16, 0, 0, -27, -55, 33, -13, -16, 0, 39, 10, -42, 31, 18, 23,
+  19, -69, -24, -16, -5, -3, 70, -7, -8, -16, 8, -4, 7, -53, -36, -35,
+  -15, 64, 47, 10, -116, 21, -12, 26, 31, -61, 5, -13, 51, -15, -22, -51,
+  7, -12, -27, 0, -17, -5, -25, -35, 42, -3, -16, 33, 9, 26, 3, -8,
+  -22, -10, -24, 20, 6, -5, 0, -24, 50, 13, 3, -47, 45, -3, -49, -32,
+  29, -48, 16, 5, -27, 8, 35, 23, -11, -30, 3, 17, -61, -127, 54, 0,
+  -38, -12, -15, 10, 12, 2, -7, 29, 28, 5, -5, -22, -37, -3, 29, -5,
+  10, -3, -9, -3, 11, -12, -19, 17, -15, 48, 2, -22, -39, -45, -49, 8,
+  0, 23, -14, 18, -48, 30, 7, 9, 3, 28, 16, 14, -51, 18, 46, -5,
+  -29, 40, 5, 29, -5, -64, -38, 11, -32, 32, -22, -45, -2, 6, 11, 13,
+  27, -27, 10, 38, -74, 44, 9, -43, 15, -7, -38, -13, 28, -16, -58, -11,
+  -58, 31, -18, 36, -30, 26, -47, 15, 7, 0, -34, 14, 23, -51, 50, -31,
+  8, -5, 78, -10, 32, -37, -9, 0, 38, -27, 48, 31, 40, 7, 20, 34,
+  -77, -7, 54, 7, -15, -11, 42, -60, 0, 12, -93, 20, 49, 41, -33, -17,
+  -13, -27, 46, -35, -32, 25, 9, 43, 34, 11, -51, -46, 0, 20, 6, 25,
+  58, -27, 24, 40, 0, 2, 7, -38, -16, 53, 6, -11, 0, -25, 50, -7,
+  -59, -27, -14, 3, -40, 61, -70, 23, 35, 21, -13, -36, -28, -91, 24, 37,
+  9, -14, -7, -69, 7, -41, -84, -75, -43, 6, -118, 6, -65, -86, 0, -27,
+  -30, 15, -20, 29, 5, 31, 28, -17, -75, 0, -16, 79, 19, -4, 19, -18,
+  49, 20, -6, 16, -70, -24, -58, -38, 36, 4, -28, 32, -23, 64, -39, -31,
+  8, -5, 37, -50, -24, 0, 87, 9, 7, 0, -13, -5, -60, -14, 53, -61,
+  -17, -28, 36, 7, 11, -63, 65, -9, 18, 33, -4, 6, 55, 53, 24, 13,
+  -17, -19, -36, 29, -101, -28, -6, -90, -56, -14, -13, -33, -9, 24, -29, -4,
+  -40, -27, -63, -24, 0, -24, -15, 8, 7, 71, 12, -32, 11, 21, 27, -45,
+  13, -5, 92, -94, -12, 15, -35, 12, -35, 17, 56, -29, 0, -7, 20, 52,
+  17, 21, 22, 3, -11, -59, 23, 9, 14, -66, -33, 11, -85, 41, 12, -63,
+  -3, -23, -16, -29, -111, 19, 22, 13, -49, -7, -3, 17, 53, 0, -58, 18,
+  -9, -67, -60, 115, -15, 0, -84, -50, -7, 26, -84, -4, -11, 4, -108, -17,
+  89, -46, -69, -34, 48, -43, -57, 29, 49, -21, -4, -52, -8, -20, 44, 37,
+  77, -7, -7, 31, -25, -48, 23, 3, -57, -27, -70, 37, 13, -41, 57, 30,
+  -3, 62, 26, -10, 16, 41, 28, -4, 7, -74, 86, 21, -28, 0, -22, -35,
+  -108, 47, -9, -40, -4, 33, -4, -42, -59, -60, 9, -32, 20, 13, -19, -14,
+  -8, 65, 23, -57, -32, 30, 26, 23, -3, 10, 9, -23, 24, 7, 12, -3,
+  34, -64, -87, 0, 0, 19, -28, 30, -93, 18, -7, 23, -13, 25, 18, 23,
+  -17, 39, -33, 70, -64, -9, -22, -99, 22, -7, 6, -17, 3, -84, 26, 60,
+  -36, -71, 27, -55, -85, -28, 65, 15, -59, 53, -6, -54, -26, 72, 66, -28,
+  4, -41, 28, -30, -24, 24, -22, -63, -35, 38, -69, -26, -60, 30, -12, 15,
+  -55, 11, 47, -55, -15, 52, 19, 21, 4, 81, -4, 3, 42, -41, 15, -17,
+  37, 31, 59, -63, -5, -47, -13, -21, 71, -11, 93, -104, -28, -76, -48, 53,
+  -27, -20, -6, 67, -30, -26, 22, 50, -52, 23, -9, -29, -40, 17, 42, 10,
+  -127, -35, -55, 27, -16, -110, 92, -104, -90, 7, -48, -18, -52, 14, -73, 37,
+  -4, -117, -90, 14, -11, 26, -42, -45, 54, 33, 67, -40, 39, -82, -27, 73,
+  23, -27, 53, -22, -74, -100, -34, -82, 101, -11, 32, 108, -12, -60, -10, -106,
+  0, -55, 6, -28, 41, -5, -73, -69, 16, -75, -37, 61, -9, 21, 50, 17,
+  -42, 46, 18, -17, 16, 24, 22, 69, 80, 14, -22, 0, 20, 41, -49, 40,
+  -64, -43, 4, 0, 11, 37, 51, 15, 7, -24, 7, 29, 104, -103, 12, -57,
+  -28, -32, 33, -51, -73, -12, -19, -10, -68, 19, 7, -38, 36, -18, 42, -19,
+  -62, -3, -51, -21, 23, 22, -8, 6, -35, 17, -9, -19, -7, -110, 29, -3,
+  -42, 23, -28, -20, 15, -7, -7, 37, -8, -47, 36, 2, 0, -5, -37, 5,
+  -62, -32, 28, 3, 53, -17, -43, 18, 11, -55, -25, 4, -5, -31, -30, 33,
+  -18, -6, -20, -2, -61, -5, 7, -36, 54, -30, 22, 0, -55, 9, 0, 8,
+  41, 18, 30, -15, 17, 22, -11, 12, -55, -37, -17, 25, -46, -39, 9, -19,
+  0, -15, -4, 28, -12, -9, 17, 44, 24, -50, -3, 2, 3, 13, 22, -21,
+  -20, 11, -17, 5, -42, 11, -35, 67, 41, 21, 8, 0, 22, 56, -39, 18,
+  -5, -9, -5, 7, -12, -2, -7, -26, 31, 32, 20, 41, -12, -3, 2, -27,
+  24, -12, 5, 6, 45, -7, -78, 29, 47, -3, -5, -3, 13, -3, 27, -40,
+  3, -6, -18, -33, -52, 42, 3, 37, 3, -23, -7, -30, -18, 54, -12, 47,
+  -127, 81, 14, -34, 8, 51, 4, 9, -52, 9, -14, -26, -17, 44, 21, -15,
+  0, -21, 35, 27, 12, 50, -24, 20, -31, -24, 34, -10, -9, -31, -39, -22,
+  -27, 24, -11, -9, -17, 34, 3, 3, -15, -20, -7, 33, -13, -71, -12, -27,
+  -6, 10, -39, 33, 0, 5, -63, -24, 50, -60, -23, -14, -21, -13, 59, -47,
+  0, -49, 28, 42, 31, -28, 46, -23, -27, -37, -3, 17, -10, -53, -51, 8,
+  -33, -50, 0, -10, -36, 19, -7, -39, 0, 16, -10, -35, -2, -12, 49, -24,
+  99, -3, -9, -12, 8, 4, 3, -15, -65, -49, -21, 50, -61, -45, -12, -19,
+  -91, -35, -81, 36, 6, 2, -67, -20, -3, -68, -66, 12, -33, -23, -65, -49,
+  42, -68, -30, -34, -28, 51, 21, 21, 16, -69, 31, -37, 10, -94, -21, -30,
+  13, 38, 18, -22, -12, -10, -14, 7, 68, 14, -42, 41, 36, 40, 7, -11,
+  3, 30, 57, -6, -6, -7, -3, 29, -52, 46, 14, -8, 15, -10, -62, 56,
+  36, -10, 21, 64, -15, -9, 43, 0, -32, -3, -17, -20, -15, -26, -19, -21,
+  -68, -8, -28, 32, 50, -3, 85, -34, 11, 2, 8, 15, -35, -25, 0, 48,
+  -3, 9, 0, 5, 65, 24, 26, 23, -28, 24, -24, -10, -36, -37, -24, -5,
+  7, -9, -23, -48, -11, 23, -6, -41, 30, 3, -24, 50, -24, 23, -6, 8,
+  -32, 31, 14, -44, -6, -26, -37, 7, -19, 23, -13, 26, 61, -8, -34, 5,
+  -10, -22, -11, 34, -11, -28, -50, 51, 22, -14, 28, 9, 10, -69, -30, 20,
+  31, -32, -23, -15, -16, 14, -19, -49, 20, -43, -54, 41, 5, 21, 42, -32,
+  65, 36, 5, -9, -45, -23, -72, 12, -12, 49, -9, -19, 22, -32, -35, 43,
+  -55, -23, -11, -36, -61, -14, -47, 0, 21, -37, 20, 30, -21, 23, -6, -61,
+  0, -30, -3, 55, -53, 3, -43, -16, -93, 28, -25, 2, 35, -3, -2, 43,
+  -31, -9, -70, -12, 4, -26, 0, 7, 54, -51, -54, -22, -17, 64, 56, -3,
+  48, 21, 28, 39, -6, -2, -11, -20, -2, -46, 2, -11, 17, -32, -24, 32,
+  58, 2, 0, 5, -27, 35, 3, 15, -64, 34, 10, 16, -18, -18, -71, -19,
+  7, 24, -11, 55, -22, -11, -18, 37, 30, 9, 14, -9, 10, 0, 18, -76,
+  0, -3, -34, -15, -13, -35, 35, 48, 6, 14, 8, 17, 15, -41, 0, 3,
+  -4, -12, 33, -69, 18, -19, -23, -24, -26, -30, 49, 31, -11, 13, -52, 8,
+  40, -15, 11, 11, 9, 29, -10, 7, 0, 19, 10, 25, 16, 3, -80, -5,
+  54, 6, 17, 11, -17, 9, 74, 10, 26, -33, 47, 7, 18, -3, 7, -47,
+  24, -28, -10, 5, -92, -5, -10, 14, -3, 22, 48, 3, -7, -96, -10, -31,
+  -32, -16, 29, 34, 18, -21, 0, -46, -16, -24, 0, 9, 11, 13, 12, 3,
+  7, -50, -51, 8, 32, -58, -52, -21, 33, -16, -24, -17, -35, -16, -16, 22,
+  10, -8, 17, 8, -29, -18, -37, -2, -9, -10, 35, 7, 0, -26, 7, 18,
+  -29, 0, -3, -13, -25, -5, 5, 24, 18, 25, 46, -60, -32, -19, -25, 39,
+  21, -37, 43, -25, -23, 6, 23, 21, -8, 6, -49, 31, -68, -64, 12, -52,
+  -57, -26, -11, 11, 22, 0, 24, -30, -50, 0, 27, -39, -66, -54, -13, 15,
+  27, -28, 11, 63, -40, 9, 0, 36, 62, 10, -21, -14, -8, 7, 14, -18,
+  -13, -37, 10, -50, 42, 40, -10, -34, 12, -22, -58, -23, -27, -38, -28, -17,
+  14, 31, 0, -25, 35, -24, -14, -42, -54, -9, -7, -74, -11, 37, 24, -6,
+  -3, -2, 44, -13, -3, 0, 10, -23, 69, 5, 10, -10, -3, 46, -13, 27,
+  7, -8, 20, 44, 23, -6, -7, -48, -11, 48, -12, -9, 5, 36, -10, -24,
+  -13, 15, -16, -13, -34, -50, 50, 68, 12, -17, 0, 63, -22, -35, -33, -51,
+  -46, 3, -10, -6, -15, -60, -12, -30, 5, -30, -15, -114, -11, 64, -58, -36,
+  71, -19, -110, 56, -32, -10, -21, 21, 30, 35, -72, -27, 41, 3, -71, 29,
+  14, -62, -17, -79, 0, 21, -11, -43, 54, -76, 15, 0, 3, -13, 0, -18,
+  24, -28, 37, 8, -13, 2, 15, 7, 3, 0, 8, -26, 0, -45, 51, -51,
+  -57, -37, -17, 19, 26, -11, 35, -21, -3, -33, 39, -6, 16, -27, -18, 3,
+  -67, -2, -7, 32, -57, -12, -14, 5, 41, -49, -31, 12, -82, 59, -58, -20,
+  0, -59, -20, 5, -35, 12, -18, -26, -31, 12, 18, -5, 0, 10, -21, 79,
+  11, 6, -60, -15, 46, 17, -35, 34, -18, -6, -5, -13, 7, -19, 25, -3,
+  28, -81, 14, 3, -6, -7, 20, -67, 3, -21, 7, -49, -9, 0, 43, 0,
+  -27, -9, 44, 85, -6, 2, 24, 7, -25, 3, -24, -10, -44, 0, 42, 7,
+  -14, 8, 54, -11, 0, 44, 55, 43, -6, 12, -3, 9, -47, 46, 38, -3,
+  83, 18, 5, -30, 4, 0, -22, -20, -44, -14, 8, 26, -20, -54, -23, 37,
+  82, -16, 0, 75, 47, -11, -66, 70, 44, -33, -15, -51, 20, -54, 64, 17,
+  -74, 30, -26, -8, -9, 19, -66, 16, -22, 0, 17, 12, 63, 48, 77, 59,
+  -44, -20, -26, 19, -23, 12, -18, 17, -40, -5, 26, 38, -16, 13, 14, 26,
+  40, -21, -39, 18, -29, -5, -60, 68, 15, -14, -63, 43, -62, -6, -30, -42,
+  -50, -25, 17, -28, -50, -52, -40, -49, 28, 21, -10, -9, -5, -10, 6, -22,
+  64, -50, 11, 11, 28, -24, -3, 50, 127, -30, 14, -41, 6, -13, 29, 0,
+  -3, -8, -34, -3, -32, 26, -11, -24, -23, 31, -21, 38, -28, -10, -7, 24,
+  3, 20, 23, -8, -79, 55, 19, -19, 52, 0, -20, -33, 8, 56, -14, -22,
+  -35, 41, 47, 17, -6, 23, -22, -10, 3, -49, 27, -6, -25, -4, 20, -52,
+  41, 2, -52, 82, 59, 53, -84, 3, 40, 54, 15, -2, 7, -41, 0, -38,
+  -19, 25, -50, -39, 29, -10, 32, 5, -50, 0, 26, 22, 3, -43, 13, -6,
+  -35, -13, -6, 6, -37, -41, 22, 11, 10, -19, 14, 22, -14, -95, -62, 31,
+  43, 10, 16, -45, -13, 14, -19, 27, -31, -13, -16, 9, 42, -11, -13, 18,
+  -7, -19, -12, 32, 21, 0, 57, -3, 70, -30, 8, 2, 28, -21, -35, 11,
+  41, -15, -50, 30, -13, 3, 16, 5, 47, 3, -10, 17, -17, -54, -16, 15,
+  -3, -71, -32, 69, -42, 41, -8, 68, 13, 43, -14, -4, 30, -4, 3, -46,
+  -12, 72, -24, 21, -97, 12, -60, -3, -20, 33, -27, -47, -12, 11, 67, 49,
+  -26, 2, -24, 9, -14, 19, -15, 55, 27, -24, 15, -32, 56, 12, 0, -8,
+  0, 15, 6, -48, -10, 52, 37, 11, -25, 47, -19, 2, -31, -40, 24, 32,
+  -35, 57, 20, -3, 97, 5, -16, 38, 0, -127, -20, 22, -30, 18, -34, -28,
+  8, 17, 11, -41, -52, -2, -35, -13, -23, 13, 3, 50, 25, -52, -44, 64,
+  4, 12, 20, -3, -38, 0, -61, 8, -33, 0, -30, 16, 38, -59, 4, 19,
+  -48, -3, 0, -18, -10, -6, -24, 58, -56, -3, 19, -12, 0, -40, -26, 6,
+  6, 57, 63, 39, -69, -60, 30, -38, 33, -93, 17, -69, -95, -39, 0, 28,
+  -59, -51, 24, -100, 58, -29, 41, 7, -3, -30, 3, -76, 37, 44, -10, -55,
+  -22, -14, -32, -15, 7, 29, 34, 50, -76, 72, -53, -14, -87, 12, 32, 5,
+  19, 59, -6, -90, 0, -49, -12, 61, -41, -50, 32, 5, -80, 54, -55, -49,
+  23, -61, -9, 89, -9, -79, 71, -41, 62, -34, 31, -15, 38, 63, 50, 19,
+  -31, 38, -32, -24, 65, 21, 6, 10, 0, 20, -11, -57, 25, -52, 10, 49,
+  -70, 36, -4, 50, 7, 3, 23, -20, 52, 3, 30, 5, -42, 0, -21, -59,
+  30, -9, -16, 27, 54, -42, 4, 53, -6, 3, 49, 45, -11, 25, -8, 52,
+  -3, 10, -52, -19, 28, 16, 16, -109, 55, -19, 22, -69, -27, 74, -31, 19,
+  -71, -10, 29, -10, 26, 23, 54, 27, -11, -10, 11, 41, -15, 30, -71, -70,
+  -15, -21, -16, -26, 35, -13, 57, -30, -70, 18, -57, 7, -35, -6, 0, -19,
+  93, -9, 19, 24, -25, 26, -37, -21, -53, 3, 36, -25, -11, 40, -37, -3,
+  -9, -13, -109, 50, 23, -25, 14, -19, -95, 15, -36, 33, 16, 35, -6, 50,
+  27, -21, -18, -14, -10, -19, 3, -37, 6, 53, 46, 13, 20, 37, -20, -55,
+  -7, -45, -64, 32, -10, 13, 38, 15, -3, 12, 45, -46, -45, -53, 0, -75,
+  -4, 25, 38, 27, 16, -58, 49, 34, -3, -13, 32, 7, -17, 25, 0, -44,
+  50, 34, -37, -6, -9, -66, 22, -45, -26, 43, 17, 66, -11, 18, -50, 53,
+  -71, -55, -16, -10, -26, 16, 73, -23, -14, -3, -8, 32, 30, 7, -20, -40,
+  30, -21, 36, -32, -42, 21, -4, 28, -24, 51, -68, -57, 38, 36, 32, 13,
+  26, 6, 35, -24, -6, -13, 20, 0, -19, -16, 65, 22, 20, 22, 26, -55,
+  30, -61, -31, 10, -57, 6, 20, -68, -36, -31, -2, -11, -10, 15, -6, 4,
+  17, -12, 10, 30, 19, -18, 14, -66, 6, -45, 16, -11, 24, -16, -15, -26,
+  -40, -21, -38, 15, 38, -17, -14, -59, 22, -2, -22, -13, 13, -41, -41, 8,
+  35, -9, 7, 9, -12, 14, 35, -10, -18, 11, -54, -31, -35, -13, 48, -4,
+  -2, 5, 6, 14, -7, 2, 16, -14, -78, 31, -16, -13, 6, -31, -2, -9,
+  -40, 7, 11, 3, 33, -12, -14, -2, 2, 24, 0, -14, -16, -8, -7, -9,
+  27, -10, -47, -30, 58, -31, -28, -22, -2, 24, -58, -38, -28, -28, 21, 8,
+  8, 2, 32, -7, 39, -61, 44, 0, 18, -15, -16, -13, -2, -10, -10, 11,
+  6, -29, 15, 6, 10, 4, -4, -14, -9, 13, 2, -40, -10, 8, -8, -20,
+  -71, 27, -38, 15, 14, -12, -7, 34, -19, 48, -14, 11, -25, 38, 29, 18,
+  13, 9, 0, 13, -38, 2, -17, 11, 7, -2, -33, -8, -35, -11, 36, 4,
+  5, -11, 2, -11, -30, 23, 29, -19, -27, 2, -12, 4, 12, 23, 8, 0,
+  -28, -24, 36, -14, -24, 48, 10, 14, -31, 4, -22, -26, -20, 5, -34, 4,
+  -3, -10, -31, -55, -2, -1, -58, -12, -21, -57, -41, 0, -14, -5, -32, -29,
+  21, -12, -50, -23, -3, 19, 3, 7, 13, -13, -33, -8, -30, -21, 44, -10,
+  5, -65, 2, -7, 14, -2, -6, 2, 11, -10, 9, -5, 31, -8, -19, -8,
+  -40, -12, 42, -16, -27, 12, 26, 30, -24, 38, 67, 127, 4, 20, -32, -40,
+  14, 35, -6, 15, -35, -21, 48, 5, 19, 17, 39, -57, -81, 3, 95, 13,
+  -3, 0, 15, 43, -71, 6, 14, 7, -64, 4, -88, -10, 53, -9, 0, 19,
+  -65, 34, -59, -120, 48, 21, 38, -52, -39, -19, 94, -24, -35, -18, -69, -72,
+  -45, 32, -25, 34, -57, -26, -6, 46, 2, -72, -49, 50, -26, -13, 30, -36,
+  -68, -10, -46, -23, -5, -9, -21, -34, 17, -24, 22, 16, 36, -11, 34, -20,
+  -5, -7, 38, -6, -25, -2, 8, 33, 68, 9, 25, 30, -38, -4, 15, 12,
+  38, -4, 2, 15, -28, -16, 32, 4, 7, -10, -35, -27, -10, 31, 36, -17,
+  -36, -91, 8, -30, 61, -20, -12, 14, -24, 22, -12, 34, -35, 15, -28, -25,
+  -6, -85, 17, -15, -14, -1, -28, -12, -41, 31, -16, -5, 14, 30, -20, -26,
+  -38, -14, -12, -2, -10, 21, 28, 38, 4, -17, -55, -31, -8, -19, 15, -37,
+  60, -20, -14, 24, -2, 59, 53, -8, -16, -17, -38, 14, -4, -16, 19, -13,
+  -55, -71, -61, 26, 67, 16, 6, 41, 17, -13, -32, 24, -65, 46, 20, 22,
+  28, 37, -4, 58, -56, -6, -25, 15, -31, -12, 6, -11, 24, -48, 5, 35,
+  56, -21, 85, 64, 40, -29, -22, -9, 62, -93, 52, -43, 35, -39, -5, 23,
+  -24, -40, 57, 48, -14, -33, 6, -15, -11, -11, -21, -51, -41, 36, 25, 23,
+  -49, -12, 10, -6, 3, 14, -4, -35, -28, 22, 12, -26, -26, -18, -6, -7,
+  28, 7, 10, -8, 23, -22, 18, 58, 39, 45, -14, -98, 0, -21, 5, -44,
+  -35, -29, 18, 0, 8, 17, 3, -49, -2, -2, -11, -18, 23, -19, -5, 18,
+  11, 7, 7, 22, 28, -2, -24, 0, 57, -11, 23, -47, -37, -10, -4, -6,
+  12, 67, -30, -38, 68, 3, -3, 59, -31, 23, 35, 4, 14, 26, 44, 7,
+  41, 47, 11, -73, 10, 30, -27, 18, 39, -14, -40, -26, 45, -82, -21, -16,
+  74, 3, 51, 31, -22, -14, 8, -24, -29, -44, 20, -2, 48, 3, 71, -56,
+  -78, -13, -23, 6, -3, 10, 30, 8, 0, 39, 14, -5, -6, 45, -17, 12,
+  -40, 57, -36, -44, 19, 0, 0, -24, 7, 13, 59, -11, -31, -52, -29, -55,
+  0, -36, 22, -4, -51, -19, 13, 25, -39, 14, -20, -50, 0, 4, -32, -38,
+  -35, 13, -51, 6, -110, 42, -24, -26, 13, -25, -103, 26, 15, -47, -63, -3,
+  -47, -29, 40, 0, -33, 7, 26, -22, -16, -11, -7, -31, 18, 11, -6, 40,
+  -31, -11, 3, 23, 15, -23, -72, 28, 31, 13, 38, -23, -31, -100, 3, -36,
+  54, 0, 14, -65, -41, 19, 7, -21, -27, 10, -3, -7, 24, -31, -14, 38,
+  0, -18, -34, 15, -22, -42, -12, -11, 19, -19, -76, -31, 4, -47, -41, 20,
+  -70, 91, -73, -63, -17, 31, 60, 64, 30, 41, -10, 8, -21, -49, 25, 58,
+  -6, 25, 27, -64, 10, -12, 17, -95, 51, -20, 50, 19, -11, -41, 12, -78,
+  41, -11, 58, -83, -61, -39, -30, 49, 39, 7, 0, 20, 13, -66, -4, 74,
+  -86, 15, -4, -25, 15, 28, 16, 8, -29, -47, 16, 33, 0, 44, 52, 11,
+  -74, -13, -50, -3, -3, 24, -60, 55, 23, -22, 0, -55, 33, 60, -28, 18,
+  74, 28, 24, 29, -10, -9, -35, 8, 58, -124, -62, -42, -37, -44, 59, -13,
+  45, 65, -28, -33, 58, -84, -40, -56, -39, 21, -77, -73, 16, 54, -25, 74,
+  4, 20, -8, -34, -48, 28, 48, 29, 29, 13, 44, -19, -102, 103, 52, -28,
+  12, 7, -23, -67, -47, -44, -77, 44, 10, 30, 65, 31, 15, 4, -19, 27,
+  -55, 0, 24, -38, 29, -26, 3, -47, 38, 7, 21, -54, 54, 11, 97, 13,
+  29, -76, -8, -15, 85, -6, 23, -67, -6, -55, -6, -46, 8, -4, -32, -80,
+  -8, -3, -55, 3, -4, 25, -96, -5, -80, 53, -64, -29, -55, 3, -4, 6,
+  -31, 3, -33, 3, -17, 7, 13, 3, -30, -25, -17, 5, -39, 83, -11, -64,
+  46, 7, 27, 6, 5, 29, 6, -83, -51, -33, -21, 34, 43, 7, 3, 29,
+  -33, 25, 28, -127, -3, -6, -23, -21, 42, -3, 31, 30, 5, -16, -7, 19,
+  12, -13, -30, -22, -51, -8, 68, 11, 0, 6, -20, -26, 4, -37, 4, -54,
+  4, -16, -23, -13, 37, -10, -47, 3, 16, 25, -3, -24, 69, 53, -30, 24,
+  15, 14, -67, 32, -34, -17, 6, 12, -10, 23, -3, 4, 31, 41, -26, -33,
+  16, -4, -64, 54, -78, 4, -20, -53, -9, 48, 14, 10, 18, -8, -11, -3,
+  -39, 13, 13, -6, -40, -17, -16, 11, 6, -53, -79, 10, -91, 28, -41, -8,
+  -121, 55, 13, 41, -40, 27, 43, 3, -10, 6, 3, -3, 3, -8, 19, 6,
+  15, -11, -63, 23, 73, 17, 46, 24, -45, 94, -32, 61, 26, 66, 21, -42,
+  37, 11, -33, -25, 3, -4, 33, 42, -54, 48, 40, -13, 29, 43, -4, 16,
+  47, -8, -17, 43, -7, 17, 4, -19, 16, -44, -12, -36, -4, 37, 22, -37,
+  -39, -36, -26, 6, -10, -54, 94, -36, -53, -11, -27, -16, -12, 53, -25, 40,
+  13, -45, -32, -22, -62, 3, 21, -42, 51, -24, -47, -4, -52, 35, -25, 10,
+  26, 69, -21, 54, -65, 7, 14, -37, -16, -92, 6, 35, 11, 25, -53, -31,
+  -41, 29, -23, 43, 54, 6, -21, -28, 82, 30, 55, 8, -12, 10, -24, 42,
+  -8, 17, 28, -27, -4, -4, 64, -3, -14, 3, -51, 3, 10, -44, 44, -52,
+  10, 23, 3, 12, -57, 15, 31, 46, -29, -7, 31, -69, -46, 24, 3, 35,
+  -4, 34, 29, -27, 22, 7, -11, 34, -10, -22, 27, 18, -89, -62, -11, -14,
+  -46, -3, -54, 30, 58, -27, -4, 25, 31, 30, -55, -20, 0, -56, 8, 48,
+  25, -31, -32, -13, -36, -22, -5, -6, 56, 9, 72, -47, -35, 4, -21, -23,
+  20, -98, -90, -43, 36, 77, -28, -55, -51, -21, -50, -12, -70, -16, -9, 7,
+  44, 77, -18, 58, -54, 18, -43, -45, -45, 88, -42, 70, -11, -58, -11, 3,
+  -62, -13, 54, -46, -31, -42, -4, -28, -3, -57, -89, 23, 74, 56, -40, -39,
+  -54, -31, -11, 0, -100, 11, -5, 12, -14, 6, -36, -36, 57, 44, -74, 45,
+  -56, 19, 19, -15, 57, 18, 12, 71, -7, -38, 19, -8, -24, -16, -19, 10,
+  -13, -57, -15, -39, 11, 14, -46, -19, 13, -63, 58, 18, -39, -33, -57, -102,
+  17, -3, -41, 13, -109, 0, 13, 3, -7, 87, 42, 18, 0, -40, 107, 12,
+  -38, 118, -18, 24, 50, 4, 45, 47, -7, -18, 36, 17, 10, -28, 50, -55,
+  30, -19, 13, 40, -62, -6, 77, -63, 0, 80, 28, 0, -36, 20, -41, 24,
+  18, -11, -53, -58, 14, -34, 36, 37, -41, 55, 9, -7, 14, 58, 60, -31,
+  33, 11, -5, -49, -78, 12, -81, 54, 27, -20, -76, -15, -8, -36, 40, 48,
+  -25, 55, 28, -78, 21, 61, 0, 76, -31, -21, 87, 67, -16, -8, -47, 39,
+  -13, 87, -19, 25, 21, -89, 18, 46, 58, -55, 6, 49, -36, 24, -16, 31,
+  -18, 34, -97, 35, -43, -5, 18, 64, -32, 40, -27, 11, -28, 4, 26, -61,
+  37, 40, -9, -33, -117, 119, -30, -25, 10, -13, -68, -8, 70, -33, -12, 33,
+  -4, 28, 25, -40, 43, -7, 36, -6, 17, -9, 25, -14, 10, 28, -24, -23,
+  69, -90, 29, -12, 16, 37, -15, -63, -22, 55, 31, 12, -3, 63, -38, -45,
+  -26, -42, 59, -66, 7, 11, -39, 22, -35, 48, -9, -11, 6, -21, 30, -7,
+  46, -5, 5, 23, 19, -18, 0, 3, -24, -70, -51, 38, 47, 36, 59, -36,
+  -25, 14, 14, 30, -53, 29, 64, -12, -24, 50, -54, 20, 41, 76, -26, 58,
+  -13, -26, -16, -50, 114, -18, 6, -13, 47, -48, -25, -16, -12, 20, 16, 48,
+  0, 0, 47, 31, -40, 37, 21, 15, 48, -66, 24, -7, -17, -4, -45, -34,
+  46, -24, -99, -10, 23, -86, 21, -20, -10, 13, -85, -41, -4, 7, -87, 9,
+  100, -80, -11, 67, -21, -87, -127, -15, 49, -12, 58, -11, 38, 36, -3, -10,
+  -52, 11, -39, 15, -62, -21, -28, -29, 33, 0, 34, 0, -27, 55, 28, 17,
+  26, 57, -3, 85, -105, 53, 4, 45, -92, -51, -18, 49, 22, -8, 41, -14,
+  8, 21, 27, -23, -39, 27, 77, -31, 48, 3, 72, -31, -27, 13, -28, 30,
+  0, 3, -25, 44, -39, -14, -9, -3, 7, 68, 69, 3, -13, -84, 15, -13,
+  18, 20, 0, -17, -12, -21, 5, 52, -20, -11, 19, 3, -30, 3, 7, -11,
+  3, -47, -14, 15, -3, -46, 27, -23, -64, 45, 7, -30, 6, -16, 46, 44,
+  -44, 0, -35, -38, 36, -27, 3, 4, -26, 5, -23, -23, -39, -23, 18, 28,
+  35, -21, 35, 36, -19, -8, -42, -7, 16, -11, -14, -6, -12, -18, 2, 10,
+  10, 52, -5, -10, -8, -14, 16, 0, -34, -16, -5, -3, -12, 45, 43, -13,
+  54, 47, -11, 0, -61, 23, 30, 14, -54, 11, -26, 35, 17, -10, -17, -16,
+  -3, -12, 31, -18, 9, -37, 26, -13, -34, -3, -10, -6, -30, 43, 30, -23,
+  -42, 11, -38, 18, -8, -22, -7, 36, 5, 27, -22, -41, 17, 3, 11, -5,
+  -13, 14, 54, -5, -115, 31, -33, -3, 22, 0, 12, 19, 21, -60, 29, -5,
+  -24, 59, -2, -21, 31, -7, -3, 60, -5, 0, -2, -41, -21, -73, -17, 5,
+  3, 6, -17, -3, -9, 2, -13, 9, -8, -31, 19, -16, -3, -33, -15, 9,
+  -80, 3, 5, -39, 22, 33, 28, 27, -3, -32, 8, 45, -81, -31, -27, -20,
+  -3, 20, 5, -33, -56, 21, -5, 48, 42, -24, 36, 3, -7, 21, -34, 21,
+  30, 68, 0, 9, 6, 0, -3, -52, 15, -23, 23, -43, 13, 3, 20, -50,
+  6, 18, 35, 63, 15, 14, 56, -26, 16, -36, 6, -43, -66, -33, -3, -48,
+  -19, -66, 14, -26, 27, -36, 24, 14, -29, 18, 19, 4, -44, -15, 38, 17,
+  -48, -26, 30, 5, 36, 5, -35, 3, 81, 24, 24, 0, -81, -60, 10, -53,
+  47, 35, -43, 33, -39, -19, 35, 52, -39, 59, -19, 27, -24, -19, 69, 34,
+  -127, -29, -48, 73, -9, -59, 3, -32, 3, -51, -23, -29, -45, -76, -49, -16,
+  10, -48, 5, -3, 0, 72, 45, 25, -3, -63, 80, 9, -90, -59, -63, 0,
+  30, 40, -25, -78, 20, -24, -19, 0, -84, 5, -50, 31, -37, 54, -19, 13,
+  71, -79, 5, -24, 25, 7, -19, 23, 22, 25, 12, 38, 32, -38, 20, 0,
+  -3, -8, 0, -5, 15, 52, 29, 4, -37, 38, -32, -23, -27, -20, 12, -32,
+  10, -13, 35, 78, -5, -28, 14, 16, 24, -20, -42, -17, 34, 6, -18, -45,
+  -38, -6, -5, -2, 60, 21, 19, 19, -36, 16, 29, 6, -37, -36, 5, -45,
+  47, -53, -32, 33, -6, -25, 11, 11, 12, 25, -21, -27, 41, -13, 20, -16,
+  -13, -14, -41, -30, -27, -52, -52, -13, -29, -31, -19, 8, -36, -66, -30, 14,
+  67, -5, -14, 26, 5, 3, -3, -59, 19, 18, -50, -11, -51, -65, -50, 40,
+  -13, 14, 0, -7, 83, 38, 35, 26, -31, -19, 7, 28, -26, 36, 43, -53,
+  -3, 24, -9, -47, -11, -19, -68, -37, 27, 23, 2, 3, 36, -73, -67, 5,
+  -3, -12, 38, -5, 12, -23, 3, 19, -39, 3, -19, 8, 27, 13, 39, -71,
+  16, 21, -19, 85, -33, -8, -10, -29, -8, -20, -19, 2, 2, 28, 9, 20,
+  -40, 35, -5, -24, -28, -49, 31, 16, -50, 19, -14, -19, 7, -48, 31, 3,
+  17, 53, -9, -6, -25, -26, 41, 43, -49, 17, 9, -103, -24, -16, -12, -13,
+  29, 18, -41, -35, -21, 23, 52, -6, -13, 0, 0, -33, -12, -36, -9, -12,
+  -19, 35, 5, -13, 19, -14, -3, -41, 13, 0, 53, -11, -17, 12, -50, -15,
+  -2, -26, -2, 21, -38, 2, -11, 9, -27, 13, 15, 4, -8, -12, 18, 4,
+  9, -6, -25, 8, 9, 4, -17, -12, 2, 12, -6, 11, -15, 22, 18, -9,
+  -30, -7, 26, -3, -22, 6, 13, -12, 5, 37, -46, -12, -14, -14, -25, 13,
+  17, -9, -2, 0, 33, -17, -24, 18, -20, -11, -11, -20, -15, -6, -3, -7,
+  9, -12, -8, 19, 3, 2, -10, -7, -13, -9, 7, 11, -11, 10, -11, -9,
+  0, 30, -5, 22, 4, 11, -2, -2, -37, 33, -2, 17, -17, 41, 10, -12,
+  22, -14, 0, -36, -20, 5, 9, -6, 9, -23, -35, 0, -14, 10, 21, 2,
+  20, 22, -6, 2, 7, -4, -7, -2, -7, -6, -6, -10, 7, 15, -2, -12,
+  2, 18, 7, 18, -54, -2, 2, -4, -13, 9, -23, 32, 3, -18, 16, -20,
+  16, -4, 12, 16, -4, -16, -2, 0, -25, 19, 5, -6, 22, -17, 0, 28,
+  6, 17, -5, 10, 0, -11, 7, 24, 5, -7, 9, -1, -45, -10, 14, 13,
+  -28, -24, -2, -11, -6, -9, -21, -15, -15, -8, 0, 7, -7, 10, -11, -2,
+  -14, -33, 13, 36, -54, -11, -51, -31, 6, 4, -5, 45, -19, 39, 5, 0,
+  37, 8, 18, -62, 42, 40, 11, -20, -3, 2, -38, 26, 29, -32, 49, -4,
+  -4, 4, 33, 31, 0, 25, 4, -24, 32, -52, -49, -29, 12, -48, 29, 0,
+  -37, -14, 48, 7, 2, 4, 43, 22, 24, 20, 4, 22, -25, 34, -15, -8,
+  -89, -37, 30, 19, 19, 2, 32, 31, 70, 61, 44, -30, -44, -53, -49, -13,
+  55, 52, -22, 40, -98, -35, 4, 94, -18, 8, -38, 37, -60, 37, 77, -9,
+  -28, -36, -127, 50, 33, -36, -18, 12, -14, 12, -49, -5, 26, -81, -111, 20,
+  37, -18, 24, -23, 4, 57, 54, 9, 40, -26, 26, -22, -53, -105, -52, 22,
+  14, 18, 10, -10, -19, 29, -11, -22, -34, -5, -8, -4, -16, 16, -7, -11,
+  -9, 22, -8, -24, -9, -12, -2, 31, -2, 27, 0, 6, -4, -15, -10, -21,
+  -19, -17, -85, 29, -2, 9, 22, 12, -18, 5, 7, 25, -22, 28, -12, -44,
+  -26, 52, 9, -7, 4, -19, 2, 25, 7, 0, 60, -12, -25, -31, 17, 0,
+  -21, 16, -15, -6, 19, 2, 6, 11, -4, 7, -3, 21, 19, -31, 21, 0,
+  14, 8, 2, 26, 8, -6, 13, -21, -10, 27, -16, 4, 16, -24, 12, -5,
+  6, 7, 21, -10, 4, -3, -51, 3, -12, 5, -11, 0, -16, -10, 10, -16,
+  4, 4, -26, 0, -13, -23, 2, -17, 0, -23, 0, 0, -5, -27, -5, 5,
+  -39, -4, -13, 0, -41, 29, 13, 24, -25, -22, -7, 26, -17, 2, 33, 4,
+  39, 4, -18, -8, -57, -20, -11, -23, -32, 8, 11, 6, 12, -24, -22, 7,
+  4, -7, -5, 12, 26, -20, 27, 12, -16, -33, 9, 5, -2, -54, -31, -8,
+  41, -27, 24, -2, -20, -49, -19, -14, -33, 6, 4, -15, -35, -4, 3, -8,
+  0, -14, -24, -10, -16, -10, 6, -22, -46, -5, -7, 9, -40, 8, 21, 7,
+  57, -24, 3, -8, 34, -55, -24, 23, 0, 12, 35, -4, 6, -11, -26, 44,
+  -48, -24, -42, -15, 2, -6, 0, -25, -5, 30, 24, -1, 24, 24, -2, -34,
+  17, 24, 13, 18, -24, -17, -17, -12, 7, 12, -13, -10, 5, 13, 12, -10,
+  3, -43, 20, 0, 37, -3, 38, -78, -29, -21, -25, -61, -35, 0, -39, 12,
+  -62, -10, -42, 65, 16, 22, 9, 20, 14, -10, -27, 0, 40, 0, -27, -9,
+  -4, -14, 48, -29, -3, 5, -4, -22, 0, 9, 30, 25, 31, -21, 0, 19,
+  -33, -34, 19, 18, 19, -80, 16, -31, -37, -36, -58, 7, 3, 4, 26, -52,
+  -12, -3, -3, 22, -50, -46, 3, -56, 52, -46, -25, 4, 3, 7, 6, -67,
+  -31, -64, 44, -17, 0, -55, -22, -26, 3, -39, 19, -9, 15, -26, 43, 18,
+  -11, -7, 96, -20, -107, 63, -19, 27, 9, 21, -26, -16, -55, 56, -28, -24,
+  74, -31, -53, 36, -63, 16, -52, 60, -25, -5, -58, -27, -3, 4, 44, -32,
+  -12, -80, -23, -19, -37, -35, -5, 26, 16, -9, -28, 47, 13, 31, 55, -31,
+  -31, 7, 47, 7, 26, -31, 13, -53, -8, 16, 16, -72, 20, -15, -20, 57,
+  -37, 59, -68, -58, -17, 39, -19, 20, -36, 53, 22, -32, -110, 21, -32, -27,
+  -66, -3, -22, 48, -16, -22, -60, 0, -40, 16, -51, -7, -23, 25, -3, 14,
+  -75, 33, 6, 5, -5, -43, 16, -19, -29, 40, 3, 29, 8, -97, -33, -126,
+  -66, 14, 0, 0, -54, -14, 3, 73, -8, 75, -51, -84, -17, 59, 60, 9,
+  -40, 14, -4, -23, 52, -11, -102, 77, 60, 24, -15, 18, 21, 26, 4, -3,
+  -59, -31, -19, -21, 6, 48, -4, 18, -3, -31, 22, -25, 0, 0, -26, -37,
+  -67, -40, -31, 11, 37, -57, 98, -74, 26, 12, -42, 105, -27, 3, 97, 18,
+  35, -47, 36, -48, 35, -45, -22, 17, -42, -36, 54, 3, -72, -40, -80, 0,
+  0, 2, -56, 6, -41, 29, 64, -32, -78, 59, -90, 20, -7, 79, -25, -8,
+  -59, 46, -122, -27, -38, 93, -44, 31, 71, -31, 19, -22, 37, 39, -78, -66,
+  -20, -27, 17, 16, -64, 8, 0, -30, 13, 12, -17, 76, 51, 3, 111, 31,
+  -50, 34, -10, 17, 6, -6, -50, -43, 14, -42, 13, -3, 20, 44, 40, -81,
+  15, 64, 48, -9, -121, 16, -4, 5, -39, 18, 45, 25, -52, 67, 25, 11,
+  -7, 43, -22, -63, 0, 13, -48, -3, 6, 39, 48, -2, -42, -14, 26, 14,
+  0, 43, 17, -16, -64, 27, -30, 15, 29, 9, 17, 14, 27, -38, -30, 6,
+  8, -3, -18, -27, -67, -22, -3, 23, 56, 72, -78, -41, 17, -18, 53, 6,
+  -22, 17, -16, 9, 79, 3, -30, -12, 12, -38, -15, 18, -14, 29, 0, 0,
+  -30, -21, 37, -24, 35, -26, -4, -8, 3, -5, 29, -17, 40, -4, 3, -3,
+  20, -110, -63, -22, -23, 30, -49, -71, -19, -31, -19, 43, -11, -73, 80, 9,
+  35, -3, 10, 34, -22, -24, -16, 43, -127, -26, -11, 22, -17, -73, 7, 6,
+  -66, 19, -32, 3, -3, 16, -68, 12, 75, 12, -7, 5, -41, -35, 46, 24,
+  -11, -40, -44, 21, 9, 26, 16, -10, 12, 23, -10, -42, 14, -28, 3, 46,
+  -46, 17, 43, -44, 14, 8, 52, 33, 58, -15, 3, -72, 59, 35, 6, -55,
+  47, 58, -8, -17, -16, 16, -6, 33, 28, 16, 8, 12, 15, -11, 23, 0,
+  44, -47, -24, 12, 34, -58, 19, 40, -33, -6, 7, -16, -41, 29, -11, -3,
+  4, -43, -25, 9, 9, -13, 76, -16, -31, -26, -16, -17, -37, -21, 21, 49,
+  -8, -39, -11, 21, -22, 8, 24, 0, 13, -87, -27, -77, -3, -24, 30, 3,
+  -30, 63, -10, 77, 31, 6, -15, -39, -14, 29, 29, -40, 0, -14, 10, 15,
+  -4, -23, -8, 42, 27, -15, -40, 7, -9, 9, 7, -31, -40, 26, -41, 29,
+  36, -48, 15, -55, 31, -59, -4, -20, -21, -10, 53, -29, -74, 0, -38, -31,
+  -20, 3, -11, 11, -45, -21, -11, -11, -35, 39, 8, 14, 18, -20, 16, -51,
+  8, 17, 23, -17, -12, -30, 0, -26, -6, -32, -5, -6, 10, -43, 23, -70,
+  -54, 9, 8, 45, 0, 5, 96, -5, -53, 14, -40, -15, 10, 26, -17, 23,
+  -4, 18, 18, 15, -9, -19, 31, -18, -15, -5, 22, -14, -6, -14, -8, -31,
+  -28, -75, 3, -40, 4, 26, -19, -18, 19, -24, -24, 39, -31, -14, -8, -66,
+  34, -7, -30, 37, -37, -20, 37, 0, -39, 3, -16, 6, -24, 46, 16, -47,
+  4, 7, 19, 45, -17, 15, 4, 7, -6, -49, -124, -11, -74, -6, 44, -36,
+  32, 3, 6, -32, -46, 25, 8, -8, -18, 13, -3, 5, 33, -3, 3, 6,
+  -11, 29, -17, -37, 0, 0, -3, -29, -60, -3, 11, -35, -45, 7, 0, -9,
+  -8, 7, 43, -27, 6, 26, -6, -6, -30, -25, 26, 12, -34, -11, -16, -15,
+  25, -5, 62, -65, 30, 10, -33, 10, 41, 58, -88, 20, 7, 46, -7, 47,
+  11, -9, -24, -12, 3, -44, 8, 10, -15, 5, -44, 0, -3, 14, -30, -36,
+  0, 29, 3, -16, -27, 29, -58, -36, -47, -57, -38, 91, -55, 30, -3, 42,
+  49, 40, 0, -70, 16, 22, -86, -68, 28, 41, -13, 12, -2, 14, -101, 23,
+  -46, -23, -23, -6, -47, 3, 51, -29, -29, -89, 77, -18, 7, -6, -7, -36,
+  -61, -45, -33, 15, -15, -22, 31, 127, -27, -18, 6, 7, 36, 80, 5, 0,
+  -3, 42, -31, -21, -45, 26, -21, -51, -13, 36, -3, 67, -71, 37, -16, -24,
+  68, -23, 23, 10, -28, -50, 25, 94, -72, 38, -55, -24, -51, 7, 46, -41,
+  -29, -7, -82, 42, 24, -21, -77, -51, 12, 9, -29, -33, -27, 31, -24, 23,
+  -22, 12, 6, 0, 49, -37, -55, -15, 48, -8, 59, -36, -11, -10, -41, -76,
+  -6, 29, 6, -35, 4, 40, -3, 40, -22, 9, 35, 11, -52, 14, -40, -3,
+  45, 7, -33, 13, 0, 0, 6, 45, 36, 22, -34, 12, 19, 18, 10, 3,
+  -93, -37, 16, 37, -7, 36, 26, -10, -18, -9, 7, 20, -3, -11, 20, -3,
+  36, -9, -46, -3, 6, -31, -8, 3, -33, -5, 31, 17, 6, 31, -18, -14,
+  -37, -49, -11, -32, 89, -32, -19, -36, -38, -33, -27, 7, 10, 27, 35, -60,
+  -34, 3, -23, -37, -53, 0, -49, 19, -25, 19, -16, -18, 5, 36, -23, -12,
+  -79, -9, 12, -11, -13, 38, -26, -29, -15, -12, -15, -7, -3, -9, 0, -18,
+  4, 6, -24, 35, -21, 12, 16, -36, 12, 3, 3, -34, 28, 28, -5, -28,
+  6, 3, -11, 29, 13, 11, 5, 47, -41, 54, -94, -11, -50, 37, -32, -45,
+  -8, 23, -25, 3, 12, -22, 15, 23, -30, 44, -60, 6, 22, -54, 49, 9,
+  57, 12, 39, -8, 7, 21, 55, 24, -15, -3, 55, -18, 10, -9, -44, 13,
+  0, 3, 55, 32, -15, -69, -20, -81, -27, 33, 22, 12, -47, 17, 3, -25,
+  30, -6, -21, -2, -36, -28, 5, -47, 33, -17, 13, 26, 6, 0, 23, -22,
+  19, -18, 3, -10, 27, -2, 0, -18, 2, -16, -15, 25, -4, -20, -16, 11,
+  -40, 1, -22, -4, 13, -14, 2, 11, -4, 21, -11, -12, -23, 30, 8, -5,
+  22, -11, -6, -7, -10, -4, -12, 13, 19, -8, 2, -9, -3, 0, -11, 28,
+  21, -16, -16, 17, 31, -5, -8, -31, 33, 2, 2, -15, -5, 6, 2, -19,
+  -2, -8, 14, 27, 23, 12, -8, 18, 14, -10, -23, -9, -22, 18, 26, 11,
+  -2, 4, -29, -16, 23, -3, -27, -24, -22, -14, -9, 5, -29, 28, -44, -14,
+  -16, -7, 55, 9, -25, -12, -22, 16, -24, -2, 23, -19, 14, 15, 8, -21,
+  11, 8, -3, -13, -89, -39, 3, 2, -2, -11, 2, 26, 10, -27, -10, 0,
+  -7, -6, 76, -2, 31, 2, 4, -34, 5, 16, -21, 9, 34, -18, 24, -18,
+  -4, 1, -43, -5, -33, 56, 30, -5, 11, 11, -7, 0, -17, 23, 0, 10,
+  47, -15, 15, 4, -2, 4, 29, 13, -9, -17, -8, 13, 17, 24, 25, -23,
+  25, -12, -22, 8, 14, -28, -3, -36, -25, -7, -3, 31, 29, 0, -10, 11,
+  42, 35, -30, -19, 12, 0, -25, -14, -10, 22, 2, -21, 24, -4, 22, 31,
+  -13, 7, -34, -14, 2, -24, 39, 15, 24, -38, 38, -8, 2, 64, -57, 8,
+  -13, -24, -40, -2, -32, 8, 5, -11, 17, -9, 8, -22, -26, -58, -9, -31,
+  -40, -16, 52, 15, -14, 11, 3, 38, 16, -30, 25, -11, -8, -42, 8, -33,
+  -7, 45, -39, 8, -85, -32, -32, -20, -2, 20, -44, -25, 15, 11, 75, 27,
+  29, 39, -5, -47, -69, 18, -21, 14, 38, -84, 36, 10, -25, -43, -127, -3,
+  -40, -17, 17, -18, -15, 19, -22, 30, 45, -28, 6, 4, -2, -9, -8, 9,
+  -44, -36, -14, 12, -22, -8, -16, -13, -33, 24, -12, -17, -6, -29, 40, -4,
+  2, -41, -47, 27, -14, -36, 11, -22, -14, 0, -41, -25, -43, -35, -4, -18,
+  -18, -11, -41, -42, -21, -2, -57, -12, -31, -18, -18, 8, -31, -4, -49, 6,
+  -29, 26, 19, -18, -59, 0, -39, 0, -2, -9, -17, -1, 12, -86, -17, 23,
+  5, -2, 17, -8, 0, 7, -21, 13, 4, 13, 3, -9, 28, -21, 7, -2,
+  -21, 8, -14, 8, 6, 30, -8, -26, 24, -32, -5, -6, -10, -42, 10, 25,
+  31, 16, 41, -5, -2, -21, 14, -33, 9, 7, -5, 5, 0, 7, 21, 24,
+  4, -15, -9, -27, 4, 37, -29, -6, -24, -19, -31, -18, 3, 17, 3, 19,
+  -23, -18, -9, -3, -31, 38, -8, -40, -6, 17, -7, -28, 26, -29, -20, -69,
+  5, -4, -13, 0, -33, -21, 8, -22, 2, 39, -29, -13, 15, 20, 20, 16,
+  27, -33, -46, -2, -8, -37, 5, -39, 27, -48, -11, -14, -31, -4, 0, -11,
+  60, -72, 32, 43, -25, -21, -36, -8, -15, 32, -15, -54, -20, -30, -19, 42,
+  -7, -14, 19, 41, -28, 20, -3, 20, 20, -22, 3, -9, 11, 15, -10, -4,
+  21, 18, -3, -12, -23, -14, 21, -34, 3, -32, 3, 9, 1, 20, 16, 4,
+  11, -10, 5, -30, -6, 5, -14, -36, 25, -21, 25, -23, -19, -34, 8, 0,
+  -25, -22, -6, -23, 44, 27, 22, 50, 9, 22, -10, -1, -22, -30, 8, -10,
+  -36, -13, 8, 26, -71, 26, 8, -54, -34, -6, -13, 0, -18, -3, 3, -44,
+  -22, -52, 23, 10, 19, -14, -40, -70, -22, -22, -21, 51, -2, 11, -23, 3,
+  -14, -14, -73, 31, 17, 5, -25, 14, 32, 43, -29, -17, 20, 14, -37, 23,
+  18, -6, 57, 23, -15, -40, 12, -35, 6, -25, 3, 26, 3, 3, 30, -6,
+  22, -61, 58, 37, -31, 29, 5, -29, 0, -12, 8, -21, 18, -3, -8, -30,
+  34, -13, -13, 17, 68, 6, 18, -51, -60, -13, 36, 27, 17, 18, -19, 38,
+  -96, -16, -65, 6, 10, -23, -4, 2, 55, -77, -54, -26, -47, -3, -51, -10,
+  39, -21, 18, 9, -18, 28, 43, 23, 30, 8, -59, -21, -22, -62, -23, 11,
+  8, -16, -3, 29, -89, -8, 18, -7, 3, 62, -5, 14, -13, 57, 11, 3,
+  49, -16, -20, 50, 3, -10, -9, -6, -30, 47, -8, -9, 0, 46, -23, -76,
+  -14, -14, -69, -36, -7, -46, 18, -46, 64, -11, -4, 26, 30, 8, -51, -33,
+  11, -38, 15, 43, -55, -15, 16, 13, 9, -30, 0, 10, -25, -3, 15, -3,
+  -11, -32, 33, 0, -18, -3, 39, 43, -50, 3, -27, -42, 16, -17, -61, 30,
+  11, -7, 0, -10, 12, -28, -24, 0, -5, -47, -10, -42, 26, 42, 0, -32,
+  28, -39, -31, 20, -7, 20, 29, -7, 20, 0, -4, 7, 13, -31, 64, -3,
+  -7, 15, 24, 29, 9, 19, 39, -45, 57, -5, 3, -14, 14, -14, 5, -19,
+  -6, -3, -91, -8, -80, -63, 3, 83, -6, 77, -32, 42, 29, 44, -29, -9,
+  97, -82, 33, -10, 0, -22, -76, 22, 41, -85, 54, 57, 2, 35, 19, -17,
+  7, -39, -27, 39, 0, -43, -33, 10, -35, 26, 7, -30, -3, -62, 0, -10,
+  -7, -59, -69, 37, 0, -62, -62, -23, 42, -8, -3, -45, -19, -127, 53, 0,
+  31, -10, -3, 13, -106, -37, -26, -50, 25, 33, -8, 24, -10, -57, -5, 6,
+  30, -20, 25, -40, -46, -14, -3, -29, -19, -35, 10, 24, 0, -35, 10, -6,
+  7, -48, 23, 22, -53, -43, 36, 0, 38, -57, 58, 4, -57, 40, 3, -13,
+  14, -38, 27, 66, 9, -28, -39, -3, 24, 10, -46, -10, 33, 14, 23, -33,
+  -34, -58, 6, -26, -58, 10, -5, 18, -97, -18, -29, -3, 13, 3, 13, -18,
+  -52, -16, -5, -17, -40, 4, 6, -3, 0, 6, -31, -27, -2, 0, -68, -41,
+  14, 11, -8, -6, 60, 33, 4, -14, 3, -40, -80, 20, 10, 0, 34, -36,
+  43, -9, 63, -6, -36, 9, 16, 58, -18, -48, -71, 26, 8, 55, 10, 25,
+  64, -16, -47, -26, 71, -26, -8, -32, -65, 6, -53, 94, -42, 67, 59, 18,
+  41, -82, -13, 17, -31, 43, -15, -35, 25, -28, -16, 21, -14, 7, -45, -26,
+  -4, 23, 15, 17, 0, 36, -120, 14, 15, -103, 29, 20, -37, 76, 68, -15,
+  -11, 41, 42, -23, -18, -28, -54, -5, -66, 25, -46, -12, 25, 24, 30, 33,
+  -34, 0, 6, -56, -18, 3, 3, 0, 9, -3, 3, 63, 3, -30, 16, 15,
+  52, -88, 5, -7, 12, 8, 9, 45, 57, 9, 21, 3, -21, -18, -84, -26,
+  18, -25, -108, -42, 27, 3, 80, 19, -3, 54, -25, -13, 30, 14, -34, 3,
+  14, 18, -81, -49, -21, -28, 12, 20, -24, 0, 6, -12, -44, 58, 0, -22,
+  -21, 48, 26, -10, -46, -20, 10, 7, 41, 31, -13, -33, 12, -13, -28, 3,
+  -32, -18, -21, 16, -17, -20, 0, -3, -31, 35, -7, 3, -4, -30, 33, 16,
+  -27, -13, 40, -32, 3, 31, 17, -25, -27, -5, 24, -4, 34, 13, -16, 2,
+  -64, -11, 17, -11, 14, -17, -36, -33, -3, 17, -17, -2, -38, 42, -7, -5,
+  24, -21, -18, -22, -96, 5, -54, -27, -3, -14, 3, -39, -22, -57, -30, 28,
+  21, -55, 43, -59, 23, -2, -46, 27, -26, 12, 44, 65, -2, 37, 15, -36,
+  -76, -2, -14, -42, -41, 29, -17, 16, 38, 21, -41, 8, -31, 0, 13, 27,
+  -87, -17, 8, -57, -29, 64, 33, -21, 17, -19, -55, 36, -15, -13, 7, 16,
+  24, 3, 39, 0, -50, -5, 17, -54, 35, -28, -35, 33, -2, -6, -33, 31,
+  -32, -25, 33, 6, 26, -7, 3, 36, -28, 47, 27, -17, 7, 53, 3, -55,
+  -13, -49, -25, 13, 44, -19, 41, 34, 36, 19, 41, -53, -63, -51, 60, -12,
+  3, -14, -8, -5, 23, 20, 4, 14, 39, 38, -41, 34, 59, -55, 0, 34,
+  13, 33, 3, 10, -71, -25, 39, -74, -29, 17, -5, -43, 7, 22, -28, 31,
+  -84, 43, -19, 6, -6, 13, 54, 12, -5, -3, 0, 6, -34, -17, -15, -22,
+  30, 13, -47, -8, -19, 0, -3, -7, -8, -11, 31, 8, -41, 16, 32, 22,
+  13, -31, 0, -19, -23, 15, 33, 17, -11, -7, -3, -18, 10, -16, 7, 5,
+  -82, -24, -78, 30, 4, 15, -37, 0, 21, 31, -43, -3, -17, -32, 55, 25,
+  -18, -15, 9, -16, -6, -15, -20, -45, -33, -35, 34, -6, -27, -66, -48, -55,
+  -17, 41, 90, 45, -69, 21, -24, 32, 38, -32, 37, -6, -16, -13, -127, 17,
+  -3, 14, 3, -57, -31, 76, 40, 54, 8, 21, 9, 63, -28, 19, 47, 0,
+  16, -61, -52, 42, -42, 12, -27, 0, -97, -8, -38, 23, -27, -9, 25, 17,
+  0, 0, 28, 22, 35, -6, 14, 60, -44, 21, 71, -28, 2, 10, 0, 25,
+  -90, 11, -7, -42, -19, 26, -3, 32, 3, 11, 31, 16, -53, 32, 0, -10,
+  -47, 36, 6, -11, -31, -35, -29, -40, 8, 64, -3, -9, 46, 35, 17, -8,
+  -21, 6, 31, -27, -17, 57, 10, -44, 12, -25, 13, 16, 0, 0, 20, -8,
+  -18, 3, 31, 25, -23, -13, 29, 42, -10, -12, -12, 3, 25, 0, -15, -27,
+  -23, 13, -7, -16, -9, 21, 10, -48, -27, 5, -3, 39, 72, 27, 16, 0,
+  -27, -17, -37, -27, -6, 15, -11, 14, 11, -19, 26, -38, 18, 16, -14, -55,
+  11, 3, 18, -67, -54, -39, -20, -57, -9, 36, 8, 10, -24, 6, 5, -83,
+  35, -98, 43, -31, -17, -13, -40, 3, -46, -53, 0, 31, -11, 33, 15, -60,
+  43, 11, -65, -53, 0, 26, -51, 25, -33, 38, -48, -22, 16, -21, 54, 17,
+  50, -11, -82, -57, -37, 52, 4, -7, -3, -40, 23, -29, -13, 10, 2, -29,
+  53, -39, 0, 32, 8, 42, 2, -54, 29, 25, -13, -20, -5, 16, 3, 70,
+  -21, -25, -17, -12, 35, -7, -37, -6, 15, 56, 29, -6, 20, 66, -15, 46,
+  -17, 19, -51, -26, 44, -41, -27, 23, 27, 21, 17, 41, 22, -37, 83, -27,
+  -33, 22, 14, 22, 37, -15, 7, -17, 17, 28, 12, -29, 23, -35, 35, -10,
+  -13, -38, -10, 26, 40, -5, -40, -39, 0, 19, 19, -16, -64, -49, 19, -35,
+  31, -45, 9, -24, 6, -27, 41, -17, -64, 29, -24, -16, 26, 3, -32, 24,
+  -42, -46, -21, 15, -15, -9, -7, 2, -26, 10, -26, -45, 42, -15, 0, 14,
+  -16, 11, -36, -8, 0, 31, -7, 7, 30, -7, 11, 2, -30, -9, -9, 15,
+  -33, 9, -30, -38, 76, -17, -31, -23, 14, 16, 12, -44, -38, 15, -29, -8,
+  27, -59, 2, -33, -34, -27, 39, 26, -42, 14, -21, 8, -48, -29, -29, -32,
+  6, -33, -24, 25, -15, 23, -46, -7, 11, 23, 10, -49, 18, -62, -9, 19,
+  -3, 16, 0, 3, -17, -20, 39, -14, 5, -16, -3, 37, -17, -28, -27, -3,
+  -48, 20, 2, -50, 36, -24, -38, -29, -6, 13, -10, 16, -12, -18, 7, -21,
+  85, -15, 7, -27, 3, -14, -14, 12, -30, -20, 19, 0, 6, 45, -12, -24,
+  3, -37, -17, 13, 27, -21, 17, 15, 37, -36, 39, -22, 6, -5, 43, -2,
+  29, -21, 14, 0, -36, 14, -4, 25, 35, -5, 11, -43, -52, 34, 7, -30,
+  25, -12, -20, -26, 44, -12, -7, 0, 6, -16, -46, 28, -31, 0, 41, -5,
+  31, 59, 21, 57, -36, -18, -6, -29, -40, -9, 59, 22, -26, -32, 18, 0,
+  -13, 19, -52, -36, -33, 16, -10, 0, -48, -60, 26, -34, 3, -13, 3, 19,
+  -16, -16, -11, 0, -25, -20, -18, -7, -19, -11, 45, 13, 25, 3, 27, -13,
+  -5, -3, -37, 19, -20, -12, -45, -33, -65, 8, 29, -6, -28, -18, 10, 40,
+  37, -12, 9, 33, -17, 9, 30, -6, -30, 9, -19, 46, -17, -64, -29, 11,
+  6, -25, -80, -5, 48, -16, -33, 11, -11, -127, 112, 14, -21, -10, -64, -5,
+  87, -59, 33, 10, 6, -45, -18, 11, 14, -11, -42, 22, -72, 9, 50, 10,
+  20, -26, 60, 10, 28, 55, -29, 42, -11, -3, -7, 35, -2, -52, -5, -5,
+  71, 48, -39, -24, -53, -45, -14, 81, 10, 31, -7, -74, -54, -45, 47, 61,
+  29, 12, -35, -10, -18, -21, -26, 11, 37, -18, -33, -22, -15, 18, 34, 19,
+  -52, 8, -41, -60, -11, 11, 25, 32, -62, 39, 39, 35, -17, 16, -23, 15,
+  20, -47, -40, -5, -52, -26, -19, 55, 23, -8, -39, 19, 2, 15, -7, 8,
+  24, -18, -27, -9, 0, 12, -25, -32, 15, -54, 24, 11, 43, 26, -6, -24,
+  -48, 8, 49, -59, 51, 12, 33, 0, 24, 39, 49, -14, -24, -3, -21, -2,
+  26, 24, -60, 3, -14, -34, -21, 30, -49, 41, -20, 15, 7, 9, -2, 0,
+  20, 23, 45, -26, -44, -17, 0, -13, 11, 97, -5, -54, 14, -82, -68, -110,
+  -65, -15, 2, -93, 14, 14, 52, -38, -96, 23, -24, 3, 2, 13, -3, -26,
+  13, -21, 52, -61, -51, 16, 0, -9, 45, 41, 13, -22, -57, -39, -6, 9,
+  55, -43, -66, -58, 33, 36, 35, 16, 16, -37, 87, -41, 2, 37, 9, 8,
+  -41, 20, -32, -17, 16, 14, 26, 49, 6, -62, 5, -70, -40, -24, -22, 11,
+  -34, -92, 16, -36, 20, -21, -61, -29, -22, -23, 2, 57, 28, 83, 0, 16,
+  -19, 2, 31, 23, 0, -9, 40, -39, -61, -16, -20, -8, 82, -62, -18, 7,
+  10, 54, 52, -8, 6, -14, 11, -14, 35, -5, 51, -30, 32, 28, 30, -68,
+  16, -10, 2, 26, -61, 42, -8, -6, 3, -2, -34, 50, -17, 8, -37, -24,
+  15, 45, 26, -35, -2, -14, -46, 21, 13, 28, -44, 5, 4, -51, 5, -28,
+  28, -29, -22, 11, 56, 14, -44, 6, 26, 0, 12, 17, -3, -7, -30, -31,
+  26, -17, 17, -14, 5, -20, 78, 0, -14, -10, 5, -10, 24, 6, 8, 2,
+  -20, -31, -18, -28, -46, -8, 4, 20, -3, -29, -24, 20, -6, -27, -4, 29,
+  21, 21, 8, 29, 42, 0, 5, -21, -66, 18, -23, 39, -15, -14, -3, -12,
+  20, -13, -43, -14, 11, 8, -6, 17, 40, -9, -38, -51, 29, -68, -22, 0,
+  32, 0, 24, -5, -24, -17, -22, 20, -14, -8, -17, 2, -24, -33, 2, 18,
+  -32, 39, 2, 43, -36, 17, 30, -35, -18, -12, -6, 28, -10, -11, 26, 7,
+  66, 21, 8, 11, 22, -11, 22, -28, -2, 5, -21, 0, 10, 17, 0, -7,
+  -14, 0, 6, -16, 19, 4, 3, 10, -12, 2, 15, 17, -27, -7, -30, -41,
+  -14, 26, 58, 5, -2, -27, 19, 16, 17, -8, 22, -2, 42, -14, 12, 2,
+  7, -36, -60, -9, -61, 2, -38, 3, -53, -24, 28, -14, 17, -35, -30, -19,
+  -3, -11, 2, -37, 32, 27, 22, -23, -4, 33, -38, -19, 40, 9, 13, 2,
+  9, 4, 62, -2, 11, 2, 9, -2, 0, -32, -52, -24, 32, -9, 0, 33,
+  0, -14, 15, -14, -5, -52, 41, -30, 5, -2, -35, -33, -20, 30, -28, -31,
+  -41, -21, -2, 49, -114, 44, 65, 43, 15, -5, -62, 0, 25, -51, -28, -36,
+  57, 42, -49, -5, 22, -11, 46, -28, -66, 20, -75, -39, 52, 20, -29, 16,
+  26, -5, -127, -29, -32, -10, -67, 31, 73, -21, 6, -28, -19, -16, -71, 21,
+  -26, -24, -61, -46, -71, 17, -6, 20, -2, -28, -15, 61, -39, -61, 4, 69,
+  7, 10, 15, 19, -18, -34, 27, 0, 13, -64, 24, 17, -10, -3, 32, -17,
+  9, 18, -4, -45, -10, 27, -34, -3, -48, -56, 40, -48, 50, -17, -29, -5,
+  6, 22, 12, 41, -37, 10, -29, 8, 7, -44, 20, 19, -40, -2, -35, -4,
+  -3, -74, -63, 14, 42, 32, -16, 16, -48, 14, -12, 10, -7, 47, -24, 7,
+  -29, 0, 0, 9, -18, -4, -4, 6, 10, 29, 13, -28, 13, -35, 11, -50,
+  -45, -11, 16, -29, -35, 11, 42, 8, -33, -23, -27, -34, -27, -3, 57, -26,
+  60, 18, 62, 2, 16, 8, -59, 12, 12, -9, -15, 2, -24, -16, 24, -21,
+  -26, -7, 46, -16, 7, -40, 9, 0, -2, 30, 30, 2, 4, 11, 6, 13,
+  9, 39, 27, -32, 25, -19, 11, 23, -63, -12, 67, -34, -31, -3, 17, 43,
+  87, 0, -16, 77, 30, -36, 42, 18, 0, 10, -48, 29, -29, 23, 5, -5,
+  -80, 0, -19, 25, 11, -72, 97, -39, -89, 28, -70, -17, -21, 34, -87, 25,
+  26, -121, -51, 23, 10, -35, -56, -38, 26, -18, 20, -27, 7, 14, -28, -18,
+  2, -88, -58, -15, -43, -44, -48, -89, 50, 7, -58, 104, -40, 27, 37, -88,
+  51, -8, 59, -19, -70, 3, -34, -39, -2, -23, -52, 34, 15, -3, 49, -23,
+  28, 13, 22, -36, -19, -16, -3, 43, 103, -85, -12, -49, -64, 30, -41, -14,
+  37, -79, -19, 32, -34, 55, 47, -16, -53, -2, -55, -4, 4, -44, -16, -11,
+  2, -22, 26, 2, 23, 30, 7, -12, 8, -18, 21, 6, -45, -15, 14, -23,
+  -39, 17, 22, -6, 19, -2, -45, 11, -12, 8, 25, -5, 12, -46, 22, 3,
+  -3, -32, -94, -2, 32, -15, 44, 8, -35, 30, 16, 8, -17, 5, -50, -13,
+  -46, 49, -16, -28, 0, 11, 20, 31, -23, 28, -48, 19, 2, -6, 7, -10,
+  -10, -3, -45, -32, 50, 23, 11, -72, -49, 8, 28, 33, 0, 41, 26, -51,
+  -68, 11, -33, -37, -30, -3, 13, 28, -14, 44, 0, 26, -21, 49, -53, -18,
+  -40, -6, -17, -5, -20, 9, -54, -8, 13, 15, -57, 15, 6, 30, -29, -38,
+  -19, 13, 8, 13, -45, -38, 20, 11, -47, 0, -19, -12, 17, -12, 15, -5,
+  -2, -31, 31, -7, 27, -41, -46, 16, -5, 0, 21, 24, 5, -3, 5, 31,
+  -42, 17, -28, -46, 27, 0, -16, 31, -7, -49, 16, 3, 44, -9, -28, -10,
+  -15, 28, -40, 22, 26, -11, -6, -10, 15, -35, -13, 11, -35, -39, -50, 9,
+  0, 26, -24, -25, -8, 0, 10, 22, -31, -13, -38, -6, -47, -78, 7, 41,
+  -54, -34, -55, -7, 8, 0, -16, -47, 5, -23, -16, 0, -16, -12, 5, 5,
+  -26, 34, 11, 9, -30, -44, -18, 11, -2, 46, 32, -13, 31, -22, 17, -10,
+  -12, -8, 7, -5, -29, 9, -25, 21, 43, -32, -6, 6, 9, -64, -24, 29,
+  22, 10, -21, -3, 29, -11, -34, -22, -23, 13, 11, 8, 19, 51, 2, -39,
+  19, -59, -14, -76, 127, -91, 77, -22, -27, -51, -56, 33, 45, -15, 49, -3,
+  0, -74, 31, -11, 30, 12, 77, -11, 38, -22, -23, -29, 6, -6, -78, -20,
+  15, 14, 13, -22, 9, 44, 13, -46, -68, 65, -72, -15, -6, 98, 6, 27,
+  0, 3, 52, 23, -87, 0, -20, -31, -13, 48, -59, -52, 24, 39, 11, -27,
+  7, 59, 0, -37, 54, 20, -30, -9, -68, 23, 0, 3, 7, 12, -33, -39,
+  20, -37, -4, 20, -32, 9, 24, 25, -5, 25, -27, 10, -10, -3, 6, -15,
+  0, -4, 20, -7, 0, 35, 0, -2, -38, -12, -41, 0, -52, 2, -29, 51,
+  -46, 21, 3, -40, 5, 24, 17, -4, -10, -9, 35, -15, -19, 30, 31, 48,
+  -12, -14, -29, 7, 19, 20, -14, -31, -35, 3, -37, -27, -16, -102, 0, -26,
+  -16, -57, -20, 9, -32, -26, -29, 6, -19, -14, 2, 26, -6, -34, -11, -3,
+  9, -14, -27, -19, -17, 7, -9, 27, -5, -15, -28, -19, 29, 10, 29, -25,
+  -37, -31, 13, 5, -24, -11, -7, 31, 3, -39, 0, -2, 14, -18, 22, -24,
+  -2, -28, 31, 21, -38, 0, 7, -31, -19, -28, 30, -6, 23, 20, 5, -18,
+  26, -26, 7, -26, 40, 12, -24, -17, -31, -16, -32, -21, 33, -49, 22, 13,
+  34, -44, -64, 17, -20, -20, -9, -25, -3, 20, -28, -57, -6, 2, -68, -25,
+  53, 18, -24, -13, -26, 56, -20, 0, -34, -17, -83, -31, -81, -12, -42, 5,
+  -17, -56, -14, -37, 112, -32, 0, 31, -41, -36, 16, -27, -36, -90, -21, -41,
+  39, -43, -2, -6, -11, 46, -55, 14, 2, -25, -18, 3, -31, -12, 14, -48,
+  25, -26, 27, 29, -3, -2, -16, -10, 13, -17, -19, -38, 0, 22, -9, 16,
+  12, -3, -24, 13, 34, -48, -44, 0, 47, 4, 21, -37, -47, 18, -37, -7,
+  -2, -28, -19, -19, -4, -14, -2, -3, -41, -13, -26, 25, -23, 0, -12, 37,
+  36, 52, -2, -23, -11, -10, 0, 14, 46, 30, 2, -5, 6, -16, -17, 49,
+  -12, -12, -10, 25, 53, -7, 13, -4, 33, -5, -35, 6, 35, -40, -39, -18,
+  -57, 29, 45, -5, 11, -46, 51, 20, 3, 7, -3, -8, 10, -48, 0, 10,
+  -15, 6, -19, 0, 59, -25, 7, 44, 47, 13, -42, 52, 14, 15, -14, -16,
+  40, 32, 13, 23, 5, -7, -19, -34, -2, -14, 14, -11, 17, 34, 11, 31,
+  -6, 16, 78, -2, 23, 9, 48, 8, 56, 13, 51, -23, 35, -82, 71, 0,
+  41, 8, 13, 20, -40, -27, 3, -11, 0, -20, 52, 11, 5, -48, 31, -17,
+  -12, 11, -2, 5, -4, -16, -23, -92, -14, 8, 14, 34, -2, -6, -38, -13,
+  -50, 14, 9, 9, 14, -33, 62, 6, 14, -33, -73, -3, -42, -25, 3, 3,
+  -16, 14, -37, -22, -15, 7, -19, -25, 0, 20, 16, -21, 29, -25, -3, -23,
+  3, -8, 37, 18, 48, -52, -65, -22, 29, -4, -22, 23, -22, -73, 0, -15,
+  62, -14, -15, 7, 4, 12, -16, -44, -19, -3, 0, -3, -21, -21, 5, -18,
+  3, 17, -42, -52, 5, -35, 13, 42, -36, 53, 0, 3, -36, -31, 20, 28,
+  31, -38, -31, -12, -32, 22, -39, 25, -28, 13, -45, -25, 26, 2, 63, -20,
+  -19, 3, -56, -48, -13, 8, -24, -9, -32, 2, 41, 48, -12, 76, -18, -42,
+  -17, -11, -15, 21, 0, -5, 2, 32, 30, 0, 2, 80, 43, -27, -16, -10,
+  -3, 6, -31, 20, -25, 0, -27, -87, -5, -19, 9, 16, -19, 59, -11, -15,
+  9, -16, 14, -15, 6, 13, -19, -34, 61, 23, -48, -25, -32, 15, 66, -34,
+  6, -47, 8, -28, -32, 46, 14, 9, -18, 16, -19, 25, -10, -76, -2, 42,
+  10, 57, 19, 23, 27, -37, -39, 6, -63, 3, 64, -49, 25, -21, 2, 5,
+  20, 0, -11, -35, -33, -16, 8, 6, 24, -22, -18, -42, -23, 47, 17, 46,
+  6, 32, -3, -2, 6, -18, 32, -11, 3, -23, 10, -57, 23, 0, 12, -2,
+  22, -21, 16, -66, -13, 14, 24, -38, -32, 7, -30, 2, -50, -45, 13, 27,
+  -17, -23, -19, -56, 8, -5, -42, 13, -19, 42, -5, -6, 23, 53, -9, 0,
+  -83, -78, -31, 3, -16, 17, -5, 34, 7, -11, 2, 72, 15, -53, -20, 8,
+  31, 2, 98, -12, -47, 40, 19, 4, -31, 23, -83, -29, 79, 5, -27, -2,
+  50, -13, 27, 46, 16, 0, 20, 4, -21, 13, 16, -11, 55, 48, 27, -24,
+  -15, -14, -65, -12, 98, 18, -7, 0, -41, 16, -49, 37, -2, 9, 16, 21,
+  40, -14, -44, -6, 27, 17, 59, 11, -2, 39, -41, -53, 19, 25, -31, 26,
+  37, -26, -7, 30, 9, -56, 29, -57, -13, -35, -35, -29, 41, -7, -39, -41,
+  -3, -39, 72, 79, -43, -60, 89, 27, -53, 13, 16, -23, -19, -6, -58, 29,
+  -84, 40, 48, -5, 51, -32, 39, -13, 19, 31, 7, 12, -5, -27, 40, -23,
+  3, -3, -7, 29, -46, 5, 24, -37, 7, -36, -5, 3, -32, 9, 0, 26,
+  -16, 22, 51, 10, 9, -43, -6, -11, -5, 30, 10, 13, -73, -10, -57, -9,
+  -6, -44, 24, 43, 16, -5, -55, 33, 66, -40, -16, -13, 5, -127, -7, -29,
+  12, -2, -22, 61, -6, -6, 8, -5, 4, -9, -13, 5, 6, 2, -4, 11,
+  3, 16, 16, 21, 20, -25, 7, -21, -4, -41, 11, -17, -41, -13, -2, -10,
+  -38, 36, -19, -18, -43, -22, 24, 23, -44, -4, 49, 6, 14, -30, -2, 22,
+  -20, 19, -39, 10, 46, -33, 0, 14, 11, 33, 40, 33, -14, -10, -13, -10,
+  12, 19, -22, -4, 25, -23, 6, -44, 0, -17, 4, -18, 7, 22, -29, 2,
+  -48, 2, -2, 43, -18, 32, 0, 2, 6, -2, -20, 76, -10, -38, 14, -13,
+  -33, 20, 0, -32, 38, -2, -26, -3, -15, 4, 39, 9, 19, 30, -39, -13,
+  -15, -6, -41, -4, 24, -11, -3, 42, 21, -11, 2, 2, 12, 2, 27, -2,
+  0, -7, -26, 10, 6, -8, -8, -28, 16, -17, -2, 10, 17, 24, -4, 17,
+  -11, -7, 5, 7, 20, -10, 7, 50, -18, -59, 0, 32, -19, -48, -23, 15,
+  -71, 21, 33, -32, -5, 5, -26, 10, -42, -25, -44, 20, 17, 12, 0, 17,
+  -3, 19, -24, 0, 24, 2, -25, 13, -32, 20, 24, -15, 31, -37, 16, -18,
+  30, -5, -36, 11, -35, -15, -21, 10, -16, -21, -2, 20, 28, -26, -8, 19,
+  0, 9, 4, -33, 24, 18, -7, -25, 23, -27, -17, 41, 15, -13, -51, 23,
+  -48, -3, -14, 6, 14, 7, 18, 3, 21, -25, -23, -3, -36, -12, -7, -46,
+  -18, -49, 6, -2, -15, -51, 25, 5, -2, -51, -22, 7, 18, -20, 23, -6,
+  -8, -19, 14, 4, 6, -19, 9, -21, -20, 9, -21, 3, 26, 24, -8, -26,
+  11, -16, -16, 12, -24, 16, -35, -44, -18, -54, 9, 54, 0, 18, -25, 4,
+  -127, -23, -30, 20, 2, -22, 39, -40, -46, 6, 18, -11, 19, -22, -22, -6,
+  -36, -17, -28, -31, 9, 7, 36, -36, -13, -7, -2, 2, 25, -12, 0, -70,
+  14, 9, 26, 23, 13, -6, -23, -28, 4, -17, 2, 45, -6, 34, -23, 13,
+  48, -7, 7, 17, -40, -35, -20, -32, -22, -29, 2, 39, -9, 81, 23, 0,
+  -25, -59, -41, -24, -31, -4, 42, 5, -8, -37, -34, -20, -26, -33, 34, 13,
+  5, 6, 17, -21, -2, 18, -6, 16, 0, 25, 16, 17, -16, -12, 34, 20,
+  -4, 12, -12, -11, -57, -8, -6, 8, -7, -4, -21, 35, 0, -19, -19, 2,
+  35, -33, 9, -52, 40, -11, -7, 11, 29, 34, 41, 11, 12, 28, -32, 13,
+  0, 20, 14, -32, 24, 9, -10, 35, -33, 29, 21, 3, 22, 20, -34, -6,
+  -33, 38, -4, 0, -9, 9, -25, -18, -11, -27, 7, 2, -27, -5, 4, -22,
+  34, -37, -41, -23, -29, -28, 19, -49, -20, -51, -25, 3, -20, 19, 21, 34,
+  0, -54, 36, -21, 18, -13, -13, 9, -35, 11, 37, 37, 2, -20, -37, 13,
+  -71, -13, -22, -18, -33, 20, -50, -36, -13, -4, 3, 0, -10, 18, 10, -31,
+  -18, 32, -45, 8, -22, 18, -28, -20, 13, 14, -18, -10, 16, -17, -7, -8,
+  -85, -16, -16, 15, -22, 0, -19, 0, 45, -30, -23, -5, -7, 19, 36, 30,
+  5, 28, 33, -19, -47, -7, -17, -7, -35, -20, -13, -35, -22, -8, 42, -15,
+  -5, -10, -14, -38, -38, 24, -3, 31, -25, -23, -5, -2, -14, -14, -24, 7,
+  5, -23, -30, 14, 26, 11, -6, 13, 15, 18, 22, 7, 20, -5, -14, 24,
+  -2, 17, 34, -2, -7, 20, 16, -42, 19, 50, 25, -27, -42, 5, -35, 25,
+  -20, -20, 55, 26, 29, 0, 9, 27, -40, -29, 8, 2, -17, -8, -10, -16,
+  -16, 5, -60, -24, 0, 10, -6, -13, 5, 11, 3, -32, -28, -24, -55, 12,
+  -3, 0, -26, -13, 35, 24, 3, 25, 9, -18, -36, 11, -2, -27, 27, 34,
+  -17, -10, 34, 8, 7, -10, 45, 14, 22, -16, -2, 8, 6, -42, -4, 30,
+  -73, -38, 55, -15, 38, -23, -5, 2, 17, -12, 8, -9, -31, -30, -65, -47,
+  27, -34, 12, 24, -3, 4, -31, 11, -32, 44, -109, 8, -44, -7, 16, -10,
+  41, -2, 21, 2, 14, 17, -27, 8, 46, -6, -7, -30, -8, -16, -18, -2,
+  11, -67, -11, -4, 10, -28, -28, 22, 17, 16, 8, -5, -40, -26, 21, -2,
+  -35, 5, 33, -51, 38, -2, 21, -37, -11, -10, 12, -37, 20, -25, -20, 9,
+  41, 11, -15, 22, -3, 28, 40, 22, -16, 11, 8, -5, -15, -37, -8, -32,
+  50, 28, -2, -7, -5, 26, -12, 16, 23, 10, -10, -20, -51, 11, 2, 34,
+  -39, 27, -4, -14, 17, -18, -14, 56, -17, 14, -2, -8, -6, -8, 19, -53,
+  3, -33, 33, 13, 10, 0, 26, 0, 8, -10, -32, -7, 7, 8, 17, 47,
+  3, 53, 0, -4, 26, 20, -3, 22, 20, 33, 28, 10, -5, 22, 26, -18,
+  3, 14, -19, 22, -33, 10, -36, 2, 28, -18, 12, 0, 2, 24, 27, 4,
+  -26, -47, -21, -39, -51, -8, 49, -64, -94, 11, -75, 43, 34, -5, 4, 0,
+  -67, -15, 12, 15, 79, -47, -26, 27, -23, -37, 56, -2, 2, 33, 15, -18,
+  -16, 32, 18, -20, -36, -4, -6, -78, -106, 49, 8, 39, 39, 86, 34, 10,
+  17, -55, -9, -40, -24, -10, 27, -29, -19, -19, -69, -39, 13, 45, -4, -127,
+  20, 37, 13, -2, -58, -28, 35, 19, -51, -28, -35, 27, 34, -26, 54, -28,
+  0, -20, -25, -31, 34, -12, -9, -50, 32, -68, 0, -23, 18, 14, -2, -38,
+  3, 9, 36, -13, -10, -2, -6, 11, 0, 0, -31, 37, -34, 13, -24, 2,
+  44, -39, -28, 31, -24, -34, -63, -45, 2, 6, -10, -6, 4, 3, 25, -34,
+  22, 5, -15, -8, -7, 6, -6, -25, 0, 18, -2, -22, 2, -47, -14, 16,
+  -9, -43, 58, 0, 7, -30, 35, 52, -8, -32, -24, -42, 6, 14, 12, -36,
+  -30, -28, -54, -13, -10, 0, 40, -13, 18, 24, -45, -12, -28, 29, -29, -14,
+  8, 0, -7, 18, -7, 31, 9, -18, 19, 0, 22, -24, 32, -16, 8, 4,
+  0, -60, -26, -25, -27, 51, -4, -14, -68, -14, -23, -5, 8, 23, 27, -39,
+  44, 10, -6, 3, -10, -9, -9, 10, -49, -39, 16, 0, -39, -74, 37, -43,
+  11, -11, -63, -13, 26, 30, -62, -50, 7, -11, -17, 17, -46, 15, 13, 38,
+  -8, 7, -51, 0, 24, 7, 39, -37, 12, -49, 2, -4, 0, -3, 4, -4,
+  28, -40, 6, -29, -72, 16, 67, 56, -68, -34, -43, 8, 18, -23, -2, -78,
+  0, -18, -4, 10, 5, -8, -9, -15, -6, -5, 16, 16, 35, -14, 35, 11,
+  -3, -11, 24, -13, -23, -6, -25, -9, 56, 13, 14, 7, 18, 81, 50, -22,
+  19, -69, 0, -11, -33, -62, -24, -18, 23, 39, -38, -11, -23, 35, 12, -6,
+  0, 9, 8, 33, -21, 10, 18, 3, 33, 8, 38, -43, 0, -55, -8, 3,
+  0, 25, 0, -25, 56, 4, -23, -9, -31, -27, -17, -9, -2, -81, -65, 14,
+  -78, 7, -88, -27, 10, 5, -45, 5, -36, -5, -7, -27, -29, -27, -32, -2,
+  -61, 25, 9, -14, 35, 18, -30, 46, -20, 17, 35, 25, -18, 0, 12, 90,
+  0, -22, -50, 8, -4, 20, -88, -10, -42, -20, -13, 27, -67, 45, -26, -37,
+  75, 41, 10, 9, 15, -24, 38, 9, -44, 42, -7, 40, -71, -74, -28, -14,
+  -7, -31, -15, 21, -19, -46, -42, -5, 22, -41, -14, 8, 35, 27, -45, 34,
+  -37, -14, -14, 8, -26, 27, -26, -5, 20, 19, 12, -50, 5, -39, -34, 19,
+  -21, -6, -5, -8, -25, -28, 20, 55, 33, 0, 8, 10, -20, -51, -31, 34,
+  75, -44, 29, 9, 59, -9, 17, -9, -47, -57, 7, -3, 0, -20, -68, -31,
+  27, 11, -37, -27, 35, -10, 49, 30, 6, -25, 14, -67, -22, -22, -13, 42,
+  10, -28, -6, -17, -12, -3, 7, -14, 34, -14, -59, 27, -44, 53, 19, 19,
+  16, 3, 21, 25, 0, 40, -28, -24, 6, -20, -100, 13, -72, 3, -36, -45,
+  4, -13, -17, -28, 9, 45, -70, -6, 13, 18, 32, 6, -7, 24, 9, -33,
+  -37, -33, -37, -11, 51, -2, -24, 23, 14, -19, 10, -2, -38, 24, -3, 39,
+  7, -34, -43, 58, 9, 15, 33, 5, -86, 79, -3, -18, -16, 10, 12, -16,
+  -40, 59, -113, -56, 38, -20, -13, 0, -21, -71, -28, -67, 20, -13, -15, 82,
+  11, -56, 14, -3, -62, 8, -35, 43, 52, -63, -60, 29, -16, 74, -25, -61,
+  27, -15, -48, 102, 13, -29, 24, 0, -56, 8, -52, 27, 10, 3, -3, -59,
+  61, -11, 43, 19, 32, 6, 100, 17, 66, -2, -30, -36, 18, -20, 24, -29,
+  32, 43, 42, -8, -25, 38, 25, 27, 18, 6, 10, 43, -10, -51, 23, -11,
+  29, 16, 12, 3, 6, -6, 0, 64, -104, 51, 27, -58, 25, 37, -46, 14,
+  -24, -44, -55, 11, 6, -15, -56, -18, 3, -30, -114, -12, -35, 11, -29, -22,
+  -55, -34, 14, 6, 26, -44, 48, 7, 17, -14, 59, 34, -49, -20, -26, 5,
+  -48, -22, -39, 51, -85, 53, -18, 48, -30, 28, 5, -7, -35, 29, 49, 23,
+  14, -22, -24, -28, -53, -13, 17, -34, -29, -3, 30, -17, 46, -3, 3, -19,
+  10, -20, -7, 48, 0, 27, 24, 74, -19, -33, -3, -31, -80, -108, -16, -25,
+  -92, 34, 6, -17, -23, -18, 0, 12, 0, -5, 33, 36, -73, 7, 19, 19,
+  13, 6, 26, -8, 127, 33, -3, -34, -6, 42, -5, -47, -69, -16, 5, -25,
+  25, 9, -43, -54, 41, -36, -46, 55, -55, 27, 0, -49, -32, -27, 31, -31,
+  -27, -15, -22, 16, 38, 36, -94, 14, -78, -35, -48, 25, -6, -14, -19, -32,
+  -95, 48, -32, -22, 32, -35, -15, -2, -26, -38, 74, 11, 23, -7, -24, 5,
+  16, -22, -29, -73, -8, -25, 15, 17, -42, 8, -15, 63, -12, -10, 28, 11,
+  21, -19, 24, -22, 6, -6, -15, -9, -26, 42, -52, -14, 27, 24, -12, 0,
+  27, -9, 22, 0, -45, 17, 3, 32, 28, 30, -28, -15, 25, -14, 16, -22,
+  41, 28, 63, 50, -70, 15, -19, 7, 3, 7, 30, 16, 21, 46, -2, -11,
+  24, -19, -7, 13, 91, 25, 3, -13, -7, -25, -51, 21, 50, 52, 6, -36,
+  -18, -4, 27, -44, 7, 7, 51, 27, 39, -30, -16, -18, 9, -64, -23, -7,
+  30, 5, -107, 13, 64, -24, -57, -46, -17, -17, 22, -8, 12, -37, 12, -43,
+  56, -28, 29, -10, -99, -89, -14, 3, -11, -3, -19, 11, 3, 21, 27, -7,
+  7, -23, 20, 22, 32, -16, 32, 26, 49, -18, -32, 13, -9, -60, 10, -18,
+  -32, -24, 36, 40, -19, -14, 40, 35, 7, 0, 25, -29, -43, -77, 4, -3,
+  38, -25, -79, 44, -44, -15, 13, 61, 42, 21, -17, -5, -40, 3, 8, 6,
+  56, 64, 7, -69, -40, -19, 37, -6, -43, 39, -15, -40, 10, 50, 21, 47,
+  20, 27, 30, 54, 5, 19, -9, 0, -41, 28, -3, 8, 0, 52, -45, 43,
+  -27, 91, 3, 52, -82, -26, -11, 69, 56, 72, -9, -25, 57, -30, 0, 3,
+  -21, -19, -42, -7, 16, -52, 88, -12, 31, -14, 35, -47, -68, -68, -4, 37,
+  17, -25, 14, -69, 4, -22, 42, 0, 4, 15, -4, -26, 3, 41, 67, -27,
+  10, 47, -43, -35, -64, -3, -6, -47, -11, 25, 16, -17, -19, -60, -45, 14,
+  23, -12, 39, -28, 52, -85, 0, -4, -62, -53, 16, -7, -17, 77, 35, -31,
+  -106, -8, -56, -47, -36, 55, -26, -75, 14, -48, -48, -13, -28, 0, 16, 40,
+  47, -93, -54, -10, -29, 19, -5, -24, 36, 24, 19, -89, -43, -62, -54, -70,
+  57, -54, 50, -57, 16, 25, -6, -9, 7, -78, 3, 8, 34, 77, 0, -21,
+  14, 4, 15, 103, 37, -73, 62, -104, -98, 42, 0, -25, 17, -13, 66, 105,
+  55, -36, -5, -27, -72, -40, -109, -90, 52, -34, -74, -39, -12, 7, 98, 6,
+  -64, -46, -29, 3, -51, 41, 14, -115, 0, 30, 15, 20, 16, -116, 27, 17,
+  -57, 19, 23, -70, 37, -32, 44, -4, -15, 43, -6, 46, -6, -48, 26, -25,
+  -41, 71, 42, -48, 33, 0, 51, -4, 3, -64, 19, -69, 14, 21, -54, 0,
+  -4, 16, 51, -34, 80, -28, 35, 12, -17, 17, -4, -37, -80, -7, -49, 15,
+  17, -18, 14, 14, -4, -26, 28, 18, 61, 9, 52, 46, -43, -8, -9, 30,
+  -27, -47, -43, -32, 0, -38, -9, -52, -11, -50, 10, 42, 3, -8, 6, 7,
+  18, -35, -42, -32, 33, -21, 48, 35, 26, -11, 16, -11, -77, 34, 0, 3,
+  -43, 8, -19, -74, -16, 12, -18, -32, 28, -38, -30, -21, -20, 0, -73, -40,
+  51, 36, 36, -14, -22, -4, 37, 21, 18, -21, -11, 0, -16, 21, -6, -10,
+  -27, 16, 7, 16, -5, 3, 25, 60, 7, -114, 26, 4, 25, -24, 3, 121,
+  18, -55, 0, 52, -26, 19, 0, 8, -23, -57, 37, -58, 29, 43, -66, 0,
+  -64, 0, 19, 57, -4, -83, 127, -6, -7, 48, -43, -71, 40, -20, -53, 49,
+  -34, -82, 33, 73, -40, -7, -19, -3, -36, 21, -30, -17, -43, -33, -24, -20,
+  20, 27, 17, 38, 5, 28, -25, -43, 34, -21, -55, 80, -6, 12, -39, -11,
+  -18, -20, 9, -48, 7, -26, -18, 35, -26, 0, 41, 22, -23, -38, 0, -91,
+  -21, 11, 93, -13, 80, 67, -39, 84, 45, 55, -96, -63, -32, 71, 37, 40,
+  -26, 78, 25, 49, 40, 33, -14, -3, -32, -15, -15, 11, -3, -45, 18, 20,
+  39, 0, 5, -21, 79, -8, 21, 0, -40, -3, -21, -28, 36, 37, 8, 18,
+  15, -45, 0, -7, 37, -37, -39, -3, 0, 37, -8, -57, 12, -35, -54, -9,
+  39, -2, -15, 72, 56, -5, 25, 10, 12, 31, -47, -54, 26, 28, -10, -15,
+  -42, 0, 15, -14, -18, -21, 23, 5, 3, -20, -15, 12, -3, -51, -42, -22,
+  -22, -51, -25, -24, 9, 18, -16, -57, -15, -18, -37, -10, -26, 7, 50, 23,
+  22, -39, 0, -59, -46, -4, 21, -25, 14, 19, 5, -6, -2, -49, -42, -29,
+  -4, -38, -11, -36, 3, 35, -29, 12, -20, -6, -4, 0, 7, -70, -54, 18,
+  -11, 9, 39, -37, -24, -28, 65, -25, 9, 20, -6, 14, -35, -126, -17, 8,
+  22, -13, -14, 3, -18, 31, -21, -107, 12, 6, -11, -55, -41, 13, 0, 0,
+  56, 6, 35, 43, -15, 0, -51, -16, -38, -50, -5, -30, 14, 53, -77, -3,
+  0, -57, -92, 17, 76, -3, -7, -17, 35, -31, 50, 15, 7, -65, -30, -20,
+  -7, -47, -18, -17, 30, -6, -4, 17, -18, -7, 37, -2, 3, -48, 7, 14,
+  -25, 26, 30, -8, 61, 8, -8, 93, -25, -47, 16, -10, -49, 50, -37, 12,
+  45, 23, 30, -23, -3, 8, -12, 67, 43, 50, 64, -60, 40, 7, 38, -9,
+  42, -14, 27, 19, -36, -30, 25, -31, -32, -20, 0, -28, -23, -34, 80, 31,
+  14, -18, -18, -26, 12, 21, -42, -27, 47, 27, 37, -7, 5, 48, 12, -52,
+  72, -54, -82, 39, -105, -42, -18, -4, -56, -6, -16, -28, 13, -67, 3, 50,
+  -7, 26, 22, 13, -18, -72, 57, 16, -54, 9, 8, -36, -5, 4, 16, -46,
+  4, -16, -53, -31, -89, -13, 18, 24, -9, 11, 54, -17, -63, 51, 57, -10,
+  106, -62, 30, -31, -18, -18, -4, 20, -44, 47, -98, 21, -32, 3, -22, 14,
+  -3, -6, 11, 0, 53, 70, -13, -4, -22, -23, -37, 31, 13, -10, -42, 6,
+  -22, -81, -80, 10, 9, 14, -72, -51, 8, -22, -10, -39, 19, 21, 6, -20,
+  46, 29, 0, -19, -69, -10, -29, -2, 29, -11, -11, -9, -16, -17, 10, 53,
+  -81, -6, -15, -3, 45, -18, -23, 32, -77, -27, -31, -9, 41, -37, 12, 11,
+  -8, -16, -38, 34, -31, 18, -5, -32, 6, -9, 24, -48, 28, -53, 64, -12,
+  -59, -6, 22, -36, -25, -18, 33, -3, 14, -22, -18, -24, 17, 25, -35, -32,
+  7, 20, 8, 22, 0, 8, -18, 10, 6, -40, -111, -30, 10, -101, 34, -59,
+  18, -53, -39, -91, -75, -31, 15, 35, -56, -27, -18, -9, -22, -24, -32, 39,
+  -28, -16, 19, 45, 35, -3, -18, -43, -34, 70, 5, -45, 69, -33, 3, -85,
+  -4, -6, -47, -69, 6, -60, -45, 0, 22, -3, -57, -57, -38, -21, 19, -26,
+  7, -5, 11, -17, -26, 40, -76, 19, -6, -37, 32, -54, -63, -81, 30, -3,
+  -64, 76, 69, -57, -18, 15, 35, 32, -3, 27, 12, -45, -127, 31, 50, -11,
+  -17, -19, 60, -37, -88, 13, -8, -7, 0, 35, 11, -17, -46, -47, -32, 56,
+  -15, -36, -5, 56, 6, -29, 15, -29, -11, 44, -33, 30, 14, 46, 35, 6,
+  -14, -2, -42, 11, -20, 25, 47, -5, -55, 65, 50, 24, 13, -51, -3, 38,
+  -46, 3, 24, 26, 3, 3, -23, -5, 71, -2, 52, 26, -35, 17, 27, -39,
+  -6, 7, -8, 10, 36, -6, -4, -32, -30, -22, -42, 52, 2, -5, -42, 2,
+  14, 0, -4, -27, 2, -3, -2, -33, -22, -33, -15, -4, 7, 13, -14, -4,
+  -42, -12, 17, 17, 12, 36, -41, 13, 9, 6, -35, -19, -55, -4, 8, -17,
+  -16, -40, 67, 2, -2, -5, 49, -11, -20, -21, -7, 20, -18, 8, 11, -12,
+  -27, -24, -2, 12, 13, 25, 18, -27, -23, -4, -50, -5, -17, 0, -20, 13,
+  22, 5, -19, -20, 32, -7, -16, 7, -8, 7, -15, -9, 16, -3, 2, 13,
+  5, 2, -20, 2, 10, 38, 0, -7, 24, 4, -40, -23, -27, 11, -18, 73,
+  40, -31, 18, -4, 14, -28, 12, -15, 2, -21, -2, -4, -6, 3, -21, -12,
+  6, -43, 16, 28, -3, 12, 20, -37, 5, 7, -52, 29, 29, 18, 2, -42,
+  45, 24, 9, 47, 9, -7, -9, -7, -2, 23, 14, 0, -2, 74, 38, 0,
+  3, -25, -3, -8, 12, 21, 35, 18, 63, -28, 0, 15, 20, -17, 40, -8,
+  -8, 7, 34, 0, -14, 2, 0, 13, 18, -2, 7, -9, 18, -8, 13, 29,
+  -2, -19, 31, 14, -17, 12, 4, 32, -33, -4, -16, 23, 0, -13, 16, -35,
+  -47, 15, 15, 2, -21, 13, 14, 12, -16, 19, -14, -20, -9, 47, 17, -2,
+  71, 22, 6, 38, 7, -25, 0, 7, -11, -2, 24, -11, 10, 15, -23, 4,
+  -11, 26, -18, -13, -20, -46, -6, -8, -33, -19, -2, 16, -45, -38, 23, 33,
+  61, -17, -78, -2, -36, -21, -33, -35, -112, 62, 32, -70, -31, -8, -38, 66,
+  20, -127, -13, -12, 51, 18, 9, -10, -8, 45, 39, 47, 50, 0, -43, -11,
+  -40, -17, -43, 29, 69, 8, -71, 31, 17, 26, -3, -24, -72, -15, 30, 13,
+  -3, -18, -11, 37, 41, -67, -81, -4, -49, -24, -88, -2, -24, -13, 45, 48,
+  -21, -19, -10, -4, 20, -47, 2, -75, -2, -11, -32, -18, -14, -43, 38, -7,
+  11, -27, 8, 10, -7, -21, 11, 31, -22, 19, -4, -4, -21, 0, -17, -28,
+  11, -19, 83, 10, -35, -8, -16, -20, 9, 17, 16, -26, 12, -2, -28, -11,
+  27, -13, 20, 15, -14, 2, 12, -2, 7, -23, -39, -14, -8, 26, 4, -54,
+  36, -41, 2, 6, 17, 31, 2, 46, -19, 20, 28, -8, -8, 68, 14, -4,
+  -25, -20, -2, 37, -7, -18, -7, -19, 2, 2, 23, -27, 0, 11, 31, -24,
+  5, -2, -6, -10, 17, -34, 27, 2, 7, 19, -51, -11, -7, -21, 28, 10,
+  16, -2, -2, 17, -20, -23, -46, -39, -38, 28, -14, -14, 4, 41, 8, -6,
+  -15, -7, -47, -20, -13, -16, 8, 0, -5, 38, -32, 47, -21, -23, -28, -9,
+  64, -20, -21, -89, -28, 9, 5, 7, -8, 5, 6, -49, 41, 21, -12, -15,
+  8, 14, -23, 10, -7, -15, -46, 31, 15, 15, 16, -8, -2, -55, -58, -17,
+  88, -24, 13, -28, -14, 30, 20, -19, 2, 15, 0, 9, -63, 44, -36, 31,
+  23, -26, -31, -6, -26, -20, -2, -11, -5, -4, -46, 0, -17, 10, -6, 20,
+  25, -12, -2, -84, -2, -28, 9, 2, 4, 9, -37, -18, 20, -5, -14, -28,
+  8, -25, -40, -21, -35, 8, 3, 5, 15, 23, -19, -18, 5, -34, 8, -8,
+  -16, 22, -2, -19, -59, -41, 3, 9, -2, 17, -14, -9, 30, -10, -43, -14,
+  24, -28, 8, -5, -81, -51, -8, -35, -15, 14, -21, -91, 40, -6, -3, 11,
+  -87, 3, 2, 22, -39, 8, 9, 12, -3, -9, -18, -9, 42, -55, 28, 0,
+  -17, 26, 101, -19, -6, 12, 4, 30, -3, -33, 49, 38, -39, 60, 29, 30,
+  -14, 34, -32, -28, 6, -12, 26, -22, -40, 29, -12, -12, 8, 40, -34, -22,
+  19, -19, -45, -41, -69, -3, -10, 0, 24, 29, -26, 17, -15, 0, -28, 23,
+  -25, 19, -10, -26, 45, -6, 29, -12, -21, 6, 55, 9, -35, 24, 34, -45,
+  -103, 2, 48, -30, 29, 49, -46, 47, -14, 11, -18, -32, 6, -63, 23, 37,
+  7, -26, -47, -17, -6, 15, -8, -41, -46, -66, -3, 25, -11, -13, -7, -78,
+  -24, -3, -8, 3, 99, 56, 33, 38, -15, -37, -36, 24, 50, 19, -18, 14,
+  -11, 25, 2, 48, -48, -15, -21, -50, 0, -18, 5, 32, -72, -38, -6, -14,
+  -17, 15, 63, -3, 19, -37, 60, -9, -42, 6, -35, -21, -19, 19, 3, -22,
+  7, -14, -3, 22, 21, -36, 19, -10, 40, 29, -42, -5, -26, 47, -2, 19,
+  35, -19, 16, 67, -90, 58, -76, -83, -60, -3, 5, -47, -38, 49, -34, -6,
+  -29, 19, -5, 6, -18, -19, 44, 3, -21, 3, 5, 26, 16, 3, -3, 14,
+  14, 9, 48, -41, 23, 2, -25, -26, -3, -55, 102, 0, -19, -22, 13, 85,
+  -62, 34, 6, 3, -32, 27, 26, 32, -9, 0, 3, 46, -24, 70, 0, 43,
+  -27, 19, -3, -49, -4, -23, -8, -14, -39, 26, -36, 54, 38, 52, -78, 37,
+  22, 0, -2, -19, -12, -19, 9, -3, 3, 49, -85, -18, -127, 38, -44, -3,
+  45, -33, -52, 24, 3, -7, 42, 5, -37, 30, -7, -53, 74, 30, -13, 25,
+  121, -32, -53, -14, 24, -66, 26, -32, 72, -15, -6, 39, -29, -27, -27, -73,
+  5, -12, 27, -15, 9, 56, 15, 24, -36, -34, 23, 74, -20, -39, 8, 17,
+  -94, 29, 10, 32, 3, 17, -44, -84, -16, -18, 5, 3, -5, 82, -44, 37,
+  -31, 13, -34, 24, 29, 7, -21, 7, -31, -39, -11, 8, -29, 14, 36, 0,
+  -10, -14, -18, -56, 18, 0, 8, -12, -87, -7, 18, -25, 32, 60, 12, -22,
+  -16, 0, -21, 33, 9, -3, -15, 3, 3, -43, -34, -30, 18, 10, 52, -17,
+  -51, 10, 27, 96, -45, -13, -18, -46, -21, 58, -8, 20, -2, 45, -31, -39,
+  -3, -20, -4, -22, -19, 22, -67, 12, -23, -3, -42, 15, -29, 33, -3, -15,
+  -35, -3, 12, -33, 32, 21, 8, -7, -35, 0, 9, -14, 32, -33, 44, 8,
+  19, 6, -16, -31, 4, -23, -41, -28, 30, 23, 31, 30, -58, -45, -16, -43,
+  25, -114, 44, -19, 39, 15, -41, 68, -45, -55, 3, -50, -25, -38, -16, 0,
+  -58, 40, 22, -8, 48, -74, -32, -63, -79, 6, -21, -13, 13, -25, 16, 25,
+  -28, -49, -53, -33, -79, 9, -15, -5, -6, -7, -9, -18, -13, -7, -34, 5,
+  14, -12, -16, 3, -69, -46, -28, -28, 12, 54, 16, 34, 10, -39, 3, -9,
+  -62, -38, 54, 16, 18, -17, -41, -40, -13, 9, 18, -20, -2, 7, 22, 54,
+  -69, 38, 30, 11, -32, -5, -11, 33, 31, 14, 60, 38, 74, 49, -62, 17,
+  7, 26, 38, -39, -47, 69, 53, 49, 43, -12, 45, 42, 45, -33, -7, 5,
+  -41, -14, 26, 50, 0, -30, -30, 38, 36, 66, 34, 26, -5, -50, 8, 22,
+  40, 17, -5, -38, -36, 6, 64, 14, -60, -33, 36, -64, -63, -60, -3, -18,
+  15, 17, -37, 41, -63, 19, 15, 13, -46, 0, -8, -2, -49, -27, -64, 19,
+  49, 31, -25, -21, 90, -20, 4, 43, 9, 24, 46, 53, -52, -123, 5, 44,
+  24, 10, -3, 31, -14, -6, -44, 0, -3, -9, 23, -7, -33, -32, -23, 41,
+  24, -21, -21, 63, -16, -2, 10, 7, 9, -47, 36, 16, -48, 0, 7, 0,
+  49, -14, -4, 24, 25, -40, -4, -3, 71, 15, 27, -23, 7, -27, -32, -16,
+  94, -13, -3, 27, 42, 26, 20, 27, 76, 29, 26, -10, -14, -47, -11, 53,
+  41, -20, -20, 8, 14, 3, 19, 0, -23, -9, 45, -55, -3, -18, -45, 53,
+  55, -69, -5, 17, -16, -4, 6, 24, -46, 13, 3, 13, -30, -19, -10, 34,
+  -4, -7, 77, -6, 35, 16, -85, -20, -80, 21, -46, 0, -42, 48, 43, 30,
+  53, 0, -41, 0, 29, 52, 0, 11, -16, 8, 0, -33, 66, -40, -13, -15,
+  -36, 20, -9, 22, 47, -33, -83, 64, 10, 3, 0, 22, -25, 11, 17, -41,
+  59, -7, 45, -24, 46, 4, 42, 10, 52, 33, -8, -29, 5, 0, 0, 15,
+  -41, 29, 57, -50, -21, -13, -19, -23, -71, -42, 4, -32, 35, 12, -11, 14,
+  -8, 28, 45, 30, -26, 29, 37, -19, -38, 21, -7, -13, -29, 54, -27, -23,
+  -62, 112, 6, -8, 51, -22, 33, 68, -16, 0, -34, 44, -55, -71, -8, -31,
+  -32, -45, -35, -98, 59, -15, -6, -27, -35, -86, -16, -76, 10, 82, -3, -101,
+  -49, 24, -81, -33, -39, -21, 4, -5, -46, 45, -31, -11, 14, -9, -79, 54,
+  -19, -13, 51, -37, -35, -42, -16, -32, -16, -40, -7, 3, -69, 11, -56, -26,
+  56, 61, -3, 20, 0, 50, -3, 80, -10, -28, -3, 77, -41, -67, -31, -31,
+  32, -3, -66, -10, 62, 0, 10, -10, -66, -23, 8, 60, -18, 11, -7, -25,
+  60, 41, 81, 36, -77, -56, 50, 33, -6, -36, 34, 16, 39, 21, 14, 0,
+  -26, -3, -60, 30, 32, 13, -49, -13, -22, 29, 56, 48, -26, -65, -24, 62,
+  -36, 34, -32, -11, -14, -25, 3, -11, 0, -47, -51, 0, 16, 4, 56, -50,
+  -87, -10, -8, -38, 33, -17, -6, -57, 32, -100, 58, -38, -35, 11, 68, 9,
+  75, 58, 77, 59, -32, -3, 4, 31, -49, 9, 88, 51, -49, 24, 14, -35,
+  -49, 38, 67, -30, -51, -20, -127, -53, -22, 35, -23, -40, -26, 11, 21, 12,
+  41, 27, -17, 20, 5, -42, 39, 4, -59, -9, -23, -74, 49, -35, 37, 59,
+  -12, -10, -3, -38, 59, 4, 19, -3, 3, 50, 16, -73, -38, -22, 17, -71,
+  -56, 14, -61, 36, -7, 48, -38, 3, -95, 57, -8, 60, -67, 45, 32, -14,
+  -68, 47, 19, -43, 93, -36, 4, 32, -13, -45, 26, 40, -3, 51, 16, -126,
+  6, 20, -84, -28, -28, -47, -28, -8, -40, -16, 23, 18, -11, -64, -28, 28,
+  -36, -48, 58, -24, 20, 37, 29, -34, 89, -10, 27, 25, -28, -90, -48, -37,
+  -101, 0, -69, 33, -4, 54, -50, -23, -6, 33, -27, 67, -18, 15, -25, 14,
+  45, -47, -35, -76, -100, -98, -4, 16, -32, 0, -10, 3, -14, 76, 0, -9,
+  -31, 32, -33, 16, 22, -29, 16, -47, -41, -21, 3, 112, -34, -77, -5, 12,
+  -60, -59, -23, 0, -25, -4, 43, 10, -44, -69, -8, -15, 29, 11, -6, -18,
+  -18, -18, -27, -70, -17, -20, -11, -7, 32, -49, 62, -28, 67, -23, -27, -3,
+  43, -42, -12, 9, 34, 22, 78, -5, 3, -30, 6, -12, 60, -10, 13, 8,
+  6, -19, -41, 16, -49, 24, 16, -18, 6, 0, -21, 18, 16, -84, -3, -21,
+  49, -56, -33, -20, 12, -20, -15, 26, -30, -22, -31, 0, 19, -4, 52, 41,
+  -32, -50, -35, 34, -13, -8, -62, -19, 29, -54, 51, -33, 0, 9, -68, -3,
+  7, -3, -67, -23, 0, 28, 23, -25, 0, 13, 19, -17, -5, -7, -33, 11,
+  -8, 26, -19, -8, -62, -5, -5, 29, 38, 9, 24, 53, -5, -17, -16, -12,
+  53, -69, -38, -40, 22, -30, 12, 22, 30, 9, -13, -12, -10, 4, 23, 0,
+  36, -18, 12, -53, -43, -61, -51, -22, -3, -11, -29, -41, 37, 31, -51, 23,
+  -61, -3, -9, 20, -40, -16, -101, -35, -39, 18, 6, -45, -38, 10, -56, 6,
+  -48, -52, 8, -29, 107, -11, -21, 36, 41, -18, -11, 4, 10, -30, -59, -12,
+  -34, -3, -18, -30, -9, -45, 3, 45, -30, -51, 8, -9, -50, -25, -19, -91,
+  -18, -37, -19, 54, -43, 28, -4, 39, -41, -17, -94, -2, 7, 17, -37, -8,
+  -25, -51, 33, 49, 52, -6, -12, -38, -3, -15, 31, -43, 16, -38, -10, 0,
+  -59, -26, -41, -48, 53, -39, 61, 54, -56, -18, -48, 67, -8, -51, 32, -48,
+  98, -62, 8, 30, 75, -14, -24, -93, -8, -95, 23, 3, -22, -25, -91, -61,
+  85, -34, -23, -6, -13, 26, -4, 53, -26, 55, -94, 4, 127, 34, -34, 31,
+  -39, -15, -15, -32, 3, -71, -16, 3, 69, -63, 28, -67, 19, 31, -10, -64,
+  76, -61, -39, -19, 44, 34, -11, 18, 25, -27, -40, -21, -13, 34, 16, 3,
+  64, 20, -10, 83, 16, 2, -31, -71, -44, 32, 13, 36, 7, 75, -23, 6,
+  39, -34, 62, 39, -57, -13, 40, -15, 18, -46, 11, 33, -33, -60, 0, 18,
+  0, -6, 45, -64, -49, 19, 31, -38, -36, 20, 9, -57, -44, -17, 61, 20,
+  -23, -19, -44, 24, 36, -29, 0, 50, -19, -18, -40, 25, -13, -20, -16, 51,
+  -38, -89, 0, -56, -53, 24, -3, -22, -14, -32, 3, 18, 19, -39, 10, 15,
+  -11, 39, 46, -28, 23, 5, 33, 36, 47, -23, 98, 28, -13, -28, -44, -8,
+  32, -59, 33, 58, -21, -3, 35, 8, -18, -10, -53, 19, -5, 24, 35, 17,
+  87, -32, -41, -27, 36, 13, 34, -126, -106, 21, -21, -42, -23, -17, 48, 6,
+  87, -102, 28, 80, 19, -20, 52, 45, 5, -19, -8, -48, 10, -89, 0, 6,
+  -46, -7, -15, -34, 27, 20, -88, -77, -44, -3, 11, 24, 20, 71, 24, -59,
+  61, -74, -85, -9, 6, -40, -43, -13, -12, 35, -3, -17, 11, 34, -13, 14,
+  -56, 10, -33, -66, 4, 37, -63, 65, 44, -6, -43, 11, 21, 27, 38, -51,
+  19, -46, -25, 0, -6, 0, 9, -109, 19, -13, -44, -27, -38, -64, 6, 29,
+  60, -5, 46, -11, -53, 8, 44, 17, -53, -86, 36, -28, 10, -9, -20, 10,
+  -4, 39, -76, 46, -27, 12, -12, -53, -42, 30, -19, 5, -82, -79, -18, -47,
+  16, 8, -26, 40, 104, 46, -21, 8, -7, 28, -50, 24, -36, 20, -31, -17,
+  -48, 27, 12, 19, 51, 0, 7, -22, -6, 15, 39, 11, -11, -8, 0, -31,
+  21, -29, 63, -7, 86, 45, 9, -14, 48, 47, 8, 13, -58, 30, -8, 45,
+  -21, -17, 42, 13, -14, -40, -54, -29, -35, 65, 0, -31, 61, 4, 0, -36,
+  -39, -49, -3, -40, -26, 43, 18, -21, 11, -7, -6, -81, -55, -12, 9, -55,
+  -22, -38, 3, 35, 43, -2, -4, 19, 6, -26, -3, -21, -11, 12, -19, -14,
+  -4, -40, -36, -13, 27, -42, -60, 20, 10, 3, -42, -15, 12, -7, 28, 9,
+  87, -31, 18, 34, 18, 14, -5, 26, 45, 0, -47, -17, -64, 8, -18, -19,
+  13, 8, -3, 40, 16, -34, -15, 4, 7, 59, 25, 37, 6, -74, 0, -42,
+  127, -42, 44, -15, -22, -5, -7, -22, 13, -18, -12, -32, -14, -33, -11, 24,
+  25, 0, -50, 7, 62, -21, -9, 20, -65, -10, -42, -33, -47, -36, 8, -21,
+  12, -52, 14, 7, -25, 80, -14, -3, -3, -12, -22, -22, -19, 32, 47, 6,
+  -23, 8, -45, 31, 31, 28, 9, 29, 11, -10, -9, -20, -27, -20, 6, 0,
+  26, -42, -6, -35, 18, 37, 4, 0, -25, 37, 18, -28, -17, 29, 38, -10,
+  29, -35, 0, 39, -19, 33, 51, 0, -14, 20, -25, 5, -16, -53, 43, -15,
+  -54, 83, 46, -3, 4, 43, 23, -6, -77, 21, 4, -3, -51, 56, 44, -6,
+  7, -15, -87, 22, -88, 34, -101, 13, -29, 59, 6, -16, -39, -35, -41, -59,
+  -13, -31, -68, 19, -33, -51, -32, 37, -96, 59, 9, -21, 33, -4, 26, 14,
+  -41, 8, -27, -52, 62, -30, -17, 14, 17, -80, 8, 10, 0, -86, 16, 6,
+  -17, -90, -21, -7, -43, -18, -32, -3, 24, -47, 25, 8, -38, -52, -88, 65,
+  -13, -11, 35, 9, 36, -37, 0, 13, -18, -28, 9, -4, 3, -59, -41, -3,
+  -13, -84, -26, 8, 40, -37, -7, -41, 10, 7, 21, 18, 28, 99, -57, -3,
+  45, -13, 50, 20, -12, -12, 17, 23, 48, -43, 21, 3, -27, 50, 16, -6,
+  29, -62, 21, 10, 4, -29, -63, 3, 10, 9, -36, 17, -16, 0, 47, -32,
+  -3, -75, -19, -59, -36, -21, -6, -25, -44, -7, 6, 0, 21, 20, 31, 21,
+  4, -8, -24, 4, -4, -7, 0, -56, 29, -37, 33, -18, -11, 17, -45, -20,
+  -58, -24, 36, 13, -35, 42, -55, -6, 10, 13, -42, -3, -70, 33, -4, -18,
+  -12, 17, 53, -61, -21, -33, -27, -29, -3, 47, -43, -59, -16, -28, 32, 3,
+  -29, 53, 39, -68, -57, 3, 49, -4, -22, -38, 19, -45, 33, -71, 41, 14,
+  44, 57, -18, 46, -58, -2, -14, 15, 32, 15, -30, -21, -81, 33, 30, 3,
+  -70, 27, -18, -39, 19, -45, -89, -17, -24, -13, -42, 3, -35, 50, -40, -33,
+  29, -62, 39, -13, -39, -105, -18, -15, 63, -62, 36, -84, -3, 4, 15, -45,
+  46, -38, -45, -15, -98, 31, -61, 8, -62, 21, 25, 69, 9, 16, 22, -38,
+  39, 61, 38, 46, -65, -55, 14, -41, -22, 18, -12, -4, 25, -116, 8, 7,
+  12, -8, -86, -75, 0, 12, 0, -23, 82, -57, 17, -25, -74, -3, 47, 18,
+  75, -69, -7, 24, -67, -22, -9, -35, 14, 3, -101, -11, -51, -44, 50, 13,
+  -37, 13, -25, 24, 36, 5, 32, -7, 42, 15, -27, 18, 53, 10, -25, 18,
+  -31, -7, -5, 7, -51, -34, -25, -36, -64, 16, -35, 9, -34, -29, 26, 12,
+  -15, -2, -40, -9, -34, 63, -34, 12, 60, 15, 4, 22, 10, -17, 17, -5,
+  -18, 6, 25, 0, -37, -25, -76, 8, -34, 3, 6, 12, 22, -11, 57, -23,
+  40, -66, -45, 22, -36, -3, -67, 4, -10, 9, 3, -21, -27, -21, -36, 9,
+  15, -3, 28, 7, -10, -18, 28, -39, -45, -23, 21, 22, 46, 29, -3, 30,
+  -11, 2, 32, 32, 14, 44, 0, -10, 51, -76, -56, 7, -51, -6, -3, 3,
+  -51, -27, -19, -15, 19, 16, -28, 39, -9, 28, 51, -12, -34, 67, 57, 9,
+  -20, -63, -3, -3, -14, -24, 16, 26, 45, 24, 47, 14, -3, -24, -8, -33,
+  42, -57, 65, -17, -38, -32, 37, -23, -11, 81, 0, 6, -34, 22, 60, -27,
+  44, 37, 28, 32, -72, 8, 30, 12, -24, 29, -67, -13, -27, -32, 59, -18,
+  -22, 30, 15, 6, -31, 57, -24, 31, 52, 13, 6, 0, 34, -7, -8, -6,
+  -17, -3, -31, 8, -73, -35, 40, -33, 0, 9, -19, -50, 32, -17, -5, -88,
+  -77, -54, -34, 10, -48, 8, -25, -59, 50, -35, 13, -80, -7, -15, -20, 15,
+  -76, 30, 20, 0, 20, 16, -75, -7, 48, 35, 48, 25, 10, 67, -66, 63,
+  -11, -79, -40, 12, -28, -16, 28, -15, -21, 0, -51, -24, -31, 0, 13, -40,
+  -75, 13, -20, -81, -9, -11, 27, -29, 6, -30, -5, 97, -11, -10, 49, -30,
+  -4, -27, -13, -3, 0, -4, -50, 7, 39, -74, 64, 19, -42, 15, 0, -75,
+  44, 58, -28, -9, -61, -3, 52, -10, -84, 59, -30, 16, -3, 49, -69, 18,
+  -80, 39, -6, -18, -3, 54, 8, -5, 37, -3, 48, -59, 20, 81, 8, -66,
+  -55, -73, -51, 14, 0, 24, 16, -55, -61, 43, -22, 43, -29, 38, 58, -9,
+  19, -10, -31, 14, 25, -44, 12, 30, -17, 10, -16, 9, 0, 22, 60, -45,
+  -127, 49, -4, -17, -75, 65, -7, -2, -12, 47, -41, 65, -68, 78, -14, 0,
+  -48, -12, -6, -35, 3, 29, 20, -8, 12, 5, 3, 17, 45, 39, -18, 34,
+  17, -36, -8, -68, -9, 67, -11, 48, -16, 0, -58, 0, 35, -31, 0, -12,
+  38, -50, -44, -10, -16, 18, -34, 3, -8, -6, 3, -25, 24, -29, -23, 18,
+  -29, -7, -24, -6, 44, 10, -4, 7, 27, 6, -56, 31, -24, 58, 62, -8,
+  -7, -43, -71, 6, 22, 3, 24, -26, -28, 15, -29, 17, -31, 4, 18, 3,
+  3, -63, 62, -43, -95, -51, -43, 29, -48, -18, 27, 46, -19, -52, 3, -36,
+  19, -54, 3, -58, -60, -2, -31, 62, -67, 29, 5, -49, 51, 105, 63, 15,
+  69, -51, -4, -23, -75, -52, -19, -10, 48, -103, -108, -33, 3, -3, 42, 11,
+  66, -55, 22, 12, -9, 48, 40, -83, -9, -5, 6, -90, 45, -39, -44, 26,
+  55, 30, -25, -8, 23, 62, -11, 70, -13, -9, -44, -11, -24, 34, 8, -33,
+  50, -24, -31, 3, -57, 34, 56, 20, -8, 16, 21, 6, 51, -47, 3, -30,
+  15, -19, -43, -46, 34, 5, -11, 25, 6, -23, -15, -13, -79, 29, 114, 0,
+  66, -64, -9, 6, 12, 16, 20, 3, 3, 36, -57, 10, -14, -21, -10, 68,
+  12, 7, -12, -10, -33, 12, 6, -53, -21, -11, -16, -31, -15, 20, -43, 17,
+  -19, 43, -13, 49, 30, 0, -34, -52, -22, -25, -8, 18, 2, -13, -28, -2,
+  3, 20, 23, -37, 10, -22, 0, 11, 11, -17, 24, 3, -27, -12, -10, 25,
+  8, -26, -18, -23, 0, -23, -17, -24, -4, -15, -9, 5, -6, 33, -15, -10,
+  -31, 45, -4, 10, -10, -4, 17, -18, -2, 28, 4, -26, 21, 17, -22, -7,
+  -33, -24, -30, -12, -2, -16, -25, -28, 12, -23, -6, 9, -7, -3, 19, -32,
+  21, 13, -40, 19, 32, 11, -35, 9, 17, 27, -24, 10, -20, 21, 5, -30,
+  13, -7, 4, -8, -18, 20, 26, 0, 9, -7, -34, 16, -18, -18, 13, -22,
+  -21, -5, 16, -23, -49, 6, 15, -8, -25, 24, 10, 26, 6, 10, -14, -26,
+  17, -27, -6, 17, -64, -19, 9, 33, -30, -5, 17, -38, -2, 21, 43, -24,
+  -29, 20, -3, 6, 10, 7, -13, -4, 2, 27, -16, -10, -61, -19, 15, 28,
+  0, -26, 16, 0, 11, 30, 0, -13, 11, -17, -14, 16, -12, -43, 6, -22,
+  -27, 9, -34, 2, -29, -8, 6, -24, -11, 7, 6, -33, 8, -27, -28, -37,
+  -39, 7, -22, 12, -20, -14, -4, 19, -8, 28, 13, -2, -12, 5, 0, 26,
+  8, 5, 0, 6, 22, -21, -51, 27, 36, 13, -13, 26, 17, 23, -35, 26,
+  -3, -44, -13, -34, -42, -45, 31, -22, -33, -13, 14, -4, -40, -30, 28, -29,
+  -56, -74, -24, -29, -3, -39, -44, 32, 69, -37, 39, 33, -15, 7, 16, -28,
+  -25, 7, -7, -39, -75, 1, -69, -127, -28, -16, 53, -53, 33, -23, -64, -2,
+  42, 18, 85, 35, -110, -24, 48, 4, 47, -78, 24, 11, 5, -23, -124, -45,
+  -31, -46, -29, -19, 4, 30, 106, -13, -40, 35, 5, 18, -14, 66, -4, -31,
+  -29, -52, -8, -4, 23, -25, -10, -24, -48, 17, 22, 31, 0, -2, 2, 2,
+  25, -41, 9, 0, -32, 9, -4, -12, -6, 19, -25, 0, -21, 10, 7, -68,
+  -29, 13, -26, -29, -34, 32, 3, -12, -36, 4, -37, -34, -32, 17, 0, -13,
+  5, -13, 2, 11, -11, 2, -51, -9, -15, -19, 0, 0, -24, -13, 9, 4,
+  10, 17, -32, -4, 7, 13, -21, 48, 11, 17, -10, -23, -32, -25, 0, 30,
+  30, -2, 19, -46, -23, -17, 25, -5, -22, 12, 17, 4, 9, 34, 31, -11,
+  31, -12, 11, -4, 12, 19, 3, -7, 0, -6, -56, 0, 17, -12, -12, -9,
+  -5, 0, 13, 6, 22, 36, -9, -13, -18, 0, 36, 2, -8, 13, -24, 10,
+  -8, 2, -16, -51, -3, -29, 2, -11, -48, -2, 8, 3, -17, -30, -4, -11,
+  -8, -82, 22, -19, 9, -17, 16, 35, -10, 37, 23, -24, 26, 44, 28, -11,
+  13, -3, 26, -39, 0, -6, -5, -11, 13, 21, -5, -22, -2, -31, -12, 2,
+  10, 17, -24, 2, -74, 36, 9, -52, -29, -9, -5, -21, 16, -23, -20, -35,
+  -14, 21, -14, 0, 26, -35, -8, 13, 41, 17, -6, -5, -25, -5, -8, -37,
+  44, 5, -6, -10, -20, -10, 20, 5, -46, -9, -23, -4, -23, 18, 28, 19,
+  5, -7, -28, 0, -2, 4, -21, 21, 28, -27, 8, -24, -27, -10, -7, 4,
+  10, -4, 33, 23, -18, 27, 26, -30, 0, -22, -5, 25, -10, -35, -9, 31,
+  8, -12, 27, 40, -75, -16, -9, 13, -8, -3, -34, 3, -21, -3, -2, -3,
+  10, -6, -36, -3, -8, 35, 30, -17, -20, 34, 23, 16, -17, -35, -6, 3,
+  -10, 35, 38, 8, -18, 5, 10, 17, 34, 3, -10, 2, -12, 0, 0, 7,
+  10, 8, -19, -13, 8, -8, -3, 9, -40, 2, 22, 26, -49, -37, 9, -5,
+  -10, 38, 25, -36, -91, 9, -23, 29, 39, 8, -31, -72, 5, 42, -41, 11,
+  -3, 21, 2, -24, -8, 12, 8, 32, -10, -85, -30, -5, -32, 10, 35, 23,
+  -10, -12, 79, 25, 42, -2, -10, -24, 55, 5, -26, -18, -9, -20, -103, -35,
+  115, 0, -65, -67, 14, 58, -17, 18, -29, -56, 11, 28, 17, -31, -5, 0,
+  -30, -14, -32, -33, 8, 9, -26, 10, -28, -8, -38, -22, -23, 12, 7, -40,
+  -24, -38, -2, 27, -28, 9, -46, 6, 2, 42, 2, 38, -13, 0, 20, 18,
+  29, -27, 62, -18, -33, -46, -20, -39, 13, -13, -3, -18, -27, 3, 15, -12,
+  45, -32, -14, -23, -25, 11, -3, -18, -21, 9, -53, -19, -37, -15, -45, 40,
+  -20, 26, 10, 45, 12, -7, -7, 16, 34, -3, 62, 25, 5, 33, 29, 13,
+  3, -47, -41, 18, -25, -7, -14, -23, 34, 28, 30, -32, 9, 10, -23, -47,
+  -51, 12, -69, 3, -51, -32, 23, 24, -31, 49, -10, 10, -30, -20, 45, -5,
+  -26, 8, -8, 26, 14, 47, -14, 16, -13, 11, 17, -30, 12, -15, -11, -5,
+  -85, 12, -7, -26, 32, 35, 9, -113, -81, -8, -50, -31, 7, 105, 38, 21,
+  20, -47, -38, -9, -6, 12, -8, 43, -17, -17, -16, 54, -9, 35, -3, -8,
+  -48, -6, 52, -35, 63, 2, -72, -50, -13, 28, 62, 39, 39, -5, -51, -37,
+  -38, 82, 43, 41, -27, 3, -10, 25, 16, 18, 8, 26, 0, -37, -2, 0,
+  -5, -40, -79, 12, -127, 23, 19, 16, 6, -19, -12, 3, -5, 48, 19, -45,
+  -20, 6, -34, 6, -19, 2, -16, -32, 34, 39, 35, 16, 11, 19, 43, 5,
+  -10, 61, 28, -35, 42, -73, -55, 4, -5, -38, 55, 21, -9, -3, 33, -7,
+  -35, -24, -22, -21, -19, 58, -3, 14, -62, 7, -22, 28, -27, -15, -7, 40,
+  -15, -55, -2, 0, 48, -45, -31, -19, -14, -34, -67, 25, 19, -51, 41, -53,
+  -64, -9, 14, 53, -67, -7, -19, 9, -10, -17, -44, -14, -2, -10, -12, -10,
+  -22, 31, -21, 13, 12, -9, -13, 13, -31, -61, 6, 21, -39, 0, -42, 16,
+  10, -16, 41, -18, 11, 25, -28, 9, -21, 7, -44, -11, 5, -68, -14, -57,
+  -48, -17, -5, -2, 4, 31, -5, -39, 22, 24, -12, 37, 5, -9, 57, 8,
+  -60, 12, -7, 9, -3, 18, -3, -17, -12, 11, -16, -43, -6, 29, 9, -60,
+  -79, 0, 38, -65, 0, -27, -36, -63, -13, 28, 16, 19, 15, 13, 27, -12,
+  -16, -16, 38, 41, -8, -19, -59, -2, -62, -34, 72, -6, 61, 0, -36, -22,
+  20, 49, 22, 17, -40, 33, 56, 13, -6, -40, 48, -47, -33, 6, -7, -5,
+  -54, -12, 5, 0, 47, 56, 11, 29, -17, -20, 51, 27, -13, 22, -14, 0,
+  -92, -6, 38, 23, 66, -11, -36, -22, -16, 36, -16, 43, 24, -8, -55, -30,
+  -10, 80, 30, -13, -5, 6, -24, 52, -29, 20, 44, -36, 37, -46, 45, -65,
+  5, -6, -12, 11, 46, 50, -57, -19, -30, 31, -12, 30, -36, 0, 9, 3,
+  -36, 9, 15, -43, -5, -14, -8, -19, -31, 33, 5, 8, -6, 15, -53, 3,
+  18, -2, -50, -10, -40, -15, 25, 2, 23, -10, -60, -25, -17, 20, -26, 7,
+  6, 5, 13, 18, -79, 32, 30, -4, 16, -2, -30, -21, 9, -6, -15, 2,
+  29, -39, 14, 5, 35, 48, -16, 6, -22, -3, -9, 33, 0, 47, -30, -36,
+  26, -3, 0, 32, 24, 3, 21, -14, 5, 41, 0, 29, -4, 12, -59, 28,
+  37, -30, 10, 0, 35, -44, -16, 0, 0, -22, -41, -8, 23, -37, 3, -20,
+  3, -5, 26, 60, 3, -30, 13, -4, 3, 7, 21, -2, 26, -54, -2, 12,
+  24, 0, -26, 9, 50, -27, -27, -3, 5, 5, 30, -24, 20, 0, -28, 23,
+  33, -26, 13, 14, -43, -15, 32, 11, 12, 11, 2, -10, -39, -28, 17, 28,
+  74, 12, 84, 41, 81, -24, -25, -27, -51, -25, 0, 32, 3, 37, 3, -20,
+  -12, -5, 5, 8, -45, -3, -30, -15, -16, 7, -21, -33, -92, -27, -7, -41,
+  -12, 11, -26, -23, -50, 14, -14, 41, -14, -5, -14, 12, -23, 6, -14, 36,
+  -26, 11, 7, 20, 62, -12, 40, 11, 36, 68, 29, -100, 8, -3, 25, 18,
+  -89, -36, 7, 10, -38, -9, -35, -15, 30, 0, -47, -43, -20, -20, -15, -4,
+  28, -31, -10, 3, -50, -5, -10, -24, -3, 31, 3, -58, -59, -30, -46, -2,
+  17, 25, -88, -9, -38, -23, 7, 78, -14, -39, -12, 55, 32, -70, -46, -26,
+  -42, -60, -2, -11, 11, -15, -50, -28, 40, -109, 56, -8, 35, 71, 6, -28,
+  43, -4, -3, 17, -20, -7, -44, 0, 13, 74, -6, -8, 52, 12, -6, 31,
+  71, -54, -18, 25, -74, -11, -27, -17, -23, -26, -48, -58, -9, -48, 20, -43,
+  7, 53, -14, -18, 127, -2, 14, 37, 3, 33, 16, -18, -32, -44, -46, -33,
+  10, -71, -28, 3, -13, -15, -29, 14, 24, 8, 11, 50, 2, 6, -25, 3,
+  3, -20, 77, 29, 23, 11, -16, -34, 25, -2, -28, 8, 38, -20, -71, -2,
+  -6, 21, -21, -10, -34, 38, -37, 13, -16, 4, 54, -48, -5, 24, -20, 36,
+  -19, -28, -65, -9, 4, -32, -34, -12, 0, -18, 0, 3, 41, 58, 35, -3,
+  42, 46, -7, 0, -8, 2, 16, 31, 0, 8, 34, -31, -64, 28, 64, -3,
+  3, -20, 10, 32, -6, -7, -35, 0, -25, -30, 35, -6, 9, -2, -6, 4,
+  -9, -3, -55, -20, -3, -21, 0, 24, 5, 50, -24, -23, -50, -6, -7, -22,
+  17, 20, -5, 7, 27, -9, 39, 16, -41, 3, -30, -21, 29, 15, 2, 31,
+  36, -9, -31, -20, 62, 26, -45, 0, 71, 27, 9, -8, 8, 34, 34, -5,
+  12, -12, -44, -44, -17, 44, -63, 13, 8, -7, 13, 42, 23, 42, 32, -2,
+  -87, 59, 34, 15, 37, -3, -13, 28, -23, 4, -32, 0, -50, -36, 33, -56,
+  2, -42, -14, -23, 31, -5, -30, 25, 41, -18, 23, -18, -18, -26, -42, -3,
+  20, 31, -7, 0, -56, 9, 5, -33, -24, 11, -20, -3, -19, -25, 6, 8,
+  -3, -10, -47, 10, 0, 4, -70, -6, 48, 2, -47, -4, -72, 0, -38, 38,
+  -6, -33, -45, -40, -100, -13, -54, 11, -23, -17, -30, 17, -33, 60, 0, 14,
+  10, -9, -2, -28, -55, -12, 40, -16, 31, -5, -24, -41, -21, -30, 12, 3,
+  -3, -44, 5, -32, 14, 11, 8, 9, 27, 8, 23, -32, 9, 57, 20, -5,
+  -13, 22, 0, -5, 18, -61, -26, -13, 18, 43, -81, 29, 36, 5, -27, -23,
+  0, -56, -27, 8, -35, -6, 17, 14, 21, -36, 30, -11, -34, -46, -32, -17,
+  -48, -9, 7, -7, -36, 5, 23, 3, 6, -8, 43, -19, -5, 21, 36, -13,
+  -30, 23, -20, -44, -36, 4, -30, -23, -15, -3, 14, -32, 17, 0, 9, -23,
+  -70, -18, -52, 40, -3, -27, 20, -30, 39, 26, -42, 12, 15, 5, -24, -5,
+  -64, -69, 11, 39, -41, 14, 14, 9, -13, -7, 6, -15, -27, 0, -27, 12,
+  -8, -6, -10, -2, -4, -9, 12, -10, 0, -45, 7, 3, -30, -30, -5, -19,
+  -47, 9, -9, -62, 19, 12, 14, -23, 0, -8, 9, -13, 4, -28, -32, 21,
+  -16, -33, -62, -23, -33, -39, 16, -35, 16, 15, -19, -14, -68, 0, -36, 23,
+  -22, 50, -3, -15, -68, 14, 17, 27, -3, 43, -66, -30, -22, -46, 20, 0,
+  28, -20, 20, -21, 24, 21, -16, 42, 36, -5, -36, 19, 28, -42, 17, -29,
+  0, 32, 45, -32, -3, -23, -24, 0, -10, 20, -37, 43, -34, 25, -3, 57,
+  -32, -18, -10, 0, -21, -2, 0, -37, -44, -5, -45, 6, -12, -3, 0, 30,
+  -32, -19, -5, 8, 8, -11, 3, 7, 5, 38, 3, -19, 46, 6, -43, -27,
+  48, 66, 12, 14, 40, 23, -70, 26, -28, -101, -41, 37, -16, -27, -14, -48,
+  54, 18, 41, 15, -50, -39, -41, -11, -34, 48, -91, 22, 2, 25, -9, 65,
+  63, 6, -45, -28, -21, 70, -3, 32, 8, -66, -16, -27, -63, 68, 127, -37,
+  -3, -8, 40, -41, -33, -6, -35, -5, 3, 9, -6, -21, 29, -55, -5, 22,
+  23, -32, -39, -14, -8, -7, 42, -90, -33, 3, 24, -94, 21, 15, -26, -5,
+  44, -26, 27, -3, 44, -5, 19, -26, -32, 0, 46, 13, 6, -16, -3, -47,
+  -25, -55, -76, 23, 0, -41, -10, 6, -8, 38, -36, 27, -21, 8, -12, -16,
+  -6, -21, -3, 31, -27, -3, -7, -9, -3, 0, -39, -2, -20, 9, -5, -20,
+  -25, 20, -7, -9, -44, -28, 2, -19, -75, -16, -5, -56, 30, -21, -7, -45,
+  27, 21, 7, -56, -3, 14, -14, -11, 17, 59, -14, -22, -13, -47, 23, 21,
+  -16, 14, 0, 48, -24, -23, -10, 24, -10, -38, 3, -39, -15, -8, -30, -18,
+  -13, -32, 16, 18, -19, -33, -21, 7, 3, -5, -14, -17, -32, -101, -7, 0,
+  -18, 3, 30, 14, -28, 40, 5, 58, 25, -16, -5, -34, 60, -51, 12, 13,
+  -20, 3, -9, -18, -19, 5, 5, 29, 39, 20, 14, -35, -32, 13, 3, 52,
+  -111, 6, -21, 35, 3, 2, -49, 11, 16, 28, -13, -6, 3, 5, -18, -39,
+  -51, 16, -5, -31, -8, 0, 45, 29, 19, 11, -36, 13, -27, -34, 38, 30,
+  0, 3, -30, -45, 16, 0, -19, 48, 14, 8, -2, 34, -30, -51, 22, -24,
+  7, -3, 27, -30, 22, 12, -16, -6, -12, 39, 46, -70, -38, -32, -26, -29,
+  -3, 2, -3, 25, 6, 2, 33, 2, -16, -13, -61, -14, 21, -43, 36, -14,
+  54, -61, -30, 13, -38, -30, 28, 2, -51, -18, -33, -13, -44, 40, -32, 2,
+  23, 11, -19, -9, -31, 3, 0, -47, -22, 35, 41, 45, 28, 12, 9, 0,
+  -35, 23, -30, 23, -7, 7, -4, -72, -80, -63, 28, 7, -11, -29, -65, 76,
+  38, 54, 23, 10, 4, 9, 43, 26, 55, 13, -21, 15, -16, 53, 0, -6,
+  13, 14, -25, 7, -61, 33, -55, 45, -14, -39, 40, 28, 84, 93, 30, 30,
+  83, -4, 6, -44, 58, -6, -28, 34, 7, 7, 22, 8, -15, -44, -25, 14,
+  -49, -39, -12, 4, 22, 16, 18, -26, -3, 19, -12, -43, -17, 50, 23, 31,
+  50, 38, 9, 7, 39, -30, 4, -60, 24, 3, -26, 0, -47, 20, 16, -18,
+  17, -17, 25, -10, -11, 33, 32, 21, -18, -30, 29, -20, 32, 89, 9, 16,
+  33, -30, 32, -25, -21, -3, -31, -42, 7, 14, -6, 37, 15, -4, 25, -7,
+  84, -35, 83, -23, -11, -44, 47, -4, 19, 33, -12, 7, 37, 13, 80, 55,
+  -50, 59, 9, -23, -43, 15, 52, 11, -31, -10, 21, 36, -75, 94, 56, 3,
+  -34, -42, 46, 51, 61, 73, 37, 33, -11, 21, -26, 25, -10, 73, -27, -39,
+  63, 23, 16, 41, 5, 9, -84, -38, -26, 21, 25, 4, -74, -36, -47, -7,
+  13, -12, -24, 4, 33, -12, -22, 19, -35, 45, 0, -50, 82, 63, 38, 10,
+  -42, 32, -5, 46, 31, -21, -17, -17, 89, 0, 17, 13, 102, 47, 0, 24,
+  -13, -45, -14, 7, 4, 40, 64, 21, -18, -30, 62, -20, 19, -61, -24, -43,
+  -43, 19, 29, 16, 115, -59, -28, 110, 118, -31, 19, -41, -95, -83, -57, -66,
+  -62, -15, -65, -90, -110, -32, -108, -15, -13, -37, -28, -50, -31, 100, -38, -17,
+  54, -38, -14, 50, -59, -6, -43, -3, 69, -27, -64, -10, -16, -127, -120, -6,
+  -76, 24, 75, -44, -4, 58, 69, -30, 81, -45, 44, -6, -45, 12, -27, -23,
+  -17, -57, 6, 69, 31, -50, 12, -34, -52, 94, -69, -21, 25, -32, 92, -3,
+  75, -70, -21, 35, -26, -32, 39, 4, -6, 78, -58, -68, -11, 25, 61, -79,
+  13, -19, -18, 56, 16, 63, 17, -14, -58, -67, -38, -67, -12, 17, 40, -73,
+  29, 77, 71, 7, 7, -37, 23, -42, 42, -6, -11, 3, -42, -12, 0, 56,
+  0, 38, -45, -31, 110, -25, -9, 93, -18, 24, 3, -4, 40, 8, -6, 17,
+  -13, -8, 0, -31, -62, 0, 25, -15, 13, 63, -18, 7, -34, 38, -53, -24,
+  71, -5, 45, -3, 8, 30, 47, -17, -41, -13, -34, -23, -39, -13, 72, 6,
+  4, 17, 39, -24, -11, -37, 14, -6, -71, -56, 58, -8, -90, 8, 33, 56,
+  43, 46, 6, 31, -84, 28, -25, 38, -85, -24, -6, 0, 49, -24, 6, -7,
+  44, 8, 3, 43, -15, -28, -54, -34, 26, 15, -74, -85, 59, -54, 8, -21,
+  54, -8, -14, 10, 12, 15, -52, -26, 31, -37, -26, -46, 67, -77, 16, 15,
+  34, 10, 53, 68, -4, -47, 60, -3, 0, -65, -4, -17, 3, -53, 30, -30,
+  -40, -57, -16, -3, -21, 12, -31, 21, -52, 38, -51, 4, -52, 75, 28, -3,
+  49, 23, -30, 12, -37, -16, 32, -23, -32, 19, -18, -14, -20, -38, -88, 21,
+  38, -13, -32, -23, -24, 48, -4, -17, 7, -34, 9, -21, -24, -67, 36, 0,
+  17, -17, 7, 10, -39, -106, 23, -27, -25, 24, -4, 3, -51, -97, -9, 33}
+;
+const int32_t conv2d_3_int8_bias[128] = {18261, 4540, 854, 1521, 6069, -5114, 17469, 18036,
+  18339, 19635, 10384, 7977, 21599, 11173, 3854, 14365,
+  14109, -9513, 11022, 9597, 700, 15996, 9496, -9138,
+  29098, 23981, 11672, 8759, 1011, 26662, 18068, 12529,
+  8111, 11225, 7122, 14059, 22443, 17105, 24591, 5024,
+  23336, 14931, 15967, 8470, 5659, -5727, 12247, 15176,
+  15521, 9653, 2352, 5056, 15464, -8363, 6230, 3535,
+  23576, 15959, 6655, 11290, 7200, 10623, 913, 19255,
+  9555, 20852, 18179, 12191, -3244, 22054, 7230, 22560,
+  -16927, 16297, 22259, -11148, 5223, 15036, 24639, 14087,
+  9150, 20999, 11035, 4642, 21698, 9525, 17451, 15487,
+  22397, 10542, 20898, 5738, 14584, 14942, 26626, 18845,
+  8643, 4790, 17163, 11271, 5183, 13327, 5128, 11673,
+  21012, 15169, 14425, 8920, 19592, 12432, 24548, 6617,
+  21577, 11478, 12910, 7713, 24534, 5790, 18918, 13450,
+  32597, 17697, 4127, 20470, 15659, 10409, 17740, -3491}
+;
+const int32_t conv2d_3_int8_multiplier[128] = {1808936085, 1848260782, 1990544688, 2013782009, 1846830793, 1268757740, 1673087130, 1812511057,
+  1737079137, 1680237075, 2075271536, 1188499607, 1887585480, 1147387424, 1182422154, 1155431112,
+  1126473834, 1744229082, 2104228813, 1451438835, 2007704556, 1689174506, 2032014369, 1404964192,
+  1604447658, 1190465842, 1636622410, 1665222190, 1604447658, 1901885370, 1235510496, 1110028961,
+  1157754844, 1738151629, 1191180837, 1182422154, 1936920100, 1392630537, 1758886470, 1786771255,
+  1408181667, 1285917608, 1798926162, 1993762163, 2114596233, 1847545788, 1957654941, 1087506634,
+  1759243967, 1854338235, 1967664864, 1798926162, 1539025661, 1967664864, 1103594010, 1891875447,
+  2023791932, 1940495073, 1914397773, 1844685810, 1212451923, 2072054060, 2123533664, 1776046338,
+  1959084930, 1539025661, 1148638664, 1982679748, 1872928092, 1645202344, 1775510092, 1363137014,
+  1812511057, 1189750848, 1812511057, 2116383719, 1689532003, 1273405204, 1575847878, 1936920100,
+  1567982938, 1346870889, 1567982938, 2043096783, 1701686910, 1567982938, 1077317963, 1944427542,
+  1429989000, 1904745348, 1875430573, 1246950408, 1624825001, 1920117729, 1447863862, 1896165414,
+  1825380958, 1656284759, 1141131222, 1576562872, 1481468604, 1930485150, 1418906585, 1673087130,
+  1715986800, 1383514357, 1732789170, 1844685810, 1909392812, 1077317963, 1993762163, 1966949869,
+  1206553218, 1117893900, 1812511057, 1441071414, 1747446558, 1161866062, 1789273736, 1640197383,
+  1725281728, 1482541095, 1689174506, 1177595941, 1933345128, 1993762163, 1936920100, 1467168714}
+;
+const int8_t conv2d_3_int8_shift[128] = {40, 40, 40, 40, 40, 39, 40, 40, 40, 40, 40, 39, 40, 39, 39, 39,
+  39, 40, 40, 40, 40, 40, 40, 40, 40, 39, 40, 40, 40, 40, 40, 39,
+  39, 40, 39, 39, 40, 39, 40, 40, 40, 39, 40, 40, 40, 40, 40, 39,
+  40, 40, 40, 40, 40, 40, 39, 40, 40, 40, 40, 40, 39, 40, 40, 40,
+  40, 40, 39, 40, 40, 40, 39, 40, 40, 39, 40, 40, 40, 39, 40, 40,
+  39, 39, 40, 40, 40, 39, 39, 40, 40, 40, 40, 39, 40, 40, 40, 40,
+  40, 40, 39, 40, 40, 40, 39, 40, 40, 39, 40, 40, 40, 39, 40, 40,
+  39, 39, 40, 40, 40, 39, 40, 40, 40, 40, 40, 39, 40, 40, 40, 40}
+;
+
+// dense: input scale 0.097564, output scale 0.103039
+const int8_t dense_int8_kernel[64][128] NN_ALIGNED = {0, -95, 70, -25, -27, -127, 45, -61, 16, 7, -7, -36, 16, -23, -9, -82,
+  -23, 75, 34, 41, 50, 50, 25, 36, 7, -7, 68, 36, -48, 9, 39, -91,
+  25, -39, 95, 16, -43, -11, 45, 9, 102, -43, 16, -2, -63, -18, 25, 113,
+  11, 27, 43, -45, 5, 32, 45, 29, -23, 18, 32, -34, 41, 52, -34, 0,
+  29, 11, 61, -9, -27, 29, -9, -7, 54, -57, -82, 25, -63, -5, -16, 70,
+  0, 64, -25, 43, -59, -11, -25, -59, -2, 16, -23, -9, 54, 2, -63, 73,
+  -75, 45, -48, 20, -5, -32, -25, 57, 16, 45, -16, 7, -2, -27, 52, -14,
+  79, -41, -73, -34, -54, -9, -11, 5, -32, 23, 45, -39, -32, 2, 50, -29,
+  -95, 24, -49, -49, 22, -37, 66, -125, -17, -7, -34, -56, 15, 5, -15, -49,
+  32, 2, 44, 27, 73, -5, -44, -7, 29, 22, 0, -37, -29, 51, 20, 29,
+  17, 42, 76, -46, 32, -27, -12, -22, -27, 24, 27, 12, -54, 0, 24, -20,
+  29, -22, -54, 78, -32, -88, -110, 54, -24, 2, 59, -15, 0, -24, -34, -44,
+  -5, -29, 0, -15, 22, -39, -29, 44, -7, 51, -73, -78, -63, 15, -42, 39,
+  -127, 98, 24, 54, 64, -22, -37, -27, 34, 49, 44, 98, 34, -20, 46, -63,
+  -17, -15, -39, 12, 17, -81, -24, 71, 49, 59, -10, -10, -63, 112, 76, 95,
+  -32, -10, -71, 10, -22, -39, -29, -32, -63, -12, 2, 24, -27, 10, 56, -120,
+  -60, -16, 39, -14, 28, 7, 2, 30, 35, 58, -37, 0, -23, 32, -32, 16,
+  48, -51, 39, 53, 16, -18, 12, 5, 37, -67, -83, -53, -14, 16, -74, -72,
+  42, -74, -21, 42, 72, 42, 51, -23, -48, 37, 21, 42, 2, 2, -32, -48,
+  -5, -42, 16, 21, -67, 18, -51, -5, 16, 2, -74, 9, -28, -16, 35, 35,
+  -32, -90, -127, 30, 42, 25, 90, 39, -5, -42, 55, -44, -16, -39, -5, -18,
+  12, -67, -60, -46, 35, -58, -81, -12, -44, 23, 28, -9, 5, 32, 39, -111,
+  21, -5, -46, -62, -48, -37, 72, -18, -18, 72, 39, -21, -44, 42, 67, 14,
+  -28, 48, 9, -39, 58, 55, 35, 62, 44, -7, -51, 37, -5, 92, -30, 21,
+  -22, -107, 49, -31, 11, -76, 16, 33, 4, -89, -45, -18, -2, -13, -51, -82,
+  -45, 22, -56, 22, 65, -42, 36, -27, -25, -4, -7, -20, -69, -4, 53, -2,
+  -13, -9, 18, 29, 47, -20, 33, 16, -20, 2, -16, 53, 13, 0, 4, 40,
+  -29, -65, 2, 33, -11, 36, -16, -33, 0, 38, 4, -40, -33, 49, -80, -40,
+  -2, 49, 20, 18, -25, 22, 31, 45, -13, -2, 42, 2, -2, 25, -25, 36,
+  -74, 31, 31, -2, 40, -20, -27, -85, 36, 33, -45, -94, -22, 27, -33, 67,
+  58, 7, -49, 58, -16, -33, 29, 47, -20, 127, -65, -22, -25, 100, 58, -45,
+  31, 11, 13, 31, -33, -80, 11, 82, 27, 45, 38, 25, -71, -40, 51, 62,
+  39, -88, -39, -58, -16, 7, -72, 55, -42, -35, 42, -35, 7, -7, 88, -21,
+  18, 0, -42, 55, 16, 25, -67, -16, -12, -2, -28, 39, 42, 62, 30, 2,
+  -72, 21, 21, 5, -62, -35, -37, -32, 7, -58, 16, -18, -12, 79, -21, -14,
+  44, -18, 39, 39, 23, 9, -95, -76, 85, 60, -32, 39, 60, 12, 53, -32,
+  32, -7, 25, -55, -51, 39, -44, -30, -16, 48, -127, -102, 83, 28, 2, 51,
+  -32, 32, 21, -16, 7, -23, 90, 37, -18, 0, -55, -62, 25, -60, 16, 42,
+  74, 32, 88, -53, 46, 18, -35, -14, -5, -2, 7, -25, -67, 48, 12, -14,
+  51, 0, -62, 44, -67, -23, -62, 79, 60, 60, 2, -76, -55, 37, 55, -69,
+  -19, 19, 38, -27, 70, 46, 43, -35, -70, 122, 5, -22, 38, -16, -65, 5,
+  -76, 84, 54, -62, 43, 16, 38, 38, 8, 38, -38, 16, 14, 0, -8, 51,
+  -86, -46, 70, 35, 24, -73, -62, 49, -32, -27, 35, 38, -22, -5, 22, -22,
+  81, -116, -122, 8, -78, 35, 35, 86, 3, 3, 35, 54, 35, -16, 5, -73,
+  -86, -35, -100, -19, -32, 19, -27, -35, -30, 57, 41, -24, -30, 103, -49, -14,
+  -5, 19, 35, -32, 70, 65, -108, -22, 32, -19, 38, 46, -16, -119, -24, -68,
+  -19, 27, 49, -62, 19, -46, -65, 0, -59, 49, -24, 3, -41, 68, -3, 43,
+  -68, -51, -70, 14, -65, 51, -27, -70, -92, -24, 127, 43, 16, -24, -49, 24,
+  9, -42, 13, -22, -20, -72, -39, 31, 44, 26, -9, 15, -44, -20, -9, -127,
+  42, -7, -59, 33, -66, -20, 42, -11, -44, -20, -35, 64, -7, -15, 39, -44,
+  -39, 0, 20, 11, -37, -4, 22, 59, 59, -26, 9, -46, -50, 33, -20, 33,
+  13, 37, -7, -57, -44, 4, -68, 37, 26, -53, 74, 20, 4, -66, -46, 53,
+  -7, 44, 85, -39, 39, -26, -77, 9, -68, 64, -2, -57, -53, -2, 55, 22,
+  -94, -15, 72, 61, -28, -48, -57, -39, -33, 37, -48, 0, -72, 48, -11, -26,
+  22, 2, -74, 53, -35, 9, -123, -24, 9, 35, -77, -9, 59, -33, 24, 33,
+  -9, -37, 20, 9, 0, -7, -28, -4, 50, -18, 9, -9, -9, -44, 61, 11,
+  -61, -61, -20, 0, -3, 20, 43, -113, 14, 61, -17, 46, -43, -84, 46, 43,
+  23, -6, 12, 6, -78, 6, 26, -69, 14, -3, -32, 6, -32, -23, -9, 46,
+  40, 17, -84, 29, -55, -6, -6, -20, -66, -98, 20, 58, -46, -6, -89, 40,
+  -95, -20, 104, 113, 49, 29, 104, 92, 20, 38, -49, 9, -104, -3, -3, -9,
+  -43, 0, -101, -26, -32, 20, -107, 92, 32, -3, 118, 14, 29, -84, -43, -12,
+  29, 9, -98, -12, -52, -89, 124, 84, -9, 84, -63, 121, 35, -127, 26, -43,
+  -35, 40, 61, -104, -66, -14, 29, -40, 87, 66, -124, 3, 110, 3, -40, 46,
+  72, -40, 12, 26, -35, -9, -55, -12, -55, -92, -40, 113, -49, 3, -12, -84,
+  47, -47, 16, 34, -41, 127, 65, 44, -39, 109, 18, -57, 26, -80, 21, -13,
+  36, 8, 21, 23, 13, 104, -39, 83, -114, 23, 34, 36, 47, 3, 91, -98,
+  31, -49, 60, -75, -127, 39, 49, 31, 10, -91, -47, 60, 18, -13, -3, 57,
+  26, 62, 3, -26, 31, 13, 5, -34, -3, 29, 65, 88, -3, -26, -49, 54,
+  -62, 8, 60, -18, -8, 16, 18, 75, 31, -75, 49, -98, 16, 52, -29, 18,
+  65, -39, -39, -21, 3, 39, 5, 67, 41, 36, -44, -16, 54, -75, -44, -60,
+  -39, -54, 16, -91, -10, 57, 75, -62, 60, -16, 18, 41, -62, -41, -44, 5,
+  18, 0, -57, -16, -73, 52, 10, -114, -83, -3, 5, -44, 65, 44, -54, 3,
+  35, -19, 51, -81, -105, -16, 24, 70, -41, 11, 27, 35, -86, 70, -3, 19,
+  -78, -105, -27, -62, -27, 35, -3, -76, -3, -24, 24, -49, -5, 16, -14, 14,
+  65, 0, -127, 65, -105, 89, 11, -14, 62, 41, -35, 78, -8, 27, 68, 24,
+  27, -14, -16, -92, 51, -30, -19, -70, -70, 84, -95, 11, 19, -51, 32, -57,
+  32, 54, -59, -19, -19, -16, 76, -24, -86, -27, 11, -97, 100, -57, -14, -22,
+  11, -127, -35, 68, 22, -32, 5, 78, 24, -22, 0, -59, -32, 22, -73, 32,
+  70, 24, -5, 24, -51, 84, 57, -68, -24, 43, 5, -92, -43, -54, -38, -70,
+  -27, 43, -24, 22, -73, 51, 49, 3, 62, 35, 5, 65, 0, 51, 32, 59,
+  -58, 23, 75, 98, -32, 23, -49, 87, 49, -43, 32, -14, -52, -29, -84, -101,
+  -32, 38, -66, -43, 55, 46, 66, -20, -40, 49, -63, 81, 98, 72, 58, -127,
+  35, -17, 17, 61, 26, -46, 12, -55, 9, -43, -49, -14, 61, 17, 66, -6,
+  12, -14, 3, -49, -40, -43, -35, 26, -20, -63, 6, 3, -46, -61, -72, -81,
+  -115, 55, 64, -66, -110, 14, -17, 40, 35, -98, 29, 81, -101, 61, -84, 43,
+  -66, -9, -6, -58, -40, -12, -92, -69, -49, 3, -6, -49, 6, -84, -46, 66,
+  -58, 9, -29, 66, 69, -12, -9, 81, -9, -89, 121, 23, 43, 9, 92, 49,
+  29, 23, -20, -84, -9, -12, -26, -32, -17, -63, 17, 26, -69, -20, -29, -95,
+  -66, -13, 15, -2, -80, -49, -25, -25, -34, 40, 28, 34, -15, 59, -32, -70,
+  -44, -57, 17, -11, 30, 0, -2, 6, -28, 57, -17, -47, -83, 6, 30, 72,
+  44, -17, -63, -28, -6, 21, -21, -4, 4, 2, -21, -32, 42, -23, -28, 34,
+  42, 28, -70, -13, -25, -66, -47, -32, 87, 74, -13, 72, 0, 0, 64, 6,
+  -72, -11, -72, 4, 17, -17, 30, 44, -30, -2, -36, -42, 51, 15, 19, 25,
+  57, -23, -19, 0, -25, 44, -23, 8, 30, -13, 36, 34, -38, -30, 55, -17,
+  -6, -70, -2, -4, 15, 2, 72, 57, 6, -13, 8, 32, -61, 72, 6, -15,
+  55, -76, 0, -30, -127, -55, 49, -21, -2, 19, 15, 61, -28, 21, -21, 17,
+  -5, -74, -21, 16, 58, 5, -56, -79, 0, 69, 40, 45, 8, 69, -29, -127,
+  32, 64, 32, 5, 29, 19, -50, 66, 16, 40, 19, -116, -19, -85, -21, 50,
+  -74, 3, 13, -11, 26, -11, -48, 24, -45, -13, 53, -56, -40, 24, -34, -53,
+  101, 66, -42, 24, -40, -53, 90, -24, 93, -40, -19, 11, -50, -3, 32, -3,
+  66, -8, 5, -24, 11, -26, 64, -29, 26, -11, 79, 95, -40, 42, 108, 56,
+  -5, -42, -58, 24, 0, 34, 71, -66, 32, -32, 74, 37, -34, 48, 40, 29,
+  -8, 45, -69, 69, -58, -58, -40, 61, -69, 19, -66, 69, -79, 58, 40, -13,
+  13, -24, 95, 21, -29, -71, -37, -74, -32, -66, 16, 26, -19, -111, 61, -26,
+  -28, -41, 25, 25, -52, 47, -58, 72, 41, -72, -127, 6, -8, 61, 39, 39,
+  -69, -44, -30, 77, -3, -19, 11, -52, -105, -41, 6, -61, 25, 19, 36, 86,
+  -97, -97, -44, 28, 6, 108, -25, 6, -94, 75, 0, 102, 33, 11, 6, -17,
+  -19, 6, -39, 63, -28, -47, -8, -91, -50, 50, -97, 25, -19, 36, -61, -11,
+  22, -52, -28, 33, 116, -33, -36, 11, 36, -28, 124, 11, 63, -22, 25, -80,
+  19, 83, -30, -80, 86, -80, 36, 41, 47, -41, 50, -14, -44, 102, 41, -11,
+  86, -58, -47, -33, -52, -6, 55, -22, 69, 6, -50, 6, 25, 3, -17, -3,
+  -58, -30, 28, 50, 11, -22, 19, 58, 55, -3, 25, -17, -41, -17, 80, 55,
+  23, -28, -92, 30, -9, -51, 79, -12, 72, 5, 16, -35, -65, -42, -30, -30,
+  -60, 23, 32, -16, 42, 32, 0, 83, -46, 102, -2, 58, -23, 12, 65, -32,
+  -69, -12, -16, 30, -58, 18, -9, 25, 69, 9, 81, -14, 23, -58, -60, 46,
+  14, 0, -44, -5, -21, 0, -9, 9, 12, -12, 0, -2, 16, 51, -62, -25,
+  -28, 51, 32, -120, -25, -12, -23, 35, 16, 39, -18, -92, -14, 35, 46, 9,
+  -44, 46, 46, 48, -18, 21, 60, 28, 32, 37, 32, -28, -72, -9, 32, -25,
+  9, -69, -115, 85, -23, -23, -127, -21, 12, -92, -58, 53, -7, 21, 23, 51,
+  32, -42, -12, 25, -72, -60, 62, 28, -72, -25, -67, 44, 18, -35, 18, -32,
+  36, 0, -58, -2, -36, 56, -49, 20, -18, -4, 49, 33, -98, -36, -20, 2,
+  -25, -58, -94, -7, -20, -13, -127, -16, 45, -13, -91, -25, 18, 22, -47, -80,
+  -7, 27, 38, -11, 20, -116, -4, -40, -16, -18, -45, 25, -16, 49, -76, 16,
+  -98, 13, 47, 16, 38, 47, -11, 0, 80, 49, 40, -33, -40, 42, -29, 65,
+  56, -16, 20, 7, -80, 67, -38, -4, 27, 4, -7, -2, -4, 16, 45, 36,
+  11, 22, 65, -98, -67, 47, 87, -20, 27, 60, 27, -25, 2, -27, -22, 51,
+  7, 27, 11, -85, 36, 33, 67, -2, 7, -20, -9, 7, 49, -67, -45, -7,
+  16, -13, 45, 11, -7, -58, 18, 67, 4, -51, -82, -9, 87, -62, -2, 25,
+  -116, 85, -62, -3, -90, 40, 8, -23, 8, -110, -82, 82, -45, 42, -6, 93,
+  -119, 34, 28, -34, -17, 14, 14, -65, -23, -56, -71, -42, 25, -127, -71, -28,
+  23, 56, -93, -48, -3, -65, -96, -59, -65, 8, 20, -14, 45, 17, 76, 65,
+  0, 73, 45, 17, -3, 3, 31, 71, 82, -3, -6, 87, 42, 65, 62, -104,
+  6, -59, -85, -34, -107, -34, -20, 51, -11, 71, -93, 93, 48, -23, -71, -11,
+  -73, 20, -65, 34, 93, 3, 68, 14, -20, -6, 68, 76, -93, 76, 20, -14,
+  17, 14, -28, 40, -54, -23, 28, 56, 23, -71, 28, -3, 37, 104, -48, -90,
+  51, 14, 3, 28, -8, 20, -54, 65, 113, 34, -85, -42, 28, -6, 68, -51,
+  -12, 62, -48, -51, -46, 23, 53, 5, -9, 44, 58, -21, 62, -23, -14, 67,
+  -62, -16, 0, -65, 42, -21, 74, 51, -9, 83, -58, 16, 0, -76, -35, 67,
+  -92, 7, -42, 30, 12, -88, -88, 48, -14, -12, -37, -92, 51, 16, 12, -21,
+  7, -25, 12, -35, 37, -44, 12, 79, 37, -115, 42, -14, -14, -18, 48, -79,
+  -65, 69, -51, 32, -55, 51, -32, 2, -5, 67, -69, 46, 9, 65, -53, -99,
+  16, 37, -18, 32, 35, 48, -62, 37, -32, -7, 28, -39, -67, -53, -18, -46,
+  -62, 16, -21, 23, 55, 30, -127, 39, 7, -32, 21, -12, -48, -48, -46, 18,
+  21, 48, -9, -37, 0, -32, -2, -69, -48, 25, 18, 35, 12, 0, 9, 9,
+  -60, -37, -4, -6, 2, 6, 79, -85, -23, 25, -21, -2, 12, -33, -10, -29,
+  2, 10, 21, -8, 0, -29, 33, 27, -21, -15, 10, -42, -60, -29, 25, -6,
+  -29, 27, 69, -6, -79, -12, 52, -8, -2, 29, 4, -40, -87, 31, -27, -2,
+  -10, -33, 52, 83, 33, 67, 48, -12, 15, -12, 27, -10, -60, 31, 25, -67,
+  -4, -40, 27, -48, 23, -73, -98, 65, 65, -54, -8, -8, -67, 69, -15, -33,
+  -50, 62, -2, 17, -117, 23, -65, -35, 65, 42, 62, 37, -54, 52, -127, 19,
+  -31, -31, 17, 8, -44, -31, 19, 62, 15, 106, -56, 17, -12, -35, 35, -21,
+  8, -4, 4, -46, -77, -37, -44, 8, -23, -25, 44, -15, 46, 2, 4, -6,
+  -63, -48, -40, 119, 93, 58, 32, 16, 0, -69, -29, -111, -24, 26, -58, 29,
+  11, -3, -32, -63, 40, -58, 85, 29, 50, -32, 5, -108, 8, -34, -3, 48,
+  -16, 13, 21, 29, 56, 11, 45, -58, -45, -108, 32, -34, 34, 53, 40, 21,
+  -21, 74, -56, 58, -45, -63, -93, 34, -8, -13, 19, 74, 58, -69, -127, -29,
+  -85, -42, 19, -26, 32, -50, 56, 79, -24, 69, -50, 48, -19, 0, -29, 21,
+  -82, 71, 50, 16, 53, 19, -34, 8, 37, 58, -16, -42, 53, -34, -26, 34,
+  -34, 11, 58, -71, 58, -26, 3, -37, -3, 24, 50, -85, 8, 69, 58, 42,
+  26, 11, 58, 85, 90, -24, -71, 21, 13, 21, 21, -63, -79, 66, 8, -19,
+  39, 0, 36, 11, -91, -111, -45, -32, -70, -29, 57, 0, 54, 48, -45, -43,
+  -14, 7, -23, 39, -7, 2, -127, 32, -54, 41, -2, -11, -54, 9, 48, 7,
+  -34, -54, 43, -34, 77, -36, 52, -5, 32, 5, -52, 59, -54, 7, -25, 52,
+  -66, -102, 45, 25, 29, 11, -23, -18, 36, -7, -39, -39, -86, 25, 14, 5,
+  23, 14, 36, 29, -23, -7, -43, -18, -61, -59, 27, -5, 16, 57, -45, -2,
+  59, 88, -11, -45, -77, -20, -36, 14, 68, -2, 14, 77, 41, -20, 9, 2,
+  -39, -100, 14, -54, -20, 18, 9, -9, 48, 36, 34, 73, -36, -77, -39, -102,
+  68, -16, 7, -82, -39, -61, 14, -16, -32, 34, 16, 41, -25, -48, -20, 39,
+  56, -63, -59, 7, -5, -95, 37, 37, 71, -7, 34, 20, -32, -32, 5, -17,
+  12, -76, 34, -20, -42, 64, 15, -15, -76, 68, 7, 5, -12, 29, 49, 10,
+  -7, -46, 15, -24, -63, -27, -54, 64, 66, -37, -2, 27, 10, -22, 24, 22,
+  127, 20, -44, -12, -17, 2, 61, -20, -59, -73, -20, -12, 76, -88, 42, -27,
+  -12, 20, -42, -2, 39, -12, 37, -42, -54, -20, 112, -56, 59, -37, 12, -88,
+  -71, -78, -39, 61, 56, 27, 22, 56, 90, -12, -29, -7, 24, 24, -10, -29,
+  -10, 37, -44, 12, 15, -15, -68, -95, -37, 49, -32, 7, -42, 17, 59, 39,
+  -7, -85, -85, -2, -107, 12, -22, -39, 17, 12, -2, 2, 17, -46, -29, 78,
+  8, -98, 98, 41, -96, 3, 16, -18, 16, -26, -60, -91, -65, -65, 31, -111,
+  47, 3, -8, 8, -13, 26, 70, -127, -47, -21, -5, 57, 18, 60, 5, 41,
+  -10, -3, -10, 75, -47, 10, 5, 36, 3, -60, 44, 10, -57, 44, 60, 47,
+  86, 21, 5, -16, -31, -52, -5, 44, 3, 49, 47, 29, 29, -83, -106, 111,
+  -52, 21, 31, 41, -5, -52, -36, 16, -21, -41, 73, 47, -8, 0, -60, 62,
+  36, -57, 39, 21, -75, -23, -73, 39, 13, 54, -86, -114, 36, -23, -114, 106,
+  -41, -49, 67, 31, -62, -26, 78, 60, -31, 60, 34, 10, -36, -117, -13, 98,
+  -10, -23, -67, 52, -96, 52, -57, -67, 83, 23, 101, -60, 13, -3, 36, 41,
+  -30, 23, -25, -53, 91, 0, -21, 21, -47, -127, 51, -2, 72, 21, 61, 61,
+  -51, 25, 6, 23, 2, -2, 34, 53, 13, 4, 36, -44, 32, 61, 49, -6,
+  15, 21, 28, -38, -21, -53, 44, -25, -15, 49, -13, 57, -13, -91, 36, 34,
+  -76, -40, 51, 25, -30, -36, -40, -32, -19, -13, 40, -63, 49, 47, 25, -32,
+  40, 32, 55, 8, 8, 6, -15, 21, -57, 49, -87, -87, -15, 59, -74, -38,
+  19, 32, -25, -4, 40, -21, -44, -34, -38, -40, 0, 15, -25, 8, -32, -2,
+  -40, -2, 53, -28, 51, 66, 17, -38, 30, 34, 25, 19, -19, -36, -61, -28,
+  2, -47, -59, -2, 19, 51, -25, 13, -2, 11, -76, -68, -11, -63, -28, -38,
+  -24, -61, 33, -66, -28, 108, -47, 12, -28, 24, -2, -12, -21, 19, 64, -35,
+  33, -47, -14, 24, -26, 19, -94, -7, -21, -16, -49, -14, 49, 73, -5, -71,
+  -82, -38, -85, 31, 38, -94, -19, 28, -38, -19, 9, 45, -16, 73, -21, -52,
+  16, 19, 5, 59, -19, 49, -7, -80, -9, 66, 12, -45, 64, -26, -14, 66,
+  33, -14, -2, 26, -73, 52, -96, -12, 9, 19, -35, 21, -5, 0, 2, 52,
+  -19, -19, 68, 19, 42, -35, -45, 31, 68, 12, -127, -42, 24, -28, 38, 78,
+  33, 42, 111, -54, 92, -5, 2, -24, 38, -35, -7, -52, -111, 71, -45, 35,
+  -80, -33, -14, 28, -26, 2, 42, -78, -31, 38, -38, -16, 26, -59, 47, -35,
+  61, 3, 24, -95, -42, -45, -87, 32, -61, -85, -50, 34, 69, 21, 11, -98,
+  -103, 50, -8, 16, 40, -85, 56, -32, 37, -71, 48, -26, 5, 26, 50, -56,
+  -50, -66, 56, 71, 53, 74, 87, 13, 16, 61, 19, -37, 0, 13, -34, 11,
+  -11, -63, 24, -16, 8, -40, 40, -37, 45, 19, -66, -127, -74, -26, -56, 26,
+  37, 90, -16, 103, 5, 79, -37, -29, -56, -77, -5, 58, -48, -34, 19, -50,
+  -101, -11, 24, 21, -58, -82, -58, 8, -3, 13, -95, 29, 71, 56, -40, -13,
+  21, 56, 61, -5, -63, 34, 71, -16, -48, 87, 48, -3, -21, -111, 42, 53,
+  8, 87, 11, 19, 26, -61, 29, 50, -66, -21, -61, -37, -45, 42, 90, 77,
+  56, 15, -9, 56, -87, -84, -3, 62, 68, 15, 31, -59, -22, 74, -3, -46,
+  105, 19, 68, 56, -3, 59, -40, 15, -124, -25, 68, -9, -40, -53, -6, -124,
+  62, -65, 96, -53, 99, 127, -93, -56, 59, -87, -50, -19, 56, 0, 0, 43,
+  53, -40, 43, -12, 90, 25, -102, -77, 40, -74, -15, 37, -71, 46, -25, 22,
+  31, -31, 68, 62, -28, -59, -34, -43, -112, -90, -62, 34, 31, 28, -3, 50,
+  -65, 37, 15, -22, 56, 3, -53, 9, 6, 127, -9, -12, -15, -43, -50, -81,
+  118, -15, -62, -121, -28, 3, -9, -84, 68, -74, 71, 28, -19, -53, 19, -19,
+  9, -25, 15, -96, 59, 56, 31, -6, -102, 19, 12, 99, -115, 99, -22, 53,
+  48, 50, 21, 10, 40, 25, -8, -2, -54, 27, -44, 25, -92, -79, 35, -23,
+  35, 10, 4, 8, -44, 8, 17, -21, -19, 67, -29, -10, -12, -8, -44, 21,
+  0, 35, -6, -44, 12, -104, 29, -31, -92, 54, -12, -25, 35, -44, -48, -52,
+  -6, 29, -17, 79, -25, -54, 0, -73, -67, 62, -2, -58, 10, 25, 25, 25,
+  -31, 25, -4, -52, 67, 19, -127, 8, 6, 37, 100, 33, -87, 50, -40, 15,
+  48, 35, -71, -46, -21, -29, 54, -54, 27, -50, -10, -60, -23, 0, -23, 2,
+  19, -40, 27, -44, 6, -12, 46, 48, 27, -6, -50, 52, 50, 8, 4, 42,
+  -100, -4, 44, -33, -25, -44, 69, -25, 42, 0, 79, 6, 0, -67, -83, -50,
+  40, -54, -65, 104, 85, 68, -31, 76, -45, -23, 56, -11, -45, -3, 42, 45,
+  34, -28, -51, -65, -25, 54, 54, -6, -127, 59, 40, -48, 8, -71, -8, 85,
+  23, -68, -56, 6, -56, 62, 34, 17, 8, -71, -25, -14, -6, -79, -51, -25,
+  79, 6, -8, -82, 11, -51, 3, 20, 59, 25, 45, 54, -45, -11, -28, -6,
+  -54, 11, 0, -65, 31, 0, 59, -8, -34, 31, -28, 102, 14, 45, 23, -99,
+  54, 14, -11, -82, 34, 65, 73, -11, 51, 51, -37, -11, 87, -68, -71, 6,
+  -31, 73, 28, 20, 119, 65, 0, 62, 37, 37, -54, -28, -116, 6, 17, -87,
+  45, 85, -40, -17, -54, 23, -116, -25, 25, -68, -6, 99, 11, -99, -87, 23,
+  40, -45, 24, -21, 11, 13, 40, 5, 34, 79, -95, 24, 32, 37, 74, 24,
+  90, -69, 8, -16, -95, 5, -21, -48, -77, -87, 5, -98, -29, -74, 5, 13,
+  127, 50, 40, -106, -34, 108, -8, -56, 29, -82, -74, 48, -116, -13, -53, 37,
+  69, 26, -19, -13, 29, 16, 40, -95, 48, -42, 3, 48, 29, -87, 19, 101,
+  24, 40, -16, 26, 77, -71, -85, 42, 77, -13, -19, -21, -5, -24, 29, -56,
+  5, -122, -71, -11, -19, -114, 24, 3, 64, -16, -53, -29, 103, 8, -19, 34,
+  24, -56, 58, -26, 5, 32, -29, -24, -50, 66, 53, -34, -26, 0, -11, 24,
+  -16, -71, 45, -53, 32, 66, -95, -119, 69, -21, 3, -74, 5, 71, 16, 77,
+  2, 42, -72, 77, 127, 2, 25, -32, -52, 7, -5, -82, 25, -57, 50, 25,
+  65, 5, -77, 60, -27, -92, -7, 55, -35, 67, 37, -47, -2, -25, -47, 25,
+  17, 35, 25, -60, -22, 50, 2, -77, -17, 90, -55, 12, 15, -77, -42, -62,
+  -40, -10, -112, -7, -85, -27, -47, 82, 57, -5, 35, 25, -20, 60, -77, -32,
+  10, 12, 55, -5, 82, -67, -52, 5, -10, 67, 62, -90, -80, 72, 5, -32,
+  -2, 120, 45, -15, 25, -67, 70, -85, 2, 32, 52, 5, 17, 30, 55, -47,
+  -57, -65, -32, -52, 7, -22, -7, 42, -25, 60, -7, 25, 67, -55, -62, 82,
+  -7, -37, -22, -25, 45, -82, 25, -7, -77, -87, 0, 17, -2, 25, 15, 77,
+  30, 8, -52, 56, -20, -113, 0, -16, 58, -30, -4, -42, -30, 10, -20, 62,
+  32, 14, 20, -58, 38, 52, 22, -10, -8, 58, -8, -24, -4, -65, -28, -30,
+  -58, -4, -8, 0, 75, -119, -87, -12, -20, -62, -14, 8, 4, 30, -8, 6,
+  -32, -16, 14, 46, 71, 18, -4, 60, -58, -40, 38, 56, -6, 34, 6, -85,
+  -30, -34, -30, 8, 14, -26, 56, -30, -4, 4, 28, -14, 40, 2, 0, 26,
+  40, -16, -52, 40, 54, -6, 20, -36, 30, 18, 77, -28, -71, 4, 42, -48,
+  -2, 18, -95, -44, 8, -26, -69, -40, -30, -22, -8, 0, -40, 127, 38, 4,
+  36, -22, -18, -34, 8, 46, -16, 65, 4, 30, 36, 18, -2, 44, 34, -2,
+  30, -57, -24, -5, 54, 24, -108, 5, 0, 81, 113, 8, 5, -24, -78, -24,
+  51, -46, 41, -11, 5, -57, 62, 30, 81, -70, 22, -38, -81, 86, 16, -8,
+  30, -24, -46, 8, 32, -8, 41, -78, -46, 0, -32, -8, 11, -49, -97, -97,
+  38, -54, -73, 97, -43, 57, -54, -57, 59, 14, 65, -73, -57, 30, -46, 27,
+  32, 43, -57, -35, -30, 92, 32, -32, -19, -22, 122, -8, -119, 32, 127, 68,
+  43, -89, 22, -95, -19, -54, -70, -54, 32, 0, 8, -35, -27, 16, 30, 41,
+  22, 103, 92, -5, 38, -84, 16, 54, -100, 84, -68, 49, -51, 54, 14, 100,
+  -95, 43, -59, 32, 11, 41, 27, -81, -14, -54, 49, 32, -22, -14, 0, 14,
+  13, -65, -26, 36, -3, -44, 16, 36, 23, -36, -5, 41, -8, 52, -21, -10,
+  -5, 96, 31, -31, 10, 21, 47, -13, -13, 54, 0, -67, 5, 13, 18, 78,
+  -49, -91, -62, 54, -39, 41, -31, 54, 5, 26, 5, -109, 88, 47, -5, 44,
+  21, 67, -60, -98, 13, -41, -57, -10, -60, -106, -10, 21, -65, -31, -62, -47,
+  -10, 31, 36, -65, -29, -13, 3, 23, -67, 96, 21, 10, 60, -47, -18, -119,
+  -60, 93, 23, -29, 21, 0, 18, 60, -16, 62, 65, -65, -54, 49, -127, -29,
+  39, -80, -117, 52, -36, 8, -106, -16, 54, -91, -44, 5, 0, -60, 73, 67,
+  54, 31, -3, 5, 3, -44, 3, 44, 91, -39, -34, 47, -91, 31, 13, 8,
+  52, -83, -26, -78, -3, 73, 83, -39, -34, 41, -96, -10, 8, 31, -23, -93,
+  -96, -54, 52, 16, -70, -65, 16, -70, 18, -23, -18, 78, 127, 65, -21, 75,
+  -54, -36, 26, 34, 23, 18, -16, 57, 39, -80, 29, -41, 10, 78, 0, -39,
+  0, -29, 49, 86, -86, 67, -5, -31, -18, -18, 41, -47, -34, -16, -13, -10,
+  18, 21, 62, -34, 67, -31, -70, 57, -49, 34, -5, -60, 36, 5, 8, -26,
+  -83, 5, -3, -44, -18, -119, 67, 34, -26, 3, 44, 73, -8, 49, -83, -49,
+  44, -41, 57, -3, 0, -78, -93, -26, 36, 83, 39, 0, 16, -52, 26, -10,
+  34, -13, -78, 16, 26, 91, -83, -23, 70, -5, 21, 10, -73, -16, 31, -26,
+  11, -37, 95, -63, 21, 0, -42, -32, -21, 13, -26, -24, 45, -11, 37, 40,
+  24, -53, 79, 64, 77, 48, 21, 24, 24, -29, 66, -63, -56, 77, -29, -58,
+  29, -32, -42, 42, 13, 8, -8, 61, 0, 37, -24, 8, 3, 0, -53, -50,
+  -3, -21, -85, -93, -63, -29, -71, -61, -32, -87, -127, -26, -34, 56, 13, 19,
+  48, -53, 58, -21, 13, 56, 3, 16, -61, -24, 21, -3, 61, -8, 42, -29,
+  13, -48, -29, 58, 34, -42, -56, 45, -85, -24, 45, 24, -37, -40, -63, -5,
+  32, 48, -87, 26, 42, 48, -114, 11, 42, 90, 19, -45, -26, -21, -50, -13,
+  -34, -26, -26, 16, 71, 16, -101, 21, 64, 71, -63, -40, -69, -8, 19, 13,
+  0, 51, 65, 34, 127, -45, -79, 23, 73, -14, -37, 54, -25, -68, 40, 90,
+  -65, 17, -3, -34, 54, 34, 25, -17, 6, 3, 11, -76, -71, 82, -76, -82,
+  -79, 6, -6, 42, 0, 71, 25, -37, -23, -34, -14, 62, -17, -34, -73, 0,
+  -65, -11, 11, 42, -99, -87, -90, 20, 45, 85, -28, -65, 96, 0, -31, 62,
+  -28, 25, -23, 59, -82, -23, 93, -3, 37, 17, 11, -59, -51, -71, -6, 65,
+  45, -48, 20, -11, 8, 54, -79, 20, 37, -28, -65, 28, 54, -99, 90, 17,
+  -90, 71, 37, 34, 51, 8, 28, -62, -45, -20, -65, -40, -3, 14, 42, 102,
+  42, 14, -45, 34, -45, -99, 42, 28, -42, 11, -59, -48, -68, 68, -42, -68,
+  -17, 44, -32, 2, 46, -117, 5, -39, 76, -54, 22, 105, -17, -63, 0, -46,
+  -54, 34, 46, 17, 24, -27, -37, 24, 17, 39, 73, -46, -61, -49, -90, -100,
+  -51, -71, -37, 49, -20, -88, 22, 27, -10, 2, 39, 12, -32, -39, -100, -2,
+  -10, -83, 90, -76, -7, -78, 15, -42, -5, -12, -59, -24, 20, 61, 17, -83,
+  46, -24, -37, -63, 46, 12, 61, -51, 34, -42, -24, -2, 34, -46, -24, 22,
+  37, 24, 24, 64, -44, 24, 85, 22, 5, -27, 66, 54, -76, 24, 34, 46,
+  -93, -15, -112, 15, 20, 68, -12, -5, 42, 64, -85, 44, 127, 29, 2, 12,
+  7, -81, -71, -29, 83, -39, -32, -10, -71, -59, -54, 15, 22, -59, 22, 68,
+  -24, 7, -43, -10, 26, -10, 58, -38, 48, 19, -69, -43, -53, -24, -127, -84,
+  -29, -58, -65, -67, 50, 10, 74, -2, 65, 22, 2, -14, 5, 12, 5, 22,
+  38, 74, -10, 2, -41, -50, 72, 19, -19, -72, 50, -110, 72, 58, 65, -2,
+  -53, 93, -58, -65, 43, 0, -91, 10, -46, -81, 53, 24, -62, 5, 29, 10,
+  14, 58, 0, -17, 14, 41, -65, 55, -43, 2, -5, 26, -46, -26, -2, -12,
+  -34, 48, 48, 17, -10, 5, 81, -19, -74, 96, 17, 34, 12, 38, 7, 46,
+  5, 2, 55, -31, -12, -65, -34, -29, -26, -58, 53, -69, -2, -67, -67, -38,
+  14, 22, 93, -24, -19, 12, -19, 24, 36, -12, 5, -55, 7, 24, 7, -29,
+  -39, -26, 34, -18, 3, 78, -23, 16, -29, -10, -49, -54, -41, -73, -96, -29,
+  5, 39, -49, 29, 41, -13, 70, -18, -21, -5, -34, 23, 34, -13, 54, -57,
+  -44, -127, -10, 70, -41, 5, 5, -16, -39, -36, 5, -10, 10, -70, -41, -21,
+  -5, 29, -8, -23, -23, 78, -60, 44, -3, -80, 54, -39, 5, -31, 29, -44,
+  -114, 0, 49, 3, -34, 67, 98, 0, 86, -5, 124, -44, -111, 36, 60, 39,
+  13, 5, -18, -57, 5, -8, 54, -70, -21, 31, -36, -49, -10, -73, -41, 31,
+  -75, 75, -13, 88, 29, -101, 60, 96, 36, 86, -49, -39, -18, 23, 10, -23,
+  10, 73, 49, -62, 39, -70, -98, 41, -54, -3, 54, 23, -60, -36, -13, 36,
+  -4, 33, -4, -7, 4, -80, 40, -45, 40, -20, 45, 4, 13, -25, -11, 58,
+  13, -16, 40, -53, -2, 47, 31, 7, 22, -7, 71, 38, -29, -31, 42, 25,
+  94, -42, -9, 31, -36, 127, 22, 29, 20, 51, 27, -29, 45, 13, 111, 67,
+  96, 2, -4, -33, 45, 22, -49, -18, -82, -45, 33, 16, 25, -65, -47, -47,
+  -29, -27, -20, 49, 27, -51, -22, 0, -71, -36, -4, -118, 29, -56, -31, -89,
+  16, -2, 7, 91, 49, 40, -80, 22, -11, 16, 40, 9, -56, 42, -25, 9,
+  -9, -51, -65, 33, -36, 29, 7, -111, 13, 13, -25, -56, -29, -107, -9, 31,
+  60, -82, -9, 33, 4, 58, 29, -18, -7, 27, 13, -49, -27, 20, 11, 76,
+  20, -70, -34, -50, 64, 111, 36, -57, 59, 11, 16, -2, 57, -61, -29, -39,
+  -98, 5, 50, 11, -36, -27, -127, 57, 54, 52, -9, 73, 29, 36, 5, -88,
+  -7, -39, -9, 93, 2, -77, 29, 41, -16, 23, 57, 25, 0, 23, -84, 14,
+  -77, -16, 14, 16, -18, -68, 16, -7, 0, -7, 16, -59, -43, -11, 41, -7,
+  -11, 41, 36, -18, -5, 14, 36, 25, -11, -9, -79, -61, -25, 18, -5, -34,
+  52, 66, 43, -39, -54, -25, -23, 61, 5, -7, -79, 75, -39, 16, -77, 5,
+  -11, -5, 20, 88, -39, 77, -23, -2, 41, -34, 0, 36, 50, -50, 39, -2,
+  -5, 2, -27, -2, -34, -59, -50, 9, 50, -18, -9, 41, 29, -2, -11, -68,
+  19, -61, -85, -108, 5, -26, 11, 40, -26, 16, -19, 79, -42, -95, -48, -26,
+  -69, -50, 3, -8, -19, 53, -3, -61, -103, -8, 21, 87, -29, 34, 82, 48,
+  -116, -58, -56, 106, -58, -8, 37, 37, 71, 98, 13, 37, 45, -63, -37, 77,
+  -58, -93, -29, 24, -114, -13, 50, 13, 40, 45, -85, -11, -5, 53, 61, -63,
+  -63, 98, 26, -21, -26, 16, 127, 64, 11, -37, 40, -114, 34, 16, -21, -85,
+  29, 3, 82, -32, 29, 53, -45, 3, -29, -13, -45, 11, -34, 16, 34, -58,
+  -3, -26, -66, 66, -13, 11, -11, 21, 26, 21, -32, 61, 82, -77, 8, 13,
+  69, -32, -69, -45, -40, -45, 56, -24, -3, 8, 58, 122, -29, -63, -45, 50,
+  -3, 28, -127, 37, 59, 17, 51, -20, 40, -3, 59, -11, 90, 96, 6, -3,
+  11, 14, -34, 0, 25, 3, 48, 82, 11, 82, 48, 3, -17, -42, 76, 79,
+  107, -99, -45, -51, 34, 51, -62, 25, -51, 34, -54, -45, 65, -68, -56, 42,
+  -8, 65, -54, -54, 17, -37, -23, 8, -48, -119, 93, -37, -28, -51, 56, -54,
+  34, 11, -37, 71, 76, 68, -6, 6, -17, -42, -8, -6, -45, -37, -48, -23,
+  79, 40, 102, 73, -59, 87, 79, 28, -25, 25, -31, 59, -99, -42, -3, 8,
+  3, 40, -82, 51, 17, 3, -82, -113, -3, -48, -54, 0, 40, -102, 25, 31,
+  -34, -23, 90, 56, -54, -54, 93, 17, -54, -31, -82, 14, -79, -28, -3, -14,
+  67, 19, 32, -9, -9, -37, -26, -16, -5, -37, 12, -5, -21, 41, 14, -4,
+  12, -41, 48, -7, 11, 11, 18, -32, 53, 34, 19, 9, 18, 19, -26, -12,
+  -32, 21, -42, 4, 86, -127, 34, 46, 5, 12, 44, -12, 7, -2, 14, -35,
+  -48, -78, 7, 23, -41, -32, -14, 4, -9, 21, -58, 11, 49, 18, -49, -19,
+  60, 7, -37, 42, -26, 37, 21, 0, -62, 46, 2, -7, 42, -48, -9, -11,
+  -37, -28, -7, 41, 55, -44, -48, 42, -7, 12, 16, 58, 35, -19, 5, 7,
+  -26, -37, -4, -7, -37, -26, -14, -4, 30, -12, 49, 2, 34, -19, -65, -26,
+  -4, 5, 0, 0, 35, 11, 39, -12, 25, 28, -34, -9, 0, 11, -32, 18,
+  -3, 49, 67, 34, 8, -16, 23, -88, -21, 80, -8, -73, 16, -26, -111, 57,
+  70, -10, 73, -34, 18, -36, -34, -5, 34, 78, -52, 10, 3, 36, -21, -26,
+  -26, -26, 36, 10, 127, -114, -65, 60, 44, -86, 5, 39, -49, 31, 36, 3,
+  -70, -31, 18, 16, 39, 41, -78, 73, -47, 13, 67, 23, 23, -16, -13, 0,
+  -26, -75, -91, 49, -34, -31, 91, 13, -39, 34, 86, -10, 26, -39, 18, 49,
+  21, -109, -52, 31, 60, -31, -109, 36, 16, 75, -13, -13, -16, 44, -86, -86,
+  -117, 29, 57, -21, -73, -60, 52, -16, 3, -44, 0, -21, 54, -54, 3, -8,
+  -78, 73, -47, -36, 31, 57, -39, -47, -29, -23, -54, 34, -3, 47, -3, -49,
+  43, 81, -52, -38, 69, 69, 32, -29, 52, -63, -29, 61, 75, -72, 72, -6,
+  -12, -12, 46, 40, -14, 81, -84, 69, -110, 17, 64, 0, -20, -23, 3, -9,
+  -49, 43, -9, -66, -14, 89, -9, 6, 46, 87, 52, -75, -6, -46, -52, 0,
+  43, 43, 23, 6, -95, -87, 118, -58, -81, 58, -81, -23, 46, -12, -14, -9,
+  35, -38, 6, 26, 55, -78, 12, 23, -66, 72, -52, -17, 55, -89, -12, -101,
+  -49, -9, -38, 61, 61, -29, 89, 46, 6, -12, 9, 113, 29, 26, 52, 6,
+  -52, -81, -78, -9, -14, 127, 46, -95, 38, -55, -58, 29, -35, 23, -9, 20,
+  23, 3, 43, 115, 49, -14, 92, -12, -6, 12, -58, 0, 23, -52, -6, -12,
+  -26, -52, 32, 61, 26, 26, -52, 6, -17, -6, -75, -66, 38, 40, -61, -55,
+  35, -95, -92, 38, 66, 46, -98, -49, -17, -29, -29, -32, 3, -61, 55, -87,
+  0, -81, -29, 69, 29, -121, 64, 0, 17, 23, -14, 89, 58, 40, -66, 64,
+  -52, -66, 43, -81, -17, -87, -46, 14, -40, 46, -26, -127, -46, 52, 12, 12,
+  -6, -40, -78, 81, -75, 20, 40, 84, 12, -98, 75, 20, -58, -104, -17, 75,
+  89, -26, -29, -52, -89, 43, -66, -49, 89, -63, -46, -46, 35, -95, -66, 75,
+  -89, -61, -35, -55, -55, 49, 75, 26, 38, 12, 49, 35, 17, -58, -72, 40,
+  20, -66, 124, -26, 23, -23, -14, -6, 40, 55, 64, -43, -26, -87, -3, 12,
+  35, 2, -10, -15, -8, -35, -2, 2, -33, -77, 48, 35, 69, -21, 4, 12,
+  -21, 31, 29, 4, 40, 17, 52, 67, 33, -23, 31, -12, -6, -90, -12, -52,
+  -58, 21, 54, 25, 60, -94, -31, -2, -69, 8, -42, 25, 4, -25, -27, -12,
+  -33, -50, 127, -33, 35, 62, 62, 73, -48, -44, 33, -8, -21, 85, 42, -79,
+  33, -4, -56, 0, 0, 37, -40, -19, 17, 37, 42, -12, 19, 69, -60, 6,
+  -58, 4, -23, -8, 25, 27, 19, -73, -56, -54, 90, -19, -67, 29, -29, -29,
+  -12, 17, -104, -6, -23, -8, 6, 50, -23, 77, -21, 0, 31, -37, -35, -81,
+  -19, 25, 17, -52, 31, 6, 12, 67, -10, -40, 44, -27, 44, 25, 0, 25,
+  -15, 42, -22, 28, -74, 15, 44, -46, -26, 61, 74, -22, 46, -11, -13, 22,
+  83, 7, 37, -2, -46, 42, -13, 70, -4, 33, 33, -9, 20, -2, 15, -99,
+  103, 44, 50, -72, -79, 55, -59, 53, -7, -59, -59, 33, -72, -24, 15, 24,
+  72, -35, 7, -22, 53, 66, -9, -39, 44, 44, 2, 31, 15, -31, 44, -20,
+  22, -11, -7, -33, -55, 9, -59, -22, 39, -4, -39, -77, -33, -22, 42, 46,
+  57, -88, -50, 44, 4, 39, -70, 24, 35, 39, 9, 50, -26, -24, 13, -50,
+  -35, 9, -15, -2, -7, -7, -26, -88, 7, 9, -7, 26, -48, 15, -7, 20,
+  0, -61, -88, -70, -53, 24, 24, -127, -50, -20, 0, -20, 2, 9, 7, -39,
+  44, 22, -48, -123, -20, -50, 57, -59, 15, -26, -20, 50, 31, 26, 31, -66,
+  -66, -28, -2, -37, -31, 0, -46, 15, -2, 70, -44, 33, 28, 37, 35, 31,
+  9, 105, 57, -26, 42, -116, 48, 42, -31, 35, -18, -44, 9, -24, 46, -15,
+  7, 13, -26, -26, 2, -28, -26, -24, -15, 37, -24, -61, 26, -2, 53, 77,
+  -53, 94, -50, 57, 20, 7, -83, 46, -2, 88, -46, -57, -94, -9, -55, 37,
+  -127, -26, -13, -31, -44, -61, 7, 13, -50, -11, -35, -18, -20, -13, 35, 9,
+  4, -57, 59, 20, 55, -11, -33, 15, 39, -37, 79, -15, -11, -2, -123, -33,
+  -61, -50, 28, 2, 4, -50, 46, -39, 24, 15, -44, 15, 37, 0, -35, 15,
+  -17, 93, 39, 15, -39, -7, 10, -22, -54, 51, 54, -44, 68, 10, -66, 20,
+  5, -61, 10, 0, 93, -10, 59, 10, 32, 61, 20, -51, -20, -10, -22, 68,
+  -93, 29, -27, -17, -12, 54, 85, -56, 22, 37, 54, -71, 46, 22, 22, 17,
+  17, -46, -37, -22, -56, -27, -20, 37, 127, 37, -51, -24, -49, -32, -66, -56,
+  -22, 17, 0, 66, -44, -22, 51, 15, 2, -46, -78, -15, -24, 29, 10, 46,
+  12, 81, 34, -68, -22, 54, -39, 42, -78, 112, 5, 54, 88, -73, 17, -2,
+  32, 22, 7, -49, 56, 2, 32, -68, 46, -12, 32, -12, -61, -85, -39, 27,
+  64, 76, 5, -7, -22, -39, -56, 44, -115, -12, -20, -20, -29, 56, -54, 46,
+  69, 105, 91, 41, 25, 25, 75, 36, -36, 39, 0, -86, 50, -69, -39, 99,
+  11, -127, -25, -33, -8, 72, -119, -66, -28, 17, -25, 33, -3, 50, 39, -41,
+  -91, -47, 52, 33, -30, 41, 6, 55, 44, -25, -55, -39, -52, 33, 44, 41,
+  -75, -11, 44, -22, -44, -19, -41, -6, -44, -22, -69, 63, 25, 33, 0, 33,
+  -55, -55, 17, 80, -66, -33, 14, 61, 55, -52, 58, -61, 25, -22, -105, -61,
+  124, -33, -28, 8, 88, -14, 28, 55, -50, 28, 3, -28, 33, -86, 50, -69,
+  -69, -55, -41, -99, -25, 0, 69, -22, 3, -127, 50, 25, 86, -88, -36, 0,
+  -8, -39, 55, 36, -6, 58, 11, -52, -69, -55, -28, 22, 28, -77, -39, -41,
+  -5, -122, -61, 29, 85, -78, 15, 20, -39, 24, -39, -22, -22, -37, 39, 5,
+  73, -37, -39, 42, -95, 0, 10, 7, -42, -24, -15, 5, 66, 51, 49, -42,
+  32, -2, -10, 17, -32, -49, 5, 0, 32, -61, -17, -5, -17, 37, 29, 7,
+  27, 90, -78, -29, 10, -7, -127, -61, -24, -61, -20, -20, 66, 0, -110, -34,
+  -29, 68, 39, -59, 32, -2, -85, 0, -73, 44, -32, -22, 46, -49, 15, -34,
+  -39, -61, 12, 15, -2, -54, -46, -34, -20, 42, -90, -88, -49, 20, -54, -20,
+  -5, 37, 56, 29, 34, 7, -66, 2, 29, 29, -24, -71, -15, -56, -12, -27,
+  49, 0, 15, -7, -49, 46, -61, -15, 39, -24, 17, -76, -10, 5, 27, -59,
+  32, 105, 55, -25, 0, -47, -7, 5, -2, 52, -27, -65, 0, -15, -17, 65,
+  52, 10, -27, 47, -32, 30, -5, -2, 120, 7, -20, -5, -22, -85, -25, -60,
+  55, -2, -52, -62, 20, 45, -2, -5, 2, -77, -110, -57, -22, 27, -17, -50,
+  -12, -10, 7, -77, -2, -10, -17, -25, 17, -67, -50, 27, 30, 55, 0, 15,
+  15, 27, -10, -60, -57, -15, -15, -47, 70, -2, -95, -35, -10, 87, 50, 97,
+  25, 10, -37, -5, 30, -67, 82, -25, -127, -77, 37, -12, 42, -77, 45, 5,
+  20, 47, 10, 45, -12, -95, -17, -12, 15, 62, -5, 32, 95, -42, -35, -57,
+  -65, 42, 47, -65, 17, 65, -55, 72, 7, 17, 37, -77, 57, 32, -42, -60,
+  68, 20, 41, -20, -6, -23, 35, 41, 51, 4, -55, 29, -47, -10, 18, -59,
+  -53, 25, -35, 23, -29, -29, 39, -63, 25, -8, -47, 51, 78, 29, 4, -29,
+  -43, 2, -45, 35, 31, 29, -27, 14, 0, -2, 4, -39, 23, 41, 2, -12,
+  -25, 23, -25, -29, -53, 33, 10, -41, -59, -37, -6, -31, -18, -8, -66, 31,
+  -70, 18, 29, -20, 2, 51, -18, -16, -66, -2, -43, 68, 10, -14, -43, -29,
+  -68, 4, 2, -41, -27, -68, 41, 53, -76, 8, -25, -74, 37, -14, -47, 20,
+  31, 16, -29, 41, 10, -23, -53, 31, 25, -33, 27, 4, 47, -51, 35, -18,
+  12, 127, 25, -20, 74, -2, 23, 45, -25, -2, 14, 20, -12, 55, 35, 31,
+  44, 35, 6, -44, 41, -48, -67, -16, -35, 73, 6, 10, -57, -48, 79, 60,
+  32, -51, -51, 51, -108, 79, 13, -67, 41, -105, 76, 70, -67, -73, -35, 92,
+  44, 70, 3, -76, -60, 16, -86, -54, 25, -44, 0, -48, -19, 16, -19, 10,
+  89, 64, -44, 22, 41, 127, 44, 67, -70, -16, -41, 98, 44, 32, 89, 3,
+  -73, -70, 13, -124, 124, 10, -16, -54, 89, -13, 102, -86, -48, 32, -29, 79,
+  73, -22, -114, 16, 48, -114, 102, 3, -54, -51, 76, 51, -89, -98, 29, -92,
+  16, -54, 67, -48, 10, -48, 83, 102, -57, -76, 51, 48, 60, -13, -98, -38,
+  -57, -54, -73, 64, -22, -25, -19, -44, 92, 86, 127, 10, -3, -41, -92, 25,
+  8, -17, 0, -66, -88, -88, -44, -19, -50, -105, -86, -11, 52, 28, 72, 52,
+  -61, 94, -22, 61, 0, -22, 0, -33, -75, 14, 22, 30, 75, 47, 61, -33,
+  -8, -39, 25, -44, 55, -75, -3, 28, 25, 69, -25, 25, -80, 6, 30, 66,
+  58, 66, 102, 41, 55, -19, 52, 25, -94, 58, 6, -63, 52, -11, -94, 11,
+  66, -19, 33, 58, 3, 50, -75, -41, -72, 86, -25, 72, 41, 6, -36, -69,
+  -25, 41, 0, 77, -14, -33, -66, -80, 77, -25, -61, -6, 11, 6, 47, 127,
+  0, -55, -44, 3, -28, 86, 97, 47, -33, -39, -6, 41, 52, 6, -19, -39,
+  66, -6, 66, -25, 6, 11, -6, -91, 25, -6, 3, -83, -83, -36, 66, -52,
+  -9, -12, -81, 40, 56, 34, -9, 3, 71, 25, -71, -65, 6, -50, -12, -6,
+  93, -31, -46, 34, -53, -22, -40, -65, 6, -3, 31, -77, -108, 59, -40, -77,
+  108, -71, 22, -59, 99, 65, 0, -90, -71, 34, 19, -71, -22, -25, -50, -6,
+  -40, 31, -9, 68, 90, 50, 25, -65, -68, -102, 9, -53, -121, -50, 28, 53,
+  -12, -6, -3, 50, 46, 6, -31, -31, 3, -77, -12, 43, -37, 43, 65, -46,
+  28, 6, 9, 81, 6, 3, -25, 31, 43, 65, -9, 115, -68, 74, 46, -25,
+  37, 50, -25, 15, -25, -19, 71, -28, 34, -6, 22, 112, 37, -71, 40, 3,
+  -40, 12, 65, -62, 87, 43, 25, -62, -12, -46, 31, -31, -127, -34, -37, -105,
+  -13, 79, -66, 37, 56, 26, 61, -45, 61, -24, -50, 101, 5, 61, 0, 19,
+  29, 95, -21, -16, 21, -34, 37, -19, 29, -3, 37, -74, -48, -66, 19, 82,
+  106, -37, -29, -79, 11, 16, -58, 48, 16, 127, -37, -61, 13, 5, 53, -48,
+  69, 116, -82, 50, 32, -21, 24, 16, -87, -37, -19, -24, 82, -122, -66, 8,
+  -32, 13, -26, 90, 58, -69, -53, -8, -50, 40, 40, 90, -29, -29, -29, -87,
+  -66, 19, -32, 53, 50, -32, -42, -79, 0, -50, -34, 3, -5, -45, 64, 56,
+  69, -13, -40, 11, -40, -29, -5, 40, 19, -24, 61, -45, -63, -42, -26, 32,
+  -21, -71, 106, 106, -11, 69, 45, -53, 45, 61, 0, -19, -87, -34, 48, -11,
+  70, -30, -39, -88, -48, -115, -67, -6, 54, 6, -85, -15, -79, 73, -15, 12,
+  21, 30, -67, 45, -30, 60, -127, -21, -36, -18, 30, 18, -79, 15, -112, -82,
+  30, 57, -82, -51, 12, 21, -36, 57, 82, 21, -79, -79, 24, -109, -76, -67,
+  118, 51, -88, 0, -30, -6, 6, -100, -60, 18, -109, 54, 76, -3, 94, -60,
+  3, 27, -9, -12, 12, 12, -6, -42, 60, 42, -88, 24, 3, -57, 42, 18,
+  -63, -60, -12, -45, 24, -124, 24, 12, -18, -39, -27, 91, 94, -94, 88, -15,
+  -6, -103, -94, 0, 33, -36, -82, 79, 76, -109, 97, -12, 30, 127, -70, 3,
+  12, -57, -18, 33, -27, 85, 45, -67, 85, 42, -39, 36, 3, 42, 70, -79,
+  -22, 105, 60, -77, -17, -2, 32, 62, 70, 57, 70, 77, 97, -57, -27, 10,
+  -92, -32, 7, -75, 35, 10, -27, 5, -85, 15, -17, -32, -32, -22, -50, -40,
+  -122, 22, -15, 45, -67, 100, 50, 10, -47, 7, 52, -52, 105, 20, 32, 32,
+  42, -75, -75, -52, -97, -2, -32, 7, -30, 65, -47, -27, 30, 27, -2, -37,
+  -80, -37, -2, -30, -52, 57, 30, 45, -47, 22, 35, -45, 15, -127, -55, -2,
+  20, -80, 70, -2, 52, 50, -22, 30, 15, -17, 35, -80, -15, -50, 22, -15,
+  -12, -85, -50, 27, -12, 20, -52, -35, -32, -82, -17, -12, 20, 10, -35, 7,
+  42, 2, 45, 62, 0, -35, 80, 72, -12, 40, -15, 15, 105, 0, 70, 0,
+  60, -70, 76, -57, -76, -21, 39, 79, -63, -70, -82, -6, -70, 54, -45, -36,
+  -94, -27, -24, -21, -45, -48, 54, -63, -27, -27, 103, -9, 15, -33, -39, 27,
+  33, 127, 51, 12, -21, 15, -15, -27, -57, 42, -54, 109, 63, 3, 51, -67,
+  -70, -57, -30, 51, -18, 9, 3, -106, -6, 118, 21, 57, -73, 51, 3, 33,
+  9, 33, -24, 18, 6, 3, -82, 51, -45, -33, -12, 6, 24, 115, 54, -12,
+  -57, 67, -118, -12, 21, -70, 3, -70, 21, -18, 60, -63, -85, 45, 94, -33,
+  88, -63, -24, -18, 67, -39, 57, 79, 109, 45, -15, -57, -76, 70, -3, -30,
+  -24, 18, 21, -42, 15, -33, -3, -27, 0, 36, 48, 76, 12, 33, 6, 100,
+  -51, 69, -30, 37, -60, -30, 37, 18, 28, -28, -60, 42, 9, 62, 51, -46,
+  -2, -44, -30, -51, 44, 2, 21, 32, 12, -21, -55, -58, -28, -28, 46, 79,
+  -7, -37, 79, 28, 14, -35, 53, 5, 9, -7, 53, 35, -65, 42, -25, 42,
+  -18, 51, 60, -79, -28, -28, 62, 23, 30, 32, 0, -62, 25, -42, 28, -42,
+  5, 35, -39, 51, 55, 18, 21, 51, 32, 81, -46, -21, 16, -95, 9, -32,
+  -55, -79, -18, 12, -37, 30, -7, 12, 5, -92, -95, -65, -28, 51, -37, 39,
+  23, -23, -18, -14, -25, 51, 30, 30, -37, 35, 37, -127, 12, -35, 37, 25,
+  -18, -55, 35, 32, -53, -42, -28, -23, 79, -53, -46, -46, 58, -2, 46, 69}
+;
+const int32_t dense_int8_bias[64] = {256, -100, 47, -23, 213, -83, 67, -148,
+  186, 111, 30, 65, -217, 170, 402, 23,
+  -202, -47, -213, -108, 93, 200, 159, 43,
+  72, 163, 349, -192, -202, -271, -179, -21,
+  0, 213, 80, 136, -29, 75, -172, -133,
+  206, -46, 190, -29, 253, -80, -89, -59,
+  -64, -90, 112, 150, 0, -75, -26, 210,
+  -130, 226, -254, -108, 217, 128, -31, -95}
+;
+const int32_t dense_int8_multiplier[64] = {1793215726, 1665128889, 1761194017, 1825237436, 1761194017, 1505020342, 1857259145, 1408955213,
+  1569063760, 1505020342, 1408955213, 1921302564, 1537042051, 1472998632, 1761194017, 1825237436,
+  1440976923, 1761194017, 1953324273, 1537042051, 1793215726, 1665128889, 1569063760, 1921302564,
+  1729172307, 1537042051, 1312890085, 1953324273, 1440976923, 1537042051, 1633107179, 2017367692,
+  1505020342, 1569063760, 1569063760, 1537042051, 1440976923, 1665128889, 1697150598, 1569063760,
+  1825237436, 1793215726, 1537042051, 1440976923, 1152781538, 1569063760, 1408955213, 1408955213,
+  1953324273, 1857259145, 1857259145, 1665128889, 1472998632, 1665128889, 1633107179, 1985345983,
+  1280868376, 1472998632, 1312890085, 1537042051, 1344911795, 1633107179, 1344911795, 1761194017}
+;
+const int8_t dense_int8_shift[64] = {39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 38, 39, 39, 39,
+  39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39}
+;
+
+// dense_1: input scale 0.103039, output scale 0.0078125
+const int8_t dense_1_int8_kernel[28][64] NN_ALIGNED = {36, -34, -95, -68, 59, -25, 66, -89, 4, -76, -8, 53, 72, -53, 15, 44,
+  -28, -25, 13, -91, 42, 19, 25, -70, 19, -44, 45, -63, 27, 64, 45, -44,
+  53, -127, -11, 32, 4, -40, -55, 9, -80, -91, -40, -30, -6, 9, -53, -17,
+  -108, 47, -45, 53, -19, 64, 45, -40, 13, -40, 11, -70, 21, -55, -82, -45,
+  42, -57, -127, -87, 38, 32, 51, -125, 21, 47, 23, -36, -13, -72, 0, -85,
+  -114, -59, -74, -85, 49, 74, 64, 44, 25, -72, 64, -42, 17, 61, -19, 2,
+  -57, -36, 44, 53, -104, -4, -61, -55, 53, -89, 6, -51, 38, 28, 36, -30,
+  -49, 42, 15, -44, 57, 61, 25, -40, 55, 44, -36, 25, 38, -44, 30, -83,
+  27, -70, -41, -127, -14, 43, -68, -50, 7, 52, -29, 52, 7, -84, 66, -102,
+  -18, 88, -27, -113, 66, 70, -14, -9, -57, -93, 54, -63, 29, -7, -7, 16,
+  -54, 64, -7, 50, 0, 59, -63, -27, 52, 25, 73, 50, 29, 41, 39, -43,
+  -45, 23, -41, 66, 59, -61, -88, -29, 29, -27, -63, -25, 7, 57, -113, -54,
+  53, -115, -5, 39, 28, -90, -58, -127, -7, 58, 42, 55, -85, -16, 0, 21,
+  -44, -109, -14, -53, 76, 32, 72, 55, 23, 55, -44, -127, -18, -42, -67, -104,
+  -18, -92, -92, 7, 48, 55, -69, -18, 42, 32, 69, -25, 35, 5, 42, 76,
+  -23, -72, 9, 69, 51, -106, -118, -95, -69, 51, -55, -67, -79, 62, -104, 65,
+  58, 39, -58, 24, -90, -9, 67, 37, 9, -21, 41, -9, 7, -108, 50, -75,
+  -19, -60, 37, 19, -43, 52, 65, -22, -90, -93, 47, -62, 4, 41, 30, 41,
+  -50, 41, 26, -82, -34, -19, 35, -69, 41, -11, -6, 35, -75, 45, -13, -11,
+  -127, 34, -95, -65, 26, 54, -112, -62, -6, 24, 47, 34, -65, -43, -95, 22,
+  40, -58, -89, 13, 45, -100, 65, -62, -78, 65, 18, -56, -49, 2, 62, -67,
+  9, 36, -76, -42, -25, 76, 47, 25, 16, 47, -40, -45, -60, -27, -47, -91,
+  -51, 67, 47, 49, 7, 51, 22, -76, 42, 33, 69, 25, 40, -36, 51, -69,
+  -67, -74, 29, -65, 4, 40, -127, 60, -47, 53, -100, 31, 33, 51, -96, 38,
+  61, 53, -118, 17, -6, 11, 48, -48, -28, -42, -90, -68, 20, -9, 50, -64,
+  -39, -61, 42, -120, 74, 24, -66, 66, -63, 28, 35, -2, -105, -33, 37, -66,
+  -15, 53, 59, 42, -99, 44, -11, -127, 26, 29, 52, 35, 17, -77, 40, -46,
+  22, 18, -79, 17, -37, -26, -68, -42, -83, 46, 24, 2, -22, -4, 0, -79,
+  79, 71, -97, 69, 43, 18, 71, -56, -3, -61, 81, -36, -58, -119, 76, -23,
+  -114, 61, 61, 10, 84, -104, 58, 41, -38, 18, 53, -58, -3, -84, 71, -74,
+  -89, 56, 84, -71, -109, -127, 43, 48, -33, 38, 74, -30, -56, -69, -119, 5,
+  -46, -56, -33, 53, 10, 33, -38, 69, -13, 46, -15, -99, -66, -36, 13, -84,
+  34, -69, -77, 47, -93, 6, 11, -30, -90, -37, 52, -73, 60, -84, -101, -49,
+  63, 56, 62, -73, -37, -63, 65, -73, -22, 15, -41, 60, 52, -19, -63, -22,
+  52, -6, -75, -50, -60, 45, -101, 49, -80, -19, -15, -127, -80, -45, -97, -71,
+  43, -80, -65, -41, -60, -120, 32, 37, 35, 49, 52, 65, -24, -108, 26, -60,
+  42, -30, -57, 3, -27, -69, -48, -105, -92, -50, 48, 12, 57, -35, -80, -55,
+  55, -65, -10, 38, 48, -15, 55, -105, -92, 32, 13, -10, 60, 47, -42, -35,
+  -53, 79, -32, -57, -87, -69, -127, -33, -90, -69, -47, -100, 13, -97, -2, 60,
+  -55, -115, -87, -3, -70, -30, -74, 42, -35, 58, -72, 70, 65, -110, -55, 45,
+  -87, -12, 23, 42, -89, 58, -46, 13, -12, 58, -62, 56, 52, 42, -119, -90,
+  -77, -71, 35, 17, 10, 79, 65, 6, -44, 44, -75, 23, 58, 69, 67, -33,
+  54, -10, 40, 15, -54, -44, -15, 44, 33, -100, 38, 23, -92, -98, -29, -17,
+  -13, -60, -54, 17, -79, -60, -127, -115, 60, -115, -50, 42, -85, -58, 35, 50,
+  -48, 57, 9, -42, -85, 57, 26, 22, -127, -90, -37, -85, -105, -42, -31, -55,
+  50, 79, -98, 55, -105, -99, -42, 55, -68, -24, -61, -39, -98, -29, 63, 37,
+  -64, 9, -31, -83, 48, -63, 37, -48, 24, -61, -61, 35, 44, 37, 40, -81,
+  29, -4, 48, 53, 46, -50, 33, -18, -22, 17, -42, 63, -20, 44, -66, 28,
+  69, -72, 5, 62, 62, -115, -5, 76, -46, -21, -65, -67, 23, -51, 5, 60,
+  69, -115, 51, -25, -92, -51, -55, -92, -35, 2, -76, 5, -109, -62, -85, 67,
+  9, -48, -127, -125, 48, 76, 48, 58, -28, -14, -83, -9, -113, -65, -62, -12,
+  74, 32, -65, 0, -60, -83, 60, 5, 72, -74, -58, -67, -92, 2, -111, 76,
+  -74, 53, 37, -6, 55, 47, -35, 27, -98, -18, -84, -59, -45, -127, -98, 21,
+  -96, -14, -63, 51, 4, -55, 47, 33, 37, 59, -55, 25, -43, -6, 4, -86,
+  74, -35, 78, -12, 59, -49, 64, -35, -84, 29, -74, -98, 55, 59, -16, -76,
+  -72, -104, 51, 61, -29, -41, 4, 37, -47, -70, 74, -80, -51, -18, -51, -25,
+  -66, -4, 53, -57, 51, 32, -36, 51, -93, -49, -38, -127, -63, 47, -99, 34,
+  102, -23, -57, -21, 30, -53, -89, 6, -78, -66, 49, -49, 6, -28, -21, 66,
+  -112, -25, 57, -2, -87, 70, -72, -66, -74, 8, 17, -125, 44, 55, 11, -61,
+  59, -112, -30, -59, 59, -106, 49, 55, 66, 30, 51, -89, 23, -80, -21, -23,
+  13, 35, 65, 49, -28, 11, -45, -11, -127, -69, 26, -118, 15, -71, -95, -24,
+  0, -15, -90, 37, -50, -30, -90, 7, -41, 30, -17, -43, 26, -30, -17, 45,
+  45, -99, -21, 34, 67, 56, -41, 56, -69, 21, 0, -52, 43, 60, -60, 35,
+  49, -41, -90, 2, -71, -67, 41, 47, -75, -28, 43, -39, -35, -45, -41, -17,
+  -38, -25, -22, -19, -47, -17, -22, -28, -127, -49, 0, 3, -30, -30, 24, 42,
+  -11, 8, -67, -33, -3, -36, -2, 20, -49, -24, -36, 74, -69, -31, 64, 13,
+  28, -71, -100, -69, 20, 47, 49, -80, -108, -30, 25, -11, 44, -20, 24, -66,
+  39, -55, 55, -42, 42, -13, 38, 41, 30, -94, 6, -14, 39, 47, 44, -72,
+  -79, -28, 44, 66, -31, -96, -66, -31, -90, -44, -114, 26, 35, 4, -94, 33,
+  -55, 15, -127, -66, 85, -7, -96, -44, 33, 77, 72, 57, -127, 24, -42, 37,
+  53, -48, -118, -55, -20, -83, -57, -44, -55, -63, -57, 44, 59, 26, -24, 39,
+  42, -107, 53, -55, -53, -74, -9, 42, -68, 64, 85, 72, 31, -94, 46, -66,
+  -91, -116, 60, 58, 62, -60, -85, -111, -127, 62, -20, -51, -69, 49, -80, -38,
+  80, 45, -22, 58, -47, -82, -109, -82, -127, 31, 58, -47, -60, -89, -125, 69,
+  -107, 80, 13, 38, 2, 33, 47, -42, 20, -100, -82, -87, 51, 58, -96, -51,
+  51, -53, -85, 65, -11, -4, 49, 67, -76, -25, -76, -80, -80, 51, 60, -9,
+  -127, 30, 35, -57, -90, -59, -73, -16, -2, -9, -50, -35, -42, 31, -45, -75,
+  -52, -63, -47, 63, -94, -54, -84, 21, -78, 40, 64, -42, -5, 47, 70, -61,
+  17, 12, -106, 7, 59, -50, 23, -45, 26, -54, -97, 35, -19, -70, 45, -38,
+  -50, 23, -35, 57, 50, -84, 30, 54, -17, -59, 54, 75, 17, 40, -2, -45,
+  -31, 12, 42, -16, -7, -64, -61, -52, -92, 57, 7, 66, -21, -54, -127, -66,
+  56, -43, -50, -42, -30, -68, -80, -10, -59, 17, 50, 5, -92, 54, -43, -2,
+  23, -94, -92, -14, -43, -57, 50, 2, 24, -14, -59, 43, 0, -73, -61, 0,
+  -19, 33, 73, -21, -70, -80, 40, -10, 59, -115, 71, 52, 70, -47, 52, 21,
+  -87, 77, 25, 37, 58, 23, -69, -67, -73, 10, -23, 56, 31, 44, 27, -64,
+  56, -96, -69, 64, -77, 15, -46, -33, 46, -77, -2, 58, -40, -40, 21, 50,
+  48, -21, -33, -46, 37, 13, -62, -10, -44, -127, -2, -67, 25, -42, 42, -67,
+  -56, -31, 29, -33, -92, -92, -29, -71, 33, 12, -46, 42, 64, 52, 44, -35,
+  -75, -71, -27, -90, 58, 65, -83, -33, 25, 10, 17, -56, -33, -98, -121, 52,
+  8, 79, -69, 19, -25, -75, -110, 106, 71, -112, -31, -40, 54, -33, 19, 6,
+  65, -33, -4, -100, 21, -77, -54, 62, -81, 29, -110, 85, -127, -29, -60, -6,
+  31, 56, -81, 2, -94, -35, -19, -104, -54, -102, -71, -69, -110, 35, -27, -79,
+  -12, -1, 53, -88, -47, 47, -79, 10, 28, -58, -55, -13, 20, -32, -1, 10,
+  -4, 35, 57, -22, -86, 3, -53, -16, 20, -34, -58, -20, -55, 50, -57, -104,
+  -58, -35, 48, -102, -53, -3, -35, -4, -60, 34, -36, 18, -127, 36, 39, -41,
+  29, 48, 13, -73, 36, -83, -45, -39, -51, -109, -35, -39, -9, 38, -22, 66,
+  -85, -33, -19, -110, -61, -78, -77, 49, 26, -99, 9, -40, 23, 14, -26, 49,
+  64, -10, -26, 26, -104, -89, 23, -99, 37, -104, -99, 52, 31, 3, -104, -111,
+  -56, -19, 57, -77, -92, -82, 57, 70, -71, 33, -87, 63, -63, -33, 50, 54,
+  -84, -37, -12, 0, 37, 24, 26, 19, -45, -87, 54, 33, -127, 19, -49, -47,
+  -75, -79, -51, -52, 37, -63, -56, 38, 19, 57, -54, -51, -46, 6, -90, 48,
+  44, -24, 13, -17, -48, -73, 10, 65, 46, -16, -89, 29, 52, 64, -59, -90,
+  -46, -105, 17, -100, 30, 5, -27, -13, -121, 44, -71, -51, -111, -102, 33, 19,
+  -40, 33, 17, -63, -48, -127, -29, -76, -94, 27, -33, -8, -113, -62, 43, 38,
+  -127, -85, 42, -62, -90, 44, -117, 52, 40, 42, 27, -12, -71, 27, -102, 35,
+  -58, -25, -48, -48, -17, -94, 69, -23, 58, -73, -119, 56, -27, 42, 48, -112,
+  52, -79, 25, -108, 46, -92, -94, 40, -98, 48, 10, -27, -100, 54, -33, 73,
+  -83, 35, -62, -83, 60, -104, -31, -52, 27, -19, 15, -71, -60, 40, 15, -65,
+  -50, -54, -65, -28, 42, -65, -45, -39, -8, -11, -61, -63, -65, 8, -19, 5,
+  -65, -50, -59, 53, -39, -12, -19, 57, 20, -49, -49, 54, 36, 31, 59, -23,
+  -35, 22, -38, 39, 32, -61, -69, -24, -31, 22, -57, 51, -19, -34, 23, -19,
+  -69, -42, -39, -45, 11, 41, -16, -127, 49, 43, 35, 11, -55, -46, -81, 16}
+;
+const int32_t dense_1_int8_bias[28] = {129, 123, 110, 0, -290, 368, -54, -99,
+  -399, -81, -523, -125, 269, 133, 247, 54,
+  -61, 43, 130, 34, -34, -149, 121, -28,
+  -186, -139, 20, -92}
+;
+const int32_t dense_1_int8_multiplier[28] = {1867764217, 1672624672, 1561116360, 1533239282, 1895641294, 1588993438, 1923518372, 1393853893,
+  1895641294, 2118657917, 1839887139, 1923518372, 1533239282, 1812010061, 1672624672, 1895641294,
+  1129021653, 1616870516, 1588993438, 2035026684, 2035026684, 1839887139, 1700501749, 1212652887,
+  2035026684, 1115083114, 1700501749, 1310222659}
+;
+const int8_t dense_1_int8_shift[28] = {35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+  34, 35, 35, 35, 35, 35, 35, 34, 35, 34, 35, 34}
+;
+
+// int8 network on either an input_t or, when pixels is not NULL, an RGB565
+// image (see cnn_run() in model.h)
+static void cnn_int8_run(
+  const input_t input,
+  const uint16_t *pixels,
+  size_t stride,
+  const int16_t *lut_5,
+  const int16_t *lut_6,
+  output_t output) {
+
+  static int8_t activations1[3072] NN_ALIGNED;
+  static int8_t activations2[1800] NN_ALIGNED;
+
+  if (pixels != NULL) {
+    quantize_rgb565_s8(pixels, stride, 32, 32, lut_5, lut_6, activations1,
+                       CNN_INT8_INPUT_MULTIPLIER, CNN_INT8_INPUT_SHIFT);
+  } else {
+    quantize_s8((const int16_t *)input, activations1, sizeof(input_t) / sizeof(int16_t),
+                CNN_INT8_INPUT_MULTIPLIER, CNN_INT8_INPUT_SHIFT);
+  }
+
+  PROFILE_LAYER_BEGIN();
+  {
+    static const requant_s8_t rq = {conv2d_int8_multiplier, conv2d_int8_shift, 0, 127};
+    static const conv_shape_t shape = {32, 32, 3, 8, 3, 3, 2, 2, 0, 0, 15, 15};
+    conv2d_s8(activations1, (const int8_t *)conv2d_int8_kernel, conv2d_int8_bias, activations2, &shape, &rq);
+  }
+  PROFILE_LAYER_END(0);
+
+  PROFILE_LAYER_BEGIN();
+  {
+    static const requant_s8_t rq = {conv2d_1_int8_multiplier, conv2d_1_int8_shift, 0, 127};
+    static const conv_shape_t shape = {15, 15, 8, 32, 3, 3, 2, 2, 0, 0, 7, 7};
+    conv2d_s8(activations2, (const int8_t *)conv2d_1_int8_kernel, conv2d_1_int8_bias, activations1, &shape, &rq);
+  }
+  PROFILE_LAYER_END(2);
+
+  PROFILE_LAYER_BEGIN();
+  {
+    static const requant_s8_t rq = {conv2d_2_int8_multiplier, conv2d_2_int8_shift, 0, 127};
+    static const conv_shape_t shape = {7, 7, 32, 64, 3, 3, 2, 2, 0, 0, 3, 3};
+    conv2d_s8(activations1, (const int8_t *)conv2d_2_int8_kernel, conv2d_2_int8_bias, activations2, &shape, &rq);
+  }
+  PROFILE_LAYER_END(4);
+
+  PROFILE_LAYER_BEGIN();
+  {
+    static const requant_s8_t rq = {conv2d_3_int8_multiplier, conv2d_3_int8_shift, 0, 127};
+    static const conv_shape_t shape = {3, 3, 64, 128, 3, 3, 2, 2, 0, 0, 1, 1};
+    conv2d_s8(activations2, (const int8_t *)conv2d_3_int8_kernel, conv2d_3_int8_bias, activations1, &shape, &rq);
+  }
+  PROFILE_LAYER_END(6);
+
+  PROFILE_LAYER_BEGIN();
+  {
+    static const requant_s8_t rq = {dense_int8_multiplier, dense_int8_shift, 0, 127};
+    dense_s8(activations1, (const int8_t *)dense_int8_kernel, dense_int8_bias, activations2, 128, 64, &rq);
+  }
+  PROFILE_LAYER_END(8);
+
+  PROFILE_LAYER_BEGIN();
+  {
+    static const requant_s8_t rq = {dense_1_int8_multiplier, dense_1_int8_shift, -32768, 32767};
+    dense_s8_q15(activations2, (const int8_t *)dense_1_int8_kernel, dense_1_int8_bias, output, 64, 28, &rq);
+  }
+  PROFILE_LAYER_END(9);
+
+  PROFILE_INFERENCE_END();
+}
+
+static inline void cnn_int8(const input_t input, output_t output) {
+  cnn_int8_run(input, NULL, 0, NULL, NULL, output);
+}
+
+// int8 network on n images, CNN_BATCH_SIZE at a time, each layer applied to
+// the whole batch (see cnn_batch() in model.h)
+static inline void cnn_int8_batch(const input_t *inputs, output_t *outputs, size_t n) {
+  static int8_t activations1[CNN_BATCH_SIZE][3072] NN_ALIGNED;
+  static int8_t activations2[CNN_BATCH_SIZE][1800] NN_ALIGNED;
+  int8_t *buffer1[CNN_BATCH_SIZE], *buffer2[CNN_BATCH_SIZE];
+  int16_t *output[CNN_BATCH_SIZE];
+
+  for (int b = 0; b < CNN_BATCH_SIZE; b++) {
+    buffer1[b] = activations1[b];
+    buffer2[b] = activations2[b];
+  }
+  while (n > 0) {
+    const int count = n < CNN_BATCH_SIZE ? (int)n : CNN_BATCH_SIZE;
+    for (int b = 0; b < count; b++) {
+      quantize_s8((const int16_t *)inputs[b], buffer1[b], sizeof(input_t) / sizeof(int16_t),
+                  CNN_INT8_INPUT_MULTIPLIER, CNN_INT8_INPUT_SHIFT);
+      output[b] = outputs[b];
+    }
+    {
+      static const requant_s8_t rq = {conv2d_int8_multiplier, conv2d_int8_shift, 0, 127};
+      static const conv_shape_t shape = {32, 32, 3, 8, 3, 3, 2, 2, 0, 0, 15, 15};
+      conv2d_s8_batch(buffer1, (const int8_t *)conv2d_int8_kernel, conv2d_int8_bias, buffer2, count, &shape, &rq);
+    }
+    {
+      static const requant_s8_t rq = {conv2d_1_int8_multiplier, conv2d_1_int8_shift, 0, 127};
+      static const conv_shape_t shape = {15, 15, 8, 32, 3, 3, 2, 2, 0, 0, 7, 7};
+      conv2d_s8_batch(buffer2, (const int8_t *)conv2d_1_int8_kernel, conv2d_1_int8_bias, buffer1, count, &shape, &rq);
+    }
+    {
+      static const requant_s8_t rq = {conv2d_2_int8_multiplier, conv2d_2_int8_shift, 0, 127};
+      static const conv_shape_t shape = {7, 7, 32, 64, 3, 3, 2, 2, 0, 0, 3, 3};
+      conv2d_s8_batch(buffer1, (const int8_t *)conv2d_2_int8_kernel, conv2d_2_int8_bias, buffer2, count, &shape, &rq);
+    }
+    {
+      static const requant_s8_t rq = {conv2d_3_int8_multiplier, conv2d_3_int8_shift, 0, 127};
+      static const conv_shape_t shape = {3, 3, 64, 128, 3, 3, 2, 2, 0, 0, 1, 1};
+      conv2d_s8_batch(buffer2, (const int8_t *)conv2d_3_int8_kernel, conv2d_3_int8_bias, buffer1, count, &shape, &rq);
+    }
+    {
+      static const requant_s8_t rq = {dense_int8_multiplier, dense_int8_shift, 0, 127};
+      dense_s8_batch(buffer1, (const int8_t *)dense_int8_kernel, dense_int8_bias, buffer2, count, 128, 64, &rq);
+    }
+    {
+      static const requant_s8_t rq = {dense_1_int8_multiplier, dense_1_int8_shift, -32768, 32767};
+      dense_s8_q15_batch(buffer2, (const int8_t *)dense_1_int8_kernel, dense_1_int8_bias, output, count, 64, 28, &rq);
+    }
+
+    n -= count;
+    inputs += count;
+    outputs += count;
+  }
+}
+
+#endif//_MODEL_INT8_H_
@@ -0,0 +1,451 @@
+/**
+  ******************************************************************************
+  * @file    model_store.h
+  * @brief   Two flash slots of model blobs (nn_blob.h): one runs, the other
+  *          receives the next model
+  *
+  * Build with -DWITH_MODEL_STORE. A new blob is written to the slot cnn()
+  * is not reading (modelStoreBegin(), modelStoreWrite() in order), then
+  * modelStoreCommit() maps it, checks it with modelBlobOpen() (CRC-32,
+  * shapes, bounds), hands it to the activate() callback of the caller
+  * (cnnUseBlob(), which checks input_t/output_t and switches cnn() from its
+  * next inference on) and only then writes the slot record.
+  *
+  * The record, in the last sector of a slot, holds a generation number: at
+  * boot modelStoreOpen() activates the valid slot with the largest one. The
+  * record of the receiving slot is erased before its first byte is
+  * written, so an upload cut by a reset or a power loss never replaces the
+  * running model. A slot holding a valid blob without a record (written
+  * with esptool, see tools/export_blob.py) counts as generation 0.
+  *
+  *  - ESP32: slots are the data partitions MODEL_BLOB_PARTITION and
+  *    MODEL_BLOB_PARTITION_1 (partitions_model.csv), erased sector by
+  *    sector as the upload reaches them and mapped with esp_partition_mmap().
+  *    Erasing and writing stall the flash cache, hence both cores, for a
+  *    few tens of ms per sector.
+  *  - Host: both slots live in one file of MODEL_STORE_SLOTS *
+  *    MODEL_STORE_SLOT_SIZE bytes, mapped read-write. Writes only clear
+  *    bits and erasing sets bytes to 0xFF, as on NOR flash. A shorter file
+  *    is extended with erased bytes, so a copy of model.bin seeds slot 0.
+  *
+  * The previous slot stays mapped until the next modelStoreBegin(), which
+  * lets an inference already running on another task finish on it.
+  */
+
+#ifndef _MODEL_STORE_H_
+#define _MODEL_STORE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "nn_blob.h"
+#include "blob_map.h"
+
+#define MODEL_STORE_SLOTS 2
+#define MODEL_STORE_SECTOR 4096             // flash erase unit
+#define MODEL_STORE_RECORD_MAGIC 0x544F4C53u  // "SLOT"
+
+#ifndef MODEL_STORE_SLOT_SIZE
+#define MODEL_STORE_SLOT_SIZE 0x100000      // host slots, as partitions_model.csv
+#endif
+#ifndef MODEL_BLOB_PARTITION_1
+#define MODEL_BLOB_PARTITION_1 "model1"
+#endif
+
+typedef struct {
+  uint32_t magic;       // MODEL_STORE_RECORD_MAGIC
+  uint32_t generation;  // larger is newer
+  uint32_t size;        // total_size of the blob
+  uint32_t checksum;    // checksum of its header
+} model_store_record_t;
+
+// Above the model_blob_status_t codes modelStoreCommit() also returns
+typedef enum {
+  MODEL_STORE_OK = 0,
+  MODEL_STORE_ERR_IO = 0x10,     // erase, write or map failed
+  MODEL_STORE_ERR_STATE,         // no upload in progress
+  MODEL_STORE_ERR_OFFSET,        // bytes not at the next offset expected
+  MODEL_STORE_ERR_SIZE,          // blob larger than a slot, or than announced
+  MODEL_STORE_ERR_INCOMPLETE,    // commit before the last byte
+  MODEL_STORE_ERR_REJECTED,      // refused by activate(), e.g. other input_t/output_t
+} model_store_status_t;
+
+#if defined(ESP_PLATFORM)
+
+#include "esp_idf_version.h"
+#include "esp_partition.h"
+#if ESP_IDF_VERSION_MAJOR < 5
+#include "esp_spi_flash.h"
+typedef spi_flash_mmap_handle_t model_store_mmap_handle_t;
+#define MODEL_STORE_MMAP_DATA SPI_FLASH_MMAP_DATA
+#define model_store_munmap spi_flash_munmap
+#else
+typedef esp_partition_mmap_handle_t model_store_mmap_handle_t;
+#define MODEL_STORE_MMAP_DATA ESP_PARTITION_MMAP_DATA
+#define model_store_munmap esp_partition_munmap
+#endif
+
+typedef struct {
+  const esp_partition_t *partitions[MODEL_STORE_SLOTS];
+  model_store_mmap_handle_t handles[MODEL_STORE_SLOTS];
+} model_store_io_t;
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef struct {
+  int fd;
+  uint8_t *base;        // whole file, read-write
+} model_store_io_t;
+
+#endif
+
+typedef struct {
+  model_store_io_t io;
+  uint32_t slot_size[MODEL_STORE_SLOTS];
+  const void *mapped[MODEL_STORE_SLOTS];   // NULL when unmapped
+  model_blob_t blobs[MODEL_STORE_SLOTS];   // valid while mapped
+  uint32_t generation[MODEL_STORE_SLOTS];
+  int active;           // slot cnn() runs, -1 for the compiled tables
+  int upload;           // slot receiving a blob, -1 when idle
+  uint32_t upload_size;
+  uint32_t received;    // next offset expected
+  uint32_t erased;      // bytes erased from the start of the upload slot
+} model_store_t;
+
+static inline const char *modelStoreStatusName(int status) {
+  static const char * const names[] = {
+    "io", "state", "offset", "size", "incomplete", "rejected",
+  };
+  if (status >= MODEL_STORE_ERR_IO && status <= MODEL_STORE_ERR_REJECTED) {
+    return names[status - MODEL_STORE_ERR_IO];
+  }
+  return modelBlobStatusName(status);
+}
+
+// Bytes of a slot a blob may use, the record sector excluded
+static inline uint32_t modelStoreCapacity(const model_store_t *store, int slot) {
+  return store->slot_size[slot] - MODEL_STORE_SECTOR;
+}
+
+#if defined(ESP_PLATFORM)
+
+static inline int model_store_io_open(model_store_t *store, const char *source) {
+  static const char * const labels[MODEL_STORE_SLOTS] = {MODEL_BLOB_PARTITION, MODEL_BLOB_PARTITION_1};
+  (void)source;
+  for (int slot = 0; slot < MODEL_STORE_SLOTS; slot++) {
+    const esp_partition_t *part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)MODEL_BLOB_PARTITION_SUBTYPE, labels[slot]);
+    if (part == NULL || part->size < 2 * MODEL_STORE_SECTOR || part->size % MODEL_STORE_SECTOR != 0) {
+      return MODEL_STORE_ERR_IO;
+    }
+    store->io.partitions[slot] = part;
+    store->slot_size[slot] = part->size;
+  }
+  return MODEL_STORE_OK;
+}
+
+static inline void model_store_io_close(model_store_t *store) {
+  (void)store;
+}
+
+static inline int model_store_erase(model_store_t *store, int slot, uint32_t offset, uint32_t size) {
+  return esp_partition_erase_range(store->io.partitions[slot], offset, size) == ESP_OK
+         ? MODEL_STORE_OK : MODEL_STORE_ERR_IO;
+}
+
+static inline int model_store_write(model_store_t *store, int slot, uint32_t offset, const void *data,
+                                    uint32_t size) {
+  return esp_partition_write(store->io.partitions[slot], offset, data, size) == ESP_OK
+         ? MODEL_STORE_OK : MODEL_STORE_ERR_IO;
+}
+
+static inline int model_store_read(model_store_t *store, int slot, uint32_t offset, void *data, uint32_t size) {
+  return esp_partition_read(store->io.partitions[slot], offset, data, size) == ESP_OK
+         ? MODEL_STORE_OK : MODEL_STORE_ERR_IO;
+}
+
+static inline const void *model_store_map(model_store_t *store, int slot, uint32_t size) {
+  const void *data;
+  if (esp_partition_mmap(store->io.partitions[slot], 0, size, MODEL_STORE_MMAP_DATA, &data,
+                         &store->io.handles[slot]) != ESP_OK) {
+    return NULL;
+  }
+  return data;
+}
+
+static inline void model_store_unmap(model_store_t *store, int slot) {
+  model_store_munmap(store->io.handles[slot]);
+}
+
+#else
+
+static inline int model_store_io_open(model_store_t *store, const char *path) {
+  const size_t size = (size_t)MODEL_STORE_SLOTS * MODEL_STORE_SLOT_SIZE;
+  struct stat st;
+  int fd = open(path, O_RDWR | O_CREAT, 0644);
+
+  if (fd < 0) {
+    return MODEL_STORE_ERR_IO;
+  }
+  if (fstat(fd, &st) != 0 || (size_t)st.st_size > size || ftruncate(fd, (off_t)size) != 0) {
+    close(fd);
+    return MODEL_STORE_ERR_IO;
+  }
+  void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (base == MAP_FAILED) {
+    close(fd);
+    return MODEL_STORE_ERR_IO;
+  }
+  // Bytes the file did not have yet are erased flash
+  memset((uint8_t *)base + st.st_size, 0xFF, size - (size_t)st.st_size);
+  store->io.fd = fd;
+  store->io.base = (uint8_t *)base;
+  for (int slot = 0; slot < MODEL_STORE_SLOTS; slot++) {
+    store->slot_size[slot] = MODEL_STORE_SLOT_SIZE;
+  }
+  return MODEL_STORE_OK;
+}
+
+static inline void model_store_io_close(model_store_t *store) {
+  if (store->io.base != NULL) {
+    munmap(store->io.base, (size_t)MODEL_STORE_SLOTS * MODEL_STORE_SLOT_SIZE);
+    close(store->io.fd);
+    store->io.base = NULL;
+  }
+}
+
+static inline uint8_t *model_store_slot(model_store_t *store, int slot) {
+  return store->io.base + (size_t)slot * MODEL_STORE_SLOT_SIZE;
+}
+
+static inline int model_store_erase(model_store_t *store, int slot, uint32_t offset, uint32_t size) {
+  if (offset % MODEL_STORE_SECTOR != 0 || size % MODEL_STORE_SECTOR != 0) {
+    return MODEL_STORE_ERR_IO;
+  }
+  memset(model_store_slot(store, slot) + offset, 0xFF, size);
+  return MODEL_STORE_OK;
+}
+
+static inline int model_store_write(model_store_t *store, int slot, uint32_t offset, const void *data,
+                                    uint32_t size) {
+  uint8_t *dst = model_store_slot(store, slot) + offset;
+  const uint8_t *src = (const uint8_t *)data;
+  for (uint32_t i = 0; i < size; i++) {
+    dst[i] &= src[i];  // programming only clears bits
+  }
+  return MODEL_STORE_OK;
+}
+
+static inline int model_store_read(model_store_t *store, int slot, uint32_t offset, void *data, uint32_t size) {
+  memcpy(data, model_store_slot(store, slot) + offset, size);
+  return MODEL_STORE_OK;
+}
+
+static inline const void *model_store_map(model_store_t *store, int slot, uint32_t size) {
+  (void)size;
+  return model_store_slot(store, slot);
+}
+
+static inline void model_store_unmap(model_store_t *store, int slot) {
+  (void)store;
+  (void)slot;
+}
+
+#endif
+
+static inline void modelStoreUnmap(model_store_t *store, int slot) {
+  if (store->mapped[slot] != NULL) {
+    model_store_unmap(store, slot);
+    store->mapped[slot] = NULL;
+  }
+  memset(&store->blobs[slot], 0, sizeof(store->blobs[slot]));
+}
+
+// Map the first `size` bytes of a slot and check them as a blob
+static inline int modelStoreMap(model_store_t *store, int slot, uint32_t size) {
+  if (size < sizeof(model_blob_header_t) || size > modelStoreCapacity(store, slot)) {
+    return MODEL_STORE_ERR_SIZE;
+  }
+  store->mapped[slot] = model_store_map(store, slot, size);
+  if (store->mapped[slot] == NULL) {
+    return MODEL_STORE_ERR_IO;
+  }
+  int status = modelBlobOpen(&store->blobs[slot], store->mapped[slot], size);
+  if (status != MODEL_BLOB_OK) {
+    modelStoreUnmap(store, slot);
+  }
+  return status;
+}
+
+// Map a slot at boot and read its generation
+static inline int modelStoreLoadSlot(model_store_t *store, int slot) {
+  model_blob_header_t header;
+  model_store_record_t record;
+  int status;
+
+  store->generation[slot] = 0;
+  if ((status = model_store_read(store, slot, 0, &header, sizeof(header))) != MODEL_STORE_OK) {
+    return status;
+  }
+  if (header.magic != MODEL_BLOB_MAGIC) {
+    return MODEL_BLOB_ERR_MAGIC;
+  }
+  if ((status = modelStoreMap(store, slot, header.total_size)) != MODEL_BLOB_OK) {
+    return status;
+  }
+  if (model_store_read(store, slot, modelStoreCapacity(store, slot), &record, sizeof(record)) == MODEL_STORE_OK
+      && record.magic == MODEL_STORE_RECORD_MAGIC && record.size == header.total_size
+      && record.checksum == header.checksum) {
+    store->generation[slot] = record.generation;
+  }
+  return MODEL_STORE_OK;
+}
+
+// Open the slots of `source` (file path on the host, unused on the ESP32)
+// and activate the newest valid blob activate() accepts. Returns
+// MODEL_STORE_OK even when no slot holds one: store->active is then -1.
+static inline int modelStoreOpen(model_store_t *store, const char *source,
+                                 int (*activate)(const model_blob_t *)) {
+  int valid[MODEL_STORE_SLOTS];
+
+  memset(store, 0, sizeof(*store));
+  store->active = -1;
+  store->upload = -1;
+  int status = model_store_io_open(store, source);
+  if (status != MODEL_STORE_OK) {
+    return status;
+  }
+  for (int slot = 0; slot < MODEL_STORE_SLOTS; slot++) {
+    valid[slot] = modelStoreLoadSlot(store, slot) == MODEL_STORE_OK;
+  }
+  // Newest first, the older one is the fallback
+  while (store->active < 0) {
+    int best = -1;
+    for (int slot = 0; slot < MODEL_STORE_SLOTS; slot++) {
+      if (valid[slot] && (best < 0 || store->generation[slot] > store->generation[best])) {
+        best = slot;
+      }
+    }
+    if (best < 0) {
+      break;
+    }
+    valid[best] = 0;
+    if (activate(&store->blobs[best]) == 0) {
+      store->active = best;
+    }
+  }
+  return MODEL_STORE_OK;
+}
+
+static inline void modelStoreClose(model_store_t *store) {
+  for (int slot = 0; slot < MODEL_STORE_SLOTS; slot++) {
+    modelStoreUnmap(store, slot);
+  }
+  model_store_io_close(store);
+}
+
+// Blob of the active slot, NULL when cnn() runs the compiled tables
+static inline const model_blob_t *modelStoreActive(const model_store_t *store) {
+  return store->active >= 0 ? &store->blobs[store->active] : NULL;
+}
+
+// Start receiving a blob of `size` bytes into the slot not in use. An
+// upload in progress is dropped.
+static inline int modelStoreBegin(model_store_t *store, uint32_t size) {
+  const int slot = store->active == 0 ? 1 : 0;
+
+  store->upload = -1;
+  if (size < sizeof(model_blob_header_t) || size > modelStoreCapacity(store, slot)) {
+    return MODEL_STORE_ERR_SIZE;
+  }
+  modelStoreUnmap(store, slot);
+  store->generation[slot] = 0;
+  int status = model_store_erase(store, slot, modelStoreCapacity(store, slot), MODEL_STORE_SECTOR);
+  if (status != MODEL_STORE_OK) {
+    return status;
+  }
+  store->upload = slot;
+  store->upload_size = size;
+  store->received = 0;
+  store->erased = 0;
+  return MODEL_STORE_OK;
+}
+
+// Append `size` bytes at `offset`, which must be store->received
+static inline int modelStoreWrite(model_store_t *store, uint32_t offset, const void *data, uint32_t size) {
+  const int slot = store->upload;
+  int status;
+
+  if (slot < 0) {
+    return MODEL_STORE_ERR_STATE;
+  }
+  if (offset != store->received) {
+    return MODEL_STORE_ERR_OFFSET;
+  }
+  if (size > store->upload_size - store->received) {
+    return MODEL_STORE_ERR_SIZE;
+  }
+  while (store->erased < store->received + size) {
+    if ((status = model_store_erase(store, slot, store->erased, MODEL_STORE_SECTOR)) != MODEL_STORE_OK) {
+      return status;
+    }
+    store->erased += MODEL_STORE_SECTOR;
+  }
+  if ((status = model_store_write(store, slot, offset, data, size)) != MODEL_STORE_OK) {
+    return status;
+  }
+  store->received += size;
+  return MODEL_STORE_OK;
+}
+
+// Check the uploaded blob, switch to it through activate() and make it the
+// one modelStoreOpen() picks. On any error the active model is unchanged.
+static inline int modelStoreCommit(model_store_t *store, int (*activate)(const model_blob_t *)) {
+  const int slot = store->upload;
+  model_store_record_t record;
+  int status;
+
+  if (slot < 0) {
+    return MODEL_STORE_ERR_STATE;
+  }
+  if (store->received != store->upload_size) {
+    return MODEL_STORE_ERR_INCOMPLETE;
+  }
+  store->upload = -1;
+  if ((status = modelStoreMap(store, slot, store->upload_size)) != MODEL_BLOB_OK) {
+    return status;
+  }
+  if (store->blobs[slot].header->total_size != store->upload_size) {
+    modelStoreUnmap(store, slot);
+    return MODEL_STORE_ERR_SIZE;
+  }
+  if (activate(&store->blobs[slot]) != 0) {
+    modelStoreUnmap(store, slot);
+    return MODEL_STORE_ERR_REJECTED;
+  }
+
+  record.magic = MODEL_STORE_RECORD_MAGIC;
+  record.generation = 0;
+  for (int i = 0; i < MODEL_STORE_SLOTS; i++) {
+    record.generation = store->generation[i] > record.generation ? store->generation[i] : record.generation;
+  }
+  record.generation++;
+  record.size = store->upload_size;
+  record.checksum = store->blobs[slot].header->checksum;
+  if (model_store_write(store, slot, modelStoreCapacity(store, slot), &record, sizeof(record)) != MODEL_STORE_OK) {
+    activate(modelStoreActive(store));
+    modelStoreUnmap(store, slot);
+    return MODEL_STORE_ERR_IO;
+  }
+  store->generation[slot] = record.generation;
+  store->active = slot;
+  return MODEL_STORE_OK;
+}
+
+#endif//_MODEL_STORE_H_
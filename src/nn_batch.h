@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file    nn_batch.h
+  * @brief   Batched conv2d/dense kernels used by cnn_batch()
+  *
+  * A layer is applied to up to CNN_BATCH_SIZE images in one pass. Filters
+  * (conv2d) and units (dense) are the outermost loop, so every weight row is
+  * fetched once per batch and then reused, hot in cache, for each image,
+  * instead of being re-read from flash for every image by cnn().
+  *
+  * Inner products go through dot_q15() (simd.h), so the PIE kernels are
+  * used when building with -DWITH_SIMD. Results are bit-exact with the
+  * reference templates.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _NN_BATCH_H_
+#define _NN_BATCH_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "nn_common.h"
+#include "simd.h"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef CNN_BATCH_SIZE
+#define CNN_BATCH_SIZE 4
+#endif
+
+// conv2d without zero-padding on n <= CNN_BATCH_SIZE HWC images
+static inline void conv2d_batch_q15(
+  const int16_t *const inputs[],  // [n] x [input_height][input_width][input_channels]
+  const int16_t *kernel,          // [filters][kernel_size_y][kernel_size_x][input_channels]
+  const int16_t *bias,            // [filters]
+  int16_t *const outputs[],       // [n] x [output_height][output_width][filters]
+  int n,
+  const conv_shape_t *s,
+  const requant_t *rq) {
+
+  const int row_len = s->kernel_size_x * s->input_channels;
+  const int depth = s->kernel_size_y * row_len;
+  const size_t input_row = (size_t)s->input_width * s->input_channels;
+  int32_t acc[CNN_BATCH_SIZE];
+
+  for (int k = 0; k < s->filters; k++) {
+    const int16_t *filter = kernel + (size_t)k * depth;
+
+    for (int pos_y = 0; pos_y < s->output_height; pos_y++) {
+      for (int pos_x = 0; pos_x < s->output_width; pos_x++) {
+        size_t window = (size_t)(pos_y * s->stride_y) * input_row
+                        + (size_t)(pos_x * s->stride_x) * s->input_channels;
+
+        for (int b = 0; b < n; b++) {
+          acc[b] = 0;
+        }
+        for (int y = 0; y < s->kernel_size_y; y++) {
+          for (int b = 0; b < n; b++) {
+            acc[b] += dot_q15(inputs[b] + window + y * input_row, filter + y * row_len, row_len);
+          }
+        }
+
+        size_t out = ((size_t)pos_y * s->output_width + pos_x) * s->filters + k;
+        for (int b = 0; b < n; b++) {
+          outputs[b][out] = requantize_q15(acc[b], bias[k], rq);
+        }
+      }
+    }
+  }
+}
+
+// dense on n <= CNN_BATCH_SIZE input vectors
+static inline void dense_batch_q15(
+  const int16_t *const inputs[],  // [n] x [samples]
+  const int16_t *kernel,          // [units][samples]
+  const int16_t *bias,            // [units]
+  int16_t *const outputs[],       // [n] x [units]
+  int n,
+  int samples,
+  int units,
+  const requant_t *rq) {
+
+  for (int k = 0; k < units; k++) {
+    const int16_t *row = kernel + (size_t)k * samples;
+    for (int b = 0; b < n; b++) {
+      outputs[b][k] = requantize_q15(dot_q15(inputs[b], row, samples), bias[k], rq);
+    }
+  }
+}
+
+#endif//_NN_BATCH_H_
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,421 @@
+/**
+  ******************************************************************************
+  * @file    nn_blob.h
+  * @brief   Versioned binary model format and the interpreter running it
+  *
+  * A model blob, written by tools/export_blob.py, holds everything cnn()
+  * takes from the compiled tables of model.h, so that a model can be
+  * swapped without rebuilding the firmware. Little-endian, every section
+  * aligned on MODEL_BLOB_ALIGN bytes:
+  *
+  *   model_blob_header_t              magic, version, sizes, CRC-32, name
+  *   model_blob_layer_t[layer_count]  type, shapes, fixed-point shifts,
+  *                                    offsets of the weight sections
+  *   int16 weight sections            kernel and bias of each layer
+  *
+  * The CRC-32 (IEEE 802.3, as zlib.crc32) covers every byte after the
+  * checksum field. modelBlobOpen() checks the header, the checksum, that
+  * each layer reads the output shape of the previous one and that every
+  * weight section lies inside the blob, so modelBlobRun() does no checks
+  * of its own. The blob is read in place: the weights stay wherever the
+  * caller mapped them (flash partition, mmap'ed file, RAM buffer).
+  *
+  * modelBlobRun() executes the layers in order and is bit-exact with the
+  * compiled network the blob was exported from. It ping-pongs between two
+  * activation buffers of activation_size values. The output stage is
+  * requantize_q15(). conv2d layers with zero-padding or groups are rejected
+  * at load time.
+  *
+  * The shapes are only known at run time, so the kernels here are written
+  * for the compiler's benefit instead of taking the row-by-row dot_q15()
+  * of simd.h. Each conv2d window is gathered into one contiguous patch,
+  * which leaves one long dot product per filter. The scalar MACs run in
+  * blocks of 8, which GCC vectorizes at -O2. On the host this puts
+  * modelBlobRun() within ~1.2x of the compiled cnn() at -O2 and on par
+  * with it without vectorization. The PIE path of dot_q15() still takes
+  * the aligned blocks.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _NN_BLOB_H_
+#define _NN_BLOB_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "nn_common.h"
+#include "simd.h"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define MODEL_BLOB_MAGIC 0x4D454153u  // "SAEM"
+#define MODEL_BLOB_VERSION 1
+#define MODEL_BLOB_ALIGN 16
+#define MODEL_BLOB_NAME_SIZE 32
+
+// Largest conv2d window (kernel_size_y * kernel_size_x * channels) the
+// interpreter accepts, the size of its patch buffer
+#ifndef MODEL_BLOB_MAX_DEPTH
+#define MODEL_BLOB_MAX_DEPTH 1024
+#endif
+
+typedef enum {
+  MODEL_BLOB_CONV2D = 1,
+  MODEL_BLOB_BATCHNORM = 2,
+  MODEL_BLOB_FLATTEN = 3,
+  MODEL_BLOB_DENSE = 4,
+} model_blob_layer_type_t;
+
+typedef struct {
+  uint32_t magic;           // MODEL_BLOB_MAGIC
+  uint16_t version;         // MODEL_BLOB_VERSION
+  uint16_t header_size;     // sizeof(model_blob_header_t)
+  uint32_t total_size;      // bytes of the whole blob
+  uint32_t checksum;        // CRC-32 of bytes [16, total_size)
+  uint16_t layer_count;
+  uint16_t layer_size;      // sizeof(model_blob_layer_t)
+  uint16_t input_height;
+  uint16_t input_width;
+  uint16_t input_channels;
+  uint16_t output_size;
+  uint32_t activation_size; // int16 values of the largest layer input or output
+  char name[MODEL_BLOB_NAME_SIZE];  // NUL-terminated model identifier
+} model_blob_header_t;
+
+// conv2d:    shape as conv_shape_t, kernel [filters][ky][kx][channels]
+// batchnorm: input = output shape, filters = channels, kernel [channels]
+// flatten:   input shape, output 1 x 1 x (h * w * c), no weights
+// dense:     input 1 x 1 x samples, filters = units, kernel [units][samples]
+typedef struct {
+  uint8_t type;             // model_blob_layer_type_t
+  uint8_t activation;       // nn_activation_t
+  uint8_t round_mode;       // round_mode_t
+  int8_t weights_shift;     // requant_t fields
+  int8_t bias_shift;
+  int8_t output_shift;
+  uint16_t reserved;
+  int32_t relu6_max;
+  conv_shape_t shape;
+  uint32_t kernel_offset;   // bytes from the start of the blob
+  uint32_t kernel_count;    // int16 values
+  uint32_t bias_offset;
+  uint32_t bias_count;
+} model_blob_layer_t;
+
+typedef char model_blob_header_size_check[sizeof(model_blob_header_t) == 64 ? 1 : -1];
+typedef char model_blob_layer_size_check[sizeof(model_blob_layer_t) == 52 ? 1 : -1];
+
+typedef enum {
+  MODEL_BLOB_OK = 0,
+  MODEL_BLOB_ERR_SIZE,      // truncated, or total_size larger than the data
+  MODEL_BLOB_ERR_MAGIC,
+  MODEL_BLOB_ERR_VERSION,
+  MODEL_BLOB_ERR_CHECKSUM,
+  MODEL_BLOB_ERR_ALIGN,     // data or a weight section misaligned
+  MODEL_BLOB_ERR_LAYER,     // unknown type, activation or round mode, unsupported padding
+  MODEL_BLOB_ERR_SHAPE,     // layers do not chain, counts do not match the shapes
+  MODEL_BLOB_ERR_BOUNDS,    // weight section outside the blob
+} model_blob_status_t;
+
+typedef struct {
+  const uint8_t *data;
+  const model_blob_header_t *header;
+  const model_blob_layer_t *layers;
+} model_blob_t;
+
+static inline const char *modelBlobStatusName(int status) {
+  static const char * const names[] = {
+    "ok", "size", "magic", "version", "checksum", "alignment", "layer", "shape", "bounds",
+  };
+  return status >= 0 && status < (int)(sizeof(names) / sizeof(names[0])) ? names[status] : "?";
+}
+
+// CRC-32 (reflected, polynomial 0xEDB88320), one nibble at a time; pass
+// the result of the previous call to continue a running checksum, 0 first
+static inline uint32_t modelBlobCrc32(uint32_t crc, const void *data, size_t size) {
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+  };
+  const uint8_t *p = (const uint8_t *)data;
+  crc = ~crc;
+  for (size_t i = 0; i < size; i++) {
+    crc ^= p[i];
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+static inline int modelBlobSection(const model_blob_header_t *h, uint32_t offset, uint32_t count) {
+  if (offset % MODEL_BLOB_ALIGN != 0) {
+    return MODEL_BLOB_ERR_ALIGN;
+  }
+  if (offset > h->total_size || count > (h->total_size - offset) / sizeof(int16_t)) {
+    return MODEL_BLOB_ERR_BOUNDS;
+  }
+  return MODEL_BLOB_OK;
+}
+
+static inline int modelBlobCheckLayer(const model_blob_header_t *h, const model_blob_layer_t *l,
+                                      uint32_t *output_size) {
+  const conv_shape_t *s = &l->shape;
+  const uint32_t input_size = (uint32_t)s->input_height * s->input_width * s->input_channels;
+  uint32_t kernel_count, bias_count;
+  int status;
+
+  if (l->activation > NN_ACTIVATION_RELU6 || l->round_mode > ROUND_MODE_NEAREST) {
+    return MODEL_BLOB_ERR_LAYER;
+  }
+  switch (l->type) {
+    case MODEL_BLOB_CONV2D:
+      if (s->zeropadding_top != 0 || s->zeropadding_left != 0 || s->stride_y == 0 || s->stride_x == 0
+          || s->kernel_size_y == 0 || s->kernel_size_x == 0) {
+        return MODEL_BLOB_ERR_LAYER;
+      }
+      if (s->kernel_size_y > s->input_height || s->kernel_size_x > s->input_width
+          || (uint32_t)s->kernel_size_y * s->kernel_size_x * s->input_channels > MODEL_BLOB_MAX_DEPTH
+          || s->output_height != (s->input_height - s->kernel_size_y) / s->stride_y + 1
+          || s->output_width != (s->input_width - s->kernel_size_x) / s->stride_x + 1) {
+        return MODEL_BLOB_ERR_SHAPE;
+      }
+      kernel_count = (uint32_t)s->filters * s->kernel_size_y * s->kernel_size_x * s->input_channels;
+      bias_count = s->filters;
+      *output_size = (uint32_t)s->output_height * s->output_width * s->filters;
+      break;
+    case MODEL_BLOB_BATCHNORM:
+      if (s->filters != s->input_channels || s->output_height != s->input_height
+          || s->output_width != s->input_width) {
+        return MODEL_BLOB_ERR_SHAPE;
+      }
+      kernel_count = bias_count = s->input_channels;
+      *output_size = input_size;
+      break;
+    case MODEL_BLOB_FLATTEN:
+      if (s->output_height != 1 || s->output_width != 1 || s->filters != input_size) {
+        return MODEL_BLOB_ERR_SHAPE;
+      }
+      kernel_count = bias_count = 0;
+      *output_size = input_size;
+      break;
+    case MODEL_BLOB_DENSE:
+      if (s->input_height != 1 || s->input_width != 1 || s->output_height != 1 || s->output_width != 1) {
+        return MODEL_BLOB_ERR_SHAPE;
+      }
+      kernel_count = (uint32_t)s->filters * s->input_channels;
+      bias_count = s->filters;
+      *output_size = s->filters;
+      break;
+    default:
+      return MODEL_BLOB_ERR_LAYER;
+  }
+  if (l->kernel_count != kernel_count || l->bias_count != bias_count) {
+    return MODEL_BLOB_ERR_SHAPE;
+  }
+  if (input_size > h->activation_size || *output_size > h->activation_size) {
+    return MODEL_BLOB_ERR_SHAPE;
+  }
+  if (kernel_count > 0 && (status = modelBlobSection(h, l->kernel_offset, kernel_count)) != MODEL_BLOB_OK) {
+    return status;
+  }
+  if (bias_count > 0 && (status = modelBlobSection(h, l->bias_offset, bias_count)) != MODEL_BLOB_OK) {
+    return status;
+  }
+  return MODEL_BLOB_OK;
+}
+
+// Validate `size` bytes at `data` (MODEL_BLOB_ALIGN-aligned) and fill
+// `model`. Returns MODEL_BLOB_OK or the first error found; `model` is only
+// usable after MODEL_BLOB_OK.
+static inline int modelBlobOpen(model_blob_t *model, const void *data, size_t size) {
+  const model_blob_header_t *h = (const model_blob_header_t *)data;
+
+  memset(model, 0, sizeof(*model));
+  if ((uintptr_t)data % MODEL_BLOB_ALIGN != 0) {
+    return MODEL_BLOB_ERR_ALIGN;
+  }
+  if (size < sizeof(model_blob_header_t)) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  if (h->magic != MODEL_BLOB_MAGIC) {
+    return MODEL_BLOB_ERR_MAGIC;
+  }
+  if (h->version != MODEL_BLOB_VERSION || h->header_size != sizeof(model_blob_header_t)
+      || h->layer_size != sizeof(model_blob_layer_t)) {
+    return MODEL_BLOB_ERR_VERSION;
+  }
+  if (h->total_size > size || h->total_size < h->header_size + (uint32_t)h->layer_count * h->layer_size) {
+    return MODEL_BLOB_ERR_SIZE;
+  }
+  if (modelBlobCrc32(0, (const uint8_t *)data + 16, h->total_size - 16) != h->checksum) {
+    return MODEL_BLOB_ERR_CHECKSUM;
+  }
+  if (h->layer_count == 0 || h->name[MODEL_BLOB_NAME_SIZE - 1] != '\0') {
+    return MODEL_BLOB_ERR_LAYER;
+  }
+
+  const model_blob_layer_t *layers = (const model_blob_layer_t *)((const uint8_t *)data + h->header_size);
+  uint16_t height = h->input_height, width = h->input_width, channels = h->input_channels;
+  uint32_t output_size = 0;
+  for (uint16_t i = 0; i < h->layer_count; i++) {
+    const model_blob_layer_t *l = &layers[i];
+    if (l->shape.input_height != height || l->shape.input_width != width
+        || l->shape.input_channels != channels) {
+      return MODEL_BLOB_ERR_SHAPE;
+    }
+    int status = modelBlobCheckLayer(h, l, &output_size);
+    if (status != MODEL_BLOB_OK) {
+      return status;
+    }
+    height = l->shape.output_height;
+    width = l->shape.output_width;
+    channels = l->shape.filters;
+  }
+  if (height != 1 || width != 1 || output_size != h->output_size) {
+    return MODEL_BLOB_ERR_SHAPE;
+  }
+
+  model->data = (const uint8_t *)data;
+  model->header = h;
+  model->layers = layers;
+  return MODEL_BLOB_OK;
+}
+
+// Whether an opened blob takes a height x width x channels input and
+// produces `outputs` values
+static inline int modelBlobCompatible(const model_blob_t *model, int height, int width, int channels,
+                                      int outputs) {
+  const model_blob_header_t *h = model->header;
+  return h != NULL && h->input_height == height && h->input_width == width && h->input_channels == channels
+         && h->output_size == outputs;
+}
+
+// int16 values of scratch modelBlobRun() needs
+static inline size_t modelBlobScratchSize(const model_blob_t *model) {
+  // Rounded so that the second buffer stays aligned for the SIMD kernels
+  return 2 * (((size_t)model->header->activation_size + 7) & ~(size_t)7);
+}
+
+static inline const int16_t *modelBlobTable(const model_blob_t *model, uint32_t offset) {
+  return (const int16_t *)(model->data + offset);
+}
+
+// dot_q15() with its scalar part in blocks of 8 MACs: a constant trip
+// count is what GCC vectorizes at -O2, n being only known at run time.
+// Without the pragma -O3 unrolls the blocks first and loses that.
+static inline int32_t modelBlobDot(const int16_t *a, const int16_t *b, int n) {
+#if SIMD_BACKEND != SIMD_BACKEND_SCALAR
+  if (n >= SIMD_LANES && simd_aligned(a, b)) {
+    return dot_q15(a, b, n);
+  }
+#endif
+  int32_t acc = 0;
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    int32_t block = 0;
+#pragma GCC unroll 1
+    for (int j = 0; j < 8; j++) {
+      block += (int32_t)a[i + j] * (int32_t)b[i + j];
+    }
+    acc += block;
+  }
+  for (; i < n; i++) {
+    acc += (int32_t)a[i] * (int32_t)b[i];
+  }
+  return acc;
+}
+
+// conv2d without zero-padding: the window of each output pixel is copied
+// into one contiguous patch, then every filter is a single dot product
+// over its kernel_size_y * kernel_size_x * channels values. Not reentrant
+// (static patch), as cnn().
+static inline void modelBlobConv2d(const int16_t *input, const int16_t *kernel, const int16_t *bias,
+                                   int16_t *output, const conv_shape_t *s, const requant_t *rq) {
+  static int16_t patch[MODEL_BLOB_MAX_DEPTH] NN_ALIGNED;
+  const int row_len = s->kernel_size_x * s->input_channels;
+  const int depth = s->kernel_size_y * row_len;
+  const size_t input_row = (size_t)s->input_width * s->input_channels;
+
+  for (int pos_y = 0; pos_y < s->output_height; pos_y++) {
+    for (int pos_x = 0; pos_x < s->output_width; pos_x++) {
+      const int16_t *window = input + (size_t)(pos_y * s->stride_y) * input_row
+                              + (size_t)(pos_x * s->stride_x) * s->input_channels;
+      for (int y = 0; y < s->kernel_size_y; y++) {
+        memcpy(patch + y * row_len, window + y * input_row, (size_t)row_len * sizeof(int16_t));
+      }
+      for (int k = 0; k < s->filters; k++) {
+        *output++ = requantize_q15(modelBlobDot(patch, kernel + (size_t)k * depth, depth), bias[k], rq);
+      }
+    }
+  }
+}
+
+static inline void modelBlobDense(const int16_t *input, const int16_t *kernel, const int16_t *bias,
+                                  int16_t *output, int samples, int units, const requant_t *rq) {
+  for (int k = 0; k < units; k++) {
+    output[k] = requantize_q15(modelBlobDot(input, kernel + (size_t)k * samples, samples), bias[k], rq);
+  }
+}
+
+static inline void modelBlobBatchnorm(const int16_t *input, const int16_t *kernel, const int16_t *bias,
+                                      int16_t *output, const conv_shape_t *s, const requant_t *rq) {
+  const size_t pixels = (size_t)s->input_height * s->input_width;
+  for (size_t i = 0; i < pixels; i++) {
+    for (int z = 0; z < s->input_channels; z++) {
+      *output++ = requantize_q15((int32_t)*input++ * kernel[z], bias[z], rq);
+    }
+  }
+}
+
+// Run an opened blob on `input` (input_height x input_width x
+// input_channels), writing output_size values to `output`. `scratch` holds
+// modelBlobScratchSize() int16 values, 16-byte aligned.
+static inline void modelBlobRun(const model_blob_t *model, const int16_t *input, int16_t *output,
+                                int16_t *scratch) {
+  const model_blob_header_t *h = model->header;
+  int16_t *buffers[2] = {scratch, scratch + modelBlobScratchSize(model) / 2};
+  const int16_t *src = input;
+  int next = 0;
+
+  for (uint16_t i = 0; i < h->layer_count; i++) {
+    const model_blob_layer_t *l = &model->layers[i];
+    const requant_t rq = {l->weights_shift, l->bias_shift, l->output_shift, (round_mode_t)l->round_mode,
+                          (nn_activation_t)l->activation, l->relu6_max};
+    int16_t *dst = i + 1 == h->layer_count ? output : buffers[next];
+
+    switch (l->type) {
+      case MODEL_BLOB_CONV2D:
+        modelBlobConv2d(src, modelBlobTable(model, l->kernel_offset), modelBlobTable(model, l->bias_offset),
+                        dst, &l->shape, &rq);
+        break;
+      case MODEL_BLOB_BATCHNORM:
+        modelBlobBatchnorm(src, modelBlobTable(model, l->kernel_offset), modelBlobTable(model, l->bias_offset),
+                           dst, &l->shape, &rq);
+        break;
+      case MODEL_BLOB_FLATTEN:
+        // HWC is already the flattened order
+        if (dst != output) {
+          continue;
+        }
+        memcpy(dst, src, (size_t)l->shape.filters * sizeof(int16_t));
+        break;
+      case MODEL_BLOB_DENSE:
+        modelBlobDense(src, modelBlobTable(model, l->kernel_offset), modelBlobTable(model, l->bias_offset),
+                       dst, l->shape.input_channels, l->shape.filters, &rq);
+        break;
+    }
+    src = dst;
+    next ^= 1;
+  }
+}
+
+#endif//_NN_BLOB_H_
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
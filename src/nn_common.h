@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    nn_common.h
+  * @brief   Layer shape and requantization descriptors shared by the
+  *          alternative kernels (im2col/GEMM, SIMD, ...)
+  *
+  * requantize_q15() reproduces bit for bit the output stage of the generated
+  * conv2d/dense templates: weights rescaling, bias addition, activation and
+  * final scale-and-clamp to int16.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _NN_COMMON_H_
+#define _NN_COMMON_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#endif
+
+#include <stdint.h>
+
+// Alignment of the weight tables and activation buffers, so that the SIMD
+// kernels (simd.h) can use 128-bit loads on them
+#ifndef NN_ALIGNED
+#define NN_ALIGNED __attribute__((aligned(16)))
+#endif
+
+typedef enum {
+  NN_ACTIVATION_LINEAR,
+  NN_ACTIVATION_RELU,
+  NN_ACTIVATION_RELU6,
+} nn_activation_t;
+
+typedef struct {
+  uint16_t input_height;
+  uint16_t input_width;
+  uint16_t input_channels;
+  uint16_t filters;
+  uint16_t kernel_size_y;
+  uint16_t kernel_size_x;
+  uint16_t stride_y;
+  uint16_t stride_x;
+  uint16_t zeropadding_top;
+  uint16_t zeropadding_left;
+  uint16_t output_height;
+  uint16_t output_width;
+} conv_shape_t;
+
+typedef struct {
+  int8_t weights_shift;   // WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR
+  int8_t bias_shift;      // BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR
+  int8_t output_shift;    // INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR
+  round_mode_t round_mode;
+  nn_activation_t activation;
+  int32_t relu6_max;      // 6 in the accumulator fixed-point format
+} requant_t;
+
+// Build a conv_shape_t from the layer macros of the current conv2d template
+#define CONV_SHAPE_FROM_LAYER() { \
+    INPUT_HEIGHT, INPUT_WIDTH, INPUT_CHANNELS, CONV_FILTERS, \
+    CONV_KERNEL_SIZE_Y, CONV_KERNEL_SIZE_X, CONV_STRIDE_Y, CONV_STRIDE_X, \
+    ZEROPADDING_TOP, ZEROPADDING_LEFT, CONV_OUTHEIGHT, CONV_OUTWIDTH }
+
+// Build a requant_t from the fixed-point macros of the current template
+#define REQUANT_FROM_LAYER(activation) { \
+    WEIGHTS_SCALE_FACTOR - TMP_SCALE_FACTOR, \
+    BIASES_SCALE_FACTOR - TMP_SCALE_FACTOR - INPUT_SCALE_FACTOR, \
+    INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR - OUTPUT_SCALE_FACTOR, \
+    OUTPUT_ROUND_MODE, (activation), 6 << (INPUT_SCALE_FACTOR + TMP_SCALE_FACTOR) }
+
+static inline int16_t requantize_q15(int32_t acc, int16_t bias, const requant_t *rq) {
+  // Scale for possible additional precision of bias
+  acc = scale_number_t_int16_t(acc, rq->weights_shift, rq->round_mode);
+  // Scale bias to match accumulator
+  acc += scale_number_t_int16_t((int32_t)bias, rq->bias_shift, rq->round_mode);
+
+  if (rq->activation != NN_ACTIVATION_LINEAR) {
+    if (acc < 0) {
+      return 0;
+    }
+    if (rq->activation == NN_ACTIVATION_RELU6 && acc > rq->relu6_max) {
+      acc = rq->relu6_max;
+    }
+  }
+  return scale_and_clamp_to_number_t_int16_t(acc, rq->output_shift, rq->round_mode);
+}
+
+#endif//_NN_COMMON_H_
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,281 @@
+/**
+  ******************************************************************************
+  * @file    nn_int8.h
+  * @brief   int8 conv2d/dense kernels with per-output-channel requantization
+  *
+  * Kernels of the int8 network generated by tools/quantize_int8.py
+  * (model_int8.h, -DWITH_INT8). Weights and activations are int8 with a
+  * zero point of 0, biases int32 in the accumulator scale. Each output
+  * channel k maps its int32 accumulator to the output scale with
+  *
+  *   out = clamp(round(acc * multiplier[k] / 2^shift[k]), output_min, output_max)
+  *
+  * multiplier[k] in [2^30, 2^31) and shift[k] > 0, rounding half up. The
+  * last layer writes int16 logits in the Q format of output_t so that
+  * softmaxLabelQ15() is unchanged.
+  *
+  * conv2d_s8() walks output pixels, then filters, with the channels of the
+  * window innermost, so input and kernel are both read sequentially.
+  *
+  * The *_batch variants, used by cnn_batch(), apply a layer to up to
+  * CNN_BATCH_SIZE images with the filters (units) outermost, as nn_batch.h
+  * does for the int16 network, and give the same results image by image.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _NN_INT8_H_
+#define _NN_INT8_H_
+
+#ifndef SINGLE_FILE
+#include "nn_common.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef CNN_BATCH_SIZE
+#define CNN_BATCH_SIZE 4
+#endif
+
+typedef struct {
+  const int32_t *multiplier;  // [filters]
+  const int8_t *shift;        // [filters]
+  int32_t output_min;         // 0 after ReLU
+  int32_t output_max;
+} requant_s8_t;
+
+static inline int32_t requantize_s8(int32_t acc, int32_t multiplier, int shift) {
+  int64_t p = (int64_t)acc * multiplier;
+  return (int32_t)((p + ((int64_t)1 << (shift - 1))) >> shift);
+}
+
+static inline int32_t clamp_s8(int32_t v, int32_t lo, int32_t hi) {
+  return v < lo ? lo : (v > hi ? hi : v);
+}
+
+static inline int32_t dot_s8(const int8_t *a, const int8_t *b, int n) {
+  int32_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    acc0 += (int32_t)a[i] * b[i];
+    acc1 += (int32_t)a[i + 1] * b[i + 1];
+    acc2 += (int32_t)a[i + 2] * b[i + 2];
+    acc3 += (int32_t)a[i + 3] * b[i + 3];
+  }
+  for (; i < n; i++) {
+    acc0 += (int32_t)a[i] * b[i];
+  }
+  return acc0 + acc1 + acc2 + acc3;
+}
+
+// int16 activations (model input) to int8 with a single multiplier/shift
+static inline void quantize_s8(
+  const int16_t *input,
+  int8_t *output,
+  size_t n,
+  int32_t multiplier,
+  int shift) {
+
+  for (size_t i = 0; i < n; i++) {
+    output[i] = (int8_t)clamp_s8(requantize_s8(input[i], multiplier, shift), -128, 127);
+  }
+}
+
+// RGB565 rows of `stride` pixels to int8 HWC, through the int16 values of
+// the preprocessing tables
+static inline void quantize_rgb565_s8(
+  const uint16_t *pixels,
+  size_t stride,
+  int height,
+  int width,
+  const int16_t lut_5[32],
+  const int16_t lut_6[64],
+  int8_t *output,
+  int32_t multiplier,
+  int shift) {
+
+  for (int y = 0; y < height; y++) {
+    const uint16_t *row = pixels + (size_t)y * stride;
+    for (int x = 0; x < width; x++) {
+      uint16_t p = row[x];
+      *output++ = (int8_t)clamp_s8(requantize_s8(lut_5[p >> 11], multiplier, shift), -128, 127);
+      *output++ = (int8_t)clamp_s8(requantize_s8(lut_6[(p >> 5) & 0x3F], multiplier, shift), -128, 127);
+      *output++ = (int8_t)clamp_s8(requantize_s8(lut_5[p & 0x1F], multiplier, shift), -128, 127);
+    }
+  }
+}
+
+static inline void conv2d_s8(
+  const int8_t *input,    // [input_height][input_width][input_channels]
+  const int8_t *kernel,   // [filters][kernel_size_y][kernel_size_x][input_channels]
+  const int32_t *bias,    // [filters]
+  int8_t *output,         // [output_height][output_width][filters]
+  const conv_shape_t *s,
+  const requant_s8_t *rq) {
+
+  const int channels = s->input_channels;
+  const int row_len = s->kernel_size_x * channels;
+  const int depth = s->kernel_size_y * row_len;
+
+  for (int pos_y = 0; pos_y < s->output_height; pos_y++) {
+    for (int pos_x = 0; pos_x < s->output_width; pos_x++) {
+      const int input_y0 = pos_y * s->stride_y - s->zeropadding_top;
+      const int input_x0 = pos_x * s->stride_x - s->zeropadding_left;
+
+      // A window row inside the image is kernel_size_x * channels contiguous values
+      const int inside_x = input_x0 >= 0 && input_x0 + s->kernel_size_x <= s->input_width;
+
+      for (int k = 0; k < s->filters; k++) {
+        const int8_t *w = kernel + (size_t)k * depth;
+        int32_t acc = bias[k];
+
+        for (int y = 0; y < s->kernel_size_y; y++) {
+          const int input_y = input_y0 + y;
+          if (input_y < 0 || input_y >= s->input_height) { // ZeroPadding2D
+            continue;
+          }
+          const int8_t *row = input + (size_t)input_y * s->input_width * channels;
+          if (inside_x) {
+            acc += dot_s8(row + input_x0 * channels, w + y * row_len, row_len);
+            continue;
+          }
+          for (int x = 0; x < s->kernel_size_x; x++) {
+            const int input_x = input_x0 + x;
+            if (input_x < 0 || input_x >= s->input_width) { // ZeroPadding2D
+              continue;
+            }
+            acc += dot_s8(row + input_x * channels, w + y * row_len + x * channels, channels);
+          }
+        }
+        *output++ = (int8_t)clamp_s8(requantize_s8(acc, rq->multiplier[k], rq->shift[k]),
+                                     rq->output_min, rq->output_max);
+      }
+    }
+  }
+}
+
+static inline void dense_s8(
+  const int8_t *input,    // [samples]
+  const int8_t *kernel,   // [units][samples]
+  const int32_t *bias,    // [units]
+  int8_t *output,         // [units]
+  int samples,
+  int units,
+  const requant_s8_t *rq) {
+
+  for (int k = 0; k < units; k++) {
+    int32_t acc = bias[k] + dot_s8(input, kernel + (size_t)k * samples, samples);
+    output[k] = (int8_t)clamp_s8(requantize_s8(acc, rq->multiplier[k], rq->shift[k]),
+                                 rq->output_min, rq->output_max);
+  }
+}
+
+// Same with int16 outputs, for the logits of the last layer
+static inline void dense_s8_q15(
+  const int8_t *input,
+  const int8_t *kernel,
+  const int32_t *bias,
+  int16_t *output,
+  int samples,
+  int units,
+  const requant_s8_t *rq) {
+
+  for (int k = 0; k < units; k++) {
+    int32_t acc = bias[k] + dot_s8(input, kernel + (size_t)k * samples, samples);
+    output[k] = (int16_t)clamp_s8(requantize_s8(acc, rq->multiplier[k], rq->shift[k]),
+                                  rq->output_min, rq->output_max);
+  }
+}
+
+// conv2d_s8() without zero-padding on n <= CNN_BATCH_SIZE HWC images
+static inline void conv2d_s8_batch(
+  const int8_t *const inputs[],   // [n] x [input_height][input_width][input_channels]
+  const int8_t *kernel,           // [filters][kernel_size_y][kernel_size_x][input_channels]
+  const int32_t *bias,            // [filters]
+  int8_t *const outputs[],        // [n] x [output_height][output_width][filters]
+  int n,
+  const conv_shape_t *s,
+  const requant_s8_t *rq) {
+
+  const int row_len = s->kernel_size_x * s->input_channels;
+  const int depth = s->kernel_size_y * row_len;
+  const size_t input_row = (size_t)s->input_width * s->input_channels;
+  int32_t acc[CNN_BATCH_SIZE];
+
+  for (int k = 0; k < s->filters; k++) {
+    const int8_t *filter = kernel + (size_t)k * depth;
+
+    for (int pos_y = 0; pos_y < s->output_height; pos_y++) {
+      for (int pos_x = 0; pos_x < s->output_width; pos_x++) {
+        size_t window = (size_t)(pos_y * s->stride_y) * input_row
+                        + (size_t)(pos_x * s->stride_x) * s->input_channels;
+
+        for (int b = 0; b < n; b++) {
+          acc[b] = bias[k];
+        }
+        for (int y = 0; y < s->kernel_size_y; y++) {
+          for (int b = 0; b < n; b++) {
+            acc[b] += dot_s8(inputs[b] + window + y * input_row, filter + y * row_len, row_len);
+          }
+        }
+
+        size_t out = ((size_t)pos_y * s->output_width + pos_x) * s->filters + k;
+        for (int b = 0; b < n; b++) {
+          outputs[b][out] = (int8_t)clamp_s8(requantize_s8(acc[b], rq->multiplier[k], rq->shift[k]),
+                                             rq->output_min, rq->output_max);
+        }
+      }
+    }
+  }
+}
+
+// dense_s8() on n <= CNN_BATCH_SIZE input vectors
+static inline void dense_s8_batch(
+  const int8_t *const inputs[],   // [n] x [samples]
+  const int8_t *kernel,           // [units][samples]
+  const int32_t *bias,            // [units]
+  int8_t *const outputs[],        // [n] x [units]
+  int n,
+  int samples,
+  int units,
+  const requant_s8_t *rq) {
+
+  for (int k = 0; k < units; k++) {
+    const int8_t *row = kernel + (size_t)k * samples;
+    for (int b = 0; b < n; b++) {
+      int32_t acc = bias[k] + dot_s8(inputs[b], row, samples);
+      outputs[b][k] = (int8_t)clamp_s8(requantize_s8(acc, rq->multiplier[k], rq->shift[k]),
+                                       rq->output_min, rq->output_max);
+    }
+  }
+}
+
+// dense_s8_q15() on n <= CNN_BATCH_SIZE input vectors
+static inline void dense_s8_q15_batch(
+  const int8_t *const inputs[],
+  const int8_t *kernel,
+  const int32_t *bias,
+  int16_t *const outputs[],
+  int n,
+  int samples,
+  int units,
+  const requant_s8_t *rq) {
+
+  for (int k = 0; k < units; k++) {
+    const int8_t *row = kernel + (size_t)k * samples;
+    for (int b = 0; b < n; b++) {
+      int32_t acc = bias[k] + dot_s8(inputs[b], row, samples);
+      outputs[b][k] = (int16_t)clamp_s8(requantize_s8(acc, rq->multiplier[k], rq->shift[k]),
+                                        rq->output_min, rq->output_max);
+    }
+  }
+}
+
+#endif//_NN_INT8_H_
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
@@ -0,0 +1,317 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Hugo Meleiro - LEAT
+
+  Pipeline a trois etages qui recouvre pretraitement, inference et rapport :
+
+    source -> [depaquetage] -> infer_q -> [cnn + softmax] -> report_q -> [rapport]
+                   ^                                                        |
+                   +------------------------ free_q <-----------------------+
+
+  PIPELINE_DEPTH emplacements (entree, sortie, resultat, temps) circulent
+  entre les etages. Le depaquetage (source : image RGB565 -> input_t) et le
+  rapport (formatage, liaison serie) tournent chacun dans leur tache ;
+  l'inference reste sur l'appelant, un pipelineStep() par image. Pendant
+  que cnn() traite l'image N, l'image N+1 est preparee et le resultat N-1
+  envoye : le debit tend vers 1 / max(duree d'un etage).
+
+   - ESP32 : files FreeRTOS, taches de depaquetage et de rapport sur le
+     coeur PIPELINE_CORE (0), l'inference dans loop() sur le coeur 1.
+     A ne pas combiner avec WITH_DUAL_CORE ni WITH_WEIGHT_STREAM, qui
+     utilisent aussi le coeur 0.
+   - Hote : std::thread et anneaux SPSC sans verrou (un seul producteur et
+     un seul consommateur par file).
+
+  A inclure apres model.h, preprocess.h et postprocess.h.
+*/
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#ifndef POSTPROCESS_H
+#error "pipeline.h doit etre inclus apres postprocess.h"
+#endif
+
+#if defined(WITH_PIPELINE) && (defined(WITH_DUAL_CORE) || defined(WITH_WEIGHT_STREAM))
+#error "WITH_PIPELINE occupe le coeur 0, deja pris par WITH_DUAL_CORE et WITH_WEIGHT_STREAM"
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Emplacements en circulation : un par etage
+#ifndef PIPELINE_DEPTH
+#define PIPELINE_DEPTH 3
+#endif
+
+typedef struct {
+  uint32_t id;              // Numero de l'image dans le flux
+  bool end;                 // Marqueur de fin de flux, sans image
+  input_t inputs;
+  output_t outputs;
+  int label;
+  uint16_t confidence;      // Q15
+  uint32_t unpack_us;       // Duree de chaque etage
+  uint32_t infer_us;
+  uint32_t report_us;
+  uint64_t start_us;        // Debut du depaquetage
+} pipeline_slot_t;
+
+// Remplit slot->inputs avec l'image suivante ; false en fin de flux
+typedef bool (*pipeline_source_t)(void *context, pipeline_slot_t *slot);
+// Publie le resultat d'une image
+typedef void (*pipeline_sink_t)(void *context, const pipeline_slot_t *slot);
+
+#if defined(ESP_PLATFORM)
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+
+#ifndef PIPELINE_CORE
+#define PIPELINE_CORE 0
+#endif
+
+#ifndef PIPELINE_STACK
+#define PIPELINE_STACK 4096
+#endif
+
+typedef QueueHandle_t pipeline_queue_t;
+
+static inline uint64_t pipelineMicros(void) {
+  return (uint64_t)esp_timer_get_time();
+}
+
+static inline void pipelineQueueInit(pipeline_queue_t *q) {
+  *q = xQueueCreate(PIPELINE_DEPTH, sizeof(uint8_t));
+}
+
+static inline void pipelineQueuePush(pipeline_queue_t *q, uint8_t slot) {
+  xQueueSend(*q, &slot, portMAX_DELAY);
+}
+
+static inline uint8_t pipelineQueuePop(pipeline_queue_t *q) {
+  uint8_t slot;
+  xQueueReceive(*q, &slot, portMAX_DELAY);
+  return slot;
+}
+
+static inline void pipelineQueueFree(pipeline_queue_t *q) {
+  vQueueDelete(*q);
+}
+
+typedef TaskHandle_t pipeline_thread_t;
+
+#elif defined(__cplusplus)
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+static inline uint64_t pipelineMicros(void) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Anneau SPSC : push par le seul producteur, pop par le seul consommateur.
+// Une case de plus que d'emplacements, push ne trouve donc jamais l'anneau plein.
+struct pipeline_queue_t {
+  uint8_t slots[PIPELINE_DEPTH + 1];
+  std::atomic<uint32_t> head;   // Prochaine lecture (consommateur)
+  std::atomic<uint32_t> tail;   // Prochaine ecriture (producteur)
+};
+
+static inline void pipelineQueueInit(pipeline_queue_t *q) {
+  q->head.store(0, std::memory_order_relaxed);
+  q->tail.store(0, std::memory_order_relaxed);
+}
+
+static inline void pipelineQueuePush(pipeline_queue_t *q, uint8_t slot) {
+  uint32_t tail = q->tail.load(std::memory_order_relaxed);
+  q->slots[tail % (PIPELINE_DEPTH + 1)] = slot;
+  q->tail.store(tail + 1, std::memory_order_release);
+}
+
+static inline uint8_t pipelineQueuePop(pipeline_queue_t *q) {
+  uint32_t head = q->head.load(std::memory_order_relaxed);
+  while (q->tail.load(std::memory_order_acquire) == head) {
+    std::this_thread::yield();
+  }
+  uint8_t slot = q->slots[head % (PIPELINE_DEPTH + 1)];
+  q->head.store(head + 1, std::memory_order_release);
+  return slot;
+}
+
+static inline void pipelineQueueFree(pipeline_queue_t *q) {
+  (void)q;
+}
+
+// Un flux sans fin (camera) peut encore tourner quand le programme se
+// termine : le thread est alors detache plutot que d'appeler std::terminate
+struct pipeline_thread_t {
+  std::thread thread;
+  ~pipeline_thread_t() {
+    if (thread.joinable()) thread.detach();
+  }
+};
+
+#else
+#error "pipeline.h a besoin de FreeRTOS (ESP32) ou d'une compilation C++ sur l'hote"
+#endif
+
+typedef struct {
+  pipeline_slot_t slots[PIPELINE_DEPTH];
+  pipeline_queue_t free_q, infer_q, report_q;
+  pipeline_source_t source;
+  void *source_context;
+  pipeline_sink_t sink;
+  void *sink_context;
+  pipeline_thread_t unpacker, reporter;
+  bool running;
+} pipeline_t;
+
+// Etage 1 : depaquetage de l'image suivante dans un emplacement libre
+static inline void pipelineUnpackStage(pipeline_t *p) {
+  for (uint32_t id = 0;; id++) {
+    uint8_t index = pipelineQueuePop(&p->free_q);
+    pipeline_slot_t *slot = &p->slots[index];
+    slot->id = id;
+    slot->start_us = pipelineMicros();
+    slot->end = !p->source(p->source_context, slot);
+    slot->unpack_us = (uint32_t)(pipelineMicros() - slot->start_us);
+    pipelineQueuePush(&p->infer_q, index);
+    if (slot->end) {
+      return;
+    }
+  }
+}
+
+// Etage 3 : rapport, puis l'emplacement est rendu
+static inline void pipelineReportStage(pipeline_t *p) {
+  for (;;) {
+    uint8_t index = pipelineQueuePop(&p->report_q);
+    pipeline_slot_t *slot = &p->slots[index];
+    bool end = slot->end;
+    if (!end) {
+      uint64_t start = pipelineMicros();
+      p->sink(p->sink_context, slot);
+      slot->report_us = (uint32_t)(pipelineMicros() - start);
+    }
+    pipelineQueuePush(&p->free_q, index);
+    if (end) {
+      return;
+    }
+  }
+}
+
+#if defined(ESP_PLATFORM)
+
+static void pipelineUnpackTask(void *arg) {
+  pipelineUnpackStage((pipeline_t *)arg);
+  vTaskDelete(NULL);
+}
+
+static void pipelineReportTask(void *arg) {
+  pipelineReportStage((pipeline_t *)arg);
+  vTaskDelete(NULL);
+}
+
+// Rapport d'abord : si le depaquetage ne peut etre cree, un marqueur de fin
+// termine le rapport et rien ne reste bloque sur les files
+static inline bool pipelineStartStages(pipeline_t *p) {
+  if (xTaskCreatePinnedToCore(pipelineReportTask, "report", PIPELINE_STACK, p,
+                              uxTaskPriorityGet(NULL), &p->reporter, PIPELINE_CORE) != pdPASS) {
+    return false;
+  }
+  if (xTaskCreatePinnedToCore(pipelineUnpackTask, "unpack", PIPELINE_STACK, p,
+                              uxTaskPriorityGet(NULL), &p->unpacker, PIPELINE_CORE) != pdPASS) {
+    uint8_t index = pipelineQueuePop(&p->free_q);
+    p->slots[index].end = true;
+    pipelineQueuePush(&p->report_q, index);
+    for (int i = 0; i < PIPELINE_DEPTH; i++) {
+      pipelineQueuePop(&p->free_q);  // Attend que le rapport rende l'emplacement
+    }
+    return false;
+  }
+  return true;
+}
+
+// Les taches se terminent seules apres le marqueur de fin
+static inline void pipelineJoinStages(pipeline_t *p) {
+  (void)p;
+}
+
+#else
+
+static inline bool pipelineStartStages(pipeline_t *p) {
+  p->unpacker.thread = std::thread(pipelineUnpackStage, p);
+  p->reporter.thread = std::thread(pipelineReportStage, p);
+  return true;
+}
+
+static inline void pipelineJoinStages(pipeline_t *p) {
+  p->unpacker.thread.join();
+  p->reporter.thread.join();
+}
+
+#endif
+
+// Demarre les etages de depaquetage et de rapport. false si une tache n'a
+// pu etre creee : les files sont deja liberees, pas de pipelineEnd().
+static inline bool pipelineBegin(pipeline_t *p, pipeline_source_t source, void *source_context,
+                                 pipeline_sink_t sink, void *sink_context) {
+  p->source = source;
+  p->source_context = source_context;
+  p->sink = sink;
+  p->sink_context = sink_context;
+  pipelineQueueInit(&p->free_q);
+  pipelineQueueInit(&p->infer_q);
+  pipelineQueueInit(&p->report_q);
+  for (uint8_t i = 0; i < PIPELINE_DEPTH; i++) {
+    pipelineQueuePush(&p->free_q, i);
+  }
+  p->running = pipelineStartStages(p);
+  if (!p->running) {
+    pipelineQueueFree(&p->free_q);
+    pipelineQueueFree(&p->infer_q);
+    pipelineQueueFree(&p->report_q);
+  }
+  return p->running;
+}
+
+// Etage 2, sur l'appelant : inference d'une image. false en fin de flux.
+static inline bool pipelineStep(pipeline_t *p) {
+  if (!p->running) {
+    return false;
+  }
+  uint8_t index = pipelineQueuePop(&p->infer_q);
+  pipeline_slot_t *slot = &p->slots[index];
+  if (!slot->end) {
+    uint64_t start = pipelineMicros();
+    cnn(slot->inputs, slot->outputs);
+    slot->label = softmaxLabelQ15(slot->outputs, NULL, &slot->confidence);
+    slot->infer_us = (uint32_t)(pipelineMicros() - start);
+  } else {
+    p->running = false;
+  }
+  pipelineQueuePush(&p->report_q, index);
+  return p->running;
+}
+
+// Attend la fin du flux (tous les rapports envoyes) puis libere les files
+static inline void pipelineEnd(pipeline_t *p) {
+  while (pipelineStep(p)) {
+  }
+  pipelineJoinStages(p);
+  // Les etages sont termines : l'appelant peut vider free_q
+  for (int i = 0; i < PIPELINE_DEPTH; i++) {
+    pipelineQueuePop(&p->free_q);
+  }
+  pipelineQueueFree(&p->free_q);
+  pipelineQueueFree(&p->infer_q);
+  pipelineQueueFree(&p->report_q);
+}
+
+#endif // PIPELINE_H
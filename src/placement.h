@@ -0,0 +1,175 @@
+/**
+  ******************************************************************************
+  * @file    placement.h
+  * @brief   Per-tensor residency of the weight tables: flash, internal DRAM
+  *          or PSRAM, with a boot-time copy
+  *
+  * Build with -DWITH_PLACEMENT. The weight tables of model.h are const
+  * arrays: on the ESP32-S3 they stay in flash and every read goes through
+  * the flash cache, which conv2d_3 (147 KB) and dense (16 KB), each weight
+  * read once per inference, keep evicting. placementSet() declares where a
+  * table should live, placementApply() copies the tables not left in flash
+  * to internal DRAM or PSRAM, and cnn() reads every table through
+  * placementResolve(), which returns the copy if there is one.
+  *
+  * A table that cannot be allocated stays in flash, so a too ambitious map
+  * only costs speed. IRAM is not offered: it only allows 32-bit accesses and
+  * the kernels read int16 values.
+  *
+  * On the host both regions are plain heap memory (no flash cache), which
+  * checks the mechanism but not the latency of the ESP32-S3 regions.
+  */
+
+#ifndef _PLACEMENT_H_
+#define _PLACEMENT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "esp_heap_caps.h"
+#else
+#include <stdlib.h>
+#endif
+
+#ifndef PLACEMENT_MAX_TABLES
+#define PLACEMENT_MAX_TABLES 32
+#endif
+
+#define PLACEMENT_ALIGNMENT 16  // NN_ALIGNED, for the SIMD kernels
+
+typedef enum {
+  PLACEMENT_FLASH,   // const table as linked
+  PLACEMENT_DRAM,    // internal SRAM
+  PLACEMENT_PSRAM,   // external octal PSRAM (BOARD_HAS_PSRAM)
+  PLACEMENT_REGIONS
+} placement_region_t;
+
+typedef struct {
+  const char *name;
+  const void *table;          // flash table
+  size_t size;
+  placement_region_t region;  // requested
+  void *copy;                 // NULL while the table is read from flash
+} placement_entry_t;
+
+typedef struct {
+  placement_entry_t entries[PLACEMENT_MAX_TABLES];
+  size_t count;
+} placement_map_t;
+
+static placement_map_t placement_map;
+
+static inline const char *placementRegionName(placement_region_t region) {
+  static const char * const names[PLACEMENT_REGIONS] = {"flash", "dram", "psram"};
+  return region < PLACEMENT_REGIONS ? names[region] : "?";
+}
+
+static inline void *placement_alloc(size_t size, placement_region_t region) {
+#if defined(ESP_PLATFORM)
+  uint32_t caps = region == PLACEMENT_PSRAM ? MALLOC_CAP_SPIRAM : MALLOC_CAP_INTERNAL;
+  return heap_caps_aligned_alloc(PLACEMENT_ALIGNMENT, size, caps | MALLOC_CAP_8BIT);
+#else
+  (void)region;
+  return aligned_alloc(PLACEMENT_ALIGNMENT, (size + PLACEMENT_ALIGNMENT - 1) & ~(size_t)(PLACEMENT_ALIGNMENT - 1));
+#endif
+}
+
+static inline void placement_free(void *copy) {
+#if defined(ESP_PLATFORM)
+  heap_caps_free(copy);
+#else
+  free(copy);
+#endif
+}
+
+// Declare the residency of a table, replacing a previous declaration.
+// Takes effect at the next placementApply(). Returns -1 if the map is full.
+static inline int placementSet(const char *name, const void *table, size_t size, placement_region_t region) {
+  for (size_t i = 0; i < placement_map.count; i++) {
+    if (placement_map.entries[i].table == table) {
+      placement_map.entries[i].region = region;
+      return 0;
+    }
+  }
+  if (placement_map.count == PLACEMENT_MAX_TABLES) {
+    return -1;
+  }
+  placement_entry_t *e = &placement_map.entries[placement_map.count++];
+  e->name = name;
+  e->table = table;
+  e->size = size;
+  e->region = region;
+  e->copy = NULL;
+  return 0;
+}
+
+// Free every copy: all the tables are read from flash again
+static inline void placementRelease(void) {
+  for (size_t i = 0; i < placement_map.count; i++) {
+    placement_free(placement_map.entries[i].copy);
+    placement_map.entries[i].copy = NULL;
+  }
+}
+
+// Copy the tables to their region. Returns the number of tables left in
+// flash because their region had no room. Not to be called during an
+// inference.
+static inline int placementApply(void) {
+  int failed = 0;
+  placementRelease();
+  for (size_t i = 0; i < placement_map.count; i++) {
+    placement_entry_t *e = &placement_map.entries[i];
+    if (e->region == PLACEMENT_FLASH) {
+      continue;
+    }
+    e->copy = placement_alloc(e->size, e->region);
+    if (e->copy == NULL) {
+      failed++;
+      continue;
+    }
+    memcpy(e->copy, e->table, e->size);
+  }
+  return failed;
+}
+
+// Forget every declaration
+static inline void placementClear(void) {
+  placementRelease();
+  placement_map.count = 0;
+}
+
+// Address to read `table` from: its copy, or the table itself
+static inline const void *placementResolve(const void *table) {
+  for (size_t i = 0; i < placement_map.count; i++) {
+    if (placement_map.entries[i].table == table) {
+      return placement_map.entries[i].copy ? placement_map.entries[i].copy : table;
+    }
+  }
+  return table;
+}
+
+// Region a table is actually read from
+static inline placement_region_t placementRegion(const void *table) {
+  for (size_t i = 0; i < placement_map.count; i++) {
+    if (placement_map.entries[i].table == table) {
+      return placement_map.entries[i].copy ? placement_map.entries[i].region : PLACEMENT_FLASH;
+    }
+  }
+  return PLACEMENT_FLASH;
+}
+
+// Bytes of the declared tables currently read from `region`
+static inline size_t placementBytes(placement_region_t region) {
+  size_t bytes = 0;
+  for (size_t i = 0; i < placement_map.count; i++) {
+    const placement_entry_t *e = &placement_map.entries[i];
+    if ((e->copy ? e->region : PLACEMENT_FLASH) == region) {
+      bytes += e->size;
+    }
+  }
+  return bytes;
+}
+
+#endif//_PLACEMENT_H_
@@ -0,0 +1,164 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Hugo Meleiro - LEAT
+
+  Post-traitement de la sortie du modele : softmax, classe predite et libelles.
+  A inclure apres model.h (utilise output_t).
+*/
+
+#ifndef POSTPROCESS_H
+#define POSTPROCESS_H
+
+#ifndef __MODEL_H__
+#error "postprocess.h doit etre inclus apres model.h"
+#endif
+
+#include <math.h>
+#include <stdint.h>
+
+#define NBLABELS 28
+
+// Libelles des 28 classes du modele
+static const char * const LABELS[NBLABELS] = {
+  "20 km/h",
+  "30 km/h",
+  "50 km/h",
+  "60 km/h",
+  "70 km/h",
+  "80 km/h",
+  "100 km/h",
+  "120 km/h",
+  "Wrong way",
+  "Stop",
+  "Yield",
+  "Danger",
+  "Dangerous left turn",
+  "Dangerous right turn",
+  "Winding road",
+  "Slippery road",
+  "Crosswalk",
+  "Bicycles",
+  "Animals",
+  "Red light",
+  "Road bumps",
+  "Workers ahead",
+  "Right or Forward",
+  "Left or Forward",
+  "Right",
+  "Left",
+  "Forward",
+  "End of game",
+};
+
+static inline const char *labelName(int label) {
+  if (label < 0 || label >= NBLABELS) {
+    return NULL;
+  }
+  return LABELS[label];
+}
+
+// Calcule le softmax des sorties et renvoie la classe predite,
+// la confiance de cette classe est ecrite dans *confidence.
+// Version flottante d'origine, gardee comme reference pour bench_softmax :
+// exp(outputs[i]/100) est une division entiere et la somme ignore la classe 0,
+// la confiance n'est donc qu'une approximation du softmax.
+static inline int softmaxLabel(const output_t outputs, float *confidence) {
+  int label = 0;
+  float sum = 0;
+  float max_val = outputs[0];
+  for (int i = 1; i < NBLABELS; i++) {
+    sum += exp(outputs[i]/100);
+    if (max_val < outputs[i]) {
+      max_val = (float)outputs[i];
+      label = i;
+    }
+  }
+
+  //calculate prediction accuracy with softmax
+  float softmax[NBLABELS];
+
+  for (int i = 0; i < NBLABELS; i++) {
+    softmax[i] = exp(outputs[i]/100) / sum;
+  }
+
+  *confidence = softmax[label];
+  return label;
+}
+
+/*
+  Softmax en virgule fixe, sans libm ni flottants.
+
+  Les sorties sont des logits Q7 (MODEL_OUTPUT_SCALE_FACTOR). On soustrait le
+  maximum (normalisation log-sum-exp : exp(x - max) <= 1, pas de debordement)
+  puis exp(-d / 128) est calcule par deux tables Q15 :
+    d = 32 * hi + lo,  exp(-d/128) = EXP_HI[hi] * EXP_LO[lo]
+  avec EXP_HI[j] = exp(-j/4) et EXP_LO[k] = exp(-k/128). Au-dela de
+  d = 45 * 32 (logit plus petit de 11.25 que le max) le terme est nul en Q15.
+  Les probabilites sont rendues en Q15 (SOFTMAX_ONE = 1.0).
+*/
+#if MODEL_OUTPUT_SCALE_FACTOR != 7
+#error "Les tables de softmaxLabelQ15 supposent des sorties Q7"
+#endif
+
+#define SOFTMAX_ONE 32768
+#define SOFTMAX_HI_SHIFT 5
+#define SOFTMAX_HI_SIZE 45
+
+// round(exp(-j / 4) * 32768)
+static const uint16_t SOFTMAX_EXP_HI[SOFTMAX_HI_SIZE] = {
+  32768, 25520, 19875, 15479, 12055, 9388, 7312, 5694, 4435, 3454, 2690, 2095,
+  1631, 1271, 990, 771, 600, 467, 364, 283, 221, 172, 134, 104, 81, 63, 49, 38,
+  30, 23, 18, 14, 11, 9, 7, 5, 4, 3, 2, 2, 1, 1, 1, 1, 1,
+};
+
+// round(exp(-k / 128) * 32768)
+static const uint16_t SOFTMAX_EXP_LO[1 << SOFTMAX_HI_SHIFT] = {
+  32768, 32513, 32260, 32009, 31760, 31513, 31267, 31024, 30783, 30543, 30305,
+  30070, 29836, 29603, 29373, 29144, 28918, 28693, 28469, 28248, 28028, 27810,
+  27593, 27379, 27166, 26954, 26744, 26536, 26330, 26125, 25922, 25720,
+};
+
+// exp(-d / 128) en Q15 pour d >= 0 (d en Q7)
+static inline uint32_t softmaxExpQ15(int32_t d) {
+  int32_t hi = d >> SOFTMAX_HI_SHIFT;
+  if (hi >= SOFTMAX_HI_SIZE) {
+    return 0;
+  }
+  return ((uint32_t)SOFTMAX_EXP_HI[hi] * SOFTMAX_EXP_LO[d & ((1 << SOFTMAX_HI_SHIFT) - 1)]
+          + (SOFTMAX_ONE / 2)) >> 15;
+}
+
+// Classe predite (argmax, premiere en cas d'egalite)
+static inline int argmaxLabel(const output_t outputs) {
+  int label = 0;
+  for (int i = 1; i < NBLABELS; i++) {
+    if (outputs[i] > outputs[label]) {
+      label = i;
+    }
+  }
+  return label;
+}
+
+// Softmax complet en Q15 dans probs (peut etre NULL), renvoie la classe
+// predite et ecrit sa confiance Q15 dans *confidence
+static inline int softmaxLabelQ15(const output_t outputs, uint16_t probs[NBLABELS], uint16_t *confidence) {
+  int label = argmaxLabel(outputs);
+  uint32_t e[NBLABELS];
+  uint32_t sum = 0;
+
+  for (int i = 0; i < NBLABELS; i++) {
+    e[i] = softmaxExpQ15((int32_t)outputs[label] - outputs[i]);
+    sum += e[i];  // >= SOFTMAX_ONE grace au terme du max
+  }
+
+  if (probs != NULL) {
+    for (int i = 0; i < NBLABELS; i++) {
+      probs[i] = (uint16_t)(((e[i] << 15) + sum / 2) / sum);
+    }
+  }
+  *confidence = (uint16_t)(((e[label] << 15) + sum / 2) / sum);
+  return label;
+}
+
+#endif // POSTPROCESS_H
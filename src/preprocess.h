@@ -0,0 +1,139 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Hugo Meleiro - LEAT
+
+  Pretraitement des images RGB565 vers le tenseur d'entree du modele.
+  A inclure apres model.h (utilise input_t).
+
+  La conversion passe par des tables precalculees (une par canal, indexees
+  par le champ 5 ou 6 bits du pixel) qui donnent directement la valeur en
+  virgule fixe Q(MODEL_INPUT_SCALE_FACTOR) attendue par le modele : pas de
+  calcul flottant ni d'arrondi par pixel.
+
+  PREPROCESS_NORMALIZATION choisit la valeur reelle associee a un code :
+   - PREPROCESS_NORM_CODE (defaut) : code / 128, soit le code brut 0..31/63
+     en Q7, l'entree avec laquelle le modele a ete valide ;
+   - PREPROCESS_NORM_UNIT : code / max dans [0, 1] (31 ou 63).
+*/
+
+#ifndef PREPROCESS_H
+#define PREPROCESS_H
+
+#ifndef __MODEL_H__
+#error "preprocess.h doit etre inclus apres model.h"
+#endif
+
+#include <stdint.h>
+
+#define PREPROCESS_NORM_CODE 0
+#define PREPROCESS_NORM_UNIT 1
+
+#ifndef PREPROCESS_NORMALIZATION
+#define PREPROCESS_NORMALIZATION PREPROCESS_NORM_CODE
+#endif
+
+// Diviseur de chaque canal : valeur reelle = code / diviseur
+#if PREPROCESS_NORMALIZATION == PREPROCESS_NORM_CODE
+#define PREPROCESS_DIV_5 128
+#define PREPROCESS_DIV_6 128
+#elif PREPROCESS_NORMALIZATION == PREPROCESS_NORM_UNIT
+#define PREPROCESS_DIV_5 31
+#define PREPROCESS_DIV_6 63
+#else
+#error "PREPROCESS_NORMALIZATION inconnue"
+#endif
+
+// round(code * 2^MODEL_INPUT_SCALE_FACTOR / div), evalue a la compilation
+#define PREPROCESS_Q(c, div) \
+  (int16_t)((2L * (c) * (1L << MODEL_INPUT_SCALE_FACTOR) + (div)) / (2L * (div)))
+// Extension d'un code 5/6 bits sur 8 bits : round(code * 255 / max)
+#define PREPROCESS_8BIT(c, max) (uint8_t)(((c) * 255 + (max) / 2) / (max))
+
+// Generation des tables : F(0), F(1), ... F(n - 1)
+#define PREPROCESS_REP8(F, b) F((b) + 0), F((b) + 1), F((b) + 2), F((b) + 3), \
+                              F((b) + 4), F((b) + 5), F((b) + 6), F((b) + 7)
+#define PREPROCESS_REP32(F) PREPROCESS_REP8(F, 0), PREPROCESS_REP8(F, 8), \
+                            PREPROCESS_REP8(F, 16), PREPROCESS_REP8(F, 24)
+#define PREPROCESS_REP64(F) PREPROCESS_REP32(F), PREPROCESS_REP8(F, 32), PREPROCESS_REP8(F, 40), \
+                            PREPROCESS_REP8(F, 48), PREPROCESS_REP8(F, 56)
+
+#define PREPROCESS_Q5(c) PREPROCESS_Q(c, PREPROCESS_DIV_5)
+#define PREPROCESS_Q6(c) PREPROCESS_Q(c, PREPROCESS_DIV_6)
+#define PREPROCESS_8BIT5(c) PREPROCESS_8BIT(c, 31)
+#define PREPROCESS_8BIT6(c) PREPROCESS_8BIT(c, 63)
+
+// Valeur d'entree du modele pour un code rouge/bleu (5 bits) ou vert (6 bits)
+static const int16_t PREPROCESS_LUT5[32] = { PREPROCESS_REP32(PREPROCESS_Q5) };
+static const int16_t PREPROCESS_LUT6[64] = { PREPROCESS_REP64(PREPROCESS_Q6) };
+// Valeur 8 bits d'un code 5 ou 6 bits (affichage, outils)
+static const uint8_t RGB565_TO_8BIT5[32] = { PREPROCESS_REP32(PREPROCESS_8BIT5) };
+static const uint8_t RGB565_TO_8BIT6[64] = { PREPROCESS_REP64(PREPROCESS_8BIT6) };
+
+// Fonction pour convertir le rgb 565 en RGB 8 bits
+static inline void rgb565_to_rgb888(unsigned short rgb565, int* red8, int* green8, int* blue8) {
+  *red8 = RGB565_TO_8BIT5[rgb565 >> 11];
+  *green8 = RGB565_TO_8BIT6[(rgb565 >> 5) & 0x3F];
+  *blue8 = RGB565_TO_8BIT5[rgb565 & 0x1F];
+}
+
+// Avec PREPROCESS_NORM_CODE en Q7 les tables sont l'identite : les champs
+// sont alors copies directement, ce que le compilateur vectorise.
+#if PREPROCESS_NORMALIZATION == PREPROCESS_NORM_CODE && MODEL_INPUT_SCALE_FACTOR == 7
+#define PREPROCESS_R(p) (int16_t)((p) >> 11)
+#define PREPROCESS_G(p) (int16_t)(((p) >> 5) & 0x3F)
+#define PREPROCESS_B(p) (int16_t)((p) & 0x1F)
+#else
+#define PREPROCESS_R(p) PREPROCESS_LUT5[(p) >> 11]
+#define PREPROCESS_G(p) PREPROCESS_LUT6[((p) >> 5) & 0x3F]
+#define PREPROCESS_B(p) PREPROCESS_LUT5[(p) & 0x1F]
+#endif
+
+// Convertit la fenetre 32x32 en (x0, y0) d'une image RGB565 de largeur
+// `width` en tenseur d'entree
+static inline void rgb565FrameToInput(const unsigned short *frame, int width, int x0, int y0,
+                                      input_t inputs) {
+  for (int i = 0; i < 32; i++) {
+    const unsigned short *row = &frame[(i + y0) * width + x0];
+    for (int j = 0; j < 32; j++) {
+      uint16_t pixel = row[j];
+      inputs[i][j][0] = PREPROCESS_R(pixel); // Rouge (5 bits)
+      inputs[i][j][1] = PREPROCESS_G(pixel); // Vert (6 bits)
+      inputs[i][j][2] = PREPROCESS_B(pixel); // Bleu (5 bits)
+    }
+  }
+}
+
+// Inference sur la fenetre 32x32 en (x0, y0) d'une image RGB565 de largeur
+// `width`, sans passer par input_t : la premiere convolution lit et convertit
+// les pixels elle-meme (cnn_rgb565), avec les memes tables que
+// rgb565FrameToInput, donc le meme resultat que pixelProcess32 + cnn.
+// Economise les 6 Ko de input_t mais reste plus lent que pixelProcess32 +
+// cnn (bench_fused) : main.cpp ne l'utilise qu'avec WITH_FUSED_RGB565.
+static inline void cnnRGB565(const unsigned short *frame, int width, int x0, int y0,
+                             output_t outputs) {
+  cnn_rgb565(&frame[y0 * width + x0], width, PREPROCESS_LUT5, PREPROCESS_LUT6, outputs);
+}
+
+#include "resample.h"
+
+static inline void pixelProcess32(const unsigned short *trafficSign, input_t inputs){
+  rgb565FrameToInput(trafficSign, 32, 0, 0, inputs);
+}
+
+// Filtre de pixelProcess43 (resample.h)
+#ifndef PREPROCESS_43_FILTER
+#define PREPROCESS_43_FILTER RESAMPLE_AREA
+#endif
+
+static inline void pixelProcess43(const unsigned short *trafficSign, input_t inputs){
+#ifdef PREPROCESS_43_CROP
+  // Ancien comportement : fenetre centrale 32x32, les pixels au dela sont perdus
+  rgb565FrameToInput(trafficSign, 43, (43 - 32) / 2, (43 - 32) / 2, inputs);
+#else
+  // Toute l'image est ramenee a 32x32
+  resample565(trafficSign, 43, 43, 43, PREPROCESS_43_FILTER, inputs);
+#endif
+}
+
+#endif // PREPROCESS_H
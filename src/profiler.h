@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file    profiler.h
+  * @brief   Opt-in per-layer latency instrumentation for cnn()
+  *
+  * Build with -DWITH_LAYER_PROFILING to record the duration of every layer
+  * call in cnn(). Durations are CPU cycles on Xtensa targets (CCOUNT register)
+  * and nanoseconds on the host. Without the flag all macros expand to nothing.
+  */
+
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef WITH_LAYER_PROFILING
+
+#include <stdio.h>
+#if !defined(__XTENSA__)
+#include <time.h>
+#endif
+
+#define PROFILER_MAX_LAYERS 16
+
+#if defined(__XTENSA__)
+#define PROFILER_TICK_UNIT "cycles"
+#else
+#define PROFILER_TICK_UNIT "ns"
+#endif
+
+typedef struct {
+  uint32_t last[PROFILER_MAX_LAYERS];   // Duration of each layer during the last inference
+  uint64_t total[PROFILER_MAX_LAYERS];  // Accumulated duration since the last reset
+  uint32_t runs;                        // Number of inferences since the last reset
+  uint32_t start;                       // Timestamp of the layer being measured
+} profiler_state_t;
+
+static profiler_state_t profiler_state;
+
+static inline uint32_t profiler_ticks(void) {
+#if defined(__XTENSA__)
+  uint32_t ccount;
+  __asm__ __volatile__("rsr %0, ccount" : "=a"(ccount));
+  return ccount;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+#endif
+}
+
+static inline void profiler_record(unsigned int layer, uint32_t ticks) {
+  profiler_state.last[layer] = ticks;
+  profiler_state.total[layer] += ticks;
+}
+
+static inline void profiler_reset(void) {
+  for (size_t i = 0; i < PROFILER_MAX_LAYERS; i++) {
+    profiler_state.last[i] = 0;
+    profiler_state.total[i] = 0;
+  }
+  profiler_state.runs = 0;
+}
+
+#define PROFILE_LAYER_BEGIN() (profiler_state.start = profiler_ticks())
+#define PROFILE_LAYER_END(layer) profiler_record((layer), profiler_ticks() - profiler_state.start)
+#define PROFILE_INFERENCE_END() (profiler_state.runs++)
+
+#else
+
+#define PROFILE_LAYER_BEGIN()
+#define PROFILE_LAYER_END(layer)
+#define PROFILE_INFERENCE_END()
+
+#endif // WITH_LAYER_PROFILING
+
+#endif//_PROFILER_H_
@@ -0,0 +1,236 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Hugo Meleiro - LEAT
+
+  Protocole binaire sur la liaison serie : l'hote envoie des tuiles RGB565,
+  la carte renvoie label, confiance et temps d'inference.
+
+  Trame : COBS(type | seq | corps | crc16) suivi d'un octet 0x00.
+   - type : PROTOCOL_*, les reponses ont le bit 0x80 ;
+   - seq : numero de sequence 16 bits choisi par l'hote, recopie dans la reponse ;
+   - crc16 : CRC-16/CCITT-FALSE de type, seq et corps.
+  Tous les entiers sont little-endian. COBS retire les 0x00 de la trame, le
+  recepteur se resynchronise donc sur le prochain 0x00 apres un octet perdu
+  ou du texte (Serial.println) glisse dans le flux.
+
+  Messages (corps) :
+   PING   hote -> carte : vide
+   PONG   carte -> hote : version u8, tuile max u8, debit u32
+   IMAGE  hote -> carte : largeur u8, hauteur u8, pixels RGB565 u16[h][w]
+   RESULT carte -> hote : label u8 (0xFF si aucun), confiance u16 (Q15),
+                          inference_us u32, total_us u32 (tuile -> resultat)
+   BAUD   hote -> carte : debit u32 ; ACK renvoye a l'ancien debit, puis changement
+   ACK    carte -> hote : debit u32
+   ERROR  carte -> hote : code u8 (PROTOCOL_ERR_*)
+   TELEMETRY carte -> hote : enregistrement de telemetry.h, sans requete
+   MODEL_BEGIN  hote -> carte : taille u32 du blob (tools/export_blob.py)
+   MODEL_DATA   hote -> carte : offset u32, octets du blob (PROTOCOL_MODEL_CHUNK au plus)
+   MODEL_COMMIT hote -> carte : vide ; verification du blob puis bascule de cnn()
+   MODEL_INFO   hote -> carte : vide
+   MODEL        carte -> hote : statut u8 (0 ou code de model_store.h), emplacement u8
+                                (0xFF : poids compiles), octets recus u32, nom char[32]
+                                du modele actif ; reponse aux quatre messages MODEL_*
+
+  Ce fichier ne fait que le codage et le decodage : main.cpp (WITH_SERIAL_PROTOCOL)
+  branche les messages sur Serial et le modele, tools/serial_infer.py est le
+  client hote. Les messages MODEL_* demandent WITH_MODEL_STORE, leur client
+  est tools/serial_model.py.
+*/
+
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#define PROTOCOL_VERSION 2
+
+#define PROTOCOL_PING   0x01
+#define PROTOCOL_IMAGE  0x02
+#define PROTOCOL_BAUD   0x03
+#define PROTOCOL_MODEL_BEGIN  0x04
+#define PROTOCOL_MODEL_DATA   0x05
+#define PROTOCOL_MODEL_COMMIT 0x06
+#define PROTOCOL_MODEL_INFO   0x07
+#define PROTOCOL_PONG   0x81
+#define PROTOCOL_RESULT 0x82
+#define PROTOCOL_ACK    0x83
+#define PROTOCOL_TELEMETRY 0x84
+#define PROTOCOL_MODEL  0x85
+#define PROTOCOL_ERROR  0x8F
+
+#define PROTOCOL_ERR_TYPE 1   // Type de message inconnu
+#define PROTOCOL_ERR_SIZE 2   // Taille de tuile ou de corps invalide
+#define PROTOCOL_ERR_BAUD 3   // Debit refuse
+
+// Plus grande tuile acceptee (resample.h redimensionne vers 32x32)
+#ifndef PROTOCOL_MAX_TILE
+#define PROTOCOL_MAX_TILE 64
+#endif
+
+#define PROTOCOL_HEADER 3     // type + seq
+#define PROTOCOL_CRC 2
+#define PROTOCOL_MAX_PAYLOAD (PROTOCOL_HEADER + 2 + 2 * PROTOCOL_MAX_TILE * PROTOCOL_MAX_TILE + PROTOCOL_CRC)
+// COBS ajoute un octet tous les 254, plus le code initial
+#define PROTOCOL_MAX_ENCODED (PROTOCOL_MAX_PAYLOAD + PROTOCOL_MAX_PAYLOAD / 254 + 1)
+
+#define PROTOCOL_RESULT_SIZE 11
+#define PROTOCOL_MODEL_SIZE 38
+// Plus long corps de reponse
+#define PROTOCOL_MAX_REPLY PROTOCOL_MODEL_SIZE
+
+// Octets de blob par MODEL_DATA, un secteur de flash
+#define PROTOCOL_MODEL_CHUNK 4096
+#if 4 + PROTOCOL_MODEL_CHUNK > 2 + 2 * PROTOCOL_MAX_TILE * PROTOCOL_MAX_TILE
+#error "PROTOCOL_MODEL_CHUNK ne tient pas dans une trame, augmenter PROTOCOL_MAX_TILE"
+#endif
+
+static inline uint16_t protocolCrc16(const uint8_t *data, size_t len) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < len; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (int b = 0; b < 8; b++) {
+      crc = crc & 0x8000 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static inline void protocolPut16(uint8_t *p, uint16_t v) {
+  p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static inline void protocolPut32(uint8_t *p, uint32_t v) {
+  protocolPut16(p, (uint16_t)v);
+  protocolPut16(p + 2, (uint16_t)(v >> 16));
+}
+
+static inline uint16_t protocolGet16(const uint8_t *p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t protocolGet32(const uint8_t *p) {
+  return protocolGet16(p) | ((uint32_t)protocolGet16(p + 2) << 16);
+}
+
+// COBS de src vers dst (taille len + len / 254 + 1 au plus), sans delimiteur
+static inline size_t protocolCobsEncode(const uint8_t *src, size_t len, uint8_t *dst) {
+  size_t code_pos = 0, out = 1;
+  uint8_t code = 1;
+  for (size_t i = 0; i < len; i++) {
+    if (src[i] == 0) {
+      dst[code_pos] = code;
+      code_pos = out++;
+      code = 1;
+    } else {
+      dst[out++] = src[i];
+      if (++code == 0xFF) {
+        dst[code_pos] = code;
+        code_pos = out++;
+        code = 1;
+      }
+    }
+  }
+  dst[code_pos] = code;
+  return out;
+}
+
+// Decodage COBS en place. Retourne la taille decodee, ou -1 si invalide.
+static inline int protocolCobsDecode(uint8_t *buf, size_t len) {
+  size_t in = 0, out = 0;
+  while (in < len) {
+    uint8_t code = buf[in++];
+    if (code == 0 || in + code - 1 > len) {
+      return -1;
+    }
+    for (uint8_t i = 1; i < code; i++) {
+      buf[out++] = buf[in++];
+    }
+    if (code != 0xFF && in < len) {
+      buf[out++] = 0;
+    }
+  }
+  return (int)out;
+}
+
+// Taille maximale d'une trame de len octets de corps, delimiteur compris
+#define PROTOCOL_FRAME_SIZE(len) \
+  ((PROTOCOL_HEADER + (len) + PROTOCOL_CRC) + (PROTOCOL_HEADER + (len) + PROTOCOL_CRC) / 254 + 2)
+
+// Construit une trame complete (delimiteur compris) dans frame, de capacity
+// octets. Retourne sa taille, 0 si PROTOCOL_FRAME_SIZE(len) depasse capacity.
+static inline size_t protocolEncode(uint8_t type, uint16_t seq, const uint8_t *body, size_t len,
+                                    uint8_t *frame, size_t capacity) {
+  if (len + PROTOCOL_HEADER + PROTOCOL_CRC > PROTOCOL_MAX_PAYLOAD || PROTOCOL_FRAME_SIZE(len) > capacity) {
+    return 0;
+  }
+  // La trame en clair est construite a la fin du tampon et COBS l'encode
+  // vers le debut : l'ecriture n'a jamais plus de 1 + i / 254 octets
+  // d'avance, elle ne rattrape donc pas la lecture
+  size_t raw_len = PROTOCOL_HEADER + len + PROTOCOL_CRC;
+  uint8_t *raw = frame + capacity - raw_len;
+  memmove(raw + PROTOCOL_HEADER, body, len);
+  raw[0] = type;
+  protocolPut16(raw + 1, seq);
+  protocolPut16(raw + PROTOCOL_HEADER + len, protocolCrc16(raw, PROTOCOL_HEADER + len));
+  size_t n = protocolCobsEncode(raw, raw_len, frame);
+  frame[n] = 0;
+  return n + 1;
+}
+
+typedef struct {
+  uint8_t buf[PROTOCOL_MAX_ENCODED];
+  size_t len;
+  bool overflow;          // Trame trop longue, ignoree jusqu'au prochain 0x00
+  uint32_t errors;        // Trames rejetees (COBS, CRC, taille)
+} protocol_decoder_t;
+
+typedef struct {
+  uint8_t type;
+  uint16_t seq;
+  const uint8_t *body;
+  size_t len;
+} protocol_message_t;
+
+static inline void protocolDecoderInit(protocol_decoder_t *d) {
+  d->len = 0;
+  d->overflow = false;
+  d->errors = 0;
+}
+
+// Consomme un octet recu. Retourne 1 quand une trame valide est complete
+// (message rempli, valable jusqu'au prochain appel), 0 sinon.
+static inline int protocolFeed(protocol_decoder_t *d, uint8_t byte, protocol_message_t *message) {
+  if (byte != 0) {
+    if (d->len < sizeof(d->buf)) {
+      d->buf[d->len++] = byte;
+    } else {
+      d->overflow = true;
+    }
+    return 0;
+  }
+  size_t len = d->len;
+  bool overflow = d->overflow;
+  d->len = 0;
+  d->overflow = false;
+  if (len == 0) {
+    return 0; // Delimiteurs consecutifs : resynchronisation
+  }
+  int n = overflow ? -1 : protocolCobsDecode(d->buf, len);
+  if (n < PROTOCOL_HEADER + PROTOCOL_CRC
+      || protocolCrc16(d->buf, n - PROTOCOL_CRC) != protocolGet16(d->buf + n - PROTOCOL_CRC)) {
+    d->errors++;
+    return 0;
+  }
+  message->type = d->buf[0];
+  message->seq = protocolGet16(d->buf + 1);
+  message->body = d->buf + PROTOCOL_HEADER;
+  message->len = n - PROTOCOL_HEADER - PROTOCOL_CRC;
+  return 1;
+}
+
+#endif // PROTOCOL_H
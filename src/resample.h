@@ -0,0 +1,217 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Hugo Meleiro - LEAT
+
+  Redimensionnement en virgule fixe d'une image RGB565 de taille quelconque
+  (ROI camera, tuiles GTSRB 43x43, crops 64x64...) vers le tenseur 32x32 du
+  modele, avec un filtre par moyenne de surface (RESAMPLE_AREA) ou bilineaire
+  (RESAMPLE_BILINEAR).
+
+  Le calcul est entierement entier et se fait ligne par ligne : les lignes
+  source sont poussees dans l'ordre avec resamplerPushRow() et chaque ligne
+  de sortie est ecrite des qu'elle est complete. L'etat ne garde que deux
+  lignes de 32 pixels deja filtrees horizontalement, il n'y a donc pas de
+  tampon de la taille de l'image.
+
+  La normalisation (PREPROCESS_NORMALIZATION) est celle de preprocess.h.
+  Sur une image 32x32 les deux filtres redonnent exactement pixelProcess32.
+  A inclure via preprocess.h.
+*/
+
+#ifndef RESAMPLE_H
+#define RESAMPLE_H
+
+#ifndef PREPROCESS_DIV_5
+#error "resample.h doit etre inclus via preprocess.h"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#define RESAMPLE_AREA     0
+#define RESAMPLE_BILINEAR 1
+
+// Taille de la sortie (input_t)
+#define RESAMPLE_OUT 32
+// Precision des poids bilineaires (Q8 par axe, Q16 au total)
+#define RESAMPLE_FRAC_BITS 8
+#define RESAMPLE_ONE (1 << RESAMPLE_FRAC_BITS)
+
+typedef struct {
+  int mode;
+  int width, height;      // Taille de la source
+  int row;                // Prochaine ligne source attendue
+  int y;                  // Prochaine ligne de sortie
+  uint64_t recip5, recip6; // 2^(MODEL_INPUT_SCALE_FACTOR + 32) / (diviseur * poids total)
+  uint32_t acc[RESAMPLE_OUT][3];  // Surface : ligne de sortie en cours d'accumulation
+  uint32_t prev[RESAMPLE_OUT][3]; // Bilineaire : ligne source y0 filtree horizontalement
+  int16_t (*out)[RESAMPLE_OUT][3];
+} resampler_t;
+
+static inline uint64_t resampleReciprocal(uint32_t divisor, uint64_t total) {
+  uint64_t d = (uint64_t)divisor * total;
+  return (((uint64_t)1 << (MODEL_INPUT_SCALE_FACTOR + 32)) + d / 2) / d;
+}
+
+// Somme ponderee d'un canal -> valeur Q(MODEL_INPUT_SCALE_FACTOR) arrondie
+static inline int16_t resampleQuantize(uint32_t sum, uint64_t recip) {
+  return (int16_t)(((uint64_t)sum * recip + 0x80000000u) >> 32);
+}
+
+// Position bilineaire d'une sortie sur un axe de `size` pixels : indice de
+// gauche et poids Q8 du voisin, centres des pixels alignes
+static inline void resampleBilinearTap(int out, int size, int *i0, int *i1, uint32_t *frac) {
+  // ((out + 0.5) * size / 32 - 0.5) en Q8
+  int pos = ((2 * out + 1) * size * RESAMPLE_ONE) / (2 * RESAMPLE_OUT) - RESAMPLE_ONE / 2;
+  if (pos < 0) pos = 0;
+  *i0 = pos >> RESAMPLE_FRAC_BITS;
+  *frac = pos & (RESAMPLE_ONE - 1);
+  if (*i0 >= size - 1) {
+    *i0 = size - 1;
+    *frac = 0;
+  }
+  *i1 = *i0 + (*frac != 0);
+}
+
+// Intersection de [a0, a1) et [b0, b1)
+static inline uint32_t resampleOverlap(int a0, int a1, int b0, int b1) {
+  int lo = a0 > b0 ? a0 : b0;
+  int hi = a1 < b1 ? a1 : b1;
+  return hi > lo ? (uint32_t)(hi - lo) : 0;
+}
+
+/*
+  Filtre horizontal d'une ligne source vers 32 colonnes, sommes entieres :
+   - surface : la colonne x couvre [x * W, (x + 1) * W) et le pixel i
+     [32 i, 32 (i + 1)) en unites de 1/32 de pixel source, le poids est leur
+     intersection (total W par colonne) ;
+   - bilineaire : poids Q8 des deux voisins (total 256).
+*/
+static inline void resampleRow(const resampler_t *s, const unsigned short *src,
+                               uint32_t hrow[RESAMPLE_OUT][3]) {
+  for (int x = 0; x < RESAMPLE_OUT; x++) {
+    uint32_t r = 0, g = 0, b = 0;
+    if (s->mode == RESAMPLE_AREA) {
+      int x0 = x * s->width, x1 = (x + 1) * s->width;
+      for (int i = x0 / RESAMPLE_OUT; i * RESAMPLE_OUT < x1; i++) {
+        uint32_t w = resampleOverlap(x0, x1, i * RESAMPLE_OUT, (i + 1) * RESAMPLE_OUT);
+        uint16_t p = src[i];
+        r += w * (p >> 11);
+        g += w * ((p >> 5) & 0x3F);
+        b += w * (p & 0x1F);
+      }
+    } else {
+      int i0, i1;
+      uint32_t f;
+      resampleBilinearTap(x, s->width, &i0, &i1, &f);
+      uint16_t p = src[i0], q = src[i1];
+      r = (RESAMPLE_ONE - f) * (p >> 11) + f * (q >> 11);
+      g = (RESAMPLE_ONE - f) * ((p >> 5) & 0x3F) + f * ((q >> 5) & 0x3F);
+      b = (RESAMPLE_ONE - f) * (p & 0x1F) + f * (q & 0x1F);
+    }
+    hrow[x][0] = r;
+    hrow[x][1] = g;
+    hrow[x][2] = b;
+  }
+}
+
+static inline void resampleEmit(resampler_t *s, int y, uint32_t sums[RESAMPLE_OUT][3]) {
+  for (int x = 0; x < RESAMPLE_OUT; x++) {
+    s->out[y][x][0] = resampleQuantize(sums[x][0], s->recip5);
+    s->out[y][x][1] = resampleQuantize(sums[x][1], s->recip6);
+    s->out[y][x][2] = resampleQuantize(sums[x][2], s->recip5);
+  }
+}
+
+// Prepare le redimensionnement d'une source width x height vers inputs.
+// Retourne 0, ou -1 si la taille ou le mode ne sont pas supportes.
+static inline int resamplerInit(resampler_t *s, int width, int height, int mode, input_t inputs) {
+  // Les sommes d'une colonne doivent tenir sur 32 bits (63 * W * H)
+  if (width <= 0 || height <= 0 || width > 2048 || height > 2048
+      || (mode != RESAMPLE_AREA && mode != RESAMPLE_BILINEAR)) {
+    return -1;
+  }
+  uint64_t total = mode == RESAMPLE_AREA ? (uint64_t)width * height
+                                         : (uint64_t)RESAMPLE_ONE * RESAMPLE_ONE;
+  s->mode = mode;
+  s->width = width;
+  s->height = height;
+  s->row = 0;
+  s->y = 0;
+  s->recip5 = resampleReciprocal(PREPROCESS_DIV_5, total);
+  s->recip6 = resampleReciprocal(PREPROCESS_DIV_6, total);
+  memset(s->acc, 0, sizeof(s->acc));
+  s->out = inputs;
+  return 0;
+}
+
+// Vrai quand les 32 lignes de sortie sont ecrites
+static inline bool resamplerDone(const resampler_t *s) {
+  return s->y >= RESAMPLE_OUT;
+}
+
+// Consomme la ligne source suivante (width pixels)
+static inline void resamplerPushRow(resampler_t *s, const unsigned short *src) {
+  uint32_t hrow[RESAMPLE_OUT][3];
+  bool filtered = false;
+  int r = s->row++;
+
+  if (s->mode == RESAMPLE_AREA) {
+    // Lignes de sortie couvrant la ligne r, en unites de 1/32 de ligne source
+    while (s->y < RESAMPLE_OUT) {
+      int y0 = s->y * s->height, y1 = (s->y + 1) * s->height;
+      if (y0 >= (r + 1) * RESAMPLE_OUT) return;
+      uint32_t w = resampleOverlap(y0, y1, r * RESAMPLE_OUT, (r + 1) * RESAMPLE_OUT);
+      if (!filtered) {
+        resampleRow(s, src, hrow);
+        filtered = true;
+      }
+      for (int x = 0; x < RESAMPLE_OUT; x++) {
+        for (int c = 0; c < 3; c++) s->acc[x][c] += w * hrow[x][c];
+      }
+      if (y1 > (r + 1) * RESAMPLE_OUT) return; // Continue sur la ligne suivante
+      resampleEmit(s, s->y++, s->acc);
+      memset(s->acc, 0, sizeof(s->acc));
+    }
+    return;
+  }
+
+  while (s->y < RESAMPLE_OUT) {
+    int y0, y1;
+    uint32_t f;
+    resampleBilinearTap(s->y, s->height, &y0, &y1, &f);
+    if (y0 > r) return;
+    if (!filtered) {
+      resampleRow(s, src, hrow);
+      filtered = true;
+    }
+    if (y1 > r) {
+      // r = y0 : gardee pour la ligne suivante
+      memcpy(s->prev, hrow, sizeof(hrow));
+      return;
+    }
+    // y1 = r, la ligne y0 est soit r soit la precedente
+    const uint32_t (*top)[3] = y0 == r ? hrow : s->prev;
+    for (int x = 0; x < RESAMPLE_OUT; x++) {
+      for (int c = 0; c < 3; c++) {
+        s->acc[x][c] = (RESAMPLE_ONE - f) * top[x][c] + f * hrow[x][c];
+      }
+    }
+    resampleEmit(s, s->y++, s->acc);
+  }
+}
+
+// Redimensionne une image entiere (ou une ROI : src pointe sur son premier
+// pixel, stride est la largeur de l'image complete)
+static inline int resample565(const unsigned short *src, int width, int height, int stride,
+                              int mode, input_t inputs) {
+  resampler_t s;
+  if (resamplerInit(&s, width, height, mode, inputs) != 0) return -1;
+  for (int i = 0; i < height && !resamplerDone(&s); i++) {
+    resamplerPushRow(&s, &src[i * stride]);
+  }
+  return 0;
+}
+
+#endif // RESAMPLE_H
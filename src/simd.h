@@ -0,0 +1,222 @@
+/**
+  ******************************************************************************
+  * @file    simd.h
+  * @brief   int16 dot-product kernels for conv2d/dense with an ESP32-S3 PIE
+  *          backend, a host emulation of it and a portable scalar fallback
+  *
+  * Build with -DWITH_SIMD to route the inner channel dot-products of the
+  * conv2d and dense layers through dot_q15(). The backend is selected
+  * automatically:
+  *  - SIMD_BACKEND_PIE on ESP32-S3: EE.VLD.128.IP loads of 8 x int16 and
+  *    EE.VMULAS.S16.ACCX multiply-accumulate into the 40-bit ACCX register;
+  *  - SIMD_BACKEND_EMULATED on other targets when WITH_SIMD_EMULATION is
+  *    defined: a C model of the same instructions (including the address
+  *    masking of 128-bit loads), to check the PIE code path bit for bit;
+  *  - SIMD_BACKEND_SCALAR otherwise.
+  *
+  * 128-bit loads ignore the 4 low address bits, so the vector path is only
+  * taken when both operands are 16-byte aligned; other calls and the n % 8
+  * tail use the scalar loop. The low 32 bits of ACCX are returned, which
+  * wraps exactly like the int32 accumulators of the reference templates.
+  */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef _SIMD_H_
+#define _SIMD_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "nn_common.h"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(ESP_PLATFORM)
+#include "sdkconfig.h"
+#endif
+
+#define SIMD_BACKEND_SCALAR   0
+#define SIMD_BACKEND_PIE      1
+#define SIMD_BACKEND_EMULATED 2
+
+#if defined(__XTENSA__) && defined(CONFIG_IDF_TARGET_ESP32S3)
+#define SIMD_BACKEND SIMD_BACKEND_PIE
+#elif defined(WITH_SIMD_EMULATION)
+#define SIMD_BACKEND SIMD_BACKEND_EMULATED
+#else
+#define SIMD_BACKEND SIMD_BACKEND_SCALAR
+#endif
+
+#define SIMD_LANES 8
+#define SIMD_ALIGNMENT 16
+
+static inline int simd_aligned(const void *a, const void *b) {
+  return (((uintptr_t)a | (uintptr_t)b) & (SIMD_ALIGNMENT - 1)) == 0;
+}
+
+static inline int32_t dot_q15_scalar(const int16_t *a, const int16_t *b, int n) {
+  int32_t acc = 0;
+  for (int i = 0; i < n; i++) {
+    acc += (int32_t)a[i] * (int32_t)b[i];
+  }
+  return acc;
+}
+
+#if SIMD_BACKEND == SIMD_BACKEND_PIE
+
+// blocks > 0 groups of 8 lanes, a and b 16-byte aligned
+static inline int32_t dot_q15_blocks(const int16_t *a, const int16_t *b, int blocks) {
+  int32_t acc;
+  __asm__ __volatile__(
+    "ee.zero.accx\n"
+    "1:\n"
+    "ee.vld.128.ip q0, %[a], 16\n"
+    "ee.vld.128.ip q1, %[b], 16\n"
+    "addi %[n], %[n], -1\n"
+    "ee.vmulas.s16.accx q0, q1\n"
+    "bnez %[n], 1b\n"
+    "rur.accx_0 %[acc]\n"
+    : [acc] "=r"(acc), [a] "+r"(a), [b] "+r"(b), [n] "+r"(blocks)
+    :
+    : "memory");
+  return acc;
+}
+
+#elif SIMD_BACKEND == SIMD_BACKEND_EMULATED
+
+// C model of the PIE registers used by dot_q15_blocks()
+typedef struct {
+  int16_t q[2][SIMD_LANES];
+  int64_t accx;  // 40-bit accumulator
+} pie_state_t;
+
+static inline void pie_vld_128_ip(pie_state_t *pie, int reg, const int16_t **address) {
+  // EE.VLD.128.IP ignores the 4 low bits of the address
+  const int16_t *aligned = (const int16_t *)((uintptr_t)*address & ~(uintptr_t)(SIMD_ALIGNMENT - 1));
+  for (int i = 0; i < SIMD_LANES; i++) {
+    pie->q[reg][i] = aligned[i];
+  }
+  *address += SIMD_LANES;
+}
+
+static inline void pie_vmulas_s16_accx(pie_state_t *pie) {
+  int64_t sum = pie->accx;
+  for (int i = 0; i < SIMD_LANES; i++) {
+    sum += (int32_t)pie->q[0][i] * (int32_t)pie->q[1][i];
+  }
+  // Keep the 40 bits of ACCX, sign-extended
+  sum &= ((int64_t)1 << 40) - 1;
+  if (sum & ((int64_t)1 << 39)) {
+    sum -= (int64_t)1 << 40;
+  }
+  pie->accx = sum;
+}
+
+static inline int32_t pie_rur_accx_0(const pie_state_t *pie) {
+  return (int32_t)(uint32_t)((uint64_t)pie->accx & 0xFFFFFFFFu);
+}
+
+static inline int32_t dot_q15_blocks(const int16_t *a, const int16_t *b, int blocks) {
+  pie_state_t pie;
+  pie.accx = 0;
+  do {
+    pie_vld_128_ip(&pie, 0, &a);
+    pie_vld_128_ip(&pie, 1, &b);
+    pie_vmulas_s16_accx(&pie);
+  } while (--blocks);
+  return pie_rur_accx_0(&pie);
+}
+
+#endif
+
+static inline int32_t dot_q15(const int16_t *a, const int16_t *b, int n) {
+#if SIMD_BACKEND != SIMD_BACKEND_SCALAR
+  if (n >= SIMD_LANES && simd_aligned(a, b)) {
+    int blocks = n / SIMD_LANES;
+    int done = blocks * SIMD_LANES;
+    return dot_q15_blocks(a, b, blocks) + dot_q15_scalar(a + done, b + done, n - done);
+  }
+#endif
+  return dot_q15_scalar(a, b, n);
+}
+
+// conv2d without zero-padding, filters [k_begin, k_end) only: one
+// dot-product per kernel row, since a kernel row is contiguous both in the
+// HWC input and in the kernel
+static inline void conv2d_simd_q15_filters(
+  const int16_t *input,   // [input_height][input_width][input_channels]
+  const int16_t *kernel,  // [filters][kernel_size_y][kernel_size_x][input_channels]
+  const int16_t *bias,    // [filters]
+  int16_t *output,        // [output_height][output_width][filters]
+  const conv_shape_t *s,
+  const requant_t *rq,
+  int k_begin,
+  int k_end) {
+
+  const int row_len = s->kernel_size_x * s->input_channels;
+  const int depth = s->kernel_size_y * row_len;
+
+  for (int pos_y = 0; pos_y < s->output_height; pos_y++) {
+    for (int pos_x = 0; pos_x < s->output_width; pos_x++) {
+      const int16_t *window = input + ((size_t)(pos_y * s->stride_y) * s->input_width
+                                       + pos_x * s->stride_x) * s->input_channels;
+      int16_t *out = output + ((size_t)pos_y * s->output_width + pos_x) * s->filters;
+      for (int k = k_begin; k < k_end; k++) {
+        const int16_t *filter = kernel + (size_t)k * depth;
+        int32_t acc = 0;
+        for (int y = 0; y < s->kernel_size_y; y++) {
+          acc += dot_q15(window + (size_t)y * s->input_width * s->input_channels,
+                         filter + y * row_len, row_len);
+        }
+        out[k] = requantize_q15(acc, bias[k], rq);
+      }
+    }
+  }
+}
+
+static inline void conv2d_simd_q15(
+  const int16_t *input,
+  const int16_t *kernel,
+  const int16_t *bias,
+  int16_t *output,
+  const conv_shape_t *s,
+  const requant_t *rq) {
+  conv2d_simd_q15_filters(input, kernel, bias, output, s, rq, 0, s->filters);
+}
+
+// dense, units [k_begin, k_end) only
+static inline void dense_simd_q15_units(
+  const int16_t *input,   // [samples]
+  const int16_t *kernel,  // [units][samples]
+  const int16_t *bias,    // [units]
+  int16_t *output,        // [units]
+  int samples,
+  const requant_t *rq,
+  int k_begin,
+  int k_end) {
+
+  for (int k = k_begin; k < k_end; k++) {
+    output[k] = requantize_q15(dot_q15(input, kernel + (size_t)k * samples, samples), bias[k], rq);
+  }
+}
+
+static inline void dense_simd_q15(
+  const int16_t *input,
+  const int16_t *kernel,
+  const int16_t *bias,
+  int16_t *output,
+  int samples,
+  int units,
+  const requant_t *rq) {
+  dense_simd_q15_units(input, kernel, bias, output, samples, rq, 0, units);
+}
+
+#endif//_SIMD_H_
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
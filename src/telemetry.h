@@ -0,0 +1,116 @@
+/*
+  ESP32 - IA Embarquée - GTSRB
+  Université Côte d'Azur
+  Hugo Meleiro - LEAT
+
+  Telemetrie binaire : un enregistrement de taille fixe par image au lieu des
+  lignes de texte de loop() (~90 octets, plusieurs ms a 115200 bauds).
+
+  Chaque enregistrement est une trame PROTOCOL_TELEMETRY de protocol.h
+  (COBS + CRC, 21 octets sur la liaison) :
+   image u32, label u8 (0xFF si aucun), confiance u8 (Q7, 128 = 100 %),
+   pretraitement_us u16, inference_us u16, postraitement_us u16,
+   periode_us u16 (depuis l'image precedente). Les temps saturent a 65535.
+
+  telemetryPush() copie la trame dans un anneau et ne bloque jamais : si
+  l'anneau est plein l'enregistrement est perdu et compte dans dropped.
+  telemetryPeek()/telemetryConsume() vident l'anneau au rythme de la liaison,
+  main.cpp n'ecrit que ce que Serial.availableForWrite() accepte sans
+  bloquer, l'UART envoie pendant l'inference suivante. Un producteur et un
+  consommateur, eventuellement sur deux taches.
+
+  Decodage sur l'hote : tools/telemetry_decode.py.
+*/
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "protocol.h"
+
+#include <atomic>
+
+#define TELEMETRY_BODY_SIZE 14
+// Corps < 254 octets : COBS ajoute exactement un octet, plus le delimiteur
+#define TELEMETRY_RECORD_SIZE (PROTOCOL_HEADER + TELEMETRY_BODY_SIZE + PROTOCOL_CRC + 2)
+
+// Taille de l'anneau (puissance de 2), ~48 enregistrements par defaut
+#ifndef TELEMETRY_RING_SIZE
+#define TELEMETRY_RING_SIZE 1024
+#endif
+
+#if TELEMETRY_RING_SIZE & (TELEMETRY_RING_SIZE - 1)
+#error "TELEMETRY_RING_SIZE doit etre une puissance de 2"
+#endif
+
+typedef struct {
+  uint32_t frame;
+  uint8_t label;
+  uint8_t confidence;       // Q7
+  uint32_t preprocess_us;
+  uint32_t inference_us;
+  uint32_t postprocess_us;
+  uint32_t period_us;
+} telemetry_record_t;
+
+typedef struct {
+  uint8_t ring[TELEMETRY_RING_SIZE];
+  std::atomic<uint32_t> head;   // Prochain octet a envoyer (consommateur)
+  std::atomic<uint32_t> tail;   // Prochain octet libre (producteur)
+  uint32_t dropped;             // Enregistrements perdus, anneau plein
+} telemetry_t;
+
+static inline void telemetryInit(telemetry_t *t) {
+  t->head.store(0, std::memory_order_relaxed);
+  t->tail.store(0, std::memory_order_relaxed);
+  t->dropped = 0;
+}
+
+static inline uint16_t telemetrySaturate(uint32_t us) {
+  return us > 0xFFFF ? 0xFFFF : (uint16_t)us;
+}
+
+// Confiance Q15 du softmax -> Q7 arrondie
+static inline uint8_t telemetryConfidenceQ7(uint16_t confidence_q15) {
+  return (uint8_t)((confidence_q15 + (1 << 7)) >> 8);
+}
+
+// Ajoute un enregistrement ; false s'il a ete perdu
+static inline bool telemetryPush(telemetry_t *t, const telemetry_record_t *r) {
+  uint8_t body[TELEMETRY_BODY_SIZE];
+  protocolPut32(body, r->frame);
+  body[4] = r->label;
+  body[5] = r->confidence;
+  protocolPut16(body + 6, telemetrySaturate(r->preprocess_us));
+  protocolPut16(body + 8, telemetrySaturate(r->inference_us));
+  protocolPut16(body + 10, telemetrySaturate(r->postprocess_us));
+  protocolPut16(body + 12, telemetrySaturate(r->period_us));
+  uint8_t frame[PROTOCOL_FRAME_SIZE(TELEMETRY_BODY_SIZE)];
+  size_t n = protocolEncode(PROTOCOL_TELEMETRY, (uint16_t)r->frame, body, sizeof(body),
+                            frame, sizeof(frame));
+
+  uint32_t tail = t->tail.load(std::memory_order_relaxed);
+  if (TELEMETRY_RING_SIZE - (tail - t->head.load(std::memory_order_acquire)) < n) {
+    t->dropped++;
+    return false;
+  }
+  for (size_t i = 0; i < n; i++) {
+    t->ring[(tail + i) & (TELEMETRY_RING_SIZE - 1)] = frame[i];
+  }
+  t->tail.store(tail + (uint32_t)n, std::memory_order_release);
+  return true;
+}
+
+// Octets en attente contigus dans l'anneau (jusqu'a la fin du tampon)
+static inline size_t telemetryPeek(telemetry_t *t, const uint8_t **data) {
+  uint32_t head = t->head.load(std::memory_order_relaxed);
+  uint32_t pending = t->tail.load(std::memory_order_acquire) - head;
+  uint32_t offset = head & (TELEMETRY_RING_SIZE - 1);
+  *data = t->ring + offset;
+  return pending < TELEMETRY_RING_SIZE - offset ? pending : TELEMETRY_RING_SIZE - offset;
+}
+
+static inline void telemetryConsume(telemetry_t *t, size_t n) {
+  t->head.store(t->head.load(std::memory_order_relaxed) + (uint32_t)n, std::memory_order_release);
+}
+
+#endif // TELEMETRY_H
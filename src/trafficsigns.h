@@ -2,6 +2,9 @@
 // le troisième panneau est en 43x43. Il faudra donc le redimensionner
 // pour qu'il soit compatible avec votre input layer.
 
+#ifndef TRAFFICSIGNS_H
+#define TRAFFICSIGNS_H
+
 const unsigned short trafficsign1[0x400] PROGMEM = {
     0x1083, 0x10A3, 0x10A3, 0x10A3, 0x1083, 0x1083, 0x1083, 0x10A3, 0x10A3, 0x10A3, 0x10C4, 0x10C3, 0x10A3, 0x18C3, 0x10A3, 0x10A3, // 0x0010 (16)
     0x1083, 0x1083, 0x1083, 0x0882, 0x1082, 0x1082, 0x10A2, 0x0882, 0x0882, 0x0882, 0x0882, 0x0862, 0x0882, 0x1082, 0x0882, 0x1082, // 0x0020 (32)
@@ -252,4 +255,6 @@ const unsigned short trafficsign3[0x739] PROGMEM ={
     0x3983, 0x20E2, 0x10A2, 0x10A2, 0x18C3, 0x2102, 0x3183, 0x41E2, 0x7BE8, 0xB5D2, 0x73AC, 0x41E6, 0x20E3, 0x2924, 0xACB3, 0x6B2D,   // 0x0710 (1808)
     0xFFFF, 0x9D15, 0x8C94, 0x8433, 0x5AEC, 0x2944, 0x2144, 0x1904, 0x1904, 0x1904, 0x1904, 0x1905, 0x1905, 0x1925, 0x1905, 0x2125,   // 0x0720 (1824)
     0x39E8, 0xD6BA, 0xFFFE, 0xACD0, 0x5A05, 0xA32A, 0xC36A, 0xA3AB, 0x5286, 0x49C4, 0x59C4, 0x49C4, 0x20C2, 0x10A2, 0x1903, 0x2984,   // 0x0730 (1840)
-    0x31A5, 0x39C5, 0x5A85, 0x8C49, 0xA52E, 0x7BCB, 0x39A4, 0x18E2, 0x2123, };
\ No newline at end of file
+    0x31A5, 0x39C5, 0x5A85, 0x8C49, 0xA52E, 0x7BCB, 0x39A4, 0x18E2, 0x2123, };
+
+#endif // TRAFFICSIGNS_H
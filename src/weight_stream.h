@@ -0,0 +1,445 @@
+/**
+  ******************************************************************************
+  * @file    weight_stream.h
+  * @brief   Double-buffered weight prefetch for conv2d_3 and dense
+  *
+  * Built with -DWITH_WEIGHT_STREAM. conv2d_3 (3x3x64 input, 128 filters,
+  * 1x1 output) and dense (128 -> 64) read each weight exactly once per
+  * inference, so they run at the speed of the flash cache rather than of
+  * the MACs. Their kernel tables are filter-major: a block of filters is a
+  * contiguous slice of the table. The scheduler copies the next block into
+  * one of two small SRAM buffers while the current block, already in the
+  * other buffer, is multiplied:
+  *
+  *   copy 0 | wait 0, copy 1, compute 0 | wait 1, copy 2, compute 1 | ...
+  *
+  * Only one copy is in flight and it always targets the buffer whose block
+  * has just been computed, so a buffer is never overwritten while it is
+  * read. Results are bit-exact with the reference templates.
+  *
+  * The ESP32-S3 GDMA cannot read the flash (only internal SRAM and PSRAM),
+  * so the prefetch is a memcpy() run by a copier task pinned to core 0
+  * while the Arduino loop task computes on core 1: the copier absorbs the
+  * cache misses. On the host the copier is a std::thread.
+  * weight_stream_set_async(0) makes the copy synchronous, for comparisons
+  * in the same binary.
+  *
+  * For testing, weight_stream_set_trace() records the order of the copies,
+  * waits and computations of each layer call. weight_stream_check()
+  * verifies the double-buffering invariants on a trace and
+  * weight_stream_simulate() replays it with a copier and a compute unit of
+  * given costs, to estimate the latency hidden on the board.
+  */
+
+#ifndef _WEIGHT_STREAM_H_
+#define _WEIGHT_STREAM_H_
+
+#ifndef SINGLE_FILE
+#include "number.h"
+#include "nn_common.h"
+#include "simd.h"
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Size of each of the two SRAM buffers, a multiple of 16 bytes
+#ifndef WEIGHT_STREAM_BLOCK_BYTES
+#define WEIGHT_STREAM_BLOCK_BYTES 4096
+#endif
+
+typedef enum {
+  WEIGHT_STREAM_COPY,     // copy of a block started
+  WEIGHT_STREAM_WAIT,     // wait for the copy in flight
+  WEIGHT_STREAM_COMPUTE,  // block multiplied
+} weight_stream_event_type_t;
+
+typedef struct {
+  uint8_t type;     // weight_stream_event_type_t
+  uint8_t buffer;   // 0 or 1
+  uint16_t block;
+  uint16_t units;   // filters (units) of the block
+  uint32_t bytes;   // weights of the block
+} weight_stream_event_t;
+
+typedef struct {
+  weight_stream_event_t *events;
+  size_t capacity;
+  size_t count;
+  size_t dropped;   // events past capacity
+} weight_stream_trace_t;
+
+// compute(arg, weights, k_begin, k_end): filters [k_begin, k_end), weights
+// pointing at filter k_begin
+typedef void (*weight_stream_compute_t)(void *arg, const int16_t *weights, int k_begin, int k_end);
+
+static int16_t weight_stream_buffers[2][WEIGHT_STREAM_BLOCK_BYTES / sizeof(int16_t)] NN_ALIGNED;
+static size_t weight_stream_block_bytes = WEIGHT_STREAM_BLOCK_BYTES;
+static int weight_stream_async = 1;
+static weight_stream_trace_t *weight_stream_trace;
+
+static inline void weight_stream_set_async(int async) {
+  weight_stream_async = async;
+}
+
+// Bytes of each buffer actually used, at most WEIGHT_STREAM_BLOCK_BYTES
+static inline void weight_stream_set_block_bytes(size_t bytes) {
+  weight_stream_block_bytes = bytes < WEIGHT_STREAM_BLOCK_BYTES ? bytes : WEIGHT_STREAM_BLOCK_BYTES;
+}
+
+static inline void weight_stream_set_trace(weight_stream_trace_t *trace) {
+  weight_stream_trace = trace;
+}
+
+static inline void weight_stream_record(weight_stream_event_type_t type, int block, int buffer, int units,
+                                        size_t bytes) {
+  weight_stream_trace_t *t = weight_stream_trace;
+  if (t == NULL) {
+    return;
+  }
+  if (t->count == t->capacity) {
+    t->dropped++;
+    return;
+  }
+  weight_stream_event_t *e = &t->events[t->count++];
+  e->type = (uint8_t)type;
+  e->buffer = (uint8_t)buffer;
+  e->block = (uint16_t)block;
+  e->units = (uint16_t)units;
+  e->bytes = (uint32_t)bytes;
+}
+
+#if defined(ESP_PLATFORM)
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifndef WEIGHT_STREAM_COPIER_CORE
+#define WEIGHT_STREAM_COPIER_CORE 0
+#endif
+
+#ifndef WEIGHT_STREAM_COPIER_STACK
+#define WEIGHT_STREAM_COPIER_STACK 1024
+#endif
+
+static struct {
+  TaskHandle_t copier;
+  TaskHandle_t caller;
+  void *dst;
+  const void *src;
+  size_t bytes;
+  int pending;
+} weight_stream_state;
+
+static void weight_stream_copier(void *unused) {
+  (void)unused;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    memcpy(weight_stream_state.dst, weight_stream_state.src, weight_stream_state.bytes);
+    xTaskNotifyGive(weight_stream_state.caller);
+  }
+}
+
+static inline void weight_stream_copy_async(void *dst, const void *src, size_t bytes) {
+  if (weight_stream_state.copier == NULL
+      && xTaskCreatePinnedToCore(weight_stream_copier, "cnn_copier", WEIGHT_STREAM_COPIER_STACK, NULL,
+                                 uxTaskPriorityGet(NULL), &weight_stream_state.copier,
+                                 WEIGHT_STREAM_COPIER_CORE) != pdPASS) {
+    // No copier (out of memory): synchronous copy, nothing left to wait for
+    weight_stream_state.copier = NULL;
+    memcpy(dst, src, bytes);
+    return;
+  }
+  weight_stream_state.dst = dst;
+  weight_stream_state.src = src;
+  weight_stream_state.bytes = bytes;
+  weight_stream_state.caller = xTaskGetCurrentTaskHandle();
+  weight_stream_state.pending = 1;
+  xTaskNotifyGive(weight_stream_state.copier);
+}
+
+static inline void weight_stream_copy_wait(void) {
+  if (weight_stream_state.pending) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    weight_stream_state.pending = 0;
+  }
+}
+
+#elif defined(__cplusplus)
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Polls of the copier before it goes to sleep, as DUAL_CORE_SPIN
+#ifndef WEIGHT_STREAM_SPIN
+#define WEIGHT_STREAM_SPIN 100000
+#endif
+
+struct weight_stream_state_t {
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::atomic<unsigned> posted{0};
+  std::atomic<unsigned> done{0};
+  void *dst = nullptr;
+  const void *src = nullptr;
+  size_t bytes = 0;
+  int spin = std::thread::hardware_concurrency() > 1 ? WEIGHT_STREAM_SPIN : 0;
+};
+
+// Never freed: the detached copier lives until the process exits
+static weight_stream_state_t *weight_stream_state;
+
+static void weight_stream_copier(weight_stream_state_t *st) {
+  unsigned seen = 0;
+  for (;;) {
+    for (int spin = 0; spin < st->spin && st->posted.load(std::memory_order_acquire) == seen; spin++) {
+    }
+    if (st->posted.load(std::memory_order_acquire) == seen) {
+      std::unique_lock<std::mutex> lock(st->mutex);
+      st->wake.wait(lock, [&] { return st->posted.load(std::memory_order_acquire) != seen; });
+    }
+    seen = st->posted.load(std::memory_order_acquire);
+    memcpy(st->dst, st->src, st->bytes);
+    st->done.store(seen, std::memory_order_release);
+  }
+}
+
+static inline void weight_stream_copy_async(void *dst, const void *src, size_t bytes) {
+  weight_stream_state_t *st = weight_stream_state;
+  if (st == nullptr) {
+    st = weight_stream_state = new weight_stream_state_t;
+    std::thread(weight_stream_copier, st).detach();
+  }
+  st->dst = dst;
+  st->src = src;
+  st->bytes = bytes;
+  {
+    std::lock_guard<std::mutex> lock(st->mutex);
+    st->posted.store(st->posted.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+  st->wake.notify_one();
+}
+
+static inline void weight_stream_copy_wait(void) {
+  weight_stream_state_t *st = weight_stream_state;
+  if (st == nullptr) {
+    return;
+  }
+  const unsigned ticket = st->posted.load(std::memory_order_acquire);
+  for (int spin = 0; st->done.load(std::memory_order_acquire) != ticket; spin++) {
+    if (spin >= st->spin) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+#else
+
+// Plain C host build: no copier, every copy is synchronous
+static inline void weight_stream_copy_async(void *dst, const void *src, size_t bytes) {
+  memcpy(dst, src, bytes);
+}
+
+static inline void weight_stream_copy_wait(void) {
+}
+
+#endif
+
+static inline void weight_stream_copy(void *dst, const void *src, size_t bytes) {
+  if (weight_stream_async) {
+    weight_stream_copy_async(dst, src, bytes);
+  } else {
+    memcpy(dst, src, bytes);
+  }
+}
+
+static inline void weight_stream_wait(void) {
+  if (weight_stream_async) {
+    weight_stream_copy_wait();
+  }
+}
+
+// Run compute() over `units` filters of `unit_len` weights each, streaming
+// the weights through the two buffers in blocks of as many filters as fit
+static inline void weight_stream_run(
+  const int16_t *weights,  // [units][unit_len]
+  int units,
+  int unit_len,
+  weight_stream_compute_t compute,
+  void *arg) {
+
+  const size_t unit_bytes = (size_t)unit_len * sizeof(int16_t);
+  int block = (int)(weight_stream_block_bytes / unit_bytes);
+  if (block == 0) {
+    // A filter does not fit in a buffer: read it in place
+    compute(arg, weights, 0, units);
+    return;
+  }
+  if (block > units) {
+    block = units;
+  }
+  const int blocks = (units + block - 1) / block;
+
+  weight_stream_copy(weight_stream_buffers[0], weights, block * unit_bytes);
+  weight_stream_record(WEIGHT_STREAM_COPY, 0, 0, block, block * unit_bytes);
+
+  for (int b = 0; b < blocks; b++) {
+    const int k_begin = b * block;
+    const int k_end = k_begin + block < units ? k_begin + block : units;
+
+    weight_stream_wait();
+    weight_stream_record(WEIGHT_STREAM_WAIT, b, b & 1, k_end - k_begin, 0);
+
+    if (b + 1 < blocks) {
+      const int next_end = k_end + block < units ? k_end + block : units;
+      const size_t bytes = (size_t)(next_end - k_end) * unit_bytes;
+      weight_stream_copy(weight_stream_buffers[(b + 1) & 1], weights + (size_t)k_end * unit_len, bytes);
+      weight_stream_record(WEIGHT_STREAM_COPY, b + 1, (b + 1) & 1, next_end - k_end, bytes);
+    }
+
+    weight_stream_record(WEIGHT_STREAM_COMPUTE, b, b & 1, k_end - k_begin, 0);
+    compute(arg, weight_stream_buffers[b & 1], k_begin, k_end);
+  }
+}
+
+typedef struct {
+  const int16_t *input;
+  const int16_t *bias;
+  int16_t *output;
+  const conv_shape_t *shape;
+  const requant_t *rq;
+  int samples;            // dense only
+} weight_stream_layer_t;
+
+// The block holds filters [k_begin, k_end) from its start: shift bias and
+// output so that the filter range becomes [0, k_end - k_begin)
+static void weight_stream_conv2d_block(void *arg, const int16_t *weights, int k_begin, int k_end) {
+  const weight_stream_layer_t *l = (const weight_stream_layer_t *)arg;
+  conv2d_simd_q15_filters(l->input, weights, l->bias + k_begin, l->output + k_begin, l->shape, l->rq,
+                          0, k_end - k_begin);
+}
+
+static void weight_stream_dense_block(void *arg, const int16_t *weights, int k_begin, int k_end) {
+  const weight_stream_layer_t *l = (const weight_stream_layer_t *)arg;
+  dense_simd_q15_units(l->input, weights, l->bias + k_begin, l->output + k_begin, l->samples, l->rq,
+                       0, k_end - k_begin);
+}
+
+// conv2d without zero-padding, kernel streamed filter block by filter block
+static inline void weight_stream_conv2d_q15(
+  const int16_t *input,   // [input_height][input_width][input_channels]
+  const int16_t *kernel,  // [filters][kernel_size_y][kernel_size_x][input_channels]
+  const int16_t *bias,    // [filters]
+  int16_t *output,        // [output_height][output_width][filters]
+  const conv_shape_t *s,
+  const requant_t *rq) {
+
+  weight_stream_layer_t layer = {input, bias, output, s, rq, 0};
+  weight_stream_run(kernel, s->filters, s->kernel_size_y * s->kernel_size_x * s->input_channels,
+                    weight_stream_conv2d_block, &layer);
+}
+
+static inline void weight_stream_dense_q15(
+  const int16_t *input,   // [samples]
+  const int16_t *kernel,  // [units][samples]
+  const int16_t *bias,    // [units]
+  int16_t *output,        // [units]
+  int samples,
+  int units,
+  const requant_t *rq) {
+
+  weight_stream_layer_t layer = {input, bias, output, NULL, rq, samples};
+  weight_stream_run(kernel, units, samples, weight_stream_dense_block, &layer);
+}
+
+// Check a trace of one or more layer calls: blocks computed in order, each
+// after the wait that follows its copy, and no copy into a buffer whose
+// block is not computed yet. Returns 0, or the index of the first
+// offending event + 1.
+static inline size_t weight_stream_check(const weight_stream_trace_t *trace) {
+  int copied[2] = {-1, -1};     // block last copied into each buffer
+  int computed[2] = {-1, -1};   // block last computed from each buffer
+  int in_flight = -1;           // block of the copy not waited for yet
+  int ready = -1;               // block waited for, not computed yet
+  int next = 0;                 // next block to compute
+
+  for (size_t i = 0; i < trace->count; i++) {
+    const weight_stream_event_t *e = &trace->events[i];
+    switch (e->type) {
+      case WEIGHT_STREAM_COPY:
+        if (e->block == 0) {
+          // First copy of a layer call
+          copied[0] = copied[1] = computed[0] = computed[1] = -1;
+          ready = -1;
+          next = 0;
+        }
+        if (in_flight >= 0 || copied[e->buffer] != computed[e->buffer] || e->buffer != (e->block & 1)) {
+          return i + 1;
+        }
+        copied[e->buffer] = e->block;
+        in_flight = e->block;
+        break;
+      case WEIGHT_STREAM_WAIT:
+        if (in_flight != e->block) {
+          return i + 1;
+        }
+        ready = in_flight;
+        in_flight = -1;
+        break;
+      case WEIGHT_STREAM_COMPUTE:
+        if (ready != e->block || e->block != next || copied[e->buffer] != e->block) {
+          return i + 1;
+        }
+        computed[e->buffer] = e->block;
+        ready = -1;
+        next++;
+        break;
+      default:
+        return i + 1;
+    }
+  }
+  return in_flight >= 0 || ready >= 0 ? trace->count + 1 : 0;
+}
+
+// Replay a trace with one copier (copy_per_byte per weight byte) running
+// beside one compute unit (compute_per_unit per filter of a block). Returns
+// the streamed duration; *serial receives the duration with every copy
+// followed by its computation, as without the double buffer.
+static inline double weight_stream_simulate(const weight_stream_trace_t *trace, double copy_per_byte,
+                                            double compute_per_unit, double *serial) {
+  double now = 0.0;          // compute unit
+  double copier_free = 0.0;  // end of the last copy
+  double total = 0.0;
+
+  for (size_t i = 0; i < trace->count; i++) {
+    const weight_stream_event_t *e = &trace->events[i];
+    switch (e->type) {
+      case WEIGHT_STREAM_COPY: {
+        const double start = now > copier_free ? now : copier_free;
+        copier_free = start + e->bytes * copy_per_byte;
+        total += e->bytes * copy_per_byte;
+        break;
+      }
+      case WEIGHT_STREAM_WAIT:
+        if (copier_free > now) {
+          now = copier_free;
+        }
+        break;
+      case WEIGHT_STREAM_COMPUTE:
+        now += e->units * compute_per_unit;
+        total += e->units * compute_per_unit;
+        break;
+      default:
+        break;
+    }
+  }
+  if (serial != NULL) {
+    *serial = total;
+  }
+  return now;
+}
+
+#endif//_WEIGHT_STREAM_H_
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""Export the network of src/model.h as a model blob for the nn_blob.h runtime.
+
+The blob carries the layer descriptors (shapes, strides, activation,
+fixed-point shifts) and the int16 kernel/bias tables of every layer, in
+the versioned format documented in src/nn_blob.h, so that the firmware
+built with -DWITH_MODEL_BLOB can switch models without being rebuilt.
+With --fold the batch_normalization layers are replaced by the folded
+conv2d tables of src/model_bnfold.h, as with -DWITH_BN_FOLDING.
+
+Writes model.bin by default:
+
+    python3 tools/export_blob.py [--fold] [--name gtsrb-v2] [-o model.bin]
+
+On the board the blob goes to the `model` data partition of
+partitions_model.csv (offset 0x610000):
+
+    python3 -m esptool --chip esp32s3 write_flash 0x610000 model.bin
+
+On the host, the native firmware maps the file named by $MODEL_BLOB.
+"""
+
+import argparse
+import os
+import struct
+import zlib
+
+import modeltools
+
+OUTPUT = os.path.join(modeltools.ROOT, "model.bin")
+BNFOLD_H = os.path.join(modeltools.ROOT, "src", "model_bnfold.h")
+
+MAGIC = 0x4D454153  # "SAEM"
+VERSION = 1
+ALIGN = 16
+NAME_SIZE = 32
+
+HEADER = struct.Struct("<IHHIIHHHHHHI%ds" % NAME_SIZE)
+LAYER = struct.Struct("<BBBbbbHi12HIIII")
+assert HEADER.size == 64 and LAYER.size == 52
+
+CONV2D, BATCHNORM, FLATTEN, DENSE = 1, 2, 3, 4
+ACTIVATIONS = {"linear": 0, "relu": 1, "relu6": 2}
+ROUND_MODES = {"ROUND_MODE_NONE": 0, "ROUND_MODE_FLOOR": 1, "ROUND_MODE_NEAREST": 2}
+
+
+class Entry:
+    """One layer of the blob: descriptor fields plus its weight tables."""
+
+    def __init__(self, kind, layer, shape, kernel=None, bias=None, weights_scale=None, biases_scale=None):
+        self.kind = kind
+        self.layer = layer
+        self.shape = shape  # conv_shape_t fields
+        self.kernel = kernel or []
+        self.bias = bias or []
+        self.weights_scale = weights_scale if weights_scale is not None else layer.get("WEIGHTS_SCALE_FACTOR", 7)
+        self.biases_scale = biases_scale if biases_scale is not None else layer.get("BIASES_SCALE_FACTOR", 7)
+
+    def requant(self):
+        """activation, round mode and shifts, as REQUANT_FROM_LAYER()."""
+        layer = self.layer
+        tmp = layer.get("TMP_SCALE_FACTOR", 7)
+        inputs = layer.get("INPUT_SCALE_FACTOR", 7)
+        outputs = layer.get("OUTPUT_SCALE_FACTOR", 7)
+        return (ACTIVATIONS[layer.activation or "linear"],
+                ROUND_MODES[layer.defines.get("OUTPUT_ROUND_MODE", "ROUND_MODE_FLOOR")],
+                self.weights_scale - tmp, self.biases_scale - tmp - inputs, inputs + tmp - outputs,
+                6 << (inputs + tmp))
+
+    @property
+    def output_size(self):
+        return self.shape[10] * self.shape[11] * self.shape[3]
+
+
+def conv_shape(layer):
+    if layer.get("CONV_GROUPS", 1) != 1:
+        raise SystemExit("%s: grouped convolutions are not supported" % layer.name)
+    if any(layer.get(p, 0) for p in ("ZEROPADDING_TOP", "ZEROPADDING_BOTTOM", "ZEROPADDING_LEFT",
+                                     "ZEROPADDING_RIGHT")):
+        raise SystemExit("%s: zero-padding is not supported by the runtime" % layer.name)
+    return [layer.get(k) for k in ("INPUT_HEIGHT", "INPUT_WIDTH", "INPUT_CHANNELS", "CONV_FILTERS",
+                                   "CONV_KERNEL_SIZE_Y", "CONV_KERNEL_SIZE_X", "CONV_STRIDE_Y",
+                                   "CONV_STRIDE_X")] + [0, 0, layer.get("CONV_OUTHEIGHT"),
+                                                        layer.get("CONV_OUTWIDTH")]
+
+
+def folded_tables():
+    """name -> (kernel, bias, weights scale, biases scale) of model_bnfold.h."""
+    with open(BNFOLD_H, encoding="utf-8") as f:
+        text = f.read()
+    defines = modeltools.parse_defines(text)
+    tensors = {t.name: t for t in modeltools.parse_arrays(text, defines)}
+    tables = {}
+    for name, tensor in tensors.items():
+        if name.endswith("_folded_kernel"):
+            layer = name[:-len("_folded_kernel")]
+            prefix = layer.upper() + "_FOLDED_"
+            tables[layer] = (tensor.values, tensors[layer + "_folded_bias"].values,
+                             int(defines[prefix + "WEIGHTS_SCALE_FACTOR"]),
+                             int(defines[prefix + "BIASES_SCALE_FACTOR"]))
+    return tables
+
+
+def entries(layers, fold):
+    folded = folded_tables() if fold else {}
+    out = []
+    shape = None  # height, width, channels flowing between layers
+    for i, layer in enumerate(layers):
+        if layer.kind == "conv2d":
+            s = conv_shape(layer)
+            if layer.name in folded:
+                kernel, bias, wsf, bsf = folded[layer.name]
+                out.append(Entry(CONV2D, layer, s, kernel, bias, wsf, bsf))
+            else:
+                out.append(Entry(CONV2D, layer, s, layer.weights["kernel"].values, layer.weights["bias"].values))
+        elif layer.kind == "batchnorm2d":
+            nxt = layers[i + 1] if i + 1 < len(layers) else None
+            if nxt is not None and nxt.name in folded:
+                continue  # folded into the next conv2d
+            h, w, c = layer.get("INPUT_HEIGHT"), layer.get("INPUT_WIDTH"), layer.get("INPUT_CHANNELS")
+            out.append(Entry(BATCHNORM, layer, [h, w, c, c, 1, 1, 1, 1, 0, 0, h, w],
+                             layer.weights["kernel"].values, layer.weights["bias"].values))
+        elif layer.kind == "flatten":
+            h, w, c = shape
+            out.append(Entry(FLATTEN, layer, [h, w, c, h * w * c, 1, 1, 1, 1, 0, 0, 1, 1]))
+        elif layer.kind == "fc":
+            samples, units = layer.get("INPUT_SAMPLES"), layer.get("FC_UNITS")
+            out.append(Entry(DENSE, layer, [1, 1, samples, units, 1, 1, 1, 1, 0, 0, 1, 1],
+                             layer.weights["kernel"].values, layer.weights["bias"].values))
+        else:
+            raise SystemExit("%s: layer type %s is not supported" % (layer.name, layer.kind))
+        e = out[-1]
+        shape = (e.shape[10], e.shape[11], e.shape[3])
+    return out
+
+
+def align(n):
+    return (n + ALIGN - 1) // ALIGN * ALIGN
+
+
+def build(layers, fold, name):
+    items = entries(layers, fold)
+    first = items[0].shape
+    activation_size = max([first[0] * first[1] * first[2]] + [e.output_size for e in items])
+
+    # Weight sections after the descriptors, each aligned
+    offset = align(HEADER.size + LAYER.size * len(items))
+    sections = []
+    descriptors = []
+    for e in items:
+        offsets = []
+        for table in (e.kernel, e.bias):
+            if table:
+                offsets.append(offset)
+                sections.append((offset, struct.pack("<%dh" % len(table), *table)))
+                offset = align(offset + 2 * len(table))
+            else:
+                offsets.append(0)
+        activation, round_mode, wshift, bshift, oshift, relu6_max = e.requant()
+        descriptors.append(LAYER.pack(e.kind, activation, round_mode, wshift, bshift, oshift, 0, relu6_max,
+                                      *e.shape, offsets[0], len(e.kernel), offsets[1], len(e.bias)))
+    total = offset
+
+    body = bytearray(total)
+    pos = HEADER.size
+    for d in descriptors:
+        body[pos:pos + LAYER.size] = d
+        pos += LAYER.size
+    for start, data in sections:
+        body[start:start + len(data)] = data
+
+    encoded_name = name.encode("utf-8")[:NAME_SIZE - 1]
+    header = HEADER.pack(MAGIC, VERSION, HEADER.size, total, 0, len(items), LAYER.size,
+                         first[0], first[1], first[2], items[-1].output_size, activation_size, encoded_name)
+    body[0:HEADER.size] = header
+    checksum = zlib.crc32(bytes(body[16:])) & 0xFFFFFFFF
+    struct.pack_into("<I", body, 12, checksum)
+    return bytes(body), items
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("-o", "--output", default=OUTPUT, help="blob file (default: model.bin)")
+    parser.add_argument("--fold", action="store_true", help="batch-norm folded network (model_bnfold.h)")
+    parser.add_argument("--name", help="model identifier stored in the blob")
+    args = parser.parse_args()
+
+    name = args.name or ("gtsrb-bnfold" if args.fold else "gtsrb")
+    blob, items = build(modeltools.load(), args.fold, name)
+    with open(args.output, "wb") as f:
+        f.write(blob)
+    for e in items:
+        print("%-22s %-9s %5d weights" % (e.layer.name, ("", "conv2d", "batchnorm", "flatten", "dense")[e.kind],
+                                          len(e.kernel) + len(e.bias)))
+    print("%s: %d layers, %d bytes, crc32 %08x" % (name, len(items), len(blob), struct.unpack_from("<I", blob, 12)[0]))
+    print("wrote %s" % os.path.relpath(args.output, modeltools.ROOT))
+
+
+if __name__ == "__main__":
+    main()
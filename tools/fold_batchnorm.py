@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""Fold the batch_normalization layers of src/model.h into the next conv2d.
+
+Every batch_normalization_* of the network is a per-channel affine map
+``y = a[c] * x + b[c]`` (ACTIVATION_LINEAR) sitting between a ReLU conv2d
+and the next conv2d, which uses no zero-padding. It can therefore be merged
+into the following convolution:
+
+    W'[k][y][x][c] = W[k][y][x][c] * a[c]
+    bias'[k]       = bias[k] + sum_{y,x,c} W[k][y][x][c] * b[c]
+
+W * a is computed exactly in Q14 and then stored with the largest weights
+scale factor that still fits int16 (same for the bias), so the folded layers
+keep more precision than the original Q7 tables. The result is not bit-exact:
+the unfolded network floors the batch-norm output to Q7 before the next conv,
+the folded one does not. The deviation measured on the evaluation set below
+is written in the generated header.
+
+Writes src/model_bnfold.h, used when building with -DWITH_BN_FOLDING.
+Re-run after regenerating model.h:  python3 tools/fold_batchnorm.py
+"""
+
+import argparse
+import operator
+import os
+import random
+
+import modeltools
+import qmodel
+
+OUTPUT = os.path.join(modeltools.ROOT, "src", "model_bnfold.h")
+
+# Keep the int32 accumulator below 2**31 with this factor of headroom over
+# the largest accumulator observed on the evaluation set
+ACC_HEADROOM = 4
+
+
+def fit_scale(values_q14, max_scale=14):
+    """Largest scale factor <= max_scale such that values fit in int16."""
+    for sf in range(max_scale, -1, -1):
+        shift = 14 - sf
+        scaled = [round_shift(v, shift) for v in values_q14]
+        if all(qmodel.INT16_MIN <= v <= qmodel.INT16_MAX for v in scaled):
+            return sf, scaled
+    raise ValueError("values do not fit int16")
+
+
+def round_shift(value, shift):
+    """Round to nearest (ties away from zero) value / 2**shift."""
+    if shift == 0:
+        return value
+    half = 1 << (shift - 1)
+    if value >= 0:
+        return (value + half) >> shift
+    return -((-value + half) >> shift)
+
+
+def fold(bn, conv, weights_scale):
+    """Return (kernel, bias, Quant) of conv with bn folded in."""
+    a = bn.weights["kernel"].values
+    b = bn.weights["bias"].values
+    kernel = conv.weights["kernel"].values
+    bias = conv.weights["bias"].values
+    channels = len(a)
+    depth = len(kernel) // len(bias)
+
+    # Both batch-norm and conv tables are Q7 in model.h
+    assert qmodel.Quant.of(bn).weights == 7 and qmodel.Quant.of(conv).weights == 7
+
+    kernel_q14 = [w * a[i % channels] for i, w in enumerate(kernel)]
+    bias_q14 = []
+    for k, bk in enumerate(bias):
+        row = kernel[k * depth:(k + 1) * depth]
+        bias_q14.append((bk << 7) + sum(w * b[i % channels] for i, w in enumerate(row)))
+
+    wsf = min(weights_scale, fit_scale(kernel_q14)[0])
+    folded_kernel = [round_shift(v, 14 - wsf) for v in kernel_q14]
+    # CMSIS-NN requires BIASES_SCALE_FACTOR <= WEIGHTS_SCALE_FACTOR
+    bsf, folded_bias = fit_scale(bias_q14, max_scale=wsf)
+
+    quant = qmodel.Quant.of(conv)
+    quant.weights = wsf
+    quant.biases = bsf
+    return folded_kernel, folded_bias, quant
+
+
+def evaluation_set(signs, count, seed=1):
+    """Reference signs, every 32x32 crop of the 43x43 one and random images."""
+    images = []
+    for size, pixels in signs.values():
+        if size == 32:
+            images.append(qmodel.pixel_process(size, pixels))
+    for size, pixels in signs.values():
+        if size > 32:
+            for oy in range(size - 31):
+                for ox in range(size - 31):
+                    crop = [pixels[(oy + i) * size + ox + j] for i in range(32) for j in range(32)]
+                    images.append(qmodel.pixel_process(32, crop))
+    rng = random.Random(seed)
+    for _ in range(count):
+        images.append(qmodel.pixel_process(32, [rng.randrange(0x10000) for _ in range(1024)]))
+    return images
+
+
+def max_accumulator(layer_name, x_trace, kernel, depth, filters):
+    """Largest |sum W * x| over all output pixels of a conv layer."""
+    rows = [kernel[k * depth:(k + 1) * depth] for k in range(filters)]
+    best = 0
+    for start in range(0, len(x_trace), depth):
+        patch = x_trace[start:start + depth]
+        for row in rows:
+            best = max(best, abs(sum(map(operator.mul, row, patch))))
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--random", type=int, default=32,
+                        help="random images added to the evaluation set")
+    parser.add_argument("--max-weights-scale", type=int, default=14)
+    parser.add_argument("-o", "--output", default=OUTPUT)
+    args = parser.parse_args()
+
+    layers = modeltools.load()
+    names = modeltools.by_name(layers)
+    pairs = []
+    for i, layer in enumerate(layers[:-1]):
+        nxt = layers[i + 1]
+        if layer.kind == "batchnorm2d" and nxt.kind == "conv2d":
+            if layer.activation != "linear":
+                raise SystemExit("%s: only linear batch-norm can be folded" % layer.name)
+            if any(nxt.get(p, 0) for p in ("ZEROPADDING_TOP", "ZEROPADDING_BOTTOM",
+                                           "ZEROPADDING_LEFT", "ZEROPADDING_RIGHT")):
+                raise SystemExit("%s: zero-padding prevents folding" % nxt.name)
+            pairs.append((layer, nxt))
+
+    images = evaluation_set(qmodel.load_trafficsigns(), args.random)
+
+    # Pick per layer the largest weights scale factor whose accumulator keeps
+    # ACC_HEADROOM margin on the whole evaluation set
+    overrides = {}
+    traces = []
+    references = []
+    for x in images:
+        trace = {}
+        references.append(qmodel.run(layers, x, trace=trace))
+        traces.append(trace)
+    for bn, conv in pairs:
+        previous = layers[layers.index(bn) - 1].name
+        depth = len(conv.weights["kernel"].values) // len(conv.weights["bias"].values)
+        filters = len(conv.weights["bias"].values)
+        patches = []
+        height, width, channels = (conv.get("INPUT_HEIGHT"), conv.get("INPUT_WIDTH"),
+                                   conv.get("INPUT_CHANNELS"))
+        k = conv.get("CONV_KERNEL_SIZE_Y")
+        stride = conv.get("CONV_STRIDE_Y")
+        for trace in traces:
+            x = trace[previous]
+            for py in range(0, height - k + 1, stride):
+                for px in range(0, width - k + 1, stride):
+                    for y in range(k):
+                        start = ((py + y) * width + px) * channels
+                        patches.extend(x[start:start + k * channels])
+        for wsf in range(args.max_weights_scale, 6, -1):
+            kernel, bias, quant = fold(bn, conv, wsf)
+            peak = max_accumulator(conv.name, patches, kernel, depth, filters)
+            if peak * ACC_HEADROOM < 2 ** 31:
+                break
+        else:
+            raise SystemExit("%s: accumulator peak %d exceeds 2**31 / %d even with WEIGHTS_SCALE_FACTOR=7"
+                             % (conv.name, peak, ACC_HEADROOM))
+        overrides[bn.name] = None
+        overrides[conv.name] = (kernel, bias, quant)
+
+    # Deviation of the folded network on the evaluation set
+    max_dev = 0
+    total_dev = 0
+    agree = 0
+    for x, ref in zip(images, references):
+        out = qmodel.run(layers, x, overrides=overrides)
+        dev = [abs(r - o) for r, o in zip(ref, out)]
+        max_dev = max(max_dev, max(dev))
+        total_dev += sum(dev)
+        agree += ref.index(max(ref)) == out.index(max(out))
+    mean_dev = total_dev / (len(images) * len(ref))
+
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(render(pairs, overrides, len(images), max_dev, mean_dev, agree))
+
+    for bn, conv in pairs:
+        kernel, bias, quant = overrides[conv.name]
+        print("%s -> %s: WEIGHTS_SCALE_FACTOR=%d BIASES_SCALE_FACTOR=%d"
+              % (bn.name, conv.name, quant.weights, quant.biases))
+    print("evaluation: %d images, max |deviation| %d LSB (Q%d), mean %.3f LSB, top-1 agreement %d/%d"
+          % (len(images), max_dev, qmodel.Quant.of(layers[-1]).outputs, mean_dev, agree, len(images)))
+    print("wrote %s" % os.path.relpath(args.output, modeltools.ROOT))
+
+
+def render(pairs, overrides, images, max_dev, mean_dev, agree):
+    out = []
+    out.append("""/**
+  ******************************************************************************
+  * @file    model_bnfold.h
+  * @brief   conv2d weights with the preceding batch_normalization folded in
+  *
+  * GENERATED by tools/fold_batchnorm.py from src/model.h, do not edit.
+  * Used by cnn() when building with -DWITH_BN_FOLDING.
+  *
+  * Rounding tolerance against the unfolded network, measured on %d images
+  * (reference signs, all 32x32 crops of trafficsign3, random inputs):
+  *   max |output deviation| = %d LSB, mean = %.3f LSB (Q7 logits),
+  *   top-1 agreement %d/%d
+  */
+
+#ifndef _MODEL_BNFOLD_H_
+#define _MODEL_BNFOLD_H_
+
+#include <stdint.h>
+""" % (images, max_dev, mean_dev, agree, images))
+    for bn, conv in pairs:
+        kernel, bias, quant = overrides[conv.name]
+        upper = conv.name.upper()
+        shape = conv.weights["kernel"].shape
+        out.append("""
+// %s folded into %s
+#define %s_FOLDED_WEIGHTS_SCALE_FACTOR %d
+#define %s_FOLDED_BIASES_SCALE_FACTOR %d
+
+const int16_t %s_folded_bias[%d] = %s
+;
+
+const int16_t %s_folded_kernel[%d][%d][%d][%d] NN_ALIGNED = %s
+;
+""" % (bn.name, conv.name, upper, quant.weights, upper, quant.biases,
+       conv.name, len(bias), modeltools.c_array(bias),
+       conv.name, shape[0], shape[1], shape[2], shape[3], modeltools.c_array(kernel)))
+    out.append("\n#endif//_MODEL_BNFOLD_H_\n")
+    return "".join(out)
+
+
+if __name__ == "__main__":
+    main()
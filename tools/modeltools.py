@@ -0,0 +1,140 @@
+"""Helpers to read the generated src/model.h.
+
+model.h is a single-file concatenation of per-layer templates
+(``@file conv2d.cc``), weight files (``@file weights/conv2d.cc``) and the
+final ``model.cc`` holding cnn(). This module splits it back into those
+sections so the build-time tools of this directory can work on the layer
+parameters and weight tables without a C parser.
+"""
+
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MODEL_H = os.path.join(ROOT, "src", "model.h")
+
+_SECTION_RE = re.compile(r"/\*\*\n\s*\*+\n\s*\* @file\s+(\S+)\n")
+_DEFINE_RE = re.compile(r"^#define[ \t]+(\w+)(?:[ \t]+(.*?))?[ \t]*(?://.*)?$", re.M)
+_ARRAY_RE = re.compile(
+    r"const\s+(\w+)\s+(\w+)((?:\[[^\]]+\])+)\s*(?:NN_ALIGNED\s*)?=\s*(\{.*?\})\s*;", re.S)
+_FUNCTION_RE = re.compile(r"static inline void (\w+)\(")
+
+
+class Tensor:
+    """A constant weight table: flat list of ints plus its shape."""
+
+    def __init__(self, name, ctype, shape, values):
+        self.name = name
+        self.ctype = ctype
+        self.shape = shape
+        self.values = values
+
+    @property
+    def size(self):
+        n = 1
+        for d in self.shape:
+            n *= d
+        return n
+
+    def __repr__(self):
+        return "Tensor(%s, %s, %s)" % (self.name, self.ctype, self.shape)
+
+
+class Layer:
+    """A layer template (.cc section) and its compile-time parameters."""
+
+    def __init__(self, name, kind, defines):
+        self.name = name
+        self.kind = kind          # conv2d, batchnorm2d, flatten, fc
+        self.defines = defines
+        self.weights = {}         # "kernel"/"bias" -> Tensor
+
+    @property
+    def activation(self):
+        for name in ("RELU6", "RELU", "LINEAR"):
+            if "ACTIVATION_" + name in self.defines:
+                return name.lower()
+        return None
+
+    def get(self, key, default=None):
+        value = self.defines.get(key)
+        if value is None:
+            return default
+        return evaluate(value, self.defines)
+
+    def __repr__(self):
+        return "Layer(%s, %s)" % (self.name, self.kind)
+
+
+def evaluate(expr, defines):
+    """Evaluate a macro expression using the integer macros in defines."""
+    for _ in range(8):
+        replaced = re.sub(r"[A-Za-z_]\w*",
+                          lambda m: "(%s)" % defines[m.group(0)]
+                          if m.group(0) in defines else m.group(0),
+                          expr)
+        if replaced == expr:
+            break
+        expr = replaced
+    return int(eval(expr.replace("/", "//"), {"__builtins__": {}}))
+
+
+def sections(text):
+    """Yield (file name, body) for every template section of model.h."""
+    matches = list(_SECTION_RE.finditer(text))
+    for i, m in enumerate(matches):
+        end = matches[i + 1].start() if i + 1 < len(matches) else len(text)
+        yield m.group(1), text[m.start():end]
+
+
+def parse_defines(body):
+    defines = {}
+    for name, value in _DEFINE_RE.findall(body):
+        defines[name] = value.strip()
+    return defines
+
+
+def parse_arrays(body, defines):
+    tensors = []
+    for ctype, name, dims, init in _ARRAY_RE.findall(body):
+        shape = [evaluate(d, defines) for d in re.findall(r"\[([^\]]+)\]", dims)]
+        values = [int(v) for v in re.findall(r"-?\d+", init)]
+        tensor = Tensor(name, ctype, shape, values)
+        if len(values) != tensor.size:
+            raise ValueError("%s: %d values for shape %s" % (name, len(values), shape))
+        tensors.append(tensor)
+    return tensors
+
+
+def load(path=MODEL_H):
+    """Return the ordered list of layers of model.h with their weights."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+
+    layers = []
+    for filename, body in sections(text):
+        if filename.endswith(".hh") or filename in ("defines.hh", "number.hh", "model.cc"):
+            continue
+        defines = parse_defines(body)
+        if filename.startswith("weights/"):
+            for tensor in parse_arrays(body, defines):
+                layer_name, _, role = tensor.name.rpartition("_")
+                layer = next(l for l in layers if l.name == layer_name)
+                layer.weights[role] = tensor
+        else:
+            name = _FUNCTION_RE.search(body).group(1)
+            kind = os.path.splitext(filename)[0]
+            layers.append(Layer(name, kind, defines))
+    return layers
+
+
+def by_name(layers):
+    return {layer.name: layer for layer in layers}
+
+
+def c_array(values, per_line=16):
+    """Format a flat list of ints as the body of a C initializer."""
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(", ".join(str(v) for v in values[i:i + per_line]))
+    return "{" + ",\n  ".join(lines) + "}"
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+"""Pack labelled traffic-sign images into the GTPK file read by bench_gtsrb.
+
+Sources:
+  * a GTSRB tree (``Final_Training/Images/000NN/*.ppm`` with its
+    ``GT-000NN.csv``, or any ``<class>/<image>`` layout): the ROI of the CSV
+    is cropped when present, then the image is resized to --size;
+  * ``--trafficsigns``: the reference signs of src/trafficsigns.h plus every
+    32x32 crop of the 43x43 one, as a small smoke-test set.
+
+GTSRB has 43 classes, the model 28 (postprocess.h). ``--map gtsrb43`` maps
+the GTSRB class ids onto the model labels and drops the classes the model
+does not know; without it the directory names must already be model labels.
+
+PPM images are read natively; PNG/JPEG need Pillow, which is also used for
+a bilinear resize when installed (nearest-neighbour otherwise).
+
+    python3 tools/pack_gtsrb.py GTSRB/Final_Test/Images --map gtsrb43 -o test.bin
+    python3 tools/pack_gtsrb.py --trafficsigns -o smoke.bin
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+
+import qmodel
+
+try:
+    from PIL import Image
+except ImportError:  # PPM only, nearest-neighbour resize
+    Image = None
+
+MAGIC = b"GTPK"
+VERSION = 1
+
+# GTSRB class id -> model label (index in LABELS of postprocess.h)
+GTSRB43 = {
+    0: 0,    # 20 km/h
+    1: 1,    # 30 km/h
+    2: 2,    # 50 km/h
+    3: 3,    # 60 km/h
+    4: 4,    # 70 km/h
+    5: 5,    # 80 km/h
+    7: 6,    # 100 km/h
+    8: 7,    # 120 km/h
+    17: 8,   # No entry -> Wrong way
+    14: 9,   # Stop
+    13: 10,  # Yield
+    18: 11,  # General caution -> Danger
+    19: 12,  # Dangerous curve left
+    20: 13,  # Dangerous curve right
+    21: 14,  # Double curve -> Winding road
+    23: 15,  # Slippery road
+    27: 16,  # Pedestrians -> Crosswalk
+    29: 17,  # Bicycles crossing
+    31: 18,  # Wild animals crossing
+    26: 19,  # Traffic signals -> Red light
+    22: 20,  # Bumpy road
+    25: 21,  # Road work -> Workers ahead
+    36: 22,  # Go straight or right
+    37: 23,  # Go straight or left
+    33: 24,  # Turn right ahead
+    34: 25,  # Turn left ahead
+    35: 26,  # Ahead only -> Forward
+    32: 27,  # End of all limits -> End of game
+}
+
+IMAGE_EXTENSIONS = (".ppm", ".png", ".jpg", ".jpeg", ".bmp")
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def read_ppm(path):
+    """Return (width, height, bytes RGB) of a binary P6 PPM."""
+    with open(path, "rb") as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b"P6" or int(fields[3]) != 255:
+        raise ValueError("%s: not a P6 PPM with maxval 255" % path)
+    width, height = int(fields[1]), int(fields[2])
+    pos += 1
+    return width, height, data[pos:pos + width * height * 3]
+
+
+def load_tile(path, size, roi=None):
+    """Load an image, crop roi=(x1, y1, x2, y2) inclusive, resize to size x size RGB565."""
+    if Image is not None:
+        image = Image.open(path).convert("RGB")
+        if roi:
+            image = image.crop((roi[0], roi[1], roi[2] + 1, roi[3] + 1))
+        image = image.resize((size, size), Image.BILINEAR)
+        return [rgb565(*p) for p in image.getdata()]
+    if not path.lower().endswith(".ppm"):
+        raise SystemExit("%s: Pillow is needed for non-PPM images" % path)
+    width, height, rgb = read_ppm(path)
+    x0, y0, x1, y1 = roi if roi else (0, 0, width - 1, height - 1)
+    w, h = x1 - x0 + 1, y1 - y0 + 1
+    tile = []
+    for y in range(size):
+        sy = y0 + (2 * y + 1) * h // (2 * size)
+        for x in range(size):
+            sx = x0 + (2 * x + 1) * w // (2 * size)
+            i = (sy * width + sx) * 3
+            tile.append(rgb565(rgb[i], rgb[i + 1], rgb[i + 2]))
+    return tile
+
+
+def read_rois(directory):
+    """{filename: (class id, roi)} from the GT-*.csv files of a GTSRB directory."""
+    rois = {}
+    for name in os.listdir(directory):
+        if name.startswith("GT-") and name.endswith(".csv"):
+            with open(os.path.join(directory, name), newline="") as f:
+                for row in csv.DictReader(f, delimiter=";"):
+                    roi = tuple(int(row[k]) for k in ("Roi.X1", "Roi.Y1", "Roi.X2", "Roi.Y2"))
+                    class_id = int(row["ClassId"]) if "ClassId" in row else None
+                    rois[row["Filename"]] = (class_id, roi)
+    return rois
+
+
+def scan(root):
+    """Yield (path, class id, roi) for every image under root."""
+    for directory, subdirs, files in os.walk(root):
+        subdirs.sort()
+        rois = read_rois(directory)
+        parent = os.path.basename(directory)
+        for name in sorted(files):
+            if not name.lower().endswith(IMAGE_EXTENSIONS):
+                continue
+            class_id, roi = rois.get(name, (None, None))
+            if class_id is None:
+                if not parent.isdigit():
+                    continue
+                class_id = int(parent)
+            yield os.path.join(directory, name), class_id, roi
+
+
+def trafficsign_samples():
+    """(label, size, pixels) of the reference signs and the trafficsign3 crops."""
+    labels = {"trafficsign1": 4, "trafficsign2": 15, "trafficsign3": 26}
+    samples = []
+    for name, (size, pixels) in sorted(qmodel.load_trafficsigns().items()):
+        samples.append((labels[name], size, pixels))
+        if size > 32:
+            for oy in range(size - 31):
+                for ox in range(size - 31):
+                    crop = [pixels[(oy + i) * size + ox + j] for i in range(32) for j in range(32)]
+                    samples.append((labels[name], 32, crop))
+    return samples
+
+
+def write(path, samples):
+    with open(path, "wb") as f:
+        f.write(MAGIC + struct.pack("<III", VERSION, len(samples), 0))
+        for label, size, pixels in samples:
+            f.write(struct.pack("<BBH", label, size, 0))
+            f.write(struct.pack("<%dH" % len(pixels), *pixels))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("root", nargs="?", help="image directory")
+    parser.add_argument("--trafficsigns", action="store_true",
+                        help="pack the signs of src/trafficsigns.h instead")
+    parser.add_argument("--map", choices=("none", "gtsrb43"), default="none",
+                        help="class id mapping of the source directory")
+    parser.add_argument("--size", type=int, choices=(32, 43), default=32)
+    parser.add_argument("--limit", type=int, default=0, help="stop after n images")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+
+    if args.trafficsigns:
+        samples = trafficsign_samples()
+        dropped = 0
+    elif args.root:
+        samples = []
+        dropped = 0
+        for path, class_id, roi in scan(args.root):
+            label = GTSRB43.get(class_id) if args.map == "gtsrb43" else class_id
+            if label is None or not 0 <= label < 28:
+                dropped += 1
+                continue
+            samples.append((label, args.size, load_tile(path, args.size, roi)))
+            if args.limit and len(samples) >= args.limit:
+                break
+    else:
+        parser.error("give an image directory or --trafficsigns")
+
+    if not samples:
+        sys.exit("no images found")
+    write(args.output, samples)
+    print("wrote %s: %d images (%d dropped, class not known by the model)"
+          % (args.output, len(samples), dropped))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,56 @@
+"""PlatformIO pre-build hook regenerating the tables derived from model.h.
+
+Referenced from platformio.ini with ``extra_scripts = pre:tools/pio_generate.py``.
+A generated header is rebuilt when the build enables the feature that uses
+it and the header is missing or older than src/model.h or its generator.
+Builds with WITH_MEMORY_PLAN also print the per-layer RAM of their plan.
+"""
+
+import os
+import subprocess
+import sys
+
+Import("env")  # noqa: F821 (provided by PlatformIO/SCons)
+
+ROOT = env.subst("$PROJECT_DIR")  # noqa: F821
+MODEL_H = os.path.join(ROOT, "src", "model.h")
+
+# build flag -> (generator script, generated file)
+GENERATORS = [
+    ("WITH_BN_FOLDING", "tools/fold_batchnorm.py", "src/model_bnfold.h"),
+    ("WITH_MEMORY_PLAN", "tools/plan_memory.py", "src/model_arena.h"),
+    ("WITH_INT8", "tools/quantize_int8.py", "src/model_int8.h"),
+    ("WITH_SPECIALIZED_CONV", "tools/specialize_conv.py", "src/model_convspec.h"),
+    ("WITH_PACKED_WEIGHTS", "tools/repack_weights.py", "src/model_packed.h"),
+]
+
+
+def defines():
+    for define in env.get("CPPDEFINES", []):  # noqa: F821
+        yield define[0] if isinstance(define, (list, tuple)) else define
+
+
+def defined(flag):
+    return flag in defines()
+
+
+def outdated(target, sources):
+    if not os.path.exists(target):
+        return True
+    mtime = os.path.getmtime(target)
+    return any(os.path.getmtime(source) > mtime for source in sources)
+
+
+for flag, script, generated in GENERATORS:
+    if not defined(flag):
+        continue
+    script_path = os.path.join(ROOT, script)
+    target = os.path.join(ROOT, generated)
+    if outdated(target, [MODEL_H, script_path]):
+        print("Generating %s (%s)" % (generated, flag))
+        subprocess.check_call([sys.executable, script_path], cwd=ROOT)
+
+if defined("WITH_MEMORY_PLAN"):
+    flags = ["-D%s" % name for name in defines()]
+    subprocess.check_call([sys.executable, os.path.join(ROOT, "tools/plan_memory.py"), "--report"] + flags,
+                          cwd=ROOT)
@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+"""Plan every activation and layer scratch buffer of cnn() in a single arena.
+
+cnn() keeps its activations in two hand-written ping-pong unions and every
+conv2d template can add its own static scratch buffer (im2col patches,
+RGB565 rows), all of them alive for the whole program. This
+tool reads the layer shapes of src/model.h and computes, for the layers
+actually executed, the lifetime of each tensor:
+
+  - a layer output lives from the layer that writes it to the last one that
+    reads it;
+  - batch_normalization (element-wise) and flatten (same layout) write over
+    their input, so their output shares its buffer;
+  - a layer scratch buffer only lives during its layer.
+
+Buffers are then placed largest first, each at the lowest 16-byte aligned
+offset that does not overlap a buffer alive at the same time. The arena
+size is compared with the lower bound max_layer(sum of live buffers): when
+they are equal no other placement can do better.
+
+The plan depends on the build: BN folding removes layers, the convolution
+engine decides the scratch buffers. One plan is written for each variant in
+src/model_arena.h, used when building with -DWITH_MEMORY_PLAN:
+
+    python3 tools/plan_memory.py                            # all variants
+    python3 tools/plan_memory.py --report -DWITH_IM2COL_GEMM
+
+--report prints the per-layer peak RAM of the variant selected by the -D
+flags without writing the header; tools/pio_generate.py runs it on every
+build of a WITH_MEMORY_PLAN environment.
+"""
+
+import argparse
+import os
+
+import modeltools
+
+OUTPUT = os.path.join(modeltools.ROOT, "src", "model_arena.h")
+
+ALIGN = 16          # NN_ALIGNED
+SIZEOF = {"int8_t": 1, "int16_t": 2, "int32_t": 4, "int64_t": 8, "float": 4}
+
+# Convolution engine -> (description, preprocessor condition)
+KERNELS = [
+    ("direct", "reference, SIMD, dual core or specialised, no scratch",
+     "(defined(WITH_DUAL_CORE) || defined(WITH_SPECIALIZED_CONV) || !defined(WITH_IM2COL_GEMM))"),
+    ("im2col", "im2col + GEMM, patch tiles",
+     "!defined(WITH_DUAL_CORE) && !defined(WITH_SPECIALIZED_CONV) && defined(WITH_IM2COL_GEMM)"),
+]
+
+
+def align(n):
+    return (n + ALIGN - 1) // ALIGN * ALIGN
+
+
+class Buffer:
+    """A region of the arena holding one or more tensors in turn."""
+
+    def __init__(self, name, size, first):
+        self.name = name
+        self.size = size
+        self.first = first
+        self.last = first
+        self.tensors = [name]
+        self.offset = None
+
+    def live(self, step):
+        return self.first <= step <= self.last
+
+    def overlaps(self, other):
+        return self.first <= other.last and other.first <= self.last
+
+
+def output_size(layer):
+    element = SIZEOF[layer.defines["NUMBER_T"]]
+    if layer.kind == "conv2d":
+        return layer.get("CONV_OUTHEIGHT") * layer.get("CONV_OUTWIDTH") * layer.get("CONV_FILTERS") * element
+    if layer.kind == "batchnorm2d":
+        return layer.get("INPUT_HEIGHT") * layer.get("INPUT_WIDTH") * layer.get("INPUT_CHANNELS") * element
+    if layer.kind == "flatten":
+        return layer.get("OUTPUT_DIM") * element
+    if layer.kind == "fc":
+        return layer.get("FC_UNITS") * element
+    raise ValueError("%s: unsupported layer %s" % (layer.name, layer.kind))
+
+
+def scratch_size(layer, kernel, tile_pixels, first):
+    """Bytes of the scratch buffer of a conv2d template for this engine."""
+    if layer.kind != "conv2d":
+        return 0
+    element = SIZEOF[layer.defines["NUMBER_T"]]
+    ky, kx = layer.get("CONV_KERNEL_SIZE_Y"), layer.get("CONV_KERNEL_SIZE_X")
+    channels = layer.get("INPUT_CHANNELS")
+    if kernel == "im2col":
+        size = tile_pixels * ky * kx * channels * element
+    else:
+        size = 0
+    if first:
+        # cnn_rgb565() runs conv2d_rgb565() instead, with its window of rows
+        size = max(size, ky * layer.get("INPUT_WIDTH") * channels * element)
+    return size
+
+
+def plan(layers, folding, kernel, tile_pixels):
+    """(executed layers, buffers, tensor -> buffer) for one build variant."""
+    executed = [l for l in layers if not (folding and l.kind == "batchnorm2d")]
+    buffers = []
+    tensor_buffer = {}
+    previous = None          # buffer holding the input of the current layer
+    for step, layer in enumerate(executed):
+        size = scratch_size(layer, kernel, tile_pixels, step == 0)
+        if size:
+            scratch = Buffer(layer.name + "_scratch", size, step)
+            buffers.append(scratch)
+            tensor_buffer[scratch.name] = scratch
+        if previous is not None:
+            previous.last = step
+        name = layer.name + "_output"
+        if step == len(executed) - 1:
+            previous = None      # model output, passed by the caller
+        elif layer.kind in ("batchnorm2d", "flatten") and previous is not None:
+            previous.tensors.append(name)
+            tensor_buffer[name] = previous
+        else:
+            previous = Buffer(name, output_size(layer), step)
+            buffers.append(previous)
+            tensor_buffer[name] = previous
+
+    placed = []
+    for buf in sorted(buffers, key=lambda b: (-b.size, b.first)):
+        offset = 0
+        for other in sorted((p for p in placed if p.overlaps(buf)), key=lambda p: p.offset):
+            if offset + buf.size <= other.offset:
+                break
+            offset = max(offset, align(other.offset + other.size))
+        buf.offset = offset
+        placed.append(buf)
+    return executed, buffers, tensor_buffer
+
+
+def arena_size(buffers):
+    return align(max(b.offset + b.size for b in buffers)) if buffers else 0
+
+
+def lower_bound(steps, buffers):
+    return max(sum(align(b.size) for b in buffers if b.live(step)) for step in range(len(steps)))
+
+
+def legacy_size(steps, kernel, tile_pixels):
+    """Bytes of the two static unions of cnn() plus the per-template statics."""
+    unions = [0, 0]
+    index = 0
+    statics = 0
+    for step, layer in enumerate(steps):
+        statics += align(scratch_size(layer, kernel, tile_pixels, False))
+        if step == 0:
+            statics += align(scratch_size(layer, "direct", tile_pixels, True))
+        if step == len(steps) - 1:
+            break
+        if layer.kind != "flatten":
+            index ^= 1
+        unions[index] = max(unions[index], align(output_size(layer)))
+    return sum(unions) + statics
+
+
+def report(steps, buffers):
+    lines = ["  %-22s %-54s %7s %7s" % ("layer", "live buffers", "live B", "peak B")]
+    for step, layer in enumerate(steps):
+        live = [b for b in buffers if b.live(step)]
+        lines.append("  %-22s %-54s %7d %7d" % (
+            layer.name, ", ".join(b.name for b in sorted(live, key=lambda b: b.offset)),
+            sum(b.size for b in live), max(b.offset + b.size for b in live) if live else 0))
+    return lines
+
+
+def variants():
+    for folding in (False, True):
+        for kernel, description, condition in KERNELS:
+            yield folding, kernel, description, condition
+
+
+def variant_name(folding, kernel):
+    return "%s, %s" % ("batch_normalization folded" if folding else "batch_normalization kept", kernel)
+
+
+def render(layers, tile_pixels):
+    out = ["""/**
+  ******************************************************************************
+  * @file    model_arena.h
+  * @brief   Offsets of the activations and conv2d scratch buffers in cnn_arena
+  *
+  * GENERATED by tools/plan_memory.py from src/model.h, do not edit.
+  * Used by cnn() when building with -DWITH_MEMORY_PLAN: one plan per build
+  * variant (BN folding, convolution engine), each buffer at CNN_ARENA_<name>.
+  * Tensors of a same buffer (in-place layers) share their offset.
+  */
+
+#ifndef _MODEL_ARENA_H_
+#define _MODEL_ARENA_H_
+
+#include <stdint.h>
+
+#if defined(WITH_CMSIS_NN) || defined(WITH_NMSIS_NN)
+#error "WITH_MEMORY_PLAN does not plan the CMSIS-NN buffers"
+#endif
+#if defined(WITH_IM2COL_GEMM) && CONV_GEMM_TILE_PIXELS != %d
+#error "model_arena.h was planned for CONV_GEMM_TILE_PIXELS %d, run tools/plan_memory.py --tile-pixels"
+#endif
+""" % (tile_pixels, tile_pixels)]
+    keyword = "#if"
+    for folding, kernel, description, condition in variants():
+        steps, buffers, tensor_buffer = plan(layers, folding, kernel, tile_pixels)
+        folding_condition = "defined(WITH_BN_FOLDING)" if folding else "!defined(WITH_BN_FOLDING)"
+        out.append("\n%s %s && %s\n" % (keyword, folding_condition, condition))
+        keyword = "#elif"
+        out.append("// %s (%s)\n" % (variant_name(folding, kernel), description))
+        out.append("// %d bytes, lower bound %d, unions + statics %d\n"
+                   % (arena_size(buffers), lower_bound(steps, buffers), legacy_size(steps, kernel, tile_pixels)))
+        out.append("#define CNN_ARENA_SIZE %d\n" % arena_size(buffers))
+        for name, buf in sorted(tensor_buffer.items(), key=lambda item: item[1].offset):
+            out.append("#define CNN_ARENA_%s %d\n" % (name, buf.offset))
+    out.append("#endif\n")
+    out.append("""
+static uint8_t cnn_arena[CNN_ARENA_SIZE] NN_ALIGNED;
+
+#endif//_MODEL_ARENA_H_
+""")
+    return "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--output", default=OUTPUT, help="generated header (default: src/model_arena.h)")
+    parser.add_argument("--tile-pixels", type=int, default=8, help="CONV_GEMM_TILE_PIXELS of the build")
+    parser.add_argument("--report", action="store_true",
+                        help="only print the per-layer report of the variant given by the -D flags")
+    parser.add_argument("-D", dest="defines", action="append", default=[], metavar="FLAG",
+                        help="build flag selecting the variant (WITH_BN_FOLDING, WITH_IM2COL_GEMM, ...)")
+    args = parser.parse_args()
+
+    layers = modeltools.load()
+    flags = set(d.split("=", 1)[0] for d in args.defines)
+    if args.report:
+        folding = "WITH_BN_FOLDING" in flags
+        if "WITH_IM2COL_GEMM" in flags and not flags & {"WITH_DUAL_CORE", "WITH_SPECIALIZED_CONV"}:
+            kernel = "im2col"
+        else:
+            kernel = "direct"
+        selected = [(folding, kernel)]
+    else:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(render(layers, args.tile_pixels))
+        selected = [(folding, kernel) for folding, kernel, _, _ in variants()]
+
+    for folding, kernel in selected:
+        steps, buffers, _ = plan(layers, folding, kernel, args.tile_pixels)
+        size, bound = arena_size(buffers), lower_bound(steps, buffers)
+        print("cnn arena (%s): %d bytes, lower bound %d%s, unions + statics %d"
+              % (variant_name(folding, kernel), size, bound, " (optimal)" if size == bound else "",
+                 legacy_size(steps, kernel, args.tile_pixels)))
+        if args.report:
+            print("\n".join(report(steps, buffers)))
+    if not args.report:
+        print("wrote %s" % os.path.relpath(args.output, modeltools.ROOT))
+
+
+if __name__ == "__main__":
+    main()
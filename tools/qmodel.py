@@ -0,0 +1,165 @@
+"""Bit-exact Python emulation of the int16 layer templates of src/model.h.
+
+Used by the build-time tools to evaluate transformations of the network
+(batch-norm folding, quantization, ...) against the deployed fixed-point
+arithmetic without building the firmware. Activations are flat HWC lists.
+"""
+
+import operator
+import os
+import re
+
+import modeltools
+
+INT16_MIN, INT16_MAX = -32768, 32767
+
+
+def scale(number, scale_factor, nearest=False):
+    """scale_number_t_int16_t() of number.hh."""
+    if scale_factor <= 0:
+        return number << -scale_factor
+    if nearest:
+        number += 1 << (scale_factor - 1)
+    return number >> scale_factor
+
+
+def clamp16(number):
+    return max(INT16_MIN, min(INT16_MAX, number))
+
+
+class Quant:
+    """Fixed-point parameters of one layer (the *_SCALE_FACTOR macros)."""
+
+    def __init__(self, weights=7, biases=7, tmp=7, inputs=7, outputs=7,
+                 activation="linear", nearest=False):
+        self.weights = weights
+        self.biases = biases
+        self.tmp = tmp
+        self.inputs = inputs
+        self.outputs = outputs
+        self.activation = activation
+        self.nearest = nearest
+
+    @classmethod
+    def of(cls, layer):
+        return cls(layer.get("WEIGHTS_SCALE_FACTOR", 7),
+                   layer.get("BIASES_SCALE_FACTOR", 7),
+                   layer.get("TMP_SCALE_FACTOR", 7),
+                   layer.get("INPUT_SCALE_FACTOR", 7),
+                   layer.get("OUTPUT_SCALE_FACTOR", 7),
+                   layer.activation or "linear",
+                   layer.defines.get("OUTPUT_ROUND_MODE") == "ROUND_MODE_NEAREST")
+
+    def requantize(self, acc, bias):
+        acc = scale(acc, self.weights - self.tmp, self.nearest)
+        acc += scale(bias, self.biases - self.tmp - self.inputs, self.nearest)
+        if self.activation != "linear":
+            if acc < 0:
+                return 0
+            if self.activation == "relu6":
+                acc = min(acc, 6 << (self.inputs + self.tmp))
+        return clamp16(scale(acc, self.inputs + self.tmp - self.outputs, self.nearest))
+
+
+def conv2d(x, shape, kernel, bias, quant, stride=2):
+    """Valid (no zero-padding) conv2d, x is [H][W][C] flattened."""
+    height, width, channels = shape
+    filters = len(bias)
+    depth = len(kernel) // filters
+    ksize = int(round((depth // channels) ** 0.5))
+    out_h = (height - ksize) // stride + 1
+    out_w = (width - ksize) // stride + 1
+    rows = [kernel[k * depth:(k + 1) * depth] for k in range(filters)]
+    out = []
+    for pos_y in range(out_h):
+        for pos_x in range(out_w):
+            patch = []
+            for y in range(ksize):
+                start = ((pos_y * stride + y) * width + pos_x * stride) * channels
+                patch.extend(x[start:start + ksize * channels])
+            for k in range(filters):
+                acc = sum(map(operator.mul, patch, rows[k]))
+                out.append(quant.requantize(acc, bias[k]))
+    return out, (out_h, out_w, filters)
+
+
+def batchnorm(x, shape, kernel, bias, quant):
+    channels = shape[2]
+    out = []
+    for i, v in enumerate(x):
+        z = i % channels
+        tmp = scale(v * kernel[z], quant.weights - quant.tmp, quant.nearest)
+        tmp += scale(bias[z], quant.biases - quant.tmp - quant.inputs, quant.nearest)
+        out.append(clamp16(scale(tmp, quant.inputs + quant.tmp - quant.outputs, quant.nearest)))
+    return out, shape
+
+
+def dense(x, kernel, bias, quant):
+    units = len(bias)
+    samples = len(x)
+    out = []
+    for k in range(units):
+        acc = sum(map(operator.mul, x, kernel[k * samples:(k + 1) * samples]))
+        out.append(quant.requantize(acc, bias[k]))
+    return out
+
+
+def run(layers, x, shape=(32, 32, 3), overrides=None, trace=None):
+    """Run the network of model.h on one input.
+
+    overrides maps a layer name to (kernel, bias, Quant) replacing its
+    weights, or to None to skip the layer. trace, if given, is filled with
+    the output of every executed layer.
+    """
+    overrides = overrides or {}
+    for layer in layers:
+        if layer.name in overrides and overrides[layer.name] is None:
+            continue
+        if layer.name in overrides:
+            kernel, bias, quant = overrides[layer.name]
+        elif layer.weights:
+            kernel = layer.weights["kernel"].values
+            bias = layer.weights["bias"].values
+            quant = Quant.of(layer)
+        if layer.kind == "conv2d":
+            x, shape = conv2d(x, shape, kernel, bias, quant, layer.get("CONV_STRIDE_Y"))
+        elif layer.kind == "batchnorm2d":
+            x, shape = batchnorm(x, shape, kernel, bias, quant)
+        elif layer.kind == "flatten":
+            shape = (len(x),)
+        elif layer.kind == "fc":
+            x = dense(x, kernel, bias, quant)
+            shape = (len(x),)
+        else:
+            raise ValueError("unsupported layer %s" % layer.kind)
+        if trace is not None:
+            trace[layer.name] = x
+    return x
+
+
+def load_trafficsigns(path=os.path.join(modeltools.ROOT, "src", "trafficsigns.h")):
+    """Return {name: (size, rgb565 pixels)} from trafficsigns.h."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    signs = {}
+    for name, body in re.findall(r"const unsigned short (\w+)\[[^\]]*\][^=]*=\s*\{(.*?)\}", text, re.S):
+        body = re.sub(r"//[^\n]*", "", body)
+        pixels = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+        size = int(round(len(pixels) ** 0.5))
+        signs[name] = (size, pixels)
+    return signs
+
+
+def pixel_process(size, pixels):
+    """pixelProcess32 of preprocess.h, centre 32x32 crop for larger images.
+
+    This is pixelProcess43 built with PREPROCESS_43_CROP; the default one
+    resizes the whole tile (resample.h).
+    """
+    start = (size - 32) // 2
+    x = []
+    for i in range(32):
+        for j in range(32):
+            p = pixels[(i + start) * size + (j + start)]
+            x.extend(((p >> 11) & 0x1F, (p >> 5) & 0x3F, p & 0x1F))
+    return x
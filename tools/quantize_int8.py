@@ -0,0 +1,456 @@
+#!/usr/bin/env python3
+"""Quantize the network of src/model.h to int8 with per-channel scales.
+
+The int16 Q7 tables of model.h are turned back into real numbers, each
+batch_normalization is folded into the next conv2d (as fold_batchnorm.py
+does, but in floating point) and the result is quantized the usual way:
+
+  - weights: int8, symmetric, one scale per output channel
+    (max |W[k]| / 127);
+  - activations: int8, symmetric, one scale per tensor, calibrated on the
+    largest value the int16 network produces on the evaluation set;
+  - biases: int32 in the accumulator scale (input scale * weight scale);
+  - requantization: one fixed-point multiplier and shift per output
+    channel (nn_int8.h).
+
+The model input (input_t, int16) is quantized on entry and the last layer
+writes int16 logits in the format of output_t, so the int8 network is a
+drop-in replacement of cnn(). The int8 arithmetic is emulated here bit for
+bit to report its agreement with the int16 network.
+
+Writes src/model_int8.h, used when building with -DWITH_INT8 and by
+bench/bench_int8.cpp. Re-run after regenerating model.h:
+    python3 tools/quantize_int8.py
+"""
+
+import argparse
+import math
+import os
+
+import fold_batchnorm
+import modeltools
+import pack_gtsrb
+import qmodel
+
+OUTPUT = os.path.join(modeltools.ROOT, "src", "model_int8.h")
+
+INT8_MIN, INT8_MAX = -128, 127
+
+
+def real(values, scale_factor):
+    return [v / float(1 << scale_factor) for v in values]
+
+
+def round_half_up(x):
+    return int(math.floor(x + 0.5))
+
+
+def multiplier(m):
+    """(multiplier, shift) with m = multiplier / 2**shift, multiplier in [2**30, 2**31)."""
+    mantissa, exponent = math.frexp(m)
+    q = round_half_up(mantissa * (1 << 31))
+    if q == 1 << 31:
+        q //= 2
+        exponent += 1
+    shift = 31 - exponent
+    if not 0 < shift < 63:
+        raise ValueError("requantization multiplier %g out of range" % m)
+    return q, shift
+
+
+def requantize(acc, mult, shift):
+    """requantize_s8() of nn_int8.h."""
+    return (acc * mult + (1 << (shift - 1))) >> shift
+
+
+def clamp(v, lo, hi):
+    return max(lo, min(hi, v))
+
+
+class Int8Layer:
+    """A conv2d or dense layer of the int8 network."""
+
+    def __init__(self, layer, kernel, bias):
+        if layer.activation not in ("relu", "linear"):
+            raise SystemExit("%s: activation %s not supported" % (layer.name, layer.activation))
+        self.layer = layer
+        self.name = layer.name
+        self.kind = layer.kind
+        self.relu = layer.activation == "relu"
+        self.kernel = kernel        # real weights, [filters][depth]
+        self.bias = bias
+        self.filters = len(bias)
+        self.depth = len(kernel) // len(bias)
+
+    def quantize(self, input_scale, output_scale):
+        self.input_scale = input_scale
+        self.output_scale = output_scale
+        self.kernel8 = []
+        self.bias32 = []
+        self.mult = []
+        self.shift = []
+        self.weight_scales = []
+        for k in range(self.filters):
+            row = self.kernel[k * self.depth:(k + 1) * self.depth]
+            ws = max(abs(w) for w in row) / INT8_MAX or 1.0
+            self.weight_scales.append(ws)
+            self.kernel8.extend(clamp(round_half_up(w / ws), INT8_MIN, INT8_MAX) for w in row)
+            self.bias32.append(round_half_up(self.bias[k] / (input_scale * ws)))
+            m, s = multiplier(input_scale * ws / output_scale)
+            self.mult.append(m)
+            self.shift.append(s)
+
+
+def int8_network(layers):
+    """Int8Layer list of model.h, batch_normalization folded into the next conv2d."""
+    net = []
+    pending = None
+    for layer in layers:
+        quant = qmodel.Quant.of(layer)
+        if layer.kind == "batchnorm2d":
+            if layer.activation != "linear":
+                raise SystemExit("%s: only linear batch-norm can be folded" % layer.name)
+            pending = (real(layer.weights["kernel"].values, quant.weights),
+                       real(layer.weights["bias"].values, quant.biases))
+            continue
+        if layer.kind == "flatten":
+            continue
+        kernel = real(layer.weights["kernel"].values, quant.weights)
+        bias = real(layer.weights["bias"].values, quant.biases)
+        if pending is not None:
+            if layer.kind != "conv2d":
+                raise SystemExit("%s: batch-norm can only be folded into a conv2d" % layer.name)
+            a, b = pending
+            channels = len(a)
+            depth = len(kernel) // len(bias)
+            for k in range(len(bias)):
+                row = kernel[k * depth:(k + 1) * depth]
+                bias[k] += sum(w * b[i % channels] for i, w in enumerate(row))
+            kernel = [w * a[i % channels] for i, w in enumerate(kernel)]
+            pending = None
+        net.append(Int8Layer(layer, kernel, bias))
+    return net
+
+
+def calibrate(layers, net, images):
+    """Largest |real value| of the model input and of every int8 layer output."""
+    input_sf = layers[0].get("INPUT_SCALE_FACTOR", 7)
+    input_max = 0.0
+    output_max = {l.name: 0.0 for l in net}
+    for x in images:
+        input_max = max(input_max, max(abs(v) for v in x) / float(1 << input_sf))
+        trace = {}
+        qmodel.run(layers, x, trace=trace)
+        for l in net:
+            sf = l.layer.get("OUTPUT_SCALE_FACTOR", 7)
+            output_max[l.name] = max(output_max[l.name], max(abs(v) for v in trace[l.name]) / float(1 << sf))
+    return input_max, output_max
+
+
+class Int8Model:
+    def __init__(self, layers, images):
+        self.layers = layers
+        self.net = int8_network(layers)
+        self.input_sf = layers[0].get("INPUT_SCALE_FACTOR", 7)
+        self.output_sf = layers[-1].get("OUTPUT_SCALE_FACTOR", 7)
+        input_max, output_max = calibrate(layers, self.net, images)
+        self.input_scale = (input_max or 1.0) / INT8_MAX
+        self.input_mult, self.input_shift = multiplier(1.0 / (self.input_scale * (1 << self.input_sf)))
+        scale = self.input_scale
+        for l in self.net:
+            if l is self.net[-1]:
+                out = 1.0 / (1 << self.output_sf)      # int16 logits of output_t
+            else:
+                out = (output_max[l.name] or 1.0) / INT8_MAX
+            l.quantize(scale, out)
+            scale = out
+
+    def run(self, x):
+        """Bit-exact emulation of cnn_int8() on an input_t (flat HWC int16)."""
+        x = [clamp(requantize(v, self.input_mult, self.input_shift), INT8_MIN, INT8_MAX) for v in x]
+        shape = (32, 32, 3)
+        for l in self.net:
+            last = l is self.net[-1]
+            lo, hi = (qmodel.INT16_MIN, qmodel.INT16_MAX) if last else (INT8_MIN, INT8_MAX)
+            if l.relu:
+                lo = 0
+            if l.kind == "conv2d":
+                x, shape = self.conv2d(l, x, shape, lo, hi)
+            else:
+                rows = [l.kernel8[k * l.depth:(k + 1) * l.depth] for k in range(l.filters)]
+                x = [clamp(requantize(l.bias32[k] + sum(a * b for a, b in zip(x, rows[k])),
+                                      l.mult[k], l.shift[k]), lo, hi) for k in range(l.filters)]
+        return x
+
+    @staticmethod
+    def conv2d(l, x, shape, lo, hi):
+        height, width, channels = shape
+        stride = l.layer.get("CONV_STRIDE_Y")
+        ksize = l.layer.get("CONV_KERNEL_SIZE_Y")
+        out_h = (height - ksize) // stride + 1
+        out_w = (width - ksize) // stride + 1
+        rows = [l.kernel8[k * l.depth:(k + 1) * l.depth] for k in range(l.filters)]
+        out = []
+        for pos_y in range(out_h):
+            for pos_x in range(out_w):
+                patch = []
+                for y in range(ksize):
+                    start = ((pos_y * stride + y) * width + pos_x * stride) * channels
+                    patch.extend(x[start:start + ksize * channels])
+                for k in range(l.filters):
+                    acc = l.bias32[k] + sum(a * b for a, b in zip(patch, rows[k]))
+                    out.append(clamp(requantize(acc, l.mult[k], l.shift[k]), lo, hi))
+        return out, (out_h, out_w, l.filters)
+
+
+def evaluate(model, images):
+    """(max |deviation|, mean |deviation|, top-1 agreement) against the int16 network."""
+    max_dev = total_dev = agree = 0
+    for x in images:
+        ref = qmodel.run(model.layers, x)
+        out = model.run(x)
+        dev = [abs(r - o) for r, o in zip(ref, out)]
+        max_dev = max(max_dev, max(dev))
+        total_dev += sum(dev)
+        agree += ref.index(max(ref)) == out.index(max(out))
+    return max_dev, total_dev / float(len(images) * len(model.net[-1].bias)), agree
+
+
+def labelled_accuracy(model):
+    """Top-1 of the int16 and int8 networks on the labelled reference samples."""
+    correct16 = correct8 = 0
+    samples = pack_gtsrb.trafficsign_samples()
+    for label, size, pixels in samples:
+        x = qmodel.pixel_process(size, pixels)
+        ref = qmodel.run(model.layers, x)
+        out = model.run(x)
+        correct16 += ref.index(max(ref)) == label
+        correct8 += out.index(max(out)) == label
+    return correct16, correct8, len(samples)
+
+
+def weight_bytes(layers, net):
+    int16 = sum(2 * t.size for l in layers for t in l.weights.values())
+    int8 = sum(len(l.kernel8) + 4 * l.filters * 2 + l.filters for l in net)
+    return int16, int8
+
+
+def render(model, images, stats, labelled, sizes):
+    max_dev, mean_dev, agree = stats
+    correct16, correct8, samples = labelled
+    out = ["""/**
+  ******************************************************************************
+  * @file    model_int8.h
+  * @brief   int8 network with per-channel requantization (nn_int8.h)
+  *
+  * GENERATED by tools/quantize_int8.py from src/model.h, do not edit.
+  * Used by cnn() when building with -DWITH_INT8, and by bench_int8.
+  * batch_normalization is folded into the next conv2d.
+  *
+  * Against the int16 network, on %d images (reference signs, all 32x32
+  * crops of trafficsign3, random inputs):
+  *   max |output deviation| = %d LSB, mean = %.3f LSB (Q%d logits),
+  *   top-1 agreement %d/%d
+  * Labelled reference samples: int16 %d/%d, int8 %d/%d
+  * Weights, biases and requantization tables: %d bytes (int16: %d)
+  */
+
+#ifndef _MODEL_INT8_H_
+#define _MODEL_INT8_H_
+
+#include <stdint.h>
+
+#include "nn_int8.h"
+
+// input_t (Q%d) -> int8, scale %.6g
+#define CNN_INT8_INPUT_MULTIPLIER %d
+#define CNN_INT8_INPUT_SHIFT %d
+""" % (len(images), max_dev, mean_dev, model.output_sf, agree, len(images),
+       correct16, samples, correct8, samples, sizes[1], sizes[0],
+       model.input_sf, model.input_scale, model.input_mult, model.input_shift)]
+
+    for l in model.net:
+        if l.kind == "conv2d":
+            shape = "[%d][%d][%d][%d]" % (l.filters, l.layer.get("CONV_KERNEL_SIZE_Y"),
+                                          l.layer.get("CONV_KERNEL_SIZE_X"), l.layer.get("INPUT_CHANNELS"))
+        else:
+            shape = "[%d][%d]" % (l.filters, l.depth)
+        out.append("""
+// %s: input scale %.6g, output scale %.6g
+const int8_t %s_int8_kernel%s NN_ALIGNED = %s
+;
+const int32_t %s_int8_bias[%d] = %s
+;
+const int32_t %s_int8_multiplier[%d] = %s
+;
+const int8_t %s_int8_shift[%d] = %s
+;
+""" % (l.name, l.input_scale, l.output_scale,
+       l.name, shape, modeltools.c_array(l.kernel8),
+       l.name, l.filters, modeltools.c_array(l.bias32, 8),
+       l.name, l.filters, modeltools.c_array(l.mult, 8),
+       l.name, l.filters, modeltools.c_array(l.shift)))
+
+    # Call chain, ping-pong between two int8 buffers
+    sizes = [32 * 32 * 3]
+    for l in model.net[:-1]:
+        if l.kind == "conv2d":
+            sizes.append(l.layer.get("CONV_OUTHEIGHT") * l.layer.get("CONV_OUTWIDTH") * l.filters)
+        else:
+            sizes.append(l.filters)
+    buffer_size = [max(sizes[0::2]), max(sizes[1::2])]
+    out.append("""
+// int8 network on either an input_t or, when pixels is not NULL, an RGB565
+// image (see cnn_run() in model.h)
+static void cnn_int8_run(
+  const input_t input,
+  const uint16_t *pixels,
+  size_t stride,
+  const int16_t *lut_5,
+  const int16_t *lut_6,
+  output_t output) {
+
+  static int8_t activations1[%d] NN_ALIGNED;
+  static int8_t activations2[%d] NN_ALIGNED;
+
+  if (pixels != NULL) {
+    quantize_rgb565_s8(pixels, stride, 32, 32, lut_5, lut_6, activations1,
+                       CNN_INT8_INPUT_MULTIPLIER, CNN_INT8_INPUT_SHIFT);
+  } else {
+    quantize_s8((const int16_t *)input, activations1, sizeof(input_t) / sizeof(int16_t),
+                CNN_INT8_INPUT_MULTIPLIER, CNN_INT8_INPUT_SHIFT);
+  }
+""" % (buffer_size[0], buffer_size[1]))
+
+    buffers = ["activations1", "activations2"]
+    index = 0
+    names = [layer.name for layer in model.layers]
+    for l in model.net:
+        last = l is model.net[-1]
+        lo = "0" if l.relu else ("-32768" if last else "-128")
+        hi = "32767" if last else "127"
+        src = buffers[index]
+        dst = "output" if last else buffers[index ^ 1]
+        out.append("""
+  PROFILE_LAYER_BEGIN();
+  {
+    static const requant_s8_t rq = {%s_int8_multiplier, %s_int8_shift, %s, %s};
+""" % (l.name, l.name, lo, hi))
+        if l.kind == "conv2d":
+            L = l.layer
+            out.append("""    static const conv_shape_t shape = {%d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d, %d};
+    conv2d_s8(%s, (const int8_t *)%s_int8_kernel, %s_int8_bias, %s, &shape, &rq);
+""" % (L.get("INPUT_HEIGHT"), L.get("INPUT_WIDTH"), L.get("INPUT_CHANNELS"), l.filters,
+       L.get("CONV_KERNEL_SIZE_Y"), L.get("CONV_KERNEL_SIZE_X"), L.get("CONV_STRIDE_Y"), L.get("CONV_STRIDE_X"),
+       L.get("ZEROPADDING_TOP"), L.get("ZEROPADDING_LEFT"), L.get("CONV_OUTHEIGHT"), L.get("CONV_OUTWIDTH"),
+       src, l.name, l.name, dst))
+        else:
+            function = "dense_s8_q15" if last else "dense_s8"
+            out.append("""    %s(%s, (const int8_t *)%s_int8_kernel, %s_int8_bias, %s, %d, %d, &rq);
+""" % (function, src, l.name, l.name, dst, l.depth, l.filters))
+        out.append("""  }
+  PROFILE_LAYER_END(%d);
+""" % names.index(l.name))
+        index ^= 1
+
+    out.append("""
+  PROFILE_INFERENCE_END();
+}
+
+static inline void cnn_int8(const input_t input, output_t output) {
+  cnn_int8_run(input, NULL, 0, NULL, NULL, output);
+}
+""")
+
+    # Same chain on CNN_BATCH_SIZE images at a time, for cnn_batch()
+    out.append("""
+// int8 network on n images, CNN_BATCH_SIZE at a time, each layer applied to
+// the whole batch (see cnn_batch() in model.h)
+static inline void cnn_int8_batch(const input_t *inputs, output_t *outputs, size_t n) {
+  static int8_t activations1[CNN_BATCH_SIZE][%d] NN_ALIGNED;
+  static int8_t activations2[CNN_BATCH_SIZE][%d] NN_ALIGNED;
+  int8_t *buffer1[CNN_BATCH_SIZE], *buffer2[CNN_BATCH_SIZE];
+  int16_t *output[CNN_BATCH_SIZE];
+
+  for (int b = 0; b < CNN_BATCH_SIZE; b++) {
+    buffer1[b] = activations1[b];
+    buffer2[b] = activations2[b];
+  }
+  while (n > 0) {
+    const int count = n < CNN_BATCH_SIZE ? (int)n : CNN_BATCH_SIZE;
+    for (int b = 0; b < count; b++) {
+      quantize_s8((const int16_t *)inputs[b], buffer1[b], sizeof(input_t) / sizeof(int16_t),
+                  CNN_INT8_INPUT_MULTIPLIER, CNN_INT8_INPUT_SHIFT);
+      output[b] = outputs[b];
+    }
+""" % (buffer_size[0], buffer_size[1]))
+    index = 0
+    for l in model.net:
+        last = l is model.net[-1]
+        lo = "0" if l.relu else ("-32768" if last else "-128")
+        hi = "32767" if last else "127"
+        src = ["buffer1", "buffer2"][index]
+        dst = "output" if last else ["buffer1", "buffer2"][index ^ 1]
+        out.append("""    {
+      static const requant_s8_t rq = {%s_int8_multiplier, %s_int8_shift, %s, %s};
+""" % (l.name, l.name, lo, hi))
+        if l.kind == "conv2d":
+            L = l.layer
+            if L.get("ZEROPADDING_TOP") or L.get("ZEROPADDING_LEFT"):
+                raise SystemExit("%s: conv2d_s8_batch() has no zero-padding" % l.name)
+            out.append("""      static const conv_shape_t shape = {%d, %d, %d, %d, %d, %d, %d, %d, 0, 0, %d, %d};
+      conv2d_s8_batch(%s, (const int8_t *)%s_int8_kernel, %s_int8_bias, %s, count, &shape, &rq);
+""" % (L.get("INPUT_HEIGHT"), L.get("INPUT_WIDTH"), L.get("INPUT_CHANNELS"), l.filters,
+       L.get("CONV_KERNEL_SIZE_Y"), L.get("CONV_KERNEL_SIZE_X"), L.get("CONV_STRIDE_Y"), L.get("CONV_STRIDE_X"),
+       L.get("CONV_OUTHEIGHT"), L.get("CONV_OUTWIDTH"), src, l.name, l.name, dst))
+        else:
+            function = "dense_s8_q15_batch" if last else "dense_s8_batch"
+            out.append("""      %s(%s, (const int8_t *)%s_int8_kernel, %s_int8_bias, %s, count, %d, %d, &rq);
+""" % (function, src, l.name, l.name, dst, l.depth, l.filters))
+        out.append("""    }
+""")
+        index ^= 1
+
+    out.append("""
+    n -= count;
+    inputs += count;
+    outputs += count;
+  }
+}
+
+#endif//_MODEL_INT8_H_
+""")
+    return "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--random", type=int, default=32,
+                        help="random images added to the evaluation set")
+    parser.add_argument("-o", "--output", default=OUTPUT)
+    args = parser.parse_args()
+
+    layers = modeltools.load()
+    images = fold_batchnorm.evaluation_set(qmodel.load_trafficsigns(), args.random)
+    # Calibrate on the real images only, random inputs would inflate the ranges
+    calibration = images[:len(images) - args.random]
+    model = Int8Model(layers, calibration)
+    stats = evaluate(model, images)
+    labelled = labelled_accuracy(model)
+    sizes = weight_bytes(layers, model.net)
+
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(render(model, images, stats, labelled, sizes))
+
+    for l in model.net:
+        print("%-10s input scale %.6g output scale %.6g, shifts %d..%d"
+              % (l.name, l.input_scale, l.output_scale, min(l.shift), max(l.shift)))
+    print("evaluation: %d images, max |deviation| %d LSB, mean %.3f LSB, top-1 agreement %d/%d"
+          % (len(images), stats[0], stats[1], stats[2], len(images)))
+    print("labelled samples: int16 %d/%d, int8 %d/%d" % (labelled[0], labelled[2], labelled[1], labelled[2]))
+    print("weights: int16 %d bytes, int8 %d bytes" % sizes)
+    print("wrote %s" % os.path.relpath(args.output, modeltools.ROOT))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Repack the conv2d/dense kernel tables of src/model.h into filter blocks.
+
+model.h stores every conv2d kernel as [filters][y][x][c] and every dense
+kernel as [units][samples]: the reference templates compute one filter at
+a time and reload the whole input window for each of them. This tool
+rewrites each table so that the kernels of conv_packed.h can compute a
+block of B filters per window pass:
+
+    conv2d  [filters / B][y][x][c][B]
+    dense   [units / B][samples][B]
+
+i.e. channels innermost and the B weights applied to one input value next
+to each other, in the order the kernel reads them. When filters is not a
+multiple of B the last block is narrower, so every packed table keeps the
+size (and the C declaration) of the original one.
+
+The folded conv2d tables of src/model_bnfold.h are repacked too, under
+WITH_BN_FOLDING.
+
+Writes src/model_packed.h, used when building with -DWITH_PACKED_WEIGHTS.
+Re-run after regenerating model.h or model_bnfold.h:
+
+    python3 tools/repack_weights.py [--block 8]
+"""
+
+import argparse
+import os
+
+import modeltools
+
+OUTPUT = os.path.join(modeltools.ROOT, "src", "model_packed.h")
+BNFOLD_H = os.path.join(modeltools.ROOT, "src", "model_bnfold.h")
+
+
+def pack(values, filters, block):
+    """[filters][depth] -> blocks of `block` filters, filters innermost."""
+    depth = len(values) // filters
+    packed = []
+    for k0 in range(0, filters, block):
+        n = min(block, filters - k0)
+        for i in range(depth):
+            for b in range(n):
+                packed.append(values[(k0 + b) * depth + i])
+    return packed
+
+
+def declaration(name, tensor, block):
+    dims = "".join("[%d]" % d for d in tensor.shape)
+    layout = "[%d / %d]%s[%d]" % (tensor.shape[0], block, "".join("[%d]" % d for d in tensor.shape[1:]), block)
+    return """
+// %s packed %s
+const int16_t %s%s NN_ALIGNED = %s
+;
+""" % (tensor.name, layout, name, dims, modeltools.c_array(pack(tensor.values, tensor.shape[0], block)))
+
+
+def folded_kernels():
+    with open(BNFOLD_H, encoding="utf-8") as f:
+        text = f.read()
+    return [t for t in modeltools.parse_arrays(text, {}) if t.name.endswith("_folded_kernel")]
+
+
+def render(layers, folded, block):
+    out = ["""/**
+  ******************************************************************************
+  * @file    model_packed.h
+  * @brief   conv2d/dense kernels repacked in blocks of %d filters
+  *
+  * GENERATED by tools/repack_weights.py from src/model.h and
+  * src/model_bnfold.h, do not edit. Used by cnn() when building with
+  * -DWITH_PACKED_WEIGHTS, read by the kernels of conv_packed.h. The tables
+  * keep the declaration of the originals, only the order of the values
+  * changes.
+  */
+
+#ifndef _MODEL_PACKED_H_
+#define _MODEL_PACKED_H_
+
+#include <stdint.h>
+
+#if CONV_PACK_FILTERS != %d
+#error "model_packed.h was packed for CONV_PACK_FILTERS %d, run tools/repack_weights.py --block"
+#endif
+""" % (block, block, block)]
+    for layer in layers:
+        if layer.kind in ("conv2d", "fc"):
+            out.append(declaration(layer.name + "_packed_kernel", layer.weights["kernel"], block))
+    out.append("\n#ifdef WITH_BN_FOLDING\n")
+    for tensor in folded:
+        out.append(declaration(tensor.name.replace("_folded_kernel", "_folded_packed_kernel"), tensor, block))
+    out.append("#endif\n\n#endif//_MODEL_PACKED_H_\n")
+    return "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--output", default=OUTPUT, help="generated header (default: src/model_packed.h)")
+    parser.add_argument("--block", type=int, default=4, help="filters per block, CONV_PACK_FILTERS of the build")
+    args = parser.parse_args()
+
+    layers = modeltools.load()
+    folded = folded_kernels()
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(render(layers, folded, args.block))
+    for layer in layers:
+        if layer.kind in ("conv2d", "fc"):
+            shape = layer.weights["kernel"].shape
+            print("%-10s %-16s %d blocks of %d filters" % (
+                layer.name, "x".join(str(d) for d in shape), (shape[0] + args.block - 1) // args.block, args.block))
+    print("%d folded tables" % len(folded))
+    print("wrote %s" % os.path.relpath(args.output, modeltools.ROOT))
+
+
+if __name__ == "__main__":
+    main()
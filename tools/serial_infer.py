@@ -0,0 +1,318 @@
+#!/usr/bin/env python3
+"""Stream RGB565 tiles to the board over the binary serial protocol.
+
+Talks to a firmware built with -DWITH_SERIAL_PROTOCOL (src/protocol.h):
+every image is sent as a COBS frame, the board answers with the label, the
+Q15 confidence and its inference time. Reports the accuracy, the round-trip
+latency, the images/s and the bound the link speed puts on them.
+
+Images come from a GTPK pack (tools/pack_gtsrb.py) or, by default, from the
+reference signs of src/trafficsigns.h and the trafficsign3 crops.
+
+Without hardware, --loopback starts the host build of the same firmware
+(env native-protocol) on a pseudo-terminal and talks to it instead:
+
+    pio run -e native-protocol
+    python3 tools/serial_infer.py --loopback
+    python3 tools/serial_infer.py /dev/ttyACM0 --switch-baud 921600 --pack test.bin
+
+A pseudo-terminal has no baud rate: the loopback measures the protocol and
+the firmware, the wire bound is printed for the requested baud.
+"""
+
+import argparse
+import binascii
+import json
+import os
+import select
+import struct
+import subprocess
+import termios
+import time
+
+import pack_gtsrb
+import modeltools
+
+PING, IMAGE, BAUD = 0x01, 0x02, 0x03
+PONG, RESULT, ACK, ERROR = 0x81, 0x82, 0x83, 0x8F
+ERRORS = {1: "unknown message type", 2: "bad tile size", 3: "baud rate refused"}
+
+FIRMWARE = os.path.join(modeltools.ROOT, ".pio", "build", "native-protocol", "program")
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as protocolCrc16()."""
+    return binascii.crc_hqx(data, 0xFFFF)
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_pos, code = 0, 1
+    for byte in data:
+        if byte == 0:
+            out[code_pos] = code
+            code_pos, code = len(out), 1
+            out.append(0)
+        else:
+            out.append(byte)
+            code += 1
+            if code == 0xFF:
+                out[code_pos] = code
+                code_pos, code = len(out), 1
+                out.append(0)
+    out[code_pos] = code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def encode(kind, seq, body=b""):
+    raw = struct.pack("<BH", kind, seq & 0xFFFF) + body
+    return cobs_encode(raw + struct.pack("<H", crc16(raw))) + b"\0"
+
+
+def decode(frame):
+    """(type, seq, body) of a frame without its delimiter, None if corrupt."""
+    raw = cobs_decode(frame)
+    if raw is None or len(raw) < 5 or crc16(raw[:-2]) != struct.unpack("<H", raw[-2:])[0]:
+        return None
+    kind, seq = struct.unpack("<BH", raw[:3])
+    return kind, seq, raw[3:-2]
+
+
+class Link:
+    """Raw serial device (or pseudo-terminal) with a frame reader."""
+
+    def __init__(self, path, baud):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        self.pending = bytearray()
+        self.corrupt = 0
+        self.set_baud(baud)
+
+    def set_baud(self, baud):
+        attrs = termios.tcgetattr(self.fd)
+        attrs[0] = 0                                    # iflag
+        attrs[1] = 0                                    # oflag
+        attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+        attrs[3] = 0                                    # lflag
+        speed = getattr(termios, "B%d" % baud, None)
+        if speed is None:
+            raise SystemExit("baud rate %d not supported by termios" % baud)
+        attrs[4] = attrs[5] = speed
+        attrs[6][termios.VMIN] = 0
+        attrs[6][termios.VTIME] = 0
+        termios.tcsetattr(self.fd, termios.TCSANOW, attrs)
+
+    def send(self, data):
+        view = memoryview(data)
+        while view:
+            _, writable, _ = select.select([], [self.fd], [], 5.0)
+            if not writable:
+                raise SystemExit("serial write timed out")
+            view = view[os.write(self.fd, view):]
+
+    def read_available(self, timeout):
+        """Bytes received within timeout seconds, b"" if none."""
+        readable, _, _ = select.select([self.fd], [], [], timeout)
+        return os.read(self.fd, 65536) if readable else b""
+
+    def receive(self, timeout):
+        """Next valid frame (type, seq, body), None on timeout."""
+        deadline = time.monotonic() + timeout
+        while True:
+            end = self.pending.find(b"\0")
+            if end >= 0:
+                frame = bytes(self.pending[:end])
+                del self.pending[:end + 1]
+                if frame:
+                    message = decode(frame)
+                    if message is not None:
+                        return message
+                    self.corrupt += 1   # text printed by setup(), noise
+                continue
+            left = deadline - time.monotonic()
+            if left <= 0:
+                return None
+            self.pending += self.read_available(left)
+
+    def close(self):
+        os.close(self.fd)
+
+
+def load_pack(path):
+    """(label, size, pixels) of a GTPK file."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != pack_gtsrb.MAGIC:
+        raise SystemExit("%s: not a GTPK pack" % path)
+    _, count, _ = struct.unpack_from("<III", data, 4)
+    pos = 16
+    samples = []
+    for _ in range(count):
+        label, size, _ = struct.unpack_from("<BBH", data, pos)
+        pos += 4
+        pixels = data[pos:pos + 2 * size * size]
+        pos += 2 * size * size
+        samples.append((label, size, pixels))
+    return samples
+
+
+def start_loopback(firmware):
+    if not os.path.exists(firmware):
+        raise SystemExit("%s not found, build it with `pio run -e native-protocol`" % firmware)
+    env = dict(os.environ, NATIVE_SERIAL_PTY="1")
+    process = subprocess.Popen([firmware, "-1"], env=env, stdout=subprocess.DEVNULL,
+                               stderr=subprocess.PIPE, text=True)
+    line = process.stderr.readline()
+    if not line.startswith("Serial : "):
+        process.kill()
+        raise SystemExit("firmware did not open a pseudo-terminal: %r" % line)
+    return process, line.split(":", 1)[1].strip()
+
+
+def request(link, kind, seq, body, expected):
+    link.send(encode(kind, seq, body))
+    while True:
+        message = link.receive(2.0)
+        if message is None:
+            raise SystemExit("no answer from the board to message 0x%02x" % kind)
+        if message[1] == seq & 0xFFFF:
+            break
+    if message[0] == ERROR:
+        raise SystemExit("board error: %s" % ERRORS.get(message[2][0], message[2][0]))
+    if message[0] != expected:
+        raise SystemExit("unexpected answer 0x%02x to message 0x%02x" % (message[0], kind))
+    return message[2]
+
+
+def percentile(values, p):
+    ordered = sorted(values)
+    return ordered[int(round(p / 100.0 * (len(ordered) - 1)))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("port", nargs="?", help="serial device of the board")
+    parser.add_argument("--loopback", action="store_true",
+                        help="run the host firmware on a pseudo-terminal instead of a board")
+    parser.add_argument("--firmware", default=FIRMWARE, help="host firmware for --loopback")
+    parser.add_argument("--baud", type=int, default=115200, help="baud rate of the firmware at boot")
+    parser.add_argument("--switch-baud", type=int, default=0, help="ask the board for this baud rate")
+    parser.add_argument("--pack", help="GTPK file (tools/pack_gtsrb.py), reference signs otherwise")
+    parser.add_argument("--count", type=int, default=0, help="images to send (default: the whole set once)")
+    parser.add_argument("--window", type=int, default=2,
+                        help="frames in flight; 2 hides the upload of a tile behind the previous inference")
+    parser.add_argument("--json", help="write the summary to this file")
+    args = parser.parse_args()
+
+    if args.loopback == bool(args.port):
+        parser.error("give a serial port or --loopback")
+
+    if args.pack:
+        samples = load_pack(args.pack)
+    else:
+        samples = [(label, size, struct.pack("<%dH" % len(pixels), *pixels))
+                   for label, size, pixels in pack_gtsrb.trafficsign_samples()]
+    count = args.count or len(samples)
+
+    process = None
+    port = args.port
+    if args.loopback:
+        process, port = start_loopback(args.firmware)
+    link = Link(port, args.baud)
+    try:
+        link.send(b"\0")   # Ends whatever the board was receiving
+        version, max_tile, baud = struct.unpack("<BBI", request(link, PING, 0, b"", PONG))
+        if any(size > max_tile for _, size, _ in samples):
+            raise SystemExit("the board accepts tiles up to %dx%d" % (max_tile, max_tile))
+        if args.switch_baud:
+            request(link, BAUD, 1, struct.pack("<I", args.switch_baud), ACK)
+            link.set_baud(args.switch_baud)
+            time.sleep(0.05)
+            baud = struct.unpack("<BBI", request(link, PING, 2, b"", PONG))[2]
+        print("protocol v%d on %s, %d baud, %d images" % (version, port, baud, count))
+
+        sent = {}
+        latencies, inference, board_total = [], [], []
+        correct = rejected = 0
+        upload = download = 0
+        next_image = 0
+        start = time.monotonic()
+        while len(latencies) < count:
+            while next_image < count and len(sent) < args.window:
+                seq = next_image & 0xFFFF
+                index = next_image % len(samples)
+                _, size, pixels = samples[index]
+                frame = encode(IMAGE, seq, struct.pack("<BB", size, size) + pixels)
+                sent[seq] = (index, time.monotonic())
+                link.send(frame)
+                upload += len(frame)
+                next_image += 1
+            message = link.receive(5.0)
+            if message is None:
+                raise SystemExit("timed out, %d results missing" % (count - len(latencies)))
+            kind, seq, body = message
+            if seq not in sent:
+                continue
+            index, sent_at = sent.pop(seq)
+            if kind == ERROR:
+                raise SystemExit("board error on image %d: %s" % (index, ERRORS.get(body[0], body[0])))
+            label, confidence, infer_us, total_us = struct.unpack("<BHII", body)
+            latencies.append(time.monotonic() - sent_at)
+            inference.append(infer_us)
+            board_total.append(total_us)
+            download += len(encode(RESULT, seq, body))
+            correct += label == samples[index][0]
+            rejected += label == 0xFF
+        elapsed = time.monotonic() - start
+    finally:
+        link.close()
+        if process is not None:
+            process.kill()
+            process.wait()
+
+    bytes_per_image = (upload + download) / float(count)
+    # The UART is full duplex: the tiles going up are the bottleneck
+    wire_bound = baud / 10.0 / (upload / float(count))
+    summary = {
+        "images": count,
+        "accuracy": correct / float(count),
+        "rejected": rejected,
+        "images_per_s": count / elapsed,
+        "latency_ms": {"mean": 1000 * sum(latencies) / count, "p50": 1000 * percentile(latencies, 50),
+                       "p99": 1000 * percentile(latencies, 99)},
+        "board_inference_us": sum(inference) / float(count),
+        "board_total_us": sum(board_total) / float(count),
+        "bytes_per_image": bytes_per_image,
+        "baud": baud,
+        "wire_bound_images_per_s": wire_bound,
+        "corrupt_frames": link.corrupt,
+    }
+    print("accuracy %.2f%% (%d/%d, %d below threshold)"
+          % (100 * summary["accuracy"], correct, count, rejected))
+    print("throughput %.1f images/s, round trip mean %.2f ms p50 %.2f ms p99 %.2f ms (window %d)"
+          % (summary["images_per_s"], summary["latency_ms"]["mean"], summary["latency_ms"]["p50"],
+             summary["latency_ms"]["p99"], args.window))
+    print("board: inference %.1f us, tile received -> result %.1f us"
+          % (summary["board_inference_us"], summary["board_total_us"]))
+    print("link: %.0f bytes/image, at %d baud the upload alone allows %.1f images/s"
+          % (bytes_per_image, baud, wire_bound))
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(summary, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
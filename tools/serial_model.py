@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""Upload a model blob to the board and switch cnn() to it without rebooting.
+
+Talks to a firmware built with -DWITH_SERIAL_PROTOCOL -DWITH_MODEL_STORE
+(src/model_store.h): the blob of tools/export_blob.py is written in
+PROTOCOL_MODEL_CHUNK pieces to the model slot the board is not running,
+then MODEL_COMMIT makes the board check its CRC-32 and its shapes against
+input_t/output_t and switch to it between two inferences. The running model
+is kept on any error, and after a reset the board boots on the newest
+committed slot.
+
+With --check the reference signs are classified before and after the swap,
+and, with --during, also between the chunks of the upload, to show that
+inferences go on while the next model is written.
+
+Without hardware, --loopback runs the host firmware (env native-model-store)
+on a pseudo-terminal; its two slots are simulated in the --store file:
+
+    pio run -e native-model-store
+    python3 tools/export_blob.py --fold --name gtsrb-v2
+    python3 tools/serial_model.py --loopback --check --during
+    python3 tools/serial_model.py /dev/ttyACM0 --switch-baud 921600 --blob model.bin
+"""
+
+import argparse
+import os
+import struct
+import time
+
+import modeltools
+import pack_gtsrb
+import serial_infer
+from serial_infer import ACK, BAUD, IMAGE, PING, PONG, RESULT, Link, request
+
+MODEL_BEGIN, MODEL_DATA, MODEL_COMMIT, MODEL_INFO = 0x04, 0x05, 0x06, 0x07
+MODEL = 0x85
+CHUNK = 4096   # PROTOCOL_MODEL_CHUNK
+
+STATUS = {
+    0: "ok", 1: "size", 2: "magic", 3: "version", 4: "checksum", 5: "alignment", 6: "layer",
+    7: "shape", 8: "bounds", 0x10: "flash i/o", 0x11: "no upload in progress",
+    0x12: "unexpected offset", 0x13: "too large", 0x14: "incomplete",
+    0x15: "rejected, input_t/output_t differ",
+}
+OFFSET = 0x12
+
+FIRMWARE = os.path.join(modeltools.ROOT, ".pio", "build", "native-model-store", "program")
+STORE = os.path.join(modeltools.ROOT, "model_store.bin")
+
+
+class Model:
+    """Body of a MODEL reply."""
+
+    def __init__(self, body):
+        self.status, slot, self.received = struct.unpack_from("<BBI", body)
+        self.slot = None if slot == 0xFF else slot
+        self.name = body[6:38].split(b"\0", 1)[0].decode("utf-8", "replace")
+
+    def describe(self):
+        if self.slot is None:
+            return "compiled weights"
+        return "%s (slot %d)" % (self.name, self.slot)
+
+
+def model_request(link, kind, seq, body=b""):
+    return Model(request(link, kind, seq, body, MODEL))
+
+
+def classify(link, samples, seq):
+    """Labels of the samples and the mean inference time of the board."""
+    labels, inference = [], []
+    for i, (_, size, pixels) in enumerate(samples):
+        body = request(link, IMAGE, seq + i, struct.pack("<BB", size, size) + pixels, RESULT)
+        label, _, infer_us, _ = struct.unpack("<BHII", body)
+        labels.append(label)
+        inference.append(infer_us)
+    return labels, sum(inference) / float(len(inference))
+
+
+def recognised(labels, samples):
+    correct = sum(label == sample[0] for label, sample in zip(labels, samples))
+    return "%d/%d reference signs recognised" % (correct, len(samples))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("port", nargs="?", help="serial device of the board")
+    parser.add_argument("--blob", default=os.path.join(modeltools.ROOT, "model.bin"),
+                        help="blob of tools/export_blob.py (default: model.bin)")
+    parser.add_argument("--loopback", action="store_true",
+                        help="run the host firmware on a pseudo-terminal instead of a board")
+    parser.add_argument("--firmware", default=FIRMWARE, help="host firmware for --loopback")
+    parser.add_argument("--store", default=STORE, help="file simulating the model partitions (--loopback)")
+    parser.add_argument("--baud", type=int, default=115200, help="baud rate of the firmware at boot")
+    parser.add_argument("--switch-baud", type=int, default=0, help="ask the board for this baud rate")
+    parser.add_argument("--check", action="store_true", help="classify the reference signs before and after")
+    parser.add_argument("--during", action="store_true", help="also classify them between chunks")
+    args = parser.parse_args()
+
+    if args.loopback == bool(args.port):
+        parser.error("give a serial port or --loopback")
+    with open(args.blob, "rb") as f:
+        blob = f.read()
+
+    samples = [(label, size, struct.pack("<%dH" % len(pixels), *pixels))
+               for label, size, pixels in pack_gtsrb.trafficsign_samples()]
+
+    process = None
+    port = args.port
+    if args.loopback:
+        os.environ["MODEL_STORE"] = args.store
+        process, port = serial_infer.start_loopback(args.firmware)
+    link = Link(port, args.baud)
+    seq = 0
+    try:
+        link.send(b"\0")
+        version = struct.unpack("<BBI", request(link, PING, seq, b"", PONG))[0]
+        if version < 2:
+            raise SystemExit("protocol v%d has no MODEL messages, update the firmware" % version)
+        if args.switch_baud:
+            request(link, BAUD, 1, struct.pack("<I", args.switch_baud), ACK)
+            link.set_baud(args.switch_baud)
+            time.sleep(0.05)
+        seq = 2
+        info = model_request(link, MODEL_INFO, seq)
+        print("running %s" % info.describe())
+        before = None
+        if args.check:
+            before, inference = classify(link, samples, seq + 1)
+            seq += 1 + len(samples)
+            print("  %s, inference %.0f us" % (recognised(before, samples), inference))
+
+        start = time.monotonic()
+        reply = model_request(link, MODEL_BEGIN, seq, struct.pack("<I", len(blob)))
+        seq += 1
+        if reply.status:
+            raise SystemExit("upload refused: %s" % STATUS.get(reply.status, reply.status))
+        offset = 0
+        chunks = 0
+        during = []
+        while offset < len(blob):
+            reply = model_request(link, MODEL_DATA, seq, struct.pack("<I", offset) + blob[offset:offset + CHUNK])
+            seq += 1
+            if reply.status == OFFSET:
+                offset = reply.received   # resume where the board is
+                continue
+            if reply.status:
+                raise SystemExit("upload failed at %d: %s" % (offset, STATUS.get(reply.status, reply.status)))
+            offset = reply.received
+            chunks += 1
+            if args.during:
+                during.append(classify(link, samples[:1], seq)[0][0])
+                seq += 1
+        uploaded = time.monotonic()
+        reply = model_request(link, MODEL_COMMIT, seq)
+        seq += 1
+        committed = time.monotonic()
+        if reply.status:
+            raise SystemExit("commit refused: %s, still running %s"
+                             % (STATUS.get(reply.status, reply.status), reply.describe()))
+        print("uploaded %d bytes in %d chunks, %.2f s (%.0f bytes/s), commit %.1f ms"
+              % (len(blob), chunks, uploaded - start, len(blob) / max(uploaded - start, 1e-9),
+                 1000 * (committed - uploaded)))
+        if during:
+            print("  %d inferences during the upload, trafficsign1 -> %s"
+                  % (len(during), "/".join(str(label) for label in sorted(set(during)))))
+        print("running %s" % reply.describe())
+        if args.check:
+            labels, inference = classify(link, samples, seq)
+            changed = sum(a != b for a, b in zip(before, labels))
+            print("  %s, inference %.0f us, %d labels changed"
+                  % (recognised(labels, samples), inference, changed))
+    finally:
+        link.close()
+        if process is not None:
+            process.kill()
+            process.wait()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""Generate one fully specialised kernel per conv2d layer of src/model.h.
+
+The conv2d templates of model.h are written for any shape: they recompute
+input_x/input_y with the padding offsets and test them against the image
+bounds for every kernel tap. Every conv2d of this network is 3x3, stride 2,
+without zero-padding, so none of that is needed. For each layer this tool
+emits a kernel where:
+
+  - shapes and strides are literals: the window of an output pixel starts
+    stride_y input rows and stride_x input pixels after the previous one;
+  - the kernel rows of the window are unrolled: without padding a kernel
+    row is kernel_size_x * channels contiguous values both in the HWC input
+    and in the kernel, so one loop of constant trip count walks the three
+    rows side by side, each into its own accumulator (independent MAC
+    chains for a scalar core, plain reductions for a vectorizer); rows of
+    9 values or less are written out term by term;
+  - there are no bounds checks.
+
+With -DWITH_SIMD and channels a multiple of 8, every window row is 16-byte
+aligned and is handed to dot_q15() instead (simd.h).
+
+The output stage is requantize_q15() with the requant_t of the template, so
+the kernels are bit-exact with the reference templates, BN folding included.
+
+Writes src/model_convspec.h, used when building with -DWITH_SPECIALIZED_CONV.
+Re-run after regenerating model.h:  python3 tools/specialize_conv.py
+"""
+
+import argparse
+import os
+
+import modeltools
+
+OUTPUT = os.path.join(modeltools.ROOT, "src", "model_convspec.h")
+
+# Kernel rows of at most this many values are written out term by term
+UNROLL_ROW = 9
+
+
+def check(layer):
+    for key in ("ZEROPADDING_TOP", "ZEROPADDING_BOTTOM", "ZEROPADDING_LEFT", "ZEROPADDING_RIGHT"):
+        if layer.get(key, 0) != 0:
+            raise ValueError("%s: zero-padding is not supported" % layer.name)
+    if layer.get("CONV_GROUPS", 1) != 1:
+        raise ValueError("%s: grouped convolutions are not supported" % layer.name)
+
+
+def row_terms(ky, row_len, row_stride):
+    """acc terms of a window with kernel rows written out."""
+    terms = []
+    for y in range(ky):
+        for i in range(row_len):
+            terms.append("(int32_t)window[%d] * filter[%d]" % (y * row_stride + i, y * row_len + i))
+    return terms
+
+
+def kernel(layer):
+    check(layer)
+    name = layer.name
+    h, w, c = layer.get("INPUT_HEIGHT"), layer.get("INPUT_WIDTH"), layer.get("INPUT_CHANNELS")
+    f = layer.get("CONV_FILTERS")
+    ky, kx = layer.get("CONV_KERNEL_SIZE_Y"), layer.get("CONV_KERNEL_SIZE_X")
+    sy, sx = layer.get("CONV_STRIDE_Y"), layer.get("CONV_STRIDE_X")
+    oh, ow = layer.get("CONV_OUTHEIGHT"), layer.get("CONV_OUTWIDTH")
+    row_stride = w * c            # values per input row
+    row_len = kx * c              # values per kernel row
+    depth = ky * row_len          # values per filter
+
+    out = ["""
+// %s: %dx%dx%d -> %dx%dx%d, %dx%d kernel, stride %dx%d
+static inline void %s_specialized(
+  const int16_t *input,   // [%d][%d][%d]
+  const int16_t *kernel,  // [%d][%d][%d][%d]
+  const int16_t *bias,    // [%d]
+  int16_t *output,        // [%d][%d][%d]
+  const requant_t *rq) {
+
+  for (int pos_y = 0; pos_y < %d; pos_y++) {
+    const int16_t *line = input + pos_y * %d;
+    for (int pos_x = 0; pos_x < %d; pos_x++, output += %d) {
+      const int16_t *window = line + pos_x * %d;
+      const int16_t *filter = kernel;
+      for (int k = 0; k < %d; k++, filter += %d) {
+""" % (name, h, w, c, oh, ow, f, ky, kx, sy, sx,
+       name, h, w, c, f, ky, kx, c, f, oh, ow, f,
+       oh, sy * row_stride, ow, f, sx * c, f, depth)]
+
+    simd = c % 8 == 0
+    if simd:
+        out.append("#if defined(WITH_SIMD) && SIMD_BACKEND != SIMD_BACKEND_SCALAR\n")
+        dots = ["dot_q15(window%s, filter%s, %d)" % (" + %d" % (y * row_stride) if y else "",
+                                                     " + %d" % (y * row_len) if y else "", row_len)
+                for y in range(ky)]
+        out.append("        int32_t acc = %s;\n" % "\n                    + ".join(dots))
+        out.append("#else\n")
+    if row_len <= UNROLL_ROW:
+        out.append("        int32_t acc = %s;\n" % "\n                    + ".join(row_terms(ky, row_len, row_stride)))
+    else:
+        out.append("        int32_t %s;\n" % ", ".join("acc_%d = 0" % y for y in range(ky)))
+        out.append("        for (int i = 0; i < %d; i++) {\n" % row_len)
+        for y in range(ky):
+            out.append("          acc_%d += (int32_t)window[%si] * filter[%si];\n"
+                       % (y, "%d + " % (y * row_stride) if y else "", "%d + " % (y * row_len) if y else ""))
+        out.append("        }\n")
+        out.append("        int32_t acc = %s;\n" % " + ".join("acc_%d" % y for y in range(ky)))
+    if simd:
+        out.append("#endif\n")
+    out.append("""        output[k] = requantize_q15(acc, bias[k], rq);
+      }
+    }
+  }
+}
+""")
+    return "".join(out)
+
+
+def render(layers):
+    out = ["""/**
+  ******************************************************************************
+  * @file    model_convspec.h
+  * @brief   conv2d kernels specialised for the shape of each layer
+  *
+  * GENERATED by tools/specialize_conv.py from src/model.h, do not edit.
+  * Used by the conv2d templates when building with -DWITH_SPECIALIZED_CONV:
+  * literal shapes and strides, kernel rows unrolled, no padding or bounds
+  * checks. Outputs are identical to the reference templates.
+  */
+
+#ifndef _MODEL_CONVSPEC_H_
+#define _MODEL_CONVSPEC_H_
+
+#include <stdint.h>
+
+#ifndef SINGLE_FILE
+#include "nn_common.h"
+#include "simd.h"
+#endif
+"""]
+    for layer in layers:
+        if layer.kind == "conv2d":
+            out.append(kernel(layer))
+    out.append("\n#endif//_MODEL_CONVSPEC_H_\n")
+    return "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("--output", default=OUTPUT, help="generated header (default: src/model_convspec.h)")
+    args = parser.parse_args()
+
+    layers = modeltools.load()
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(render(layers))
+    for layer in layers:
+        if layer.kind == "conv2d":
+            print("%-10s %dx%dx%d -> %dx%dx%d" % (
+                layer.name, layer.get("INPUT_HEIGHT"), layer.get("INPUT_WIDTH"), layer.get("INPUT_CHANNELS"),
+                layer.get("CONV_OUTHEIGHT"), layer.get("CONV_OUTWIDTH"), layer.get("CONV_FILTERS")))
+    print("wrote %s" % os.path.relpath(args.output, modeltools.ROOT))
+
+
+if __name__ == "__main__":
+    main()
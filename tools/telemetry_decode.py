@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Decode the binary telemetry stream of a WITH_TELEMETRY firmware.
+
+The firmware sends one fixed-size PROTOCOL_TELEMETRY frame per image
+(src/telemetry.h) instead of text lines. This tool reads them from a serial
+device, a capture file or stdin, skips any text or corrupt bytes, and
+prints a summary: records, frames lost (gaps in the frame ids), labels and
+the time of every stage. --csv writes one line per record.
+
+    pio run -e native-telemetry
+    .pio/build/native-telemetry/program 3000 | python3 tools/telemetry_decode.py -
+    python3 tools/telemetry_decode.py /dev/ttyACM0 --duration 10 --csv frames.csv
+"""
+
+import argparse
+import os
+import re
+import stat
+import struct
+import sys
+import time
+
+import serial_infer
+
+TELEMETRY = 0x84
+RECORD = struct.Struct("<IBBHHHH")
+STAGES = ("preprocess_us", "inference_us", "postprocess_us", "period_us")
+
+
+def label_names():
+    """Label names of postprocess.h, index -> name."""
+    path = os.path.join(serial_infer.modeltools.ROOT, "src", "postprocess.h")
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    body = re.search(r"LABELS\[[^\]]*\]\s*=\s*\{(.*?)\};", text, re.S)
+    return re.findall(r'"([^"]*)"', body.group(1)) if body else []
+
+
+def chunks(path, duration):
+    """Raw bytes of the source until EOF or duration seconds."""
+    if path == "-":
+        stream = sys.stdin.buffer
+        while True:
+            data = stream.read1(65536)
+            if not data:
+                return
+            yield data
+    if stat.S_ISCHR(os.stat(path).st_mode):
+        link = serial_infer.Link(path, 115200)
+        deadline = time.monotonic() + duration if duration else None
+        try:
+            while deadline is None or time.monotonic() < deadline:
+                data = link.read_available(0.2)
+                if data:
+                    yield data
+        finally:
+            link.close()
+        return
+    with open(path, "rb") as f:
+        while True:
+            data = f.read(65536)
+            if not data:
+                return
+            yield data
+
+
+def records(source):
+    """(record tuple, skipped frame count so far) for every telemetry frame."""
+    pending = bytearray()
+    corrupt = 0
+    for data in source:
+        pending += data
+        while True:
+            end = pending.find(b"\0")
+            if end < 0:
+                break
+            frame = bytes(pending[:end])
+            del pending[:end + 1]
+            if not frame:
+                continue
+            message = serial_infer.decode(frame)
+            if message is None:
+                corrupt += 1
+                continue
+            kind, _, body = message
+            if kind == TELEMETRY and len(body) == RECORD.size:
+                yield RECORD.unpack(body), corrupt
+
+
+def percentile(values, p):
+    ordered = sorted(values)
+    return ordered[int(round(p / 100.0 * (len(ordered) - 1)))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("source", help="serial device, capture file or - for stdin")
+    parser.add_argument("--duration", type=float, default=0,
+                        help="seconds to listen on a serial device (default: until interrupted)")
+    parser.add_argument("--csv", help="write every record to this file")
+    args = parser.parse_args()
+
+    csv = open(args.csv, "w") if args.csv else None
+    if csv:
+        csv.write("frame,label,confidence,%s\n" % ",".join(STAGES))
+    stages = {name: [] for name in STAGES}
+    histogram = {}
+    count = lost = 0
+    corrupt = 0
+    previous = None
+    try:
+        for (frame, label, confidence, *times), corrupt in records(chunks(args.source, args.duration)):
+            count += 1
+            if previous is not None and frame > previous + 1:
+                lost += frame - previous - 1
+            previous = frame
+            histogram[label] = histogram.get(label, 0) + 1
+            for name, value in zip(STAGES, times):
+                # The first period has no previous image
+                if name != "period_us" or value:
+                    stages[name].append(value)
+            if csv:
+                csv.write("%d,%d,%.4f,%s\n" % (frame, label, confidence / 128.0,
+                                               ",".join(str(t) for t in times)))
+    except KeyboardInterrupt:
+        pass
+    if csv:
+        csv.close()
+
+    if count == 0:
+        sys.exit("no telemetry record found")
+    print("%d records, %d frames lost, %d skipped (text or corrupt)" % (count, lost, corrupt))
+    for name in STAGES:
+        values = stages[name]
+        if values:
+            print("%-16s mean %9.1f us  p50 %7d us  p99 %7d us  max %7d us"
+                  % (name, sum(values) / float(len(values)), percentile(values, 50),
+                     percentile(values, 99), max(values)))
+    if stages["period_us"]:
+        print("rate %.1f images/s" % (1e6 * len(stages["period_us"]) / sum(stages["period_us"])))
+    names = label_names()
+    for label, n in sorted(histogram.items(), key=lambda item: -item[1]):
+        name = "none" if label == 0xFF else (names[label] if label < len(names) else "?")
+        print("  label %3d %-24s %d" % (label, name, n))
+
+
+if __name__ == "__main__":
+    main()